@@ -161,8 +161,32 @@ void u54_4(void) {
 };
 #endif
 
+#if defined(MULTITHREAD) && (MULTITHREAD > 1)
+/*
+ * With MULTITHREAD set, the U54s not running main() run the contexts given to
+ * them by core_start_parallel().
+ */
+#ifndef TEST_CORE_U54_1
+void u54_1(void) {
+    coremark_hart_worker();
+};
+#endif
 
+#ifndef TEST_CORE_U54_2
+void u54_2(void) {
+    coremark_hart_worker();
+};
+#endif
 
+#ifndef TEST_CORE_U54_3
+void u54_3(void) {
+    coremark_hart_worker();
+};
+#endif
 
-
-
+#ifndef TEST_CORE_U54_4
+void u54_4(void) {
+    coremark_hart_worker();
+};
+#endif
+#endif
@@ -108,7 +108,94 @@ secs_ret time_in_secs(CORE_TICKS ticks) {
 	return retval;
 }
 
-ee_u32 default_num_contexts=1;
+ee_u32 default_num_contexts=MULTITHREAD;
+
+#if (MEM_METHOD==MEM_MALLOC)
+/* Next free byte at COREMARK_DATA_BASE. The blocks are only freed at the end of the run. */
+static ee_ptr_int data_next = (ee_ptr_int)COREMARK_DATA_BASE;
+
+/* Function : portable_malloc
+	Hands out the data blocks of the contexts from COREMARK_DATA_BASE, each on
+	its own cache line so the harts do not share lines.
+*/
+void *portable_malloc(ee_size_t size)
+{
+	void *block = (void *)data_next;
+
+	data_next += (size + 63U) & ~(ee_ptr_int)63U;
+	return block;
+}
+
+void portable_free(void *p)
+{
+	(void)p;
+	data_next = (ee_ptr_int)COREMARK_DATA_BASE;
+}
+#endif
+
+#if (MULTITHREAD>1)
+/* Context given to each hart by core_start_parallel(), see coremark_hart_worker() */
+static core_results * volatile hart_context[5];
+static core_results *main_context;
+static ee_u32 next_hart;
+
+/* Function : core_start_parallel
+	The first context is kept to be run on this hart by core_stop_parallel().
+	Each of the others is given to the next U54 up, skipping this hart.
+*/
+ee_u8 core_start_parallel(core_results *res)
+{
+	uint32_t hartid = read_csr(mhartid);
+
+	res->port.done = 0U;
+	if (NULL == main_context) {
+		main_context = res;
+		res->port.hart = (ee_u8)hartid;
+		next_hart = 1U;
+	} else {
+		if (next_hart == hartid) {
+			next_hart++;
+		}
+		res->port.hart = (ee_u8)next_hart;
+		mb();
+		hart_context[next_hart] = res;
+		next_hart++;
+	}
+	return 0;
+}
+
+/* Function : core_stop_parallel
+	Runs the context kept for this hart, then waits for the context to complete.
+*/
+ee_u8 core_stop_parallel(core_results *res)
+{
+	if (res == main_context) {
+		iterate(res);
+		res->port.done = 1U;
+	}
+	while (0U == res->port.done) {
+	}
+	mb();
+	return 0;
+}
+
+void coremark_hart_worker(void)
+{
+	uint32_t hartid = read_csr(mhartid);
+	core_results *res;
+
+	for (;;) {
+		res = hart_context[hartid];
+		if (NULL != res) {
+			hart_context[hartid] = NULL;
+			mb();
+			iterate(res);
+			mb();
+			res->port.done = 1U;
+		}
+	}
+}
+#endif
 
 /* Function : portable_init
 	Target specific initialization code 
@@ -141,9 +228,32 @@ void portable_init(core_portable *p, int *argc, char *argv[])
 }
 /* Function : portable_fini
 	Target specific final code 
+	Prints the results in lines starting COREMARK_CONTEXT and COREMARK_RESULT,
+	one field per key=value pair, for scripts to pick out of the log. The way
+	masks are those of the L2 cache for the data of the hart running main().
 */
 void portable_fini(core_portable *p)
 {
+	core_results *res = (core_results *)((ee_u8 *)p - offsetof(core_results, port));
+	uint32_t hartid = read_csr(mhartid);
+	CORE_TICKS ticks = get_time();
+	ee_u32 total_iterations = 0;
+	ee_u32 i;
+
+	for (i = 0; i < default_num_contexts; i++) {
+		total_iterations += res[i].iterations;
+		ee_printf("COREMARK_CONTEXT n=%d iterations=%d crclist=0x%04x crcmatrix=0x%04x crcstate=0x%04x crcfinal=0x%04x\n",
+				(int)i, (int)res[i].iterations, res[i].crclist, res[i].crcmatrix,
+				res[i].crcstate, res[i].crc);
+	}
+
+	ee_printf("COREMARK_RESULT hart=%d contexts=%d iterations=%d ticks=%lu iter_per_sec=%f mem=%s way_enable=%d way_mask=0x%lx\n",
+			(int)hartid, (int)default_num_contexts, (int)total_iterations,
+			(unsigned long)ticks,
+			(ticks > 0U) ? (double)total_iterations / time_in_secs(ticks) : 0.0,
+			MEM_LOCATION, (int)CACHE_CTRL->WAY_ENABLE,
+			(unsigned long)(&CACHE_CTRL->WAY_MASK_E51_DCACHE)[2U * hartid]);
+
 	p->portable_id=0;
 }
 
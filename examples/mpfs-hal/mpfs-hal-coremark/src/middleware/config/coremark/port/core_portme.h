@@ -75,6 +75,34 @@ Original Author: Shay Gal-on
  //#define FLAGS_STR ("Please put compiler flags here (e.g. -o3)")
 #define COMPILER_FLAGS "-Wno-maybe-uninitialized -fno-common -funroll-loops -finline-functions -falign-functions=16 -falign-jumps=4 -falign-loops=4 -finline-limit=1000 -fno-if-conversion2 -fselective-scheduling -fno-tree-dominator-opts"
 #endif
+
+/* Configuration : COREMARK_DATA_LIM, COREMARK_DATA_SCRATCHPAD, COREMARK_DATA_DDR
+	Define one of these to place the data of all the contexts in that memory,
+	from COREMARK_DATA_BASE, instead of on the stack of the hart running main().
+	Each context uses TOTAL_DATA_SIZE bytes. The program and the stacks may be
+	linked to the LIM or the scratchpad, so COREMARK_DATA_BASE must be given
+	for these, pointing at memory the program does not use. The DDR default is
+	128MB into the cached DDR.
+*/
+#if defined(COREMARK_DATA_LIM)
+ #ifndef COREMARK_DATA_BASE
+ #error "Define COREMARK_DATA_BASE to an unused LIM address, e.g. 0x08100000UL"
+ #endif
+ #define MEM_LOCATION "LIM"
+#elif defined(COREMARK_DATA_SCRATCHPAD)
+ #ifndef COREMARK_DATA_BASE
+ #error "Define COREMARK_DATA_BASE to an unused scratchpad address, e.g. 0x0A000000UL"
+ #endif
+ #define MEM_LOCATION "SCRATCHPAD"
+#elif defined(COREMARK_DATA_DDR)
+ #ifndef COREMARK_DATA_BASE
+ #define COREMARK_DATA_BASE 0x88000000UL
+ #endif
+ #define MEM_LOCATION "DDR"
+#endif
+#if defined(COREMARK_DATA_BASE) && !defined(MEM_METHOD)
+ #define MEM_METHOD MEM_MALLOC
+#endif
 #ifndef MEM_LOCATION 
  #define MEM_LOCATION "STACK"
 #endif
@@ -152,6 +180,18 @@ typedef ee_u64 CORE_TICKS;
 #define USE_SOCKET 0
 #endif
 
+/* Configuration : PARALLEL_METHOD
+	With MULTITHREAD set to 2 to 4, context 0 runs on the hart running main()
+	and the others on the next U54s up. These harts call coremark_hart_worker()
+	from their u54_N() entry point, see u54_1.c.
+*/
+#if (MULTITHREAD>1)
+#if (MULTITHREAD>4)
+#error "MULTITHREAD must be from 1 to 4, one context per U54"
+#endif
+#define PARALLEL_METHOD "HARTS"
+#endif
+
 /* Configuration : MAIN_HAS_NOARGC
 	Needed if platform does not support getting arguments to main. 
 	
@@ -178,14 +218,23 @@ typedef ee_u64 CORE_TICKS;
 #endif
 
 /* Variable : default_num_contexts
-	Not used for this simple port, must cintain the value 1.
+	Number of contexts run, MULTITHREAD.
 */
 extern ee_u32 default_num_contexts;
 
 typedef struct CORE_PORTABLE_S {
 	ee_u8	portable_id;
+#if (MULTITHREAD>1)
+	ee_u8	hart;
+	volatile ee_u8	done;
+#endif
 } core_portable;
 
+#if (MULTITHREAD>1)
+/* Runs the context given to the calling hart by core_start_parallel(). Does not return. */
+void coremark_hart_worker(void);
+#endif
+
 /* target specific init/fini */
 void portable_init(core_portable *p, int *argc, char *argv[]);
 void portable_fini(core_portable *p);
@@ -0,0 +1,583 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solution.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software example
+ *
+ */
+/*******************************************************************************
+ *
+ * DDR bandwidth and latency benchmark
+ *
+ * The E51 hands each test to U54_1 up to U54_n, which start it together and
+ * time it with mcycle. The tests are:
+ *  - the STREAM copy, scale, add and triad kernels, reported as the total
+ *    GB/s moved by all the harts
+ *  - a pointer chase through a random cycle of cache lines, reported as ns
+ *    per access. Each access depends on the one before, so this is the load
+ *    to use latency.
+ *  - random read-modify-write updates of 64-bit words, reported as ns per
+ *    update on each hart and the total million updates per second
+ * Each hart uses its own arrays, see ddr_bench.h.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "inc/ddr_bench.h"
+#include "bench_report.h"
+
+#define BENCH_MAX_HARTS         4u
+#define BENCH_CPU_MHZ           (LIBERO_SETTING_MSS_COREPLEX_CPU_CLK / 1000000UL)
+/* a test not completed by all the harts in this time is abandoned */
+#define BENCH_TIMEOUT_CYCLES    (LIBERO_SETTING_MSS_COREPLEX_CPU_CLK * 20UL)
+#define BENCH_LINE_WORDS        8u
+#define BENCH_SCALAR            3.0
+
+typedef enum BENCH_TEST_
+{
+    BENCH_INIT                  = 0x00,
+    BENCH_COPY                  = 0x01,
+    BENCH_SCALE                 = 0x02,
+    BENCH_ADD                   = 0x03,
+    BENCH_TRIAD                 = 0x04,
+    BENCH_CHASE                 = 0x05,
+    BENCH_RANDOM                = 0x06,
+    BENCH_NUM_TESTS             = 0x07
+}   BENCH_TEST;
+
+typedef struct BENCH_REGION_
+{
+    const char * name;
+    uint64_t base;
+    uint64_t array_bytes;
+} BENCH_REGION;
+
+/*
+ * The DDR cached alias is tested last, so that no line written through it is
+ * still dirty in the L2 cache while the same DDR is used through the other
+ * aliases.
+ */
+static const BENCH_REGION g_regions[] =
+{
+    {"DDR non-cached", LIBERO_SETTING_DDR_32_NON_CACHE + BENCH_DDR_OFFSET,\
+            BENCH_DDR_ARRAY_BYTES},
+    {"DDR WCB       ", LIBERO_SETTING_DDR_32_WCB + BENCH_DDR_OFFSET,\
+            BENCH_DDR_ARRAY_BYTES},
+    {"DDR cached    ", LIBERO_SETTING_DDR_32_CACHE + BENCH_DDR_OFFSET,\
+            BENCH_DDR_ARRAY_BYTES},
+#ifdef BENCH_SCRATCHPAD_BASE
+    {"L2 scratchpad ", BENCH_SCRATCHPAD_BASE, BENCH_ONCHIP_ARRAY_BYTES},
+#endif
+#ifdef BENCH_LIM_BASE
+    {"L2 LIM        ", BENCH_LIM_BASE, BENCH_ONCHIP_ARRAY_BYTES},
+#endif
+};
+
+#define BENCH_NUM_REGIONS       (sizeof(g_regions) / sizeof(g_regions[0]))
+
+static const char * const g_test_names[BENCH_NUM_TESTS] =
+{
+    "init  ", "copy  ", "scale ", "add   ", "triad ", "chase ", "random"
+};
+
+/* QoS values tried on the coreplex AXI switch ports for the triad */
+static const uint32_t g_qos_values[] = {0u, 4u, 8u, 15u};
+
+static const mss_axisw_mport_t g_qos_ports[] =
+{
+    MSS_AXISW_CPLEX_D0_RD_CHAN,
+    MSS_AXISW_CPLEX_D0_WR_CHAN,
+    MSS_AXISW_CPLEX_D1_RD_CHAN,
+    MSS_AXISW_CPLEX_D1_WR_CHAN,
+    MSS_AXISW_CPLEX_NC_RD_CHAN,
+    MSS_AXISW_CPLEX_NC_WR_CHAN
+};
+
+#define BENCH_NUM_QOS_PORTS     (sizeof(g_qos_ports) / sizeof(g_qos_ports[0]))
+
+/*
+ * State shared between the E51 and the U54s. The E51 sets up a test and then
+ * increments sequence. The harts taking part add themselves to ready and
+ * start together once all of them are there.
+ */
+typedef struct BENCH_CONTROL_
+{
+    volatile uint32_t sequence;
+    volatile uint32_t seen[BENCH_MAX_HARTS + 1u];
+    volatile uint32_t test;
+    volatile uint32_t region;
+    volatile uint32_t n_harts;
+    volatile uint32_t abort;
+    volatile long lock;
+    volatile uint32_t ready;
+    volatile uint32_t done;
+    volatile uint64_t cycles[BENCH_MAX_HARTS];
+    volatile uint64_t ops[BENCH_MAX_HARTS];
+    volatile uint64_t sink[BENCH_MAX_HARTS];
+} BENCH_CONTROL;
+
+static BENCH_CONTROL g_bench;
+static char g_bench_string[120];
+static bench_report_t g_report;
+
+/* Settings given on the config lines of the report */
+static const bench_config_t g_bench_config[] =
+{
+    BENCH_CONFIG(BENCH_DDR_OFFSET),
+    BENCH_CONFIG(BENCH_DDR_ARRAY_BYTES),
+    BENCH_CONFIG(BENCH_ONCHIP_ARRAY_BYTES),
+    BENCH_CONFIG(BENCH_MAX_HARTS)
+};
+
+/*
+ * Local functions
+ */
+static void bench_hart_run(uint32_t slot);
+static uint64_t bench_kernel(BENCH_TEST test, double * a, double * b, \
+        double * c, uint64_t n, uint32_t slot);
+static void bench_build_chase(uint64_t * chain, uint64_t * order, uint64_t n, \
+        uint64_t seed);
+static uint64_t bench_xorshift(uint64_t x);
+static uint8_t bench_dispatch(BENCH_TEST test, uint32_t region, \
+        uint32_t n_harts);
+static void bench_report(mss_uart_instance_t * uart, BENCH_TEST test, \
+        uint32_t region, uint32_t n_harts, const char * variant);
+static void bench_qos_sweep(mss_uart_instance_t * uart);
+
+/**
+ * Run the benchmark on the U54s and print the results
+ * @param uart UART used for the results
+ */
+void ddr_bench_run(mss_uart_instance_t * uart)
+{
+    uint32_t region;
+    uint32_t test;
+    uint32_t n_harts;
+    uint8_t error = 0U;
+
+    raise_soft_interrupt(1u);
+    raise_soft_interrupt(2u);
+    raise_soft_interrupt(3u);
+    raise_soft_interrupt(4u);
+
+    MSS_UART_polled_tx_string(uart, (const uint8_t*)\
+            "\r\nDDR benchmark, memory         test   harts result\r\n");
+    bench_report_begin(&g_report, uart, NULL, "mpfs-hal-ddr-demo",\
+            g_bench_config, sizeof(g_bench_config) / sizeof(g_bench_config[0]));
+
+    for (region = 0u; (region < BENCH_NUM_REGIONS) && (error == 0U); region++)
+    {
+        error = bench_dispatch(BENCH_INIT, region, BENCH_MAX_HARTS);
+
+        for (test = (uint32_t)BENCH_COPY; (test < (uint32_t)BENCH_NUM_TESTS) &&\
+                (error == 0U); test++)
+        {
+            for (n_harts = 1u; (n_harts <= BENCH_MAX_HARTS) && (error == 0U);\
+                    n_harts++)
+            {
+                error = bench_dispatch((BENCH_TEST)test, region, n_harts);
+                if (error == 0U)
+                {
+                    bench_report(uart, (BENCH_TEST)test, region, n_harts,\
+                            "");
+                }
+            }
+        }
+    }
+
+    if (error == 0U)
+    {
+        bench_qos_sweep(uart);
+    }
+    else
+    {
+        MSS_UART_polled_tx_string(uart, (const uint8_t*)\
+                "Benchmark abandoned, a U54 did not respond\r\n");
+    }
+
+    bench_report_end(&g_report);
+}
+
+/**
+ * Run the test given to this hart by ddr_bench_run(), if there is one
+ */
+void ddr_bench_hart_poll(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint32_t sequence = g_bench.sequence;
+
+    if ((hart_id >= 1U) && (hart_id <= BENCH_MAX_HARTS) &&\
+            (g_bench.seen[hart_id] != sequence))
+    {
+        g_bench.seen[hart_id] = sequence;
+        mb();
+        if ((hart_id <= g_bench.n_harts) && (g_bench.abort == 0U))
+        {
+            bench_hart_run((uint32_t)hart_id - 1u);
+        }
+    }
+}
+
+/**
+ * Run the current test on one hart
+ * @param slot 0 for U54_1, selects the arrays used
+ */
+static void bench_hart_run(uint32_t slot)
+{
+    const BENCH_REGION * region = &g_regions[g_bench.region];
+    BENCH_TEST test = (BENCH_TEST)g_bench.test;
+    uint64_t n = region->array_bytes / sizeof(double);
+    double * a = (double *)(region->base + (slot * 3U * region->array_bytes));
+    double * b = a + n;
+    double * c = b + n;
+    uint64_t start;
+    uint64_t ops;
+
+    if (test == BENCH_CHASE)
+    {
+        bench_build_chase((uint64_t *)a, (uint64_t *)b, n, slot + 1U);
+    }
+
+    spinlock(&g_bench.lock);
+    g_bench.ready++;
+    spinunlock(&g_bench.lock);
+
+    while ((g_bench.ready < g_bench.n_harts) && (g_bench.abort == 0U))
+    {
+        ;
+    }
+
+    start = readmcycle();
+    ops = bench_kernel(test, a, b, c, n, slot);
+    mb();
+    g_bench.cycles[slot] = readmcycle() - start;
+    g_bench.ops[slot] = ops;
+
+    spinlock(&g_bench.lock);
+    g_bench.done++;
+    spinunlock(&g_bench.lock);
+}
+
+/**
+ * Run one test kernel
+ * @return bytes moved for the STREAM kernels, or the number of accesses
+ */
+static uint64_t bench_kernel(BENCH_TEST test, double * a, double * b, \
+        double * c, uint64_t n, uint32_t slot)
+{
+    uint64_t * words = (uint64_t *)a;
+    uint64_t mask = n - 1U;
+    uint64_t idx;
+    uint64_t x;
+    uint64_t ops = 0U;
+
+    switch (test)
+    {
+        case BENCH_INIT:
+            for (idx = 0U; idx < n; idx++)
+            {
+                a[idx] = 1.0;
+                b[idx] = 2.0;
+                c[idx] = 0.0;
+            }
+            ops = 3U * n * sizeof(double);
+            break;
+
+        case BENCH_COPY:
+            for (idx = 0U; idx < n; idx++)
+            {
+                c[idx] = a[idx];
+            }
+            ops = 2U * n * sizeof(double);
+            break;
+
+        case BENCH_SCALE:
+            for (idx = 0U; idx < n; idx++)
+            {
+                b[idx] = BENCH_SCALAR * c[idx];
+            }
+            ops = 2U * n * sizeof(double);
+            break;
+
+        case BENCH_ADD:
+            for (idx = 0U; idx < n; idx++)
+            {
+                c[idx] = a[idx] + b[idx];
+            }
+            ops = 3U * n * sizeof(double);
+            break;
+
+        case BENCH_TRIAD:
+            for (idx = 0U; idx < n; idx++)
+            {
+                a[idx] = b[idx] + (BENCH_SCALAR * c[idx]);
+            }
+            ops = 3U * n * sizeof(double);
+            break;
+
+        case BENCH_CHASE:
+            /* two laps of the cycle, the mask keeps a bad link in the array */
+            x = 0U;
+            for (idx = 0U; idx < ((2U * n) / BENCH_LINE_WORDS); idx++)
+            {
+                x = words[x] & mask;
+            }
+            g_bench.sink[slot] = x;
+            ops = (2U * n) / BENCH_LINE_WORDS;
+            break;
+
+        case BENCH_RANDOM:
+            x = 0x9E3779B97F4A7C15ULL * (slot + 1U);
+            for (idx = 0U; idx < (n / 2U); idx++)
+            {
+                x = bench_xorshift(x);
+                words[x & mask] ^= x;
+            }
+            ops = n / 2U;
+            break;
+
+        default:
+            break;
+    }
+
+    return (ops);
+}
+
+/**
+ * Link the cache lines of an array into one cycle in a random order, using
+ * Sattolo's algorithm. The first word of each line holds the index of the
+ * first word of the next line.
+ * @param chain array linked
+ * @param order scratch array, n / BENCH_LINE_WORDS words
+ * @param n words in the array, a power of two
+ * @param seed
+ */
+static void bench_build_chase(uint64_t * chain, uint64_t * order, uint64_t n, \
+        uint64_t seed)
+{
+    uint64_t lines = n / BENCH_LINE_WORDS;
+    uint64_t idx;
+    uint64_t swap_idx;
+    uint64_t tmp;
+    uint64_t x = seed * 0x2545F4914F6CDD1DULL;
+
+    for (idx = 0U; idx < lines; idx++)
+    {
+        order[idx] = idx;
+    }
+
+    for (idx = lines - 1U; idx > 0U; idx--)
+    {
+        x = bench_xorshift(x);
+        swap_idx = x % idx;
+        tmp = order[idx];
+        order[idx] = order[swap_idx];
+        order[swap_idx] = tmp;
+    }
+
+    for (idx = 0U; idx < lines; idx++)
+    {
+        chain[idx * BENCH_LINE_WORDS] = order[idx] * BENCH_LINE_WORDS;
+    }
+    mb();
+}
+
+/**
+ * xorshift64 pseudo random number generator
+ * @param x previous value, not zero
+ * @return next value
+ */
+static uint64_t bench_xorshift(uint64_t x)
+{
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return (x);
+}
+
+/**
+ * Start a test on U54_1 to U54_n and wait for it to complete
+ * @return 0 if all the harts completed the test
+ */
+static uint8_t bench_dispatch(BENCH_TEST test, uint32_t region, \
+        uint32_t n_harts)
+{
+    uint64_t start;
+    uint8_t error = 0U;
+
+    g_bench.test = (uint32_t)test;
+    g_bench.region = region;
+    g_bench.n_harts = n_harts;
+    g_bench.abort = 0U;
+    g_bench.ready = 0U;
+    g_bench.done = 0U;
+    mb();
+    g_bench.sequence++;
+
+    start = readmcycle();
+    while ((g_bench.done < n_harts) && (error == 0U))
+    {
+        if ((readmcycle() - start) > BENCH_TIMEOUT_CYCLES)
+        {
+            g_bench.abort = 1U;
+            error = 1U;
+        }
+    }
+
+    return (error);
+}
+
+/**
+ * Print the result of the test just run, variant is added to the name of the
+ * region on the report line
+ */
+static void bench_report(mss_uart_instance_t * uart, BENCH_TEST test, \
+        uint32_t region, uint32_t n_harts, const char * variant)
+{
+    bench_record_t record;
+    char region_name[32];
+    uint32_t name_len;
+    uint64_t total_ops = 0U;
+    uint64_t total_cycles = 0U;
+    uint64_t max_cycles = 0U;
+    uint64_t rate;
+    uint64_t tenth_ns;
+    uint32_t slot;
+
+    for (slot = 0u; slot < n_harts; slot++)
+    {
+        total_ops += g_bench.ops[slot];
+        total_cycles += g_bench.cycles[slot];
+        if (g_bench.cycles[slot] > max_cycles)
+        {
+            max_cycles = g_bench.cycles[slot];
+        }
+    }
+
+    /* the names of the regions are padded for the table */
+    (void)snprintf(region_name, sizeof(region_name), "%s",\
+            g_regions[region].name);
+    name_len = (uint32_t)strlen(region_name);
+    while ((name_len > 0u) && (region_name[name_len - 1u] == ' '))
+    {
+        name_len--;
+    }
+    (void)snprintf(&region_name[name_len], sizeof(region_name) - name_len,\
+            " %s", variant);
+    bench_record_init(&record, "ddr", g_test_names[test], region_name);
+    record.size = (uint32_t)g_regions[region].array_bytes;
+    record.depth = n_harts;
+    /* one timed run of the kernel for each hart */
+    record.samples = n_harts;
+
+    if ((max_cycles == 0U) || (total_ops == 0U))
+    {
+        sprintf(g_bench_string, "%s %s %u      no result\r\n",\
+                g_regions[region].name, g_test_names[test], n_harts);
+        record.errors = 1U;
+    }
+    else if (test <= BENCH_TRIAD)
+    {
+        /* MB/s */
+        rate = (total_ops * BENCH_CPU_MHZ) / max_cycles;
+        sprintf(g_bench_string, "%s %s %u      %u.%03u GB/s\r\n",\
+                g_regions[region].name, g_test_names[test], n_harts,\
+                (uint32_t)(rate / 1000U), (uint32_t)(rate % 1000U));
+        record.rate = rate;
+        record.rate_unit = "MB/s";
+    }
+    else
+    {
+        /* average over the harts, and thousand updates/s for random */
+        tenth_ns = (total_cycles * 10000U) / (BENCH_CPU_MHZ * total_ops);
+        rate = (total_ops * BENCH_CPU_MHZ * 1000U) / max_cycles;
+        record.samples = (uint32_t)total_ops;
+        record.mean = tenth_ns * 100U;
+        record.lat_unit = "ps";
+        if (test == BENCH_CHASE)
+        {
+            sprintf(g_bench_string, "%s %s %u      %u.%u ns/access\r\n",\
+                    g_regions[region].name, g_test_names[test], n_harts,\
+                    (uint32_t)(tenth_ns / 10U), (uint32_t)(tenth_ns % 10U));
+        }
+        else
+        {
+            sprintf(g_bench_string,\
+                    "%s %s %u      %u.%u ns/update, %u.%03u M updates/s\r\n",\
+                    g_regions[region].name, g_test_names[test], n_harts,\
+                    (uint32_t)(tenth_ns / 10U), (uint32_t)(tenth_ns % 10U),\
+                    (uint32_t)(rate / 1000U), (uint32_t)(rate % 1000U));
+            record.rate = rate;
+            record.rate_unit = "kupdate/s";
+        }
+    }
+
+    MSS_UART_polled_tx_string(uart, (const uint8_t*)g_bench_string);
+    bench_report_result(&g_report, &record);
+}
+
+/**
+ * Run the triad on four harts with a range of QoS values set on the AXI
+ * switch ports used by the coreplex, then restore the original values.
+ * The QoS values can only be written if the switch is configured for AXI3.
+ */
+static void bench_qos_sweep(mss_uart_instance_t * uart)
+{
+    uint32_t saved[BENCH_NUM_QOS_PORTS];
+    uint32_t port;
+    uint32_t qos;
+    uint32_t region;
+    char variant[8];
+    uint32_t read_error = 0U;
+    uint32_t axi_error;
+    uint8_t error = 0U;
+
+    for (port = 0u; port < BENCH_NUM_QOS_PORTS; port++)
+    {
+        read_error |= MSS_AXISW_read_qos_val(g_qos_ports[port], &saved[port]);
+    }
+    axi_error = read_error;
+
+    for (qos = 0u; (qos < (sizeof(g_qos_values) / sizeof(g_qos_values[0]))) &&\
+            (axi_error == 0U) && (error == 0U); qos++)
+    {
+        for (port = 0u; port < BENCH_NUM_QOS_PORTS; port++)
+        {
+            axi_error |= MSS_AXISW_write_qos_val(g_qos_ports[port],\
+                    g_qos_values[qos]);
+        }
+
+        sprintf(g_bench_string, "Coreplex AXI QoS %u\r\n", g_qos_values[qos]);
+        MSS_UART_polled_tx_string(uart, (const uint8_t*)g_bench_string);
+
+        for (region = 0u; (region < BENCH_NUM_REGIONS) && (axi_error == 0U) &&\
+                (error == 0U); region++)
+        {
+            error = bench_dispatch(BENCH_TRIAD, region, BENCH_MAX_HARTS);
+            if (error == 0U)
+            {
+                (void)snprintf(variant, sizeof(variant), "qos=%u",\
+                        g_qos_values[qos]);
+                bench_report(uart, BENCH_TRIAD, region, BENCH_MAX_HARTS,\
+                        variant);
+            }
+        }
+    }
+
+    if (axi_error != 0U)
+    {
+        MSS_UART_polled_tx_string(uart, (const uint8_t*)\
+                "AXI switch QoS not programmable, QoS sweep skipped\r\n");
+    }
+
+    if (read_error == 0U)
+    {
+        for (port = 0u; port < BENCH_NUM_QOS_PORTS; port++)
+        {
+            (void)MSS_AXISW_write_qos_val(g_qos_ports[port], saved[port]);
+        }
+    }
+}
@@ -17,6 +17,7 @@
 #include "mpfs_hal/mss_hal.h"
 #include "mpfs_hal/mpfs_hal_version.h"
 #include "inc/common.h"
+#include "inc/ddr_bench.h"
 
 #ifndef SIFIVE_HIFIVE_UNLEASHED
 #include "../../middleware/ymodem/ymodem.h"
@@ -40,6 +41,7 @@ DDR test options:\r\n\
 4  Display clock values\r\n\
 5  Load DDR test pattern and run.\r\n\
 b  Display MSS PLL registers\r\n\
+c  Run DDR bandwidth and latency benchmark\r\n\
 \r\n\
 Bootloader options:\r\n\
 6  Load image to DDR using YMODEM\r\n\
@@ -62,6 +64,7 @@ DDR test options:\r\n\
 4  Display clock values\r\n\
 5  Not used\r\n\
 b  Display MSS PLL registers\r\n\
+c  Run DDR bandwidth and latency benchmark\r\n\
 \r\n\
 Bootloader options:\r\n\
 6  Load image to DDR using YMODEM\r\n\
@@ -342,6 +345,9 @@ void e51(void)
                 case 'b':
                     display_mss_regs();
                     break;
+                case 'c':
+                    ddr_bench_run(g_uart);
+                    break;
                 case 'x':
                 	ddr_test = 2U;
                     break;
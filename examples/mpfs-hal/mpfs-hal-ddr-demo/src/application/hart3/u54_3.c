@@ -15,6 +15,7 @@
 #include <string.h>
 #include "mpfs_hal/mss_hal.h"
 #include "inc/common.h"
+#include "inc/ddr_bench.h"
 
 #ifndef SIFIVE_HIFIVE_UNLEASHED
 #else
@@ -54,6 +55,7 @@ void u54_3(void)
 
     while (1U)
     {
+        ddr_bench_hart_poll();
         if((hart_jump_ddr == 123U) ||
            (hart_jump_ddr == 1234U))
         {
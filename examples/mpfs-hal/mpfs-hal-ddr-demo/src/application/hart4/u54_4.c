@@ -15,6 +15,7 @@
 #include <string.h>
 #include "mpfs_hal/mss_hal.h"
 #include "inc/common.h"
+#include "inc/ddr_bench.h"
 
 #ifndef SIFIVE_HIFIVE_UNLEASHED
 #else
@@ -55,6 +56,7 @@ void u54_4(void)
 
     while (1U)
     {
+        ddr_bench_hart_poll();
         if(hart_jump_ddr == 1234U)
         {
             jump_to_application(hls, M_MODE, (uint64_t)0x80000000);
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solution.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software example
+ *
+ */
+/*******************************************************************************
+ *
+ * DDR bandwidth and latency benchmark, run from one to four U54s at once
+ *
+ */
+
+#ifndef DDR_BENCH_H_
+#define DDR_BENCH_H_
+
+#include <stdint.h>
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+/*
+ * Memory used by the benchmark, offset from the start of each 32-bit DDR
+ * alias. Each U54 uses three arrays of BENCH_DDR_ARRAY_BYTES, so DDR from
+ * BENCH_DDR_OFFSET to BENCH_DDR_OFFSET + (12 * BENCH_DDR_ARRAY_BYTES) is
+ * overwritten. The arrays are four times the size of the L2 cache.
+ */
+#ifndef BENCH_DDR_OFFSET
+#define BENCH_DDR_OFFSET                0x01000000UL
+#endif
+#ifndef BENCH_DDR_ARRAY_BYTES
+#define BENCH_DDR_ARRAY_BYTES           0x00800000UL
+#endif
+
+/*
+ * On-chip memory is only benchmarked if BENCH_SCRATCHPAD_BASE or
+ * BENCH_LIM_BASE is defined. The program may be linked to either, so these
+ * must point at memory it does not use, large enough for twelve arrays of
+ * BENCH_ONCHIP_ARRAY_BYTES. e.g. with LIBERO_SETTING_NUM_SCRATCH_PAD_WAYS set
+ * to four and the program linked to the LIM:
+ *     #define BENCH_SCRATCHPAD_BASE       0x0A000000UL
+ */
+#ifndef BENCH_ONCHIP_ARRAY_BYTES
+#define BENCH_ONCHIP_ARRAY_BYTES        0x00008000UL
+#endif
+
+/*
+ * Called by the E51. Wakes the U54s, runs the benchmark and prints the results
+ * to the UART.
+ */
+void ddr_bench_run(mss_uart_instance_t * uart);
+
+/*
+ * Called repeatedly by each U54 from its main loop, runs the benchmark work
+ * given to the hart by ddr_bench_run().
+ */
+void ddr_bench_hart_poll(void);
+
+#endif /* DDR_BENCH_H_ */
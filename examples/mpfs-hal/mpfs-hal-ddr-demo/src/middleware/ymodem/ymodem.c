@@ -33,39 +33,93 @@
 #include "drivers/mss/mss_mmuart/mss_uart.h"
 #endif
 #include "ymodem.h"
+#ifdef YMODEM_MMC
+#include "drivers/mss/mss_mmc/mss_mmc.h"
+#endif
 
 
 extern mss_uart_instance_t *g_uart;
 extern volatile uint32_t g_10ms_count;
 
-/***************************************************************************//**
- * Calculate CRC for block of data.
+/*
+ * Received characters are stored in a ring buffer by the UART receive
+ * interrupt, so the next packet is received while the last one is written
+ * out. It must be a power of two, large enough for a 1K packet and the time
+ * taken to write it. Define YMODEM_POLLED_RX to poll the UART instead, as
+ * before.
  */
-uint16_t sf2bl_crc16(const uint8_t *buf, uint32_t count)
+#ifndef YMODEM_RX_RING_SIZE
+#define YMODEM_RX_RING_SIZE     (4096U)
+#endif
+#define RX_RING_MASK            (YMODEM_RX_RING_SIZE - 1U)
+
+#ifndef YMODEM_POLLED_RX
+static uint8_t g_rx_ring[YMODEM_RX_RING_SIZE];
+static volatile uint32_t g_rx_head;     /* Written by the interrupt only */
+static volatile uint32_t g_rx_tail;
+#endif
+
+/*
+ * CRC-16/XMODEM (polynomial 0x1021) of each byte value, so the CRC is
+ * updated a byte at a time rather than a bit at a time.
+ */
+static const uint16_t g_crc16_table[256] =
 {
-    uint16_t crc = 0;
-    int i;
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+    0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+    0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+    0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+    0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+    0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+    0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+    0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+    0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+    0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+    0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+    0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+    0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+    0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+    0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+    0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+    0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+    0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+    0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+    0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+    0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+    0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+    0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+    0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+    0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+    0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+    0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+    0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+    0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+    0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+    0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+};
 
+/***************************************************************************//**
+ * Update a CRC with a block of data.
+ */
+static uint16_t crc16_update(uint16_t crc, const uint8_t *buf, uint32_t count)
+{
     while(count--)
     {
-        crc = crc ^ *buf++ << 8;
-
-        for (i=0; i<8; i++)
-        {
-            if (crc & 0x8000)
-            {
-                crc = crc << 1 ^ 0x1021;
-            }
-            else
-            {
-                crc = crc << 1;
-            }
-        }
+        crc = (uint16_t)((crc << 8) ^ g_crc16_table[((crc >> 8) ^ *buf++) & 0xFFU]);
     }
 
     return crc;
 }
 
+/***************************************************************************//**
+ * Calculate CRC for block of data.
+ */
+uint16_t sf2bl_crc16(const uint8_t *buf, uint32_t count)
+{
+    return crc16_update(0U, buf, count);
+}
+
 
 /***************************************************************************//**
  * The rest of this is only needed for YMODEM builds.
@@ -192,85 +246,191 @@ static void _sleep(uint32_t seconds_delay)
 }
 
 
+#ifndef YMODEM_POLLED_RX
+/***************************************************************************//**
+ * UART receive interrupt handler. Moves the characters in the receive FIFO to
+ * the ring buffer. Characters received with the ring buffer full are dropped,
+ * so the CRC of the packet fails and it is sent again.
+ */
+static void ymodem_rx_handler(mss_uart_instance_t *this_uart)
+{
+    uint8_t rx_fifo[16];
+    size_t received;
+    size_t index;
+    uint32_t head = g_rx_head;
+
+    do
+    {
+        received = MSS_UART_get_rx(this_uart, rx_fifo, sizeof(rx_fifo));
+
+        for(index = 0U; index < received; index++)
+        {
+            if((head - g_rx_tail) < YMODEM_RX_RING_SIZE)
+            {
+                g_rx_ring[head & RX_RING_MASK] = rx_fifo[index];
+                head++;
+            }
+        }
+    } while(0U != received);
+
+    g_rx_head = head;
+}
+#endif
+
 
 /***************************************************************************//**
- *
+ * Start receiving through the UART receive interrupt, unless YMODEM_POLLED_RX
+ * is defined. MMUART0 uses its local interrupt to the calling hart, the other
+ * UARTs the PLIC, which must have been set up with PLIC_init().
+ */
+static void rx_open(void)
+{
+#ifndef YMODEM_POLLED_RX
+    g_rx_head = 0U;
+    g_rx_tail = 0U;
+
+    MSS_UART_set_rx_handler(g_uart, ymodem_rx_handler,
+                            MSS_UART_FIFO_EIGHT_BYTES);
+
+    if((g_uart == &g_mss_uart0_lo) || (g_uart == &g_mss_uart0_hi))
+    {
+        MSS_UART_enable_local_irq(g_uart);
+    }
+#endif
+}
+
+
+/***************************************************************************//**
+ * Go back to polled reception for the rest of the program.
+ */
+static void rx_close(void)
+{
+#ifndef YMODEM_POLLED_RX
+    MSS_UART_disable_irq(g_uart, MSS_UART_RBF_IRQ);
+#endif
+}
+
+
+/***************************************************************************//**
+ * Take one received character, if any. Returns the number taken.
+ */
+static int32_t rx_getbyte(uint8_t *rx_byte)
+{
+    int32_t received = 0;
+#ifndef YMODEM_POLLED_RX
+    uint32_t tail = g_rx_tail;
+
+    if(tail != g_rx_head)
+    {
+        *rx_byte = g_rx_ring[tail & RX_RING_MASK];
+        g_rx_tail = tail + 1U;
+        received = 1;
+    }
+#else
+    received = (int32_t)MSS_UART_get_rx(g_uart, rx_byte, 1);
+#endif
+
+    return(received);
+}
+
+
+/***************************************************************************//**
+ * Returns the character received, or -1 on timeout. A negative timeout waits
+ * forever, 0 returns at once and a positive timeout is in seconds.
  */
 static int32_t _getchar(int32_t timeout)
 {
     uint32_t start_time;
     uint8_t  rx_byte;
     int32_t  done;
-    int32_t received;
     int32_t ret_value;
 
     ret_value = -1; /* Assume failure/timeout to simplify things */
     done = 0;
+    start_time = g_10ms_count; /* record starting point */
 
-    if(timeout < 0) /* blocking mode, exit only on rx character or error */
+    while(!done)
     {
-        while(!done)
+        if(0 != rx_getbyte(&rx_byte))
         {
-#ifndef RTG4_DEMO
-            received = MSS_UART_get_rx(g_my_uart, &rx_byte, 1);
-#else
-            received = MSS_UART_get_rx(g_uart, &rx_byte, 1 );
-#endif
-            if(0 != received)
-            {
-                done = 1;
-#ifndef RTG4_DEMO
-                if(MSS_UART_NO_ERROR == MSS_UART_get_rx_status(g_my_uart))
-#endif
-                {
-                    ret_value = (int32_t)rx_byte;
-                }
-            }
+            ret_value = (int32_t)rx_byte;
+            done = 1;
+        }
+        else if(0 == timeout) /* one shot mode */
+        {
+            done = 1;
+        }
+        else if((timeout > 0) &&
+                ((g_10ms_count - start_time) >= ((uint32_t)timeout * 1000U)))
+        {
+            /* Timed out so exit with ret_value == -1 */
+            done = 1;
+        }
+        else
+        {
+            /* Keep waiting */
         }
     }
-    else if(timeout > 0) /* time limited mode */
+
+    return(ret_value);
+}
+
+
+/***************************************************************************//**
+ * Receive a block of characters, copied out of the ring buffer as they
+ * arrive rather than one at a time. Returns 0, or -1 if no character arrives
+ * for PACKET_TIMEOUT seconds.
+ */
+static int32_t rx_block(uint8_t *dest, uint32_t count)
+{
+    uint32_t start_time;
+    uint32_t chunk;
+#ifndef YMODEM_POLLED_RX
+    uint32_t tail;
+#endif
+    int32_t ret_value = 0;
+
+    start_time = g_10ms_count;
+
+    while((0U != count) && (0 == ret_value))
     {
-        start_time = g_10ms_count; /* record starting point */
-        timeout *= 1000;           /* Convert timeout to ms */
-        while(!done)
+#ifndef YMODEM_POLLED_RX
+        tail = g_rx_tail;
+        chunk = g_rx_head - tail;
+
+        /* Copy up to the end of the ring buffer, the rest on the next pass */
+        if(chunk > (YMODEM_RX_RING_SIZE - (tail & RX_RING_MASK)))
         {
-#ifndef RTG4_DEMO
-            received = MSS_UART_get_rx(g_my_uart, &rx_byte, 1);
-#else
-            received = MSS_UART_get_rx(g_uart, &rx_byte, 1 );
-#endif
-            if(0 != received)
-            {
-                done = 1;
-#ifndef RTG4_DEMO
-                if(MSS_UART_NO_ERROR == MSS_UART_get_rx_status(g_my_uart))
-#endif
-                {
-                    ret_value = (int32_t)rx_byte;
-                }
-            }
+            chunk = YMODEM_RX_RING_SIZE - (tail & RX_RING_MASK);
+        }
 
-           if((g_10ms_count) >= start_time + timeout)
-           {
-                /* Timed out so exit with ret_value == -1 */
-                done = 1;
-           }
+        if(chunk > count)
+        {
+            chunk = count;
+        }
+
+        if(0U != chunk)
+        {
+            memcpy(dest, &g_rx_ring[tail & RX_RING_MASK], chunk);
+            g_rx_tail = tail + chunk;
         }
-    }
-    else /* one shot mode */
-    {
-#ifndef RTG4_DEMO
-            received = MSS_UART_get_rx(g_my_uart, &rx_byte, 1);
-#else
-            received = MSS_UART_get_rx(g_uart, &rx_byte, 1 );
-#endif
-#ifndef RTG4_DEMO
-            if((0 != received) && (MSS_UART_NO_ERROR == MSS_UART_get_rx_status(g_my_uart)))
 #else
-                if(0 != received)
+        chunk = (uint32_t)MSS_UART_get_rx(g_uart, dest, count);
 #endif
+
+        if(0U != chunk)
         {
-            ret_value = (int32_t)rx_byte;
+            dest += chunk;
+            count -= chunk;
+            start_time = g_10ms_count;
+        }
+        else if((g_10ms_count - start_time) >= (PACKET_TIMEOUT * 1000U))
+        {
+            ret_value = -1;
+        }
+        else
+        {
+            /* Keep waiting */
         }
     }
 
@@ -349,21 +509,28 @@ static uint32_t str_to_u32(uint8_t *str)
     return acc;
 }
 
-
 /***************************************************************************//**
+ * Receive a packet. The header goes to header and, if the packet is the next
+ * data packet expected, the data goes straight to where the sink asks for it,
+ * else to scratch. *data is set to where the data went.
+ *
  * Returns 0 on success, 1 on corrupt packet, -1 on error (timeout):
- * *length will be set to the length of
+ * *length will be set to the length of the packet, 0 for end of file or -1
+ * for abort.
  */
-static int32_t receive_packet(uint8_t *data, int32_t *length)
+static int32_t receive_packet(uint8_t *header, uint8_t *scratch,
+                              const ymodem_sink_t *sink, uint32_t expected,
+                              uint8_t **data, int32_t *length)
 {
-    volatile int32_t index;
     int32_t rx_char;
-    volatile int32_t return_val = 0; /* Assume everything is ok */
+    int32_t return_val = 0; /* Assume everything is ok */
     uint32_t packet_size = 0U;
+    uint8_t trailer[PACKET_TRAILER];
+    uint16_t crc;
 
     *length = 0;
+    *data = scratch;
 
-    //_putchar('N');
     rx_char = _getchar(PACKET_TIMEOUT);
 
     if(rx_char < 0)
@@ -415,41 +582,62 @@ static int32_t receive_packet(uint8_t *data, int32_t *length)
 
         if(0 == return_val) /* Still ok */
         {
-            *data = (uint8_t)rx_char; /* Store first character of packet */
+            header[0] = (uint8_t)rx_char; /* Store first character of packet */
+            return_val = rx_block(&header[PACKET_SEQNO_INDEX], PACKET_HEADER - 1);
+        }
 
-            for(index = 1; (index < (int32_t)(packet_size + PACKET_OVERHEAD)) && (0 == return_val); ++index)
+        if(0 == return_val)
+        {
+            /* Just a sanity check on the sequence number/complement value.
+             * Caller should check for in-order arrival.
+             */
+            if(header[PACKET_SEQNO_INDEX] !=
+               (uint8_t)(header[PACKET_SEQNO_COMP_INDEX] ^ 0xffU))
             {
-                rx_char = _getchar(PACKET_TIMEOUT);
-                if (rx_char < 0)
-                {
-                    return_val = -1;
-                }
-                else
+                return_val = 1;
+            }
+            else if((0U != expected) &&
+                    (header[PACKET_SEQNO_INDEX] == (uint8_t)(expected & 0xffU)))
+            {
+                /* Next data packet, received where it is to be stored */
+                *data = sink->next(sink->ctx, packet_size);
+                if(0 == *data)
                 {
-                    data[index] = (uint8_t)rx_char;
+                    /* Does not fit, the caller cancels */
+                    *data = scratch;
                 }
             }
+            else
+            {
+                /* Header packet or out of sequence */
+            }
 
-            /* Just a sanity check on the sequence number/complement value.
-             * Caller should check for in-order arrival.
-             *
+            /* Receive the rest even if corrupt, so the line is clear for the
+             * retry.
              */
-            int y = (0 == return_val);
-            uint8_t x = data[PACKET_SEQNO_INDEX];
-            uint8_t z = ((uint8_t)((data[PACKET_SEQNO_COMP_INDEX] ^ 0xffU) & 0xffU));
-            if(y && (x != z))
+            if(-1 != rx_block(*data, packet_size))
             {
-                return_val = 1;
+                if(-1 == rx_block(trailer, PACKET_TRAILER))
+                {
+                    return_val = -1;
+                }
+            }
+            else
+            {
+                return_val = -1;
             }
+        }
 
-            if((0 == return_val) && (sf2bl_crc16(data + PACKET_HEADER, packet_size + PACKET_TRAILER) != 0))
+        if(0 == return_val)
+        {
+            crc = crc16_update(0U, *data, packet_size);
+            if(0U != crc16_update(crc, trailer, PACKET_TRAILER))
             {
                 return_val = 1;
             }
-
-            if(0 == return_val) /* All ok ! */
+            else /* All ok ! */
             {
-                *length = packet_size;
+                *length = (int32_t)packet_size;
             }
         }
     }
@@ -463,15 +651,29 @@ static int32_t receive_packet(uint8_t *data, int32_t *length)
 }
 
 
+/***************************************************************************//**
+ * Cancel the transfer.
+ */
+static void cancel_transfer(void)
+{
+    _putchar(CAN);
+    _putchar(CAN);
+    _sleep(1);
+}
+
+
 /***************************************************************************//**
  *
  */
 /* Returns the length of the file received, or 0 on error: */
-uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
+uint32_t ymodem_receive_sink(const ymodem_sink_t *sink, uint32_t length,
+                             uint8_t *file_name)
 {
-    static uint8_t packet_data[PACKET_1K_SIZE + PACKET_OVERHEAD]; /* Declare as static as 1K is a lot to put on our stack */
+    static uint8_t packet_data[PACKET_1K_SIZE]; /* Declare as static as 1K is a lot to put on our stack */
+    uint8_t header[PACKET_HEADER];
     uint8_t file_size[FILE_SIZE_LENGTH + 1];
     uint8_t *file_ptr;
+    uint8_t *data;
     int32_t  packet_length;
     int32_t  index;
     int32_t  file_done;
@@ -481,7 +683,6 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
     uint32_t packets_received;
     uint32_t errors;
     int32_t  first_try = 1;
-    uint8_t *buf_ptr;
     uint32_t size = 0;
     uint32_t return_val = 0; /* Default to abnormal exit */
     uint32_t temp;
@@ -491,6 +692,8 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
     session_done = 0;
     errors       = 0;
 
+    rx_open();
+
     while(0 == session_done)
     {
         crc_nak   = 1;
@@ -503,11 +706,11 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
         first_try        = 0;
         packets_received = 0;
         file_done        = 0;
-        buf_ptr          = buf;
 
         while(0 == file_done)
         {
-            rx_status = receive_packet(packet_data, &packet_length);
+            rx_status = receive_packet(header, packet_data, sink,
+                                       packets_received, &data, &packet_length);
             switch(rx_status)
             {
             case 0: /* Success */
@@ -528,11 +731,19 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
                      * packets received and the advertised file length.
                      */
                     file_done = 1;
-                    return_val = 1; /* Signal normal exit */
+                    if(0 == sink->finish(sink->ctx))
+                    {
+                        return_val = 1; /* Signal normal exit */
+                    }
+                    else
+                    {
+                        return_val = 0;
+                        session_done = 1;
+                    }
                     break;
 
                 default:  /* normal packet */
-                    if((packet_data[PACKET_SEQNO_INDEX] & 0xff) != (packets_received & 0xff))
+                    if((header[PACKET_SEQNO_INDEX] & 0xff) != (packets_received & 0xff))
                     {
                         /*
                          * Hmmm, Tera Term 4.86 doesn't seem to like the ACK+C
@@ -540,10 +751,14 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
                          * with just C seems to work. Only try this if we get a
                          * repeat of packet 0...
                          */
-                        if((1 == packets_received) && (0 == (packet_data[PACKET_SEQNO_INDEX] & 0xff)))
+                        if((1 == packets_received) && (0 == (header[PACKET_SEQNO_INDEX] & 0xff)))
                         {
                         _putchar(CRC); /* Repeated packet 0 error */
                         }
+                        else if((header[PACKET_SEQNO_INDEX] & 0xff) == ((packets_received - 1U) & 0xff))
+                        {
+                        _putchar(ACK); /* Our ACK of the last packet was lost */
+                        }
                         else
                         {
                         _putchar(NAK); /* Normal out of sequence packet error */
@@ -559,14 +774,14 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
                              * the file length are zero, we'll call it empty.
                              */
                             temp = 0;
-                            for(index = PACKET_HEADER; index < PACKET_HEADER + 4; index++)
+                            for(index = 0; index < 4; index++)
                             {
-                                temp += (uint32_t)packet_data[index];
+                                temp += (uint32_t)data[index];
                             }
 
                             if(0 != temp) /* looks like there is something there... */
                             {  /* filename packet has data */
-                                file_ptr = packet_data + PACKET_HEADER;
+                                file_ptr = data;
                                 /* Copy file name until nul or too much */
                                 for(index = 0; *file_ptr && (index < FILE_NAME_LENGTH);)
                                 {
@@ -592,9 +807,7 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
                                 size = str_to_u32(file_size);
                                 if(size > length)
                                 {
-                                    _putchar(CAN);
-                                    _putchar(CAN);
-                                    _sleep(1);
+                                    cancel_transfer();
 
                                     /* Terminate transfer immediately */
                                     file_done    = 1;
@@ -602,6 +815,7 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
                                 }
                                 else
                                 {
+                                    sink->start(sink->ctx);
                                     _putchar(ACK);
                                     _putchar(crc_nak ? CRC : NAK);
                                     crc_nak = 0;
@@ -618,13 +832,12 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
                         else
                         {
                             /* This shouldn't happen, but we check anyway in case the
-                             * sender lied in its filename packet:
+                             * sender lied in its filename packet: the sink had
+                             * no room for the packet.
                              */
-                            if((buf_ptr + packet_length) - buf > length)
+                            if(data == packet_data)
                             {
-                                _putchar(CAN);
-                                _putchar(CAN);
-                                _sleep(1);
+                                cancel_transfer();
 
                                 /* Terminate transfer immediately */
                                 file_done    = 1;
@@ -632,13 +845,19 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
                             }
                             else
                             {
-                                for (index=0; index < packet_length; index++)
+                                /* ACK first, so the sender sends the next
+                                 * packet while this one is written out.
+                                 */
+                                _putchar(ACK);
+
+                                if(0 != sink->commit(sink->ctx, (uint32_t)packet_length))
                                 {
-                                    buf_ptr[index] = packet_data[PACKET_HEADER + index];
-                                }
+                                    cancel_transfer();
 
-                                buf_ptr += packet_length;
-                                _putchar(ACK);
+                                    /* Terminate transfer immediately */
+                                    file_done    = 1;
+                                    session_done = 1;
+                                }
                             }
                         }
 
@@ -653,9 +872,7 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
                 {
                     if(++errors >= MAX_ERRORS)
                     {
-                        _putchar(CAN);
-                        _putchar(CAN);
-                        _sleep(1);
+                        cancel_transfer();
 
                         /* Terminate transfer immediately */
                         file_done    = 1;
@@ -672,7 +889,247 @@ uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
         }  /* receive packets */
     }  /* receive files */
 
+    rx_close();
+
     return(return_val == 1 ?  size : 0 );
 }
 
+
+/*
+ * Sink storing the file straight to memory, e.g. DDR.
+ */
+typedef struct
+{
+    uint8_t *buf;
+    uint32_t length;
+    uint32_t offset;
+} mem_sink_t;
+
+static void mem_start(void *ctx)
+{
+    ((mem_sink_t *)ctx)->offset = 0U;
+}
+
+static uint8_t *mem_next(void *ctx, uint32_t size)
+{
+    mem_sink_t *mem = (mem_sink_t *)ctx;
+    uint8_t *dest = 0;
+
+    if(size <= (mem->length - mem->offset))
+    {
+        dest = &mem->buf[mem->offset];
+    }
+
+    return(dest);
+}
+
+static int32_t mem_commit(void *ctx, uint32_t size)
+{
+    ((mem_sink_t *)ctx)->offset += size;
+
+    return(0);
+}
+
+static int32_t mem_finish(void *ctx)
+{
+    (void)ctx;
+
+    return(0);
+}
+
+
+/***************************************************************************//**
+ *
+ */
+/* Returns the length of the file received, or 0 on error: */
+uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name)
+{
+    mem_sink_t mem;
+    ymodem_sink_t sink;
+
+    mem.buf = buf;
+    mem.length = length;
+    mem.offset = 0U;
+
+    sink.start = mem_start;
+    sink.next = mem_next;
+    sink.commit = mem_commit;
+    sink.finish = mem_finish;
+    sink.ctx = &mem;
+
+    return(ymodem_receive_sink(&sink, length, file_name));
+}
+
+
+#ifdef YMODEM_MMC
+/*
+ * Sink writing the file to eMMC/SD with ADMA2. Packets are collected in one
+ * of two buffers while the other is being written, and a buffer is written
+ * each time it holds YMODEM_MMC_CHUNK_SIZE bytes. A 1K packet which does not
+ * fit goes on into the space after the buffer, and what is over is moved to
+ * the start of the next buffer.
+ */
+#define MMC_SECTOR_SIZE         (512U)
+
+typedef struct
+{
+    uint32_t sector;        /* Next sector to write */
+    uint32_t fill;          /* Bytes in the current buffer */
+    uint32_t current;       /* Buffer being filled */
+    uint32_t pending;       /* A write is in progress */
+    uint32_t start_sector;  /* First sector of the file */
+} mmc_sink_t;
+
+static uint8_t g_mmc_chunk[2][YMODEM_MMC_CHUNK_SIZE + PACKET_1K_SIZE]
+                          __attribute__((aligned(64)));
+
+/***************************************************************************//**
+ * Wait for the write in progress, if any. Returns 0, or -1 if it failed.
+ */
+static int32_t mmc_wait(mmc_sink_t *mmc)
+{
+    mss_mmc_status_t status = MSS_MMC_TRANSFER_SUCCESS;
+    int32_t ret_value = 0;
+
+    if(0U != mmc->pending)
+    {
+        do
+        {
+            status = MSS_MMC_get_transfer_status();
+        } while(MSS_MMC_TRANSFER_IN_PROGRESS == status);
+
+        mmc->pending = 0U;
+    }
+
+    if(MSS_MMC_TRANSFER_SUCCESS != status)
+    {
+        ret_value = -1;
+    }
+
+    return(ret_value);
+}
+
+/***************************************************************************//**
+ * Start writing size bytes of the current buffer, once the last write is
+ * complete, and switch to the other buffer.
+ */
+static int32_t mmc_write(mmc_sink_t *mmc, uint32_t size)
+{
+    mss_mmc_status_t status;
+    int32_t ret_value = mmc_wait(mmc);
+
+    if(0 == ret_value)
+    {
+        status = MSS_MMC_adma2_write(g_mmc_chunk[mmc->current], mmc->sector,
+                                     size);
+        if(MSS_MMC_TRANSFER_IN_PROGRESS == status)
+        {
+            mmc->pending = 1U;
+            mmc->sector += size / MMC_SECTOR_SIZE;
+            mmc->current ^= 1U;
+        }
+        else
+        {
+            ret_value = -1;
+        }
+    }
+
+    return(ret_value);
+}
+
+static void mmc_start(void *ctx)
+{
+    mmc_sink_t *mmc = (mmc_sink_t *)ctx;
+
+    mmc->sector = mmc->start_sector;
+    mmc->fill = 0U;
+}
+
+static uint8_t *mmc_next(void *ctx, uint32_t size)
+{
+    mmc_sink_t *mmc = (mmc_sink_t *)ctx;
+
+    (void)size;
+
+    return(&g_mmc_chunk[mmc->current][mmc->fill]);
+}
+
+static int32_t mmc_commit(void *ctx, uint32_t size)
+{
+    mmc_sink_t *mmc = (mmc_sink_t *)ctx;
+    uint32_t last = mmc->current;
+    int32_t ret_value = 0;
+
+    mmc->fill += size;
+
+    if(mmc->fill >= YMODEM_MMC_CHUNK_SIZE)
+    {
+        ret_value = mmc_write(mmc, YMODEM_MMC_CHUNK_SIZE);
+        mmc->fill -= YMODEM_MMC_CHUNK_SIZE;
+
+        if((0 == ret_value) && (0U != mmc->fill))
+        {
+            memcpy(g_mmc_chunk[mmc->current],
+                   &g_mmc_chunk[last][YMODEM_MMC_CHUNK_SIZE], mmc->fill);
+        }
+    }
+
+    return(ret_value);
+}
+
+static int32_t mmc_finish(void *ctx)
+{
+    mmc_sink_t *mmc = (mmc_sink_t *)ctx;
+    uint32_t size;
+    int32_t ret_value = 0;
+
+    if(0U != mmc->fill)
+    {
+        /* Pad the last sector with zeros */
+        size = (mmc->fill + MMC_SECTOR_SIZE - 1U) & ~(MMC_SECTOR_SIZE - 1U);
+        memset(&g_mmc_chunk[mmc->current][mmc->fill], 0, size - mmc->fill);
+        ret_value = mmc_write(mmc, size);
+        mmc->fill = 0U;
+    }
+
+    if(0 != mmc_wait(mmc))
+    {
+        ret_value = -1;
+    }
+
+    return(ret_value);
+}
+
+
+/***************************************************************************//**
+ *
+ */
+/* Returns the length of the file received, or 0 on error: */
+uint32_t ymodem_receive_mmc(uint32_t sector, uint32_t length, uint8_t *file_name)
+{
+    mmc_sink_t mmc;
+    ymodem_sink_t sink;
+    uint32_t received;
+
+    mmc.start_sector = sector;
+    mmc.sector = sector;
+    mmc.fill = 0U;
+    mmc.current = 0U;
+    mmc.pending = 0U;
+
+    sink.start = mmc_start;
+    sink.next = mmc_next;
+    sink.commit = mmc_commit;
+    sink.finish = mmc_finish;
+    sink.ctx = &mmc;
+
+    received = ymodem_receive_sink(&sink, length, file_name);
+
+    /* Do not return with a write still reading from the buffers */
+    (void)mmc_wait(&mmc);
+
+    return(received);
+}
+#endif /* YMODEM_MMC */
+
 #endif /* SF2BL_COMMS_OPTION == SF2BL_COMMS_YMODEM */
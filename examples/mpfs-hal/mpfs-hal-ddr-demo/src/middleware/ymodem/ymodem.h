@@ -51,9 +51,41 @@
 /* Number of consecutive receive errors before giving up: */
 #define MAX_ERRORS    (5)
 
+/*
+ * Bytes collected before each write with ymodem_receive_mmc(), a multiple of
+ * 1024. Two buffers of this size, plus 1K each, are used.
+ */
+#ifndef YMODEM_MMC_CHUNK_SIZE
+#define YMODEM_MMC_CHUNK_SIZE   (8192U)
+#endif
+
+/*
+ * Where the data of a file goes. next() returns where to receive the data of
+ * the next packet, size 128 or 1024 bytes, or 0 if there is no room for it,
+ * which cancels the transfer. commit() is called once the packet has been
+ * received correctly and acknowledged, so it may take as long as the sender
+ * takes to send the next packet. start() is called for each file and finish()
+ * at its end. commit() and finish() return 0, or non zero to fail the
+ * transfer.
+ */
+typedef struct
+{
+    void (*start)(void *ctx);
+    uint8_t *(*next)(void *ctx, uint32_t size);
+    int32_t (*commit)(void *ctx, uint32_t size);
+    int32_t (*finish)(void *ctx);
+    void *ctx;
+} ymodem_sink_t;
+
 void sf2bl_ymodem_init(void);
 void sf2bl_ymodem_deinit(void);
 uint32_t ymodem_receive(uint8_t *buf, uint32_t length, uint8_t *file_name);
+uint32_t ymodem_receive_sink(const ymodem_sink_t *sink, uint32_t length,
+                             uint8_t *file_name);
+#ifdef YMODEM_MMC
+/* The eMMC/SD card must have been set up with MSS_MMC_init() */
+uint32_t ymodem_receive_mmc(uint32_t sector, uint32_t length, uint8_t *file_name);
+#endif
 uint16_t sf2bl_crc16(const uint8_t *buf, uint32_t count);
 void _putchar(int32_t data);
 void _putstring(uint8_t *string);
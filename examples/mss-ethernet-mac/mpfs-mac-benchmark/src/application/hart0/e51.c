@@ -0,0 +1,148 @@
+/******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Application code running on E51
+ *
+ * Ethernet traffic generator and responder benchmark. See README.txt.
+ *
+ * The E51 sets up MMUART0, which all harts print to, and wakes the generator
+ * on U54_1 and the responder on U54_3. The MAC set up shared by the two is
+ * here as well.
+ *
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+
+#include "drivers/mss_mmuart/mss_uart.h"
+#include "inc/bench.h"
+#include "drivers/mss_ethernet_mac/phy.h"
+
+/* Link status polls, 10ms apart, before giving up on a port */
+#define BENCH_LINK_TRIES            500u
+
+uint64_t g_bench_uart_lock;
+uint64_t g_bench_mdio_lock;
+volatile uint32_t g_bench_started = 0u;
+volatile uint32_t g_bench_gem1_ready = 0u;
+
+static void bench_delay_ms(uint32_t ms);
+
+/* Main function for the hart0(E51 processor).
+ * Application code running on hart0 is placed here.
+ */
+void e51(void)
+{
+    SYSREG->SUBBLK_CLOCK_CR = 0xffffffff;        /* all clocks on */
+
+    MSS_UART_init(&g_mss_uart0_lo,
+                  MSS_UART_115200_BAUD,
+                  MSS_UART_DATA_8_BITS | MSS_UART_NO_PARITY | MSS_UART_ONE_STOP_BIT);
+
+    bench_printf("\r\n# Ethernet benchmark: generator %u, responder %u, %s, %u queues\r\n",
+                 BENCH_RUN_GENERATOR, BENCH_RUN_RESPONDER,
+                 (BENCH_UDP != 0) ? "udp" : "raw", BENCH_QUEUES);
+
+    __asm volatile ("fence" ::: "memory");
+    g_bench_started = 1u;
+
+    raise_soft_interrupt(1u);
+    raise_soft_interrupt(3u);
+
+    while(1)
+    {
+        __asm("wfi");
+    }
+}
+/******************************************************************************/
+void bench_printf(const char *fmt, ...)
+{
+    char buf[256];
+    va_list args;
+
+    va_start(args, fmt);
+    (void)vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    mss_take_mutex((uint64_t)&g_bench_uart_lock);
+    MSS_UART_polled_tx_string(&g_mss_uart0_lo, (const uint8_t *)buf);
+    mss_release_mutex((uint64_t)&g_bench_uart_lock);
+}
+/******************************************************************************/
+/*
+ * Icicle Kit standard reference design: both GEMs use SGMII to the VSC8662
+ * and the management interface of the PHY is wired to GEM1.
+ */
+void bench_mac_config(mss_mac_cfg_t *cfg, const mss_mac_instance_t *mac)
+{
+    MSS_MAC_cfg_struct_def_init(cfg);
+
+    cfg->speed_duplex_select   = MSS_MAC_ANEG_ALL_SPEEDS;
+    cfg->mac_addr[0] = 0x00;
+    cfg->mac_addr[1] = 0xFC;
+    cfg->mac_addr[2] = 0x00;
+    cfg->mac_addr[3] = 0x12;
+    cfg->mac_addr[4] = 0x34;
+    cfg->mac_addr[5] = 0x56;
+    cfg->tsu_clock_select      = 1U;
+
+    cfg->phy_addr              = PHY_VSC8662_1_MDIO_ADDR;
+    cfg->phy_type              = MSS_MAC_DEV_PHY_VSC8662;
+    cfg->pcs_phy_addr          = SGMII_MDIO_ADDR;
+    cfg->interface_type        = TBI;
+    cfg->phy_autonegotiate     = MSS_MAC_VSC8662_phy_autonegotiate;
+    cfg->phy_mac_autonegotiate = MSS_MAC_VSC8662_mac_autonegotiate;
+    cfg->phy_get_link_status   = MSS_MAC_VSC8662_phy_get_link_status;
+    cfg->phy_init              = MSS_MAC_VSC8662_phy_init;
+    cfg->phy_set_link_speed    = MSS_MAC_VSC8662_phy_set_link_speed;
+#if MSS_MAC_USE_PHY_DP83867
+    cfg->phy_extended_read     = NULL_ti_read_extended_regs;
+    cfg->phy_extended_write    = NULL_ti_write_extended_regs;
+#endif
+
+    if(mac == &g_mac1)
+    {
+        cfg->mac_addr[5] = 0x57;
+    }
+    else
+    {
+        cfg->phy_addr       = PHY_VSC8662_0_MDIO_ADDR;
+        cfg->phy_controller = &g_mac1;
+    }
+}
+/******************************************************************************/
+uint8_t bench_wait_link(mss_mac_instance_t *mac)
+{
+    mss_mac_speed_t speed;
+    uint8_t full_duplex;
+    uint8_t link_up = 0u;
+    uint32_t tries = 0u;
+
+    while((0u == link_up) && (tries < BENCH_LINK_TRIES))
+    {
+        mss_take_mutex((uint64_t)&g_bench_mdio_lock);
+        link_up = MSS_MAC_get_link_status(mac, &speed, &full_duplex);
+        mss_release_mutex((uint64_t)&g_bench_mdio_lock);
+
+        if(0u == link_up)
+        {
+            bench_delay_ms(10u);
+            tries++;
+        }
+    }
+
+    return (link_up);
+}
+/******************************************************************************/
+static void bench_delay_ms(uint32_t ms)
+{
+    uint64_t end = readmcycle() + (((uint64_t)BENCH_CYCLE_HZ / 1000u) * ms);
+
+    while(readmcycle() < end)
+    {
+    }
+}
@@ -0,0 +1,651 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Application code running on U54_1
+ *
+ * Ethernet benchmark generator. One stream of test frames per queue of GEM0 is
+ * sent to the responder at a fixed rate for each point of a frame size and
+ * rate sweep. The frames which come back are counted per stream and their
+ * round trip time is taken from the transmit and receive time stamps the TSU
+ * writes to the DMA descriptors. Each point is reported as one JSON line per
+ * stream. See README.txt.
+ *
+ */
+
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss_mmuart/mss_uart.h"
+#include "inc/bench.h"
+#include "bench_report.h"
+
+/* Length of each point of the sweep and the wait for stragglers after it */
+#define GEN_POINT_MS                1000u
+#define GEN_DRAIN_MS                50u
+
+/* Transmit time stamps kept per stream, a power of 2 */
+#define GEN_STAMP_SLOTS             1024u
+/* Round trip times kept per stream and point for the percentiles */
+#define GEN_RTT_SAMPLES             4096u
+#define GEN_RX_BUDGET               32u
+
+/* 125MHz TSU clock */
+#define GEN_TSU_NS_INC              8u
+
+#define GEN_SRC_IP                  0x0A000001u     /* 10.0.0.1 */
+#define GEN_DST_IP                  0x0A000002u     /* 10.0.0.2 */
+
+volatile uint32_t count_sw_ints_h1 = 0U;
+
+#if BENCH_RUN_GENERATOR
+typedef struct
+{
+    uint64_t ns;
+    uint32_t seq;
+    uint32_t valid;
+} gen_stamp_t;
+
+typedef struct
+{
+    uint32_t seq;               /* Next sequence number to send */
+    uint64_t tx;
+    uint64_t rx;
+    uint64_t reorder;
+    uint64_t no_stamp;
+    uint32_t expect;            /* Next sequence number expected back */
+    uint32_t stride;            /* Sequence numbers between RTT samples, a power of 2 */
+    uint32_t samples;
+    uint32_t rtt_ns[GEN_RTT_SAMPLES];
+} gen_stream_t;
+
+static const uint32_t g_gen_sizes[] = {64u, 128u, 256u, 512u, 1024u, 1518u};
+/* Per stream rates in kbit/s, 0 for as fast as the MAC will go */
+static const uint32_t g_gen_rates[] = {10000u, 100000u, 0u};
+
+static uint8_t g_gen_tx_buf[BENCH_QUEUES][BENCH_BATCH][BENCH_MAX_FRAME] __attribute__ ((aligned (8)));
+static uint8_t g_gen_rx_buf[BENCH_QUEUES][MSS_MAC_RX_RING_SIZE][MSS_MAC_MAX_RX_BUF_SIZE] __attribute__ ((aligned (8)));
+
+/* Written by the TX callback, read from the poll loop */
+static volatile gen_stamp_t g_gen_stamp[BENCH_QUEUES][GEN_STAMP_SLOTS];
+static gen_stream_t g_gen_stream[BENCH_QUEUES];
+static mss_mac_tx_pkt_info_t g_gen_list[(BENCH_QUEUES * BENCH_BATCH) + 1u];
+static volatile uint32_t g_gen_rx_sched[BENCH_QUEUES];
+
+/* One report per sweep */
+static bench_report_t g_gen_report;
+static const bench_config_t g_gen_config[] =
+{
+    BENCH_CONFIG(BENCH_UDP),
+    BENCH_CONFIG(BENCH_QUEUES),
+    BENCH_CONFIG(BENCH_BATCH),
+    BENCH_CONFIG(MSS_MAC_RX_RING_SIZE),
+    BENCH_CONFIG(MSS_MAC_TX_RING_SIZE),
+    BENCH_CONFIG(GEN_POINT_MS)
+};
+
+static void gen_rx_sched(void *this_mac, uint32_t queue_no);
+static void gen_rx_callback(void *this_mac, uint32_t queue_no,
+                            uint8_t *p_rx_packet, uint32_t pckt_length,
+                            mss_mac_rx_desc_t *cdesc, void *p_user_data);
+static void gen_tx_callback(void *this_mac, uint32_t queue_no,
+                            mss_mac_tx_desc_t *cdesc, void *p_user_data);
+static uint8_t gen_init(void);
+static void gen_build_frames(uint32_t size);
+static void gen_poll(void);
+static void gen_run_point(uint32_t size, uint32_t rate_kbps);
+static void gen_report(uint32_t size, uint32_t rate_kbps, uint64_t cycles);
+static void gen_report_tx(const uint8_t *line);
+static void gen_sort(uint32_t *values, uint32_t count);
+static uint64_t gen_tsu_ns(const mss_mac_tsu_time_t *tsu);
+#endif /* BENCH_RUN_GENERATOR */
+
+/* Main function for the hart1(U54_1 processor).
+ * Application code running on hart1 is placed here
+ *
+ * The hart1 goes into WFI. hart0 brings it out of WFI when it raises the first
+ * Software interrupt to this hart.
+ */
+void u54_1(void)
+{
+#if BENCH_RUN_GENERATOR
+    uint32_t size_index;
+    uint32_t rate_index;
+#endif
+
+    /* Clear pending software interrupt in case there was any.
+       Enable only the software interrupt so that the E51 core can bring this
+       core out of WFI by raising a software interrupt. */
+    clear_soft_interrupt();
+    set_csr(mie, MIP_MSIP);
+
+    /* Put this hart in WFI. */
+    do
+    {
+        __asm("wfi");
+    }while(0 == (read_csr(mip) & MIP_MSIP));
+
+    /* The hart is now out of WFI, clear the SW interrupt. Here onwards the
+     * application can enable and use any interrupts as required */
+    clear_soft_interrupt();
+
+    while(0u == g_bench_started)
+    {
+    }
+
+#if BENCH_RUN_GENERATOR
+    PLIC_init();
+    __enable_irq();
+
+    if(0u != gen_init())
+    {
+        for(;;)
+        {
+            bench_report_begin(&g_gen_report, &g_mss_uart0_lo, gen_report_tx,
+                               "mpfs-mac-benchmark", g_gen_config,
+                               sizeof(g_gen_config) / sizeof(g_gen_config[0]));
+
+            for(size_index = 0u; size_index < (sizeof(g_gen_sizes) / sizeof(g_gen_sizes[0])); size_index++)
+            {
+                gen_build_frames(g_gen_sizes[size_index]);
+
+                for(rate_index = 0u; rate_index < (sizeof(g_gen_rates) / sizeof(g_gen_rates[0])); rate_index++)
+                {
+                    gen_run_point(g_gen_sizes[size_index], g_gen_rates[rate_index]);
+                }
+            }
+
+            bench_report_end(&g_gen_report);
+            bench_printf("{\"role\":\"generator\",\"sweep\":\"done\"}\r\n");
+        }
+    }
+#endif
+
+    while(1U)
+    {
+        __asm("wfi");
+    }
+
+  /* Never return */
+}
+
+/* hart1 software interrupt handler */
+void Software_h1_IRQHandler(void)
+{
+    count_sw_ints_h1++;
+}
+
+#if BENCH_RUN_GENERATOR
+/******************************************************************************/
+/*
+ * Brings GEM0 up with a stream per queue. Without the responder in this image
+ * nothing else drives GEM1, so it is brought up here for its MDIO.
+ */
+static uint8_t gen_init(void)
+{
+    mss_mac_cfg_t cfg;
+    mss_mac_tsu_config_t tsu_cfg;
+    mss_mac_flow_t flow;
+    uint32_t queue_no;
+    uint32_t index;
+    uint8_t ok = 0u;
+
+#if BENCH_RUN_RESPONDER
+    while(0u == g_bench_gem1_ready)
+    {
+    }
+#else
+    bench_mac_config(&cfg, &g_mac1);
+    MSS_MAC_init(&g_mac1, &cfg);
+#endif
+
+    bench_mac_config(&cfg, &g_mac0);
+
+    mss_take_mutex((uint64_t)&g_bench_mdio_lock);
+    MSS_MAC_init(&g_mac0, &cfg);
+    mss_release_mutex((uint64_t)&g_bench_mdio_lock);
+
+    if(MSS_MAC_AVAILABLE != g_mac0.mac_available)
+    {
+        bench_printf("{\"role\":\"generator\",\"error\":\"gem0 init\"}\r\n");
+    }
+    else if(0u == bench_wait_link(&g_mac0))
+    {
+        bench_printf("{\"role\":\"generator\",\"error\":\"gem0 link down\"}\r\n");
+    }
+    else
+    {
+        ok = 1u;
+
+        tsu_cfg.secs_msb = 0u;
+        tsu_cfg.secs_lsb = 0u;
+        tsu_cfg.nanoseconds = 0u;
+        tsu_cfg.ns_inc = GEN_TSU_NS_INC;
+        tsu_cfg.sub_ns_inc = 0u;
+        MSS_MAC_init_TSU(&g_mac0, &tsu_cfg);
+        MSS_MAC_set_TSU_rx_mode(&g_mac0, MSS_MAC_TSU_MODE_ALL);
+        MSS_MAC_set_TSU_tx_mode(&g_mac0, MSS_MAC_TSU_MODE_ALL);
+
+        (void)memset(&flow, 0, sizeof(flow));
+        flow.protocol = 17u;
+
+        for(queue_no = 0u; queue_no < BENCH_QUEUES; queue_no++)
+        {
+            MSS_MAC_set_tx_callback(&g_mac0, queue_no, gen_tx_callback);
+            MSS_MAC_set_rx_callback(&g_mac0, queue_no, gen_rx_callback);
+            MSS_MAC_set_rx_poll_mode(&g_mac0, queue_no, gen_rx_sched);
+
+#if BENCH_UDP
+            /* Queue 0 gets everything the screeners do not claim */
+            if(0u != queue_no)
+            {
+                flow.dst_port = (uint16_t)(BENCH_UDP_PORT_BASE + queue_no);
+                if(MSS_MAC_FLOW_INVALID == MSS_MAC_steer_flow(&g_mac0, &flow, queue_no))
+                {
+                    bench_printf("{\"role\":\"generator\",\"error\":\"steer queue %u\"}\r\n", queue_no);
+                    ok = 0u;
+                }
+            }
+#endif
+
+            for(index = 0u; index < MSS_MAC_RX_RING_SIZE; index++)
+            {
+                (void)MSS_MAC_receive_pkt(&g_mac0, queue_no, g_gen_rx_buf[queue_no][index],
+                                          g_gen_rx_buf[queue_no][index],
+                                          ((MSS_MAC_RX_RING_SIZE - 1u) == index) ?
+                                          MSS_MAC_INT_ARM : MSS_MAC_INT_DISABLE);
+            }
+        }
+    }
+
+    return (ok);
+}
+/******************************************************************************/
+/*
+ * Fills in everything but the sequence number of each frame. With UDP each
+ * stream has its own port so the screeners at both ends can tell them apart.
+ */
+static void gen_build_frames(uint32_t size)
+{
+    uint32_t length = size - 4u;            /* The MAC appends the FCS */
+    uint32_t queue_no;
+    uint32_t index;
+#if BENCH_UDP
+    uint32_t sum;
+#endif
+    uint8_t *frame;
+    bench_payload_t payload;
+
+    for(queue_no = 0u; queue_no < BENCH_QUEUES; queue_no++)
+    {
+        for(index = 0u; index < BENCH_BATCH; index++)
+        {
+            frame = g_gen_tx_buf[queue_no][index];
+            (void)memset(frame, 0, BENCH_MAX_FRAME);
+
+            frame[0] = 0x00u;               /* The responder, GEM1 */
+            frame[1] = 0xFCu;
+            frame[2] = 0x00u;
+            frame[3] = 0x12u;
+            frame[4] = 0x34u;
+            frame[5] = 0x57u;
+            (void)memcpy(&frame[6], g_mac0.mac_addr, 6u);
+#if BENCH_UDP
+            frame[12] = 0x08u;
+            frame[13] = 0x00u;
+
+            frame[14] = 0x45u;              /* IPv4, 20 byte header */
+            frame[16] = (uint8_t)((length - BENCH_ETH_HDR_LEN) >> 8);
+            frame[17] = (uint8_t)(length - BENCH_ETH_HDR_LEN);
+            frame[20] = 0x40u;              /* Don't fragment */
+            frame[22] = 64u;                /* TTL */
+            frame[23] = 17u;                /* UDP */
+            frame[26] = (uint8_t)(GEN_SRC_IP >> 24);
+            frame[27] = (uint8_t)(GEN_SRC_IP >> 16);
+            frame[28] = (uint8_t)(GEN_SRC_IP >> 8);
+            frame[29] = (uint8_t)GEN_SRC_IP;
+            frame[30] = (uint8_t)(GEN_DST_IP >> 24);
+            frame[31] = (uint8_t)(GEN_DST_IP >> 16);
+            frame[32] = (uint8_t)(GEN_DST_IP >> 8);
+            frame[33] = (uint8_t)GEN_DST_IP;
+
+            sum = 0u;
+            for(uint32_t word = 0u; word < BENCH_IP_HDR_LEN; word += 2u)
+            {
+                sum += ((uint32_t)frame[BENCH_ETH_HDR_LEN + word] << 8) |
+                       (uint32_t)frame[BENCH_ETH_HDR_LEN + word + 1u];
+            }
+            sum = (sum & 0xFFFFu) + (sum >> 16);
+            sum = (sum & 0xFFFFu) + (sum >> 16);
+            frame[24] = (uint8_t)(~sum >> 8);
+            frame[25] = (uint8_t)~sum;
+
+            /* Same source and destination port, no UDP checksum */
+            frame[34] = (uint8_t)((BENCH_UDP_PORT_BASE + queue_no) >> 8);
+            frame[35] = (uint8_t)(BENCH_UDP_PORT_BASE + queue_no);
+            frame[36] = frame[34];
+            frame[37] = frame[35];
+            frame[38] = (uint8_t)((length - BENCH_ETH_HDR_LEN - BENCH_IP_HDR_LEN) >> 8);
+            frame[39] = (uint8_t)(length - BENCH_ETH_HDR_LEN - BENCH_IP_HDR_LEN);
+#else
+            frame[12] = (uint8_t)(BENCH_RAW_ETHERTYPE >> 8);
+            frame[13] = (uint8_t)BENCH_RAW_ETHERTYPE;
+#endif
+            payload.magic = BENCH_MAGIC;
+            payload.stream = queue_no;
+            payload.seq = 0u;
+            (void)memcpy(&frame[BENCH_PAYLOAD_OFFSET], &payload, sizeof(payload));
+
+            g_gen_list[(queue_no * BENCH_BATCH) + index].queue_no = queue_no;
+            g_gen_list[(queue_no * BENCH_BATCH) + index].length = length;
+            g_gen_list[(queue_no * BENCH_BATCH) + index].tx_buffer = frame;
+        }
+    }
+
+    g_gen_list[BENCH_QUEUES * BENCH_BATCH].length = 0u;
+    g_gen_list[BENCH_QUEUES * BENCH_BATCH].tx_buffer = NULL;
+}
+/******************************************************************************/
+static void gen_poll(void)
+{
+    uint32_t queue_no;
+
+    for(queue_no = 0u; queue_no < BENCH_QUEUES; queue_no++)
+    {
+        if(0u != g_gen_rx_sched[queue_no])
+        {
+            g_gen_rx_sched[queue_no] = 0u;
+            if(GEN_RX_BUDGET == MSS_MAC_rx_poll(&g_mac0, queue_no, GEN_RX_BUDGET))
+            {
+                g_gen_rx_sched[queue_no] = 1u;
+            }
+        }
+    }
+}
+/******************************************************************************/
+/*
+ * Sends a batch per stream every interval for GEN_POINT_MS. A list is only
+ * taken by MSS_MAC_send_pkts() once the last one has gone, so the frame
+ * buffers are safe to reuse each time it succeeds.
+ */
+static void gen_run_point(uint32_t size, uint32_t rate_kbps)
+{
+    gen_stream_t *stream;
+    uint64_t cycles_per_ms = (uint64_t)BENCH_CYCLE_HZ / 1000u;
+    uint64_t interval = 0u;
+    uint64_t expected;
+    uint64_t start;
+    uint64_t end;
+    uint64_t next;
+    uint64_t now;
+    uint32_t queue_no;
+    uint32_t index;
+    uint32_t seq;
+    uint8_t *frame;
+
+    if(0u != rate_kbps)
+    {
+        interval = ((uint64_t)BENCH_BATCH * (size + BENCH_WIRE_OVERHEAD) * 8u * BENCH_CYCLE_HZ) /
+                   ((uint64_t)rate_kbps * 1000u);
+        expected = ((uint64_t)rate_kbps * GEN_POINT_MS) / ((size + BENCH_WIRE_OVERHEAD) * 8u);
+    }
+    else
+    {
+        /* Share of 1Gbit/s */
+        expected = ((uint64_t)1000000u * GEN_POINT_MS) /
+                   ((uint64_t)(size + BENCH_WIRE_OVERHEAD) * 8u * BENCH_QUEUES);
+    }
+
+    for(queue_no = 0u; queue_no < BENCH_QUEUES; queue_no++)
+    {
+        stream = &g_gen_stream[queue_no];
+        stream->tx = 0u;
+        stream->rx = 0u;
+        stream->reorder = 0u;
+        stream->no_stamp = 0u;
+        stream->expect = stream->seq;
+        stream->samples = 0u;
+        stream->stride = 1u;
+        while(((uint64_t)stream->stride * GEN_RTT_SAMPLES) < expected)
+        {
+            stream->stride <<= 1;
+        }
+    }
+
+    start = readmcycle();
+    end = start + (cycles_per_ms * GEN_POINT_MS);
+    next = start;
+    now = start;
+
+    while(now < end)
+    {
+        if(now >= next)
+        {
+            for(queue_no = 0u; queue_no < BENCH_QUEUES; queue_no++)
+            {
+                seq = g_gen_stream[queue_no].seq;
+                for(index = 0u; index < BENCH_BATCH; index++)
+                {
+                    frame = g_gen_tx_buf[queue_no][index];
+                    (void)memcpy(&frame[BENCH_PAYLOAD_OFFSET + offsetof(bench_payload_t, seq)],
+                                 &seq, sizeof(seq));
+                    g_gen_list[(queue_no * BENCH_BATCH) + index].p_user_data =
+                        (void *)(((uintptr_t)queue_no << 32) | (uintptr_t)seq);
+                    seq++;
+                }
+            }
+
+            if(MSS_MAC_ERR_OK == MSS_MAC_send_pkts(&g_mac0, (1u << BENCH_QUEUES) - 1u, g_gen_list))
+            {
+                for(queue_no = 0u; queue_no < BENCH_QUEUES; queue_no++)
+                {
+                    g_gen_stream[queue_no].seq += BENCH_BATCH;
+                    g_gen_stream[queue_no].tx += BENCH_BATCH;
+                }
+                next += interval;
+            }
+        }
+
+        gen_poll();
+        now = readmcycle();
+    }
+
+    end = now + (cycles_per_ms * GEN_DRAIN_MS);
+    while(readmcycle() < end)
+    {
+        gen_poll();
+    }
+
+    gen_report(size, rate_kbps, now - start);
+}
+/******************************************************************************/
+static void gen_report(uint32_t size, uint32_t rate_kbps, uint64_t cycles)
+{
+    gen_stream_t *stream;
+    bench_record_t record;
+    char variant[32];
+    uint64_t sum;
+    uint32_t index;
+    uint64_t ms = cycles / ((uint64_t)BENCH_CYCLE_HZ / 1000u);
+    uint64_t wire_bits = (uint64_t)(size + BENCH_WIRE_OVERHEAD) * 8u;
+    uint32_t p50 = 0u;
+    uint32_t p90 = 0u;
+    uint32_t p99 = 0u;
+    uint32_t max = 0u;
+    uint32_t queue_no;
+
+    for(queue_no = 0u; queue_no < BENCH_QUEUES; queue_no++)
+    {
+        stream = &g_gen_stream[queue_no];
+
+        if(0u != stream->samples)
+        {
+            gen_sort(stream->rtt_ns, stream->samples);
+            p50 = stream->rtt_ns[(stream->samples * 50u) / 100u];
+            p90 = stream->rtt_ns[(stream->samples * 90u) / 100u];
+            p99 = stream->rtt_ns[(stream->samples * 99u) / 100u];
+            max = stream->rtt_ns[stream->samples - 1u];
+        }
+
+        /* Bits per millisecond is kbit/s */
+        bench_printf("{\"role\":\"generator\",\"size\":%u,\"rate_kbps\":%u,\"queue\":%u,"
+                     "\"tx\":%llu,\"rx\":%llu,\"lost\":%llu,\"reorder\":%llu,",
+                     size, rate_kbps, queue_no,
+                     (unsigned long long)stream->tx, (unsigned long long)stream->rx,
+                     (unsigned long long)((stream->tx > stream->rx) ? (stream->tx - stream->rx) : 0u),
+                     (unsigned long long)stream->reorder);
+        bench_printf("\"tx_kbps\":%llu,\"rx_kbps\":%llu,\"rtt_ns\":{\"p50\":%u,\"p90\":%u,"
+                     "\"p99\":%u,\"max\":%u,\"samples\":%u,\"no_stamp\":%llu}}\r\n",
+                     (unsigned long long)((0u != ms) ? ((stream->tx * wire_bits) / ms) : 0u),
+                     (unsigned long long)((0u != ms) ? ((stream->rx * wire_bits) / ms) : 0u),
+                     p50, p90, p99, max, stream->samples,
+                     (unsigned long long)stream->no_stamp);
+
+        (void)snprintf(variant, sizeof(variant), "%s q%u %ukbit/s",
+                       (BENCH_UDP != 0) ? "udp" : "raw", queue_no, rate_kbps);
+        bench_record_init(&record, "mac", "rtt", variant);
+        record.size = size;
+        record.depth = BENCH_QUEUES;
+        record.rate = (0u != ms) ? ((stream->rx * wire_bits) / ms) : 0u;
+        record.rate_unit = "kbit/s";
+        if(0u != stream->samples)
+        {
+            sum = 0u;
+            for(index = 0u; index < stream->samples; index++)
+            {
+                sum += stream->rtt_ns[index];
+            }
+            record.samples = stream->samples;
+            record.min = stream->rtt_ns[0];
+            record.mean = sum / stream->samples;
+            record.p50 = p50;
+            record.p99 = p99;
+            record.max = max;
+            record.lat_unit = "ns";
+        }
+        bench_report_result(&g_gen_report, &record);
+    }
+}
+/******************************************************************************/
+/* Report lines go through the lock shared with the other harts */
+static void gen_report_tx(const uint8_t *line)
+{
+    bench_printf("%s", (const char *)line);
+}
+/******************************************************************************/
+static void gen_rx_sched(void *this_mac, uint32_t queue_no)
+{
+    (void)this_mac;
+
+    g_gen_rx_sched[queue_no] = 1u;
+}
+/******************************************************************************/
+/* Called from MSS_MAC_rx_poll() in the poll loop */
+static void gen_rx_callback(void *this_mac, uint32_t queue_no,
+                            uint8_t *p_rx_packet, uint32_t pckt_length,
+                            mss_mac_rx_desc_t *cdesc, void *p_user_data)
+{
+    mss_mac_tsu_time_t rx_time;
+    volatile gen_stamp_t *stamp;
+    gen_stream_t *stream;
+    bench_payload_t payload;
+    uint64_t rtt;
+
+    if(pckt_length >= (BENCH_PAYLOAD_OFFSET + sizeof(bench_payload_t)))
+    {
+        (void)memcpy(&payload, &p_rx_packet[BENCH_PAYLOAD_OFFSET], sizeof(payload));
+
+        if((BENCH_MAGIC == payload.magic) && (payload.stream < BENCH_QUEUES))
+        {
+            stream = &g_gen_stream[payload.stream];
+            stream->rx++;
+
+            if((int32_t)(payload.seq - stream->expect) < 0)
+            {
+                stream->reorder++;
+            }
+            else
+            {
+                stream->expect = payload.seq + 1u;
+            }
+
+            if((0u == (payload.seq & (stream->stride - 1u))) &&
+               (stream->samples < GEN_RTT_SAMPLES))
+            {
+                stamp = &g_gen_stamp[payload.stream][payload.seq & (GEN_STAMP_SLOTS - 1u)];
+
+                if((0u != stamp->valid) && (payload.seq == stamp->seq) &&
+                   (MSS_MAC_SUCCESS == MSS_MAC_get_rx_timestamp((mss_mac_instance_t *)this_mac,
+                                                                queue_no, cdesc, &rx_time)))
+                {
+                    rtt = gen_tsu_ns(&rx_time) - stamp->ns;
+                    stream->rtt_ns[stream->samples] = (rtt > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)rtt;
+                    stream->samples++;
+                }
+                else
+                {
+                    stream->no_stamp++;
+                }
+            }
+        }
+    }
+
+    (void)MSS_MAC_receive_pkt((mss_mac_instance_t *)this_mac, queue_no,
+                              p_rx_packet, p_user_data, MSS_MAC_INT_ENABLE);
+}
+/******************************************************************************/
+/* Called from the GEM0 queue interrupt as each frame is sent */
+static void gen_tx_callback(void *this_mac, uint32_t queue_no,
+                            mss_mac_tx_desc_t *cdesc, void *p_user_data)
+{
+    mss_mac_tsu_time_t tx_time;
+    volatile gen_stamp_t *stamp;
+    uint32_t stream = (uint32_t)((uintptr_t)p_user_data >> 32);
+    uint32_t seq = (uint32_t)(uintptr_t)p_user_data;
+
+    if(stream < BENCH_QUEUES)
+    {
+        stamp = &g_gen_stamp[stream][seq & (GEN_STAMP_SLOTS - 1u)];
+        if(MSS_MAC_SUCCESS == MSS_MAC_get_tx_timestamp((mss_mac_instance_t *)this_mac,
+                                                       queue_no, cdesc, &tx_time))
+        {
+            stamp->ns = gen_tsu_ns(&tx_time);
+            stamp->seq = seq;
+            stamp->valid = 1u;
+        }
+        else
+        {
+            stamp->valid = 0u;
+        }
+    }
+}
+/******************************************************************************/
+static void gen_sort(uint32_t *values, uint32_t count)
+{
+    uint32_t gap;
+    uint32_t index;
+    uint32_t inner;
+    uint32_t temp;
+
+    for(gap = count / 2u; gap > 0u; gap /= 2u)
+    {
+        for(index = gap; index < count; index++)
+        {
+            temp = values[index];
+            for(inner = index; (inner >= gap) && (values[inner - gap] > temp); inner -= gap)
+            {
+                values[inner] = values[inner - gap];
+            }
+            values[inner] = temp;
+        }
+    }
+}
+/******************************************************************************/
+static uint64_t gen_tsu_ns(const mss_mac_tsu_time_t *tsu)
+{
+    return ((((uint64_t)tsu->secs_msb << 32) | (uint64_t)tsu->secs_lsb) * 1000000000u) +
+           (uint64_t)tsu->nanoseconds;
+}
+#endif /* BENCH_RUN_GENERATOR */
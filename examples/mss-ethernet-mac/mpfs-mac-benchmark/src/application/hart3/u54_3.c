@@ -0,0 +1,295 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Application code running on U54_3
+ *
+ * Ethernet benchmark responder. Test frames received on queue 0 of GEM1 are
+ * sent straight back out of GEM1 from the receive buffer they arrived in, with
+ * the MAC and IP addresses swapped. The UDP ports are left alone so the frame
+ * returns to the generator queue which sent it. See README.txt.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss_mmuart/mss_uart.h"
+#include "inc/bench.h"
+
+/* Most frames received before the poll loop hands them to the MAC to send */
+#define RSP_RX_BUDGET               32u
+/* Most frames in one call to MSS_MAC_send_pkts() */
+#define RSP_TX_MAX                  (MSS_MAC_TX_RING_SIZE - 1u)
+#define RSP_STATS_MS                1000u
+
+volatile uint32_t count_sw_ints_h3 = 0U;
+
+#if BENCH_RUN_RESPONDER
+static uint8_t g_rsp_buf[MSS_MAC_RX_RING_SIZE][MSS_MAC_MAX_RX_BUF_SIZE] __attribute__ ((aligned (8)));
+
+/* Frames waiting to go back, plus the end of list entry */
+static mss_mac_tx_pkt_info_t g_rsp_pending[RSP_TX_MAX + 1u];
+static uint32_t g_rsp_pending_count = 0u;
+
+/* Frames handed to the MAC and not yet sent, decremented by the TX callback */
+static volatile uint32_t g_rsp_tx_busy = 0u;
+static volatile uint32_t g_rsp_rx_sched = 0u;
+
+static uint64_t g_rsp_reflected = 0u;
+static uint64_t g_rsp_other = 0u;
+static uint64_t g_rsp_dropped = 0u;
+
+static void rsp_rx_sched(void *this_mac, uint32_t queue_no);
+static void rsp_rx_callback(void *this_mac, uint32_t queue_no,
+                            uint8_t *p_rx_packet, uint32_t pckt_length,
+                            mss_mac_rx_desc_t *cdesc, void *p_user_data);
+static void rsp_tx_callback(void *this_mac, uint32_t queue_no,
+                            mss_mac_tx_desc_t *cdesc, void *p_user_data);
+static uint8_t rsp_is_bench_frame(const uint8_t *frame, uint32_t length);
+static void rsp_swap(uint8_t *frame, uint32_t offset, uint32_t length);
+static void rsp_run(void);
+#endif /* BENCH_RUN_RESPONDER */
+
+/* Main function for the hart3(U54_3 processor).
+ * Application code running on hart3 is placed here
+ *
+ * The hart3 goes into WFI. hart0 brings it out of WFI when it raises the first
+ * Software interrupt to this hart.
+ */
+void u54_3(void)
+{
+    /* Clear pending software interrupt in case there was any.
+       Enable only the software interrupt so that the E51 core can bring this
+       core out of WFI by raising a software interrupt. */
+    clear_soft_interrupt();
+    set_csr(mie, MIP_MSIP);
+
+    /* Put this hart in WFI. */
+    do
+    {
+        __asm("wfi");
+    }while(0 == (read_csr(mip) & MIP_MSIP));
+
+    /* The hart is now out of WFI, clear the SW interrupt. Here onwards the
+     * application can enable and use any interrupts as required */
+    clear_soft_interrupt();
+
+    while(0u == g_bench_started)
+    {
+    }
+
+#if BENCH_RUN_RESPONDER
+    PLIC_init();
+    __enable_irq();
+
+    rsp_run();
+#endif
+
+    while(1U)
+    {
+        __asm("wfi");
+    }
+
+  /* Never return */
+}
+
+/* hart3 software interrupt handler */
+void Software_h3_IRQHandler(void)
+{
+    count_sw_ints_h3++;
+}
+
+#if BENCH_RUN_RESPONDER
+/******************************************************************************/
+static void rsp_run(void)
+{
+    mss_mac_cfg_t cfg;
+    uint32_t index;
+    uint64_t next_stats;
+    uint64_t now;
+
+    bench_mac_config(&cfg, &g_mac1);
+
+    mss_take_mutex((uint64_t)&g_bench_mdio_lock);
+    MSS_MAC_init(&g_mac1, &cfg);
+    mss_release_mutex((uint64_t)&g_bench_mdio_lock);
+
+    __asm volatile ("fence" ::: "memory");
+    g_bench_gem1_ready = 1u;
+
+    if(MSS_MAC_AVAILABLE != g_mac1.mac_available)
+    {
+        bench_printf("{\"role\":\"responder\",\"error\":\"gem1 init\"}\r\n");
+    }
+    else
+    {
+        MSS_MAC_set_tx_callback(&g_mac1, 0u, rsp_tx_callback);
+        MSS_MAC_set_rx_callback(&g_mac1, 0u, rsp_rx_callback);
+        MSS_MAC_set_rx_poll_mode(&g_mac1, 0u, rsp_rx_sched);
+
+        for(index = 0u; index < MSS_MAC_RX_RING_SIZE; index++)
+        {
+            (void)MSS_MAC_receive_pkt(&g_mac1, 0u, g_rsp_buf[index], g_rsp_buf[index],
+                                      ((MSS_MAC_RX_RING_SIZE - 1u) == index) ?
+                                      MSS_MAC_INT_ARM : MSS_MAC_INT_DISABLE);
+        }
+
+        if(0u == bench_wait_link(&g_mac1))
+        {
+            bench_printf("{\"role\":\"responder\",\"error\":\"gem1 link down\"}\r\n");
+        }
+
+        next_stats = readmcycle() + (((uint64_t)BENCH_CYCLE_HZ / 1000u) * RSP_STATS_MS);
+
+        for(;;)
+        {
+            if(0u != g_rsp_rx_sched)
+            {
+                g_rsp_rx_sched = 0u;
+                if(RSP_RX_BUDGET == MSS_MAC_rx_poll(&g_mac1, 0u, RSP_RX_BUDGET))
+                {
+                    g_rsp_rx_sched = 1u;
+                }
+            }
+
+            /*
+             * MSS_MAC_send_pkts() refuses work while the queue is still
+             * sending so the next list waits for the last to complete.
+             */
+            if((0u != g_rsp_pending_count) && (0u == g_rsp_tx_busy))
+            {
+                g_rsp_pending[g_rsp_pending_count].length = 0u;
+                g_rsp_pending[g_rsp_pending_count].tx_buffer = NULL;
+                g_rsp_tx_busy = g_rsp_pending_count;
+
+                if(MSS_MAC_ERR_OK == MSS_MAC_send_pkts(&g_mac1, 1u, g_rsp_pending))
+                {
+                    g_rsp_reflected += g_rsp_pending_count;
+                    g_rsp_pending_count = 0u;
+                }
+                else
+                {
+                    g_rsp_tx_busy = 0u;
+                }
+            }
+
+            now = readmcycle();
+            if(now >= next_stats)
+            {
+                next_stats = now + (((uint64_t)BENCH_CYCLE_HZ / 1000u) * RSP_STATS_MS);
+                bench_printf("{\"role\":\"responder\",\"reflected\":%llu,\"other\":%llu,\"dropped\":%llu}\r\n",
+                             (unsigned long long)g_rsp_reflected,
+                             (unsigned long long)g_rsp_other,
+                             (unsigned long long)g_rsp_dropped);
+            }
+        }
+    }
+}
+/******************************************************************************/
+static void rsp_rx_sched(void *this_mac, uint32_t queue_no)
+{
+    (void)this_mac;
+    (void)queue_no;
+
+    g_rsp_rx_sched = 1u;
+}
+/******************************************************************************/
+/*
+ * Called from MSS_MAC_rx_poll() in the main loop. Test frames are turned round
+ * in place and kept for the next MSS_MAC_send_pkts() call, anything else goes
+ * straight back to the receive ring.
+ */
+static void rsp_rx_callback(void *this_mac, uint32_t queue_no,
+                            uint8_t *p_rx_packet, uint32_t pckt_length,
+                            mss_mac_rx_desc_t *cdesc, void *p_user_data)
+{
+    mss_mac_tx_pkt_info_t *entry;
+
+    (void)cdesc;
+
+    if((0u != rsp_is_bench_frame(p_rx_packet, pckt_length)) &&
+       (g_rsp_pending_count < RSP_TX_MAX))
+    {
+        rsp_swap(p_rx_packet, 0u, 6u);
+#if BENCH_UDP
+        rsp_swap(p_rx_packet, BENCH_IP_SRC_OFFSET, 4u);
+#endif
+        entry = &g_rsp_pending[g_rsp_pending_count];
+        entry->queue_no = 0u;
+        entry->length = pckt_length;
+        entry->tx_buffer = p_rx_packet;
+        entry->p_user_data = p_user_data;
+        g_rsp_pending_count++;
+    }
+    else
+    {
+        if(0u != rsp_is_bench_frame(p_rx_packet, pckt_length))
+        {
+            g_rsp_dropped++;
+        }
+        else
+        {
+            g_rsp_other++;
+        }
+
+        (void)MSS_MAC_receive_pkt((mss_mac_instance_t *)this_mac, queue_no,
+                                  p_rx_packet, p_user_data, MSS_MAC_INT_ENABLE);
+    }
+}
+/******************************************************************************/
+/* The frame has gone, so its buffer can receive again */
+static void rsp_tx_callback(void *this_mac, uint32_t queue_no,
+                            mss_mac_tx_desc_t *cdesc, void *p_user_data)
+{
+    (void)queue_no;
+    (void)cdesc;
+
+    (void)MSS_MAC_receive_pkt((mss_mac_instance_t *)this_mac, 0u,
+                              (uint8_t *)p_user_data, p_user_data, MSS_MAC_INT_ENABLE);
+    if(0u != g_rsp_tx_busy)
+    {
+        g_rsp_tx_busy--;
+    }
+}
+/******************************************************************************/
+static uint8_t rsp_is_bench_frame(const uint8_t *frame, uint32_t length)
+{
+    uint8_t is_bench = 0u;
+    uint32_t magic;
+    uint32_t ethertype;
+
+    if(length >= (BENCH_PAYLOAD_OFFSET + sizeof(bench_payload_t)))
+    {
+        ethertype = ((uint32_t)frame[BENCH_ETHERTYPE_OFFSET] << 8) |
+                    (uint32_t)frame[BENCH_ETHERTYPE_OFFSET + 1u];
+        (void)memcpy(&magic, &frame[BENCH_PAYLOAD_OFFSET], sizeof(magic));
+#if BENCH_UDP
+        if((0x0800u == ethertype) &&
+           (17u == frame[BENCH_ETH_HDR_LEN + 9u]) && (BENCH_MAGIC == magic))
+#else
+        if((BENCH_RAW_ETHERTYPE == ethertype) && (BENCH_MAGIC == magic))
+#endif
+        {
+            is_bench = 1u;
+        }
+    }
+
+    return (is_bench);
+}
+/******************************************************************************/
+/* Swaps the source and destination fields which follow each other at offset */
+static void rsp_swap(uint8_t *frame, uint32_t offset, uint32_t length)
+{
+    uint32_t index;
+    uint8_t temp;
+
+    for(index = 0u; index < length; index++)
+    {
+        temp = frame[offset + index];
+        frame[offset + index] = frame[offset + length + index];
+        frame[offset + length + index] = temp;
+    }
+}
+#endif /* BENCH_RUN_RESPONDER */
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Ethernet traffic generator and responder benchmark, shared definitions.
+ * See README.txt.
+ *
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stdint.h>
+#include "drivers/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac.h"
+
+/*
+ * Roles built into the image. The generator runs on U54_1 and uses GEM0, the
+ * responder runs on U54_3 and uses GEM1. With both set, the two ports of one
+ * board are cabled together. Set one of them to 0 to run the generator and
+ * responder on two boards.
+ */
+#ifndef BENCH_RUN_GENERATOR
+#define BENCH_RUN_GENERATOR         1
+#endif
+#ifndef BENCH_RUN_RESPONDER
+#define BENCH_RUN_RESPONDER         1
+#endif
+
+/* 1 for UDP over IPv4 streams, 0 for raw frames of BENCH_RAW_ETHERTYPE */
+#ifndef BENCH_UDP
+#define BENCH_UDP                   1
+#endif
+
+/* Generator streams, one per pMAC queue, 1 to MSS_MAC_QUEUE_COUNT */
+#ifndef BENCH_QUEUES
+#define BENCH_QUEUES                2u
+#endif
+
+#if (BENCH_QUEUES < 1u) || (BENCH_QUEUES > MSS_MAC_QUEUE_COUNT)
+#error "BENCH_QUEUES must be between 1 and MSS_MAC_QUEUE_COUNT"
+#endif
+
+#if !defined(MSS_MAC_DESC_TIMESTAMPS) || !defined(MSS_MAC_RX_POLL_MODE) || \
+    !defined(MSS_MAC_FLOW_STEERING)
+#error "The benchmark needs MSS_MAC_DESC_TIMESTAMPS, MSS_MAC_RX_POLL_MODE and MSS_MAC_FLOW_STEERING"
+#endif
+
+/* Frames per stream posted by each call to MSS_MAC_send_pkts() */
+#define BENCH_BATCH                 16u
+
+#if (BENCH_BATCH >= MSS_MAC_TX_RING_SIZE)
+#error "BENCH_BATCH must be less than MSS_MAC_TX_RING_SIZE"
+#endif
+
+#define BENCH_UDP_PORT_BASE         5000u
+#define BENCH_RAW_ETHERTYPE         0x88B5u
+#define BENCH_MAGIC                 0x4D504642u     /* "MPFB" */
+
+/*
+ * Test frame layout. Offsets are from the start of the frame, the payload
+ * follows the UDP header, or the Ethernet header for raw frames.
+ */
+#define BENCH_ETH_HDR_LEN           14u
+#define BENCH_IP_HDR_LEN            20u
+#define BENCH_UDP_HDR_LEN           8u
+#define BENCH_ETHERTYPE_OFFSET      12u
+#if BENCH_UDP
+#define BENCH_PAYLOAD_OFFSET        (BENCH_ETH_HDR_LEN + BENCH_IP_HDR_LEN + BENCH_UDP_HDR_LEN)
+#else
+#define BENCH_PAYLOAD_OFFSET        BENCH_ETH_HDR_LEN
+#endif
+#define BENCH_IP_SRC_OFFSET         (BENCH_ETH_HDR_LEN + 12u)
+#define BENCH_UDP_DST_PORT_OFFSET   (BENCH_ETH_HDR_LEN + BENCH_IP_HDR_LEN + 2u)
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t stream;
+    uint32_t seq;
+} bench_payload_t;
+
+/* Frame sizes include the FCS the MAC appends */
+#define BENCH_MIN_FRAME             64u
+#define BENCH_MAX_FRAME             1518u
+/* Preamble, start of frame delimiter and inter frame gap */
+#define BENCH_WIRE_OVERHEAD         20u
+
+#define BENCH_CYCLE_HZ              LIBERO_SETTING_MSS_COREPLEX_CPU_CLK
+
+/*
+ * Serialises the output of the harts on MMUART0 and the MDIO accesses made
+ * through GEM1, which owns the management interface of both PHYs.
+ */
+extern uint64_t g_bench_uart_lock;
+extern uint64_t g_bench_mdio_lock;
+
+/* Set by the E51 once MMUART0 is set up, before it wakes the U54s */
+extern volatile uint32_t g_bench_started;
+/* Set by the responder once GEM1 is up, so GEM0 can use its MDIO */
+extern volatile uint32_t g_bench_gem1_ready;
+
+void bench_printf(const char *fmt, ...);
+void bench_mac_config(mss_mac_cfg_t *cfg, const mss_mac_instance_t *mac);
+uint8_t bench_wait_link(mss_mac_instance_t *mac);
+
+#endif /* BENCH_H_ */
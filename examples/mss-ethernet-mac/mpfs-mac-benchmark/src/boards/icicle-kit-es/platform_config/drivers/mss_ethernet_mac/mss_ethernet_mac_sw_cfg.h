@@ -0,0 +1,557 @@
+/*******************************************************************************
+ * Copyright 2020 Microchip Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains system specific definitions for the PolarFire SoC MSS
+ * Ethernet MAC device driver.
+ * 
+ * Note: This file is maintained in the driver source repository in the same
+ *       folder as the driver source to keep them consistent but in the example
+ *       repositories the working copy resides in the current boards
+ *       platform_config/drivers/mss_mac folder and a reference copy is found in
+ *       the platform/platform_config_reference/drivers/mss_mac folder.
+ *
+ */
+
+#ifndef MICROSEMI__FIRMWARE__POLARFIRE_SOC_MSS_ETHERNET_MAC_DRIVER__1_7_107_CONFIGURATION_HEADER
+#define MICROSEMI__FIRMWARE__POLARFIRE_SOC_MSS_ETHERNET_MAC_DRIVER__1_7_107_CONFIGURATION_HEADER
+
+
+/***************************************************************************//**
+ * When running the documentation scripts, this macro should be defined to make
+ * sure the maximal macro selections are enabled so that the scripts pick up
+ * the complete documentation.
+ *
+ * Some macro definitions that are not normally used will be enabled if this
+ * macro is defined...
+ */
+#if 0
+#define MSS_MAC_DOCUMENTATION
+#endif
+
+
+/***************************************************************************//**
+ * Define this macro to add support for lower latency receive interrupt handling
+ * which may improve performance for full bandwidth network performance testing.
+ *
+ * If using debug mode build, you might set the NDEBUG macro in the project
+ * settings to further reduce interrupt overhead when using this option.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_UNH_TEST
+#endif
+
+/***************************************************************************//**
+ * This macro is normally defined at project level to select MPFS as the 
+ * platform. The alternative is to define _TARGET_ALOE_ for the SiFive Aloe or
+ * Aloe + Vera boards.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define TARGET_G5_SOC
+#endif
+
+
+/***************************************************************************//**
+ * Driver versioning macros.
+ */
+#define CORE_VENDOR "Microsemi"
+#define CORE_LIBRARY "Firmware"
+#define CORE_NAME "PolarFire_SoC_MSS_Ethernet_MAC_Driver"
+#define CORE_VERSION "1.7.107"
+
+
+/***************************************************************************//**
+ * Define this macro to add support for high speed transmission for network
+ * saturation testing. Not recommended for normal builds of the code as it may
+ * cause some unexpected behaviour for normal operations.
+ *
+ * If using debug mode build, you might set the NDEBUG macro in the project
+ * settings to reduce interrupt overhead when using this option.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_SPEED_TEST
+#endif
+
+/***************************************************************************//**
+ * Defines for OS and network stack specific support.
+ *
+ * Un-comment as necessary or define in project properties etc.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define USING_FREERTOS
+#define USING_LWIP
+#endif
+
+/***************************************************************************//**
+ * Supported PHY interface types: 
+ */
+
+#define NULL_PHY                        (0x0001U) /*!< @brief No PHY in connection, for example GEM0 and GEM1 connected via fabric */
+#define GMII                            (0x0002U) /*!< @brief Currently only on Aloe board */
+#define TBI                             (0x0004U) /*!< @brief G5 SoC Emulation Platform designs with TBI */
+#define GMII_SGMII                      (0x0008U) /*!< @brief G5 SoC Emulation Platform designs with SGMII to GMII conversion */
+#if 0
+#define BASEX1000                       (0x0010U) /* Not currently available */
+#define RGMII                           (0x0020U) /* Not currently available */
+#define RMII                            (0x0040U) /* Not currently available */
+#define SGMII                           (0x0080U) /* Not currently available */
+#endif
+
+/***************************************************************************//**
+ * Supported PHY models, used to control compile time inclusion of the
+ * associated PHY sub-drivers.
+ */
+
+#define MSS_MAC_DEV_PHY_NULL            (0x0001U) /*!< @brief No PHY device connected, for loopback and direct connection configurations */
+#define MSS_MAC_DEV_PHY_VSC8575         (0x0002U) /*!< @brief VSC8575 using full VTSS API */
+#define MSS_MAC_DEV_PHY_VSC8541         (0x0004U) /*!< @brief VSC8541 without VTSS API */
+#define MSS_MAC_DEV_PHY_DP83867         (0x0008U) /*!< @brief TI DP83867 */
+#define MSS_MAC_DEV_PHY_VSC8575_LITE    (0x0010U) /*!< @brief VSC8575 using Lite VTSS API */
+#define MSS_MAC_DEV_PHY_VSC8662         (0x0020U) /*!< @brief VSC8662 without VTSS API */
+
+
+/***************************************************************************//**
+ * Defines for the different hardware configurations for the applications using
+ * the driver. Used to allow software configure GPIO etc, to support the
+ * appropriate hardware configuration.
+ *
+ * Not strictly part of the driver but we manage them here to keep things tidy.
+ */
+
+#define MSS_MAC_DESIGN_ALOE                     (0)  /*!< @brief ALOE board from Sifive (GMII)*/
+#define MSS_MAC_DESIGN_EMUL_GMII                (1)  /*!< @brief G5 SoC Emulation Platform VSC8575 designs with GMII to SGMII bridge on GEM0 */
+#define MSS_MAC_DESIGN_EMUL_TBI                 (2)  /*!< @brief G5 SoC Emulation Platform VSC8575 designs with TBI to SGMII bridge on GEM0 */
+#define MSS_MAC_DESIGN_EMUL_DUAL_INTERNAL       (3)  /*!< @brief G5 SoC Emulation Platform Dual GEM design with loopback in fabric */
+#define MSS_MAC_DESIGN_EMUL_TI_GMII             (4)  /*!< @brief G5 SoC Emulation Platform DP83867 design with GMII to SGMII bridge */
+#define MSS_MAC_DESIGN_EMUL_DUAL_EX_TI          (5)  /*!< @brief G5 SoC Emulation Platform Dual GEM design with external TI PHY on GEM1 (GMII) */
+#define MSS_MAC_DESIGN_EMUL_DUAL_EX_VTS         (6)  /*!< @brief G5 SoC Emulation Platform Dual GEM design with external Vitess PHY on GEM0 (GMII) */
+#define MSS_MAC_DESIGN_EMUL_GMII_GEM1           (7)  /*!< @brief G5 SoC Emulation Platform VSC8575 designs with GMII to SGMII bridge on GEM 1 */
+#define MSS_MAC_DESIGN_EMUL_DUAL_EXTERNAL       (8)  /*!< @brief G5 SoC Emulation Platform Dual GEM design with GEM0 -> VSC, GEM1 -> TI (both GMII) */
+#define MSS_MAC_DESIGN_EMUL_TBI_GEM1            (9)  /*!< @brief G5 SoC Emulation Platform VSC8575 designs with TBI to SGMII bridge GEM1 */
+#define MSS_MAC_DESIGN_EMUL_TBI_TI              (10) /*!< @brief G5 SoC Emulation Platform DP83867 designs with TBI to SGMII bridge GEM0 */
+#define MSS_MAC_DESIGN_EMUL_TBI_GEM1_TI         (11) /*!< @brief G5 SoC Emulation Platform DP83867 designs with TBI to SGMII bridge GEM1 */
+#define MSS_MAC_DESIGN_EMUL_GMII_LOCAL          (12) /*!< @brief G5 SoC Emulation Platform VSC8575 design with GMII to SGMII bridge with local ints */
+#define MSS_MAC_DESIGN_RENODE                   (13) /*!< @brief Renode */
+#define MSS_MAC_DESIGN_SVG_SGMII_GEM0           (14) /*!< @brief Silicon validation board GEM0 */
+#define MSS_MAC_DESIGN_SVG_SGMII_GEM1           (15) /*!< @brief Silicon validation board GEM1 */
+#define MSS_MAC_DESIGN_SVG_DUAL_GEM             (16) /*!< @brief Silicon validation board both GEMS */
+#define MSS_MAC_DESIGN_SVG_GMII_GEM0            (17) /*!< @brief Silicon validation board GEM0 */
+#define MSS_MAC_DESIGN_SVG_GMII_GEM1            (18) /*!< @brief Silicon validation board GEM1 */
+#define MSS_MAC_DESIGN_ICICLE_SGMII_GEM0        (19) /*!< @brief Icicle board GEM0 */
+#define MSS_MAC_DESIGN_ICICLE_SGMII_GEM1        (20) /*!< @brief Icicle board GEM1 */
+#define MSS_MAC_DESIGN_ICICLE_SGMII_GEMS        (21) /*!< @brief Icicle board GEM0 and GEM1 */
+#define MSS_MAC_DESIGN_ICICLE_STD_GEM0          (22) /*!< @brief Icicle board GEM0 Standard Reference Design */
+#define MSS_MAC_DESIGN_ICICLE_STD_GEM1          (23) /*!< @brief Icicle board GEM1 Standard Reference Design */
+#define MSS_MAC_DESIGN_ICICLE_STD_GEMS          (24) /*!< @brief Icicle board GEM0 and GEM1 Standard Reference Design */
+#define MSS_MAC_DESIGN_SVG_GMII_GEM0_SGMII_GEM1 (25) /*!< @brief Silicon validation  board GEM0 (GMII) and GEM1 (SGMII) */
+
+#if defined(TARGET_ALOE)
+#define MSS_MAC_PHY_INTERFACE GMII /* Only one option allowed here... */
+#define MSS_MAC_RX_RING_SIZE (4U)
+#define MSS_MAC_TX_RING_SIZE (2U)
+#define MSS_MAC_PHYS (MSS_MAC_DEV_PHY_NULL | MSS_MAC_DEV_PHY_VSC8541)
+#define MSS_MAC_HW_PLATFORM MSS_MAC_DESIGN_ALOE
+#endif
+
+/***************************************************************************//**
+ * Define one of these macros if using the VSC8662 PHY recovered clock through
+ * the NWC at 25MHZ or 125MHZ. You will need to configure the SGMII PLL Mux as
+ * well.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_VSC8662_NWC_25
+#define MSS_MAC_VSC8662_NWC_125
+#endif
+
+#if defined(TARGET_G5_SOC)
+/***************************************************************************//**
+ * This macro is a bit map that indicates which PHY sub drivers are included in
+ * this build.
+ */
+#define MSS_MAC_PHYS (MSS_MAC_DEV_PHY_NULL | MSS_MAC_DEV_PHY_VSC8575_LITE | MSS_MAC_DEV_PHY_DP83867 | MSS_MAC_DEV_PHY_VSC8662 | MSS_MAC_DEV_PHY_VSC8541)
+
+/***************************************************************************//**
+ * Set this macro to one of the _MSS_MAC_DESIGN_XX_ macros to configure the
+ * hardware platform for the application.
+ */
+#define MSS_MAC_HW_PLATFORM MSS_MAC_DESIGN_ICICLE_STD_GEM0
+//#define MSS_MAC_HW_PLATFORM MSS_MAC_DESIGN_SVG_SGMII_GEM1
+//#define MSS_MAC_HW_PLATFORM MSS_MAC_DESIGN_EMUL_DUAL_EX_VTS
+/***************************************************************************//**
+ * Number of receive buffer descriptors per queue.
+ *
+ *  Minimum size is 16 as the descriptor caching implemented by the GEM DMA
+ *  requires that we make sure there are valid packet descriptors in all the
+ *  cached buffer slots.
+ */
+#define MSS_MAC_RX_RING_SIZE (16U)
+
+/***************************************************************************//**
+ * Number of transmit buffer descriptors per queue.
+ *
+ *  Minimum size is 16 as the descriptor caching implemented by the GEM DMA
+ *  requires that we make sure there are valid packet descriptors in all the
+ *  cached buffer slots.
+ */
+#if defined(MSS_MAC_SPEED_TEST)
+#define MSS_MAC_TX_RING_SIZE (4001U)
+#else
+#define MSS_MAC_TX_RING_SIZE (64U)
+#endif
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add the batch transmit functions. These post a list of
+ * packets to any queue of a pMAC or eMAC with a single transmit start and can
+ * report the completion of the whole batch with one callback.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_TX_BATCH
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add deferred transmit completion processing. Queues
+ * switched to deferred mode with _MSS_MAC_set_tx_reclaim_mode()_ reclaim sent
+ * descriptors on the next send or on a call to _MSS_MAC_tx_reclaim()_ instead
+ * of in the transmit interrupt. This requires the batch transmit support.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_TX_DEFERRED_RECLAIM
+#endif
+
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM) && !defined(MSS_MAC_TX_BATCH)
+#define MSS_MAC_TX_BATCH
+#endif
+
+/***************************************************************************//**
+ * Define this macro to enable the driver managed receive buffer pool. When the
+ * pool is attached to a queue with _MSS_MAC_rx_pool_init()_, the driver refills
+ * the receive descriptor ring from the pool itself and lends each received
+ * buffer to the application as a reference counted _mss_mac_rx_buf_t_ handle
+ * instead of requiring _MSS_MAC_receive_pkt()_ to be called for every frame.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_RX_BUFFER_POOL
+#endif
+
+/***************************************************************************//**
+ * Maximum number of buffers in each queue's receive buffer pool. This should be
+ * larger than _MSS_MAC_RX_RING_SIZE_ so that the receive ring can still be kept
+ * full while the application holds on to some of the received buffers.
+ */
+#if defined(MSS_MAC_RX_BUFFER_POOL) && !defined(MSS_MAC_RX_POOL_SIZE)
+#define MSS_MAC_RX_POOL_SIZE (MSS_MAC_RX_RING_SIZE * 2U)
+#endif
+
+/***************************************************************************//**
+ * Define this macro to receive frames across several receive buffers. Each
+ * buffer is then _MSS_MAC_RX_CHAIN_BUF_SIZE_ bytes rather than the maximum
+ * packet size and a longer frame, a jumbo frame for example, is handed to the
+ * callback set with _MSS_MAC_set_rx_chain_callback()_ as the list of buffers
+ * it was received into.
+ *
+ * _MSS_MAC_RX_CHAIN_BUF_SIZE_ must be a multiple of 64 and the receive ring
+ * must be able to hold a maximum size frame. This cannot be used with the
+ * receive buffer pool.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_RX_CHAINED
+#endif
+
+#if defined(MSS_MAC_RX_CHAINED)
+#if !defined(MSS_MAC_RX_CHAIN_BUF_SIZE)
+#define MSS_MAC_RX_CHAIN_BUF_SIZE (1536U)
+#endif
+
+/* Buffers needed for a frame of the hardware maximum of 10240 bytes */
+#define MSS_MAC_RX_CHAIN_MAX ((10240U + MSS_MAC_RX_CHAIN_BUF_SIZE - 1U) / MSS_MAC_RX_CHAIN_BUF_SIZE)
+
+#if (0U != (MSS_MAC_RX_CHAIN_BUF_SIZE % 64U))
+#error "MSS_MAC_RX_CHAIN_BUF_SIZE must be a multiple of 64"
+#endif
+#if (MSS_MAC_RX_CHAIN_MAX > MSS_MAC_RX_RING_SIZE)
+#error "MSS_MAC_RX_RING_SIZE is too small for MSS_MAC_RX_CHAIN_BUF_SIZE"
+#endif
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+#error "MSS_MAC_RX_CHAINED cannot be used with MSS_MAC_RX_BUFFER_POOL"
+#endif
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add support for polled receive operation. When polling
+ * is enabled for a queue with _MSS_MAC_set_rx_poll_mode()_, the first receive
+ * interrupt masks further receive interrupts for the queue and asks the
+ * application to schedule a call to _MSS_MAC_rx_poll()_. Receive interrupts
+ * are only re-enabled once polling has emptied the receive ring.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_RX_POLL_MODE
+#endif
+#define MSS_MAC_RX_POLL_MODE
+
+/***************************************************************************//**
+ * Define this macro to add the flow steering support functions which spread
+ * receive traffic across the pMAC queues using the Type 1 and Type 2
+ * screeners and route each queue's PLIC interrupt to a chosen U54.
+ *
+ * _MSS_MAC_FLOW_TABLE_SIZE_ sets the number of entries in the flow hash
+ * indirection table and must be a power of 2.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_FLOW_STEERING
+#endif
+#define MSS_MAC_FLOW_STEERING
+
+#if defined(MSS_MAC_FLOW_STEERING) && !defined(MSS_MAC_FLOW_TABLE_SIZE)
+#define MSS_MAC_FLOW_TABLE_SIZE (64U)
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add a lock-free single producer, single consumer
+ * transmit ring in front of each queue. One hart per queue pushes packets with
+ * _MSS_MAC_tx_ring_push()_ without masking interrupts and the driver moves
+ * them onto the DMA descriptors from the push call or the transmit interrupt,
+ * whichever gets there first. This requires the batch transmit support.
+ *
+ * _MSS_MAC_TX_SPSC_SIZE_ sets the number of entries in each ring and must be a
+ * power of 2.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_TX_SPSC_RING
+#endif
+
+#if defined(MSS_MAC_TX_SPSC_RING) && !defined(MSS_MAC_TX_BATCH)
+#define MSS_MAC_TX_BATCH
+#endif
+
+#if defined(MSS_MAC_TX_SPSC_RING) && !defined(MSS_MAC_TX_SPSC_SIZE)
+#define MSS_MAC_TX_SPSC_SIZE (64U)
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add the performance counters read by
+ * _MSS_MAC_get_stats()_. The driver then times each MAC interrupt with the
+ * mcycle counter and tracks how many descriptors are handled per interrupt
+ * and the high-water marks of the transmit and receive rings.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_PERF_STATS
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add asynchronous link bring-up. When the _async_link_
+ * configuration parameter is set, _MSS_MAC_init()_ returns once the PHY has
+ * been initialised and the autonegotiation is stepped through by calls to
+ * _MSS_MAC_link_poll()_ from a timer or the PHY interrupt.
+ *
+ * _MSS_MAC_LINK_POLL_LIMIT_ sets the number of calls to _MSS_MAC_link_poll()_
+ * each step waits for before moving on as the blocking code would on timeout.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_ASYNC_LINK
+#endif
+
+#if defined(MSS_MAC_ASYNC_LINK) && !defined(MSS_MAC_LINK_POLL_LIMIT)
+#define MSS_MAC_LINK_POLL_LIMIT (1000U)
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add the queued MDIO engine. A list of PHY register
+ * operations given to _MSS_MAC_mdio_submit()_ is run back to back from the GEM
+ * management frame sent interrupt, or by _MSS_MAC_mdio_run()_ in one call.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_MDIO_QUEUE
+#endif
+
+/***************************************************************************//**
+ * Define this macro to have the receive and transmit callbacks read the time
+ * stamp the GEM writes to the DMA descriptor with
+ * _MSS_MAC_get_rx_timestamp()_ and _MSS_MAC_get_tx_timestamp()_. The upper
+ * seconds of the TSU are latched once each time the driver works through a
+ * ring rather than read for each packet. _MSS_MAC_TIME_STAMPED_MODE_ must be
+ * defined as well.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_DESC_TIMESTAMPS
+#endif
+#define MSS_MAC_DESC_TIMESTAMPS
+
+/***************************************************************************//**
+ * Define this macro to add the TSN traffic class layer. _MSS_MAC_tsn_init()_
+ * maps each VLAN priority (PCP) to the eMAC, for express traffic, or to a pMAC
+ * queue, sets up the credit based shapers and the MAC Merge Sublayer and
+ * _MSS_MAC_tsn_send_pkt()_ sends a frame to the MAC and queue of its PCP.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_TSN
+#endif
+
+/***************************************************************************//**
+ * Define this macro to build the two port software bridge of
+ * _mss_ethernet_mac_bridge.h_. Frames received on one MAC are sent out of the
+ * other from the same buffer and a MAC address learning table filters the
+ * frames which need not cross. The bridge uses polled receive and deferred
+ * transmit reclaim.
+ *
+ * _MSS_MAC_BRIDGE_TABLE_SIZE_ sets the entries in the learning table, a power
+ * of two, _MSS_MAC_BRIDGE_AGE_TICKS_ the calls to _MSS_MAC_bridge_tick()_ after
+ * which an address not seen again is forgotten and _MSS_MAC_BRIDGE_MAX_BUFS_
+ * the most buffers the bridge can own.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_BRIDGE
+#endif
+
+#if defined(MSS_MAC_BRIDGE)
+#if !defined(MSS_MAC_RX_POLL_MODE)
+#define MSS_MAC_RX_POLL_MODE
+#endif
+#if !defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+#define MSS_MAC_TX_DEFERRED_RECLAIM
+#endif
+#if !defined(MSS_MAC_TX_BATCH)
+#define MSS_MAC_TX_BATCH
+#endif
+#if !defined(MSS_MAC_BRIDGE_TABLE_SIZE)
+#define MSS_MAC_BRIDGE_TABLE_SIZE (256U)
+#endif
+#if !defined(MSS_MAC_BRIDGE_AGE_TICKS)
+#define MSS_MAC_BRIDGE_AGE_TICKS  (300U)
+#endif
+#if !defined(MSS_MAC_BRIDGE_MAX_BUFS)
+#define MSS_MAC_BRIDGE_MAX_BUFS   (4U * MSS_MAC_RX_RING_SIZE)
+#endif
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add the multicast filter manager. Addresses joined with
+ * _MSS_MAC_mcast_add()_ are counted and programmed into the specific address
+ * filters and the hash filter of the MAC so that unwanted multicast frames are
+ * dropped by the hardware.
+ *
+ * _MSS_MAC_MCAST_LIST_SIZE_ sets the number of addresses each MAC can hold and
+ * _MSS_MAC_MCAST_SA_FILTERS_, 0 to 3, the number of specific address filters,
+ * counting up from filter 2, given over to exact matching of the first
+ * addresses joined.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_MCAST_FILTER
+#endif
+
+#if defined(MSS_MAC_MCAST_FILTER)
+#if !defined(MSS_MAC_MCAST_LIST_SIZE)
+#define MSS_MAC_MCAST_LIST_SIZE   (16U)
+#endif
+#if !defined(MSS_MAC_MCAST_SA_FILTERS)
+#define MSS_MAC_MCAST_SA_FILTERS  (3U)
+#endif
+#if (MSS_MAC_MCAST_SA_FILTERS > 3U)
+#error "MSS_MAC_MCAST_SA_FILTERS must be 3 or less"
+#endif
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add packet capture. _MSS_MAC_capture_start()_ has the
+ * driver copy the start of each frame received, and optionally sent, with a
+ * TSU time stamp into a ring in memory supplied by the application and
+ * _MSS_MAC_capture_dump()_ writes the ring out in pcap format.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_CAPTURE
+#endif
+
+/*
+ * Define MSS_MAC_CACHE_MAINTENANCE to have the driver flush transmit buffers
+ * from the L2 cache as they are queued and flush receive buffers as they are
+ * handed to the DMA engine and again before the receive callback is called.
+ * This allows packet buffers to be placed in cached DDR. The descriptor rings
+ * are not maintained and must still be placed in non-cached memory.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_CACHE_MAINTENANCE
+#endif
+
+/***************************************************************************//**
+ * Macros for testing for different PHY models supported in the current build.
+ */
+#define MSS_MAC_USE_PHY_VSC8575      (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_VSC8575))
+#define MSS_MAC_USE_PHY_VSC8575_LITE (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_VSC8575_LITE))
+#define MSS_MAC_USE_PHY_VSC8541      (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_VSC8541))
+#define MSS_MAC_USE_PHY_DP83867      (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_DP83867))
+#define MSS_MAC_USE_PHY_NULL         (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_NULL))
+#define MSS_MAC_USE_PHY_VSC8662      (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_VSC8662))
+
+/***************************************************************************//**
+ * Macros for selecting options which change the size of the DMA descriptors.
+ * Both these features change the layout of the descriptors as there are
+ * additional entries needed in the descriptors to support them.
+ */
+#if !defined(MSS_MAC_SPEED_TEST) || defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_TIME_STAMPED_MODE      (0) /*!< @brief Enable time stamp support */
+#define MSS_MAC_64_BIT_ADDRESS_MODE    (0) /*!< @brief Enable 64 bit addressing */
+#endif
+
+#if defined(MSS_MAC_DESC_TIMESTAMPS) && !defined(MSS_MAC_TIME_STAMPED_MODE)
+#error "MSS_MAC_DESC_TIMESTAMPS needs MSS_MAC_TIME_STAMPED_MODE"
+#endif
+
+/***************************************************************************//**
+ * Defines for different memory areas. Set the macro _MSS_MAC_USE_DDR_ to one of
+ * these values to select the area of memory and buffer sizes to use when
+ * testing for non LIM based areas of memory. 
+ */
+
+#define MSS_MAC_MEM_DDR    (0)
+#define MSS_MAC_MEM_FIC0   (1)
+#define MSS_MAC_MEM_FIC1   (2)
+#define MSS_MAC_MEM_CRYPTO (3)
+
+/***************************************************************************//**
+ * Number of additional queues for PMAC (eMAC only has 1).
+ *
+ * __Note:__ We explicitly set the number of queues in the MAC structure as we
+ * have to indicate the Interrupt Number so this is slightly artificial...
+ */
+#if defined(TARGET_ALOE)
+#define MSS_MAC_QUEUE_COUNT (1)
+#else
+#if defined(MSS_MAC_SPEED_TEST)
+#define MSS_MAC_QUEUE_COUNT (1)
+#else
+#define MSS_MAC_QUEUE_COUNT (4)
+#endif
+#endif
+
+
+/***************************************************************************//**
+ * Number of Type 1 and 2 screeners for pMAC.
+ */
+
+#define MSS_MAC_TYPE_1_SCREENERS  (4U)
+#define MSS_MAC_TYPE_2_SCREENERS  (4U)
+#define MSS_MAC_TYPE_2_ETHERTYPES (4U)
+#define MSS_MAC_TYPE_2_COMPARERS  (12U)
+
+/***************************************************************************//**
+ * Number of Type 1 and 2 screeners for eMAC.
+ *
+ * These are hard coded and not user selectable
+ */
+#define MSS_MAC_EMAC_TYPE_2_SCREENERS  (2U)
+#define MSS_MAC_EMAC_TYPE_2_COMPARERS  (6U)
+
+/***************************************************************************//**
+ * Define one or both of these macros to enable support for hardware based
+ * Hard Reset or Soft Reset of the PHY. This will result in inclusion of the
+ * MSS GPIO  driver in the project.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_PHY_HW_RESET /*!< @brief If this is defined, the hard reset of the PHY is controllable via GPIO. */
+#endif
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_PHY_HW_SRESET /*!< @brief If this is defined, the hard reset of the PHY is controllable via GPIO. */
+#endif
+
+#endif /* MICROSEMI__FIRMWARE__POLARFIRE_SOC_MSS_ETHERNET_MAC_DRIVER__1_7_107_CONFIGURATION_HEADER */
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright 2019-2020 Microchip FPGA Embedded Systems Solutions.
+ * 
+ * SPDX-License-Identifier: MIT
+ * 
+ * @file hw_mpu_fic0.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * 
+ * Generated using Libero version: 1.0
+ * Libero design name: ICICLE_MSS
+ * MPFS part number used in design: MPFS250T_ES
+ * Date generated by Libero: 09-18-2020_10:08:56
+ * Format version of XML description: 0.3.8
+ * PolarFire SoC Configuration Generator version: 0.4.1
+ * 
+ * Note 1: This file should not be edited. If you need to modify a parameter,
+ * without going through the Libero flow or editing the associated xml file,
+ * the following method is recommended:
+ *   1. edit the file platform//config//software//mpfs_hal//mss_sw_config.h
+ *   2. define the value you want to override there. (Note: There is a 
+ *      commented example in mss_sw_config.h)
+ * Note 2: The definition in mss_sw_config.h takes precedence, as 
+ * mss_sw_config.h is included prior to the hw_mpu_fic0.h in the hal 
+ * (see platform//mpfs_hal//mss_hal.h)
+ *
+ */ 
+
+#ifndef HW_MPU_FIC0_H_
+#define HW_MPU_FIC0_H_
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP0)
+/*mpu setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP0    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP1)
+/*mpu setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP1    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP2)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP2    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP3)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP3    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP4)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP4    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP5)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP5    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP6)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP6    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP7)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP7    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP8)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP8    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP9)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP9    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP10)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP10    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP11)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP11    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP12)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP12    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP13)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP13    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP14)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP14    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+#if !defined (LIBERO_SETTING_FIC0_MPU_CFG_PMP15)
+/*pmp setup register, 64 bits */ 
+#define LIBERO_SETTING_FIC0_MPU_CFG_PMP15    0x1F00000FFFFFFFFFULL
+    /* PMP                               [0:38]  RW value= 0xFFFFFFFFF */ 
+    /* RESERVED                          [38:18] RW value= 0x0 */ 
+    /* MODE                              [56:8]  RW value= 0x1F */ 
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* #ifdef HW_MPU_FIC0_H_ */
+
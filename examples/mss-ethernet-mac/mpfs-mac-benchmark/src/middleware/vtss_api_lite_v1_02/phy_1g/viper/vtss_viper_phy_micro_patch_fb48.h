@@ -0,0 +1,30 @@
+/* ******************************************************************************
+* Copyright © 2015 Microsemi Corporation                                        *
+* Permission is hereby granted, free of charge, to any person obtaining a copy  *
+* of this software and associated documentation files (the "Software"), to deal *
+* in the Software without restriction, including without limitation the rights  *
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell     *
+* copies of the Software, and to permit persons to whom the Software is         *
+* furnished to do so, subject to the following conditions:                      *
+* The above copyright notice and this permission notice shall be included in    *
+* all copies or substantial portions of the Software.                           *
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR    *
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,      *
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE   *
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER        *
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, *
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN     *
+* THE SOFTWARE.                                                                 *
+******************************************************************************* */
+const uint8_t vsc_viper_phy_micro_patch_fb48[] = {
+        0xe8, 0x59, 0x02, 0xe8, 0x12, 0x02, 0xe8, 0x42, 0x02, 0xe8,
+        0x5a, 0x02, 0xe8, 0x5b, 0x02, 0xe8, 0x5c, 0xe5, 0x69, 0x54,
+        0x0f, 0x24, 0xf7, 0x60, 0x27, 0x24, 0xfc, 0x60, 0x23, 0x24,
+        0x08, 0x70, 0x14, 0xe5, 0x69, 0xae, 0x68, 0x78, 0x04, 0xce,
+        0xa2, 0xe7, 0x13, 0xce, 0x13, 0xd8, 0xf8, 0x7e, 0x00, 0x54,
+        0x0f, 0x80, 0x00, 0x7b, 0x01, 0x7a, 0x00, 0x7d, 0xee, 0x7f,
+        0x92, 0x12, 0x50, 0xee, 0x22, 0xe4, 0xf5, 0x10, 0x85, 0x10,
+        0xfb, 0x7d, 0x1c, 0xe4, 0xff, 0x12, 0x59, 0xea, 0x05, 0x10,
+        0xe5, 0x10, 0xc3, 0x94, 0x04, 0x40, 0xed, 0x22, 0x22, 0x22,
+        0x22, 0x22
+};
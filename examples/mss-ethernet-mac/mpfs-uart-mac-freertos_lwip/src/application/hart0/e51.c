@@ -58,6 +58,8 @@
 #include "lwip/sockets.h"
 #include "WebServer/if_utils.h"
 
+#include "inc/rtos_bench.h"
+
 typedef socklen_t SOCKLEN_T;
 #include "lwip/def.h"
 #include "lwip/inet.h"
@@ -589,6 +591,15 @@ void u54_2(void)
 
     PLIC_init();
 
+#ifdef RTOS_BENCH
+    rtos_result = xTaskCreate( rtos_bench_task, "rtos_bench", 4000, NULL, RTOS_BENCH_PRIORITY, NULL );
+    if(1 != rtos_result)
+    {
+        int ix;
+        for(;;)
+            ix++;
+    }
+#else
     rtos_result = xTaskCreate( e51_task, "u54", 4000, NULL, uartPRIMARY_PRIORITY, NULL );
     if(1 != rtos_result)
     {
@@ -626,6 +637,7 @@ void u54_2(void)
     vTaskSuspend(thandle_link);
     vTaskSuspend(thandle_web);
 #endif
+#endif /* RTOS_BENCH */
 
     /* Start the kernel.  From here on, only tasks and interrupts will run. */
       vTaskStartScheduler();
@@ -665,6 +677,15 @@ void e51(void)
 
     PLIC_init();
 
+#ifdef RTOS_BENCH
+    rtos_result = xTaskCreate( rtos_bench_task, "rtos_bench", 4000, NULL, RTOS_BENCH_PRIORITY, NULL );
+    if(1 != rtos_result)
+    {
+        int ix;
+        for(;;)
+            ix++;
+    }
+#else
     rtos_result = xTaskCreate( e51_task, "e51", 4000, NULL, uartPRIMARY_PRIORITY, NULL );
     if(1 != rtos_result)
     {
@@ -702,6 +723,7 @@ void e51(void)
     vTaskSuspend(thandle_link);
     vTaskSuspend(thandle_web);
 #endif
+#endif /* RTOS_BENCH */
 
     /* Start the kernel.  From here on, only tasks and interrupts will run. */
       vTaskStartScheduler();
@@ -712,12 +734,6 @@ void e51(void)
  *
  */
 
-/*
- * Default to e51 values
- */
-volatile uint64_t* mtime = (volatile uint64_t*)0x0200bff8;
-volatile uint64_t* timecmp = (volatile uint64_t*)0x02004000;
-
 void e51_task( void *pvParameters )
 {
     int count;
@@ -1009,10 +1025,6 @@ Hart 0, 1048576 loops required 580897991 cycles, sw ints h0 = 0, sw ints h1 = 0,
     MSS_GPIO_set_output(GPIO2_LO, MSS_GPIO_27, 0);
     MSS_GPIO_set_output(GPIO2_LO, MSS_GPIO_28, 0);
 
-    /* U54 2 values */
-    mtime = (volatile uint64_t*)0x0200bff8;
-    timecmp = ((volatile uint64_t*)0x02004000) + 2;
-
 #endif
 
 
@@ -1538,6 +1550,26 @@ void Software_h0_IRQHandler(void)
     {
         count_sw_ints_h0++;
     }
+
+#ifdef RTOS_BENCH
+    rtos_bench_sw_isr();
+#endif
+
+    /* Return from functions run on the U54s by xPortHartCall() */
+    vPortHartCallISR();
+}
+#endif
+
+#if MSS_MAC_HW_PLATFORM  == MSS_MAC_DESIGN_ICICLE_STD_GEM0_LOCAL
+/**
+ * The scheduler runs on U54_2 in this configuration.
+ */
+void Software_h2_IRQHandler(void)
+{
+#ifdef RTOS_BENCH
+    rtos_bench_sw_isr();
+#endif
+    vPortHartCallISR();
 }
 #endif
 
@@ -0,0 +1,388 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * FreeRTOS context switch and IPC benchmark, see inc/rtos_bench.h.
+ *
+ * Each sample is the mcycle count from just before a task hands over to the
+ * cycle the task it hands over to is running again after the kernel call it
+ * was blocked in:
+ *  - yield: two tasks of the same priority taking turns with taskYIELD()
+ *  - sem give->take: xSemaphoreGive() to a higher priority task blocked in
+ *    xSemaphoreTake()
+ *  - queue send->receive: xQueueSend() to a higher priority task blocked in
+ *    xQueueReceive(), the item being the start time
+ *  - sw irq->isr: raise_soft_interrupt() of the own hart to the software
+ *    interrupt handler running
+ *  - isr notify->task: vTaskNotifyGiveFromISR() in that handler to the higher
+ *    priority task blocked in ulTaskNotifyTake() running
+ *
+ * With floating point context, both tasks write a floating point register
+ * before each hand over, so mstatus.FS is dirty and the port saves and
+ * restores f0 to f31 and fcsr on each switch. A task which has used floating
+ * point once keeps FS dirty, so the tests without floating point context all
+ * run first, and the benchmark task prints nothing until they are done.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss_mmuart/mss_uart.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+
+#include "inc/rtos_bench.h"
+#include "bench_report.h"
+
+#ifdef RTOS_BENCH
+
+typedef enum
+{
+    BENCH_YIELD = 0,
+    BENCH_SEM,
+    BENCH_QUEUE,
+    BENCH_SW_IRQ,
+    BENCH_ISR_TASK,
+    BENCH_NUM_TESTS
+} bench_test_t;
+
+typedef struct
+{
+    uint64_t min;
+    uint64_t max;
+    uint64_t sum;
+    uint32_t samples;
+    uint32_t skip;
+} bench_stat_t;
+
+static const char * const g_test_name[BENCH_NUM_TESTS] =
+{
+    "yield",
+    "sem give->take",
+    "queue send->receive",
+    "sw irq->isr",
+    "isr notify->task"
+};
+
+/* Without and with floating point context */
+static bench_stat_t g_stat[2][BENCH_NUM_TESTS];
+
+static volatile uint32_t g_use_fp = 0u;
+
+#ifdef __riscv_flen
+static volatile double g_fp_acc = 0.0;
+#endif
+
+/* mcycle just before the hand over, and on entry to the interrupt handler */
+static volatile uint64_t g_t0;
+static volatile uint64_t g_t_isr;
+
+static SemaphoreHandle_t g_sem = NULL;
+static QueueHandle_t g_queue = NULL;
+
+/* Task woken by rtos_bench_sw_isr(), NULL outside of the interrupt test */
+static TaskHandle_t volatile g_isr_task = NULL;
+
+static bench_report_t g_report;
+
+/* Settings given on the config lines of the report */
+static const bench_config_t g_bench_config[] =
+{
+    BENCH_CONFIG(RTOS_BENCH_SAMPLES),
+    BENCH_CONFIG(RTOS_BENCH_WARMUP),
+    BENCH_CONFIG(RTOS_BENCH_PRIORITY),
+    BENCH_CONFIG(configTICK_RATE_HZ),
+    BENCH_CONFIG(configMAX_PRIORITIES)
+};
+
+static void stat_reset(bench_stat_t * stat)
+{
+    stat->min = UINT64_MAX;
+    stat->max = 0u;
+    stat->sum = 0u;
+    stat->samples = 0u;
+    stat->skip = RTOS_BENCH_WARMUP;
+}
+
+static void stat_add(bench_stat_t * stat, uint64_t cycles)
+{
+    if (0u != stat->skip)
+    {
+        stat->skip--;
+    }
+    else if (stat->samples < RTOS_BENCH_SAMPLES)
+    {
+        stat->min = (cycles < stat->min) ? cycles : stat->min;
+        stat->max = (cycles > stat->max) ? cycles : stat->max;
+        stat->sum += cycles;
+        stat->samples++;
+    }
+}
+
+static uint32_t stat_done(const bench_stat_t * stat)
+{
+    return (RTOS_BENCH_SAMPLES <= stat->samples);
+}
+
+/*------------------------------------------------------------------------------
+  Dirties the floating point context of the calling task in the runs with it.
+ */
+static inline void fp_touch(void)
+{
+#ifdef __riscv_flen
+    if (0u != g_use_fp)
+    {
+        g_fp_acc = g_fp_acc + 1.0;
+    }
+#endif
+}
+
+static uint32_t fp_available(void)
+{
+#ifdef __riscv_flen
+    return (0u != (read_csr(misa) & (1UL << ('F' - 'A'))));
+#else
+    return (0u);
+#endif
+}
+
+/*------------------------------------------------------------------------------
+  Peer tasks, deleted by the benchmark task once the test has its samples.
+ */
+static void yield_peer(void *pvParameters)
+{
+    bench_stat_t * stat = (bench_stat_t *)pvParameters;
+
+    for (;;)
+    {
+        stat_add(stat, read_csr(mcycle) - g_t0);
+        fp_touch();
+        g_t0 = read_csr(mcycle);
+        taskYIELD();
+    }
+}
+
+static void sem_peer(void *pvParameters)
+{
+    bench_stat_t * stat = (bench_stat_t *)pvParameters;
+
+    for (;;)
+    {
+        fp_touch();
+        (void)xSemaphoreTake(g_sem, portMAX_DELAY);
+        stat_add(stat, read_csr(mcycle) - g_t0);
+    }
+}
+
+static void queue_peer(void *pvParameters)
+{
+    bench_stat_t * stat = (bench_stat_t *)pvParameters;
+    uint64_t t0;
+
+    for (;;)
+    {
+        fp_touch();
+        (void)xQueueReceive(g_queue, &t0, portMAX_DELAY);
+        stat_add(stat, read_csr(mcycle) - t0);
+    }
+}
+
+static void isr_peer(void *pvParameters)
+{
+    bench_stat_t * stat = (bench_stat_t *)pvParameters;
+    uint64_t t1;
+
+    for (;;)
+    {
+        fp_touch();
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        t1 = read_csr(mcycle);
+        stat_add(&stat[BENCH_SW_IRQ], g_t_isr - g_t0);
+        stat_add(&stat[BENCH_ISR_TASK], t1 - g_t_isr);
+    }
+}
+
+/*------------------------------------------------------------------------------
+  See inc/rtos_bench.h
+ */
+void rtos_bench_sw_isr(void)
+{
+    BaseType_t woken = pdFALSE;
+    uint64_t t_isr = read_csr(mcycle);
+
+    if (NULL != g_isr_task)
+    {
+        /* Cleared here, the switch to the woken task re-enables interrupts */
+        clear_soft_interrupt();
+        g_t_isr = t_isr;
+        vTaskNotifyGiveFromISR(g_isr_task, &woken);
+        portEND_SWITCHING_ISR(woken);
+    }
+}
+
+/*------------------------------------------------------------------------------
+  Runs all tests, with or without floating point context as g_use_fp says.
+ */
+static void run_tests(bench_stat_t * stat)
+{
+    UBaseType_t prio = uxTaskPriorityGet(NULL);
+    uint64_t hart_id = read_csr(mhartid);
+    TaskHandle_t peer;
+    uint32_t inc;
+
+    for (inc = 0u; inc < BENCH_NUM_TESTS; inc++)
+    {
+        stat_reset(&stat[inc]);
+    }
+
+    /* Both tasks count the switch to themselves */
+    (void)xTaskCreate(yield_peer, "bench_yield", configMINIMAL_STACK_SIZE,
+                      &stat[BENCH_YIELD], prio, &peer);
+    while (!stat_done(&stat[BENCH_YIELD]))
+    {
+        fp_touch();
+        g_t0 = read_csr(mcycle);
+        taskYIELD();
+        stat_add(&stat[BENCH_YIELD], read_csr(mcycle) - g_t0);
+    }
+    vTaskDelete(peer);
+
+    (void)xTaskCreate(sem_peer, "bench_sem", configMINIMAL_STACK_SIZE,
+                      &stat[BENCH_SEM], prio + 1u, &peer);
+    while (!stat_done(&stat[BENCH_SEM]))
+    {
+        fp_touch();
+        g_t0 = read_csr(mcycle);
+        (void)xSemaphoreGive(g_sem);
+    }
+    vTaskDelete(peer);
+
+    (void)xTaskCreate(queue_peer, "bench_queue", configMINIMAL_STACK_SIZE,
+                      &stat[BENCH_QUEUE], prio + 1u, &peer);
+    while (!stat_done(&stat[BENCH_QUEUE]))
+    {
+        uint64_t t0;
+
+        fp_touch();
+        t0 = read_csr(mcycle);
+        (void)xQueueSend(g_queue, &t0, portMAX_DELAY);
+    }
+    vTaskDelete(peer);
+
+    (void)xTaskCreate(isr_peer, "bench_isr", configMINIMAL_STACK_SIZE,
+                      stat, prio + 1u, &peer);
+    g_isr_task = peer;
+    while (!stat_done(&stat[BENCH_ISR_TASK]))
+    {
+        fp_touch();
+        g_t0 = read_csr(mcycle);
+        raise_soft_interrupt(hart_id);
+    }
+    g_isr_task = NULL;
+    vTaskDelete(peer);
+}
+
+static void print_stat(const char * name, const char * fp,
+                       const bench_stat_t * stat)
+{
+    char line[100];
+    bench_record_t record;
+
+    bench_record_init(&record, "rtos", name,
+                      ('y' == fp[0]) ? "fp" : "nofp");
+
+    if (0u == stat->samples)
+    {
+        (void)snprintf(line, sizeof(line), "%-20s %-4s n/a\r\n", name, fp);
+    }
+    else
+    {
+        (void)snprintf(line, sizeof(line), "%-20s %-4s %8lu %8lu %8lu\r\n",
+                       name, fp, (unsigned long)stat->min,
+                       (unsigned long)(stat->sum / stat->samples),
+                       (unsigned long)stat->max);
+
+        record.samples = stat->samples;
+        record.min = stat->min;
+        record.mean = stat->sum / stat->samples;
+        record.max = stat->max;
+        record.lat_unit = "cycles";
+    }
+
+    MSS_UART_polled_tx_string(&g_mss_uart0_lo, (const uint8_t *)line);
+
+    /* Without floating point on the hart the runs with it give no line */
+    if ((0u != stat->samples) || ('n' == fp[0]))
+    {
+        bench_report_result(&g_report, &record);
+    }
+}
+
+/*------------------------------------------------------------------------------
+  See inc/rtos_bench.h
+ */
+void rtos_bench_task(void *pvParameters)
+{
+    char line[100];
+    uint32_t inc;
+
+    (void)pvParameters;
+
+    MSS_UART_init(&g_mss_uart0_lo,
+                  MSS_UART_115200_BAUD,
+                  MSS_UART_DATA_8_BITS | MSS_UART_NO_PARITY | MSS_UART_ONE_STOP_BIT);
+
+    MSS_UART_polled_tx_string(&g_mss_uart0_lo,
+            (const uint8_t *)"\r\nFreeRTOS context switch and IPC benchmark\r\n");
+
+    g_sem = xSemaphoreCreateBinary();
+    g_queue = xQueueCreate(1u, sizeof(uint64_t));
+    configASSERT((NULL != g_sem) && (NULL != g_queue));
+
+    g_use_fp = 0u;
+    run_tests(g_stat[0]);
+
+    if (0u != fp_available())
+    {
+        g_use_fp = 1u;
+        run_tests(g_stat[1]);
+    }
+    else
+    {
+        for (inc = 0u; inc < BENCH_NUM_TESTS; inc++)
+        {
+            g_stat[1][inc].samples = 0u;
+        }
+    }
+
+    (void)snprintf(line, sizeof(line),
+                   "hart %lu, %u samples per test, cycles\r\n",
+                   (unsigned long)read_csr(mhartid),
+                   (unsigned int)RTOS_BENCH_SAMPLES);
+    MSS_UART_polled_tx_string(&g_mss_uart0_lo, (const uint8_t *)line);
+    MSS_UART_polled_tx_string(&g_mss_uart0_lo,
+            (const uint8_t *)"test                 fp        min      avg      max\r\n");
+
+    bench_report_begin(&g_report, &g_mss_uart0_lo, NULL,
+                       "mpfs-uart-mac-freertos_lwip", g_bench_config,
+                       sizeof(g_bench_config) / sizeof(g_bench_config[0]));
+
+    for (inc = 0u; inc < BENCH_NUM_TESTS; inc++)
+    {
+        print_stat(g_test_name[inc], "no", &g_stat[0][inc]);
+        print_stat(g_test_name[inc], "yes", &g_stat[1][inc]);
+    }
+
+    bench_report_end(&g_report);
+
+    for (;;)
+    {
+        vTaskDelay(portMAX_DELAY);
+    }
+}
+
+#endif /* RTOS_BENCH */
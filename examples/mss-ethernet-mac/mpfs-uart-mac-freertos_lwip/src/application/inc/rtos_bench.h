@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * FreeRTOS context switch and IPC benchmark, built instead of the web server
+ * when RTOS_BENCH is defined in the project settings. See README.txt.
+ *
+ */
+
+#ifndef RTOS_BENCH_H_
+#define RTOS_BENCH_H_
+
+#include <stdint.h>
+
+/* Samples per test */
+#ifndef RTOS_BENCH_SAMPLES
+#define RTOS_BENCH_SAMPLES          10000u
+#endif
+
+/* Samples run before each test and not counted, to warm the caches */
+#ifndef RTOS_BENCH_WARMUP
+#define RTOS_BENCH_WARMUP           100u
+#endif
+
+/*
+ * Priority of the benchmark task. The task woken in the semaphore, queue and
+ * interrupt tests runs one above it, so it preempts the sender.
+ */
+#ifndef RTOS_BENCH_PRIORITY
+#define RTOS_BENCH_PRIORITY         ( configMAX_PRIORITIES - 3 )
+#endif
+
+/*------------------------------------------------------------------------------
+  Runs the tests in turn, with and without floating point context, and prints
+  the results on MMUART0. Created in place of the web server tasks, on the hart
+  running the scheduler.
+ */
+void rtos_bench_task(void *pvParameters);
+
+/*------------------------------------------------------------------------------
+  Called first from the software interrupt handler of the hart running the
+  scheduler, wakes the task of the interrupt test.
+ */
+void rtos_bench_sw_isr(void);
+
+#endif /* RTOS_BENCH_H_ */
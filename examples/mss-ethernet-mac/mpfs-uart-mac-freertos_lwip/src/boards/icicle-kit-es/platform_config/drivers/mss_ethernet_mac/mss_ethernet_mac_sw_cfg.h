@@ -201,6 +201,17 @@
 #endif
 #endif
 
+/***************************************************************************//**
+ * The lwIP port queues the frames it sends in the lock-free transmit ring so
+ * that they are started from the transmit interrupt, see mpfs_ethernetif.c.
+ * The ring holds a frame for each transmit buffer of the port.
+ */
+#if !defined(MSS_MAC_SPEED_TEST)
+#define MSS_MAC_TX_BATCH
+#define MSS_MAC_TX_SPSC_RING
+#define MSS_MAC_TX_SPSC_SIZE (16U)
+#endif
+
 /***************************************************************************//**
  * Macros for testing for different PHY models supported in the current build.
  */
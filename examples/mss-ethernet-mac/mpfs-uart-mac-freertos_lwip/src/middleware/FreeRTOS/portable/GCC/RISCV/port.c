@@ -78,6 +78,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "portmacro.h"
+#include "mpfs_hal/mss_hal.h"
 
 
 /* A variable is used to keep track of the critical section nesting.  This
@@ -87,13 +88,34 @@ the scheduler starts.  As it is stored as part of the task context it will
 automatically be set to 0 when the first task is started. */
 UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
 
+/* mstatus.FS of a new task: initial, so its floating point registers are
+only saved once it has used them. */
+#define portINITIAL_FS	( 0x2000UL )
+
 /* Contains context when starting scheduler, save all 31 registers */
 #ifdef __gracefulExit
 BaseType_t xStartContext[31] = {0};
 #endif
  
-extern volatile uint64_t* mtime;
-extern volatile uint64_t* timecmp;
+/* Hart the scheduler runs on, the tick uses its mtimecmp register */
+static volatile UBaseType_t uxSchedulerHart = 0;
+
+/* States of a call to a function on another hart, see xPortHartCall() */
+#define portHART_CALL_IDLE		( 0UL )
+#define portHART_CALL_POSTED	( 1UL )
+#define portHART_CALL_DONE		( 2UL )
+#define portHART_CALL_RETURNED	( 3UL )
+
+typedef struct
+{
+	TaskFunction_t pxFunction;
+	void *pvParameters;
+	TaskHandle_t xCaller;
+	volatile UBaseType_t uxState;
+} HartCall_t;
+
+/* One call at a time to each hart */
+static HartCall_t xHartCall[ portNUM_HARTS ];
 
 /*
  * Handler for timer interrupt
@@ -145,8 +167,7 @@ void vPortExitCritical( void )
 
 static void prvSetNextTimerInterrupt(void)
 {
-    if (mtime && timecmp) 
-        *timecmp = *mtime + (configTICK_CLOCK_HZ / configTICK_RATE_HZ);
+    CLINT->MTIMECMP[uxSchedulerHart] = CLINT->MTIME + (configTICK_CLOCK_HZ / configTICK_RATE_HZ);
 }
 /*-----------------------------------------------------------*/
 
@@ -154,11 +175,13 @@ static void prvSetNextTimerInterrupt(void)
 void vPortSetupTimer(void)
 {
 
+    uxSchedulerHart = read_csr(mhartid);
+
     /* reuse existing routine */
     prvSetNextTimerInterrupt();
     uxCriticalNesting = 0;
-	/* Enable timer interupt */
-	__asm volatile("csrs mie,%0"::"r"(0x80));
+	/* Enable timer interupt, and the software interrupt ending hart calls */
+	__asm volatile("csrs mie,%0"::"r"(0x80 | MIP_MSIP));
 }
 /*-----------------------------------------------------------*/
 
@@ -202,6 +225,11 @@ StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t px
 	/* Simulate the stack frame as it would be created by a context switch
 	interrupt. */
 	register int *tp asm("x3");
+#ifdef __riscv_flen
+	pxTopOfStack -= 33;								/* f0 to f31 and fcsr, not saved */
+	pxTopOfStack--;
+	*pxTopOfStack = (portSTACK_TYPE)portINITIAL_FS;	/* Floating point unused yet */
+#endif
 	pxTopOfStack--;
 	*pxTopOfStack = (portSTACK_TYPE)0;   			/* Normal context switch */
 	pxTopOfStack--;
@@ -229,4 +257,104 @@ void vPortSysTickHandler( void )
 		vTaskSwitchContext();
 	}
 }
+/*-----------------------------------------------------------*/
+
+/*
+ * Runs pxFunction( pvParameters ) on another hart, waiting for vPortHartWorker()
+ * on that hart to pick it up, and blocks the calling task until the function
+ * returns. The call completes with a software interrupt back to the scheduler
+ * hart, whose Software_hN_IRQHandler() must call vPortHartCallISR(). The
+ * notification of the calling task is used to wait.
+ */
+BaseType_t xPortHartCall( UBaseType_t uxHart, TaskFunction_t pxFunction, void *pvParameters )
+{
+BaseType_t xReturn = pdFAIL;
+HartCall_t *pxCall;
+
+	if( ( uxHart < portNUM_HARTS ) && ( uxHart != uxSchedulerHart ) )
+	{
+		pxCall = &xHartCall[ uxHart ];
+
+		portENTER_CRITICAL();
+		if( portHART_CALL_IDLE == pxCall->uxState )
+		{
+			pxCall->pxFunction = pxFunction;
+			pxCall->pvParameters = pvParameters;
+			pxCall->xCaller = xTaskGetCurrentTaskHandle();
+			mb();
+			pxCall->uxState = portHART_CALL_POSTED;
+			xReturn = pdPASS;
+		}
+		portEXIT_CRITICAL();
+
+		if( pdPASS == xReturn )
+		{
+			raise_soft_interrupt( uxHart );
+
+			while( portHART_CALL_RETURNED != pxCall->uxState )
+			{
+				( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+			}
+
+			pxCall->uxState = portHART_CALL_IDLE;
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Called from the software interrupt handler of the scheduler hart. Wakes the
+ * tasks whose calls to functions on other harts have returned.
+ */
+void vPortHartCallISR( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+UBaseType_t uxHart;
+
+	clear_soft_interrupt();
+
+	for( uxHart = 0; uxHart < portNUM_HARTS; uxHart++ )
+	{
+		if( portHART_CALL_DONE == xHartCall[ uxHart ].uxState )
+		{
+			xHartCall[ uxHart ].uxState = portHART_CALL_RETURNED;
+			vTaskNotifyGiveFromISR( xHartCall[ uxHart ].xCaller, &xHigherPriorityTaskWoken );
+		}
+	}
+
+	portEND_SWITCHING_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Runs the functions passed to xPortHartCall() for the calling hart, waiting
+ * in wfi between calls. Called from u54_N() of a hart not running the
+ * scheduler, it does not return.
+ */
+void vPortHartWorker( void )
+{
+HartCall_t *pxCall = &xHartCall[ read_csr(mhartid) ];
 
+	set_csr( mie, MIP_MSIP );
+
+	for( ;; )
+	{
+		/* Cleared before looking, so a call posted after is not missed */
+		clear_soft_interrupt();
+		mb();
+
+		if( portHART_CALL_POSTED == pxCall->uxState )
+		{
+			pxCall->pxFunction( pxCall->pvParameters );
+			mb();
+			pxCall->uxState = portHART_CALL_DONE;
+			raise_soft_interrupt( uxSchedulerHart );
+		}
+		else
+		{
+			__asm volatile( "wfi" );
+		}
+	}
+}
@@ -126,6 +126,7 @@ typedef unsigned long UBaseType_t;
 	#define portBYTE_ALIGNMENT	4
 #endif
 #define portCRITICAL_NESTING_IN_TCB					1
+#define portNUM_HARTS				5
 /*-----------------------------------------------------------*/
 
 
@@ -136,6 +137,12 @@ extern void vPortYield( void );
 #define portYIELD()					vPortYield()
 /*-----------------------------------------------------------*/
 
+/* Calls from tasks to functions run on the other harts, see port.c. */
+extern BaseType_t xPortHartCall( UBaseType_t uxHart, TaskFunction_t pxFunction, void *pvParameters );
+extern void vPortHartCallISR( void );
+extern void vPortHartWorker( void );
+/*-----------------------------------------------------------*/
+
 
 /* Critical section management. */
 extern int vPortSetInterruptMask( void );
@@ -19,6 +19,7 @@
 #include "mpfs_hal/mss_hal.h"
 
 #include <assert.h>
+#include <string.h>
 
 #include "drivers/mss_ethernet_mac/mss_ethernet_registers.h"
 #include "drivers/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
@@ -47,16 +48,17 @@ void handle_trigger_request(char * buf, u16_t len);
 /*------------------------------------------------------------------------------
  *
  */
-extern const char mscc_png_logo[4727];
+extern const unsigned char mscc_png_logo[];
+extern const unsigned int mscc_png_logo_size;
 
 /*------------------------------------------------------------------------------
  *
  */
-static const char http_html_hdr[] = "HTTP/1.1 200 OK\r\nContent-type: text/html\r\n\r\n";
-static const char http_json_hdr[] = "HTTP/1.1 200 OK\r\nContent-type: application/jsonrequest\r\n\r\n";
+static const char http_json_hdr[] = "HTTP/1.1 200 OK\r\nContent-type: application/jsonrequest\r\nContent-Length: %lu\r\n\r\n";
 
 static const char http_post_resp_hdr[] = "HTTP/1.1 204 No Content\r\n\r\n";
-static const char http_html_ok_hdr[] = "HTTP/1.1 200 OK\r\n\r\n";
+static const char http_html_ok_hdr[] = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n";
+static const char http_not_acceptable_hdr[] = "HTTP/1.1 406 Not Acceptable\r\nContent-Length: 0\r\n\r\n";
 
 /*------------------------------------------------------------------------------
  *
@@ -336,10 +338,35 @@ window.onload = function() {\r\
 </script>\r\
 </body></html>";
 
+/*------------------------------------------------------------------------------
+ * Keep-alive connections: each worker thread serves the requests of one
+ * connection in turn until the client closes it, sends no request for
+ * HTTPD_KEEPALIVE_TIMEOUT_MS or has sent HTTPD_KEEPALIVE_MAX_REQUESTS. There
+ * are HTTPD_SERVE_THREADS workers, so a connection left open by a browser does
+ * not hold up the others for long.
+ */
+#ifndef HTTPD_SERVE_THREADS
+#define HTTPD_SERVE_THREADS             2
+#endif
+
+#ifndef HTTPD_KEEPALIVE_TIMEOUT_MS
+#define HTTPD_KEEPALIVE_TIMEOUT_MS      500
+#endif
+
+#ifndef HTTPD_KEEPALIVE_MAX_REQUESTS
+#define HTTPD_KEEPALIVE_MAX_REQUESTS    32u
+#endif
+
+#define STATUS_JSON_SIZE                400u
+
 /*------------------------------------------------------------------------------
  *
  */
-static char status_json[400];
+static http_static_file_t g_index_html_file;
+static http_static_file_t g_logo_file;
+
+/* Files served, added before the workers start and not changed after */
+static http_static_file_t * g_http_static_files = NULL;
 
 /*------------------------------------------------------------------------------
  *
@@ -347,8 +374,147 @@ static char status_json[400];
 
 extern mss_mac_speed_t g_net_speed;
 
+/*------------------------------------------------------------------------------
+ * See httpserver-netconn.h
+ */
+err_t
+http_server_add_static_file
+(
+    http_static_file_t * file,
+    const char * path,
+    const char * content_type,
+    const void * data,
+    u32_t length,
+    u8_t flags
+)
+{
+    http_static_file_t ** p_link = &g_http_static_files;
+    int header_len = 0;
+
+    if (0u == (flags & HTTP_STATIC_PREBUILT))
+    {
+        header_len = snprintf(file->header, sizeof(file->header),
+                              "HTTP/1.1 200 OK\r\nContent-Type: %s\r\n"
+                              "Content-Length: %lu\r\n%s\r\n",
+                              content_type, (unsigned long)length,
+                              (0u != (flags & HTTP_STATIC_GZIP)) ?
+                              "Content-Encoding: gzip\r\n" : "");
+
+        if ((header_len < 0) || (header_len >= (int)sizeof(file->header)))
+        {
+            return ERR_VAL;
+        }
+    }
+
+    file->path = path;
+    file->data = data;
+    file->length = length;
+    file->header_len = (u16_t)header_len;
+    file->flags = flags;
+    file->next = NULL;
 
-/** Serve one HTTP connection accepted in the http thread */
+    /* Appended, so files added by the application come before the defaults */
+    while (*p_link != NULL)
+    {
+        p_link = &(*p_link)->next;
+    }
+    *p_link = file;
+
+    return ERR_OK;
+}
+
+/*------------------------------------------------------------------------------
+ * Finds the file of the path of a request, which ends at a space or '?'.
+ */
+static const http_static_file_t *
+http_static_find
+(
+    const char * path,
+    u16_t len
+)
+{
+    const http_static_file_t * file = g_http_static_files;
+    u16_t path_len = 0u;
+
+    while ((path_len < len) && (path[path_len] != ' ') && (path[path_len] != '?'))
+    {
+        ++path_len;
+    }
+
+    while ((file != NULL) &&
+           ((strlen(file->path) != path_len) ||
+            (0 != strncmp(file->path, path, path_len))))
+    {
+        file = file->next;
+    }
+
+    return file;
+}
+
+/*------------------------------------------------------------------------------
+ * Sends a static file. Neither the header nor the data is copied: lwIP holds
+ * references to them until they are acknowledged.
+ */
+static err_t
+http_static_send
+(
+    struct netconn *conn,
+    const http_static_file_t * file,
+    const char * buf,
+    u16_t buflen
+)
+{
+    err_t err = ERR_OK;
+
+    if ((0u != (file->flags & HTTP_STATIC_GZIP)) &&
+        (NULL == lwip_strnstr(buf, "gzip", buflen)))
+    {
+        err = netconn_write(conn, http_not_acceptable_hdr,
+                            sizeof(http_not_acceptable_hdr)-1, NETCONN_NOCOPY);
+    }
+    else
+    {
+        if (0u == (file->flags & HTTP_STATIC_PREBUILT))
+        {
+            err = netconn_write(conn, file->header, file->header_len,
+                                NETCONN_NOCOPY);
+        }
+
+        if (ERR_OK == err)
+        {
+            err = netconn_write(conn, file->data, file->length, NETCONN_NOCOPY);
+        }
+    }
+
+    return err;
+}
+
+/*------------------------------------------------------------------------------
+ * HTTP/1.1 connections are kept alive unless the client asks for them to be
+ * closed, HTTP/1.0 ones only if it asks for them to be kept.
+ */
+static u8_t
+http_keep_alive
+(
+    const char * buf,
+    u16_t buflen
+)
+{
+    u8_t keep_alive;
+
+    if (NULL != lwip_strnstr(buf, "HTTP/1.1", buflen))
+    {
+        keep_alive = (NULL == lwip_strnstr(buf, "Connection: close", buflen));
+    }
+    else
+    {
+        keep_alive = (NULL != lwip_strnstr(buf, "Connection: keep-alive", buflen));
+    }
+
+    return keep_alive;
+}
+
+/** Serve one HTTP connection accepted by a worker thread */
 #if defined(_ZL303XX_MIV)
 static void
 http_server_netconn_serve
@@ -368,7 +534,11 @@ http_server_netconn_serve
     struct netbuf *inbuf;
     char *buf;
     u16_t buflen;
-    err_t err;
+    u32_t requests = 0u;
+    u8_t keep_alive = 1u;
+    const http_static_file_t * file;
+    char status_json[STATUS_JSON_SIZE];
+    char json_hdr[sizeof(http_json_hdr) + 16u];
 
 #ifndef USB_DEVICE_RNDIS
     const char * mac_speed_lut[] =
@@ -380,14 +550,18 @@ http_server_netconn_serve
     };
 #endif
 
+    netconn_set_recvtimeout(conn, HTTPD_KEEPALIVE_TIMEOUT_MS);
+
     /* Read the data from the port, blocking if nothing yet there. 
     We assume the request (the part we care about) is in one netbuf */
-    err = netconn_recv(conn, &inbuf);
-
-    if(err == ERR_OK)
+    while ((0u != keep_alive) && (ERR_OK == netconn_recv(conn, &inbuf)))
     {
         netbuf_data(inbuf, (void**)&buf, &buflen);
-    
+
+        ++requests;
+        keep_alive = (u8_t)((0u != http_keep_alive(buf, buflen)) &&
+                            (requests < HTTPD_KEEPALIVE_MAX_REQUESTS));
+
         /* Is this an HTTP GET command? (only check the first 5 chars, since
         there are other formats for GET, and we're keeping it very simple )*/
         if(buflen >= 5 &&
@@ -397,10 +571,16 @@ http_server_netconn_serve
            buf[3] == ' ' &&
            buf[4] == '/' )
         {
-        
-            if(buf[5]=='s')
+            file = http_static_find(&buf[4], buflen - 4);
+
+            if(file != NULL)
+            {
+                (void)http_static_send(conn, file, buf, buflen);
+            }
+            else if(buf[5]=='s')
             {
                 uint32_t json_resp_size;
+                uint32_t json_hdr_size;
                 uint32_t ip_addr;
                 uint8_t mac_addr[6];
 #ifndef USB_DEVICE_RNDIS
@@ -464,18 +644,17 @@ http_server_netconn_serve
                     json_resp_size = sizeof(status_json);
                 }
 
-                /* Send the HTML header 
-                * subtract 1 from the size, since we dont send the \0 in the string
-                * NETCONN_NOCOPY: our data is const static, so no need to copy it
-                */
-                netconn_write(conn, http_json_hdr, sizeof(http_json_hdr)-1, NETCONN_NOCOPY);
+                /* The length lets the client find the end of the response
+                 * on a connection kept alive.
+                 */
+                json_hdr_size = snprintf(json_hdr, sizeof(json_hdr), http_json_hdr,
+                                         (unsigned long)(json_resp_size - 1));
+
+                /* The status is built on the stack, so it is copied */
+                netconn_write(conn, json_hdr, json_hdr_size, NETCONN_COPY);
 
                 /* Send our HTML page */
-                netconn_write(conn, status_json, json_resp_size-1, NETCONN_NOCOPY);
-            }
-            else if(buf[5]=='i')
-            {
-                netconn_write(conn, mscc_png_logo, sizeof(mscc_png_logo)-1, NETCONN_NOCOPY);
+                netconn_write(conn, status_json, json_resp_size-1, NETCONN_COPY);
             }
             else if(buf[5]=='t')
             {
@@ -484,14 +663,8 @@ http_server_netconn_serve
             }
             else 
             {
-                /* Send the HTML header 
-                     * subtract 1 from the size, since we dont send the \0 in the string
-                     * NETCONN_NOCOPY: our data is const static, so no need to copy it
-                */
-                netconn_write(conn, http_html_hdr, sizeof(http_html_hdr)-1, NETCONN_NOCOPY);
-              
-                /* Send our HTML page */
-                netconn_write(conn, http_index_html, sizeof(http_index_html)-1, NETCONN_NOCOPY);
+                /* Any other page is the index page */
+                (void)http_static_send(conn, &g_index_html_file, buf, buflen);
             }
         }
         else if (buflen>=6 &&
@@ -502,24 +675,71 @@ http_server_netconn_serve
                  buf[4]==' ' &&
                  buf[5]=='/' )
         {
-        
-        err = netconn_recv(conn, &inbuf);
-        
-        ++err;
-        
-        /* Send the HTML header 
-             * subtract 1 from the size, since we dont send the \0 in the string
-             * NETCONN_NOCOPY: our data is const static, so no need to copy it
-        */
-        netconn_write(conn, http_post_resp_hdr, sizeof(http_post_resp_hdr)-1, NETCONN_NOCOPY);
-    }
+            /* The body of the POST follows the request */
+            netbuf_delete(inbuf);
+            inbuf = NULL;
+            if (ERR_OK != netconn_recv(conn, &inbuf))
+            {
+                inbuf = NULL;
+                keep_alive = 0u;
+            }
+
+            /* Send the HTML header 
+                 * subtract 1 from the size, since we dont send the \0 in the string
+                 * NETCONN_NOCOPY: our data is const static, so no need to copy it
+            */
+            netconn_write(conn, http_post_resp_hdr, sizeof(http_post_resp_hdr)-1, NETCONN_NOCOPY);
+        }
+        else
+        {
+            keep_alive = 0u;
+        }
+
+        /* Delete the buffer (netconn_recv gives us ownership,
+          so we have to make sure to deallocate the buffer) */
+        netbuf_delete(inbuf);
     }
-    /* Close the connection (server closes in HTTP) */
+
+    /* Close the connection */
     netconn_close(conn);
-  
-    /* Delete the buffer (netconn_recv gives us ownership,
-      so we have to make sure to deallocate the buffer) */
-    netbuf_delete(inbuf);
+}
+
+/** A worker thread, serving the connections accepted on the listening
+ * connection given as arg. Never returns unless accept fails. */
+static void
+http_server_netconn_worker(void *arg)
+{
+    struct netconn *conn = (struct netconn *)arg;
+    struct netconn *newconn;
+    err_t err;
+#if defined(_ZL303XX_MIV)
+    	uint32_t counter = 0;
+#endif
+
+    do {
+#if defined(_ZL303XX_MIV)
+        err = netconn_accept(conn, &newconn);
+        if (err == ERR_OK)
+        {
+            http_server_netconn_serve(newconn, counter);
+            netconn_delete(newconn);
+        }
+        counter++;
+#else
+        mss_rtc_calendar_t calendar_count;
+
+        err = netconn_accept(conn, &newconn);
+        if (err == ERR_OK)
+        {
+            MSS_RTC_get_calendar_count(&calendar_count);
+            http_server_netconn_serve(newconn, &calendar_count);
+            netconn_delete(newconn);
+        }
+#endif
+    } while(err == ERR_OK);
+    LWIP_DEBUGF(HTTPD_DEBUG,
+                ("http_server_netconn_worker: netconn_accept received error %d, shutting down",
+                err));
 }
 
 /** The main function, never returns! */
@@ -528,11 +748,8 @@ http_server_netconn_thread(void *arg);
 void
 http_server_netconn_thread(void *arg)
 {
-    struct netconn *conn, *newconn;
-    err_t err;
-#if defined(_ZL303XX_MIV)
-    	uint32_t counter = 0;
-#endif
+    struct netconn *conn;
+    int worker;
     (void)arg;
 
 #if !defined(_ZL303XX_MIV)
@@ -560,37 +777,16 @@ http_server_netconn_thread(void *arg)
 #endif
     /* Put the connection into LISTEN state */
     netconn_listen(conn);
-  
-    do {
-#if defined(_ZL303XX_MIV)
-        err = netconn_accept(conn, &newconn);
-        if (err == ERR_OK)
-        {
-            http_server_netconn_serve(newconn, counter);
-            netconn_delete(newconn);
-        }
-        counter++;
-#else
-        mss_rtc_calendar_t calendar_count;
-        uint32_t rtc_count_updated;
-        
-        rtc_count_updated = MSS_RTC_get_update_flag();
-        if(rtc_count_updated)
-        {
-            MSS_RTC_get_calendar_count(&calendar_count);
-            MSS_RTC_clear_update_flag();
-        }
-        err = netconn_accept(conn, &newconn);
-        if (err == ERR_OK)
-        {
-            http_server_netconn_serve(newconn, &calendar_count);
-            netconn_delete(newconn);
-        }
-#endif
-    } while(err == ERR_OK);
-    LWIP_DEBUGF(HTTPD_DEBUG,
-                ("http_server_netconn_thread: netconn_accept received error %d, shutting down",
-                err));
+
+    /* The other workers accept on the same connection as this thread */
+    for (worker = 1; worker < HTTPD_SERVE_THREADS; worker++)
+    {
+        sys_thread_new("http_server_worker", http_server_netconn_worker, conn,
+                       DEFAULT_THREAD_STACKSIZE, DEFAULT_THREAD_PRIO);
+    }
+
+    http_server_netconn_worker(conn);
+
     netconn_close(conn);
     netconn_delete(conn);
 }
@@ -599,6 +795,10 @@ http_server_netconn_thread(void *arg)
 void
 http_server_netconn_init(void)
 {
+  (void)http_server_add_static_file(&g_index_html_file, "/", "text/html",
+                                    http_index_html, sizeof(http_index_html)-1, 0u);
+  (void)http_server_add_static_file(&g_logo_file, "/index_r1_c1.png", "image/png",
+                                    mscc_png_logo, mscc_png_logo_size, 0u);
   sys_thread_new("http_server_netconn", http_server_netconn_thread, NULL, DEFAULT_THREAD_STACKSIZE, DEFAULT_THREAD_PRIO);
 }
 
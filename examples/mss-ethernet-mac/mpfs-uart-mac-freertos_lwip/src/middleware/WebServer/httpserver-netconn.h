@@ -1,6 +1,47 @@
 #ifndef __HTTPSERVER_NETCONN_H__
 #define __HTTPSERVER_NETCONN_H__
 
+#include "lwip/opt.h"
+#include "lwip/err.h"
+
+/*
+ * Static files are sent with NETCONN_NOCOPY straight from where they are
+ * stored, e.g. const data in DDR or memory-mapped QSPI flash, so a response
+ * costs no copy and no allocation beyond the pbufs referencing it. The header
+ * of each file, with its Content-Length, is built once when it is added.
+ */
+#ifndef HTTPD_STATIC_HEADER_SIZE
+#define HTTPD_STATIC_HEADER_SIZE        160
+#endif
+
+/* The data of the file is gzip compressed, sent with Content-Encoding: gzip */
+#define HTTP_STATIC_GZIP                0x01u
+/* The data is the whole response, headers included, sent as it is */
+#define HTTP_STATIC_PREBUILT            0x02u
+
+typedef struct http_static_file
+{
+    struct http_static_file * next;
+    const char * path;
+    const void * data;
+    u32_t length;
+    u16_t header_len;
+    u8_t flags;
+    char header[HTTPD_STATIC_HEADER_SIZE];
+} http_static_file_t;
+
+/*
+ * Adds a file served for GET requests of path, e.g. "/index_r1_c1.png". file
+ * is kept by the server and data, of length bytes, must stay in place and
+ * unchanged. content_type is not used for a HTTP_STATIC_PREBUILT response,
+ * which must give its own Content-Length for keep-alive connections. Files
+ * are added before http_server_netconn_init(). Returns ERR_VAL if the header
+ * does not fit in HTTPD_STATIC_HEADER_SIZE bytes.
+ */
+err_t http_server_add_static_file(http_static_file_t * file, const char * path,
+                                  const char * content_type, const void * data,
+                                  u32_t length, u8_t flags);
+
 void http_server_netconn_init(void);
 
 #endif /* __HTTPSERVER_NETCONN_H__ */
@@ -436,3 +436,5 @@ const unsigned char mscc_png_logo[1740] =
         0x49, 0x45, 0x4e, 0x44,
         0xae, 0x42, 0x60, 0x82,
     };
+
+const unsigned int mscc_png_logo_size = sizeof(mscc_png_logo);
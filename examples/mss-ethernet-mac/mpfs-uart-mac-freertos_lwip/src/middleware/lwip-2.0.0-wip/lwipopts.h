@@ -39,6 +39,79 @@
 #define __USER_LWIP_OPT_H__
 
 #define LWIP_TIMEVAL_PRIVATE 0
+
+/*
+   -----------------------------------------------
+   ---------- PolarFire SoC port options ----------
+   -----------------------------------------------
+*/
+
+/**
+ * LWIP_MPFS_HIGH_THROUGHPUT: define to size lwIP for bulk TCP at gigabit
+ * rates, in place of the defaults below. The send side is sized for a window
+ * of about 32 segments, which the MAC transmit ring sends back to back. The
+ * receive window is kept to 12 segments: with LWIP_SUPPORT_CUSTOM_PBUF each
+ * segment not yet read by the application holds a MAC receive buffer, so
+ * TCP_WND must fit in the MSS_MAC_RX_RING_SIZE buffers of the MAC, which
+ * mpfs_ethernetif.c checks, or in the pbufs of LWIP_MPFS_PBUF_CACHE. 12 segments cover the bandwidth delay product of
+ * a gigabit LAN with a round trip below 140us. Raise MSS_MAC_RX_RING_SIZE and
+ * TCP_WND together for longer paths.
+ */
+/* #define LWIP_MPFS_HIGH_THROUGHPUT */
+
+#ifdef LWIP_MPFS_HIGH_THROUGHPUT
+#define TCP_MSS                         1460
+#define TCP_WND                         (12 * TCP_MSS)
+#define TCP_SND_BUF                     (32 * TCP_MSS)
+#define TCP_SND_QUEUELEN                ((4 * (TCP_SND_BUF) + (TCP_MSS - 1))/(TCP_MSS))
+#define MEMP_NUM_TCP_SEG                (TCP_SND_QUEUELEN + 16)
+#define MEMP_NUM_PBUF                   64
+#define PBUF_POOL_SIZE                  32
+#endif
+
+/**
+ * Memory placement: define any of the following to the name of a linker
+ * section to place that memory there instead of .bss, declared in arch/cc.h.
+ *
+ * LWIP_PBUF_POOL_SECTION: the pbuf pool, and the pool of the per-hart pbuf
+ * caches.
+ * LWIP_TCP_MEM_SECTION: the TCP PCBs, listening PCBs and segments, touched by
+ * every TCP packet sent or received.
+ * LWIP_HEAP_SECTION: the pools of lwippools.h, which are the lwIP heap since
+ * MEM_USE_POOLS is 1, so MEM_SIZE is not used.
+ *
+ * ".l2_scratchpad", of the example linker scripts, keeps the memory out of
+ * the way of the L2 cache ways. Its contents are loaded from the image, so
+ * the image grows by the size of what is placed there. A section in cached
+ * DDR needs no cache maintenance: the GEM reaches cached DDR through the L2,
+ * which keeps its accesses coherent with the harts. Sections other than
+ * .l2_scratchpad, e.g. one in DDR, must be added to the linker script.
+ */
+/* #define LWIP_PBUF_POOL_SECTION          ".l2_scratchpad" */
+/* #define LWIP_TCP_MEM_SECTION            ".l2_scratchpad" */
+/* #define LWIP_HEAP_SECTION               ".ddr_lwip_heap" */
+
+/**
+ * LWIP_MPFS_PBUF_CACHE==1: copy received frames into pbufs from per-hart
+ * pbuf caches, see arch/pbuf_cache.h, rather than passing up the MAC receive
+ * buffers. The harts allocating and freeing pbufs each use their own free
+ * list, and only share a lock when one runs empty or full. The MAC receive
+ * buffers are handed back at once, so TCP_WND is then bounded by the
+ * LWIP_MPFS_PBUF_CACHE_COUNT pbufs, of PBUF_POOL_BUFSIZE bytes, rather than by
+ * MSS_MAC_RX_RING_SIZE. LWIP_MPFS_PBUF_CACHE_DEPTH is the most pbufs kept by
+ * each hart. Needs LWIP_SUPPORT_CUSTOM_PBUF.
+ */
+#ifndef LWIP_MPFS_PBUF_CACHE
+#define LWIP_MPFS_PBUF_CACHE            0
+#endif
+
+#ifndef LWIP_MPFS_PBUF_CACHE_COUNT
+#define LWIP_MPFS_PBUF_CACHE_COUNT      PBUF_POOL_SIZE
+#endif
+
+#ifndef LWIP_MPFS_PBUF_CACHE_DEPTH
+#define LWIP_MPFS_PBUF_CACHE_DEPTH      8u
+#endif
 /*
    -----------------------------------------------
    ---------- Platform specific locking ----------
@@ -135,6 +208,8 @@
 /**
  * MEM_SIZE: the size of the heap memory. If the application will send
  * a lot of data that needs to be copied, this should be set high.
+ * Not used while MEM_USE_POOLS is 1, the heap then being the pools of
+ * lwippools.h.
  */
 #ifndef MEM_SIZE
 #ifdef RUN_IN_DDR
@@ -1177,6 +1252,17 @@
 #define PBUF_POOL_BUFSIZE               LWIP_MEM_ALIGN_SIZE(TCP_MSS+40+PBUF_LINK_ENCAPSULATION_HLEN+PBUF_LINK_HLEN)
 #endif
 
+/**
+ * LWIP_SUPPORT_CUSTOM_PBUF==1: Received frames are passed up in custom pbufs
+ * referencing the MAC receive buffers, without a copy, see mpfs_ethernetif.c.
+ * Each receive buffer is held until the pbuf is freed, so frames queued by
+ * lwIP, e.g. out of sequence TCP segments, reduce the receive buffers left to
+ * the MAC. Set to 0 to copy received frames into the pbuf pool instead.
+ */
+#ifndef LWIP_SUPPORT_CUSTOM_PBUF
+#define LWIP_SUPPORT_CUSTOM_PBUF        1
+#endif
+
 /*
    ------------------------------------------------
    ---------- Network Interfaces options ----------
@@ -1829,6 +1915,25 @@
    --------------------------------------
 */
 
+/**
+ * MPFS_ETHERNETIF_CSUM_OFFLOAD==1: Let the GEM generate and check the IP, TCP
+ * and UDP checksums. The matching software checksum options below are turned
+ * off and mpfs_ethernetif.c enables the offloads in the MAC configuration.
+ * ICMP checksums are not handled by the GEM and remain in software.
+ */
+#ifndef MPFS_ETHERNETIF_CSUM_OFFLOAD
+#define MPFS_ETHERNETIF_CSUM_OFFLOAD    1
+#endif
+
+#if MPFS_ETHERNETIF_CSUM_OFFLOAD
+#define CHECKSUM_GEN_IP                 0
+#define CHECKSUM_GEN_UDP                0
+#define CHECKSUM_GEN_TCP                0
+#define CHECKSUM_CHECK_IP               0
+#define CHECKSUM_CHECK_UDP              0
+#define CHECKSUM_CHECK_TCP              0
+#endif
+
 /**
  * LWIP_CHECKSUM_CTRL_PER_NETIF==1: Checksum generation/check can be enabled/disabled
  * per netif.
@@ -70,6 +70,7 @@
 #include "lwip/ethip6.h"
 #include "lwip/etharp.h"
 #include "netif/ppp/pppoe.h"
+#include "arch/pbuf_cache.h"
 
 const uint8_t * sys_cfg_get_mac_address(void);
 
@@ -80,7 +81,58 @@ const uint8_t * sys_cfg_get_mac_address(void);
 #define BUFFER_EMPTY    0u
 #define RELEASE_BUFFER  BUFFER_EMPTY
 #define RX_BUFFER_COUNT MSS_MAC_RX_RING_SIZE
+
+/*
+ * With the MAC driver's lock-free transmit ring, frames are queued in the ring
+ * while the GEM sends the one ahead of them and are started from the transmit
+ * interrupt. There is then one transmit buffer for each frame the MAC transmit
+ * descriptor ring can hold, so lwIP only waits for a transmit complete when
+ * all of them are in use.
+ */
+#if defined(MSS_MAC_TX_SPSC_RING) && !defined(MSS_MAC_USE_DDR)
+#define TX_USE_RING
+#ifndef TX_BUFFER_COUNT
+#define TX_BUFFER_COUNT (MSS_MAC_TX_RING_SIZE - 1U)
+#endif
+#if TX_BUFFER_COUNT > MSS_MAC_TX_SPSC_SIZE
+#error "TX_BUFFER_COUNT must not be larger than MSS_MAC_TX_SPSC_SIZE"
+#endif
+#else
 #define TX_BUFFER_COUNT 1
+#endif
+
+/*
+ * With custom pbufs, received frames are passed to lwIP in pbufs referencing
+ * the MAC receive buffers rather than copied into the pbuf pool. A receive
+ * buffer is only handed back to the MAC when lwIP frees its pbuf. With the
+ * per-hart pbuf caches, frames are copied into pbufs from the caches instead.
+ */
+#if LWIP_SUPPORT_CUSTOM_PBUF && (ETH_PAD_SIZE == 0) && !LWIP_MPFS_PBUF_CACHE
+#define RX_USE_CUSTOM_PBUF
+#endif
+
+/*
+ * Received data not yet read by the application holds receive buffers, so the
+ * TCP window must leave the MAC a couple of them to receive into.
+ */
+#if defined(RX_USE_CUSTOM_PBUF) && (TCP_WND > ((RX_BUFFER_COUNT - 2) * TCP_MSS))
+#warning "TCP_WND is larger than the MAC receive buffers can hold"
+#endif
+
+/*
+ * Received frames are passed to lwIP by the receive task, woken by the MAC
+ * interrupt. It runs below the tcpip thread so the frames it posts are
+ * handled as they arrive rather than filling the tcpip mailbox.
+ */
+#ifndef ETHERNETIF_RX_TASK_PRIO
+#define ETHERNETIF_RX_TASK_PRIO         (TCPIP_THREAD_PRIO - 1)
+#endif
+#ifndef ETHERNETIF_RX_TASK_STACKSIZE
+#define ETHERNETIF_RX_TASK_STACKSIZE    4000
+#endif
+
+/* One more entry than the receive buffers, so a full queue is not empty */
+#define RX_QUEUE_SIZE   (RX_BUFFER_COUNT + 1u)
 
 uint32_t get_user_eth_speed_choice(void);
 
@@ -91,6 +143,26 @@ static uint8_t g_mac_rx_buffer[RX_BUFFER_COUNT][MSS_MAC_MAX_RX_BUF_SIZE] __attri
 static volatile uint8_t g_mac_tx_buffer_used[TX_BUFFER_COUNT];
 static volatile uint8_t g_mac_rx_buffer_data_valid[RX_BUFFER_COUNT];
 
+/* Received frames waiting for the receive task, see mac_rx_callback() */
+typedef struct
+{
+    uint8_t * p_rx_packet;
+    uint32_t pckt_length;
+} rx_frame_t;
+
+static rx_frame_t g_mac_rx_queue[RX_QUEUE_SIZE];
+static volatile uint32_t g_mac_rx_queue_head = 0u; /* Written by the MAC ISR */
+static volatile uint32_t g_mac_rx_queue_tail = 0u; /* Written by the receive task */
+static TaskHandle_t g_mac_rx_task = NULL;
+
+#if defined(RX_USE_CUSTOM_PBUF)
+/* One custom pbuf for each receive buffer */
+static struct pbuf_custom g_mac_rx_pbuf[RX_BUFFER_COUNT];
+#endif
+
+/* Set while low_level_output() pushes a frame, see packet_tx_complete_handler() */
+static volatile uint8_t g_mac_tx_in_output = 0u;
+
 struct netif * g_p_mac_netif = 0;
 
 static uint8_t r_mac_addr[60] = {0};
@@ -119,10 +191,13 @@ static void ethernetif_input
     uint32_t pckt_length
 );
 
+static void ethernetif_rx_task(void * pvParameters);
+
 static void packet_tx_complete_handler(/* mss_mac_instance_t*/ void *this_mac, uint32_t queue_no, mss_mac_tx_desc_t *cdesc, void * caller_info);
 
 static void low_level_init(struct netif *netif);
 static err_t low_level_output(struct netif *netif, struct pbuf *p);
+static uint32_t get_free_tx_buffer(void);
 
 static struct pbuf * low_level_input
 (
@@ -131,6 +206,10 @@ static struct pbuf * low_level_input
     uint32_t pckt_length
 );
 
+#if defined(RX_USE_CUSTOM_PBUF)
+static void rx_pbuf_free(struct pbuf *p);
+#endif
+
 
 /**=============================================================================
  * Should be called at the beginning of the program to set up the
@@ -211,6 +290,10 @@ low_level_init(struct netif *netif)
     /* maximum transfer unit */
     netif->mtu = 1500;
 
+#if LWIP_MPFS_PBUF_CACHE && !defined(RX_USE_CUSTOM_PBUF)
+    mpfs_pbuf_cache_init();
+#endif
+
     /* device capabilities */
     /* don't set NETIF_FLAG_ETHARP if this device is not an ethernet one */
     netif->flags |= NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_LINK_UP;
@@ -234,8 +317,19 @@ low_level_init(struct netif *netif)
     g_p_mac_netif = netif;
     
     /*--------------------- Initialize packet containers ---------------------*/
-    g_mac_tx_buffer_used[0] = RELEASE_BUFFER;
+    for(count = 0; count < TX_BUFFER_COUNT; ++count)
+    {
+        g_mac_tx_buffer_used[count] = RELEASE_BUFFER;
+    }
     g_mac_rx_buffer_data_valid[0] = RELEASE_BUFFER;
+    g_mac_rx_queue_head = 0u;
+    g_mac_rx_queue_tail = 0u;
+#if defined(RX_USE_CUSTOM_PBUF)
+    for(count = 0; count < RX_BUFFER_COUNT; ++count)
+    {
+        g_mac_rx_pbuf[count].custom_free_function = rx_pbuf_free;
+    }
+#endif
     
     /*-------------------------- Initialize the MAC --------------------------*/
     /*
@@ -272,6 +366,17 @@ low_level_init(struct netif *netif)
     g_mac_config.mac_addr[4] = netif->hwaddr[4];
     g_mac_config.mac_addr[5] = netif->hwaddr[5];
 
+    /*
+     * Hand checksum work to the GEM when lwIP has been configured not to do
+     * it in software.
+     */
+#if (CHECKSUM_GEN_IP == 0) && (CHECKSUM_GEN_UDP == 0) && (CHECKSUM_GEN_TCP == 0)
+    g_mac_config.tx_csum_offload = MSS_MAC_ENABLE;
+#endif
+#if (CHECKSUM_CHECK_IP == 0) && (CHECKSUM_CHECK_UDP == 0) && (CHECKSUM_CHECK_TCP == 0)
+    g_mac_config.rx_csum_offload = MSS_MAC_ENABLE;
+#endif
+
 #if (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM1) ||\
     (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM0) ||\
     (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM1)   ||\
@@ -422,6 +527,13 @@ low_level_init(struct netif *netif)
         while(1);// could not create semaphore
     }
 
+    if(pdPASS != xTaskCreate(ethernetif_rx_task, "EthRx",
+                             ETHERNETIF_RX_TASK_STACKSIZE, netif,
+                             ETHERNETIF_RX_TASK_PRIO, &g_mac_rx_task))
+    {
+        while(1);// could not create receive task
+    }
+
     /*
      * Initialize MAC with specified configuration. The Ethernet MAC is
      * functional after this function returns but still requires transmit and
@@ -547,6 +659,7 @@ low_level_output(struct netif *netif, struct pbuf *p)
     struct pbuf *q;
     uint16_t pckt_length = 0u;
     uint32_t pbuf_chain_end = 0u;
+    uint32_t tx_index;
     
     int32_t tx_status;
 
@@ -558,49 +671,62 @@ low_level_output(struct netif *netif, struct pbuf *p)
     /*--------------------------------------------------------------------------
      * Wait for packet buffer to become free.
      */
-    // Block waiting for the semaphore to become available.
-    if( xSemaphoreTake( xSemaphore, portMAX_DELAY ) == pdTRUE )
+    // Block waiting for the semaphore given when a buffer is released.
+    tx_index = get_free_tx_buffer();
+    while(TX_BUFFER_COUNT == tx_index)
     {
+        (void)xSemaphoreTake( xSemaphore, portMAX_DELAY );
+        tx_index = get_free_tx_buffer();
+    }
 
-        /*--------------------------------------------------------------------------
-         * Copy pbuf chain into single buffer.
-         */
-        q = p;
-        do {
-            memcpy(&g_mac_tx_buffer[0][pckt_length], q->payload, q->len);
-            pckt_length = (uint16_t)(pckt_length + q->len);
-            if(q->len == q->tot_len)
-            {
-                pbuf_chain_end = 1u;
-            }
-            else
-            {
-                q = q->next;
-            }
-        } while(0u == pbuf_chain_end);
+    g_mac_tx_buffer_used[tx_index] = BUFFER_USED;
 
-        /*--------------------------------------------------------------------------
-         * Initiate packet transmit. Keep retrying until there is room in the MAC Tx
-         * ring.
-         */
-        do {
+    /*--------------------------------------------------------------------------
+     * Copy pbuf chain into single buffer.
+     */
+    q = p;
+    do {
+        memcpy(&g_mac_tx_buffer[tx_index][pckt_length], q->payload, q->len);
+        pckt_length = (uint16_t)(pckt_length + q->len);
+        if(q->len == q->tot_len)
+        {
+            pbuf_chain_end = 1u;
+        }
+        else
+        {
+            q = q->next;
+        }
+    } while(0u == pbuf_chain_end);
+
+    /*--------------------------------------------------------------------------
+     * Initiate packet transmit. Keep retrying until there is room in the MAC Tx
+     * ring.
+     */
+    do {
 #if defined(MSS_MAC_USE_DDR)
-        	memcpy((void *)0xC0030000LLU, g_mac_tx_buffer[0], pckt_length);
-        	tx_status = MSS_MAC_send_pkt((mss_mac_instance_t *)0xC0000000LLU, (void *)0xC0030000LLU, pckt_length, (void *)&g_mac_tx_buffer_used[0]);
+    	memcpy((void *)0xC0030000LLU, g_mac_tx_buffer[0], pckt_length);
+    	tx_status = MSS_MAC_send_pkt((mss_mac_instance_t *)0xC0000000LLU, (void *)0xC0030000LLU, pckt_length, (void *)&g_mac_tx_buffer_used[0]);
 
+#elif defined(TX_USE_RING)
+        g_mac_tx_in_output = 1u;
+#if defined(G5_SOC_EMU_USE_GEM0) && ((MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0_LOCAL))
+        tx_status = MSS_MAC_tx_ring_push(&g_mac0, 0, g_mac_tx_buffer[tx_index], pckt_length, (void *)&g_mac_tx_buffer_used[tx_index]);
+#else
+        tx_status = MSS_MAC_tx_ring_push(&g_mac1, 0, g_mac_tx_buffer[tx_index], pckt_length, (void *)&g_mac_tx_buffer_used[tx_index]);
+#endif
+        g_mac_tx_in_output = 0u;
 #else
 #if defined(G5_SOC_EMU_USE_GEM0) && ((MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0_LOCAL))
-        	tx_status = MSS_MAC_send_pkt(&g_mac0, 0, g_mac_tx_buffer[0], pckt_length, (void *)&g_mac_tx_buffer_used[0]);
+    	tx_status = MSS_MAC_send_pkt(&g_mac0, 0, g_mac_tx_buffer[0], pckt_length, (void *)&g_mac_tx_buffer_used[0]);
 #else
-        	tx_status = MSS_MAC_send_pkt(&g_mac1, 0, g_mac_tx_buffer[0], pckt_length, (void *)&g_mac_tx_buffer_used[0]);
+    	tx_status = MSS_MAC_send_pkt(&g_mac1, 0, g_mac_tx_buffer[0], pckt_length, (void *)&g_mac_tx_buffer_used[0]);
 #endif
 #endif
-            if(MSS_MAC_SUCCESS != tx_status)
-            {
-            	vTaskDelay(1);
-            }
-        } while(MSS_MAC_SUCCESS != tx_status);
-    }
+        if(MSS_MAC_SUCCESS != tx_status)
+        {
+        	vTaskDelay(1);
+        }
+    } while(MSS_MAC_SUCCESS != tx_status);
     
     MIB2_STATS_NETIF_ADD(netif, ifoutoctets, p->tot_len);
     if (((u8_t*)p->payload)[0] & 1) {
@@ -618,6 +744,22 @@ low_level_output(struct netif *netif, struct pbuf *p)
     return ERR_OK;
 }
 
+/**=============================================================================
+ * Returns the index of a free transmit buffer, or TX_BUFFER_COUNT if all of
+ * them are waiting to be sent.
+ */
+static uint32_t get_free_tx_buffer(void)
+{
+    uint32_t index = 0u;
+
+    while((index < TX_BUFFER_COUNT) && (BUFFER_EMPTY != g_mac_tx_buffer_used[index]))
+    {
+        ++index;
+    }
+
+    return index;
+}
+
 /**=============================================================================
  *
  */
@@ -630,14 +772,28 @@ static void packet_tx_complete_handler(/* mss_mac_instance_t*/ void *this_mac, u
     static signed portBASE_TYPE xHigherPriorityTaskWoken;
     xHigherPriorityTaskWoken = pdFALSE;
 
-    (void)caller_info;
     (void)this_mac;
+    (void)queue_no;
+    (void)cdesc;
 
-    // Unblock the task by releasing the semaphore.
-    xSemaphoreGiveFromISR( xSemaphore, &xHigherPriorityTaskWoken );
-    if(pdTRUE == xHigherPriorityTaskWoken)
+    if(NULL != caller_info)
     {
-    	g_mac_context_switch = 1;
+        *(volatile uint8_t *)caller_info = RELEASE_BUFFER;
+    }
+
+    /*
+     * The driver's transmit ring can also make this call from
+     * MSS_MAC_tx_ring_push(), in low_level_output(). That task is not blocked
+     * then and finds the released buffer itself.
+     */
+    if(0u == g_mac_tx_in_output)
+    {
+        // Unblock the task by releasing the semaphore.
+        xSemaphoreGiveFromISR( xSemaphore, &xHigherPriorityTaskWoken );
+        if(pdTRUE == xHigherPriorityTaskWoken)
+        {
+        	g_mac_context_switch = 1;
+        }
     }
 }
 
@@ -656,14 +812,72 @@ static void mac_rx_callback
     void * caller_info
 )
 {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    uint32_t head;
+
+    (void)this_mac;
+    (void)queue_no;
+    (void)cdesc;
     (void)caller_info;
     if(g_p_mac_netif != 0)
     {
-        ethernetif_input(g_p_mac_netif, p_rx_packet, pckt_length);
+        /*
+         * Queue the frame for the receive task. Each entry holds a receive
+         * buffer only handed back to the MAC once the frame has been passed
+         * up, so the queue cannot overflow.
+         */
+        head = g_mac_rx_queue_head;
+        g_mac_rx_queue[head].p_rx_packet = p_rx_packet;
+        g_mac_rx_queue[head].pckt_length = pckt_length;
+        ++head;
+        if(RX_QUEUE_SIZE == head)
+        {
+            head = 0u;
+        }
+        mb();
+        g_mac_rx_queue_head = head;
+
+        vTaskNotifyGiveFromISR(g_mac_rx_task, &xHigherPriorityTaskWoken);
+        if(pdTRUE == xHigherPriorityTaskWoken)
+        {
+            g_mac_context_switch = 1;
+        }
     }
     _rx_counter++;
 }
 
+/**=============================================================================
+ * Receive task. Woken by mac_rx_callback(), it passes all the frames queued
+ * since it last ran to lwIP, so frames arriving in a burst are handled in one
+ * pass and no lwIP work is done in the MAC interrupt.
+ *
+ * @param pvParameters the lwip network interface structure for this ethernetif
+ */
+static void ethernetif_rx_task(void * pvParameters)
+{
+    struct netif * netif = (struct netif *)pvParameters;
+    uint32_t tail;
+
+    for(;;)
+    {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        tail = g_mac_rx_queue_tail;
+        while(tail != g_mac_rx_queue_head)
+        {
+            mb();
+            ethernetif_input(netif, g_mac_rx_queue[tail].p_rx_packet,
+                             g_mac_rx_queue[tail].pckt_length);
+            ++tail;
+            if(RX_QUEUE_SIZE == tail)
+            {
+                tail = 0u;
+            }
+            g_mac_rx_queue_tail = tail;
+        }
+    }
+}
+
 /**=============================================================================
  * This function should be called when a packet is ready to be read
  * from the interface. It uses the function low_level_input() that
@@ -739,8 +953,29 @@ low_level_input
         len += ETH_PAD_SIZE; /* allow room for Ethernet padding */
 #endif
 
+#if defined(RX_USE_CUSTOM_PBUF)
+        /*
+         * Wrap the receive buffer in its custom pbuf. The buffer is handed
+         * back to the MAC by rx_pbuf_free() once lwIP is done with it.
+         */
+        {
+            uint32_t index = (uint32_t)((p_rx_packet - &g_mac_rx_buffer[0][0]) /
+                                        MSS_MAC_MAX_RX_BUF_SIZE);
+
+            p = pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF,
+                                    &g_mac_rx_pbuf[index], p_rx_packet,
+                                    (u16_t)MSS_MAC_MAX_RX_BUF_SIZE);
+        }
+        if (p != NULL)
+        {
+#else
+#if LWIP_MPFS_PBUF_CACHE
+        /* We allocate a pbuf from the cache of this hart. */
+        p = mpfs_pbuf_cache_alloc(PBUF_RAW, len);
+#else
         /* We allocate a pbuf chain of pbufs from the pool. */
         p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+#endif
         if (p != NULL)
         {
             uint32_t length = 0;
@@ -765,6 +1000,7 @@ low_level_input
 #else
             MSS_MAC_receive_pkt(&g_mac1, 0, p_rx_packet, 0, 1);
 #endif
+#endif /* RX_USE_CUSTOM_PBUF */
 #if ETH_PAD_SIZE
             pbuf_header(p, ETH_PAD_SIZE); /* reclaim the padding word */
 #endif
@@ -799,6 +1035,26 @@ low_level_input
     return p;
 }
 
+#if defined(RX_USE_CUSTOM_PBUF)
+/**=============================================================================
+ * Called by lwIP when the last reference to a received frame's custom pbuf is
+ * freed. Hands the receive buffer back to the MAC.
+ *
+ * @param p the custom pbuf, one of g_mac_rx_pbuf[]
+ */
+static void
+rx_pbuf_free(struct pbuf *p)
+{
+    uint32_t index = (uint32_t)((struct pbuf_custom *)p - &g_mac_rx_pbuf[0]);
+
+#if defined(G5_SOC_EMU_USE_GEM0) && ((MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0_LOCAL))
+    MSS_MAC_receive_pkt(&g_mac0, 0, g_mac_rx_buffer[index], 0, 1);
+#else
+    MSS_MAC_receive_pkt(&g_mac1, 0, g_mac_rx_buffer[index], 0, 1);
+#endif
+}
+#endif
+
 /**************************************************************************//**
  *
  */
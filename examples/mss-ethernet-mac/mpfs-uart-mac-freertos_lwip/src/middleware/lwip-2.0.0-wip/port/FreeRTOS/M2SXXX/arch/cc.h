@@ -89,6 +89,27 @@ uint32_t sys_arch_random(void);
 
 #define LWIP_PLATFORM_HTONL(x) __REV(x)
 
+/*
+ * Memory placement, see LWIP_PBUF_POOL_SECTION in lwipopts.h. The section of
+ * these declarations is kept by the definitions of the pools in memp.c.
+ */
+#ifdef LWIP_PBUF_POOL_SECTION
+extern uint8_t memp_memory_PBUF_POOL_base[] __attribute__((section(LWIP_PBUF_POOL_SECTION)));
+#endif
+
+#ifdef LWIP_TCP_MEM_SECTION
+extern uint8_t memp_memory_TCP_PCB_base[] __attribute__((section(LWIP_TCP_MEM_SECTION)));
+extern uint8_t memp_memory_TCP_PCB_LISTEN_base[] __attribute__((section(LWIP_TCP_MEM_SECTION)));
+extern uint8_t memp_memory_TCP_SEG_base[] __attribute__((section(LWIP_TCP_MEM_SECTION)));
+#endif
+
+#ifdef LWIP_HEAP_SECTION
+extern uint8_t memp_memory_POOL256_base[] __attribute__((section(LWIP_HEAP_SECTION)));
+extern uint8_t memp_memory_POOL512_base[] __attribute__((section(LWIP_HEAP_SECTION)));
+extern uint8_t memp_memory_POOL1512_base[] __attribute__((section(LWIP_HEAP_SECTION)));
+extern uint8_t memp_memory_POOL1540_base[] __attribute__((section(LWIP_HEAP_SECTION)));
+#endif
+
 uint16_t lwip_cortem_chksum(const void *dataptr, int len);
 #if !defined(_ZL303XX_MIV)
 #define LWIP_CHKSUM lwip_cortem_chksum
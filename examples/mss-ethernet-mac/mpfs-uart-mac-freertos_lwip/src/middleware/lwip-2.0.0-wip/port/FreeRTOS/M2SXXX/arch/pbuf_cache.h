@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Per-hart pbuf caches for the PolarFire SoC lwIP port.
+ *
+ * mpfs_pbuf_cache_alloc() returns a single pbuf of PBUF_POOL_BUFSIZE bytes
+ * from a pool of LWIP_MPFS_PBUF_CACHE_COUNT, in place of
+ * pbuf_alloc(layer, length, PBUF_POOL). Each hart keeps up to
+ * LWIP_MPFS_PBUF_CACHE_DEPTH free pbufs of its own, taken and given back with
+ * its interrupts disabled but without a lock, so harts allocating and freeing
+ * pbufs at the same time do not contend for the pool. Only when its cache is
+ * empty, or full, does a hart move half of LWIP_MPFS_PBUF_CACHE_DEPTH pbufs
+ * from, or to, the shared free list, under a spin lock.
+ *
+ * The pbufs are lwIP custom pbufs of type PBUF_POOL, freed with pbuf_free()
+ * as any other, into the cache of the hart which frees them. The pool is
+ * placed in LWIP_PBUF_POOL_SECTION when it is defined, as the lwIP pbuf pool
+ * is.
+ */
+#ifndef __PBUF_CACHE_H__
+#define __PBUF_CACHE_H__
+
+#include "lwip/opt.h"
+#include "lwip/pbuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if LWIP_MPFS_PBUF_CACHE
+
+/*------------------------------------------------------------------------------
+  Builds the shared free list. Called once, before any pbuf is allocated from
+  the caches.
+ */
+void mpfs_pbuf_cache_init(void);
+
+/*------------------------------------------------------------------------------
+  Allocates a pbuf from the cache of the calling hart.
+
+  @param layer
+    Header room kept ahead of the payload, as for pbuf_alloc().
+  @param length
+    Size of the payload.
+  @return
+    The pbuf, or NULL if the pool is empty or length and the header room do
+    not fit in PBUF_POOL_BUFSIZE bytes.
+ */
+struct pbuf * mpfs_pbuf_cache_alloc(pbuf_layer layer, u16_t length);
+
+/*------------------------------------------------------------------------------
+  Returns the number of pbufs free in the shared list, not counting those in
+  the hart caches.
+ */
+u32_t mpfs_pbuf_cache_shared_free(void);
+
+#endif /* LWIP_MPFS_PBUF_CACHE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PBUF_CACHE_H__ */
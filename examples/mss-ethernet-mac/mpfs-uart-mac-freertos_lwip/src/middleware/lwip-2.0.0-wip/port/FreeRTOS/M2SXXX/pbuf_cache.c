@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Per-hart pbuf caches for the PolarFire SoC lwIP port, see arch/pbuf_cache.h.
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#include "lwip/opt.h"
+#include "lwip/sys.h"
+#include "lwip/pbuf.h"
+#include "arch/pbuf_cache.h"
+
+#if LWIP_MPFS_PBUF_CACHE
+
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "LWIP_MPFS_PBUF_CACHE needs LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+#if (LWIP_MPFS_PBUF_CACHE_DEPTH < 2)
+#error "LWIP_MPFS_PBUF_CACHE_DEPTH must be at least 2"
+#endif
+
+/* E51 and U54_1 to U54_4 */
+#define PBUF_CACHE_HARTS        5u
+
+/* pbufs moved between a hart cache and the shared list at a time */
+#define PBUF_CACHE_BATCH        (LWIP_MPFS_PBUF_CACHE_DEPTH / 2u)
+
+/*
+ * The payload follows the pbuf, so a header can be added back in front of it
+ * as for a PBUF_POOL pbuf.
+ */
+typedef struct pbuf_cache_elem
+{
+    struct pbuf_custom pc;
+    u8_t payload[PBUF_POOL_BUFSIZE] __attribute__ ((aligned (MEM_ALIGNMENT)));
+} pbuf_cache_elem_t;
+
+typedef struct
+{
+    pbuf_cache_elem_t * free[LWIP_MPFS_PBUF_CACHE_DEPTH];
+    u32_t count;
+} __attribute__ ((aligned (64))) hart_cache_t;
+
+#ifdef LWIP_PBUF_POOL_SECTION
+static pbuf_cache_elem_t g_pool[LWIP_MPFS_PBUF_CACHE_COUNT]
+    __attribute__ ((section (LWIP_PBUF_POOL_SECTION)));
+#else
+static pbuf_cache_elem_t g_pool[LWIP_MPFS_PBUF_CACHE_COUNT];
+#endif
+
+/* Each hart cache is only used by its own hart, on its own cache line */
+static hart_cache_t g_hart_cache[PBUF_CACHE_HARTS];
+
+/* Shared free list, linked through pc.pbuf.next */
+static pbuf_cache_elem_t * g_shared_free = NULL;
+static u32_t g_shared_count = 0u;
+static volatile u8_t g_shared_lock = 0u;
+
+static void pbuf_cache_free(struct pbuf *p);
+
+static void shared_lock(void)
+{
+    while (__atomic_test_and_set(&g_shared_lock, __ATOMIC_ACQUIRE))
+    {
+        ;
+    }
+}
+
+static void shared_unlock(void)
+{
+    __atomic_clear(&g_shared_lock, __ATOMIC_RELEASE);
+}
+
+/*------------------------------------------------------------------------------
+  Moves up to PBUF_CACHE_BATCH pbufs from the shared list to an empty cache.
+ */
+static void refill(hart_cache_t * cache)
+{
+    pbuf_cache_elem_t * elem;
+
+    shared_lock();
+
+    while ((cache->count < PBUF_CACHE_BATCH) && (NULL != g_shared_free))
+    {
+        elem = g_shared_free;
+        g_shared_free = (pbuf_cache_elem_t *)elem->pc.pbuf.next;
+        g_shared_count--;
+        cache->free[cache->count] = elem;
+        cache->count++;
+    }
+
+    shared_unlock();
+}
+
+/*------------------------------------------------------------------------------
+  Moves PBUF_CACHE_BATCH pbufs from a full cache to the shared list.
+ */
+static void drain(hart_cache_t * cache)
+{
+    pbuf_cache_elem_t * elem;
+    u32_t inc;
+
+    shared_lock();
+
+    for (inc = 0u; inc < PBUF_CACHE_BATCH; inc++)
+    {
+        cache->count--;
+        elem = cache->free[cache->count];
+        elem->pc.pbuf.next = (struct pbuf *)g_shared_free;
+        g_shared_free = elem;
+        g_shared_count++;
+    }
+
+    shared_unlock();
+}
+
+/*------------------------------------------------------------------------------
+  See arch/pbuf_cache.h
+ */
+void mpfs_pbuf_cache_init(void)
+{
+    u32_t inc;
+
+    shared_lock();
+
+    g_shared_free = NULL;
+    g_shared_count = 0u;
+
+    for (inc = 0u; inc < LWIP_MPFS_PBUF_CACHE_COUNT; inc++)
+    {
+        g_pool[inc].pc.custom_free_function = pbuf_cache_free;
+        g_pool[inc].pc.pbuf.next = (struct pbuf *)g_shared_free;
+        g_shared_free = &g_pool[inc];
+        g_shared_count++;
+    }
+
+    for (inc = 0u; inc < PBUF_CACHE_HARTS; inc++)
+    {
+        g_hart_cache[inc].count = 0u;
+    }
+
+    shared_unlock();
+}
+
+/*------------------------------------------------------------------------------
+  See arch/pbuf_cache.h
+ */
+struct pbuf * mpfs_pbuf_cache_alloc(pbuf_layer layer, u16_t length)
+{
+    hart_cache_t * cache;
+    pbuf_cache_elem_t * elem = NULL;
+    struct pbuf * p = NULL;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+
+    cache = &g_hart_cache[read_csr(mhartid)];
+
+    if (0u == cache->count)
+    {
+        refill(cache);
+    }
+
+    if (0u != cache->count)
+    {
+        cache->count--;
+        elem = cache->free[cache->count];
+    }
+
+    SYS_ARCH_UNPROTECT(lev);
+
+    if (NULL != elem)
+    {
+        p = pbuf_alloced_custom(layer, length, PBUF_POOL, &elem->pc,
+                                elem->payload, (u16_t)PBUF_POOL_BUFSIZE);
+        if (NULL == p)
+        {
+            pbuf_cache_free(&elem->pc.pbuf);
+        }
+    }
+
+    return p;
+}
+
+/*------------------------------------------------------------------------------
+  See arch/pbuf_cache.h
+ */
+u32_t mpfs_pbuf_cache_shared_free(void)
+{
+    return __atomic_load_n(&g_shared_count, __ATOMIC_RELAXED);
+}
+
+/*------------------------------------------------------------------------------
+  Called by pbuf_free() when the last reference to a cache pbuf goes. The pbuf
+  goes into the cache of the hart freeing it.
+ */
+static void pbuf_cache_free(struct pbuf *p)
+{
+    hart_cache_t * cache;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+
+    cache = &g_hart_cache[read_csr(mhartid)];
+
+    if (LWIP_MPFS_PBUF_CACHE_DEPTH == cache->count)
+    {
+        drain(cache);
+    }
+
+    cache->free[cache->count] = (pbuf_cache_elem_t *)p;
+    cache->count++;
+
+    SYS_ARCH_UNPROTECT(lev);
+}
+
+#endif /* LWIP_MPFS_PBUF_CACHE */
@@ -758,6 +758,8 @@ MSS_MAC_cfg_struct_def_init
         cfg->rx_edc_enable         = MSS_MAC_ERR_DET_CORR_DISABLE;
         cfg->jumbo_frame_enable    = MSS_MAC_JUMBO_FRAME_DISABLE;
         cfg->jumbo_frame_default   = MSS_MAC_MAX_PACKET_SIZE;
+        cfg->tx_csum_offload       = MSS_MAC_DISABLE;
+        cfg->rx_csum_offload       = MSS_MAC_DISABLE;
         cfg->length_field_check    = MSS_MAC_LENGTH_FIELD_CHECK_ENABLE;
         cfg->append_CRC            = MSS_MAC_CRC_ENABLE;
         cfg->loopback              = MSS_MAC_LOOPBACK_DISABLE;
@@ -1100,6 +1102,11 @@ static void config_mac_hw(mss_mac_instance_t *this_mac, const mss_mac_cfg_t * cf
     {
         temp_net_config |= GEM_LENGTH_FIELD_ERROR_FRAME_DISCARD;
     }
+
+    if(MSS_MAC_ENABLE == cfg->rx_csum_offload)
+    {
+        temp_net_config |= GEM_RECEIVE_CHECKSUM_OFFLOAD_ENABLE;
+    }
     
     if(MSS_MAC_IPG_DEFVAL != cfg->ipg_multiplier) /* If we have a non zero value here then enable IPG stretching */
     {
@@ -1159,6 +1166,11 @@ static void config_mac_hw(mss_mac_instance_t *this_mac, const mss_mac_cfg_t * cf
     temp_dma_config |= GEM_DMA_ADDR_BUS_WIDTH_1;
 #endif
 
+    if(MSS_MAC_ENABLE == cfg->tx_csum_offload)
+    {
+        temp_dma_config |= GEM_TX_PBUF_TCP_EN;
+    }
+
 if(0U != this_mac->is_emac)
     {
     this_mac->emac_base->DMA_CONFIG = temp_dma_config;
@@ -651,6 +651,8 @@ typedef struct __mss_mac_cfg_t
     uint32_t mmsl_int_priority;         /*!< MMSL interrupt */
     uint32_t tsu_clock_select;          /*!< 0 for default TSU clock, 1 for fabric tsu clock */
     uint32_t amba_burst_length;         /*!< AXI burst length for DMA data transfers */
+    uint32_t tx_csum_offload;           /*!< Enable hardware TX IP/TCP/UDP checksum generation */
+    uint32_t rx_csum_offload;           /*!< Enable hardware RX IP/TCP/UDP checksum checking */
 } mss_mac_cfg_t;
 
 /***************************************************************************//**
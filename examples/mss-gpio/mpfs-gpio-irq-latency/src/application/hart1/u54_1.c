@@ -0,0 +1,614 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Application code running on U54_1
+ *
+ * PolarFire SoC GPIO loopback interrupt latency benchmark. See README.md.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss/mss_gpio/mss_gpio.h"
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+#include "drivers/mss/mss_pdma/mss_pdma.h"
+#include "inc/latency_bench.h"
+#include "bench_report.h"
+
+/*
+ * Loopbacks of the Icicle kit reference design: GPIO2_26 drives the GPIO2_30
+ * input and GPIO2_28 drives MSS_INT_F2M[0], which is both a PLIC source and
+ * local interrupt 16 of each U54.
+ */
+#define TRIGGER_GPIO_PIN        MSS_GPIO_26
+#define TRIGGER_F2H_PIN         MSS_GPIO_28
+#define INPUT_GPIO_PIN          MSS_GPIO_30
+#define F2H_0_LOCAL_INT         16u
+
+#define CPU_CLK_MHZ             (LIBERO_SETTING_MSS_COREPLEX_CPU_CLK / 1000000u)
+#define CYCLES_TO_NS(c)         (((c) * 1000u) / CPU_CLK_MHZ)
+
+/* Trigger ticks of HART1_TICK_RATE_MS waited in wfi before a sample is lost */
+#define BENCH_TIMEOUT_TICKS     2u
+
+typedef enum
+{
+    PATH_GPIO_PLIC = 0,             /* GPIO2_30 through the PLIC */
+    PATH_F2H_PLIC,                  /* MSS_INT_F2M[0] through the PLIC */
+    PATH_F2H_LOCAL,                 /* MSS_INT_F2M[0] as a local interrupt */
+    NUM_PATHS
+} bench_path_t;
+
+typedef struct
+{
+    uint32_t bin[BENCH_BINS];
+    uint64_t min;
+    uint64_t max;
+    uint64_t sum;
+    uint32_t count;
+} histogram_t;
+
+static const char * const g_path_names[NUM_PATHS] =
+{
+    "GPIO2_30 PLIC", "F2H_0 PLIC", "F2H_0 local"
+};
+
+static const char * const g_load_names[BENCH_NUM_LOADS] =
+{
+    "none", "PDMA", "memory", "PDMA + memory"
+};
+
+static histogram_t g_handler_hist;
+static histogram_t g_task_hist;
+
+/* Written by the handlers */
+static volatile uint32_t g_armed;               /* Path expected + 1 */
+static volatile uint32_t g_fired;
+static volatile uint64_t g_handler_cycle;
+static volatile uint32_t g_spurious;
+static volatile uint64_t g_ticks;
+
+#if (BENCH_DMA_CHANNELS > 0u)
+#ifndef BENCH_DMA_SRC
+static uint8_t g_dma_src[BENCH_DMA_CHANNELS][BENCH_DMA_BYTES]
+                                __attribute__((aligned(BENCH_LINE_BYTES)));
+static uint8_t g_dma_dst[BENCH_DMA_CHANNELS][BENCH_DMA_BYTES]
+                                __attribute__((aligned(BENCH_LINE_BYTES)));
+#define BENCH_DMA_SRC           ((uint64_t)(uintptr_t)g_dma_src)
+#define BENCH_DMA_DST           ((uint64_t)(uintptr_t)g_dma_dst)
+#endif
+#endif
+
+static char g_line[128];
+
+static bench_report_t g_report;
+
+/* Settings given on the config lines of the report */
+static const bench_config_t g_bench_config[] =
+{
+    BENCH_CONFIG(BENCH_SAMPLES),
+    BENCH_CONFIG(BENCH_BIN_CYCLES),
+    BENCH_CONFIG(BENCH_TASK_WFI),
+    BENCH_CONFIG(BENCH_DMA_CHANNELS),
+    BENCH_CONFIG(BENCH_DMA_BYTES),
+    BENCH_CONFIG(BENCH_MEM_LOAD_BYTES)
+};
+
+static uint32_t bench_run(bench_path_t path);
+static void path_enable(bench_path_t path, uint8_t enable);
+static void load_start(bench_load_t load);
+static void load_stop(bench_load_t load);
+static void handler_taken(bench_path_t path, uint64_t cycle);
+static void hist_clear(histogram_t * hist);
+static void hist_add(histogram_t * hist, uint64_t cycles);
+static void hist_print(void);
+static uint64_t hist_percentile(const histogram_t * hist, uint32_t percent);
+static void report_results(bench_path_t path, bench_load_t load, uint32_t lost);
+static void print(const char * text);
+
+/* Main function for the hart1(U54 processor).
+ * Application code running on hart1 is placed here.
+ */
+void u54_1(void)
+{
+    uint32_t path;
+    uint32_t load;
+    uint32_t lost;
+
+    /* Clear pending software interrupt in case there was any.
+     * Enable only the software interrupt so that the E51 core can bring this
+     * core out of WFI by raising a software interrupt In case of external,
+     * bootloader not present
+     */
+
+    clear_soft_interrupt();
+    set_csr(mie, MIP_MSIP);
+
+#if (IMAGE_LOADED_BY_BOOTLOADER == 0)
+
+    /*Put this hart into WFI.*/
+
+    do
+    {
+        __asm("wfi");
+    }while(0 == (read_csr(mip) & MIP_MSIP));
+
+    /* The hart is out of WFI, clear the SW interrupt. Hear onwards Application
+     * can enable and use any interrupts as required */
+    clear_soft_interrupt();
+#endif
+
+    PLIC_init();
+    __enable_irq();
+
+    (void)mss_config_clk_rst(MSS_PERIPH_MMUART1, (uint8_t) MPFS_HAL_FIRST_HART, PERIPHERAL_ON);
+    (void)mss_config_clk_rst(MSS_PERIPH_GPIO2, (uint8_t) MPFS_HAL_FIRST_HART, PERIPHERAL_ON);
+    (void)mss_config_clk_rst(MSS_PERIPH_CFM, (uint8_t) MPFS_HAL_FIRST_HART, PERIPHERAL_ON);
+
+    MSS_UART_init( &g_mss_uart1_lo,
+            MSS_UART_115200_BAUD,
+            MSS_UART_DATA_8_BITS | MSS_UART_NO_PARITY | MSS_UART_ONE_STOP_BIT);
+
+    print("\r\n**** PolarFire SoC GPIO loopback interrupt latency benchmark ****\r\n");
+
+    /* The tick is the time-out of the samples waited for in wfi */
+    SysTick_Config();
+
+    /* Routes the GPIO2 interrupts to the PLIC instead of GPIO0 and GPIO1 */
+    SYSREG->GPIO_INTERRUPT_FAB_CR = 0xFFFFFFFFUL;
+
+    PLIC_SetPriority_Threshold(0);
+    PLIC_SetPriority(GPIO1_BIT16_or_GPIO2_BIT30_PLIC_30, 2u);
+    PLIC_SetPriority(FABRIC_F2H_0_PLIC, 2u);
+
+    MSS_GPIO_init(GPIO2_LO);
+    MSS_GPIO_config(GPIO2_LO, TRIGGER_GPIO_PIN, MSS_GPIO_OUTPUT_MODE);
+    MSS_GPIO_config(GPIO2_LO, TRIGGER_F2H_PIN, MSS_GPIO_OUTPUT_MODE);
+    MSS_GPIO_config(GPIO2_LO, INPUT_GPIO_PIN,
+                    MSS_GPIO_INPUT_MODE | MSS_GPIO_IRQ_EDGE_POSITIVE);
+    MSS_GPIO_set_outputs(GPIO2_LO, 0u);
+
+#if (BENCH_DMA_CHANNELS > 0u)
+    MSS_PDMA_init();
+#endif
+
+    (void)snprintf(g_line, sizeof(g_line),
+                   "CPU clock %lu MHz, %u samples per run, %s task\r\n",
+                   (unsigned long)CPU_CLK_MHZ, (unsigned int)BENCH_SAMPLES,
+                   (BENCH_TASK_WFI != 0) ? "wfi" : "spinning");
+    print(g_line);
+
+    bench_report_begin(&g_report, &g_mss_uart1_lo, NULL,
+                       "mpfs-gpio-irq-latency", g_bench_config,
+                       sizeof(g_bench_config) / sizeof(g_bench_config[0]));
+
+    for (load = 0u; load < (uint32_t)BENCH_NUM_LOADS; load++)
+    {
+        if ((0u == BENCH_DMA_CHANNELS) &&
+            ((BENCH_LOAD_DMA == (bench_load_t)load) ||
+             (BENCH_LOAD_DMA_MEM == (bench_load_t)load)))
+        {
+            continue;
+        }
+
+        load_start((bench_load_t)load);
+
+        for (path = 0u; path < (uint32_t)NUM_PATHS; path++)
+        {
+            (void)snprintf(g_line, sizeof(g_line),
+                           "\r\npath %s, load %s\r\n",
+                           g_path_names[path], g_load_names[load]);
+            print(g_line);
+
+            lost = bench_run((bench_path_t)path);
+            hist_print();
+            report_results((bench_path_t)path, (bench_load_t)load, lost);
+        }
+
+        load_stop((bench_load_t)load);
+    }
+
+    bench_report_end(&g_report);
+
+    (void)snprintf(g_line, sizeof(g_line),
+                   "\r\ndone, memory load walked %lu lines\r\n",
+                   (unsigned long)g_mem_load_lines);
+    print(g_line);
+
+    while (1u)
+    {
+        __asm("wfi");
+    }
+}
+
+/*
+ * Takes BENCH_SAMPLES interrupts on one path. Each one is triggered by a write
+ * to the GPIO outputs. The handler latency is from the cycle before the write
+ * to the first instruction of the handler, the task latency from the same
+ * cycle to the task seeing the flag set by the handler. Returns the number of
+ * samples lost.
+ */
+static uint32_t bench_run(bench_path_t path)
+{
+    uint32_t pin_mask = (PATH_GPIO_PLIC == path) ?
+            ((uint32_t)1u << TRIGGER_GPIO_PIN) : ((uint32_t)1u << TRIGGER_F2H_PIN);
+    uint32_t sample;
+    uint32_t lost = 0u;
+    uint32_t lfsr = 0xACE1u;
+    uint64_t trigger;
+    uint64_t task;
+    uint64_t gap;
+    uint64_t start_ticks;
+
+    hist_clear(&g_handler_hist);
+    hist_clear(&g_task_hist);
+    g_spurious = 0u;
+
+    path_enable(path, 1u);
+
+    for (sample = 0u; sample < BENCH_SAMPLES; sample++)
+    {
+        /* A pseudo random gap between samples, so they do not line up with
+         * the period of the load */
+        lfsr = (lfsr >> 1u) ^ ((0u - (lfsr & 1u)) & 0xB400u);
+        gap = readmcycle() + 2000u + (lfsr & 0xFFFu);
+        while (readmcycle() < gap)
+        {
+            ;
+        }
+
+        g_fired = 0u;
+        g_armed = (uint32_t)path + 1u;
+        mb();
+
+        trigger = readmcycle();
+        MSS_GPIO_set_outputs(GPIO2_LO, pin_mask);
+
+#if (BENCH_TASK_WFI != 0)
+        start_ticks = g_ticks;
+        __disable_irq();
+        while ((0u == g_fired) &&
+               ((g_ticks - start_ticks) < BENCH_TIMEOUT_TICKS))
+        {
+            /* wfi wakes up on the pending interrupt, which is taken here */
+            __asm("wfi");
+            __enable_irq();
+            __disable_irq();
+        }
+        task = readmcycle();
+        __enable_irq();
+#else
+        (void)start_ticks;
+        while ((0u == g_fired) &&
+               ((readmcycle() - trigger) < BENCH_TIMEOUT_CYCLES))
+        {
+            ;
+        }
+        task = readmcycle();
+#endif
+
+        g_armed = 0u;
+
+        if (0u != g_fired)
+        {
+            hist_add(&g_handler_hist, g_handler_cycle - trigger);
+            hist_add(&g_task_hist, task - trigger);
+        }
+        else
+        {
+            ++lost;
+            MSS_GPIO_set_outputs(GPIO2_LO, 0u);
+        }
+    }
+
+    path_enable(path, 0u);
+
+    (void)snprintf(g_line, sizeof(g_line),
+                   "samples %u, lost %u, spurious %u\r\n",
+                   (unsigned int)g_handler_hist.count, (unsigned int)lost,
+                   (unsigned int)g_spurious);
+    print(g_line);
+
+    return (lost);
+}
+
+static void path_enable(bench_path_t path, uint8_t enable)
+{
+    switch (path)
+    {
+        case PATH_GPIO_PLIC:
+            if (0u != enable)
+            {
+                MSS_GPIO_clear_irq(GPIO2_LO, INPUT_GPIO_PIN);
+                MSS_GPIO_enable_irq(GPIO2_LO, INPUT_GPIO_PIN);
+            }
+            else
+            {
+                MSS_GPIO_disable_irq(GPIO2_LO, INPUT_GPIO_PIN);
+            }
+            break;
+
+        case PATH_F2H_PLIC:
+            if (0u != enable)
+            {
+                PLIC_EnableIRQ(FABRIC_F2H_0_PLIC);
+            }
+            else
+            {
+                PLIC_DisableIRQ(FABRIC_F2H_0_PLIC);
+            }
+            break;
+
+        default:
+            if (0u != enable)
+            {
+                __enable_local_irq(F2H_0_LOCAL_INT);
+            }
+            else
+            {
+                __disable_local_irq(F2H_0_LOCAL_INT);
+            }
+            break;
+    }
+}
+
+/*
+ * The PDMA channels copy their buffers over and over in repeat mode, without
+ * interrupts. The memory load runs on U54_2.
+ */
+static void load_start(bench_load_t load)
+{
+#if (BENCH_DMA_CHANNELS > 0u)
+    mss_pdma_channel_config_t config;
+    uint32_t channel;
+
+    if ((BENCH_LOAD_DMA == load) || (BENCH_LOAD_DMA_MEM == load))
+    {
+        for (channel = 0u; channel < BENCH_DMA_CHANNELS; channel++)
+        {
+            config.src_addr = BENCH_DMA_SRC + (channel * BENCH_DMA_BYTES);
+            config.dest_addr = BENCH_DMA_DST + (channel * BENCH_DMA_BYTES);
+            config.num_bytes = BENCH_DMA_BYTES;
+            config.enable_done_int = 0u;
+            config.enable_err_int = 0u;
+            config.repeat = 1u;
+            config.force_order = 0u;
+
+            if ((MSS_PDMA_OK != MSS_PDMA_setup_transfer(
+                                    (mss_pdma_channel_id_t)channel, &config)) ||
+                (MSS_PDMA_OK != MSS_PDMA_start_transfer(
+                                    (mss_pdma_channel_id_t)channel)))
+            {
+                print("PDMA set up failed\r\n");
+            }
+        }
+    }
+#endif
+
+    if ((BENCH_LOAD_MEM == load) || (BENCH_LOAD_DMA_MEM == load))
+    {
+        g_mem_load_run = 1u;
+    }
+}
+
+static void load_stop(bench_load_t load)
+{
+#if (BENCH_DMA_CHANNELS > 0u)
+    volatile mss_pdma_t * pdmareg;
+    uint32_t channel;
+
+    if ((BENCH_LOAD_DMA == load) || (BENCH_LOAD_DMA_MEM == load))
+    {
+        for (channel = 0u; channel < BENCH_DMA_CHANNELS; channel++)
+        {
+            /* Releasing the claim stops the repeated transfer */
+            pdmareg = (mss_pdma_t *)(uintptr_t)(PDMA_REG_BASE +
+                                     (PDMA_CHL_REG_OFFSET * channel));
+            pdmareg->control_reg = 0u;
+            while (0u != (pdmareg->control_reg & MASK_PDMA_CONTROL_RUN))
+            {
+                ;
+            }
+        }
+    }
+#endif
+
+    g_mem_load_run = 0u;
+    (void)load;
+}
+
+static void handler_taken(bench_path_t path, uint64_t cycle)
+{
+    /* Drop the trigger, the read back makes sure the write has reached the
+     * GPIO before the interrupt is completed */
+    MSS_GPIO_set_outputs(GPIO2_LO, 0u);
+    (void)MSS_GPIO_get_outputs(GPIO2_LO);
+
+    if ((((uint32_t)path + 1u) == g_armed) && (0u == g_fired))
+    {
+        g_handler_cycle = cycle;
+        mb();
+        g_fired = 1u;
+    }
+    else
+    {
+        ++g_spurious;
+    }
+}
+
+static void hist_clear(histogram_t * hist)
+{
+    (void)memset(hist, 0, sizeof(histogram_t));
+    hist->min = UINT64_MAX;
+}
+
+static void hist_add(histogram_t * hist, uint64_t cycles)
+{
+    uint64_t bin = cycles / BENCH_BIN_CYCLES;
+
+    if (bin >= BENCH_BINS)
+    {
+        bin = BENCH_BINS - 1u;
+    }
+
+    hist->bin[bin]++;
+    hist->sum += cycles;
+    hist->count++;
+
+    if (cycles < hist->min)
+    {
+        hist->min = cycles;
+    }
+
+    if (cycles > hist->max)
+    {
+        hist->max = cycles;
+    }
+}
+
+static void hist_print(void)
+{
+    const histogram_t * hists[2] = { &g_handler_hist, &g_task_hist };
+    const char * names[2] = { "handler", "task" };
+    uint32_t idx;
+    uint32_t bin;
+
+    for (idx = 0u; idx < 2u; idx++)
+    {
+        if (0u != hists[idx]->count)
+        {
+            (void)snprintf(g_line, sizeof(g_line),
+                           "%-7s cycles min %lu avg %lu max %lu, ns min %lu avg %lu max %lu\r\n",
+                           names[idx],
+                           (unsigned long)hists[idx]->min,
+                           (unsigned long)(hists[idx]->sum / hists[idx]->count),
+                           (unsigned long)hists[idx]->max,
+                           (unsigned long)CYCLES_TO_NS(hists[idx]->min),
+                           (unsigned long)CYCLES_TO_NS(hists[idx]->sum / hists[idx]->count),
+                           (unsigned long)CYCLES_TO_NS(hists[idx]->max));
+            print(g_line);
+        }
+    }
+
+    print("  cycles         handler     task\r\n");
+
+    for (bin = 0u; bin < BENCH_BINS; bin++)
+    {
+        if ((0u != g_handler_hist.bin[bin]) || (0u != g_task_hist.bin[bin]))
+        {
+            if (bin < (BENCH_BINS - 1u))
+            {
+                (void)snprintf(g_line, sizeof(g_line),
+                               "  %5u-%-5u  %9u %9u\r\n",
+                               (unsigned int)(bin * BENCH_BIN_CYCLES),
+                               (unsigned int)(((bin + 1u) * BENCH_BIN_CYCLES) - 1u),
+                               (unsigned int)g_handler_hist.bin[bin],
+                               (unsigned int)g_task_hist.bin[bin]);
+            }
+            else
+            {
+                (void)snprintf(g_line, sizeof(g_line),
+                               "  >= %-7u  %9u %9u\r\n",
+                               (unsigned int)(bin * BENCH_BIN_CYCLES),
+                               (unsigned int)g_handler_hist.bin[bin],
+                               (unsigned int)g_task_hist.bin[bin]);
+            }
+            print(g_line);
+        }
+    }
+}
+
+/*
+ * Upper edge of the bin holding the sample of the nearest rank to percent, or
+ * the maximum for the last bin, which has no upper edge.
+ */
+static uint64_t hist_percentile(const histogram_t * hist, uint32_t percent)
+{
+    uint32_t rank = ((hist->count * percent) + 99u) / 100u;
+    uint32_t seen = 0u;
+    uint32_t bin = 0u;
+    uint64_t value = hist->max;
+
+    while ((bin < (BENCH_BINS - 1u)) && (seen < rank))
+    {
+        seen += hist->bin[bin];
+        if (seen >= rank)
+        {
+            value = ((uint64_t)(bin + 1u) * BENCH_BIN_CYCLES) - 1u;
+        }
+        bin++;
+    }
+
+    return ((value < hist->max) ? value : hist->max);
+}
+
+/*
+ * Report lines of the handler and task latencies of a run. The percentiles are
+ * taken from the histograms, so are rounded up to the bins.
+ */
+static void report_results(bench_path_t path, bench_load_t load, uint32_t lost)
+{
+    const histogram_t * hists[2] = { &g_handler_hist, &g_task_hist };
+    const char * names[2] = { "handler", "task" };
+    bench_record_t record;
+    char variant[48];
+    uint32_t idx;
+
+    (void)snprintf(variant, sizeof(variant), "%s load %s",
+                   g_path_names[path], g_load_names[load]);
+
+    for (idx = 0u; idx < 2u; idx++)
+    {
+        bench_record_init(&record, "gpio_irq", names[idx], variant);
+        record.errors = lost;
+        if (0u != hists[idx]->count)
+        {
+            record.samples = hists[idx]->count;
+            record.min = hists[idx]->min;
+            record.mean = hists[idx]->sum / hists[idx]->count;
+            record.p50 = hist_percentile(hists[idx], 50u);
+            record.p99 = hist_percentile(hists[idx], 99u);
+            record.max = hists[idx]->max;
+            record.lat_unit = "cycles";
+        }
+        bench_report_result(&g_report, &record);
+    }
+}
+
+static void print(const char * text)
+{
+    MSS_UART_polled_tx_string(&g_mss_uart1_lo, (const uint8_t *)text);
+}
+
+/* Interrupt handlers, each reads mcycle first */
+
+uint8_t gpio1_bit16_or_gpio2_bit30_plic_30_IRQHandler(void)
+{
+    uint64_t cycle = readmcycle();
+
+    MSS_GPIO_clear_irq(GPIO2_LO, INPUT_GPIO_PIN);
+    handler_taken(PATH_GPIO_PLIC, cycle);
+    return EXT_IRQ_KEEP_ENABLED;
+}
+
+uint8_t fabric_f2h_0_plic_IRQHandler(void)
+{
+    uint64_t cycle = readmcycle();
+
+    handler_taken(PATH_F2H_PLIC, cycle);
+    return EXT_IRQ_KEEP_ENABLED;
+}
+
+void fabric_f2h_0_u54_local_IRQHandler_16(void)
+{
+    uint64_t cycle = readmcycle();
+
+    handler_taken(PATH_F2H_LOCAL, cycle);
+}
+
+void SysTick_Handler_h1_IRQHandler(void)
+{
+    ++g_ticks;
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Application code running on U54_2
+ *
+ * Memory load of the GPIO loopback interrupt latency benchmark
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+#include "inc/latency_bench.h"
+
+volatile uint32_t count_sw_ints_h2 = 0U;
+
+volatile uint32_t g_mem_load_run = 0U;
+volatile uint64_t g_mem_load_lines = 0U;
+
+#ifndef BENCH_MEM_LOAD_ADDR
+static uint8_t g_mem_load_buffer[BENCH_MEM_LOAD_BYTES]
+                               __attribute__((aligned(BENCH_LINE_BYTES)));
+#define BENCH_MEM_LOAD_ADDR     ((uintptr_t)g_mem_load_buffer)
+#endif
+
+
+/* Main function for the hart2(U54_2 processor).
+ * Application code running on hart2 is placed here
+ */
+
+void u54_2(void)
+{
+    uint64_t hartid = read_csr(mhartid);
+    volatile uint64_t * p_line;
+    uint64_t offset;
+    uint64_t seed = 0U;
+
+    /* Clear pending software interrupt in case there was any.
+       Enable only the software interrupt so that the E51 core can bring this
+       core out of WFI by raising a software interrupt. */
+
+    clear_soft_interrupt();
+    set_csr(mie, MIP_MSIP);
+
+    /* Put this hart in WFI */
+
+    do
+    {
+        __asm("wfi");
+    }while(0 == (read_csr(mip) & MIP_MSIP));
+
+    /* The hart is out of WFI, clear the SW interrupt. Here onwards application
+     * can enable and use any interrupts as required */
+
+    clear_soft_interrupt();
+
+    __enable_irq();
+
+    /*
+     * While U54_1 asks for it, write each cache line of the buffer and read
+     * it back, so the L2 and the memory behind it are kept busy
+     */
+    while (1U)
+    {
+        if (0U != g_mem_load_run)
+        {
+            for (offset = 0U; offset < BENCH_MEM_LOAD_BYTES;
+                 offset += BENCH_LINE_BYTES)
+            {
+                p_line = (volatile uint64_t *)(BENCH_MEM_LOAD_ADDR + offset);
+                *p_line = seed + offset;
+                seed += *p_line;
+            }
+
+            g_mem_load_lines += BENCH_MEM_LOAD_BYTES / BENCH_LINE_BYTES;
+        }
+    }
+
+    /* never return */
+}
+
+/* hart2 Software interrupt handler */
+
+void Software_h2_IRQHandler(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    count_sw_ints_h2++;
+}
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * GPIO loopback interrupt latency benchmark, shared definitions.
+ * See README.md.
+ *
+ */
+
+#ifndef LATENCY_BENCH_H_
+#define LATENCY_BENCH_H_
+
+#include <stdint.h>
+
+/* Interrupts taken per path and load */
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES               10000u
+#endif
+
+/* Histogram bins of BENCH_BIN_CYCLES each, the last bin holds the overflow */
+#ifndef BENCH_BINS
+#define BENCH_BINS                  32u
+#endif
+#ifndef BENCH_BIN_CYCLES
+#define BENCH_BIN_CYCLES            32u
+#endif
+
+/*
+ * 1 for the task to wait for the handler in wfi, so the task latency includes
+ * the wake up, 0 for it to spin on the flag the handler sets
+ */
+#ifndef BENCH_TASK_WFI
+#define BENCH_TASK_WFI              1
+#endif
+
+/* Most cycles waited for an interrupt before the sample is counted lost */
+#define BENCH_TIMEOUT_CYCLES        1000000u
+
+/*
+ * PDMA load, 0 to 4 channels each copying BENCH_DMA_BYTES over and over in
+ * repeat mode. The buffers are in .bss unless BENCH_DMA_SRC and BENCH_DMA_DST
+ * are defined, e.g. as non-cached DDR addresses with a DDR build.
+ */
+#ifndef BENCH_DMA_CHANNELS
+#define BENCH_DMA_CHANNELS          4u
+#endif
+#ifndef BENCH_DMA_BYTES
+#define BENCH_DMA_BYTES             4096u
+#endif
+
+/*
+ * Memory load, U54_2 writes and reads back BENCH_MEM_LOAD_BYTES in cache line
+ * steps over and over. The buffer is in .bss unless BENCH_MEM_LOAD_ADDR is
+ * defined, e.g. as a cached DDR address larger than the L2 with a DDR build.
+ */
+#ifndef BENCH_MEM_LOAD_BYTES
+#define BENCH_MEM_LOAD_BYTES        0x10000u
+#endif
+
+#define BENCH_LINE_BYTES            64u
+
+/*
+ * Background load of a run
+ */
+typedef enum
+{
+    BENCH_LOAD_NONE = 0,
+    BENCH_LOAD_DMA,
+    BENCH_LOAD_MEM,
+    BENCH_LOAD_DMA_MEM,
+    BENCH_NUM_LOADS
+} bench_load_t;
+
+/*
+ * Set by U54_1 to start and stop the memory load on U54_2
+ */
+extern volatile uint32_t g_mem_load_run;
+
+/* Cache lines U54_2 has walked, to show the load is running */
+extern volatile uint64_t g_mem_load_lines;
+
+#endif /* LATENCY_BENCH_H_ */
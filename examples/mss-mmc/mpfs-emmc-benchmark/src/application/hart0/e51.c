@@ -0,0 +1,526 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Application code running on E51
+ *
+ * eMMC transfer mode benchmark. See README.txt.
+ *
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+
+#include "drivers/mss_mmuart/mss_uart.h"
+#include "drivers/mss_mmc/mss_mmc.h"
+#include "drivers/mss_mmc/mss_mmc_internal_api.h"
+#include "bench_report.h"
+
+/* First sector of the test area, and its size in sectors (64MB) */
+#define BENCH_SECTOR_BASE           0x00100000u
+#define BENCH_SECTOR_SPAN           0x00020000u
+/* Operations measured for each test point */
+#define BENCH_ITERATIONS            32u
+/* Largest transfer, the buffers are in LIM */
+#define BENCH_MAX_SIZE              65536u
+/* Size of each entry of a packed command */
+#define BENCH_PACKED_ENTRY_SIZE     4096u
+#define BENCH_CQ_MAX_DEPTH          16u
+/* mtime ticks per second */
+#define BENCH_MTIME_HZ              LIBERO_SETTING_MSS_RTC_TOGGLE_CLK
+
+#define BLK_SIZE                    512u
+#define PACKED_HDR_VERSION          0x01u
+#define PACKED_HDR_READ             0x01u
+#define PACKED_HDR_WRITE            0x02u
+#define PACKED_HDR_ENTRY_SIZE       8u
+
+#define DIR_READ                    0u
+#define DIR_WRITE                   1u
+
+typedef enum
+{
+    BENCH_SINGLE,
+    BENCH_SDMA,
+    BENCH_ADMA2,
+    BENCH_PACKED,
+    BENCH_CQ
+} bench_mode_t;
+
+typedef struct
+{
+    const char *name;
+    uint8_t bus_speed_mode;
+    uint32_t clk_rate;
+    /* HS200 and HS400 are only defined for 1.8V signalling */
+    uint8_t bus_voltage;
+} bench_bus_t;
+
+static const bench_bus_t g_bus_modes[] =
+{
+    {"LEGACY", MSS_MMC_MODE_LEGACY, MSS_MMC_CLOCK_25MHZ,  MSS_MMC_3_3V_BUS_VOLTAGE},
+    {"SDR",    MSS_MMC_MODE_SDR,    MSS_MMC_CLOCK_50MHZ,  MSS_MMC_3_3V_BUS_VOLTAGE},
+    {"DDR",    MSS_MMC_MODE_DDR,    MSS_MMC_CLOCK_50MHZ,  MSS_MMC_3_3V_BUS_VOLTAGE},
+    {"HS200",  MSS_MMC_MODE_HS200,  MSS_MMC_CLOCK_200MHZ, MSS_MMC_1_8V_BUS_VOLTAGE},
+    {"HS400",  MSS_MMC_MODE_HS400,  MSS_MMC_CLOCK_200MHZ, MSS_MMC_1_8V_BUS_VOLTAGE},
+};
+
+static const char * const g_mode_names[] =
+{
+    "single", "SDMA", "ADMA2", "packed", "CQ"
+};
+
+/* Writes first, so that the reads return written data */
+static const uint8_t g_dirs[] = {DIR_WRITE, DIR_READ};
+static const uint32_t g_sizes[] = {512u, 4096u, 16384u, 65536u};
+static const uint32_t g_packed_depths[] = {2u, 4u, 8u};
+static const uint32_t g_cq_depths[] = {1u, 2u, 4u, 8u, 16u};
+
+/* The write buffer has room for the packed command header in front */
+static uint8_t g_mmc_tx_buff[BLK_SIZE + BENCH_MAX_SIZE] __attribute__ ((aligned (64)));
+static uint8_t g_mmc_rx_buff[BENCH_MAX_SIZE] __attribute__ ((aligned (64)));
+static uint32_t g_packed_read_hdr[BLK_SIZE / 4u];
+
+static uint64_t g_latency[BENCH_ITERATIONS * BENCH_CQ_MAX_DEPTH];
+static volatile uint32_t g_latency_count;
+static volatile uint32_t g_cq_done;
+static volatile uint32_t g_cq_errors;
+static uint64_t g_cq_start;
+static uint32_t g_seed = 0x12345678u;
+static bench_report_t g_report;
+static const char *g_bus_name = "";
+
+/* Settings given on the config lines of the report */
+static const bench_config_t g_bench_config[] =
+{
+    BENCH_CONFIG(BENCH_ITERATIONS),
+    BENCH_CONFIG(BENCH_SECTOR_BASE),
+    BENCH_CONFIG(BENCH_PACKED_ENTRY_SIZE)
+};
+
+static void bench_printf(const char *fmt, ...);
+static uint32_t bench_sector(uint32_t blocks);
+static mss_mmc_status_t bench_wait(mss_mmc_status_t status);
+static void bench_point(bench_mode_t mode, uint8_t dir, uint32_t size,
+                        uint32_t depth);
+static mss_mmc_status_t bench_packed(uint8_t dir, uint32_t depth);
+static mss_mmc_status_t bench_cq(uint8_t dir, uint32_t size, uint32_t depth);
+static void bench_report(bench_mode_t mode, uint8_t dir, uint32_t size,
+                         uint32_t depth, uint64_t bytes, uint64_t elapsed);
+static void bench_report_failed(bench_mode_t mode, uint8_t dir, uint32_t size,
+                                uint32_t depth);
+static void bench_cq_handler(uint8_t task_id, mss_mmc_status_t status,
+                             void *p_user_data);
+
+/* Main function for the hart0(E51 processor).
+ * Application code running on hart0 is placed here.
+ */
+void e51(void)
+{
+    mss_mmc_cfg_t g_mmc;
+    mss_mmc_status_t ret_status;
+    uint32_t loop_count;
+    uint32_t bus;
+    uint32_t idx;
+    uint32_t depth;
+    uint8_t dir;
+
+    SYSREG->SUBBLK_CLOCK_CR = 0xffffffff;        /* all clocks on */
+    SYSREG->SOFT_RESET_CR &= ~( (1u << 0u) | (1u << 3u) | (1u << 4u) | (1u << 5u)
+                                    | (1u << 19u) | (1u << 23u) | (1u << 28u));
+
+    MSS_UART_init(&g_mss_uart0_lo,
+                  MSS_UART_115200_BAUD,
+                  MSS_UART_DATA_8_BITS | MSS_UART_NO_PARITY | MSS_UART_ONE_STOP_BIT);
+
+    for (loop_count = 0u; loop_count < sizeof(g_mmc_tx_buff); loop_count++)
+    {
+        g_mmc_tx_buff[loop_count] = 0x45u + loop_count;
+    }
+
+    PLIC_init();
+    __enable_irq();
+    PLIC_SetPriority(MMC_main_PLIC, 2u);
+    PLIC_SetPriority(MMC_wakeup_PLIC, 2u);
+    /* DMA init for eMMC */
+    loop_count = MSS_MPU_configure(MSS_MPU_MMC,
+                                   MSS_MPU_PMP_REGION3,
+                                   0x08000000u,
+                                   0x200000u,
+                                   MPU_MODE_READ_ACCESS|MPU_MODE_WRITE_ACCESS|MPU_MODE_EXEC_ACCESS,
+                                   MSS_MPU_AM_NAPOT,
+                                   0u);
+
+    bench_printf("\r\neMMC benchmark, %u iterations per point\r\n",
+                 BENCH_ITERATIONS);
+    bench_report_begin(&g_report, &g_mss_uart0_lo, NULL, "mpfs-emmc-benchmark",
+                       g_bench_config,
+                       sizeof(g_bench_config) / sizeof(g_bench_config[0]));
+
+    for (bus = 0u; bus < (sizeof(g_bus_modes) / sizeof(g_bus_modes[0])); bus++)
+    {
+        g_mmc.clk_rate = g_bus_modes[bus].clk_rate;
+        g_mmc.card_type = MSS_MMC_CARD_TYPE_MMC;
+        g_mmc.bus_speed_mode = g_bus_modes[bus].bus_speed_mode;
+        g_mmc.data_bus_width = MSS_MMC_DATA_WIDTH_8BIT;
+        g_mmc.bus_voltage = g_bus_modes[bus].bus_voltage;
+
+        ret_status = MSS_MMC_init(&g_mmc);
+        if (ret_status != MSS_MMC_INIT_SUCCESS)
+        {
+            bench_printf("\r\n%s: not supported (%u)\r\n",
+                         g_bus_modes[bus].name, (uint32_t)ret_status);
+            continue;
+        }
+
+        bench_printf("\r\n%s %u kHz\r\n", g_bus_modes[bus].name,
+                     g_bus_modes[bus].clk_rate);
+        g_bus_name = g_bus_modes[bus].name;
+        bench_printf("mode   dir     size depth     KB/s    IOPS   p50   p95   p99   max (us)\r\n");
+
+        for (dir = 0u; dir < sizeof(g_dirs); dir++)
+        {
+            bench_point(BENCH_SINGLE, g_dirs[dir], BLK_SIZE, 1u);
+
+            for (idx = 0u; idx < (sizeof(g_sizes) / sizeof(g_sizes[0])); idx++)
+            {
+                bench_point(BENCH_SDMA, g_dirs[dir], g_sizes[idx], 1u);
+            }
+            for (idx = 0u; idx < (sizeof(g_sizes) / sizeof(g_sizes[0])); idx++)
+            {
+                bench_point(BENCH_ADMA2, g_dirs[dir], g_sizes[idx], 1u);
+            }
+            for (idx = 0u; idx < (sizeof(g_packed_depths) / sizeof(g_packed_depths[0])); idx++)
+            {
+                bench_point(BENCH_PACKED, g_dirs[dir], BENCH_PACKED_ENTRY_SIZE,
+                            g_packed_depths[idx]);
+            }
+        }
+
+        /* Command queue last, the next MSS_MMC_init() turns it off */
+        ret_status = MSS_MMC_cq_init();
+        if (ret_status != MSS_MMC_TRANSFER_SUCCESS)
+        {
+            bench_printf("CQ: not supported (%u)\r\n", (uint32_t)ret_status);
+            continue;
+        }
+
+        for (dir = 0u; dir < sizeof(g_dirs); dir++)
+        {
+            for (idx = 0u; idx < (sizeof(g_sizes) / sizeof(g_sizes[0])); idx++)
+            {
+                for (depth = 0u; depth < (sizeof(g_cq_depths) / sizeof(g_cq_depths[0])); depth++)
+                {
+                    if ((g_sizes[idx] * g_cq_depths[depth]) <= BENCH_MAX_SIZE)
+                    {
+                        bench_point(BENCH_CQ, g_dirs[dir], g_sizes[idx], g_cq_depths[depth]);
+                    }
+                }
+            }
+        }
+    }
+
+    bench_report_end(&g_report);
+    bench_printf("\r\nbenchmark complete\r\n");
+
+    while(1);
+}
+/******************************************************************************/
+static void bench_printf(const char *fmt, ...)
+{
+    char line[128];
+    va_list args;
+
+    va_start(args, fmt);
+    (void)vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+
+    MSS_UART_polled_tx_string(&g_mss_uart0_lo, (const uint8_t *)line);
+}
+/******************************************************************************/
+/* Pseudo-random sector in the test area, aligned to the transfer size */
+static uint32_t bench_sector(uint32_t blocks)
+{
+    g_seed = (g_seed * 1103515245u) + 12345u;
+
+    return BENCH_SECTOR_BASE + (((g_seed >> 8u) % (BENCH_SECTOR_SPAN / blocks)) * blocks);
+}
+/******************************************************************************/
+static mss_mmc_status_t bench_wait(mss_mmc_status_t status)
+{
+    if (status == MSS_MMC_TRANSFER_IN_PROGRESS)
+    {
+        do
+        {
+            status = MSS_MMC_get_transfer_status();
+        }while (status == MSS_MMC_TRANSFER_IN_PROGRESS);
+    }
+
+    return status;
+}
+/******************************************************************************/
+/* Measures BENCH_ITERATIONS operations of one mode, direction, size and depth */
+static void bench_point(bench_mode_t mode, uint8_t dir, uint32_t size,
+                        uint32_t depth)
+{
+    mss_mmc_status_t status = MSS_MMC_TRANSFER_SUCCESS;
+    uint32_t iter;
+    uint32_t sector;
+    uint64_t t0;
+    uint64_t start;
+
+    g_latency_count = 0u;
+    start = readmtime();
+
+    for (iter = 0u; (iter < BENCH_ITERATIONS) && (status == MSS_MMC_TRANSFER_SUCCESS); iter++)
+    {
+        sector = bench_sector(size / BLK_SIZE);
+        t0 = readmtime();
+
+        switch (mode)
+        {
+            case BENCH_SINGLE:
+                if (dir == DIR_WRITE)
+                {
+                    status = MSS_MMC_single_block_write((const uint32_t *)g_mmc_tx_buff, sector);
+                }
+                else
+                {
+                    status = MSS_MMC_single_block_read(sector, (uint32_t *)g_mmc_rx_buff);
+                }
+                break;
+
+            case BENCH_SDMA:
+                if (dir == DIR_WRITE)
+                {
+                    status = MSS_MMC_sdma_write(g_mmc_tx_buff, sector, size);
+                }
+                else
+                {
+                    status = MSS_MMC_sdma_read(sector, g_mmc_rx_buff, size);
+                }
+                status = bench_wait(status);
+                break;
+
+            case BENCH_ADMA2:
+                if (dir == DIR_WRITE)
+                {
+                    status = MSS_MMC_adma2_write(g_mmc_tx_buff, sector, size);
+                }
+                else
+                {
+                    status = MSS_MMC_adma2_read(sector, g_mmc_rx_buff, size);
+                }
+                status = bench_wait(status);
+                break;
+
+            case BENCH_PACKED:
+                status = bench_packed(dir, depth);
+                break;
+
+            case BENCH_CQ:
+                status = bench_cq(dir, size, depth);
+                break;
+
+            default:
+                status = MSS_MMC_INVALID_PARAMETER;
+                break;
+        }
+
+        /* The command queue handler times each task itself */
+        if (mode != BENCH_CQ)
+        {
+            g_latency[g_latency_count] = readmtime() - t0;
+            g_latency_count++;
+        }
+    }
+
+    if (status != MSS_MMC_TRANSFER_SUCCESS)
+    {
+        bench_printf("%-6s %-5s %6u %5u failed (%u)\r\n", g_mode_names[mode],
+                     (dir == DIR_WRITE) ? "write" : "read", size, depth,
+                     (uint32_t)status);
+        bench_report_failed(mode, dir, size, depth);
+    }
+    else
+    {
+        bench_report(mode, dir, size, depth,
+                     (uint64_t)BENCH_ITERATIONS * size * depth,
+                     readmtime() - start);
+    }
+}
+/******************************************************************************/
+/* One packed command of depth entries at unrelated sectors */
+static mss_mmc_status_t bench_packed(uint8_t dir, uint32_t depth)
+{
+    uint8_t *hdr = (dir == DIR_WRITE) ? g_mmc_tx_buff : (uint8_t *)g_packed_read_hdr;
+    uint32_t blocks = BENCH_PACKED_ENTRY_SIZE / BLK_SIZE;
+    uint32_t first_sector = 0u;
+    uint32_t sector;
+    uint32_t entry;
+    uint8_t *p;
+    mss_mmc_status_t status;
+
+    (void)memset(hdr, 0, BLK_SIZE);
+    hdr[0] = PACKED_HDR_VERSION;
+    hdr[1] = (dir == DIR_WRITE) ? PACKED_HDR_WRITE : PACKED_HDR_READ;
+    hdr[2] = (uint8_t)depth;
+
+    for (entry = 0u; entry < depth; entry++)
+    {
+        sector = bench_sector(blocks);
+        if (entry == 0u)
+        {
+            first_sector = sector;
+        }
+        p = &hdr[(entry + 1u) * PACKED_HDR_ENTRY_SIZE];
+        /* CMD23 argument, block count */
+        p[0] = (uint8_t)blocks;
+        p[1] = (uint8_t)(blocks >> 8u);
+        /* CMD25/CMD18 argument, sector */
+        p[4] = (uint8_t)sector;
+        p[5] = (uint8_t)(sector >> 8u);
+        p[6] = (uint8_t)(sector >> 16u);
+        p[7] = (uint8_t)(sector >> 24u);
+    }
+
+    if (dir == DIR_WRITE)
+    {
+        status = MSS_MMC_packed_write(g_mmc_tx_buff, first_sector,
+                                      BLK_SIZE + (depth * BENCH_PACKED_ENTRY_SIZE));
+    }
+    else
+    {
+        status = MSS_MMC_packed_read(first_sector, g_mmc_rx_buff, g_packed_read_hdr,
+                                     depth * BENCH_PACKED_ENTRY_SIZE);
+    }
+
+    return bench_wait(status);
+}
+/******************************************************************************/
+/* depth command queue tasks started with one doorbell write */
+static mss_mmc_status_t bench_cq(uint8_t dir, uint32_t size, uint32_t depth)
+{
+    uint8_t *buffer = (dir == DIR_WRITE) ? &g_mmc_tx_buff[BLK_SIZE] : g_mmc_rx_buff;
+    uint32_t task;
+    mss_mmc_status_t status = MSS_MMC_TRANSFER_SUCCESS;
+
+    g_cq_done = 0u;
+    g_cq_errors = 0u;
+
+    for (task = 0u; (task < depth) && (status == MSS_MMC_TRANSFER_SUCCESS); task++)
+    {
+        status = MSS_MMC_cq_submit((dir == DIR_WRITE) ? MSS_MMC_CQ_DIR_WRITE : MSS_MMC_CQ_DIR_READ,
+                                   bench_sector(size / BLK_SIZE),
+                                   &buffer[task * size], size,
+                                   bench_cq_handler, NULL, NULL);
+        if (status == MSS_MMC_TRANSFER_IN_PROGRESS)
+        {
+            status = MSS_MMC_TRANSFER_SUCCESS;
+        }
+    }
+
+    if (status == MSS_MMC_TRANSFER_SUCCESS)
+    {
+        g_cq_start = readmtime();
+        MSS_MMC_cq_ring_doorbell();
+
+        while (g_cq_done < depth)
+        {
+            ;
+        }
+
+        if (g_cq_errors != 0u)
+        {
+            status = MSS_MMC_TRANSFER_FAIL;
+        }
+    }
+
+    return status;
+}
+/******************************************************************************/
+static void bench_cq_handler(uint8_t task_id, mss_mmc_status_t status,
+                             void *p_user_data)
+{
+    (void)task_id;
+    (void)p_user_data;
+
+    if (g_latency_count < (sizeof(g_latency) / sizeof(g_latency[0])))
+    {
+        g_latency[g_latency_count] = readmtime() - g_cq_start;
+        g_latency_count++;
+    }
+    if (status != MSS_MMC_TRANSFER_SUCCESS)
+    {
+        g_cq_errors++;
+    }
+    g_cq_done++;
+}
+/******************************************************************************/
+static uint32_t ticks_to_us(uint64_t ticks)
+{
+    return (uint32_t)((ticks * 1000000u) / BENCH_MTIME_HZ);
+}
+/******************************************************************************/
+static void bench_report(bench_mode_t mode, uint8_t dir, uint32_t size,
+                         uint32_t depth, uint64_t bytes, uint64_t elapsed)
+{
+    uint32_t count = g_latency_count;
+    char test[16];
+    bench_record_t record;
+    uint64_t kbps;
+    uint64_t iops;
+
+    /* Sorts the samples */
+    (void)snprintf(test, sizeof(test), "%s_%s", g_mode_names[mode],
+                   (dir == DIR_WRITE) ? "write" : "read");
+    bench_record_init(&record, "mmc", test, g_bus_name);
+    bench_record_samples(&record, g_latency, count);
+
+    if (elapsed == 0u)
+    {
+        elapsed = 1u;
+    }
+    kbps = (bytes * BENCH_MTIME_HZ) / (elapsed * 1024u);
+    iops = ((uint64_t)count * BENCH_MTIME_HZ) / elapsed;
+
+    bench_printf("%-6s %-5s %6u %5u %8u %7u %5u %5u %5u %5u\r\n",
+                 g_mode_names[mode], (dir == DIR_WRITE) ? "write" : "read",
+                 size, depth, (uint32_t)kbps, (uint32_t)iops,
+                 ticks_to_us(g_latency[(count * 50u) / 100u]),
+                 ticks_to_us(g_latency[(count * 95u) / 100u]),
+                 ticks_to_us(g_latency[(count * 99u) / 100u]),
+                 ticks_to_us(g_latency[count - 1u]));
+
+    record.size = size;
+    record.depth = depth;
+    record.rate = kbps;
+    record.rate_unit = "KB/s";
+    record.min = ticks_to_us(record.min);
+    record.mean = ticks_to_us(record.mean);
+    record.p50 = ticks_to_us(record.p50);
+    record.p99 = ticks_to_us(record.p99);
+    record.max = ticks_to_us(record.max);
+    record.lat_unit = "us";
+    bench_report_result(&g_report, &record);
+}
+/******************************************************************************/
+static void bench_report_failed(bench_mode_t mode, uint8_t dir, uint32_t size,
+                                uint32_t depth)
+{
+    char test[16];
+    bench_record_t record;
+
+    (void)snprintf(test, sizeof(test), "%s_%s", g_mode_names[mode],
+                   (dir == DIR_WRITE) ? "write" : "read");
+    bench_record_init(&record, "mmc", test, g_bus_name);
+    record.size = size;
+    record.depth = depth;
+    record.samples = g_latency_count;
+    record.errors = 1u;
+    bench_report_result(&g_report, &record);
+}
+/******************************************************************************/
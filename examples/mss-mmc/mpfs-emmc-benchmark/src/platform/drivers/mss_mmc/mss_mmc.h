@@ -0,0 +1,1662 @@
+/*******************************************************************************
+ * Copyright 2019-2020 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * PolarFire SoC MSS eMMC SD bare metal software driver public API.
+ *
+ */
+/*=========================================================================*//**
+  @mainpage PolarFire SoC MSS eMMC SD Bare Metal Driver
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The PolarFire SoC MSS includes an SD host controller and an eMMC/SD PHY.
+  The SD Host Controller can support multiple eMMC/SD standards with bus
+  widths of 1 bit, 4 bits, and 8 bits at clock rates up to 200 MHz.
+
+  The PolarFire SoC MSS eMMC SD software driver, provided as C source code,
+  supports a set of functions for controlling eMMC/SD as part of a bare-metal
+  system where no operating system is available. The driver can be adapted for
+  use as part of an operating system, but the implementation of the adaptation 
+  layer between the driver and the operating system's driver model is outside
+  the scope of the driver.
+    
+  The PolarFire SoC MSS eMMC SD driver provides the following features:
+    - Configuring the eMMC/SD/SDIO
+    - Single block read and write without DMA.
+    - Multiple or single block read and write with DMA (SDMA, ADMA2).
+    - eMMC command queue block read and write.
+    - eMMC standards LEGACY, SDR, DDR, HS200, HS400 and HS400-ES
+    - SD card standards Default Speed(DS), High Speed(HS), UHS-I(SDR12, SDR25,
+      SDR50, SDR104, DDR50).
+    - Single block read and write operation for SDIO.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  The PolarFire SoC MSS eMMC SD driver functions allow 512-byte blocks of data
+  to be written to and read from a eMMC/SD device connected to the host 
+  controller. The blocks can be read/written singly or using the multi block
+  functions. 
+  There are two variants of the single block functions. One set are blocking,
+  the other are non-blocking. The multi block functions are non-blocking.
+  
+  Note: The eMMC/SD device connected to the eMMC/SD host hardware must support
+  a sector size of 512-bytes. This is the default block size for the 
+  eMMC/SD device > 2GB.
+
+  The PolarFire SoC MSS eMMC SD driver functions are grouped into the following
+  categories:
+    - Initialization
+    - Block Transfer Control
+    - Block Transfer Status
+    - Interrupt Handling
+    - Command Queue
+
+  --------------------------------
+  Initialization
+  --------------------------------
+  The initialization of the MSS eMMC SD driver involves the following steps:
+    - Initialize the mss_mmc_cfg_t data structure.
+    - Call the MSS_MMC_init() function.
+
+  The configuration data structure mss_mmc_cfg_t should set eMMC/SD/SDIO
+  clock frequency, data width, card type and speed before calling the 
+  MSS_MMC_init() function.
+  
+  The MSS_MMC_init() function takes a pointer to the configuration data
+  structure of type mss_mmc_cfg_t.
+
+  Tuning Cache
+
+  MSS_MMC_init() trains the PHY input delay for the selected bus mode and, for
+  HS200 and HS400, sweeps the eMMC tuning value with CMD21. Both searches
+  issue many read commands and add to the boot time. The application can hand
+  the driver a record of type mss_mmc_tuning_t, loaded from non-volatile
+  storage such as the eNVM, by calling MSS_MMC_set_tuning_cache() before
+  MSS_MMC_init(). When the record was saved for the same device, identified by
+  its CID, and for the same clock rate, bus width and bus speed mode, the
+  driver applies the saved values and checks them with a single read. A full
+  search is only made for a value which is missing or which fails the check,
+  for example with a CRC error. Whenever a full search was made, the driver
+  calls the save handler at the end of a successful MSS_MMC_init() so that
+  the application can store the updated record.
+
+  --------------------------------
+  Block Transfer Control 
+  --------------------------------
+  The following functions are used for block read and write:
+    - MSS_MMC_single_block_read()
+    - MSS_MMC_single_block_write()
+    - MSS_MMC_sdma_read()
+    - MSS_MMC_sdma_write()
+    - MSS_MMC_adma2_read()
+    - MSS_MMC_adma2_write()
+    - MSS_MMC_sdio_single_block_read()
+    - MSS_MMC_sdio_single_block_write()
+  
+  Write Transfer
+
+  To write a single block of data to the eMMC/SD device, a call is made to the
+  MSS_MMC_single_block_write() function.
+
+  To write a single block or multiple blocks of data to the eMMC/SD device,
+  using DMA, a call is made to the MSS_MMC_sdma_write() or MSS_MMC_adma2_write()
+  functions.
+
+  To write a single block of data to the SDIO device, a call is made to the
+  MSS_MMC_sdio_single_block_write() function.
+
+  Read Transfer
+
+  To read a single block of data stored within the eMMC/SD device, a call is
+  made to the MSS_MMC_single_block_read() function.
+
+  To read a single block or multiple blocks of data stored within the eMMC/SD
+  device, using DMA, a call is made to the MSS_MMC_sdma_read() or 
+  MSS_MMC_adma2_read() functions. 
+
+  To read a single block of data stored within the SDIO device, a call is made
+  to the MSS_MMC_sdio_single_block_read() function.
+
+  Scatter-Gather Transfer
+
+  The MSS_MMC_adma2_write_sg() and MSS_MMC_adma2_read_sg() functions take a
+  list of memory segments, of type mss_mmc_sg_t, instead of one buffer. One
+  ADMA2 descriptor chain is built for the whole list, so a single multi-block
+  transfer reads into or writes from buffers which are not contiguous in
+  memory, without a bounce copy. Only the total size of the segments must be a
+  multiple of 512 bytes.
+
+  Cache Maintenance
+
+  By default the DMA transfer functions do no cache maintenance, so DMA
+  buffers are expected to be in non-cached memory. If MSS_MMC_CACHE_MAINTENANCE
+  is defined, the SDMA and ADMA2 transfer functions flush the buffer, and the
+  ADMA2 descriptor table, from the L2 cache before the transfer is started.
+  This allows buffers to be placed in cached DDR. The buffer must not be
+  accessed by the CPU until the transfer has completed.
+
+  --------------------------------
+  Block Transfer Status
+  --------------------------------
+  The status of the eMMC SD block read or write transfer can be retrieved 
+  using the MSS_MMC_get_transfer_status() function.
+
+  --------------------------------
+  Interrupt Handling
+  --------------------------------
+  The MSS_MMC_set_handler() function is used to register a handler function
+  that will be called by the driver when a block transfer completes. The
+  driver passes the outcome of the transfer to the completion handler in
+  the form of a status parameter indicating if the transfer was successful
+  or the type of error that occurred during the transfer. The application
+  must create and register a transfer completion handler function to suit
+  the application.
+
+  --------------------------------
+  Command Queue
+  --------------------------------
+  The following functions are used for eMMC command queue operation:
+    - MSS_MMC_cq_init()
+    - MSS_MMC_cq_write()
+    - MSS_MMC_cq_read()
+
+  The MSS_MMC_cq_init() function initializes command queue in the eMMC device
+  and the host controller.
+
+  To write a single block or multiple blocks of data to the eMMC device using
+  a command queue, a call is made to the MSS_MMC_cq_write() function. This
+  function supports up to 32 tasks.
+
+  To read a single block or multiple blocks of data stored within the eMMC
+  device using a command queue, a call is made to the MSS_MMC_cq_read()
+  function. This function supports up to 32 tasks.
+
+  The MSS_MMC_cq_write() and MSS_MMC_cq_read() functions queue the tasks for
+  one transfer and wait for all of them before the next transfer can start.
+  For many small independent transfers, such as random reads, the following
+  functions keep up to MSS_MMC_CQ_MAX_TASKS tasks queued in the device at the
+  same time:
+    - MSS_MMC_cq_submit()
+    - MSS_MMC_cq_ring_doorbell()
+
+  MSS_MMC_cq_submit() takes a free task slot, fills in its task descriptor and
+  returns the slot number. The task is not started until
+  MSS_MMC_cq_ring_doorbell() is called, so a batch of tasks can be started
+  with one doorbell write. The device may complete the tasks in any order.
+  Each task's handler is called from the eMMC SD interrupt when the task
+  completes, and the slot is free again once the handler is called.
+  MSS_MMC_cq_write() and MSS_MMC_cq_read() are refused while submitted tasks
+  are outstanding, and MSS_MMC_cq_submit() is refused while one of them is in
+  progress.
+
+  --------------------------------
+  Block Device
+  --------------------------------
+  The block device layer in mss_mmc_bdev.h queues read and write requests,
+  merges requests which continue each other and starts them back to back from
+  the eMMC SD interrupt. See mss_mmc_bdev.h for details.
+  
+ *//*=========================================================================*/
+#ifndef __MSS_MMC_H
+#define __MSS_MMC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+#endif
+
+/*----------------------------------------------------------------------------*/
+/* Clock rate*/
+#define MSS_MMC_CLOCK_400KHZ            400u
+#define MSS_MMC_CLOCK_12_5MHZ           12500u
+#define MSS_MMC_CLOCK_25MHZ             25000u
+#define MSS_MMC_CLOCK_26MHZ             26000u
+#define MSS_MMC_CLOCK_50MHZ             50000u
+#define MSS_MMC_CLOCK_100MHZ            100000u
+#define MSS_MMC_CLOCK_200MHZ            200000u
+/*  card type */
+#define MSS_MMC_CARD_TYPE_NONE          0u
+#define MSS_MMC_CARD_TYPE_MMC           1u
+#define MSS_MMC_CARD_TYPE_SD            2u
+#define MSS_MMC_CARD_TYPE_SDIO          3u
+#define MSS_MMC_CARD_TYPE_COMBO         4u
+
+/* Host controller eMMC mode select */
+
+/* High-speed single data rate supports clock frequency up to 52 MHz and data
+ * bus width of 1 bit, 4 bits, and 8 bits.
+ */
+#define MSS_MMC_MODE_SDR                0x2u
+
+/* High speed double data rate supports clock frequency up to 52 MHz and data
+ * bus width of 4 bits and 8 bits.
+ */
+#define MSS_MMC_MODE_DDR                0x3u
+
+/* SDR data sampling supports clock frequency up to 200 MHz and data bus width
+ *  of 4 bits and 8 bits.
+ */
+#define MSS_MMC_MODE_HS200              0x4u
+
+/* DDR data sampling supports clock frequency up to 200 MHz and data bus width
+ * of 8 bits.
+ */
+#define MSS_MMC_MODE_HS400              0x5u
+
+/* HS400 mode with Enhanced Strobe. */
+#define MSS_MMC_MODE_HS400_ES           0x6u
+
+/* Backwards compatibility with legacy MMC card supports clock frequency up to
+ * 26MHz and data bus width of 1 bit, 4 bits, and 8 bits.
+ */
+#define MSS_MMC_MODE_LEGACY             0x7u
+
+#define MSS_MMC_MODE_MASK               0x00000007u
+#define MSS_MMC_MODE_SDCARD             0x0u
+
+/* Host controller SD/SDIO card mode select */
+
+/* Default speed supports clock frequency up to 25 MHz and data bus width of
+ * 4 bits.
+ */
+#define MSS_SDCARD_MODE_DEFAULT_SPEED   0x8u
+
+/* High-speed supports clock frequency up to 50 MHz and data bus width of
+ * 4 bits.
+ */
+#define MSS_SDCARD_MODE_HIGH_SPEED      0x9u
+
+/* Ultra-High speed-I (UHS-I) single data rate supports clock frequency up to
+ * 25 MHz and data bus width of 4 bits.
+ */
+#define MSS_SDCARD_MODE_SDR12           0xAu
+
+/* Ultra-High speed-I (UHS-I) single data rate supports clock frequency up to
+ * 50 MHz and data bus width of 4 bits.
+ */
+#define MSS_SDCARD_MODE_SDR25           0xBu
+
+/* Ultra-High speed-I (UHS-I) single data rate supports clock frequency up to
+ * 100 MHz and data bus width of 4 bits.
+ */
+#define MSS_SDCARD_MODE_SDR50           0xCu
+
+/* Ultra-High speed-I (UHS-I) single data rate supports clock frequency up to
+ * 208 MHz and data bus width of 4 bits.
+ */
+#define MSS_SDCARD_MODE_SDR104          0xDu
+
+/* Ultra-High speed-I (UHS-I) double data rate supports clock frequency up to
+ * 50 MHz and data bus width of 4 bits.
+ */
+#define MSS_SDCARD_MODE_DDR50           0xEu
+
+/* Host controller data width */
+#define MSS_MMC_DATA_WIDTH_1BIT         0x00u
+#define MSS_MMC_DATA_WIDTH_4BIT         0x01u
+#define MSS_MMC_DATA_WIDTH_8BIT         0x02u
+
+/* eMMC bus voltage */
+/* 1.8v */
+#define MSS_MMC_1_8V_BUS_VOLTAGE     18u
+/* 3.3v */
+#define MSS_MMC_3_3V_BUS_VOLTAGE      33u
+
+#define MSS_SDIO_FUNCTION_NUMBER_0      0u
+#define MSS_SDIO_FUNCTION_NUMBER_1      1u
+#define MSS_SDIO_FUNCTION_NUMBER_2      2u
+#define MSS_SDIO_FUNCTION_NUMBER_3      3u
+#define MSS_SDIO_FUNCTION_NUMBER_4      4u
+#define MSS_SDIO_FUNCTION_NUMBER_5      5u
+#define MSS_SDIO_FUNCTION_NUMBER_6      6u
+#define MSS_SDIO_FUNCTION_NUMBER_7      7u
+
+/*-------------------------------------------------------------------------*//**
+The mss_mmc_status_t type is used to indicate the return status of the eMMC/SD
+data transfer. A variable of this type is returned by the MSS_MMC_init(),
+MSS_MMC_single_block_write(), MSS_MMC_single_block_read(), MSS_MMC_sdma_write(),
+MSS_MMC_sdma_read(), MSS_MMC_adma2_write(), MSS_MMC_adma2_read(),
+MSS_MMC_cq_init(), MSS_MMC_cq_write(), MSS_MMC_cq_read(),
+MSS_MMC_sdio_single_block_read(), MSS_MMC_sdio_single_block_write() functions.
+*/
+typedef enum
+{
+    MSS_MMC_INIT_SUCCESS = 0u,
+    MSS_MMC_INIT_FAILURE,
+    MSS_MMC_NOT_INITIALISED,
+    MSS_MMC_TRANSFER_IN_PROGRESS,
+    MSS_MMC_TRANSFER_FAIL,
+    MSS_MMC_TRANSFER_SUCCESS,
+    MSS_MMC_DWIDTH_ERR,
+    MSS_MMC_RCA_ERROR,
+    MSS_MMC_CID_RESP_ERR,
+    MSS_MMC_OP_COND_ERR,
+    MSS_MMC_RESET_ERR,
+    MSS_MMC_CRC_ERR,
+    MSS_MMC_UNSUPPORTED_HW_REVISION,
+    MSS_MMC_INVALID_PARAMETER,
+    MSS_MMC_NO_ERROR,
+    MSS_MMC_BASE_CLK_IS_ZERO_ERR,
+    MSS_MMC_CARD_STATE_STABLE_ERR,
+    MSS_MMC_CARD_INSERTED_ERR,
+    MSS_MMC_MODE_NOT_SUPPORT_DATAWIDTH,
+    MSS_MMC_CLK_DIV_ERR,
+    MSS_MMC_RESPONSE_ERROR,
+    MSS_MMC_ERR_INTERRUPT,
+    MSS_MMC_ERR_SWITCH_VOLTAGE_FAILED,
+    MSS_MMC_CARD_SELECT_ERROR,
+    MSS_MMC_CARD_SELECT_SUCCESS,
+    MSS_MMC_DEVICE_NOT_SUPPORT_HS400,
+    MSS_MMC_DEVICE_NOT_SUPPORT_HS200,
+    MSS_MMC_DEVICE_NOT_SUPPORT_DDR,
+    MSS_MMC_DEVICE_NOT_SUPPORT_SDR,
+    MSS_MMC_DEVICE_NOT_SUPPORT_LOW_POWER,
+    MSS_MMC_HS400_MODE_SETUP_FAILURE,
+    MSS_MMC_DEVICE_NOT_SUPPORT_CQ,
+    MSS_MMC_CQ_INIT_FAILURE,
+    MSS_MMC_CQ_NOT_INITIALISED,
+    MSS_MMC_SDCARD_NOT_SUPPORT_SPEED,
+    MSS_MMC_SDCARD_NOT_SUPPORT_VOLTAGE,
+    MSS_MMC_SDCARD_NOT_SUPPORT_BUS_MODE,
+    MSS_MMC_SDCARD_CMD6_SWITCH_ERROR,
+    MSS_MMC_SDCARD_TUNING_FAILED,
+    MSS_MMC_SDIO_ERR_BUS_SPEED_UNSUPP,
+    MSS_MMC_DEVICE_NOT_SUPPORT_HPI,
+    MSS_MMC_DEVICE_IS_NOT_IN_HPI_MODE,
+    MSS_MMC_DEVICE_HPI_NOT_DISABLED,
+    MSS_MMC_DATA_SIZE_IS_NOT_MULTI_BLOCK,
+    MSS_MMC_DEVICE_ERROR
+} mss_mmc_status_t;
+
+/*-------------------------------------------------------------------------*//**
+  The mss_mmc_cfg_t type provides the prototype for the configuration values of
+  the MSS eMMC SD driver. The application need to create a record of this type
+  to hold the configuration of the eMMC/SD/SDIO. The MSS_MMC_init() function
+  initializes the MSS eMMC SD using this structure. A pointer to an initialized
+  of this structure should be passed as the first parameter to the 
+  MSS_MMC_init() function.
+ */
+typedef struct
+{
+    /* Specifies the clock frequency of the eMMC/SD/SDIO devices */
+     uint32_t clk_rate;
+    /* Specifies the card type is the eMMC/SD/SDIO */
+     uint8_t card_type;
+    /* Specifies the data bus width of the eMMC/SD/SDIO */
+     uint8_t data_bus_width;
+    /* Specifies the bus speed mode of the eMMC/SD/SDIO */ 
+     uint8_t bus_speed_mode;
+     /* Specifies the bus voltage for eMMC only */
+     uint8_t bus_voltage; 
+} mss_mmc_cfg_t;
+
+/*-------------------------------------------------------------------------*//**
+  This type definition specifies the prototype of a function that can be 
+  registered with this driver as a eMMC/SD transfer completion handler function
+  through a call to MSS_MMC_set_handler(). The eMMC/SD transfer completion
+  handler will be called by the driver when an eMMC/SD transfer completes. The
+  PolarFire SoC MSS eMMC SD driver passes the outcome of the transfer to the 
+  completion handler in the form of a status parameter indicating if the 
+  transfer is successful or the type of error that occurred during the transfer.
+*/
+typedef void (*mss_mmc_handler_t)(uint32_t status);
+
+/*-------------------------------------------------------------------------*//**
+  Number of PHY input delay types held in a tuning record. This covers the
+  MSS_MMC_PHY_DELAY_INPUT_ delay types of mss_mmc_types.h.
+ */
+#define MSS_MMC_TUNING_PHY_DELAYS       9u
+
+/*-------------------------------------------------------------------------*//**
+  Value of the marker field of a tuning record filled in by the driver.
+ */
+#define MSS_MMC_TUNING_MARKER           0x4D4D5455u
+
+/*-------------------------------------------------------------------------*//**
+  The mss_mmc_tuning_t type holds the results of the PHY training and bus
+  tuning made by MSS_MMC_init(), together with the device and configuration
+  they were found for. The application does not need to interpret the record,
+  it only stores it and hands it back with MSS_MMC_set_tuning_cache().
+ */
+typedef struct
+{
+    /* MSS_MMC_TUNING_MARKER when the record holds results */
+    uint32_t marker;
+    /* CID register of the device */
+    uint32_t cid[4];
+    /* Clock rate, bus width and bus speed mode of mss_mmc_cfg_t */
+    uint32_t clk_rate;
+    uint8_t data_bus_width;
+    uint8_t bus_speed_mode;
+    /* Non-zero when tune_value holds the HS200/HS400 tuning result */
+    uint8_t tune_valid;
+    uint8_t tune_value;
+    /* Bit n set when phy_delay[n] holds the result for PHY delay type n */
+    uint32_t phy_valid;
+    uint8_t phy_delay[MSS_MMC_TUNING_PHY_DELAYS];
+} mss_mmc_tuning_t;
+
+/*-------------------------------------------------------------------------*//**
+  This type definition specifies the prototype of the function called by the
+  driver at the end of MSS_MMC_init() when the tuning record has been updated
+  and should be saved by the application.
+ */
+typedef void (*mss_mmc_tuning_save_t)(const mss_mmc_tuning_t *tuning);
+
+/*-------------------------------------------------------------------------*//**
+  The mss_mmc_sg_t type describes one memory segment of a scatter-gather
+  transfer made with MSS_MMC_adma2_write_sg() or MSS_MMC_adma2_read_sg(). The
+  buffer address and size must be multiples of 4 bytes.
+ */
+typedef struct
+{
+    /* Start of the segment in host memory */
+    uint8_t *buffer;
+    /* Size of the segment in bytes */
+    uint32_t size;
+} mss_mmc_sg_t;
+
+/*-------------------------------------------------------------------------*//**
+  Task directions for MSS_MMC_cq_submit().
+ */
+#define MSS_MMC_CQ_DIR_READ             0u
+#define MSS_MMC_CQ_DIR_WRITE            1u
+
+/*-------------------------------------------------------------------------*//**
+  Number of task slots available to MSS_MMC_cq_submit(). The last of the 32
+  command queue slots is kept for direct commands.
+ */
+#define MSS_MMC_CQ_MAX_TASKS            31u
+
+/*-------------------------------------------------------------------------*//**
+  Largest transfer, in bytes, for one task submitted with MSS_MMC_cq_submit().
+ */
+#define MSS_MMC_CQ_MAX_TASK_SIZE        65536u
+
+/*-------------------------------------------------------------------------*//**
+  This type definition specifies the prototype of the task completion handler
+  passed to MSS_MMC_cq_submit(). It is called from interrupt context with the
+  slot number returned by MSS_MMC_cq_submit(), MSS_MMC_TRANSFER_SUCCESS or
+  MSS_MMC_TRANSFER_FAIL, and the p_user_data value given to
+  MSS_MMC_cq_submit(). The handler may submit new tasks.
+*/
+typedef void (*mss_mmc_cq_task_handler_t)
+(
+    uint8_t task_id,
+    mss_mmc_status_t status,
+    void *p_user_data
+);
+
+/*-----------------------------Public APIs------------------------------------*/
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_init() function initializes the MSS eMMC SD host controller and
+  the eMMC/SD/SDIO device. The MSS_MMC_init()function takes a pointer to a
+  configuration data structure of type mss_mmc_cfg_t as parameter. This
+  configuration data structure contains all the information required to
+  configure the MSS eMMC SD.
+  The configuration passed to the MSS_MMC_init() function specifies the type
+  of interface used to connect the MSS eMMC SD host controller and the
+  eMMC/SD/SDIO device. It also specifies the allowed clock frequency, data bus
+  width and bus speed mode. The MSS_MMC_init() function must be called prior
+  to any MSS eMMC SD data transfer functions being called.
+
+  @param cfg
+  This parameter is a pointer to a data structure of type mss_mmc_cfg_t
+  containing the MSS eMMC SD desired configuration. The application must fill
+  the configuration data structure parameters before passing it as parameter to
+  the call to the MSS_MMC_init() function.
+
+  @return 
+  This function returns the initialization status of the eMMC/SD/SDIO device as
+  a value of type mss_mmc_status_t.
+
+  Example:
+  The following example shows how to initialize the eMMC device and configure
+  the data rate 25Mhz.
+  @code
+
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_MMC_MODE_LEGACY;
+    g_mmc0.bus_voltage = MSS_MMC_3_3V_BUS_VOLTAGE;
+
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+    //...
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_init
+(
+    const mss_mmc_cfg_t * cfg
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_single_block_write() function is used to transmit a single block
+  of data from the host controller to the eMMC/SD device. The size of the block
+  of data transferred by this function is always 512 bytes, which is the
+  standard sector size for all eMMC/SD devices with a capacity of greater than
+  2 GB.
+
+  Note: This function is a blocking function and will not return until the
+  write operation is successful or an error occurs.
+        
+  @param src_addr
+  This parameter is a pointer to a buffer containing the data to be stored in
+  the eMMC/SD device. The buffer to which this parameter points should be 
+  declared with a minimum size of 512 bytes.
+
+  @param dst_addr
+  Specifies the sector address in the eMMC/SD device where the data is to be
+  stored.
+  Note: For eMMC/SD devices of greater than 2 GB in size, this address refers
+  to a 512-byte sector.
+  
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+
+  Example:
+  The following example shows how to initialize the device, perform a single
+  block transfer.
+  @code
+  
+    #define SECT_1 0x01u
+    #define BUFFER_SIZE 512u
+    
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    uint8_t tx_data_buffer[BUFFER_SIZE] = {0u};
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_MMC_MODE_LEGACY;
+    g_mmc0.bus_voltage = MSS_MMC_3_3V_BUS_VOLTAGE;
+    
+    for (loop_count = 0; loop_count < (BUFFER_SIZE); loop_count++)
+    {
+        tx_data_buffer[loop_count] = 0x45 + loop_count;
+    }
+    
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        ret_status = MSS_MMC_single_block_write(tx_data_buffer, SECT_1);
+        if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
+        {
+            //..
+        }
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_single_block_write
+(
+    const uint32_t * src_addr,
+    uint32_t dst_addr
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_single_block_read() function is used to read a single block of 
+  data from the eMMC/SD device to the host controller. The size of the block
+  of data read by this function is always 512 bytes, which is the standard 
+  sector size for all eMMC/SD devices with a capacity of greater than 2 GB.
+
+  Note: This function is a blocking function and will not return until the 
+  read operation is successful or an error occurs.
+
+  @param src_addr
+  Specifies the sector address in the eMMC/SD device from where the data is
+  to be read.
+  Note: For eMMC/SD devices of greater than 2 GB in size, this address refers
+  to a 512-byte sector.
+  
+  @param dst_addr
+  This parameter is a pointer to a buffer where the data to read from the
+  eMMC/SD device will be stored. The buffer to which this parameter points
+  should be declared with a minimum size of 512 bytes.  
+
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+   
+  Example:
+  The following example shows how to initialize the device, perform a single
+  block transfer and read back the data from the sector written to within 
+  the eMMC device.
+  @code
+
+    #define SECT_1 0x01u
+    #define BUFFER_SIZE 512u
+    
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    uint8_t tx_data_buffer[BUFFER_SIZE] = {0u};
+    uint8_t rx_data_buffer[BUFFER_SIZE] = {0u};
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_MMC_MODE_LEGACY;
+    g_mmc0.bus_voltage = MSS_MMC_3_3V_BUS_VOLTAGE;
+
+    for (loop_count = 0; loop_count < (BUFFER_SIZE); loop_count++)
+    {
+        tx_data_buffer[loop_count] = 0x45 + loop_count;
+    }
+    
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        ret_status = MSS_MMC_single_block_write(tx_data_buffer, SECT_1);
+        if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
+        {
+            ret_status = MSS_MMC_single_block_read(SECT_1, rx_data_buffer);
+            if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
+            {
+                //..
+            }
+        }
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_single_block_read
+(
+    uint32_t src_addr,
+    uint32_t * dst_addr
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sdma_write() function is used to transfer a single block or multi
+  blocks of data from the host controller to the eMMC/SD device using SDMA.
+  The size of the block of data transferred by this function must be set to 512
+  bytes or a multiple of 512 bytes. The 512 bytes is the standard sector
+  size for all eMMC/SD devices with a capacity of greater than 2 GB.
+
+  Note: A call to MSS_MMC_sdma_write() while a transfer is in progress will not 
+  initiate a new transfer. Use the MSS_MMC_get_transfer_status() function 
+  or a completion handler registered by the MSS_MMC_set_handler() function
+  to check the status of the current transfer before calling the 
+  MSS_MMC_sdma_write() function again.
+  
+  Note: This function is a non-blocking function and returns immediately after
+  initiating the write transfer.
+
+  @param src
+  This parameter is a pointer to a buffer containing the data to be stored in
+  the eMMC/SD device. The buffer to which this parameter points must be 
+  declared with a minimum size of 512 bytes.
+  
+  @param dest
+  Specifies the sector address in the eMMC/SD device where the data is to be
+  stored.
+  Note: For eMMC/SD devices of greater than 2 GB in size, this address refers
+  to a 512-byte sector.
+  
+  @param size
+  Specifies the size in bytes of the requested transfer. The value of size must
+  be a multiple of 512 but not greater than (32MB - 512).
+    
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+   
+  Example:
+  The following example shows how to initialize the device, perform a multi
+  block write transfer using SDMA.
+  @code
+
+    #define SECT_1 0x01u
+    #define BUFFER_SIZE 4096u
+    
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    uint8_t data_buffer[BUFFER_SIZE];
+    uint32_t loop_count;
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_MMC_MODE_LEGACY;
+    g_mmc0.bus_voltage = MSS_MMC_3_3V_BUS_VOLTAGE;
+
+    for (loop_count = 0; loop_count < (BUFFER_SIZE); loop_count++)
+    {
+        data_buffer[loop_count] = 0x45 + loop_count;
+    }
+    
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        ret_status = MSS_MMC_sdma_write(data_buffer, SECT_1, BUFFER_SIZE);
+        do
+        {
+            ret_status = MSS_MMC_get_transfer_status();
+        }while (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS)
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_sdma_write
+(
+    const uint8_t *src,
+    uint32_t dest,
+    uint32_t size
+);
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sdma_read() function is used to read a single block or multiple
+  blocks of data from the eMMC/SD device to the host controller using SDMA. The
+  size of the block of data read by this function must be set to 512 bytes or
+  a multiple of 512 bytes. The 512 bytes is the standard sector size for all
+  eMMC/SD devices with a capacity of greater than 2 GB.
+
+  Note: A call to MSS_MMC_sdma_read() while a transfer is in progress will not 
+  initiate a new transfer. Use the MSS_MMC_get_transfer_status() function 
+  or a completion handler registered by the MSS_MMC_set_handler() function
+  to check the status of the current transfer before calling the 
+  MSS_MMC_sdma_read() function again.
+  
+  Note: This function is a non-blocking function and will return immediately 
+  after initiating the read transfer.
+          
+  @param src
+  Specifies the sector address in the eMMC/SD device from where the data is
+  to be read.
+  Note: For eMMC/SD devices of greater than 2 GB in size, this address refers
+  to a 512-byte sector.
+
+  @param dest
+  This parameter is a pointer to a buffer where the data to read from the 
+  eMMC/SD device will be stored. The buffer to which this parameter points 
+  must be declared with a minimum size of 512 bytes.
+
+  @param size
+  Specifies the size in bytes of the requested transfer. The value of size 
+  must be a multiple of 512 but not greater than (32MB - 512).
+  
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+
+  Example:
+  The following example shows how to initialize the device, perform a multi
+  block read transfer using SDMA.
+  @code
+  
+    #define SECT_1 0x01u
+    #define BUFFER_SIZE 4096u
+    
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    uint8_t data_buffer[BUFFER_SIZE];
+    uint32_t loop_count;
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_MMC_MODE_LEGACY;
+    g_mmc0.bus_voltage = MSS_MMC_3_3V_BUS_VOLTAGE;
+    
+    for (loop_count = 0; loop_count < (BUFFER_SIZE); loop_count++)
+    {
+        data_buffer[loop_count] = 0x45 + loop_count;
+    }
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        ret_status = MSS_MMC_sdma_read(SECT_1, data_buffer, BUFFER_SIZE);
+        do
+        {
+            ret_status = MSS_MMC_get_transfer_status();
+        }while (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS)
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_sdma_read
+(
+    uint32_t src,
+    uint8_t *dest,
+    uint32_t size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_adma2_write() function is used to transfer a single block or
+  multiple blocks of data from the host controller to the eMMC/SD device using
+  ADMA2. The size of the block of data transferred by this function must be set
+  to 512 bytes or a multiple of 512 bytes. The 512 bytes is the standard sector
+  size for all eMMC/SD devices with a capacity of greater than 2 GB.
+
+  Note: A call to MSS_MMC_adma2_write() while a transfer is in progress will not
+  initiate a new transfer. Use the MSS_MMC_get_transfer_status() function 
+  or a completion handler registered by the MSS_MMC_set_handler() function
+  to check the status of the current transfer before calling the 
+  MSS_MMC_adma2_write() function again.
+  
+  Note: This function is a non-blocking function and returns immediately after 
+  initiating the write transfer.
+
+  @param src
+  This parameter is a pointer to a buffer containing the data to be stored in
+  the eMMC/SD device. The buffer to which this parameter points must be
+  declared with a minimum size of 512 bytes.
+  
+  @param dest
+  Specifies the sector address in the eMMC/SD device where the data is
+  to be stored.
+  Note: For eMMC/SD devices of greater than 2 GB in size, this address refers
+  to a 512-byte sector.
+  
+  @param size
+  Specifies the size in bytes of the requested transfer. The value of size must
+  be a multiple of 512 but not greater than (32MB - 512).
+    
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+   
+  Example:
+  The following example shows how to initialize the device, perform a multi
+  block transfer using ADMA2.
+  
+  @code
+
+    #define SECT_1 0x01u
+    #define BUFFER_SIZE 4096u
+    
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    uint8_t data_buffer[BUFFER_SIZE];
+    uint32_t loop_count;
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_MMC_MODE_LEGACY;
+    g_mmc0.bus_voltage = MSS_MMC_3_3V_BUS_VOLTAGE;
+    
+    for (loop_count = 0; loop_count < (BUFFER_SIZE); loop_count++)
+    {
+        data_buffer[loop_count] = 0x45 + loop_count;
+    }
+    
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        ret_status = MSS_MMC_adma2_write(data_buffer, SECT_1, BUFFER_SIZE);
+        do
+        {
+            ret_status = MSS_MMC_get_transfer_status();
+        }while (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS)
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_adma2_write
+(
+    const uint8_t *src,
+    uint32_t dest,
+    uint32_t size
+);
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_adma2_read() function is used to read a single or multiple blocks
+  of data from the eMMC/SD device to the host controller using ADMA2. The size
+  of the block of data read by this function must be set to 512 bytes or a
+  multiple of 512 bytes. The 512 bytes is the standard sector size for all
+  eMMC/SD devices with a capacity of greater than 2 GB. 
+
+  Note: A call to MSS_MMC_adma2_read() while a transfer is in progress will not
+  initiate a new transfer. Use the MSS_MMC_get_transfer_status() function 
+  or a completion handler registered by the MSS_MMC_set_handler() function
+  to check the status of the current transfer before calling the 
+  MSS_MMC_adma2_read() function again.
+  
+  Note: This function is a non-blocking function and returns immediately after 
+  initiating the read transfer.
+  
+  @param src
+  Specifies the sector address in the eMMC/SD device from where the data is
+  to be read.
+  Note: For eMMC/SD devices of greater than 2 GB in size, this address refers
+  to a 512-byte sector.
+
+  @param dest
+  This parameter is a pointer to a buffer where the data to read from the
+  eMMC/SD device will be stored. The buffer to which this parameter points
+  must be declared with a minimum size of 512 bytes.
+
+  @param size
+  Specifies the size in bytes of the requested transfer. The value of size must
+  be a multiple of 512 but not greater than (32MB -512).
+  
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+
+  Example:
+  The following example shows how to initialize the device, perform a multi
+  block read transfer using ADMA2.
+  @code
+  
+    #define SECT_1 0x01u
+    #define BUFFER_SIZE 4096u
+  
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    uint8_t data_buffer[BUFFER_SIZE];
+    uint32_t loop_count;
+
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_MMC_MODE_LEGACY;
+    g_mmc0.bus_voltage = MSS_MMC_3_3V_BUS_VOLTAGE;
+
+    for (loop_count = 0; loop_count < (BUFFER_SIZE); loop_count++)
+    {
+        data_buffer[loop_count] = 0x45 + loop_count;
+    }
+    
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        ret_status = MSS_MMC_adma2_read(SECT_1, data_buffer, BUFFER_SIZE);
+        do
+        {
+            ret_status = MSS_MMC_get_transfer_status();
+        }while (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS)
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_adma2_read
+(
+    uint32_t src,
+    uint8_t *dest,
+    uint32_t size
+);
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_adma2_write_sg() function is used to write blocks of data
+  gathered from a list of memory segments to the eMMC/SD device using ADMA2.
+  The segments are written one after another, starting at sector dest.
+
+  Note: A call to MSS_MMC_adma2_write_sg() while a transfer is in progress will
+  not initiate a new transfer.
+
+  Note: This function is a non-blocking function and returns immediately after
+  initiating the write transfer. The segment list is only read by this
+  function, but the segment buffers must not change until the transfer has
+  completed.
+
+  @param segments
+  This parameter is a pointer to the list of segments.
+
+  @param seg_count
+  Specifies the number of segments in the list.
+
+  @param dest
+  Specifies the sector address in the eMMC/SD device where the data is
+  to be stored.
+
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation. MSS_MMC_INVALID_PARAMETER is returned if
+  the total size is not a multiple of 512, is greater than (32MB - 512), or
+  needs more descriptors than the driver's descriptor table holds.
+ */
+mss_mmc_status_t
+MSS_MMC_adma2_write_sg
+(
+    const mss_mmc_sg_t *segments,
+    uint32_t seg_count,
+    uint32_t dest
+);
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_adma2_read_sg() function is used to read blocks of data from the
+  eMMC/SD device, starting at sector src, and scatter them over a list of
+  memory segments using ADMA2.
+
+  Note: A call to MSS_MMC_adma2_read_sg() while a transfer is in progress will
+  not initiate a new transfer.
+
+  Note: This function is a non-blocking function and returns immediately after
+  initiating the read transfer.
+
+  @param src
+  Specifies the sector address in the eMMC/SD device from where the data is
+  to be read.
+
+  @param segments
+  This parameter is a pointer to the list of segments.
+
+  @param seg_count
+  Specifies the number of segments in the list.
+
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation. MSS_MMC_INVALID_PARAMETER is returned if
+  the total size is not a multiple of 512, is greater than (32MB - 512), or
+  needs more descriptors than the driver's descriptor table holds.
+
+  Example:
+  The following example reads 64 sectors into four separate frame buffers.
+  @code
+    mss_mmc_sg_t segments[4];
+    uint32_t idx;
+
+    for (idx = 0u; idx < 4u; idx++)
+    {
+        segments[idx].buffer = g_frame[idx];
+        segments[idx].size = 8192u;
+    }
+
+    ret_status = MSS_MMC_adma2_read_sg(SECT_1, segments, 4u);
+    do
+    {
+        ret_status = MSS_MMC_get_transfer_status();
+    }while (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS)
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_adma2_read_sg
+(
+    uint32_t src,
+    const mss_mmc_sg_t *segments,
+    uint32_t seg_count
+);
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sdio_single_block_write() function is used to transfer a single
+  block of data from the host controller to the SDIO device function 1
+  code storage area(CSA). The size of the block of data transferred by this
+  function is 1 to 512 bytes.
+  
+  Note: This function is a blocking function and will not return until the
+  write operation is successful or an error occurs.
+  
+  @param src_addr
+  This parameter is a pointer to a buffer containing the data to be stored in
+  the SDIO device. The buffer to which this parameter points must be declared
+  with a minimum size in the range of 1 to 512 bytes.
+
+  @param dst_addr
+  Specifies the function 1 code storage area(CSA) address in the SDIO device
+  where the data is to be stored.
+
+  @param data_size
+  Specifies the dat_size in bytes of the requested transfer. The value of size must
+  be in the range of 1 to 512 bytes but not greater than 512.
+  
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+
+  Example:
+  The following example shows how to initialize the SDIO device and perform
+  single block transfer.
+  
+  @code
+
+    #define BUFFER_SIZE 4
+    #define REG_NUM 0x1118u
+    
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    
+    uint8_t data_buffer[BUFFER_SIZE];
+    uint32_t loop_count;
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_SDIO;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_SDCARD_MODE_HIGH_SPEED;
+    
+    for (loop_count = 0; loop_count < (BUFFER_SIZE); loop_count++)
+    {
+        data_buffer[loop_count] = 0x45 + loop_count;
+    }
+    
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        ret_status = MSS_MMC_sdio_single_block_write(data_buffer, 
+                                                    REG_NUM,
+                                                    BUFFER_SIZE);
+        if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
+        {
+            //...
+        }
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_sdio_single_block_write
+(
+    const uint32_t * src_addr,
+    uint32_t dst_addr,
+    uint16_t data_size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sdio_single_block_read() function is used to read a single block
+  of data from the the SDIO device function 1 code storage area(CSA) to host
+  controller. The size of the block of data transferred by this function
+  is set to in the range of 1 to 512 bytes.
+
+  Note: This function is a blocking function and will not return until the
+  write operation is successful or an error occurs.
+  
+  @param src_addr
+  Specifies the function 1 code storage area(CSA) address in the SDIO device
+  from where the 1 to 512 bytes of data will be read.
+
+  @param dst_addr
+  This parameter is a pointer to a buffer where the data read from the SDIO
+  device will be stored. The buffer to which this parameter points must be
+  declared with a minimum size in the range of 1 to 512 bytes.
+
+  @param data_size
+  Specifies the dat_size in bytes of the requested transfer. The value of size must
+  be in the range of 1 to 512 bytes but not greater than 512.
+  
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+
+  Example:
+  The following example shows how to initialize the SDIO device and perform
+  single block transfer.
+
+  @code
+
+    #define BUFFER_SIZE 512u
+    #define REG_NUM 0x000C0000u
+    
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    uint8_t data_buffer[BUFFER_SIZE];
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_SDIO;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_SDCARD_MODE_HIGH_SPEED;
+    
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        ret_status = MSS_MMC_sdio_single_block_read(REG_NUM,
+                                                    data_buffer
+                                                    BUFFER_SIZE);
+        if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
+        {
+            //...
+        }
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_sdio_single_block_read
+(
+    uint32_t src_addr,
+    uint32_t *dst_addr,
+    uint16_t data_size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_get_transfer_status() function returns the status of the MMC
+  transfer initiated by a call to MSS_MMC_sdma_write(), MSS_MMC_sdma_read(), 
+  MSS_MMC_adma2_write(), MSS_MMC_adma2_read(), MSS_MMC_cq_write(), 
+  MSS_MMC_cq_read() functions.
+  
+  @param
+    This function has no parameters.
+    
+  @return
+  This function returns a value of type mss_mmc_status_t. The possible return
+  values are:
+        - MSS_MMC_TRANSFER_IN_PROGRESS
+        - MSS_MMC_TRANSFER_SUCCESS
+        - MSS_MMC_TRANSFER_FAIL
+        - MSS_MMC_RESPONSE_ERROR
+
+  Example:
+  The following example shows the use of MSS_MMC_get_transfer_status() function.
+  
+  @code
+        
+        mss_mmc_status_t ret_status;
+        ret_status = MSS_MMC_write(data_buffer, SECT_1, BUFFER_SIZE);
+        do
+        {
+            ret_status = MSS_MMC_get_transfer_status();
+        }while(ret_status == MSS_MMC_TRANSFER_IN_PROGRESS)
+     
+  @endcode
+ */
+mss_mmc_status_t MSS_MMC_get_transfer_status(void);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_set_handler() function registers a handler function that will be
+  called by the driver when a read o write transfer completes. The application
+  must create and register a transfer completion handler function. The MSS
+  eMMC SD driver passes the outcome of the transfer to the completion handler
+  in the form of a status (SRS12 register) parameter indicating if the transfer
+  is successful or the type of error that occurred during the transfer if the
+  transfer failed.
+
+  @param handler
+  The handler parameter is a pointer to a handler function provided by the
+  application. This handler is of type mss_mmc_handler_t. The handler function
+  must take one parameter of type uint32_t and must not return a value.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  The following example shows the use of MSS_MMC_set_handler() function.
+
+  @code
+  
+    #define BLOCK_1 0x00000001u
+    #define BUFFER_SIZE 1024
+    #define ERROR_INTERRUPT 0x8000
+    #define TRANSFER_COMPLETE 0x1
+  
+    void transfer_complete_handler(uint32_t srs12_status);
+    volatile uint32_t g_xfer_in_progress = 0;
+    
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    uint8_t data_buffer[BUFFER_SIZE];
+    uint32_t loop_count;
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_MMC_MODE_LEGACY;
+    g_mmc0.bus_voltage = MSS_MMC_3_3V_BUS_VOLTAGE;
+    
+    for (loop_count = 0; loop_count < (BUFFER_SIZE); loop_count++)
+    {
+        data_buffer[loop_count] = 0x45 + loop_count;
+    }
+    
+    ret_status = MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        MSS_MMC_set_handler(transfer_complete_handler);
+        ret_status = MSS_MMC_adma2_write(data_buffer, BLOCK_1, BUFFER_SIZE);
+        if (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS)
+        {
+            while(g_xfer_in_progress)
+            {
+                ;
+            }
+        }
+    }
+    
+    void transfer_complete_handler(uint32_t srs12_status)
+    {
+        g_xfer_in_progress = 0;
+        uint32_t isr_err;
+        if(ERROR_INTERRUPT & srs12_status)
+        {
+            isr_err = srs12_status >> 16;
+        }
+        else if(TRANSFER_COMPLETE & srs12_status)
+        {
+            isr_err = 0;
+        }
+        else
+        {
+        }
+    }
+  @endcode
+ */
+void MSS_MMC_set_handler(mss_mmc_handler_t handler);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_set_tuning_cache() function gives the driver a tuning record to
+  use and update in the following calls to MSS_MMC_init(). It must be called
+  before MSS_MMC_init(). The record is kept by the driver, so it must remain
+  valid for as long as it is registered.
+
+  A record which has never been saved, or which was saved for another device
+  or configuration, is cleared by MSS_MMC_init() and filled in with the results
+  of a full search. A zero filled record can be used the first time.
+
+  @param tuning
+  The tuning parameter is a pointer to the tuning record. Passing NULL_POINTER
+  stops the use of a tuning record, and MSS_MMC_init() always makes a full
+  search.
+
+  @param save
+  The save parameter is a pointer to the function called when the record has
+  been updated. It may be NULL_POINTER.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  The following example keeps the tuning record in the eNVM user area.
+  @code
+    static mss_mmc_tuning_t g_tuning;
+
+    void save_tuning(const mss_mmc_tuning_t *tuning)
+    {
+        envm_write(TUNING_ADDR, tuning, sizeof(mss_mmc_tuning_t));
+    }
+
+    memcpy(&g_tuning, (const void *)TUNING_ADDR, sizeof(g_tuning));
+    MSS_MMC_set_tuning_cache(&g_tuning, save_tuning);
+    ret_status = MSS_MMC_init(&g_mmc);
+  @endcode
+ */
+void MSS_MMC_set_tuning_cache
+(
+    mss_mmc_tuning_t *tuning,
+    mss_mmc_tuning_save_t save
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_cq_init() function enables command queue in the eMMC device and
+  in the host controller. The command queue allows the application to queue
+  multiple read or write tasks.
+
+  Note: The MSS_MMC_init() must be configured for eMMC mode before using the
+  MSS_MMC_cq_init() function.
+
+  @param
+    This function has no parameters.
+
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+ */
+mss_mmc_status_t MSS_MMC_cq_init(void);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_cq_write() function is used to transmit a single block or multiple
+  blocks of data from the host controller to the eMMC device using command queue
+  with single or multiple tasks based on the data size. The size of the block of
+  data transferred by this function must be set to 512 bytes or a multiple of
+  512 bytes. The 512 bytes is the standard sector size for all eMMC
+  devices with a capacity of greater than 2 GB.
+
+  Note: A call to MSS_MMC_cq_write() while a transfer is in progress will not
+  initiate a new transfer. Use the MSS_MMC_get_transfer_status() function 
+  or a completion handler registered by the MSS_MMC_set_handler() function
+  to check the status of the current transfer before calling the 
+  MSS_MMC_cq_write() function again.
+  
+  Note: This function is a non-blocking function and returns immediately after
+  initiating the write transfer.
+  
+  @param src
+  This parameter is a pointer to a buffer containing the data to be stored
+  in the eMMC device. The buffer to which this parameter points must be
+  declared with a minimum size of 512 bytes.
+  
+  @param dest
+  Specifies the sector address in the eMMC device where the data is
+  to be stored.
+  Note: For eMMC devices of greater than 2 GB in size, this address refers to a 
+  512 byte sector.
+
+  @param size
+  Specifies the size in bytes of the requested transfer. The value of size must
+  be a multiple of 512 but not greater than (1GB - 16KB).
+    
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+   
+  Example:
+  The following example shows how to initialize the device and perform a multi
+  block transfer..
+  @code
+
+    #define SECT_1 0x01u
+    #define BUFFER_SIZE 4096u
+    
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    uint8_t data_buffer[BUFFER_SIZE];
+    uint32_t loop_count;
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_MMC_MODE_LEGACY;
+    g_mmc0.bus_voltage = MSS_MMC_3_3V_BUS_VOLTAGE;
+    
+    for (loop_count = 0; loop_count < (BUFFER_SIZE); loop_count++)
+    {
+        data_buffer[loop_count] = 0x45 + loop_count;
+    }
+    
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        ret_status = MSS_MMC_cq_init();
+        if ( MSS_MMC_INIT_SUCCESS == ret_status)
+        {
+            ret_status = MSS_MMC_cq_write(data_buffer, SECT_1, BUFFER_SIZE);
+            do
+            {
+                ret_status = MSS_MMC_get_transfer_status();
+            }while (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS)
+        }
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_cq_write
+(
+    const uint8_t *src,
+    uint32_t dest,
+    uint32_t size
+);
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_cq_read() function is used to read a single block or multiple
+  blocks of data from the eMMC device to the host controller using command queue
+  with single or multiple tasks based on the data size. The size of the block of
+  data read by this function must be set to 512 bytes or a multiple of 512 bytes.
+  The 512 bytes is the standard sector size for all eMMC devices with a capacity
+  of greater than 2 GB. 
+
+  Note: A call to MSS_MMC_cq_read() while a transfer is in progress will not 
+  initiate a new transfer. Use the MSS_MMC_get_transfer_status() function 
+  or a completion handler registered by the MSS_MMC_set_handler() function
+  to check the status of the current transfer before calling the 
+  MSS_MMC_cq_read() function again.
+
+  Note: This function is a non-blocking function and returns immediately after
+  initiating the write transfer.
+  
+  @param src_addr
+  Specifies the sector address in the eMMC device from where the datato is
+  to be read.
+  
+  Note: For eMMC devices of greater than 2 GB in size, this address refers
+  to a 512-byte sector.
+  
+  @param dst_addr
+  This parameter is a pointer to a buffer where the data to read from the eMMC
+  device will be stored. The buffer to which this parameter points must be
+  declared with a minimum size of 512 bytes.
+
+  @param size
+  Specifies the size in bytes of the requested transfer. The value of size must
+  be a multiple of 512 but not greater than (1GB - 16KB).
+  
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation.
+
+  Example:
+  The following example shows how to initialize the device and perform a multi
+  block transfer.
+
+  @code
+
+    #define SECT_1 0x01u
+    #define BUFFER_SIZE 4096u
+    
+    mss_mmc_cfg_t g_mmc0;
+    mss_mmc_status_t ret_status;
+    uint8_t data_buffer[BUFFER_SIZE];
+    uint32_t loop_count;
+    
+    g_mmc0.clk_rate = MSS_MMC_CLOCK_25MHZ;
+    g_mmc0.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_mmc0.data_bus_width = MSS_MMC_DATA_WIDTH_4BIT;
+    g_mmc0.bus_speed_mode = MSS_MMC_MODE_LEGACY;
+    g_mmc0.bus_voltage = MSS_MMC_3_3V_BUS_VOLTAGE;
+    
+    for (loop_count = 0; loop_count < (BUFFER_SIZE); loop_count++)
+    {
+        data_buffer[loop_count] = 0x45 + loop_count;
+    }
+    
+    ret_status = MSS_MMC_init(&g_mmc0);
+    if (MSS_MMC_INIT_SUCCESS == ret_status)
+    {
+        ret_status = MSS_MMC_cq_init();
+        if (MSS_MMC_INIT_SUCCESS == ret_status)
+        {
+            ret_status = MSS_MMC_cq_read(SECT_1, data_buffer, BUFFER_SIZE);
+            do
+            {
+                ret_status = MSS_MMC_get_transfer_status();
+            }while (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS)
+        }
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_cq_read
+(
+    uint32_t src,
+    uint8_t *dest,
+    uint32_t size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_cq_submit() function takes a free command queue task slot and
+  fills in its task descriptor for a read or write of up to
+  MSS_MMC_CQ_MAX_TASK_SIZE bytes. The task is started by the next call to
+  MSS_MMC_cq_ring_doorbell().
+
+  Note: This function is a non-blocking function. It can be called from a task
+  completion handler.
+
+  @param direction
+  Specifies the direction of the transfer, MSS_MMC_CQ_DIR_READ or
+  MSS_MMC_CQ_DIR_WRITE.
+
+  @param sector
+  Specifies the first sector of the transfer in the eMMC device.
+
+  @param buffer
+  This parameter is a pointer to the data buffer in host memory. It must
+  remain valid until the task handler is called.
+
+  @param size
+  Specifies the size in bytes of the transfer. The value of size must be a
+  multiple of 512 and not greater than MSS_MMC_CQ_MAX_TASK_SIZE.
+
+  @param handler
+  Specifies the task completion handler. It may be NULL.
+
+  @param p_user_data
+  This value is passed to the handler.
+
+  @param task_id
+  This parameter is a pointer to where the slot number of the task is stored.
+  It may be NULL.
+
+  @return
+  This function returns MSS_MMC_TRANSFER_IN_PROGRESS when the task has been
+  set up. It returns MSS_MMC_TRANSFER_FAIL when no task slot is free or when
+  MSS_MMC_cq_write() or MSS_MMC_cq_read() is in progress,
+  MSS_MMC_CQ_NOT_INITIALISED when MSS_MMC_cq_init() has not succeeded, and
+  MSS_MMC_INVALID_PARAMETER when a parameter is out of range.
+
+  Example:
+  @code
+    void read_done(uint8_t task_id, mss_mmc_status_t status, void *p_user_data)
+    {
+        // p_user_data identifies the read
+    }
+
+    for (idx = 0u; idx < 8u; idx++)
+    {
+        (void)MSS_MMC_cq_submit(MSS_MMC_CQ_DIR_READ, sectors[idx],
+                                &buffer[idx * 4096u], 4096u, read_done,
+                                (void *)idx, NULL);
+    }
+    MSS_MMC_cq_ring_doorbell();
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_cq_submit
+(
+    uint8_t direction,
+    uint32_t sector,
+    uint8_t *buffer,
+    uint32_t size,
+    mss_mmc_cq_task_handler_t handler,
+    void *p_user_data,
+    uint8_t *task_id
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_cq_ring_doorbell() function starts all the tasks set up by
+  MSS_MMC_cq_submit() since the last call, with one doorbell register write.
+
+  @param
+    This function has no parameters.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_MMC_cq_ring_doorbell(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __MSS_MMC_H */
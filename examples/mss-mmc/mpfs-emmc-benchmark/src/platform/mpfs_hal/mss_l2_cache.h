@@ -0,0 +1,32 @@
+/*******************************************************************************
+ * Copyright 2019-2020 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_l2_cache.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief MACROs defines and prototypes associated with L2 Cache
+ *
+ */
+#ifndef MSS_L2_CACHE_H
+#define MSS_L2_CACHE_H
+
+#include <stdint.h>
+#include "encoding.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void config_l2_cache(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MSS_L2_CACHE_H */
@@ -0,0 +1,35 @@
+ /*******************************************************************************
+ * Copyright 2019-2020 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/*******************************************************************************
+ * @file mss_prci.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief PRCI: Power, Reset, Clock, Interrupt
+ *
+ */
+
+#ifndef MSS_PRCI_H
+#define MSS_PRCI_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==============================================================================
+ * PRCI: Power, Reset, Clock, Interrupt
+ */
+#define PRCI_BASE   0x10000000UL  /* FU540-C000 on unleashed board- 0x10000000UL  */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* MSS_PRCI_H */
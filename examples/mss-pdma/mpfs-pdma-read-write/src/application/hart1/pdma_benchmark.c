@@ -0,0 +1,339 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software example
+ *
+ * PolarFire SoC MSS PDMA Driver example project
+ *
+ * PDMA and CPU copy throughput benchmark. See pdma_benchmark.h for details.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss/mss_pdma/mss_pdma.h"
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+#include "inc/pdma_benchmark.h"
+#include "bench_report.h"
+
+/* Memory region taking part in the benchmark. */
+typedef struct
+{
+    const char *name;
+    uint64_t base;
+    uint64_t size;
+} bench_region_t;
+
+static const bench_region_t g_bench_regions[] =
+{
+    { "LIM",     BENCH_LIM_BASE,            BENCH_LIM_SIZE },
+    { "L2SCR",   BENCH_L2_SCRATCH_BASE,     BENCH_L2_SCRATCH_SIZE },
+    { "DDR-C",   BENCH_DDR_CACHED_BASE,     BENCH_DDR_CACHED_SIZE },
+    { "DDR-NC",  BENCH_DDR_NON_CACHED_BASE, BENCH_DDR_NON_CACHED_SIZE },
+    { "DDR-WCB", BENCH_DDR_WCB_BASE,        BENCH_DDR_WCB_SIZE },
+    { "FIC0",    BENCH_FIC0_BASE,           BENCH_FIC0_SIZE },
+    { "FIC1",    BENCH_FIC1_BASE,           BENCH_FIC1_SIZE },
+};
+
+#define BENCH_REGION_COUNT \
+    (sizeof(g_bench_regions) / sizeof(g_bench_regions[0]))
+
+/* Channel count used in a row to mark the CPU memcpy() measurement. */
+#define BENCH_CPU_COPY                  0u
+#define BENCH_MAX_CHANNELS              4u
+
+/* Timing for one measurement. */
+typedef struct
+{
+    uint64_t cycles;
+    uint64_t ticks;
+    uint8_t error;
+} bench_result_t;
+
+static bench_report_t g_report;
+
+/* Settings given on the config lines of the report */
+static const bench_config_t g_bench_config[] =
+{
+    BENCH_CONFIG(BENCH_ITERATIONS),
+    BENCH_CONFIG(BENCH_MIN_SIZE),
+    BENCH_CONFIG(BENCH_MAX_SIZE)
+};
+
+static void bench_copy
+(
+    uint64_t dest,
+    uint64_t src,
+    uint64_t num_bytes,
+    uint8_t channels,
+    bench_result_t *result
+);
+
+static void bench_print_row
+(
+    mss_uart_instance_t * this_uart,
+    const bench_region_t *src,
+    const bench_region_t *dest,
+    uint64_t num_bytes,
+    uint8_t channels,
+    const bench_result_t *result
+);
+
+/*------------------------------------------------------------------------------
+ * See pdma_benchmark.h for details.
+ */
+void
+pdma_benchmark_run
+(
+    mss_uart_instance_t * this_uart
+)
+{
+    uint32_t src_idx;
+    uint32_t dest_idx;
+    uint64_t num_bytes;
+    uint8_t channels;
+    bench_result_t result;
+
+    MSS_UART_polled_tx_string(this_uart,
+            (const uint8_t *)"\n\r\t******* PDMA throughput benchmark *******\n\r");
+    bench_report_begin(&g_report, this_uart, NULL, "mpfs-pdma-read-write",
+                       g_bench_config,
+                       sizeof(g_bench_config) / sizeof(g_bench_config[0]));
+    MSS_UART_polled_tx_string(this_uart,
+            (const uint8_t *)"\n\rsrc      dest     bytes       ch   mcycle        mtime      MB/s\n\r");
+
+    /* Fill each source half once so the PDMA reads real data. */
+    for (src_idx = 0u; src_idx < BENCH_REGION_COUNT; src_idx++)
+    {
+        if (g_bench_regions[src_idx].size != 0u)
+        {
+            (void)memset((void *)(uintptr_t)g_bench_regions[src_idx].base,
+                         0xA5, (size_t)(g_bench_regions[src_idx].size / 2u));
+        }
+    }
+
+    for (src_idx = 0u; src_idx < BENCH_REGION_COUNT; src_idx++)
+    {
+        for (dest_idx = 0u; dest_idx < BENCH_REGION_COUNT; dest_idx++)
+        {
+            const bench_region_t *src = &g_bench_regions[src_idx];
+            const bench_region_t *dest = &g_bench_regions[dest_idx];
+
+            for (num_bytes = BENCH_MIN_SIZE; num_bytes <= BENCH_MAX_SIZE;
+                 num_bytes *= BENCH_SIZE_STEP)
+            {
+                /* Sizes which do not fit in either half are skipped. */
+                if ((num_bytes > (src->size / 2u)) ||
+                    (num_bytes > (dest->size / 2u)))
+                {
+                    break;
+                }
+
+                for (channels = BENCH_CPU_COPY; channels <= BENCH_MAX_CHANNELS;
+                     channels++)
+                {
+                    /* Each channel needs at least one 64 byte part. */
+                    if ((channels != BENCH_CPU_COPY) &&
+                        ((num_bytes / 64u) < channels))
+                    {
+                        break;
+                    }
+
+                    bench_copy(dest->base + (dest->size / 2u), src->base,
+                               num_bytes, channels, &result);
+                    bench_print_row(this_uart, src, dest, num_bytes, channels,
+                                    &result);
+                }
+            }
+        }
+    }
+
+    bench_report_end(&g_report);
+    MSS_UART_polled_tx_string(this_uart,
+            (const uint8_t *)"\n\rBenchmark complete\n\r");
+}
+
+/*------------------------------------------------------------------------------
+ * Time BENCH_ITERATIONS copies of num_bytes from src to dest, using the CPU
+ * for BENCH_CPU_COPY or the given number of PDMA channels, and store the
+ * average.
+ */
+static void
+bench_copy
+(
+    uint64_t dest,
+    uint64_t src,
+    uint64_t num_bytes,
+    uint8_t channels,
+    bench_result_t *result
+)
+{
+    mss_pdma_channel_config_t config;
+    uint64_t part;
+    uint64_t offset;
+    uint64_t start_cycle;
+    uint64_t start_tick;
+    uint32_t iteration;
+    uint8_t ch;
+    uint8_t done_mask;
+    uint8_t all_mask;
+
+    result->cycles = 0u;
+    result->ticks = 0u;
+    result->error = 0u;
+
+    for (iteration = 0u; iteration < BENCH_ITERATIONS; iteration++)
+    {
+        if (channels == BENCH_CPU_COPY)
+        {
+            start_tick = readmtime();
+            start_cycle = readmcycle();
+
+            (void)memcpy((void *)(uintptr_t)dest, (const void *)(uintptr_t)src,
+                         (size_t)num_bytes);
+
+            result->cycles += readmcycle() - start_cycle;
+            result->ticks += readmtime() - start_tick;
+            continue;
+        }
+
+        part = (num_bytes / channels) & ~((uint64_t)63u);
+        offset = 0u;
+        all_mask = (uint8_t)((1u << channels) - 1u);
+        done_mask = 0u;
+
+        config.enable_done_int = 0u;
+        config.enable_err_int = 0u;
+        config.repeat = 0u;
+        config.force_order = 0u;
+
+        for (ch = 0u; ch < channels; ch++)
+        {
+            (void)MSS_PDMA_clear_transfer_complete_status((mss_pdma_channel_id_t)ch);
+            (void)MSS_PDMA_clear_transfer_error_status((mss_pdma_channel_id_t)ch);
+
+            config.src_addr = src + offset;
+            config.dest_addr = dest + offset;
+
+            /* The last channel picks up what is left over. */
+            config.num_bytes = (ch == (channels - 1u)) ?
+                               (num_bytes - offset) : part;
+            offset += part;
+
+            if (MSS_PDMA_OK != MSS_PDMA_setup_transfer((mss_pdma_channel_id_t)ch,
+                                                       &config))
+            {
+                result->error = 1u;
+                return;
+            }
+        }
+
+        start_tick = readmtime();
+        start_cycle = readmcycle();
+
+        for (ch = 0u; ch < channels; ch++)
+        {
+            (void)MSS_PDMA_start_transfer((mss_pdma_channel_id_t)ch);
+        }
+
+        while (done_mask != all_mask)
+        {
+            for (ch = 0u; ch < channels; ch++)
+            {
+                if (0u != MSS_PDMA_get_transfer_complete_status((mss_pdma_channel_id_t)ch))
+                {
+                    done_mask |= (uint8_t)(1u << ch);
+                }
+
+                if (0u != MSS_PDMA_get_transfer_error_status((mss_pdma_channel_id_t)ch))
+                {
+                    done_mask |= (uint8_t)(1u << ch);
+                    result->error = 1u;
+                }
+            }
+        }
+
+        result->cycles += readmcycle() - start_cycle;
+        result->ticks += readmtime() - start_tick;
+
+        for (ch = 0u; ch < channels; ch++)
+        {
+            (void)MSS_PDMA_clear_transfer_complete_status((mss_pdma_channel_id_t)ch);
+            (void)MSS_PDMA_clear_transfer_error_status((mss_pdma_channel_id_t)ch);
+        }
+    }
+
+    result->cycles /= BENCH_ITERATIONS;
+    result->ticks /= BENCH_ITERATIONS;
+}
+
+/*------------------------------------------------------------------------------
+ * Print one row of the results table.
+ */
+static void
+bench_print_row
+(
+    mss_uart_instance_t * this_uart,
+    const bench_region_t *src,
+    const bench_region_t *dest,
+    uint64_t num_bytes,
+    uint8_t channels,
+    const bench_result_t *result
+)
+{
+    char line[128];
+    char ch_name[4];
+    char regions[24];
+    bench_record_t record;
+    uint64_t mbps = 0u;
+
+    if (result->cycles != 0u)
+    {
+        /* Bytes per microsecond is the same as MB/s. */
+        mbps = (num_bytes * (LIBERO_SETTING_MSS_COREPLEX_CPU_CLK / 1000000u)) /
+                result->cycles;
+    }
+
+    if (channels == BENCH_CPU_COPY)
+    {
+        (void)strcpy(ch_name, "cpu");
+    }
+    else
+    {
+        (void)snprintf(ch_name, sizeof(ch_name), "%u", (unsigned int)channels);
+    }
+
+    if (result->error != 0u)
+    {
+        (void)snprintf(line, sizeof(line), "%-8s %-8s %-11lu %-4s error\n\r",
+                       src->name, dest->name, (unsigned long)num_bytes,
+                       ch_name);
+    }
+    else
+    {
+        (void)snprintf(line, sizeof(line),
+                       "%-8s %-8s %-11lu %-4s %-13lu %-10lu %lu\n\r",
+                       src->name, dest->name, (unsigned long)num_bytes,
+                       ch_name, (unsigned long)result->cycles,
+                       (unsigned long)result->ticks, (unsigned long)mbps);
+    }
+
+    MSS_UART_polled_tx_string(this_uart, (const uint8_t *)line);
+
+    /* The copy time is an average, given as the mean */
+    (void)snprintf(regions, sizeof(regions), "%s->%s", src->name, dest->name);
+    bench_record_init(&record, "pdma",
+                      (channels == BENCH_CPU_COPY) ? "memcpy" : "pdma",
+                      regions);
+    record.size = (uint32_t)num_bytes;
+    record.depth = (channels == BENCH_CPU_COPY) ? 1u : channels;
+    record.samples = BENCH_ITERATIONS;
+    record.errors = result->error;
+    record.rate = mbps;
+    record.rate_unit = "MB/s";
+    record.mean = result->cycles;
+    record.lat_unit = "cycles";
+    bench_report_result(&g_report, &record);
+}
@@ -15,6 +15,7 @@
 #include "mpfs_hal/mss_hal.h"
 #include "drivers/mss/mss_pdma/mss_pdma.h"
 #include "drivers/mss/mss_mmuart/mss_uart.h"
+#include "inc/pdma_benchmark.h"
 
 /* Local buffers to store the destination and source address data. */
 uint8_t g_src_arr[1024] = {0};
@@ -49,6 +50,7 @@ success / failure about the DMA transactions \r\n\
 \n\n\r 1--> Initiate PDMA transaction on channel 1 \n\r\
 \n\n\r 2--> Initiate PDMA transaction on channel 2 \n\r\
 \n\n\r 3--> Initiate PDMA transaction on channel 3 \n\r\
+\n\n\r b--> Run the PDMA throughput benchmark \n\r\
 ";
 
 /* Main function for the hart0(E51 processor).
@@ -185,6 +187,10 @@ void u54_1(void)
 
                 MSS_UART_polled_tx_string (g_uart, "DMA CH '3' ");
             }
+            else if (rx_buff[0] == 'b')
+            {
+                pdma_benchmark_run(g_uart);
+            }
             else
             {
                 MSS_UART_polled_tx_string (g_uart, "Please Select Correct Channel  \n\r");
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC MSS PDMA Driver example project
+ *
+ * PDMA and CPU copy throughput benchmark.
+ */
+
+#ifndef PDMA_BENCHMARK_H_
+#define PDMA_BENCHMARK_H_
+
+#include <stdint.h>
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+/*------------------------------------------------------------------------------
+ * Memory regions used by the benchmark. Each region is split in two halves,
+ * the source buffer uses the lower half and the destination buffer the upper
+ * half. A region with a size of 0 is left out of the benchmark.
+ *
+ * The defaults leave the lower part of each DDR alias and of the LIM and
+ * scratchpad free for the application image. Check them against the linker
+ * script in use. FIC0 and FIC1 need memory in the fabric design, so they are
+ * left out unless a size is given.
+ */
+#ifndef BENCH_LIM_BASE
+#define BENCH_LIM_BASE                  0x08020000UL
+#endif
+#ifndef BENCH_LIM_SIZE
+#define BENCH_LIM_SIZE                  0x00020000UL
+#endif
+
+#ifndef BENCH_L2_SCRATCH_BASE
+#define BENCH_L2_SCRATCH_BASE           0x0A020000UL
+#endif
+#ifndef BENCH_L2_SCRATCH_SIZE
+#define BENCH_L2_SCRATCH_SIZE           0x00020000UL
+#endif
+
+#ifndef BENCH_DDR_CACHED_BASE
+#define BENCH_DDR_CACHED_BASE           0x90000000UL
+#endif
+#ifndef BENCH_DDR_CACHED_SIZE
+#define BENCH_DDR_CACHED_SIZE           0x08000000UL
+#endif
+
+#ifndef BENCH_DDR_NON_CACHED_BASE
+#define BENCH_DDR_NON_CACHED_BASE       0xC8000000UL
+#endif
+#ifndef BENCH_DDR_NON_CACHED_SIZE
+#define BENCH_DDR_NON_CACHED_SIZE       0x08000000UL
+#endif
+
+#ifndef BENCH_DDR_WCB_BASE
+#define BENCH_DDR_WCB_BASE              0xD8000000UL
+#endif
+#ifndef BENCH_DDR_WCB_SIZE
+#define BENCH_DDR_WCB_SIZE              0x08000000UL
+#endif
+
+#ifndef BENCH_FIC0_BASE
+#define BENCH_FIC0_BASE                 0x60000000UL
+#endif
+#ifndef BENCH_FIC0_SIZE
+#define BENCH_FIC0_SIZE                 0x00000000UL
+#endif
+
+#ifndef BENCH_FIC1_BASE
+#define BENCH_FIC1_BASE                 0xE0000000UL
+#endif
+#ifndef BENCH_FIC1_SIZE
+#define BENCH_FIC1_SIZE                 0x00000000UL
+#endif
+
+/*------------------------------------------------------------------------------
+ * Transfer sizes run from BENCH_MIN_SIZE to BENCH_MAX_SIZE, multiplying by
+ * BENCH_SIZE_STEP each time. Each measurement is repeated BENCH_ITERATIONS
+ * times and the average is reported.
+ */
+#ifndef BENCH_MIN_SIZE
+#define BENCH_MIN_SIZE                  64UL
+#endif
+#ifndef BENCH_MAX_SIZE
+#define BENCH_MAX_SIZE                  (64UL * 1024UL * 1024UL)
+#endif
+#ifndef BENCH_SIZE_STEP
+#define BENCH_SIZE_STEP                 4UL
+#endif
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS                4UL
+#endif
+
+/*------------------------------------------------------------------------------
+ * Runs the benchmark over every source/destination region pair and prints
+ * the results over this_uart.
+ *
+ * For each pair and size a CPU memcpy() and PDMA copies on 1 to 4 channels
+ * are timed. A transfer on several channels is split into equal 64 byte
+ * aligned parts which are started back to back. The PDMA channels are polled
+ * for completion, their interrupts are not used.
+ *
+ * Each row gives the average mcycle count and mtime count for one copy, and
+ * the bandwidth in MB/s worked out from the mcycle count. The row for the
+ * smallest size gives the latency of a single transfer.
+ *
+ * The source and destination buffers are not checked and no cache
+ * maintenance is done, the figures are for the copy only.
+ */
+void pdma_benchmark_run(mss_uart_instance_t * this_uart);
+
+#endif /* PDMA_BENCHMARK_H_ */
@@ -40,6 +40,47 @@ volatile uint8_t xip_dis = 0x0u;
 volatile static uint8_t g_enh_v_val __attribute__ ((aligned (4))) = 0x0u;
 volatile static uint16_t g_nh_cfg_val __attribute__ ((aligned (4))) = 0x0u;
 
+/*Asynchronous write engine, see Flash_async_write()*/
+#define ASYNC_IDLE              0u
+#define ASYNC_ERASE             1u
+#define ASYNC_PROGRAM           2u
+#define ASYNC_WAIT              3u
+
+#define STATUS_WIP_MASK         0x01u
+#define FLAG_ERASE_SUSPEND_MASK 0x40u
+#define FLAG_READY_MASK         0x80u
+#define FLAG_ERROR_MASK         0x3Au
+
+typedef struct
+{
+    const uint8_t* buf;
+    uint32_t addr;          /*next byte to program*/
+    uint32_t end;
+    uint32_t erase_addr;    /*next sector to erase*/
+    uint32_t erase_end;
+    uint8_t state;
+    uint8_t op;             /*ASYNC_ERASE or ASYNC_PROGRAM while waiting*/
+    uint8_t staged;         /*next page copied into g_async_cmd[g_async_fill]*/
+    uint8_t status_pending; /*status register read in progress*/
+    uint8_t result;
+} flash_async_t;
+
+static flash_async_t g_async = {0};
+/*Command buffers of two pages so the next page is prepared while the
+ * previous one is being programmed*/
+static uint8_t g_async_cmd[2][FLASH_PAGE_SIZE + 4u] __attribute__ ((aligned (4)));
+static uint8_t g_async_fill = 0u;
+static uint32_t g_async_len[2] = {0u};
+volatile static uint8_t g_async_status __attribute__ ((aligned (4))) = 0x0u;
+
+/*Bulk read engine, see Flash_bulk_read()*/
+#define VCR_XIP_DISABLE_MASK    0x08u
+#define XIP_CONFIRM             0x00u
+#define XIP_RELEASE             0xFFu
+
+static uint8_t g_bulk_active = 0u;
+volatile static uint8_t g_bulk_vcr __attribute__ ((aligned (4))) = 0x0u;
+
 #ifdef USE_QSPI_INTERRUPT
 void transfer_status_handler(uint32_t status)
 {
@@ -262,8 +303,23 @@ void Flash_enter_xip
     wait_for_wel(1);
     wait_for_wip(1);
 
-    /*Drive XIP confirmation using FAST read and keeping DQ0 to 0 during idle cycle*/
-    command_buf[0] = MICRON_FAST_READ;
+    /*Drive XIP confirmation using FAST read and keeping DQ0 to 0 during idle cycle.
+      The flash keeps using the read command given here for the XIP reads, so
+      quad I/O fast read is used when the address is sent on DQ[3:0] and quad
+      output fast read when only the data is.*/
+    if (MSS_QSPI_QUAD_EX_RO == g_flash_io_format)
+    {
+        command_buf[0] = MICRON_QUADO_FAST_READ;
+    }
+    else if ((MSS_QSPI_QUAD_FULL == g_flash_io_format) ||
+             (MSS_QSPI_QUAD_EX_RW == g_flash_io_format))
+    {
+        command_buf[0] = MICRON_QUADIO_FAST_READ;
+    }
+    else
+    {
+        command_buf[0] = MICRON_FAST_READ;
+    }
     command_buf[1] = 0x00u;
     command_buf[2] = 0x00u;
     command_buf[3] = 0x00u;
@@ -274,8 +330,7 @@ void Flash_enter_xip
       status register in the IRQ returns the flash memory value instead of
       register value and this will not allow interrupt to be processed properly.*/
     if ((MSS_QSPI_QUAD_FULL == g_flash_io_format) ||
-            (MSS_QSPI_QUAD_EX_RW == g_flash_io_format) ||
-            (MSS_QSPI_QUAD_EX_RO == g_flash_io_format))
+            (MSS_QSPI_QUAD_EX_RW == g_flash_io_format))
     {
         MSS_QSPI_polled_transfer_block(3, command_buf, 1, &temp, 1, 10);
     }
@@ -542,7 +597,8 @@ uint8_t Flash_program
 }
 
 /*Micron sector size is = 64k (65536 bytes).
- * addr parameter value should be any address  within the sector that needs to be erased */
+ * addr parameter value should be any address  within the sector that needs to be erased.
+ * The function returns once the erase has started, Flash_is_busy() tells when it is done */
 void Flash_sector_erase(uint32_t addr)
 {
     uint8_t command_buf[5] __attribute__ ((aligned (4))) = {MICRON_WRITE_ENABLE};
@@ -557,7 +613,7 @@ void Flash_sector_erase(uint32_t addr)
 #endif
     /*This command works for all modes. No Dummy cycles*/
     /*Erase the sector. This will write 1 to all bits*/
-    command_buf[0] = MICRON_DIE_ERASE;
+    command_buf[0] = MICRON_SECTOR_ERASE;
     command_buf[1] = (addr >> 16u) & 0xFFu;
     command_buf[2] = (addr >> 8u) & 0xFFu;
     command_buf[3] = addr & 0xFFu;
@@ -570,6 +626,44 @@ void Flash_sector_erase(uint32_t addr)
 #endif
 }
 
+uint8_t Flash_is_busy(void)
+{
+    uint8_t status __attribute__ ((aligned (4))) = 0u;
+
+    Flash_read_statusreg(&status, 1u);
+
+    return ((0u != (status & STATUS_WIP_MASK)) ? 1u : 0u);
+}
+
+uint8_t Flash_erase_suspend(void)
+{
+    uint8_t command_buf[1] __attribute__ ((aligned (4))) = {MICRON_PROG_ERASE_SUSPEND};
+    uint8_t suspended = 0u;
+
+    if (1u == Flash_is_busy())
+    {
+        /*The device is ready once the erase has stopped, or finished*/
+        MSS_QSPI_polled_transfer_block(0, command_buf, 0, (uint8_t*)0, 0, 0);
+        do{
+            Flash_read_flagstatusreg(&flag_status_reg);
+        }while (0u == (flag_status_reg & FLAG_READY_MASK));
+
+        if (0u != (flag_status_reg & FLAG_ERASE_SUSPEND_MASK))
+        {
+            suspended = 1u;
+        }
+    }
+
+    return suspended;
+}
+
+void Flash_erase_resume(void)
+{
+    uint8_t command_buf[1] __attribute__ ((aligned (4))) = {MICRON_PROG_ERASE_RESUME};
+
+    MSS_QSPI_polled_transfer_block(0, command_buf, 0, (uint8_t*)0, 0, 0);
+}
+
 void Flash_die_erase(void)
 {
 
@@ -600,6 +694,407 @@ void Flash_die_erase(void)
 #endif
 }
 
+/*Copies the next page to be programmed into the free command buffer*/
+static void async_stage_page(void)
+{
+    uint32_t len;
+    uint8_t* cmd = g_async_cmd[g_async_fill];
+
+    if ((0u == g_async.staged) && (g_async.addr < g_async.end))
+    {
+        len = FLASH_PAGE_SIZE - (g_async.addr % FLASH_PAGE_SIZE);
+        if (len > (g_async.end - g_async.addr))
+        {
+            len = g_async.end - g_async.addr;
+        }
+
+        cmd[0] = MICRON_PAGE_PROGRAM;
+        cmd[1] = (g_async.addr >> 16u) & 0xFFu;
+        cmd[2] = (g_async.addr >> 8u) & 0xFFu;
+        cmd[3] = g_async.addr & 0xFFu;
+
+        for (uint32_t idx = 0u; idx < len; idx++)
+        {
+            cmd[4u + idx] = g_async.buf[idx];
+        }
+
+        g_async_len[g_async_fill] = len;
+        g_async.staged = 1u;
+    }
+}
+
+/*Starts a status register read without waiting for it*/
+static void async_status_start(void)
+{
+    const uint8_t command_buf[1] __attribute__ ((aligned (4))) = {MICRON_READ_STATUS_REG};
+
+#ifdef USE_QSPI_INTERRUPT
+    g_rx_complete = 0u;
+    if (0u == MSS_QSPI_irq_transfer_block(0, command_buf, 0,
+                                          (uint8_t*)&g_async_status, 1, 0))
+    {
+        g_async.status_pending = 1u;
+    }
+#else
+    MSS_QSPI_polled_transfer_block(0, command_buf, 0,
+                                   (uint8_t*)&g_async_status, 1, 0);
+    g_async.status_pending = 1u;
+#endif
+}
+
+/*Returns 1 when the status register read started by async_status_start()
+ * has completed*/
+static uint8_t async_status_done(void)
+{
+#ifdef USE_QSPI_INTERRUPT
+    return g_rx_complete;
+#else
+    return 1u;
+#endif
+}
+
+/*Waits for a status register read in progress so the bus can be used*/
+static void async_status_flush(void)
+{
+    if (1u == g_async.status_pending)
+    {
+        while (0u == async_status_done());
+        g_async.status_pending = 0u;
+#ifdef USE_QSPI_INTERRUPT
+        g_rx_complete = 0u;
+#endif
+    }
+}
+
+/*Checks and clears the flag status register after an erase or program*/
+static void async_check_flags(void)
+{
+    const uint8_t command_buf[1] __attribute__ ((aligned (4))) = {MICRON_CLR_FLAG_STATUS_REG};
+
+    Flash_read_flagstatusreg(&flag_status_reg);
+    if (0u != (flag_status_reg & FLAG_ERROR_MASK))
+    {
+        g_async.result = FLASH_ASYNC_ERROR;
+        MSS_QSPI_polled_transfer_block(0, command_buf, 0, (uint8_t*)0, 0, 0);
+    }
+}
+
+uint8_t Flash_async_write
+(
+    const uint8_t* buf,
+    uint32_t wr_addr,
+    uint32_t wr_len,
+    uint8_t erase
+)
+{
+    if ((ASYNC_IDLE != g_async.state) || ((const uint8_t*)0 == buf) ||
+        (0u == wr_len))
+    {
+        return FLASH_ASYNC_ERROR;
+    }
+
+    g_async.buf = buf;
+    g_async.addr = wr_addr;
+    g_async.end = wr_addr + wr_len;
+    g_async.staged = 0u;
+    g_async.status_pending = 0u;
+    g_async.result = FLASH_ASYNC_BUSY;
+
+    if (0u != erase)
+    {
+        g_async.erase_addr = wr_addr & ~(FLASH_SECTOR_SIZE - 1u);
+        g_async.erase_end = g_async.end;
+        g_async.state = ASYNC_ERASE;
+    }
+    else
+    {
+        g_async.erase_addr = 0u;
+        g_async.erase_end = 0u;
+        g_async.state = ASYNC_PROGRAM;
+    }
+
+    return FLASH_ASYNC_BUSY;
+}
+
+uint8_t Flash_async_poll
+(
+    void
+)
+{
+    uint8_t command_buf[4] __attribute__ ((aligned (4))) = {MICRON_WRITE_ENABLE};
+
+    switch (g_async.state)
+    {
+        case ASYNC_ERASE:
+            if (g_async.erase_addr < g_async.erase_end)
+            {
+                MSS_QSPI_polled_transfer_block(0, command_buf, 0, (uint8_t*)0, 0, 0);
+
+                command_buf[0] = MICRON_SECTOR_ERASE;
+                command_buf[1] = (g_async.erase_addr >> 16u) & 0xFFu;
+                command_buf[2] = (g_async.erase_addr >> 8u) & 0xFFu;
+                command_buf[3] = g_async.erase_addr & 0xFFu;
+                MSS_QSPI_polled_transfer_block(3, command_buf, 0, (uint8_t*)0, 0, 0);
+
+                g_async.erase_addr += FLASH_SECTOR_SIZE;
+                g_async.op = ASYNC_ERASE;
+                g_async.state = ASYNC_WAIT;
+                async_status_start();
+            }
+            else
+            {
+                g_async.state = ASYNC_PROGRAM;
+            }
+            break;
+
+        case ASYNC_PROGRAM:
+            async_stage_page();
+            if (1u == g_async.staged)
+            {
+                MSS_QSPI_polled_transfer_block(0, command_buf, 0, (uint8_t*)0, 0, 0);
+                MSS_QSPI_polled_transfer_block(3, g_async_cmd[g_async_fill],
+                                               g_async_len[g_async_fill],
+                                               (uint8_t*)0, 0, 0);
+
+                g_async.buf += g_async_len[g_async_fill];
+                g_async.addr += g_async_len[g_async_fill];
+                g_async_fill ^= 1u;
+                g_async.staged = 0u;
+                g_async.op = ASYNC_PROGRAM;
+                g_async.state = ASYNC_WAIT;
+                async_status_start();
+            }
+            else
+            {
+                g_async.state = ASYNC_IDLE;
+                if (FLASH_ASYNC_BUSY == g_async.result)
+                {
+                    g_async.result = FLASH_ASYNC_DONE;
+                }
+            }
+            break;
+
+        case ASYNC_WAIT:
+            /*Prepare the next page while the device is busy*/
+            async_stage_page();
+
+            if (0u == g_async.status_pending)
+            {
+                async_status_start();
+            }
+            else if (1u == async_status_done())
+            {
+                g_async.status_pending = 0u;
+                if (0u == (g_async_status & STATUS_WIP_MASK))
+                {
+                    async_check_flags();
+                    if (FLASH_ASYNC_ERROR == g_async.result)
+                    {
+                        g_async.state = ASYNC_IDLE;
+                    }
+                    else if (g_async.erase_addr < g_async.erase_end)
+                    {
+                        g_async.state = ASYNC_ERASE;
+                    }
+                    else
+                    {
+                        g_async.state = ASYNC_PROGRAM;
+                    }
+                }
+                else
+                {
+                    async_status_start();
+                }
+            }
+            else
+            {
+                /*status read still in progress*/
+            }
+            break;
+
+        case ASYNC_IDLE:
+        default:
+            break;
+    }
+
+    return g_async.result;
+}
+
+void Flash_async_read
+(
+    uint8_t* buf,
+    uint32_t read_addr,
+    uint32_t read_len
+)
+{
+    uint8_t command_buf[1] __attribute__ ((aligned (4))) = {MICRON_PROG_ERASE_SUSPEND};
+    uint8_t suspended = 0u;
+
+    async_status_flush();
+
+    if (ASYNC_WAIT == g_async.state)
+    {
+        if (ASYNC_ERASE == g_async.op)
+        {
+            /*Suspend the erase, the device is ready once it has stopped*/
+            MSS_QSPI_polled_transfer_block(0, command_buf, 0, (uint8_t*)0, 0, 0);
+            do{
+                Flash_read_flagstatusreg(&flag_status_reg);
+            }while (0u == (flag_status_reg & FLAG_READY_MASK));
+
+            if (0u != (flag_status_reg & FLAG_ERASE_SUSPEND_MASK))
+            {
+                suspended = 1u;
+            }
+        }
+        else
+        {
+            /*A page program takes less time than suspending it*/
+            wait_for_wip(1);
+        }
+    }
+
+    Flash_read(buf, read_addr, read_len);
+
+    if (1u == suspended)
+    {
+        command_buf[0] = MICRON_PROG_ERASE_RESUME;
+        MSS_QSPI_polled_transfer_block(0, command_buf, 0, (uint8_t*)0, 0, 0);
+    }
+}
+
+/*Number of dummy clocks left after the mode byte which holds the XIP
+ * confirmation bit. The fast read needs 10 dummy clocks in quad mode and 8 in
+ * the other modes, the mode byte takes 2, 4 or 8 of them.*/
+static uint8_t bulk_idle_cycles(void)
+{
+    uint8_t cycles = 0u;
+
+    if (MSS_QSPI_QUAD_FULL == g_flash_io_format)
+    {
+        cycles = 8u;
+    }
+    else if (MSS_QSPI_DUAL_FULL == g_flash_io_format)
+    {
+        cycles = 4u;
+    }
+    else
+    {
+        cycles = 0u;
+    }
+
+    return cycles;
+}
+
+static void bulk_start(void)
+{
+    uint8_t command_buf[4] __attribute__ ((aligned (4))) = {MICRON_READ_V_CONFIG_REG};
+
+    MSS_QSPI_polled_transfer_block(0, command_buf, 0, (uint8_t*)&g_bulk_vcr, 1, 0);
+
+    command_buf[0] = MICRON_WRITE_ENABLE;
+    MSS_QSPI_polled_transfer_block(0, command_buf, 0, (uint8_t*)0, 0, 0);
+
+    command_buf[0] = MICRON_WR_V_CONFIG_REG;
+    command_buf[1] = g_bulk_vcr & (uint8_t)~VCR_XIP_DISABLE_MASK;
+    MSS_QSPI_polled_transfer_block(0, command_buf, 1, (uint8_t*)0, 0, 0);
+    wait_for_wel(1);
+    wait_for_wip(1);
+}
+
+static void bulk_read_frame
+(
+    uint8_t* buf,
+    uint32_t read_addr,
+    uint32_t read_len
+)
+{
+    uint8_t command_buf[8] __attribute__ ((aligned (4))) = {0};
+
+    if (0u == g_bulk_active)
+    {
+        /*Full fast read, the cleared confirmation bit keeps the flash memory
+          in continuous read mode at the end of the frame*/
+        command_buf[0] = MICRON_FAST_READ;
+        command_buf[1] = (read_addr >> 16u) & 0xFFu;
+        command_buf[2] = (read_addr >> 8u) & 0xFFu;
+        command_buf[3] = read_addr & 0xFFu;
+        command_buf[4] = XIP_CONFIRM;
+        MSS_QSPI_polled_transfer_block(3, command_buf, 1, buf, read_len,
+                                       bulk_idle_cycles());
+        g_bulk_active = 1u;
+    }
+    else
+    {
+        /*No command phase. The controller always starts a frame with one
+          byte before the address, so the address bytes are given as that
+          byte and two address bytes.*/
+        command_buf[0] = (read_addr >> 16u) & 0xFFu;
+        command_buf[1] = (read_addr >> 8u) & 0xFFu;
+        command_buf[2] = read_addr & 0xFFu;
+        command_buf[3] = XIP_CONFIRM;
+        MSS_QSPI_polled_transfer_block(2, command_buf, 1, buf, read_len,
+                                       bulk_idle_cycles());
+    }
+}
+
+void Flash_bulk_read
+(
+    uint8_t* buf,
+    uint32_t read_addr,
+    uint32_t read_len
+)
+{
+    uint32_t len;
+
+    if ((0u == g_bulk_active) && (0u != read_len))
+    {
+        bulk_start();
+    }
+
+    while (0u != read_len)
+    {
+        len = FLASH_BULK_SEGMENT_SIZE - (read_addr % FLASH_BULK_SEGMENT_SIZE);
+        if (len > read_len)
+        {
+            len = read_len;
+        }
+
+        bulk_read_frame(buf, read_addr, len);
+
+        buf += len;
+        read_addr += len;
+        read_len -= len;
+    }
+}
+
+void Flash_bulk_read_end
+(
+    void
+)
+{
+    uint8_t command_buf[8] __attribute__ ((aligned (4))) = {0};
+    uint8_t temp __attribute__ ((aligned (4))) = 0u;
+
+    if (1u == g_bulk_active)
+    {
+        /*An address-only read with the confirmation bit set releases the
+          flash memory from continuous read mode*/
+        command_buf[3] = XIP_RELEASE;
+        MSS_QSPI_polled_transfer_block(2, command_buf, 1, &temp, 1,
+                                       bulk_idle_cycles());
+        g_bulk_active = 0u;
+
+        command_buf[0] = MICRON_WRITE_ENABLE;
+        MSS_QSPI_polled_transfer_block(0, command_buf, 0, (uint8_t*)0, 0, 0);
+
+        command_buf[0] = MICRON_WR_V_CONFIG_REG;
+        command_buf[1] = g_bulk_vcr;
+        MSS_QSPI_polled_transfer_block(0, command_buf, 1, (uint8_t*)0, 0, 0);
+        wait_for_wel(1);
+        wait_for_wip(1);
+    }
+}
 
 #ifdef __cplusplus
 }
@@ -82,6 +82,17 @@ uint8_t Flash_program
 void Flash_sector_erase(uint32_t addr);
 void Flash_die_erase(void);
 
+/*Flash_is_busy() returns 1 while an erase or program is in progress.
+ *
+ * Flash_erase_suspend() suspends an erase started by Flash_sector_erase(), so
+ * that the other sectors can be read, and returns 1 if it was suspended, or 0
+ * if no erase was in progress. An erase it suspended is carried on with
+ * Flash_erase_resume().
+ */
+uint8_t Flash_is_busy(void);
+uint8_t Flash_erase_suspend(void);
+void Flash_erase_resume(void);
+
 void Flash_read_flagstatusreg
 (
     uint8_t* rd_buf
@@ -117,6 +128,80 @@ mss_qspi_io_format Flash_probe_io_format
     void
 );
 
+/*Asynchronous write engine.
+ *
+ * Flash_async_write() starts a write of wr_len bytes from buf to wr_addr,
+ * optionally erasing the 64KB sectors covering it first, and returns straight
+ * away. Flash_async_poll() must then be called regularly, for example from the
+ * main loop, until it no longer returns FLASH_ASYNC_BUSY. Each call issues the
+ * next erase or page program once the device has finished the previous one, and
+ * copies the next page into a spare command buffer while the device is busy so
+ * it can be sent as soon as the device is ready. With USE_QSPI_INTERRUPT
+ * defined the status register reads use MSS_QSPI_irq_transfer_block() so the
+ * CPU does not wait for them. buf must not be changed until the write is
+ * complete.
+ *
+ * Flash_async_read() can be used while a write is in progress. An erase in
+ * progress is suspended for the read and resumed after it, a page program is
+ * left to finish first. Flash_read() must not be used while a write is in
+ * progress.
+ */
+#define FLASH_PAGE_SIZE                       256u
+#define FLASH_SECTOR_SIZE                     65536u
+
+#define FLASH_ASYNC_DONE                      0u
+#define FLASH_ASYNC_BUSY                      1u
+#define FLASH_ASYNC_ERROR                     2u
+
+uint8_t Flash_async_write
+(
+    const uint8_t* buf,
+    uint32_t wr_addr,
+    uint32_t wr_len,
+    uint8_t erase
+);
+
+uint8_t Flash_async_poll
+(
+    void
+);
+
+void Flash_async_read
+(
+    uint8_t* buf,
+    uint32_t read_addr,
+    uint32_t read_len
+);
+
+/*Bulk read engine.
+ *
+ * Flash_bulk_read() reads read_len bytes using the continuous read (XIP) mode
+ * of the flash memory. The first call enables XIP in the volatile
+ * configuration register and sends a fast read with the XIP confirmation bit
+ * cleared, which leaves the flash memory waiting for the next address. The
+ * following calls send only the address, mode and data phases, without the
+ * command byte. Each read is sent as one QSPI frame, split only where it
+ * crosses a 16MB boundary of the 3 byte address space, so large reads run at
+ * the full SPI clock rate. buf must be 4 byte aligned.
+ *
+ * The flash memory does not accept other commands in continuous read mode.
+ * Flash_bulk_read_end() must be called after the last bulk read and before
+ * any other function of this driver is used.
+ */
+#define FLASH_BULK_SEGMENT_SIZE               0x01000000u
+
+void Flash_bulk_read
+(
+    uint8_t* buf,
+    uint32_t read_addr,
+    uint32_t read_len
+);
+
+void Flash_bulk_read_end
+(
+    void
+);
+
 static inline void Flash_init_normal(void)
 {
     qspi_config.clk_div =  MSS_QSPI_CLK_DIV_2;
@@ -213,6 +298,9 @@ static inline void Flash_init_quad(void)
 #define MICRON_SECTOR_ERASE                  0xD8
 #define MICRON_DIE_ERASE                     0xC4
 
+#define MICRON_PROG_ERASE_SUSPEND            0x75
+#define MICRON_PROG_ERASE_RESUME             0x7A
+
 #define MICRON_4BYTE_SECTOR_ERASE            0xDC
 #define MICRON_4BYTE_4KB_SUBSECTOR_ERASE     0x21
 #define MICRON_4BYTE_32KB_SUBSECTOR_ERASE    0x5C
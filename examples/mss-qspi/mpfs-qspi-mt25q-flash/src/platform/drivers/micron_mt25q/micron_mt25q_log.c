@@ -0,0 +1,1114 @@
+/***************************************************************************//**
+ * Copyright 2019 Microchip Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Log structured, wear levelled record store for MICRON_MT25Q QSPI flash
+ * memory, see micron_mt25q_log.h.
+ *
+ * Sector layout, all fields little endian:
+ *
+ *   page 0           sector header: magic, sequence, erase count, check
+ *   pages 1 to n     records, each an 8 byte header (key, length, check) and
+ *                    the data padded to 4 bytes. An erased header ends them.
+ *   last pages       summary: header (magic, count, check) and count 8 byte
+ *                    entries (key, length, offset of the record in the sector)
+ *
+ * A record of length 0 is a deletion. It is kept in the index, and copied by
+ * the garbage collection, until the sector holding it is the oldest one in
+ * the log, so that a mount does not find an older version of the record in
+ * an older sector.
+ */
+
+#include <string.h>
+#include "drivers/micron_mt25q/micron_mt25q_log.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LOG_SECTOR_MAGIC        0x474F4C4Du     /*"MLOG"*/
+#define LOG_SUMMARY_MAGIC       0x4D4D5553u     /*"SUMM"*/
+
+#define LOG_FLAG_ERROR_MASK     0x3Au           /*flag status register*/
+
+#define LOG_NONE                0xFFFFFFFFu
+#define LOG_ERASED_KEY          0xFFFFu
+
+#define LOG_HDR_SIZE            8u
+#define LOG_DATA_OFFSET         FLASH_PAGE_SIZE
+#define LOG_SUMMARY_OFFSET      (FLASH_SECTOR_SIZE - \
+                                 (FLASH_LOG_SUMMARY_PAGES * FLASH_PAGE_SIZE))
+#define LOG_SUMMARY_HDR_SIZE    16u
+#define LOG_SUMMARY_SIZE        (FLASH_LOG_SUMMARY_PAGES * FLASH_PAGE_SIZE)
+#define LOG_SUMMARY_ENTRIES     ((LOG_SUMMARY_SIZE - LOG_SUMMARY_HDR_SIZE) / 8u)
+#define LOG_BUFFER_SIZE         (FLASH_LOG_BUFFER_PAGES * FLASH_PAGE_SIZE)
+
+#define LOG_RECORD_SIZE(len)    (LOG_HDR_SIZE + (((uint32_t)(len) + 3u) & ~3u))
+
+/*The work buffer holds a record, or a summary*/
+#if ((FLASH_LOG_MAX_RECORD + LOG_HDR_SIZE) > LOG_SUMMARY_SIZE)
+#define LOG_WORK_SIZE           (FLASH_LOG_MAX_RECORD + LOG_HDR_SIZE)
+#else
+#define LOG_WORK_SIZE           LOG_SUMMARY_SIZE
+#endif
+
+#if (FLASH_LOG_MAX_KEYS > LOG_ERASED_KEY)
+#error FLASH_LOG_MAX_KEYS is too large
+#endif
+
+#if ((FLASH_LOG_MAX_RECORD + LOG_HDR_SIZE + 3u) > (LOG_SUMMARY_OFFSET - LOG_DATA_OFFSET))
+#error FLASH_LOG_MAX_RECORD does not fit in a sector
+#endif
+
+#if (FLASH_LOG_MAX_SECTORS > 256u)
+#error FLASH_LOG_MAX_SECTORS is too large
+#endif
+
+#if (FLASH_LOG_BUFFER_PAGES < 1u)
+#error FLASH_LOG_BUFFER_PAGES must be at least 1
+#endif
+
+/*Sector states*/
+#define LOG_FREE                0u      /*erased*/
+#define LOG_HEAD                1u      /*being written*/
+#define LOG_CLOSED              2u      /*full, or not to be written again*/
+#define LOG_DIRTY               3u      /*to be erased*/
+#define LOG_ERASING             4u
+
+typedef struct
+{
+    uint32_t addr;              /*record header, LOG_NONE if no record*/
+    uint16_t length;
+    uint16_t sector;
+} log_index_t;
+
+typedef struct
+{
+    uint32_t sequence;
+    uint32_t erase_count;
+    uint32_t live;              /*bytes of current records*/
+    uint8_t state;
+} log_sector_t;
+
+typedef struct
+{
+    uint32_t base;
+    uint32_t sector_count;
+    uint8_t mounted;
+    uint32_t head;              /*sector being written, LOG_NONE if none*/
+    uint32_t head_offset;       /*next record in the head sector*/
+    uint32_t next_sequence;
+    uint32_t free_count;
+    uint32_t erasing;           /*sector being erased, LOG_NONE if none*/
+    uint32_t victim;            /*sector being collected, LOG_NONE if none*/
+    uint32_t gc_key;            /*next key to look at in the victim*/
+    uint32_t buf_addr;          /*flash address of g_log_buf[0]*/
+    uint32_t buf_fill;
+    flash_log_stats_t stats;
+} log_state_t;
+
+static log_state_t g_log;
+static log_sector_t g_log_sector[FLASH_LOG_MAX_SECTORS];
+static log_index_t g_log_index[FLASH_LOG_MAX_KEYS];
+static uint8_t g_log_buf[LOG_BUFFER_SIZE] __attribute__ ((aligned (4)));
+static uint8_t g_log_work[LOG_WORK_SIZE] __attribute__ ((aligned (4)));
+
+static uint32_t log_get32(const uint8_t* p)
+{
+    return ((uint32_t)p[0] | ((uint32_t)p[1] << 8u) |
+            ((uint32_t)p[2] << 16u) | ((uint32_t)p[3] << 24u));
+}
+
+static uint16_t log_get16(const uint8_t* p)
+{
+    return (uint16_t)((uint32_t)p[0] | ((uint32_t)p[1] << 8u));
+}
+
+static void log_put32(uint8_t* p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8u);
+    p[2] = (uint8_t)(value >> 16u);
+    p[3] = (uint8_t)(value >> 24u);
+}
+
+static void log_put16(uint8_t* p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8u);
+}
+
+/*FNV-1a*/
+static uint32_t log_check(uint32_t hash, const uint8_t* p, uint32_t len)
+{
+    uint32_t idx;
+
+    for (idx = 0u; idx < len; idx++)
+    {
+        hash = (hash ^ p[idx]) * 16777619u;
+    }
+
+    return hash;
+}
+
+static uint32_t log_record_check(uint16_t key, uint16_t len, const uint8_t* data)
+{
+    uint8_t hdr[4];
+
+    log_put16(&hdr[0], key);
+    log_put16(&hdr[2], len);
+
+    return log_check(log_check(2166136261u, hdr, 4u), data, len);
+}
+
+static uint32_t log_sector_addr(uint32_t sector)
+{
+    return (g_log.base + (sector * FLASH_SECTOR_SIZE));
+}
+
+static uint32_t log_index_size(const log_index_t* entry)
+{
+    return LOG_RECORD_SIZE(entry->length);
+}
+
+static void log_erase_wait(void)
+{
+    if (LOG_NONE != g_log.erasing)
+    {
+        while (1u == Flash_is_busy())
+        {
+            ;
+        }
+
+        g_log_sector[g_log.erasing].state = LOG_FREE;
+        g_log.free_count++;
+        g_log.stats.sectors_erased++;
+        g_log.erasing = LOG_NONE;
+    }
+}
+
+/*Outside of the store there is no erase in progress, see Flash_log_idle()*/
+static uint8_t log_program(uint8_t* buf, uint32_t addr, uint32_t len)
+{
+    uint8_t flags;
+
+    log_erase_wait();
+    flags = Flash_program(buf, addr, len);
+
+    return ((0u != (flags & LOG_FLAG_ERROR_MASK)) ? FLASH_LOG_ERROR : FLASH_LOG_OK);
+}
+
+/*Reads from the flash memory, suspending an erase in progress. Data which is
+ * still in g_log_buf is copied from there.*/
+static void log_read(uint8_t* buf, uint32_t addr, uint32_t len)
+{
+    uint32_t flash_len = len;
+    uint32_t offset;
+    uint8_t suspended = 0u;
+
+    if (((addr + len) > g_log.buf_addr) && (addr < (g_log.buf_addr + g_log.buf_fill)))
+    {
+        flash_len = (addr > g_log.buf_addr) ? 0u : (g_log.buf_addr - addr);
+    }
+
+    if (0u != flash_len)
+    {
+        if (LOG_NONE != g_log.erasing)
+        {
+            suspended = Flash_erase_suspend();
+        }
+
+        Flash_read(buf, addr, flash_len);
+
+        if (1u == suspended)
+        {
+            Flash_erase_resume();
+        }
+    }
+
+    if (flash_len < len)
+    {
+        offset = (addr + flash_len) - g_log.buf_addr;
+        memcpy(&buf[flash_len], &g_log_buf[offset], len - flash_len);
+    }
+}
+
+/*Programs the full pages of g_log_buf, and the partial one too if all is set.
+ * The partial page stays in the buffer and is programmed again, with what
+ * follows, when it is full.*/
+static uint8_t log_flush(uint8_t all)
+{
+    uint8_t status = FLASH_LOG_OK;
+    uint32_t full = g_log.buf_fill / FLASH_PAGE_SIZE;
+    uint32_t pages = full;
+    uint32_t page;
+
+    if ((1u == all) && (0u != (g_log.buf_fill % FLASH_PAGE_SIZE)))
+    {
+        pages++;
+    }
+
+    for (page = 0u; (page < pages) && (FLASH_LOG_OK == status); page++)
+    {
+        status = log_program(&g_log_buf[page * FLASH_PAGE_SIZE],
+                             g_log.buf_addr + (page * FLASH_PAGE_SIZE),
+                             FLASH_PAGE_SIZE);
+    }
+
+    if ((FLASH_LOG_OK == status) && (0u != full))
+    {
+        g_log.buf_fill -= full * FLASH_PAGE_SIZE;
+        memmove(g_log_buf, &g_log_buf[full * FLASH_PAGE_SIZE], g_log.buf_fill);
+        memset(&g_log_buf[g_log.buf_fill], 0xFF, LOG_BUFFER_SIZE - g_log.buf_fill);
+        g_log.buf_addr += full * FLASH_PAGE_SIZE;
+    }
+
+    return status;
+}
+
+static uint8_t log_buffer_put(const uint8_t* data, uint32_t len)
+{
+    uint8_t status = FLASH_LOG_OK;
+    uint32_t count;
+
+    while ((0u != len) && (FLASH_LOG_OK == status))
+    {
+        if (LOG_BUFFER_SIZE == g_log.buf_fill)
+        {
+            status = log_flush(0u);
+        }
+
+        count = LOG_BUFFER_SIZE - g_log.buf_fill;
+        if (count > len)
+        {
+            count = len;
+        }
+
+        memcpy(&g_log_buf[g_log.buf_fill], data, count);
+        g_log.buf_fill += count;
+        data += count;
+        len -= count;
+    }
+
+    return status;
+}
+
+/*Writes the summary of the head sector and closes it. With too many records
+ * for the summary, the sector is scanned at mount instead.*/
+static uint8_t log_close_head(void)
+{
+    uint8_t status;
+    uint32_t count = 0u;
+    uint32_t key;
+    uint32_t size;
+    uint32_t page;
+    uint32_t addr;
+    uint8_t* entry;
+
+    status = log_flush(1u);
+
+    memset(g_log_work, 0xFF, LOG_SUMMARY_SIZE);
+    for (key = 0u; (key < FLASH_LOG_MAX_KEYS) && (count <= LOG_SUMMARY_ENTRIES); key++)
+    {
+        if ((LOG_NONE != g_log_index[key].addr) && (g_log.head == g_log_index[key].sector))
+        {
+            if (count < LOG_SUMMARY_ENTRIES)
+            {
+                entry = &g_log_work[LOG_SUMMARY_HDR_SIZE + (count * 8u)];
+                log_put16(&entry[0], (uint16_t)key);
+                log_put16(&entry[2], g_log_index[key].length);
+                log_put32(&entry[4], g_log_index[key].addr - log_sector_addr(g_log.head));
+            }
+            count++;
+        }
+    }
+
+    if ((FLASH_LOG_OK == status) && (count <= LOG_SUMMARY_ENTRIES))
+    {
+        size = log_check(2166136261u, &g_log_work[LOG_SUMMARY_HDR_SIZE], count * 8u);
+        log_put32(&g_log_work[0], LOG_SUMMARY_MAGIC);
+        log_put32(&g_log_work[4], count);
+        log_put32(&g_log_work[8], size);
+
+        /*The page holding the summary header is programmed last*/
+        size = LOG_SUMMARY_HDR_SIZE + (count * 8u);
+        addr = log_sector_addr(g_log.head) + LOG_SUMMARY_OFFSET;
+        for (page = (size - 1u) / FLASH_PAGE_SIZE; (page > 0u) && (FLASH_LOG_OK == status); page--)
+        {
+            status = log_program(&g_log_work[page * FLASH_PAGE_SIZE],
+                                 addr + (page * FLASH_PAGE_SIZE), FLASH_PAGE_SIZE);
+        }
+
+        if (FLASH_LOG_OK == status)
+        {
+            status = log_program(g_log_work, addr, FLASH_PAGE_SIZE);
+        }
+    }
+
+    g_log_sector[g_log.head].state = LOG_CLOSED;
+    g_log.head = LOG_NONE;
+
+    return status;
+}
+
+/*Starts a new head sector, the free one erased the fewest times. Writes from
+ * the application leave FLASH_LOG_GC_FREE_SECTORS - 1 sectors free.*/
+static uint8_t log_open_head(uint8_t gc)
+{
+    uint8_t status = FLASH_LOG_FULL;
+    uint8_t hdr[16] __attribute__ ((aligned (4)));
+    uint32_t sector;
+    uint32_t best = LOG_NONE;
+    uint32_t keep = (1u == gc) ? 0u : (FLASH_LOG_GC_FREE_SECTORS - 1u);
+
+    for (sector = 0u; sector < g_log.sector_count; sector++)
+    {
+        if ((LOG_FREE == g_log_sector[sector].state) &&
+            ((LOG_NONE == best) ||
+             (g_log_sector[sector].erase_count < g_log_sector[best].erase_count)))
+        {
+            best = sector;
+        }
+    }
+
+    if ((LOG_NONE != best) && (g_log.free_count > keep))
+    {
+        log_put32(&hdr[0], LOG_SECTOR_MAGIC);
+        log_put32(&hdr[4], g_log.next_sequence);
+        log_put32(&hdr[8], g_log_sector[best].erase_count);
+        log_put32(&hdr[12], ~(LOG_SECTOR_MAGIC ^ g_log.next_sequence ^
+                              g_log_sector[best].erase_count));
+
+        status = log_program(hdr, log_sector_addr(best), sizeof(hdr));
+        if (FLASH_LOG_OK == status)
+        {
+            g_log_sector[best].state = LOG_HEAD;
+            g_log_sector[best].sequence = g_log.next_sequence;
+            g_log_sector[best].live = 0u;
+            g_log.next_sequence++;
+            g_log.free_count--;
+            g_log.head = best;
+            g_log.head_offset = LOG_DATA_OFFSET;
+            g_log.buf_addr = log_sector_addr(best) + LOG_DATA_OFFSET;
+            g_log.buf_fill = 0u;
+            memset(g_log_buf, 0xFF, LOG_BUFFER_SIZE);
+        }
+        else
+        {
+            /*Not to be written, erased again by the garbage collection*/
+            g_log_sector[best].state = LOG_DIRTY;
+            g_log.free_count--;
+        }
+    }
+
+    return status;
+}
+
+/*Makes room in the head sector for a record of size bytes*/
+static uint8_t log_make_room(uint32_t size, uint8_t gc)
+{
+    uint8_t status = FLASH_LOG_OK;
+
+    if ((LOG_NONE != g_log.head) && ((g_log.head_offset + size) > LOG_SUMMARY_OFFSET))
+    {
+        status = log_close_head();
+    }
+
+    if ((FLASH_LOG_OK == status) && (LOG_NONE == g_log.head))
+    {
+        status = log_open_head(gc);
+    }
+
+    return status;
+}
+
+/*Replaces the version of key in the index, and updates the live counts*/
+static void log_index_set(uint16_t key, uint32_t sector, uint32_t addr, uint16_t len)
+{
+    log_index_t* entry = &g_log_index[key];
+
+    if (LOG_NONE != entry->addr)
+    {
+        g_log_sector[entry->sector].live -= log_index_size(entry);
+    }
+
+    entry->addr = addr;
+    entry->length = len;
+    entry->sector = (uint16_t)sector;
+
+    if (LOG_NONE != addr)
+    {
+        g_log_sector[sector].live += log_index_size(entry);
+    }
+}
+
+/*Appends a record to the head sector, which has room for it*/
+static uint8_t log_append(uint16_t key, const uint8_t* data, uint16_t len)
+{
+    uint8_t status;
+    uint8_t hdr[LOG_HDR_SIZE];
+    uint8_t pad[4] = {0u, 0u, 0u, 0u};
+    uint32_t addr = log_sector_addr(g_log.head) + g_log.head_offset;
+
+    log_put16(&hdr[0], key);
+    log_put16(&hdr[2], len);
+    log_put32(&hdr[4], log_record_check(key, len, data));
+
+    status = log_buffer_put(hdr, LOG_HDR_SIZE);
+    if (FLASH_LOG_OK == status)
+    {
+        status = log_buffer_put(data, len);
+    }
+
+    if (FLASH_LOG_OK == status)
+    {
+        status = log_buffer_put(pad, LOG_RECORD_SIZE(len) - LOG_HDR_SIZE - len);
+    }
+
+    /*The space is used whatever happened*/
+    g_log.head_offset += LOG_RECORD_SIZE(len);
+
+    if (FLASH_LOG_OK == status)
+    {
+        log_index_set(key, g_log.head, addr, len);
+    }
+
+    return status;
+}
+
+/*Picks the sector to collect, if one needs collecting*/
+static uint32_t log_pick_victim(void)
+{
+    uint32_t sector;
+    uint32_t victim = LOG_NONE;
+    uint32_t coldest = LOG_NONE;
+    uint32_t max_erase = 0u;
+    log_sector_t* s;
+
+    for (sector = 0u; sector < g_log.sector_count; sector++)
+    {
+        s = &g_log_sector[sector];
+
+        if (s->erase_count > max_erase)
+        {
+            max_erase = s->erase_count;
+        }
+
+        if (LOG_DIRTY == s->state)
+        {
+            victim = sector;
+        }
+        else if ((LOG_CLOSED == s->state) && (LOG_NONE == victim))
+        {
+            if ((LOG_NONE == coldest) || (s->erase_count < g_log_sector[coldest].erase_count))
+            {
+                coldest = sector;
+            }
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    if ((LOG_NONE == victim) && (g_log.free_count <= FLASH_LOG_GC_FREE_SECTORS))
+    {
+        for (sector = 0u; sector < g_log.sector_count; sector++)
+        {
+            s = &g_log_sector[sector];
+
+            if ((LOG_CLOSED == s->state) &&
+                ((LOG_NONE == victim) || (s->live < g_log_sector[victim].live) ||
+                 ((s->live == g_log_sector[victim].live) &&
+                  (s->erase_count < g_log_sector[victim].erase_count))))
+            {
+                victim = sector;
+            }
+        }
+
+        /*Moving a full sector frees nothing*/
+        if ((LOG_NONE != victim) &&
+            (g_log_sector[victim].live >= (LOG_SUMMARY_OFFSET - LOG_DATA_OFFSET)))
+        {
+            victim = LOG_NONE;
+        }
+    }
+
+    /*Static wear levelling, only with sectors to spare*/
+    if ((LOG_NONE == victim) && (LOG_NONE != coldest) &&
+        (g_log.free_count > FLASH_LOG_GC_FREE_SECTORS) &&
+        ((max_erase - g_log_sector[coldest].erase_count) > FLASH_LOG_WEAR_DELTA))
+    {
+        victim = coldest;
+    }
+
+    return victim;
+}
+
+/*Is sector the oldest one in the log?*/
+static uint8_t log_is_oldest(uint32_t sector)
+{
+    uint8_t oldest = 1u;
+    uint32_t idx;
+
+    for (idx = 0u; idx < g_log.sector_count; idx++)
+    {
+        if (((LOG_CLOSED == g_log_sector[idx].state) || (LOG_HEAD == g_log_sector[idx].state)) &&
+            (g_log_sector[idx].sequence < g_log_sector[sector].sequence))
+        {
+            oldest = 0u;
+        }
+    }
+
+    return oldest;
+}
+
+/*One step of the garbage collection: copies one record out of the victim, or
+ * starts erasing it*/
+static uint8_t log_gc_step(void)
+{
+    uint8_t status = FLASH_LOG_OK;
+    log_index_t* entry = (log_index_t*)0;
+    uint32_t size;
+
+    if (LOG_NONE == g_log.victim)
+    {
+        g_log.victim = log_pick_victim();
+        g_log.gc_key = 0u;
+    }
+
+    if (LOG_NONE != g_log.victim)
+    {
+        if (LOG_DIRTY != g_log_sector[g_log.victim].state)
+        {
+            while ((g_log.gc_key < FLASH_LOG_MAX_KEYS) && ((log_index_t*)0 == entry))
+            {
+                if ((LOG_NONE != g_log_index[g_log.gc_key].addr) &&
+                    (g_log.victim == g_log_index[g_log.gc_key].sector))
+                {
+                    entry = &g_log_index[g_log.gc_key];
+                }
+                else
+                {
+                    g_log.gc_key++;
+                }
+            }
+        }
+
+        if ((log_index_t*)0 != entry)
+        {
+            if ((0u == entry->length) && (1u == log_is_oldest(g_log.victim)))
+            {
+                log_index_set((uint16_t)g_log.gc_key, 0u, LOG_NONE, 0u);
+            }
+            else
+            {
+                size = log_index_size(entry);
+                status = log_make_room(size, 1u);
+                if (FLASH_LOG_OK == status)
+                {
+                    log_read(g_log_work, entry->addr + LOG_HDR_SIZE, entry->length);
+                    status = log_append((uint16_t)g_log.gc_key, g_log_work, entry->length);
+                    g_log.stats.gc_bytes_copied += size;
+                }
+            }
+            g_log.gc_key++;
+        }
+        else
+        {
+            /*The copies must be on the flash memory before the erase*/
+            status = log_flush(1u);
+            if (FLASH_LOG_OK == status)
+            {
+                log_erase_wait();
+                Flash_sector_erase(log_sector_addr(g_log.victim));
+                g_log_sector[g_log.victim].state = LOG_ERASING;
+                g_log_sector[g_log.victim].erase_count++;
+                g_log_sector[g_log.victim].live = 0u;
+                g_log.erasing = g_log.victim;
+                g_log.victim = LOG_NONE;
+            }
+        }
+    }
+
+    return status;
+}
+
+/*Reads a record at mount, returns 1 if it is valid*/
+static uint8_t log_scan_record(uint32_t addr, uint32_t end, uint16_t* key, uint16_t* len)
+{
+    uint8_t valid = 0u;
+
+    Flash_read(g_log_work, addr, LOG_HDR_SIZE);
+    *key = log_get16(&g_log_work[0]);
+    *len = log_get16(&g_log_work[2]);
+
+    if ((*len <= FLASH_LOG_MAX_RECORD) && ((addr + LOG_RECORD_SIZE(*len)) <= end))
+    {
+        Flash_read(&g_log_work[LOG_HDR_SIZE], addr + LOG_HDR_SIZE, *len);
+        if (log_get32(&g_log_work[4]) ==
+            log_record_check(*key, *len, &g_log_work[LOG_HDR_SIZE]))
+        {
+            valid = 1u;
+        }
+    }
+
+    return valid;
+}
+
+/*Reads the summary of a sector into the index, returns 1 if it was valid*/
+static uint8_t log_mount_summary(uint32_t sector)
+{
+    uint8_t valid = 0u;
+    uint32_t addr = log_sector_addr(sector);
+    uint32_t count;
+    uint32_t idx;
+    uint16_t key;
+    uint8_t* entry;
+
+    Flash_read(g_log_work, addr + LOG_SUMMARY_OFFSET, LOG_SUMMARY_HDR_SIZE);
+    count = log_get32(&g_log_work[4]);
+
+    if ((LOG_SUMMARY_MAGIC == log_get32(&g_log_work[0])) && (count <= LOG_SUMMARY_ENTRIES))
+    {
+        Flash_read(&g_log_work[LOG_SUMMARY_HDR_SIZE],
+                   addr + LOG_SUMMARY_OFFSET + LOG_SUMMARY_HDR_SIZE, count * 8u);
+
+        if (log_get32(&g_log_work[8]) ==
+            log_check(2166136261u, &g_log_work[LOG_SUMMARY_HDR_SIZE], count * 8u))
+        {
+            valid = 1u;
+            for (idx = 0u; idx < count; idx++)
+            {
+                entry = &g_log_work[LOG_SUMMARY_HDR_SIZE + (idx * 8u)];
+                key = log_get16(&entry[0]);
+                if (key < FLASH_LOG_MAX_KEYS)
+                {
+                    log_index_set(key, sector, addr + log_get32(&entry[4]),
+                                  log_get16(&entry[2]));
+                }
+            }
+        }
+    }
+
+    return valid;
+}
+
+/*Scans the records of a sector into the index, returns the offset after the
+ * last valid one. *torn is set if the records end in a bad one rather than in
+ * erased flash.*/
+static uint32_t log_mount_scan(uint32_t sector, uint8_t* torn)
+{
+    uint32_t addr = log_sector_addr(sector);
+    uint32_t offset = LOG_DATA_OFFSET;
+    uint8_t done = 0u;
+    uint16_t key;
+    uint16_t len;
+
+    *torn = 0u;
+
+    while ((0u == done) && ((offset + LOG_HDR_SIZE) <= LOG_SUMMARY_OFFSET))
+    {
+        if (1u == log_scan_record(addr + offset, addr + LOG_SUMMARY_OFFSET, &key, &len))
+        {
+            if (key < FLASH_LOG_MAX_KEYS)
+            {
+                log_index_set(key, sector, addr + offset, len);
+            }
+            offset += LOG_RECORD_SIZE(len);
+        }
+        else
+        {
+            done = 1u;
+            if ((LOG_ERASED_KEY != key) || (LOG_ERASED_KEY != len))
+            {
+                *torn = 1u;
+            }
+        }
+    }
+
+    return offset;
+}
+
+static uint8_t log_params_valid(uint32_t base_addr, uint32_t sector_count)
+{
+    return (((0u == (base_addr % FLASH_SECTOR_SIZE)) &&
+             (sector_count >= (FLASH_LOG_GC_FREE_SECTORS + 2u)) &&
+             (sector_count <= FLASH_LOG_MAX_SECTORS)) ? 1u : 0u);
+}
+
+static void log_reset(uint32_t base_addr, uint32_t sector_count)
+{
+    uint32_t idx;
+
+    memset(&g_log, 0, sizeof(g_log));
+    g_log.base = base_addr;
+    g_log.sector_count = sector_count;
+    g_log.head = LOG_NONE;
+    g_log.erasing = LOG_NONE;
+    g_log.victim = LOG_NONE;
+    g_log.buf_addr = LOG_NONE;
+
+    for (idx = 0u; idx < FLASH_LOG_MAX_KEYS; idx++)
+    {
+        g_log_index[idx].addr = LOG_NONE;
+        g_log_index[idx].length = 0u;
+        g_log_index[idx].sector = 0u;
+    }
+
+    memset(g_log_sector, 0, sizeof(g_log_sector));
+    memset(g_log_buf, 0xFF, LOG_BUFFER_SIZE);
+}
+
+uint8_t Flash_log_mount
+(
+    uint32_t base_addr,
+    uint32_t sector_count
+)
+{
+    uint8_t status = FLASH_LOG_ERROR;
+    uint8_t order[FLASH_LOG_MAX_SECTORS];
+    uint32_t used = 0u;
+    uint32_t max_erase = 0u;
+    uint32_t sector;
+    uint32_t idx;
+    uint32_t pos;
+    uint32_t offset;
+    uint8_t torn;
+    uint8_t erased;
+    log_sector_t* s;
+
+    if (1u == log_params_valid(base_addr, sector_count))
+    {
+        log_reset(base_addr, sector_count);
+
+        /*Sector headers, the used sectors sorted by sequence*/
+        for (sector = 0u; sector < sector_count; sector++)
+        {
+            s = &g_log_sector[sector];
+            Flash_read(g_log_work, log_sector_addr(sector), 16u);
+
+            if ((LOG_SECTOR_MAGIC == log_get32(&g_log_work[0])) &&
+                (log_get32(&g_log_work[12]) == ~(LOG_SECTOR_MAGIC ^ log_get32(&g_log_work[4]) ^
+                                                 log_get32(&g_log_work[8]))))
+            {
+                s->sequence = log_get32(&g_log_work[4]);
+                s->erase_count = log_get32(&g_log_work[8]);
+                s->state = LOG_CLOSED;
+                if (s->erase_count > max_erase)
+                {
+                    max_erase = s->erase_count;
+                }
+
+                pos = used;
+                while ((pos > 0u) && (g_log_sector[order[pos - 1u]].sequence > s->sequence))
+                {
+                    order[pos] = order[pos - 1u];
+                    pos--;
+                }
+                order[pos] = (uint8_t)sector;
+                used++;
+            }
+            else
+            {
+                erased = 1u;
+                for (idx = 0u; idx < 16u; idx++)
+                {
+                    if (0xFFu != g_log_work[idx])
+                    {
+                        erased = 0u;
+                    }
+                }
+
+                /*An erase count is lost with the header, taken as the
+                 * highest one*/
+                s->state = (1u == erased) ? LOG_FREE : LOG_DIRTY;
+                s->erase_count = LOG_NONE;
+            }
+        }
+
+        if (0u != used)
+        {
+            status = FLASH_LOG_OK;
+
+            for (pos = 0u; pos < used; pos++)
+            {
+                sector = order[pos];
+                if (0u == log_mount_summary(sector))
+                {
+                    offset = log_mount_scan(sector, &torn);
+
+                    /*The newest sector without a summary is written on,
+                     * unless it ends in a torn record*/
+                    if (((pos + 1u) == used) && (0u == torn))
+                    {
+                        g_log_sector[sector].state = LOG_HEAD;
+                        g_log.head = sector;
+                        g_log.head_offset = offset;
+                        g_log.buf_addr = log_sector_addr(sector) + offset;
+                    }
+                }
+            }
+
+            g_log.next_sequence = g_log_sector[order[used - 1u]].sequence + 1u;
+
+            /*The head buffer starts at a page boundary, with what is already
+             * programmed in the page*/
+            if (LOG_NONE != g_log.head)
+            {
+                offset = g_log.buf_addr % FLASH_PAGE_SIZE;
+                g_log.buf_addr -= offset;
+                g_log.buf_fill = offset;
+                if (0u != offset)
+                {
+                    Flash_read(g_log_buf, g_log.buf_addr, offset);
+                }
+            }
+
+            for (sector = 0u; sector < sector_count; sector++)
+            {
+                s = &g_log_sector[sector];
+                if (LOG_NONE == s->erase_count)
+                {
+                    s->erase_count = max_erase;
+                }
+                if (LOG_FREE == s->state)
+                {
+                    g_log.free_count++;
+                }
+            }
+
+            g_log.mounted = 1u;
+        }
+    }
+
+    return status;
+}
+
+uint8_t Flash_log_format
+(
+    uint32_t base_addr,
+    uint32_t sector_count
+)
+{
+    uint8_t status = FLASH_LOG_ERROR;
+    uint8_t hdr[16] __attribute__ ((aligned (4)));
+    uint32_t sector;
+
+    if (1u == log_params_valid(base_addr, sector_count))
+    {
+        log_reset(base_addr, sector_count);
+
+        for (sector = 0u; sector < sector_count; sector++)
+        {
+            Flash_sector_erase(log_sector_addr(sector));
+            while (1u == Flash_is_busy())
+            {
+                ;
+            }
+        }
+
+        /*An empty first sector, so that the store mounts*/
+        log_put32(&hdr[0], LOG_SECTOR_MAGIC);
+        log_put32(&hdr[4], 0u);
+        log_put32(&hdr[8], 0u);
+        log_put32(&hdr[12], ~LOG_SECTOR_MAGIC);
+        status = log_program(hdr, base_addr, sizeof(hdr));
+
+        if (FLASH_LOG_OK == status)
+        {
+            status = Flash_log_mount(base_addr, sector_count);
+        }
+    }
+
+    return status;
+}
+
+static uint8_t log_write(uint16_t key, const uint8_t* buf, uint16_t len)
+{
+    uint8_t status = FLASH_LOG_ERROR;
+    uint32_t size = LOG_RECORD_SIZE(len);
+    uint32_t steps;
+
+    if ((1u == g_log.mounted) && (key < FLASH_LOG_MAX_KEYS) && (len <= FLASH_LOG_MAX_RECORD))
+    {
+        status = log_make_room(size, 0u);
+
+        /*The garbage collection has not kept up, a sector's worth of steps at
+         * most for each sector*/
+        steps = g_log.sector_count * (((LOG_SUMMARY_OFFSET - LOG_DATA_OFFSET) / LOG_HDR_SIZE) + 1u);
+        while ((FLASH_LOG_FULL == status) && (0u != steps))
+        {
+            if ((LOG_NONE == g_log.victim) && (LOG_NONE == log_pick_victim()))
+            {
+                steps = 0u;
+            }
+            else
+            {
+                if (FLASH_LOG_OK != log_gc_step())
+                {
+                    steps = 0u;
+                }
+                else
+                {
+                    steps--;
+                }
+                log_erase_wait();
+                status = log_make_room(size, 0u);
+            }
+        }
+
+        if (FLASH_LOG_OK == status)
+        {
+            status = log_append(key, buf, len);
+        }
+    }
+
+    return status;
+}
+
+uint8_t Flash_log_write
+(
+    uint16_t key,
+    const uint8_t* buf,
+    uint16_t len
+)
+{
+    uint8_t status = FLASH_LOG_ERROR;
+
+    if (0u != len)
+    {
+        status = log_write(key, buf, len);
+        if (FLASH_LOG_OK == status)
+        {
+            g_log.stats.records_written++;
+        }
+    }
+
+    return status;
+}
+
+uint8_t Flash_log_delete
+(
+    uint16_t key
+)
+{
+    uint8_t status = FLASH_LOG_NOT_FOUND;
+
+    if ((key < FLASH_LOG_MAX_KEYS) && (LOG_NONE != g_log_index[key].addr) &&
+        (0u != g_log_index[key].length))
+    {
+        status = log_write(key, g_log_work, 0u);
+    }
+
+    return status;
+}
+
+uint8_t Flash_log_read
+(
+    uint16_t key,
+    uint8_t* buf,
+    uint16_t buf_len,
+    uint16_t* len
+)
+{
+    uint8_t status = FLASH_LOG_NOT_FOUND;
+    log_index_t* entry;
+
+    if ((1u == g_log.mounted) && (key < FLASH_LOG_MAX_KEYS))
+    {
+        entry = &g_log_index[key];
+        if ((LOG_NONE != entry->addr) && (0u != entry->length))
+        {
+            *len = entry->length;
+            if (entry->length > buf_len)
+            {
+                status = FLASH_LOG_ERROR;
+            }
+            else
+            {
+                /*Through the aligned work buffer, for the QSPI driver*/
+                log_read(g_log_work, entry->addr + LOG_HDR_SIZE, entry->length);
+                memcpy(buf, g_log_work, entry->length);
+                status = FLASH_LOG_OK;
+            }
+        }
+    }
+
+    return status;
+}
+
+uint8_t Flash_log_sync
+(
+    void
+)
+{
+    uint8_t status = FLASH_LOG_ERROR;
+
+    if (1u == g_log.mounted)
+    {
+        status = log_flush(1u);
+    }
+
+    return status;
+}
+
+void Flash_log_idle
+(
+    void
+)
+{
+    if (1u == g_log.mounted)
+    {
+        if ((LOG_NONE != g_log.erasing) && (0u == Flash_is_busy()))
+        {
+            log_erase_wait();
+        }
+
+        if (LOG_NONE == g_log.erasing)
+        {
+            if (g_log.buf_fill >= FLASH_PAGE_SIZE)
+            {
+                (void)log_flush(0u);
+            }
+            else
+            {
+                (void)log_gc_step();
+            }
+        }
+    }
+}
+
+void Flash_log_get_stats
+(
+    flash_log_stats_t* stats
+)
+{
+    uint32_t sector;
+    uint32_t live = 0u;
+
+    *stats = g_log.stats;
+    stats->free_sectors = g_log.free_count;
+    stats->min_erase_count = LOG_NONE;
+    stats->max_erase_count = 0u;
+
+    for (sector = 0u; sector < g_log.sector_count; sector++)
+    {
+        live += g_log_sector[sector].live;
+        if (g_log_sector[sector].erase_count < stats->min_erase_count)
+        {
+            stats->min_erase_count = g_log_sector[sector].erase_count;
+        }
+        if (g_log_sector[sector].erase_count > stats->max_erase_count)
+        {
+            stats->max_erase_count = g_log_sector[sector].erase_count;
+        }
+    }
+
+    stats->live_bytes = live;
+}
+
+#ifdef __cplusplus
+}
+#endif
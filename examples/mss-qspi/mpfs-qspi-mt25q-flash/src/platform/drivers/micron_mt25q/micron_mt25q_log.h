@@ -0,0 +1,200 @@
+/***************************************************************************//**
+ * Copyright 2019 Microchip Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Log structured, wear levelled record store for MICRON_MT25Q QSPI flash
+ * memory, using the micron_mt25q driver.
+ *
+ * Records are small blocks of data identified by a key, 0 to
+ * FLASH_LOG_MAX_KEYS - 1. Writing a record appends a new version of it to the
+ * log rather than erasing and rewriting the sector holding the old one, so an
+ * update costs the page programs of the record alone, and the erases are
+ * spread over all the sectors of the store.
+ *
+ * The store uses sector_count 64KB sectors of the flash memory from base_addr.
+ * Each sector holds a header page, with the sequence number of the sector in
+ * the log and its erase count, the records, and FLASH_LOG_SUMMARY_PAGES
+ * summary pages at its end. The summary, written when the sector is full,
+ * lists the records of the sector which were current at the time, so
+ * Flash_log_mount() builds the RAM index of the store from the headers and
+ * summaries alone, and scans only the records of the sector being written.
+ *
+ * Records are gathered in a RAM buffer of FLASH_LOG_BUFFER_PAGES pages and
+ * programmed a page at a time. Flash_log_sync() programs what is in the
+ * buffer, records written since the last sync are lost on a power failure.
+ *
+ * Flash_log_idle() is called when the application has nothing else to do, for
+ * example from its main loop. It programs the full pages of the buffer and
+ * does the garbage collection a step at a time: once no more than
+ * FLASH_LOG_GC_FREE_SECTORS sectors are free, it copies the current records of
+ * the sector with the fewest of them to the end of the log, then starts
+ * erasing the sector with Flash_sector_erase() and carries on, for each call,
+ * until the erase has finished. Sectors are written in order of their erase
+ * counts, lowest first, and the records of a sector which has been erased
+ * FLASH_LOG_WEAR_DELTA times fewer than the most erased one are moved too, so
+ * that sectors holding records which never change take their share of the
+ * erases.
+ *
+ * If the garbage collection has not kept up, Flash_log_write() does it itself,
+ * waiting for the erases. Reads suspend an erase in progress. Programming the
+ * buffer waits for an erase in progress to finish.
+ *
+ * The functions must all be called from the same hart, and not from an
+ * interrupt handler. No other function of the micron_mt25q driver may be used
+ * on the flash memory while the store is mounted.
+ *
+ * Example:
+ * @code
+ *    Flash_init(MSS_QSPI_QUAD_FULL);
+ *    if (FLASH_LOG_OK != Flash_log_mount(0x00100000u, 16u))
+ *    {
+ *        Flash_log_format(0x00100000u, 16u);
+ *    }
+ *
+ *    Flash_log_write(SETTINGS_KEY, (const uint8_t*)&settings, sizeof(settings));
+ *    Flash_log_sync();
+ *
+ *    for (;;)
+ *    {
+ *        ...
+ *        Flash_log_idle();
+ *    }
+ * @endcode
+ */
+
+#ifndef MSS_MICRON_MT25Q_LOG_H_
+#define MSS_MICRON_MT25Q_LOG_H_
+
+#include <stdint.h>
+#include "micron_mt25q.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*Number of keys, the RAM index takes 8 bytes per key*/
+#ifndef FLASH_LOG_MAX_KEYS
+#define FLASH_LOG_MAX_KEYS                    256u
+#endif
+
+/*Largest number of sectors in the store*/
+#ifndef FLASH_LOG_MAX_SECTORS
+#define FLASH_LOG_MAX_SECTORS                 64u
+#endif
+
+/*Largest record, in bytes*/
+#ifndef FLASH_LOG_MAX_RECORD
+#define FLASH_LOG_MAX_RECORD                  1024u
+#endif
+
+/*Pages of the RAM buffer the records are gathered in*/
+#ifndef FLASH_LOG_BUFFER_PAGES
+#define FLASH_LOG_BUFFER_PAGES                4u
+#endif
+
+/*Pages at the end of each sector holding its summary, 255 records in 8*/
+#ifndef FLASH_LOG_SUMMARY_PAGES
+#define FLASH_LOG_SUMMARY_PAGES               8u
+#endif
+
+/*Garbage collection starts once no more than this many sectors are free. One
+ * of them is kept for the garbage collection itself.*/
+#ifndef FLASH_LOG_GC_FREE_SECTORS
+#define FLASH_LOG_GC_FREE_SECTORS             2u
+#endif
+
+/*Difference in erase counts at which the records of a sector are moved*/
+#ifndef FLASH_LOG_WEAR_DELTA
+#define FLASH_LOG_WEAR_DELTA                  64u
+#endif
+
+#define FLASH_LOG_OK                          0u
+#define FLASH_LOG_ERROR                       1u
+#define FLASH_LOG_FULL                        2u
+#define FLASH_LOG_NOT_FOUND                   3u
+
+typedef struct
+{
+    uint32_t free_sectors;      /*sectors erased and not yet written*/
+    uint32_t live_bytes;        /*current records, with their headers*/
+    uint32_t min_erase_count;
+    uint32_t max_erase_count;
+    uint32_t records_written;   /*by the application*/
+    uint32_t gc_bytes_copied;   /*by the garbage collection*/
+    uint32_t sectors_erased;
+} flash_log_stats_t;
+
+/*Flash_log_mount() builds the RAM index from the store on the flash memory.
+ * It returns FLASH_LOG_ERROR if no sector holds a store, or if the
+ * parameters are not valid: base_addr must be at the start of a sector and
+ * sector_count at least FLASH_LOG_GC_FREE_SECTORS + 2.
+ *
+ * Flash_log_format() erases the sectors, waiting for the erases, and mounts an
+ * empty store.
+ */
+uint8_t Flash_log_mount
+(
+    uint32_t base_addr,
+    uint32_t sector_count
+);
+
+uint8_t Flash_log_format
+(
+    uint32_t base_addr,
+    uint32_t sector_count
+);
+
+/*Flash_log_write() writes a new version of a record, of 1 to
+ * FLASH_LOG_MAX_RECORD bytes. It returns FLASH_LOG_FULL if the store holds no
+ * space for it even after garbage collection.
+ *
+ * Flash_log_delete() removes a record.
+ */
+uint8_t Flash_log_write
+(
+    uint16_t key,
+    const uint8_t* buf,
+    uint16_t len
+);
+
+uint8_t Flash_log_delete
+(
+    uint16_t key
+);
+
+/*Flash_log_read() reads the current version of a record into buf, which is
+ * buf_len bytes long, and sets *len to its length. It returns
+ * FLASH_LOG_NOT_FOUND if there is no such record, or FLASH_LOG_ERROR if it
+ * does not fit in buf.
+ */
+uint8_t Flash_log_read
+(
+    uint16_t key,
+    uint8_t* buf,
+    uint16_t buf_len,
+    uint16_t* len
+);
+
+/*Flash_log_sync() programs the records in the RAM buffer*/
+uint8_t Flash_log_sync
+(
+    void
+);
+
+/*Flash_log_idle() does the background work of the store, see above*/
+void Flash_log_idle
+(
+    void
+);
+
+void Flash_log_get_stats
+(
+    flash_log_stats_t* stats
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_MICRON_MT25Q_LOG_H_*/
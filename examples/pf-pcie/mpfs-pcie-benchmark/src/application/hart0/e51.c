@@ -0,0 +1,448 @@
+/******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Application code running on E51
+ *
+ * PCIe link throughput and latency benchmark. See README.txt.
+ *
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+
+#include "drivers/mss_mmuart/mss_uart.h"
+#include "drivers/pf_pcie/pf_pcie.h"
+#include "bench_report.h"
+
+#define PCIE_APB_BASE_ADDR          0x50000000UL
+/* AXI slave window of the root port, also bus 0 of the ECAM */
+#define PCIE_ECAM_ADDR              0x60000000UL
+/* Endpoint on bus 1 device 0 function 0, and where its BARs are allocated */
+#define PCIE_EP_ECAM_ADDR           0x60100000UL
+#define PCIE_EP_ALLOC_ADDR          0x60000000UL
+/* Interrupt the PCIe controller is wired to in the Libero design */
+#define PCIE_PLIC_IRQ               FABRIC_F2H_0_PLIC
+
+/*
+ * DMA buffers. The endpoint DMA engines reach the root port buffer at
+ * BENCH_RP_PCIE_ADDR, which the root port master ATR table translates to
+ * BENCH_RP_BUF_ADDR in non-cached DDR. BENCH_EP_MEM_ADDR is the endpoint
+ * memory, in the endpoint's AXI address space. Each region holds two
+ * buffers of BENCH_DMA_MAX_SIZE, one per DMA engine.
+ */
+#define BENCH_RP_PCIE_ADDR          0x10000000u
+#define BENCH_RP_BUF_ADDR           0xC0000000UL
+#define BENCH_EP_MEM_ADDR           0x00000000u
+#define BENCH_DMA_MAX_SIZE          65536u
+
+/* Operations measured for each test point */
+#define BENCH_ITERATIONS            32u
+/* mcycle ticks per second */
+#define BENCH_CYCLE_HZ              LIBERO_SETTING_MSS_COREPLEX_CPU_CLK
+
+static const uint32_t g_mmio_read_sizes[] = {4u, 8u, 64u, 256u, 1024u};
+static const uint32_t g_mmio_write_sizes[] = {64u, 256u, 1024u, 4096u};
+static const uint32_t g_dma_sizes[] = {1024u, 4096u, 16384u, 65536u};
+
+static uint64_t g_latency[BENCH_ITERATIONS];
+static volatile uint64_t g_dma_end[PF_PCIE_EP_DMA_CHANNELS];
+static volatile uint32_t g_dma_done;
+static volatile uint32_t g_dma_errors;
+static volatile uint64_t g_mmio_sink;
+static pf_pcie_dma_job_t g_dma_job[PF_PCIE_EP_DMA_CHANNELS];
+static bench_report_t g_report;
+
+/* Settings given on the config lines of the report */
+static const bench_config_t g_bench_config[] =
+{
+    BENCH_CONFIG(BENCH_ITERATIONS),
+    BENCH_CONFIG(BENCH_DMA_MAX_SIZE),
+    BENCH_CONFIG(PF_PCIE_EP_DMA_CHANNELS)
+};
+
+static void bench_printf(const char *fmt, ...);
+static void bench_mmio_read(volatile uint64_t *p_bar, uint32_t size);
+static void bench_mmio_write(volatile uint64_t *p_bar, uint32_t size);
+static void bench_dma(uint8_t dir, uint32_t size);
+static void bench_dma_concurrent(uint32_t size);
+static void bench_report(const char *test, const char *dir, uint32_t size,
+                         uint64_t bytes, uint64_t elapsed);
+static void bench_report_failed(const char *dir, uint32_t size);
+static uint32_t cycles_to_ns(uint64_t cycles);
+static void bench_write_handler(pf_pcie_ep_dma_status_t status);
+static void bench_read_handler(pf_pcie_ep_dma_status_t status);
+static void bench_job_handler(pf_pcie_dma_job_t *job,
+                              pf_pcie_ep_dma_status_t status);
+
+/* Main function for the hart0(E51 processor).
+ * Application code running on hart0 is placed here.
+ */
+void e51(void)
+{
+    pf_pcie_slave_atr_cfg_t s_cfg;
+    pf_pcie_master_atr_cfg_t m_cfg;
+    pf_pcie_ebuff_t *p_pcie_enum_data;
+    pf_pcie_bar_info_t *p_pcie_bar_data;
+    volatile uint64_t *p_bar2;
+    uint32_t idx;
+
+    SYSREG->SUBBLK_CLOCK_CR = 0xffffffff;        /* all clocks on */
+    SYSREG->SOFT_RESET_CR &= ~((1u << 0u) | (1u << 5u));
+
+    MSS_UART_init(&g_mss_uart0_lo,
+                  MSS_UART_115200_BAUD,
+                  MSS_UART_DATA_8_BITS | MSS_UART_NO_PARITY | MSS_UART_ONE_STOP_BIT);
+
+    bench_printf("\r\nPCIe benchmark, %u iterations per point\r\n",
+                 BENCH_ITERATIONS);
+    bench_report_begin(&g_report, &g_mss_uart0_lo, NULL, "mpfs-pcie-benchmark",
+                       g_bench_config,
+                       sizeof(g_bench_config) / sizeof(g_bench_config[0]));
+
+    /* Outbound: AXI4 slave 0x60000000 to PCIe 0x60000000, 256MB */
+    s_cfg.state = PF_PCIE_ATR_TABLE_ENABLE;
+    s_cfg.size = PF_PCIE_SIZE_256MB;
+    s_cfg.src_addr = 0x60000000u;
+    s_cfg.src_addr_msb = 0x00000000u;
+    s_cfg.trns_addr = 0x60000000u;
+    s_cfg.trns_addr_msb = 0x00000000u;
+    (void)PF_PCIE_slave_atr_table_init(PCIE_APB_BASE_ADDR, PF_PCIE_CTRL_1,
+                                       &s_cfg, 0u, PF_PCIE_TLP_MEM);
+
+    /* Inbound: endpoint DMA to the root port buffer in DDR */
+    m_cfg.state = PF_PCIE_ATR_TABLE_ENABLE;
+    m_cfg.bar_type = PF_PCIE_BAR_TYPE_64BIT_PREFET_MEM;
+    m_cfg.bar_size = PF_PCIE_SIZE_256KB;
+    m_cfg.table_size = PF_PCIE_SIZE_256KB;
+    m_cfg.src_addr = BENCH_RP_PCIE_ADDR;
+    m_cfg.src_addr_msb = 0u;
+    m_cfg.trns_addr = (uint32_t)(BENCH_RP_BUF_ADDR & 0xFFFFFFFFUL);
+    m_cfg.trns_addr_msb = (uint32_t)(BENCH_RP_BUF_ADDR >> 32u);
+    (void)PF_PCIE_master_atr_table_init(PCIE_APB_BASE_ADDR, PF_PCIE_CTRL_1,
+                                        &m_cfg, 0u, PF_PCIE_TLP_MEM);
+
+    p_pcie_enum_data = PF_PCIE_enumeration(PCIE_APB_BASE_ADDR, PF_PCIE_CTRL_1,
+                                           PCIE_ECAM_ADDR);
+    if (p_pcie_enum_data->no_of_devices_attached == 0u)
+    {
+        bench_printf("no endpoint found\r\n");
+        bench_report_end(&g_report);
+        while(1);
+    }
+
+    p_pcie_bar_data = PF_PCIE_allocate_memory(PCIE_EP_ECAM_ADDR,
+                                              PCIE_EP_ALLOC_ADDR);
+    p_bar2 = (volatile uint64_t *)((uintptr_t)p_pcie_bar_data->bar2_address);
+
+    /* MMIO, through endpoint BAR2 */
+    bench_printf("\r\ntest   dir       size     MB/s   p50   p99   max (ns)\r\n");
+    for (idx = 0u; idx < (sizeof(g_mmio_read_sizes) / sizeof(g_mmio_read_sizes[0])); idx++)
+    {
+        bench_mmio_read(p_bar2, g_mmio_read_sizes[idx]);
+    }
+    for (idx = 0u; idx < (sizeof(g_mmio_write_sizes) / sizeof(g_mmio_write_sizes[0])); idx++)
+    {
+        bench_mmio_write(p_bar2, g_mmio_write_sizes[idx]);
+    }
+
+    /* Endpoint DMA, through the DMA engines reached by BAR0 */
+    PF_PCIE_dma_init(p_pcie_bar_data->bar0_address);
+    PF_PCIE_set_dma_write_callback(bench_write_handler);
+    PF_PCIE_set_dma_read_callback(bench_read_handler);
+
+    PLIC_init();
+    PLIC_SetPriority(PCIE_PLIC_IRQ, 2u);
+    PLIC_EnableIRQ(PCIE_PLIC_IRQ);
+    PF_PCIE_enable_interrupts();
+    __enable_irq();
+
+    for (idx = 0u; idx < (sizeof(g_dma_sizes) / sizeof(g_dma_sizes[0])); idx++)
+    {
+        bench_dma(PF_PCIE_EP_DMA_WRITE, g_dma_sizes[idx]);
+    }
+    for (idx = 0u; idx < (sizeof(g_dma_sizes) / sizeof(g_dma_sizes[0])); idx++)
+    {
+        bench_dma(PF_PCIE_EP_DMA_READ, g_dma_sizes[idx]);
+    }
+    for (idx = 0u; idx < (sizeof(g_dma_sizes) / sizeof(g_dma_sizes[0])); idx++)
+    {
+        bench_dma_concurrent(g_dma_sizes[idx]);
+    }
+
+    bench_report_end(&g_report);
+    bench_printf("\r\nbenchmark complete\r\n");
+
+    while(1);
+}
+/******************************************************************************/
+uint8_t fabric_f2h_0_plic_IRQHandler(void)
+{
+    PF_PCIE_isr();
+    return EXT_IRQ_KEEP_ENABLED;
+}
+/******************************************************************************/
+static void bench_printf(const char *fmt, ...)
+{
+    char line[128];
+    va_list args;
+
+    va_start(args, fmt);
+    (void)vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+
+    MSS_UART_polled_tx_string(&g_mss_uart0_lo, (const uint8_t *)line);
+}
+/******************************************************************************/
+/*
+ * Non-posted reads. Each read has to complete before the next one is issued,
+ * so the time of a size byte block is size/8 round trips over the link.
+ * 4-byte reads use a 32-bit load.
+ */
+static void bench_mmio_read(volatile uint64_t *p_bar, uint32_t size)
+{
+    volatile uint32_t *p_bar32 = (volatile uint32_t *)p_bar;
+    uint64_t start;
+    uint64_t total = 0u;
+    uint64_t sum;
+    uint32_t iter;
+    uint32_t word;
+
+    for (iter = 0u; iter < BENCH_ITERATIONS; iter++)
+    {
+        sum = 0u;
+        start = readmcycle();
+        if (size == 4u)
+        {
+            sum = p_bar32[iter];
+        }
+        else
+        {
+            for (word = 0u; word < (size / 8u); word++)
+            {
+                sum += p_bar[word];
+            }
+        }
+        /* The sum depends on every load, they are all complete */
+        g_mmio_sink = sum;
+        g_latency[iter] = readmcycle() - start;
+        total += g_latency[iter];
+    }
+
+    bench_report("mmio", "read", size, (uint64_t)BENCH_ITERATIONS * size, total);
+}
+/******************************************************************************/
+/*
+ * Posted writes, with 64-bit stores. A read of the last word written follows
+ * the block: it cannot pass the writes, so it returns once they have reached
+ * the endpoint.
+ */
+static void bench_mmio_write(volatile uint64_t *p_bar, uint32_t size)
+{
+    uint64_t start;
+    uint64_t total = 0u;
+    uint32_t iter;
+    uint32_t word;
+
+    for (iter = 0u; iter < BENCH_ITERATIONS; iter++)
+    {
+        start = readmcycle();
+        for (word = 0u; word < (size / 8u); word++)
+        {
+            p_bar[word] = ((uint64_t)iter << 32u) | word;
+        }
+        g_mmio_sink = p_bar[(size / 8u) - 1u];
+        g_latency[iter] = readmcycle() - start;
+        total += g_latency[iter];
+    }
+
+    bench_report("mmio", "write", size, (uint64_t)BENCH_ITERATIONS * size, total);
+}
+/******************************************************************************/
+/*
+ * One engine, one transfer at a time, started with PF_PCIE_dma_write() or
+ * PF_PCIE_dma_read() and timed up to its completion callback.
+ */
+static void bench_dma(uint8_t dir, uint32_t size)
+{
+    uint64_t start;
+    uint64_t total = 0u;
+    uint32_t iter;
+
+    g_dma_errors = 0u;
+    for (iter = 0u; iter < BENCH_ITERATIONS; iter++)
+    {
+        g_dma_done = 0u;
+        start = readmcycle();
+        if (dir == PF_PCIE_EP_DMA_WRITE)
+        {
+            PF_PCIE_dma_write(BENCH_RP_PCIE_ADDR, BENCH_EP_MEM_ADDR, size);
+        }
+        else
+        {
+            PF_PCIE_dma_read(BENCH_EP_MEM_ADDR + BENCH_DMA_MAX_SIZE,
+                             BENCH_RP_PCIE_ADDR + BENCH_DMA_MAX_SIZE, size);
+        }
+        while (g_dma_done == 0u)
+        {
+        }
+        g_latency[iter] = g_dma_end[dir] - start;
+        total += g_latency[iter];
+    }
+
+    if (g_dma_errors != 0u)
+    {
+        bench_report_failed((dir == PF_PCIE_EP_DMA_WRITE) ? "write" : "read",
+                            size);
+    }
+    else
+    {
+        bench_report("dma", (dir == PF_PCIE_EP_DMA_WRITE) ? "write" : "read",
+                     size, (uint64_t)BENCH_ITERATIONS * size, total);
+    }
+}
+/******************************************************************************/
+/*
+ * A write and a read of size bytes each, queued on both engines together
+ * with PF_PCIE_dma_submit(). The time runs until the later of the two
+ * completes and the throughput counts the bytes of both.
+ */
+static void bench_dma_concurrent(uint32_t size)
+{
+    uint64_t start;
+    uint64_t end;
+    uint64_t total = 0u;
+    uint32_t iter;
+
+    g_dma_job[PF_PCIE_EP_DMA_WRITE].src_address = BENCH_RP_PCIE_ADDR;
+    g_dma_job[PF_PCIE_EP_DMA_WRITE].dest_address = BENCH_EP_MEM_ADDR;
+    g_dma_job[PF_PCIE_EP_DMA_READ].src_address = BENCH_EP_MEM_ADDR + BENCH_DMA_MAX_SIZE;
+    g_dma_job[PF_PCIE_EP_DMA_READ].dest_address = BENCH_RP_PCIE_ADDR + BENCH_DMA_MAX_SIZE;
+
+    g_dma_errors = 0u;
+    for (iter = 0u; iter < BENCH_ITERATIONS; iter++)
+    {
+        g_dma_job[PF_PCIE_EP_DMA_WRITE].length = size;
+        g_dma_job[PF_PCIE_EP_DMA_WRITE].callback = bench_job_handler;
+        g_dma_job[PF_PCIE_EP_DMA_READ].length = size;
+        g_dma_job[PF_PCIE_EP_DMA_READ].callback = bench_job_handler;
+
+        g_dma_done = 0u;
+        start = readmcycle();
+        (void)PF_PCIE_dma_submit(PF_PCIE_EP_DMA_WRITE, &g_dma_job[PF_PCIE_EP_DMA_WRITE]);
+        (void)PF_PCIE_dma_submit(PF_PCIE_EP_DMA_READ, &g_dma_job[PF_PCIE_EP_DMA_READ]);
+        while (g_dma_done < PF_PCIE_EP_DMA_CHANNELS)
+        {
+        }
+        end = g_dma_end[PF_PCIE_EP_DMA_WRITE];
+        if (g_dma_end[PF_PCIE_EP_DMA_READ] > end)
+        {
+            end = g_dma_end[PF_PCIE_EP_DMA_READ];
+        }
+        g_latency[iter] = end - start;
+        total += g_latency[iter];
+    }
+
+    if (g_dma_errors != 0u)
+    {
+        bench_report_failed("both", size);
+    }
+    else
+    {
+        bench_report("dma", "both", size, (uint64_t)BENCH_ITERATIONS * size * 2u,
+                     total);
+    }
+}
+/******************************************************************************/
+static uint32_t cycles_to_ns(uint64_t cycles)
+{
+    return (uint32_t)((cycles * 1000u) / (BENCH_CYCLE_HZ / 1000000u));
+}
+/******************************************************************************/
+static void bench_report(const char *test, const char *dir, uint32_t size,
+                         uint64_t bytes, uint64_t elapsed)
+{
+    bench_record_t record;
+    uint64_t mbps;
+
+    /* Sorts the samples */
+    bench_record_init(&record, "pcie", test, dir);
+    bench_record_samples(&record, g_latency, BENCH_ITERATIONS);
+
+    if (elapsed == 0u)
+    {
+        elapsed = 1u;
+    }
+    mbps = (bytes * BENCH_CYCLE_HZ) / (elapsed * 1000000u);
+
+    record.size = size;
+    record.rate = mbps;
+    record.rate_unit = "MB/s";
+    record.min = cycles_to_ns(record.min);
+    record.mean = cycles_to_ns(record.mean);
+    record.p50 = cycles_to_ns(record.p50);
+    record.p99 = cycles_to_ns(record.p99);
+    record.max = cycles_to_ns(record.max);
+    record.lat_unit = "ns";
+    bench_report_result(&g_report, &record);
+
+    bench_printf("%-6s %-5s  %8u %8u %5u %5u %5u\r\n", test, dir, size,
+                 (uint32_t)mbps,
+                 cycles_to_ns(g_latency[(BENCH_ITERATIONS * 50u) / 100u]),
+                 cycles_to_ns(g_latency[(BENCH_ITERATIONS * 99u) / 100u]),
+                 cycles_to_ns(g_latency[BENCH_ITERATIONS - 1u]));
+}
+/******************************************************************************/
+static void bench_report_failed(const char *dir, uint32_t size)
+{
+    bench_record_t record;
+
+    bench_printf("dma    %-5s  %8u failed (%u)\r\n", dir, size, g_dma_errors);
+
+    bench_record_init(&record, "pcie", "dma", dir);
+    record.size = size;
+    record.samples = BENCH_ITERATIONS;
+    record.errors = g_dma_errors;
+    bench_report_result(&g_report, &record);
+}
+/******************************************************************************/
+static void bench_write_handler(pf_pcie_ep_dma_status_t status)
+{
+    g_dma_end[PF_PCIE_EP_DMA_WRITE] = readmcycle();
+    if (status != PF_PCIE_EP_DMA_COMPLETED)
+    {
+        g_dma_errors++;
+    }
+    g_dma_done++;
+}
+/******************************************************************************/
+static void bench_read_handler(pf_pcie_ep_dma_status_t status)
+{
+    g_dma_end[PF_PCIE_EP_DMA_READ] = readmcycle();
+    if (status != PF_PCIE_EP_DMA_COMPLETED)
+    {
+        g_dma_errors++;
+    }
+    g_dma_done++;
+}
+/******************************************************************************/
+static void bench_job_handler(pf_pcie_dma_job_t *job,
+                              pf_pcie_ep_dma_status_t status)
+{
+    if (job == &g_dma_job[PF_PCIE_EP_DMA_WRITE])
+    {
+        g_dma_end[PF_PCIE_EP_DMA_WRITE] = readmcycle();
+    }
+    else
+    {
+        g_dma_end[PF_PCIE_EP_DMA_READ] = readmcycle();
+    }
+    if (status != PF_PCIE_EP_DMA_COMPLETED)
+    {
+        g_dma_errors++;
+    }
+    g_dma_done++;
+}
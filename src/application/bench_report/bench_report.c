@@ -0,0 +1,413 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Benchmark report, see bench_report.h.
+ *
+ * The fingerprint is the 32-bit FNV-1a hash of the values printed on the build
+ * and config lines, each config value taken as eight bytes, least significant
+ * first.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "bench_report.h"
+
+#define FNV_OFFSET_BASIS            0x811C9DC5u
+#define FNV_PRIME                   0x01000193u
+
+/* L2 cache controller, the way masks follow in the order of g_l2_masters */
+#define BENCH_L2_BASE               0x02010000UL
+#define BENCH_L2_WAY_ENABLE         (BENCH_L2_BASE + 0x008UL)
+#define BENCH_L2_WAY_MASK           (BENCH_L2_BASE + 0x800UL)
+
+#if defined(__OPTIMIZE_SIZE__)
+#define BENCH_OPTIMISATION          "Os"
+#elif defined(__OPTIMIZE__)
+#define BENCH_OPTIMISATION          "O"
+#else
+#define BENCH_OPTIMISATION          "O0"
+#endif
+
+#if defined(__VERSION__)
+#define BENCH_COMPILER              __VERSION__
+#else
+#define BENCH_COMPILER              "unknown"
+#endif
+
+/* Settings of the Libero design, those not defined are left out */
+static const bench_config_t g_design_config[] =
+{
+    BENCH_CONFIG(LIBERO_SETTING_MSS_COREPLEX_CPU_CLK),
+#if defined(LIBERO_SETTING_MSS_AXI_CLK)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_AXI_CLK),
+#endif
+#if defined(LIBERO_SETTING_MSS_APB_AHB_CLK)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_APB_AHB_CLK),
+#endif
+#if defined(LIBERO_SETTING_MSS_RTC_TOGGLE_CLK)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_RTC_TOGGLE_CLK),
+#endif
+#if defined(LIBERO_SETTING_MSS_CLOCK_CONFIG_CR)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_CLOCK_CONFIG_CR),
+#endif
+#if defined(LIBERO_SETTING_MSS_MSSCLKMUX)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_MSSCLKMUX),
+#endif
+#if defined(LIBERO_SETTING_MSS_PLL_CTRL)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_PLL_CTRL),
+#endif
+#if defined(LIBERO_SETTING_MSS_PLL_REF_FB)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_PLL_REF_FB),
+#endif
+#if defined(LIBERO_SETTING_MSS_PLL_FRACN)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_PLL_FRACN),
+#endif
+#if defined(LIBERO_SETTING_MSS_PLL_DIV_0_1)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_PLL_DIV_0_1),
+#endif
+#if defined(LIBERO_SETTING_MSS_PLL_DIV_2_3)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_PLL_DIV_2_3),
+#endif
+#if defined(LIBERO_SETTING_MSS_PLL_CTRL2)
+    BENCH_CONFIG(LIBERO_SETTING_MSS_PLL_CTRL2),
+#endif
+#if defined(LIBERO_SETTING_DDR_PLL_CTRL)
+    BENCH_CONFIG(LIBERO_SETTING_DDR_PLL_CTRL),
+#endif
+#if defined(LIBERO_SETTING_DDR_PLL_REF_FB)
+    BENCH_CONFIG(LIBERO_SETTING_DDR_PLL_REF_FB),
+#endif
+#if defined(LIBERO_SETTING_DDR_PLL_FRACN)
+    BENCH_CONFIG(LIBERO_SETTING_DDR_PLL_FRACN),
+#endif
+#if defined(LIBERO_SETTING_DDR_PLL_DIV_0_1)
+    BENCH_CONFIG(LIBERO_SETTING_DDR_PLL_DIV_0_1),
+#endif
+#if defined(LIBERO_SETTING_DDR_PLL_DIV_2_3)
+    BENCH_CONFIG(LIBERO_SETTING_DDR_PLL_DIV_2_3),
+#endif
+#if defined(LIBERO_SETTING_DDRPHY_MODE)
+    BENCH_CONFIG(LIBERO_SETTING_DDRPHY_MODE),
+#endif
+#if defined(LIBERO_SETTING_DATA_LANES_USED)
+    BENCH_CONFIG(LIBERO_SETTING_DATA_LANES_USED),
+#endif
+#if defined(LIBERO_SETTING_NUM_SCRATCH_PAD_WAYS)
+    BENCH_CONFIG(LIBERO_SETTING_NUM_SCRATCH_PAD_WAYS),
+#endif
+};
+
+static const char * const g_l2_masters[] =
+{
+    "L2_WAY_MASK_DMA",
+    "L2_WAY_MASK_AXI4_SLAVE_PORT_0",
+    "L2_WAY_MASK_AXI4_SLAVE_PORT_1",
+    "L2_WAY_MASK_AXI4_SLAVE_PORT_2",
+    "L2_WAY_MASK_AXI4_SLAVE_PORT_3",
+    "L2_WAY_MASK_E51_DCACHE",
+    "L2_WAY_MASK_E51_ICACHE",
+    "L2_WAY_MASK_U54_1_DCACHE",
+    "L2_WAY_MASK_U54_1_ICACHE",
+    "L2_WAY_MASK_U54_2_DCACHE",
+    "L2_WAY_MASK_U54_2_ICACHE",
+    "L2_WAY_MASK_U54_3_DCACHE",
+    "L2_WAY_MASK_U54_3_ICACHE",
+    "L2_WAY_MASK_U54_4_DCACHE",
+    "L2_WAY_MASK_U54_4_ICACHE"
+};
+
+#define DESIGN_CONFIG_COUNT     (sizeof(g_design_config) / sizeof(g_design_config[0]))
+#define L2_MASTER_COUNT         (sizeof(g_l2_masters) / sizeof(g_l2_masters[0]))
+
+static void report_tx(const bench_report_t * report, const char * line);
+static void report_config(const bench_report_t * report, const char * name,
+                          uint64_t value);
+static uint32_t hash_string(uint32_t hash, const char * str);
+static uint32_t hash_value(uint32_t hash, uint64_t value);
+static uint32_t hash_settings(uint32_t hash, const bench_config_t * config,
+                              uint32_t config_count);
+static void csv_field(char * dest, size_t size, const char * src);
+
+/*------------------------------------------------------------------------------
+ * See bench_report.h
+ */
+void bench_report_begin(bench_report_t * report, mss_uart_instance_t * uart,
+                        bench_report_tx_t tx, const char * project,
+                        const bench_config_t * config, uint32_t config_count)
+{
+    char line[BENCH_REPORT_LINE_SIZE];
+    char field[64];
+    uint32_t idx;
+
+    report->uart = uart;
+    report->tx = tx;
+    report->results = 0u;
+    report->fingerprint = bench_report_fingerprint(config, config_count);
+
+    csv_field(field, sizeof(field), project);
+    (void)snprintf(line, sizeof(line), "\r\nBENCH,begin,%u,%s\r\n",
+                   (unsigned int)BENCH_REPORT_FORMAT, field);
+    report_tx(report, line);
+
+    csv_field(field, sizeof(field), BENCH_COMPILER);
+    (void)snprintf(line, sizeof(line), "BENCH,build,%s,%s\r\n", field,
+                   BENCH_OPTIMISATION);
+    report_tx(report, line);
+
+    for (idx = 0u; idx < DESIGN_CONFIG_COUNT; idx++)
+    {
+        report_config(report, g_design_config[idx].name,
+                      g_design_config[idx].value);
+    }
+
+    report_config(report, "L2_WAY_ENABLE",
+                  *(volatile uint64_t *)BENCH_L2_WAY_ENABLE);
+    for (idx = 0u; idx < L2_MASTER_COUNT; idx++)
+    {
+        report_config(report, g_l2_masters[idx],
+                      ((volatile uint64_t *)BENCH_L2_WAY_MASK)[idx]);
+    }
+
+    for (idx = 0u; idx < config_count; idx++)
+    {
+        report_config(report, config[idx].name, config[idx].value);
+    }
+
+    (void)snprintf(line, sizeof(line), "BENCH,fingerprint,%08x\r\n",
+                   (unsigned int)report->fingerprint);
+    report_tx(report, line);
+
+    report_tx(report, "BENCH,columns,suite,test,variant,size,depth,samples,"
+                      "rate,rate_unit,min,mean,p50,p99,max,lat_unit,errors\r\n");
+}
+
+/*------------------------------------------------------------------------------
+ * See bench_report.h
+ */
+void bench_report_result(bench_report_t * report,
+                         const bench_record_t * record)
+{
+    char line[BENCH_REPORT_LINE_SIZE];
+    char suite[24];
+    char test[40];
+    char variant[40];
+    char rate_unit[16];
+    char lat_unit[16];
+
+    csv_field(suite, sizeof(suite), record->suite);
+    csv_field(test, sizeof(test), record->test);
+    csv_field(variant, sizeof(variant), record->variant);
+    csv_field(rate_unit, sizeof(rate_unit), record->rate_unit);
+    csv_field(lat_unit, sizeof(lat_unit), record->lat_unit);
+
+    (void)snprintf(line, sizeof(line),
+                   "BENCH,result,%s,%s,%s,%lu,%lu,%lu,%lu,%s,%lu,%lu,%lu,%lu,%lu,%s,%lu\r\n",
+                   suite, test, variant,
+                   (unsigned long)record->size,
+                   (unsigned long)record->depth,
+                   (unsigned long)record->samples,
+                   (unsigned long)record->rate, rate_unit,
+                   (unsigned long)record->min,
+                   (unsigned long)record->mean,
+                   (unsigned long)record->p50,
+                   (unsigned long)record->p99,
+                   (unsigned long)record->max, lat_unit,
+                   (unsigned long)record->errors);
+    report_tx(report, line);
+
+    report->results++;
+}
+
+/*------------------------------------------------------------------------------
+ * See bench_report.h
+ */
+void bench_report_end(bench_report_t * report)
+{
+    char line[BENCH_REPORT_LINE_SIZE];
+
+    (void)snprintf(line, sizeof(line), "BENCH,end,%u\r\n",
+                   (unsigned int)report->results);
+    report_tx(report, line);
+}
+
+/*------------------------------------------------------------------------------
+ * See bench_report.h
+ */
+uint32_t bench_report_fingerprint(const bench_config_t * config,
+                                  uint32_t config_count)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    uint32_t idx;
+
+    hash = hash_string(hash, BENCH_COMPILER);
+    hash = hash_string(hash, BENCH_OPTIMISATION);
+    hash = hash_settings(hash, g_design_config, DESIGN_CONFIG_COUNT);
+
+    hash = hash_string(hash, "L2_WAY_ENABLE");
+    hash = hash_value(hash, *(volatile uint64_t *)BENCH_L2_WAY_ENABLE);
+    for (idx = 0u; idx < L2_MASTER_COUNT; idx++)
+    {
+        hash = hash_string(hash, g_l2_masters[idx]);
+        hash = hash_value(hash, ((volatile uint64_t *)BENCH_L2_WAY_MASK)[idx]);
+    }
+
+    return (hash_settings(hash, config, config_count));
+}
+
+/*------------------------------------------------------------------------------
+ * See bench_report.h
+ */
+void bench_record_init(bench_record_t * record, const char * suite,
+                       const char * test, const char * variant)
+{
+    (void)memset(record, 0, sizeof(*record));
+    record->suite = suite;
+    record->test = test;
+    record->variant = variant;
+    record->depth = 1u;
+    record->rate_unit = "";
+    record->lat_unit = "";
+}
+
+/*------------------------------------------------------------------------------
+ * See bench_report.h
+ */
+void bench_record_samples(bench_record_t * record, uint64_t * samples,
+                          uint32_t count)
+{
+    uint64_t sum = 0u;
+    uint64_t key;
+    uint32_t i;
+    uint32_t j;
+
+    if (count != 0u)
+    {
+        /* Insertion sort, the samples of the examples are small */
+        for (i = 1u; i < count; i++)
+        {
+            key = samples[i];
+            j = i;
+            while ((j > 0u) && (samples[j - 1u] > key))
+            {
+                samples[j] = samples[j - 1u];
+                j--;
+            }
+            samples[j] = key;
+        }
+
+        for (i = 0u; i < count; i++)
+        {
+            sum += samples[i];
+        }
+
+        record->samples = count;
+        record->min = samples[0];
+        record->mean = sum / count;
+        record->p50 = samples[(((uint64_t)count * 50u) + 99u) / 100u - 1u];
+        record->p99 = samples[(((uint64_t)count * 99u) + 99u) / 100u - 1u];
+        record->max = samples[count - 1u];
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Local functions
+ */
+static void report_tx(const bench_report_t * report, const char * line)
+{
+    if (report->tx != NULL)
+    {
+        report->tx((const uint8_t *)line);
+    }
+    else
+    {
+        MSS_UART_polled_tx_string(report->uart, (const uint8_t *)line);
+    }
+}
+
+static void report_config(const bench_report_t * report, const char * name,
+                          uint64_t value)
+{
+    char line[BENCH_REPORT_LINE_SIZE];
+    char field[64];
+
+    csv_field(field, sizeof(field), name);
+    (void)snprintf(line, sizeof(line), "BENCH,config,%s,0x%lx\r\n", field,
+                   (unsigned long)value);
+    report_tx(report, line);
+}
+
+static uint32_t hash_string(uint32_t hash, const char * str)
+{
+    while (*str != '\0')
+    {
+        hash = (hash ^ (uint8_t)*str) * FNV_PRIME;
+        str++;
+    }
+
+    return (hash);
+}
+
+static uint32_t hash_value(uint32_t hash, uint64_t value)
+{
+    uint32_t idx;
+
+    for (idx = 0u; idx < 8u; idx++)
+    {
+        hash = (hash ^ (uint8_t)(value >> (idx * 8u))) * FNV_PRIME;
+    }
+
+    return (hash);
+}
+
+static uint32_t hash_settings(uint32_t hash, const bench_config_t * config,
+                              uint32_t config_count)
+{
+    uint32_t idx;
+
+    for (idx = 0u; idx < config_count; idx++)
+    {
+        hash = hash_string(hash, config[idx].name);
+        hash = hash_value(hash, config[idx].value);
+    }
+
+    return (hash);
+}
+
+/* Copies a string for a CSV field, see bench_record_t */
+static void csv_field(char * dest, size_t size, const char * src)
+{
+    size_t len = 0u;
+    size_t end = 0u;
+
+    if (src == NULL)
+    {
+        src = "";
+    }
+
+    while (*src == ' ')
+    {
+        src++;
+    }
+
+    while ((*src != '\0') && (len < (size - 1u)))
+    {
+        if ((*src == ' ') || (*src == '\r') || (*src == '\n'))
+        {
+            dest[len] = '_';
+        }
+        else
+        {
+            dest[len] = (*src == ',') ? ';' : *src;
+            end = len + 1u;
+        }
+        len++;
+        src++;
+    }
+
+    /* Trailing spaces dropped */
+    dest[end] = '\0';
+}
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Benchmark report, the results format shared by the benchmark examples.
+ *
+ * The results are printed as comma separated lines starting with "BENCH,", so
+ * that a test rig can pick them out of the rest of the output of the example
+ * and compare them run over run:
+ *
+ *   BENCH,begin,<format>,<project>
+ *   BENCH,build,<compiler>,<optimisation>
+ *   BENCH,config,<name>,<value>            one line per setting
+ *   BENCH,fingerprint,<hash of the build and config lines>
+ *   BENCH,columns,suite,test,variant,size,depth,samples,rate,rate_unit,
+ *                 min,mean,p50,p99,max,lat_unit,errors
+ *   BENCH,result,<one value per column>    one line per result
+ *   BENCH,end,<number of result lines>
+ *
+ * The config lines give the clock and PLL settings of the Libero design, the
+ * L2 cache way enable and way masks read from the cache controller, and the
+ * settings of the drivers passed to bench_report_begin() by the example. Runs
+ * with the same fingerprint were made with the same configuration, so that a
+ * change in their results comes from the code, e.g. a new release of the
+ * drivers. The columns are described with bench_record_t.
+ *
+ * The benchmark examples share this copy, kept in src/application/bench_report
+ * of the repository and linked into each project as src/bench_report. The
+ * UART driver is included from the layout of the platform of the example,
+ * drivers/mss/mss_mmuart or the older drivers/mss_mmuart.
+ *
+ * Example:
+ * @code
+ *   static const bench_config_t g_config[] =
+ *   {
+ *       BENCH_CONFIG(MSS_MAC_RX_RING_SIZE),
+ *       BENCH_CONFIG(MSS_MAC_TX_RING_SIZE)
+ *   };
+ *   bench_report_t report;
+ *   bench_record_t record;
+ *
+ *   bench_report_begin(&report, &g_mss_uart0_lo, NULL, "mpfs-mac-benchmark",
+ *                      g_config, sizeof(g_config) / sizeof(g_config[0]));
+ *
+ *   bench_record_init(&record, "mac", "rtt", "udp");
+ *   record.size = 64u;
+ *   bench_record_samples(&record, g_rtt_ns, count);
+ *   record.lat_unit = "ns";
+ *   bench_report_result(&report, &record);
+ *
+ *   bench_report_end(&report);
+ * @endcode
+ */
+
+#ifndef BENCH_REPORT_H_
+#define BENCH_REPORT_H_
+
+#include <stdint.h>
+#if defined(__has_include)
+#if __has_include("drivers/mss/mss_mmuart/mss_uart.h")
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+#else
+#include "drivers/mss_mmuart/mss_uart.h"
+#endif
+#else
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+#endif
+
+/* Version of the format of the lines, given on the begin line */
+#define BENCH_REPORT_FORMAT         1u
+
+/* Longest line printed, longer strings are cut short */
+#ifndef BENCH_REPORT_LINE_SIZE
+#define BENCH_REPORT_LINE_SIZE      256u
+#endif
+
+/*
+ * A setting printed on a config line and taken into the fingerprint. The
+ * value is printed in hexadecimal.
+ */
+typedef struct
+{
+    const char * name;
+    uint64_t value;
+} bench_config_t;
+
+/* Entry of a bench_config_t table for a setting defined as a macro */
+#define BENCH_CONFIG(setting)       { #setting, (uint64_t)(setting) }
+
+/*
+ * One result line. Strings are printed with commas replaced by semicolons and
+ * spaces by underscores, leading and trailing spaces are dropped.
+ */
+typedef struct
+{
+    const char * suite;         /* Subsystem, e.g. "mac", "mmc", "ddr" */
+    const char * test;          /* Test within the suite, e.g. "adma2_read" */
+    const char * variant;       /* Other settings of the test, or "" */
+    uint32_t size;              /* Bytes per operation, 0 if not relevant */
+    uint32_t depth;             /* Operations in flight, or harts or channels
+                                   working at once, 1 if not relevant */
+    uint32_t samples;           /* Operations measured */
+    uint64_t rate;              /* Throughput in rate_unit, 0 if none */
+    const char * rate_unit;     /* e.g. "MB/s", "KB/s", "kbit/s", or "" */
+    uint64_t min;               /* Latency of an operation, in lat_unit,
+                                   0 for the values not measured */
+    uint64_t mean;
+    uint64_t p50;
+    uint64_t p99;
+    uint64_t max;
+    const char * lat_unit;      /* e.g. "ns", "us", "cycles", or "" */
+    uint32_t errors;            /* Failed operations, the other values are not
+                                   valid unless this is 0 */
+} bench_record_t;
+
+/*
+ * Function printing one line, instead of the UART driver, e.g. to take a lock
+ * when several harts print on the same UART.
+ */
+typedef void (*bench_report_tx_t)(const uint8_t * line);
+
+/* State of a report, from bench_report_begin() to bench_report_end() */
+typedef struct
+{
+    mss_uart_instance_t * uart;
+    bench_report_tx_t tx;
+    uint32_t fingerprint;
+    uint32_t results;
+} bench_report_t;
+
+/*------------------------------------------------------------------------------
+ * Starts a report, printing the begin, build, config, fingerprint and columns
+ * lines. The lines are sent to uart with MSS_UART_polled_tx_string(), or given
+ * to tx if it is not NULL. config is a table of config_count settings of the
+ * example, printed after the settings common to all the examples, and may be
+ * NULL if config_count is 0.
+ */
+void bench_report_begin(bench_report_t * report, mss_uart_instance_t * uart,
+                        bench_report_tx_t tx, const char * project,
+                        const bench_config_t * config, uint32_t config_count);
+
+/*------------------------------------------------------------------------------
+ * Prints a result line.
+ */
+void bench_report_result(bench_report_t * report,
+                         const bench_record_t * record);
+
+/*------------------------------------------------------------------------------
+ * Ends a report, printing the end line.
+ */
+void bench_report_end(bench_report_t * report);
+
+/*------------------------------------------------------------------------------
+ * Returns the fingerprint bench_report_begin() prints for the same settings,
+ * e.g. for an example to keep with results it stores.
+ */
+uint32_t bench_report_fingerprint(const bench_config_t * config,
+                                  uint32_t config_count);
+
+/*------------------------------------------------------------------------------
+ * Sets up a record with no values, a depth of 1 and no units.
+ */
+void bench_record_init(bench_record_t * record, const char * suite,
+                       const char * test, const char * variant);
+
+/*------------------------------------------------------------------------------
+ * Sorts count latency samples in place, in ascending order, and sets the
+ * samples, min, mean, p50, p99 and max fields of the record from them. The
+ * percentiles are by nearest rank. The fields are left unchanged if count is
+ * 0.
+ */
+void bench_record_samples(bench_record_t * record, uint64_t * samples,
+                          uint32_t count);
+
+#endif /* BENCH_REPORT_H_ */
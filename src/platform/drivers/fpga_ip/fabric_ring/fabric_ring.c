@@ -0,0 +1,228 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Fabric command ring driver implementation.
+ */
+#include "hal/hal.h"
+#include "fabric_ring_regs.h"
+#include "fabric_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ * Orders the writes to the rings before the doorbell write, and the read of a
+ * completion phase before the reads of the rest of the completion.
+ */
+#define FRING_FENCE_W_O()       __asm__ __volatile__ ("fence w,o" ::: "memory")
+#define FRING_FENCE_R_R()       __asm__ __volatile__ ("fence r,r" ::: "memory")
+
+/*------------------------------------------------------------------------------
+ * Local functions
+ */
+static uint32_t fring_is_pow2(uint32_t value);
+
+/*-------------------------------------------------------------------------*//**
+ * See fabric_ring.h for details of how to use this function.
+ */
+void FRING_init
+(
+    fring_instance_t * this_ring,
+    addr_t base_addr,
+    fring_desc_t * sq,
+    uint32_t sq_entries,
+    fring_cpl_t * cq,
+    uint32_t cq_entries,
+    fring_complete_t on_complete,
+    void * ctx
+)
+{
+    uint32_t inc;
+
+    HAL_ASSERT(0u != fring_is_pow2(sq_entries));
+    HAL_ASSERT(0u != fring_is_pow2(cq_entries));
+    HAL_ASSERT(cq_entries >= sq_entries);
+
+    this_ring->base_addr = base_addr;
+    this_ring->sq = sq;
+    this_ring->cq = cq;
+    this_ring->sq_mask = sq_entries - 1u;
+    this_ring->cq_mask = cq_entries - 1u;
+    this_ring->sq_tail = 0u;
+    this_ring->sq_rung = 0u;
+    this_ring->sq_head = 0u;
+    this_ring->cq_head = 0u;
+    this_ring->on_complete = on_complete;
+    this_ring->ctx = ctx;
+    this_ring->stats.submitted = 0u;
+    this_ring->stats.doorbells = 0u;
+    this_ring->stats.completions = 0u;
+    this_ring->stats.head_reads = 0u;
+    this_ring->stats.full = 0u;
+
+    for (inc = 0u; inc < cq_entries; inc++)
+    {
+        this_ring->cq[inc].phase = 0u;
+    }
+
+    HW_set_32bit_reg(base_addr + FRING_CTRL_REG_OFFSET, FRING_CTRL_RESET);
+    HW_set_32bit_reg(base_addr + FRING_SQ_BASE_LO_REG_OFFSET,
+                     (uint32_t)(uint64_t)sq);
+    HW_set_32bit_reg(base_addr + FRING_SQ_BASE_HI_REG_OFFSET,
+                     (uint32_t)((uint64_t)sq >> 32u));
+    HW_set_32bit_reg(base_addr + FRING_SQ_SIZE_REG_OFFSET, sq_entries);
+    HW_set_32bit_reg(base_addr + FRING_CQ_BASE_LO_REG_OFFSET,
+                     (uint32_t)(uint64_t)cq);
+    HW_set_32bit_reg(base_addr + FRING_CQ_BASE_HI_REG_OFFSET,
+                     (uint32_t)((uint64_t)cq >> 32u));
+    HW_set_32bit_reg(base_addr + FRING_CQ_SIZE_REG_OFFSET, cq_entries);
+    HW_set_32bit_reg(base_addr + FRING_CQ_HEAD_REG_OFFSET, 0u);
+    HW_set_32bit_reg(base_addr + FRING_STATUS_REG_OFFSET, FRING_STATUS_IRQ);
+
+    FRING_FENCE_W_O();
+    HW_set_32bit_reg(base_addr + FRING_CTRL_REG_OFFSET,
+                     FRING_CTRL_ENABLE | FRING_CTRL_IRQ_ENABLE);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See fabric_ring.h for details of how to use this function.
+ */
+uint32_t FRING_space(const fring_instance_t * this_ring)
+{
+    return (this_ring->sq_mask + 1u) -
+           (this_ring->sq_tail - this_ring->sq_head);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See fabric_ring.h for details of how to use this function.
+ */
+uint32_t FRING_submit
+(
+    fring_instance_t * this_ring,
+    const fring_desc_t * descs,
+    uint32_t count
+)
+{
+    uint32_t space = FRING_space(this_ring);
+    uint32_t done = 0u;
+
+    /* Only read the accelerator when the ring looks full */
+    if (space < count)
+    {
+        this_ring->sq_head = HW_get_32bit_reg(this_ring->base_addr +
+                                              FRING_SQ_HEAD_REG_OFFSET);
+        this_ring->stats.head_reads++;
+        space = FRING_space(this_ring);
+    }
+
+    while ((done < count) && (done < space))
+    {
+        this_ring->sq[this_ring->sq_tail & this_ring->sq_mask] = descs[done];
+        this_ring->sq_tail++;
+        done++;
+    }
+
+    this_ring->stats.submitted += done;
+    this_ring->stats.full += count - done;
+
+    return done;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See fabric_ring.h for details of how to use this function.
+ */
+void FRING_doorbell(fring_instance_t * this_ring)
+{
+    if (this_ring->sq_rung != this_ring->sq_tail)
+    {
+        FRING_FENCE_W_O();
+        HW_set_32bit_reg(this_ring->base_addr + FRING_SQ_TAIL_REG_OFFSET,
+                         this_ring->sq_tail);
+        this_ring->sq_rung = this_ring->sq_tail;
+        this_ring->stats.doorbells++;
+    }
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See fabric_ring.h for details of how to use this function.
+ *
+ * The phase expected is 1 on even passes round the ring, counting from 0.
+ */
+uint32_t FRING_poll(fring_instance_t * this_ring, uint32_t max)
+{
+    volatile fring_cpl_t * entry;
+    fring_cpl_t cpl;
+    uint16_t phase;
+    uint32_t done = 0u;
+    uint32_t empty = 0u;
+
+    while ((done < max) && (0u == empty))
+    {
+        entry = &this_ring->cq[this_ring->cq_head & this_ring->cq_mask];
+        phase = (uint16_t)(1u ^ ((this_ring->cq_head /
+                                  (this_ring->cq_mask + 1u)) & 1u));
+
+        if ((entry->phase & 1u) == phase)
+        {
+            FRING_FENCE_R_R();
+            cpl.tag = entry->tag;
+            cpl.status = entry->status;
+            cpl.phase = phase;
+            cpl.result = entry->result;
+
+            this_ring->cq_head++;
+            done++;
+            this_ring->on_complete(this_ring->ctx, &cpl);
+        }
+        else
+        {
+            empty = 1u;
+        }
+    }
+
+    if (0u != done)
+    {
+        HW_set_32bit_reg(this_ring->base_addr + FRING_CQ_HEAD_REG_OFFSET,
+                         this_ring->cq_head);
+        this_ring->stats.completions += done;
+    }
+
+    return done;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See fabric_ring.h for details of how to use this function.
+ *
+ * The interrupt is cleared before the ring is read, so a completion written
+ * while the ring is read raises it again.
+ */
+void FRING_isr(fring_instance_t * this_ring)
+{
+    HW_set_32bit_reg(this_ring->base_addr + FRING_STATUS_REG_OFFSET,
+                     FRING_STATUS_IRQ);
+    (void)FRING_poll(this_ring, 0xFFFFFFFFu);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See fabric_ring.h for details of how to use this function.
+ */
+void FRING_f2h_handler(uint32_t f2h, void * arg)
+{
+    (void)f2h;
+    FRING_isr((fring_instance_t *)arg);
+}
+
+/*------------------------------------------------------------------------------
+ * Non zero if value is a power of two.
+ */
+static uint32_t fring_is_pow2(uint32_t value)
+{
+    return ((0u != value) && (0u == (value & (value - 1u)))) ? 1u : 0u;
+}
+
+#ifdef __cplusplus
+}
+#endif
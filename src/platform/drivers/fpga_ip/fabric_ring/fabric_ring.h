@@ -0,0 +1,237 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * Fabric command ring driver public API.
+ */
+/*=========================================================================*//**
+  @mainpage Fabric command ring driver
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The fabric command ring driver passes commands to an accelerator in the FPGA
+  fabric, e.g. a CRC, crypto or DSP kernel, and takes back its completions. It
+  is the common part of the drivers of such accelerators, which define the
+  opcodes and the meaning of the command and completion fields.
+
+  ==============================================================================
+  Hardware Flow Dependencies
+  ==============================================================================
+  The accelerator implements the registers of fabric_ring_regs.h on a FIC
+  slave port, and masters the FIC to read the submission ring and the data and
+  to write the completion ring and the results. Its interrupt is wired to one
+  of the fabric to hart (F2H) interrupts.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  Two rings are held in memory, each a power of two entries:
+    - the submission ring, of fring_desc_t commands written by the host and
+      read by the accelerator
+    - the completion ring, of fring_cpl_t completions written by the
+      accelerator and read by the host
+
+  The commands carry the addresses of the data, as seen from the fabric, so
+  the data is not copied. FRING_submit() copies commands into the submission
+  ring without telling the accelerator, FRING_doorbell() then writes the
+  doorbell register once for all the commands submitted since the last one.
+  The consumer index of the accelerator is only read when the submission ring
+  looks full.
+
+  The accelerator writes the phase field of a completion last, 1 on the first
+  pass round the completion ring, 0 on the second, and so on. The host so
+  finds new completions from memory, without reading the accelerator, and
+  writes the completion consumer index once per batch. FRING_isr(), called
+  from the F2H interrupt handler, or FRING_poll() call the completion handler
+  given to FRING_init() for each new completion.
+
+  The buffers and the rings must be in memory the fabric sees the latest
+  writes of the harts in, e.g. non-cached DDR, else the caller flushes them.
+  The functions of an instance must be called from one hart, with FRING_isr()
+  from an interrupt of that hart.
+
+  Example, a CRC accelerator on FIC0 and F2H 4 with U54_1:
+  @code
+    static fring_instance_t g_crc;
+    static fring_desc_t g_crc_sq[64] __attribute__((aligned(64)));
+    static fring_cpl_t g_crc_cq[64] __attribute__((aligned(64)));
+
+    static void crc_done(void * ctx, const fring_cpl_t * cpl)
+    {
+        crc_result(cpl->tag, (uint32_t)cpl->result);
+    }
+
+    void u54_1(void)
+    {
+        fring_desc_t desc = {CRC32_OPCODE, 0u, 1u, (uint64_t)buf, 0u,
+                             sizeof(buf), 0u};
+
+        FRING_init(&g_crc, 0x60000000u, g_crc_sq, 64u, g_crc_cq, 64u,
+                   crc_done, 0);
+        (void)mss_f2h_attach(4u, FRING_f2h_handler, &g_crc);
+        __enable_irq();
+
+        (void)FRING_submit(&g_crc, &desc, 1u);
+        FRING_doorbell(&g_crc);
+    }
+  @endcode
+ */
+#ifndef FABRIC_RING_H_
+#define FABRIC_RING_H_
+
+#include <stdint.h>
+#include "hal/cpu_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  A command, 32 bytes. The accelerator defines opcode, flags, param and the
+  use of the addresses. tag is returned in the completion.
+ */
+typedef struct
+{
+    uint16_t opcode;
+    uint16_t flags;
+    uint32_t tag;
+    uint64_t src;
+    uint64_t dst;
+    uint32_t length;
+    uint32_t param;
+} fring_desc_t;
+
+/*-------------------------------------------------------------------------*//**
+  A completion, 16 bytes, status 0 for success.
+ */
+typedef struct
+{
+    uint32_t tag;
+    uint16_t status;
+    uint16_t phase;
+    uint64_t result;
+} fring_cpl_t;
+
+/*-------------------------------------------------------------------------*//**
+  Completion handler, called for each completion. The completion is only valid
+  until the handler returns.
+ */
+typedef void (*fring_complete_t)(void * ctx, const fring_cpl_t * cpl);
+
+typedef struct
+{
+    uint64_t submitted;             /* Commands submitted */
+    uint64_t doorbells;             /* Doorbell writes */
+    uint64_t completions;           /* Completions handled */
+    uint64_t head_reads;            /* Reads of the consumer index */
+    uint64_t full;                  /* Commands refused, ring full */
+} fring_stats_t;
+
+/*-------------------------------------------------------------------------*//**
+  An instance of the driver, one for each accelerator.
+ */
+typedef struct
+{
+    addr_t base_addr;
+    volatile fring_desc_t * sq;
+    volatile fring_cpl_t * cq;
+    uint32_t sq_mask;
+    uint32_t cq_mask;
+    uint32_t sq_tail;               /* Next command to fill */
+    uint32_t sq_rung;               /* Last index written to the doorbell */
+    uint32_t sq_head;               /* Last consumer index read */
+    uint32_t cq_head;               /* Next completion */
+    fring_complete_t on_complete;
+    void * ctx;
+    fring_stats_t stats;
+} fring_instance_t;
+
+/*-------------------------------------------------------------------------*//**
+  FRING_init() resets the accelerator, gives it the rings and enables it with
+  its interrupt. sq_entries and cq_entries are powers of two, cq_entries at
+  least sq_entries. The completion ring is cleared.
+ */
+void FRING_init
+(
+    fring_instance_t * this_ring,
+    addr_t base_addr,
+    fring_desc_t * sq,
+    uint32_t sq_entries,
+    fring_cpl_t * cq,
+    uint32_t cq_entries,
+    fring_complete_t on_complete,
+    void * ctx
+);
+
+/*-------------------------------------------------------------------------*//**
+  FRING_space() returns the number of commands which can be submitted at
+  present, without reading the accelerator.
+ */
+uint32_t FRING_space(const fring_instance_t * this_ring);
+
+/*-------------------------------------------------------------------------*//**
+  FRING_submit() copies up to count commands into the submission ring. They
+  are passed to the accelerator by the next FRING_doorbell().
+
+  @return
+    The number of commands submitted, fewer than count if the ring is full.
+ */
+uint32_t FRING_submit
+(
+    fring_instance_t * this_ring,
+    const fring_desc_t * descs,
+    uint32_t count
+);
+
+/*-------------------------------------------------------------------------*//**
+  FRING_doorbell() passes the commands submitted since the last call to the
+  accelerator, with a single register write, if there are any.
+ */
+void FRING_doorbell(fring_instance_t * this_ring);
+
+/*-------------------------------------------------------------------------*//**
+  FRING_poll() calls the completion handler for up to max new completions.
+
+  @return
+    The number of completions handled.
+ */
+uint32_t FRING_poll(fring_instance_t * this_ring, uint32_t max);
+
+/*-------------------------------------------------------------------------*//**
+  FRING_isr() clears the interrupt of the accelerator and handles all the new
+  completions. It is called from the interrupt handler of the F2H interrupt of
+  the accelerator.
+ */
+void FRING_isr(fring_instance_t * this_ring);
+
+/*-------------------------------------------------------------------------*//**
+  FRING_f2h_handler() calls FRING_isr() for the instance arg. It has the type
+  of the handlers of mss_f2h_attach().
+ */
+void FRING_f2h_handler(uint32_t f2h, void * arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FABRIC_RING_H_ */
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Register map of the fabric command ring interface, the registers a fabric
+ * accelerator block implements on its FIC slave port for use with the
+ * fabric_ring driver. All registers are 32 bits wide.
+ */
+#ifndef FABRIC_RING_REGS_H_
+#define FABRIC_RING_REGS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ * Submission ring base address, low and high, and size in entries.
+ */
+#define FRING_SQ_BASE_LO_REG_OFFSET         0x00u
+#define FRING_SQ_BASE_HI_REG_OFFSET         0x04u
+#define FRING_SQ_SIZE_REG_OFFSET            0x08u
+
+/*------------------------------------------------------------------------------
+ * Submission ring doorbell. Written by the host with its producer index, the
+ * index of the next entry it will fill, modulo 2^32.
+ */
+#define FRING_SQ_TAIL_REG_OFFSET            0x0Cu
+
+/*------------------------------------------------------------------------------
+ * Submission ring consumer index, read only. The index of the next entry the
+ * accelerator will read, modulo 2^32.
+ */
+#define FRING_SQ_HEAD_REG_OFFSET            0x10u
+
+/*------------------------------------------------------------------------------
+ * Completion ring base address, low and high, and size in entries.
+ */
+#define FRING_CQ_BASE_LO_REG_OFFSET         0x14u
+#define FRING_CQ_BASE_HI_REG_OFFSET         0x18u
+#define FRING_CQ_SIZE_REG_OFFSET            0x1Cu
+
+/*------------------------------------------------------------------------------
+ * Completion ring consumer index, written by the host, modulo 2^32. The
+ * accelerator does not write a completion entry the host has not consumed.
+ */
+#define FRING_CQ_HEAD_REG_OFFSET            0x20u
+
+/*------------------------------------------------------------------------------
+ * Control register.
+ */
+#define FRING_CTRL_REG_OFFSET               0x24u
+
+#define FRING_CTRL_ENABLE                   0x01u
+#define FRING_CTRL_IRQ_ENABLE               0x02u
+#define FRING_CTRL_RESET                    0x80u
+
+/*------------------------------------------------------------------------------
+ * Status register. The interrupt bit is cleared by writing 1 to it.
+ */
+#define FRING_STATUS_REG_OFFSET             0x28u
+
+#define FRING_STATUS_IRQ                    0x01u
+#define FRING_STATUS_ERROR                  0x02u
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FABRIC_RING_REGS_H_ */
@@ -11,6 +11,7 @@
 /*******************************************************************************
  * Include files
  */
+#include <string.h>
 #include "mpfs_hal/mss_hal.h"
 #include "mss_can.h"
 
@@ -33,6 +34,11 @@ extern "C" {
 #define    ENABLE                        1u
 #define    DISABLE                       0u
 #define    SYSREG_CAN_SOFTRESET_MASK     (uint32_t)(3 << 14u)
+#define    CAN_STD_ID_SHIFT              21u
+#define    CAN_EXT_ID_SHIFT              3u
+#define    CAN_STD_UNUSED_ID_MASK        (0x3FFFFu << 3u)
+#define    CAN_FILTER_RTR_MASK           (1u << 1u)
+#define    CAN_DATA_DONT_CARE            0xFFFFu
 
 /*******************************************************************************
  * Instance definition
@@ -47,6 +53,62 @@ static void global_init
     mss_can_instance_t* this_wd
 );
 
+static uint32_t filter_ids_covered
+(
+    const uint32_t ids[],
+    uint32_t id_count,
+    uint32_t code,
+    uint32_t mask
+);
+
+static uint32_t filter_bit_count
+(
+    uint32_t mask
+);
+
+static uint32_t tx_sched_key
+(
+    pmss_can_msgobject pmsg
+);
+
+static void tx_sched_copy
+(
+    pmss_can_msgobject pdst,
+    pmss_can_msgobject psrc
+);
+
+static void tx_sched_push
+(
+    mss_can_tx_sched_t* sched,
+    pmss_can_msgobject pmsg
+);
+
+static void tx_sched_pop
+(
+    mss_can_tx_sched_t* sched,
+    pmss_can_msgobject pmsg
+);
+
+static void tx_sched_run
+(
+    mss_can_instance_t* this_can
+);
+
+#ifdef MSS_CAN_STATS
+static void stats_frame
+(
+    mss_can_instance_t* this_can,
+    pmss_can_msgobject pmsg,
+    uint8_t is_rx
+);
+
+static void stats_occupancy
+(
+    uint8_t* phwm,
+    uint32_t status
+);
+#endif
+
 /***************************************************************************//**
  * MSS_CAN_init()
  * See "mss_can.h" for details of how to use this function.
@@ -71,6 +133,15 @@ MSS_CAN_init
     /* Initialize the device structure */
     this_can->basic_can_rx_mb = basic_can_rx_mb;
     this_can->basic_can_tx_mb = basic_can_tx_mb;
+    this_can->tx_sched = (mss_can_tx_sched_t*)0;
+    this_can->rx_ring = (pmss_can_msgobject)0;
+    this_can->rx_ring_mask = 0u;
+    this_can->rx_ring_head = 0u;
+    this_can->rx_ring_tail = 0u;
+    MSS_STAT_CLEAR(this_can->rx_ring_full);
+#ifdef MSS_CAN_STATS
+    MSS_CAN_stats_reset(this_can);
+#endif
 
     /* Initialize the rx mailbox */
     canrxobj.ID = 0u;
@@ -196,13 +267,13 @@ MSS_CAN_start
     
     /* Enable CAN Interrupt at NVIC level- if supported */
 #ifdef MSS_CAN_ENABLE_INTERRUPTS
-    if (if (&g_mss_can_0_lo == this_can) || (&g_mss_can_0_hi == this_can))
+    if ((&g_mss_can_0_lo == this_can) || (&g_mss_can_0_hi == this_can))
     {
-        PLIC_DisableIRQ(CAN0_PLIC);
+        PLIC_EnableIRQ(CAN0_PLIC);
     }
     else
     {
-        PLIC_DisableIRQ(CAN1_PLIC);
+        PLIC_EnableIRQ(CAN1_PLIC);
     }
 #endif
 
@@ -559,6 +630,12 @@ MSS_CAN_get_message_n
         /* Get DLC, IDE and RTR and time stamp. */
         pmsg->L = this_can->hw_reg->RxMsg[mailbox_number].RXB.L;
 
+#ifdef MSS_CAN_STATS
+        stats_occupancy(&this_can->stats.rx_mailbox_hwm,
+                        MSS_CAN_get_rx_buffer_status(this_can));
+        stats_frame(this_can, pmsg, 1u);
+#endif
+
         /* Ack that it's been removed from the FIFO */
         this_can->hw_reg->RxMsg[mailbox_number].RXB.MSGAV = ENABLE;
 
@@ -609,6 +686,12 @@ MSS_CAN_get_message
 
             /* Get DLC, IDE and RTR and time stamp.*/
             pmsg->L = this_can->hw_reg->RxMsg[mailbox_number].RXB.L;
+
+#ifdef MSS_CAN_STATS
+            stats_occupancy(&this_can->stats.rx_mailbox_hwm,
+                            MSS_CAN_get_rx_buffer_status(this_can));
+            stats_frame(this_can, pmsg, 1u);
+#endif
         
             /* Ack that it's been removed from the FIFO */
             this_can->hw_reg->RxMsg[mailbox_number].RXB.MSGAV = ENABLE;
@@ -687,6 +770,11 @@ MSS_CAN_send_message_n
         this_can->hw_reg->TxMsg[mailbox_number].TXB.L = (pmsg->L | \
                                                    CAN_TX_WPNH_EBL | \
                                                    CAN_TX_REQ);
+#ifdef MSS_CAN_STATS
+        stats_occupancy(&this_can->stats.tx_mailbox_hwm,
+                        MSS_CAN_get_tx_buffer_status(this_can));
+        stats_frame(this_can, pmsg, 0u);
+#endif
         return (CAN_VALID_MSG);
     }
     else
@@ -801,6 +889,11 @@ MSS_CAN_send_message
             this_can->hw_reg->TxMsg[mailbox_number].TXB.L = (pmsg->L | \
                                                    CAN_TX_WPNH_EBL | \
                                                    CAN_TX_REQ);
+#ifdef MSS_CAN_STATS
+            stats_occupancy(&this_can->stats.tx_mailbox_hwm,
+                            MSS_CAN_get_tx_buffer_status(this_can));
+            stats_frame(this_can, pmsg, 0u);
+#endif
             success = CAN_VALID_MSG;
             break;
         }
@@ -973,6 +1066,880 @@ MSS_CAN_get_tx_gte96
                                                                 CAN_FLAG_MASK);
 }
 
+/***************************************************************************//**
+ * MSS_CAN_tx_sched_init()
+ * See "mss_can.h" for details of how to use this function.
+ */
+uint8_t
+MSS_CAN_tx_sched_init
+(
+    mss_can_instance_t* this_can,
+    mss_can_tx_sched_t* sched,
+    pmss_can_msgobject heap,
+    uint32_t heap_size,
+    uint8_t mailboxes
+)
+{
+    if ((0u == mailboxes) ||
+        (mailboxes > (CAN_TX_MAILBOX - this_can->basic_can_tx_mb)))
+    {
+        return (CAN_INVALID_MAILBOX);
+    }
+
+    sched->heap = heap;
+    sched->heap_size = heap_size;
+    sched->heap_count = 0u;
+    sched->busy = 0u;
+    sched->mailboxes = mailboxes;
+    this_can->tx_sched = sched;
+
+    return (CAN_OK);
+}
+
+/***************************************************************************//**
+ * MSS_CAN_tx_sched_send()
+ * See "mss_can.h" for details of how to use this function.
+ */
+uint8_t
+MSS_CAN_tx_sched_send
+(
+    mss_can_instance_t* this_can,
+    pmss_can_msgobject pmsg
+)
+{
+    mss_can_tx_sched_t* sched = this_can->tx_sched;
+    uint8_t success = CAN_NO_MSG;
+
+    /* Can't send if device is disabled */
+    if (DISABLE == this_can->hw_reg->Command.RUN_STOP)
+    {
+        return (CAN_NO_MSG);
+    }
+
+    /* Shut down interrupts from the MSS CAN while we do this */
+    PLIC_DisableIRQ(this_can->irqn);
+
+    if (sched->heap_count < sched->heap_size)
+    {
+        tx_sched_push(sched, pmsg);
+        tx_sched_run(this_can);
+        success = CAN_VALID_MSG;
+    }
+
+    PLIC_EnableIRQ(this_can->irqn);
+
+    return (success);
+}
+
+/***************************************************************************//**
+ * MSS_CAN_tx_sched_service()
+ * See "mss_can.h" for details of how to use this function.
+ */
+void
+MSS_CAN_tx_sched_service
+(
+    mss_can_instance_t* this_can
+)
+{
+    if ((mss_can_tx_sched_t*)0 != this_can->tx_sched)
+    {
+        tx_sched_run(this_can);
+    }
+}
+
+/***************************************************************************//**
+ * MSS_CAN_rx_ring_init()
+ * See "mss_can.h" for details of how to use this function.
+ */
+uint8_t
+MSS_CAN_rx_ring_init
+(
+    mss_can_instance_t* this_can,
+    pmss_can_msgobject ring,
+    uint32_t ring_size
+)
+{
+    if ((ring_size < 2u) || (0u != (ring_size & (ring_size - 1u))))
+    {
+        return (CAN_ERR);
+    }
+
+    this_can->rx_ring = ring;
+    this_can->rx_ring_mask = ring_size - 1u;
+    this_can->rx_ring_head = 0u;
+    this_can->rx_ring_tail = 0u;
+    MSS_STAT_CLEAR(this_can->rx_ring_full);
+
+    return (CAN_OK);
+}
+
+/***************************************************************************//**
+ * MSS_CAN_rx_drain()
+ * See "mss_can.h" for details of how to use this function.
+ */
+uint32_t
+MSS_CAN_rx_drain
+(
+    mss_can_instance_t* this_can
+)
+{
+    uint32_t pending;
+    uint32_t head;
+    uint32_t copied = 0u;
+    uint8_t mailbox_number;
+    pmss_can_msgobject pmsg;
+
+    if ((pmss_can_msgobject)0 == this_can->rx_ring)
+    {
+        return (0u);
+    }
+
+    pending = MSS_CAN_get_rx_buffer_status(this_can);
+    head = this_can->rx_ring_head;
+#ifdef MSS_CAN_STATS
+    stats_occupancy(&this_can->stats.rx_mailbox_hwm, pending);
+#endif
+
+    for (mailbox_number = 0u; (mailbox_number < CAN_RX_MAILBOX) &&
+                              (0u != pending); mailbox_number++)
+    {
+        if (0u != (pending & ((uint32_t)1u << mailbox_number)))
+        {
+            pending &= ~((uint32_t)1u << mailbox_number);
+
+            if ((head - this_can->rx_ring_tail) > this_can->rx_ring_mask)
+            {
+                /* Ring full, leave the rest in the mailboxes. */
+                MSS_STAT_INC(this_can->rx_ring_full);
+                pending = 0u;
+            }
+            else
+            {
+                pmsg = &this_can->rx_ring[head & this_can->rx_ring_mask];
+
+                pmsg->ID = this_can->hw_reg->RxMsg[mailbox_number].ID;
+                pmsg->DATALOW = this_can->hw_reg->RxMsg[mailbox_number].DATALOW;
+                pmsg->DATAHIGH = this_can->hw_reg->RxMsg[mailbox_number].DATAHIGH;
+                pmsg->L = this_can->hw_reg->RxMsg[mailbox_number].RXB.L;
+#ifdef MSS_CAN_STATS
+                stats_frame(this_can, pmsg, 1u);
+#endif
+
+                /* Ack that it's been removed from the mailbox */
+                this_can->hw_reg->RxMsg[mailbox_number].RXB.MSGAV = ENABLE;
+
+                head++;
+                copied++;
+            }
+        }
+    }
+
+    /* Make the entries visible before the new head. */
+    mb();
+    this_can->rx_ring_head = head;
+
+    return (copied);
+}
+
+/***************************************************************************//**
+ * MSS_CAN_rx_ring_get()
+ * See "mss_can.h" for details of how to use this function.
+ */
+uint8_t
+MSS_CAN_rx_ring_get
+(
+    mss_can_instance_t* this_can,
+    pmss_can_msgobject pmsg
+)
+{
+    uint32_t tail = this_can->rx_ring_tail;
+    pmss_can_msgobject pentry;
+
+    if (tail == this_can->rx_ring_head)
+    {
+        return (CAN_NO_MSG);
+    }
+
+    /* Read the entry only after seeing the head which covers it. */
+    mb();
+    pentry = &this_can->rx_ring[tail & this_can->rx_ring_mask];
+    pmsg->ID = pentry->ID;
+    pmsg->DATALOW = pentry->DATALOW;
+    pmsg->DATAHIGH = pentry->DATAHIGH;
+    pmsg->L = pentry->L;
+
+    /* Finish with the entry before handing it back to the drain. */
+    mb();
+    this_can->rx_ring_tail = tail + 1u;
+
+    return (CAN_VALID_MSG);
+}
+
+/***************************************************************************//**
+ * MSS_CAN_pack_id_filters()
+ * See "mss_can.h" for details of how to use this function.
+ */
+uint32_t
+MSS_CAN_pack_id_filters
+(
+    const uint32_t ids[],
+    uint32_t id_count,
+    mss_can_id_filter_t filters[],
+    uint32_t max_filters
+)
+{
+    uint32_t count = id_count;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t mask;
+    uint32_t code;
+    uint32_t extra;
+    uint32_t size;
+    uint32_t best_i = 0u;
+    uint32_t best_j = 0u;
+    uint32_t best_extra;
+    uint32_t best_size;
+    uint8_t done = 0u;
+
+    ASSERT(0u != max_filters);
+
+    for (i = 0u; i < count; i++)
+    {
+        filters[i].code = ids[i];
+        filters[i].mask = 0u;
+    }
+
+    while ((count > 1u) && (0u == done))
+    {
+        best_extra = 0xFFFFFFFFu;
+        best_size = 0xFFFFFFFFu;
+
+        /* Find the merge letting the fewest unlisted IDs through. */
+        for (i = 0u; i < count; i++)
+        {
+            for (j = i + 1u; j < count; j++)
+            {
+                mask = filters[i].mask | filters[j].mask |
+                       (filters[i].code ^ filters[j].code);
+                code = filters[i].code & ~mask;
+                size = filter_bit_count(mask);
+                size = (size < 32u) ? ((uint32_t)1u << size) : 0xFFFFFFFFu;
+                extra = filter_ids_covered(ids, id_count, code, mask);
+                extra = (extra < size) ? (size - extra) : 0u;
+
+                if ((extra < best_extra) ||
+                    ((extra == best_extra) && (size < best_size)))
+                {
+                    best_extra = extra;
+                    best_size = size;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+
+        if ((0u != best_extra) && (count <= max_filters))
+        {
+            done = 1u;
+        }
+        else
+        {
+            mask = filters[best_i].mask | filters[best_j].mask |
+                   (filters[best_i].code ^ filters[best_j].code);
+            code = filters[best_i].code & ~mask;
+            filters[best_i].code = code;
+            filters[best_i].mask = mask;
+
+            /* Drop the merged filter and any other one now covered. */
+            k = 0u;
+            for (i = 0u; i < count; i++)
+            {
+                if ((i == best_i) ||
+                    ((i != best_j) &&
+                     ((0u != (filters[i].mask & ~mask)) ||
+                      (code != (filters[i].code & ~mask)))))
+                {
+                    filters[k] = filters[i];
+                    if (i == best_i)
+                    {
+                        best_i = k;
+                    }
+                    k++;
+                }
+            }
+            count = k;
+        }
+    }
+
+    return (count);
+}
+
+/***************************************************************************//**
+ * MSS_CAN_set_id_filters()
+ * See "mss_can.h" for details of how to use this function.
+ */
+uint8_t
+MSS_CAN_set_id_filters
+(
+    mss_can_instance_t* this_can,
+    const mss_can_id_filter_t filters[],
+    uint8_t filter_count,
+    uint8_t ide
+)
+{
+    uint8_t mailbox_number;
+    uint8_t full_can_rx_mb = CAN_RX_MAILBOX - this_can->basic_can_rx_mb;
+    uint32_t amr;
+
+    if (filter_count > full_can_rx_mb)
+    {
+        return (CAN_INVALID_MAILBOX);
+    }
+
+    for (mailbox_number = 0u; mailbox_number < full_can_rx_mb;
+                                                         mailbox_number++)
+    {
+        if (mailbox_number < filter_count)
+        {
+            if (ide)
+            {
+                amr = filters[mailbox_number].mask << CAN_EXT_ID_SHIFT;
+            }
+            else
+            {
+                amr = (filters[mailbox_number].mask << CAN_STD_ID_SHIFT) |
+                      CAN_STD_UNUSED_ID_MASK;
+            }
+
+            (void)MSS_CAN_set_mask_n(this_can, mailbox_number,
+                                     amr | CAN_FILTER_RTR_MASK,
+                                     MSS_CAN_get_msg_filter_mask(
+                                         filters[mailbox_number].code, ide, 0u),
+                                     CAN_DATA_DONT_CARE, 0u);
+
+            this_can->hw_reg->RxMsg[mailbox_number].RXB.L =
+                                          (CAN_RX_WPNH_EBL | CAN_RX_WPNL_EBL | \
+                                          CAN_RX_BUFFER_EBL | CAN_RX_INT_EBL);
+        }
+        else
+        {
+            this_can->hw_reg->RxMsg[mailbox_number].RXB.L =
+                                          (CAN_RX_WPNH_EBL | CAN_RX_WPNL_EBL);
+        }
+    }
+
+    return (CAN_OK);
+}
+
+/*******************************************************************************
+ * Sets a mailbox high-water mark from a buffer status bit map.
+ */
+#ifdef MSS_CAN_STATS
+static void stats_occupancy
+(
+    uint8_t* phwm,
+    uint32_t status
+)
+{
+    uint8_t used = 0u;
+
+    while (0u != status)
+    {
+        status &= status - 1u;
+        used++;
+    }
+
+    if (used > *phwm)
+    {
+        *phwm = used;
+    }
+}
+
+/*******************************************************************************
+ * Counts a frame read from or loaded into a mailbox.
+ */
+static void stats_frame
+(
+    mss_can_instance_t* this_can,
+    pmss_can_msgobject pmsg,
+    uint8_t is_rx
+)
+{
+    mss_can_stats_t* stats = &this_can->stats;
+    uint32_t id = MSS_CAN_get_id(pmsg) | ((uint32_t)pmsg->IDE << 31u);
+    uint32_t dlc = pmsg->DLC;
+    uint32_t bits;
+    uint64_t latency;
+    uint32_t idx;
+
+    /* Frame bits less stuffing: 47 for a standard frame, 67 for an extended
+     * one, plus the data bytes of a data frame. */
+    if (dlc > 8u)
+    {
+        dlc = 8u;
+    }
+    bits = (0u != pmsg->IDE) ? 67u : 47u;
+    if (0u == pmsg->RTR)
+    {
+        bits += 8u * dlc;
+    }
+
+    for (idx = 0u; (idx < stats->id_count) && (stats->ids[idx].id != id); idx++)
+    {
+        ;
+    }
+    if ((idx == stats->id_count) && (idx < MSS_CAN_STATS_IDS))
+    {
+        stats->ids[idx].id = id;
+        stats->ids[idx].rx_frames = 0u;
+        stats->ids[idx].tx_frames = 0u;
+        stats->id_count++;
+    }
+
+    if (0u != is_rx)
+    {
+        stats->rx_frames++;
+        stats->rx_bits += bits;
+        if (idx < stats->id_count)
+        {
+            stats->ids[idx].rx_frames++;
+        }
+        else
+        {
+            stats->ids_other++;
+        }
+
+        if (0u != stats->irq_time)
+        {
+            latency = readmtime() - stats->irq_time;
+            stats->rx_latency_sum += latency;
+            stats->rx_latency_count++;
+            if (latency > stats->rx_latency_max)
+            {
+                stats->rx_latency_max = latency;
+            }
+        }
+    }
+    else
+    {
+        stats->tx_frames++;
+        stats->tx_bits += bits;
+        if (idx < stats->id_count)
+        {
+            stats->ids[idx].tx_frames++;
+        }
+        else
+        {
+            stats->ids_other++;
+        }
+    }
+}
+#endif
+
+/*******************************************************************************
+ * Priority key of a message, lower is sent first. The left aligned ID decides,
+ * then a standard frame wins over an extended one and a data frame over a
+ * remote frame, as in bus arbitration.
+ */
+static uint32_t tx_sched_key
+(
+    pmss_can_msgobject pmsg
+)
+{
+    return (((uint32_t)pmsg->ID << 2u) | ((uint32_t)pmsg->IDE << 1u) |
+            (uint32_t)pmsg->RTR);
+}
+
+/*******************************************************************************
+ * Copies a message object.
+ */
+static void tx_sched_copy
+(
+    pmss_can_msgobject pdst,
+    pmss_can_msgobject psrc
+)
+{
+    pdst->ID = psrc->ID;
+    pdst->DATALOW = psrc->DATALOW;
+    pdst->DATAHIGH = psrc->DATAHIGH;
+    pdst->L = psrc->L;
+}
+
+/*******************************************************************************
+ * Adds a message to the priority queue. There must be room for it.
+ */
+static void tx_sched_push
+(
+    mss_can_tx_sched_t* sched,
+    pmss_can_msgobject pmsg
+)
+{
+    uint32_t idx = sched->heap_count;
+    uint32_t parent;
+    uint32_t key = tx_sched_key(pmsg);
+
+    sched->heap_count++;
+    while (idx > 0u)
+    {
+        parent = (idx - 1u) / 2u;
+        if (tx_sched_key(&sched->heap[parent]) <= key)
+        {
+            break;
+        }
+        tx_sched_copy(&sched->heap[idx], &sched->heap[parent]);
+        idx = parent;
+    }
+    tx_sched_copy(&sched->heap[idx], pmsg);
+}
+
+/*******************************************************************************
+ * Removes the most urgent message from the priority queue, which must not be
+ * empty.
+ */
+static void tx_sched_pop
+(
+    mss_can_tx_sched_t* sched,
+    pmss_can_msgobject pmsg
+)
+{
+    uint32_t idx = 0u;
+    uint32_t child;
+    uint32_t count;
+    uint32_t key;
+
+    tx_sched_copy(pmsg, &sched->heap[0]);
+
+    sched->heap_count--;
+    count = sched->heap_count;
+    if (count > 0u)
+    {
+        key = tx_sched_key(&sched->heap[count]);
+        child = 1u;
+        while (child < count)
+        {
+            if (((child + 1u) < count) &&
+                (tx_sched_key(&sched->heap[child + 1u]) <
+                 tx_sched_key(&sched->heap[child])))
+            {
+                child++;
+            }
+            if (key <= tx_sched_key(&sched->heap[child]))
+            {
+                break;
+            }
+            tx_sched_copy(&sched->heap[idx], &sched->heap[child]);
+            idx = child;
+            child = (2u * idx) + 1u;
+        }
+        tx_sched_copy(&sched->heap[idx], &sched->heap[count]);
+    }
+}
+
+/*******************************************************************************
+ * Releases the mailboxes which have been sent and loads queued messages.
+ *
+ * With fixed priority arbitration a free mailbox may only take the most
+ * urgent queued message if that keeps the loaded mailboxes in ID order, so
+ * the controller sends them in priority order. With round robin arbitration
+ * only one mailbox is loaded at a time. When no mailbox can take the most
+ * urgent message, the least urgent loaded message that it should go before
+ * is aborted and queued again.
+ */
+static void tx_sched_run
+(
+    mss_can_instance_t* this_can
+)
+{
+    mss_can_tx_sched_t* sched = this_can->tx_sched;
+    uint32_t key;
+    uint32_t bit;
+    uint8_t fixed = (uint8_t)this_can->hw_reg->Config.CFG_ARBITER;
+    uint8_t mailbox_number;
+    uint8_t target;
+    uint8_t victim;
+    uint8_t progress = 1u;
+
+    /* Release the mailboxes which are neither requesting nor aborting. */
+    for (mailbox_number = 0u; mailbox_number < sched->mailboxes;
+                                                        mailbox_number++)
+    {
+        bit = (uint32_t)1u << mailbox_number;
+        if ((0u != (sched->busy & bit)) &&
+            (0u == (this_can->hw_reg->TxMsg[mailbox_number].TXB.L &
+                    (CAN_TX_REQ | CAN_TX_ABORT))))
+        {
+            sched->busy &= ~bit;
+        }
+    }
+
+    while ((sched->heap_count > 0u) && (0u != progress))
+    {
+        progress = 0u;
+        key = tx_sched_key(&sched->heap[0]);
+        target = sched->mailboxes;
+        victim = sched->mailboxes;
+
+        if (0u != fixed)
+        {
+            /* Free mailbox with only more urgent messages below it and only
+             * less urgent ones above it. */
+            for (mailbox_number = 0u; (mailbox_number < sched->mailboxes) &&
+                                      (target == sched->mailboxes);
+                                                        mailbox_number++)
+            {
+                if (0u == (sched->busy & ((uint32_t)1u << mailbox_number)))
+                {
+                    target = mailbox_number;
+                    for (victim = 0u; victim < sched->mailboxes; victim++)
+                    {
+                        if ((0u != (sched->busy & ((uint32_t)1u << victim))) &&
+                            (((victim < mailbox_number) &&
+                              (sched->inflight_key[victim] > key)) ||
+                             ((victim > mailbox_number) &&
+                              (sched->inflight_key[victim] < key))))
+                        {
+                            target = sched->mailboxes;
+                        }
+                    }
+                    victim = sched->mailboxes;
+                }
+            }
+        }
+        else if (0u == sched->busy)
+        {
+            target = 0u;
+        }
+        else
+        {
+            /* Round robin: wait for the loaded message. */
+        }
+
+        if (target < sched->mailboxes)
+        {
+            tx_sched_pop(sched, &sched->inflight[target]);
+            sched->inflight_key[target] = key;
+            sched->busy |= (uint32_t)1u << target;
+
+            this_can->hw_reg->TxMsg[target].ID = sched->inflight[target].ID;
+            this_can->hw_reg->TxMsg[target].DATALOW =
+                                            sched->inflight[target].DATALOW;
+            this_can->hw_reg->TxMsg[target].DATAHIGH =
+                                            sched->inflight[target].DATAHIGH;
+            this_can->hw_reg->TxMsg[target].TXB.L =
+                                    (sched->inflight[target].L | \
+                                     CAN_TX_WPNH_EBL | CAN_TX_INT_EBL | \
+                                     CAN_TX_REQ);
+#ifdef MSS_CAN_STATS
+            stats_occupancy(&this_can->stats.tx_mailbox_hwm,
+                            MSS_CAN_get_tx_buffer_status(this_can));
+            stats_frame(this_can, &sched->inflight[target], 0u);
+#endif
+            progress = 1u;
+        }
+        else
+        {
+            /* Least urgent loaded message the queued one should go before. */
+            for (mailbox_number = 0u; mailbox_number < sched->mailboxes;
+                                                        mailbox_number++)
+            {
+                if ((0u != (sched->busy & ((uint32_t)1u << mailbox_number))) &&
+                    (sched->inflight_key[mailbox_number] > key) &&
+                    ((victim == sched->mailboxes) ||
+                     (sched->inflight_key[mailbox_number] >
+                      sched->inflight_key[victim])))
+                {
+                    victim = mailbox_number;
+                }
+            }
+
+            /* A message already being transmitted cannot be aborted; it is
+             * left to complete. */
+            if ((victim < sched->mailboxes) &&
+                (sched->heap_count < sched->heap_size) &&
+                (CAN_OK == MSS_CAN_send_message_abort_n(this_can, victim)))
+            {
+                sched->busy &= ~((uint32_t)1u << victim);
+                tx_sched_push(sched, &sched->inflight[victim]);
+                progress = 1u;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * Number of listed IDs accepted by a filter.
+ */
+static uint32_t filter_ids_covered
+(
+    const uint32_t ids[],
+    uint32_t id_count,
+    uint32_t code,
+    uint32_t mask
+)
+{
+    uint32_t i;
+    uint32_t covered = 0u;
+
+    for (i = 0u; i < id_count; i++)
+    {
+        if (code == (ids[i] & ~mask))
+        {
+            covered++;
+        }
+    }
+
+    return (covered);
+}
+
+/*******************************************************************************
+ * Number of bits set in a filter mask.
+ */
+static uint32_t filter_bit_count
+(
+    uint32_t mask
+)
+{
+    uint32_t bits = 0u;
+
+    while (0u != mask)
+    {
+        mask &= mask - 1u;
+        bits++;
+    }
+
+    return (bits);
+}
+
+#ifdef MSS_CAN_STATS
+/***************************************************************************//**
+ * MSS_CAN_stats_reset()
+ * See "mss_can.h" for details of how to use this function.
+ */
+void
+MSS_CAN_stats_reset
+(
+    mss_can_instance_t* this_can
+)
+{
+    (void)memset(&this_can->stats, 0, sizeof(this_can->stats));
+    this_can->stats.start_time = readmtime();
+}
+
+/***************************************************************************//**
+ * MSS_CAN_stats_irq_entry()
+ * See "mss_can.h" for details of how to use this function.
+ */
+void
+MSS_CAN_stats_irq_entry
+(
+    mss_can_instance_t* this_can
+)
+{
+    this_can->stats.irq_time = readmtime();
+}
+
+/***************************************************************************//**
+ * MSS_CAN_stats_sample_errors()
+ * See "mss_can.h" for details of how to use this function.
+ */
+void
+MSS_CAN_stats_sample_errors
+(
+    mss_can_instance_t* this_can
+)
+{
+    mss_can_stats_t* stats = &this_can->stats;
+    mss_can_err_sample_t* sample;
+    uint32_t status;
+    uint8_t last_state = 0u;
+
+    if (0u != stats->err_samples)
+    {
+        last_state = stats->err_history[(stats->err_samples - 1u) %
+                                        MSS_CAN_STATS_ERR_HISTORY].error_state;
+    }
+
+    sample = &stats->err_history[stats->err_samples %
+                                 MSS_CAN_STATS_ERR_HISTORY];
+    sample->time = readmtime();
+    sample->error_state = MSS_CAN_get_error_status(this_can, &status);
+    sample->tx_err_count = (uint8_t)(status & CAN_ERROR_COUNT_MASK);
+    sample->rx_err_count = (uint8_t)((status >> CAN_ERROR_COUNT_SHIFT) &
+                                     CAN_ERROR_COUNT_MASK);
+    stats->err_samples++;
+
+    if (sample->tx_err_count > stats->tx_err_max)
+    {
+        stats->tx_err_max = sample->tx_err_count;
+    }
+    if (sample->rx_err_count > stats->rx_err_max)
+    {
+        stats->rx_err_max = sample->rx_err_count;
+    }
+
+    /* Error state: 0 error active, 1 error passive, 2 or 3 bus off. */
+    if (sample->error_state != last_state)
+    {
+        if (1u == sample->error_state)
+        {
+            stats->error_passive_count++;
+        }
+        else if (sample->error_state >= 2u)
+        {
+            stats->bus_off_count++;
+        }
+        else
+        {
+            ;/* back to error active */
+        }
+    }
+}
+
+/***************************************************************************//**
+ * MSS_CAN_stats_bus_load()
+ * See "mss_can.h" for details of how to use this function.
+ */
+uint32_t
+MSS_CAN_stats_bus_load
+(
+    mss_can_instance_t* this_can,
+    uint32_t bitrate,
+    uint32_t mtime_hz
+)
+{
+    uint64_t elapsed = readmtime() - this_can->stats.start_time;
+    uint64_t bus_bits;
+    uint64_t load;
+
+    /* Bits the bus could have carried over the period. */
+    bus_bits = (elapsed * (uint64_t)bitrate) / (uint64_t)mtime_hz;
+    if (0u == bus_bits)
+    {
+        return (0u);
+    }
+
+    /* Frames sent in loop back are counted in both directions. */
+    load = ((this_can->stats.rx_bits + this_can->stats.tx_bits) * 1000u) /
+           bus_bits;
+
+    return ((load > 1000u) ? 1000u : (uint32_t)load);
+}
+
+/***************************************************************************//**
+ * MSS_CAN_get_stats()
+ * See "mss_can.h" for details of how to use this function.
+ */
+const mss_can_stats_t*
+MSS_CAN_get_stats
+(
+    mss_can_instance_t* this_can
+)
+{
+    return (&this_can->stats);
+}
+#endif
+
 /*******************************************************************************
  * Global initialization for all modes
  */
@@ -1019,6 +1986,10 @@ static void global_init
  */
 uint8_t External_can0_plic_IRQHandler(void)
 {
+#ifdef MSS_CAN_STATS
+    MSS_CAN_stats_irq_entry(&g_mss_can_0_lo);
+    MSS_CAN_stats_irq_entry(&g_mss_can_0_hi);
+#endif
 #ifdef MSS_CAN_ENABLE_INTERRUPTS
     /* User provided code is required here to handle interrupts from the MSS CAN
      * peripheral. Remove the assert once this is in place.*/
@@ -1032,6 +2003,10 @@ uint8_t External_can0_plic_IRQHandler(void)
     
 uint8_t can1_IRQHandler(void)
 {
+#ifdef MSS_CAN_STATS
+    MSS_CAN_stats_irq_entry(&g_mss_can_1_lo);
+    MSS_CAN_stats_irq_entry(&g_mss_can_1_hi);
+#endif
 #ifdef MSS_CAN_ENABLE_INTERRUPTS
     /* User provided code is required here to handle interrupts from the MSS CAN
      * peripheral. Remove the assert once this is in place.*/
@@ -215,6 +215,70 @@
      create FIFOs that share an identical message filter configuration, can 
      be built upon the available Full CAN functions.
 
+  --------------------------------
+  Prioritised Transmit Scheduler
+  --------------------------------
+  MSS_CAN_send_message() uses the first free mailbox, so a message queued
+  behind lower priority messages can wait for all of them. The transmit
+  scheduler avoids this priority inversion. MSS_CAN_tx_sched_init() gives the
+  driver a priority queue of messages and the number of Full CAN transmit
+  mailboxes, starting from mailbox 0, that the scheduler owns.
+  MSS_CAN_tx_sched_send() adds a message to the queue, ordered by CAN ID in
+  the same way as bus arbitration. MSS_CAN_tx_sched_service(), called from the
+  application's CAN interrupt handler on CAN_INT_TX_MSG, loads freed
+  mailboxes with the most urgent queued messages. When a queued message is
+  more urgent than one waiting in a mailbox and no mailbox can take it, the
+  waiting message is aborted and put back in the queue.
+  With CAN_ARB_FIXED_PRIO, where the controller sends the pending mailbox with
+  the lowest number first, the scheduler keeps the mailbox order in step
+  with the ID order and uses all its mailboxes, keeping the bus busy. With
+  round robin arbitration the mailbox order says nothing about priority, so
+  the scheduler only keeps one message in a mailbox at a time.
+
+  --------------------------------
+  Bus Load and Latency Instrumentation
+  --------------------------------
+  When MSS_CAN_STATS is defined, the driver keeps an mss_can_stats_t record
+  in each instance, returned by MSS_CAN_get_stats() and cleared by
+  MSS_CAN_stats_reset() and MSS_CAN_init(). The driver counts the frames per
+  ID, in each direction, for every message read or loaded through the
+  driver. It also records the high-water marks of the receive and transmit
+  mailboxes in use, and estimates the number of bits each frame occupies on
+  the bus.
+  MSS_CAN_stats_irq_entry() records mtime. It is called on entry to the CAN
+  interrupt handler, and the driver's default handlers call it. The time from
+  then until each message is read gives the receive to CPU latency.
+  MSS_CAN_stats_sample_errors() is called periodically, for example from a
+  timer tick. It records the error counters and state reported by
+  MSS_CAN_get_error_status() in a short history and tracks their peaks and
+  the transitions to error passive and bus off.
+  MSS_CAN_stats_bus_load() turns the estimated bits into a bus load. Stuff
+  bits are not counted, so the load is a lower bound of up to about 20% under
+  the real value.
+
+  --------------------------------
+  Receive Ring and Filter Packing
+  --------------------------------
+  On a busy bus, reading one mailbox per call can leave messages waiting in
+  the mailboxes until newer messages overwrite or miss them. The receive ring
+  avoids this. MSS_CAN_rx_ring_init() gives the driver a ring of
+  mss_can_msgobject entries. MSS_CAN_rx_drain(), typically called from the
+  application's CAN interrupt handler, reads the receive buffer status once
+  and copies every mailbox holding a message into the ring in one pass, then
+  releases those mailboxes. MSS_CAN_rx_ring_get() takes the messages out of
+  the ring. The ring is lock-free for one producer, the drain, and one
+  consumer. When the ring is full, the remaining messages are left in their
+  mailboxes until the next drain and the rx_ring_full count is incremented.
+
+  MSS_CAN_pack_id_filters() turns a list of accepted message IDs into a
+  small set of acceptance code and mask pairs. It first merges IDs whose
+  combined filter accepts no other ID, and then, if more filters are still
+  needed than there are mailboxes, the pairs which let the fewest other
+  IDs through. MSS_CAN_set_id_filters() programs the resulting filters into
+  the Full CAN mailboxes, one filter per mailbox. When filters had to be
+  merged inexactly, the application must check the ID of each received
+  message.
+
  *//*=========================================================================*/
 
 #ifndef MSS_CAN_H_
@@ -234,6 +298,27 @@ extern "C" {
 #if 0
 #define MSS_CAN_ENABLE_INTERRUPTS
 #endif
+
+/* The following macro MSS_CAN_STATS must be defined to add the bus load and
+ * latency instrumentation read with MSS_CAN_get_stats(). It adds a few
+ * register reads and an mtime read to each message sent or received.
+ */
+
+#if 0
+#define MSS_CAN_STATS
+#endif
+
+/* Number of IDs whose frames are counted individually by MSS_CAN_STATS.
+ * Frames of further IDs are only counted in ids_other.
+ */
+#ifndef MSS_CAN_STATS_IDS
+#define MSS_CAN_STATS_IDS          32u
+#endif
+
+/* Number of error counter samples kept by MSS_CAN_stats_sample_errors(). */
+#ifndef MSS_CAN_STATS_ERR_HISTORY
+#define MSS_CAN_STATS_ERR_HISTORY  16u
+#endif
   
 /**
  * Define CAN target device
@@ -898,6 +983,85 @@ typedef CAN_DEVICE * PCAN_DEVICE;
 #define SYSREG_CAN_A_SOFTRESET_MASK           ( (uint32_t)0x01u << 14u )
 #define SYSREG_CAN_B_SOFTRESET_MASK           ( (uint32_t)0x01u << 15u )
 
+/*-------------------------------------------------------------------------*//**
+  The mss_can_id_filter_t structure holds one message filter produced by
+  MSS_CAN_pack_id_filters(). An ID is accepted when it matches code in all the
+  bits which are 0 in mask. Both are right aligned, as with MSS_CAN_set_id().
+ */
+typedef struct _mss_can_id_filter
+{
+    uint32_t code;
+    uint32_t mask;
+} mss_can_id_filter_t;
+
+/*-------------------------------------------------------------------------*//**
+  The mss_can_tx_sched_t structure holds the state of the transmit scheduler.
+  It is provided by the application to MSS_CAN_tx_sched_init() and must only
+  be accessed through the scheduler functions.
+ */
+typedef struct _mss_can_tx_sched
+{
+    pmss_can_msgobject heap;                        /* queued messages */
+    uint32_t heap_size;                             /* entries of heap */
+    uint32_t heap_count;                            /* messages queued */
+    mss_can_msgobject inflight[CAN_TX_MAILBOX];     /* copies of loaded messages */
+    uint32_t inflight_key[CAN_TX_MAILBOX];          /* their priority keys */
+    uint32_t busy;                                  /* loaded mailboxes */
+    uint8_t mailboxes;                              /* mailboxes used */
+} mss_can_tx_sched_t;
+
+#ifdef MSS_CAN_STATS
+/*-------------------------------------------------------------------------*//**
+  Frame counts of one ID. The id field is the right aligned ID with bit 31 set
+  for extended IDs.
+ */
+typedef struct _mss_can_id_stats
+{
+    uint32_t id;
+    uint32_t rx_frames;
+    uint32_t tx_frames;
+} mss_can_id_stats_t;
+
+/*-------------------------------------------------------------------------*//**
+  One sample of the error counters taken by MSS_CAN_stats_sample_errors().
+ */
+typedef struct _mss_can_err_sample
+{
+    uint64_t time;             /* mtime */
+    uint8_t tx_err_count;
+    uint8_t rx_err_count;
+    uint8_t error_state;       /* as returned by MSS_CAN_get_error_status() */
+} mss_can_err_sample_t;
+
+/*-------------------------------------------------------------------------*//**
+  Instrumentation kept when MSS_CAN_STATS is defined. Times are in mtime
+  ticks.
+ */
+typedef struct _mss_can_stats
+{
+    uint64_t start_time;                      /* mtime of the last reset */
+    uint32_t rx_frames;
+    uint32_t tx_frames;
+    uint64_t rx_bits;                         /* estimated bus bits received */
+    uint64_t tx_bits;                         /* estimated bus bits sent */
+    mss_can_id_stats_t ids[MSS_CAN_STATS_IDS];
+    uint32_t id_count;                        /* entries of ids in use */
+    uint32_t ids_other;                       /* frames of IDs not in ids */
+    uint64_t irq_time;                        /* mtime at interrupt entry */
+    uint64_t rx_latency_sum;
+    uint64_t rx_latency_max;
+    uint32_t rx_latency_count;
+    uint8_t rx_mailbox_hwm;                   /* most receive mailboxes full */
+    uint8_t tx_mailbox_hwm;                   /* most transmit mailboxes busy */
+    uint8_t tx_err_max;
+    uint8_t rx_err_max;
+    uint32_t error_passive_count;             /* transitions to error passive */
+    uint32_t bus_off_count;                   /* transitions to bus off */
+    mss_can_err_sample_t err_history[MSS_CAN_STATS_ERR_HISTORY];
+    uint32_t err_samples;                     /* samples taken */
+} mss_can_stats_t;
+#endif
+
 /*-------------------------------------------------------------------------*//**
   The structure mss_can_instance_t is used by the driver to manage the 
   configuration and operation of each MSS CAN peripheral. The instance content 
@@ -915,6 +1079,17 @@ typedef struct can_instance
     /* Local data (eg pointer to local FIFO, irq number etc) */
     uint8_t  basic_can_rx_mb; /* number of rx mailboxes */
     uint8_t  basic_can_tx_mb; /* number of tx mailboxes */
+    /* Transmit scheduler, see MSS_CAN_tx_sched_init() */
+    struct _mss_can_tx_sched * tx_sched;
+    /* Receive ring, see MSS_CAN_rx_ring_init() */
+    pmss_can_msgobject rx_ring;         /* ring entries */
+    uint32_t rx_ring_mask;              /* number of entries - 1 */
+    volatile uint32_t rx_ring_head;     /* written by MSS_CAN_rx_drain() */
+    volatile uint32_t rx_ring_tail;     /* written by MSS_CAN_rx_ring_get() */
+    mss_stat_t rx_ring_full;            /* drains which found the ring full, see MSS_STAT_READ() */
+#ifdef MSS_CAN_STATS
+    mss_can_stats_t stats;              /* see MSS_CAN_get_stats() */
+#endif
  } mss_can_instance_t;
 
  /*------------------------------------------------------------------------*//**
@@ -2423,6 +2598,361 @@ MSS_CAN_get_tx_gte96
     mss_can_instance_t* this_can
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_tx_sched_init() function sets up the transmit scheduler. The
+  scheduler uses the Full CAN transmit mailboxes 0 to mailboxes - 1, which
+  must not be used through MSS_CAN_send_message_n() while it is in use. It must
+  be called after MSS_CAN_init().
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+
+  @param sched
+    The sched parameter is a pointer to the scheduler state.
+
+  @param heap
+    The heap parameter is a pointer to an array of heap_size message objects
+    which holds the queued messages.
+
+  @param heap_size
+    The heap_size parameter is the largest number of messages queued at once.
+
+  @param mailboxes
+    The mailboxes parameter is the number of transmit mailboxes used.
+
+  @return
+    This function returns CAN_OK, or CAN_INVALID_MAILBOX if mailboxes is 0 or
+    greater than the number of Full CAN transmit mailboxes.
+ */
+uint8_t
+MSS_CAN_tx_sched_init
+(
+    mss_can_instance_t* this_can,
+    mss_can_tx_sched_t* sched,
+    pmss_can_msgobject heap,
+    uint32_t heap_size,
+    uint8_t mailboxes
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_tx_sched_send() function queues a message for transmission and
+  loads it into a mailbox straight away if it is among the most urgent.
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+
+  @param pmsg
+    The pmsg parameter is a pointer to the message, set up as for
+    MSS_CAN_send_message(). The message is copied.
+
+  @return
+    This function returns CAN_VALID_MSG if the message was queued, or
+    CAN_NO_MSG if the CAN controller is stopped or the queue is full.
+
+  Example:
+  @code
+      static mss_can_tx_sched_t g_can_sched;
+      static mss_can_msgobject g_can_heap[32];
+
+      uint8_t External_can0_plic_IRQHandler(void)
+      {
+          if (MSS_CAN_get_int_status(&g_mss_can_0_lo) & CAN_INT_TX_MSG)
+          {
+              MSS_CAN_clear_int_status(&g_mss_can_0_lo, CAN_INT_TX_MSG);
+              MSS_CAN_tx_sched_service(&g_mss_can_0_lo);
+          }
+          return EXT_IRQ_KEEP_ENABLED;
+      }
+
+      MSS_CAN_init(&g_mss_can_0_lo, CAN_SPEED_32M_1M | CAN_ARB_FIXED_PRIO,
+                   (pmss_can_config_reg)0, 0u, 0u);
+      (void)MSS_CAN_tx_sched_init(&g_mss_can_0_lo, &g_can_sched, g_can_heap,
+                                  32u, 8u);
+      MSS_CAN_set_int_ebl(&g_mss_can_0_lo, CAN_INT_GLOBAL | CAN_INT_TX_MSG);
+      MSS_CAN_start(&g_mss_can_0_lo);
+
+      (void)MSS_CAN_tx_sched_send(&g_mss_can_0_lo, &msg);
+  @endcode
+ */
+uint8_t
+MSS_CAN_tx_sched_send
+(
+    mss_can_instance_t* this_can,
+    pmss_can_msgobject pmsg
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_tx_sched_service() function releases the mailboxes whose
+  message has been sent and loads the most urgent queued messages into them.
+  It is intended to be called from the CAN interrupt handler on the
+  CAN_INT_TX_MSG interrupt. The scheduler enables the transmit interrupt of
+  each mailbox it loads.
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+ */
+void
+MSS_CAN_tx_sched_service
+(
+    mss_can_instance_t* this_can
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_rx_ring_init() function provides the ring that
+  MSS_CAN_rx_drain() copies received messages into, and empties it. It must be
+  called after MSS_CAN_init().
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+
+  @param ring
+    The ring parameter is a pointer to an array of ring_size message objects.
+
+  @param ring_size
+    The ring_size parameter is the number of entries of the ring. It must be a
+    power of two of at least 2.
+
+  @return
+    This function returns CAN_OK, or CAN_ERR if ring_size is not valid.
+ */
+uint8_t
+MSS_CAN_rx_ring_init
+(
+    mss_can_instance_t* this_can,
+    pmss_can_msgobject ring,
+    uint32_t ring_size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_rx_drain() function copies the messages of all receive
+  mailboxes which hold one into the receive ring, in mailbox order, and
+  releases the mailboxes. It reads the receive buffer status register once
+  per call. It is intended to be called from the CAN interrupt handler on the
+  CAN_INT_RX_MSG interrupt, or polled.
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+
+  @return
+    This function returns the number of messages copied into the ring.
+
+  Example:
+  @code
+      static mss_can_msgobject g_can_ring[64];
+
+      uint8_t External_can0_plic_IRQHandler(void)
+      {
+          (void)MSS_CAN_rx_drain(&g_mss_can_0_lo);
+          MSS_CAN_clear_int_status(&g_mss_can_0_lo, CAN_INT_RX_MSG);
+          return EXT_IRQ_KEEP_ENABLED;
+      }
+
+      (void)MSS_CAN_rx_ring_init(&g_mss_can_0_lo, g_can_ring, 64u);
+      MSS_CAN_set_int_ebl(&g_mss_can_0_lo, CAN_INT_GLOBAL | CAN_INT_RX_MSG);
+
+      while (CAN_VALID_MSG == MSS_CAN_rx_ring_get(&g_mss_can_0_lo, &msg))
+      {
+          process_message(&msg);
+      }
+  @endcode
+ */
+uint32_t
+MSS_CAN_rx_drain
+(
+    mss_can_instance_t* this_can
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_rx_ring_get() function takes the oldest message out of the
+  receive ring.
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+
+  @param pmsg
+    The pmsg parameter is a pointer to the message object the message is
+    copied to.
+
+  @return
+    This function returns CAN_VALID_MSG if a message was copied, or CAN_NO_MSG
+    if the ring is empty.
+ */
+uint8_t
+MSS_CAN_rx_ring_get
+(
+    mss_can_instance_t* this_can,
+    pmss_can_msgobject pmsg
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_pack_id_filters() function packs a list of accepted IDs into at
+  most max_filters code and mask pairs. Filters which exactly cover
+  their IDs are merged first. If more than max_filters are left, the pairs of
+  filters which accept the fewest IDs not in the list are merged until
+  max_filters remain. The search is quadratic in the number of filters for
+  each merge, so the function is meant to be called once at start up.
+
+  @param ids
+    The ids parameter is the list of right aligned IDs, all standard or all
+    extended.
+
+  @param id_count
+    The id_count parameter is the number of IDs in the list.
+
+  @param filters
+    The filters parameter is an array of id_count entries used as work space,
+    which receives the filters.
+
+  @param max_filters
+    The max_filters parameter is the largest number of filters wanted,
+    usually the number of Full CAN mailboxes available. It must not be 0.
+
+  @return
+    This function returns the number of filters in filters.
+
+  Example:
+  @code
+      static const uint32_t g_ids[6] = { 0x100, 0x101, 0x102, 0x103,
+                                         0x200, 0x280 };
+      mss_can_id_filter_t filters[6];
+      uint32_t count;
+
+      count = MSS_CAN_pack_id_filters(g_ids, 6u, filters, 4u);
+      (void)MSS_CAN_set_id_filters(&g_mss_can_0_lo, filters, (uint8_t)count,
+                                   0u);
+  @endcode
+ */
+uint32_t
+MSS_CAN_pack_id_filters
+(
+    const uint32_t ids[],
+    uint32_t id_count,
+    mss_can_id_filter_t filters[],
+    uint32_t max_filters
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_set_id_filters() function programs one filter into each Full
+  CAN receive mailbox, starting with mailbox 0, and enables those mailboxes.
+  The RTR bit and the data bytes are not filtered. The remaining Full CAN
+  mailboxes are disabled.
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+
+  @param filters
+    The filters parameter is the array of filters, for example from
+    MSS_CAN_pack_id_filters().
+
+  @param filter_count
+    The filter_count parameter is the number of filters.
+
+  @param ide
+    The ide parameter is 1 if the filters are for extended IDs, 0 for standard
+    IDs.
+
+  @return
+    This function returns CAN_OK, or CAN_INVALID_MAILBOX if there are more
+    filters than Full CAN mailboxes.
+ */
+uint8_t
+MSS_CAN_set_id_filters
+(
+    mss_can_instance_t* this_can,
+    const mss_can_id_filter_t filters[],
+    uint8_t filter_count,
+    uint8_t ide
+);
+
+#ifdef MSS_CAN_STATS
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_stats_reset() function clears the instrumentation and starts a
+  new measurement period.
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+ */
+void
+MSS_CAN_stats_reset
+(
+    mss_can_instance_t* this_can
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_stats_irq_entry() function records the time the CAN interrupt
+  was taken. A user supplied CAN interrupt handler calls it first.
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+ */
+void
+MSS_CAN_stats_irq_entry
+(
+    mss_can_instance_t* this_can
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_stats_sample_errors() function samples the transmit and receive
+  error counters and the error state into the error history.
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+ */
+void
+MSS_CAN_stats_sample_errors
+(
+    mss_can_instance_t* this_can
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_stats_bus_load() function returns the bus load since the last
+  reset, computed from the estimated bits sent and received.
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+
+  @param bitrate
+    The bitrate parameter is the bus bit rate in bits per second.
+
+  @param mtime_hz
+    The mtime_hz parameter is the mtime frequency in Hz.
+
+  @return
+    This function returns the bus load in tenths of a percent, from 0 to 1000.
+
+  Example:
+  @code
+      MSS_CAN_stats_sample_errors(&g_mss_can_0_lo);
+      load = MSS_CAN_stats_bus_load(&g_mss_can_0_lo, 1000000u, 1000000u);
+      stats = MSS_CAN_get_stats(&g_mss_can_0_lo);
+      printf("load %u.%u%%, worst latency %u ticks\n", load / 10u,
+             load % 10u, (uint32_t)stats->rx_latency_max);
+  @endcode
+ */
+uint32_t
+MSS_CAN_stats_bus_load
+(
+    mss_can_instance_t* this_can,
+    uint32_t bitrate,
+    uint32_t mtime_hz
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_CAN_get_stats() function returns the instrumentation record.
+
+  @param this_can
+    The this_can parameter is a pointer to the mss_can_instance_t structure.
+
+  @return
+    This function returns a pointer to the record of the instance.
+ */
+const mss_can_stats_t*
+MSS_CAN_get_stats
+(
+    mss_can_instance_t* this_can
+);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,67 @@ extern  IOSCB_IO_CALIB_STRUCT *IOSCB_IO_CALIB_DDR;
 #define PHY_ADDRESS_MIN                 (0U)
 #define PHY_ADDRESS_MAX                 (31U)
 
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
+/*
+ * Layout of the time stamp in the DMA descriptors. Word 2 holds the
+ * nanoseconds and seconds bits 1:0, word 3 holds seconds bits 5:2.
+ */
+#define DESC_TS_NSEC_MASK               (0x3FFFFFFFU)
+#define DESC_TS_SECS_LO_SHIFT           (30U)
+#define DESC_TS_SECS_HI_MASK            (0x0000000FU)
+#define DESC_TS_SECS_MASK               (0x3FULL)
+#define DESC_TS_SECS_HALF               (0x20ULL)
+#endif
+
+#if defined(MSS_MAC_CAPTURE)
+/*
+ * Capture records are a pcap record header, time stamp seconds, nanoseconds,
+ * length kept and frame length, followed by the data padded to 8 bytes. The
+ * file header uses the pcap nanosecond time stamp magic number.
+ */
+#define CAPTURE_REC_HDR_SIZE        (16U)
+#define CAPTURE_MIN_SIZE            (4096U)
+#define CAPTURE_WRAP                (0xFFFFFFFFU)
+#define CAPTURE_PCAP_MAGIC          (0xA1B23C4DU)
+#define CAPTURE_PCAP_VERSION        (0x00040002U) /* 2.4, minor in the upper half */
+#define CAPTURE_LINKTYPE_ETHERNET   (1U)
+
+#if defined(MPFS_HAL_HOST_MODEL)
+#define CAPTURE_FENCE_W_W()         __sync_synchronize()
+#define CAPTURE_FENCE_R_R()         __sync_synchronize()
+#define CAPTURE_FENCE_RW_W()        __sync_synchronize()
+#else
+#define CAPTURE_FENCE_W_W()         __asm__ __volatile__ ("fence w,w" ::: "memory")
+#define CAPTURE_FENCE_R_R()         __asm__ __volatile__ ("fence r,r" ::: "memory")
+#define CAPTURE_FENCE_RW_W()        __asm__ __volatile__ ("fence rw,w" ::: "memory")
+#endif
+#endif
+
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+/*
+ * Frame fields looked at to find where the MAC split the headers from the
+ * payload of a TCP or UDP frame
+ */
+#define HDR_ETHERTYPE_OFFSET        (12U)
+#define HDR_ETH_SIZE                (14U)
+#define HDR_VLAN_SIZE               (4U)
+#define HDR_IPV4_MIN_SIZE           (20U)
+#define HDR_IPV6_SIZE               (40U)
+#define HDR_TCP_MIN_SIZE            (20U)
+#define HDR_UDP_SIZE                (8U)
+#define HDR_ETHERTYPE_IPV4          (0x0800U)
+#define HDR_ETHERTYPE_IPV6          (0x86DDU)
+#define HDR_ETHERTYPE_VLAN          (0x8100U)
+#define HDR_ETHERTYPE_QINQ          (0x88A8U)
+#define HDR_PROTOCOL_TCP            (6U)
+#define HDR_PROTOCOL_UDP            (17U)
+#define HDR_IPV4_FRAG_MASK          (0x3FFFU)
+#endif
+
+#if defined(MSS_MAC_TSN) && !defined(TARGET_G5_SOC)
+#error "MSS_MAC_TSN needs the eMAC of the G5 SoC"
+#endif
+
 /*
  * Defines for determining DMA descriptor sizes 
  */
@@ -149,17 +210,89 @@ static void tx_desc_ring_init(mss_mac_instance_t *this_mac);
 static void rx_desc_ring_init(mss_mac_instance_t *this_mac);
 static void assign_station_addr(mss_mac_instance_t *this_mac, const uint8_t mac_addr[MSS_MAC_MAC_LEN]);
 static void generic_mac_irq_handler(mss_mac_instance_t *this_mac, uint64_t queue_no);
-static void rxpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no);
-static void txpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no);
+static uint32_t rxpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t budget);
+static uint32_t txpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no);
 static void update_mac_cfg(const mss_mac_instance_t *this_mac);
-static uint8_t probe_phy(const mss_mac_instance_t *this_mac);
 static void instances_init(mss_mac_instance_t *this_mac, mss_mac_cfg_t *cfg);
+static int32_t send_frags(mss_mac_instance_t *this_mac, uint32_t queue_no, mss_mac_tx_frag_t const *frags, uint32_t frag_count, int32_t no_crc, void *p_user_data);
+static int32_t tx_queue_kick(mss_mac_instance_t *this_mac, uint32_t queue_no, volatile uint32_t *p_nw_control);
+#if defined(MSS_MAC_TX_BATCH)
+static int32_t tx_batch_post(mss_mac_instance_t *this_mac, uint32_t queue_no, mss_mac_tx_pkt_info_t const *p_packets, uint32_t pkt_count);
+#endif
+#if defined(MSS_MAC_TX_SPSC_RING)
+static void tx_spsc_service(mss_mac_instance_t *this_mac, uint32_t queue_no);
+#endif
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+static uint32_t tx_reclaim_deferred(mss_mac_instance_t *this_mac, uint32_t queue_no);
+static void tx_reclaim_arm(mss_mac_instance_t *this_mac, uint32_t queue_no);
+#endif
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+static void rx_pool_lock(const mss_mac_instance_t *this_mac, uint32_t queue_no);
+static void rx_pool_unlock(const mss_mac_instance_t *this_mac, uint32_t queue_no);
+static uint32_t rx_pool_fill(mss_mac_instance_t *this_mac, uint32_t queue_no);
+static void rx_pool_free(mss_mac_rx_pool_t *p_pool, mss_mac_rx_buf_t *p_buf);
+#endif
+
+#if defined(MSS_MAC_FLOW_STEERING)
+static void flow_init(mss_mac_instance_t *this_mac);
+static uint32_t flow_alloc(uint32_t *p_used, uint32_t limit);
+static uint32_t flow_compare(mss_mac_instance_t *this_mac, uint32_t filter_no, const mss_mac_type_2_compare_t *comparer);
+static int32_t flow_type_2(mss_mac_instance_t *this_mac, mss_mac_type_2_filter_t *filter,
+                           uint32_t ethertype, const mss_mac_type_2_compare_t *compares,
+                           uint32_t compare_count);
+static uint32_t flow_ethertype(mss_mac_instance_t *this_mac, uint32_t ethertype);
+static void flow_release(mss_mac_instance_t *this_mac, uint32_t filter_no);
+static volatile uint32_t *plic_hart_enables(uint32_t hart_id);
+#endif
 
 static void msgmii_init(const mss_mac_instance_t *this_mac);
 
 /* PMCS: Made non static for now for test program use... */
 void msgmii_autonegotiate(const mss_mac_instance_t *this_mac);
 
+#if defined(MSS_MAC_MDIO_QUEUE)
+static mss_mac_instance_t *mdio_controller(const mss_mac_instance_t *this_mac);
+static void mdio_issue(mss_mac_instance_t *this_mac);
+static void mdio_step(mss_mac_instance_t *this_mac);
+#endif
+
+#if defined(MSS_MAC_ASYNC_LINK)
+static void link_next_state(mss_mac_instance_t *this_mac, mss_mac_link_state_t state);
+static uint16_t link_pcs_status(const mss_mac_instance_t *this_mac);
+#endif
+
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
+static void ts_latch_secs(mss_mac_instance_t *this_mac, uint64_t queue_no);
+static void ts_expand(uint64_t secs_ref, uint32_t ts_word_0, uint32_t ts_word_1, mss_mac_tsu_time_t *tsu_time);
+#endif
+
+#if defined(MSS_MAC_TSN)
+static mss_mac_instance_t *tsn_emac(const mss_mac_instance_t *this_mac);
+#endif
+
+#if defined(MSS_MAC_RX_CHAINED)
+static uint32_t rx_chain_handler(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t budget);
+static void rx_chain_take(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t count, uint32_t pckt_length, uint32_t hdr_length);
+static void rx_chain_recycle(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t count);
+static void rx_chain_deliver(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t count, mss_mac_rx_desc_t *cdesc);
+#endif
+
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+static uint32_t rx_hdr_length(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t count, uint32_t pckt_length);
+static uint32_t rx_hdr_parse(const uint8_t *p_frame, uint32_t avail);
+static void rx_hdr_deliver(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t count, uint32_t hdr_length,
+                           uint32_t pckt_length, mss_mac_rx_desc_t *cdesc);
+#endif
+
+#if defined(MSS_MAC_MCAST_FILTER)
+static uint32_t mcast_find(const mss_mac_instance_t *this_mac, const uint8_t *mac_addr);
+static void mcast_program(const mss_mac_instance_t *this_mac);
+#endif
+
+#if defined(MSS_MAC_CAPTURE)
+static void capture_frags(mss_mac_capture_t *cap, const mss_mac_tx_frag_t *frags, uint32_t frag_count, uint32_t pckt_length, const mss_mac_tsu_time_t *tsu_time);
+#endif
+
 /**************************************************************************/
 /* Public Functions                                                       */
 /**************************************************************************/
@@ -174,6 +307,9 @@ MSS_MAC_init
 )
 {
     int32_t queue_no;
+#if defined(MSS_MAC_PERF_STATS)
+    uint32_t stat;
+#endif
     ASSERT(cfg != NULL_POINTER);
 #if defined(TARGET_ALOE)
     ASSERT(this_mac == &g_mac0);
@@ -344,17 +480,62 @@ MSS_MAC_init
             /* initialize default interrupt handlers */
             this_mac->queue[queue_no].pckt_tx_callback        = (mss_mac_transmit_callback_t)NULL_POINTER;
             this_mac->queue[queue_no].pckt_rx_callback        = (mss_mac_receive_callback_t)NULL_POINTER;
+#if defined(MSS_MAC_RX_CHAINED)
+            this_mac->queue[queue_no].pckt_rx_chain_callback  = (mss_mac_receive_chain_callback_t)NULL_POINTER;
+            this_mac->queue[queue_no].rx_chain_dropped        = 0U;
+#endif
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+            this_mac->queue[queue_no].pckt_rx_split_callback  = (mss_mac_receive_split_callback_t)NULL_POINTER;
+            this_mac->queue[queue_no].rx_hdr_pool             = (uint8_t *)NULL_POINTER;
+            this_mac->queue[queue_no].rx_hdr_next             = 0U;
+            this_mac->queue[queue_no].rx_hdr_split            = 0U;
+            this_mac->queue[queue_no].rx_hdr_no_slot          = 0U;
+#endif
+#if defined(MSS_MAC_TX_BATCH)
+            this_mac->queue[queue_no].pckt_tx_batch_callback  = (mss_mac_tx_batch_callback_t)NULL_POINTER;
+#endif
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+            this_mac->queue[queue_no].tx_reclaim_low_water    = 0U;
+            this_mac->queue[queue_no].tx_reclaim_armed        = 0U;
+            this_mac->queue[queue_no].tx_deferred_reclaims    = 0U;
+#endif
+#if defined(MSS_MAC_TX_SPSC_RING)
+            this_mac->queue[queue_no].tx_spsc.head            = 0U;
+            this_mac->queue[queue_no].tx_spsc.tail            = 0U;
+            this_mac->queue[queue_no].tx_spsc.busy            = 0U;
+            this_mac->queue[queue_no].tx_spsc.pending         = 0U;
+            this_mac->queue[queue_no].tx_spsc.full            = 0U;
+#endif
 
             /* Added these to MAC structure to make them MAC and queue specific... */
 
-            this_mac->queue[queue_no].ingress     = 0U;
-            this_mac->queue[queue_no].egress      = 0U;
-            this_mac->queue[queue_no].rx_overflow = 0U;
-            this_mac->queue[queue_no].hresp_error = 0U;
-            this_mac->queue[queue_no].rx_restart  = 0U;
-            this_mac->queue[queue_no].tx_restart  = 0U;
-            this_mac->queue[queue_no].tx_reenable = 0U;
+            MSS_STAT_CLEAR(this_mac->queue[queue_no].ingress);
+            MSS_STAT_CLEAR(this_mac->queue[queue_no].egress);
+            MSS_STAT_CLEAR(this_mac->queue[queue_no].rx_overflow);
+            MSS_STAT_CLEAR(this_mac->queue[queue_no].hresp_error);
+            MSS_STAT_CLEAR(this_mac->queue[queue_no].rx_restart);
+            MSS_STAT_CLEAR(this_mac->queue[queue_no].tx_restart);
+            MSS_STAT_CLEAR(this_mac->queue[queue_no].tx_reenable);
+#if defined(MSS_MAC_PERF_STATS)
+            (void)memset(&this_mac->queue[queue_no].perf, 0, sizeof(mss_mac_queue_perf_t));
+#endif
+        }
+
+#if defined(MSS_MAC_PERF_STATS)
+        for(stat = 0U; stat != (uint32_t)MSS_MAC_LAST_STAT; stat++)
+        {
+            MSS_STAT_CLEAR(this_mac->hw_stats[stat]);
         }
+#endif
+
+#if defined(MSS_MAC_FLOW_STEERING)
+        flow_init(this_mac);
+#endif
+#if defined(MSS_MAC_ASYNC_LINK)
+        /* Stays ready unless the asynchronous bring-up is selected below */
+        this_mac->link_state = MSS_MAC_LINK_READY;
+        this_mac->link_polls = 0U;
+#endif
 #if 0        
         /* Initialize PHY interface */
         if(MSS_MAC_AUTO_DETECT_PHY_ADDRESS == cfg->phy_addr)
@@ -374,30 +555,45 @@ MSS_MAC_init
 
             this_mac->phy_init(this_mac, (uint8_t)this_mac->phy_addr);
 
+#if defined(MSS_MAC_ASYNC_LINK)
+            if(MSS_MAC_ENABLE == cfg->async_link)
+            {
 #if (defined(MSS_MAC_VSC8662_NWC_25) || defined(MSS_MAC_VSC8662_NWC_125))
-            /* 0U => configure using scb, 1U => NVMAP reset */
+                /* 0U => configure using scb, 1U => NVMAP reset */
                 pre_configure_sgmii_and_ddr_pll_via_scb(1U);
+                this_mac->link_state = MSS_MAC_LINK_PLL_WAIT;
+#else
+                this_mac->link_state = MSS_MAC_LINK_PHY_START;
+#endif
+            }
+            else
+#endif
             {
-                volatile uint32_t timer_out=0x00000FFFU;
-                while(((MSS_SCB_SGMII_PLL->PLL_CTRL & ((0x01U) << 25U))) == 0U)
+#if (defined(MSS_MAC_VSC8662_NWC_25) || defined(MSS_MAC_VSC8662_NWC_125))
+                /* 0U => configure using scb, 1U => NVMAP reset */
+                    pre_configure_sgmii_and_ddr_pll_via_scb(1U);
                 {
-                #ifdef RENODE_DEBUG
-                    break;
-                #endif
-                    if (timer_out == 0U)
+                    volatile uint32_t timer_out=0x00000FFFU;
+                    while(((MSS_SCB_SGMII_PLL->PLL_CTRL & ((0x01U) << 25U))) == 0U)
                     {
-                        timer_out--;
+                    #ifdef RENODE_DEBUG
+                        break;
+                    #endif
+                        if (timer_out == 0U)
+                        {
+                            timer_out--;
+                        }
                     }
                 }
-            }
 
 #endif
-            this_mac->phy_set_link_speed(this_mac, this_mac->speed_duplex_select, this_mac->speed_mode);
-            this_mac->phy_autonegotiate(this_mac);
+                this_mac->phy_set_link_speed(this_mac, this_mac->speed_duplex_select, this_mac->speed_mode);
+                this_mac->phy_autonegotiate(this_mac);
 
-            if(TBI == this_mac->interface_type)
-            {
-                msgmii_autonegotiate(this_mac);
+                if(TBI == this_mac->interface_type)
+                {
+                    msgmii_autonegotiate(this_mac);
+                }
             }
         }
         update_mac_cfg(this_mac);
@@ -790,6 +986,13 @@ MSS_MAC_cfg_struct_def_init
         cfg->queue2_int_priority   = 7U;
         cfg->queue3_int_priority   = 7U;
         cfg->mmsl_int_priority     = 7U;
+        cfg->rx_int_moderation     = MSS_MAC_INT_MODERATION_DISABLE;
+        cfg->tx_int_moderation     = MSS_MAC_INT_MODERATION_DISABLE;
+        cfg->tx_csum_offload       = MSS_MAC_DISABLE;
+        cfg->rx_csum_offload       = MSS_MAC_DISABLE;
+#if defined(MSS_MAC_ASYNC_LINK)
+        cfg->async_link            = MSS_MAC_DISABLE;
+#endif
         /*
          * PMCS: Note for the Emulation platform we need to select the non
          * default TSU clock the moment or TX won't work
@@ -1100,6 +1303,11 @@ static void config_mac_hw(mss_mac_instance_t *this_mac, const mss_mac_cfg_t * cf
     {
         temp_net_config |= GEM_LENGTH_FIELD_ERROR_FRAME_DISCARD;
     }
+
+    if(MSS_MAC_ENABLE == cfg->rx_csum_offload)
+    {
+        temp_net_config |= GEM_RECEIVE_CHECKSUM_OFFLOAD_ENABLE;
+    }
     
     if(MSS_MAC_IPG_DEFVAL != cfg->ipg_multiplier) /* If we have a non zero value here then enable IPG stretching */
     {
@@ -1159,6 +1367,11 @@ static void config_mac_hw(mss_mac_instance_t *this_mac, const mss_mac_cfg_t * cf
     temp_dma_config |= GEM_DMA_ADDR_BUS_WIDTH_1;
 #endif
 
+    if(MSS_MAC_ENABLE == cfg->tx_csum_offload)
+    {
+        temp_dma_config |= GEM_TX_PBUF_TCP_EN;
+    }
+
 if(0U != this_mac->is_emac)
     {
     this_mac->emac_base->DMA_CONFIG = temp_dma_config;
@@ -1224,6 +1437,33 @@ if(0U != this_mac->is_emac)
         this_mac->mac_base->JUMBO_MAX_LENGTH = temp_length;
     }
 
+    /*--------------------------------------------------------------------------
+     * Set up interrupt moderation - but bounds check first
+     */
+    {
+        uint32_t rx_moderation = cfg->rx_int_moderation;
+        uint32_t tx_moderation = cfg->tx_int_moderation;
+
+        if(rx_moderation > MSS_MAC_INT_MODERATION_MAX)
+        {
+            rx_moderation = MSS_MAC_INT_MODERATION_MAX;
+        }
+
+        if(tx_moderation > MSS_MAC_INT_MODERATION_MAX)
+        {
+            tx_moderation = MSS_MAC_INT_MODERATION_MAX;
+        }
+
+        if(0U != this_mac->is_emac)
+        {
+            this_mac->emac_base->INT_MODERATION = (tx_moderation << GEM_TX_INT_MODERATION_SHIFT) | rx_moderation;
+        }
+        else
+        {
+            this_mac->mac_base->INT_MODERATION = (tx_moderation << GEM_TX_INT_MODERATION_SHIFT) | rx_moderation;
+        }
+    }
+
     /*--------------------------------------------------------------------------
      * Disable all ints for now
      */
@@ -1287,6 +1527,13 @@ MSS_MAC_write_phy_reg
         phy_op |= ((uint32_t)regaddr << GEM_REGISTER_ADDRESS_SHIFT) & GEM_REGISTER_ADDRESS;
 
         lev = HAL_disable_interrupts();
+#if defined(MSS_MAC_MDIO_QUEUE)
+        /* Let any queued script finish first */
+        while(0U != this_mac->mdio_busy)
+        {
+            mdio_step((mss_mac_instance_t *)this_mac);
+        }
+#endif
         /*
          * Always use the pMAC for this as the eMAC MDIO interface is not
          * connected to the outside world...
@@ -1353,6 +1600,13 @@ MSS_MAC_read_phy_reg
          * connected to the outside world...
          */
         lev = HAL_disable_interrupts();
+#if defined(MSS_MAC_MDIO_QUEUE)
+        /* Let any queued script finish first */
+        while(0U != this_mac->mdio_busy)
+        {
+            mdio_step((mss_mac_instance_t *)this_mac);
+        }
+#endif
         /* Wait for MII Mgmt interface to complete previous operation. */
         do
         {
@@ -1379,6 +1633,105 @@ MSS_MAC_read_phy_reg
     return((uint16_t)phy_op);
 }
 
+#if defined(MSS_MAC_MDIO_QUEUE)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint8_t
+MSS_MAC_mdio_submit
+(
+    mss_mac_instance_t *this_mac,
+    mss_mac_mdio_op_t *ops,
+    uint32_t count,
+    mss_mac_mdio_done_t done
+)
+{
+    mss_mac_instance_t *ctl = mdio_controller(this_mac);
+    uint8_t ret_val = MSS_MAC_FAILED;
+    psr_t lev;
+
+    lev = HAL_disable_interrupts();
+    if((0U == ctl->mdio_busy) && (0U != count))
+    {
+        /* Wait for an access started by MSS_MAC_write_phy_reg() */
+        while(0U == (ctl->mac_base->NETWORK_STATUS & GEM_MAN_DONE))
+        {
+            ;
+        }
+
+        ctl->mdio_ops     = ops;
+        ctl->mdio_count   = count;
+        ctl->mdio_next    = 0U;
+        ctl->mdio_writing = 0U;
+        ctl->mdio_done    = done;
+        ctl->mdio_busy    = 1U;
+
+        ctl->mac_base->INT_STATUS = GEM_MANAGEMENT_FRAME_SENT;
+        ctl->mac_base->INT_ENABLE = GEM_MANAGEMENT_FRAME_SENT;
+        mdio_issue(ctl);
+        ret_val = MSS_MAC_SUCCESS;
+    }
+    HAL_restore_interrupts(lev);
+
+    return(ret_val);
+}
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void
+MSS_MAC_mdio_run
+(
+    mss_mac_instance_t *this_mac,
+    mss_mac_mdio_op_t *ops,
+    uint32_t count
+)
+{
+    while(MSS_MAC_FAILED == MSS_MAC_mdio_submit(this_mac, ops, count, (mss_mac_mdio_done_t)NULL_POINTER))
+    {
+        if(0U == count)
+        {
+            break;
+        }
+        MSS_MAC_mdio_poll(this_mac);
+    }
+
+    while(0U != MSS_MAC_mdio_busy(this_mac))
+    {
+        MSS_MAC_mdio_poll(this_mac);
+    }
+}
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void
+MSS_MAC_mdio_poll
+(
+    mss_mac_instance_t *this_mac
+)
+{
+    mss_mac_instance_t *ctl = mdio_controller(this_mac);
+    psr_t lev;
+
+    lev = HAL_disable_interrupts();
+    mdio_step(ctl);
+    HAL_restore_interrupts(lev);
+}
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_mdio_busy
+(
+    const mss_mac_instance_t *this_mac
+)
+{
+    return(mdio_controller(this_mac)->mdio_busy);
+}
+#endif /* defined(MSS_MAC_MDIO_QUEUE) */
+
 
 /******************************************************************************
  * See mss_ethernet_mac.h for details of how to use this function.
@@ -1528,6 +1881,95 @@ void MSS_MAC_clear_statistics
 }
 
 
+#if defined(MSS_MAC_PERF_STATS)
+/*******************************************************************************
+ See mss_ethernet_mac.h for details of how to use this function
+*/
+void MSS_MAC_get_stats
+(
+    mss_mac_instance_t *this_mac,
+    mss_mac_stats_t *p_stats
+)
+{
+    uint32_t queue_no;
+    uint32_t queue_count;
+    uint32_t stat;
+    mss_mac_queue_t *p_queue;
+    mss_mac_queue_stats_t *p_qstats;
+
+    ASSERT(NULL_POINTER != p_stats);
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != p_stats))
+    {
+        if(0U != this_mac->is_emac)
+        {
+            queue_count = 1U;
+        }
+        else
+        {
+            queue_count = (uint32_t)MSS_MAC_QUEUE_COUNT;
+        }
+
+        /* Hold off all the queue interrupts so the counts are consistent */
+        for(queue_no = 0U; queue_no != queue_count; queue_no++)
+        {
+            if(0U != this_mac->use_local_ints)
+            {
+                __disable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]);
+            }
+        }
+
+        p_stats->timestamp = readmcycle();
+
+        for(stat = 0U; stat != (uint32_t)MSS_MAC_LAST_STAT; stat++)
+        {
+            MSS_STAT_ADD(this_mac->hw_stats[stat], MSS_MAC_read_stat(this_mac, (mss_mac_stat_t)stat));
+            p_stats->hw[stat] = MSS_STAT_READ(this_mac->hw_stats[stat]);
+        }
+
+        p_stats->tx_pause      = MSS_STAT_READ(this_mac->tx_pause);
+        p_stats->rx_pause      = MSS_STAT_READ(this_mac->rx_pause);
+        p_stats->pause_elapsed = MSS_STAT_READ(this_mac->pause_elapsed);
+        p_stats->queue_count   = queue_count;
+
+        for(queue_no = 0U; queue_no != queue_count; queue_no++)
+        {
+            p_queue  = &this_mac->queue[queue_no];
+            p_qstats = &p_stats->queue[queue_no];
+
+            p_qstats->ingress        = MSS_STAT_READ(p_queue->ingress);
+            p_qstats->egress         = MSS_STAT_READ(p_queue->egress);
+            p_qstats->rx_overflow    = MSS_STAT_READ(p_queue->rx_overflow);
+            p_qstats->hresp_error    = MSS_STAT_READ(p_queue->hresp_error);
+            p_qstats->rx_restart     = MSS_STAT_READ(p_queue->rx_restart);
+            p_qstats->tx_amba_errors = MSS_STAT_READ(p_queue->tx_amba_errors);
+            p_qstats->tx_restart     = MSS_STAT_READ(p_queue->tx_restart);
+            p_qstats->tx_reenable    = MSS_STAT_READ(p_queue->tx_reenable);
+            p_qstats->rx_free_desc   = p_queue->nb_available_rx_desc;
+            p_qstats->tx_free_desc   = p_queue->nb_available_tx_desc;
+            (void)memcpy(&p_qstats->perf, (const void *)&p_queue->perf, sizeof(mss_mac_queue_perf_t));
+        }
+
+        for(queue_no = 0U; queue_no != queue_count; queue_no++)
+        {
+            if(0U != this_mac->use_local_ints)
+            {
+                __enable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]);
+            }
+        }
+    }
+}
+#endif /* defined(MSS_MAC_PERF_STATS) */
+
+
 /******************************************************************************
  * See mss_ethernet_mac.h for details of how to use this function.
  */
@@ -1561,8 +2003,16 @@ MSS_MAC_receive_pkt
 
         ASSERT(NULL_POINTER != rx_pkt_buffer);
         ASSERT(IS_WORD_ALIGNED(rx_pkt_buffer));
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+        /* Can't mix application buffers with a pool managed ring */
+        ASSERT(0U == this_mac->queue[queue_no].rx_pool.active);
+#endif
         
-        if(this_mac->queue[queue_no].nb_available_rx_desc > 0U)
+        if((this_mac->queue[queue_no].nb_available_rx_desc > 0U)
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+           && (0U == this_mac->queue[queue_no].rx_pool.active)
+#endif
+          )
         {
             uint32_t next_rx_desc_index;
             
@@ -1584,6 +2034,10 @@ MSS_MAC_receive_pkt
 
             --this_mac->queue[queue_no].nb_available_rx_desc;
             next_rx_desc_index = this_mac->queue[queue_no].next_free_rx_desc_index;
+
+#if defined(MSS_MAC_CACHE_MAINTENANCE)
+            mss_l2_flush_range((uint64_t)rx_pkt_buffer, MSS_MAC_MAX_RX_BUF_SIZE);
+#endif
             
             if((MSS_MAC_RX_RING_SIZE - 1U) == next_rx_desc_index)
             {
@@ -1665,14 +2119,15 @@ MSS_MAC_receive_pkt
             /* Wrap around in case next descriptor is pointing to last in the ring */
             ++this_mac->queue[queue_no].next_free_rx_desc_index;
             this_mac->queue[queue_no].next_free_rx_desc_index %= MSS_MAC_RX_RING_SIZE;
-            
+
+            status = MSS_MAC_SUCCESS;
         }
 
         /*
          * Only call Ethernet Interrupt Enable function if the user says so.
          * See note above for disable...
          */
-        if((MSS_MAC_INT_ARM == enable) && (0U == this_mac->queue[queue_no].in_isr))
+        if((MSS_MAC_INT_DISABLE != enable) && (0U == this_mac->queue[queue_no].in_isr))
         {
             if(0U != this_mac->use_local_ints)
             {
@@ -1714,635 +2169,572 @@ MSS_MAC_receive_pkt_isr
 }
 #endif
 
-/*******************************************************************************
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+/******************************************************************************
  * See mss_ethernet_mac.h for details of how to use this function.
  */
-int32_t
-MSS_MAC_send_pkt
+uint8_t
+MSS_MAC_rx_pool_init
 (
     mss_mac_instance_t *this_mac,
     uint32_t queue_no,
-    uint8_t const * tx_buffer,
-    uint32_t length,
-    void * p_user_data
+    uint8_t *pool_mem,
+    uint32_t buf_size,
+    uint32_t buf_count
 )
 {
-    /*
-     * Simplified transmit operation which depends on the following assumptions:
-     * 
-     * 1. The TX DMA buffer size is big enough to contain a full packet.
-     * 2. We will only transmit one packet at a time.
-     * 3. We wait for any outstanding transmits on other queues to complete
-     *    because we need to ALWAYS write to the queue 0 pointer to trigger
-     *    internal restart of the DMA process.
-     *
-     * We do transmission by using two buffer descriptors. The first contains the
-     * packet to transmit and the second is a dummy one with the USED bit set. This
-     * halts transmission once the first packet is transmitted. We always reset the
-     * TX DMA to point to the first packet when we send a packet so we don't have
-     * to juggle buffer positions or worry about wrap.
-     */
-    uint32_t tx_length = length;
-    int32_t status = MSS_MAC_ERR_NOT_DONE;
-    /*
-     *  Hack for system testing. If b31 of the tx_length is 1 then we want to
-     * send without a CRC appended. This is used for loopback testing where we
-     * can get the GEM to receive packets with CRC appended and send them
-     * straight back.
-     */
-    int32_t no_crc = 0;
-    volatile int delay;
-    volatile uint32_t *p_nw_control;
-    volatile uint32_t *p_tx_status;
+    uint8_t status = MSS_MAC_FAILED;
+    mss_mac_queue_t *this_queue;
+    mss_mac_rx_pool_t *p_pool;
+    uint32_t index;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    ASSERT(NULL_POINTER != pool_mem);
+    ASSERT(IS_WORD_ALIGNED(pool_mem));
+    ASSERT(buf_size >= MSS_MAC_MAX_RX_BUF_SIZE);
+    ASSERT(0U == (buf_size & 7U));
+    ASSERT(buf_count <= MSS_MAC_RX_POOL_SIZE);
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) &&
+       (queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT) && (NULL_POINTER != pool_mem) &&
+       (0U != buf_count) && (buf_count <= MSS_MAC_RX_POOL_SIZE))
     {
-        /* Is config option for disabling CRC set? */
-        if(MSS_MAC_CRC_DISABLE == this_mac->append_CRC)
+        this_queue = &this_mac->queue[queue_no];
+        p_pool     = &this_queue->rx_pool;
+
+        rx_pool_lock(this_mac, queue_no);
+
+        /*
+         * Shut down reception while we rebuild the descriptor ring from
+         * scratch.
+         */
+        if(0U != this_mac->is_emac)
         {
-            no_crc = 1;
+            this_mac->emac_base->NETWORK_CONTROL &= ~GEM_ENABLE_RECEIVE;
+        }
+        else
+        {
+            this_mac->mac_base->NETWORK_CONTROL &= ~GEM_ENABLE_RECEIVE;
         }
 
-        /* Or has the user requested just this packet? */
-        if(0U != (tx_length & 0x80000000U))
+        /* Carve the pool memory up into buffers and put them all on the free list */
+        for(index = 0U; index < buf_count; ++index)
         {
-            no_crc = 1;
+            p_pool->buf[index].buffer    = pool_mem + ((uint64_t)index * (uint64_t)buf_size);
+            p_pool->buf[index].this_mac  = (void *)this_mac;
+            p_pool->buf[index].queue_no  = queue_no;
+            p_pool->buf[index].length    = 0U;
+            p_pool->buf[index].ref_count = 0U;
+            p_pool->buf[index].next_free = index + 1U;
         }
 
-        tx_length &= 0x7FFFFFFFU; /* Make sure high bit is now clear */
+        p_pool->buf[buf_count - 1U].next_free = MSS_MAC_RX_POOL_END;
+        p_pool->buf_count  = buf_count;
+        p_pool->buf_size   = buf_size;
+        p_pool->free_head  = 0U;
+        p_pool->free_count = buf_count;
+        p_pool->starved    = 0U;
 
-        /* Make this function atomic w.r.to EMAC interrupt */
-        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
-        if(0U == this_mac->queue[queue_no].in_isr)
+        for(index = 0U; index < MSS_MAC_RX_RING_SIZE; ++index)
         {
-            if(0U != this_mac->use_local_ints)
-            {
-                __disable_local_irq(this_mac->mac_q_int[queue_no]);
-            }
-            else
-            {
-                PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]); /* Single interrupt from GEM? */
-            }
+            p_pool->ring_buf[index] = MSS_MAC_RX_POOL_END;
         }
 
-        ASSERT(NULL_POINTER != tx_buffer);
-        ASSERT(0U != tx_length);
-        ASSERT(IS_WORD_ALIGNED(tx_buffer));
+        this_queue->nb_available_rx_desc    = MSS_MAC_RX_RING_SIZE;
+        this_queue->next_free_rx_desc_index = 0U;
+        this_queue->first_rx_desc_index     = 0U;
+        p_pool->active = 1U;
 
-        /* We use these a lot and this cuts down on conditional code later on */
+        (void)rx_pool_fill(this_mac, queue_no);
+
+        /* Start receive operations off with the fully populated ring */
         if(0U != this_mac->is_emac)
         {
-            p_nw_control = &this_mac->emac_base->NETWORK_CONTROL;
-            p_tx_status  = &this_mac->emac_base->TRANSMIT_STATUS;
+            this_mac->emac_base->RECEIVE_Q_PTR = (uint32_t)((uint64_t)this_queue->rx_desc_tab);
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+            this_mac->emac_base->UPPER_RX_Q_BASE_ADDR = (uint32_t)((uint64_t)this_queue->rx_desc_tab >> 32);
+#endif
+            this_mac->emac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
         }
         else
         {
-            p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
-            p_tx_status  = &this_mac->mac_base->TRANSMIT_STATUS;
+            *(this_queue->receive_q_ptr) = (uint32_t)((uint64_t)this_queue->rx_desc_tab);
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+            this_mac->mac_base->UPPER_RX_Q_BASE_ADDR = (uint32_t)((uint64_t)this_queue->rx_desc_tab >> 32);
+#endif
+            this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
         }
 
-#if defined(MSS_MAC_SIMPLE_TX_QUEUE)
-        if(this_mac->queue[queue_no].nb_available_tx_desc == (uint32_t)MSS_MAC_TX_RING_SIZE)
-        {
-            /* Queue is fully available for transmit so clear retry count */
-            this_mac->queue[queue_no].tries = 0UL;
+        rx_pool_unlock(this_mac, queue_no);
+        status = MSS_MAC_SUCCESS;
+    }
 
-            /* Make sure transmit is enabled */
-            if(0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
-                {
-                *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
-                }
-            /*
-             * Wait for pending transmits to complete as you cannot alter
-             * tx queue pointers while transmit is active...
-             */
-            while(0 != (*p_tx_status & GEM_TRANSMIT_GO))
-            {
-                delay++; /* Empty loop will cause debug issues... */
-            }
+    return(status);
+}
 
-            /* Make sure queue is currently disabled */
-            *this_mac->queue[queue_no].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[queue_no].tx_desc_tab) | 1UL;
 
-            /* Set up tx descriptor for this packet */
-            this_mac->queue[queue_no].nb_available_tx_desc--;
-            this_mac->queue[queue_no].current_tx_desc = 0;
-            this_mac->queue[queue_no].tx_desc_tab[0].addr_low = (uint32_t)((uint64_t)tx_buffer);
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_rx_pool_refill
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no
+)
+{
+    uint32_t filled = 0U;
 
-            /* Mark as last buffer for frame */
-            this_mac->queue[queue_no].tx_desc_tab[0].status   = (tx_length & GEM_TX_DMA_BUFF_LEN) | GEM_TX_DMA_LAST;
-            if(0 != no_crc)
-            {
-                this_mac->queue[queue_no].tx_desc_tab[0].status |= GEM_TX_DMA_NO_CRC;
-            }
-#if 0
-            this_mac->tx_desc_tab[0].status = (tx_length & GEM_TX_DMA_BUFF_LEN) | GEM_TX_DMA_LAST | GEM_TX_DMA_USED; /* PMCS deliberate error ! */
-#endif
-#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
-            this_mac->queue[queue_no].tx_desc_tab[0].addr_high = (uint32_t)((uint64_t)tx_buffer >> 32);
-            this_mac->queue[queue_no].tx_desc_tab[0].unused    = 0U;
-#endif
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT))
+    {
+        rx_pool_lock(this_mac, queue_no);
+        filled = rx_pool_fill(this_mac, queue_no);
+        rx_pool_unlock(this_mac, queue_no);
+    }
 
-            this_mac->queue[queue_no].tx_desc_tab[1].status   =  GEM_TX_DMA_WRAP | GEM_TX_DMA_LAST |  GEM_TX_DMA_USED ;
+    return(filled);
+}
 
-            this_mac->queue[queue_no].tx_caller_info[0] = p_user_data;
 
-            *this_mac->queue[queue_no].transmit_q_ptr = (uint32_t)((uint64_t)&this_mac->queue[queue_no].tx_desc_tab[0]);
-            /*
-             * If not queue 0 then we need to write disabled value to queue 0 to
-             * get the DMA engine reloaded...
-             */
-            if(0 != queue_no)
-            {
-                *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1U;
-            }
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void
+MSS_MAC_rx_buf_ref
+(
+    mss_mac_rx_buf_t *p_buf
+)
+{
+    mss_mac_instance_t *this_mac;
 
-            /* When transmitting at 10M, this delay is needed, 625MHz cpu clock - YMMV */
-            for(delay = 0; delay != 8; delay++)
-            {
-            }
+    ASSERT(NULL_POINTER != p_buf);
+    ASSERT(0U != p_buf->ref_count);
 
-            *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+    if(NULL_POINTER != p_buf)
+    {
+        this_mac = (mss_mac_instance_t *)p_buf->this_mac;
+        rx_pool_lock(this_mac, p_buf->queue_no);
+        ++p_buf->ref_count;
+        rx_pool_unlock(this_mac, p_buf->queue_no);
+    }
+}
 
-            this_mac->queue[queue_no].egress += tx_length;
-            status = MSS_MAC_ERR_OK;
-        }
-        else
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void
+MSS_MAC_rx_buf_release
+(
+    mss_mac_rx_buf_t *p_buf
+)
+{
+    mss_mac_instance_t *this_mac;
+    mss_mac_rx_pool_t *p_pool;
+
+    ASSERT(NULL_POINTER != p_buf);
+    ASSERT(0U != p_buf->ref_count);
+
+    if(NULL_POINTER != p_buf)
+    {
+        this_mac = (mss_mac_instance_t *)p_buf->this_mac;
+        p_pool   = &this_mac->queue[p_buf->queue_no].rx_pool;
+
+        rx_pool_lock(this_mac, p_buf->queue_no);
+        if(0U != p_buf->ref_count)
         {
-            /*
-             * Queue not available so lets check some things...
-             */
-            if(0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
+            --p_buf->ref_count;
+            if(0U == p_buf->ref_count)
             {
+                rx_pool_free(p_pool, p_buf);
+
                 /*
-                 * TX is currently disabled so re-enable it and restart the last
-                 * operation on this queue to see if that gets us a completion.
+                 * The receive handler normally tops the ring up in one go but
+                 * if the pool ran dry while the application was holding on to
+                 * buffers, there are empty descriptors waiting so put this one
+                 * straight back to work.
                  */
-                this_mac->queue[queue_no].tx_reenable++;
-                *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
-                *this_mac->queue[queue_no].transmit_q_ptr = (uint32_t)((uint64_t)&this_mac->queue[queue_no].tx_desc_tab[0]);
-                if(0 != queue_no)
+                if(0U != this_mac->queue[p_buf->queue_no].nb_available_rx_desc)
                 {
-                    *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1U;
+                    (void)rx_pool_fill(this_mac, p_buf->queue_no);
                 }
+            }
+        }
+        rx_pool_unlock(this_mac, p_buf->queue_no);
+    }
+}
+#endif /* defined(MSS_MAC_RX_BUFFER_POOL) */
 
-                /* When transmitting at 10M, this delay is needed, 625MHz cpu clock - YMMV */
-                for(delay = 0; delay != 8; delay++)
-                {
-                }
+#if defined(MSS_MAC_RX_POLL_MODE)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void
+MSS_MAC_set_rx_poll_mode
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_rx_poll_sched_t rx_poll_sched
+)
+{
+    mss_mac_queue_t *this_queue;
 
-                *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
-            }
-            else
-            {
-                /* Kick the tx start bit in case we are stalled... */
-                this_mac->queue[queue_no].tx_restart++;
-                *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
-            }
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT))
+    {
+        this_queue = &this_mac->queue[queue_no];
 
-            /*
-             * TX might have completed since we entered the function but if we
-             * seem to be spinning on this and buffers haven't been returned to
-             * the queue then just give up and reset queue.
-             */
-            if(this_mac->queue[queue_no].tx_desc_tab[0].status & GEM_TX_DMA_USED)
-            {
-                this_mac->queue[queue_no].tries++;
+        if(0U != this_mac->use_local_ints)
+        {
+            __disable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]);
+        }
 
-                if(this_mac->queue[queue_no].tries > 3) /* Been here too often? */
-                {
-                    /* Give up and reset FW queue count */
-                    this_mac->queue[queue_no].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
-                    status = MSS_MAC_ERR_TX_TIMEOUT;
-                }
-            }
+        this_queue->rx_poll_sched = rx_poll_sched;
+        if(NULL_POINTER == rx_poll_sched)
+        {
+            /* Back to interrupt driven operation */
+            this_queue->rx_poll_pending = 0U;
+            *this_queue->int_enable = GEM_RECEIVE_COMPLETE | GEM_RX_USED_BIT_READ;
+        }
 
-            if(this_mac->queue[queue_no].tx_desc_tab[0].status & (GEM_TX_DMA_RETRY_ERROR | GEM_TX_DMA_UNDERRUN | GEM_TX_DMA_BUS_ERROR | GEM_TX_DMA_LATE_COL_ERROR | GEM_TX_DMA_OFFLOAD_ERRORS))
-            {
-                /* Give up and reset FW queue count */
-                this_mac->queue[queue_no].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
-                status = MSS_MAC_ERR_TX_FAIL;
-            }
+        if(0U != this_mac->use_local_ints)
+        {
+            __enable_local_irq(this_mac->mac_q_int[queue_no]);
         }
-#else
-        /* TBD PMCS need to implement multi packet queuing... */
-#warning "Nothing implemented for multi packet tx yet"
-#endif
-        /* Ethernet Interrupt Enable function. */
-        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
-        if(0U == this_mac->queue[queue_no].in_isr)
+        else
         {
-            if(0U != this_mac->use_local_ints)
-            {
-                __enable_local_irq(this_mac->mac_q_int[queue_no]);
-            }
-            else
-            {
-                PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]); /* Single interrupt from GEM? */
-            }
+            PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]);
         }
     }
-    return status;
 }
 
 
-/*******************************************************************************
+/******************************************************************************
  * See mss_ethernet_mac.h for details of how to use this function.
  */
-int32_t
-MSS_MAC_send_pkts
+uint32_t
+MSS_MAC_rx_poll
 (
-    mss_mac_instance_t    *this_mac,
-    uint32_t               queue_mask,
-    mss_mac_tx_pkt_info_t *p_packets
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint32_t budget
 )
 {
-    /*
-     * Multi packet, multi queue transmit operation which depends on the
-     * following assumptions:
-     *
-     * 1. queue_mask indicates the queues which may be involved so that we can
-     *    properly handle ISR vs normal calling.
-     *    Set the mask to 0x0000000F to indicate all queues if there is any
-     *    uncertainty.
-     *    Set the mask to 0xFFFFFFF0 to indicate we are being called from a GEM
-     *    ISR.
-     * 2. We wait for any outstanding transmits on other queues to complete
-     *    because we need to ALWAYS write to the queue 0 pointer to trigger
-     *    internal restart of the DMA process.
-     * 3. We accept at most MSS_MAC_TX_RING_SIZE-1 packets as the final packet
-     *    in the chain is a dummy one to get the TX DMA engine to stop. Any
-     *    packets beyond that are silently dropped.
-     *
-     * We do transmission by using multiple buffer descriptors. The initial
-     * descriptors are for the packet(s) to transmit and the last is a dummy one
-     * with the USED bit set. This halts transmission once the first packet is
-     * transmitted. We always reset the TX DMA to point to the first packet when
-     * we send packets so we don't have to juggle buffer positions or worry
-     * about wrap.
-     */
-    uint32_t mask_bit;
-    uint32_t counter;
-    int32_t  status = MSS_MAC_ERR_NOT_DONE;
-    bool tx_done;
-    uint32_t queues;
-    mss_mac_tx_pkt_info_t *tx_rover;
-    /*
-     */
-    int32_t no_crc = 0;
-    volatile int delay;
-    volatile uint32_t *p_nw_control;
-    volatile uint32_t *p_tx_status;
+    mss_mac_queue_t *this_queue;
+    uint32_t processed = 0U;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT))
     {
-        /* We use these a lot and this cuts down on conditional code later on */
-        if(0U != this_mac->is_emac)
+        this_queue = &this_mac->queue[queue_no];
+
+        /*
+         * Keep the queue interrupt out while we work on the ring and flag
+         * in_isr so the receive callback can call MSS_MAC_receive_pkt() just
+         * as it would from the interrupt handler.
+         */
+        if(0U != this_mac->use_local_ints)
         {
-            p_nw_control = &this_mac->emac_base->NETWORK_CONTROL;
-            p_tx_status  = &this_mac->emac_base->TRANSMIT_STATUS;
-            queues = 1;
+            __disable_local_irq(this_mac->mac_q_int[queue_no]);
         }
         else
         {
-            p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
-            p_tx_status  = &this_mac->mac_base->TRANSMIT_STATUS;
-            queues = 4;
+            PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]);
         }
 
-        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
-        if(0xFFFFFFF0U != queue_mask) /* Not called from ISR */
+        this_queue->in_isr = 1;
+        this_queue->rx_polls++;
+
+        processed = rxpkt_handler(this_mac, queue_no, budget);
+        if(processed == budget)
+        {
+            /* More may be waiting so leave interrupts off and get polled again */
+            this_queue->rx_poll_exhausted++;
+        }
+        else if(0U != this_queue->rx_poll_pending)
         {
+            /* Ring is empty so go back to interrupt driven operation */
+            this_queue->rx_poll_pending = 0U;
+            *this_queue->int_enable = GEM_RECEIVE_COMPLETE | GEM_RX_USED_BIT_READ;
+
             /*
-             * Make this function atomic w.r.to EMAC interrupt for the queues we
-             * are using and queue 0.
+             * A packet may have landed between the last descriptor check and
+             * the interrupt enable. The receive complete status will still be
+             * pending in that case and we take the interrupt as soon as the
+             * queue interrupt is unmasked below.
              */
-            mask_bit = 1;
-            queue_mask |= 1U; /* Force queue 0 interrupt disable */
-            for(counter = 0; counter != 4; counter++)
-            {
-                if(0 != (mask_bit & queue_mask))
-                {
-                    if(0U != this_mac->use_local_ints)
-                    {
-                        __disable_local_irq(this_mac->mac_q_int[counter]);
-                    }
-                    else
-                    {
-                        PLIC_DisableIRQ(this_mac->mac_q_int[counter]); /* Single interrupt from GEM? */
-                    }
-                }
-
-                mask_bit <<= 1;
-            }
         }
-
-        tx_done = true;
-        for(counter = 0; counter != queues; counter++)
+        else
         {
-            if(this_mac->queue[counter].nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
-            {
-                tx_done = false; /* Not done if any queue still active */
-            }
+            /* Polled without being scheduled, nothing else to do */
         }
 
-        if(tx_done)
+        this_queue->in_isr = 0;
+
+        if(0U != this_mac->use_local_ints)
         {
-            /* Queues are fully available for transmit so clear retry counts */
-            for(counter = 0; counter != queues; counter++)
-            {
-                /* Make sure queue is currently disabled */
-                *this_mac->queue[counter].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[counter].tx_desc_tab) | 1UL;
-                this_mac->queue[counter].tries = 0UL;
-            }
+            __enable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]);
+        }
+    }
 
+    return(processed);
+}
+#endif /* defined(MSS_MAC_RX_POLL_MODE) */
 
-            /* Make sure transmit is enabled */
-            if(0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
-                {
-                *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
-                }
-            /*
-             * Wait for pending transmits to complete as you cannot alter
-             * tx queue pointers while transmit is active...
-             */
-            while(0 != (*p_tx_status & GEM_TRANSMIT_GO))
-            {
-                delay++; /* Empty loop will cause debug issues... */
-            }
+#if defined(MSS_MAC_BUSY_POLL)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void
+MSS_MAC_set_busy_poll
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint32_t enable
+)
+{
+    mss_mac_queue_t *this_queue;
 
-            /* All is quiet now so let's construct the TX queue(s) */
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT))
+    {
+        this_queue = &this_mac->queue[queue_no];
 
-            tx_rover = p_packets;
-            while(0 != tx_rover->length)
+        if(0U != enable)
+        {
+            if(0U == this_queue->busy_poll)
             {
-                uint32_t tx_length;
-                mss_mac_queue_t *p_queue;
-
-                tx_length = tx_rover->length;
-
-                /* Is config option for disabling CRC set? */
-                if(MSS_MAC_CRC_DISABLE == this_mac->append_CRC)
+                if(0U != this_mac->use_local_ints)
                 {
-                    no_crc = 1;
+                    __disable_local_irq(this_mac->mac_q_int[queue_no]);
                 }
-
-                /* Or has the user requested just this packet? */
-                if(0U != (tx_length & 0x80000000U))
+                else
                 {
-                    no_crc = 1;
-                    tx_length &= 0x7FFFFFFFU; /* Make sure high bit is now clear */
+                    PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]);
                 }
 
-
                 /*
-                 * We need to leave one spare at the end to halt the DMA when we
-                 * are done...
+                 * Remember what was enabled so it can be put back and mask
+                 * the lot. The in_isr flag stays set for as long as we poll
+                 * so the send and receive functions leave the PLIC alone.
                  */
-                p_queue  = &this_mac->queue[tx_rover->queue_no];
-                if(p_queue->nb_available_tx_desc > 1)
-                {
-                    uint32_t position;
-                    mss_mac_tx_desc_t *p_desc;
+                this_queue->busy_poll_ints = ~(*this_queue->int_mask);
+                *this_queue->int_disable = 0xFFFFFFFFU;
+                this_queue->in_isr = 1;
+                this_queue->busy_poll = 1U;
+            }
+        }
+        else if(0U != this_queue->busy_poll)
+        {
+            this_queue->busy_poll = 0U;
+            this_queue->in_isr = 0;
 
+            /*
+             * Clear down the status the rings built up while we were polling
+             * so we don't take a burst of stale interrupts.
+             */
+            *this_queue->int_status = 0xFFFFFFFFU;
+            *this_queue->int_enable = this_queue->busy_poll_ints;
 
-                    /* Set up tx descriptor for this packet */
-                    position = MSS_MAC_TX_RING_SIZE - p_queue->nb_available_tx_desc;
-                    p_desc   = &p_queue->tx_desc_tab[position];
+            if(0U != this_mac->use_local_ints)
+            {
+                __enable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]);
+            }
+        }
+        else
+        {
+            /* Not busy polling, nothing to do */
+        }
+    }
+}
 
-                    p_queue->nb_available_tx_desc--;
-                    p_queue->current_tx_desc = 0;
-                    p_desc->addr_low = (uint32_t)((uint64_t)tx_rover->tx_buffer);
 
-                    /* Mark as last buffer for frame */
-                    p_desc->status = (tx_length & GEM_TX_DMA_BUFF_LEN) | GEM_TX_DMA_LAST;
-                    if(0 != no_crc)
-                    {
-                        p_desc->status |= GEM_TX_DMA_NO_CRC;
-                    }
-#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
-                    p_desc->addr_high = (uint32_t)((uint64_t)tx_rover->tx_buffer >> 32);
-                    p_desc->unused    = 0U;
-#endif
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_poll_rx
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint32_t budget
+)
+{
+    mss_mac_queue_t *this_queue;
+    uint32_t processed = 0U;
 
-                    (p_desc + 1)->status |= GEM_TX_DMA_WRAP | GEM_TX_DMA_USED;
-                    p_queue->tx_caller_info[position] = tx_rover->p_user_data;
+    if(queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT)
+    {
+        this_queue = &this_mac->queue[queue_no];
 
-                    p_queue->egress += tx_length;
-                }
+        /*
+         * Only the descriptor is looked at when there is nothing to do, an
+         * idle poll costs one memory read and no register accesses.
+         */
+        if((0U != this_queue->busy_poll) &&
+           (0U != (this_queue->rx_desc_tab[this_queue->first_rx_desc_index].addr_low & GEM_RX_DMA_USED)))
+        {
+            this_queue->busy_polls++;
+            processed = rxpkt_handler(this_mac, queue_no, budget);
+            this_queue->overflow_counter = 0U;
+        }
+    }
 
-                tx_rover++;
-            }
+    return(processed);
+}
 
-            counter = queues;
-            while(0 != counter)
-            {
-                counter--;
-                if(this_mac->queue[counter].nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
-                {
-                    *this_mac->queue[counter].transmit_q_ptr = (uint32_t)((uint64_t)&this_mac->queue[counter].tx_desc_tab[0]);
-                }
-            }
 
-            /* If queue 0 not used we still need a dummy write... */
-            if(this_mac->queue[0].nb_available_tx_desc == (uint32_t)MSS_MAC_TX_RING_SIZE)
-            {
-                *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1U;
-            }
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_poll_tx_complete
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no
+)
+{
+    mss_mac_queue_t *this_queue;
+    uint32_t reclaimed = 0U;
 
-            /* When transmitting at 10M, this delay is needed, 625MHz cpu clock - YMMV */
-            for(delay = 0; delay != 8; delay++)
-            {
-            }
+    if(queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT)
+    {
+        this_queue = &this_mac->queue[queue_no];
 
-            *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+        if((0U != this_queue->busy_poll) &&
+           (this_queue->nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE) &&
+           (0U != (this_queue->tx_desc_tab[this_queue->current_tx_desc].status & GEM_TX_DMA_USED)))
+        {
+            this_queue->busy_polls++;
+#if defined(MSS_MAC_TX_SPSC_RING)
+            /* The ring service reclaims and then posts whatever is waiting */
+            tx_spsc_service(this_mac, queue_no);
+            reclaimed = 1U;
+#else
+            reclaimed = txpkt_handler(this_mac, queue_no);
+#endif
+        }
+    }
 
-            status = MSS_MAC_ERR_OK;
+    return(reclaimed);
+}
+#endif /* defined(MSS_MAC_BUSY_POLL) */
+
+/*******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+int32_t
+MSS_MAC_send_pkt
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint8_t const * tx_buffer,
+    uint32_t length,
+    void * p_user_data
+)
+{
+    uint32_t tx_length = length;
+    int32_t status = MSS_MAC_ERR_NOT_DONE;
+    /*
+     *  Hack for system testing. If b31 of the tx_length is 1 then we want to
+     * send without a CRC appended. This is used for loopback testing where we
+     * can get the GEM to receive packets with CRC appended and send them
+     * straight back.
+     */
+    int32_t no_crc = 0;
+    mss_mac_tx_frag_t frag;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        /* Is config option for disabling CRC set? */
+        if(MSS_MAC_CRC_DISABLE == this_mac->append_CRC)
+        {
+            no_crc = 1;
         }
-        else /* tx_done */
+
+        /* Or has the user requested just this packet? */
+        if(0U != (tx_length & 0x80000000U))
         {
-            /*
-             * Queues not available so lets check some things...
-             */
-            if(0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
-            {
-                /*
-                 * TX is currently disabled so re-enable it and restart the last
-                 * operation on the queues to see if that gets us a completion.
-                 */
-                counter = queues;
-                while(0 != counter)
-                {
-                    counter--;
-                    if(this_mac->queue[counter].nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
-                    {
-                        bool test_done = false;
-                        mss_mac_tx_desc_t *p_descriptor;
+            no_crc = 1;
+        }
 
-                        /* Scan descriptor lists to see where they are at */
-                        p_descriptor = &this_mac->queue[counter].tx_desc_tab[0];
-                        while(!test_done)
-                        {
-                            if((p_descriptor->status & GEM_TX_DMA_USED) && (p_descriptor->status & GEM_TX_DMA_WRAP))
-                            {
-                                /*
-                                 * End of chain and no unsent packets...
-                                 * Mark as all sent and disable queue.
-                                 */
-                                *this_mac->queue[counter].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[counter].tx_desc_tab) | 1U;
-                                this_mac->queue[counter].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
-                                test_done = true;
-                            }
-                            else if(p_descriptor->status & GEM_TX_DMA_USED)
-                            {
-                                /* Used but not last so try next one */
-                                p_descriptor++;
-                            }
-                            else /* Not used - restart from here */
-                            {
-                                this_mac->queue[counter].tx_reenable++;
-                                *this_mac->queue[counter].transmit_q_ptr = (uint32_t)((uint64_t)p_descriptor);
-                                test_done = true;
-                            }
-                        }
-                    }
-                }
+        tx_length &= 0x7FFFFFFFU; /* Make sure high bit is now clear */
 
-                *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
-                /* When transmitting at 10M, this delay is needed, 625MHz cpu clock - YMMV */
-                for(delay = 0; delay != 8; delay++)
-                {
-                }
+        ASSERT(NULL_POINTER != tx_buffer);
+        ASSERT(0U != tx_length);
+        ASSERT(IS_WORD_ALIGNED(tx_buffer));
 
-                *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
-            }
-            else
-            {
-                /* Kick the tx start bit in case we are stalled... */
-                this_mac->queue[0].tx_restart++;
-                *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
-            }
+        frag.addr   = tx_buffer;
+        frag.length = tx_length;
 
-            /*
-             * TX might have completed since we entered the function but if we
-             * seem to be spinning on this and buffers haven't been returned to
-             * the queue then just give up and reset queue.
-             */
-            for(counter = 0; counter != queues; counter++)
-            {
-                bool test_done = false;
-                bool all_sent = false;
-                mss_mac_tx_desc_t *p_descriptor;
+        status = send_frags(this_mac, queue_no, &frag, 1U, no_crc, p_user_data);
+    }
 
-                /* Scan descriptor lists to see where they are at */
-                p_descriptor = &this_mac->queue[counter].tx_desc_tab[0];
-                while(!test_done)
-                {
-                    if((p_descriptor->status & GEM_TX_DMA_USED) && (p_descriptor->status & GEM_TX_DMA_WRAP))
-                    {
-                        /*
-                         * End of chain and no unsent packets...
-                         * Mark as all sent and disable queue.
-                         */
-                        all_sent  = true;
-                        test_done = true;
-                    }
-                    else if(p_descriptor->status & GEM_TX_DMA_USED)
-                    {
-                        /* Used but not last so try next one */
-                        p_descriptor++;
-                    }
-                    else /* Not used - not all sent yet */
-                    {
-                        test_done = true;
-                    }
-                }
-
-                if(true == all_sent)
-                {
-                    this_mac->queue[counter].tries++;
-
-                    if(this_mac->queue[counter].tries > 3) /* Been here too often? */
-                    {
-                        /* Give up and reset FW queue count */
-                        this_mac->queue[counter].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
-                        status = MSS_MAC_ERR_TX_TIMEOUT;
-                    }
-                }
-            }
+    return status;
+}
 
-            for(counter = 0; counter != queues; counter++) /* Scan for TX fails */
-            {
-                bool test_done = false;
-                mss_mac_tx_desc_t *p_descriptor;
 
-                /* Scan descriptor lists to see where they are at */
-                p_descriptor = &this_mac->queue[counter].tx_desc_tab[0];
-                while(!test_done)
-                {
-                    if(p_descriptor->status & (GEM_TX_DMA_RETRY_ERROR | GEM_TX_DMA_UNDERRUN | GEM_TX_DMA_BUS_ERROR | GEM_TX_DMA_LATE_COL_ERROR | GEM_TX_DMA_OFFLOAD_ERRORS))
-                    {
-                        /* Give up and reset FW queue count on first fail */
-                        this_mac->queue[counter].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
-                        status = MSS_MAC_ERR_TX_FAIL;
-                        test_done = true;
-                    }
+/*******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+int32_t
+MSS_MAC_send_pkt_gather
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_frag_t const *frags,
+    uint32_t frag_count,
+    void * p_user_data
+)
+{
+    int32_t status = MSS_MAC_ERR_TX_NOT_OK;
+    int32_t no_crc = 0;
+    uint32_t index;
 
-                    if(p_descriptor->status & GEM_TX_DMA_WRAP)
-                    {
-                        /* End of chain so bail */
-                        test_done = true;
-                    }
+    ASSERT(NULL_POINTER != frags);
+    ASSERT(0U != frag_count);
+    /* Need one descriptor per fragment plus the dummy end of frame one */
+    ASSERT(frag_count < (uint32_t)MSS_MAC_TX_RING_SIZE);
 
-                    p_descriptor++;
-                }
-            }
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != frags) &&
+       (0U != frag_count) && (frag_count < (uint32_t)MSS_MAC_TX_RING_SIZE))
+    {
+        for(index = 0U; index != frag_count; index++)
+        {
+            ASSERT(NULL_POINTER != frags[index].addr);
+            ASSERT(0U != frags[index].length);
+            ASSERT(frags[index].length <= GEM_TX_DMA_BUFF_LEN);
         }
 
-        /* Ethernet Interrupt Enable function. */
-        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
-        if(0xFFFFFFF0U != queue_mask) /* Not called from ISR */
+        if(MSS_MAC_CRC_DISABLE == this_mac->append_CRC)
         {
-            mask_bit = 1;
-            for(counter = 0; counter != 4; counter++)
-            {
-                if(0 != (mask_bit & queue_mask))
-                {
-                    if(0U != this_mac->use_local_ints)
-                    {
-                        __enable_local_irq(this_mac->mac_q_int[counter]);
-                    }
-                    else
-                    {
-                        PLIC_EnableIRQ(this_mac->mac_q_int[counter]); /* Single interrupt from GEM? */
-                    }
-                }
-
-                mask_bit <<= 1;
-            }
+            no_crc = 1;
         }
+
+        status = send_frags(this_mac, queue_no, frags, frag_count, no_crc, p_user_data);
     }
+
     return status;
 }
 
-#if defined(MSS_MAC_SPEED_TEST)
-/* Very stripped down queue 0 packet blaster - assumes full tx queue0 is being
- * used on pMAC and does little or no checking. Don't call from GEM interrupts!
- * Don't use with local interrupts or eMAC either...
- */
-
-void copy8b(uint64_t *dest, uint64_t *source, uint32_t count)
-{
-    while(count--)
-        *dest++ = *source++;
-}
 
+/*******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
 int32_t
-MSS_MAC_send_pkts_fast
+MSS_MAC_send_pkts
 (
     mss_mac_instance_t    *this_mac,
-    mss_mac_tx_desc_t *descriptors,
-    uint32_t tx_count
+    uint32_t               queue_mask,
+    mss_mac_tx_pkt_info_t *p_packets
 )
 {
     /*
@@ -2369,1148 +2761,4124 @@ MSS_MAC_send_pkts_fast
      * we send packets so we don't have to juggle buffer positions or worry
      * about wrap.
      */
+    uint32_t mask_bit;
+    uint32_t counter;
+    int32_t  status = MSS_MAC_ERR_NOT_DONE;
+    bool tx_done;
+    uint32_t queues;
+    mss_mac_tx_pkt_info_t *tx_rover;
+    /*
+     */
+    int32_t no_crc = 0;
     volatile int delay;
     volatile uint32_t *p_nw_control;
     volatile uint32_t *p_tx_status;
 
-    p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
-    p_tx_status  = &this_mac->mac_base->TRANSMIT_STATUS;
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        /* We use these a lot and this cuts down on conditional code later on */
+        if(0U != this_mac->is_emac)
+        {
+            p_nw_control = &this_mac->emac_base->NETWORK_CONTROL;
+            p_tx_status  = &this_mac->emac_base->TRANSMIT_STATUS;
+            queues = 1;
+        }
+        else
+        {
+            p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
+            p_tx_status  = &this_mac->mac_base->TRANSMIT_STATUS;
+            queues = 4;
+        }
 
-    /* Wait for queue to empty */
-    while(this_mac->queue[0].nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
+        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
+        if(0xFFFFFFF0U != queue_mask) /* Not called from ISR */
         {
-        /* Make sure transmit stays enabled */
-        if(0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
+            /*
+             * Make this function atomic w.r.to EMAC interrupt for the queues we
+             * are using and queue 0.
+             */
+            mask_bit = 1;
+            queue_mask |= 1U; /* Force queue 0 interrupt disable */
+            for(counter = 0; counter != 4; counter++)
             {
-            *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
+                if(0 != (mask_bit & queue_mask))
+                {
+                    if(0U != this_mac->use_local_ints)
+                    {
+                        __disable_local_irq(this_mac->mac_q_int[counter]);
+                    }
+                    else
+                    {
+                        PLIC_DisableIRQ(this_mac->mac_q_int[counter]); /* Single interrupt from GEM? */
+                    }
+                }
+
+                mask_bit <<= 1;
             }
         }
 
-    PLIC_DisableIRQ(this_mac->mac_q_int[0]); /* Single interrupt from GEM? */
+        tx_done = true;
+        for(counter = 0; counter != queues; counter++)
+        {
+            if(this_mac->queue[counter].nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
+            {
+                tx_done = false; /* Not done if any queue still active */
+            }
+        }
 
-    /*
-     * Wait for pending transmits to complete as you cannot alter
-     * tx queue pointers while transmit is active...
-     */
-    while(0 != (*p_tx_status & GEM_TRANSMIT_GO))
-    {
-        delay++; /* Empty loop will cause debug issues... */
-    }
+        if(tx_done)
+        {
+            /* Queues are fully available for transmit so clear retry counts */
+            for(counter = 0; counter != queues; counter++)
+            {
+                /* Make sure queue is currently disabled */
+                *this_mac->queue[counter].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[counter].tx_desc_tab) | 1UL;
+                this_mac->queue[counter].tries = 0UL;
+            }
 
-    *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1UL;
-    this_mac->queue[0].tries = 0UL;
 
-    /* All is quiet now so let's construct the TX queue(s) */
+            /* Make sure transmit is enabled */
+            if(0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
+                {
+                *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
+                }
+            /*
+             * Wait for pending transmits to complete as you cannot alter
+             * tx queue pointers while transmit is active...
+             */
+            while(0 != (*p_tx_status & GEM_TRANSMIT_GO))
+            {
+                delay++; /* Empty loop will cause debug issues... */
+            }
 
-    copy8b((uint64_t *)this_mac->queue[0].tx_desc_tab, (uint64_t *)descriptors, sizeof(this_mac->queue[0].tx_desc_tab) / 8);
+            /* All is quiet now so let's construct the TX queue(s) */
 
-    this_mac->queue[0].egress += tx_count;
+            tx_rover = p_packets;
+            while(0 != tx_rover->length)
+            {
+                uint32_t tx_length;
+                mss_mac_queue_t *p_queue;
 
-    this_mac->queue[0].nb_available_tx_desc = 1;
-    this_mac->queue[0].current_tx_desc = 0;
-    *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)&this_mac->queue[0].tx_desc_tab[0]);
-    *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+                tx_length = tx_rover->length;
 
-    PLIC_EnableIRQ(this_mac->mac_q_int[0]); /* Single interrupt from GEM? */
+                /* Is config option for disabling CRC set? */
+                if(MSS_MAC_CRC_DISABLE == this_mac->append_CRC)
+                {
+                    no_crc = 1;
+                }
 
-    return(MSS_MAC_ERR_OK);
-}
+                /* Or has the user requested just this packet? */
+                if(0U != (tx_length & 0x80000000U))
+                {
+                    no_crc = 1;
+                    tx_length &= 0x7FFFFFFFU; /* Make sure high bit is now clear */
+                }
 
-#endif /* defined(MSS_MAC_SPEED_TEST) */
 
-/******************************************************************************
- * 
- */
-#if defined(USING_LWIP)
-extern BaseType_t g_mac_context_switch;
-#endif
+                /*
+                 * We need to leave one spare at the end to halt the DMA when we
+                 * are done...
+                 */
+                p_queue  = &this_mac->queue[tx_rover->queue_no];
+                if(p_queue->nb_available_tx_desc > 1)
+                {
+                    uint32_t position;
+                    mss_mac_tx_desc_t *p_desc;
 
-#if defined(USING_FREERTOS)
-extern UBaseType_t uxCriticalNesting;
-#endif
-#if defined(TARGET_ALOE)
-uint8_t  MAC0_plic_53_IRQHandler(void);
+
+                    /* Set up tx descriptor for this packet */
+                    position = MSS_MAC_TX_RING_SIZE - p_queue->nb_available_tx_desc;
+                    p_desc   = &p_queue->tx_desc_tab[position];
+
+                    p_queue->nb_available_tx_desc--;
+                    p_queue->current_tx_desc = 0;
+#if defined(MSS_MAC_CACHE_MAINTENANCE)
+                    mss_l2_flush_range((uint64_t)tx_rover->tx_buffer, tx_length);
+#endif
+                    p_desc->addr_low = (uint32_t)((uint64_t)tx_rover->tx_buffer);
+
+                    /* Mark as last buffer for frame */
+                    p_desc->status = (tx_length & GEM_TX_DMA_BUFF_LEN) | GEM_TX_DMA_LAST;
+                    if(0 != no_crc)
+                    {
+                        p_desc->status |= GEM_TX_DMA_NO_CRC;
+                    }
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+                    p_desc->addr_high = (uint32_t)((uint64_t)tx_rover->tx_buffer >> 32);
+                    p_desc->unused    = 0U;
+#endif
+
+                    (p_desc + 1)->status |= GEM_TX_DMA_WRAP | GEM_TX_DMA_USED;
+                    p_queue->tx_caller_info[position] = tx_rover->p_user_data;
+
+                    MSS_STAT_ADD(p_queue->egress, tx_length);
+                }
+
+                tx_rover++;
+            }
+
+            counter = queues;
+            while(0 != counter)
+            {
+                counter--;
+                if(this_mac->queue[counter].nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
+                {
+                    *this_mac->queue[counter].transmit_q_ptr = (uint32_t)((uint64_t)&this_mac->queue[counter].tx_desc_tab[0]);
+                }
+            }
+
+            /* If queue 0 not used we still need a dummy write... */
+            if(this_mac->queue[0].nb_available_tx_desc == (uint32_t)MSS_MAC_TX_RING_SIZE)
+            {
+                *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1U;
+            }
+
+            /* When transmitting at 10M, this delay is needed, 625MHz cpu clock - YMMV */
+            for(delay = 0; delay != 8; delay++)
+            {
+            }
+
+            *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+
+            status = MSS_MAC_ERR_OK;
+        }
+        else /* tx_done */
+        {
+            /*
+             * Queues not available so lets check some things...
+             */
+            if(0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
+            {
+                /*
+                 * TX is currently disabled so re-enable it and restart the last
+                 * operation on the queues to see if that gets us a completion.
+                 */
+                counter = queues;
+                while(0 != counter)
+                {
+                    counter--;
+                    if(this_mac->queue[counter].nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
+                    {
+                        bool test_done = false;
+                        mss_mac_tx_desc_t *p_descriptor;
+
+                        /* Scan descriptor lists to see where they are at */
+                        p_descriptor = &this_mac->queue[counter].tx_desc_tab[0];
+                        while(!test_done)
+                        {
+                            if((p_descriptor->status & GEM_TX_DMA_USED) && (p_descriptor->status & GEM_TX_DMA_WRAP))
+                            {
+                                /*
+                                 * End of chain and no unsent packets...
+                                 * Mark as all sent and disable queue.
+                                 */
+                                *this_mac->queue[counter].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[counter].tx_desc_tab) | 1U;
+                                this_mac->queue[counter].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
+                                test_done = true;
+                            }
+                            else if(p_descriptor->status & GEM_TX_DMA_USED)
+                            {
+                                /* Used but not last so try next one */
+                                p_descriptor++;
+                            }
+                            else /* Not used - restart from here */
+                            {
+                                MSS_STAT_INC(this_mac->queue[counter].tx_reenable);
+                                *this_mac->queue[counter].transmit_q_ptr = (uint32_t)((uint64_t)p_descriptor);
+                                test_done = true;
+                            }
+                        }
+                    }
+                }
+
+                *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
+                /* When transmitting at 10M, this delay is needed, 625MHz cpu clock - YMMV */
+                for(delay = 0; delay != 8; delay++)
+                {
+                }
+
+                *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+            }
+            else
+            {
+                /* Kick the tx start bit in case we are stalled... */
+                MSS_STAT_INC(this_mac->queue[0].tx_restart);
+                *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+            }
+
+            /*
+             * TX might have completed since we entered the function but if we
+             * seem to be spinning on this and buffers haven't been returned to
+             * the queue then just give up and reset queue.
+             */
+            for(counter = 0; counter != queues; counter++)
+            {
+                bool test_done = false;
+                bool all_sent = false;
+                mss_mac_tx_desc_t *p_descriptor;
+
+                /* Scan descriptor lists to see where they are at */
+                p_descriptor = &this_mac->queue[counter].tx_desc_tab[0];
+                while(!test_done)
+                {
+                    if((p_descriptor->status & GEM_TX_DMA_USED) && (p_descriptor->status & GEM_TX_DMA_WRAP))
+                    {
+                        /*
+                         * End of chain and no unsent packets...
+                         * Mark as all sent and disable queue.
+                         */
+                        all_sent  = true;
+                        test_done = true;
+                    }
+                    else if(p_descriptor->status & GEM_TX_DMA_USED)
+                    {
+                        /* Used but not last so try next one */
+                        p_descriptor++;
+                    }
+                    else /* Not used - not all sent yet */
+                    {
+                        test_done = true;
+                    }
+                }
+
+                if(true == all_sent)
+                {
+                    this_mac->queue[counter].tries++;
+
+                    if(this_mac->queue[counter].tries > 3) /* Been here too often? */
+                    {
+                        /* Give up and reset FW queue count */
+                        this_mac->queue[counter].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
+                        status = MSS_MAC_ERR_TX_TIMEOUT;
+                    }
+                }
+            }
+
+            for(counter = 0; counter != queues; counter++) /* Scan for TX fails */
+            {
+                bool test_done = false;
+                mss_mac_tx_desc_t *p_descriptor;
+
+                /* Scan descriptor lists to see where they are at */
+                p_descriptor = &this_mac->queue[counter].tx_desc_tab[0];
+                while(!test_done)
+                {
+                    if(p_descriptor->status & (GEM_TX_DMA_RETRY_ERROR | GEM_TX_DMA_UNDERRUN | GEM_TX_DMA_BUS_ERROR | GEM_TX_DMA_LATE_COL_ERROR | GEM_TX_DMA_OFFLOAD_ERRORS))
+                    {
+                        /* Give up and reset FW queue count on first fail */
+                        this_mac->queue[counter].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
+                        status = MSS_MAC_ERR_TX_FAIL;
+                        test_done = true;
+                    }
+
+                    if(p_descriptor->status & GEM_TX_DMA_WRAP)
+                    {
+                        /* End of chain so bail */
+                        test_done = true;
+                    }
+
+                    p_descriptor++;
+                }
+            }
+        }
+
+        /* Ethernet Interrupt Enable function. */
+        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
+        if(0xFFFFFFF0U != queue_mask) /* Not called from ISR */
+        {
+            mask_bit = 1;
+            for(counter = 0; counter != 4; counter++)
+            {
+                if(0 != (mask_bit & queue_mask))
+                {
+                    if(0U != this_mac->use_local_ints)
+                    {
+                        __enable_local_irq(this_mac->mac_q_int[counter]);
+                    }
+                    else
+                    {
+                        PLIC_EnableIRQ(this_mac->mac_q_int[counter]); /* Single interrupt from GEM? */
+                    }
+                }
+
+                mask_bit <<= 1;
+            }
+        }
+    }
+    return status;
+}
+
+#if defined(MSS_MAC_TX_BATCH)
+/*******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+int32_t
+MSS_MAC_send_pkt_batch
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_pkt_info_t const *p_packets,
+    uint32_t pkt_count
+)
+{
+    uint32_t limit;
+    int32_t status = MSS_MAC_ERR_TX_NOT_OK;
+
+    ASSERT(NULL_POINTER != p_packets);
+    ASSERT(0U != pkt_count);
+
+    if(0U != this_mac->is_emac)
+    {
+        limit = 1U;
+    }
+    else
+    {
+        limit = (uint32_t)MSS_MAC_QUEUE_COUNT;
+    }
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != p_packets) &&
+       (0U != pkt_count) && (queue_no < limit))
+    {
+        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
+        if(0U == this_mac->queue[queue_no].in_isr)
+        {
+            if(0U != this_mac->use_local_ints)
+            {
+                __disable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]);
+            }
+        }
+
+        status = tx_batch_post(this_mac, queue_no, p_packets, pkt_count);
+
+        if(0U == this_mac->queue[queue_no].in_isr)
+        {
+            if(0U != this_mac->use_local_ints)
+            {
+                __enable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]);
+            }
+        }
+    }
+
+    return status;
+}
+#endif /* defined(MSS_MAC_TX_BATCH) */
+
+#if defined(MSS_MAC_SPEED_TEST)
+/* Very stripped down queue 0 packet blaster - assumes full tx queue0 is being
+ * used on pMAC and does little or no checking. Don't call from GEM interrupts!
+ * Don't use with local interrupts or eMAC either...
+ */
+
+void copy8b(uint64_t *dest, uint64_t *source, uint32_t count)
+{
+    (void)mpfs_memcpy(dest, source, (size_t)count * 8U);
+}
+
+int32_t
+MSS_MAC_send_pkts_fast
+(
+    mss_mac_instance_t    *this_mac,
+    mss_mac_tx_desc_t *descriptors,
+    uint32_t tx_count
+)
+{
+    /*
+     * Multi packet, multi queue transmit operation which depends on the
+     * following assumptions:
+     *
+     * 1. queue_mask indicates the queues which may be involved so that we can
+     *    properly handle ISR vs normal calling.
+     *    Set the mask to 0x0000000F to indicate all queues if there is any
+     *    uncertainty.
+     *    Set the mask to 0xFFFFFFF0 to indicate we are being called from a GEM
+     *    ISR.
+     * 2. We wait for any outstanding transmits on other queues to complete
+     *    because we need to ALWAYS write to the queue 0 pointer to trigger
+     *    internal restart of the DMA process.
+     * 3. We accept at most MSS_MAC_TX_RING_SIZE-1 packets as the final packet
+     *    in the chain is a dummy one to get the TX DMA engine to stop. Any
+     *    packets beyond that are silently dropped.
+     *
+     * We do transmission by using multiple buffer descriptors. The initial
+     * descriptors are for the packet(s) to transmit and the last is a dummy one
+     * with the USED bit set. This halts transmission once the first packet is
+     * transmitted. We always reset the TX DMA to point to the first packet when
+     * we send packets so we don't have to juggle buffer positions or worry
+     * about wrap.
+     */
+    volatile int delay;
+    volatile uint32_t *p_nw_control;
+    volatile uint32_t *p_tx_status;
+
+    p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
+    p_tx_status  = &this_mac->mac_base->TRANSMIT_STATUS;
+
+    /* Wait for queue to empty */
+    while(this_mac->queue[0].nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
+        {
+        /* Make sure transmit stays enabled */
+        if(0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
+            {
+            *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
+            }
+        }
+
+    PLIC_DisableIRQ(this_mac->mac_q_int[0]); /* Single interrupt from GEM? */
+
+    /*
+     * Wait for pending transmits to complete as you cannot alter
+     * tx queue pointers while transmit is active...
+     */
+    while(0 != (*p_tx_status & GEM_TRANSMIT_GO))
+    {
+        delay++; /* Empty loop will cause debug issues... */
+    }
+
+    *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1UL;
+    this_mac->queue[0].tries = 0UL;
+
+    /* All is quiet now so let's construct the TX queue(s) */
+
+    copy8b((uint64_t *)this_mac->queue[0].tx_desc_tab, (uint64_t *)descriptors, sizeof(this_mac->queue[0].tx_desc_tab) / 8);
+
+    MSS_STAT_ADD(this_mac->queue[0].egress, tx_count);
+
+    this_mac->queue[0].nb_available_tx_desc = 1;
+    this_mac->queue[0].current_tx_desc = 0;
+    *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)&this_mac->queue[0].tx_desc_tab[0]);
+    *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+
+    PLIC_EnableIRQ(this_mac->mac_q_int[0]); /* Single interrupt from GEM? */
+
+    return(MSS_MAC_ERR_OK);
+}
+
+#endif /* defined(MSS_MAC_SPEED_TEST) */
+
+/******************************************************************************
+ * 
+ */
+#if defined(USING_LWIP)
+extern BaseType_t g_mac_context_switch;
+#endif
+
+#if defined(USING_FREERTOS)
+extern UBaseType_t uxCriticalNesting;
+#endif
+#if defined(TARGET_ALOE)
+uint8_t  MAC0_plic_53_IRQHandler(void);
 uint8_t  MAC0_plic_53_IRQHandler(void)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 0U);
-#endif
-    return(EXT_IRQ_KEEP_ENABLED);
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 0U);
+#endif
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+#else
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac0_int_plic_IRQHandler(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 0U);
+#endif
+
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac0_queue1_plic_IRQHandler(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 1U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 1U);
+#endif
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac0_queue2_plic_IRQHandler(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 2U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 2U);
+#endif
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac0_queue3_plic_IRQHandler(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 3U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 3U);
+#endif
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac0_emac_plic_IRQHandler(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_emac0, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_emac0, 0U);
+#endif
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac0_mmsl_plic_IRQHandler(void)
+{
+    g_mac0.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac1_int_plic_IRQHandler(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 0U);
+#endif
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac1_queue1_plic_IRQHandler(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 1U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 1U);
+#endif
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac1_queue2_plic_IRQHandler(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 2U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 2U);
+#endif
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac1_queue3_plic_IRQHandler(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 3U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 3U);
+#endif
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac1_emac_plic_IRQHandler(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_emac1, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_emac1, 0U);
+#endif
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+uint8_t mac1_mmsl_plic_IRQHandler(void)
+{
+    g_mac1.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
+    return(EXT_IRQ_KEEP_ENABLED);
+}
+
+
+/******************************************************************************
+ * 
+ */
+/* U54 1 */
+void mac_mmsl_u54_1_local_IRQHandler_3(void)
+{
+    g_mac0.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_emac_u54_1_local_IRQHandler_4(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_emac0, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_emac0, 0U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue3_u54_1_local_IRQHandler_5(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 3U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 3U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue2_u54_1_local_IRQHandler_6(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 2U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 2U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue1_u54_1_local_IRQHandler_7(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 1U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 1U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_int_u54_1_local_IRQHandler_8(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 0U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+/* U54 2 */
+void mac_mmsl_u54_2_local_IRQHandler_3(void)
+{
+    g_mac0.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_emac_u54_2_local_IRQHandler_4(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_emac0, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_emac0, 0U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue3_u54_2_local_IRQHandler_5(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 3U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 3U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue2_u54_2_local_IRQHandler_6(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 2U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 2U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue1_u54_2_local_IRQHandler_7(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 1U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 1U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_int_u54_2_local_IRQHandler_8(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac0, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac0, 0U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+/* U54 3 */
+void mac_mmsl_u54_3_local_IRQHandler_3(void)
+{
+    g_mac1.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_emac_u54_3_local_IRQHandler_4(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_emac1, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_emac1, 0U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue3_u54_3_local_IRQHandler_5(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 3U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 3U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue2_u54_3_local_IRQHandler_6(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 2U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 2U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue1_u54_3_local_IRQHandler_7(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 1U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 1U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_int_u54_3_local_IRQHandler_8(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 0U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+/* U54 4 */
+void mac_mmsl_u54_4_local_IRQHandler_3(void)
+{
+    g_mac1.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_emac_u54_4_local_IRQHandler_4(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_emac1, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_emac1, 0U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue3_u54_4_local_IRQHandler_5(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 3U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 3U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue2_u54_4_local_IRQHandler_6(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 2U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 2U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_queue1_u54_4_local_IRQHandler_7(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 1U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 1U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+
+/******************************************************************************
+ * 
+ */
+void mac_int_u54_4_local_IRQHandler_8(void)
+{
+#if defined(USING_FREERTOS)
+    uxCriticalNesting++;
+    generic_mac_irq_handler(&g_mac1, 0U);
+    uxCriticalNesting--;
+#else
+    generic_mac_irq_handler(&g_mac1, 0U);
+#endif
+#if defined(USING_LWIP)
+    if(0 != g_mac_context_switch)
+    {
+        g_mac_context_switch = 0;
+        vPortYieldISR();
+    }
+#endif
+}
+
+#endif
+
+
+/* Define the following if your GEM is configured to clear on read for int flags
+ * In this case you should not write to the int status reg ... */
+/* #define GEM_FLAGS_CLR_ON_RD */
+
+static void generic_mac_irq_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
+{
+    volatile uint32_t int_pending;  /* We read and hold a working copy as many
+                                     * of the bits can be clear on read if
+                                     * the GEM is configured that way... */
+    uint32_t volatile *rx_status;   /* Address of receive status register */
+    uint32_t volatile *tx_status;   /* Address of transmit status register */
+    uint32_t volatile *int_status;  /* Address of interrupt status register */
+    mss_mac_queue_t *p_queue;
+#if defined(MSS_MAC_PERF_STATS)
+    uint64_t isr_start = readmcycle();
+    uint64_t isr_cycles;
+    uint32_t rx_done;
+    uint32_t tx_done;
+#endif
+
+    p_queue = &this_mac->queue[queue_no];
+    
+    p_queue->in_isr = 1U;
+#if defined(MSS_MAC_PERF_STATS)
+    rx_done = (uint32_t)p_queue->perf.rx_desc_done;
+    tx_done = (uint32_t)p_queue->perf.tx_desc_done;
+#endif
+    int_status  = p_queue->int_status;
+    int_pending =  *int_status;
+#if defined(MSS_MAC_BUSY_POLL)
+    if(0U != p_queue->busy_poll)
+    {
+        /*
+         * Pended before the queue was handed over to the polling hart. Make
+         * sure everything is masked and leave the rings to the poll functions.
+         */
+        *p_queue->int_disable = 0xFFFFFFFFU;
+        int_pending = 0U;
+    }
+#endif
+
+    if(0U != this_mac->is_emac)
+    {
+        rx_status   = &this_mac->emac_base->RECEIVE_STATUS;
+        tx_status   = &this_mac->emac_base->TRANSMIT_STATUS;
+    }
+    else
+    {
+        rx_status   = &this_mac->mac_base->RECEIVE_STATUS;
+        tx_status   = &this_mac->mac_base->TRANSMIT_STATUS;
+    }
+    
+    /*
+     * Note, in the following code we generally clear any flags first and then
+     * handle the condition as this allows any new events which occur in the
+     * course of the ISR to be picked up later.
+     */
+
+    /*
+     * Packet received interrupt - first in line as most time critical. Followed
+     * by transmit interrupt and then the less frequent ones.
+     */
+    if((int_pending & GEM_RECEIVE_COMPLETE) != 0U)
+    {
+       *rx_status = GEM_FRAME_RECEIVED;
+#if !defined(GEM_FLAGS_CLR_ON_RD)
+#if defined(TARGET_ALOE)
+        *int_status = (uint32_t)3U; /* PMCS: Should be 2 but that does not work on Aloe... */
+#else
+        *int_status = (uint32_t)2U;
+#endif
+#if defined(MSS_MAC_RX_POLL_MODE)
+        if(NULL_POINTER != p_queue->rx_poll_sched)
+        {
+            /*
+             * Hand the work off to the poll function and keep RX interrupts
+             * off until it has drained the ring.
+             */
+            *p_queue->int_disable = GEM_RECEIVE_COMPLETE | GEM_RX_USED_BIT_READ;
+            if(0U == p_queue->rx_poll_pending)
+            {
+                p_queue->rx_poll_pending = 1U;
+                p_queue->rx_poll_sched(this_mac, (uint32_t)queue_no);
+            }
+        }
+        else
+#endif
+        {
+            (void)rxpkt_handler(this_mac, queue_no, MSS_MAC_RX_RING_SIZE);
+        }
+        p_queue->overflow_counter = 0U; /* Reset counter as we have received something */
+#endif
+    }
+
+    /* Transmit packet sent interrupt */
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+    /* The status bit is set even when masked so ignore it unless armed */
+    if(((int_pending & GEM_TRANSMIT_COMPLETE) != 0U) &&
+       ((0U == p_queue->tx_reclaim_low_water) || (0U != p_queue->tx_reclaim_armed)))
+#else
+    if((int_pending & GEM_TRANSMIT_COMPLETE) != 0U)
+#endif
+    {
+        if((*tx_status & GEM_STAT_TRANSMIT_COMPLETE) != 0U) /* If loopback test or other hasn't taken care of this... */
+        {
+            *tx_status  = GEM_STAT_TRANSMIT_COMPLETE;
+            *int_status = GEM_TRANSMIT_COMPLETE;
+#if !defined(GEM_FLAGS_CLR_ON_RD)
+#endif
+#if defined(MSS_MAC_TX_SPSC_RING)
+            tx_spsc_service(this_mac, (uint32_t)queue_no);
+#else
+            (void)txpkt_handler(this_mac, queue_no);
+#endif
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+            if(0U != p_queue->tx_reclaim_armed)
+            {
+                /* One shot - next send decides whether to arm again */
+                p_queue->tx_reclaim_armed = 0U;
+                *p_queue->int_disable = GEM_TRANSMIT_COMPLETE;
+            }
+#endif
+        }
+    }
+
+    /*
+     * RX and TX are the majority cases so see if all done rather than testing
+     * remaining one by one. Move on to one by one testing if not finished. Cuts
+     * down on interrupt processing impact for 'normal' case...
+     */
+    if((int_pending & ~(GEM_RECEIVE_COMPLETE | GEM_TRANSMIT_COMPLETE)) != 0U)
+    {
+        if((int_pending & GEM_RECEIVE_OVERRUN_INT) != 0U)
+        {
+            *rx_status = GEM_RECEIVE_OVERRUN;
+#if !defined(GEM_FLAGS_CLR_ON_RD)
+            *int_status = GEM_RECEIVE_OVERRUN_INT;
+#endif
+            p_queue->overflow_counter++;
+            MSS_STAT_INC(p_queue->rx_overflow);
+        }
+
+        if((int_pending & GEM_RX_USED_BIT_READ) != 0U)
+        {
+            *rx_status = GEM_BUFFER_NOT_AVAILABLE;
+    #if !defined(GEM_FLAGS_CLR_ON_RD)
+            *int_status = GEM_RX_USED_BIT_READ;
+    #endif
+#if defined(MSS_MAC_RX_POLL_MODE)
+            if(0U == p_queue->rx_poll_pending)
+#endif
+            {
+                (void)rxpkt_handler(this_mac, queue_no, MSS_MAC_RX_RING_SIZE);
+            }
+            MSS_STAT_INC(p_queue->rx_overflow);
+            p_queue->overflow_counter++;
+        }
+
+        if((int_pending & GEM_RESP_NOT_OK_INT) != 0U) /* Hope this is transient and restart rx... */
+        {
+            *rx_status = GEM_RX_RESP_NOT_OK; /* One of them did it... */
+            *tx_status = GEM_TX_RESP_NOT_OK;
+    #if !defined(GEM_FLAGS_CLR_ON_RD)
+            *int_status = GEM_RESP_NOT_OK_INT;
+    #endif
+            if(0U != this_mac->is_emac)
+            {
+                this_mac->emac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
+            }
+            else
+            {
+                this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
+            }
+
+            MSS_STAT_INC(p_queue->hresp_error);
+        }
+
+    /*
+     * This may cause more problems than it cures so disabling for now until we
+     * figure out a better strategy...
+     */
+    #if 0
+        if(p_queue->overflow_counter > 4U) /* looks like we are stuck in a rut here... */
+        {
+            uint32_t descriptor;
+            /* Restart receive operation from scratch */
+            p_queue->overflow_counter = 0U;
+            MSS_STAT_INC(p_queue->rx_restart);
+
+            if(0U != this_mac->is_emac)
+            {
+                this_mac->emac_base->NETWORK_CONTROL &= ~GEM_ENABLE_RECEIVE;
+            }
+            else
+            {
+                this_mac->mac_base->NETWORK_CONTROL &= ~GEM_ENABLE_RECEIVE;
+            }
+
+            p_queue->nb_available_rx_desc = MSS_MAC_RX_RING_SIZE;
+            p_queue->next_free_rx_desc_index = 0U;
+            p_queue->first_rx_desc_index = 0U;
+
+            for(descriptor = 0U; descriptor < MSS_MAC_RX_RING_SIZE; descriptor++) /* Discard everything */
+            {
+                p_queue->rx_desc_tab[descriptor].addr_low &= ~GEM_RX_DMA_USED;
+            }
+
+            if(0U != this_mac->is_emac)
+            {
+                this_mac->emac_base->RECEIVE_Q_PTR = (uint32_t)((uint64_t)p_queue->rx_desc_tab);
+    #if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+                this_mac->emac_base->UPPER_RX_Q_BASE_ADDR = (uint32_t)((uint64_t)p_queue->rx_desc_tab >> 32);
+    #endif
+                this_mac->emac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
+            }
+            else
+            {
+                this_mac->mac_base->RECEIVE_Q_PTR = (uint32_t)((uint64_t)p_queue->rx_desc_tab);
+    #if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+                this_mac->mac_base->UPPER_RX_Q_BASE_ADDR = (uint32_t)((uint64_t)p_queue->rx_desc_tab >> 32);
+    #endif
+                this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
+            }
+        }
+    #endif
+#if defined(MSS_MAC_MDIO_QUEUE)
+        /* Only queue 0 of the pMAC has the management frame sent interrupt */
+        if(((int_pending & GEM_MANAGEMENT_FRAME_SENT) != 0U) &&
+           (0U == this_mac->is_emac) && (0U == queue_no))
+        {
+            *int_status = GEM_MANAGEMENT_FRAME_SENT;
+            mdio_step(this_mac);
+        }
+#endif
+        if((int_pending & GEM_PAUSE_FRAME_TRANSMITTED) != 0U)
+        {
+            *int_status = GEM_PAUSE_FRAME_TRANSMITTED;
+            MSS_STAT_INC(this_mac->tx_pause);
+        }
+        if((int_pending & GEM_PAUSE_TIME_ELAPSED) != 0U)
+        {
+            *int_status = GEM_PAUSE_TIME_ELAPSED;
+            MSS_STAT_INC(this_mac->pause_elapsed);
+        }
+        if((int_pending & GEM_PAUSE_FRAME_WITH_NON_0_PAUSE_QUANTUM_RX) != 0U)
+        {
+            *int_status = GEM_PAUSE_FRAME_WITH_NON_0_PAUSE_QUANTUM_RX;
+            MSS_STAT_INC(this_mac->rx_pause);
+        }
+
+        /* Mask off checked ints and see if any left pending */
+        int_pending &= ~(GEM_RECEIVE_OVERRUN_INT | GEM_RX_USED_BIT_READ | GEM_RECEIVE_COMPLETE |
+                         GEM_TRANSMIT_COMPLETE | GEM_RESP_NOT_OK_INT | GEM_PAUSE_FRAME_TRANSMITTED |
+                         GEM_PAUSE_TIME_ELAPSED | GEM_PAUSE_FRAME_WITH_NON_0_PAUSE_QUANTUM_RX);
+        if(0U != int_pending)
+        {
+            if((int_pending & GEM_AMBA_ERROR) != 0U)
+            {
+                /* *int_status = (uint32_t)0x60U; */ /* Should be 0x40 but that doesn't clear it... */
+                *int_status = (uint32_t)0x40U;
+                *tx_status  = GEM_STAT_AMBA_ERROR;
+                *rx_status  = GEM_AMBA_ERROR;
+                MSS_STAT_INC(p_queue->tx_amba_errors);
+                p_queue->nb_available_tx_desc = MSS_MAC_TX_RING_SIZE;
+            }
+            else
+            {
+                volatile int32_t index;
+                ASSERT(0); /* Need to think about how to deal with this... */
+                while(1)
+                {
+                    index++;
+                }
+            }
+        }
+    }
+#if defined(MSS_MAC_PERF_STATS)
+    /* Low 32 bits of the running counts are enough for the per ISR delta */
+    rx_done = (uint32_t)p_queue->perf.rx_desc_done - rx_done;
+    tx_done = (uint32_t)p_queue->perf.tx_desc_done - tx_done;
+    if(rx_done > p_queue->perf.rx_max_per_isr)
+    {
+        p_queue->perf.rx_max_per_isr = rx_done;
+    }
+
+    if(tx_done > p_queue->perf.tx_max_per_isr)
+    {
+        p_queue->perf.tx_max_per_isr = tx_done;
+    }
+
+    isr_cycles = readmcycle() - isr_start;
+    p_queue->perf.isr_count++;
+    p_queue->perf.isr_cycles += isr_cycles;
+    if(isr_cycles > p_queue->perf.isr_max_cycles)
+    {
+        p_queue->perf.isr_max_cycles = isr_cycles;
+    }
+
+#endif
+#if defined(MSS_MAC_BUSY_POLL)
+    p_queue->in_isr = (int32_t)p_queue->busy_poll; /* Polling hart keeps it set */
+#else
+    p_queue->in_isr = 0U;
+#endif
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void MSS_MAC_set_tx_callback
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_transmit_callback_t tx_complete_handler
+)
+{
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        this_mac->queue[queue_no].pckt_tx_callback = tx_complete_handler;
+    }
+}
+
+
+#if defined(MSS_MAC_TX_BATCH)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void MSS_MAC_set_tx_batch_callback
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_batch_callback_t tx_batch_handler
+)
+{
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        this_mac->queue[queue_no].pckt_tx_batch_callback = tx_batch_handler;
+    }
+}
+#endif
+
+
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void
+MSS_MAC_set_tx_reclaim_mode
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint32_t low_water
+)
+{
+    mss_mac_queue_t *p_queue;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        p_queue = &this_mac->queue[queue_no];
+
+        if(0U != this_mac->use_local_ints)
+        {
+            __disable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]);
+        }
+
+        p_queue->tx_reclaim_armed = 0U;
+        if(0U == low_water)
+        {
+            /* Back to normal, any pending completion is picked up by the ISR */
+            p_queue->tx_reclaim_low_water = 0U;
+            *p_queue->int_enable = GEM_TRANSMIT_COMPLETE;
+        }
+        else
+        {
+            if(low_water > (uint32_t)MSS_MAC_TX_RING_SIZE)
+            {
+                p_queue->tx_reclaim_low_water = (uint32_t)MSS_MAC_TX_RING_SIZE;
+            }
+            else
+            {
+                p_queue->tx_reclaim_low_water = low_water;
+            }
+
+            *p_queue->int_disable = GEM_TRANSMIT_COMPLETE;
+        }
+
+        if(0U != this_mac->use_local_ints)
+        {
+            __enable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]);
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_tx_reclaim
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no
+)
+{
+    uint32_t reclaimed = 0U;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->use_local_ints)
+        {
+            __disable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]);
+        }
+
+        reclaimed = tx_reclaim_deferred(this_mac, queue_no);
+
+        if(0U != this_mac->use_local_ints)
+        {
+            __enable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]);
+        }
+    }
+
+    return(reclaimed);
+}
+#endif /* defined(MSS_MAC_TX_DEFERRED_RECLAIM) */
+
+
+#if defined(MSS_MAC_TX_SPSC_RING)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+int32_t
+MSS_MAC_tx_ring_push
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint8_t const * tx_buffer,
+    uint32_t length,
+    void * p_user_data
+)
+{
+    mss_mac_tx_spsc_t *p_ring;
+    mss_mac_tx_pkt_info_t *p_entry;
+    uint32_t head;
+    int32_t status = MSS_MAC_ERR_TX_NOT_OK;
+
+    ASSERT(NULL_POINTER != tx_buffer);
+    ASSERT(0U != (length & 0x7FFFFFFFU));
+    ASSERT(IS_WORD_ALIGNED(tx_buffer));
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != tx_buffer))
+    {
+        p_ring = &this_mac->queue[queue_no].tx_spsc;
+        head   = p_ring->head;
+
+        if((head - atomic_read(&p_ring->tail)) >= MSS_MAC_TX_SPSC_SIZE)
+        {
+            p_ring->full++;
+        }
+        else
+        {
+            p_entry = &p_ring->entry[head & (MSS_MAC_TX_SPSC_SIZE - 1U)];
+            p_entry->queue_no    = queue_no;
+            p_entry->length      = length;
+            p_entry->tx_buffer   = (uint8_t *)tx_buffer;
+            p_entry->p_user_data = p_user_data;
+
+            /* Publish the entry before the index that makes it visible */
+            mb();
+            atomic_set(&p_ring->head, head + 1U);
+
+            status = MSS_MAC_ERR_OK;
+        }
+
+        /* Keep the queue moving even if the ring was full */
+        tx_spsc_service(this_mac, queue_no);
+    }
+
+    return status;
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_tx_ring_space
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t queue_no
+)
+{
+    const mss_mac_tx_spsc_t *p_ring = &this_mac->queue[queue_no].tx_spsc;
+
+    return(MSS_MAC_TX_SPSC_SIZE - (p_ring->head - p_ring->tail));
+}
+#endif /* defined(MSS_MAC_TX_SPSC_RING) */
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void MSS_MAC_set_rx_callback
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_receive_callback_t rx_callback
+)
+{
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        this_mac->queue[queue_no].pckt_rx_callback = rx_callback;
+    }
+}
+
+
+#if defined(MSS_MAC_RX_CHAINED)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void MSS_MAC_set_rx_chain_callback
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_receive_chain_callback_t rx_callback
+)
+{
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        this_mac->queue[queue_no].pckt_rx_chain_callback = rx_callback;
+    }
+}
+#endif /* defined(MSS_MAC_RX_CHAINED) */
+
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void MSS_MAC_set_rx_hdr_split
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint8_t *hdr_pool,
+    mss_mac_receive_split_callback_t rx_callback
+)
+{
+    mss_mac_queue_t *this_queue;
+    uint32_t split = 0U;
+    uint32_t inc;
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT))
+    {
+        this_queue = &this_mac->queue[queue_no];
+
+        if(0U != this_mac->use_local_ints)
+        {
+            __disable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]);
+        }
+
+        this_queue->rx_hdr_pool = hdr_pool;
+        this_queue->rx_hdr_next = 0U;
+        for(inc = 0U; inc < MSS_MAC_RX_HDR_SLOTS; inc++)
+        {
+            this_queue->rx_hdr_used[inc] = 0U;
+        }
+
+        if(NULL_POINTER == hdr_pool)
+        {
+            this_queue->pckt_rx_split_callback = (mss_mac_receive_split_callback_t)NULL_POINTER;
+        }
+        else
+        {
+            this_queue->pckt_rx_split_callback = rx_callback;
+        }
+
+        /* The split is a MAC wide setting so keep it on while any queue wants it */
+        for(inc = 0U; inc < (uint32_t)MSS_MAC_QUEUE_COUNT; inc++)
+        {
+            if(NULL_POINTER != this_mac->queue[inc].pckt_rx_split_callback)
+            {
+                split = 1U;
+            }
+        }
+
+        if(0U != this_mac->is_emac)
+        {
+            if(0U != split)
+            {
+                this_mac->emac_base->DMA_CONFIG |= GEM_HDR_DATA_SPLITTING_EN;
+            }
+            else
+            {
+                this_mac->emac_base->DMA_CONFIG &= ~GEM_HDR_DATA_SPLITTING_EN;
+            }
+        }
+        else
+        {
+            if(0U != split)
+            {
+                this_mac->mac_base->DMA_CONFIG |= GEM_HDR_DATA_SPLITTING_EN;
+            }
+            else
+            {
+                this_mac->mac_base->DMA_CONFIG &= ~GEM_HDR_DATA_SPLITTING_EN;
+            }
+        }
+
+        if(0U != this_mac->use_local_ints)
+        {
+            __enable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]);
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void MSS_MAC_rx_hdr_release
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    const uint8_t *p_hdr
+)
+{
+    mss_mac_queue_t *this_queue;
+    uint64_t offset;
+
+    if(queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT)
+    {
+        this_queue = &this_mac->queue[queue_no];
+        offset = (uint64_t)p_hdr - (uint64_t)this_queue->rx_hdr_pool;
+
+        if((NULL_POINTER != this_queue->rx_hdr_pool) &&
+           ((uint64_t)p_hdr >= (uint64_t)this_queue->rx_hdr_pool) &&
+           (offset < ((uint64_t)MSS_MAC_RX_HDR_SLOTS * (uint64_t)MSS_MAC_RX_HDR_SIZE)))
+        {
+            /* Finish with the slot before the receive side can see it free */
+            mb();
+            this_queue->rx_hdr_used[offset / MSS_MAC_RX_HDR_SIZE] = 0U;
+        }
+    }
+}
+#endif /* defined(MSS_MAC_RX_HDR_SPLIT) */
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void MSS_MAC_change_speed
+(
+    mss_mac_instance_t *this_mac, uint32_t speed_duplex_select, mss_mac_speed_mode_t speed_mode
+)
+{
+    uint32_t temp_cr;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        /* Only change HW settings if there is a change in status */
+        if((this_mac->speed_duplex_select |= speed_duplex_select) || (this_mac->speed_mode != speed_mode))
+        {
+            this_mac->speed_duplex_select = speed_duplex_select;
+            this_mac->speed_mode = speed_mode;
+
+            /* Apply settings to the PHY */
+            this_mac->phy_set_link_speed(this_mac, this_mac->speed_duplex_select, speed_mode);
+            this_mac->phy_autonegotiate(this_mac); /* Do this in case it is needed */
+            if(MSS_MAC_SPEED_AN == speed_mode) /* Apply results of AN to MAC */
+            {
+                update_mac_cfg(this_mac);
+            }
+            else
+            {
+                if(0U != this_mac->is_emac)
+                {
+                    temp_cr = this_mac->emac_base->NETWORK_CONFIG;
+                }
+                else
+                {
+                    temp_cr = this_mac->mac_base->NETWORK_CONFIG;
+                }
+
+                temp_cr &= ~(GEM_GIGABIT_MODE_ENABLE | GEM_SPEED | GEM_FULL_DUPLEX);
+
+                if((MSS_MAC_1000_HDX == this_mac->speed_mode) || (MSS_MAC_1000_FDX == this_mac->speed_mode))
+                {
+    #if defined(TARGET_ALOE)
+                    *GEMGXL_tx_clk_sel = (uint32_t)0U;
+                    *GEMGXL_speed_mode = (uint32_t)2U;
+    #endif
+                    temp_cr |= GEM_GIGABIT_MODE_ENABLE;
+                }
+                else
+                {
+                    if((MSS_MAC_100_HDX == this_mac->speed_mode) || (MSS_MAC_100_FDX == this_mac->speed_mode))
+                    {
+    #if defined(TARGET_ALOE)
+                    *GEMGXL_tx_clk_sel = (uint32_t)1U;
+                    *GEMGXL_speed_mode = (uint32_t)1U;
+    #endif
+                    temp_cr |= (uint32_t)GEM_SPEED;
+                    }
+    #if defined(TARGET_ALOE)
+                    else
+                    {
+                        *GEMGXL_tx_clk_sel = (uint32_t)1U;
+                        *GEMGXL_speed_mode = (uint32_t)0U;
+                    }
+    #endif
+                }
+
+                /* Configure duplex mode */
+                if((MSS_MAC_10_FDX == this_mac->speed_mode) || (MSS_MAC_100_FDX == this_mac->speed_mode) || (MSS_MAC_1000_FDX == this_mac->speed_mode))
+                {
+                    temp_cr |= GEM_FULL_DUPLEX;
+                }
+
+                if(0U != this_mac->is_emac)
+                {
+                    this_mac->emac_base->NETWORK_CONFIG = temp_cr;
+                }
+                else
+                {
+                    this_mac->mac_base->NETWORK_CONFIG = temp_cr;
+                }
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_init_TSU(const mss_mac_instance_t *this_mac, const mss_mac_tsu_config_t *tsu_cfg)
+{
+    uint32_t temp;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        temp  = (tsu_cfg->sub_ns_inc & 0xFFU) << 24;
+        temp |= (tsu_cfg->sub_ns_inc >> 8) & 0xFFFFU;
+
+        if(0U != this_mac->is_emac)
+        {
+#if 0 /* Shouldn't really allow setting of tsu through eMAC as it is slaved to pMAC TSU */
+            this_mac->emac_base->TSU_TIMER_INCR_SUB_NSEC = temp;
+            this_mac->emac_base->TSU_TIMER_INCR          = tsu_cfg->ns_inc;
+
+            /* PMCS: I'm not 100% sure about the sequencing here... */
+
+            this_mac->emac_base->TSU_TIMER_MSB_SEC       = tsu_cfg->secs_msb;
+            this_mac->emac_base->TSU_TIMER_SEC           = tsu_cfg->secs_lsb;
+            this_mac->emac_base->TSU_TIMER_NSEC          = tsu_cfg->nanoseconds;
+#endif
+        }
+        else
+        {
+            this_mac->mac_base->TSU_TIMER_INCR_SUB_NSEC = temp;
+            this_mac->mac_base->TSU_TIMER_INCR          = tsu_cfg->ns_inc;
+            this_mac->mac_base->TSU_TIMER_MSB_SEC       = tsu_cfg->secs_msb;
+            this_mac->mac_base->TSU_TIMER_SEC           = tsu_cfg->secs_lsb;
+            this_mac->mac_base->TSU_TIMER_NSEC          = tsu_cfg->nanoseconds;
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_read_TSU(const mss_mac_instance_t *this_mac, mss_mac_tsu_time_t *tsu_time)
+{
+    int32_t got_time = 0;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        do
+        {
+            if(0U != this_mac->is_emac)
+            {
+                tsu_time->secs_lsb    = this_mac->emac_base->TSU_TIMER_SEC;
+                tsu_time->secs_msb    = this_mac->emac_base->TSU_TIMER_MSB_SEC;
+                tsu_time->nanoseconds = this_mac->emac_base->TSU_TIMER_NSEC;
+
+                /* Check for nanoseconds roll over and exit loop if none otherwise do again */
+                if(tsu_time->secs_lsb == this_mac->emac_base->TSU_TIMER_SEC)
+                {
+                    got_time = 1;
+                }
+            }
+            else
+            {
+                tsu_time->secs_lsb    = this_mac->mac_base->TSU_TIMER_SEC;
+                tsu_time->secs_msb    = this_mac->mac_base->TSU_TIMER_MSB_SEC;
+                tsu_time->nanoseconds = this_mac->mac_base->TSU_TIMER_NSEC;
+
+                /* Check for nanoseconds roll over and exit loop if none otherwise do again */
+                if(tsu_time->secs_lsb == this_mac->mac_base->TSU_TIMER_SEC)
+                {
+                    got_time = 1;
+                }
+            }
+        } while(0 == got_time);
+    }
+}
+
+
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint8_t
+MSS_MAC_get_rx_timestamp
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    const mss_mac_rx_desc_t *cdesc,
+    mss_mac_tsu_time_t *tsu_time
+)
+{
+    uint8_t ret_val = MSS_MAC_FAILED;
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) &&
+       (queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT) &&
+       (0U != (cdesc->addr_low & GEM_RX_DMA_TS_PRESENT)))
+    {
+        ts_expand(this_mac->queue[queue_no].ts_secs_ref, cdesc->nano_seconds,
+                  cdesc->seconds, tsu_time);
+        ret_val = MSS_MAC_SUCCESS;
+    }
+
+    return(ret_val);
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint8_t
+MSS_MAC_get_tx_timestamp
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    const mss_mac_tx_desc_t *cdesc,
+    mss_mac_tsu_time_t *tsu_time
+)
+{
+    uint8_t ret_val = MSS_MAC_FAILED;
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) &&
+       (queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT) &&
+       (0U != (cdesc->status & GEM_TX_DMA_TS_PRESENT)))
+    {
+        ts_expand(this_mac->queue[queue_no].ts_secs_ref, cdesc->nano_seconds,
+                  cdesc->seconds, tsu_time);
+        ret_val = MSS_MAC_SUCCESS;
+    }
+
+    return(ret_val);
+}
+#endif /* defined(MSS_MAC_DESC_TIMESTAMPS) */
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_set_TSU_rx_mode(const mss_mac_instance_t *this_mac, mss_mac_tsu_mode_t tsu_mode)
+{
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            this_mac->emac_base->RX_BD_CONTROL = ((uint32_t)tsu_mode << GEM_BD_TS_MODE_SHIFT) & GEM_BD_TS_MODE;
+        }
+        else
+        {
+            this_mac->mac_base->RX_BD_CONTROL = ((uint32_t)tsu_mode << GEM_BD_TS_MODE_SHIFT) & GEM_BD_TS_MODE;
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_set_TSU_tx_mode(const mss_mac_instance_t *this_mac, mss_mac_tsu_mode_t tsu_mode)
+{
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            this_mac->emac_base->TX_BD_CONTROL = ((uint32_t)tsu_mode << GEM_BD_TS_MODE_SHIFT) & GEM_BD_TS_MODE;
+        }
+        else
+        {
+            this_mac->mac_base->TX_BD_CONTROL = ((uint32_t)tsu_mode << GEM_BD_TS_MODE_SHIFT) & GEM_BD_TS_MODE;
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+mss_mac_tsu_mode_t MSS_MAC_get_TSU_rx_mode(const mss_mac_instance_t *this_mac)
+{
+    mss_mac_tsu_mode_t ret_val = MSS_MAC_TSU_MODE_DISABLED;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            ret_val = (mss_mac_tsu_mode_t)((this_mac->emac_base->RX_BD_CONTROL & GEM_BD_TS_MODE) >> GEM_BD_TS_MODE_SHIFT);
+        }
+        else
+        {
+            ret_val = (mss_mac_tsu_mode_t)((this_mac->mac_base->RX_BD_CONTROL & GEM_BD_TS_MODE) >> GEM_BD_TS_MODE_SHIFT);
+        }
+    }
+
+    return(ret_val);
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+mss_mac_tsu_mode_t MSS_MAC_get_TSU_tx_mode(const mss_mac_instance_t *this_mac)
+{
+    mss_mac_tsu_mode_t ret_val= MSS_MAC_TSU_MODE_DISABLED;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            ret_val = (mss_mac_tsu_mode_t)((this_mac->emac_base->TX_BD_CONTROL & GEM_BD_TS_MODE) >> GEM_BD_TS_MODE_SHIFT);
+        }
+        else
+        {
+            ret_val = (mss_mac_tsu_mode_t)((this_mac->mac_base->TX_BD_CONTROL & GEM_BD_TS_MODE) >> GEM_BD_TS_MODE_SHIFT);
+        }
+    }
+    
+    return(ret_val);
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_set_TSU_oss_mode(const mss_mac_instance_t *this_mac, mss_mac_oss_mode_t oss_mode)
+{
+    volatile uint32_t temp_control;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            temp_control = this_mac->emac_base->NETWORK_CONTROL;
+        }
+        else
+        {
+            temp_control = this_mac->mac_base->NETWORK_CONTROL;
+        }
+
+        /*
+         * Note. The docs don't say these are mutually exclusive but I don't think
+         * it makes sense to allow both modes at once...
+         */
+        if(MSS_MAC_OSS_MODE_DISABLED == oss_mode)
+        {
+            temp_control &= ~(GEM_OSS_CORRECTION_FIELD | GEM_ONE_STEP_SYNC_MODE);
+        }
+        else if(MSS_MAC_OSS_MODE_REPLACE == oss_mode)
+        {
+            temp_control &= ~GEM_OSS_CORRECTION_FIELD;
+            temp_control |= GEM_ONE_STEP_SYNC_MODE;
+        }
+        else
+        {
+            if(MSS_MAC_OSS_MODE_ADJUST == oss_mode)
+            {
+                temp_control |= GEM_OSS_CORRECTION_FIELD;
+                temp_control &= ~GEM_ONE_STEP_SYNC_MODE;
+            }
+        }
+        
+        if(0U != this_mac->is_emac)
+        {
+            this_mac->emac_base->NETWORK_CONTROL = temp_control;
+        }
+        else
+        {
+            this_mac->mac_base->NETWORK_CONTROL = temp_control;
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+mss_mac_oss_mode_t MSS_MAC_get_TSU_oss_mode(const mss_mac_instance_t *this_mac)
+{
+    mss_mac_oss_mode_t ret_val = MSS_MAC_OSS_MODE_DISABLED;
+    volatile uint32_t temp_control;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            temp_control = this_mac->emac_base->NETWORK_CONTROL;
+        }
+        else
+        {
+            temp_control = this_mac->mac_base->NETWORK_CONTROL;
+        }
+
+        /*
+         * Note. The docs don't say these are mutually exclusive but I don't think
+         * it makes sense to allow both modes at once so report this as invalid...
+         */
+        if((GEM_OSS_CORRECTION_FIELD | GEM_ONE_STEP_SYNC_MODE) == (temp_control & (GEM_OSS_CORRECTION_FIELD | GEM_ONE_STEP_SYNC_MODE)))
+        {
+            ret_val = MSS_MAC_OSS_MODE_INVALID;
+        }
+        else if(GEM_OSS_CORRECTION_FIELD == (temp_control & GEM_OSS_CORRECTION_FIELD))
+        {
+            ret_val = MSS_MAC_OSS_MODE_ADJUST;
+        }
+        else if(GEM_ONE_STEP_SYNC_MODE == (temp_control & GEM_ONE_STEP_SYNC_MODE))
+        {
+            ret_val = MSS_MAC_OSS_MODE_REPLACE;
+        }
+        else
+        {
+            ret_val = MSS_MAC_OSS_MODE_DISABLED;
+        }
+    }
+    
+    return(ret_val);
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_set_TSU_unicast_addr(const mss_mac_instance_t *this_mac, mss_mac_tsu_addr_t select, uint32_t ip_address)
+{
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            if(MSS_MAC_TSU_UNICAST_RX == select)
+            {
+                this_mac->emac_base->RX_PTP_UNICAST = ip_address;
+            }
+            else
+            {
+                this_mac->emac_base->TX_PTP_UNICAST = ip_address;
+            }
+        }
+        else
+        {
+            if(MSS_MAC_TSU_UNICAST_RX == select)
+            {
+                this_mac->mac_base->RX_PTP_UNICAST = ip_address;
+            }
+            else
+            {
+                this_mac->mac_base->TX_PTP_UNICAST = ip_address;
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+uint32_t MSS_MAC_get_TSU_unicast_addr(const mss_mac_instance_t *this_mac, mss_mac_tsu_addr_t select)
+{
+    uint32_t ret_val = 0U;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            if(MSS_MAC_TSU_UNICAST_RX == select)
+            {
+                ret_val = this_mac->emac_base->RX_PTP_UNICAST;
+            }
+            else
+            {
+                ret_val = this_mac->emac_base->TX_PTP_UNICAST;
+            }
+        }
+        else
+        {
+            if(MSS_MAC_TSU_UNICAST_RX == select)
+            {
+                ret_val = this_mac->mac_base->RX_PTP_UNICAST;
+            }
+            else
+            {
+                ret_val = this_mac->mac_base->TX_PTP_UNICAST;
+            }
+        }
+    }
+
+    return(ret_val);
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_set_VLAN_only_mode(const mss_mac_instance_t *this_mac, bool enable)
+{
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            if(false == enable)
+            {
+                this_mac->emac_base->NETWORK_CONFIG &= ~GEM_DISCARD_NON_VLAN_FRAMES;
+            }
+            else
+            {
+                this_mac->emac_base->NETWORK_CONFIG |= GEM_DISCARD_NON_VLAN_FRAMES;
+            }
+        }
+        else
+        {
+            if(false == enable)
+            {
+                this_mac->mac_base->NETWORK_CONFIG &= ~GEM_DISCARD_NON_VLAN_FRAMES;
+            }
+            else
+            {
+                this_mac->mac_base->NETWORK_CONFIG |= GEM_DISCARD_NON_VLAN_FRAMES;
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+bool MSS_MAC_get_VLAN_only_mode(const mss_mac_instance_t *this_mac)
+{
+    bool ret_val = false;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            ret_val = 0U != (this_mac->emac_base->NETWORK_CONFIG & GEM_DISCARD_NON_VLAN_FRAMES);
+        }
+        else
+        {
+            ret_val = 0U != (this_mac->mac_base->NETWORK_CONFIG & GEM_DISCARD_NON_VLAN_FRAMES);
+        }
+    }
+
+    return(ret_val);
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_set_stacked_VLAN(const mss_mac_instance_t *this_mac, uint16_t tag)
+{
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            if(GEM_VLAN_ETHERTYPE_MIN > tag)
+            {
+                this_mac->emac_base->STACKED_VLAN = 0U;
+            }
+            else
+            {
+                this_mac->emac_base->STACKED_VLAN = (uint32_t)tag | GEM_ENABLE_PROCESSING;
+            }
+        }
+        else
+        {
+            if(GEM_VLAN_ETHERTYPE_MIN > tag)
+            {
+                this_mac->mac_base->STACKED_VLAN = 0U;
+            }
+            else
+            {
+                this_mac->mac_base->STACKED_VLAN = (uint32_t)tag | GEM_ENABLE_PROCESSING;
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+uint16_t MSS_MAC_get_stacked_VLAN(const mss_mac_instance_t *this_mac)
+{
+    uint16_t ret_val = GEM_VLAN_NO_STACK; /* Return 0 if stacked VLANs not enabled */
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            if(0U != (this_mac->emac_base->STACKED_VLAN & GEM_ENABLE_PROCESSING))
+            {
+                ret_val = (uint16_t)this_mac->emac_base->STACKED_VLAN;
+            }
+        }
+        else
+        {
+            if(0U != (this_mac->mac_base->STACKED_VLAN & GEM_ENABLE_PROCESSING))
+            {
+                ret_val = (uint16_t)this_mac->mac_base->STACKED_VLAN;
+            }
+        }
+    }
+
+    return(ret_val);
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_set_hash(const mss_mac_instance_t *this_mac, uint64_t hash_in)
+{
+    uint64_t hash = hash_in; /* Avoids warning about modifying fn parameter passed by value */
+    
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            if(0ULL == hash) /* Short cut for disabling */
+            {
+                this_mac->emac_base->NETWORK_CONFIG &= ~(GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
+            }
+
+            this_mac->emac_base->HASH_BOTTOM = (uint32_t)hash;
+            hash >>= 32;
+            this_mac->emac_base->HASH_TOP = (uint32_t)hash;
+        }
+        else
+        {
+            if(0ULL == hash) /* Short cut for disabling */
+            {
+                this_mac->mac_base->NETWORK_CONFIG &= ~(GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
+            }
+
+            this_mac->mac_base->HASH_BOTTOM = (uint32_t)hash;
+            hash >>= 32;
+            this_mac->mac_base->HASH_TOP = (uint32_t)hash;
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+uint64_t MSS_MAC_get_hash(const mss_mac_instance_t *this_mac)
+{
+    uint64_t ret_val = 0U;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            ret_val   = (uint64_t)this_mac->emac_base->HASH_TOP;
+            ret_val <<= 32;
+            ret_val  |= (uint64_t)this_mac->emac_base->HASH_BOTTOM;
+        }
+        else
+        {
+            ret_val   = (uint64_t)this_mac->mac_base->HASH_TOP;
+            ret_val <<= 32;
+            ret_val  |= (uint64_t)this_mac->mac_base->HASH_BOTTOM;
+        }
+    }
+    
+    return(ret_val);
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_set_hash_mode(const mss_mac_instance_t *this_mac, mss_mac_hash_mode_t mode)
+{
+    uint32_t temp;
+
+    /*
+     * Enum values are matched to register bits but just to be safe we mask them
+     * to ensure only the two hash control bits are modified...
+     */
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            temp = this_mac->emac_base->NETWORK_CONFIG & ~(GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
+            temp |= (uint32_t)mode & (GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
+            this_mac->emac_base->NETWORK_CONFIG = temp;
+        }
+        else
+        {
+            temp = this_mac->mac_base->NETWORK_CONFIG & ~(GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
+            temp |= (uint32_t)mode & (GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
+            this_mac->mac_base->NETWORK_CONFIG = temp;
+        }
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+mss_mac_hash_mode_t MSS_MAC_get_hash_mode(const mss_mac_instance_t *this_mac)
+{
+    mss_mac_hash_mode_t ret_val = 0;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            ret_val = (mss_mac_hash_mode_t)(this_mac->emac_base->NETWORK_CONFIG & (GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE));
+        }
+        else
+        {
+            ret_val = (mss_mac_hash_mode_t)(this_mac->mac_base->NETWORK_CONFIG & (GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE));
+        }
+    }
+
+    return(ret_val);
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ *
+ * The GEM hash index is the exclusive or of every sixth bit of the destination
+ * address, counting from bit 0 of the first byte.
+ */
+
+uint32_t MSS_MAC_calc_hash_index(const uint8_t *mac_addr)
+{
+    uint64_t address = 0ULL;
+    uint32_t index = 0U;
+    uint32_t count;
+
+    for(count = 6U; count != 0U; count--)
+    {
+        address <<= 8;
+        address |= (uint64_t)mac_addr[count - 1U];
+    }
+
+    for(count = 0U; count != 8U; count++)
+    {
+        index ^= (uint32_t)(address & 0x3FULL);
+        address >>= 6;
+    }
+
+    return(index);
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_set_type_filter(const mss_mac_instance_t *this_mac, uint32_t filter, uint16_t value)
+{
+    volatile uint32_t *p_reg;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            p_reg = &this_mac->emac_base->SPEC_TYPE1;
+        }
+        else
+        {
+            p_reg = &this_mac->mac_base->SPEC_TYPE1;
+        }
+        if((filter <= 4U) && (filter > 0U)) /* Filter is in range 1 to 4 to match register naming */
+        {
+            p_reg += filter - 1U;
+            if(0U == value) /* Disable filter if match value is 0 as this should not be a valid type */
+            {
+                *p_reg = 0U;
+            }
+            else
+            {
+                *p_reg = (uint32_t)(0x80000000UL | (uint32_t)value);
+            }
+        }
+    }
 }
-#else
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-uint8_t mac0_int_plic_IRQHandler(void)
+
+uint16_t MSS_MAC_get_type_filter(const mss_mac_instance_t *this_mac, uint32_t filter)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 0U);
-#endif
+    volatile uint32_t *p_reg;
+    uint16_t ret_val = 0U;
 
-    return(EXT_IRQ_KEEP_ENABLED);
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            p_reg = &this_mac->emac_base->SPEC_TYPE1;
+        }
+        else
+        {
+            p_reg = &this_mac->mac_base->SPEC_TYPE1;
+        }
+
+        if((filter <= 4U) && (filter > 0U)) /* Filter is in range 1 to 4 to match register naming */
+        {
+            p_reg += filter - 1U;
+            if(0U != (*p_reg & 0x80000000UL)) /* Not disabled filter... */
+            {
+                ret_val = (uint16_t)*p_reg;
+            }
+        }
+    }
+
+    return(ret_val);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-uint8_t mac0_queue1_plic_IRQHandler(void)
+
+void MSS_MAC_set_sa_filter(const mss_mac_instance_t *this_mac, uint32_t filter, uint16_t control, const uint8_t *mac_addr)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 1U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 1U);
-#endif
-    return(EXT_IRQ_KEEP_ENABLED);
+    volatile uint32_t *p_reg;
+    uint32_t address32_l;
+    uint32_t address32_h;
+
+    ASSERT(NULL_POINTER!= mac_addr);
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != mac_addr))
+    {
+        if((filter >= 2U) && (filter <= 4U)) /* SA Filter 1 is for our address */
+        {
+            if(0U != this_mac->is_emac)
+            {
+                p_reg = &this_mac->emac_base->SPEC_ADD2_BOTTOM;
+            }
+            else
+            {
+                p_reg = &this_mac->mac_base->SPEC_ADD2_BOTTOM;
+            }
+
+            p_reg = p_reg + ((filter - 2U) * 2U);
+
+            if(MSS_MAC_SA_FILTER_DISABLE == control)
+            {
+                /*
+                 * Clear filter and disable - must be done in this order...
+                 *  Writing to [0] disables and [1] enables So this sequence
+                 *  clears the registers and disables the filter as opposed to
+                 *  setting a destination address filter for 00:00:00:00:00:00.
+                 */
+                p_reg[1] = 0U;
+                p_reg[0] = 0U;
+            }
+            else
+            {
+                /* Assemble correct register values */
+                address32_l  = ((uint32_t)mac_addr[3]) << 24;
+                address32_l |= ((uint32_t)mac_addr[2]) << 16;
+                address32_l |= ((uint32_t)mac_addr[1]) << 8;
+                address32_l |= ((uint32_t)mac_addr[0]);
+                address32_h =  ((uint32_t)mac_addr[5]) << 8;
+                address32_h |= ((uint32_t)mac_addr[4]);
+
+                address32_h |= (uint32_t)control << 16;
+
+                /* Update hardware registers - must be done in this order... */
+                p_reg[0] = address32_l;
+                p_reg[1] = address32_h;
+            }
+        }
+    }
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-uint8_t mac0_queue2_plic_IRQHandler(void)
+
+uint16_t MSS_MAC_get_sa_filter(const mss_mac_instance_t *this_mac, uint32_t filter, uint8_t *mac_addr)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 2U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 2U);
-#endif
-    return(EXT_IRQ_KEEP_ENABLED);
+    volatile uint32_t *p_reg;
+    uint32_t temp_reg;
+    uint16_t ret_val = 0U;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(NULL_POINTER != mac_addr)
+        {
+            (void)memset(mac_addr, 0, 6); /* Consistent result if bad parameters passed... */
+        }
+
+        if((filter >= 2U) && (filter <= 4U))
+        {
+            if(0U != this_mac->is_emac)
+            {
+                p_reg = &this_mac->emac_base->SPEC_ADD2_BOTTOM;
+            }
+            else
+            {
+                p_reg = &this_mac->mac_base->SPEC_ADD2_BOTTOM;
+            }
+
+            p_reg = p_reg + ((filter - 2U) * 2U);
+
+            if(NULL_POINTER != mac_addr) /* Want MAC address and filter control info? */
+            {
+                temp_reg = p_reg[0];
+                mac_addr[0] = (uint8_t)temp_reg & BITS_08;
+                temp_reg >>= 8;
+                mac_addr[1] = (uint8_t)temp_reg & BITS_08;
+                temp_reg >>= 8;
+                mac_addr[2] = (uint8_t)temp_reg & BITS_08;
+                temp_reg >>= 8;
+                mac_addr[3] = (uint8_t)temp_reg & BITS_08;
+
+                temp_reg = p_reg[1];
+                mac_addr[4] = (uint8_t)temp_reg & BITS_08;
+                temp_reg >>= 8;
+                mac_addr[5] = (uint8_t)temp_reg & BITS_08;
+            }
+
+            ret_val = (uint16_t)(p_reg[1] >> 16);
+        }
+    }
+
+    return(ret_val);
 }
 
 
+#if defined(MSS_MAC_MCAST_FILTER)
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-uint8_t mac0_queue3_plic_IRQHandler(void)
+
+uint8_t MSS_MAC_mcast_add(mss_mac_instance_t *this_mac, const uint8_t *mac_addr)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 3U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 3U);
-#endif
-    return(EXT_IRQ_KEEP_ENABLED);
+    uint8_t status = MSS_MAC_FAILED;
+    uint32_t entry;
+
+    ASSERT(NULL_POINTER != mac_addr);
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != mac_addr) &&
+       (0U != (mac_addr[0] & 1U)))
+    {
+        entry = mcast_find(this_mac, mac_addr);
+        if(entry != this_mac->mcast_count)
+        {
+            if(0xFFFFU != this_mac->mcast[entry].refs)
+            {
+                this_mac->mcast[entry].refs++;
+                status = MSS_MAC_SUCCESS;
+            }
+        }
+        else if(this_mac->mcast_count < MSS_MAC_MCAST_LIST_SIZE)
+        {
+            (void)memcpy(this_mac->mcast[entry].addr, mac_addr, 6U);
+            this_mac->mcast[entry].refs = 1U;
+            this_mac->mcast_count++;
+            mcast_program(this_mac);
+            status = MSS_MAC_SUCCESS;
+        }
+        else
+        {
+            /* List full, leave things as they are */
+        }
+    }
+
+    return(status);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
+ *
+ * Entries are kept in join order so the address of a freed specific address
+ * filter goes to the oldest address which was in the hash.
  */
-uint8_t mac0_emac_plic_IRQHandler(void)
+
+uint8_t MSS_MAC_mcast_remove(mss_mac_instance_t *this_mac, const uint8_t *mac_addr)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_emac0, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_emac0, 0U);
-#endif
-    return(EXT_IRQ_KEEP_ENABLED);
+    uint8_t status = MSS_MAC_FAILED;
+    uint32_t entry;
+
+    ASSERT(NULL_POINTER != mac_addr);
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != mac_addr))
+    {
+        entry = mcast_find(this_mac, mac_addr);
+        if(entry != this_mac->mcast_count)
+        {
+            this_mac->mcast[entry].refs--;
+            if(0U == this_mac->mcast[entry].refs)
+            {
+                this_mac->mcast_count--;
+                for(; entry != this_mac->mcast_count; entry++)
+                {
+                    this_mac->mcast[entry] = this_mac->mcast[entry + 1U];
+                }
+
+                mcast_program(this_mac);
+            }
+
+            status = MSS_MAC_SUCCESS;
+        }
+    }
+
+    return(status);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-uint8_t mac0_mmsl_plic_IRQHandler(void)
+
+void MSS_MAC_mcast_clear(mss_mac_instance_t *this_mac)
 {
-    g_mac0.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
-    return(EXT_IRQ_KEEP_ENABLED);
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        this_mac->mcast_count = 0U;
+        mcast_program(this_mac);
+    }
 }
 
 
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+uint32_t MSS_MAC_mcast_get_count(const mss_mac_instance_t *this_mac)
+{
+    return(this_mac->mcast_count);
+}
+#endif /* defined(MSS_MAC_MCAST_FILTER) */
 
+
+#if defined(MSS_MAC_CAPTURE)
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-uint8_t mac1_int_plic_IRQHandler(void)
+
+uint8_t MSS_MAC_capture_start(mss_mac_instance_t *this_mac, mss_mac_capture_t *cap)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 0U);
-#endif
-    return(EXT_IRQ_KEEP_ENABLED);
+    uint8_t status = MSS_MAC_FAILED;
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != cap) &&
+       (NULL_POINTER != cap->mem) && (0U == ((uint64_t)cap->mem & 7U)) &&
+       (cap->size >= CAPTURE_MIN_SIZE) && (0U == (cap->size & (cap->size - 1U))))
+    {
+        cap->head    = 0U;
+        cap->tail    = 0U;
+        cap->frames  = 0U;
+        cap->dropped = 0U;
+        CAPTURE_FENCE_W_W();
+        this_mac->capture = cap;
+        status = MSS_MAC_SUCCESS;
+    }
+
+    return(status);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-uint8_t mac1_queue1_plic_IRQHandler(void)
+
+void MSS_MAC_capture_stop(mss_mac_instance_t *this_mac)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 1U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 1U);
-#endif
-    return(EXT_IRQ_KEEP_ENABLED);
+    this_mac->capture = (mss_mac_capture_t *)0;
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
+ *
+ * Records which would have run past the end of the ring start again at the
+ * beginning. The gap left is marked with a record header holding
+ * CAPTURE_WRAP, or is too short to hold a header.
  */
-uint8_t mac1_queue2_plic_IRQHandler(void)
+
+uint32_t MSS_MAC_capture_dump(mss_mac_capture_t *cap, mss_mac_capture_write_t write_fn, void *ctx, uint32_t pcap_header)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 2U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 2U);
-#endif
-    return(EXT_IRQ_KEEP_ENABLED);
+    uint32_t pcap_hdr[6];
+    const uint32_t *p_rec;
+    uint64_t tail;
+    uint32_t offset;
+    uint32_t room;
+    uint32_t records = 0U;
+    uint8_t status = MSS_MAC_SUCCESS;
+
+    if(0U != pcap_header)
+    {
+        pcap_hdr[0] = CAPTURE_PCAP_MAGIC;
+        pcap_hdr[1] = CAPTURE_PCAP_VERSION;
+        pcap_hdr[2] = 0U;       /* GMT to local correction */
+        pcap_hdr[3] = 0U;       /* Accuracy of time stamps */
+        pcap_hdr[4] = (0U == cap->snaplen) ? MSS_MAC_MAX_PACKET_SIZE : cap->snaplen;
+        pcap_hdr[5] = CAPTURE_LINKTYPE_ETHERNET;
+        status = write_fn(ctx, (const uint8_t *)pcap_hdr, (uint32_t)sizeof(pcap_hdr));
+    }
+
+    tail = cap->tail;
+    CAPTURE_FENCE_R_R();
+
+    while((MSS_MAC_SUCCESS == status) && (cap->head != tail))
+    {
+        offset = (uint32_t)cap->head & (cap->size - 1U);
+        room = cap->size - offset;
+        p_rec = (const uint32_t *)&cap->mem[offset];
+
+        if((room < CAPTURE_REC_HDR_SIZE) || (CAPTURE_WRAP == p_rec[2]))
+        {
+            cap->head += room;
+        }
+        else
+        {
+            status = write_fn(ctx, (const uint8_t *)p_rec, CAPTURE_REC_HDR_SIZE + p_rec[2]);
+            if(MSS_MAC_SUCCESS == status)
+            {
+                CAPTURE_FENCE_RW_W();
+                cap->head += CAPTURE_REC_HDR_SIZE + ((p_rec[2] + 7U) & ~7U);
+                records++;
+            }
+        }
+    }
+
+    return(records);
 }
+#endif /* defined(MSS_MAC_CAPTURE) */
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-uint8_t mac1_queue3_plic_IRQHandler(void)
+
+void MSS_MAC_set_type_1_filter(const mss_mac_instance_t *this_mac, uint32_t filter_no, const mss_mac_type_1_filter_t *filter)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 3U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 3U);
-#endif
-    return(EXT_IRQ_KEEP_ENABLED);
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (filter_no < MSS_MAC_TYPE_1_SCREENERS))
+    {
+        volatile uint32_t *p_reg;
+        uint32_t temp_reg;
+
+        if(0U != this_mac->is_emac)
+        {
+            p_reg = &this_mac->emac_base->SCREENING_TYPE_1_REGISTER_0;
+        }
+        else
+        {
+            p_reg = &this_mac->mac_base->SCREENING_TYPE_1_REGISTER_0;
+        }
+
+        temp_reg  = (uint32_t)filter->queue_no & GEM_QUEUE_NUMBER;
+        temp_reg |= ((uint32_t)filter->dstc << GEM_DSTC_MATCH_SHIFT) & GEM_DSTC_MATCH;
+        temp_reg |= ((uint32_t)filter->udp_port << GEM_UDP_PORT_MATCH_SHIFT) & GEM_UDP_PORT_MATCH;
+        if(0U != filter->drop_on_match)
+        {
+            temp_reg |= GEM_DROP_ON_MATCH;
+        }
+
+        if(0U != filter->dstc_enable)
+        {
+            temp_reg |= GEM_DSTC_ENABLE;
+        }
+
+        if(0U != filter->udp_port_enable)
+        {
+            temp_reg |= GEM_UDP_PORT_MATCH_ENABLE;
+        }
+
+        p_reg[filter_no] = temp_reg;
+    }
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-uint8_t mac1_emac_plic_IRQHandler(void)
+
+void MSS_MAC_get_type_1_filter(const mss_mac_instance_t *this_mac, uint32_t filter_no, mss_mac_type_1_filter_t *filter)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_emac1, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_emac1, 0U);
-#endif
-    return(EXT_IRQ_KEEP_ENABLED);
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (filter_no < MSS_MAC_TYPE_1_SCREENERS))
+    {
+        volatile uint32_t *p_reg;
+        uint32_t temp_reg;
+
+        (void)memset(filter, 0, sizeof(mss_mac_type_1_filter_t)); /* Blank canvass to start */
+        
+        if(0U != this_mac->is_emac)
+        {
+            p_reg = &this_mac->emac_base->SCREENING_TYPE_1_REGISTER_0;
+        }
+        else
+        {
+            p_reg = &this_mac->mac_base->SCREENING_TYPE_1_REGISTER_0;
+        }
+
+        temp_reg = p_reg[filter_no];
+
+        filter->queue_no = (uint8_t)(temp_reg & GEM_QUEUE_NUMBER);
+        temp_reg >>= 4;
+
+        filter->dstc = (uint8_t)(temp_reg & GEM_DSTC_MATCH);
+        temp_reg >>= GEM_DSTC_MATCH_SHIFT;
+
+        filter->udp_port = (uint16_t)(temp_reg & GEM_UDP_PORT_MATCH);
+        temp_reg >>= GEM_UDP_PORT_MATCH_SHIFT;
+
+        filter->dstc_enable = (uint8_t)(temp_reg & 1U);
+        temp_reg >>= 1;
+
+        filter->udp_port_enable = (uint8_t)(temp_reg & 1U);
+        temp_reg >>= 1;
+
+        filter->drop_on_match = (uint8_t)(temp_reg & 1U);
+    }
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-uint8_t mac1_mmsl_plic_IRQHandler(void)
+
+void MSS_MAC_set_type_2_ethertype(const mss_mac_instance_t *this_mac, uint32_t ethertype_no, uint16_t ethertype)
 {
-    g_mac1.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
-    return(EXT_IRQ_KEEP_ENABLED);
+    volatile uint32_t *p_reg;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U == this_mac->is_emac) /* Ethertype filter not supported on eMAC */
+        {
+            p_reg = &this_mac->mac_base->SCREENING_TYPE_2_ETHERTYPE_REG_0;
+            if(ethertype_no < MSS_MAC_TYPE_2_ETHERTYPES)
+            {
+                p_reg[ethertype_no] = (uint32_t)ethertype;
+            }
+        }
+    }
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-/* U54 1 */
-void mac_mmsl_u54_1_local_IRQHandler_3(void)
+
+uint16_t MSS_MAC_get_type_2_ethertype(const mss_mac_instance_t *this_mac, uint32_t ethertype_no)
 {
-    g_mac0.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
+    volatile uint32_t *p_reg;
+    uint16_t temp_reg = 0U;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U == this_mac->is_emac) /* Ethertype filter not supported on eMAC */
+        {
+            p_reg = &this_mac->mac_base->SCREENING_TYPE_2_ETHERTYPE_REG_0;
+            if(ethertype_no < MSS_MAC_TYPE_2_ETHERTYPES)
+            {
+                temp_reg = (uint16_t)p_reg[ethertype_no];
+            }
+        }
+    }
+    
+    return(temp_reg);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_emac_u54_1_local_IRQHandler_4(void)
+
+void MSS_MAC_set_type_2_compare(const mss_mac_instance_t *this_mac, uint32_t comparer_no_in, const mss_mac_type_2_compare_t *comparer)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_emac0, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_emac0, 0U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    volatile uint32_t *p_reg;
+    uint32_t limit;
+    uint32_t temp_reg;
+    uint32_t comparer_no = comparer_no_in;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        if(0U != this_mac->is_emac) /* eMAC limits are different to pMAC ones */
+        {
+            p_reg = &this_mac->emac_base->TYPE2_COMPARE_0_WORD_0;
+            limit = MSS_MAC_EMAC_TYPE_2_COMPARERS;
+        }
+        else
+        {
+            p_reg = &this_mac->mac_base->TYPE2_COMPARE_0_WORD_0;
+            limit = MSS_MAC_TYPE_2_COMPARERS;
+        }
+
+        if(comparer_no < limit)
+        {
+            comparer_no *= 2U; /* Working with consecutive pairs of registers for this one */
+            if(0U != comparer->disable_mask)
+            {
+                p_reg[comparer_no] = comparer->data; /* Mask disabled so just 4 byte compare value */
+                temp_reg = GEM_DISABLE_MASK;         /* and no mask */
+            }
+            else
+            {
+                temp_reg  = comparer->data << 16;     /* 16 bit compare value and 16 bit mask */
+                temp_reg |= (uint32_t)comparer->mask;
+                p_reg[comparer_no] = temp_reg;
+                temp_reg = 0U;
+            }
+
+            if(0U != comparer->compare_vlan_c_id)
+            {
+                temp_reg |= GEM_COMPARE_VLAN_ID;
+            }
+            else if(0U != comparer->compare_vlan_s_id)
+            {
+                temp_reg |= GEM_COMPARE_VLAN_ID | GEM_COMPARE_S_TAG;
+            }
+            else
+            {
+                temp_reg |= (uint32_t)comparer->offset_value & BITS_07;
+                temp_reg |= ((uint32_t)comparer->compare_offset & BITS_02) << GEM_COMPARE_OFFSET_SHIFT;
+            }
+
+            p_reg[comparer_no + 1] = temp_reg; /* Set second word of comparer */
+        }
     }
-#endif
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_queue3_u54_1_local_IRQHandler_5(void)
+
+void MSS_MAC_get_type_2_compare(const mss_mac_instance_t *this_mac, uint32_t comparer_no_in, mss_mac_type_2_compare_t *comparer)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 3U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 3U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    volatile uint32_t *p_reg;
+    uint32_t limit;
+    uint32_t comparer_no = comparer_no_in;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
-    }
-#endif
-}
+        if(0U != this_mac->is_emac) /* eMAC limits are different to pMAC ones */
+        {
+            p_reg = &this_mac->emac_base->TYPE2_COMPARE_0_WORD_0;
+            limit = MSS_MAC_EMAC_TYPE_2_COMPARERS;
+        }
+        else
+        {
+            p_reg = &this_mac->mac_base->TYPE2_COMPARE_0_WORD_0;
+            limit = MSS_MAC_TYPE_2_COMPARERS;
+        }
 
+        (void)memset(comparer, 0, sizeof(mss_mac_type_2_compare_t));
+        if(comparer_no < limit)
+        {
+            comparer_no *= 2U; /* Working with consecutive pairs of registers for this one */
+            if(0U != (p_reg[comparer_no + 1] & GEM_DISABLE_MASK))
+            {
+                comparer->data = p_reg[comparer_no]; /* Mask disabled so just 4 byte compare value */
+                comparer->disable_mask = 1;          /* and no mask */
+            }
+            else
+            {
+                comparer->data = p_reg[comparer_no] >> 16;     /* 16 bit compare value and 16 bit mask */
+                comparer->mask = (uint16_t)p_reg[comparer_no];
+            }
 
-/******************************************************************************
- * 
- */
-void mac_queue2_u54_1_local_IRQHandler_6(void)
-{
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 2U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 2U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
-    {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+            if(0U != (p_reg[comparer_no + 1U] & GEM_COMPARE_VLAN_ID))
+            {
+                if(0U != (p_reg[comparer_no + 1U] & GEM_COMPARE_S_TAG))
+                {
+                    comparer->compare_vlan_s_id = 1U;
+                }
+                else
+                {
+                    comparer->compare_vlan_c_id = 1U;
+                }
+            }
+            else
+            {
+                comparer->compare_offset = (uint8_t)((p_reg[comparer_no + 1U] >> GEM_COMPARE_OFFSET_SHIFT) & BITS_02);
+            }
+
+            comparer->offset_value = (uint8_t)(p_reg[comparer_no + 1U] & GEM_OFFSET_VALUE);
+        }
     }
-#endif
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_queue1_u54_1_local_IRQHandler_7(void)
+
+void MSS_MAC_set_type_2_filter(const mss_mac_instance_t *this_mac, uint32_t filter_no, const mss_mac_type_2_filter_t *filter)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 1U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 1U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    volatile uint32_t *p_reg;
+    uint32_t limit;
+    uint32_t temp_reg = 0U;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        if(0U != this_mac->is_emac) /* eMAC limits are different to pMAC ones */
+        {
+            p_reg = &this_mac->emac_base->SCREENING_TYPE_2_REGISTER_0;
+            limit = MSS_MAC_EMAC_TYPE_2_SCREENERS;
+        }
+        else
+        {
+            p_reg = &this_mac->mac_base->SCREENING_TYPE_2_REGISTER_0;
+            limit = MSS_MAC_TYPE_2_SCREENERS;
+        }
+
+        if(filter_no < limit) /* Lets go build a filter... */
+        {
+            if(0u != (filter->drop_on_match))
+            {
+                temp_reg = GEM_T2_DROP_ON_MATCH;
+            }
+            else
+            {
+                temp_reg = 0U;
+            }
+
+            if(0U != (filter->compare_a_enable))
+            {
+                temp_reg |= GEM_COMPARE_A_ENABLE;
+                temp_reg |= ((uint32_t)filter->compare_a_index & BITS_05) << GEM_COMPARE_A_SHIFT;
+            }
+
+            if(0U != (filter->compare_b_enable))
+            {
+                temp_reg |= GEM_COMPARE_B_ENABLE;
+                temp_reg |= ((uint32_t)filter->compare_b_index & BITS_05) << GEM_COMPARE_B_SHIFT;
+            }
+
+            if(0U != (filter->compare_c_enable))
+            {
+                temp_reg |= GEM_COMPARE_C_ENABLE;
+                temp_reg |= ((uint32_t)filter->compare_c_index & BITS_05) << GEM_COMPARE_C_SHIFT;
+            }
+
+            if(0U != (filter->ethertype_enable))
+            {
+                temp_reg |= GEM_ETHERTYPE_ENABLE;
+                temp_reg |= ((uint32_t)filter->ethertype_index & BITS_03) << GEM_ETHERTYPE_REG_INDEX_SHIFT;
+            }
+
+            if(0U != (filter->vlan_priority_enable))
+            {
+                temp_reg |= GEM_VLAN_ENABLE;
+                temp_reg |= ((uint32_t)filter->vlan_priority & BITS_03) << GEM_VLAN_PRIORITY_SHIFT;
+            }
+
+            temp_reg |= (uint32_t)filter->queue_no & GEM_QUEUE_NUMBER;
+
+            p_reg[filter_no] = temp_reg; /* Set filter up at last */
+        }
     }
-#endif
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_int_u54_1_local_IRQHandler_8(void)
+
+void MSS_MAC_get_type_2_filter(const mss_mac_instance_t *this_mac, uint32_t filter_no, mss_mac_type_2_filter_t *filter)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 0U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    volatile uint32_t *p_reg;
+    uint32_t limit;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
-    }
-#endif
-}
+        (void)memset(filter, 0, sizeof(mss_mac_type_2_filter_t));
+        if(0U != this_mac->is_emac) /* eMAC limits are different to pMAC ones */
+        {
+            p_reg = &this_mac->emac_base->SCREENING_TYPE_2_REGISTER_0;
+            limit = MSS_MAC_EMAC_TYPE_2_SCREENERS;
+        }
+        else
+        {
+            p_reg = &this_mac->mac_base->SCREENING_TYPE_2_REGISTER_0;
+            limit = MSS_MAC_TYPE_2_SCREENERS;
+        }
+
+        if(filter_no < limit) /* Lets go fetch a filter... */
+        {
+            if(0U != (p_reg[filter_no] & GEM_T2_DROP_ON_MATCH))
+            {
+                filter->drop_on_match = 1;
+            }
 
+            if(0U != (p_reg[filter_no] & GEM_COMPARE_A_ENABLE))
+            {
+                filter->compare_a_enable = 1;
+            }
 
-/******************************************************************************
- * 
- */
-/* U54 2 */
-void mac_mmsl_u54_2_local_IRQHandler_3(void)
-{
-    g_mac0.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
-}
+            if(0U != (p_reg[filter_no] & GEM_COMPARE_B_ENABLE))
+            {
+                filter->compare_b_enable = 1;
+            }
 
+            if(0U != (p_reg[filter_no] & GEM_COMPARE_C_ENABLE))
+            {
+                filter->compare_c_enable = 1;
+            }
 
-/******************************************************************************
- * 
- */
-void mac_emac_u54_2_local_IRQHandler_4(void)
-{
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_emac0, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_emac0, 0U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
-    {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+            if(0U != (p_reg[filter_no] & GEM_ETHERTYPE_ENABLE))
+            {
+                filter->ethertype_enable = 1;
+            }
+
+            if(0U != (p_reg[filter_no] & GEM_VLAN_ENABLE))
+            {
+                filter->vlan_priority_enable = 1;
+            }
+
+            filter->compare_a_index = (uint8_t)((p_reg[filter_no] & GEM_COMPARE_A) >> GEM_COMPARE_A_SHIFT);
+            filter->compare_b_index = (uint8_t)((p_reg[filter_no] & GEM_COMPARE_B) >> GEM_COMPARE_B_SHIFT);
+            filter->compare_c_index = (uint8_t)((p_reg[filter_no] & GEM_COMPARE_C) >> GEM_COMPARE_C_SHIFT);
+            filter->ethertype_index = (uint8_t)((p_reg[filter_no] & GEM_ETHERTYPE_REG_INDEX) >> GEM_ETHERTYPE_REG_INDEX_SHIFT);
+            filter->vlan_priority   = (uint8_t)((p_reg[filter_no] & GEM_VLAN_PRIORITY) >> GEM_VLAN_PRIORITY_SHIFT);
+            filter->queue_no        = (uint8_t)(p_reg[filter_no] & GEM_QUEUE_NUMBER);
+        }
     }
-#endif
 }
 
 
+#if defined(MSS_MAC_FLOW_STEERING)
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_queue3_u54_2_local_IRQHandler_5(void)
+
+uint32_t MSS_MAC_flow_hash(const mss_mac_flow_t *flow)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 3U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 3U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
-    {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
-    }
-#endif
+    uint32_t hash;
+
+    /*
+     * Simple multiply and xor mix of the 5-tuple. This only has to spread
+     * flows evenly across the indirection table and be cheap enough to
+     * calculate for every packet a stack handles.
+     */
+    hash  = flow->src_ip * 0x9E3779B1U;
+    hash ^= flow->dst_ip;
+    hash *= 0x85EBCA77U;
+    hash ^= ((uint32_t)flow->src_port << 16) | (uint32_t)flow->dst_port;
+    hash *= 0xC2B2AE3DU;
+    hash ^= (uint32_t)flow->protocol;
+    hash ^= hash >> 16;
+
+    return(hash);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_queue2_u54_2_local_IRQHandler_6(void)
+
+uint32_t MSS_MAC_flow_to_queue(const mss_mac_instance_t *this_mac, const mss_mac_flow_t *flow)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 2U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 2U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
-    {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
-    }
-#endif
+    return((uint32_t)this_mac->flow_table[MSS_MAC_flow_hash(flow) & (MSS_MAC_FLOW_TABLE_SIZE - 1U)]);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_queue1_u54_2_local_IRQHandler_7(void)
+
+uint8_t MSS_MAC_set_flow_table(mss_mac_instance_t *this_mac, const uint8_t *table)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 1U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 1U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    uint32_t index;
+    uint32_t limit;
+    uint8_t ret_val = MSS_MAC_SUCCESS;
+
+    if(0U != this_mac->is_emac)
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        limit = 1U;
+    }
+    else
+    {
+        limit = (uint32_t)MSS_MAC_QUEUE_COUNT;
     }
-#endif
-}
-
 
-/******************************************************************************
- * 
- */
-void mac_int_u54_2_local_IRQHandler_8(void)
-{
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac0, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac0, 0U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    for(index = 0U; index < MSS_MAC_FLOW_TABLE_SIZE; index++)
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        if((uint32_t)table[index] >= limit)
+        {
+            ret_val = MSS_MAC_FAILED;
+        }
     }
-#endif
-}
 
+    if(MSS_MAC_SUCCESS == ret_val)
+    {
+        (void)memcpy(this_mac->flow_table, table, MSS_MAC_FLOW_TABLE_SIZE);
+    }
 
-/******************************************************************************
- * 
- */
-/* U54 3 */
-void mac_mmsl_u54_3_local_IRQHandler_3(void)
-{
-    g_mac1.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
+    return(ret_val);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_emac_u54_3_local_IRQHandler_4(void)
+
+int32_t MSS_MAC_steer_flow(mss_mac_instance_t *this_mac, const mss_mac_flow_t *flow, uint32_t queue_no)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_emac1, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_emac1, 0U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    mss_mac_type_1_filter_t filter1;
+    mss_mac_type_2_filter_t filter2;
+    mss_mac_type_2_compare_t compares[3];
+    uint32_t compare_count = 0U;
+    uint32_t filter_no;
+    uint32_t target_queue = queue_no;
+    int32_t flow_id = MSS_MAC_FLOW_INVALID;
+
+    if(MSS_MAC_FLOW_QUEUE_AUTO == target_queue)
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        target_queue = MSS_MAC_flow_to_queue(this_mac, flow);
     }
-#endif
-}
-
 
-/******************************************************************************
- * 
- */
-void mac_queue3_u54_3_local_IRQHandler_5(void)
-{
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 3U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 3U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (0U == this_mac->is_emac) &&
+       (target_queue < (uint32_t)MSS_MAC_QUEUE_COUNT))
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
-    }
-#endif
-}
+        /* UDP destination port only flows fit in a Type 1 screener */
+        if((17U == flow->protocol) && (0U != flow->dst_port) && (0U == flow->dst_ip))
+        {
+            filter_no = flow_alloc(&this_mac->flow_t1_used, MSS_MAC_TYPE_1_SCREENERS);
+            if(INVALID_INDEX != filter_no)
+            {
+                (void)memset(&filter1, 0, sizeof(filter1));
+                filter1.udp_port        = flow->dst_port;
+                filter1.udp_port_enable = 1U;
+                filter1.queue_no        = (uint8_t)target_queue;
+                MSS_MAC_set_type_1_filter(this_mac, filter_no, &filter1);
 
+                flow_id = (int32_t)filter_no;
+            }
+        }
 
-/******************************************************************************
- * 
- */
-void mac_queue2_u54_3_local_IRQHandler_6(void)
-{
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 2U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 2U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
-    {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        /* Everything else, or UDP when the Type 1 screeners are all used */
+        if(MSS_MAC_FLOW_INVALID == flow_id)
+        {
+            (void)memset(compares, 0, sizeof(compares));
+            if(0U != flow->protocol)
+            {
+                compares[compare_count].compare_offset = MSS_MAC_T2_OFFSET_IP;
+                compares[compare_count].data           = (uint32_t)flow->protocol; /* b0-b7 is the byte at the offset */
+                compares[compare_count].mask           = 0x00FFU;
+                compares[compare_count].offset_value   = 9U; /* IPv4 protocol field */
+                compare_count++;
+            }
+
+            if(0U != flow->dst_ip)
+            {
+                compares[compare_count].compare_offset = MSS_MAC_T2_OFFSET_IP;
+                compares[compare_count].data           = ((flow->dst_ip >> 24) & BITS_08) | ((flow->dst_ip >> 8) & 0x0000FF00U) |
+                                                         ((flow->dst_ip << 8) & 0x00FF0000U) | (flow->dst_ip << 24);
+                compares[compare_count].disable_mask   = 1U;
+                compares[compare_count].offset_value   = 16U; /* IPv4 destination address */
+                compare_count++;
+            }
+
+            if(0U != flow->dst_port)
+            {
+                compares[compare_count].compare_offset = MSS_MAC_T2_OFFSET_TCP_UDP;
+                compares[compare_count].data           = ((uint32_t)flow->dst_port >> 8) | (((uint32_t)flow->dst_port & BITS_08) << 8);
+                compares[compare_count].mask           = 0xFFFFU;
+                compares[compare_count].offset_value   = 2U; /* TCP/UDP destination port */
+                compare_count++;
+            }
+
+            (void)memset(&filter2, 0, sizeof(filter2));
+            filter2.queue_no = (uint8_t)target_queue;
+            flow_id = flow_type_2(this_mac, &filter2, 0x0800U, compares, compare_count);
+        }
     }
-#endif
+
+    return(flow_id);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_queue1_u54_3_local_IRQHandler_7(void)
+
+int32_t MSS_MAC_classify(mss_mac_instance_t *this_mac, const mss_mac_class_t *rule, uint32_t queue_no)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 1U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 1U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    mss_mac_type_1_filter_t filter1;
+    mss_mac_type_2_filter_t filter2;
+    mss_mac_type_2_compare_t compares[3];
+    uint32_t compare_count = 0U;
+    uint32_t filter_no;
+    uint32_t ethertype = 0U;
+    uint32_t valid = 1U;
+    int32_t flow_id = MSS_MAC_FLOW_INVALID;
+
+    if(0U != (rule->match & MSS_MAC_CLASS_ETHERTYPE))
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        ethertype = (uint32_t)rule->ethertype;
     }
-#endif
-}
 
+    /* The DSCP and UDP port are found through the IPv4 header */
+    if(0U != (rule->match & (MSS_MAC_CLASS_DSCP | MSS_MAC_CLASS_UDP_PORT)))
+    {
+        if((0U != ethertype) && (0x0800U != ethertype))
+        {
+            valid = 0U;
+        }
+
+        ethertype = 0x0800U;
+    }
 
-/******************************************************************************
- * 
- */
-void mac_int_u54_3_local_IRQHandler_8(void)
-{
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 0U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    if((0U == rule->match) || (0U != (rule->match & ~MSS_MAC_CLASS_ALL)) ||
+       ((0U != (rule->match & MSS_MAC_CLASS_ETHERTYPE)) && (0U == rule->ethertype)) ||
+       ((0U != (rule->match & MSS_MAC_CLASS_VLAN_PCP)) && (rule->vlan_pcp > 7U)) ||
+       ((0U != (rule->match & MSS_MAC_CLASS_DSCP)) && (rule->dscp > 63U)))
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        valid = 0U;
     }
-#endif
-}
 
+    if((0U != valid) && (MSS_MAC_AVAILABLE == this_mac->mac_available) &&
+       (0U == this_mac->is_emac) && (queue_no < (uint32_t)MSS_MAC_QUEUE_COUNT))
+    {
+        /* A UDP port on its own fits in a Type 1 screener */
+        if((0U == (rule->match & ~(MSS_MAC_CLASS_UDP_PORT | MSS_MAC_CLASS_ETHERTYPE))) &&
+           (0U != (rule->match & MSS_MAC_CLASS_UDP_PORT)))
+        {
+            filter_no = flow_alloc(&this_mac->flow_t1_used, MSS_MAC_TYPE_1_SCREENERS);
+            if(INVALID_INDEX != filter_no)
+            {
+                (void)memset(&filter1, 0, sizeof(filter1));
+                filter1.udp_port        = rule->udp_port;
+                filter1.udp_port_enable = 1U;
+                filter1.drop_on_match   = (uint8_t)((0U != rule->drop) ? 1U : 0U);
+                filter1.queue_no        = (uint8_t)queue_no;
+                MSS_MAC_set_type_1_filter(this_mac, filter_no, &filter1);
 
-/******************************************************************************
- * 
- */
-/* U54 4 */
-void mac_mmsl_u54_4_local_IRQHandler_3(void)
-{
-    g_mac1.mac_base->MMSL_INT_DISABLE = 0x3F; /* Acknowledge ints */
-}
+                flow_id = (int32_t)filter_no;
+            }
+        }
 
+        if(MSS_MAC_FLOW_INVALID == flow_id)
+        {
+            (void)memset(compares, 0, sizeof(compares));
+            if(0U != (rule->match & MSS_MAC_CLASS_DSCP))
+            {
+                /* Top 6 bits of the second byte, the ECN bits are ignored */
+                compares[compare_count].compare_offset = MSS_MAC_T2_OFFSET_IP;
+                compares[compare_count].data           = (uint32_t)rule->dscp << 10;
+                compares[compare_count].mask           = 0xFC00U;
+                compares[compare_count].offset_value   = 0U;
+                compare_count++;
+            }
 
-/******************************************************************************
- * 
- */
-void mac_emac_u54_4_local_IRQHandler_4(void)
-{
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_emac1, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_emac1, 0U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
-    {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+            if(0U != (rule->match & MSS_MAC_CLASS_UDP_PORT))
+            {
+                compares[compare_count].compare_offset = MSS_MAC_T2_OFFSET_IP;
+                compares[compare_count].data           = 17U;
+                compares[compare_count].mask           = 0x00FFU;
+                compares[compare_count].offset_value   = 9U; /* IPv4 protocol field */
+                compare_count++;
+
+                compares[compare_count].compare_offset = MSS_MAC_T2_OFFSET_TCP_UDP;
+                compares[compare_count].data           = ((uint32_t)rule->udp_port >> 8) | (((uint32_t)rule->udp_port & BITS_08) << 8);
+                compares[compare_count].mask           = 0xFFFFU;
+                compares[compare_count].offset_value   = 2U; /* UDP destination port */
+                compare_count++;
+            }
+
+            (void)memset(&filter2, 0, sizeof(filter2));
+            if(0U != (rule->match & MSS_MAC_CLASS_VLAN_PCP))
+            {
+                filter2.vlan_priority_enable = 1U;
+                filter2.vlan_priority        = rule->vlan_pcp;
+            }
+
+            filter2.drop_on_match = (uint8_t)((0U != rule->drop) ? 1U : 0U);
+            filter2.queue_no      = (uint8_t)queue_no;
+            flow_id = flow_type_2(this_mac, &filter2, ethertype, compares, compare_count);
+        }
     }
-#endif
+
+    return(flow_id);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_queue3_u54_4_local_IRQHandler_5(void)
+
+void MSS_MAC_get_screener_usage(const mss_mac_instance_t *this_mac, mss_mac_screener_usage_t *usage)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 3U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 3U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    uint32_t index;
+
+    (void)memset(usage, 0, sizeof(mss_mac_screener_usage_t));
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (0U == this_mac->is_emac))
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        for(index = 0U; index < MSS_MAC_TYPE_1_SCREENERS; index++)
+        {
+            if(0U == (this_mac->flow_t1_used & ((uint32_t)1U << index)))
+            {
+                usage->type_1_free++;
+            }
+        }
+
+        for(index = 0U; index < MSS_MAC_TYPE_2_SCREENERS; index++)
+        {
+            if(0U == (this_mac->flow_t2_used & ((uint32_t)1U << index)))
+            {
+                usage->type_2_free++;
+            }
+        }
+
+        for(index = 0U; index < MSS_MAC_TYPE_2_COMPARERS; index++)
+        {
+            if(0U == (this_mac->flow_compare_used & ((uint32_t)1U << index)))
+            {
+                usage->comparers_free++;
+            }
+        }
+
+        for(index = 0U; index < MSS_MAC_TYPE_2_ETHERTYPES; index++)
+        {
+            if(0U == this_mac->flow_ethertype_refs[index])
+            {
+                usage->ethertypes_free++;
+            }
+        }
     }
-#endif
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_queue2_u54_4_local_IRQHandler_6(void)
+
+void MSS_MAC_clear_flow(mss_mac_instance_t *this_mac, int32_t flow_id)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 2U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 2U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    mss_mac_type_1_filter_t filter1;
+    mss_mac_type_2_filter_t filter2;
+    uint32_t filter_no;
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (0U == this_mac->is_emac))
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        if((flow_id >= 0) && (flow_id < (int32_t)MSS_MAC_TYPE_1_SCREENERS))
+        {
+            filter_no = (uint32_t)flow_id;
+            if(0U != (this_mac->flow_t1_used & ((uint32_t)1U << filter_no)))
+            {
+                (void)memset(&filter1, 0, sizeof(filter1));
+                MSS_MAC_set_type_1_filter(this_mac, filter_no, &filter1);
+                this_mac->flow_t1_used &= ~((uint32_t)1U << filter_no);
+            }
+        }
+        else if((flow_id >= MSS_MAC_FLOW_TYPE_2_BASE) &&
+                (flow_id < (MSS_MAC_FLOW_TYPE_2_BASE + (int32_t)MSS_MAC_TYPE_2_SCREENERS)))
+        {
+            filter_no = (uint32_t)(flow_id - MSS_MAC_FLOW_TYPE_2_BASE);
+            if(0U != (this_mac->flow_t2_used & ((uint32_t)1U << filter_no)))
+            {
+                (void)memset(&filter2, 0, sizeof(filter2));
+                MSS_MAC_set_type_2_filter(this_mac, filter_no, &filter2);
+                flow_release(this_mac, filter_no);
+            }
+        }
+        else
+        {
+            /* Not a flow ID we handed out so nothing to do */
+        }
     }
-#endif
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_queue1_u54_4_local_IRQHandler_7(void)
+
+uint8_t MSS_MAC_set_queue_hart(mss_mac_instance_t *this_mac, uint32_t queue_no, uint32_t hart_id)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 1U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 1U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    volatile uint32_t *p_enables;
+    uint32_t irq;
+    uint32_t irq_bit;
+    uint32_t hart;
+    uint32_t limit;
+    uint32_t enabled = 0U;
+    uint8_t ret_val = MSS_MAC_FAILED;
+
+    if(0U != this_mac->is_emac)
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        limit = 1U;
     }
-#endif
+    else
+    {
+        limit = (uint32_t)MSS_MAC_QUEUE_COUNT;
+    }
+
+    /* Local interrupts are hard wired to particular harts so can't be moved */
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (0U == this_mac->use_local_ints) &&
+       (queue_no < limit) && (NULL_POINTER != plic_hart_enables(hart_id)))
+    {
+        irq     = (uint32_t)this_mac->mac_q_int[queue_no];
+        irq_bit = (uint32_t)1U << (irq % 32U);
+
+        for(hart = 0U; hart < 5U; hart++)
+        {
+            p_enables = plic_hart_enables(hart);
+            if(0U != (p_enables[irq / 32U] & irq_bit))
+            {
+                enabled = 1U;
+            }
+
+            p_enables[irq / 32U] &= ~irq_bit;
+        }
+
+        if(0U != enabled)
+        {
+            p_enables = plic_hart_enables(hart_id);
+            p_enables[irq / 32U] |= irq_bit;
+        }
+
+        this_mac->queue_hart[queue_no] = hart_id;
+        ret_val = MSS_MAC_SUCCESS;
+    }
+
+    return(ret_val);
 }
 
 
 /******************************************************************************
- * 
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-void mac_int_u54_4_local_IRQHandler_8(void)
+
+uint8_t MSS_MAC_set_queue_priority(const mss_mac_instance_t *this_mac, uint32_t queue_no, uint32_t priority)
 {
-#if defined(USING_FREERTOS)
-    uxCriticalNesting++;
-    generic_mac_irq_handler(&g_mac1, 0U);
-    uxCriticalNesting--;
-#else
-    generic_mac_irq_handler(&g_mac1, 0U);
-#endif
-#if defined(USING_LWIP)
-    if(0 != g_mac_context_switch)
+    uint32_t limit;
+    uint8_t ret_val = MSS_MAC_FAILED;
+
+    if(0U != this_mac->is_emac)
     {
-        g_mac_context_switch = 0;
-        vPortYieldISR();
+        limit = 1U;
+    }
+    else
+    {
+        limit = (uint32_t)MSS_MAC_QUEUE_COUNT;
     }
-#endif
-}
 
-#endif
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (0U == this_mac->use_local_ints) &&
+       (queue_no < limit) && (priority <= 7U))
+    {
+        PLIC_SetPriority(this_mac->mac_q_int[queue_no], priority);
+        ret_val = MSS_MAC_SUCCESS;
+    }
 
+    return(ret_val);
+}
 
-/* Define the following if your GEM is configured to clear on read for int flags
- * In this case you should not write to the int status reg ... */
-/* #define GEM_FLAGS_CLR_ON_RD */
 
-static void generic_mac_irq_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
+/******************************************************************************
+ * Set up the flow steering state for a MAC. The indirection table cycles
+ * through the available queues and no screeners are allocated.
+ */
+static void flow_init(mss_mac_instance_t *this_mac)
 {
-    volatile uint32_t int_pending;  /* We read and hold a working copy as many
-                                     * of the bits can be clear on read if
-                                     * the GEM is configured that way... */
-    uint32_t volatile *rx_status;   /* Address of receive status register */
-    uint32_t volatile *tx_status;   /* Address of transmit status register */
-    uint32_t volatile *int_status;  /* Address of interrupt status register */
-    mss_mac_queue_t *p_queue;
-
-    p_queue = &this_mac->queue[queue_no];
-    
-    p_queue->in_isr = 1U;
-    int_status  = p_queue->int_status;
-    int_pending =  *int_status;
+    uint32_t index;
+    uint32_t limit;
 
     if(0U != this_mac->is_emac)
     {
-        rx_status   = &this_mac->emac_base->RECEIVE_STATUS;
-        tx_status   = &this_mac->emac_base->TRANSMIT_STATUS;
+        limit = 1U;
     }
     else
     {
-        rx_status   = &this_mac->mac_base->RECEIVE_STATUS;
-        tx_status   = &this_mac->mac_base->TRANSMIT_STATUS;
+        limit = (uint32_t)MSS_MAC_QUEUE_COUNT;
     }
-    
-    /*
-     * Note, in the following code we generally clear any flags first and then
-     * handle the condition as this allows any new events which occur in the
-     * course of the ISR to be picked up later.
-     */
 
-    /*
-     * Packet received interrupt - first in line as most time critical. Followed
-     * by transmit interrupt and then the less frequent ones.
-     */
-    if((int_pending & GEM_RECEIVE_COMPLETE) != 0U)
+    for(index = 0U; index < MSS_MAC_FLOW_TABLE_SIZE; index++)
     {
-       *rx_status = GEM_FRAME_RECEIVED;
-#if !defined(GEM_FLAGS_CLR_ON_RD)
-#if defined(TARGET_ALOE)
-        *int_status = (uint32_t)3U; /* PMCS: Should be 2 but that does not work on Aloe... */
-#else
-        *int_status = (uint32_t)2U;
-#endif
-        rxpkt_handler(this_mac, queue_no);
-        p_queue->overflow_counter = 0U; /* Reset counter as we have received something */
-#endif
+        this_mac->flow_table[index] = (uint8_t)(index % limit);
     }
 
-    /* Transmit packet sent interrupt */
-    if((int_pending & GEM_TRANSMIT_COMPLETE) != 0U)
+    this_mac->flow_t1_used         = 0U;
+    this_mac->flow_t2_used         = 0U;
+    this_mac->flow_compare_used    = 0U;
+    (void)memset(this_mac->flow_t2_compares, 0, sizeof(this_mac->flow_t2_compares));
+    (void)memset(this_mac->flow_ethertype_refs, 0, sizeof(this_mac->flow_ethertype_refs));
+    (void)memset(this_mac->flow_ethertypes, 0, sizeof(this_mac->flow_ethertypes));
+
+    for(index = 0U; index < MSS_MAC_TYPE_2_SCREENERS; index++)
     {
-        if((*tx_status & GEM_STAT_TRANSMIT_COMPLETE) != 0U) /* If loopback test or other hasn't taken care of this... */
-        {
-            *tx_status  = GEM_STAT_TRANSMIT_COMPLETE;
-            *int_status = GEM_TRANSMIT_COMPLETE;
-#if !defined(GEM_FLAGS_CLR_ON_RD)
-#endif
-            txpkt_handler(this_mac, queue_no);
-        }
+        this_mac->flow_t2_ethertype[index] = INVALID_INDEX;
     }
 
-    /*
-     * RX and TX are the majority cases so see if all done rather than testing
-     * remaining one by one. Move on to one by one testing if not finished. Cuts
-     * down on interrupt processing impact for 'normal' case...
-     */
-    if((int_pending & ~(GEM_RECEIVE_COMPLETE | GEM_TRANSMIT_COMPLETE)) != 0U)
+    for(index = 0U; index < (uint32_t)MSS_MAC_QUEUE_COUNT; index++)
     {
-        if((int_pending & GEM_RECEIVE_OVERRUN_INT) != 0U)
-        {
-            *rx_status = GEM_RECEIVE_OVERRUN;
-#if !defined(GEM_FLAGS_CLR_ON_RD)
-            *int_status = GEM_RECEIVE_OVERRUN_INT;
-#endif
-            p_queue->overflow_counter++;
-            p_queue->rx_overflow++;
-        }
+        this_mac->queue_hart[index] = (uint32_t)read_csr(mhartid);
+    }
+}
 
-        if((int_pending & GEM_RX_USED_BIT_READ) != 0U)
+
+/******************************************************************************
+ * Allocate the highest numbered free entry from a bit map of limit entries.
+ * Returns INVALID_INDEX if they are all in use.
+ */
+static uint32_t flow_alloc(uint32_t *p_used, uint32_t limit)
+{
+    uint32_t index = limit;
+    uint32_t ret_val = INVALID_INDEX;
+
+    while((INVALID_INDEX == ret_val) && (0U != index))
+    {
+        index--;
+        if(0U == (*p_used & ((uint32_t)1U << index)))
         {
-            *rx_status = GEM_BUFFER_NOT_AVAILABLE;
-    #if !defined(GEM_FLAGS_CLR_ON_RD)
-            *int_status = GEM_RX_USED_BIT_READ;
-    #endif
-            rxpkt_handler(this_mac, queue_no);
-            p_queue->rx_overflow++;
-            p_queue->overflow_counter++;
+            *p_used |= (uint32_t)1U << index;
+            ret_val = index;
         }
+    }
 
-        if((int_pending & GEM_RESP_NOT_OK_INT) != 0U) /* Hope this is transient and restart rx... */
-        {
-            *rx_status = GEM_RX_RESP_NOT_OK; /* One of them did it... */
-            *tx_status = GEM_TX_RESP_NOT_OK;
-    #if !defined(GEM_FLAGS_CLR_ON_RD)
-            *int_status = GEM_RESP_NOT_OK_INT;
-    #endif
-            if(0U != this_mac->is_emac)
-            {
-                this_mac->emac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
-            }
-            else
-            {
-                this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
-            }
+    return(ret_val);
+}
 
-            p_queue->hresp_error++;
-        }
 
-    /*
-     * This may cause more problems than it cures so disabling for now until we
-     * figure out a better strategy...
-     */
-    #if 0
-        if(p_queue->overflow_counter > 4U) /* looks like we are stuck in a rut here... */
-        {
-            uint32_t descriptor;
-            /* Restart receive operation from scratch */
-            p_queue->overflow_counter = 0U;
-            p_queue->rx_restart++;
+/******************************************************************************
+ * Allocate and program a Type 2 comparer for a flow steering screener and note
+ * it against the screener so it can be released later.
+ */
+static uint32_t flow_compare(mss_mac_instance_t *this_mac, uint32_t filter_no, const mss_mac_type_2_compare_t *comparer)
+{
+    uint32_t comparer_no;
 
-            if(0U != this_mac->is_emac)
-            {
-                this_mac->emac_base->NETWORK_CONTROL &= ~GEM_ENABLE_RECEIVE;
-            }
-            else
-            {
-                this_mac->mac_base->NETWORK_CONTROL &= ~GEM_ENABLE_RECEIVE;
-            }
+    comparer_no = flow_alloc(&this_mac->flow_compare_used, MSS_MAC_TYPE_2_COMPARERS);
+    if(INVALID_INDEX != comparer_no)
+    {
+        MSS_MAC_set_type_2_compare(this_mac, comparer_no, comparer);
+        this_mac->flow_t2_compares[filter_no] |= (uint32_t)1U << comparer_no;
+    }
+
+    return(comparer_no);
+}
 
-            p_queue->nb_available_rx_desc = MSS_MAC_RX_RING_SIZE;
-            p_queue->next_free_rx_desc_index = 0U;
-            p_queue->first_rx_desc_index = 0U;
 
-            for(descriptor = 0U; descriptor < MSS_MAC_RX_RING_SIZE; descriptor++) /* Discard everything */
+/******************************************************************************
+ * Allocate a Type 2 screener along with its comparers and Ethertype register
+ * and program them. filter holds the queue, drop and VLAN priority settings
+ * and ethertype is 0 if the Ethertype is not to be matched. Returns the flow
+ * ID or MSS_MAC_FLOW_INVALID if any of the resources could not be had, in
+ * which case nothing is left allocated.
+ */
+static int32_t flow_type_2(mss_mac_instance_t *this_mac, mss_mac_type_2_filter_t *filter,
+                           uint32_t ethertype, const mss_mac_type_2_compare_t *compares,
+                           uint32_t compare_count)
+{
+    uint32_t comparer_no[3];
+    uint32_t filter_no;
+    uint32_t index;
+    uint32_t failed = 0U;
+    int32_t flow_id = MSS_MAC_FLOW_INVALID;
+
+    filter_no = flow_alloc(&this_mac->flow_t2_used, MSS_MAC_TYPE_2_SCREENERS);
+    if(INVALID_INDEX != filter_no)
+    {
+        this_mac->flow_t2_compares[filter_no]  = 0U;
+        this_mac->flow_t2_ethertype[filter_no] = INVALID_INDEX;
+
+        for(index = 0U; index < compare_count; index++)
+        {
+            comparer_no[index] = flow_compare(this_mac, filter_no, &compares[index]);
+            if(INVALID_INDEX == comparer_no[index])
             {
-                p_queue->rx_desc_tab[descriptor].addr_low &= ~GEM_RX_DMA_USED;
+                failed = 1U;
             }
+        }
 
-            if(0U != this_mac->is_emac)
+        if((0U == failed) && (0U != ethertype))
+        {
+            this_mac->flow_t2_ethertype[filter_no] = flow_ethertype(this_mac, ethertype);
+            if(INVALID_INDEX == this_mac->flow_t2_ethertype[filter_no])
             {
-                this_mac->emac_base->RECEIVE_Q_PTR = (uint32_t)((uint64_t)p_queue->rx_desc_tab);
-    #if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
-                this_mac->emac_base->UPPER_RX_Q_BASE_ADDR = (uint32_t)((uint64_t)p_queue->rx_desc_tab >> 32);
-    #endif
-                this_mac->emac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
+                failed = 1U;
             }
             else
             {
-                this_mac->mac_base->RECEIVE_Q_PTR = (uint32_t)((uint64_t)p_queue->rx_desc_tab);
-    #if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
-                this_mac->mac_base->UPPER_RX_Q_BASE_ADDR = (uint32_t)((uint64_t)p_queue->rx_desc_tab >> 32);
-    #endif
-                this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
+                filter->ethertype_enable = 1U;
+                filter->ethertype_index  = (uint8_t)this_mac->flow_t2_ethertype[filter_no];
             }
         }
-    #endif
-        if((int_pending & GEM_PAUSE_FRAME_TRANSMITTED) != 0U)
-        {
-            *int_status = GEM_PAUSE_FRAME_TRANSMITTED;
-            this_mac->tx_pause++;
-        }
-        if((int_pending & GEM_PAUSE_TIME_ELAPSED) != 0U)
+
+        if(0U != failed) /* Give back anything we got and bail out */
         {
-            *int_status = GEM_PAUSE_TIME_ELAPSED;
-            this_mac->pause_elapsed++;
+            flow_release(this_mac, filter_no);
         }
-        if((int_pending & GEM_PAUSE_FRAME_WITH_NON_0_PAUSE_QUANTUM_RX) != 0U)
+        else
         {
-            *int_status = GEM_PAUSE_FRAME_WITH_NON_0_PAUSE_QUANTUM_RX;
-            this_mac->rx_pause++;
-        }
+            if(compare_count > 0U)
+            {
+                filter->compare_a_enable = 1U;
+                filter->compare_a_index  = (uint8_t)comparer_no[0];
+            }
 
-        /* Mask off checked ints and see if any left pending */
-        int_pending &= ~(GEM_RECEIVE_OVERRUN_INT | GEM_RX_USED_BIT_READ | GEM_RECEIVE_COMPLETE |
-                         GEM_TRANSMIT_COMPLETE | GEM_RESP_NOT_OK_INT | GEM_PAUSE_FRAME_TRANSMITTED |
-                         GEM_PAUSE_TIME_ELAPSED | GEM_PAUSE_FRAME_WITH_NON_0_PAUSE_QUANTUM_RX);
-        if(0U != int_pending)
-        {
-            if((int_pending & GEM_AMBA_ERROR) != 0U)
+            if(compare_count > 1U)
             {
-                /* *int_status = (uint32_t)0x60U; */ /* Should be 0x40 but that doesn't clear it... */
-                *int_status = (uint32_t)0x40U;
-                *tx_status  = GEM_STAT_AMBA_ERROR;
-                *rx_status  = GEM_AMBA_ERROR;
-                p_queue->tx_amba_errors++;
-                p_queue->nb_available_tx_desc = MSS_MAC_TX_RING_SIZE;
+                filter->compare_b_enable = 1U;
+                filter->compare_b_index  = (uint8_t)comparer_no[1];
             }
-            else
+
+            if(compare_count > 2U)
             {
-                volatile int32_t index;
-                ASSERT(0); /* Need to think about how to deal with this... */
-                while(1)
-                {
-                    index++;
-                }
+                filter->compare_c_enable = 1U;
+                filter->compare_c_index  = (uint8_t)comparer_no[2];
             }
+
+            MSS_MAC_set_type_2_filter(this_mac, filter_no, filter);
+
+            flow_id = MSS_MAC_FLOW_TYPE_2_BASE + (int32_t)filter_no;
         }
     }
-    p_queue->in_isr = 0U;
+
+    return(flow_id);
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Find the Ethertype register already set to ethertype, or allocate and
+ * program a free one, and take a reference on it. Returns INVALID_INDEX if
+ * there is no match and no free register.
  */
-void MSS_MAC_set_tx_callback
-(
-    mss_mac_instance_t *this_mac,
-    uint32_t queue_no,
-    mss_mac_transmit_callback_t tx_complete_handler
-)
+static uint32_t flow_ethertype(mss_mac_instance_t *this_mac, uint32_t ethertype)
 {
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    uint32_t index;
+    uint32_t ret_val = INVALID_INDEX;
+
+    for(index = 0U; (INVALID_INDEX == ret_val) && (index < MSS_MAC_TYPE_2_ETHERTYPES); index++)
     {
-        this_mac->queue[queue_no].pckt_tx_callback = tx_complete_handler;
+        if((0U != this_mac->flow_ethertype_refs[index]) &&
+           (ethertype == (uint32_t)this_mac->flow_ethertypes[index]))
+        {
+            ret_val = index;
+        }
     }
-}
 
+    index = MSS_MAC_TYPE_2_ETHERTYPES;
+    while((INVALID_INDEX == ret_val) && (0U != index))
+    {
+        index--;
+        if(0U == this_mac->flow_ethertype_refs[index])
+        {
+            this_mac->flow_ethertypes[index] = (uint16_t)ethertype;
+            MSS_MAC_set_type_2_ethertype(this_mac, index, (uint16_t)ethertype);
+            ret_val = index;
+        }
+    }
 
-/******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
- */
-void MSS_MAC_set_rx_callback
-(
-    mss_mac_instance_t *this_mac,
-    uint32_t queue_no,
-    mss_mac_receive_callback_t rx_callback
-)
-{
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    if(INVALID_INDEX != ret_val)
     {
-        this_mac->queue[queue_no].pckt_rx_callback = rx_callback;
+        this_mac->flow_ethertype_refs[ret_val]++;
     }
+
+    return(ret_val);
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Release a Type 2 screener and the comparers and Ethertype register
+ * reference allocated with it. The screener itself must already be disabled
+ * or never have been programmed.
  */
-void MSS_MAC_change_speed
-(
-    mss_mac_instance_t *this_mac, uint32_t speed_duplex_select, mss_mac_speed_mode_t speed_mode
-)
+static void flow_release(mss_mac_instance_t *this_mac, uint32_t filter_no)
 {
-    uint32_t temp_cr;
+    uint32_t ethertype_no = this_mac->flow_t2_ethertype[filter_no];
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    if((INVALID_INDEX != ethertype_no) && (0U != this_mac->flow_ethertype_refs[ethertype_no]))
     {
-        /* Only change HW settings if there is a change in status */
-        if((this_mac->speed_duplex_select |= speed_duplex_select) || (this_mac->speed_mode != speed_mode))
-        {
-            this_mac->speed_duplex_select = speed_duplex_select;
-            this_mac->speed_mode = speed_mode;
-
-            /* Apply settings to the PHY */
-            this_mac->phy_set_link_speed(this_mac, this_mac->speed_duplex_select, speed_mode);
-            this_mac->phy_autonegotiate(this_mac); /* Do this in case it is needed */
-            if(MSS_MAC_SPEED_AN == speed_mode) /* Apply results of AN to MAC */
-            {
-                update_mac_cfg(this_mac);
-            }
-            else
-            {
-                if(0U != this_mac->is_emac)
-                {
-                    temp_cr = this_mac->emac_base->NETWORK_CONFIG;
-                }
-                else
-                {
-                    temp_cr = this_mac->mac_base->NETWORK_CONFIG;
-                }
-
-                temp_cr &= ~(GEM_GIGABIT_MODE_ENABLE | GEM_SPEED | GEM_FULL_DUPLEX);
-
-                if((MSS_MAC_1000_HDX == this_mac->speed_mode) || (MSS_MAC_1000_FDX == this_mac->speed_mode))
-                {
-    #if defined(TARGET_ALOE)
-                    *GEMGXL_tx_clk_sel = (uint32_t)0U;
-                    *GEMGXL_speed_mode = (uint32_t)2U;
-    #endif
-                    temp_cr |= GEM_GIGABIT_MODE_ENABLE;
-                }
-                else
-                {
-                    if((MSS_MAC_100_HDX == this_mac->speed_mode) || (MSS_MAC_100_FDX == this_mac->speed_mode))
-                    {
-    #if defined(TARGET_ALOE)
-                    *GEMGXL_tx_clk_sel = (uint32_t)1U;
-                    *GEMGXL_speed_mode = (uint32_t)1U;
-    #endif
-                    temp_cr |= (uint32_t)GEM_SPEED;
-                    }
-    #if defined(TARGET_ALOE)
-                    else
-                    {
-                        *GEMGXL_tx_clk_sel = (uint32_t)1U;
-                        *GEMGXL_speed_mode = (uint32_t)0U;
-                    }
-    #endif
-                }
-
-                /* Configure duplex mode */
-                if((MSS_MAC_10_FDX == this_mac->speed_mode) || (MSS_MAC_100_FDX == this_mac->speed_mode) || (MSS_MAC_1000_FDX == this_mac->speed_mode))
-                {
-                    temp_cr |= GEM_FULL_DUPLEX;
-                }
-
-                if(0U != this_mac->is_emac)
-                {
-                    this_mac->emac_base->NETWORK_CONFIG = temp_cr;
-                }
-                else
-                {
-                    this_mac->mac_base->NETWORK_CONFIG = temp_cr;
-                }
-            }
-        }
+        this_mac->flow_ethertype_refs[ethertype_no]--;
     }
+
+    this_mac->flow_compare_used &= ~this_mac->flow_t2_compares[filter_no];
+    this_mac->flow_t2_compares[filter_no]  = 0U;
+    this_mac->flow_t2_ethertype[filter_no] = INVALID_INDEX;
+    this_mac->flow_t2_used &= ~((uint32_t)1U << filter_no);
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Return a pointer to the M mode interrupt enable registers in the PLIC for a
+ * hart or NULL_POINTER if the hart ID is not valid.
  */
-
-void MSS_MAC_init_TSU(const mss_mac_instance_t *this_mac, const mss_mac_tsu_config_t *tsu_cfg)
+static volatile uint32_t *plic_hart_enables(uint32_t hart_id)
 {
-    uint32_t temp;
+    volatile uint32_t *p_enables;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    switch(hart_id)
     {
-        temp  = (tsu_cfg->sub_ns_inc & 0xFFU) << 24;
-        temp |= (tsu_cfg->sub_ns_inc >> 8) & 0xFFFFU;
+        case 0U:
+            p_enables = PLIC->HART0_MMODE_ENA;
+            break;
 
-        if(0U != this_mac->is_emac)
-        {
-#if 0 /* Shouldn't really allow setting of tsu through eMAC as it is slaved to pMAC TSU */
-            this_mac->emac_base->TSU_TIMER_INCR_SUB_NSEC = temp;
-            this_mac->emac_base->TSU_TIMER_INCR          = tsu_cfg->ns_inc;
+        case 1U:
+            p_enables = PLIC->HART1_MMODE_ENA;
+            break;
 
-            /* PMCS: I'm not 100% sure about the sequencing here... */
+        case 2U:
+            p_enables = PLIC->HART2_MMODE_ENA;
+            break;
 
-            this_mac->emac_base->TSU_TIMER_MSB_SEC       = tsu_cfg->secs_msb;
-            this_mac->emac_base->TSU_TIMER_SEC           = tsu_cfg->secs_lsb;
-            this_mac->emac_base->TSU_TIMER_NSEC          = tsu_cfg->nanoseconds;
-#endif
-        }
-        else
-        {
-            this_mac->mac_base->TSU_TIMER_INCR_SUB_NSEC = temp;
-            this_mac->mac_base->TSU_TIMER_INCR          = tsu_cfg->ns_inc;
-            this_mac->mac_base->TSU_TIMER_MSB_SEC       = tsu_cfg->secs_msb;
-            this_mac->mac_base->TSU_TIMER_SEC           = tsu_cfg->secs_lsb;
-            this_mac->mac_base->TSU_TIMER_NSEC          = tsu_cfg->nanoseconds;
-        }
+        case 3U:
+            p_enables = PLIC->HART3_MMODE_ENA;
+            break;
+
+        case 4U:
+            p_enables = PLIC->HART4_MMODE_ENA;
+            break;
+
+        default:
+            p_enables = NULL_POINTER;
+            break;
     }
+
+    return(p_enables);
 }
+#endif /* defined(MSS_MAC_FLOW_STEERING) */
 
 
 /******************************************************************************
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_read_TSU(const mss_mac_instance_t *this_mac, mss_mac_tsu_time_t *tsu_time)
+void MSS_MAC_set_mmsl_mode(const mss_mac_instance_t *this_mac, const mss_mac_mmsl_config_t *mmsl_cfg)
 {
-    int32_t got_time = 0;
-
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        do
+        if(0U != mmsl_cfg->preemption) /* Preemption is enabled so deal with it */
         {
-            if(0U != this_mac->is_emac)
-            {
-                tsu_time->secs_lsb    = this_mac->emac_base->TSU_TIMER_SEC;
-                tsu_time->secs_msb    = this_mac->emac_base->TSU_TIMER_MSB_SEC;
-                tsu_time->nanoseconds = this_mac->emac_base->TSU_TIMER_NSEC;
+            /*
+             * Need to shut preemption down in case it is already enabled
+             * otherwise the new settings may not be recognised properly.
+             */
+            this_mac->mac_base->MMSL_CONTROL = 0U;
 
-                /* Check for nanoseconds roll over and exit loop if none otherwise do again */
-                if(tsu_time->secs_lsb == this_mac->emac_base->TSU_TIMER_SEC)
-                {
-                    got_time = 1;
-                }
+            if(0U != mmsl_cfg->verify_disable)
+            {
+                this_mac->mac_base->MMSL_CONTROL |= ((uint32_t)(mmsl_cfg->frag_size)) | GEM_VERIFY_DISABLE;
+                this_mac->mac_base->MMSL_CONTROL |= GEM_PRE_ENABLE;
             }
             else
             {
-                tsu_time->secs_lsb    = this_mac->mac_base->TSU_TIMER_SEC;
-                tsu_time->secs_msb    = this_mac->mac_base->TSU_TIMER_MSB_SEC;
-                tsu_time->nanoseconds = this_mac->mac_base->TSU_TIMER_NSEC;
-
-                /* Check for nanoseconds roll over and exit loop if none otherwise do again */
-                if(tsu_time->secs_lsb == this_mac->mac_base->TSU_TIMER_SEC)
-                {
-                    got_time = 1;
-                }
+                this_mac->mac_base->MMSL_CONTROL |= (uint32_t)(mmsl_cfg->frag_size);
+                this_mac->mac_base->MMSL_CONTROL |= GEM_PRE_ENABLE;
             }
-        } while(0 == got_time);
+        }
+        else /* Preemption is not enabled so see which MAC we want to use */
+        {
+            if(0U != mmsl_cfg->use_pmac)
+            {
+                this_mac->mac_base->MMSL_CONTROL = GEM_ROUTE_RX_TO_PMAC;
+            }
+            else
+            {
+                this_mac->mac_base->MMSL_CONTROL = 0U;
+            }
+        }
     }
 }
 
@@ -3519,18 +6887,27 @@ void MSS_MAC_read_TSU(const mss_mac_instance_t *this_mac, mss_mac_tsu_time_t *ts
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_TSU_rx_mode(const mss_mac_instance_t *this_mac, mss_mac_tsu_mode_t tsu_mode)
+void MSS_MAC_get_mmsl_mode(const mss_mac_instance_t *this_mac, mss_mac_mmsl_config_t *mmsl_cfg)
 {
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(0U != this_mac->is_emac)
+        (void)memset(mmsl_cfg, 0, sizeof(mss_mac_mmsl_config_t));
+        if(0U != (this_mac->mac_base->MMSL_CONTROL & GEM_ROUTE_RX_TO_PMAC))
+        {
+            mmsl_cfg->use_pmac = 1U;
+        }
+
+        if(0U != (this_mac->mac_base->MMSL_CONTROL & GEM_PRE_ENABLE))
         {
-            this_mac->emac_base->RX_BD_CONTROL = ((uint32_t)tsu_mode << GEM_BD_TS_MODE_SHIFT) & GEM_BD_TS_MODE;
+            mmsl_cfg->preemption = 1U;
         }
-        else
+
+        if(0U != (this_mac->mac_base->MMSL_CONTROL & GEM_VERIFY_DISABLE))
         {
-            this_mac->mac_base->RX_BD_CONTROL = ((uint32_t)tsu_mode << GEM_BD_TS_MODE_SHIFT) & GEM_BD_TS_MODE;
+            mmsl_cfg->verify_disable = 1U;
         }
+
+        mmsl_cfg->frag_size = (mss_mac_frag_size_t)(this_mac->mac_base->MMSL_CONTROL & BITS_02);
     }
 }
 
@@ -3539,17 +6916,13 @@ void MSS_MAC_set_TSU_rx_mode(const mss_mac_instance_t *this_mac, mss_mac_tsu_mod
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_TSU_tx_mode(const mss_mac_instance_t *this_mac, mss_mac_tsu_mode_t tsu_mode)
+void MSS_MAC_start_preemption_verify(const mss_mac_instance_t *this_mac)
 {
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(0U != this_mac->is_emac)
-        {
-            this_mac->emac_base->TX_BD_CONTROL = ((uint32_t)tsu_mode << GEM_BD_TS_MODE_SHIFT) & GEM_BD_TS_MODE;
-        }
-        else
+        if(0U != (this_mac->mac_base->MMSL_CONTROL & GEM_PRE_ENABLE)) /* Preemption is enabled */
         {
-            this_mac->mac_base->TX_BD_CONTROL = ((uint32_t)tsu_mode << GEM_BD_TS_MODE_SHIFT) & GEM_BD_TS_MODE;
+            this_mac->mac_base->MMSL_CONTROL |= GEM_RESTART_VER;
         }
     }
 }
@@ -3559,20 +6932,13 @@ void MSS_MAC_set_TSU_tx_mode(const mss_mac_instance_t *this_mac, mss_mac_tsu_mod
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-mss_mac_tsu_mode_t MSS_MAC_get_TSU_rx_mode(const mss_mac_instance_t *this_mac)
+uint32_t MSS_MAC_get_mmsl_status(const mss_mac_instance_t *this_mac)
 {
-    mss_mac_tsu_mode_t ret_val = MSS_MAC_TSU_MODE_DISABLED;
+    uint32_t ret_val = 0U;
 
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(0U != this_mac->is_emac)
-        {
-            ret_val = (mss_mac_tsu_mode_t)((this_mac->emac_base->RX_BD_CONTROL & GEM_BD_TS_MODE) >> GEM_BD_TS_MODE_SHIFT);
-        }
-        else
-        {
-            ret_val = (mss_mac_tsu_mode_t)((this_mac->mac_base->RX_BD_CONTROL & GEM_BD_TS_MODE) >> GEM_BD_TS_MODE_SHIFT);
-        }
+        ret_val = this_mac->mac_base->MMSL_STATUS; /* Just return raw value, user can decode using defined bits */
     }
 
     return(ret_val);
@@ -3583,23 +6949,21 @@ mss_mac_tsu_mode_t MSS_MAC_get_TSU_rx_mode(const mss_mac_instance_t *this_mac)
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-mss_mac_tsu_mode_t MSS_MAC_get_TSU_tx_mode(const mss_mac_instance_t *this_mac)
+void MSS_MAC_get_mmsl_stats(const mss_mac_instance_t *this_mac, mss_mac_mmsl_stats_t *stats)
 {
-    mss_mac_tsu_mode_t ret_val= MSS_MAC_TSU_MODE_DISABLED;
-
+    /*
+     * We return these differently to the general statistics as they are pMAC
+     * specific and don't have a corresponding eMAC equivalent.
+     */
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(0U != this_mac->is_emac)
-        {
-            ret_val = (mss_mac_tsu_mode_t)((this_mac->emac_base->TX_BD_CONTROL & GEM_BD_TS_MODE) >> GEM_BD_TS_MODE_SHIFT);
-        }
-        else
-        {
-            ret_val = (mss_mac_tsu_mode_t)((this_mac->mac_base->TX_BD_CONTROL & GEM_BD_TS_MODE) >> GEM_BD_TS_MODE_SHIFT);
-        }
+        (void)memset(stats, 0, sizeof(mss_mac_mmsl_stats_t));
+        stats->smd_err_count = (this_mac->mac_base->MMSL_ERR_STATS & GEM_SMD_ERR_COUNT) >> GEM_SMD_ERR_COUNT_SHIFT;
+        stats->ass_err_count = this_mac->mac_base->MMSL_ERR_STATS & GEM_ASS_ERR_COUNT;
+        stats->ass_ok_count  = this_mac->mac_base->MMSL_ASS_OK_COUNT;
+        stats->frag_count_rx = this_mac->mac_base->MMSL_FRAG_COUNT_RX;
+        stats->frag_count_tx = this_mac->mac_base->MMSL_FRAG_COUNT_TX;
     }
-    
-    return(ret_val);
 }
 
 
@@ -3607,50 +6971,41 @@ mss_mac_tsu_mode_t MSS_MAC_get_TSU_tx_mode(const mss_mac_instance_t *this_mac)
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_TSU_oss_mode(const mss_mac_instance_t *this_mac, mss_mac_oss_mode_t oss_mode)
+void MSS_MAC_set_cbs(const mss_mac_instance_t *this_mac, uint32_t cbs_queue, uint32_t idle_slope)
 {
-    volatile uint32_t temp_control;
+    volatile uint32_t *p_control;
+    volatile uint32_t *p_slope;
+    uint32_t enable;
 
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
         if(0U != this_mac->is_emac)
         {
-            temp_control = this_mac->emac_base->NETWORK_CONTROL;
+            p_control = &this_mac->emac_base->CBS_CONTROL;
+            p_slope   = &this_mac->emac_base->CBS_IDLESLOPE_Q_A;
         }
         else
         {
-            temp_control = this_mac->mac_base->NETWORK_CONTROL;
+            p_control = &this_mac->mac_base->CBS_CONTROL;
+            p_slope   = &this_mac->mac_base->CBS_IDLESLOPE_Q_A;
         }
 
-        /*
-         * Note. The docs don't say these are mutually exclusive but I don't think
-         * it makes sense to allow both modes at once...
-         */
-        if(MSS_MAC_OSS_MODE_DISABLED == oss_mode)
-        {
-            temp_control &= ~(GEM_OSS_CORRECTION_FIELD | GEM_ONE_STEP_SYNC_MODE);
-        }
-        else if(MSS_MAC_OSS_MODE_REPLACE == oss_mode)
+        if(MSS_MAC_CBS_QUEUE_B == cbs_queue)
         {
-            temp_control &= ~GEM_OSS_CORRECTION_FIELD;
-            temp_control |= GEM_ONE_STEP_SYNC_MODE;
+            p_slope++; /* CBS_IDLESLOPE_Q_B follows CBS_IDLESLOPE_Q_A */
+            enable = GEM_CBS_ENABLE_QUEUE_B;
         }
         else
         {
-            if(MSS_MAC_OSS_MODE_ADJUST == oss_mode)
-            {
-                temp_control |= GEM_OSS_CORRECTION_FIELD;
-                temp_control &= ~GEM_ONE_STEP_SYNC_MODE;
-            }
-        }
-        
-        if(0U != this_mac->is_emac)
-        {
-            this_mac->emac_base->NETWORK_CONTROL = temp_control;
+            enable = GEM_CBS_ENABLE_QUEUE_A;
         }
-        else
+
+        /* The shaper is stopped while the slope is changed */
+        *p_control &= ~enable;
+        if(0U != idle_slope)
         {
-            this_mac->mac_base->NETWORK_CONTROL = temp_control;
+            *p_slope    = idle_slope;
+            *p_control |= enable;
         }
     }
 }
@@ -3660,113 +7015,122 @@ void MSS_MAC_set_TSU_oss_mode(const mss_mac_instance_t *this_mac, mss_mac_oss_mo
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-mss_mac_oss_mode_t MSS_MAC_get_TSU_oss_mode(const mss_mac_instance_t *this_mac)
+uint32_t MSS_MAC_get_cbs(const mss_mac_instance_t *this_mac, uint32_t cbs_queue)
 {
-    mss_mac_oss_mode_t ret_val = MSS_MAC_OSS_MODE_DISABLED;
-    volatile uint32_t temp_control;
+    volatile uint32_t *p_control;
+    volatile uint32_t *p_slope;
+    uint32_t enable;
+    uint32_t ret_val = 0U;
 
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
         if(0U != this_mac->is_emac)
         {
-            temp_control = this_mac->emac_base->NETWORK_CONTROL;
+            p_control = &this_mac->emac_base->CBS_CONTROL;
+            p_slope   = &this_mac->emac_base->CBS_IDLESLOPE_Q_A;
         }
         else
         {
-            temp_control = this_mac->mac_base->NETWORK_CONTROL;
+            p_control = &this_mac->mac_base->CBS_CONTROL;
+            p_slope   = &this_mac->mac_base->CBS_IDLESLOPE_Q_A;
         }
 
-        /*
-         * Note. The docs don't say these are mutually exclusive but I don't think
-         * it makes sense to allow both modes at once so report this as invalid...
-         */
-        if((GEM_OSS_CORRECTION_FIELD | GEM_ONE_STEP_SYNC_MODE) == (temp_control & (GEM_OSS_CORRECTION_FIELD | GEM_ONE_STEP_SYNC_MODE)))
-        {
-            ret_val = MSS_MAC_OSS_MODE_INVALID;
-        }
-        else if(GEM_OSS_CORRECTION_FIELD == (temp_control & GEM_OSS_CORRECTION_FIELD))
+        if(MSS_MAC_CBS_QUEUE_B == cbs_queue)
         {
-            ret_val = MSS_MAC_OSS_MODE_ADJUST;
+            p_slope++;
+            enable = GEM_CBS_ENABLE_QUEUE_B;
         }
-        else if(GEM_ONE_STEP_SYNC_MODE == (temp_control & GEM_ONE_STEP_SYNC_MODE))
+        else
         {
-            ret_val = MSS_MAC_OSS_MODE_REPLACE;
+            enable = GEM_CBS_ENABLE_QUEUE_A;
         }
-        else
+
+        if(0U != (*p_control & enable))
         {
-            ret_val = MSS_MAC_OSS_MODE_DISABLED;
+            ret_val = *p_slope;
         }
     }
-    
+
     return(ret_val);
 }
 
 
+#if defined(MSS_MAC_TSN)
 /******************************************************************************
  * See mss_ethernet_mac.h for details of how to use this function.
+ *
+ * The whole map is checked before anything is changed so a bad map leaves the
+ * MACs as they were.
  */
 
-void MSS_MAC_set_TSU_unicast_addr(const mss_mac_instance_t *this_mac, mss_mac_tsu_addr_t select, uint32_t ip_address)
+uint8_t MSS_MAC_tsn_init(mss_mac_instance_t *this_mac, const mss_mac_tsn_config_t *cfg)
 {
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    mss_mac_type_2_filter_t filter;
+    mss_mac_instance_t *p_emac;
+    uint32_t pcp;
+    uint32_t filter_no = 0U;
+    uint32_t express = 0U;
+    uint8_t ret_val = MSS_MAC_FAILED;
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (0U == this_mac->is_emac))
     {
-        if(0U != this_mac->is_emac)
+        ret_val = MSS_MAC_SUCCESS;
+        for(pcp = 0U; pcp < MSS_MAC_TSN_PCP_COUNT; pcp++)
         {
-            if(MSS_MAC_TSU_UNICAST_RX == select)
+            if(0U != cfg->pcp_express[pcp])
             {
-                this_mac->emac_base->RX_PTP_UNICAST = ip_address;
+                express = 1U;
             }
-            else
+            else if((uint32_t)cfg->pcp_queue[pcp] >= (uint32_t)MSS_MAC_QUEUE_COUNT)
             {
-                this_mac->emac_base->TX_PTP_UNICAST = ip_address;
+                ret_val = MSS_MAC_FAILED;
             }
-        }
-        else
-        {
-            if(MSS_MAC_TSU_UNICAST_RX == select)
+            else if(0U != cfg->pcp_queue[pcp])
             {
-                this_mac->mac_base->RX_PTP_UNICAST = ip_address;
+                filter_no++; /* Queue 0 takes whatever no screener matches */
             }
             else
             {
-                this_mac->mac_base->TX_PTP_UNICAST = ip_address;
+                /* Nothing needed for queue 0 */
             }
         }
-    }
-}
-
-
-/******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
- */
-
-uint32_t MSS_MAC_get_TSU_unicast_addr(const mss_mac_instance_t *this_mac, mss_mac_tsu_addr_t select)
-{
-    uint32_t ret_val = 0U;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
-    {
-        if(0U != this_mac->is_emac)
+        p_emac = tsn_emac(this_mac);
+        if((filter_no > MSS_MAC_TYPE_2_SCREENERS) ||
+           ((0U != express) && (MSS_MAC_AVAILABLE != p_emac->mac_available)))
         {
-            if(MSS_MAC_TSU_UNICAST_RX == select)
-            {
-                ret_val = this_mac->emac_base->RX_PTP_UNICAST;
-            }
-            else
-            {
-                ret_val = this_mac->emac_base->TX_PTP_UNICAST;
-            }
+            ret_val = MSS_MAC_FAILED;
         }
-        else
+
+        if(MSS_MAC_SUCCESS == ret_val)
         {
-            if(MSS_MAC_TSU_UNICAST_RX == select)
+            (void)memset(&filter, 0, sizeof(filter));
+            filter.vlan_priority_enable = 1U;
+            filter_no = 0U;
+
+            for(pcp = 0U; pcp < MSS_MAC_TSN_PCP_COUNT; pcp++)
             {
-                ret_val = this_mac->mac_base->RX_PTP_UNICAST;
+                this_mac->tsn_express[pcp] = (uint8_t)((0U != cfg->pcp_express[pcp]) ? 1U : 0U);
+                this_mac->tsn_queue[pcp]   = cfg->pcp_queue[pcp];
+
+                if((0U == this_mac->tsn_express[pcp]) && (0U != cfg->pcp_queue[pcp]))
+                {
+                    filter.vlan_priority = (uint8_t)pcp;
+                    filter.queue_no      = cfg->pcp_queue[pcp];
+                    MSS_MAC_set_type_2_filter(this_mac, filter_no, &filter);
+                    filter_no++;
+                }
             }
-            else
+
+            MSS_MAC_set_cbs(this_mac, MSS_MAC_CBS_QUEUE_A, cfg->idle_slope_a);
+            MSS_MAC_set_cbs(this_mac, MSS_MAC_CBS_QUEUE_B, cfg->idle_slope_b);
+            if(0U != express)
             {
-                ret_val = this_mac->mac_base->TX_PTP_UNICAST;
+                MSS_MAC_set_cbs(p_emac, MSS_MAC_CBS_QUEUE_A, cfg->emac_idle_slope);
             }
+
+            MSS_MAC_set_mmsl_mode(this_mac, &cfg->mmsl);
+            (void)memset(&this_mac->tsn_stats, 0, sizeof(this_mac->tsn_stats));
         }
     }
 
@@ -3778,53 +7142,37 @@ uint32_t MSS_MAC_get_TSU_unicast_addr(const mss_mac_instance_t *this_mac, mss_ma
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_VLAN_only_mode(const mss_mac_instance_t *this_mac, bool enable)
+int32_t
+MSS_MAC_tsn_send_pkt
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t pcp,
+    uint8_t const * tx_buffer,
+    uint32_t tx_length,
+    void * p_user_data
+)
 {
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    int32_t ret_val = MSS_MAC_ERR_TX_NOT_OK;
+
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (0U == this_mac->is_emac) &&
+       (pcp < MSS_MAC_TSN_PCP_COUNT))
     {
-        if(0U != this_mac->is_emac)
+        if(0U != this_mac->tsn_express[pcp])
         {
-            if(false == enable)
-            {
-                this_mac->emac_base->NETWORK_CONFIG &= ~GEM_DISCARD_NON_VLAN_FRAMES;
-            }
-            else
-            {
-                this_mac->emac_base->NETWORK_CONFIG |= GEM_DISCARD_NON_VLAN_FRAMES;
-            }
+            ret_val = MSS_MAC_send_pkt(tsn_emac(this_mac), 0U, tx_buffer, tx_length, p_user_data);
         }
         else
         {
-            if(false == enable)
-            {
-                this_mac->mac_base->NETWORK_CONFIG &= ~GEM_DISCARD_NON_VLAN_FRAMES;
-            }
-            else
-            {
-                this_mac->mac_base->NETWORK_CONFIG |= GEM_DISCARD_NON_VLAN_FRAMES;
-            }
+            ret_val = MSS_MAC_send_pkt(this_mac, (uint32_t)this_mac->tsn_queue[pcp], tx_buffer, tx_length, p_user_data);
         }
-    }
-}
-
-
-/******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
- */
-
-bool MSS_MAC_get_VLAN_only_mode(const mss_mac_instance_t *this_mac)
-{
-    bool ret_val = false;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
-    {
-        if(0U != this_mac->is_emac)
+        if(MSS_MAC_ERR_OK == ret_val)
         {
-            ret_val = 0U != (this_mac->emac_base->NETWORK_CONFIG & GEM_DISCARD_NON_VLAN_FRAMES);
+            this_mac->tsn_stats.tx_frames[pcp]++;
         }
         else
         {
-            ret_val = 0U != (this_mac->mac_base->NETWORK_CONFIG & GEM_DISCARD_NON_VLAN_FRAMES);
+            this_mac->tsn_stats.tx_refused[pcp]++;
         }
     }
 
@@ -3836,97 +7184,48 @@ bool MSS_MAC_get_VLAN_only_mode(const mss_mac_instance_t *this_mac)
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_stacked_VLAN(const mss_mac_instance_t *this_mac, uint16_t tag)
-{
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
-    {
-        if(0U != this_mac->is_emac)
-        {
-            if(GEM_VLAN_ETHERTYPE_MIN > tag)
-            {
-                this_mac->emac_base->STACKED_VLAN = 0U;
-            }
-            else
-            {
-                this_mac->emac_base->STACKED_VLAN = (uint32_t)tag | GEM_ENABLE_PROCESSING;
-            }
-        }
-        else
-        {
-            if(GEM_VLAN_ETHERTYPE_MIN > tag)
-            {
-                this_mac->mac_base->STACKED_VLAN = 0U;
-            }
-            else
-            {
-                this_mac->mac_base->STACKED_VLAN = (uint32_t)tag | GEM_ENABLE_PROCESSING;
-            }
-        }
-    }
-}
-
-
-/******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
- */
-
-uint16_t MSS_MAC_get_stacked_VLAN(const mss_mac_instance_t *this_mac)
+void MSS_MAC_tsn_get_stats(mss_mac_instance_t *this_mac, mss_mac_tsn_stats_t *stats)
 {
-    uint16_t ret_val = GEM_VLAN_NO_STACK; /* Return 0 if stacked VLANs not enabled */
+    mss_mac_mmsl_stats_t mmsl;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (0U == this_mac->is_emac))
     {
-        if(0U != this_mac->is_emac)
-        {
-            if(0U != (this_mac->emac_base->STACKED_VLAN & GEM_ENABLE_PROCESSING))
-            {
-                ret_val = (uint16_t)this_mac->emac_base->STACKED_VLAN;
-            }
-        }
-        else
-        {
-            if(0U != (this_mac->mac_base->STACKED_VLAN & GEM_ENABLE_PROCESSING))
-            {
-                ret_val = (uint16_t)this_mac->mac_base->STACKED_VLAN;
-            }
-        }
-    }
+        /* The MMSL counts clear on read so add them to the totals */
+        MSS_MAC_get_mmsl_stats(this_mac, &mmsl);
+        this_mac->tsn_stats.smd_err_count += (uint64_t)mmsl.smd_err_count;
+        this_mac->tsn_stats.ass_err_count += (uint64_t)mmsl.ass_err_count;
+        this_mac->tsn_stats.ass_ok_count  += (uint64_t)mmsl.ass_ok_count;
+        this_mac->tsn_stats.frag_count_rx += (uint64_t)mmsl.frag_count_rx;
+        this_mac->tsn_stats.frag_count_tx += (uint64_t)mmsl.frag_count_tx;
+        this_mac->tsn_stats.mmsl_status    = MSS_MAC_get_mmsl_status(this_mac);
 
-    return(ret_val);
+        *stats = this_mac->tsn_stats;
+    }
 }
+#endif /* defined(MSS_MAC_TSN) */
 
 
 /******************************************************************************
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_hash(const mss_mac_instance_t *this_mac, uint64_t hash_in)
+void MSS_MAC_set_tx_cutthru(const mss_mac_instance_t *this_mac, uint32_t level)
 {
-    uint64_t hash = hash_in; /* Avoids warning about modifying fn parameter passed by value */
-    
+    volatile uint32_t *p_reg;
+    uint32_t mask;
+
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(0U != this_mac->is_emac)
-        {
-            if(0ULL == hash) /* Short cut for disabling */
-            {
-                this_mac->emac_base->NETWORK_CONFIG &= ~(GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
-            }
+        p_reg = (0U != this_mac->is_emac) ? &this_mac->emac_base->PBUF_TXCUTTHRU : &this_mac->mac_base->PBUF_TXCUTTHRU;
+        mask  = (0U != this_mac->is_emac) ? GEM_DMA_EMAC_CUTTHRU_THRESHOLD : GEM_DMA_TX_CUTTHRU_THRESHOLD;
 
-            this_mac->emac_base->HASH_BOTTOM = (uint32_t)hash;
-            hash >>= 32;
-            this_mac->emac_base->HASH_TOP = (uint32_t)hash;
+        if(0U == level) /* Disabling cutthru? */
+        {
+            *p_reg = 0U;
         }
         else
         {
-            if(0ULL == hash) /* Short cut for disabling */
-            {
-                this_mac->mac_base->NETWORK_CONFIG &= ~(GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
-            }
-
-            this_mac->mac_base->HASH_BOTTOM = (uint32_t)hash;
-            hash >>= 32;
-            this_mac->mac_base->HASH_TOP = (uint32_t)hash;
+            *p_reg = GEM_DMA_CUTTHRU | (level & mask);
         }
     }
 }
@@ -3936,27 +7235,25 @@ void MSS_MAC_set_hash(const mss_mac_instance_t *this_mac, uint64_t hash_in)
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-uint64_t MSS_MAC_get_hash(const mss_mac_instance_t *this_mac)
+void MSS_MAC_set_rx_cutthru(const mss_mac_instance_t *this_mac, uint32_t level)
 {
-    uint64_t ret_val = 0U;
+    volatile uint32_t *p_reg;
+    uint32_t mask;
 
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(0U != this_mac->is_emac)
+        p_reg = (0U != this_mac->is_emac) ? &this_mac->emac_base->PBUF_RXCUTTHRU : &this_mac->mac_base->PBUF_RXCUTTHRU;
+        mask  = (0U != this_mac->is_emac) ? GEM_DMA_EMAC_CUTTHRU_THRESHOLD : GEM_DMA_RX_CUTTHRU_THRESHOLD;
+
+        if(0U == level) /* Disabling cutthru? */
         {
-            ret_val   = (uint64_t)this_mac->emac_base->HASH_TOP;
-            ret_val <<= 32;
-            ret_val  |= (uint64_t)this_mac->emac_base->HASH_BOTTOM;
+            *p_reg = 0U;
         }
         else
         {
-            ret_val   = (uint64_t)this_mac->mac_base->HASH_TOP;
-            ret_val <<= 32;
-            ret_val  |= (uint64_t)this_mac->mac_base->HASH_BOTTOM;
+            *p_reg = GEM_DMA_CUTTHRU | (level & mask);
         }
     }
-    
-    return(ret_val);
 }
 
 
@@ -3964,29 +7261,29 @@ uint64_t MSS_MAC_get_hash(const mss_mac_instance_t *this_mac)
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_hash_mode(const mss_mac_instance_t *this_mac, mss_mac_hash_mode_t mode)
+uint32_t MSS_MAC_get_tx_cutthru(const mss_mac_instance_t *this_mac)
 {
-    uint32_t temp;
+    uint32_t temp_reg = 0U;
+    volatile uint32_t *p_reg;
+    uint32_t mask;
 
-    /*
-     * Enum values are matched to register bits but just to be safe we mask them
-     * to ensure only the two hash control bits are modified...
-     */
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(0U != this_mac->is_emac)
+        p_reg = (0U != this_mac->is_emac) ? &this_mac->emac_base->PBUF_TXCUTTHRU : &this_mac->mac_base->PBUF_TXCUTTHRU;
+        mask  = (0U != this_mac->is_emac) ? GEM_DMA_EMAC_CUTTHRU_THRESHOLD : GEM_DMA_TX_CUTTHRU_THRESHOLD;
+
+        temp_reg = *p_reg;
+        if(0U == (temp_reg & GEM_DMA_CUTTHRU))
         {
-            temp = this_mac->emac_base->NETWORK_CONFIG & ~(GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
-            temp |= (uint32_t)mode & (GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
-            this_mac->emac_base->NETWORK_CONFIG = temp;
+            temp_reg = 0U;
         }
         else
         {
-            temp = this_mac->mac_base->NETWORK_CONFIG & ~(GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
-            temp |= (uint32_t)mode & (GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE);
-            this_mac->mac_base->NETWORK_CONFIG = temp;
+            temp_reg &= mask;
         }
     }
+
+    return(temp_reg);
 }
 
 
@@ -3994,23 +7291,29 @@ void MSS_MAC_set_hash_mode(const mss_mac_instance_t *this_mac, mss_mac_hash_mode
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-mss_mac_hash_mode_t MSS_MAC_get_hash_mode(const mss_mac_instance_t *this_mac)
+uint32_t MSS_MAC_get_rx_cutthru(const mss_mac_instance_t *this_mac)
 {
-    mss_mac_hash_mode_t ret_val = 0;
+    uint32_t temp_reg = 0U;
+    volatile uint32_t *p_reg;
+    uint32_t mask;
 
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(0U != this_mac->is_emac)
+        p_reg = (0U != this_mac->is_emac) ? &this_mac->emac_base->PBUF_RXCUTTHRU : &this_mac->mac_base->PBUF_RXCUTTHRU;
+        mask  = (0U != this_mac->is_emac) ? GEM_DMA_EMAC_CUTTHRU_THRESHOLD : GEM_DMA_RX_CUTTHRU_THRESHOLD;
+
+        temp_reg = *p_reg;
+        if(0U == (temp_reg & GEM_DMA_CUTTHRU))
         {
-            ret_val = (mss_mac_hash_mode_t)(this_mac->emac_base->NETWORK_CONFIG & (GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE));
+            temp_reg = 0U;
         }
         else
         {
-            ret_val = (mss_mac_hash_mode_t)(this_mac->mac_base->NETWORK_CONFIG & (GEM_UNICAST_HASH_ENABLE | GEM_MULTICAST_HASH_ENABLE));
+            temp_reg &= mask;
         }
     }
 
-    return(ret_val);
+    return(temp_reg);
 }
 
 
@@ -4018,30 +7321,23 @@ mss_mac_hash_mode_t MSS_MAC_get_hash_mode(const mss_mac_instance_t *this_mac)
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_type_filter(const mss_mac_instance_t *this_mac, uint32_t filter, uint16_t value)
+void MSS_MAC_tx_enable(const mss_mac_instance_t *this_mac)
 {
-    volatile uint32_t *p_reg;
-
+    /* Don't do this if already done in case it has side effects... */
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
         if(0U != this_mac->is_emac)
         {
-            p_reg = &this_mac->emac_base->SPEC_TYPE1;
+            if(0U == (this_mac->emac_base->NETWORK_CONTROL & GEM_ENABLE_TRANSMIT))
+            {
+                this_mac->emac_base->NETWORK_CONTROL |= GEM_ENABLE_TRANSMIT;
+            }
         }
         else
         {
-            p_reg = &this_mac->mac_base->SPEC_TYPE1;
-        }
-        if((filter <= 4U) && (filter > 0U)) /* Filter is in range 1 to 4 to match register naming */
-        {
-            p_reg += filter - 1U;
-            if(0U == value) /* Disable filter if match value is 0 as this should not be a valid type */
-            {
-                *p_reg = 0U;
-            }
-            else
+            if(0U == (this_mac->mac_base->NETWORK_CONTROL & GEM_ENABLE_TRANSMIT))
             {
-                *p_reg = (uint32_t)(0x80000000UL | (uint32_t)value);
+                this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_TRANSMIT;
             }
         }
     }
@@ -4052,33 +7348,33 @@ void MSS_MAC_set_type_filter(const mss_mac_instance_t *this_mac, uint32_t filter
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-uint16_t MSS_MAC_get_type_filter(const mss_mac_instance_t *this_mac, uint32_t filter)
+void MSS_MAC_set_jumbo_frames_mode(const mss_mac_instance_t *this_mac, bool state)
 {
-    volatile uint32_t *p_reg;
-    uint16_t ret_val = 0U;
+    volatile uint32_t *p_reg = &this_mac->mac_base->NETWORK_CONFIG;
 
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
         if(0U != this_mac->is_emac)
         {
-            p_reg = &this_mac->emac_base->SPEC_TYPE1;
-        }
-        else
-        {
-            p_reg = &this_mac->mac_base->SPEC_TYPE1;
+            p_reg = &this_mac->emac_base->NETWORK_CONFIG;
         }
 
-        if((filter <= 4U) && (filter > 0U)) /* Filter is in range 1 to 4 to match register naming */
+        if(0U != this_mac->jumbo_frame_enable) /* Only look at this if the feature is enabled in config */
         {
-            p_reg += filter - 1U;
-            if(0U != (*p_reg & 0x80000000UL)) /* Not disabled filter... */
+            if(state)
             {
-                ret_val = (uint16_t)*p_reg;
+                *p_reg |= GEM_JUMBO_FRAMES;
             }
+            else
+            {
+                *p_reg &= ~GEM_JUMBO_FRAMES;
+            }
+        }
+        else /* Ensure it is disabled if not allowed... */
+        {
+            *p_reg &= ~GEM_JUMBO_FRAMES;
         }
     }
-
-    return(ret_val);
 }
 
 
@@ -4086,58 +7382,22 @@ uint16_t MSS_MAC_get_type_filter(const mss_mac_instance_t *this_mac, uint32_t fi
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_sa_filter(const mss_mac_instance_t *this_mac, uint32_t filter, uint16_t control, const uint8_t *mac_addr)
+bool MSS_MAC_get_jumbo_frames_mode(const mss_mac_instance_t *this_mac)
 {
-    volatile uint32_t *p_reg;
-    uint32_t address32_l;
-    uint32_t address32_h;
-
-    ASSERT(NULL_POINTER!= mac_addr);
+    bool ret_val = false;
+    volatile uint32_t *p_reg = &this_mac->mac_base->NETWORK_CONFIG;
 
-    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != mac_addr))
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if((filter >= 2U) && (filter <= 4U)) /* SA Filter 1 is for our address */
+        if(0U != this_mac->is_emac)
         {
-            if(0U != this_mac->is_emac)
-            {
-                p_reg = &this_mac->emac_base->SPEC_ADD2_BOTTOM;
-            }
-            else
-            {
-                p_reg = &this_mac->mac_base->SPEC_ADD2_BOTTOM;
-            }
-
-            p_reg = p_reg + ((filter - 2U) * 2U);
-
-            if(MSS_MAC_SA_FILTER_DISABLE == control)
-            {
-                /*
-                 * Clear filter and disable - must be done in this order...
-                 *  Writing to [0] disables and [1] enables So this sequence
-                 *  clears the registers and disables the filter as opposed to
-                 *  setting a destination address filter for 00:00:00:00:00:00.
-                 */
-                p_reg[1] = 0U;
-                p_reg[0] = 0U;
-            }
-            else
-            {
-                /* Assemble correct register values */
-                address32_l  = ((uint32_t)mac_addr[3]) << 24;
-                address32_l |= ((uint32_t)mac_addr[2]) << 16;
-                address32_l |= ((uint32_t)mac_addr[1]) << 8;
-                address32_l |= ((uint32_t)mac_addr[0]);
-                address32_h =  ((uint32_t)mac_addr[5]) << 8;
-                address32_h |= ((uint32_t)mac_addr[4]);
-
-                address32_h |= (uint32_t)control << 16;
-
-                /* Update hardware registers - must be done in this order... */
-                p_reg[0] = address32_l;
-                p_reg[1] = address32_h;
-            }
+            p_reg = &this_mac->emac_base->NETWORK_CONFIG;
         }
+
+        ret_val = ((*p_reg & GEM_JUMBO_FRAMES) != 0U);
     }
+
+    return(ret_val);
 }
 
 
@@ -4145,51 +7405,53 @@ void MSS_MAC_set_sa_filter(const mss_mac_instance_t *this_mac, uint32_t filter,
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-uint16_t MSS_MAC_get_sa_filter(const mss_mac_instance_t *this_mac, uint32_t filter, uint8_t *mac_addr)
+void MSS_MAC_set_jumbo_frame_length(const mss_mac_instance_t *this_mac, uint32_t length_in)
 {
-    volatile uint32_t *p_reg;
-    uint32_t temp_reg;
-    uint16_t ret_val = 0U;
+    volatile uint32_t *p_reg = &this_mac->mac_base->JUMBO_MAX_LENGTH;
+    uint32_t length = length_in; /* Avoids warning about modifying parameter passed by value */
 
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(NULL_POINTER != mac_addr)
+        if(0U != this_mac->is_emac)
         {
-            (void)memset(mac_addr, 0, 6); /* Consistent result if bad parameters passed... */
+            p_reg = &this_mac->emac_base->JUMBO_MAX_LENGTH;
         }
 
-        if((filter >= 2U) && (filter <= 4U))
+        /* Set up maximum jumbo frame size - but bounds check first  */
+        if(length > MSS_MAC_JUMBO_MAX)
         {
-            if(0U != this_mac->is_emac)
-            {
-                p_reg = &this_mac->emac_base->SPEC_ADD2_BOTTOM;
-            }
-            else
-            {
-                p_reg = &this_mac->mac_base->SPEC_ADD2_BOTTOM;
-            }
+            length = MSS_MAC_JUMBO_MAX;
+        }
 
-            p_reg = p_reg + ((filter - 2U) * 2U);
+        if(0U != this_mac->jumbo_frame_enable) /* Only look at this if the feature is enabled in config */
+        {
+            *p_reg = length;
+        }
+        else /* Ensure it is set to reset value if not allowed... */
+        {
+            *p_reg = MSS_MAC_JUMBO_MAX;
+        }
+    }
+}
 
-            if(NULL_POINTER != mac_addr) /* Want MAC address and filter control info? */
-            {
-                temp_reg = p_reg[0];
-                mac_addr[0] = (uint8_t)temp_reg & BITS_08;
-                temp_reg >>= 8;
-                mac_addr[1] = (uint8_t)temp_reg & BITS_08;
-                temp_reg >>= 8;
-                mac_addr[2] = (uint8_t)temp_reg & BITS_08;
-                temp_reg >>= 8;
-                mac_addr[3] = (uint8_t)temp_reg & BITS_08;
 
-                temp_reg = p_reg[1];
-                mac_addr[4] = (uint8_t)temp_reg & BITS_08;
-                temp_reg >>= 8;
-                mac_addr[5] = (uint8_t)temp_reg & BITS_08;
-            }
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+uint32_t MSS_MAC_get_jumbo_frame_length(const mss_mac_instance_t *this_mac)
+{
+    uint32_t ret_val = 0;
+    volatile uint32_t *p_reg = &this_mac->mac_base->JUMBO_MAX_LENGTH;
 
-            ret_val = (uint16_t)(p_reg[1] >> 16);
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
+        {
+            p_reg = &this_mac->emac_base->JUMBO_MAX_LENGTH;
         }
+
+        ret_val = *p_reg;
     }
 
     return(ret_val);
@@ -4200,41 +7462,61 @@ uint16_t MSS_MAC_get_sa_filter(const mss_mac_instance_t *this_mac, uint32_t filt
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_type_1_filter(const mss_mac_instance_t *this_mac, uint32_t filter_no, const mss_mac_type_1_filter_t *filter)
+void MSS_MAC_set_int_moderation(const mss_mac_instance_t *this_mac, uint32_t rx_moderation, uint32_t tx_moderation)
 {
-    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (filter_no < MSS_MAC_TYPE_1_SCREENERS))
-    {
-        volatile uint32_t *p_reg;
-        uint32_t temp_reg;
+    volatile uint32_t *p_reg = &this_mac->mac_base->INT_MODERATION;
+    uint32_t rx_value = rx_moderation; /* Avoids warning about modifying parameter passed by value */
+    uint32_t tx_value = tx_moderation;
 
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
         if(0U != this_mac->is_emac)
         {
-            p_reg = &this_mac->emac_base->SCREENING_TYPE_1_REGISTER_0;
+            p_reg = &this_mac->emac_base->INT_MODERATION;
         }
-        else
+
+        /* Bounds check before writing both timers in one go */
+        if(rx_value > MSS_MAC_INT_MODERATION_MAX)
         {
-            p_reg = &this_mac->mac_base->SCREENING_TYPE_1_REGISTER_0;
+            rx_value = MSS_MAC_INT_MODERATION_MAX;
         }
 
-        temp_reg  = (uint32_t)filter->queue_no & GEM_QUEUE_NUMBER;
-        temp_reg |= ((uint32_t)filter->dstc << GEM_DSTC_MATCH_SHIFT) & GEM_DSTC_MATCH;
-        temp_reg |= ((uint32_t)filter->udp_port << GEM_UDP_PORT_MATCH_SHIFT) & GEM_UDP_PORT_MATCH;
-        if(0U != filter->drop_on_match)
+        if(tx_value > MSS_MAC_INT_MODERATION_MAX)
         {
-            temp_reg |= GEM_DROP_ON_MATCH;
+            tx_value = MSS_MAC_INT_MODERATION_MAX;
         }
 
-        if(0U != filter->dstc_enable)
+        *p_reg = (tx_value << GEM_TX_INT_MODERATION_SHIFT) | rx_value;
+    }
+}
+
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void MSS_MAC_get_int_moderation(const mss_mac_instance_t *this_mac, uint32_t *rx_moderation, uint32_t *tx_moderation)
+{
+    volatile uint32_t *p_reg = &this_mac->mac_base->INT_MODERATION;
+    uint32_t temp_reg;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        if(0U != this_mac->is_emac)
         {
-            temp_reg |= GEM_DSTC_ENABLE;
+            p_reg = &this_mac->emac_base->INT_MODERATION;
         }
 
-        if(0U != filter->udp_port_enable)
+        temp_reg = *p_reg;
+        if(NULL_POINTER != rx_moderation)
         {
-            temp_reg |= GEM_UDP_PORT_MATCH_ENABLE;
+            *rx_moderation = temp_reg & GEM_RX_INT_MODERATION;
         }
 
-        p_reg[filter_no] = temp_reg;
+        if(NULL_POINTER != tx_moderation)
+        {
+            *tx_moderation = (temp_reg & GEM_TX_INT_MODERATION) >> GEM_TX_INT_MODERATION_SHIFT;
+        }
     }
 }
 
@@ -4243,44 +7525,45 @@ void MSS_MAC_set_type_1_filter(const mss_mac_instance_t *this_mac, uint32_t filt
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_get_type_1_filter(const mss_mac_instance_t *this_mac, uint32_t filter_no, mss_mac_type_1_filter_t *filter)
+uint32_t MSS_MAC_get_offload_caps(const mss_mac_instance_t *this_mac)
 {
+    uint32_t caps = 0U;
+    uint32_t net_config;
+    uint32_t dma_config;
+    uint32_t debug6;
 
-    if((MSS_MAC_AVAILABLE == this_mac->mac_available) && (filter_no < MSS_MAC_TYPE_1_SCREENERS))
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        volatile uint32_t *p_reg;
-        uint32_t temp_reg;
-
-        (void)memset(filter, 0, sizeof(mss_mac_type_1_filter_t)); /* Blank canvass to start */
-        
         if(0U != this_mac->is_emac)
         {
-            p_reg = &this_mac->emac_base->SCREENING_TYPE_1_REGISTER_0;
+            net_config = this_mac->emac_base->NETWORK_CONFIG;
+            dma_config = this_mac->emac_base->DMA_CONFIG;
+            debug6     = this_mac->emac_base->DESIGNCFG_DEBUG6;
         }
         else
         {
-            p_reg = &this_mac->mac_base->SCREENING_TYPE_1_REGISTER_0;
+            net_config = this_mac->mac_base->NETWORK_CONFIG;
+            dma_config = this_mac->mac_base->DMA_CONFIG;
+            debug6     = this_mac->mac_base->DESIGNCFG_DEBUG6;
         }
 
-        temp_reg = p_reg[filter_no];
-
-        filter->queue_no = (uint8_t)(temp_reg & GEM_QUEUE_NUMBER);
-        temp_reg >>= 4;
-
-        filter->dstc = (uint8_t)(temp_reg & GEM_DSTC_MATCH);
-        temp_reg >>= GEM_DSTC_MATCH_SHIFT;
-
-        filter->udp_port = (uint16_t)(temp_reg & GEM_UDP_PORT_MATCH);
-        temp_reg >>= GEM_UDP_PORT_MATCH_SHIFT;
-
-        filter->dstc_enable = (uint8_t)(temp_reg & 1U);
-        temp_reg >>= 1;
+        if(0U != (dma_config & GEM_TX_PBUF_TCP_EN))
+        {
+            caps |= MSS_MAC_OFFLOAD_TX_CSUM;
+        }
 
-        filter->udp_port_enable = (uint8_t)(temp_reg & 1U);
-        temp_reg >>= 1;
+        if(0U != (net_config & GEM_RECEIVE_CHECKSUM_OFFLOAD_ENABLE))
+        {
+            caps |= MSS_MAC_OFFLOAD_RX_CSUM;
+        }
 
-        filter->drop_on_match = (uint8_t)(temp_reg & 1U);
+        if(0U != (debug6 & GEM_PBUF_LSO))
+        {
+            caps |= MSS_MAC_OFFLOAD_LSO;
+        }
     }
+
+    return(caps);
 }
 
 
@@ -4288,19 +7571,27 @@ void MSS_MAC_get_type_1_filter(const mss_mac_instance_t *this_mac, uint32_t filt
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-void MSS_MAC_set_type_2_ethertype(const mss_mac_instance_t *this_mac, uint32_t ethertype_no, uint16_t ethertype)
+void MSS_MAC_set_pause_frame_copy_to_mem(const mss_mac_instance_t *this_mac, bool state)
 {
-    volatile uint32_t *p_reg;
+    volatile uint32_t *p_reg = &this_mac->mac_base->NETWORK_CONFIG;
 
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(0U == this_mac->is_emac) /* Ethertype filter not supported on eMAC */
+        if(0U != this_mac->is_emac)
         {
-            p_reg = &this_mac->mac_base->SCREENING_TYPE_2_ETHERTYPE_REG_0;
-            if(ethertype_no < MSS_MAC_TYPE_2_ETHERTYPES)
-            {
-                p_reg[ethertype_no] = (uint32_t)ethertype;
-            }
+            p_reg = &this_mac->emac_base->NETWORK_CONFIG;
+        }
+        /*
+         * Logic is inverted as enabling copy to memory means disabling
+         * GEM_DISABLE_COPY_OF_PAUSE_FRAMES
+         */
+        if(state)
+        {
+            *p_reg &= ~GEM_DISABLE_COPY_OF_PAUSE_FRAMES;
+        }
+        else
+        {
+            *p_reg |= GEM_DISABLE_COPY_OF_PAUSE_FRAMES;
         }
     }
 }
@@ -4310,860 +7601,1543 @@ void MSS_MAC_set_type_2_ethertype(const mss_mac_instance_t *this_mac, uint32_t e
  * See mss_ethernet_mac.h for details of how to use this function.
  */
 
-uint16_t MSS_MAC_get_type_2_ethertype(const mss_mac_instance_t *this_mac, uint32_t ethertype_no)
+bool MSS_MAC_get_pause_frame_copy_to_mem(const mss_mac_instance_t *this_mac)
 {
-    volatile uint32_t *p_reg;
-    uint16_t temp_reg = 0U;
+    bool ret_val = false;
+    volatile uint32_t *p_reg = &this_mac->mac_base->NETWORK_CONFIG;
 
     if(MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
-        if(0U == this_mac->is_emac) /* Ethertype filter not supported on eMAC */
+        if(0U != this_mac->is_emac)
         {
-            p_reg = &this_mac->mac_base->SCREENING_TYPE_2_ETHERTYPE_REG_0;
-            if(ethertype_no < MSS_MAC_TYPE_2_ETHERTYPES)
-            {
-                temp_reg = (uint16_t)p_reg[ethertype_no];
-            }
+            p_reg = &this_mac->emac_base->NETWORK_CONFIG;
         }
+
+        /*
+         * Logic is inverted as enabling copy to memory means disabling
+         * GEM_DISABLE_COPY_OF_PAUSE_FRAMES
+         */
+        ret_val = 0U == (*p_reg & GEM_DISABLE_COPY_OF_PAUSE_FRAMES);
     }
     
-    return(temp_reg);
+    return(ret_val);
 }
 
 
+/**************************************************************************/
+/* Private Function definitions                                           */
+/**************************************************************************/  
+
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * This is default "Receive packet interrupt handler. This function finds the
+ * descriptor that received the packet and caused the interrupt.
+ * This informs the received packet size to the application and
+ * relinquishes the packet buffer from the associated DMA descriptor.
+ *
+ * At most budget packets are processed and the number of packets actually
+ * processed is returned.
  */
-
-void MSS_MAC_set_type_2_compare(const mss_mac_instance_t *this_mac, uint32_t comparer_no_in, const mss_mac_type_2_compare_t *comparer)
+static uint32_t 
+rxpkt_handler
+(
+    mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t budget
+)
 {
-    volatile uint32_t *p_reg;
-    uint32_t limit;
-    uint32_t temp_reg;
-    uint32_t comparer_no = comparer_no_in;
+#if !defined(MSS_MAC_RX_CHAINED) || defined(MSS_MAC_PERF_STATS)
+    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+#endif
+#if !defined(MSS_MAC_RX_CHAINED)
+    mss_mac_rx_desc_t * cdesc = &this_queue->rx_desc_tab[this_queue->first_rx_desc_index];
+#endif
+    uint32_t burst = budget;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+#if defined(MSS_MAC_RX_CHAINED)
+    burst = budget - rx_chain_handler(this_mac, queue_no, budget);
+#else
+    if((0U != budget) && (0U != (cdesc->addr_low & GEM_RX_DMA_USED))) /* Check in case we already got it... */
     {
-        if(0U != this_mac->is_emac) /* eMAC limits are different to pMAC ones */
-        {
-            p_reg = &this_mac->emac_base->TYPE2_COMPARE_0_WORD_0;
-            limit = MSS_MAC_EMAC_TYPE_2_COMPARERS;
-        }
-        else
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
+        ts_latch_secs(this_mac, queue_no);
+#endif
+        /* Execution comes here because at-least one packet is received. */
+        do
         {
-            p_reg = &this_mac->mac_base->TYPE2_COMPARE_0_WORD_0;
-            limit = MSS_MAC_TYPE_2_COMPARERS;
-        }
+            uint8_t * p_rx_packet;
+            uint32_t pckt_length;
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+            uint64_t addr_temp;
+#else
+            uint32_t addr_temp;
+#endif
 
-        if(comparer_no < limit)
-        {
-            comparer_no *= 2U; /* Working with consecutive pairs of registers for this one */
-            if(0U != comparer->disable_mask)
-            {
-                p_reg[comparer_no] = comparer->data; /* Mask disabled so just 4 byte compare value */
-                temp_reg = GEM_DISABLE_MASK;         /* and no mask */
-            }
-            else
+            ++this_queue->nb_available_rx_desc;
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+            addr_temp  = (uint64_t)(cdesc->addr_low & ~(GEM_RX_DMA_WRAP | GEM_RX_DMA_USED | GEM_RX_DMA_TS_PRESENT));
+            addr_temp |= (uint64_t)cdesc->addr_high << 32;
+#else
+            addr_temp = (cdesc->addr_low & ~(GEM_RX_DMA_WRAP | GEM_RX_DMA_USED | GEM_RX_DMA_TS_PRESENT));
+#endif
+            p_rx_packet = (uint8_t *)addr_temp;
+            /*
+             * Pass received packet up to application layer - if enabled...
+             *
+             * Note if rx_packet comes back as 0 we can't recover and will leave a
+             * used packet stuck in the queue...
+             */
+#if !defined(MSS_MAC_UNH_TEST)
+            if((NULL_POINTER != this_queue->pckt_rx_callback) && (NULL_POINTER != p_rx_packet) && (0U == this_mac->rx_discard))
+#endif
             {
-                temp_reg  = comparer->data << 16;     /* 16 bit compare value and 16 bit mask */
-                temp_reg |= (uint32_t)comparer->mask;
-                p_reg[comparer_no] = temp_reg;
-                temp_reg = 0U;
-            }
+                pckt_length = cdesc->status & (GEM_RX_DMA_BUFF_LEN | GEM_RX_DMA_JUMBO_BIT_13);
+                MSS_STAT_ADD(this_queue->ingress, pckt_length);
+#if defined(MSS_MAC_CACHE_MAINTENANCE)
+                mss_l2_invalidate_range((uint64_t)p_rx_packet, pckt_length);
+#endif
+#if defined(MSS_MAC_CAPTURE)
+                mss_mac_capture_t *cap = this_mac->capture;
 
-            if(0U != comparer->compare_vlan_c_id)
-            {
-                temp_reg |= GEM_COMPARE_VLAN_ID;
+                if((NULL_POINTER != cap) && (0U != (cap->flags & MSS_MAC_CAPTURE_RX)))
+                {
+                    mss_mac_tx_frag_t frag;
+                    mss_mac_tsu_time_t tsu_time;
+
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
+                    if(MSS_MAC_SUCCESS != MSS_MAC_get_rx_timestamp(this_mac, (uint32_t)queue_no, cdesc, &tsu_time))
+#endif
+                    {
+                        MSS_MAC_read_TSU(this_mac, &tsu_time);
+                    }
+                    frag.addr = p_rx_packet;
+                    frag.length = pckt_length;
+                    capture_frags(cap, &frag, 1U, pckt_length, &tsu_time);
+                }
+#endif
+
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+                if(0U != this_queue->rx_pool.active)
+                {
+                    mss_mac_rx_buf_t *p_buf;
+
+                    /*
+                     * Lend the buffer to the application, it now owns the one
+                     * reference and returns it with MSS_MAC_rx_buf_release().
+                     */
+                    p_buf = &this_queue->rx_pool.buf[this_queue->rx_pool.ring_buf[this_queue->first_rx_desc_index]];
+                    this_queue->rx_pool.ring_buf[this_queue->first_rx_desc_index] = MSS_MAC_RX_POOL_END;
+                    p_buf->ref_count = 1U;
+                    p_buf->length    = pckt_length;
+                    this_queue->pckt_rx_callback(this_mac, queue_no, p_rx_packet, pckt_length, cdesc, (void *)p_buf);
+                }
+                else
+#endif
+                {
+                    this_queue->pckt_rx_callback(this_mac, queue_no, p_rx_packet, pckt_length, cdesc, this_queue->rx_caller_info[this_queue->first_rx_desc_index]);
+                }
             }
-            else if(0U != comparer->compare_vlan_s_id)
+
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+            if((0U != this_queue->rx_pool.active) &&
+               (MSS_MAC_RX_POOL_END != this_queue->rx_pool.ring_buf[this_queue->first_rx_desc_index]))
             {
-                temp_reg |= GEM_COMPARE_VLAN_ID | GEM_COMPARE_S_TAG;
+                /* Nobody took the buffer so recycle it straight away */
+                rx_pool_free(&this_queue->rx_pool, &this_queue->rx_pool.buf[this_queue->rx_pool.ring_buf[this_queue->first_rx_desc_index]]);
+                this_queue->rx_pool.ring_buf[this_queue->first_rx_desc_index] = MSS_MAC_RX_POOL_END;
             }
-            else
+#endif
+#if !defined(MSS_MAC_UNH_TEST)
+            if((NULL_POINTER != p_rx_packet) && (0U != this_mac->rx_discard)
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+               && (0U == this_queue->rx_pool.active)
+#endif
+              )
             {
-                temp_reg |= (uint32_t)comparer->offset_value & BITS_07;
-                temp_reg |= ((uint32_t)comparer->compare_offset & BITS_02) << GEM_COMPARE_OFFSET_SHIFT;
+                /*
+                 * Need to return receive packet buffer to the queue as rx handler
+                 * hasn't been called to do it for us...
+                 */
+                (void)MSS_MAC_receive_pkt(this_mac, queue_no, p_rx_packet, this_queue->rx_caller_info[this_queue->first_rx_desc_index], MSS_MAC_INT_ENABLE);
             }
+#endif
+
+            /* Point the curr_rx_desc to next descriptor in the ring */
+            /* Wrap around in case next descriptor is pointing to last in the ring */
+            ++this_queue->first_rx_desc_index;
+            this_queue->first_rx_desc_index %= MSS_MAC_RX_RING_SIZE;
+
+            cdesc = &this_queue->rx_desc_tab[this_queue->first_rx_desc_index];
+            burst--;
+        } while(0 != (cdesc->addr_low & GEM_RX_DMA_USED) && (0 != burst)); /* loop while there are packets available */
+    }
+#endif /* defined(MSS_MAC_RX_CHAINED) */
+
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+    if(0U != this_queue->rx_pool.active)
+    {
+        /* Top the ring back up in one pass now that the burst is done */
+        (void)rx_pool_fill(this_mac, (uint32_t)queue_no);
+    }
+#endif
+
+    if(0U == (this_mac->mac_base->NETWORK_CONTROL & GEM_ENABLE_RECEIVE))
+    {
+        this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
+    }
 
-            p_reg[comparer_no + 1] = temp_reg; /* Set second word of comparer */
-        }
+#if defined(MSS_MAC_PERF_STATS)
+    this_queue->perf.rx_desc_done += (uint64_t)(budget - burst);
+    if((budget - burst) > this_queue->perf.rx_ring_hwm)
+    {
+        this_queue->perf.rx_ring_hwm = budget - burst;
     }
+
+#endif
+    return(budget - burst);
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * This is default "Transmit packet interrupt handler. This function finds the
+ * descriptor that transmitted the packet and caused the interrupt.
+ * This relinquishes the packet buffer from the associated DMA descriptor.
+ *
+ * Returns the number of descriptors reclaimed.
  */
 
-void MSS_MAC_get_type_2_compare(const mss_mac_instance_t *this_mac, uint32_t comparer_no_in, mss_mac_type_2_compare_t *comparer)
+static uint32_t 
+txpkt_handler
+(
+        mss_mac_instance_t *this_mac, uint64_t queue_no
+)
 {
-    volatile uint32_t *p_reg;
-    uint32_t limit;
-    uint32_t comparer_no = comparer_no_in;
+#if defined(MSS_MAC_SIMPLE_TX_QUEUE)
+    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+    mss_mac_tx_desc_t *p_current_desc;
+    uint32_t finished;
+    uint32_t reclaimed = 0U;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    /*
+     * Simple multi packet TX queue where only the one packet buffer is used
+     * per frame but we do have 1 extra descriptor to stop DMA engine running
+     * over itself...
+     */
+
+#if defined(MSS_MAC_TX_BATCH)
+    uint32_t first_desc = this_queue->current_tx_desc;
+#endif
+
+    p_current_desc = &this_queue->tx_desc_tab[this_queue->current_tx_desc];
+    finished = 0;
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
+    ts_latch_secs(this_mac, queue_no);
+#endif
+    while(!finished)
     {
-        if(0U != this_mac->is_emac) /* eMAC limits are different to pMAC ones */
+        if(this_queue->nb_available_tx_desc == MSS_MAC_TX_RING_SIZE)
         {
-            p_reg = &this_mac->emac_base->TYPE2_COMPARE_0_WORD_0;
-            limit = MSS_MAC_EMAC_TYPE_2_COMPARERS;
+            *this_queue->transmit_q_ptr = (uint32_t)((uint64_t)this_queue->tx_desc_tab) | 1UL; /* Disable the TX queue */
+            finished = 1;
         }
         else
         {
-            p_reg = &this_mac->mac_base->TYPE2_COMPARE_0_WORD_0;
-            limit = MSS_MAC_TYPE_2_COMPARERS;
-        }
-
-        (void)memset(comparer, 0, sizeof(mss_mac_type_2_compare_t));
-        if(comparer_no < limit)
-        {
-            comparer_no *= 2U; /* Working with consecutive pairs of registers for this one */
-            if(0U != (p_reg[comparer_no + 1] & GEM_DISABLE_MASK))
-            {
-                comparer->data = p_reg[comparer_no]; /* Mask disabled so just 4 byte compare value */
-                comparer->disable_mask = 1;          /* and no mask */
-            }
-            else
-            {
-                comparer->data = p_reg[comparer_no] >> 16;     /* 16 bit compare value and 16 bit mask */
-                comparer->mask = (uint16_t)p_reg[comparer_no];
-            }
-
-            if(0U != (p_reg[comparer_no + 1U] & GEM_COMPARE_VLAN_ID))
+            if(p_current_desc->status & GEM_TX_DMA_USED)
             {
-                if(0U != (p_reg[comparer_no + 1U] & GEM_COMPARE_S_TAG))
-                {
-                    comparer->compare_vlan_s_id = 1U;
-                }
-                else
+#if defined(MSS_MAC_TX_BATCH)
+                /* Batch callback is made once for the lot below */
+                if((NULL_POINTER == this_queue->pckt_tx_batch_callback) && (NULL_POINTER != this_queue->pckt_tx_callback))
+#else
+                if(NULL_POINTER != this_queue->pckt_tx_callback)
+#endif
                 {
-                    comparer->compare_vlan_c_id = 1U;
+                    this_queue->pckt_tx_callback(this_mac, queue_no, p_current_desc, this_queue->tx_caller_info[this_queue->current_tx_desc]);
                 }
+                this_queue->nb_available_tx_desc++;
+                p_current_desc++;
+                this_queue->current_tx_desc++;
+                reclaimed++;
             }
             else
             {
-                comparer->compare_offset = (uint8_t)((p_reg[comparer_no + 1U] >> GEM_COMPARE_OFFSET_SHIFT) & BITS_02);
+                finished = 1;
             }
-
-            comparer->offset_value = (uint8_t)(p_reg[comparer_no + 1U] & GEM_OFFSET_VALUE);
         }
     }
+
+#if defined(MSS_MAC_TX_BATCH)
+    if((NULL_POINTER != this_queue->pckt_tx_batch_callback) && (first_desc != this_queue->current_tx_desc))
+    {
+        this_queue->pckt_tx_batch_callback(this_mac, queue_no, &this_queue->tx_desc_tab[first_desc],
+                                           &this_queue->tx_caller_info[first_desc],
+                                           this_queue->current_tx_desc - first_desc);
+    }
+#endif
+
+#if defined(MSS_MAC_PERF_STATS)
+    this_queue->perf.tx_desc_done += (uint64_t)reclaimed;
+#endif
+    return(reclaimed);
+#else    
+#error "Multi packet TX not implemented!"
+#endif
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Common transmit path for MSS_MAC_send_pkt() and MSS_MAC_send_pkt_gather().
+ *
+ * Simplified transmit operation which depends on the following assumptions:
+ * 
+ * 1. The TX DMA buffer size is big enough to contain each fragment.
+ * 2. We will only transmit one packet at a time.
+ * 3. We wait for any outstanding transmits on other queues to complete
+ *    because we need to ALWAYS write to the queue 0 pointer to trigger
+ *    internal restart of the DMA process.
+ *
+ * We do transmission by using one buffer descriptor per fragment followed by a
+ * dummy one with the USED bit set. This halts transmission once the packet is
+ * transmitted. We always reset the TX DMA to point to the first descriptor when
+ * we send a packet so we don't have to juggle buffer positions or worry about
+ * wrap.
+ *
+ * The GEM only writes back the USED bit to the first descriptor of a frame so
+ * the frame counts as a single descriptor as far as the transmit handler is
+ * concerned.
  */
-
-void MSS_MAC_set_type_2_filter(const mss_mac_instance_t *this_mac, uint32_t filter_no, const mss_mac_type_2_filter_t *filter)
+static int32_t
+send_frags
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_frag_t const *frags,
+    uint32_t frag_count,
+    int32_t no_crc,
+    void * p_user_data
+)
 {
-    volatile uint32_t *p_reg;
-    uint32_t limit;
-    uint32_t temp_reg = 0U;
+    int32_t status = MSS_MAC_ERR_NOT_DONE;
+    volatile int delay;
+    volatile uint32_t *p_nw_control;
+    volatile uint32_t *p_tx_status;
+    uint32_t index;
+    uint32_t tx_length = 0U;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    /* Make this function atomic w.r.to EMAC interrupt */
+    /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
+    if(0U == this_mac->queue[queue_no].in_isr)
     {
-        if(0U != this_mac->is_emac) /* eMAC limits are different to pMAC ones */
+        if(0U != this_mac->use_local_ints)
         {
-            p_reg = &this_mac->emac_base->SCREENING_TYPE_2_REGISTER_0;
-            limit = MSS_MAC_EMAC_TYPE_2_SCREENERS;
+            __disable_local_irq(this_mac->mac_q_int[queue_no]);
         }
         else
         {
-            p_reg = &this_mac->mac_base->SCREENING_TYPE_2_REGISTER_0;
-            limit = MSS_MAC_TYPE_2_SCREENERS;
+            PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]); /* Single interrupt from GEM? */
         }
+    }
 
-        if(filter_no < limit) /* Lets go build a filter... */
-        {
-            if(0u != (filter->drop_on_match))
-            {
-                temp_reg = GEM_T2_DROP_ON_MATCH;
-            }
-            else
-            {
-                temp_reg = 0U;
-            }
+    /* We use these a lot and this cuts down on conditional code later on */
+    if(0U != this_mac->is_emac)
+    {
+        p_nw_control = &this_mac->emac_base->NETWORK_CONTROL;
+        p_tx_status  = &this_mac->emac_base->TRANSMIT_STATUS;
+    }
+    else
+    {
+        p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
+        p_tx_status  = &this_mac->mac_base->TRANSMIT_STATUS;
+    }
 
-            if(0U != (filter->compare_a_enable))
-            {
-                temp_reg |= GEM_COMPARE_A_ENABLE;
-                temp_reg |= ((uint32_t)filter->compare_a_index & BITS_05) << GEM_COMPARE_A_SHIFT;
-            }
+#if defined(MSS_MAC_SIMPLE_TX_QUEUE)
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+    if(0U != this_mac->queue[queue_no].tx_reclaim_low_water)
+    {
+        (void)tx_reclaim_deferred(this_mac, queue_no);
+    }
 
-            if(0U != (filter->compare_b_enable))
-            {
-                temp_reg |= GEM_COMPARE_B_ENABLE;
-                temp_reg |= ((uint32_t)filter->compare_b_index & BITS_05) << GEM_COMPARE_B_SHIFT;
-            }
+#endif
+    if(this_mac->queue[queue_no].nb_available_tx_desc == (uint32_t)MSS_MAC_TX_RING_SIZE)
+    {
+        /* Queue is fully available for transmit so clear retry count */
+        this_mac->queue[queue_no].tries = 0UL;
 
-            if(0U != (filter->compare_c_enable))
+        /* Make sure transmit is enabled */
+        if(0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
             {
-                temp_reg |= GEM_COMPARE_C_ENABLE;
-                temp_reg |= ((uint32_t)filter->compare_c_index & BITS_05) << GEM_COMPARE_C_SHIFT;
+            *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
             }
+        /*
+         * Wait for pending transmits to complete as you cannot alter
+         * tx queue pointers while transmit is active...
+         */
+        while(0 != (*p_tx_status & GEM_TRANSMIT_GO))
+        {
+            delay++; /* Empty loop will cause debug issues... */
+        }
 
-            if(0U != (filter->ethertype_enable))
-            {
-                temp_reg |= GEM_ETHERTYPE_ENABLE;
-                temp_reg |= ((uint32_t)filter->ethertype_index & BITS_03) << GEM_ETHERTYPE_REG_INDEX_SHIFT;
-            }
+        /* Make sure queue is currently disabled */
+        *this_mac->queue[queue_no].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[queue_no].tx_desc_tab) | 1UL;
 
-            if(0U != (filter->vlan_priority_enable))
-            {
-                temp_reg |= GEM_VLAN_ENABLE;
-                temp_reg |= ((uint32_t)filter->vlan_priority & BITS_03) << GEM_VLAN_PRIORITY_SHIFT;
-            }
+        /* Set up tx descriptors for this packet, one per fragment */
+        this_mac->queue[queue_no].nb_available_tx_desc--;
+        this_mac->queue[queue_no].current_tx_desc = 0;
+        for(index = 0U; index != frag_count; index++)
+        {
+#if defined(MSS_MAC_CACHE_MAINTENANCE)
+            mss_l2_flush_range((uint64_t)frags[index].addr, frags[index].length);
+#endif
+            this_mac->queue[queue_no].tx_desc_tab[index].addr_low = (uint32_t)((uint64_t)frags[index].addr);
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+            this_mac->queue[queue_no].tx_desc_tab[index].addr_high = (uint32_t)((uint64_t)frags[index].addr >> 32);
+            this_mac->queue[queue_no].tx_desc_tab[index].unused    = 0U;
+#endif
+            this_mac->queue[queue_no].tx_desc_tab[index].status    = frags[index].length & GEM_TX_DMA_BUFF_LEN;
 
-            temp_reg |= (uint32_t)filter->queue_no & GEM_QUEUE_NUMBER;
+            tx_length += frags[index].length;
+        }
 
-            p_reg[filter_no] = temp_reg; /* Set filter up at last */
+        /* Mark as last buffer for frame, GEM only checks the CRC bit here */
+        this_mac->queue[queue_no].tx_desc_tab[frag_count - 1U].status |= GEM_TX_DMA_LAST;
+        if(0 != no_crc)
+        {
+            this_mac->queue[queue_no].tx_desc_tab[frag_count - 1U].status |= GEM_TX_DMA_NO_CRC;
         }
-    }
-}
+#if 0
+        this_mac->tx_desc_tab[0].status = (tx_length & GEM_TX_DMA_BUFF_LEN) | GEM_TX_DMA_LAST | GEM_TX_DMA_USED; /* PMCS deliberate error ! */
+#endif
 
+        this_mac->queue[queue_no].tx_desc_tab[frag_count].status = GEM_TX_DMA_WRAP | GEM_TX_DMA_LAST |  GEM_TX_DMA_USED ;
 
-/******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
- */
+        this_mac->queue[queue_no].tx_caller_info[0] = p_user_data;
 
-void MSS_MAC_get_type_2_filter(const mss_mac_instance_t *this_mac, uint32_t filter_no, mss_mac_type_2_filter_t *filter)
-{
-    volatile uint32_t *p_reg;
-    uint32_t limit;
+        *this_mac->queue[queue_no].transmit_q_ptr = (uint32_t)((uint64_t)&this_mac->queue[queue_no].tx_desc_tab[0]);
+        /*
+         * If not queue 0 then we need to write disabled value to queue 0 to
+         * get the DMA engine reloaded...
+         */
+        if(0 != queue_no)
+        {
+            *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1U;
+        }
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+        /* When transmitting at 10M, this delay is needed, 625MHz cpu clock - YMMV */
+        for(delay = 0; delay != 8; delay++)
+        {
+        }
+
+        *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+
+        MSS_STAT_ADD(this_mac->queue[queue_no].egress, tx_length);
+#if defined(MSS_MAC_PERF_STATS)
+        if(frag_count > this_mac->queue[queue_no].perf.tx_ring_hwm)
+        {
+            this_mac->queue[queue_no].perf.tx_ring_hwm = frag_count;
+        }
+#endif
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+        tx_reclaim_arm(this_mac, queue_no);
+#endif
+#if defined(MSS_MAC_CAPTURE)
+        mss_mac_capture_t *cap = this_mac->capture;
+
+        if((NULL_POINTER != cap) && (0U != (cap->flags & MSS_MAC_CAPTURE_TX)))
+        {
+            mss_mac_tsu_time_t tsu_time;
+
+            MSS_MAC_read_TSU(this_mac, &tsu_time);
+            capture_frags(cap, frags, frag_count, tx_length, &tsu_time);
+        }
+#endif
+        status = MSS_MAC_ERR_OK;
+    }
+    else
     {
-        (void)memset(filter, 0, sizeof(mss_mac_type_2_filter_t));
-        if(0U != this_mac->is_emac) /* eMAC limits are different to pMAC ones */
+        status = tx_queue_kick(this_mac, queue_no, p_nw_control);
+    }
+#else
+    /* TBD PMCS need to implement multi packet queuing... */
+#warning "Nothing implemented for multi packet tx yet"
+#endif
+    /* Ethernet Interrupt Enable function. */
+    /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
+    if(0U == this_mac->queue[queue_no].in_isr)
+    {
+        if(0U != this_mac->use_local_ints)
         {
-            p_reg = &this_mac->emac_base->SCREENING_TYPE_2_REGISTER_0;
-            limit = MSS_MAC_EMAC_TYPE_2_SCREENERS;
+            __enable_local_irq(this_mac->mac_q_int[queue_no]);
         }
         else
         {
-            p_reg = &this_mac->mac_base->SCREENING_TYPE_2_REGISTER_0;
-            limit = MSS_MAC_TYPE_2_SCREENERS;
+            PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]); /* Single interrupt from GEM? */
         }
+    }
 
-        if(filter_no < limit) /* Lets go fetch a filter... */
-        {
-            if(0U != (p_reg[filter_no] & GEM_T2_DROP_ON_MATCH))
-            {
-                filter->drop_on_match = 1;
-            }
+    return status;
+}
 
-            if(0U != (p_reg[filter_no] & GEM_COMPARE_A_ENABLE))
-            {
-                filter->compare_a_enable = 1;
-            }
 
-            if(0U != (p_reg[filter_no] & GEM_COMPARE_B_ENABLE))
-            {
-                filter->compare_b_enable = 1;
-            }
+/******************************************************************************
+ * Called when a send is attempted on a queue which is still busy with a
+ * previous transmission. Tries to get a stalled queue moving again and
+ * eventually gives up on the previous transmission if it never completes.
+ *
+ * Returns MSS_MAC_ERR_NOT_DONE if the queue may still complete normally or
+ * MSS_MAC_ERR_TX_TIMEOUT/MSS_MAC_ERR_TX_FAIL if the queue has been reset.
+ *
+ * The caller must already have masked the queue interrupt.
+ */
+static int32_t tx_queue_kick(mss_mac_instance_t *this_mac, uint32_t queue_no, volatile uint32_t *p_nw_control)
+{
+    int32_t status = MSS_MAC_ERR_NOT_DONE;
+    volatile int delay;
 
-            if(0U != (p_reg[filter_no] & GEM_COMPARE_C_ENABLE))
-            {
-                filter->compare_c_enable = 1;
-            }
+    /*
+     * Queue not available so lets check some things...
+     */
+    if(0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
+    {
+        /*
+         * TX is currently disabled so re-enable it and restart the last
+         * operation on this queue to see if that gets us a completion.
+         */
+        MSS_STAT_INC(this_mac->queue[queue_no].tx_reenable);
+        *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
+        *this_mac->queue[queue_no].transmit_q_ptr = (uint32_t)((uint64_t)&this_mac->queue[queue_no].tx_desc_tab[0]);
+        if(0 != queue_no)
+        {
+            *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1U;
+        }
+
+        /* When transmitting at 10M, this delay is needed, 625MHz cpu clock - YMMV */
+        for(delay = 0; delay != 8; delay++)
+        {
+        }
 
-            if(0U != (p_reg[filter_no] & GEM_ETHERTYPE_ENABLE))
-            {
-                filter->ethertype_enable = 1;
-            }
+        *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+    }
+    else
+    {
+        /* Kick the tx start bit in case we are stalled... */
+        MSS_STAT_INC(this_mac->queue[queue_no].tx_restart);
+        *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+    }
 
-            if(0U != (p_reg[filter_no] & GEM_VLAN_ENABLE))
-            {
-                filter->vlan_priority_enable = 1;
-            }
+    /*
+     * TX might have completed since we entered the function but if we
+     * seem to be spinning on this and buffers haven't been returned to
+     * the queue then just give up and reset queue.
+     */
+    if(this_mac->queue[queue_no].tx_desc_tab[0].status & GEM_TX_DMA_USED)
+    {
+        this_mac->queue[queue_no].tries++;
 
-            filter->compare_a_index = (uint8_t)((p_reg[filter_no] & GEM_COMPARE_A) >> GEM_COMPARE_A_SHIFT);
-            filter->compare_b_index = (uint8_t)((p_reg[filter_no] & GEM_COMPARE_B) >> GEM_COMPARE_B_SHIFT);
-            filter->compare_c_index = (uint8_t)((p_reg[filter_no] & GEM_COMPARE_C) >> GEM_COMPARE_C_SHIFT);
-            filter->ethertype_index = (uint8_t)((p_reg[filter_no] & GEM_ETHERTYPE_REG_INDEX) >> GEM_ETHERTYPE_REG_INDEX_SHIFT);
-            filter->vlan_priority   = (uint8_t)((p_reg[filter_no] & GEM_VLAN_PRIORITY) >> GEM_VLAN_PRIORITY_SHIFT);
-            filter->queue_no        = (uint8_t)(p_reg[filter_no] & GEM_QUEUE_NUMBER);
+        if(this_mac->queue[queue_no].tries > 3) /* Been here too often? */
+        {
+            /* Give up and reset FW queue count */
+            this_mac->queue[queue_no].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
+            status = MSS_MAC_ERR_TX_TIMEOUT;
         }
     }
+
+    if(this_mac->queue[queue_no].tx_desc_tab[0].status & (GEM_TX_DMA_RETRY_ERROR | GEM_TX_DMA_UNDERRUN | GEM_TX_DMA_BUS_ERROR | GEM_TX_DMA_LATE_COL_ERROR | GEM_TX_DMA_OFFLOAD_ERRORS))
+    {
+        /* Give up and reset FW queue count */
+        this_mac->queue[queue_no].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
+        status = MSS_MAC_ERR_TX_FAIL;
+    }
+
+    return status;
 }
 
 
+#if defined(MSS_MAC_TX_BATCH)
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Common transmit path for MSS_MAC_send_pkt_batch() and the SPSC transmit
+ * ring.
+ *
+ * Same descriptor scheme as MSS_MAC_send_pkt() but with one descriptor per
+ * packet, all built before the DMA is pointed at the start of the chain and
+ * kicked once. The dummy descriptor with USED and WRAP set after the last
+ * packet stops the DMA so the chain never wraps while in flight.
+ *
+ * Returns the number of packets accepted or the tx_queue_kick() status if the
+ * queue is still busy. The caller must have exclusive access to the queue.
  */
-
-void MSS_MAC_set_mmsl_mode(const mss_mac_instance_t *this_mac, const mss_mac_mmsl_config_t *mmsl_cfg)
+static int32_t
+tx_batch_post
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_pkt_info_t const *p_packets,
+    uint32_t pkt_count
+)
 {
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    mss_mac_queue_t *p_queue = &this_mac->queue[queue_no];
+    mss_mac_tx_desc_t *p_desc;
+    volatile int delay;
+    volatile uint32_t *p_nw_control;
+    volatile uint32_t *p_tx_status;
+    uint32_t index;
+    uint32_t tx_count;
+    uint32_t tx_length;
+    uint64_t tx_bytes = 0U;
+    int32_t status;
+
+    if(0U != this_mac->is_emac)
     {
-        if(0U != mmsl_cfg->preemption) /* Preemption is enabled so deal with it */
+        p_nw_control = &this_mac->emac_base->NETWORK_CONTROL;
+        p_tx_status  = &this_mac->emac_base->TRANSMIT_STATUS;
+    }
+    else
+    {
+        p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
+        p_tx_status  = &this_mac->mac_base->TRANSMIT_STATUS;
+    }
+
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+    if(0U != p_queue->tx_reclaim_low_water)
+    {
+        (void)tx_reclaim_deferred(this_mac, queue_no);
+    }
+
+#endif
+    if(p_queue->nb_available_tx_desc == (uint32_t)MSS_MAC_TX_RING_SIZE)
+    {
+        /* Back pressure - take what fits and leave room for the dummy */
+        tx_count = pkt_count;
+        if(tx_count > ((uint32_t)MSS_MAC_TX_RING_SIZE - 1U))
         {
-            /*
-             * Need to shut preemption down in case it is already enabled
-             * otherwise the new settings may not be recognised properly.
-             */
-            this_mac->mac_base->MMSL_CONTROL = 0U;
+            tx_count = (uint32_t)MSS_MAC_TX_RING_SIZE - 1U;
+        }
 
-            if(0U != mmsl_cfg->verify_disable)
-            {
-                this_mac->mac_base->MMSL_CONTROL |= ((uint32_t)(mmsl_cfg->frag_size)) | GEM_VERIFY_DISABLE;
-                this_mac->mac_base->MMSL_CONTROL |= GEM_PRE_ENABLE;
-            }
-            else
-            {
-                this_mac->mac_base->MMSL_CONTROL |= (uint32_t)(mmsl_cfg->frag_size);
-                this_mac->mac_base->MMSL_CONTROL |= GEM_PRE_ENABLE;
-            }
+        p_queue->tries = 0UL;
+
+        /* Make sure transmit is enabled */
+        if(0U == (*p_nw_control & GEM_ENABLE_TRANSMIT))
+        {
+            *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
         }
-        else /* Preemption is not enabled so see which MAC we want to use */
+
+        /*
+         * Wait for pending transmits to complete as you cannot alter
+         * tx queue pointers while transmit is active...
+         */
+        while(0U != (*p_tx_status & GEM_TRANSMIT_GO))
         {
-            if(0U != mmsl_cfg->use_pmac)
-            {
-                this_mac->mac_base->MMSL_CONTROL = GEM_ROUTE_RX_TO_PMAC;
-            }
-            else
+            delay++; /* Empty loop will cause debug issues... */
+        }
+
+        /* Make sure queue is currently disabled */
+        *p_queue->transmit_q_ptr = (uint32_t)((uint64_t)p_queue->tx_desc_tab) | 1UL;
+
+        for(index = 0U; index != tx_count; index++)
+        {
+            tx_length = p_packets[index].length;
+            ASSERT(NULL_POINTER != p_packets[index].tx_buffer);
+            ASSERT(0U != (tx_length & 0x7FFFFFFFU));
+            ASSERT(IS_WORD_ALIGNED(p_packets[index].tx_buffer));
+
+            p_desc = &p_queue->tx_desc_tab[index];
+#if defined(MSS_MAC_CACHE_MAINTENANCE)
+            mss_l2_flush_range((uint64_t)p_packets[index].tx_buffer, tx_length & 0x7FFFFFFFU);
+#endif
+            p_desc->addr_low = (uint32_t)((uint64_t)p_packets[index].tx_buffer);
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+            p_desc->addr_high = (uint32_t)((uint64_t)p_packets[index].tx_buffer >> 32);
+            p_desc->unused    = 0U;
+#endif
+            /* Single buffer per frame so always the last buffer */
+            p_desc->status = (tx_length & GEM_TX_DMA_BUFF_LEN) | GEM_TX_DMA_LAST;
+            if((MSS_MAC_CRC_DISABLE == this_mac->append_CRC) || (0U != (tx_length & 0x80000000U)))
             {
-                this_mac->mac_base->MMSL_CONTROL = 0U;
+                p_desc->status |= GEM_TX_DMA_NO_CRC;
             }
+
+            p_queue->tx_caller_info[index] = p_packets[index].p_user_data;
+            tx_bytes += (uint64_t)(tx_length & GEM_TX_DMA_BUFF_LEN);
         }
-    }
-}
 
+        p_queue->tx_desc_tab[tx_count].status = GEM_TX_DMA_WRAP | GEM_TX_DMA_LAST | GEM_TX_DMA_USED;
 
-/******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
- */
+        p_queue->nb_available_tx_desc -= tx_count;
+        p_queue->current_tx_desc = 0U;
 
-void MSS_MAC_get_mmsl_mode(const mss_mac_instance_t *this_mac, mss_mac_mmsl_config_t *mmsl_cfg)
-{
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
-    {
-        (void)memset(mmsl_cfg, 0, sizeof(mss_mac_mmsl_config_t));
-        if(0U != (this_mac->mac_base->MMSL_CONTROL & GEM_ROUTE_RX_TO_PMAC))
+        /* Descriptors must be in memory before the DMA is started */
+        mb();
+
+        *p_queue->transmit_q_ptr = (uint32_t)((uint64_t)&p_queue->tx_desc_tab[0]);
+        /*
+         * If not queue 0 then we need to write disabled value to queue 0 to
+         * get the DMA engine reloaded...
+         */
+        if(0U != queue_no)
         {
-            mmsl_cfg->use_pmac = 1U;
+            *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1U;
         }
 
-        if(0U != (this_mac->mac_base->MMSL_CONTROL & GEM_PRE_ENABLE))
+        /* When transmitting at 10M, this delay is needed, 625MHz cpu clock - YMMV */
+        for(delay = 0; delay != 8; delay++)
         {
-            mmsl_cfg->preemption = 1U;
         }
 
-        if(0U != (this_mac->mac_base->MMSL_CONTROL & GEM_VERIFY_DISABLE))
+        *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+
+        MSS_STAT_ADD(p_queue->egress, tx_bytes);
+#if defined(MSS_MAC_PERF_STATS)
+        if(tx_count > p_queue->perf.tx_ring_hwm)
         {
-            mmsl_cfg->verify_disable = 1U;
+            p_queue->perf.tx_ring_hwm = tx_count;
         }
-
-        mmsl_cfg->frag_size = (mss_mac_frag_size_t)(this_mac->mac_base->MMSL_CONTROL & BITS_02);
+#endif
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+        tx_reclaim_arm(this_mac, queue_no);
+#endif
+        status = (int32_t)tx_count;
+    }
+    else
+    {
+        status = tx_queue_kick(this_mac, queue_no, p_nw_control);
     }
+
+    return status;
 }
+#endif /* defined(MSS_MAC_TX_BATCH) */
 
 
+#if defined(MSS_MAC_TX_SPSC_RING)
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Move packets from a queue's SPSC ring onto its DMA descriptors, reclaiming
+ * any sent descriptors first. Called from MSS_MAC_tx_ring_push() and from the
+ * transmit interrupt without masking interrupts.
+ *
+ * Only one context can hold the busy flag. A context which finds it taken
+ * leaves pending set and the holder goes round again once it has released the
+ * flag, so no request is lost and nobody spins waiting for anybody else.
  */
-
-void MSS_MAC_start_preemption_verify(const mss_mac_instance_t *this_mac)
+static void tx_spsc_service(mss_mac_instance_t *this_mac, uint32_t queue_no)
 {
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    mss_mac_queue_t *p_queue = &this_mac->queue[queue_no];
+    mss_mac_tx_spsc_t *p_ring = &p_queue->tx_spsc;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t count;
+    int32_t sent;
+    bool again = true;
+
+    atomic_set(&p_ring->pending, 1U);
+    mb();
+
+    while(again)
     {
-        if(0U != (this_mac->mac_base->MMSL_CONTROL & GEM_PRE_ENABLE)) /* Preemption is enabled */
+        again = false;
+        if(0U == atomic_swap(&p_ring->busy, 1U))
         {
-            this_mac->mac_base->MMSL_CONTROL |= GEM_RESTART_VER;
+            atomic_set(&p_ring->pending, 0U);
+            mb();
+
+            if(p_queue->nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
+            {
+                (void)txpkt_handler(this_mac, queue_no);
+            }
+
+            head = atomic_read(&p_ring->head);
+            tail = p_ring->tail;
+            if((head != tail) && (p_queue->nb_available_tx_desc == (uint32_t)MSS_MAC_TX_RING_SIZE))
+            {
+                /* Only post up to the end of the ring, the rest goes next time */
+                count = head - tail;
+                if(count > (MSS_MAC_TX_SPSC_SIZE - (tail & (MSS_MAC_TX_SPSC_SIZE - 1U))))
+                {
+                    count = MSS_MAC_TX_SPSC_SIZE - (tail & (MSS_MAC_TX_SPSC_SIZE - 1U));
+                }
+
+                sent = tx_batch_post(this_mac, queue_no, &p_ring->entry[tail & (MSS_MAC_TX_SPSC_SIZE - 1U)], count);
+                if(sent > 0)
+                {
+                    /* Entries are no longer read once the descriptors are built */
+                    mb();
+                    atomic_set(&p_ring->tail, tail + (uint32_t)sent);
+                }
+            }
+
+            mb();
+            atomic_set(&p_ring->busy, 0U);
+            mb();
+
+            if(0U != atomic_read(&p_ring->pending))
+            {
+                again = true;
+            }
         }
     }
 }
+#endif /* defined(MSS_MAC_TX_SPSC_RING) */
 
-
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Reclaim sent descriptors outside of the transmit interrupt. The caller must
+ * already have masked the queue interrupt.
+ *
+ * The in_isr flag is set while the callbacks run so that a callback which
+ * sends another packet doesn't unmask the queue interrupt underneath us.
  */
-
-uint32_t MSS_MAC_get_mmsl_status(const mss_mac_instance_t *this_mac)
+static uint32_t tx_reclaim_deferred(mss_mac_instance_t *this_mac, uint32_t queue_no)
 {
-    uint32_t ret_val = 0U;
+    mss_mac_queue_t *p_queue = &this_mac->queue[queue_no];
+    int32_t in_isr;
+    uint32_t reclaimed = 0U;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    if(p_queue->nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
     {
-        ret_val = this_mac->mac_base->MMSL_STATUS; /* Just return raw value, user can decode using defined bits */
-    }
-
-    return(ret_val);
-}
+        in_isr = p_queue->in_isr;
+        p_queue->in_isr = 1;
 
+        *p_queue->int_status = GEM_TRANSMIT_COMPLETE; /* Stale if masked so clear it */
+        reclaimed = txpkt_handler(this_mac, queue_no);
 
-/******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
- */
+        p_queue->in_isr = in_isr;
 
-void MSS_MAC_get_mmsl_stats(const mss_mac_instance_t *this_mac, mss_mac_mmsl_stats_t *stats)
-{
-    /*
-     * We return these differently to the general statistics as they are pMAC
-     * specific and don't have a corresponding eMAC equivalent.
-     */
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
-    {
-        (void)memset(stats, 0, sizeof(mss_mac_mmsl_stats_t));
-        stats->smd_err_count = (this_mac->mac_base->MMSL_ERR_STATS & GEM_SMD_ERR_COUNT) >> GEM_SMD_ERR_COUNT_SHIFT;
-        stats->ass_err_count = this_mac->mac_base->MMSL_ERR_STATS & GEM_ASS_ERR_COUNT;
-        stats->ass_ok_count  = this_mac->mac_base->MMSL_ASS_OK_COUNT;
-        stats->frag_count_rx = this_mac->mac_base->MMSL_FRAG_COUNT_RX;
-        stats->frag_count_tx = this_mac->mac_base->MMSL_FRAG_COUNT_TX;
+        if(0U != reclaimed)
+        {
+            p_queue->tx_deferred_reclaims++;
+        }
     }
+
+    return(reclaimed);
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Decide whether the transmit just started needs the TX complete interrupt to
+ * reclaim it or whether it can wait for the next send.
  */
-
-void MSS_MAC_set_tx_cutthru(const mss_mac_instance_t *this_mac, uint32_t level)
+static void tx_reclaim_arm(mss_mac_instance_t *this_mac, uint32_t queue_no)
 {
-    volatile uint32_t *p_reg;
-    uint32_t mask;
+    mss_mac_queue_t *p_queue = &this_mac->queue[queue_no];
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    if(0U != p_queue->tx_reclaim_low_water)
     {
-        p_reg = (0U != this_mac->is_emac) ? &this_mac->emac_base->PBUF_TXCUTTHRU : &this_mac->mac_base->PBUF_TXCUTTHRU;
-        mask  = (0U != this_mac->is_emac) ? GEM_DMA_EMAC_CUTTHRU_THRESHOLD : GEM_DMA_TX_CUTTHRU_THRESHOLD;
-
-        if(0U == level) /* Disabling cutthru? */
+        if(p_queue->nb_available_tx_desc <= p_queue->tx_reclaim_low_water)
         {
-            *p_reg = 0U;
+            p_queue->tx_reclaim_armed = 1U;
+            *p_queue->int_enable = GEM_TRANSMIT_COMPLETE;
         }
         else
         {
-            *p_reg = GEM_DMA_CUTTHRU | (level & mask);
+            p_queue->tx_reclaim_armed = 0U;
+            *p_queue->int_disable = GEM_TRANSMIT_COMPLETE;
         }
     }
 }
+#endif /* defined(MSS_MAC_TX_DEFERRED_RECLAIM) */
 
 
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Latch the TSU seconds for the time stamps of the descriptors about to be
+ * worked through on a queue. Done once per pass of a ring so the callbacks
+ * don't need to go to the TSU for each packet.
  */
-
-void MSS_MAC_set_rx_cutthru(const mss_mac_instance_t *this_mac, uint32_t level)
+static void ts_latch_secs(mss_mac_instance_t *this_mac, uint64_t queue_no)
 {
-    volatile uint32_t *p_reg;
-    uint32_t mask;
+    uint32_t secs_lsb;
+    uint32_t secs_msb;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    if(0U != this_mac->is_emac)
     {
-        p_reg = (0U != this_mac->is_emac) ? &this_mac->emac_base->PBUF_RXCUTTHRU : &this_mac->mac_base->PBUF_RXCUTTHRU;
-        mask  = (0U != this_mac->is_emac) ? GEM_DMA_EMAC_CUTTHRU_THRESHOLD : GEM_DMA_RX_CUTTHRU_THRESHOLD;
-
-        if(0U == level) /* Disabling cutthru? */
+        do
         {
-            *p_reg = 0U;
-        }
-        else
+            secs_lsb = this_mac->emac_base->TSU_TIMER_SEC;
+            secs_msb = this_mac->emac_base->TSU_TIMER_MSB_SEC;
+        } while(secs_lsb != this_mac->emac_base->TSU_TIMER_SEC);
+    }
+    else
+    {
+        do
         {
-            *p_reg = GEM_DMA_CUTTHRU | (level & mask);
-        }
+            secs_lsb = this_mac->mac_base->TSU_TIMER_SEC;
+            secs_msb = this_mac->mac_base->TSU_TIMER_MSB_SEC;
+        } while(secs_lsb != this_mac->mac_base->TSU_TIMER_SEC);
     }
+
+    this_mac->queue[queue_no].ts_secs_ref = ((uint64_t)secs_msb << 32) | (uint64_t)secs_lsb;
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Build the full TSU time from the 6 bits of seconds in a descriptor time
+ * stamp. The seconds taken are those nearest the latched count so stamps
+ * from up to 32 seconds either side of the latch come out right.
  */
-
-uint32_t MSS_MAC_get_tx_cutthru(const mss_mac_instance_t *this_mac)
+static void ts_expand(uint64_t secs_ref, uint32_t ts_word_0, uint32_t ts_word_1, mss_mac_tsu_time_t *tsu_time)
 {
-    uint32_t temp_reg = 0U;
-    volatile uint32_t *p_reg;
-    uint32_t mask;
+    uint64_t ts_secs;
+    uint64_t delta;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    ts_secs = (uint64_t)(ts_word_0 >> DESC_TS_SECS_LO_SHIFT) |
+              ((uint64_t)(ts_word_1 & DESC_TS_SECS_HI_MASK) << 2);
+    delta   = (ts_secs - secs_ref) & DESC_TS_SECS_MASK;
+    ts_secs = secs_ref + delta;
+    if(delta >= DESC_TS_SECS_HALF)
     {
-        p_reg = (0U != this_mac->is_emac) ? &this_mac->emac_base->PBUF_TXCUTTHRU : &this_mac->mac_base->PBUF_TXCUTTHRU;
-        mask  = (0U != this_mac->is_emac) ? GEM_DMA_EMAC_CUTTHRU_THRESHOLD : GEM_DMA_TX_CUTTHRU_THRESHOLD;
-
-        temp_reg = *p_reg;
-        if(0U == (temp_reg & GEM_DMA_CUTTHRU))
-        {
-            temp_reg = 0U;
-        }
-        else
-        {
-            temp_reg &= mask;
-        }
+        ts_secs -= (DESC_TS_SECS_MASK + 1ULL);
     }
 
-    return(temp_reg);
+    tsu_time->secs_msb    = (uint32_t)(ts_secs >> 32);
+    tsu_time->secs_lsb    = (uint32_t)ts_secs;
+    tsu_time->nanoseconds = ts_word_0 & DESC_TS_NSEC_MASK;
 }
+#endif /* defined(MSS_MAC_DESC_TIMESTAMPS) */
 
 
+#if defined(MSS_MAC_RX_CHAINED)
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Receive handler for frames spread over several buffers. A frame is only
+ * taken off the ring once the buffer holding its end has been received. The
+ * buffers of a frame cut short by the start of another, or too long for the
+ * chain, are handed straight back to the ring.
+ *
+ * At most budget frames are processed and the number of frames actually
+ * processed is returned.
  */
-
-uint32_t MSS_MAC_get_rx_cutthru(const mss_mac_instance_t *this_mac)
+static uint32_t rx_chain_handler(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t budget)
 {
-    uint32_t temp_reg = 0U;
-    volatile uint32_t *p_reg;
-    uint32_t mask;
+    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+    mss_mac_rx_desc_t *cdesc;
+    uint32_t status;
+    uint32_t count = 0U;
+    uint32_t drop;
+    uint32_t frames = 0U;
+    uint32_t waiting = 0U;
+
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
+    ts_latch_secs(this_mac, queue_no);
+#endif
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    while((frames < budget) && (0U == waiting))
     {
-        p_reg = (0U != this_mac->is_emac) ? &this_mac->emac_base->PBUF_RXCUTTHRU : &this_mac->mac_base->PBUF_RXCUTTHRU;
-        mask  = (0U != this_mac->is_emac) ? GEM_DMA_EMAC_CUTTHRU_THRESHOLD : GEM_DMA_RX_CUTTHRU_THRESHOLD;
-
-        temp_reg = *p_reg;
-        if(0U == (temp_reg & GEM_DMA_CUTTHRU))
+        cdesc = &this_queue->rx_desc_tab[(this_queue->first_rx_desc_index + count) % MSS_MAC_RX_RING_SIZE];
+        if(0U == (cdesc->addr_low & GEM_RX_DMA_USED))
         {
-            temp_reg = 0U;
+            waiting = 1U; /* The rest of the frame, if any, is still to come */
         }
         else
         {
-            temp_reg &= mask;
+            status = cdesc->status;
+            drop = 0U;
+
+            if((0U != count) && (0U != (status & GEM_RX_DMA_START_OF_FRAME)))
+            {
+                drop = count; /* Frame so far never got its end */
+            }
+            else if((0U == count) && (0U == (status & GEM_RX_DMA_START_OF_FRAME)))
+            {
+                drop = 1U;    /* Tail of a frame we never saw start */
+            }
+            else if(0U != (status & GEM_RX_DMA_END_OF_FRAME))
+            {
+                rx_chain_deliver(this_mac, queue_no, count + 1U, cdesc);
+                frames++;
+                count = 0U;
+            }
+            else if((count + 1U) >= MSS_MAC_RX_CHAIN_MAX)
+            {
+                drop = count + 1U;
+            }
+            else
+            {
+                count++;
+            }
+
+            if(0U != drop)
+            {
+                rx_chain_take(this_mac, queue_no, drop, 0U, 0U);
+                rx_chain_recycle(this_mac, queue_no, drop);
+                this_queue->rx_chain_dropped++;
+                count = 0U;
+            }
         }
     }
 
-    return(temp_reg);
+    return(frames);
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Take count buffers off the head of the receive ring, recording them in the
+ * chain with the part of a pckt_length frame each holds. If hdr_length is not
+ * 0 the first buffer holds just the hdr_length bytes of split off headers.
  */
-
-void MSS_MAC_tx_enable(const mss_mac_instance_t *this_mac)
+static void rx_chain_take(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t count, uint32_t pckt_length,
+                          uint32_t hdr_length)
 {
-    /* Don't do this if already done in case it has side effects... */
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+    mss_mac_rx_desc_t *cdesc;
+    uint32_t remaining = pckt_length;
+    uint32_t inc;
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+    uint64_t addr_temp;
+#else
+    uint32_t addr_temp;
+#endif
+
+    for(inc = 0U; inc < count; inc++)
     {
-        if(0U != this_mac->is_emac)
+        cdesc = &this_queue->rx_desc_tab[this_queue->first_rx_desc_index];
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+        addr_temp  = (uint64_t)(cdesc->addr_low & ~(GEM_RX_DMA_WRAP | GEM_RX_DMA_USED | GEM_RX_DMA_TS_PRESENT));
+        addr_temp |= (uint64_t)cdesc->addr_high << 32;
+#else
+        addr_temp = (cdesc->addr_low & ~(GEM_RX_DMA_WRAP | GEM_RX_DMA_USED | GEM_RX_DMA_TS_PRESENT));
+#endif
+        this_queue->rx_chain[inc].addr        = (uint8_t *)addr_temp;
+        if((0U == inc) && (0U != hdr_length))
         {
-            if(0U == (this_mac->emac_base->NETWORK_CONTROL & GEM_ENABLE_TRANSMIT))
-            {
-                this_mac->emac_base->NETWORK_CONTROL |= GEM_ENABLE_TRANSMIT;
-            }
+            this_queue->rx_chain[inc].length  = hdr_length;
         }
         else
         {
-            if(0U == (this_mac->mac_base->NETWORK_CONTROL & GEM_ENABLE_TRANSMIT))
-            {
-                this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_TRANSMIT;
-            }
+            this_queue->rx_chain[inc].length  = (remaining > MSS_MAC_RX_CHAIN_BUF_SIZE) ? MSS_MAC_RX_CHAIN_BUF_SIZE : remaining;
         }
+        this_queue->rx_chain[inc].p_user_data = this_queue->rx_caller_info[this_queue->first_rx_desc_index];
+        remaining -= this_queue->rx_chain[inc].length;
+#if defined(MSS_MAC_CACHE_MAINTENANCE)
+        mss_l2_invalidate_range((uint64_t)addr_temp, this_queue->rx_chain[inc].length);
+#endif
+
+        ++this_queue->nb_available_rx_desc;
+        ++this_queue->first_rx_desc_index;
+        this_queue->first_rx_desc_index %= MSS_MAC_RX_RING_SIZE;
     }
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Hand the first count buffers of the chain back to the receive ring.
  */
+static void rx_chain_recycle(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t count)
+{
+    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+    uint32_t inc;
 
-void MSS_MAC_set_jumbo_frames_mode(const mss_mac_instance_t *this_mac, bool state)
+    for(inc = 0U; inc < count; inc++)
+    {
+        (void)MSS_MAC_receive_pkt(this_mac, (uint32_t)queue_no, this_queue->rx_chain[inc].addr,
+                                  this_queue->rx_chain[inc].p_user_data, MSS_MAC_INT_ENABLE);
+    }
+}
+
+
+/******************************************************************************
+ * Pass a complete frame of count buffers, ending with cdesc, up to the
+ * application.
+ */
+static void rx_chain_deliver(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t count, mss_mac_rx_desc_t *cdesc)
 {
-    volatile uint32_t *p_reg = &this_mac->mac_base->NETWORK_CONFIG;
+    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+    uint32_t pckt_length;
+    uint32_t hdr_length = 0U;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    pckt_length = cdesc->status & (GEM_RX_DMA_BUFF_LEN | GEM_RX_DMA_JUMBO_BIT_13);
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+    hdr_length = rx_hdr_length(this_mac, queue_no, count, pckt_length);
+#endif
+    rx_chain_take(this_mac, queue_no, count, pckt_length, hdr_length);
+    MSS_STAT_ADD(this_queue->ingress, pckt_length);
+#if defined(MSS_MAC_CAPTURE)
+    mss_mac_capture_t *cap = this_mac->capture;
+
+    if((NULL_POINTER != cap) && (0U != (cap->flags & MSS_MAC_CAPTURE_RX)))
     {
-        if(0U != this_mac->is_emac)
-        {
-            p_reg = &this_mac->emac_base->NETWORK_CONFIG;
-        }
+        mss_mac_tx_frag_t frags[MSS_MAC_RX_CHAIN_MAX];
+        mss_mac_tsu_time_t tsu_time;
+        uint32_t inc;
 
-        if(0U != this_mac->jumbo_frame_enable) /* Only look at this if the feature is enabled in config */
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
+        if(MSS_MAC_SUCCESS != MSS_MAC_get_rx_timestamp(this_mac, (uint32_t)queue_no, cdesc, &tsu_time))
+#endif
         {
-            if(state)
-            {
-                *p_reg |= GEM_JUMBO_FRAMES;
-            }
-            else
-            {
-                *p_reg &= ~GEM_JUMBO_FRAMES;
-            }
+            MSS_MAC_read_TSU(this_mac, &tsu_time);
         }
-        else /* Ensure it is disabled if not allowed... */
+        for(inc = 0U; inc != count; inc++)
         {
-            *p_reg &= ~GEM_JUMBO_FRAMES;
+            frags[inc].addr = this_queue->rx_chain[inc].addr;
+            frags[inc].length = this_queue->rx_chain[inc].length;
         }
+        capture_frags(cap, frags, count, pckt_length, &tsu_time);
     }
-}
+#endif
 
+    if(0U != this_mac->rx_discard)
+    {
+        rx_chain_recycle(this_mac, queue_no, count);
+    }
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+    else if(0U != hdr_length)
+    {
+        rx_hdr_deliver(this_mac, queue_no, count, hdr_length, pckt_length, cdesc);
+    }
+#endif
+    else if(NULL_POINTER != this_queue->pckt_rx_chain_callback)
+    {
+        this_queue->pckt_rx_chain_callback(this_mac, (uint32_t)queue_no, this_queue->rx_chain, count, pckt_length, cdesc);
+    }
+    else if((1U == count) && (NULL_POINTER != this_queue->pckt_rx_callback))
+    {
+        this_queue->pckt_rx_callback(this_mac, (uint32_t)queue_no, this_queue->rx_chain[0].addr, pckt_length, cdesc, this_queue->rx_chain[0].p_user_data);
+    }
+    else
+    {
+        rx_chain_recycle(this_mac, queue_no, count);
+        this_queue->rx_chain_dropped++;
+    }
+}
+#endif /* defined(MSS_MAC_RX_CHAINED) */
 
+#if defined(MSS_MAC_RX_HDR_SPLIT)
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Work out whether the count buffers at the head of the receive ring hold a
+ * frame the MAC split and return the length of its headers, or 0 if the frame
+ * is to be handled as an ordinary chain.
+ *
+ * The header length is taken from the frame itself and is only believed if
+ * the rest of the frame then needs exactly the other buffers, as a frame
+ * received before the split was turned on would not.
  */
-
-bool MSS_MAC_get_jumbo_frames_mode(const mss_mac_instance_t *this_mac)
+static uint32_t rx_hdr_length(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t count, uint32_t pckt_length)
 {
-    bool ret_val = false;
-    volatile uint32_t *p_reg = &this_mac->mac_base->NETWORK_CONFIG;
+    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+    mss_mac_rx_desc_t *cdesc;
+    uint32_t hdr_length = 0U;
+    uint32_t avail;
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+    uint64_t addr_temp;
+#else
+    uint32_t addr_temp;
+#endif
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    if((NULL_POINTER != this_queue->pckt_rx_split_callback) && (count > 1U))
     {
-        if(0U != this_mac->is_emac)
+        cdesc = &this_queue->rx_desc_tab[this_queue->first_rx_desc_index];
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+        addr_temp  = (uint64_t)(cdesc->addr_low & ~(GEM_RX_DMA_WRAP | GEM_RX_DMA_USED | GEM_RX_DMA_TS_PRESENT));
+        addr_temp |= (uint64_t)cdesc->addr_high << 32;
+#else
+        addr_temp = (cdesc->addr_low & ~(GEM_RX_DMA_WRAP | GEM_RX_DMA_USED | GEM_RX_DMA_TS_PRESENT));
+#endif
+        avail = (pckt_length > MSS_MAC_RX_HDR_SIZE) ? MSS_MAC_RX_HDR_SIZE : pckt_length;
+#if defined(MSS_MAC_CACHE_MAINTENANCE)
+        mss_l2_invalidate_range((uint64_t)addr_temp, avail);
+#endif
+        hdr_length = rx_hdr_parse((const uint8_t *)addr_temp, avail);
+
+        if((0U != hdr_length) &&
+           ((count - 1U) != (((pckt_length - hdr_length) + MSS_MAC_RX_CHAIN_BUF_SIZE - 1U) / MSS_MAC_RX_CHAIN_BUF_SIZE)))
         {
-            p_reg = &this_mac->emac_base->NETWORK_CONFIG;
+            hdr_length = 0U;
         }
-
-        ret_val = ((*p_reg & GEM_JUMBO_FRAMES) != 0U);
     }
 
-    return(ret_val);
+    return(hdr_length);
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Return the length of the Ethernet, IP and TCP or UDP headers at the start of
+ * a frame, or 0 if the frame is not one the MAC splits or the headers do not
+ * fit in the avail bytes looked at.
  */
-
-void MSS_MAC_set_jumbo_frame_length(const mss_mac_instance_t *this_mac, uint32_t length_in)
+static uint32_t rx_hdr_parse(const uint8_t *p_frame, uint32_t avail)
 {
-    volatile uint32_t *p_reg = &this_mac->mac_base->JUMBO_MAX_LENGTH;
-    uint32_t length = length_in; /* Avoids warning about modifying parameter passed by value */
+    uint32_t offset = HDR_ETH_SIZE;
+    uint32_t ethertype;
+    uint32_t protocol = 0U;
+    uint32_t hdr_length = 0U;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    if(avail >= HDR_ETH_SIZE)
     {
-        if(0U != this_mac->is_emac)
+        ethertype = ((uint32_t)p_frame[HDR_ETHERTYPE_OFFSET] << 8) | (uint32_t)p_frame[HDR_ETHERTYPE_OFFSET + 1U];
+        while(((HDR_ETHERTYPE_VLAN == ethertype) || (HDR_ETHERTYPE_QINQ == ethertype)) &&
+              ((offset + HDR_VLAN_SIZE) <= avail))
         {
-            p_reg = &this_mac->emac_base->JUMBO_MAX_LENGTH;
+            ethertype = ((uint32_t)p_frame[offset + 2U] << 8) | (uint32_t)p_frame[offset + 3U];
+            offset += HDR_VLAN_SIZE;
         }
 
-        /* Set up maximum jumbo frame size - but bounds check first  */
-        if(length > MSS_MAC_JUMBO_MAX)
+        if((HDR_ETHERTYPE_IPV4 == ethertype) && ((offset + HDR_IPV4_MIN_SIZE) <= avail))
         {
-            length = MSS_MAC_JUMBO_MAX;
+            /* Only the first fragment carries the TCP or UDP header */
+            if(0U == ((((uint32_t)p_frame[offset + 6U] << 8) | (uint32_t)p_frame[offset + 7U]) & HDR_IPV4_FRAG_MASK))
+            {
+                protocol = p_frame[offset + 9U];
+            }
+            offset += ((uint32_t)p_frame[offset] & 0x0FU) * 4U;
+        }
+        else if((HDR_ETHERTYPE_IPV6 == ethertype) && ((offset + HDR_IPV6_SIZE) <= avail))
+        {
+            protocol = p_frame[offset + 6U];
+            offset += HDR_IPV6_SIZE;
+        }
+        else
+        {
+            /* Not split */
         }
 
-        if(0U != this_mac->jumbo_frame_enable) /* Only look at this if the feature is enabled in config */
+        if((HDR_PROTOCOL_TCP == protocol) && ((offset + HDR_TCP_MIN_SIZE) <= avail))
         {
-            *p_reg = length;
+            hdr_length = offset + (((uint32_t)p_frame[offset + 12U] >> 4) * 4U);
         }
-        else /* Ensure it is set to reset value if not allowed... */
+        else if((HDR_PROTOCOL_UDP == protocol) && ((offset + HDR_UDP_SIZE) <= avail))
         {
-            *p_reg = MSS_MAC_JUMBO_MAX;
+            hdr_length = offset + HDR_UDP_SIZE;
+        }
+        else
+        {
+            /* Not split */
+        }
+
+        if(hdr_length > avail)
+        {
+            hdr_length = 0U;
         }
     }
+
+    return(hdr_length);
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Pass a split frame of count buffers, ending with cdesc, up to the
+ * application. The headers are copied into a free header pool slot and their
+ * buffer goes straight back to the ring, the payload buffers are handed over.
  */
-
-uint32_t MSS_MAC_get_jumbo_frame_length(const mss_mac_instance_t *this_mac)
+static void rx_hdr_deliver(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t count, uint32_t hdr_length,
+                           uint32_t pckt_length, mss_mac_rx_desc_t *cdesc)
 {
-    uint32_t ret_val = 0;
-    volatile uint32_t *p_reg = &this_mac->mac_base->JUMBO_MAX_LENGTH;
+    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+    uint32_t slot = this_queue->rx_hdr_next;
+    uint32_t tries = 0U;
+    uint8_t *p_hdr;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    while((tries < MSS_MAC_RX_HDR_SLOTS) && (0U != this_queue->rx_hdr_used[slot]))
     {
-        if(0U != this_mac->is_emac)
-        {
-            p_reg = &this_mac->emac_base->JUMBO_MAX_LENGTH;
-        }
+        slot = (slot + 1U) % MSS_MAC_RX_HDR_SLOTS;
+        tries++;
+    }
 
-        ret_val = *p_reg;
+    if(MSS_MAC_RX_HDR_SLOTS == tries)
+    {
+        rx_chain_recycle(this_mac, queue_no, count);
+        this_queue->rx_hdr_no_slot++;
     }
+    else
+    {
+        p_hdr = &this_queue->rx_hdr_pool[slot * MSS_MAC_RX_HDR_SIZE];
+        this_queue->rx_hdr_used[slot] = 1U;
+        this_queue->rx_hdr_next = (slot + 1U) % MSS_MAC_RX_HDR_SLOTS;
+        (void)memcpy(p_hdr, this_queue->rx_chain[0].addr, hdr_length);
 
-    return(ret_val);
+        rx_chain_recycle(this_mac, queue_no, 1U);
+        this_queue->rx_hdr_split++;
+        this_queue->pckt_rx_split_callback(this_mac, (uint32_t)queue_no, p_hdr, hdr_length,
+                                           &this_queue->rx_chain[1], count - 1U, pckt_length, cdesc);
+    }
 }
+#endif /* defined(MSS_MAC_RX_HDR_SPLIT) */
 
 
+#if defined(MSS_MAC_TSN)
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * The eMAC paired with a pMAC.
  */
+static mss_mac_instance_t *tsn_emac(const mss_mac_instance_t *this_mac)
+{
+    return((this_mac == &g_mac1) ? &g_emac1 : &g_emac0);
+}
+#endif /* defined(MSS_MAC_TSN) */
 
-void MSS_MAC_set_pause_frame_copy_to_mem(const mss_mac_instance_t *this_mac, bool state)
+
+#if defined(MSS_MAC_MCAST_FILTER)
+/******************************************************************************
+ * Index of a multicast address in the list, mcast_count if not there.
+ */
+static uint32_t mcast_find(const mss_mac_instance_t *this_mac, const uint8_t *mac_addr)
 {
-    volatile uint32_t *p_reg = &this_mac->mac_base->NETWORK_CONFIG;
+    uint32_t entry = 0U;
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    while((entry != this_mac->mcast_count) &&
+          (0 != memcmp(this_mac->mcast[entry].addr, mac_addr, 6U)))
     {
-        if(0U != this_mac->is_emac)
-        {
-            p_reg = &this_mac->emac_base->NETWORK_CONFIG;
-        }
-        /*
-         * Logic is inverted as enabling copy to memory means disabling
-         * GEM_DISABLE_COPY_OF_PAUSE_FRAMES
-         */
-        if(state)
-        {
-            *p_reg &= ~GEM_DISABLE_COPY_OF_PAUSE_FRAMES;
-        }
-        else
-        {
-            *p_reg |= GEM_DISABLE_COPY_OF_PAUSE_FRAMES;
-        }
+        entry++;
     }
+
+    return(entry);
 }
 
 
 /******************************************************************************
- * See mss_ethernet_mac.h for details of how to use this function.
+ * Load the multicast list into the MAC. The first addresses get specific
+ * address filters, starting at filter 2, and the rest set bits in the hash.
+ * Multicast hash matching is turned off when the hash is empty so that only
+ * the addresses in the list are received.
  */
-
-bool MSS_MAC_get_pause_frame_copy_to_mem(const mss_mac_instance_t *this_mac)
+static void mcast_program(const mss_mac_instance_t *this_mac)
 {
-    bool ret_val = false;
-    volatile uint32_t *p_reg = &this_mac->mac_base->NETWORK_CONFIG;
+    uint64_t hash = 0ULL;
+    uint32_t entry;
+    uint32_t mode;
+    static const uint8_t no_addr[6] = {0U, 0U, 0U, 0U, 0U, 0U};
 
-    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    for(entry = 0U; entry != MSS_MAC_MCAST_SA_FILTERS; entry++)
     {
-        if(0U != this_mac->is_emac)
+        if(entry < this_mac->mcast_count)
         {
-            p_reg = &this_mac->emac_base->NETWORK_CONFIG;
+            MSS_MAC_set_sa_filter(this_mac, entry + 2U, 0U, this_mac->mcast[entry].addr);
         }
+        else
+        {
+            MSS_MAC_set_sa_filter(this_mac, entry + 2U, MSS_MAC_SA_FILTER_DISABLE, no_addr);
+        }
+    }
 
-        /*
-         * Logic is inverted as enabling copy to memory means disabling
-         * GEM_DISABLE_COPY_OF_PAUSE_FRAMES
-         */
-        ret_val = 0U == (*p_reg & GEM_DISABLE_COPY_OF_PAUSE_FRAMES);
+    for(entry = MSS_MAC_MCAST_SA_FILTERS; entry < this_mac->mcast_count; entry++)
+    {
+        hash |= 1ULL << MSS_MAC_calc_hash_index(this_mac->mcast[entry].addr);
     }
-    
-    return(ret_val);
-}
 
+    mode = (uint32_t)MSS_MAC_get_hash_mode(this_mac);
+    if(0ULL != hash)
+    {
+        mode |= (uint32_t)MSS_MAC_HASH_MULTICAST;
+    }
+    else
+    {
+        mode &= ~(uint32_t)MSS_MAC_HASH_MULTICAST;
+    }
+
+    if(0U != this_mac->is_emac)
+    {
+        this_mac->emac_base->HASH_BOTTOM = (uint32_t)hash;
+        this_mac->emac_base->HASH_TOP = (uint32_t)(hash >> 32);
+    }
+    else
+    {
+        this_mac->mac_base->HASH_BOTTOM = (uint32_t)hash;
+        this_mac->mac_base->HASH_TOP = (uint32_t)(hash >> 32);
+    }
+
+    MSS_MAC_set_hash_mode(this_mac, (mss_mac_hash_mode_t)mode);
+}
+#endif /* defined(MSS_MAC_MCAST_FILTER) */
 
-/**************************************************************************/
-/* Private Function definitions                                           */
-/**************************************************************************/  
 
+#if defined(MSS_MAC_CAPTURE)
 /******************************************************************************
- * This is default "Receive packet interrupt handler. This function finds the
- * descriptor that received the packet and caused the interrupt.
- * This informs the received packet size to the application and
- * relinquishes the packet buffer from the associated DMA descriptor.
+ * Copy the start of a frame, held in one or more fragments, into the capture
+ * ring of the MAC. The frame is counted as dropped if there is no room, the
+ * ring is never overwritten. Interrupts are masked so a receive interrupt
+ * cannot capture into the ring while a send is doing so.
  */
-static void 
-rxpkt_handler
-(
-    mss_mac_instance_t *this_mac, uint64_t queue_no
-)
+static void capture_frags(mss_mac_capture_t *cap, const mss_mac_tx_frag_t *frags, uint32_t frag_count, uint32_t pckt_length, const mss_mac_tsu_time_t *tsu_time)
 {
-    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
-    mss_mac_rx_desc_t * cdesc = &this_queue->rx_desc_tab[this_queue->first_rx_desc_index];
-    uint64_t burst = MSS_MAC_RX_RING_SIZE;
+    uint32_t *p_rec;
+    uint8_t *p_data;
+    uint64_t psr;
+    uint32_t incl;
+    uint32_t stride;
+    uint32_t offset;
+    uint32_t room;
+    uint32_t need;
+    uint32_t part;
+    uint32_t inc;
 
-    if(0U != (cdesc->addr_low & GEM_RX_DMA_USED)) /* Check in case we already got it... */
+    incl = pckt_length;
+    if((0U != cap->snaplen) && (incl > cap->snaplen))
     {
-        /* Execution comes here because at-least one packet is received. */
-        do
-        {
-            uint8_t * p_rx_packet;
-            uint32_t pckt_length;
-#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
-            uint64_t addr_temp;
-#else
-            uint32_t addr_temp;
-#endif
+        incl = cap->snaplen;
+    }
+    stride = CAPTURE_REC_HDR_SIZE + ((incl + 7U) & ~7U);
 
-            ++this_queue->nb_available_rx_desc;
-#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
-            addr_temp  = (uint64_t)(cdesc->addr_low & ~(GEM_RX_DMA_WRAP | GEM_RX_DMA_USED | GEM_RX_DMA_TS_PRESENT));
-            addr_temp |= (uint64_t)cdesc->addr_high << 32;
-#else
-            addr_temp = (cdesc->addr_low & ~(GEM_RX_DMA_WRAP | GEM_RX_DMA_USED | GEM_RX_DMA_TS_PRESENT));
-#endif
-            p_rx_packet = (uint8_t *)addr_temp;
-            /*
-             * Pass received packet up to application layer - if enabled...
-             *
-             * Note if rx_packet comes back as 0 we can't recover and will leave a
-             * used packet stuck in the queue...
-             */
-#if !defined(MSS_MAC_UNH_TEST)
-            if((NULL_POINTER != this_queue->pckt_rx_callback) && (NULL_POINTER != p_rx_packet) && (0U == this_mac->rx_discard))
-#endif
-            {
-                pckt_length = cdesc->status & (GEM_RX_DMA_BUFF_LEN | GEM_RX_DMA_JUMBO_BIT_13);
-                this_queue->ingress += pckt_length;
+    psr = read_csr(mstatus);
+    __disable_irq();
 
-                this_queue->pckt_rx_callback(this_mac, queue_no, p_rx_packet, pckt_length, cdesc, this_queue->rx_caller_info[this_queue->first_rx_desc_index]);
-            }
+    offset = (uint32_t)cap->tail & (cap->size - 1U);
+    room = cap->size - offset;
+    need = (room < stride) ? (room + stride) : stride;
 
-#if !defined(MSS_MAC_UNH_TEST)
-            if((NULL_POINTER != p_rx_packet) && (0U != this_mac->rx_discard))
+    if(((uint64_t)cap->size - (cap->tail - cap->head)) < (uint64_t)need)
+    {
+        cap->dropped++;
+    }
+    else
+    {
+        if(room < stride)
+        {
+            /* Mark the gap at the end of the ring and start again at 0 */
+            if(room >= CAPTURE_REC_HDR_SIZE)
             {
-                /*
-                 * Need to return receive packet buffer to the queue as rx handler
-                 * hasn't been called to do it for us...
-                 */
-                (void)MSS_MAC_receive_pkt(this_mac, queue_no, p_rx_packet, this_queue->rx_caller_info[this_queue->first_rx_desc_index], MSS_MAC_INT_ENABLE);
+                ((uint32_t *)&cap->mem[offset])[2] = CAPTURE_WRAP;
             }
-#endif
+            cap->tail += room;
+            offset = 0U;
+        }
 
-            /* Point the curr_rx_desc to next descriptor in the ring */
-            /* Wrap around in case next descriptor is pointing to last in the ring */
-            ++this_queue->first_rx_desc_index;
-            this_queue->first_rx_desc_index %= MSS_MAC_RX_RING_SIZE;
+        p_rec = (uint32_t *)&cap->mem[offset];
+        p_rec[0] = tsu_time->secs_lsb;
+        p_rec[1] = tsu_time->nanoseconds;
+        p_rec[2] = incl;
+        p_rec[3] = pckt_length;
 
-            cdesc = &this_queue->rx_desc_tab[this_queue->first_rx_desc_index];
-            burst--;
-        } while(0 != (cdesc->addr_low & GEM_RX_DMA_USED) && (0 != burst)); /* loop while there are packets available */
+        p_data = &cap->mem[offset + CAPTURE_REC_HDR_SIZE];
+        for(inc = 0U; (inc != frag_count) && (0U != incl); inc++)
+        {
+            part = (frags[inc].length < incl) ? frags[inc].length : incl;
+            (void)memcpy(p_data, frags[inc].addr, part);
+            p_data += part;
+            incl -= part;
+        }
+
+        /* Record is complete before the dump can see it */
+        CAPTURE_FENCE_W_W();
+        cap->tail += stride;
+        cap->frames++;
     }
 
-    if(0U == (this_mac->mac_base->NETWORK_CONTROL & GEM_ENABLE_RECEIVE))
+    write_csr(mstatus, psr);
+}
+#endif /* defined(MSS_MAC_CAPTURE) */
+
+
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+/******************************************************************************
+ * Protect the receive buffer pool for a queue from the associated interrupt.
+ * Like MSS_MAC_receive_pkt(), we don't touch the interrupt controller when
+ * called from the receive handler itself.
+ */
+static void rx_pool_lock(const mss_mac_instance_t *this_mac, uint32_t queue_no)
+{
+    if(0 == this_mac->queue[queue_no].in_isr)
     {
-        this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
+        if(0U != this_mac->use_local_ints)
+        {
+            __disable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]);
+        }
     }
 }
 
 
 /******************************************************************************
- * This is default "Transmit packet interrupt handler. This function finds the
- * descriptor that transmitted the packet and caused the interrupt.
- * This relinquishes the packet buffer from the associated DMA descriptor.
+ * Undo the effects of rx_pool_lock().
  */
+static void rx_pool_unlock(const mss_mac_instance_t *this_mac, uint32_t queue_no)
+{
+    if(0 == this_mac->queue[queue_no].in_isr)
+    {
+        if(0U != this_mac->use_local_ints)
+        {
+            __enable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]);
+        }
+    }
+}
 
-static void 
-txpkt_handler
-(
-        mss_mac_instance_t *this_mac, uint64_t queue_no
-)
+
+/******************************************************************************
+ * Return a buffer to the free list of its pool. Must be called with the pool
+ * locked.
+ */
+static void rx_pool_free(mss_mac_rx_pool_t *p_pool, mss_mac_rx_buf_t *p_buf)
 {
-#if defined(MSS_MAC_SIMPLE_TX_QUEUE)
-    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
-    mss_mac_tx_desc_t *p_current_desc;
-    uint32_t finished;
+    p_buf->ref_count = 0U;
+    p_buf->next_free = p_pool->free_head;
+    p_pool->free_head = (uint32_t)(p_buf - &p_pool->buf[0]);
+    ++p_pool->free_count;
+}
 
-    /*
-     * Simple multi packet TX queue where only the one packet buffer is used
-     * per frame but we do have 1 extra descriptor to stop DMA engine running
-     * over itself...
-     */
 
-    p_current_desc = &this_queue->tx_desc_tab[this_queue->current_tx_desc];
-    finished = 0;
-    while(!finished)
-    {
-        if(this_queue->nb_available_tx_desc == MSS_MAC_TX_RING_SIZE)
+/******************************************************************************
+ * Attach free pool buffers to every empty receive descriptor in the ring.
+ * Must be called with the pool locked. Returns the number of descriptors that
+ * were re-armed.
+ */
+static uint32_t rx_pool_fill(mss_mac_instance_t *this_mac, uint32_t queue_no)
+{
+    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+    mss_mac_rx_pool_t *p_pool = &this_queue->rx_pool;
+    mss_mac_rx_buf_t *p_buf;
+    uint32_t index;
+    uint32_t filled = 0U;
+    uint64_t addr_temp;
+
+    while((this_queue->nb_available_rx_desc > 0U) && (MSS_MAC_RX_POOL_END != p_pool->free_head))
+    {
+        p_buf = &p_pool->buf[p_pool->free_head];
+        p_pool->free_head = p_buf->next_free;
+        --p_pool->free_count;
+        p_buf->ref_count = 0U;
+
+        index     = this_queue->next_free_rx_desc_index;
+        addr_temp = (uint64_t)p_buf->buffer;
+        p_pool->ring_buf[index] = (uint32_t)(p_buf - &p_pool->buf[0]);
+        this_queue->rx_caller_info[index] = (void *)p_buf;
+
+#if defined(MSS_MAC_CACHE_MAINTENANCE)
+        mss_l2_flush_range(addr_temp, MSS_MAC_MAX_RX_BUF_SIZE);
+#endif
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+        this_queue->rx_desc_tab[index].addr_high = (uint32_t)(addr_temp >> 32);
+#endif
+        this_queue->rx_desc_tab[index].status = 0U;
+        /* Writing the address clears the used bit and hands the descriptor to the DMA engine */
+        if((MSS_MAC_RX_RING_SIZE - 1U) == index)
         {
-            *this_queue->transmit_q_ptr = (uint32_t)((uint64_t)this_queue->tx_desc_tab) | 1UL; /* Disable the TX queue */
-            finished = 1;
+            this_queue->rx_desc_tab[index].addr_low = (uint32_t)addr_temp | GEM_RX_DMA_WRAP;
         }
         else
         {
-            if(p_current_desc->status & GEM_TX_DMA_USED)
+            this_queue->rx_desc_tab[index].addr_low = (uint32_t)addr_temp;
+        }
+
+        --this_queue->nb_available_rx_desc;
+        ++this_queue->next_free_rx_desc_index;
+        this_queue->next_free_rx_desc_index %= MSS_MAC_RX_RING_SIZE;
+        ++filled;
+    }
+
+    if(0U != this_queue->nb_available_rx_desc)
+    {
+        ++p_pool->starved;
+    }
+
+    if(0U != filled)
+    {
+        /* Make sure the descriptor updates are visible before the DMA looks again */
+        mb();
+
+        if(0U != this_mac->is_emac)
+        {
+            if(0U == (this_mac->emac_base->NETWORK_CONTROL & GEM_ENABLE_RECEIVE))
             {
-                if(NULL_POINTER != this_queue->pckt_tx_callback)
-                {
-                    this_queue->pckt_tx_callback(this_mac, queue_no, p_current_desc, this_queue->tx_caller_info[this_queue->current_tx_desc]);
-                }
-                this_queue->nb_available_tx_desc++;
-                p_current_desc++;
-                this_queue->current_tx_desc++;
+                this_mac->emac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
             }
-            else
+        }
+        else
+        {
+            if(0U == (this_mac->mac_base->NETWORK_CONTROL & GEM_ENABLE_RECEIVE))
             {
-                finished = 1;
+                this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
             }
         }
     }
-#else    
-#error "Multi packet TX not implemented!"
-#endif
+
+    return(filled);
 }
+#endif /* defined(MSS_MAC_RX_BUFFER_POOL) */
 
 
 /******************************************************************************
@@ -5293,44 +9267,6 @@ static void assign_station_addr
 }
 
 
-/*******************************************************************************
- * Auto-detect the PHY's address by attempting to read the PHY identification
- * register containing the PHY manufacturer's identifier.
- * Attempting to read a PHY register using an incorrect PHY address will result
- * in a value with all bits set to one on the MDIO bus. Reading any other value
- * means that a PHY responded to the read request, therefore we have found the
- * PHY's address.
- * This function returns the detected PHY's address or 32 (PHY_ADDRESS_MAX + 1)
- * if no PHY is responding.
- */
-static uint8_t probe_phy(const mss_mac_instance_t *this_mac)
-{
-    uint8_t phy_address = PHY_ADDRESS_MIN;
-    const uint16_t ALL_BITS_HIGH = 0xFFFFU;
-    const uint8_t PHYREG_PHYID1R = 0x02U;   /* PHY Identifier 1 register address. */
-    uint32_t found;
-    
-    do
-    {
-        uint16_t reg;
-        
-        reg = MSS_MAC_read_phy_reg(this_mac, phy_address, PHYREG_PHYID1R);
-        if (reg != ALL_BITS_HIGH)
-        {
-            found = 1U;
-        }
-        else
-        {
-            found = 0U;
-            ++phy_address;
-        }
-    }
-    while ((phy_address <= PHY_ADDRESS_MAX) && (0U == found));    
-    
-    return phy_address;
-}
-
-
 /*******************************************************************************
  * MSS MAC TBI interface
  */
@@ -5357,6 +9293,252 @@ static void msgmii_init(const mss_mac_instance_t *this_mac)
 /*******************************************************************************
  *
  */
+#if defined(MSS_MAC_MDIO_QUEUE)
+/******************************************************************************
+ * Returns the MAC driving the MDIO interface used by this_mac.
+ */
+static mss_mac_instance_t *mdio_controller(const mss_mac_instance_t *this_mac)
+{
+    mss_mac_instance_t *ctl;
+
+    if((struct mss_mac_instance *)0UL != this_mac->phy_controller)
+    {
+        ctl = this_mac->phy_controller;
+    }
+    else
+    {
+        ctl = (mss_mac_instance_t *)this_mac;
+    }
+
+    return(ctl);
+}
+
+/******************************************************************************
+ * Starts the MDIO frame of the current operation of the script, the read of a
+ * modify first and then its write.
+ */
+static void mdio_issue(mss_mac_instance_t *this_mac)
+{
+    const mss_mac_mdio_op_t *op = &this_mac->mdio_ops[this_mac->mdio_next];
+    uint32_t phy_op;
+
+    if((MSS_MAC_MDIO_WRITE == op->cmd) || (0U != this_mac->mdio_writing))
+    {
+        phy_op = GEM_WRITE1 | (GEM_PHY_OP_CL22_WRITE << GEM_OPERATION_SHIFT) | (((uint32_t)(2UL)) << GEM_WRITE10_SHIFT) | (uint32_t)op->value;
+    }
+    else
+    {
+        phy_op = GEM_WRITE1 | (GEM_PHY_OP_CL22_READ << GEM_OPERATION_SHIFT) | (((uint32_t)(2UL)) << GEM_WRITE10_SHIFT);
+    }
+
+    phy_op |= ((uint32_t)op->phy_addr << GEM_PHY_ADDRESS_SHIFT) & GEM_PHY_ADDRESS;
+    phy_op |= ((uint32_t)op->reg_addr << GEM_REGISTER_ADDRESS_SHIFT) & GEM_REGISTER_ADDRESS;
+
+    this_mac->mac_base->PHY_MANAGEMENT = phy_op;
+}
+
+/******************************************************************************
+ * Completes the current operation of the script if the MDIO interface is idle
+ * and starts the next one. Called with interrupts masked.
+ */
+static void mdio_step(mss_mac_instance_t *this_mac)
+{
+    mss_mac_mdio_op_t *op;
+    uint16_t phy_reg;
+
+    if((0U != this_mac->mdio_busy) &&
+       (0U != (this_mac->mac_base->NETWORK_STATUS & GEM_MAN_DONE)))
+    {
+        op = &this_mac->mdio_ops[this_mac->mdio_next];
+        phy_reg = (uint16_t)this_mac->mac_base->PHY_MANAGEMENT;
+
+        if((MSS_MAC_MDIO_MODIFY == op->cmd) && (0U == this_mac->mdio_writing))
+        {
+            op->value = (uint16_t)((phy_reg & (uint16_t)~op->mask) | (op->value & op->mask));
+            this_mac->mdio_writing = 1U;
+            mdio_issue(this_mac);
+        }
+        else
+        {
+            if(MSS_MAC_MDIO_READ == op->cmd)
+            {
+                op->value = phy_reg;
+            }
+
+            this_mac->mdio_writing = 0U;
+            this_mac->mdio_next++;
+
+            if(this_mac->mdio_next < this_mac->mdio_count)
+            {
+                mdio_issue(this_mac);
+            }
+            else
+            {
+                this_mac->mac_base->INT_DISABLE = GEM_MANAGEMENT_FRAME_SENT;
+                this_mac->mdio_busy = 0U;
+
+                if((mss_mac_mdio_done_t)NULL_POINTER != this_mac->mdio_done)
+                {
+                    this_mac->mdio_done(this_mac, this_mac->mdio_ops, this_mac->mdio_count);
+                }
+            }
+        }
+    }
+}
+#endif /* defined(MSS_MAC_MDIO_QUEUE) */
+
+#if defined(MSS_MAC_ASYNC_LINK)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ *
+ * The steps follow the blocking bring-up of MSS_MAC_init(): PLL lock for the
+ * VSC8662 NWC designs, PHY speed and copper autonegotiation, then the SGMII
+ * autonegotiation through the GEM PCS for TBI or through the SGMII core at
+ * pcs_phy_addr for GMII_SGMII, which the PHY drivers otherwise do from their
+ * autonegotiate functions.
+ */
+mss_mac_link_state_t
+MSS_MAC_link_poll
+(
+    mss_mac_instance_t *this_mac
+)
+{
+    uint16_t phy_reg;
+    uint8_t link_fullduplex;
+    mss_mac_speed_t link_speed;
+    uint8_t pcs_link;
+
+    if(MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        pcs_link = ((TBI == this_mac->interface_type) ||
+                    (GMII_SGMII == this_mac->interface_type)) ? 1U : 0U;
+        this_mac->link_polls++;
+
+        switch(this_mac->link_state)
+        {
+#if (defined(MSS_MAC_VSC8662_NWC_25) || defined(MSS_MAC_VSC8662_NWC_125))
+            case MSS_MAC_LINK_PLL_WAIT:
+                if((0U != (MSS_SCB_SGMII_PLL->PLL_CTRL & ((0x01U) << 25U))) ||
+                   (this_mac->link_polls >= MSS_MAC_LINK_POLL_LIMIT))
+                {
+                    link_next_state(this_mac, MSS_MAC_LINK_PHY_START);
+                }
+                break;
+#endif
+
+            case MSS_MAC_LINK_PHY_START:
+                this_mac->phy_set_link_speed(this_mac, this_mac->speed_duplex_select, this_mac->speed_mode);
+
+                if((MSS_MAC_SPEED_AN == this_mac->speed_mode) &&
+                   (MSS_MAC_DEV_PHY_NULL != this_mac->phy_type))
+                {
+                    phy_reg = MSS_MAC_read_phy_reg(this_mac, (uint8_t)this_mac->phy_addr, MII_BMCR);
+                    phy_reg |= (uint16_t)(BMCR_ANENABLE | BMCR_ANRESTART);
+                    MSS_MAC_write_phy_reg(this_mac, (uint8_t)this_mac->phy_addr, MII_BMCR, phy_reg);
+                    link_next_state(this_mac, MSS_MAC_LINK_PHY_AN);
+                }
+                else
+                {
+                    link_next_state(this_mac, (0U != pcs_link) ? MSS_MAC_LINK_PCS_START : MSS_MAC_LINK_READY);
+                }
+                break;
+
+            case MSS_MAC_LINK_PHY_AN:
+                phy_reg = MSS_MAC_read_phy_reg(this_mac, (uint8_t)this_mac->phy_addr, MII_BMSR);
+                if(((0xFFFFU != phy_reg) && (0U != (phy_reg & BMSR_AUTO_NEGOTIATION_COMPLETE))) ||
+                   (this_mac->link_polls >= MSS_MAC_LINK_POLL_LIMIT))
+                {
+                    link_next_state(this_mac, (0U != pcs_link) ? MSS_MAC_LINK_PCS_START : MSS_MAC_LINK_READY);
+                }
+                break;
+
+            case MSS_MAC_LINK_PCS_START:
+                if(MSS_MAC_LINK_UP == this_mac->phy_get_link_status(this_mac, &link_speed, &link_fullduplex))
+                {
+                    /* Initiate auto-negotiation on the SGMII link. */
+                    if(TBI == this_mac->interface_type)
+                    {
+                        phy_reg = (uint16_t)this_mac->mac_base->PCS_CONTROL;
+                        phy_reg |= 0x1000U;
+                        this_mac->mac_base->PCS_CONTROL = phy_reg;
+                        phy_reg |= 0x0200U;
+                        this_mac->mac_base->PCS_CONTROL = phy_reg;
+                    }
+                    else
+                    {
+                        phy_reg = MSS_MAC_read_phy_reg(this_mac, (uint8_t)this_mac->pcs_phy_addr, 0x00U);
+                        phy_reg |= 0x1000U;
+                        MSS_MAC_write_phy_reg(this_mac, (uint8_t)this_mac->pcs_phy_addr, 0x00U, phy_reg);
+                        phy_reg |= 0x0200U;
+                        MSS_MAC_write_phy_reg(this_mac, (uint8_t)this_mac->pcs_phy_addr, 0x00U, phy_reg);
+                    }
+
+                    link_next_state(this_mac, MSS_MAC_LINK_PCS_AN);
+                }
+                else if(this_mac->link_polls >= MSS_MAC_LINK_POLL_LIMIT)
+                {
+                    link_next_state(this_mac, MSS_MAC_LINK_READY);
+                }
+                else
+                {
+                    /* Wait for the copper link */
+                }
+                break;
+
+            case MSS_MAC_LINK_PCS_AN:
+                phy_reg = link_pcs_status(this_mac);
+                if(((0xFFFFU != phy_reg) && (0U != (phy_reg & BMSR_AUTO_NEGOTIATION_COMPLETE))) ||
+                   (this_mac->link_polls >= MSS_MAC_LINK_POLL_LIMIT))
+                {
+                    link_next_state(this_mac, MSS_MAC_LINK_READY);
+                }
+                break;
+
+            default:
+                /* MSS_MAC_LINK_READY, nothing left to do */
+                break;
+        }
+    }
+
+    return(this_mac->link_state);
+}
+
+/******************************************************************************
+ * Moves the link bring-up to state. The MAC is set to the negotiated speed on
+ * reaching MSS_MAC_LINK_READY.
+ */
+static void link_next_state(mss_mac_instance_t *this_mac, mss_mac_link_state_t state)
+{
+    if(MSS_MAC_LINK_READY == state)
+    {
+        update_mac_cfg(this_mac);
+    }
+
+    this_mac->link_polls = 0U;
+    this_mac->link_state = state;
+}
+
+/******************************************************************************
+ * Reads the status of the SGMII link, from the GEM PCS for TBI or from the
+ * SGMII core for GMII_SGMII.
+ */
+static uint16_t link_pcs_status(const mss_mac_instance_t *this_mac)
+{
+    uint16_t phy_reg;
+
+    if(TBI == this_mac->interface_type)
+    {
+        phy_reg = (uint16_t)this_mac->mac_base->PCS_STATUS;
+    }
+    else
+    {
+        phy_reg = MSS_MAC_read_phy_reg(this_mac, (uint8_t)this_mac->pcs_phy_addr, MII_BMSR);
+    }
+
+    return(phy_reg);
+}
+#endif /* defined(MSS_MAC_ASYNC_LINK) */
+
 void msgmii_autonegotiate(const mss_mac_instance_t *this_mac)
  {
     uint16_t phy_reg;
@@ -159,6 +159,13 @@
     configuration process:
         - _MSS_MAC_cfg_struct_def_init()_
         - _MSS_MAC_init()_
+        - _MSS_MAC_link_poll()_
+
+    Bringing the link up can take several seconds with some PHYs. When the
+    _MSS_MAC_ASYNC_LINK_ macro is defined and the _async_link_ configuration
+    parameter is set, _MSS_MAC_init()_ returns without waiting for the
+    autonegotiation. The application then calls _MSS_MAC_link_poll()_, from a
+    timer or the PHY interrupt, until it returns _MSS_MAC_LINK_READY_.
         
     @subsection tx_ops Transmit Operations
     The MSS Ethernet MAC driver transmit operations are interrupt driven. The
@@ -176,11 +183,37 @@
     function once a packet is sent. The transmit call-back function is supplied
     by the application and can be used to, for example, release the memory used
     to store the packet that was sent.
+
+    When the _MSS_MAC_TX_BATCH_ macro is defined, _MSS_MAC_send_pkt_batch()_
+    can be used to post a list of packets to a single queue with one transmit
+    start. A batch callback registered with _MSS_MAC_set_tx_batch_callback()_
+    is then called once for each group of completed packets rather than once
+    per packet.
+
+    When the _MSS_MAC_TX_DEFERRED_RECLAIM_ macro is also defined, a queue can
+    be switched to deferred reclamation with _MSS_MAC_set_tx_reclaim_mode()_.
+    Sent descriptors are then reclaimed, and the transmit callbacks made, from
+    the next call to _MSS_MAC_send_pkt()_, _MSS_MAC_send_pkt_gather()_ or
+    _MSS_MAC_send_pkt_batch()_ for the queue or from _MSS_MAC_tx_reclaim()_.
+    The transmit interrupt is only used when the number of free descriptors
+    falls below a low-water mark.
+
+    When the _MSS_MAC_TX_SPSC_RING_ macro is defined, each queue also has a
+    lock-free single producer ring which is filled with _MSS_MAC_tx_ring_push()_.
+    This lets each U54 own a queue and transmit on it without masking
+    interrupts or serialising with the other harts.
     
     The following functions are used as part of the transmit operations:
         - _MSS_MAC_send_pkt()_
+        - _MSS_MAC_send_pkt_gather()_
         - _MSS_MAC_send_pkts()_
         - _MSS_MAC_set_tx_callback()_
+        - _MSS_MAC_send_pkt_batch()_
+        - _MSS_MAC_set_tx_batch_callback()_
+        - _MSS_MAC_tx_ring_push()_
+        - _MSS_MAC_tx_ring_space()_
+        - _MSS_MAC_set_tx_reclaim_mode()_
+        - _MSS_MAC_tx_reclaim()_
         
     @subsection rx_ops Receive Operations
     The MSS Ethernet MAC driver receive operations are interrupt driven. The
@@ -195,21 +228,69 @@
     MAC driver unless it is re-allocated to the driver by a call to
     _MSS_MAC_receive_pkt()_.
     
+    As an alternative to allocating individual receive buffers, the
+    application can hand a block of memory to the driver with the
+    _MSS_MAC_rx_pool_init()_ function when the _MSS_MAC_RX_BUFFER_POOL_ macro
+    is defined. The driver then owns the receive descriptor ring for that queue
+    and refills it from the pool in bulk. Each received packet is lent to the
+    application as a reference counted _mss_mac_rx_buf_t_ handle which is
+    returned to the pool with _MSS_MAC_rx_buf_release()_ once the packet has
+    been consumed, so the packet data never needs to be copied.
+
+    When the _MSS_MAC_RX_HDR_SPLIT_ macro is defined, the
+    _MSS_MAC_set_rx_hdr_split()_ function turns on the MAC's header-data
+    splitting for a queue. The headers of each TCP or UDP frame are copied into
+    a slot of a small header pool, which the application can place in the L2
+    scratchpad, and the payload is handed over in the receive buffers it was
+    received into, so protocol processing stays in the cache while the payload
+    buffers can be stored or forwarded as they are. Header slots are given back
+    with _MSS_MAC_rx_hdr_release()_.
+
+    Under heavy receive load, taking one interrupt per packet can use up most
+    of the processor time in interrupt handling. When the _MSS_MAC_RX_POLL_MODE_
+    macro is defined, the _MSS_MAC_set_rx_poll_mode()_ function can be used to
+    switch a queue to polled operation. In this mode the first receive
+    interrupt masks the queue's receive interrupts and calls an application
+    supplied function to schedule the work. The application then calls
+    _MSS_MAC_rx_poll()_ with a packet budget until the ring is empty, at which
+    point the driver re-enables the receive interrupts.
+
+    Where a hart can be dedicated to a queue, the _MSS_MAC_BUSY_POLL_ macro
+    adds the _MSS_MAC_set_busy_poll()_ function which masks all of the queue's
+    interrupts. The hart then spins on _MSS_MAC_poll_rx()_ and
+    _MSS_MAC_poll_tx_complete()_, which check the ownership bits of the
+    descriptors and never read the interrupt status or take a trap.
+
     The following functions are used as part of the receive operations:
         - _MSS_MAC_receive_pkt()_
         - _MSS_MAC_set_rx_callback()_
+        - _MSS_MAC_set_rx_chain_callback()_
+        - _MSS_MAC_rx_pool_init()_
+        - _MSS_MAC_rx_pool_refill()_
+        - _MSS_MAC_rx_buf_ref()_
+        - _MSS_MAC_rx_buf_release()_
+        - _MSS_MAC_set_rx_hdr_split()_
+        - _MSS_MAC_rx_hdr_release()_
+        - _MSS_MAC_set_rx_poll_mode()_
+        - _MSS_MAC_rx_poll()_
+        - _MSS_MAC_set_busy_poll()_
+        - _MSS_MAC_poll_rx()_
+        - _MSS_MAC_poll_tx_complete()_
         
     @subsection stats Reading Status and Statistics
     The MSS Ethernet MAC driver provides the following functions to retrieve the
     current link status and statistics.
         - _MSS_MAC_get_link_status()_
         - _MSS_MAC_read_stat()_
+        - _MSS_MAC_get_stats()_
 
     @subsection features Feature Support
     The MSS Ethernet MAC driver provides the following functions to support on
     the fly configuration and control of various features of the MSS
     Ethernet MAC devices.
         - _MSS_MAC_read_TSU()_
+        - _MSS_MAC_get_rx_timestamp()_
+        - _MSS_MAC_get_tx_timestamp()_
         - _MSS_MAC_init_TSU()_
         - _MSS_MAC_set_TSU_rx_mode()_
         - _MSS_MAC_set_TSU_tx_mode()_
@@ -227,10 +308,18 @@
         - _MSS_MAC_get_hash()_
         - _MSS_MAC_set_hash_mode()_
         - _MSS_MAC_get_hash_mode()_
+        - _MSS_MAC_calc_hash_index()_
         - _MSS_MAC_set_type_filter()_
         - _MSS_MAC_get_type_filter()_
         - _MSS_MAC_set_sa_filter()_
         - _MSS_MAC_get_sa_filter()_
+        - _MSS_MAC_mcast_add()_
+        - _MSS_MAC_mcast_remove()_
+        - _MSS_MAC_mcast_clear()_
+        - _MSS_MAC_mcast_get_count()_
+        - _MSS_MAC_capture_start()_
+        - _MSS_MAC_capture_stop()_
+        - _MSS_MAC_capture_dump()_
         - _MSS_MAC_set_type_1_filter()_
         - _MSS_MAC_get_type_1_filter()_
         - _MSS_MAC_set_type_2_filter()_
@@ -239,11 +328,22 @@
         - _MSS_MAC_get_type_2_ethertype()_
         - _MSS_MAC_set_type_2_compare()_
         - _MSS_MAC_get_type_2_compare()_
+        - _MSS_MAC_flow_hash()_
+        - _MSS_MAC_flow_to_queue()_
+        - _MSS_MAC_set_flow_table()_
+        - _MSS_MAC_steer_flow()_
+        - _MSS_MAC_clear_flow()_
+        - _MSS_MAC_set_queue_hart()_
         - _MSS_MAC_set_mmsl_mode()_
         - _MSS_MAC_get_mmsl_mode()_
         - _MSS_MAC_start_preemption_verify()_
         - _MSS_MAC_get_mmsl_status()_
         - _MSS_MAC_get_mmsl_stats()_
+        - _MSS_MAC_set_cbs()_
+        - _MSS_MAC_get_cbs()_
+        - _MSS_MAC_tsn_init()_
+        - _MSS_MAC_tsn_send_pkt()_
+        - _MSS_MAC_tsn_get_stats()_
         - _MSS_MAC_set_tx_cutthru()_
         - _MSS_MAC_set_rx_cutthru()_
         - _MSS_MAC_get_tx_cutthru()_
@@ -253,8 +353,27 @@
         - _MSS_MAC_get_jumbo_frames_mode()_
         - _MSS_MAC_set_jumbo_frame_length()_
         - _MSS_MAC_get_jumbo_frame_length()_
+        - _MSS_MAC_set_int_moderation()_
+        - _MSS_MAC_get_int_moderation()_
+        - _MSS_MAC_get_offload_caps()_
         - _MSS_MAC_set_pause_frame_copy_to_mem()_
         - _MSS_MAC_get_pause_frame_copy_to_mem()_
+        - _MSS_MAC_mdio_submit()_
+        - _MSS_MAC_mdio_run()_
+        - _MSS_MAC_mdio_poll()_
+        - _MSS_MAC_mdio_busy()_
+
+    When the _MSS_MAC_FLOW_STEERING_ macro is defined, the pMAC receive traffic
+    can be spread across the 4 queues on a per flow basis. The
+    _MSS_MAC_steer_flow()_ function programs a Type 1 or Type 2 screener to
+    send an IPv4 TCP or UDP flow to a queue, either chosen by the application
+    or looked up from a hash indirection table. The _MSS_MAC_set_queue_hart()_
+    function routes a queue's PLIC interrupt to one U54 so that each queue,
+    and the flows steered to it, is processed by its own application core.
+    The _MSS_MAC_classify()_ function steers a traffic class, described by its
+    VLAN priority, Ethertype, IPv4 DSCP and UDP port, to a queue and
+    _MSS_MAC_set_queue_priority()_ raises the priority of that queue's
+    interrupt.
 
  *//*=========================================================================*/
 #ifndef MSS_ETHERNET_MAC_H_
@@ -344,8 +463,13 @@ extern "C" {
 /***************************************************************************//**
  * Calculate the RX Buffer size field value automatically by rounding 
  * _MSS_MAC_MAX_PACKET_SIZE_ up to nearest 64 bytes and dividing by 64.
+ * With _MSS_MAC_RX_CHAINED_ the buffers are _MSS_MAC_RX_CHAIN_BUF_SIZE_ bytes.
  */
+#if defined(MSS_MAC_RX_CHAINED)
+#define MSS_MAC_RX_BUF_VALUE (MSS_MAC_RX_CHAIN_BUF_SIZE / 64U)
+#else
 #define MSS_MAC_RX_BUF_VALUE ((MSS_MAC_MAX_PACKET_SIZE + 63U) / 64U)
+#endif
 
 /***************************************************************************//**
   The definition below is provided to specify that the _MSS_MAC_init()_ function
@@ -369,7 +493,11 @@ extern "C" {
  *
  */
 #define MSS_MAC_MAX_TX_BUF_SIZE       (((MSS_MAC_MAX_PACKET_SIZE + 7U) / 8U) * 8U)
+#if defined(MSS_MAC_RX_CHAINED)
+#define MSS_MAC_MAX_RX_BUF_SIZE       MSS_MAC_RX_CHAIN_BUF_SIZE
+#else
 #define MSS_MAC_MAX_RX_BUF_SIZE       (((MSS_MAC_MAX_PACKET_SIZE + 7U) / 8U) * 8U)
+#endif
 
 /*******************************************************************************
  * Defines for configuration parameters
@@ -439,6 +567,27 @@ extern "C" {
  */
 #define MSS_MAC_IPG_DEFVAL                          (0x00U)
 
+/***************************************************************************//**
+ * Interrupt moderation limits. Moderation times are in units of 800ns.
+ */
+#define MSS_MAC_INT_MODERATION_DISABLE              (0x00U)
+#define MSS_MAC_INT_MODERATION_MAX                  (0xFFU)
+
+/***************************************************************************//**
+ * Offload capability flags returned by _MSS_MAC_get_offload_caps()_.
+ */
+#define MSS_MAC_OFFLOAD_TX_CSUM                     (0x01U)
+#define MSS_MAC_OFFLOAD_RX_CSUM                     (0x02U)
+#define MSS_MAC_OFFLOAD_LSO                         (0x04U)
+
+/***************************************************************************//**
+ * Extracts the hardware checksum result from a receive descriptor when
+ * _rx_csum_offload_ is enabled. The result is one of the
+ * _GEM_RX_DMA_CSUM_xxx_ values.
+ */
+#define MSS_MAC_RX_CSUM_STATUS(p_rx_desc) \
+    (((p_rx_desc)->status & GEM_RX_DMA_TYPE_ID) >> GEM_RX_DMA_CSUM_SHIFT)
+
 /***************************************************************************//**
  * PHY clock divider values.
  *
@@ -530,6 +679,29 @@ extern uint8_t *g_mss_mac_ddr_ptr;
 #define MSS_MAC_T2_OFFSET_IP         (2U)
 #define MSS_MAC_T2_OFFSET_TCP_UDP    (3U)
 
+/***************************************************************************//**
+ * Flow steering definitions.
+ *
+ * _MSS_MAC_FLOW_QUEUE_AUTO_ can be passed to _MSS_MAC_steer_flow()_ to select
+ * the queue from the flow hash indirection table. _MSS_MAC_FLOW_INVALID_ is
+ * returned by _MSS_MAC_steer_flow()_ when a flow could not be steered.
+ */
+#define MSS_MAC_FLOW_QUEUE_AUTO      (0xFFFFFFFFU)
+#define MSS_MAC_FLOW_INVALID         (-1)
+#define MSS_MAC_FLOW_TYPE_2_BASE     (0x100)  /* Flow IDs from this value up use Type 2 screeners */
+
+/***************************************************************************//**
+ * Traffic class match fields.
+ *
+ * These values are ORed together in the _match_ field of _mss_mac_class_t_ to
+ * select the fields _MSS_MAC_classify()_ compares.
+ */
+#define MSS_MAC_CLASS_VLAN_PCP       (0x01U)
+#define MSS_MAC_CLASS_ETHERTYPE      (0x02U)
+#define MSS_MAC_CLASS_DSCP           (0x04U)
+#define MSS_MAC_CLASS_UDP_PORT       (0x08U)
+#define MSS_MAC_CLASS_ALL            (0x0FU)
+
 
 /**************************************************************************/
 /* Public Function declarations                                           */
@@ -739,6 +911,221 @@ void MSS_MAC_set_tx_callback
     mss_mac_transmit_callback_t tx_complete_handler
 );
 
+#if defined(MSS_MAC_TX_BATCH)
+/***************************************************************************//**
+  The _MSS_MAC_set_tx_batch_callback()_ function registers the function that
+  will be called by the Ethernet MAC driver when packets have been sent on the
+  specified queue.
+
+  The batch callback is called once per transmit interrupt with all of the
+  packets which completed since the previous callback. While a batch callback
+  is registered, the callback registered with _MSS_MAC_set_tx_callback()_ is
+  not called for the queue.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue which this callback function will
+    service. For single queue devices, this should be set to 0 for compatibility
+    purposes.
+
+  @param tx_batch_handler
+    This parameter is a pointer to the function that will be called when
+    packets are sent by the Ethernet MAC on the selected queue. Passing _NULL_
+    restores per packet transmit callbacks.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_MAC_set_tx_batch_callback
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_batch_callback_t tx_batch_handler
+);
+#endif
+
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+/***************************************************************************//**
+  The _MSS_MAC_set_tx_reclaim_mode()_ function selects whether sent transmit
+  descriptors on a queue are reclaimed in the transmit interrupt or deferred to
+  the next send.
+
+  In deferred mode the transmit complete interrupt for the queue is masked
+  and the send functions reclaim any sent descriptors, making the transmit
+  callbacks, before queuing new packets. If a send leaves _low_water_ or fewer
+  descriptors free the transmit complete interrupt is armed for that one
+  transmission so that a large batch is still reclaimed promptly.
+
+  Because the callbacks are made from the send functions, they run in the
+  context of the caller rather than in the MAC interrupt. Registering a batch
+  callback with _MSS_MAC_set_tx_batch_callback()_ means each reclaim results
+  in a single callback.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue to configure. For single queue devices
+    this should be set to 0 for compatibility purposes.
+
+  @param low_water
+    This parameter is the free descriptor low-water mark which arms the transmit
+    interrupt. A value of 1 arms it for every transmission that uses the
+    whole ring and a value of _MSS_MAC_TX_RING_SIZE_ arms it for every
+    transmission. Passing 0 returns the queue to normal interrupt driven
+    reclamation.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    void tx_done(void *this_mac, uint32_t queue_no, mss_mac_tx_desc_t *cdescs,
+                 void * const *p_user_data, uint32_t count)
+    {
+        uint32_t index;
+
+        for(index = 0U; index != count; index++)
+        {
+            free_tx_buffer(p_user_data[index]);
+        }
+    }
+
+    void tx_init(void)
+    {
+        MSS_MAC_set_tx_batch_callback(&g_mac0, 0, tx_done);
+        MSS_MAC_set_tx_reclaim_mode(&g_mac0, 0, MSS_MAC_TX_RING_SIZE / 4U);
+    }
+  @endcode
+ */
+void
+MSS_MAC_set_tx_reclaim_mode
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint32_t low_water
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_tx_reclaim()_ function reclaims any sent transmit descriptors on
+  a queue and makes the transmit callbacks for them. This should be called
+  periodically for queues in deferred reclaim mode which may go idle with
+  packets still outstanding.
+
+  This function must not be called from the MAC's transmit or receive
+  callbacks.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue to reclaim descriptors from.
+
+  @return
+    This function returns the number of packets reclaimed.
+ */
+uint32_t
+MSS_MAC_tx_reclaim
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no
+);
+#endif
+
+#if defined(MSS_MAC_TX_SPSC_RING)
+/***************************************************************************//**
+  The _MSS_MAC_tx_ring_push()_ function adds a packet to the lock-free transmit
+  ring of a queue. The packet is moved onto the DMA descriptors straight away
+  if the queue is idle, otherwise it is sent from the transmit interrupt once
+  the packets ahead of it have gone.
+
+  Each queue's ring has a single producer. Only one hart may push to a given
+  queue, but different harts can push to different queues at the same time
+  without masking interrupts or taking any lock. Routing each queue's
+  interrupt to its producer hart keeps the completion processing local. The
+  transmit callbacks may be made from this function as well as from the
+  transmit interrupt.
+
+  Packets pushed to the ring must not be mixed with _MSS_MAC_send_pkt()_,
+  _MSS_MAC_send_pkt_gather()_ or _MSS_MAC_send_pkt_batch()_ on the same queue.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue the packet is sent on.
+
+  @param tx_buffer
+    This parameter is a pointer to the buffer containing the packet to send.
+    The buffer must be word aligned and remain valid until the transmit
+    callback for the packet has been made.
+
+  @param length
+    This parameter is the length of the packet in bytes. Setting bit 31 sends
+    the packet without a CRC appended, as for _MSS_MAC_send_pkt()_.
+
+  @param p_user_data
+    This parameter is a pointer which is passed back to the transmit callback
+    for the packet.
+
+  @return
+    This function returns _MSS_MAC_ERR_OK_ if the packet was added to the ring
+    or _MSS_MAC_ERR_TX_NOT_OK_ if the ring is full.
+
+  Example:
+  @code
+    void u54_2_tx_task(void)
+    {
+        while(0U != MSS_MAC_tx_ring_space(&g_mac0, 1U))
+        {
+            (void)MSS_MAC_tx_ring_push(&g_mac0, 1U, next_frame(), FRAME_LEN, 0);
+        }
+    }
+  @endcode
+ */
+int32_t
+MSS_MAC_tx_ring_push
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint8_t const * tx_buffer,
+    uint32_t length,
+    void * p_user_data
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_tx_ring_space()_ function returns the number of free entries in
+  the lock-free transmit ring of a queue. It should only be called by the
+  queue's producer hart, for which the result is a safe lower bound.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue to check.
+
+  @return
+    This function returns the number of packets which can be pushed.
+ */
+uint32_t
+MSS_MAC_tx_ring_space
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t queue_no
+);
+#endif
+
 /***************************************************************************//**
   The _MSS_MAC_set_rx_callback()_ function registers the function that will be
   called by the Ethernet MAC driver when a packet is received.
@@ -807,6 +1194,187 @@ void MSS_MAC_set_rx_callback
     mss_mac_receive_callback_t rx_callback
 );
 
+#if defined(MSS_MAC_RX_CHAINED)
+/***************************************************************************//**
+  The _MSS_MAC_set_rx_chain_callback()_ function registers the function that
+  will be called by the Ethernet MAC driver when a frame is received into one
+  or more receive buffers. The callback is given the buffers of the frame in
+  order, each with the length of frame data it holds and the user data pointer
+  given to _MSS_MAC_receive_pkt()_ with it, and must hand each buffer back
+  with _MSS_MAC_receive_pkt()_ when done with it.
+
+  While no chain callback is set, frames which fit in one buffer go to the
+  callback set with _MSS_MAC_set_rx_callback()_ and longer frames are dropped.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue which this callback function will
+    service.
+
+  @param rx_callback
+    This parameter is a pointer to the function that will be called when a
+    frame is received on the selected queue, or NULL to remove it.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    void rx_chain_callback
+    (
+        void *this_mac,
+        uint32_t queue_no,
+        const mss_mac_rx_frag_t *frags,
+        uint32_t frag_count,
+        uint32_t pckt_length,
+        mss_mac_rx_desc_t *cdesc
+    )
+    {
+        uint32_t inc;
+
+        for(inc = 0U; inc < frag_count; inc++)
+        {
+            append_to_frame(frags[inc].addr, frags[inc].length);
+            MSS_MAC_receive_pkt((mss_mac_instance_t *)this_mac, queue_no,
+                                frags[inc].addr, frags[inc].p_user_data,
+                                MSS_MAC_INT_ENABLE);
+        }
+
+        process_frame(pckt_length);
+    }
+  @endcode
+ */
+void MSS_MAC_set_rx_chain_callback
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_receive_chain_callback_t rx_callback
+);
+#endif /* defined(MSS_MAC_RX_CHAINED) */
+
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+/***************************************************************************//**
+  The _MSS_MAC_set_rx_hdr_split()_ function turns header-data splitting on or
+  off for one of the Ethernet MAC's queues and registers the function that
+  will be called when a split frame is received.
+
+  With splitting on, the MAC writes the Ethernet, IP and TCP or UDP headers of
+  a frame into one receive buffer and the payload into the following buffers.
+  The driver copies the headers into a free slot of the _hdr_pool_, hands the
+  header buffer straight back to the receive ring and calls _rx_callback_ with
+  the slot and the payload buffers. The application hands the payload buffers
+  back with _MSS_MAC_receive_pkt()_ and the slot with _MSS_MAC_rx_hdr_release()_
+  when done with them. A split frame is dropped if all of the slots are held by
+  the application.
+
+  Frames which are not split, and all frames on queues without a split
+  callback, are handled as set by _MSS_MAC_set_rx_chain_callback()_. As the
+  split is set for the whole MAC, the other queues of the MAC should have a
+  chain callback while any queue has splitting on. The split should be turned on
+  before the receive buffers are given to the queue.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue to configure. For single queue devices
+    this should be set to 0 for compatibility purposes.
+
+  @param hdr_pool
+    This parameter is a pointer to _MSS_MAC_RX_HDR_SLOTS_ x
+    _MSS_MAC_RX_HDR_SIZE_ bytes of memory for the header slots, or _NULL_ to
+    turn splitting off for the queue.
+
+  @param rx_callback
+    This parameter is a pointer to the function that will be called when a
+    split frame is received on the selected queue.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    void rx_split_callback
+    (
+        void *this_mac,
+        uint32_t queue_no,
+        uint8_t *p_hdr,
+        uint32_t hdr_length,
+        const mss_mac_rx_frag_t *frags,
+        uint32_t frag_count,
+        uint32_t pckt_length,
+        mss_mac_rx_desc_t *cdesc
+    )
+    {
+        uint32_t inc;
+
+        if(0 == parse_headers(p_hdr, hdr_length))
+        {
+            for(inc = 0U; inc < frag_count; inc++)
+            {
+                store_payload(frags[inc].addr, frags[inc].length);
+                MSS_MAC_receive_pkt((mss_mac_instance_t *)this_mac, queue_no,
+                                    frags[inc].addr, frags[inc].p_user_data,
+                                    MSS_MAC_INT_ENABLE);
+            }
+        }
+
+        MSS_MAC_rx_hdr_release((mss_mac_instance_t *)this_mac, queue_no, p_hdr);
+    }
+
+    void start_rx(void)
+    {
+        uint8_t *hdr_pool;
+
+        hdr_pool = mss_l2_scratchpad_alloc(MSS_MAC_RX_HDR_SLOTS *
+                                           MSS_MAC_RX_HDR_SIZE, 64U);
+        MSS_MAC_set_rx_chain_callback(&g_mac0, 0, rx_chain_callback);
+        MSS_MAC_set_rx_hdr_split(&g_mac0, 0, hdr_pool, rx_split_callback);
+    }
+  @endcode
+ */
+void MSS_MAC_set_rx_hdr_split
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint8_t *hdr_pool,
+    mss_mac_receive_split_callback_t rx_callback
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_rx_hdr_release()_ function hands a header slot passed to the
+  split receive callback back to the queue's header pool. It can be called
+  from any context once the application has finished with the headers.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue the headers were received on.
+
+  @param p_hdr
+    This parameter is the header slot pointer passed to the callback.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_MAC_rx_hdr_release
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    const uint8_t *p_hdr
+);
+#endif /* defined(MSS_MAC_RX_HDR_SPLIT) */
+
 /***************************************************************************//**
   The _MSS_MAC_change_speed()_ function sets the speed and duplex mode for the
   link and if autonegotiation is selected as the speed mode, also sets the speed
@@ -953,17 +1521,81 @@ MSS_MAC_send_pkt
 
 
 /***************************************************************************//**
-  The _MSS_MAC_send_pkts()_ function initiates the transmission of one or more
-  packets on one or more queues. It initialises all the required transmit queues
-  and sets the transmit operation in motion.
+  The _MSS_MAC_send_pkt_gather()_ function initiates the transmission of a
+  packet made up of a number of separate buffers. Each fragment is placed into
+  its own transmit descriptor with the last one marked as the end of the frame
+  so the packet is sent without first being copied into a contiguous buffer.
 
-  Due to the requirement to keep an unused descriptor at the end of the
-  per-queue descriptor chains, this function will append at most
-  _MSS_MAC_TX_RING_SIZE_ - 1 packets to any queue. Any packets above this limit
-  will be silently ignored.
+  In all other respects this function behaves the same as _MSS_MAC_send_pkt()_.
+  The transmit completion handler is called once for the whole packet when it
+  has been sent and the fragment buffers must not be modified until then.
 
-  This function is non-blocking. It will return immediately without waiting for
-  the packets to be sent. The Ethernet MAC driver indicates that each packet is
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue to which this transmit operation
+    applies. For single queue devices this should be set to 0 for compatibility
+    purposes.
+
+  @param frags
+    This parameter is a pointer to an array of _mss_mac_tx_frag_t_ structures
+    describing the fragments of the packet in the order they are to be sent.
+
+  @param frag_count
+    This parameter specifies the number of fragments in the _frags_ array. It
+    must be less than _MSS_MAC_TX_RING_SIZE_.
+
+  @param p_user_data
+    This parameter is a pointer to an optional application defined data
+    structure which is passed back to the transmit completion handler.
+
+  @return
+    This function returns the same values as _MSS_MAC_send_pkt()_.
+
+  Example:
+  @code
+    void send_packet(uint8_t const *hdr, uint32_t hdr_len,
+                     uint8_t const *payload, uint32_t payload_len,
+                     void *packet)
+    {
+        mss_mac_tx_frag_t frags[2];
+
+        frags[0].addr   = hdr;
+        frags[0].length = hdr_len;
+        frags[1].addr   = payload;
+        frags[1].length = payload_len;
+
+        MSS_MAC_send_pkt_gather(&g_mac0, 0, frags, 2, packet);
+    }
+  @endcode
+ */
+int32_t
+MSS_MAC_send_pkt_gather
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_frag_t const *frags,
+    uint32_t frag_count,
+    void * p_user_data
+);
+
+
+/***************************************************************************//**
+  The _MSS_MAC_send_pkts()_ function initiates the transmission of one or more
+  packets on one or more queues. It initialises all the required transmit queues
+  and sets the transmit operation in motion.
+
+  Due to the requirement to keep an unused descriptor at the end of the
+  per-queue descriptor chains, this function will append at most
+  _MSS_MAC_TX_RING_SIZE_ - 1 packets to any queue. Any packets above this limit
+  will be silently ignored.
+
+  This function is non-blocking. It will return immediately without waiting for
+  the packets to be sent. The Ethernet MAC driver indicates that each packet is
   sent by calling the transmit completion handler registered by a call to
   _MSS_MAC_set_tx_callback()_.
 
@@ -1056,9 +1688,113 @@ MSS_MAC_send_pkts
     mss_mac_tx_pkt_info_t *p_packets
 );
 
+#if defined(MSS_MAC_TX_BATCH)
+/***************************************************************************//**
+  The _MSS_MAC_send_pkt_batch()_ function posts a list of packets to one of the
+  Ethernet MAC's queues and starts them all transmitting with a single write to
+  the transmit start bit.
+
+  The packets are only accepted when the queue is idle. If there are more
+  packets than fit in the descriptor ring, the first _MSS_MAC_TX_RING_SIZE_ - 1
+  are sent and the return value tells the caller how many were taken so the
+  rest can be posted again once the batch completes. If the queue is still busy
+  with the previous batch, no packets are taken and the function checks the
+  state of the queue in the same way as _MSS_MAC_send_pkt()_.
+
+  Setting b31 of a packet's length field sends that packet without the CRC
+  appended. The _queue_no_ field of the packet entries is ignored.
+
+  This function can be called from the transmit or receive callbacks of the
+  MAC as well as from normal code. It is non-blocking and returns immediately
+  without waiting for the packets to be sent.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue to send the packets on. For single
+    queue devices this should be set to 0.
+
+  @param p_packets
+    This parameter is a pointer to an array of _mss_mac_tx_pkt_info_t_
+    structures describing the packets to send. The array does not need an end
+    of list entry.
+
+  @param pkt_count
+    This parameter is the number of packets in the array.
+
+  @return
+    This function returns the number of packets accepted for transmission if
+    the batch was started, otherwise one of the following values:
+
+     - ___MSS_MAC_ERR_NOT_DONE___ if the previous batch has not finished
+          sending.
+     - ___MSS_MAC_ERR_TX_NOT_OK___ for general errors.
+     - ___MSS_MAC_ERR_TX_TIMEOUT___ If the previous batch has not released the
+          queue buffers after the MAC completes the send.
+     - ___MSS_MAC_ERR_TX_FAIL___ If the previous batch has not released the
+          queue buffers after the MAC completes the send and there is an error
+          flagged in the tx descriptor.
+
+  Example:
+  This example sends an array of packets on queue 2, posting the remainder
+  each time the previous batch completes.
+
+  @code
+    static mss_mac_tx_pkt_info_t g_pkts[100];
+    static uint32_t g_pkts_sent;
+    static volatile uint32_t g_tx_idle = 1U;
+
+    void tx_batch_done(void *this_mac, uint32_t queue_no,
+                       mss_mac_tx_desc_t *cdescs, void * const *p_user_data,
+                       uint32_t count)
+    {
+        g_tx_idle = 1U;
+    }
+
+    void send_all(void)
+    {
+        int32_t status;
+
+        MSS_MAC_set_tx_batch_callback(&g_mac0, 2, tx_batch_done);
+        g_pkts_sent = 0U;
+        while(g_pkts_sent < 100U)
+        {
+            if(0U != g_tx_idle)
+            {
+                g_tx_idle = 0U;
+                status = MSS_MAC_send_pkt_batch(&g_mac0, 2, &g_pkts[g_pkts_sent],
+                                                100U - g_pkts_sent);
+                if(status > 0)
+                {
+                    g_pkts_sent += (uint32_t)status;
+                }
+                else
+                {
+                    g_tx_idle = 1U;
+                }
+            }
+        }
+    }
+  @endcode
+ */
+int32_t
+MSS_MAC_send_pkt_batch
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_pkt_info_t const *p_packets,
+    uint32_t pkt_count
+);
+#endif
+
 #if defined(MSS_MAC_SPEED_TEST)
 /***************************************************************************//**
  * Non standard function for network saturation speed tests. Not for normal use.
+ * Applications should use _MSS_MAC_send_pkt_batch()_ instead.
  */
 int32_t
 MSS_MAC_send_pkts_fast
@@ -1202,6 +1938,382 @@ MSS_MAC_receive_pkt_isr
 #endif
 
 
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+/***************************************************************************//**
+  The _MSS_MAC_rx_pool_init()_ function attaches a driver managed receive
+  buffer pool to one of the Ethernet MAC's receive queues. The memory pointed
+  to by _pool_mem_ is divided into _buf_count_ buffers of _buf_size_ bytes and
+  the driver uses these buffers to populate the queue's receive descriptor
+  ring.
+
+  Once the pool is attached, the driver refills the receive ring from the pool
+  itself after each burst of received packets. The receive callback is passed
+  a pointer to the _mss_mac_rx_buf_t_ handle for the buffer as its
+  _caller_info_ parameter. The application owns one reference to the buffer on
+  entry to the callback and may hold on to it after the callback returns, for
+  example to pass the buffer up a TCP/IP stack. The buffer is returned to the
+  pool when the application calls _MSS_MAC_rx_buf_release()_.
+
+  __Note:__ _MSS_MAC_receive_pkt()_ must not be used on a queue that has a
+  receive buffer pool attached. Any buffers previously allocated to the queue
+  with _MSS_MAC_receive_pkt()_ are discarded by this function.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue the pool is attached to. For single
+    queue devices this should be set to 0 for compatibility purposes.
+
+  @param pool_mem
+    This parameter is a pointer to a word aligned block of memory at least
+    _buf_size_ * _buf_count_ bytes long.
+
+  @param buf_size
+    This parameter is the size of each buffer in bytes. It must be a multiple
+    of 8 and at least _MSS_MAC_MAX_RX_BUF_SIZE_.
+
+  @param buf_count
+    This parameter is the number of buffers in the pool. It must not be greater
+    than _MSS_MAC_RX_POOL_SIZE_.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the pool was attached to the
+    queue and _MSS_MAC_FAILED_ otherwise.
+
+  Example:
+  @code
+    #define RX_POOL_BUFS (MSS_MAC_RX_RING_SIZE * 2U)
+
+    static uint8_t rx_pool_mem[RX_POOL_BUFS][MSS_MAC_MAX_RX_BUF_SIZE] __attribute__ ((aligned (8)));
+
+    void rx_callback
+    (
+        void *this_mac,
+        uint32_t queue_no,
+        uint8_t * p_rx_packet,
+        uint32_t pckt_length,
+        mss_mac_rx_desc_t *cdesc,
+        void * caller_info
+    )
+    {
+        queue_rx_packet((mss_mac_rx_buf_t *)caller_info);
+    }
+
+    void process_rx_packets(void)
+    {
+        mss_mac_rx_buf_t *p_buf;
+
+        while(0 != (p_buf = dequeue_rx_packet()))
+        {
+            process_rx_packet(p_buf->buffer, p_buf->length);
+            MSS_MAC_rx_buf_release(p_buf);
+        }
+    }
+
+    void init(void)
+    {
+        MSS_MAC_set_rx_callback(&g_mac0, 0, rx_callback);
+        MSS_MAC_rx_pool_init(&g_mac0, 0, &rx_pool_mem[0][0],
+                             MSS_MAC_MAX_RX_BUF_SIZE, RX_POOL_BUFS);
+    }
+  @endcode
+ */
+uint8_t
+MSS_MAC_rx_pool_init
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint8_t *pool_mem,
+    uint32_t buf_size,
+    uint32_t buf_count
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_rx_pool_refill()_ function attaches free buffers from a queue's
+  receive buffer pool to any empty descriptors in the queue's receive ring.
+
+  The driver does this automatically after each burst of received packets and
+  whenever a buffer is released while the ring is short of buffers, so this
+  function is normally only needed by applications that poll the queue.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue to refill.
+
+  @return
+    This function returns the number of descriptors that were re-armed.
+ */
+uint32_t
+MSS_MAC_rx_pool_refill
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_rx_buf_ref()_ function adds a reference to a receive buffer
+  handed to the application by the receive callback. Each call must be matched
+  by a call to _MSS_MAC_rx_buf_release()_.
+
+  @param p_buf
+    This parameter is the buffer handle passed to the receive callback as its
+    _caller_info_ parameter.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_rx_buf_ref
+(
+    mss_mac_rx_buf_t *p_buf
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_rx_buf_release()_ function drops a reference to a receive buffer
+  handed to the application by the receive callback. When the last reference is
+  dropped, the buffer is returned to the receive buffer pool it came from.
+
+  This function may be called from the receive callback or from task level
+  code.
+
+  @param p_buf
+    This parameter is the buffer handle passed to the receive callback as its
+    _caller_info_ parameter.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_rx_buf_release
+(
+    mss_mac_rx_buf_t *p_buf
+);
+#endif /* defined(MSS_MAC_RX_BUFFER_POOL) */
+
+
+#if defined(MSS_MAC_RX_POLL_MODE)
+/***************************************************************************//**
+  The _MSS_MAC_set_rx_poll_mode()_ function selects interrupt driven or polled
+  receive operation for one of the Ethernet MAC's queues.
+
+  With polled operation selected, the driver masks the queue's receive complete
+  and used bit read interrupts when the first packet arrives and calls the
+  _rx_poll_sched_ function from the interrupt handler. The
+  _rx_poll_sched_ function should arrange for _MSS_MAC_rx_poll()_ to be called
+  for the queue from task level. No further receive interrupts occur for the
+  queue until the receive ring has been emptied by _MSS_MAC_rx_poll()_.
+
+  Transmit and error interrupts are not affected by this function.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue to configure. For single queue devices
+    this should be set to 0 for compatibility purposes.
+
+  @param rx_poll_sched
+    This parameter is a pointer to the function which schedules polling for
+    the queue. Passing _NULL_ returns the queue to interrupt driven operation.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    void rx_poll_sched(void *this_mac, uint32_t queue_no)
+    {
+        xTaskNotifyFromISR(g_rx_task, 1U << queue_no, eSetBits, 0);
+    }
+
+    void rx_task(void *pvParameters)
+    {
+        uint32_t queues;
+
+        MSS_MAC_set_rx_poll_mode(&g_mac0, 1, rx_poll_sched);
+        for(;;)
+        {
+            xTaskNotifyWait(0, 0xFFFFFFFFU, &queues, portMAX_DELAY);
+            while(64U == MSS_MAC_rx_poll(&g_mac0, 1, 64U))
+            {
+                taskYIELD();
+            }
+        }
+    }
+  @endcode
+ */
+void
+MSS_MAC_set_rx_poll_mode
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_rx_poll_sched_t rx_poll_sched
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_rx_poll()_ function processes up to _budget_ received packets on
+  one of the Ethernet MAC's queues, calling the receive callback for each one
+  as the receive interrupt handler would.
+
+  If fewer than _budget_ packets were waiting, the receive ring is now empty
+  and the driver re-enables the queue's receive interrupts. If the full budget
+  was used, receive interrupts remain masked and the application should call
+  this function again after giving other work a chance to run.
+
+  This function must not be called from the queue's interrupt handler.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue to poll.
+
+  @param budget
+    This parameter is the maximum number of packets to process in this call.
+
+  @return
+    This function returns the number of packets processed.
+ */
+uint32_t
+MSS_MAC_rx_poll
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint32_t budget
+);
+#endif /* defined(MSS_MAC_RX_POLL_MODE) */
+
+#if defined(MSS_MAC_BUSY_POLL)
+/***************************************************************************//**
+  The _MSS_MAC_set_busy_poll()_ function hands one of the Ethernet MAC's queues
+  over to a hart which busy polls it, or returns it to interrupt driven
+  operation.
+
+  Enabling busy polling disables the queue's PLIC or local interrupt and masks
+  all of the queue's interrupt sources in the MAC. The calling hart then owns
+  the queue and calls _MSS_MAC_poll_rx()_ and _MSS_MAC_poll_tx_complete()_ in a
+  loop. The receive and transmit callbacks run from those calls, and the
+  _MSS_MAC_receive_pkt()_ and _MSS_MAC_send_pkt()_ functions may be called from
+  the callbacks or the loop without the driver touching the PLIC.
+
+  Disabling busy polling clears the queue's interrupt status and re-enables the
+  interrupts which were enabled when busy polling started.
+
+  Error conditions such as receive overruns and AMBA errors are not reported
+  while a queue is busy polled. This mode must not be combined with
+  _MSS_MAC_set_rx_poll_mode()_ on the same queue and should only be used from
+  the hart which polls the queue.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue to configure. For single queue devices
+    this should be set to 0 for compatibility purposes.
+
+  @param enable
+    This parameter is non zero to start busy polling the queue and 0 to go back
+    to interrupt driven operation.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    void net_hart_loop(void)
+    {
+        MSS_MAC_set_busy_poll(&g_mac0, 1, 1U);
+        for(;;)
+        {
+            (void)MSS_MAC_poll_rx(&g_mac0, 1, 32U);
+            (void)MSS_MAC_poll_tx_complete(&g_mac0, 1);
+        }
+    }
+  @endcode
+ */
+void
+MSS_MAC_set_busy_poll
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint32_t enable
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_poll_rx()_ function processes up to _budget_ received packets on
+  a busy polled queue, calling the receive callback for each one.
+
+  The function first checks the ownership bit of the next receive descriptor in
+  memory. When no packet is waiting it returns without accessing any of the MAC
+  registers, so it is cheap to call in a tight loop.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue to poll.
+
+  @param budget
+    This parameter is the maximum number of packets to process in this call.
+
+  @return
+    This function returns the number of packets processed. It returns 0 if the
+    queue is not busy polled.
+ */
+uint32_t
+MSS_MAC_poll_rx
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint32_t budget
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_poll_tx_complete()_ function reclaims the transmit descriptors
+  of a busy polled queue which the MAC has finished with, calling the transmit
+  callback for each packet sent.
+
+  The function only does any work when packets are outstanding and the oldest
+  one has been handed back by the MAC, otherwise it returns without accessing
+  any of the MAC registers.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue to poll.
+
+  @return
+    This function returns the number of descriptors reclaimed. When
+    _MSS_MAC_TX_SPSC_RING_ is defined the ring service does the reclaiming and
+    also posts any packets waiting in the ring, and this function returns 1 if
+    there was anything to reclaim.
+ */
+uint32_t
+MSS_MAC_poll_tx_complete
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no
+);
+#endif /* defined(MSS_MAC_BUSY_POLL) */
+
+
 /***************************************************************************//**
   The _MSS_MAC_get_link_status()_ function retrieves the status of the link from
   the Ethernet PHY. It returns the current state of the Ethernet link. The speed
@@ -1314,6 +2426,101 @@ void MSS_MAC_clear_statistics
     const mss_mac_instance_t *this_mac
 );
 
+#if defined(MSS_MAC_ASYNC_LINK)
+/***************************************************************************//**
+  The _MSS_MAC_link_poll()_ function takes the next step of the link bring-up
+  of a MAC initialised with the _async_link_ configuration parameter set. Each
+  call makes a few MDIO or register accesses and does not wait for the PHY.
+  A step waiting for the PHY checks once per call and moves on after
+  _MSS_MAC_LINK_POLL_LIMIT_ calls, as the blocking bring-up does on timeout.
+  When the autonegotiation is done, the MAC is set to the negotiated speed and
+  duplex mode.
+
+  The function can be called from a timer interrupt or the PHY interrupt
+  handler, every 10ms for example. It must not be called while another MDIO
+  access to the same PHY is in progress, e.g. _MSS_MAC_get_link_status()_ from
+  a task.
+
+  For an eMAC or a MAC initialised without _async_link_, the bring-up is done
+  by _MSS_MAC_init()_ and the function returns _MSS_MAC_LINK_READY_.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @return
+    This function returns the step of the bring-up reached.
+
+  Example:
+  @code
+    void link_timer_isr(void)
+    {
+        if(MSS_MAC_LINK_READY == MSS_MAC_link_poll(&g_mac0))
+        {
+            stop_link_timer();
+            netif_set_link_up(&g_netif);
+        }
+    }
+
+    void init_network(void)
+    {
+        MSS_MAC_cfg_struct_def_init(&g_mac_config);
+        g_mac_config.async_link = MSS_MAC_ENABLE;
+        ...
+        MSS_MAC_init(&g_mac0, &g_mac_config);
+        start_link_timer(10U);
+    }
+  @endcode
+ */
+mss_mac_link_state_t
+MSS_MAC_link_poll
+(
+    mss_mac_instance_t *this_mac
+);
+#endif /* defined(MSS_MAC_ASYNC_LINK) */
+
+#if defined(MSS_MAC_PERF_STATS)
+/***************************************************************************//**
+  The _MSS_MAC_get_stats()_ function takes a snapshot of the GEM statistics
+  registers together with the driver's own per queue counters. The queue
+  interrupts are masked while the snapshot is taken so the values are
+  consistent with each other.
+
+  The driver counters include the number of interrupts per queue, the mcycle
+  time spent in them, the descriptors processed per interrupt and the
+  high-water marks of the transmit and receive rings. Comparing two snapshots
+  shows where throughput is being lost.
+
+  The GEM statistics registers clear when read, so the driver keeps running
+  totals of them. Calling _MSS_MAC_read_stat()_ directly takes counts away from
+  these totals. This function must not be called from the MAC's interrupt
+  callbacks.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param p_stats
+    This parameter is a pointer to the structure which receives the snapshot.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    mss_mac_stats_t stats;
+
+    MSS_MAC_get_stats(&g_mac0, &stats);
+    avg_isr_cycles = stats.queue[0].perf.isr_cycles / stats.queue[0].perf.isr_count;
+  @endcode
+ */
+void MSS_MAC_get_stats
+(
+    mss_mac_instance_t *this_mac,
+    mss_mac_stats_t *p_stats
+);
+#endif
+
 /***************************************************************************//**
   The _MSS_MAC_read_phy_reg()_ function reads the Ethernet PHY register
   specified as parameter. It uses the MII management interface to communicate
@@ -1341,26 +2548,142 @@ void MSS_MAC_clear_statistics
     address is the offset of the register within the Ethernet PHY's register
     map.
 
-  @return 
-    This function returns the 16-bit value of the requested register.
+  @return 
+    This function returns the 16-bit value of the requested register.
+
+  Example:
+  @code
+    #include "phy.h"
+    uint16_t read_phy_status(uint8_t phy_addr)
+    {
+        uint16_t phy_status = MSS_MAC_read_phy_reg(&g_mac0, phy_addr, MII_BMSR);
+        return phy_status;
+    }
+  @endcode
+ */
+uint16_t
+MSS_MAC_read_phy_reg
+(
+    const mss_mac_instance_t *this_mac,
+    uint8_t phyaddr,
+    uint8_t regaddr
+);
+
+#if defined(MSS_MAC_MDIO_QUEUE)
+/***************************************************************************//**
+  The _MSS_MAC_mdio_submit()_ function starts a script of PHY register
+  operations and returns. The operations are run in order, each one started
+  from the GEM management frame sent interrupt of the MAC driving the MDIO
+  interface as the previous one completes. The results of the reads are
+  written back into _ops_ and _done_ is called once the last operation is done.
+
+  The queue 0 interrupt of the MAC driving the MDIO interface must be enabled
+  for the script to progress on its own. Otherwise, _MSS_MAC_mdio_poll()_ must
+  be called until _MSS_MAC_mdio_busy()_ returns 0.
+
+  _MSS_MAC_read_phy_reg()_ and _MSS_MAC_write_phy_reg()_ finish a running
+  script before their own access, so they can still be used.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param ops
+    This parameter is a pointer to the operations, which must stay valid until
+    the script is done.
+
+  @param count
+    This parameter is the number of operations.
+
+  @param done
+    This parameter is the function called when the script is done, or _NULL_.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the script was started and
+    _MSS_MAC_FAILED_ if a script is already running.
+
+  Example:
+  @code
+    static mss_mac_mdio_op_t g_phy_script[] =
+    {
+        {MSS_MAC_MDIO_WRITE,  0U, 31U, 0x0000U, 0x0002U},
+        {MSS_MAC_MDIO_MODIFY, 0U, 27U, 0x00E0U, 0x0080U},
+        {MSS_MAC_MDIO_WRITE,  0U, 31U, 0x0000U, 0x0000U},
+        {MSS_MAC_MDIO_READ,   0U, MII_BMSR, 0x0000U, 0x0000U}
+    };
+
+    (void)MSS_MAC_mdio_submit(&g_mac0, g_phy_script, 4U, phy_script_done);
+  @endcode
+ */
+uint8_t
+MSS_MAC_mdio_submit
+(
+    mss_mac_instance_t *this_mac,
+    mss_mac_mdio_op_t *ops,
+    uint32_t count,
+    mss_mac_mdio_done_t done
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_mdio_run()_ function runs a script of PHY register operations,
+  as _MSS_MAC_mdio_submit()_ does, and returns once it is done. Each operation
+  is started as soon as the previous one completes. Interrupts are only masked
+  while an operation is started.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param ops
+    This parameter is a pointer to the operations.
+
+  @param count
+    This parameter is the number of operations.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_mdio_run
+(
+    mss_mac_instance_t *this_mac,
+    mss_mac_mdio_op_t *ops,
+    uint32_t count
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_mdio_poll()_ function starts the next operation of the running
+  script if the previous one is done. It does not wait for the MDIO interface.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_mdio_poll
+(
+    mss_mac_instance_t *this_mac
+);
 
-  Example:
-  @code
-    #include "phy.h"
-    uint16_t read_phy_status(uint8_t phy_addr)
-    {
-        uint16_t phy_status = MSS_MAC_read_phy_reg(&g_mac0, phy_addr, MII_BMSR);
-        return phy_status;
-    }
-  @endcode
+/***************************************************************************//**
+  The _MSS_MAC_mdio_busy()_ function tells whether a script is running.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @return
+    This function returns non 0 while a script is running.
  */
-uint16_t
-MSS_MAC_read_phy_reg
+uint32_t
+MSS_MAC_mdio_busy
 (
-    const mss_mac_instance_t *this_mac,
-    uint8_t phyaddr,
-    uint8_t regaddr
+    const mss_mac_instance_t *this_mac
 );
+#endif /* defined(MSS_MAC_MDIO_QUEUE) */
 
 /***************************************************************************//**
   The _MSS_MAC_write_phy_reg()_ function writes a 16-bit value to the specified
@@ -1596,6 +2919,101 @@ MSS_MAC_read_TSU
     mss_mac_tsu_time_t *tsu_time
 );
 
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
+/***************************************************************************//**
+  The _MSS_MAC_get_rx_timestamp()_ function returns the time at which a packet
+  was received, from the time stamp the GEM wrote to its DMA descriptor. It is
+  called from the receive callback with the _cdesc_ parameter passed to the
+  callback. The descriptor only holds the nanoseconds and the low 6 bits of the
+  seconds; the rest of the seconds come from the TSU count latched by the
+  driver as it started on the receive ring, so no TSU access is made.
+
+  Time stamps are only recorded for the packets selected with
+  _MSS_MAC_set_TSU_rx_mode()_.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue the packet was received on, as passed
+    to the callback.
+
+  @param cdesc
+    This parameter is the descriptor pointer passed to the callback.
+
+  @param tsu_time
+    This parameter is a pointer to an _mss_mac_tsu_time_t_ structure which the
+    driver populates with the receive time.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the descriptor holds a time
+    stamp and _MSS_MAC_FAILED_ otherwise.
+
+  Example:
+  @code
+    void rx_callback(void *this_mac, uint32_t queue_no, uint8_t *p_rx_packet,
+                     uint32_t pckt_length, mss_mac_rx_desc_t *cdesc,
+                     void *caller_info)
+    {
+        mss_mac_tsu_time_t rx_time;
+
+        if(MSS_MAC_SUCCESS == MSS_MAC_get_rx_timestamp(this_mac, queue_no,
+                                                       cdesc, &rx_time))
+        {
+            ptp_rx_event(p_rx_packet, pckt_length, &rx_time);
+        }
+        ...
+    }
+  @endcode
+ */
+uint8_t
+MSS_MAC_get_rx_timestamp
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    const mss_mac_rx_desc_t *cdesc,
+    mss_mac_tsu_time_t *tsu_time
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_get_tx_timestamp()_ function returns the time at which a packet
+  was transmitted, from the time stamp the GEM wrote to its DMA descriptor. It
+  is called from the transmit callback with the _cdesc_ parameter passed to the
+  callback and works as _MSS_MAC_get_rx_timestamp()_ does.
+
+  Time stamps are only recorded for the packets selected with
+  _MSS_MAC_set_TSU_tx_mode()_.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue the packet was sent on, as passed to
+    the callback.
+
+  @param cdesc
+    This parameter is the descriptor pointer passed to the callback.
+
+  @param tsu_time
+    This parameter is a pointer to an _mss_mac_tsu_time_t_ structure which the
+    driver populates with the transmit time.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the descriptor holds a time
+    stamp and _MSS_MAC_FAILED_ otherwise.
+ */
+uint8_t
+MSS_MAC_get_tx_timestamp
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    const mss_mac_tx_desc_t *cdesc,
+    mss_mac_tsu_time_t *tsu_time
+);
+#endif /* defined(MSS_MAC_DESC_TIMESTAMPS) */
+
 /***************************************************************************//**
   The _MSS_MAC_set_TSU_rx_mode()_ function configures time stamp recording for
   received packets. This allows recording the TSU value for received packets in
@@ -2272,6 +3690,40 @@ MSS_MAC_get_hash_mode
     const mss_mac_instance_t *this_mac
 );
 
+/***************************************************************************//**
+  The _MSS_MAC_calc_hash_index()_ function calculates the bit in the 64 bit
+  addressing hash field which matches a given MAC address.
+
+  @param mac_addr
+    This parameter of type pointer to _uint8_t_, points to the 6 byte MAC
+    address.
+
+  @return
+    This function returns the index, 0 to 63, of the hash bit for the address.
+
+  Example:
+  This example sets the hash bit for the multicast MAC address 01:80:C2:00:00:0E
+  and configures the Ethernet MAC to only use hashing to match multicast
+  addresses.
+  @code
+    void set_gem_hash(void)
+    {
+        uint8_t mac_address[6] = {0x01, 0x80, 0xc2, 0x00, 0x00, 0x0e};
+        uint64_t current_hash;
+
+        current_hash = MSS_MAC_get_hash(&g_mac0);
+        current_hash |= 1ULL << MSS_MAC_calc_hash_index(mac_address);
+        MSS_MAC_set_hash_mode(&g_mac0, MSS_MAC_HASH_MULTICAST);
+        MSS_MAC_set_hash(&g_mac0, current_hash);
+    }
+  @endcode
+ */
+uint32_t
+MSS_MAC_calc_hash_index
+(
+    const uint8_t *mac_addr
+);
+
 /***************************************************************************//**
   The _MSS_MAC_set_type_filter()_ function is used to configure the specific 
   type filters in the Ethernet MAC. These filters allow selective reception of
@@ -2421,44 +3873,298 @@ MSS_MAC_set_sa_filter
     There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
     and eMAC1.
 
-  @param filter
-    This parameter of type _uint16_t_, selects which filter to retrieve from.
-    The valid range is 2 to 4 to match the numbering in the GEM documentation.
-    
-    __Note:__ Filter 1 is reserved for the MAC address of the device and cannot
-    be read using this function.
+  @param filter
+    This parameter of type _uint16_t_, selects which filter to retrieve from.
+    The valid range is 2 to 4 to match the numbering in the GEM documentation.
+    
+    __Note:__ Filter 1 is reserved for the MAC address of the device and cannot
+    be read using this function.
+
+  @param mac_addr
+    This parameter of type pointer to _uint8_t_, points to a storage location
+    where the 6 byte MAC address from the filter will be stored.
+
+  @return
+    This function returns a value of type _uint16_t_, which has the same format
+    as the control parameter for the _MSS_MAC_set_sa_filter()_ function.
+
+
+  Example:
+    This example reads the filter settings for filter 2 on the pMAC of GEM 0.
+
+  @code
+    #include "mss_ethernet_mac.h"
+
+    void read_sa_filter_2(void)
+    {
+        uint16_t control;
+        uint8_t  mac_addr[6];
+
+        control = MSS_MAC_get_sa_filter(&g_mac0, 2, mac_addr);
+    }
+  @endcode
+ */
+uint16_t
+MSS_MAC_get_sa_filter
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t filter,
+    uint8_t *mac_addr
+);
+
+#if defined(MSS_MAC_MCAST_FILTER)
+/***************************************************************************//**
+  The _MSS_MAC_mcast_add()_ function adds a multicast address to the list of
+  addresses the Ethernet MAC receives, or counts one more user of an address
+  already in the list.
+
+  The first _MSS_MAC_MCAST_SA_FILTERS_ addresses in the list are matched
+  exactly with specific address filters 2 onwards. The rest are matched with
+  the hash filter, which also passes any other multicast address sharing a
+  hash bit with one of them. The filters used and the hash field belong to the
+  multicast list while it is in use and should not also be set with
+  _MSS_MAC_set_sa_filter()_ or _MSS_MAC_set_hash()_.
+
+  The list functions must not be called from an interrupt handler or from more
+  than one task at a time for the same MAC.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param mac_addr
+    This parameter of type pointer to _uint8_t_, points to the 6 byte multicast
+    MAC address to add.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the address was added or counted
+    and _MSS_MAC_FAILED_ if it is not a multicast address or the list is full.
+
+  Example:
+    This example joins the IPv4 all hosts and mDNS groups on the pMAC of GEM 0.
+
+  @code
+    #include "mss_ethernet_mac.h"
+
+    void join_groups(void)
+    {
+        static const uint8_t all_hosts[6] = {0x01, 0x00, 0x5e, 0x00, 0x00, 0x01};
+        static const uint8_t mdns[6] = {0x01, 0x00, 0x5e, 0x00, 0x00, 0xfb};
+
+        (void)MSS_MAC_mcast_add(&g_mac0, all_hosts);
+        (void)MSS_MAC_mcast_add(&g_mac0, mdns);
+    }
+  @endcode
+ */
+uint8_t
+MSS_MAC_mcast_add
+(
+    mss_mac_instance_t *this_mac,
+    const uint8_t *mac_addr
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_mcast_remove()_ function undoes one _MSS_MAC_mcast_add()_ of a
+  multicast address. The address is taken out of the filters when the last add
+  has been undone.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param mac_addr
+    This parameter of type pointer to _uint8_t_, points to the 6 byte multicast
+    MAC address to remove.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the address was in the list and
+    _MSS_MAC_FAILED_ if not.
+ */
+uint8_t
+MSS_MAC_mcast_remove
+(
+    mss_mac_instance_t *this_mac,
+    const uint8_t *mac_addr
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_mcast_clear()_ function empties the multicast list, releasing
+  the specific address filters it used and turning off multicast hash
+  matching.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_mcast_clear
+(
+    mss_mac_instance_t *this_mac
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_mcast_get_count()_ function returns the number of different
+  addresses in the multicast list.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @return
+    This function returns the number of addresses in the list.
+ */
+uint32_t
+MSS_MAC_mcast_get_count
+(
+    const mss_mac_instance_t *this_mac
+);
+#endif /* defined(MSS_MAC_MCAST_FILTER) */
+
+#if defined(MSS_MAC_CAPTURE)
+/***************************************************************************//**
+  The _MSS_MAC_capture_start()_ function starts capturing the frames of an
+  Ethernet MAC into a ring in memory.
+
+  The first _snaplen_ bytes of each frame received, if _MSS_MAC_CAPTURE_RX_ is
+  set in _flags_, and of each frame sent with _MSS_MAC_send_pkt()_ or
+  _MSS_MAC_send_pkt_gather()_, if _MSS_MAC_CAPTURE_TX_ is set, are copied into
+  the ring along with a TSU time stamp. Received frames are stamped with the
+  descriptor time stamp when _MSS_MAC_DESC_TIMESTAMPS_ is defined and the frame
+  has one, otherwise frames are stamped when the driver handles them. The TSU
+  should be set running with _MSS_MAC_init_TSU()_.
+
+  The cost to each frame is the copy and a TSU read so a short _snaplen_, 128
+  bytes for example, keeps the headers at little cost to throughput. Frames
+  which do not fit in the ring are counted in _dropped_ and not captured, the
+  ring is emptied by _MSS_MAC_capture_dump()_.
+
+  Frames are captured by the MAC's interrupt handlers and send functions.
+  These should all run on the same hart while capturing.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param cap
+    This parameter points to the capture ring. Its _mem_, _size_, _snaplen_
+    and _flags_ members must be set up. _size_ is a power of 2 of at least 4096
+    bytes and _mem_ is aligned to 8 bytes.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if capture was started and
+    _MSS_MAC_FAILED_ if the ring is not valid.
+
+  Example:
+  @code
+    static uint8_t cap_mem[0x1000000] __attribute__ ((aligned (8)));
+    static mss_mac_capture_t cap;
+
+    void start_capture(void)
+    {
+        cap.mem     = cap_mem;
+        cap.size    = sizeof(cap_mem);
+        cap.snaplen = 128U;
+        cap.flags   = MSS_MAC_CAPTURE_RX | MSS_MAC_CAPTURE_TX;
+        (void)MSS_MAC_capture_start(&g_mac0, &cap);
+    }
+  @endcode
+ */
+uint8_t
+MSS_MAC_capture_start
+(
+    mss_mac_instance_t *this_mac,
+    mss_mac_capture_t *cap
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_capture_stop()_ function stops capturing the frames of an
+  Ethernet MAC. A frame being captured by another hart when this is called may
+  still be added to the ring.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_capture_stop
+(
+    mss_mac_instance_t *this_mac
+);
 
-  @param mac_addr
-    This parameter of type pointer to _uint8_t_, points to a storage location
-    where the 6 byte MAC address from the filter will be stored.
+/***************************************************************************//**
+  The _MSS_MAC_capture_dump()_ function writes the frames in a capture ring out
+  in pcap format, with nanosecond time stamps, and removes them from the ring.
+  It may be called while capture is running, from any hart, to keep the ring
+  from filling. Only one dump may run on a ring at a time.
 
-  @return
-    This function returns a value of type _uint16_t_, which has the same format
-    as the control parameter for the _MSS_MAC_set_sa_filter()_ function.
+  The output is passed to _write_fn_ a record at a time. The pcap file header
+  is written first if _pcap_header_ is not 0, so the first dump of a capture
+  session should set it and any later dumps appending to the same file should
+  not.
 
+  @param cap
+    This parameter points to the capture ring.
 
-  Example:
-    This example reads the filter settings for filter 2 on the pMAC of GEM 0.
+  @param write_fn
+    This parameter is the function which writes out the pcap data, to the eMMC
+    or a UART for example. Returning anything other than _MSS_MAC_SUCCESS_
+    stops the dump, the record it was given stays in the ring.
 
-  @code
-    #include "mss_ethernet_mac.h"
+  @param ctx
+    This parameter is passed to _write_fn_.
 
-    void read_sa_filter_2(void)
+  @param pcap_header
+    This parameter is non zero to start with the pcap file header.
+
+  @return
+    This function returns the number of frames written.
+
+  Example:
+    This example sends the capture out of a UART, to be turned back into a
+    file on the host. Writing to the eMMC would instead gather the data into
+    512 byte blocks for _MSS_MMC_single_block_write()_.
+  @code
+    static uint8_t uart_write(void *ctx, const uint8_t *data, uint32_t length)
     {
-        uint16_t control;
-        uint8_t  mac_addr[6];
+        MSS_UART_polled_tx((mss_uart_instance_t *)ctx, data, length);
 
-        control = MSS_MAC_get_sa_filter(&g_mac0, 2, mac_addr);
+        return(MSS_MAC_SUCCESS);
+    }
+
+    void dump_capture(void)
+    {
+        MSS_MAC_capture_stop(&g_mac0);
+        (void)MSS_MAC_capture_dump(&cap, uart_write, &g_mss_uart1_lo, 1U);
     }
   @endcode
  */
-uint16_t
-MSS_MAC_get_sa_filter
+uint32_t
+MSS_MAC_capture_dump
 (
-    const mss_mac_instance_t *this_mac,
-    uint32_t filter,
-    uint8_t *mac_addr
+    mss_mac_capture_t *cap,
+    mss_mac_capture_write_t write_fn,
+    void *ctx,
+    uint32_t pcap_header
 );
+#endif /* defined(MSS_MAC_CAPTURE) */
 
 /***************************************************************************//**
   The _MSS_MAC_set_type_1_filter()_ function is used to configure the Type 1
@@ -3083,105 +4789,440 @@ MSS_MAC_get_type_2_ethertype
     }
   @endcode
  */
-void
-MSS_MAC_set_type_2_compare
+void
+MSS_MAC_set_type_2_compare
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t comparer_no_in,
+    const mss_mac_type_2_compare_t *comparer
+);
+
+
+/***************************************************************************//**
+  The _MSS_MAC_get_type_2_compare()_ function is used to retrieve the current
+  Type 2 data matching blocks configuration from the Ethernet MAC.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param comparer_no_in
+    This parameter of type _uint32_t_, selects which compare block to retrieve.
+    The valid range is 0 to 11 for pMACs and 0 to 5 for eMACs.
+
+  @param comparer
+    This parameter of type pointer to _mss_mac_type_2_compare_t_, is the address
+    of the configuration structure which will receive a copy of the current
+    comparer block setup.
+
+  @return
+    This function does not return a value.
+
+  Example:
+    This example configures 2 filters which route IP packets with 0x9E, 0x48,
+    0x05, 0x0F at offset 0x48 to queue 3 and ARP packets with 12 x 0xFF at
+    offset 0x30 to queue 2. The example also checks to see if Ethertype block 0
+    has already been configured and only proceeds if it is not configured.
+
+  @code
+    #include "mss_ethernet_mac.h"
+
+    void init_t2_filters(void)
+    {
+        mss_mac_type_2_filter_t filter;
+        mss_mac_type_2_compare_t compare;
+
+        if(0 == MSS_MAC_get_type_2_ethertype(&g_mac0, 0))
+        {
+            MSS_MAC_set_type_2_ethertype(&g_mac0, 0, 0x0800);
+
+            compare.disable_mask = 1;
+            compare.data = 0x0F05489EUL;
+            compare.compare_offset = MSS_MAC_T2_OFFSET_FRAME;
+            compare.offset_value = 0x48;
+            MSS_MAC_set_type_2_compare(&g_mac0, 0, &compare);
+
+            memset(&filter, 0, sizeof(filter));
+            filter.compare_a_enable = 1;
+            filter.compare_a_index  = 0;
+            filter.ethertype_enable = 1;
+            filter.ethertype_index  = 0;
+            filter.queue_no         = 3;
+            MSS_MAC_set_type_2_filter(&g_mac0, 0, &filter);
+
+            compare.disable_mask = 1;
+            compare.data = 0xFFFFFFFFUL;
+            compare.compare_offset = MSS_MAC_T2_OFFSET_FRAME;
+            compare.offset_value = 0x30;
+            MSS_MAC_set_type_2_compare(&g_mac0, 1, &compare);
+
+            compare.offset_value = 0x34;
+            MSS_MAC_set_type_2_compare(&g_mac0, 2, &compare);
+
+            compare.offset_value = 0x38;
+            MSS_MAC_set_type_2_compare(&g_mac0, 3, &compare);
+
+            MSS_MAC_set_type_2_ethertype(&g_mac0, 1, 0x0806);
+
+            memset(&filter, 0, sizeof(filter));
+            filter.compare_a_enable = 1;
+            filter.compare_a_index  = 1;
+            filter.compare_b_enable = 1;
+            filter.compare_b_index  = 2;
+            filter.compare_c_enable = 1;
+            filter.compare_c_index  = 3;
+            filter.ethertype_enable = 1;
+            filter.ethertype_index  = 1;
+            filter.queue_no         = 2;
+            MSS_MAC_set_type_2_filter(&g_mac0, 1, &filter);
+        }
+    }
+  @endcode
+ */
+void
+MSS_MAC_get_type_2_compare
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t comparer_no_in,
+    mss_mac_type_2_compare_t *comparer
+);
+
+
+#if defined(MSS_MAC_FLOW_STEERING)
+/***************************************************************************//**
+  The _MSS_MAC_flow_hash()_ function calculates a 32 bit hash of the 5-tuple
+  of an IPv4 flow. The same flow always produces the same hash so the value
+  can be used to select a queue or a processing core for the flow.
+
+  @param flow
+    This parameter is a pointer to a _mss_mac_flow_t_ structure which describes
+    the flow.
+
+  @return
+    This function returns the 32 bit hash of the flow.
+ */
+uint32_t
+MSS_MAC_flow_hash
+(
+    const mss_mac_flow_t *flow
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_flow_to_queue()_ function returns the queue that a flow maps to
+  in the MAC's flow hash indirection table. The table has
+  _MSS_MAC_FLOW_TABLE_SIZE_ entries and is indexed by the low bits of the value
+  returned by _MSS_MAC_flow_hash()_.
+
+  _MSS_MAC_init()_ fills the table so that consecutive entries cycle through
+  all of the MAC's queues. The eMAC only has queue 0 so this function always
+  returns 0 for an eMAC.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param flow
+    This parameter is a pointer to a _mss_mac_flow_t_ structure which describes
+    the flow.
+
+  @return
+    This function returns the queue number for the flow.
+ */
+uint32_t
+MSS_MAC_flow_to_queue
+(
+    const mss_mac_instance_t *this_mac,
+    const mss_mac_flow_t *flow
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_set_flow_table()_ function replaces the contents of the MAC's
+  flow hash indirection table. This can be used to weight the distribution of
+  flows towards some queues or to stop using a queue altogether.
+
+  Flows already steered with _MSS_MAC_steer_flow()_ are not moved by this
+  function.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param table
+    This parameter points to an array of _MSS_MAC_FLOW_TABLE_SIZE_ queue
+    numbers.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the table was updated and
+    _MSS_MAC_FAILED_ if any entry is not a valid queue for the MAC. The
+    existing table is left unchanged on failure.
+ */
+uint8_t
+MSS_MAC_set_flow_table
+(
+    mss_mac_instance_t *this_mac,
+    const uint8_t *table
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_steer_flow()_ function programs one of the pMAC's screeners to
+  route received packets belonging to a flow to a queue.
+
+  UDP flows which are identified only by destination port use a Type 1
+  screener. All other flows use a Type 2 screener with up to 3 comparers for
+  the IP protocol, destination IP address and destination TCP/UDP port, and the
+  first Type 2 flow also claims one Ethertype register for matching IPv4
+  frames. Zero valued fields in the flow are not compared and the source
+  address and port fields are not checked by the hardware.
+
+  Screeners, comparers and the Ethertype register are allocated starting from
+  the highest numbered one. Applications which also program screeners directly
+  should use the lowest numbered ones.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    Only pMACs are supported as eMACs only have a single queue.
+
+  @param flow
+    This parameter is a pointer to a _mss_mac_flow_t_ structure which describes
+    the flow.
+
+  @param queue_no
+    This parameter is the queue to route the flow to. Passing
+    _MSS_MAC_FLOW_QUEUE_AUTO_ selects the queue returned by
+    _MSS_MAC_flow_to_queue()_.
+
+  @return
+    This function returns a flow ID to pass to _MSS_MAC_clear_flow()_ or
+    _MSS_MAC_FLOW_INVALID_ if the MAC is not a pMAC, the queue is not valid or
+    there are no free screeners or comparers.
+
+  Example:
+    This example spreads 4 UDP streams across the pMAC's queues and gives each
+    queue its own U54.
+  @code
+    void steer_streams(void)
+    {
+        mss_mac_flow_t flow;
+        uint32_t index;
+
+        memset(&flow, 0, sizeof(flow));
+        flow.protocol = 17U;
+        for(index = 0U; index < 4U; index++)
+        {
+            flow.dst_port = (uint16_t)(5000U + index);
+            (void)MSS_MAC_steer_flow(&g_mac0, &flow, index);
+            (void)MSS_MAC_set_queue_hart(&g_mac0, index, index + 1U);
+        }
+    }
+  @endcode
+ */
+int32_t
+MSS_MAC_steer_flow
+(
+    mss_mac_instance_t *this_mac,
+    const mss_mac_flow_t *flow,
+    uint32_t queue_no
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_clear_flow()_ function disables the screener used to steer a
+  flow or traffic class and releases the comparers and Ethertype register it
+  used. Packets from the flow are then received on queue 0 unless another
+  screener matches them.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param flow_id
+    This parameter is the ID returned by _MSS_MAC_steer_flow()_ or
+    _MSS_MAC_classify()_.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_clear_flow
+(
+    mss_mac_instance_t *this_mac,
+    int32_t flow_id
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_set_queue_hart()_ function routes the PLIC interrupt for one of
+  the MAC's queues to a single hart. The interrupt is disabled for all other
+  harts and, if the queue's interrupt was enabled, enabled for the selected
+  hart.
+
+  The driver enables and disables queue interrupts on the calling hart when
+  packets are queued for transmission or reception. Once a queue has been
+  routed, all driver calls for that queue should be made from the selected
+  hart.
+
+  This function is not available when the MAC is configured to use local
+  interrupts as these are wired to fixed harts; pMAC0 and eMAC0 to U54_1 and
+  U54_2 and pMAC1 and eMAC1 to U54_3 and U54_4.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue whose interrupt is to be routed.
+
+  @param hart_id
+    This parameter is the hart to route the interrupt to, 0 for the E51 or 1 to
+    4 for the U54s.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the interrupt was routed and
+    _MSS_MAC_FAILED_ otherwise.
+ */
+uint8_t
+MSS_MAC_set_queue_hart
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint32_t hart_id
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_set_queue_priority()_ function sets the PLIC priority of the
+  interrupt for one of the MAC's queues. Together with _MSS_MAC_classify()_
+  and _MSS_MAC_set_queue_hart()_ this lets a U54 take the interrupt for its
+  priority traffic ahead of any lower priority interrupts routed to it.
+
+  This function is not available when the MAC is configured to use local
+  interrupts.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue whose interrupt priority is to be set.
+
+  @param priority
+    This parameter is the PLIC priority, 1 to 7 with 7 the highest. 0 stops the
+    interrupt being taken at all.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the priority was set and
+    _MSS_MAC_FAILED_ otherwise.
+ */
+uint8_t
+MSS_MAC_set_queue_priority
 (
     const mss_mac_instance_t *this_mac,
-    uint32_t comparer_no_in,
-    const mss_mac_type_2_compare_t *comparer
+    uint32_t queue_no,
+    uint32_t priority
 );
 
-
 /***************************************************************************//**
-  The _MSS_MAC_get_type_2_compare()_ function is used to retrieve the current
-  Type 2 data matching blocks configuration from the Ethernet MAC.
+  The _MSS_MAC_classify()_ function programs the pMAC's screeners to send
+  received packets of a traffic class to a queue, or to drop them.
+
+  A class matched only on UDP destination port uses a Type 1 screener if one
+  is free. Any other class uses a Type 2 screener:
+    - the VLAN priority is matched by the screener itself and only tagged
+      packets match
+    - the Ethertype uses one of the Ethertype registers, which is shared with
+      any other screener allocated by the driver for the same Ethertype
+    - the DSCP uses one comparer, which ignores the two ECN bits
+    - the UDP port uses two comparers, one for the IPv4 protocol and one for
+      the port
+
+  Matching the DSCP or UDP port implies an Ethertype of 0x0800, so the class
+  is not valid if a different Ethertype is given.
+
+  Screeners, comparers and Ethertype registers come from the same pool as
+  those used by _MSS_MAC_steer_flow()_ and are allocated starting from the
+  highest numbered one. If they cannot all be allocated none are.
+  _MSS_MAC_get_screener_usage()_ reports how many of each are left.
+
+  The class is removed by passing the returned ID to _MSS_MAC_clear_flow()_.
 
   @param this_mac
     This parameter is a pointer to one of the global _mss_mac_instance_t_
     structures which identifies the MAC that the function is to operate on.
-    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
-    and eMAC1.
+    Only pMACs are supported as eMACs only have a single queue.
 
-  @param comparer_no_in
-    This parameter of type _uint32_t_, selects which compare block to retrieve.
-    The valid range is 0 to 11 for pMACs and 0 to 5 for eMACs.
+  @param rule
+    This parameter is a pointer to a _mss_mac_class_t_ structure which
+    describes the traffic class.
 
-  @param comparer
-    This parameter of type pointer to _mss_mac_type_2_compare_t_, is the address
-    of the configuration structure which will receive a copy of the current
-    comparer block setup.
+  @param queue_no
+    This parameter is the queue to route the class to. It is ignored when the
+    class is dropped but must still be valid.
 
   @return
-    This function does not return a value.
+    This function returns an ID to pass to _MSS_MAC_clear_flow()_ or
+    _MSS_MAC_FLOW_INVALID_ if the MAC is not a pMAC, the class or queue is not
+    valid or there are not enough free screening resources.
 
   Example:
-    This example configures 2 filters which route IP packets with 0x9E, 0x48,
-    0x05, 0x0F at offset 0x48 to queue 3 and ARP packets with 12 x 0xFF at
-    offset 0x30 to queue 2. The example also checks to see if Ethertype block 0
-    has already been configured and only proceeds if it is not configured.
-
+    This example sends VLAN priority 6 and 7 packets and Expedited Forwarding
+    packets to queue 3, whose interrupt is given the highest priority and
+    routed to U54_4.
   @code
-    #include "mss_ethernet_mac.h"
-
-    void init_t2_filters(void)
+    void steer_priority_traffic(void)
     {
-        mss_mac_type_2_filter_t filter;
-        mss_mac_type_2_compare_t compare;
+        mss_mac_class_t rule;
+        uint32_t pcp;
 
-        if(0 == MSS_MAC_get_type_2_ethertype(&g_mac0, 0))
+        memset(&rule, 0, sizeof(rule));
+        rule.match = MSS_MAC_CLASS_VLAN_PCP;
+        for(pcp = 6U; pcp < 8U; pcp++)
         {
-            MSS_MAC_set_type_2_ethertype(&g_mac0, 0, 0x0800);
-
-            compare.disable_mask = 1;
-            compare.data = 0x0F05489EUL;
-            compare.compare_offset = MSS_MAC_T2_OFFSET_FRAME;
-            compare.offset_value = 0x48;
-            MSS_MAC_set_type_2_compare(&g_mac0, 0, &compare);
+            rule.vlan_pcp = (uint8_t)pcp;
+            (void)MSS_MAC_classify(&g_mac0, &rule, 3U);
+        }
 
-            memset(&filter, 0, sizeof(filter));
-            filter.compare_a_enable = 1;
-            filter.compare_a_index  = 0;
-            filter.ethertype_enable = 1;
-            filter.ethertype_index  = 0;
-            filter.queue_no         = 3;
-            MSS_MAC_set_type_2_filter(&g_mac0, 0, &filter);
+        memset(&rule, 0, sizeof(rule));
+        rule.match = MSS_MAC_CLASS_DSCP;
+        rule.dscp  = 46U;
+        (void)MSS_MAC_classify(&g_mac0, &rule, 3U);
 
-            compare.disable_mask = 1;
-            compare.data = 0xFFFFFFFFUL;
-            compare.compare_offset = MSS_MAC_T2_OFFSET_FRAME;
-            compare.offset_value = 0x30;
-            MSS_MAC_set_type_2_compare(&g_mac0, 1, &compare);
+        (void)MSS_MAC_set_queue_priority(&g_mac0, 3U, 7U);
+        (void)MSS_MAC_set_queue_hart(&g_mac0, 3U, 4U);
+    }
+  @endcode
+ */
+int32_t
+MSS_MAC_classify
+(
+    mss_mac_instance_t *this_mac,
+    const mss_mac_class_t *rule,
+    uint32_t queue_no
+);
 
-            compare.offset_value = 0x34;
-            MSS_MAC_set_type_2_compare(&g_mac0, 2, &compare);
+/***************************************************************************//**
+  The _MSS_MAC_get_screener_usage()_ function reports how many of the pMAC's
+  screening resources have not been allocated by _MSS_MAC_steer_flow()_ and
+  _MSS_MAC_classify()_. Screeners programmed directly by the application are
+  not counted.
 
-            compare.offset_value = 0x38;
-            MSS_MAC_set_type_2_compare(&g_mac0, 3, &compare);
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
 
-            MSS_MAC_set_type_2_ethertype(&g_mac0, 1, 0x0806);
+  @param usage
+    This parameter is a pointer to the structure which receives the counts of
+    free resources. All counts are 0 for an eMAC.
 
-            memset(&filter, 0, sizeof(filter));
-            filter.compare_a_enable = 1;
-            filter.compare_a_index  = 1;
-            filter.compare_b_enable = 1;
-            filter.compare_b_index  = 2;
-            filter.compare_c_enable = 1;
-            filter.compare_c_index  = 3;
-            filter.ethertype_enable = 1;
-            filter.ethertype_index  = 1;
-            filter.queue_no         = 2;
-            MSS_MAC_set_type_2_filter(&g_mac0, 1, &filter);
-        }
-    }
-  @endcode
+  @return
+    This function does not return a value.
  */
 void
-MSS_MAC_get_type_2_compare
+MSS_MAC_get_screener_usage
 (
     const mss_mac_instance_t *this_mac,
-    uint32_t comparer_no_in,
-    mss_mac_type_2_compare_t *comparer
+    mss_mac_screener_usage_t *usage
 );
+#endif /* defined(MSS_MAC_FLOW_STEERING) */
 
 /***************************************************************************//**
   The _MSS_MAC_set_mmsl_mode()_ function is used to configure the operation of
@@ -3315,6 +5356,197 @@ MSS_MAC_get_mmsl_stats
     mss_mac_mmsl_stats_t *stats
 );
 
+/***************************************************************************//**
+  The _MSS_MAC_set_cbs()_ function configures one of the credit based shapers
+  of the GEM. A shaper limits the bandwidth of its queue to the idle slope and
+  lets the queue build up credit while it waits so traffic of a lower priority
+  queue still gets through.
+
+  The shapers apply to the two highest priority transmit queues, queue A the
+  highest and queue B the next. The eMAC has a single queue so only
+  _MSS_MAC_CBS_QUEUE_A_ applies to it.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param cbs_queue
+    This parameter selects the shaper, _MSS_MAC_CBS_QUEUE_A_ or
+    _MSS_MAC_CBS_QUEUE_B_.
+
+  @param idle_slope
+    This parameter is the bandwidth allowed to the queue in bytes per second.
+    A value of 0 turns the shaper off.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    MSS_MAC_set_cbs(&g_mac0, MSS_MAC_CBS_QUEUE_A, 12500000U);
+  @endcode
+  This limits the highest priority queue to 100Mbps.
+ */
+void
+MSS_MAC_set_cbs
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t cbs_queue,
+    uint32_t idle_slope
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_get_cbs()_ function retrieves the idle slope of one of the
+  credit based shapers of the GEM.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param cbs_queue
+    This parameter selects the shaper, _MSS_MAC_CBS_QUEUE_A_ or
+    _MSS_MAC_CBS_QUEUE_B_.
+
+  @return
+    This function returns the idle slope in bytes per second or 0 if the shaper
+    is off.
+ */
+uint32_t
+MSS_MAC_get_cbs
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t cbs_queue
+);
+
+#if defined(MSS_MAC_TSN)
+/***************************************************************************//**
+  The _MSS_MAC_tsn_init()_ function sets up the TSN traffic classes of a GEM.
+  Each VLAN priority (PCP) is either express traffic, sent on the eMAC, or
+  preemptable traffic sent on a pMAC queue. Received frames with a PCP mapped
+  to a pMAC queue other than 0 are routed to that queue with a Type 2
+  Screening Filter and all other frames go to queue 0.
+
+  The function also sets the credit based shapers, see _MSS_MAC_set_cbs()_,
+  and the MAC Merge Sublayer mode, see _MSS_MAC_set_mmsl_mode()_. With
+  preemption enabled, express frames interrupt the bulk frames of the pMAC so
+  their latency is bounded by the preemption fragment size rather than the
+  maximum frame length.
+
+  The function only operates on the pMAC. The pMAC and, if any PCP is express,
+  the eMAC must have been initialised with _MSS_MAC_init()_. The Type 2
+  Screening Filters from 0 up are used for the pMAC queue map so this is not
+  combined with other uses of them on the same pMAC.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the pMAC that the function is to operate on.
+
+  @param cfg
+    This parameter is a pointer to an _mss_mac_tsn_config_t_ structure holding
+    the traffic class map and shaper settings.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the traffic classes were set up
+    and _MSS_MAC_FAILED_ if a queue does not exist, more screeners are needed
+    than the pMAC has or the eMAC needed is not initialised. Nothing is changed
+    on failure.
+
+  Example:
+  @code
+    mss_mac_tsn_config_t tsn_cfg;
+
+    (void)memset(&tsn_cfg, 0, sizeof(tsn_cfg));
+    tsn_cfg.mmsl.preemption = MSS_MAC_ENABLE;
+    tsn_cfg.mmsl.frag_size  = MSS_MAC_FRAG_SIZE_64;
+
+    tsn_cfg.pcp_queue[4]    = 1U;
+    tsn_cfg.pcp_queue[5]    = 2U;
+    tsn_cfg.pcp_queue[6]    = 3U;
+    tsn_cfg.idle_slope_a    = 25000000U;
+    tsn_cfg.pcp_express[7]  = MSS_MAC_ENABLE;
+    tsn_cfg.emac_idle_slope = 12500000U;
+
+    if(MSS_MAC_SUCCESS == MSS_MAC_tsn_init(&g_mac0, &tsn_cfg))
+    {
+        MSS_MAC_start_preemption_verify(&g_mac0);
+    }
+  @endcode
+ */
+uint8_t
+MSS_MAC_tsn_init
+(
+    mss_mac_instance_t *this_mac,
+    const mss_mac_tsn_config_t *cfg
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_tsn_send_pkt()_ function sends a frame on the MAC and queue its
+  PCP was mapped to by _MSS_MAC_tsn_init()_, as _MSS_MAC_send_pkt()_ does. The
+  frame must already carry its VLAN tag, the PCP given is only used to pick the
+  MAC and queue.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the pMAC that the function is to operate on.
+
+  @param pcp
+    This parameter is the VLAN priority of the frame, 0 to 7.
+
+  @param tx_buffer
+    This parameter is a pointer to the buffer containing the frame to send.
+
+  @param tx_length
+    This parameter specifies the length in bytes of the frame to send.
+
+  @param p_user_data
+    This parameter is passed to the transmit callback of the queue used.
+
+  @return
+    This function returns the _MSS_MAC_send_pkt()_ result or
+    _MSS_MAC_ERR_TX_NOT_OK_ if the PCP is out of range.
+ */
+int32_t
+MSS_MAC_tsn_send_pkt
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t pcp,
+    uint8_t const * tx_buffer,
+    uint32_t tx_length,
+    void * p_user_data
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_tsn_get_stats()_ function retrieves the statistics of the TSN
+  layer: the running totals of the MMSL counts, the current MMSL status and the
+  frames sent and refused for each PCP. The counts are kept from the last call
+  to _MSS_MAC_tsn_init()_.
+
+  The TSN layer reads the clear on read MMSL counters so _MSS_MAC_get_mmsl_stats()_
+  should not be used as well.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the pMAC that the function is to operate on.
+
+  @param stats
+    This parameter is a pointer to an _mss_mac_tsn_stats_t_ structure which
+    will be populated with the statistics.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_tsn_get_stats
+(
+    mss_mac_instance_t *this_mac,
+    mss_mac_tsn_stats_t *stats
+);
+#endif /* defined(MSS_MAC_TSN) */
+
 /***************************************************************************//**
   The _MSS_MAC_set_tx_cutthru()_ function is used to set the transmit cutthru
   level for the GEM DMA engine. The useful ranges are different for the eMAC and
@@ -3535,6 +5767,119 @@ MSS_MAC_get_jumbo_frame_length
     const mss_mac_instance_t *this_mac
 );
 
+/***************************************************************************//**
+  The _MSS_MAC_set_int_moderation()_ function is used to set the hardware
+  interrupt moderation timers for the Ethernet MAC at run time. The initial
+  values are set from the _rx_int_moderation_ and _tx_int_moderation_ values in
+  the _mss_mac_cfg_t_ structure used to configure the Ethernet MAC.
+
+  While a moderation timer is running, the GEM does not raise further receive
+  or transmit complete interrupts, trading a small amount of latency for a
+  much lower interrupt rate on busy links. The moderation settings apply to
+  all queues of the MAC.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param rx_moderation
+    This parameter sets the receive interrupt moderation time in units of
+    800ns. Values greater than _MSS_MAC_INT_MODERATION_MAX_ are clamped to
+    _MSS_MAC_INT_MODERATION_MAX_ and 0 disables receive interrupt moderation.
+
+  @param tx_moderation
+    This parameter sets the transmit interrupt moderation time in units of
+    800ns. Values greater than _MSS_MAC_INT_MODERATION_MAX_ are clamped to
+    _MSS_MAC_INT_MODERATION_MAX_ and 0 disables transmit interrupt moderation.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    Allow up to about 20uS between receive interrupts on a bulk transfer link
+    and leave transmit interrupts unmoderated.
+
+    MSS_MAC_set_int_moderation(&g_mac0, 25U, MSS_MAC_INT_MODERATION_DISABLE);
+  @endcode
+ */
+void
+MSS_MAC_set_int_moderation
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t rx_moderation,
+    uint32_t tx_moderation
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_get_int_moderation()_ function is used to retrieve the current
+  hardware interrupt moderation timer settings for the Ethernet MAC.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param rx_moderation
+    This parameter is a pointer to a variable which receives the current
+    receive interrupt moderation time in units of 800ns. It can be set to 0 if
+    the caller does not need this value.
+
+  @param tx_moderation
+    This parameter is a pointer to a variable which receives the current
+    transmit interrupt moderation time in units of 800ns. It can be set to 0 if
+    the caller does not need this value.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_get_int_moderation
+(
+    const mss_mac_instance_t *this_mac,
+    uint32_t *rx_moderation,
+    uint32_t *tx_moderation
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_get_offload_caps()_ function is used to find out which checksum
+  and segmentation offloads are currently active for the Ethernet MAC. The
+  transmit and receive checksum offloads are selected at initialization time
+  through the _tx_csum_offload_ and _rx_csum_offload_ members of the
+  _mss_mac_cfg_t_ structure. The large send offload flag only reports that the
+  GEM was synthesized with LSO support; the driver always transmits one frame
+  per descriptor.
+
+  Network stacks should use this function to decide whether they need to
+  generate and check IP, TCP and UDP checksums in software.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @return
+    This function returns a bitmask of _MSS_MAC_OFFLOAD_TX_CSUM_,
+    _MSS_MAC_OFFLOAD_RX_CSUM_ and _MSS_MAC_OFFLOAD_LSO_ flags.
+
+  Example:
+  @code
+    if(0U != (MSS_MAC_get_offload_caps(&g_mac0) & MSS_MAC_OFFLOAD_TX_CSUM))
+    {
+        use_hw_tx_checksums = 1;
+    }
+  @endcode
+ */
+uint32_t
+MSS_MAC_get_offload_caps
+(
+    const mss_mac_instance_t *this_mac
+);
+
 /***************************************************************************//**
   The _MSS_MAC_set_pause_frame_copy_to_mem()_ function is used to control the
   writing of pause frames into memory. 
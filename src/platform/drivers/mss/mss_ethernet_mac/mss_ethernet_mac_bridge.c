@@ -0,0 +1,540 @@
+/*******************************************************************************
+ * Copyright 2021 Microchip Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem two port software Ethernet bridge.
+ *
+ * See mss_ethernet_mac_bridge.h for details of how to use the bridge.
+ *
+ */
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+
+#include "drivers/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_bridge.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MSS_MAC_BRIDGE)
+
+#if (0U != (MSS_MAC_BRIDGE_TABLE_SIZE & (MSS_MAC_BRIDGE_TABLE_SIZE - 1U)))
+#error "MSS_MAC_BRIDGE_TABLE_SIZE must be a power of two"
+#endif
+
+/*
+ * Learning table entries are one 64 bit word each so they are written and read
+ * whole. The MAC address is in the low 48 bits, most significant byte first.
+ */
+#define BRIDGE_KEY_VALID        (0x8000000000000000ULL)
+#define BRIDGE_KEY_PORT         (0x0001000000000000ULL)
+#define BRIDGE_KEY_MAC_MASK     (0x0000FFFFFFFFFFFFULL)
+
+#define BRIDGE_PROBES           (4U)
+#define BRIDGE_HASH_MUL         (0x9E3779B97F4A7C15ULL)
+
+#define BRIDGE_MAC_HDR_LEN      (14U)
+#define BRIDGE_SRC_OFFSET       (6U)
+
+/*
+ * Orders the write of a slot's age before its key on the bridge hart, and the
+ * reads of a key and its age on the looking up hart.
+ */
+#define BRIDGE_FENCE_W_W()      __asm__ __volatile__ ("fence w,w" ::: "memory")
+#define BRIDGE_FENCE_R_R()      __asm__ __volatile__ ("fence r,r" ::: "memory")
+
+/*
+ * A bridge buffer, its address is the user data pointer given to the driver
+ * with it. home is the port whose receive ring it belongs to.
+ */
+typedef struct bridge_buf bridge_buf_t;
+struct bridge_buf
+{
+    uint8_t      *addr;
+    bridge_buf_t *next;
+    uint32_t      home;
+};
+
+/*------------------------------------------------------------------------------
+ * Bridge state, all of it owned by the bridge hart apart from the learning
+ * table which is also read by MSS_MAC_bridge_lookup().
+ */
+static mss_mac_instance_t *g_bridge_port[MSS_MAC_BRIDGE_PORTS];
+static bridge_buf_t g_bridge_buf[MSS_MAC_BRIDGE_MAX_BUFS];
+static bridge_buf_t *g_bridge_spare[MSS_MAC_BRIDGE_PORTS];
+static mss_mac_bridge_stats_t g_bridge_stats;
+
+static volatile uint64_t g_bridge_key[MSS_MAC_BRIDGE_TABLE_SIZE];
+static volatile uint32_t g_bridge_seen[MSS_MAC_BRIDGE_TABLE_SIZE];
+static volatile uint32_t g_bridge_epoch;
+
+/*------------------------------------------------------------------------------
+ * Local functions
+ */
+static void bridge_rx_callback
+(
+    void *this_mac,
+    uint32_t queue_no,
+    uint8_t *p_rx_packet,
+    uint32_t pckt_length,
+    mss_mac_rx_desc_t *cdesc,
+    void *p_user_data
+);
+
+static void bridge_tx_callback
+(
+    void *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_desc_t *cdesc,
+    void *p_user_data
+);
+
+static void bridge_poll_sched(void *this_mac, uint32_t queue_no);
+static uint64_t bridge_mac(const uint8_t *mac);
+static uint32_t bridge_hash(uint64_t mac);
+static uint32_t bridge_age(uint32_t slot);
+static void bridge_refill(uint32_t port);
+static void bridge_learn(uint64_t mac, uint32_t port);
+static void bridge_spare_push(bridge_buf_t *buf);
+static bridge_buf_t *bridge_spare_pop(uint32_t port);
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_ethernet_mac_bridge.h for details of how to use this function.
+ */
+uint8_t
+MSS_MAC_bridge_init
+(
+    const mss_mac_bridge_cfg_t *cfg
+)
+{
+    uint8_t status = MSS_MAC_FAILED;
+    mss_mac_instance_t *this_mac;
+    uint32_t per_port;
+    uint32_t port;
+    uint32_t inc;
+    bridge_buf_t *buf;
+    mss_mac_rx_int_ctrl_t enable;
+
+    per_port = cfg->buf_count / MSS_MAC_BRIDGE_PORTS;
+
+    if((per_port >= MSS_MAC_RX_RING_SIZE) &&
+       (cfg->buf_count <= MSS_MAC_BRIDGE_MAX_BUFS) &&
+       (cfg->port[0] != cfg->port[1]) &&
+       (MSS_MAC_AVAILABLE == cfg->port[0]->mac_available) &&
+       (MSS_MAC_AVAILABLE == cfg->port[1]->mac_available) &&
+       (MSS_MAC_RX_RING_SIZE == cfg->port[0]->queue[0].nb_available_rx_desc) &&
+       (MSS_MAC_RX_RING_SIZE == cfg->port[1]->queue[0].nb_available_rx_desc))
+    {
+        status = MSS_MAC_SUCCESS;
+
+        (void)memset(&g_bridge_stats, 0, sizeof(g_bridge_stats));
+        for(inc = 0U; inc != MSS_MAC_BRIDGE_TABLE_SIZE; inc++)
+        {
+            g_bridge_key[inc] = 0ULL;
+            g_bridge_seen[inc] = 0U;
+        }
+        g_bridge_epoch = 0U;
+
+        for(port = 0U; port != MSS_MAC_BRIDGE_PORTS; port++)
+        {
+            this_mac = cfg->port[port];
+            g_bridge_port[port] = this_mac;
+            g_bridge_spare[port] = (bridge_buf_t *)0;
+
+            if(0U != this_mac->is_emac)
+            {
+                this_mac->emac_base->NETWORK_CONFIG |= GEM_COPY_ALL_FRAMES;
+            }
+            else
+            {
+                this_mac->mac_base->NETWORK_CONFIG |= GEM_COPY_ALL_FRAMES;
+            }
+
+            MSS_MAC_set_rx_callback(this_mac, 0U, bridge_rx_callback);
+            MSS_MAC_set_tx_callback(this_mac, 0U, bridge_tx_callback);
+            MSS_MAC_set_tx_batch_callback(this_mac, 0U, (mss_mac_tx_batch_callback_t)0);
+            MSS_MAC_set_tx_reclaim_mode(this_mac, 0U, 1U);
+            MSS_MAC_set_rx_poll_mode(this_mac, 0U, bridge_poll_sched);
+
+            for(inc = 0U; inc != per_port; inc++)
+            {
+                buf = &g_bridge_buf[(port * per_port) + inc];
+                buf->addr = &cfg->buf_mem[((port * per_port) + inc) * MSS_MAC_MAX_RX_BUF_SIZE];
+                buf->home = port;
+                buf->next = (bridge_buf_t *)0;
+
+                if(inc < MSS_MAC_RX_RING_SIZE)
+                {
+                    /* Fill the ring with reception off and start it on the last */
+                    enable = ((MSS_MAC_RX_RING_SIZE - 1U) == inc) ? MSS_MAC_INT_ARM : MSS_MAC_INT_DISABLE;
+                    if(MSS_MAC_SUCCESS != MSS_MAC_receive_pkt(this_mac, 0U, buf->addr, (void *)buf, enable))
+                    {
+                        status = MSS_MAC_FAILED;
+                    }
+                }
+                else
+                {
+                    bridge_spare_push(buf);
+                }
+            }
+        }
+    }
+
+    return(status);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_ethernet_mac_bridge.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_bridge_poll
+(
+    uint32_t budget
+)
+{
+    uint32_t received = 0U;
+    uint32_t port;
+
+    for(port = 0U; port != MSS_MAC_BRIDGE_PORTS; port++)
+    {
+        received += MSS_MAC_rx_poll(g_bridge_port[port], 0U, budget);
+    }
+
+    /*
+     * Sends reclaim as they go but the last frames of a burst are only picked
+     * up here. Their buffers go back to the rings they came from.
+     */
+    for(port = 0U; port != MSS_MAC_BRIDGE_PORTS; port++)
+    {
+        (void)MSS_MAC_tx_reclaim(g_bridge_port[port], 0U);
+    }
+
+    for(port = 0U; port != MSS_MAC_BRIDGE_PORTS; port++)
+    {
+        bridge_refill(port);
+    }
+
+    return(received);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_ethernet_mac_bridge.h for details of how to use this function.
+ */
+void
+MSS_MAC_bridge_tick
+(
+    void
+)
+{
+    g_bridge_epoch = g_bridge_epoch + 1U;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_ethernet_mac_bridge.h for details of how to use this function.
+ *
+ * The key is read again after the age so that a slot taken over by another
+ * address while it was being read is not returned.
+ */
+uint8_t
+MSS_MAC_bridge_lookup
+(
+    const uint8_t *mac,
+    uint32_t *port
+)
+{
+    uint8_t status = MSS_MAC_FAILED;
+    uint64_t want = bridge_mac(mac);
+    uint32_t slot = bridge_hash(want);
+    uint32_t probe;
+    uint64_t key;
+
+    for(probe = 0U; (probe != BRIDGE_PROBES) && (MSS_MAC_FAILED == status); probe++)
+    {
+        key = g_bridge_key[slot];
+        if((0U != (key & BRIDGE_KEY_VALID)) && (want == (key & BRIDGE_KEY_MAC_MASK)))
+        {
+            BRIDGE_FENCE_R_R();
+            if((bridge_age(slot) <= MSS_MAC_BRIDGE_AGE_TICKS) && (key == g_bridge_key[slot]))
+            {
+                *port = (0U != (key & BRIDGE_KEY_PORT)) ? 1U : 0U;
+                status = MSS_MAC_SUCCESS;
+            }
+        }
+
+        slot = (slot + 1U) & (MSS_MAC_BRIDGE_TABLE_SIZE - 1U);
+    }
+
+    return(status);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_ethernet_mac_bridge.h for details of how to use this function.
+ */
+void
+MSS_MAC_bridge_get_stats
+(
+    mss_mac_bridge_stats_t *stats
+)
+{
+    *stats = g_bridge_stats;
+}
+
+/*------------------------------------------------------------------------------
+ * Learn the source, then filter or forward the frame. A forwarded buffer is
+ * replaced in the ring with a spare if there is one, otherwise the ring runs
+ * one short until the transmission completes.
+ */
+static void bridge_rx_callback
+(
+    void *this_mac,
+    uint32_t queue_no,
+    uint8_t *p_rx_packet,
+    uint32_t pckt_length,
+    mss_mac_rx_desc_t *cdesc,
+    void *p_user_data
+)
+{
+    bridge_buf_t *buf = (bridge_buf_t *)p_user_data;
+    bridge_buf_t *spare;
+    mss_mac_instance_t *ingress = (mss_mac_instance_t *)this_mac;
+    uint32_t in_port = buf->home;
+    uint32_t out_port = in_port ^ 1U;
+    uint32_t port;
+    uint32_t forward = 0U;
+
+    (void)queue_no;
+    (void)cdesc;
+
+    if(pckt_length < BRIDGE_MAC_HDR_LEN)
+    {
+        g_bridge_stats.runts++;
+    }
+    else
+    {
+        if(0U == (p_rx_packet[BRIDGE_SRC_OFFSET] & 1U))
+        {
+            bridge_learn(bridge_mac(&p_rx_packet[BRIDGE_SRC_OFFSET]), in_port);
+        }
+
+        if((0U == (p_rx_packet[0] & 1U)) &&
+           (MSS_MAC_SUCCESS == MSS_MAC_bridge_lookup(p_rx_packet, &port)) &&
+           (in_port == port))
+        {
+            g_bridge_stats.filtered++;
+        }
+        else if(MSS_MAC_ERR_OK != MSS_MAC_send_pkt(g_bridge_port[out_port], 0U, p_rx_packet, pckt_length, p_user_data))
+        {
+            g_bridge_stats.tx_full[in_port]++;
+        }
+        else
+        {
+            g_bridge_stats.forwarded[in_port]++;
+            forward = 1U;
+        }
+    }
+
+    if(0U != forward)
+    {
+        spare = bridge_spare_pop(in_port);
+        if((bridge_buf_t *)0 != spare)
+        {
+            (void)MSS_MAC_receive_pkt(ingress, 0U, spare->addr, (void *)spare, MSS_MAC_INT_ENABLE);
+        }
+    }
+    else
+    {
+        (void)MSS_MAC_receive_pkt(ingress, 0U, p_rx_packet, p_user_data, MSS_MAC_INT_ENABLE);
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * The sent buffer goes on the spare list of its own port. This can be called
+ * from the interrupt of the sending port, which may have cut into the poll of
+ * the other, so the ring is left to bridge_refill().
+ */
+static void bridge_tx_callback
+(
+    void *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_desc_t *cdesc,
+    void *p_user_data
+)
+{
+    bridge_buf_t *buf = (bridge_buf_t *)p_user_data;
+
+    (void)this_mac;
+    (void)queue_no;
+    (void)cdesc;
+
+    bridge_spare_push(buf);
+}
+
+/*------------------------------------------------------------------------------
+ * The bridge hart polls continuously so there is nothing to schedule.
+ */
+static void bridge_poll_sched(void *this_mac, uint32_t queue_no)
+{
+    (void)this_mac;
+    (void)queue_no;
+}
+
+/*------------------------------------------------------------------------------
+ * MAC address as a 48 bit value.
+ */
+static uint64_t bridge_mac(const uint8_t *mac)
+{
+    uint64_t value = 0ULL;
+    uint32_t inc;
+
+    for(inc = 0U; inc != 6U; inc++)
+    {
+        value = (value << 8) | (uint64_t)mac[inc];
+    }
+
+    return(value);
+}
+
+/*------------------------------------------------------------------------------
+ * First slot to probe for an address. The multiply mixes the vendor bytes,
+ * shared by most stations on a segment, into the bits used.
+ */
+static uint32_t bridge_hash(uint64_t mac)
+{
+    return((uint32_t)((mac * BRIDGE_HASH_MUL) >> 32) & (MSS_MAC_BRIDGE_TABLE_SIZE - 1U));
+}
+
+/*------------------------------------------------------------------------------
+ * Ticks since the slot was last refreshed.
+ */
+static uint32_t bridge_age(uint32_t slot)
+{
+    return(g_bridge_epoch - g_bridge_seen[slot]);
+}
+
+/*------------------------------------------------------------------------------
+ * Put spare buffers of a port back in its receive ring until the ring is full.
+ */
+static void bridge_refill(uint32_t port)
+{
+    bridge_buf_t *buf = bridge_spare_pop(port);
+    uint8_t status = MSS_MAC_SUCCESS;
+
+    while(((bridge_buf_t *)0 != buf) && (MSS_MAC_SUCCESS == status))
+    {
+        status = MSS_MAC_receive_pkt(g_bridge_port[port], 0U, buf->addr, (void *)buf, MSS_MAC_INT_ENABLE);
+        if(MSS_MAC_SUCCESS == status)
+        {
+            buf = bridge_spare_pop(port);
+        }
+        else
+        {
+            bridge_spare_push(buf);
+        }
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Refresh the entry for an address, taking the first empty or aged slot of its
+ * probe run if it has none. If the run is full of live entries the oldest is
+ * replaced.
+ */
+static void bridge_learn(uint64_t mac, uint32_t port)
+{
+    uint32_t slot = bridge_hash(mac);
+    uint32_t probe;
+    uint32_t found = MSS_MAC_BRIDGE_TABLE_SIZE;
+    uint32_t free_slot = MSS_MAC_BRIDGE_TABLE_SIZE;
+    uint32_t oldest = slot;
+    uint64_t key;
+    uint64_t want;
+
+    want = BRIDGE_KEY_VALID | mac | ((0U != port) ? BRIDGE_KEY_PORT : 0ULL);
+
+    for(probe = 0U; (probe != BRIDGE_PROBES) && (MSS_MAC_BRIDGE_TABLE_SIZE == found); probe++)
+    {
+        key = g_bridge_key[slot];
+        if((0U != (key & BRIDGE_KEY_VALID)) && (mac == (key & BRIDGE_KEY_MAC_MASK)))
+        {
+            found = slot;
+        }
+        else if((MSS_MAC_BRIDGE_TABLE_SIZE == free_slot) &&
+                ((0U == (key & BRIDGE_KEY_VALID)) || (bridge_age(slot) > MSS_MAC_BRIDGE_AGE_TICKS)))
+        {
+            free_slot = slot;
+        }
+        else if(bridge_age(slot) > bridge_age(oldest))
+        {
+            oldest = slot;
+        }
+        else
+        {
+            /* Live entry for another address, keep looking */
+        }
+
+        slot = (slot + 1U) & (MSS_MAC_BRIDGE_TABLE_SIZE - 1U);
+    }
+
+    if(MSS_MAC_BRIDGE_TABLE_SIZE != found)
+    {
+        g_bridge_seen[found] = g_bridge_epoch;
+        if(want != g_bridge_key[found])
+        {
+            BRIDGE_FENCE_W_W();
+            g_bridge_key[found] = want;
+            g_bridge_stats.moved++;
+        }
+    }
+    else
+    {
+        if(MSS_MAC_BRIDGE_TABLE_SIZE == free_slot)
+        {
+            free_slot = oldest;
+        }
+
+        g_bridge_seen[free_slot] = g_bridge_epoch;
+        BRIDGE_FENCE_W_W();
+        g_bridge_key[free_slot] = want;
+        g_bridge_stats.learned++;
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Spare buffer lists. Transmit callbacks can come from the MAC interrupt as
+ * well as from the poll loop so interrupts are masked while a list is changed.
+ */
+static void bridge_spare_push(bridge_buf_t *buf)
+{
+    uint64_t psr = read_csr(mstatus);
+
+    __disable_irq();
+    buf->next = g_bridge_spare[buf->home];
+    g_bridge_spare[buf->home] = buf;
+    write_csr(mstatus, psr);
+}
+
+static bridge_buf_t *bridge_spare_pop(uint32_t port)
+{
+    uint64_t psr = read_csr(mstatus);
+    bridge_buf_t *buf;
+
+    __disable_irq();
+    buf = g_bridge_spare[port];
+    if((bridge_buf_t *)0 != buf)
+    {
+        g_bridge_spare[port] = buf->next;
+    }
+    write_csr(mstatus, psr);
+
+    return(buf);
+}
+
+#endif /* defined(MSS_MAC_BRIDGE) */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright 2021 Microchip Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem two port software Ethernet bridge.
+ *
+ */
+/*=========================================================================*//**
+  @section intro_sec Introduction
+  The bridge forwards frames between two MSS Ethernet MACs, normally the pMACs
+  of GEM0 and GEM1, without copying them. A frame received on one port is sent
+  out of the other from the receive buffer it arrived in and the buffer goes
+  back to the receive ring of its own port when the transmission completes.
+
+  The source address of each frame received is learned along with the port it
+  arrived on. A unicast frame for an address known to be on the port it arrived
+  on is filtered, everything else crosses. Addresses not seen again within
+  _MSS_MAC_BRIDGE_AGE_TICKS_ calls to _MSS_MAC_bridge_tick()_ are forgotten, so
+  a station which moves is relearned on its new port.
+
+  The bridge is built when _MSS_MAC_BRIDGE_ is defined in
+  _mss_ethernet_mac_sw_cfg.h_ and uses queue 0 of each port with polled receive
+  and deferred transmit reclaim. It has no port of its own: frames addressed to
+  the bridge are forwarded or filtered like any other.
+
+  @section usage Usage
+  Both MACs are initialised with _MSS_MAC_init()_ as usual, with no receive
+  buffers queued, and then handed to _MSS_MAC_bridge_init()_ along with the
+  memory for the buffers. One hart then calls _MSS_MAC_bridge_poll()_ in a loop.
+  The interrupts of both MACs must be routed to that hart as the bridge relies
+  on them being taken there, between polls.
+
+  _MSS_MAC_bridge_lookup()_ takes no lock and may be called from any hart.
+
+  Example:
+  @code
+    #define BRIDGE_BUFS (4U * MSS_MAC_RX_RING_SIZE)
+
+    static uint8_t bridge_mem[BRIDGE_BUFS][MSS_MAC_MAX_RX_BUF_SIZE] __attribute__ ((aligned (8)));
+
+    void u54_1(void)
+    {
+        mss_mac_bridge_cfg_t cfg;
+
+        MSS_MAC_init(&g_mac0, &g_mac_config0);
+        MSS_MAC_init(&g_mac1, &g_mac_config1);
+
+        cfg.port[0] = &g_mac0;
+        cfg.port[1] = &g_mac1;
+        cfg.buf_mem = &bridge_mem[0][0];
+        cfg.buf_count = BRIDGE_BUFS;
+
+        if(MSS_MAC_SUCCESS == MSS_MAC_bridge_init(&cfg))
+        {
+            for(;;)
+            {
+                (void)MSS_MAC_bridge_poll(64U);
+            }
+        }
+    }
+  @endcode
+ *//*=========================================================================*/
+#ifndef MSS_ETHERNET_MAC_BRIDGE_H_
+#define MSS_ETHERNET_MAC_BRIDGE_H_
+
+#include <stdint.h>
+#include "drivers/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MSS_MAC_BRIDGE)
+
+#define MSS_MAC_BRIDGE_PORTS    (2U)
+
+/***************************************************************************//**
+  Bridge configuration.
+
+  _buf_mem_ points to _buf_count_ receive buffers of _MSS_MAC_MAX_RX_BUF_SIZE_
+  bytes each, 8 byte aligned. Half of them belong to each port. _buf_count_
+  must be at least twice _MSS_MAC_RX_RING_SIZE_, so each port can fill its
+  receive ring, and no more than _MSS_MAC_BRIDGE_MAX_BUFS_. The buffers over
+  and above the rings keep a port receiving while the other is holding its
+  buffers for transmission.
+ */
+typedef struct
+{
+    mss_mac_instance_t *port[MSS_MAC_BRIDGE_PORTS]; /*!< The two MACs to bridge */
+    uint8_t            *buf_mem;                    /*!< Memory for the buffers */
+    uint32_t            buf_count;                  /*!< Number of buffers */
+} mss_mac_bridge_cfg_t;
+
+/***************************************************************************//**
+  Bridge statistics, counted from _MSS_MAC_bridge_init()_.
+ */
+typedef struct
+{
+    uint64_t forwarded[MSS_MAC_BRIDGE_PORTS]; /*!< Frames received on a port and sent out of the other */
+    uint64_t tx_full[MSS_MAC_BRIDGE_PORTS];   /*!< Frames received on a port and dropped as the other could not take them */
+    uint64_t filtered;                        /*!< Frames dropped as the destination is on the port they came from */
+    uint64_t runts;                           /*!< Frames too short to hold a MAC header */
+    uint64_t learned;                         /*!< Addresses added to the table */
+    uint64_t moved;                           /*!< Addresses seen on the other port from the one learned */
+} mss_mac_bridge_stats_t;
+
+/***************************************************************************//**
+  The _MSS_MAC_bridge_init()_ function sets the two ports of the bridge up and
+  primes their receive rings.
+
+  Queue 0 of each port is switched to polled receive and deferred transmit
+  reclaim, its receive and transmit callbacks are taken over and the MAC is set
+  to copy all frames. The learning table is cleared.
+
+  @param cfg
+    This parameter is a pointer to the bridge configuration.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the bridge was set up and
+    _MSS_MAC_FAILED_ if the configuration is not valid, one of the ports is not
+    available or a receive ring was not empty.
+ */
+uint8_t
+MSS_MAC_bridge_init
+(
+    const mss_mac_bridge_cfg_t *cfg
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_bridge_poll()_ function forwards up to _budget_ frames received
+  on each port and reclaims the buffers of completed transmissions.
+
+  @param budget
+    This parameter is the most frames to take from each receive ring.
+
+  @return
+    This function returns the number of frames received on both ports. A return
+    value below twice _budget_ means the receive rings were emptied.
+ */
+uint32_t
+MSS_MAC_bridge_poll
+(
+    uint32_t budget
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_bridge_tick()_ function advances the age of the learning table
+  by one tick. Calling it once a second gives the table an ageing time of
+  _MSS_MAC_BRIDGE_AGE_TICKS_ seconds.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_bridge_tick
+(
+    void
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_bridge_lookup()_ function finds the port a MAC address was
+  learned on. It takes no lock and may be called from any hart while the bridge
+  is running.
+
+  @param mac
+    This parameter points to the 6 byte MAC address to look up.
+
+  @param port
+    This parameter points to where the port, 0 or 1, is written if the address
+    is known.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the address is known and
+    _MSS_MAC_FAILED_ if not.
+ */
+uint8_t
+MSS_MAC_bridge_lookup
+(
+    const uint8_t *mac,
+    uint32_t *port
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_bridge_get_stats()_ function copies the bridge statistics. It
+  should be called from the hart running the bridge.
+
+  @param stats
+    This parameter points to the structure which receives the statistics.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_bridge_get_stats
+(
+    mss_mac_bridge_stats_t *stats
+);
+
+#endif /* defined(MSS_MAC_BRIDGE) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_ETHERNET_MAC_BRIDGE_H_ */
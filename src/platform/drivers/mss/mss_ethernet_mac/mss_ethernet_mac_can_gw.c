@@ -0,0 +1,739 @@
+/*******************************************************************************
+ * Copyright 2021 Microchip Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem CAN to UDP gateway.
+ *
+ * See mss_ethernet_mac_can_gw.h for details of how to use the gateway.
+ *
+ */
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+
+#include "drivers/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac.h"
+#include "drivers/mss_can/mss_can.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_can_gw.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MSS_MAC_CAN_GW)
+
+#if (MSS_MAC_CAN_GW_MAX_RECORDS > 72U) || (MSS_MAC_CAN_GW_MAX_RECORDS < 1U)
+#error "MSS_MAC_CAN_GW_MAX_RECORDS must be from 1 to 72"
+#endif
+
+/*
+ * Frame layout. The gateway sends IPv4 headers without options and accepts
+ * them with.
+ */
+#define GW_MAC_HDR_LEN          (14U)
+#define GW_IP_HDR_LEN           (20U)
+#define GW_UDP_HDR_LEN          (8U)
+#define GW_ARP_LEN              (28U)
+#define GW_MIN_FRAME            (60U)
+
+#define GW_IP_OFFSET            (GW_MAC_HDR_LEN)
+#define GW_UDP_OFFSET           (GW_MAC_HDR_LEN + GW_IP_HDR_LEN)
+#define GW_DATA_OFFSET          (GW_UDP_OFFSET + GW_UDP_HDR_LEN)
+#define GW_REC_OFFSET           (GW_DATA_OFFSET + MSS_MAC_CAN_GW_HDR_LEN)
+
+#define GW_ETHERTYPE_IP         (0x0800U)
+#define GW_ETHERTYPE_ARP        (0x0806U)
+#define GW_IP_PROTO_UDP         (17U)
+#define GW_IP_TTL               (64U)
+#define GW_IP_DF                (0x4000U)
+#define GW_IP_FRAG_MASK         (0x3FFFU)   /* MF and fragment offset */
+#define GW_ARP_REQUEST          (1U)
+#define GW_ARP_REPLY            (2U)
+
+#define GW_ID_EXTENDED          (0x80000000UL)
+#define GW_ID_REMOTE            (0x40000000UL)
+#define GW_ID_MASK              (0x1FFFFFFFUL)
+
+/*
+ * A transmit buffer, its address is the user data pointer given to the driver
+ * with it.
+ */
+typedef struct gw_buf gw_buf_t;
+struct gw_buf
+{
+    uint8_t  *addr;
+    gw_buf_t *next;
+};
+
+/*------------------------------------------------------------------------------
+ * Gateway state, all of it owned by the gateway hart.
+ */
+static mss_mac_instance_t *g_gw_mac;
+static mss_can_instance_t *g_gw_can[MSS_MAC_CAN_GW_CHANNELS];
+static gw_buf_t g_gw_buf[MSS_MAC_CAN_GW_MAX_TX_BUFS];
+static gw_buf_t *g_gw_free;
+static gw_buf_t *g_gw_open;                 /* Datagram being filled */
+static uint32_t g_gw_open_count;            /* Frames in it */
+static uint64_t g_gw_open_time;             /* mtime of its first frame */
+static mss_mac_tx_pkt_info_t g_gw_ready[MSS_MAC_CAN_GW_MAX_TX_BUFS];
+static uint32_t g_gw_ready_count;
+static uint8_t g_gw_hdr[GW_DATA_OFFSET];    /* MAC, IPv4 and UDP header template */
+static uint32_t g_gw_local_ip;
+static uint16_t g_gw_local_port;
+static uint32_t g_gw_flush_frames;
+static uint64_t g_gw_flush_ticks;
+static uint32_t g_gw_seq;
+static uint16_t g_gw_ip_id;
+static mss_mac_can_gw_stats_t g_gw_stats;
+
+/*------------------------------------------------------------------------------
+ * Local functions
+ */
+static void gw_rx_callback
+(
+    void *this_mac,
+    uint32_t queue_no,
+    uint8_t *p_rx_packet,
+    uint32_t pckt_length,
+    mss_mac_rx_desc_t *cdesc,
+    void *p_user_data
+);
+
+static void gw_tx_batch_callback
+(
+    void *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_desc_t *cdescs,
+    void * const *p_user_data,
+    uint32_t count
+);
+
+static void gw_poll_sched(void *this_mac, uint32_t queue_no);
+static uint32_t gw_can_take(uint32_t channel, uint32_t budget);
+static void gw_close(void);
+static void gw_post(void);
+static void gw_datagram(const uint8_t *data, uint32_t length);
+static void gw_arp(const uint8_t *arp);
+static uint16_t gw_ip_checksum(const uint8_t *hdr, uint32_t length);
+static void gw_put16(uint8_t *p, uint32_t value);
+static void gw_put32(uint8_t *p, uint32_t value);
+static uint32_t gw_get16(const uint8_t *p);
+static uint32_t gw_get32(const uint8_t *p);
+static void gw_free_push(gw_buf_t *buf);
+static gw_buf_t *gw_free_pop(void);
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_ethernet_mac_can_gw.h for details of how to use this function.
+ */
+uint8_t
+MSS_MAC_can_gw_init
+(
+    const mss_mac_can_gw_cfg_t *cfg
+)
+{
+    uint8_t status = MSS_MAC_FAILED;
+    mss_mac_instance_t *this_mac = cfg->mac;
+    uint32_t channel;
+    uint32_t used = 0U;
+    uint32_t inc;
+    mss_mac_rx_int_ctrl_t enable;
+
+    for(channel = 0U; channel != MSS_MAC_CAN_GW_CHANNELS; channel++)
+    {
+        if((mss_can_instance_t *)0 != cfg->can[channel])
+        {
+            if(((pmss_can_msgobject)0 != cfg->can[channel]->rx_ring) &&
+               ((struct _mss_can_tx_sched *)0 != cfg->can[channel]->tx_sched))
+            {
+                used++;
+            }
+            else
+            {
+                used = MSS_MAC_CAN_GW_CHANNELS + 1U;
+            }
+        }
+    }
+
+    if((0U != used) && (used <= MSS_MAC_CAN_GW_CHANNELS) &&
+       (0U != cfg->tx_buf_count) && (cfg->tx_buf_count <= MSS_MAC_CAN_GW_MAX_TX_BUFS) &&
+       (0U != cfg->flush_frames) && (cfg->flush_frames <= MSS_MAC_CAN_GW_MAX_RECORDS) &&
+       (MSS_MAC_AVAILABLE == this_mac->mac_available) &&
+       (MSS_MAC_RX_RING_SIZE == this_mac->queue[0].nb_available_rx_desc))
+    {
+        status = MSS_MAC_SUCCESS;
+
+        (void)memset(&g_gw_stats, 0, sizeof(g_gw_stats));
+        g_gw_mac = this_mac;
+        for(channel = 0U; channel != MSS_MAC_CAN_GW_CHANNELS; channel++)
+        {
+            g_gw_can[channel] = cfg->can[channel];
+        }
+
+        g_gw_local_ip = cfg->local_ip;
+        g_gw_local_port = cfg->local_port;
+        g_gw_flush_frames = cfg->flush_frames;
+        g_gw_flush_ticks = cfg->flush_ticks;
+        g_gw_seq = 0U;
+        g_gw_ip_id = 0U;
+        g_gw_open = (gw_buf_t *)0;
+        g_gw_open_count = 0U;
+        g_gw_ready_count = 0U;
+
+        /* Everything but the lengths, IP ID and IP checksum is fixed */
+        (void)memset(g_gw_hdr, 0, sizeof(g_gw_hdr));
+        (void)memcpy(&g_gw_hdr[0], cfg->remote_mac, 6U);
+        (void)memcpy(&g_gw_hdr[6], this_mac->mac_addr, 6U);
+        gw_put16(&g_gw_hdr[12], GW_ETHERTYPE_IP);
+        g_gw_hdr[GW_IP_OFFSET] = 0x45U;
+        gw_put16(&g_gw_hdr[GW_IP_OFFSET + 6U], GW_IP_DF);
+        g_gw_hdr[GW_IP_OFFSET + 8U] = (uint8_t)GW_IP_TTL;
+        g_gw_hdr[GW_IP_OFFSET + 9U] = (uint8_t)GW_IP_PROTO_UDP;
+        gw_put32(&g_gw_hdr[GW_IP_OFFSET + 12U], cfg->local_ip);
+        gw_put32(&g_gw_hdr[GW_IP_OFFSET + 16U], cfg->remote_ip);
+        gw_put16(&g_gw_hdr[GW_UDP_OFFSET], cfg->local_port);
+        gw_put16(&g_gw_hdr[GW_UDP_OFFSET + 2U], cfg->remote_port);
+
+        g_gw_free = (gw_buf_t *)0;
+        for(inc = 0U; inc != cfg->tx_buf_count; inc++)
+        {
+            g_gw_buf[inc].addr = &cfg->tx_buf_mem[inc * MSS_MAC_CAN_GW_TX_BUF_SIZE];
+            gw_free_push(&g_gw_buf[inc]);
+        }
+
+        MSS_MAC_set_rx_callback(this_mac, 0U, gw_rx_callback);
+        MSS_MAC_set_tx_batch_callback(this_mac, 0U, gw_tx_batch_callback);
+        MSS_MAC_set_tx_reclaim_mode(this_mac, 0U, 1U);
+        MSS_MAC_set_rx_poll_mode(this_mac, 0U, gw_poll_sched);
+
+        for(inc = 0U; inc != MSS_MAC_RX_RING_SIZE; inc++)
+        {
+            /* Fill the ring with reception off and start it on the last */
+            enable = ((MSS_MAC_RX_RING_SIZE - 1U) == inc) ? MSS_MAC_INT_ARM : MSS_MAC_INT_DISABLE;
+            if(MSS_MAC_SUCCESS != MSS_MAC_receive_pkt(this_mac, 0U,
+                                                      &cfg->rx_buf_mem[inc * MSS_MAC_MAX_RX_BUF_SIZE],
+                                                      (void *)0, enable))
+            {
+                status = MSS_MAC_FAILED;
+            }
+        }
+    }
+
+    return(status);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_ethernet_mac_can_gw.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_can_gw_poll
+(
+    uint32_t budget
+)
+{
+    uint32_t moved = 0U;
+    uint32_t channel;
+
+    /* Completed datagrams give their buffers back through the batch callback */
+    (void)MSS_MAC_tx_reclaim(g_gw_mac, 0U);
+
+    for(channel = 0U; channel != MSS_MAC_CAN_GW_CHANNELS; channel++)
+    {
+        if((mss_can_instance_t *)0 != g_gw_can[channel])
+        {
+            MSS_CAN_tx_sched_service(g_gw_can[channel]);
+            moved += gw_can_take(channel, budget);
+        }
+    }
+
+    if(((gw_buf_t *)0 != g_gw_open) && ((readmtime() - g_gw_open_time) >= g_gw_flush_ticks))
+    {
+        g_gw_stats.flush_time++;
+        gw_close();
+    }
+
+    moved += MSS_MAC_rx_poll(g_gw_mac, 0U, budget);
+
+    gw_post();
+
+    return(moved);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_ethernet_mac_can_gw.h for details of how to use this function.
+ */
+void
+MSS_MAC_can_gw_flush
+(
+    void
+)
+{
+    if((gw_buf_t *)0 != g_gw_open)
+    {
+        gw_close();
+    }
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_ethernet_mac_can_gw.h for details of how to use this function.
+ */
+void
+MSS_MAC_can_gw_get_stats
+(
+    mss_mac_can_gw_stats_t *stats
+)
+{
+    *stats = g_gw_stats;
+}
+
+/*------------------------------------------------------------------------------
+ * Handle a frame and give its buffer straight back to the ring, everything
+ * wanted has been copied out of it by then.
+ */
+static void gw_rx_callback
+(
+    void *this_mac,
+    uint32_t queue_no,
+    uint8_t *p_rx_packet,
+    uint32_t pckt_length,
+    mss_mac_rx_desc_t *cdesc,
+    void *p_user_data
+)
+{
+    const uint8_t *ip = &p_rx_packet[GW_IP_OFFSET];
+    uint32_t ethertype = 0U;
+    uint32_t ihl;
+    uint32_t ip_length;
+    uint32_t udp_length;
+    uint32_t handled = 0U;
+
+    (void)queue_no;
+    (void)cdesc;
+
+    if(pckt_length >= GW_MAC_HDR_LEN)
+    {
+        ethertype = gw_get16(&p_rx_packet[12]);
+    }
+
+    if((GW_ETHERTYPE_ARP == ethertype) && (pckt_length >= (GW_MAC_HDR_LEN + GW_ARP_LEN)))
+    {
+        if((GW_ARP_REQUEST == gw_get16(&ip[6])) && (g_gw_local_ip == gw_get32(&ip[24])))
+        {
+            gw_arp(ip);
+            handled = 1U;
+        }
+    }
+    else if((GW_ETHERTYPE_IP == ethertype) && (pckt_length >= GW_DATA_OFFSET))
+    {
+        ihl = ((uint32_t)ip[0] & 0x0FU) * 4U;
+        ip_length = gw_get16(&ip[2]);
+
+        if((0x40U == (ip[0] & 0xF0U)) && (GW_IP_PROTO_UDP == ip[9]) &&
+           (g_gw_local_ip == gw_get32(&ip[16])) &&
+           (0U == (gw_get16(&ip[6]) & GW_IP_FRAG_MASK)) &&
+           (ihl >= GW_IP_HDR_LEN) && (ip_length >= (ihl + GW_UDP_HDR_LEN)) &&
+           ((GW_MAC_HDR_LEN + ip_length) <= pckt_length) &&
+           (g_gw_local_port == gw_get16(&ip[ihl + 2U])))
+        {
+            handled = 1U;
+            udp_length = gw_get16(&ip[ihl + 4U]);
+            if(0U != gw_ip_checksum(ip, ihl))
+            {
+                g_gw_stats.rx_bad++;
+            }
+            else if((udp_length < GW_UDP_HDR_LEN) || (udp_length > (ip_length - ihl)))
+            {
+                g_gw_stats.rx_bad++;
+            }
+            else
+            {
+                gw_datagram(&ip[ihl + GW_UDP_HDR_LEN], udp_length - GW_UDP_HDR_LEN);
+            }
+        }
+    }
+    else
+    {
+        /* Runt or another protocol */
+    }
+
+    if(0U == handled)
+    {
+        g_gw_stats.rx_other++;
+    }
+
+    (void)MSS_MAC_receive_pkt((mss_mac_instance_t *)this_mac, 0U, p_rx_packet, p_user_data, MSS_MAC_INT_ENABLE);
+}
+
+/*------------------------------------------------------------------------------
+ * The sent buffers go back on the free list. With deferred reclaim this is
+ * called from the poll, but masking interrupts keeps the list safe should the
+ * MAC interrupt reclaim them instead.
+ */
+static void gw_tx_batch_callback
+(
+    void *this_mac,
+    uint32_t queue_no,
+    mss_mac_tx_desc_t *cdescs,
+    void * const *p_user_data,
+    uint32_t count
+)
+{
+    uint32_t index;
+
+    (void)this_mac;
+    (void)queue_no;
+    (void)cdescs;
+
+    for(index = 0U; index != count; index++)
+    {
+        gw_free_push((gw_buf_t *)p_user_data[index]);
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * The gateway hart polls continuously so there is nothing to schedule.
+ */
+static void gw_poll_sched(void *this_mac, uint32_t queue_no)
+{
+    (void)this_mac;
+    (void)queue_no;
+}
+
+/*------------------------------------------------------------------------------
+ * Move up to budget frames of a channel into datagrams. The frames drained
+ * together share a timestamp, so the resolution is the time between polls.
+ */
+static uint32_t gw_can_take(uint32_t channel, uint32_t budget)
+{
+    mss_can_instance_t *this_can = g_gw_can[channel];
+    mss_can_msgobject msg;
+    uint8_t *rec;
+    uint64_t now;
+    uint32_t id;
+    uint32_t taken = 0U;
+    uint32_t inc;
+    uint8_t more = 1U;
+
+    (void)MSS_CAN_rx_drain(this_can);
+    now = readmtime();
+
+    while((taken != budget) && (0U != more))
+    {
+        if((gw_buf_t *)0 == g_gw_open)
+        {
+            g_gw_open = gw_free_pop();
+            g_gw_open_count = 0U;
+            g_gw_open_time = now;
+        }
+
+        if((gw_buf_t *)0 == g_gw_open)
+        {
+            /* Check first, a frame taken must have somewhere to go */
+            if(this_can->rx_ring_head != this_can->rx_ring_tail)
+            {
+                g_gw_stats.tx_stall++;
+            }
+            more = 0U;
+        }
+        else if(CAN_VALID_MSG != MSS_CAN_rx_ring_get(this_can, &msg))
+        {
+            more = 0U;
+        }
+        else
+        {
+            rec = &g_gw_open->addr[GW_REC_OFFSET + (g_gw_open_count * MSS_MAC_CAN_GW_REC_LEN)];
+
+            id = MSS_CAN_get_id(&msg) & GW_ID_MASK;
+            if(0U != msg.IDE)
+            {
+                id |= GW_ID_EXTENDED;
+            }
+            if(0U != msg.RTR)
+            {
+                id |= GW_ID_REMOTE;
+            }
+
+            gw_put32(&rec[0], (uint32_t)(now - g_gw_open_time));
+            gw_put32(&rec[4], id);
+            rec[8] = (uint8_t)channel;
+            rec[9] = (uint8_t)msg.DLC;
+            rec[10] = 0U;
+            rec[11] = 0U;
+            for(inc = 0U; inc != 8U; inc++)
+            {
+                rec[12U + inc] = (uint8_t)msg.DATA[inc];
+            }
+
+            g_gw_open_count++;
+            g_gw_stats.can_rx[channel]++;
+            taken++;
+
+            if(g_gw_open_count >= g_gw_flush_frames)
+            {
+                g_gw_stats.flush_size++;
+                gw_close();
+            }
+        }
+    }
+
+    return(taken);
+}
+
+/*------------------------------------------------------------------------------
+ * Finish the headers of the open datagram and put it on the ready list.
+ */
+static void gw_close(void)
+{
+    uint8_t *frame = g_gw_open->addr;
+    uint32_t udp_length;
+    uint16_t checksum;
+
+    udp_length = GW_UDP_HDR_LEN + MSS_MAC_CAN_GW_HDR_LEN + (g_gw_open_count * MSS_MAC_CAN_GW_REC_LEN);
+
+    (void)memcpy(frame, g_gw_hdr, sizeof(g_gw_hdr));
+    gw_put16(&frame[GW_IP_OFFSET + 2U], GW_IP_HDR_LEN + udp_length);
+    gw_put16(&frame[GW_IP_OFFSET + 4U], (uint32_t)g_gw_ip_id);
+    checksum = gw_ip_checksum(&frame[GW_IP_OFFSET], GW_IP_HDR_LEN);
+    gw_put16(&frame[GW_IP_OFFSET + 10U], (uint32_t)checksum);
+    gw_put16(&frame[GW_UDP_OFFSET + 4U], udp_length);
+
+    gw_put16(&frame[GW_DATA_OFFSET], MSS_MAC_CAN_GW_MAGIC);
+    frame[GW_DATA_OFFSET + 2U] = (uint8_t)MSS_MAC_CAN_GW_VERSION;
+    frame[GW_DATA_OFFSET + 3U] = (uint8_t)g_gw_open_count;
+    gw_put32(&frame[GW_DATA_OFFSET + 4U], g_gw_seq);
+    gw_put32(&frame[GW_DATA_OFFSET + 8U], (uint32_t)(g_gw_open_time >> 32));
+    gw_put32(&frame[GW_DATA_OFFSET + 12U], (uint32_t)g_gw_open_time);
+
+    g_gw_ready[g_gw_ready_count].queue_no = 0U;
+    g_gw_ready[g_gw_ready_count].length = GW_UDP_OFFSET + udp_length;
+    g_gw_ready[g_gw_ready_count].tx_buffer = frame;
+    g_gw_ready[g_gw_ready_count].p_user_data = (void *)g_gw_open;
+    g_gw_ready_count++;
+
+    g_gw_seq++;
+    g_gw_ip_id++;
+    g_gw_open = (gw_buf_t *)0;
+    g_gw_open_count = 0U;
+}
+
+/*------------------------------------------------------------------------------
+ * Send the ready frames in one batch. The batch is only taken once the
+ * previous one has gone, until then the frames wait for the next poll.
+ */
+static void gw_post(void)
+{
+    int32_t status;
+    uint32_t sent;
+    uint32_t inc;
+
+    if(0U != g_gw_ready_count)
+    {
+        status = MSS_MAC_send_pkt_batch(g_gw_mac, 0U, g_gw_ready, g_gw_ready_count);
+        if(status > 0)
+        {
+            sent = (uint32_t)status;
+            for(inc = 0U; inc != sent; inc++)
+            {
+                if(GW_ETHERTYPE_IP == gw_get16(&g_gw_ready[inc].tx_buffer[12]))
+                {
+                    g_gw_stats.datagrams_tx++;
+                }
+            }
+
+            for(inc = sent; inc != g_gw_ready_count; inc++)
+            {
+                g_gw_ready[inc - sent] = g_gw_ready[inc];
+            }
+            g_gw_ready_count -= sent;
+        }
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Queue the frames of a datagram on their channels. A record for a channel not
+ * in use, or with a bad DLC, is dropped and the rest are still queued.
+ */
+static void gw_datagram(const uint8_t *data, uint32_t length)
+{
+    const uint8_t *rec;
+    mss_can_msgobject msg;
+    uint32_t count;
+    uint32_t index;
+    uint32_t channel;
+    uint32_t id;
+    uint32_t inc;
+
+    if((length < MSS_MAC_CAN_GW_HDR_LEN) ||
+       (MSS_MAC_CAN_GW_MAGIC != gw_get16(&data[0])) ||
+       (MSS_MAC_CAN_GW_VERSION != data[2]) ||
+       (length < (MSS_MAC_CAN_GW_HDR_LEN + ((uint32_t)data[3] * MSS_MAC_CAN_GW_REC_LEN))))
+    {
+        g_gw_stats.rx_bad++;
+    }
+    else
+    {
+        g_gw_stats.datagrams_rx++;
+        count = (uint32_t)data[3];
+
+        for(index = 0U; index != count; index++)
+        {
+            rec = &data[MSS_MAC_CAN_GW_HDR_LEN + (index * MSS_MAC_CAN_GW_REC_LEN)];
+            channel = (uint32_t)rec[8];
+
+            if((channel >= MSS_MAC_CAN_GW_CHANNELS) ||
+               ((mss_can_instance_t *)0 == g_gw_can[channel]) ||
+               (rec[9] > 8U))
+            {
+                g_gw_stats.rx_bad++;
+            }
+            else
+            {
+                id = gw_get32(&rec[4]);
+
+                (void)memset(&msg, 0, sizeof(msg));
+                msg.IDE = (0U != (id & GW_ID_EXTENDED)) ? 1U : 0U;
+                msg.RTR = (0U != (id & GW_ID_REMOTE)) ? 1U : 0U;
+                msg.DLC = rec[9];
+                msg.ID = id & GW_ID_MASK;
+                msg.ID = MSS_CAN_set_id(&msg);
+                for(inc = 0U; inc != 8U; inc++)
+                {
+                    msg.DATA[inc] = (int8_t)rec[12U + inc];
+                }
+
+                if(CAN_VALID_MSG == MSS_CAN_tx_sched_send(g_gw_can[channel], &msg))
+                {
+                    g_gw_stats.can_tx[channel]++;
+                }
+                else
+                {
+                    g_gw_stats.can_tx_full[channel]++;
+                }
+            }
+        }
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Answer an ARP request for the gateway address. The reply goes out with the
+ * next batch, or not at all if there is no free buffer, as the asker retries.
+ */
+static void gw_arp(const uint8_t *arp)
+{
+    gw_buf_t *buf;
+    uint8_t *frame;
+
+    if(g_gw_ready_count != MSS_MAC_CAN_GW_MAX_TX_BUFS)
+    {
+        buf = gw_free_pop();
+        if((gw_buf_t *)0 != buf)
+        {
+            frame = buf->addr;
+            (void)memset(frame, 0, GW_MIN_FRAME);
+
+            (void)memcpy(&frame[0], &arp[8], 6U);
+            (void)memcpy(&frame[6], g_gw_mac->mac_addr, 6U);
+            gw_put16(&frame[12], GW_ETHERTYPE_ARP);
+
+            (void)memcpy(&frame[GW_MAC_HDR_LEN], arp, 6U);     /* Same hardware and protocol types */
+            gw_put16(&frame[GW_MAC_HDR_LEN + 6U], GW_ARP_REPLY);
+            (void)memcpy(&frame[GW_MAC_HDR_LEN + 8U], g_gw_mac->mac_addr, 6U);
+            gw_put32(&frame[GW_MAC_HDR_LEN + 14U], g_gw_local_ip);
+            (void)memcpy(&frame[GW_MAC_HDR_LEN + 18U], &arp[8], 10U);  /* Sender becomes target */
+
+            g_gw_ready[g_gw_ready_count].queue_no = 0U;
+            g_gw_ready[g_gw_ready_count].length = GW_MIN_FRAME;
+            g_gw_ready[g_gw_ready_count].tx_buffer = frame;
+            g_gw_ready[g_gw_ready_count].p_user_data = (void *)buf;
+            g_gw_ready_count++;
+
+            g_gw_stats.arp_replies++;
+        }
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * One's complement sum of a header. Over a header with its checksum filled in
+ * the result is 0 if the checksum is right.
+ */
+static uint16_t gw_ip_checksum(const uint8_t *hdr, uint32_t length)
+{
+    uint32_t sum = 0U;
+    uint32_t inc;
+
+    for(inc = 0U; inc < length; inc += 2U)
+    {
+        sum += gw_get16(&hdr[inc]);
+    }
+
+    while(0U != (sum >> 16))
+    {
+        sum = (sum & 0xFFFFU) + (sum >> 16);
+    }
+
+    return((uint16_t)(~sum & 0xFFFFU));
+}
+
+/*------------------------------------------------------------------------------
+ * Big endian field access.
+ */
+static void gw_put16(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)(value >> 8);
+    p[1] = (uint8_t)value;
+}
+
+static void gw_put32(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)(value >> 24);
+    p[1] = (uint8_t)(value >> 16);
+    p[2] = (uint8_t)(value >> 8);
+    p[3] = (uint8_t)value;
+}
+
+static uint32_t gw_get16(const uint8_t *p)
+{
+    return(((uint32_t)p[0] << 8) | (uint32_t)p[1]);
+}
+
+static uint32_t gw_get32(const uint8_t *p)
+{
+    return(((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3]);
+}
+
+/*------------------------------------------------------------------------------
+ * Free buffer list. Interrupts are masked while it is changed in case the
+ * batch callback comes from the MAC interrupt.
+ */
+static void gw_free_push(gw_buf_t *buf)
+{
+    uint64_t psr = read_csr(mstatus);
+
+    __disable_irq();
+    buf->next = g_gw_free;
+    g_gw_free = buf;
+    write_csr(mstatus, psr);
+}
+
+static gw_buf_t *gw_free_pop(void)
+{
+    uint64_t psr = read_csr(mstatus);
+    gw_buf_t *buf;
+
+    __disable_irq();
+    buf = g_gw_free;
+    if((gw_buf_t *)0 != buf)
+    {
+        g_gw_free = buf->next;
+    }
+    write_csr(mstatus, psr);
+
+    return(buf);
+}
+
+#endif /* defined(MSS_MAC_CAN_GW) */
+
+#ifdef __cplusplus
+}
+#endif
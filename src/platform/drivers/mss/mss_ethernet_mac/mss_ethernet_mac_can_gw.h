@@ -0,0 +1,274 @@
+/*******************************************************************************
+ * Copyright 2021 Microchip Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem CAN to UDP gateway.
+ *
+ */
+/*=========================================================================*//**
+  @section intro_sec Introduction
+  The gateway carries the frames of the MSS CAN controllers over UDP. Frames
+  received on either controller are gathered, with the time they were taken
+  from the controller, into one datagram which is sent once it holds
+  _flush_frames_ frames or its first frame is _flush_ticks_ mtime ticks old.
+  Datagrams go out through _MSS_MAC_send_pkt_batch()_, all those ready at a
+  poll with one transmit start. The frames of datagrams received are queued on
+  the transmit scheduler of the controller each names, so the most urgent goes
+  out first whatever order they arrived in.
+
+  The gateway has a single peer, whose MAC and IP addresses are configured, and
+  answers ARP requests for its own IP address. No other traffic is handled.
+  The UDP checksum is not filled in and not checked. The IPv4 header checksum
+  is.
+
+  The gateway is built when _MSS_MAC_CAN_GW_ is defined in
+  _mss_ethernet_mac_sw_cfg.h_ and uses queue 0 of the MAC with polled receive
+  and deferred transmit reclaim.
+
+  @section format Datagram format
+  All fields are big endian. Each datagram, in either direction, starts with a
+  16 byte header:
+
+    | Offset | Size | Field                                          |
+    |--------|------|------------------------------------------------|
+    | 0      | 2    | _MSS_MAC_CAN_GW_MAGIC_                         |
+    | 2      | 1    | _MSS_MAC_CAN_GW_VERSION_                       |
+    | 3      | 1    | Number of frames                               |
+    | 4      | 4    | Sequence number, one up for each datagram sent |
+    | 8      | 8    | mtime when the first frame was taken           |
+
+  followed by a 20 byte record for each frame:
+
+    | Offset | Size | Field                                          |
+    |--------|------|------------------------------------------------|
+    | 0      | 4    | mtime ticks since the time in the header       |
+    | 4      | 4    | ID, right aligned, b31 set for an extended ID  |
+    |        |      | and b30 for a remote frame                     |
+    | 8      | 1    | Channel, the index in _can_ of the controller  |
+    | 9      | 1    | DLC                                            |
+    | 10     | 2    | 0                                              |
+    | 12     | 8    | Data bytes, in the order of _DATA[]_           |
+
+  The time fields of datagrams received are ignored.
+
+  @section usage Usage
+  The MAC is initialised with _MSS_MAC_init()_ as usual, with no receive
+  buffers queued. Each CAN controller is initialised and given a receive ring
+  with _MSS_CAN_rx_ring_init()_ and a transmit scheduler with
+  _MSS_CAN_tx_sched_init()_, and started. They are all handed to
+  _MSS_MAC_can_gw_init()_ along with the memory for the buffers. One hart then
+  calls _MSS_MAC_can_gw_poll()_ in a loop.
+
+  The poll drains the CAN receive mailboxes with _MSS_CAN_rx_drain()_ and
+  services the CAN transmit schedulers itself, so the CAN interrupts can be
+  left disabled. If they are used, their handlers and the MAC interrupt must
+  be taken on the gateway hart. Running the gateway alone on its hart keeps the
+  gap between polls short enough for both controllers at full bus load, the
+  receive rings only need to cover the longest gap. When there is no free
+  transmit buffer frames are left in the receive rings, which count the frames
+  they lose if they overflow.
+
+  Example:
+  @code
+    #define GW_TX_BUFS  (4U)
+
+    static uint8_t gw_rx_mem[MSS_MAC_RX_RING_SIZE][MSS_MAC_MAX_RX_BUF_SIZE] __attribute__ ((aligned (8)));
+    static uint8_t gw_tx_mem[GW_TX_BUFS][MSS_MAC_CAN_GW_TX_BUF_SIZE] __attribute__ ((aligned (8)));
+    static mss_can_msgobject gw_ring[2][64];
+    static mss_can_msgobject gw_heap[2][32];
+    static mss_can_tx_sched_t gw_sched[2];
+
+    void u54_3(void)
+    {
+        mss_mac_can_gw_cfg_t cfg;
+        static const uint8_t peer[6] = {0x00U, 0x04U, 0xA3U, 0x12U, 0x34U, 0x56U};
+
+        MSS_MAC_init(&g_mac0, &g_mac_config0);
+
+        MSS_CAN_init(&g_mss_can_0_lo, CAN_SPEED_32M_1M | CAN_ARB_FIXED_PRIO,
+                     (pmss_can_config_reg)0, 8u, 24u);
+        (void)MSS_CAN_rx_ring_init(&g_mss_can_0_lo, gw_ring[0], 64u);
+        (void)MSS_CAN_tx_sched_init(&g_mss_can_0_lo, &gw_sched[0], gw_heap[0], 32u, 8u);
+        MSS_CAN_start(&g_mss_can_0_lo);
+        ... the same for g_mss_can_1_lo ...
+
+        cfg.mac = &g_mac0;
+        cfg.can[0] = &g_mss_can_0_lo;
+        cfg.can[1] = &g_mss_can_1_lo;
+        (void)memcpy(cfg.remote_mac, peer, 6U);
+        cfg.local_ip = 0xC0A80164UL;    // 192.168.1.100
+        cfg.remote_ip = 0xC0A80101UL;   // 192.168.1.1
+        cfg.local_port = 5000U;
+        cfg.remote_port = 5000U;
+        cfg.rx_buf_mem = &gw_rx_mem[0][0];
+        cfg.tx_buf_mem = &gw_tx_mem[0][0];
+        cfg.tx_buf_count = GW_TX_BUFS;
+        cfg.flush_frames = MSS_MAC_CAN_GW_MAX_RECORDS;
+        cfg.flush_ticks = 1000U;        // 1ms
+
+        if(MSS_MAC_SUCCESS == MSS_MAC_can_gw_init(&cfg))
+        {
+            for(;;)
+            {
+                (void)MSS_MAC_can_gw_poll(32U);
+            }
+        }
+    }
+  @endcode
+ *//*=========================================================================*/
+#ifndef MSS_ETHERNET_MAC_CAN_GW_H_
+#define MSS_ETHERNET_MAC_CAN_GW_H_
+
+#include <stdint.h>
+#include "drivers/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac.h"
+#include "drivers/mss_can/mss_can.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MSS_MAC_CAN_GW)
+
+#define MSS_MAC_CAN_GW_CHANNELS     (2U)
+
+#define MSS_MAC_CAN_GW_MAGIC        (0x4347U)
+#define MSS_MAC_CAN_GW_VERSION      (1U)
+
+#define MSS_MAC_CAN_GW_HDR_LEN      (16U)   /* Datagram header */
+#define MSS_MAC_CAN_GW_REC_LEN      (20U)   /* One CAN frame */
+
+/*
+ * Size of each transmit buffer, the MAC, IPv4 and UDP headers and a full
+ * datagram rounded up to a multiple of 8.
+ */
+#define MSS_MAC_CAN_GW_TX_BUF_SIZE  ((((42U + MSS_MAC_CAN_GW_HDR_LEN + \
+                                      (MSS_MAC_CAN_GW_MAX_RECORDS * MSS_MAC_CAN_GW_REC_LEN)) + 7U) / 8U) * 8U)
+
+/***************************************************************************//**
+  Gateway configuration.
+
+  Addresses and ports are in host order. The local MAC address is the one the
+  MAC was initialised with. A controller in _can_ may be NULL if its channel is
+  not used.
+
+  _rx_buf_mem_ points to _MSS_MAC_RX_RING_SIZE_ receive buffers of
+  _MSS_MAC_MAX_RX_BUF_SIZE_ bytes each and _tx_buf_mem_ to _tx_buf_count_
+  transmit buffers of _MSS_MAC_CAN_GW_TX_BUF_SIZE_ bytes each, all 8 byte
+  aligned. _tx_buf_count_ is from 1 to _MSS_MAC_CAN_GW_MAX_TX_BUFS_, at least 2
+  lets one datagram fill while another is sent.
+ */
+typedef struct
+{
+    mss_mac_instance_t *mac;                          /*!< The MAC to use */
+    mss_can_instance_t *can[MSS_MAC_CAN_GW_CHANNELS]; /*!< The CAN controllers of each channel */
+    uint8_t             remote_mac[6];                /*!< MAC address of the peer */
+    uint32_t            local_ip;                     /*!< IP address of the gateway */
+    uint32_t            remote_ip;                    /*!< IP address of the peer */
+    uint16_t            local_port;                   /*!< UDP port datagrams are received on */
+    uint16_t            remote_port;                  /*!< UDP port datagrams are sent to */
+    uint8_t            *rx_buf_mem;                   /*!< Memory for the receive buffers */
+    uint8_t            *tx_buf_mem;                   /*!< Memory for the transmit buffers */
+    uint32_t            tx_buf_count;                 /*!< Number of transmit buffers */
+    uint32_t            flush_frames;                 /*!< Frames, 1 to MSS_MAC_CAN_GW_MAX_RECORDS, which fill a datagram */
+    uint64_t            flush_ticks;                  /*!< Age in mtime ticks of the first frame at which a datagram is sent */
+} mss_mac_can_gw_cfg_t;
+
+/***************************************************************************//**
+  Gateway statistics, counted from _MSS_MAC_can_gw_init()_.
+ */
+typedef struct
+{
+    uint64_t can_rx[MSS_MAC_CAN_GW_CHANNELS];      /*!< CAN frames received on a channel and put in a datagram */
+    uint64_t can_tx[MSS_MAC_CAN_GW_CHANNELS];      /*!< CAN frames received in datagrams and queued on a channel */
+    uint64_t can_tx_full[MSS_MAC_CAN_GW_CHANNELS]; /*!< CAN frames for a channel dropped as its transmit scheduler was full */
+    uint64_t datagrams_tx;                         /*!< Datagrams sent */
+    uint64_t datagrams_rx;                         /*!< Datagrams received for the gateway port */
+    uint64_t flush_size;                           /*!< Datagrams sent as they held flush_frames frames */
+    uint64_t flush_time;                           /*!< Datagrams sent as their first frame was flush_ticks old */
+    uint64_t tx_stall;                             /*!< Polls which left CAN frames in a receive ring for want of a buffer */
+    uint64_t rx_bad;                               /*!< Datagrams or records dropped as malformed or for a channel not in use */
+    uint64_t rx_other;                             /*!< Frames received which were not for the gateway */
+    uint64_t arp_replies;                          /*!< ARP requests answered */
+} mss_mac_can_gw_stats_t;
+
+/***************************************************************************//**
+  The _MSS_MAC_can_gw_init()_ function sets the gateway up and primes the
+  receive ring of the MAC.
+
+  Queue 0 of the MAC is switched to polled receive and deferred transmit
+  reclaim and its receive and batch transmit callbacks are taken over.
+
+  @param cfg
+    This parameter is a pointer to the gateway configuration.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the gateway was set up and
+    _MSS_MAC_FAILED_ if the configuration is not valid, the MAC is not
+    available or its receive ring was not empty, or a CAN controller has no
+    receive ring or transmit scheduler.
+ */
+uint8_t
+MSS_MAC_can_gw_init
+(
+    const mss_mac_can_gw_cfg_t *cfg
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_can_gw_poll()_ function moves up to _budget_ frames from each
+  CAN receive ring into datagrams, sends the datagrams which are full or old
+  enough, and handles up to _budget_ frames received by the MAC.
+
+  @param budget
+    This parameter is the most frames to take from each receive ring.
+
+  @return
+    This function returns the number of CAN frames taken and Ethernet frames
+    received.
+ */
+uint32_t
+MSS_MAC_can_gw_poll
+(
+    uint32_t budget
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_can_gw_flush()_ function sends the datagram being filled at
+  the next poll, however few frames it holds. It must be called from the
+  gateway hart.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_can_gw_flush
+(
+    void
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_can_gw_get_stats()_ function copies the gateway statistics. It
+  should be called from the gateway hart.
+
+  @param stats
+    This parameter points to the structure which receives the statistics.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_can_gw_get_stats
+(
+    mss_mac_can_gw_stats_t *stats
+);
+
+#endif /* defined(MSS_MAC_CAN_GW) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_ETHERNET_MAC_CAN_GW_H_ */
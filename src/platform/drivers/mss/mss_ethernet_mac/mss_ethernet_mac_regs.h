@@ -348,6 +348,7 @@ extern "C" {
 /* eMAC Int Moderation register bit definitions */
 
 #define GEM_TX_INT_MODERATION                       (BITS_08 << 16)
+#define GEM_TX_INT_MODERATION_SHIFT                 (16)
 #define GEM_RX_INT_MODERATION                       BITS_08
 
 /* General MAC Sys Wake Time register bit definitions */
@@ -201,6 +201,359 @@
 #endif
 #endif
 
+/***************************************************************************//**
+ * Define this macro to add the batch transmit functions. These post a list of
+ * packets to any queue of a pMAC or eMAC with a single transmit start and can
+ * report the completion of the whole batch with one callback.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_TX_BATCH
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add deferred transmit completion processing. Queues
+ * switched to deferred mode with _MSS_MAC_set_tx_reclaim_mode()_ reclaim sent
+ * descriptors on the next send or on a call to _MSS_MAC_tx_reclaim()_ instead
+ * of in the transmit interrupt. This requires the batch transmit support.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_TX_DEFERRED_RECLAIM
+#endif
+
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM) && !defined(MSS_MAC_TX_BATCH)
+#define MSS_MAC_TX_BATCH
+#endif
+
+/***************************************************************************//**
+ * Define this macro to enable the driver managed receive buffer pool. When the
+ * pool is attached to a queue with _MSS_MAC_rx_pool_init()_, the driver refills
+ * the receive descriptor ring from the pool itself and lends each received
+ * buffer to the application as a reference counted _mss_mac_rx_buf_t_ handle
+ * instead of requiring _MSS_MAC_receive_pkt()_ to be called for every frame.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_RX_BUFFER_POOL
+#endif
+
+/***************************************************************************//**
+ * Maximum number of buffers in each queue's receive buffer pool. This should be
+ * larger than _MSS_MAC_RX_RING_SIZE_ so that the receive ring can still be kept
+ * full while the application holds on to some of the received buffers.
+ */
+#if defined(MSS_MAC_RX_BUFFER_POOL) && !defined(MSS_MAC_RX_POOL_SIZE)
+#define MSS_MAC_RX_POOL_SIZE (MSS_MAC_RX_RING_SIZE * 2U)
+#endif
+
+/***************************************************************************//**
+ * Define this macro to receive frames across several receive buffers. Each
+ * buffer is then _MSS_MAC_RX_CHAIN_BUF_SIZE_ bytes rather than the maximum
+ * packet size and a longer frame, a jumbo frame for example, is handed to the
+ * callback set with _MSS_MAC_set_rx_chain_callback()_ as the list of buffers
+ * it was received into.
+ *
+ * _MSS_MAC_RX_CHAIN_BUF_SIZE_ must be a multiple of 64 and the receive ring
+ * must be able to hold a maximum size frame. This cannot be used with the
+ * receive buffer pool.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_RX_CHAINED
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add support for receive header-data splitting. With a
+ * split callback set by _MSS_MAC_set_rx_hdr_split()_, the MAC writes the
+ * headers of TCP and UDP frames into one receive buffer and the payload into
+ * the following ones. The driver copies the headers into a slot of a small
+ * header pool, which can be placed in the L2 scratchpad, returns the header
+ * buffer to the ring and hands the payload buffers to the application
+ * untouched. This requires the chained receive support.
+ *
+ * _MSS_MAC_RX_HDR_SIZE_ sets the size of a header slot, a multiple of 64 which
+ * is the longest header kept, and _MSS_MAC_RX_HDR_SLOTS_ the number of slots
+ * in each queue's header pool.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_RX_HDR_SPLIT
+#endif
+
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+#if !defined(MSS_MAC_RX_CHAINED)
+#define MSS_MAC_RX_CHAINED
+#endif
+#if !defined(MSS_MAC_RX_HDR_SIZE)
+#define MSS_MAC_RX_HDR_SIZE  (128U)
+#endif
+#if !defined(MSS_MAC_RX_HDR_SLOTS)
+#define MSS_MAC_RX_HDR_SLOTS (16U)
+#endif
+#if (0U != (MSS_MAC_RX_HDR_SIZE % 64U))
+#error "MSS_MAC_RX_HDR_SIZE must be a multiple of 64"
+#endif
+#endif
+
+#if defined(MSS_MAC_RX_CHAINED)
+#if !defined(MSS_MAC_RX_CHAIN_BUF_SIZE)
+#define MSS_MAC_RX_CHAIN_BUF_SIZE (1536U)
+#endif
+
+/*
+ * Buffers needed for a frame of the hardware maximum of 10240 bytes, plus the
+ * header buffer when the frame may be split
+ */
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+#define MSS_MAC_RX_CHAIN_MAX (((10240U + MSS_MAC_RX_CHAIN_BUF_SIZE - 1U) / MSS_MAC_RX_CHAIN_BUF_SIZE) + 1U)
+#else
+#define MSS_MAC_RX_CHAIN_MAX ((10240U + MSS_MAC_RX_CHAIN_BUF_SIZE - 1U) / MSS_MAC_RX_CHAIN_BUF_SIZE)
+#endif
+
+#if (0U != (MSS_MAC_RX_CHAIN_BUF_SIZE % 64U))
+#error "MSS_MAC_RX_CHAIN_BUF_SIZE must be a multiple of 64"
+#endif
+#if (MSS_MAC_RX_CHAIN_MAX > MSS_MAC_RX_RING_SIZE)
+#error "MSS_MAC_RX_RING_SIZE is too small for MSS_MAC_RX_CHAIN_BUF_SIZE"
+#endif
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+#error "MSS_MAC_RX_CHAINED cannot be used with MSS_MAC_RX_BUFFER_POOL"
+#endif
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add support for polled receive operation. When polling
+ * is enabled for a queue with _MSS_MAC_set_rx_poll_mode()_, the first receive
+ * interrupt masks further receive interrupts for the queue and asks the
+ * application to schedule a call to _MSS_MAC_rx_poll()_. Receive interrupts
+ * are only re-enabled once polling has emptied the receive ring.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_RX_POLL_MODE
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add support for busy polling a queue from a hart
+ * dedicated to it. With busy polling enabled for a queue with
+ * _MSS_MAC_set_busy_poll()_, all of the queue's interrupts are masked and
+ * _MSS_MAC_poll_rx()_ and _MSS_MAC_poll_tx_complete()_ work on the descriptor
+ * rings by their ownership bits alone, without reading the interrupt status or
+ * taking a trap.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_BUSY_POLL
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add the flow steering support functions which spread
+ * receive traffic across the pMAC queues using the Type 1 and Type 2
+ * screeners and route each queue's PLIC interrupt to a chosen U54.
+ *
+ * _MSS_MAC_FLOW_TABLE_SIZE_ sets the number of entries in the flow hash
+ * indirection table and must be a power of 2.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_FLOW_STEERING
+#endif
+
+#if defined(MSS_MAC_FLOW_STEERING) && !defined(MSS_MAC_FLOW_TABLE_SIZE)
+#define MSS_MAC_FLOW_TABLE_SIZE (64U)
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add a lock-free single producer, single consumer
+ * transmit ring in front of each queue. One hart per queue pushes packets with
+ * _MSS_MAC_tx_ring_push()_ without masking interrupts and the driver moves
+ * them onto the DMA descriptors from the push call or the transmit interrupt,
+ * whichever gets there first. This requires the batch transmit support.
+ *
+ * _MSS_MAC_TX_SPSC_SIZE_ sets the number of entries in each ring and must be a
+ * power of 2.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_TX_SPSC_RING
+#endif
+
+#if defined(MSS_MAC_TX_SPSC_RING) && !defined(MSS_MAC_TX_BATCH)
+#define MSS_MAC_TX_BATCH
+#endif
+
+#if defined(MSS_MAC_TX_SPSC_RING) && !defined(MSS_MAC_TX_SPSC_SIZE)
+#define MSS_MAC_TX_SPSC_SIZE (64U)
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add the performance counters read by
+ * _MSS_MAC_get_stats()_. The driver then times each MAC interrupt with the
+ * mcycle counter and tracks how many descriptors are handled per interrupt
+ * and the high-water marks of the transmit and receive rings.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_PERF_STATS
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add asynchronous link bring-up. When the _async_link_
+ * configuration parameter is set, _MSS_MAC_init()_ returns once the PHY has
+ * been initialised and the autonegotiation is stepped through by calls to
+ * _MSS_MAC_link_poll()_ from a timer or the PHY interrupt.
+ *
+ * _MSS_MAC_LINK_POLL_LIMIT_ sets the number of calls to _MSS_MAC_link_poll()_
+ * each step waits for before moving on as the blocking code would on timeout.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_ASYNC_LINK
+#endif
+
+#if defined(MSS_MAC_ASYNC_LINK) && !defined(MSS_MAC_LINK_POLL_LIMIT)
+#define MSS_MAC_LINK_POLL_LIMIT (1000U)
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add the queued MDIO engine. A list of PHY register
+ * operations given to _MSS_MAC_mdio_submit()_ is run back to back from the GEM
+ * management frame sent interrupt, or by _MSS_MAC_mdio_run()_ in one call.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_MDIO_QUEUE
+#endif
+
+/***************************************************************************//**
+ * Define this macro to have the receive and transmit callbacks read the time
+ * stamp the GEM writes to the DMA descriptor with
+ * _MSS_MAC_get_rx_timestamp()_ and _MSS_MAC_get_tx_timestamp()_. The upper
+ * seconds of the TSU are latched once each time the driver works through a
+ * ring rather than read for each packet. _MSS_MAC_TIME_STAMPED_MODE_ must be
+ * defined as well.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_DESC_TIMESTAMPS
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add the TSN traffic class layer. _MSS_MAC_tsn_init()_
+ * maps each VLAN priority (PCP) to the eMAC, for express traffic, or to a pMAC
+ * queue, sets up the credit based shapers and the MAC Merge Sublayer and
+ * _MSS_MAC_tsn_send_pkt()_ sends a frame to the MAC and queue of its PCP.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_TSN
+#endif
+
+/***************************************************************************//**
+ * Define this macro to build the two port software bridge of
+ * _mss_ethernet_mac_bridge.h_. Frames received on one MAC are sent out of the
+ * other from the same buffer and a MAC address learning table filters the
+ * frames which need not cross. The bridge uses polled receive and deferred
+ * transmit reclaim.
+ *
+ * _MSS_MAC_BRIDGE_TABLE_SIZE_ sets the entries in the learning table, a power
+ * of two, _MSS_MAC_BRIDGE_AGE_TICKS_ the calls to _MSS_MAC_bridge_tick()_ after
+ * which an address not seen again is forgotten and _MSS_MAC_BRIDGE_MAX_BUFS_
+ * the most buffers the bridge can own.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_BRIDGE
+#endif
+
+#if defined(MSS_MAC_BRIDGE)
+#if !defined(MSS_MAC_RX_POLL_MODE)
+#define MSS_MAC_RX_POLL_MODE
+#endif
+#if !defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+#define MSS_MAC_TX_DEFERRED_RECLAIM
+#endif
+#if !defined(MSS_MAC_TX_BATCH)
+#define MSS_MAC_TX_BATCH
+#endif
+#if !defined(MSS_MAC_BRIDGE_TABLE_SIZE)
+#define MSS_MAC_BRIDGE_TABLE_SIZE (256U)
+#endif
+#if !defined(MSS_MAC_BRIDGE_AGE_TICKS)
+#define MSS_MAC_BRIDGE_AGE_TICKS  (300U)
+#endif
+#if !defined(MSS_MAC_BRIDGE_MAX_BUFS)
+#define MSS_MAC_BRIDGE_MAX_BUFS   (4U * MSS_MAC_RX_RING_SIZE)
+#endif
+#endif
+
+/***************************************************************************//**
+ * Define this macro to build the CAN to UDP gateway of
+ * _mss_ethernet_mac_can_gw.h_. Frames received on the MSS CAN controllers are
+ * gathered into timestamped UDP datagrams sent with the batch transmit path
+ * and the frames of datagrams received are queued on the CAN transmit
+ * schedulers. The gateway uses polled receive and deferred transmit reclaim.
+ *
+ * _MSS_MAC_CAN_GW_MAX_RECORDS_ sets the most CAN frames in one datagram, no
+ * more than 72 so a datagram fits in a standard frame, and
+ * _MSS_MAC_CAN_GW_MAX_TX_BUFS_ the most transmit buffers the gateway can own.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_CAN_GW
+#endif
+
+#if defined(MSS_MAC_CAN_GW)
+#if !defined(MSS_MAC_RX_POLL_MODE)
+#define MSS_MAC_RX_POLL_MODE
+#endif
+#if !defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+#define MSS_MAC_TX_DEFERRED_RECLAIM
+#endif
+#if !defined(MSS_MAC_TX_BATCH)
+#define MSS_MAC_TX_BATCH
+#endif
+#if !defined(MSS_MAC_CAN_GW_MAX_RECORDS)
+#define MSS_MAC_CAN_GW_MAX_RECORDS (64U)
+#endif
+#if !defined(MSS_MAC_CAN_GW_MAX_TX_BUFS)
+#define MSS_MAC_CAN_GW_MAX_TX_BUFS (8U)
+#endif
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add the multicast filter manager. Addresses joined with
+ * _MSS_MAC_mcast_add()_ are counted and programmed into the specific address
+ * filters and the hash filter of the MAC so that unwanted multicast frames are
+ * dropped by the hardware.
+ *
+ * _MSS_MAC_MCAST_LIST_SIZE_ sets the number of addresses each MAC can hold and
+ * _MSS_MAC_MCAST_SA_FILTERS_, 0 to 3, the number of specific address filters,
+ * counting up from filter 2, given over to exact matching of the first
+ * addresses joined.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_MCAST_FILTER
+#endif
+
+#if defined(MSS_MAC_MCAST_FILTER)
+#if !defined(MSS_MAC_MCAST_LIST_SIZE)
+#define MSS_MAC_MCAST_LIST_SIZE   (16U)
+#endif
+#if !defined(MSS_MAC_MCAST_SA_FILTERS)
+#define MSS_MAC_MCAST_SA_FILTERS  (3U)
+#endif
+#if (MSS_MAC_MCAST_SA_FILTERS > 3U)
+#error "MSS_MAC_MCAST_SA_FILTERS must be 3 or less"
+#endif
+#endif
+
+/***************************************************************************//**
+ * Define this macro to add packet capture. _MSS_MAC_capture_start()_ has the
+ * driver copy the start of each frame received, and optionally sent, with a
+ * TSU time stamp into a ring in memory supplied by the application and
+ * _MSS_MAC_capture_dump()_ writes the ring out in pcap format.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_CAPTURE
+#endif
+
+/*
+ * Define MSS_MAC_CACHE_MAINTENANCE to have the driver flush transmit buffers
+ * from the L2 cache as they are queued and flush receive buffers as they are
+ * handed to the DMA engine and again before the receive callback is called.
+ * This allows packet buffers to be placed in cached DDR. The descriptor rings
+ * are not maintained and must still be placed in non-cached memory.
+ */
+#if defined(MSS_MAC_DOCUMENTATION)
+#define MSS_MAC_CACHE_MAINTENANCE
+#endif
+
 /***************************************************************************//**
  * Macros for testing for different PHY models supported in the current build.
  */
@@ -221,6 +574,10 @@
 #define MSS_MAC_64_BIT_ADDRESS_MODE    (0) /*!< @brief Enable 64 bit addressing */
 #endif
 
+#if defined(MSS_MAC_DESC_TIMESTAMPS) && !defined(MSS_MAC_TIME_STAMPED_MODE)
+#error "MSS_MAC_DESC_TIMESTAMPS needs MSS_MAC_TIME_STAMPED_MODE"
+#endif
+
 /***************************************************************************//**
  * Defines for different memory areas. Set the macro _MSS_MAC_USE_DDR_ to one of
  * these values to select the area of memory and buffer sizes to use when
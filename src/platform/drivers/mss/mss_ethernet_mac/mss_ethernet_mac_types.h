@@ -598,6 +598,55 @@ typedef void (*mss_mac_phy_extended_write_t)(/* mss_mac_instance_t */ const void
 
     The _MSS_MAC_cfg_struct_def_init()_ function sets this configuration parameter
     to 0x10 for bursts up to 16.
+
+  ___rx_int_moderation___:
+  ___tx_int_moderation___:
+    These parameters set the hardware interrupt moderation timers for receive
+    and transmit complete interrupts in units of 800ns. Once an interrupt has
+    been raised, the GEM holds off raising another one of the same type until
+    the timer expires, allowing a number of packets to be handled in each
+    interrupt. Valid values are 0 to _MSS_MAC_INT_MODERATION_MAX_ (255) and 0
+    disables moderation. These values can be changed later with the
+    _MSS_MAC_set_int_moderation()_ function.
+
+    The _MSS_MAC_cfg_struct_def_init()_ function sets these configuration
+    parameters to _MSS_MAC_INT_MODERATION_DISABLE_.
+
+  ___tx_csum_offload___:
+    This parameter enables hardware generation of the IP, TCP and UDP checksums
+    for transmitted frames. The checksum fields of each frame must be zeroed by
+    the sender and the frames must be fully contained in a single descriptor.
+    The GEM applies this setting to all transmit queues. Allowed values are:
+
+    - MSS_MAC_ENABLE
+    - MSS_MAC_DISABLE
+
+    The _MSS_MAC_cfg_struct_def_init()_ function sets this configuration
+    parameter to MSS_MAC_DISABLE.
+
+  ___rx_csum_offload___:
+    This parameter enables hardware checking of the IP, TCP and UDP checksums
+    of received frames. Frames with bad checksums are discarded by the GEM and
+    the result for good frames is reported in the receive descriptor and can be
+    retrieved with _MSS_MAC_RX_CSUM_STATUS()_. Allowed values are:
+
+    - MSS_MAC_ENABLE
+    - MSS_MAC_DISABLE
+
+    The _MSS_MAC_cfg_struct_def_init()_ function sets this configuration
+    parameter to MSS_MAC_DISABLE.
+
+  ___async_link___:
+    This parameter is only present when _MSS_MAC_ASYNC_LINK_ is defined. When
+    set to MSS_MAC_ENABLE, _MSS_MAC_init()_ does not wait for the SGMII PLL
+    lock or for the PHY and SGMII autonegotiation. The link is brought up by
+    calls to _MSS_MAC_link_poll()_ instead. Allowed values are:
+
+    - MSS_MAC_ENABLE
+    - MSS_MAC_DISABLE
+
+    The _MSS_MAC_cfg_struct_def_init()_ function sets this configuration
+    parameter to MSS_MAC_DISABLE.
  */
 
 typedef struct __mss_mac_cfg_t
@@ -651,6 +700,13 @@ typedef struct __mss_mac_cfg_t
     uint32_t mmsl_int_priority;         /*!< MMSL interrupt */
     uint32_t tsu_clock_select;          /*!< 0 for default TSU clock, 1 for fabric tsu clock */
     uint32_t amba_burst_length;         /*!< AXI burst length for DMA data transfers */
+    uint32_t rx_int_moderation;         /*!< RX interrupt moderation time in 800ns units, 0 to disable */
+    uint32_t tx_int_moderation;         /*!< TX interrupt moderation time in 800ns units, 0 to disable */
+    uint32_t tx_csum_offload;           /*!< Enable hardware TX IP/TCP/UDP checksum generation */
+    uint32_t rx_csum_offload;           /*!< Enable hardware RX IP/TCP/UDP checksum checking */
+#if defined(MSS_MAC_ASYNC_LINK)
+    uint32_t async_link;                /*!< Enable link bring-up by _MSS_MAC_link_poll()_ */
+#endif
 } mss_mac_cfg_t;
 
 /***************************************************************************//**
@@ -864,6 +920,16 @@ typedef enum __mss_mac_frag_size_t
 #define GEM_RX_DMA_TYPE_ID        (BIT_22 | BIT_23) /*!< @brief Bitfield 
                                                       indicating which ID
                                                       register was matched. */
+#define GEM_RX_DMA_CSUM_SHIFT     (22U)  /*!< @brief When RX checksum offload is
+                                           enabled GEM_RX_DMA_TYPE_ID holds the
+                                           checksum status instead. */
+#define GEM_RX_DMA_CSUM_NONE      (0U)   /*!< @brief Checksums not checked. */
+#define GEM_RX_DMA_CSUM_IP_OK     (1U)   /*!< @brief IP header checksum good,
+                                           payload not checked. */
+#define GEM_RX_DMA_CSUM_TCP_OK    (2U)   /*!< @brief IP and TCP checksums
+                                           good. */
+#define GEM_RX_DMA_CSUM_UDP_OK    (3U)   /*!< @brief IP and UDP checksums
+                                           good. */
 #define GEM_RX_DMA_VLAN_TAG       BIT_21 /*!< @brief Set if a VLAN tag was
                                            detected in the packet. */
 #define GEM_RX_DMA_PRIORITY_TAG   BIT_20 /*!< @brief Priority tag detected — 
@@ -993,6 +1059,29 @@ typedef void (*mss_mac_transmit_callback_t)(/* mss_mac_instance_t*/ void *this_m
                                        mss_mac_tx_desc_t *cdesc,
                                        void * p_user_data);
 
+#if defined(MSS_MAC_TX_BATCH)
+/***************************************************************************//**
+ * Batch transmit callback function.
+ *
+ * This is the prototype for the user function which the MSS Ethernet MAC driver
+ * calls, instead of the per packet transmit callback, when one or more packets
+ * have been transmitted on a queue with a batch callback registered.
+ *
+ *   - ___this_mac___    - pointer to global structure for the MAC in question.
+ *   - ___queue_no___    - 0 to 3 for pMAC and always 0 for eMAC.
+ *   - ___cdescs___      - pointer to the DMA descriptor of the first packet
+ *                         completed, the rest follow on consecutively.
+ *   - ___p_user_data___ - pointer to an array of the original user data
+ *                         pointers for the completed packets.
+ *   - ___count___       - number of packets completed.
+ */
+typedef void (*mss_mac_tx_batch_callback_t)(/* mss_mac_instance_t*/ void *this_mac,
+                                       uint32_t queue_no,
+                                       mss_mac_tx_desc_t *cdescs,
+                                       void * const *p_user_data,
+                                       uint32_t count);
+#endif
+
 /***************************************************************************//**
  * Receive callback function.
  *
@@ -1018,6 +1107,87 @@ typedef void (*mss_mac_receive_callback_t)(/* mss_mac_instance_t*/ void *this_ma
                                        mss_mac_rx_desc_t *cdesc,
                                        void *p_user_data);
 
+#if defined(MSS_MAC_RX_CHAINED)
+/***************************************************************************//**
+ * Receive buffer of a chained frame.
+ *
+ * This structure describes one of the receive buffers of a frame passed to the
+ * _mss_mac_receive_chain_callback_t_ function.
+ */
+typedef struct mss_mac_rx_frag mss_mac_rx_frag_t;
+struct mss_mac_rx_frag
+{
+    uint8_t *addr;        /*!< Pointer to the buffer */
+    uint32_t length;      /*!< Bytes of the frame in this buffer */
+    void    *p_user_data; /*!< User data pointer given with the buffer */
+};
+
+/***************************************************************************//**
+ * Chained receive callback function.
+ *
+ * When a frame has been received, the driver calls the function set with
+ * _MSS_MAC_set_rx_chain_callback()_ with the following parameters:
+ *   - ___this_mac___    - pointer to global structure for the MAC in question.
+ *   - ___queue_no___    - 0 to 3 for pMAC and always 0 for eMAC.
+ *   - ___frags___       - the buffers holding the frame, in order.
+ *   - ___frag_count___  - number of buffers.
+ *   - ___pckt_length___ - length of the frame.
+ *   - ___cdesc___       - pointer to the DMA descriptor of the last buffer
+ *                         which holds the frame status.
+ */
+typedef void (*mss_mac_receive_chain_callback_t)(/* mss_mac_instance_t*/ void *this_mac,
+                                       uint32_t queue_no,
+                                       const mss_mac_rx_frag_t *frags,
+                                       uint32_t frag_count,
+                                       uint32_t pckt_length,
+                                       mss_mac_rx_desc_t *cdesc);
+#endif
+
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+/***************************************************************************//**
+ * Header-data split receive callback function.
+ *
+ * When a TCP or UDP frame has been received with its headers split from its
+ * payload, the driver calls the function set with _MSS_MAC_set_rx_hdr_split()_
+ * with the following parameters:
+ *   - ___this_mac___    - pointer to global structure for the MAC in question.
+ *   - ___queue_no___    - 0 to 3 for pMAC and always 0 for eMAC.
+ *   - ___p_hdr___       - the header pool slot holding the frame's headers, to
+ *                         be handed back with _MSS_MAC_rx_hdr_release()_.
+ *   - ___hdr_length___  - length of the headers.
+ *   - ___frags___       - the receive buffers holding the payload, in order,
+ *                         to be handed back with _MSS_MAC_receive_pkt()_.
+ *   - ___frag_count___  - number of payload buffers.
+ *   - ___pckt_length___ - length of the frame, headers included.
+ *   - ___cdesc___       - pointer to the DMA descriptor of the last buffer
+ *                         which holds the frame status.
+ */
+typedef void (*mss_mac_receive_split_callback_t)(/* mss_mac_instance_t*/ void *this_mac,
+                                       uint32_t queue_no,
+                                       uint8_t *p_hdr,
+                                       uint32_t hdr_length,
+                                       const mss_mac_rx_frag_t *frags,
+                                       uint32_t frag_count,
+                                       uint32_t pckt_length,
+                                       mss_mac_rx_desc_t *cdesc);
+#endif
+
+/***************************************************************************//**
+ * Receive poll schedule callback function.
+ *
+ * This is the prototype for the user function which the MSS Ethernet MAC driver
+ * calls from the receive interrupt when polled receive operation is enabled
+ * for a queue. The function should arrange for _MSS_MAC_rx_poll()_ to be
+ * called for the queue from outside of the interrupt handler, for example by
+ * signalling a network task. No further receive interrupts occur for the queue
+ * until polling has emptied the receive ring.
+ *
+ *   - ___this_mac___    - pointer to global structure for the MAC in question.
+ *   - ___queue_no___    - 0 to 3 for pMAC and always 0 for eMAC.
+ */
+typedef void (*mss_mac_rx_poll_sched_t)(/* mss_mac_instance_t*/ void *this_mac,
+                                        uint32_t queue_no);
+
 /***************************************************************************//**
  * TSU timer time value.
  *
@@ -1150,6 +1320,66 @@ struct mss_mac_type_2_compare
     uint8_t  offset_value;      /*!< Offset value */
 };
 
+#if defined(MSS_MAC_FLOW_STEERING)
+/***************************************************************************//**
+ * Flow description structure.
+ *
+ * This structure is used with the flow steering functions to identify an IPv4
+ * TCP or UDP flow by its 5-tuple. Addresses and ports are in host byte order,
+ * for example 192.168.1.10 is 0xC0A8010AU.
+ *
+ * When used with _MSS_MAC_steer_flow()_, a value of 0 for any of the address,
+ * port or protocol fields means that field is not checked. The hardware
+ * screeners only look at the destination address, destination port and
+ * protocol so the source fields are only used by _MSS_MAC_flow_hash()_.
+ */
+typedef struct mss_mac_flow mss_mac_flow_t;
+struct mss_mac_flow
+{
+    uint32_t src_ip;   /*!< IPv4 source address */
+    uint32_t dst_ip;   /*!< IPv4 destination address */
+    uint16_t src_port; /*!< TCP/UDP source port */
+    uint16_t dst_port; /*!< TCP/UDP destination port */
+    uint8_t  protocol; /*!< IP protocol number, 6 for TCP and 17 for UDP */
+};
+
+/***************************************************************************//**
+ * Traffic class description structure.
+ *
+ * This structure is used with _MSS_MAC_classify()_ to describe a class of
+ * received packets by any combination of VLAN priority, Ethertype, IPv4 DSCP
+ * and UDP destination port. The _match_ field holds the _MSS_MAC_CLASS_*_ bits
+ * of the fields to be compared and a packet must match all of them. The
+ * Ethertype and port are in host byte order.
+ */
+typedef struct mss_mac_class mss_mac_class_t;
+struct mss_mac_class
+{
+    uint32_t match;     /*!< MSS_MAC_CLASS_* bits for the fields to compare */
+    uint16_t ethertype; /*!< Ethertype */
+    uint16_t udp_port;  /*!< UDP destination port */
+    uint8_t  vlan_pcp;  /*!< VLAN priority code point, 0 to 7 */
+    uint8_t  dscp;      /*!< IPv4 Differentiated Services code point, 0 to 63 */
+    uint8_t  drop;      /*!< Non 0 to drop matching packets instead of routing them */
+};
+
+/***************************************************************************//**
+ * Screener resource usage structure.
+ *
+ * This structure is filled in by _MSS_MAC_get_screener_usage()_ with the
+ * number of each kind of screening resource not yet allocated by the flow
+ * steering and classification functions.
+ */
+typedef struct mss_mac_screener_usage mss_mac_screener_usage_t;
+struct mss_mac_screener_usage
+{
+    uint32_t type_1_free;     /*!< Type 1 screeners */
+    uint32_t type_2_free;     /*!< Type 2 screeners */
+    uint32_t comparers_free;  /*!< Type 2 comparers */
+    uint32_t ethertypes_free; /*!< Type 2 Ethertype registers */
+};
+#endif
+
 /***************************************************************************//**
  * Media Merge Sublayer configuration structure.
  *
@@ -1202,6 +1432,117 @@ struct mss_mac_mmsl_stats
     uint32_t frag_count_tx; /*!< 17 bit count of mPackets sent */
 };
 
+/***************************************************************************//**
+ * Credit based shaper selection.
+ *
+ * The GEM has credit based shapers for its two highest priority transmit
+ * queues. Queue A is the highest priority queue, queue B the next.
+ */
+#define MSS_MAC_CBS_QUEUE_A     (0U) /*!< @brief Shaper of the highest priority queue */
+#define MSS_MAC_CBS_QUEUE_B     (1U) /*!< @brief Shaper of the second highest priority queue */
+
+#if defined(MSS_MAC_TSN)
+/***************************************************************************//**
+ * Number of VLAN priority (PCP) values.
+ */
+#define MSS_MAC_TSN_PCP_COUNT   (8U)
+
+/***************************************************************************//**
+ * TSN traffic class configuration structure.
+ *
+ * This structure is used with the _MSS_MAC_tsn_init()_ function to map the
+ * VLAN priorities onto the eMAC and the pMAC queues and to set up the shapers
+ * and the MAC Merge Sublayer.
+ */
+typedef struct mss_mac_tsn_config mss_mac_tsn_config_t;
+struct mss_mac_tsn_config
+{
+    mss_mac_mmsl_config_t mmsl;                      /*!< MAC Merge Sublayer mode, see _MSS_MAC_set_mmsl_mode()_ */
+    uint8_t  pcp_express[MSS_MAC_TSN_PCP_COUNT];     /*!< MSS_MAC_ENABLE to send the PCP as express traffic on the eMAC */
+    uint8_t  pcp_queue[MSS_MAC_TSN_PCP_COUNT];       /*!< pMAC queue for a PCP which is not express */
+    uint32_t idle_slope_a;                           /*!< pMAC shaper for queue A in bytes per second, 0 for none */
+    uint32_t idle_slope_b;                           /*!< pMAC shaper for queue B in bytes per second, 0 for none */
+    uint32_t emac_idle_slope;                        /*!< eMAC shaper in bytes per second, 0 for none */
+};
+
+/***************************************************************************//**
+ * TSN statistics structure.
+ *
+ * This structure is used to return the statistics kept by the TSN layer via
+ * the _MSS_MAC_tsn_get_stats()_ function. The MMSL counts are running totals
+ * of the counts read with _MSS_MAC_get_mmsl_stats()_.
+ */
+typedef struct mss_mac_tsn_stats mss_mac_tsn_stats_t;
+struct mss_mac_tsn_stats
+{
+    uint64_t smd_err_count;                          /*!< Unknown SMD values received */
+    uint64_t ass_err_count;                          /*!< Frames with reassembly errors */
+    uint64_t ass_ok_count;                           /*!< Frames reassembled ok */
+    uint64_t frag_count_rx;                          /*!< mPackets received */
+    uint64_t frag_count_tx;                          /*!< mPackets sent */
+    uint64_t tx_frames[MSS_MAC_TSN_PCP_COUNT];       /*!< Frames queued for each PCP */
+    uint64_t tx_refused[MSS_MAC_TSN_PCP_COUNT];      /*!< Frames of each PCP refused by a full ring */
+    uint32_t mmsl_status;                            /*!< MMSL Status register, see _MSS_MAC_get_mmsl_status()_ */
+};
+#endif
+
+#if defined(MSS_MAC_MCAST_FILTER)
+/***************************************************************************//**
+ * Multicast filter list entry.
+ *
+ * One of these is held in the MAC instance for each multicast address joined
+ * with _MSS_MAC_mcast_add()_.
+ */
+typedef struct mss_mac_mcast_entry mss_mac_mcast_entry_t;
+struct mss_mac_mcast_entry
+{
+    uint8_t  addr[6];                                /*!< Multicast MAC address */
+    uint16_t refs;                                   /*!< Joins not yet matched by a remove */
+};
+#endif
+
+#if defined(MSS_MAC_CAPTURE)
+/***************************************************************************//**
+ * Capture direction flags for the _flags_ member of _mss_mac_capture_t_.
+ */
+#define MSS_MAC_CAPTURE_RX      (0x01U) /*!< @brief Capture frames received */
+#define MSS_MAC_CAPTURE_TX      (0x02U) /*!< @brief Capture frames sent */
+
+/***************************************************************************//**
+ * Packet capture ring.
+ *
+ * This structure is owned by the application and passed to
+ * _MSS_MAC_capture_start()_. The first four members are set up by the
+ * application, the rest are maintained by the driver.
+ *
+ * Each frame is held as a pcap record header followed by the frame data,
+ * padded to a multiple of 8 bytes.
+ */
+typedef struct mss_mac_capture mss_mac_capture_t;
+struct mss_mac_capture
+{
+    uint8_t  *mem;                                   /*!< Ring memory, 8 byte aligned */
+    uint32_t  size;                                  /*!< Ring size in bytes, a power of 2 */
+    uint32_t  snaplen;                               /*!< Most bytes kept of each frame, 0 for all */
+    uint32_t  flags;                                 /*!< MSS_MAC_CAPTURE_RX and/or MSS_MAC_CAPTURE_TX */
+    volatile uint64_t head;                          /*!< Ring offset of the oldest record, advanced by the dump */
+    volatile uint64_t tail;                          /*!< Ring offset of the next record */
+    uint64_t  frames;                                /*!< Frames captured */
+    uint64_t  dropped;                               /*!< Frames not captured as the ring was full */
+};
+
+/***************************************************************************//**
+ * Capture dump output function.
+ *
+ * This is the prototype for the function which _MSS_MAC_capture_dump()_ calls
+ * with each piece of the pcap file. It returns _MSS_MAC_SUCCESS_ if the data
+ * was written, anything else ends the dump.
+ */
+typedef uint8_t (*mss_mac_capture_write_t)(void *ctx,
+                                           const uint8_t *data,
+                                           uint32_t length);
+#endif
+
 
 /***************************************************************************//**
  * Multi packet transmit structure
@@ -1224,6 +1565,122 @@ struct mss_mac_tx_pkt_info
 };
 
 
+#if defined(MSS_MAC_TX_SPSC_RING)
+/***************************************************************************//**
+ * Per queue single producer, single consumer transmit ring
+ *
+ * The producer hart owns _head_ and the entries between _tail_ and _head_
+ * are owned by the driver. Both indices run freely and are masked with
+ * _MSS_MAC_TX_SPSC_SIZE_ - 1 when accessing _entry_. The _busy_ flag is taken
+ * with an atomic swap by whichever context is moving packets onto the DMA
+ * descriptors and _pending_ tells it to go round again if another context
+ * found the ring busy.
+ */
+typedef struct mss_mac_tx_spsc
+{
+    mss_mac_tx_pkt_info_t entry[MSS_MAC_TX_SPSC_SIZE]; /*!< Packets waiting for descriptors */
+    volatile uint32_t     head;                        /*!< Next entry to be written by the producer */
+    volatile uint32_t     tail;                        /*!< Next entry to be sent by the driver */
+    volatile uint32_t     busy;                        /*!< Non 0 while a context is servicing the ring */
+    volatile uint32_t     pending;                     /*!< Set when a service request found the ring busy */
+    volatile uint64_t     full;                        /*!< Number of pushes refused because the ring was full */
+} mss_mac_tx_spsc_t;
+
+#endif
+
+/***************************************************************************//**
+ * Transmit fragment structure
+ *
+ * This structure is used with the _MSS_MAC_send_pkt_gather()_ function to
+ * describe one of the buffers that make up a frame. The fragments are sent in
+ * array order with no copying so, for example, the headers and payload of a
+ * packet can be held in separate buffers.
+ */
+typedef struct mss_mac_tx_frag mss_mac_tx_frag_t;
+
+struct mss_mac_tx_frag
+{
+    uint8_t const *addr;   /*!< Pointer to fragment data */
+    uint32_t       length; /*!< Length of this fragment in bytes */
+};
+
+
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+/***************************************************************************//**
+ * Value used to terminate the free list of a receive buffer pool.
+ */
+#define MSS_MAC_RX_POOL_END (0xFFFFFFFFU)
+
+/***************************************************************************//**
+ * Receive buffer pool handle
+ *
+ * One of these is maintained by the driver for each buffer in a receive buffer
+ * pool. When a packet is received into a pool buffer, a pointer to the handle
+ * is passed to the receive callback as the _caller_info_ parameter with a
+ * reference count of 1. The application owns that reference and must call
+ * _MSS_MAC_rx_buf_release()_ when it has finished with the packet data. The
+ * buffer can be shared with other software by calling _MSS_MAC_rx_buf_ref()_
+ * for each additional user. The buffer is only returned to the pool when the
+ * last reference is released.
+ */
+typedef struct mss_mac_rx_buf mss_mac_rx_buf_t;
+
+struct mss_mac_rx_buf
+{
+    uint8_t          *buffer;    /*!< Start of the packet buffer for this handle */
+    void             *this_mac;  /*!< MAC instance the pool belongs to */
+    uint32_t          queue_no;  /*!< Queue the pool belongs to */
+    uint32_t          length;    /*!< Length of the last packet received into the buffer */
+    volatile uint32_t ref_count; /*!< Number of outstanding references, 0 when free */
+    uint32_t          next_free; /*!< Index of next free buffer in pool */
+};
+
+/***************************************************************************//**
+ * Per queue receive buffer pool
+ *
+ * The pool memory is supplied by the application through the
+ * _MSS_MAC_rx_pool_init()_ function and is divided into fixed size buffers.
+ * Free buffers are kept on a singly linked free list of indices and the driver
+ * attaches them to the receive descriptor ring in bulk whenever descriptors
+ * become available.
+ */
+typedef struct mss_mac_rx_pool
+{
+    mss_mac_rx_buf_t  buf[MSS_MAC_RX_POOL_SIZE];        /*!< Buffer handles */
+    uint32_t          ring_buf[MSS_MAC_RX_RING_SIZE];   /*!< Index of buffer attached to each RX descriptor */
+    uint32_t          buf_count;                        /*!< Number of buffers in use in this pool */
+    uint32_t          buf_size;                         /*!< Size of each buffer in bytes */
+    uint32_t          free_head;                        /*!< Index of first free buffer */
+    volatile uint32_t free_count;                       /*!< Number of buffers on the free list */
+    uint32_t          active;                           /*!< Non 0 when the pool is feeding the RX ring */
+    volatile uint64_t starved;                          /*!< Number of times the ring could not be completely refilled */
+} mss_mac_rx_pool_t;
+#endif
+
+
+#if defined(MSS_MAC_PERF_STATS)
+/***************************************************************************//**
+ * Per queue performance counters
+ *
+ * These are maintained by the driver when _MSS_MAC_PERF_STATS_ is defined and
+ * are returned as part of the _mss_mac_stats_t_ snapshot. Cycle counts are in
+ * mcycle ticks of the hart which took the interrupt.
+ */
+typedef struct mss_mac_queue_perf
+{
+    volatile uint64_t isr_count;      /*!< Number of MAC interrupts handled for this queue */
+    volatile uint64_t isr_cycles;     /*!< Total cycles spent in the interrupt handler */
+    volatile uint64_t isr_max_cycles; /*!< Longest single interrupt in cycles */
+    volatile uint64_t rx_desc_done;   /*!< Receive descriptors processed */
+    volatile uint64_t tx_desc_done;   /*!< Transmit descriptors reclaimed */
+    volatile uint32_t rx_max_per_isr; /*!< Most receive descriptors processed in one interrupt */
+    volatile uint32_t tx_max_per_isr; /*!< Most transmit descriptors reclaimed in one interrupt */
+    volatile uint32_t rx_ring_hwm;    /*!< Most received frames found waiting in one pass of the ring */
+    volatile uint32_t tx_ring_hwm;    /*!< Most transmit descriptors in use at once */
+} mss_mac_queue_perf_t;
+
+#endif
+
 /***************************************************************************//**
  * Per queue specific info for device management structure.
  *
@@ -1268,16 +1725,146 @@ typedef struct mss_mac_queue
 
     /* Statistics counters */
 
-    volatile uint64_t ingress; /*!< Count of bytes received on this queue */
-    volatile uint64_t egress; /*!< Count of bytes transmitted on this queue */
-    volatile uint64_t rx_overflow; /*!< Number of receive overflow events on this queue */
-    volatile uint64_t hresp_error; /*!< Number of receive hresp error events on this queue*/
-    volatile uint64_t rx_restart; /*!< Number of times reception has been restarted on this queue */
-    volatile uint64_t tx_amba_errors; /*!< Number of receive amba error events on this queue */
-    volatile uint64_t tx_restart; /*!< Number of times transmission has been restarted on this queue */
-    volatile uint64_t tx_reenable; /*!< Number of times transmission has been reenabled on this queue */
+    mss_stat_t ingress; /*!< Count of bytes received on this queue */
+    mss_stat_t egress; /*!< Count of bytes transmitted on this queue */
+    mss_stat_t rx_overflow; /*!< Number of receive overflow events on this queue */
+    mss_stat_t hresp_error; /*!< Number of receive hresp error events on this queue*/
+    mss_stat_t rx_restart; /*!< Number of times reception has been restarted on this queue */
+    mss_stat_t tx_amba_errors; /*!< Number of receive amba error events on this queue */
+    mss_stat_t tx_restart; /*!< Number of times transmission has been restarted on this queue */
+    mss_stat_t tx_reenable; /*!< Number of times transmission has been reenabled on this queue */
+#if defined(MSS_MAC_TX_BATCH)
+    mss_mac_tx_batch_callback_t pckt_tx_batch_callback; /*!< Batch transmit callback, used in place of pckt_tx_callback if not NULL */
+#endif
+#if defined(MSS_MAC_TX_DEFERRED_RECLAIM)
+    uint32_t tx_reclaim_low_water;          /*!< Deferred reclaim if not 0, TX interrupt armed at or below this many free descriptors */
+    volatile uint32_t tx_reclaim_armed;     /*!< Set when the TX complete interrupt is armed in deferred mode */
+    volatile uint64_t tx_deferred_reclaims; /*!< Number of reclaims done outside the transmit interrupt */
+#endif
+#if defined(MSS_MAC_TX_SPSC_RING)
+    mss_mac_tx_spsc_t tx_spsc; /*!< Lock-free transmit ring for the owning hart */
+#endif
+#if defined(MSS_MAC_PERF_STATS)
+    mss_mac_queue_perf_t perf; /*!< Performance counters */
+#endif
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+    mss_mac_rx_pool_t rx_pool; /*!< Driver managed receive buffer pool */
+#endif
+#if defined(MSS_MAC_RX_POLL_MODE)
+    mss_mac_rx_poll_sched_t rx_poll_sched; /*!< Poll schedule callback, polled receive enabled if not NULL */
+    volatile uint32_t rx_poll_pending;     /*!< Set when RX interrupts are masked waiting for a poll */
+    volatile uint64_t rx_polls;            /*!< Number of calls to MSS_MAC_rx_poll() on this queue */
+    volatile uint64_t rx_poll_exhausted;   /*!< Number of polls which used up their full budget */
+#endif
+#if defined(MSS_MAC_BUSY_POLL)
+    volatile uint32_t busy_poll;      /*!< Set while the queue is busy polled with its interrupts masked */
+    uint32_t busy_poll_ints;          /*!< Interrupts enabled on the queue before busy polling started */
+    volatile uint64_t busy_polls;     /*!< Number of busy polls which found work on the queue */
+#endif
+#if defined(MSS_MAC_DESC_TIMESTAMPS)
+    uint64_t ts_secs_ref; /*!< TSU seconds latched as the rings were last worked on */
+#endif
+#if defined(MSS_MAC_RX_CHAINED)
+    mss_mac_receive_chain_callback_t pckt_rx_chain_callback; /*!< Chained receive callback */
+    mss_mac_rx_frag_t rx_chain[MSS_MAC_RX_CHAIN_MAX];        /*!< Buffers of the frame being handed over */
+    volatile uint64_t rx_chain_dropped;   /*!< Frames dropped as broken or with no callback to take them */
+#endif
+#if defined(MSS_MAC_RX_HDR_SPLIT)
+    mss_mac_receive_split_callback_t pckt_rx_split_callback; /*!< Header-data split receive callback */
+    uint8_t *rx_hdr_pool;                               /*!< MSS_MAC_RX_HDR_SLOTS slots of MSS_MAC_RX_HDR_SIZE bytes */
+    volatile uint8_t rx_hdr_used[MSS_MAC_RX_HDR_SLOTS]; /*!< Set while the application holds a slot */
+    uint32_t rx_hdr_next;                               /*!< Slot to try first for the next frame */
+    volatile uint64_t rx_hdr_split;                     /*!< Frames delivered with the headers split off */
+    volatile uint64_t rx_hdr_no_slot;                   /*!< Split frames dropped for want of a header slot */
+#endif
 } mss_mac_queue_t;
 
+#if defined(MSS_MAC_PERF_STATS)
+/***************************************************************************//**
+ * Per queue part of the _MSS_MAC_get_stats()_ snapshot.
+ */
+typedef struct mss_mac_queue_stats
+{
+    uint64_t ingress;           /*!< Count of bytes received on this queue */
+    uint64_t egress;            /*!< Count of bytes transmitted on this queue */
+    uint64_t rx_overflow;       /*!< Number of receive overflow events on this queue */
+    uint64_t hresp_error;       /*!< Number of receive hresp error events on this queue*/
+    uint64_t rx_restart;        /*!< Number of times reception has been restarted on this queue */
+    uint64_t tx_amba_errors;    /*!< Number of receive amba error events on this queue */
+    uint64_t tx_restart;        /*!< Number of times transmission has been restarted on this queue */
+    uint64_t tx_reenable;       /*!< Number of times transmission has been reenabled on this queue */
+    uint32_t rx_free_desc;      /*!< Receive descriptors free at the time of the snapshot */
+    uint32_t tx_free_desc;      /*!< Transmit descriptors free at the time of the snapshot */
+    mss_mac_queue_perf_t perf;  /*!< Performance counters */
+} mss_mac_queue_stats_t;
+
+/***************************************************************************//**
+ * Ethernet MAC statistics snapshot
+ *
+ * This structure is filled in by _MSS_MAC_get_stats()_. The hardware counts
+ * are running totals kept by the driver as the GEM statistics registers clear
+ * when read.
+ */
+typedef struct mss_mac_stats
+{
+    uint64_t              timestamp;              /*!< mcycle value when the snapshot was taken */
+    uint64_t              hw[MSS_MAC_LAST_STAT];  /*!< GEM statistics, indexed by _mss_mac_stat_t_ */
+    uint64_t              tx_pause;               /*!< Count of pause frames sent */
+    uint64_t              rx_pause;               /*!< Count of pause frames received */
+    uint64_t              pause_elapsed;          /*!< Count of pause frame elapsed events */
+    uint32_t              queue_count;            /*!< Number of valid entries in _queue_ */
+    mss_mac_queue_stats_t queue[MSS_MAC_QUEUE_COUNT]; /*!< Per queue counts */
+} mss_mac_stats_t;
+
+#endif
+
+
+#if defined(MSS_MAC_MDIO_QUEUE)
+/***************************************************************************//**
+ * Operations of the queued MDIO engine.
+ */
+#define MSS_MAC_MDIO_WRITE      (0U) /*!< Write _value_ to the register */
+#define MSS_MAC_MDIO_READ       (1U) /*!< Read the register into _value_ */
+#define MSS_MAC_MDIO_MODIFY     (2U) /*!< Replace the _mask_ bits of the register with those of _value_ */
+
+/***************************************************************************//**
+ * One PHY register operation of an MDIO script.
+ */
+typedef struct mss_mac_mdio_op
+{
+    uint8_t  cmd;               /*!< _MSS_MAC_MDIO_WRITE_, _READ_ or _MODIFY_ */
+    uint8_t  phy_addr;          /*!< PHY address on the MII management interface */
+    uint8_t  reg_addr;          /*!< PHY register */
+    uint16_t mask;              /*!< Bits written by _MSS_MAC_MDIO_MODIFY_ */
+    uint16_t value;             /*!< Value written, or value read for _MSS_MAC_MDIO_READ_ */
+} mss_mac_mdio_op_t;
+
+/***************************************************************************//**
+ * MDIO script completion callback function.
+ *
+ * This is called from the GEM interrupt, or from the function driving the
+ * engine, once the last operation of a script given to
+ * _MSS_MAC_mdio_submit()_ is done.
+ */
+typedef void (*mss_mac_mdio_done_t)(/* mss_mac_instance_t*/ void *this_mac,
+                                    mss_mac_mdio_op_t *ops,
+                                    uint32_t count);
+#endif
+
+#if defined(MSS_MAC_ASYNC_LINK)
+/***************************************************************************//**
+ * Steps of the link bring-up made by _MSS_MAC_link_poll()_.
+ */
+typedef enum __mss_mac_link_state_t
+{
+    MSS_MAC_LINK_PLL_WAIT,      /*!< Waiting for the SGMII PLL to lock */
+    MSS_MAC_LINK_PHY_START,     /*!< Setting the PHY speed and starting autonegotiation */
+    MSS_MAC_LINK_PHY_AN,        /*!< Waiting for the PHY autonegotiation */
+    MSS_MAC_LINK_PCS_START,     /*!< Waiting for the copper link to start SGMII autonegotiation */
+    MSS_MAC_LINK_PCS_AN,        /*!< Waiting for the SGMII autonegotiation */
+    MSS_MAC_LINK_READY          /*!< Bring-up done and the MAC set to the negotiated speed */
+} mss_mac_link_state_t;
+#endif
 
 /***************************************************************************//**
  * G5SoC Ethernet MAC instance
@@ -1296,9 +1883,12 @@ typedef struct mss_mac_instance
 
     mss_mac_queue_t   queue[MSS_MAC_QUEUE_COUNT]; /*!< Queue specific information */
 
-    volatile uint64_t tx_pause; /*!< Count of pause frames sent */
-    volatile uint64_t rx_pause; /*!< Count of pause frames received */
-    volatile uint64_t pause_elapsed; /*!< Count of pause frame elapsed events */
+    mss_stat_t tx_pause; /*!< Count of pause frames sent */
+    mss_stat_t rx_pause; /*!< Count of pause frames received */
+    mss_stat_t pause_elapsed; /*!< Count of pause frame elapsed events */
+#if defined(MSS_MAC_PERF_STATS)
+    mss_stat_t        hw_stats[MSS_MAC_LAST_STAT]; /*!< Running totals of GEM statistics for _MSS_MAC_get_stats()_ */
+#endif
 
     uint32_t          rx_discard; /*!< Flag for discarding all received data */
     volatile uint32_t mac_available; /*!< Flag to show init is done and MAC and PHY can be used */
@@ -1340,6 +1930,44 @@ typedef struct mss_mac_instance
     mss_mac_phy_extended_read_t   phy_extended_read;     /*!< Pointer to PHY extended read function */
     mss_mac_phy_extended_write_t  phy_extended_write;    /*!< Pointer to PHY extended write function */
 #endif
+#if defined(MSS_MAC_FLOW_STEERING)
+    /* Flow steering state */
+    uint8_t  flow_table[MSS_MAC_FLOW_TABLE_SIZE]; /*!< Hash to queue indirection table */
+    uint32_t flow_t1_used;              /*!< Bit map of Type 1 screeners allocated to flows */
+    uint32_t flow_t2_used;              /*!< Bit map of Type 2 screeners allocated to flows */
+    uint32_t flow_compare_used;         /*!< Bit map of Type 2 comparers allocated to flows */
+    uint32_t flow_t2_compares[MSS_MAC_TYPE_2_SCREENERS]; /*!< Comparers used by each Type 2 screener */
+    uint32_t flow_t2_ethertype[MSS_MAC_TYPE_2_SCREENERS]; /*!< Ethertype register used by each Type 2 screener */
+    uint32_t flow_ethertype_refs[MSS_MAC_TYPE_2_ETHERTYPES]; /*!< Screeners sharing each Ethertype register */
+    uint16_t flow_ethertypes[MSS_MAC_TYPE_2_ETHERTYPES]; /*!< Value programmed in each Ethertype register */
+    uint32_t queue_hart[MSS_MAC_QUEUE_COUNT]; /*!< Hart each queue interrupt is routed to */
+#endif
+#if defined(MSS_MAC_MDIO_QUEUE)
+    /* Queued MDIO engine state, used in the MAC driving the MDIO interface */
+    mss_mac_mdio_op_t  *mdio_ops;       /*!< Script being run */
+    uint32_t            mdio_count;     /*!< Operations in the script */
+    uint32_t            mdio_next;      /*!< Operation in progress */
+    uint32_t            mdio_writing;   /*!< Non 0 when the write of a modify is in progress */
+    mss_mac_mdio_done_t mdio_done;      /*!< Completion callback */
+    volatile uint32_t   mdio_busy;      /*!< Non 0 while a script is running */
+#endif
+#if defined(MSS_MAC_ASYNC_LINK)
+    volatile mss_mac_link_state_t link_state; /*!< Current step of the link bring-up */
+    uint32_t link_polls;                /*!< Calls to _MSS_MAC_link_poll()_ made in the current step */
+#endif
+#if defined(MSS_MAC_TSN)
+    /* TSN traffic class state, used in the pMAC */
+    uint8_t  tsn_express[MSS_MAC_TSN_PCP_COUNT]; /*!< Non 0 if the PCP is sent on the eMAC */
+    uint8_t  tsn_queue[MSS_MAC_TSN_PCP_COUNT];   /*!< pMAC queue of the PCP */
+    mss_mac_tsn_stats_t tsn_stats;      /*!< Running TSN statistics */
+#endif
+#if defined(MSS_MAC_MCAST_FILTER)
+    mss_mac_mcast_entry_t mcast[MSS_MAC_MCAST_LIST_SIZE]; /*!< Multicast addresses joined, in join order */
+    uint32_t mcast_count;               /*!< Entries in use in mcast[] */
+#endif
+#if defined(MSS_MAC_CAPTURE)
+    mss_mac_capture_t * volatile capture; /*!< Capture ring in use, NULL when not capturing */
+#endif
 
 } mss_mac_instance_t;
 
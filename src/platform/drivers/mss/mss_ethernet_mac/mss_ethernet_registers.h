@@ -22,9 +22,15 @@ extern "C" {
 /*----------------------------------------------------------------------------*/
 /*----------------------------------- MAC -----------------------------------*/
 /*----------------------------------------------------------------------------*/
+#ifndef __I
 #define __I  const volatile
+#endif
+#ifndef __O
 #define __O  volatile
+#endif
+#ifndef __IO
 #define __IO volatile
+#endif
 
 typedef struct
 {
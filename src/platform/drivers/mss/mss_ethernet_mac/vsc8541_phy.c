@@ -168,6 +168,22 @@ void MSS_MAC_VSC8541_phy_init(/* mss_mac_instance_t */ const void *v_this_mac, u
         temp_reg = MSS_MAC_read_phy_reg(this_mac, phy_addr, 0);
     } while(0 != (temp_reg & 0x8000U));
 
+#if defined(MSS_MAC_MDIO_QUEUE)
+    {
+        /* The same settings as below, run back to back as one script */
+        mss_mac_mdio_op_t script[] =
+        {
+            {MSS_MAC_MDIO_WRITE,  phy_addr, MII_BMCR,      0x0000U, (uint16_t)(BMCR_ANENABLE | BMCR_FULLDPLX | BMCR_SPEED1000)},
+            {MSS_MAC_MDIO_WRITE,  phy_addr, MII_ADVERTISE, 0x0000U, (uint16_t)(ADVERTISE_FULL)},
+            {MSS_MAC_MDIO_WRITE,  phy_addr, MII_CTRL1000,  0x0000U, (uint16_t)(ADVERTISE_1000FULL)},
+            {MSS_MAC_MDIO_WRITE,  phy_addr, 31U,           0x0000U, 0x0002U},
+            {MSS_MAC_MDIO_MODIFY, phy_addr, 27U,           0x00E0U, 0x0080U},
+            {MSS_MAC_MDIO_WRITE,  phy_addr, 31U,           0x0000U, 0x0000U}
+        };
+
+        MSS_MAC_mdio_run((mss_mac_instance_t *)this_mac, script, (uint32_t)(sizeof(script) / sizeof(script[0])));
+    }
+#else
     /* Full duplex, autonegotiation and 1000Mbps as starting point */
     MSS_MAC_write_phy_reg(this_mac, phy_addr, MII_BMCR, (uint16_t)(BMCR_ANENABLE | BMCR_FULLDPLX | BMCR_SPEED1000));
 
@@ -189,6 +205,7 @@ void MSS_MAC_VSC8541_phy_init(/* mss_mac_instance_t */ const void *v_this_mac, u
 
     /* Select page 0 */
     MSS_MAC_write_phy_reg(this_mac, phy_addr, 31, 0x0000U);
+#endif
 
     #if 0
     /* Auto MDI/MDI-X, Do not ignore advertised ability, disable CLKOUT */
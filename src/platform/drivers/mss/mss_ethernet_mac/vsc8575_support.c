@@ -414,14 +414,8 @@ int32_t usleep(uint32_t usecs)
 
     vTaskDelay(usecs);
 #else
-    /* Assumes 1mS tick... */
-    volatile uint64_t timeout = g_tick_counter + (((uint64_t)usecs + 999ULL) / 1000ULL);
-    volatile uint64_t index = 0U;
-
-    while(g_tick_counter <= timeout)
-    {
-        index++; /* Stop debugger from locking up... */
-    }
+    /* No tick needed, the hart waits in wfi on its own timer */
+    mss_idle_sleep_us((uint64_t)usecs);
 #endif
 
     return(0);
@@ -449,6 +449,183 @@ void MSS_GPIO_clear_irq
     }
 }
 
+/*-------------------------------------------------------------------------*//**
+ * MSS_GPIO_snapshot_inputs
+ * See "mss_gpio.h" for details of how to use this function.
+ */
+uint64_t MSS_GPIO_snapshot_inputs
+(
+    GPIO_TypeDef * const gpio[],
+    uint32_t count,
+    uint32_t inputs[]
+)
+{
+    uint64_t psr = disable_interrupts();
+    uint64_t now = readmtime();
+    uint32_t inc;
+
+    for (inc = 0u; inc < count; inc++)
+    {
+        inputs[inc] = gpio[inc]->GPIO_IN;
+    }
+
+    restore_interrupts(psr);
+
+    return now;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_GPIO_update_outputs_multi
+ * See "mss_gpio.h" for details of how to use this function.
+ */
+void MSS_GPIO_update_outputs_multi
+(
+    GPIO_TypeDef * const gpio[],
+    uint32_t count,
+    const uint32_t mask[],
+    const uint32_t value[]
+)
+{
+    uint64_t psr = disable_interrupts();
+    uint32_t inc;
+
+    for (inc = 0u; inc < count; inc++)
+    {
+        MSS_GPIO_update_outputs(gpio[inc], mask[inc], value[inc]);
+    }
+
+    restore_interrupts(psr);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_GPIO_capture_start
+ * See "mss_gpio.h" for details of how to use this function.
+ */
+void MSS_GPIO_capture_start
+(
+    mss_gpio_capture_t * capture,
+    GPIO_TypeDef * gpio,
+    uint32_t mask,
+    mss_gpio_edge_t * ring,
+    uint32_t size
+)
+{
+    uint32_t inc;
+
+    ASSERT((0u != size) && (0u == (size & (size - 1u))));
+
+    capture->gpio = gpio;
+    capture->mask = mask;
+    capture->ring = ring;
+    capture->size = size;
+    capture->head = 0u;
+    capture->tail = 0u;
+    capture->dropped = 0u;
+
+    /* Clear edges seen before the start */
+    gpio->GPIO_IRQ = mask;
+    __asm("fence");
+
+    for (inc = 0u; inc < 32u; inc++)
+    {
+        if (0u != (mask & ((uint32_t)1 << inc)))
+        {
+            gpio->GPIO_CFG[inc] |= GPIO_INT_ENABLE_MASK;
+        }
+    }
+
+    MSS_GPIO_enable_nondirect_irq(gpio);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_GPIO_capture_stop
+ * See "mss_gpio.h" for details of how to use this function.
+ */
+void MSS_GPIO_capture_stop
+(
+    mss_gpio_capture_t * capture
+)
+{
+    uint32_t inc;
+
+    MSS_GPIO_disable_nondirect_irq(capture->gpio);
+
+    for (inc = 0u; inc < 32u; inc++)
+    {
+        if (0u != (capture->mask & ((uint32_t)1 << inc)))
+        {
+            capture->gpio->GPIO_CFG[inc] &= ~GPIO_INT_ENABLE_MASK;
+        }
+    }
+
+    capture->gpio->GPIO_IRQ = capture->mask;
+    __asm("fence");
+}
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_GPIO_capture_isr
+ * See "mss_gpio.h" for details of how to use this function.
+ */
+void MSS_GPIO_capture_isr
+(
+    mss_gpio_capture_t * capture
+)
+{
+    uint64_t now = readmtime();
+    uint32_t edges = capture->gpio->GPIO_IRQ & capture->mask;
+    uint32_t inputs = capture->gpio->GPIO_IN;
+    uint32_t head = capture->head;
+    mss_gpio_edge_t * entry;
+
+    /* All the edges pending are cleared with one write */
+    capture->gpio->GPIO_IRQ = edges;
+    __asm("fence");
+
+    if (0u != edges)
+    {
+        if ((head - __atomic_load_n(&capture->tail, __ATOMIC_ACQUIRE)) <
+            capture->size)
+        {
+            entry = &capture->ring[head & (capture->size - 1u)];
+            entry->mtime = now;
+            entry->edges = edges;
+            entry->inputs = inputs;
+
+            /* Publish the entry before the new head */
+            __atomic_store_n(&capture->head, head + 1u, __ATOMIC_RELEASE);
+        }
+        else
+        {
+            capture->dropped++;
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_GPIO_capture_read
+ * See "mss_gpio.h" for details of how to use this function.
+ */
+uint8_t MSS_GPIO_capture_read
+(
+    mss_gpio_capture_t * capture,
+    mss_gpio_edge_t * edge
+)
+{
+    uint32_t tail = capture->tail;
+    uint8_t ret_val = 0u;
+
+    if (tail != __atomic_load_n(&capture->head, __ATOMIC_ACQUIRE))
+    {
+        *edge = capture->ring[tail & (capture->size - 1u)];
+
+        /* The entry is copied before the interrupt may reuse it */
+        __atomic_store_n(&capture->tail, tail + 1u, __ATOMIC_RELEASE);
+        ret_val = 1u;
+    }
+
+    return ret_val;
+}
+
 static uint8_t gpio_number_validate(GPIO_TypeDef const * gpio, mss_gpio_id_t gpio_idx)
 {
     uint8_t ret;
@@ -122,6 +122,16 @@
     - MSS_GPIO_set_outputs()
     - MSS_GPIO_set_output()
     - MSS_GPIO_drive_inout()
+    - MSS_GPIO_update_outputs()
+    - MSS_GPIO_snapshot_inputs()
+    - MSS_GPIO_update_outputs_multi()
+  
+  MSS_GPIO_update_outputs() changes the outputs selected by a mask through the
+  GPIO_SET_BITS and GPIO_CLR_BITS registers, so it needs no read-modify-write
+  of GPIO_OUT and does not race with other harts changing other outputs of
+  the same block. MSS_GPIO_snapshot_inputs() and
+  MSS_GPIO_update_outputs_multi() read or update several GPIO blocks back to
+  back with interrupts masked, so the values of the blocks belong together.
   
   --------------------------------
   Interrupt Control
@@ -135,6 +145,32 @@
     - MSS_GPIO_enable_nondirect_irq()
     - MSS_GPIO_disable_nondirect_irq()
 
+  --------------------------------
+  Edge Capture
+  --------------------------------
+  For high rate signals, such as encoders and pulse trains, the edges of a set
+  of GPIO inputs of one block can be captured from the single non-direct
+  interrupt of the block, rather than one interrupt per edge:
+    - MSS_GPIO_capture_start()
+    - MSS_GPIO_capture_stop()
+    - MSS_GPIO_capture_isr()
+    - MSS_GPIO_capture_read()
+
+  Each non-direct interrupt reads and clears all the pending GPIO interrupts of
+  the block at once and stores them, with the mtime value and the state of the
+  inputs, as one mss_gpio_edge_t entry in a ring buffer provided by the
+  application. The ring buffer is lock free, with the interrupt handler as its
+  only writer and MSS_GPIO_capture_read() as its only reader, which may run on
+  another hart. A second edge on an input before the interrupt is handled is
+  merged with the first, so the inputs should be configured for
+  MSS_GPIO_IRQ_EDGE_BOTH and the rate of edges kept below the interrupt rate
+  the hart can sustain. Entries arriving with the ring buffer full are counted
+  and dropped.
+
+  The inputs captured must not have a direct interrupt connection on the PLIC,
+  see the table below: GPIO2 inputs with their GPIO_INTERRUPT_FAB_CR bits clear,
+  or GPIO0 and GPIO1 inputs with their bits set.
+
   The GPIO interrupts are multiplexed. Total GPIO interrupt inputs on PLIC are
   41.
 
@@ -1064,6 +1100,245 @@ void MSS_GPIO_clear_irq
     mss_gpio_id_t port_id
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_GPIO_update_outputs() function is used to set the GPIO outputs
+  selected by mask to the state of the corresponding bits of value, leaving
+  the other outputs unchanged. The outputs are set through the GPIO_SET_BITS
+  register and then cleared through the GPIO_CLR_BITS register, without
+  reading GPIO_OUT.
+
+  @param gpio
+    The gpio parameter specifies the GPIO block that needs to be configured
+
+  @param mask
+    The mask parameter selects the outputs to update, a logical OR of the
+    MSS_GPIO_n_MASK constants.
+
+  @param value
+    The value parameter holds the new state of the outputs selected by mask.
+
+  @return
+    This function does not return a value.
+
+  Example:
+    Set GPIO 2 and clear GPIO 4 without changing the other outputs.
+    @code
+      MSS_GPIO_update_outputs(GPIO2_LO, MSS_GPIO_2_MASK | MSS_GPIO_4_MASK,
+                              MSS_GPIO_2_MASK);
+    @endcode
+ */
+static inline void
+MSS_GPIO_update_outputs
+(
+    GPIO_TypeDef * gpio,
+    uint32_t mask,
+    uint32_t value
+)
+{
+    gpio->GPIO_SET_BITS = value & mask;
+    gpio->GPIO_CLR_BITS = (~value) & mask;
+}
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_GPIO_snapshot_inputs() function is used to read the inputs of several
+  GPIO blocks back to back, with interrupts masked on the calling hart.
+
+  @param gpio
+    The gpio parameter is an array of count GPIO blocks to read.
+
+  @param count
+    The count parameter specifies the number of GPIO blocks.
+
+  @param inputs
+    The inputs parameter is an array of count values receiving the state of the
+    inputs of each block, as returned by MSS_GPIO_get_inputs().
+
+  @return
+    This function returns the mtime value at the time of the reads.
+
+  Example:
+    @code
+      GPIO_TypeDef * const blocks[2] = { GPIO0_LO, GPIO2_LO };
+      uint32_t inputs[2];
+      uint64_t when;
+
+      when = MSS_GPIO_snapshot_inputs(blocks, 2u, inputs);
+    @endcode
+ */
+uint64_t MSS_GPIO_snapshot_inputs
+(
+    GPIO_TypeDef * const gpio[],
+    uint32_t count,
+    uint32_t inputs[]
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_GPIO_update_outputs_multi() function is used to update the outputs of
+  several GPIO blocks back to back, as MSS_GPIO_update_outputs() does for one
+  block, with interrupts masked on the calling hart.
+
+  @param gpio
+    The gpio parameter is an array of count GPIO blocks to update.
+
+  @param count
+    The count parameter specifies the number of GPIO blocks.
+
+  @param mask
+    The mask parameter is an array of count masks, selecting the outputs to
+    update in each block.
+
+  @param value
+    The value parameter is an array of count values, holding the new state of
+    the outputs of each block.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_GPIO_update_outputs_multi
+(
+    GPIO_TypeDef * const gpio[],
+    uint32_t count,
+    const uint32_t mask[],
+    const uint32_t value[]
+);
+
+/*-------------------------------------------------------------------------*//**
+  An entry of the edge capture ring buffer. edges holds the GPIO interrupts
+  pending when the non-direct interrupt was handled, one bit per GPIO, and
+  inputs the state of the inputs of the block at that time.
+ */
+typedef struct
+{
+    uint64_t mtime;
+    uint32_t edges;
+    uint32_t inputs;
+} mss_gpio_edge_t;
+
+/*-------------------------------------------------------------------------*//**
+  Edge capture state of one GPIO block, provided by the application and set up
+  by MSS_GPIO_capture_start().
+ */
+typedef struct
+{
+    GPIO_TypeDef * gpio;
+    uint32_t mask;
+    mss_gpio_edge_t * ring;
+    uint32_t size;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t dropped;
+} mss_gpio_capture_t;
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_GPIO_capture_start() function is used to start capturing the edges
+  of the GPIO inputs selected by mask, which must already be configured as
+  inputs with an edge interrupt mode using MSS_GPIO_config(). It enables the
+  interrupts of the inputs in the GPIO block and the non-direct interrupt of
+  the block on the PLIC, but not their direct interrupts.
+
+  @param capture
+    The capture parameter specifies the edge capture state to set up.
+
+  @param gpio
+    The gpio parameter specifies the GPIO block.
+
+  @param mask
+    The mask parameter selects the inputs to capture, a logical OR of the
+    MSS_GPIO_n_MASK constants.
+
+  @param ring
+    The ring parameter is the ring buffer the edges are stored in.
+
+  @param size
+    The size parameter specifies the number of entries of the ring buffer. It
+    must be a power of two.
+
+  @return
+    This function does not return a value.
+
+  Example:
+    Capture the edges of a quadrature encoder on GPIO2 inputs 4 and 5.
+    @code
+      static mss_gpio_capture_t g_encoder;
+      static mss_gpio_edge_t g_encoder_ring[256];
+
+      uint8_t gpio2_non_direct_plic_IRQHandler(void)
+      {
+          MSS_GPIO_capture_isr(&g_encoder);
+          return EXT_IRQ_KEEP_ENABLED;
+      }
+
+      MSS_GPIO_config(GPIO2_LO, MSS_GPIO_4, MSS_GPIO_INPUT_MODE |
+                      MSS_GPIO_IRQ_EDGE_BOTH);
+      MSS_GPIO_config(GPIO2_LO, MSS_GPIO_5, MSS_GPIO_INPUT_MODE |
+                      MSS_GPIO_IRQ_EDGE_BOTH);
+      MSS_GPIO_capture_start(&g_encoder, GPIO2_LO,
+                             MSS_GPIO_4_MASK | MSS_GPIO_5_MASK,
+                             g_encoder_ring, 256u);
+    @endcode
+ */
+void MSS_GPIO_capture_start
+(
+    mss_gpio_capture_t * capture,
+    GPIO_TypeDef * gpio,
+    uint32_t mask,
+    mss_gpio_edge_t * ring,
+    uint32_t size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_GPIO_capture_stop() function is used to stop capturing edges. It
+  disables the interrupts of the inputs captured and the non-direct interrupt
+  of the block. Entries still in the ring buffer can be read.
+
+  @param capture
+    The capture parameter specifies the edge capture state.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_GPIO_capture_stop
+(
+    mss_gpio_capture_t * capture
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_GPIO_capture_isr() function must be called from the non-direct
+  interrupt handler of the GPIO block, e.g. gpio2_non_direct_plic_IRQHandler().
+  It clears the pending interrupts of the inputs captured and stores them in
+  the ring buffer.
+
+  @param capture
+    The capture parameter specifies the edge capture state.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_GPIO_capture_isr
+(
+    mss_gpio_capture_t * capture
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_GPIO_capture_read() function is used to take the oldest entry from
+  the ring buffer.
+
+  @param capture
+    The capture parameter specifies the edge capture state.
+
+  @param edge
+    The edge parameter receives the entry.
+
+  @return
+    This function returns 1 if an entry was taken, 0 if the ring buffer is
+    empty.
+ */
+uint8_t MSS_GPIO_capture_read
+(
+    mss_gpio_capture_t * capture,
+    mss_gpio_edge_t * edge
+);
+
 #ifdef __cplusplus
 }
 #endif
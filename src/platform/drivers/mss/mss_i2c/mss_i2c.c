@@ -83,6 +83,9 @@ uint8_t g_i2c_axi_pos = 0x0u;
 static void mss_i2c_isr( mss_i2c_instance_t * this_i2c );
 static void enable_slave_if_required( mss_i2c_instance_t * this_i2c );
 static void global_init( mss_i2c_instance_t * this_i2c );
+static void chain_load_op( mss_i2c_instance_t * this_i2c, const mss_i2c_op_t * op );
+static uint8_t chain_advance( mss_i2c_instance_t * this_i2c );
+static void notify_waiter( mss_i2c_instance_t * this_i2c );
 
 /*------------------------------------------------------------------------------
  * I2C instances
@@ -142,6 +145,11 @@ void MSS_I2C_init
     this_i2c->hw_reg->CTRL |= ENS1_MASK; /* Set enable bit */
 
     this_i2c->transfer_completion_handler = NULL;
+    this_i2c->chain_op = NULL;
+    this_i2c->chain_handler = NULL;
+    this_i2c->wait_hook = NULL;
+    this_i2c->notify_hook = NULL;
+    this_i2c->is_waiting = 0u;
 
     restore_interrupts(primask);
 }
@@ -191,6 +199,7 @@ void MSS_I2C_write
     /* Set I2C status in progress */
     this_i2c->master_status = MSS_I2C_IN_PROGRESS;
     this_i2c->options = options;
+    this_i2c->chain_op = NULL;
 
     if (MSS_I2C_IN_PROGRESS == stat_slave)
     {
@@ -264,6 +273,7 @@ void MSS_I2C_read
     /* Set I2C status in progress */
     this_i2c->master_status = MSS_I2C_IN_PROGRESS;
     this_i2c->options = options;
+    this_i2c->chain_op = NULL;
 
     if (MSS_I2C_IN_PROGRESS == stat_slave)
     {
@@ -350,6 +360,73 @@ void MSS_I2C_write_read
         /* Set I2C status in progress */
         this_i2c->master_status = MSS_I2C_IN_PROGRESS;
         this_i2c->options = options;
+        this_i2c->chain_op = NULL;
+
+        if (MSS_I2C_IN_PROGRESS == stat_slave)
+        {
+            this_i2c->is_transaction_pending = 1u;
+        }
+        else
+        {
+            this_i2c->hw_reg->CTRL |= STA_MASK;
+        }
+
+        /*
+         * Clear interrupts if required (depends on repeated starts).
+         * Since the Bus is on hold, only then prior status needs to
+         * be cleared.
+         */
+        if (MSS_I2C_HOLD_BUS == this_i2c->bus_status)
+        {
+            this_i2c->hw_reg->CTRL &= ~SI_MASK;
+
+            stat_ctrl = this_i2c->hw_reg->STATUS;
+        }
+
+        /* Enable the interrupt. ( Re-enable) */
+        PLIC_EnableIRQ(this_i2c->irqn);
+
+        restore_interrupts(primask);
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * MSS_I2C_queue_transfer()
+ * See "mss_i2c.h" for details of how to use this function.
+ */
+void MSS_I2C_queue_transfer
+(
+    mss_i2c_instance_t * this_i2c,
+    const mss_i2c_op_t * ops,
+    mss_i2c_transfer_completion_t handler
+)
+{
+    mss_i2c_status_t stat_slave = this_i2c->slave_status;
+
+    ASSERT((this_i2c == &g_mss_i2c0_lo) || (this_i2c == &g_mss_i2c0_hi) ||
+           (this_i2c == &g_mss_i2c1_lo) || (this_i2c == &g_mss_i2c1_hi));
+    ASSERT(ops != (const mss_i2c_op_t *)0);
+
+    if (ops != (const mss_i2c_op_t *)0)
+    {
+        uint32_t primask;
+        volatile uint8_t stat_ctrl;
+
+        primask = disable_interrupts();
+
+        this_i2c->chain_handler = handler;
+        chain_load_op(this_i2c, ops);
+
+        /* Update the transaction only when there is no transaction going on 
+         * I2C. 
+         */
+        if (this_i2c->transaction == NO_TRANSACTION)
+        {
+            this_i2c->transaction = this_i2c->pending_transaction;
+        }
+
+        /* Set I2C status in progress */
+        this_i2c->master_status = MSS_I2C_IN_PROGRESS;
 
         if (MSS_I2C_IN_PROGRESS == stat_slave)
         {
@@ -409,20 +486,81 @@ mss_i2c_status_t MSS_I2C_wait_complete
 )
 {
     mss_i2c_status_t i2c_status;
+    uint32_t primask;
     
     ASSERT((this_i2c == &g_mss_i2c0_lo) || (this_i2c == &g_mss_i2c0_hi) ||
                (this_i2c == &g_mss_i2c1_lo) || (this_i2c == &g_mss_i2c1_hi));
     
-    this_i2c->master_timeout_ms = timeout_ms;
-
-    /* Run the loop until state returns I2C_FAILED  or I2C_SUCESS */
-    do {
+    if ((this_i2c->wait_hook != NULL) && (this_i2c->notify_hook != NULL))
+    {
+        /*
+         * Blocking wait. The waiting flag is raised before the status is
+         * checked so a completion in between still notifies the waiter and
+         * the wait hook returns straight away.
+         */
+        this_i2c->master_timeout_ms = MSS_I2C_NO_TIMEOUT;
+        this_i2c->is_waiting = 1u;
         i2c_status = this_i2c->master_status;
-    } while(MSS_I2C_IN_PROGRESS == i2c_status);
+
+        while (MSS_I2C_IN_PROGRESS == i2c_status)
+        {
+            if (0u == this_i2c->wait_hook(this_i2c, timeout_ms))
+            {
+                primask = disable_interrupts();
+                if (MSS_I2C_IN_PROGRESS == this_i2c->master_status)
+                {
+                    this_i2c->master_status = MSS_I2C_TIMED_OUT;
+                    this_i2c->transaction = NO_TRANSACTION;
+                    this_i2c->is_transaction_pending = (uint8_t)0;
+                    this_i2c->chain_op = NULL;
+                    this_i2c->chain_handler = NULL;
+                }
+                restore_interrupts(primask);
+            }
+
+            i2c_status = this_i2c->master_status;
+        }
+
+        this_i2c->is_waiting = 0u;
+    }
+    else
+    {
+        this_i2c->master_timeout_ms = timeout_ms;
+
+        /* Run the loop until state returns I2C_FAILED  or I2C_SUCESS */
+        do {
+            i2c_status = this_i2c->master_status;
+        } while(MSS_I2C_IN_PROGRESS == i2c_status);
+    }
 
     return i2c_status;
 }
 
+/*------------------------------------------------------------------------------
+ * MSS_I2C_set_wait_hooks()
+ * See "mss_i2c.h" for details of how to use this function.
+ */
+void MSS_I2C_set_wait_hooks
+(
+    mss_i2c_instance_t * this_i2c,
+    mss_i2c_wait_hook_t wait_hook,
+    mss_i2c_notify_hook_t notify_hook
+)
+{
+    uint32_t primask;
+
+    ASSERT((this_i2c == &g_mss_i2c0_lo) || (this_i2c == &g_mss_i2c0_hi) ||
+           (this_i2c == &g_mss_i2c1_lo) || (this_i2c == &g_mss_i2c1_hi));
+
+    primask = disable_interrupts();
+
+    this_i2c->wait_hook = wait_hook;
+    this_i2c->notify_hook = notify_hook;
+    this_i2c->is_waiting = 0u;
+
+    restore_interrupts(primask);
+}
+
 /*------------------------------------------------------------------------------
  * MSS_I2C_system_tick()
  * See "mss_i2c.h" for details of how to use this function.
@@ -447,12 +585,16 @@ void MSS_I2C_system_tick
             this_i2c->master_status = MSS_I2C_TIMED_OUT;
             this_i2c->transaction = NO_TRANSACTION;
             this_i2c->is_transaction_pending = (uint8_t)0;
+            this_i2c->chain_op = NULL;
+            this_i2c->chain_handler = NULL;
             
             /*
              * Make sure we do not incorrectly signal a timeout for subsequent
              * transactions.
              */
             this_i2c->master_timeout_ms = MSS_I2C_NO_TIMEOUT;
+
+            notify_waiter(this_i2c);
         }
     }
 }
@@ -478,10 +620,97 @@ void MSS_I2C_set_slave_tx_buffer
     this_i2c->slave_tx_buffer = tx_buffer;
     this_i2c->slave_tx_size = tx_size;
     this_i2c->slave_tx_idx = 0u;
+    this_i2c->reg_file_bank[0] = 0;
+    this_i2c->reg_file_bank[1] = 0;
     
     restore_interrupts(primask);
 }
 
+/*------------------------------------------------------------------------------
+ * MSS_I2C_set_slave_reg_file()
+ * See "mss_i2c.h" for details of how to use this function.
+ */
+void MSS_I2C_set_slave_reg_file
+(
+    mss_i2c_instance_t * this_i2c,
+    uint8_t * bank0,
+    uint8_t * bank1,
+    uint16_t size
+)
+{
+    uint32_t primask;
+
+    ASSERT((this_i2c == &g_mss_i2c0_lo) || (this_i2c == &g_mss_i2c0_hi) ||
+           (this_i2c == &g_mss_i2c1_lo) || (this_i2c == &g_mss_i2c1_hi));
+    ASSERT((bank0 != 0) && (bank1 != 0) && (bank0 != bank1));
+
+    primask = disable_interrupts();
+
+    this_i2c->reg_file_bank[0] = bank0;
+    this_i2c->reg_file_bank[1] = bank1;
+    this_i2c->reg_file_back = 1u;
+    this_i2c->reg_file_front = bank0;
+    this_i2c->slave_tx_buffer = bank0;
+    this_i2c->slave_tx_size = size;
+    this_i2c->slave_tx_idx = 0u;
+
+    restore_interrupts(primask);
+}
+
+/*------------------------------------------------------------------------------
+ * MSS_I2C_get_slave_reg_file_back()
+ * See "mss_i2c.h" for details of how to use this function.
+ */
+uint8_t * MSS_I2C_get_slave_reg_file_back
+(
+    mss_i2c_instance_t * this_i2c
+)
+{
+    const uint8_t * back;
+
+    ASSERT((this_i2c == &g_mss_i2c0_lo) || (this_i2c == &g_mss_i2c0_hi) ||
+           (this_i2c == &g_mss_i2c1_lo) || (this_i2c == &g_mss_i2c1_hi));
+
+    back = this_i2c->reg_file_bank[this_i2c->reg_file_back];
+
+    /*
+     * The ISR only ever takes the front bank, so the back bank is only in use
+     * by a read which started before the last publish.
+     */
+    if ((READ_SLAVE_TRANSACTION == this_i2c->transaction) &&
+        (back == this_i2c->slave_tx_buffer))
+    {
+        back = 0;
+    }
+
+    return ((uint8_t *)back);
+}
+
+/*------------------------------------------------------------------------------
+ * MSS_I2C_publish_slave_reg_file()
+ * See "mss_i2c.h" for details of how to use this function.
+ */
+void MSS_I2C_publish_slave_reg_file
+(
+    mss_i2c_instance_t * this_i2c
+)
+{
+    uint8_t back;
+
+    ASSERT((this_i2c == &g_mss_i2c0_lo) || (this_i2c == &g_mss_i2c0_hi) ||
+           (this_i2c == &g_mss_i2c1_lo) || (this_i2c == &g_mss_i2c1_hi));
+
+    back = this_i2c->reg_file_back;
+
+    if (0 != this_i2c->reg_file_bank[back])
+    {
+        /* Release: the bank contents are visible before the ISR takes it */
+        __atomic_store_n(&this_i2c->reg_file_front,
+                         this_i2c->reg_file_bank[back], __ATOMIC_RELEASE);
+        this_i2c->reg_file_back = back ^ 1u;
+    }
+}
+
 /*------------------------------------------------------------------------------
  * MSS_I2C_set_slave_rx_buffer()
  * See "mss_i2c.h" for details of how to use this function.
@@ -743,6 +972,10 @@ static void mss_i2c_isr
                  this_i2c->dir = READ_DIR;
                  this_i2c->hw_reg->CTRL |= STA_MASK;
             }
+            else if (chain_advance(this_i2c) != 0u)
+            {
+                ; /* Next operation of the chain started. */
+            }
             else /* Done sending. let's stop */
             {
                 /*
@@ -844,30 +1077,33 @@ static void mss_i2c_isr
         case ST_RX_DATA_NACK: /* Data byte received, NACK returned */
             /* Get the data, then send a stop condition */
             this_i2c->master_rx_buffer[this_i2c->master_rx_idx] = this_i2c->hw_reg->DATA;
-          
-            hold_bus = this_i2c->options &  MSS_I2C_HOLD_BUS; 
-
-            /* Store the information of current I2C bus status in the bus_status*/
-            this_i2c->bus_status  = hold_bus;
-            if (hold_bus == 0u)
-            { 
-                this_i2c->hw_reg->CTRL |= STO_MASK;  /*xmt stop condition */
 
-                /* Bus is released, now we can start listening to bus, if it is slave */
-                enable_slave_if_required(this_i2c);
-            }
-            else
+            if (chain_advance(this_i2c) == 0u)
             {
-                PLIC_DisableIRQ(this_i2c->irqn);
-                clear_irq = 0u;
-            }
+                hold_bus = this_i2c->options &  MSS_I2C_HOLD_BUS; 
 
-            /*
-             * Set the transaction back to NO_TRANSACTION to allow user to do 
-             * further transaction.
-             */
-            this_i2c->transaction = NO_TRANSACTION;
-            this_i2c->master_status = MSS_I2C_SUCCESS;
+                /* Store the information of current I2C bus status in the bus_status*/
+                this_i2c->bus_status  = hold_bus;
+                if (hold_bus == 0u)
+                { 
+                    this_i2c->hw_reg->CTRL |= STO_MASK;  /*xmt stop condition */
+
+                    /* Bus is released, now we can start listening to bus, if it is slave */
+                    enable_slave_if_required(this_i2c);
+                }
+                else
+                {
+                    PLIC_DisableIRQ(this_i2c->irqn);
+                    clear_irq = 0u;
+                }
+
+                /*
+                 * Set the transaction back to NO_TRANSACTION to allow user to do 
+                 * further transaction.
+                 */
+                this_i2c->transaction = NO_TRANSACTION;
+                this_i2c->master_status = MSS_I2C_SUCCESS;
+            }
             break;
         
         /*----------------------------------------------------------------------
@@ -1068,6 +1304,14 @@ static void mss_i2c_isr
                 this_i2c->transaction = READ_SLAVE_TRANSACTION;
                 this_i2c->random_read_addr = 0u;
 
+                /* Serve one snapshot of the register file for the whole read */
+                if (0 != this_i2c->reg_file_bank[0])
+                {
+                    this_i2c->slave_tx_buffer =
+                        __atomic_load_n(&this_i2c->reg_file_front,
+                                        __ATOMIC_ACQUIRE);
+                }
+
                 this_i2c->slave_status = MSS_I2C_IN_PROGRESS;
 
                 /* If Start Bit is set, clear it, but store that information 
@@ -1163,6 +1407,29 @@ static void mss_i2c_isr
             break;
     }
     
+    /*
+     * A chain of operations queued with MSS_I2C_queue_transfer() is over
+     * once the master status leaves MSS_I2C_IN_PROGRESS, either after its
+     * last operation or when one of its operations failed.
+     */
+    if ((this_i2c->chain_op != NULL) &&
+       (this_i2c->master_status != MSS_I2C_IN_PROGRESS))
+    {
+        mss_i2c_transfer_completion_t chain_handler = this_i2c->chain_handler;
+
+        this_i2c->chain_op = NULL;
+        this_i2c->chain_handler = NULL;
+        if (chain_handler)
+        {
+            chain_handler(this_i2c, this_i2c->master_status);
+        }
+    }
+
+    if (this_i2c->master_status != MSS_I2C_IN_PROGRESS)
+    {
+        notify_waiter(this_i2c);
+    }
+
     if ((this_i2c->master_status != MSS_I2C_IN_PROGRESS) &&
        (this_i2c->slave_status != MSS_I2C_IN_PROGRESS) &&
        (this_i2c->transfer_completion_handler) &&
@@ -1427,6 +1694,68 @@ void * MSS_I2C_get_user_data
     return (this_i2c->p_user_data);
 }
 
+/*------------------------------------------------------------------------------
+ * MSS_I2C_clock_notify()
+ * See "mss_i2c.h" for details of how to use this function.
+ */
+void MSS_I2C_clock_notify
+(
+    uint8_t event,
+    const mss_clk_change_t * change,
+    void * arg
+)
+{
+    /* PCLK dividers, indexed by mss_i2c_clock_divider_t */
+    static const uint32_t pclk_divider[MSS_I2C_BCLK_DIV_8] =
+        { 256u, 224u, 192u, 160u, 960u, 120u, 60u };
+    mss_i2c_instance_t * this_i2c = (mss_i2c_instance_t *)arg;
+    uint32_t primask;
+    uint8_t ctrl;
+    uint_fast16_t clock_speed;
+    uint_fast16_t best = (uint_fast16_t)MSS_I2C_PCLK_DIV_960;
+    uint_fast16_t idx;
+    uint64_t old_divider;
+
+    if (MSS_CLK_PRE_CHANGE == event)
+    {
+        while (MSS_I2C_IN_PROGRESS == MSS_I2C_get_status(this_i2c))
+        {
+            ;
+        }
+    }
+    else
+    {
+        ctrl = this_i2c->hw_reg->CTRL;
+        clock_speed = (uint_fast16_t)((((ctrl & CR2_MASK) >> CR2) << 2u) |
+                                      (((ctrl & CR1_MASK) >> CR1) << 1u) |
+                                      ((ctrl & CR0_MASK) >> CR0));
+
+        if ((uint_fast16_t)MSS_I2C_BCLK_DIV_8 != clock_speed)
+        {
+            old_divider = pclk_divider[clock_speed];
+
+            /* Smallest divider with new_pclk / divider <= old_pclk / old_divider */
+            for (idx = 0u; idx < (uint_fast16_t)MSS_I2C_BCLK_DIV_8; idx++)
+            {
+                if (((change->to.apb_hz * old_divider) <=
+                     (change->from.apb_hz * pclk_divider[idx])) &&
+                    (pclk_divider[idx] < pclk_divider[best]))
+                {
+                    best = idx;
+                }
+            }
+
+            primask = disable_interrupts();
+            this_i2c->hw_reg->CTRL = (uint8_t)((this_i2c->hw_reg->CTRL &
+                                     (uint8_t)~(CR2_MASK | CR1_MASK | CR0_MASK)) |
+                                     ((((best >> 2u) & 0x01u) << CR2) & CR2_MASK) |
+                                     ((((best >> 1u) & 0x01u) << CR1) & CR1_MASK) |
+                                     (((best & 0x01u) << CR0) & CR0_MASK));
+            restore_interrupts(primask);
+        }
+    }
+}
+
 /*******************************************************************************
  * Global initialization based on instance
  */
@@ -1475,6 +1804,96 @@ static void global_init
 
 }
 
+/*------------------------------------------------------------------------------
+ * Loads the master transfer state from one operation of a chain. The
+ * transaction type follows from the buffer sizes: a write phase followed by
+ * a read phase is a random read, otherwise a write (possibly empty) or a read.
+ */
+static void chain_load_op
+(
+    mss_i2c_instance_t * this_i2c,
+    const mss_i2c_op_t * op
+)
+{
+    this_i2c->chain_op = op;
+
+    if ((op->tx_size > 0u) && (op->rx_size > 0u))
+    {
+        this_i2c->pending_transaction = MASTER_RANDOM_READ_TRANSACTION;
+        this_i2c->dir = WRITE_DIR;
+    }
+    else if (op->rx_size > 0u)
+    {
+        this_i2c->pending_transaction = MASTER_READ_TRANSACTION;
+        this_i2c->dir = READ_DIR;
+    }
+    else
+    {
+        this_i2c->pending_transaction = MASTER_WRITE_TRANSACTION;
+        this_i2c->dir = WRITE_DIR;
+    }
+
+    this_i2c->target_addr = (uint_fast8_t)op->serial_addr << 1u;
+
+    this_i2c->master_tx_buffer = op->tx_buffer;
+    this_i2c->master_tx_size = op->tx_size;
+    this_i2c->master_tx_idx = 0u;
+
+    this_i2c->master_rx_buffer = op->rx_buffer;
+    this_i2c->master_rx_size = op->rx_size;
+    this_i2c->master_rx_idx = 0u;
+
+    this_i2c->options = op->options;
+}
+
+/*------------------------------------------------------------------------------
+ * Called from the ISR when the current operation has completed successfully.
+ * If the chain has a further operation, loads it and requests a repeated
+ * START, or a STOP followed by a START when the completed operation asked for
+ * the bus to be released, and returns 1. Returns 0 when there is no chain or
+ * the completed operation was its last one.
+ */
+static uint8_t chain_advance
+(
+    mss_i2c_instance_t * this_i2c
+)
+{
+    uint8_t started = 0u;
+    const mss_i2c_op_t * op = this_i2c->chain_op;
+
+    if ((op != NULL) && (op->next != NULL))
+    {
+        if ((op->options & MSS_I2C_HOLD_BUS) != 0u)
+        {
+            this_i2c->hw_reg->CTRL |= STA_MASK;
+        }
+        else
+        {
+            this_i2c->hw_reg->CTRL |= (uint8_t)(STO_MASK | STA_MASK);
+        }
+
+        chain_load_op(this_i2c, op->next);
+        started = 1u;
+    }
+
+    return started;
+}
+
+/*------------------------------------------------------------------------------
+ * Wakes the task blocked in MSS_I2C_wait_complete(), if there is one.
+ */
+static void notify_waiter
+(
+    mss_i2c_instance_t * this_i2c
+)
+{
+    if ((this_i2c->is_waiting != 0u) && (this_i2c->notify_hook != NULL))
+    {
+        this_i2c->is_waiting = 0u;
+        this_i2c->notify_hook(this_i2c);
+    }
+}
+
 /*------------------------------------------------------------------------------
  * External_i2c0_main_plic_IRQHandler interrupt handler
  */
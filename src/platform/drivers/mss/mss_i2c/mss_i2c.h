@@ -224,6 +224,23 @@
     can be used to set a time base for the MSS_I2C_wait_complete() function's
     time out delay.
 
+    A sequence of transfers, possibly to different slaves, can be queued in a
+    single call to MSS_I2C_queue_transfer(). The operations of the sequence
+    are described by a linked list of mss_i2c_op_t structures and are carried
+    out back-to-back from the I2C interrupt, using a repeated START between
+    operations unless an operation asks for the bus to be released. A single
+    completion handler is called at the end of the sequence, so polling a
+    bank of sensors does not need an MSS_I2C_wait_complete() between each
+    transfer.
+
+    By default MSS_I2C_wait_complete() spins until the transaction completes.
+    Under an RTOS, wait and notify hooks can be registered with
+    MSS_I2C_set_wait_hooks(). MSS_I2C_wait_complete() then blocks the calling
+    task in the wait hook, typically on a semaphore, and the I2C interrupt
+    calls the notify hook, which gives the semaphore, when the transaction
+    completes. The CPU is then free for other tasks during slow 100 kHz or
+    400 kHz transfers.
+
   --------------------------------
   Slave Operations
   --------------------------------
@@ -314,6 +331,20 @@
       to respond to I2C transactions. It must be called after the MSS I2C driver
       has been configured to respond to the required transaction types.
 
+    Double-buffered register file
+      A slave exposing values updated at run time, e.g. sensor readings, can
+      give the driver two banks of the same size with
+      MSS_I2C_set_slave_reg_file() in place of MSS_I2C_set_slave_tx_buffer().
+      The master reads one bank, the front, while the application fills the
+      other, the back, returned by MSS_I2C_get_slave_reg_file_back().
+      MSS_I2C_publish_slave_reg_file() then swaps them with a single pointer
+      store, without copying the data or disabling interrupts. The driver takes
+      the front bank at the start of each read transaction and serves that
+      bank until the transaction ends, so a master never sees a mix of two
+      updates. A bank published during a read is served from the next read.
+      MSS_I2C_get_slave_reg_file_back() returns NULL while a read started
+      before the last publish is still being served from the back bank.
+
   --------------------------------
   Mixed Master and Slave Operations
   --------------------------------
@@ -359,6 +390,7 @@ extern "C" {
 
 #include <stddef.h>
 #include <stdint.h>
+#include "mpfs_hal/common/mss_clk_scale.h"
 
 /*-------------------------------------------------------------------------*//**
   The mss_i2c_clock_divider_t type is used to specify the divider to be applied
@@ -473,6 +505,63 @@ typedef struct mss_i2c_instance mss_i2c_instance_t ;
   */
 typedef void (*mss_i2c_transfer_completion_t)( mss_i2c_instance_t *instance, mss_i2c_status_t status);
 
+/*-------------------------------------------------------------------------*//**
+  The mss_i2c_op_t type describes one operation of a sequence queued with
+  MSS_I2C_queue_transfer().
+  
+  serial_addr:
+    Serial address of the target I2C device.
+    
+  tx_buffer, tx_size:
+    Data written to the slave. A tx_size of zero with a rx_size of zero
+    addresses the slave without transferring data.
+    
+  rx_buffer, rx_size:
+    Buffer for the data read from the slave. When both tx_size and rx_size are
+    non-zero the operation is a write-read: the write phase is followed by a
+    repeated START and the read phase, as with MSS_I2C_write_read().
+    
+  options:
+    MSS_I2C_HOLD_BUS causes the next operation to start with a repeated START.
+    MSS_I2C_RELEASE_BUS causes a STOP to be sent before the next operation, for
+    slaves which need a STOP to act on a command. On the last operation the
+    options have the same meaning as for MSS_I2C_write().
+    
+  next:
+    Next operation of the sequence, or NULL for the last one.
+    
+  The operations and their buffers must remain valid until the sequence has
+  completed.
+ */
+typedef struct mss_i2c_op
+{
+    uint8_t serial_addr;
+    const uint8_t * tx_buffer;
+    uint16_t tx_size;
+    uint8_t * rx_buffer;
+    uint16_t rx_size;
+    uint8_t options;
+    const struct mss_i2c_op * next;
+} mss_i2c_op_t;
+
+/*-------------------------------------------------------------------------*//**
+  Wait and notify hook functions prototypes.
+  These are registered with MSS_I2C_set_wait_hooks().
+  
+  The wait hook is called by MSS_I2C_wait_complete() from the waiting task. It
+  must block until the notify hook is called for the same instance or until
+  timeout_ms milliseconds have passed, MSS_I2C_NO_TIMEOUT meaning no time
+  limit. It returns 1 when it was woken by the notify hook and 0 when the time
+  out expired, in which case the transaction is marked MSS_I2C_TIMED_OUT.
+  
+  The notify hook is called from the I2C interrupt, or from
+  MSS_I2C_system_tick() when it times the transaction out, once the master
+  transaction a task is waiting for is over. It must only use interrupt safe
+  RTOS calls.
+ */
+typedef uint8_t (*mss_i2c_wait_hook_t)( mss_i2c_instance_t *instance, uint32_t timeout_ms);
+typedef void (*mss_i2c_notify_hook_t)( mss_i2c_instance_t *instance);
+
 /*-------------------------------------------------------------------------*//**
   Slave write handler functions prototype.
   ------------------------------------------------------------------------------ 
@@ -593,6 +682,11 @@ struct mss_i2c_instance
     const uint8_t * slave_tx_buffer;
     uint_fast16_t slave_tx_size;
     uint_fast16_t slave_tx_idx;
+
+    /* Slave register file: banks, front bank published to the ISR, back bank */
+    const uint8_t * reg_file_bank[2];
+    const uint8_t * volatile reg_file_front;
+    uint8_t reg_file_back;
     
     /* Slave RX INFO */
     uint8_t * slave_rx_buffer;
@@ -610,6 +704,15 @@ struct mss_i2c_instance
     /* Transfer completion handler. */
     mss_i2c_transfer_completion_t transfer_completion_handler;
 
+    /* Queued sequence: current operation and sequence completion handler. */
+    const mss_i2c_op_t * chain_op;
+    mss_i2c_transfer_completion_t chain_handler;
+
+    /* Blocking wait hooks and waiting task flag. */
+    mss_i2c_wait_hook_t wait_hook;
+    mss_i2c_notify_hook_t notify_hook;
+    volatile uint8_t is_waiting;
+
     /* User  specific data */
     void *p_user_data ;
 
@@ -996,6 +1099,77 @@ void MSS_I2C_write_read
     uint16_t read_size,
     uint8_t options
 );
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_I2C_queue_transfer() function starts a sequence of I2C master
+  operations described by a linked list of mss_i2c_op_t structures. Each
+  operation is started from the I2C interrupt as soon as the previous one has
+  completed, with a repeated START, or with a STOP followed by a START when the
+  previous operation has the MSS_I2C_RELEASE_BUS option. The sequence stops at
+  the first operation which fails, for example because its slave does not
+  acknowledge.
+  
+  The MSS_I2C_get_status() and MSS_I2C_wait_complete() functions return
+  MSS_I2C_IN_PROGRESS until the whole sequence is over. The handler is then
+  called from the interrupt with the status of the last operation carried out,
+  before the handler registered through
+  MSS_I2C_register_transfer_completion_handler().
+  ------------------------------------------------------------------------------
+  @param this_i2c:
+    The this_i2c parameter is a pointer to an mss_i2c_instance_t structure
+    identifying the MSS I2C hardware block that will perform the requested
+    function. There are four such data structures, g_mss_i2c0_lo and
+    g_mss_i2c1_lo, associated with MSS I2C 0 and MSS I2C 1 when they are
+    connected on the AXI switch slave 5 (main APB bus) and g_mss_i2c0_hi and
+    g_mss_i2c1_hi, associated with MSS I2C 0 to MSS I2C 1 when they are
+    connected on the AXI switch slave 6 (AMP APB bus).
+    This parameter must point to one of these four global data structure
+    defined within I2C driver.
+  
+  @param ops:
+    The ops parameter is a pointer to the first operation of the sequence.
+  
+  @param handler:
+    The handler parameter is the function called when the sequence has
+    completed, or NULL.
+        
+  @return 
+    This function does not return a value.
+  
+  Example:
+  @code
+    #define PAC1934_ADDR_A   0x10u
+    #define PAC1934_ADDR_B   0x11u
+    
+    static const uint8_t vbus_reg = 0x07u;
+    static uint8_t vbus_a[8];
+    static uint8_t vbus_b[8];
+    
+    static const mss_i2c_op_t read_b =
+        { PAC1934_ADDR_B, &vbus_reg, 1u, vbus_b, 8u, MSS_I2C_RELEASE_BUS, NULL };
+    static const mss_i2c_op_t read_a =
+        { PAC1934_ADDR_A, &vbus_reg, 1u, vbus_a, 8u, MSS_I2C_HOLD_BUS, &read_b };
+    
+    void sensors_done(mss_i2c_instance_t * instance, mss_i2c_status_t status)
+    {
+        if (MSS_I2C_SUCCESS == status)
+        {
+            process_vbus(vbus_a, vbus_b);
+        }
+    }
+    
+    void poll_sensors( void )
+    {
+        MSS_I2C_queue_transfer(&g_mss_i2c0_lo, &read_a, sensors_done);
+    }
+  @endcode
+ */
+void MSS_I2C_queue_transfer
+(
+    mss_i2c_instance_t * this_i2c,
+    const mss_i2c_op_t * ops,
+    mss_i2c_transfer_completion_t handler
+);
     
 /*-------------------------------------------------------------------------*//**
   I2C status
@@ -1074,6 +1248,9 @@ mss_i2c_status_t MSS_I2C_get_status
           service routine SysTick_Handler() in your application. Otherwise
           the time out will not take effect and the MSS_I2C_wait_complete()
           function will not time out.        
+          When wait hooks are registered with MSS_I2C_set_wait_hooks(), the
+          time out is passed to the wait hook instead and
+          MSS_I2C_system_tick() is not needed.
   
   @return
     The return value indicates the outcome of the last I2C transaction. It can
@@ -1117,6 +1294,72 @@ mss_i2c_status_t MSS_I2C_wait_complete
     uint32_t timeout_ms
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_I2C_set_wait_hooks() function registers the functions used by
+  MSS_I2C_wait_complete() to block the calling task until the current master
+  transaction completes, instead of spinning on the transaction status. Both
+  hooks must be given for the blocking wait to be used; passing NULL restores
+  the spinning wait.
+  ------------------------------------------------------------------------------
+  @param this_i2c:
+    The this_i2c parameter is a pointer to an mss_i2c_instance_t structure
+    identifying the MSS I2C hardware block that will perform the requested
+    function. There are four such data structures, g_mss_i2c0_lo and
+    g_mss_i2c1_lo, associated with MSS I2C 0 and MSS I2C 1 when they are
+    connected on the AXI switch slave 5 (main APB bus) and g_mss_i2c0_hi and
+    g_mss_i2c1_hi, associated with MSS I2C 0 to MSS I2C 1 when they are
+    connected on the AXI switch slave 6 (AMP APB bus).
+    This parameter must point to one of these four global data structure
+    defined within I2C driver.
+
+  @param wait_hook:
+    Function blocking the waiting task, see mss_i2c_wait_hook_t.
+
+  @param notify_hook:
+    Function waking the waiting task, see mss_i2c_notify_hook_t.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    static SemaphoreHandle_t i2c0_done;
+
+    static uint8_t i2c0_wait(mss_i2c_instance_t * instance, uint32_t timeout_ms)
+    {
+        TickType_t ticks = portMAX_DELAY;
+
+        if (MSS_I2C_NO_TIMEOUT != timeout_ms)
+        {
+            ticks = pdMS_TO_TICKS(timeout_ms);
+        }
+
+        return (pdTRUE == xSemaphoreTake(i2c0_done, ticks)) ? 1u : 0u;
+    }
+
+    static void i2c0_notify(mss_i2c_instance_t * instance)
+    {
+        BaseType_t woken = pdFALSE;
+
+        xSemaphoreGiveFromISR(i2c0_done, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+
+    void i2c_task_init( void )
+    {
+        i2c0_done = xSemaphoreCreateBinary();
+        MSS_I2C_init(&g_mss_i2c0_lo, I2C_DUMMY_ADDR, MSS_I2C_PCLK_DIV_256);
+        MSS_I2C_set_wait_hooks(&g_mss_i2c0_lo, i2c0_wait, i2c0_notify);
+    }
+  @endcode
+ */
+void MSS_I2C_set_wait_hooks
+(
+    mss_i2c_instance_t * this_i2c,
+    mss_i2c_wait_hook_t wait_hook,
+    mss_i2c_notify_hook_t notify_hook
+);
+
 /*-------------------------------------------------------------------------*//**
   Time out delay expiration.
   ------------------------------------------------------------------------------
@@ -1243,6 +1486,121 @@ void MSS_I2C_set_slave_tx_buffer
     uint16_t tx_size
 );
 
+/*-------------------------------------------------------------------------*//**
+  I2C slave double-buffered register file configuration.
+  ------------------------------------------------------------------------------
+  This function specifies two memory buffers of the same size used in turn as
+  the data sent to the I2C master when this MSS I2C instance is the target of
+  an I2C read or write-read transaction. It is used in place of
+  MSS_I2C_set_slave_tx_buffer(). bank0 is sent first and bank1 is the back
+  bank, the one the application fills before publishing it with
+  MSS_I2C_publish_slave_reg_file(). The write-read offset set with
+  MSS_I2C_set_slave_mem_offset_length() indexes the bank being sent.
+  Calling MSS_I2C_set_slave_tx_buffer() afterwards stops the use of the
+  register file.
+  ------------------------------------------------------------------------------
+  @param this_i2c:
+    The this_i2c parameter is a pointer to an mss_i2c_instance_t structure
+    identifying the MSS I2C hardware block to be initialized. There are four
+    such data structures, g_mss_i2c0_lo and g_mss_i2c1_lo, associated with MSS
+    I2C 0 and MSS I2C 1 when they are connected on the AXI switch slave 5 (main
+    APB bus) and g_mss_i2c0_hi and g_mss_i2c1_hi, associated with MSS I2C 0 to
+    MSS I2C 1 when they are connected on the AXI switch slave 6 (AMP APB bus).
+    This parameter must point to one of these four global data structure defined
+    within I2C driver.
+
+  @param bank0:
+    The bank sent to the master until the first publish.
+
+  @param bank1:
+    The bank first returned by MSS_I2C_get_slave_reg_file_back().
+
+  @param size:
+    Size of each bank in bytes.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    #define SLAVE_SER_ADDR      0x10u
+    #define REG_FILE_SIZE       16u
+
+    uint8_t g_regs[2][REG_FILE_SIZE];
+
+    void main( void )
+    {
+        uint8_t * regs;
+
+        MSS_I2C_init( &g_mss_i2c0_lo, SLAVE_SER_ADDR, MSS_I2C_PCLK_DIV_256 );
+        MSS_I2C_set_slave_reg_file( &g_mss_i2c0_lo, g_regs[0], g_regs[1],
+                                    REG_FILE_SIZE );
+        MSS_I2C_set_slave_mem_offset_length( &g_mss_i2c0_lo, 1 );
+        MSS_I2C_enable_slave( &g_mss_i2c0_lo );
+
+        for (;;)
+        {
+            regs = MSS_I2C_get_slave_reg_file_back( &g_mss_i2c0_lo );
+            if (NULL != regs)
+            {
+                read_sensors( regs );
+                MSS_I2C_publish_slave_reg_file( &g_mss_i2c0_lo );
+            }
+        }
+    }
+  @endcode
+ */
+void MSS_I2C_set_slave_reg_file
+(
+    mss_i2c_instance_t * this_i2c,
+    uint8_t * bank0,
+    uint8_t * bank1,
+    uint16_t size
+);
+
+/*-------------------------------------------------------------------------*//**
+  I2C slave register file back bank.
+  ------------------------------------------------------------------------------
+  This function returns the bank of the register file the application may fill
+  with the next values, the one MSS_I2C_publish_slave_reg_file() will publish.
+  ------------------------------------------------------------------------------
+  @param this_i2c:
+    The this_i2c parameter is a pointer to an mss_i2c_instance_t structure
+    identifying the MSS I2C hardware block, see
+    MSS_I2C_set_slave_reg_file().
+
+  @return
+    The back bank, or NULL while a read transaction started before the last
+    publish is still sending it, or if no register file is set. The call is
+    then repeated later.
+ */
+uint8_t * MSS_I2C_get_slave_reg_file_back
+(
+    mss_i2c_instance_t * this_i2c
+);
+
+/*-------------------------------------------------------------------------*//**
+  I2C slave register file publish.
+  ------------------------------------------------------------------------------
+  This function makes the back bank, filled since it was returned by
+  MSS_I2C_get_slave_reg_file_back(), the bank sent from the next read
+  transaction on, and the bank sent until now the back bank. It is a single
+  pointer store and does not disable interrupts. A read transaction in progress
+  completes from the bank it started with.
+  ------------------------------------------------------------------------------
+  @param this_i2c:
+    The this_i2c parameter is a pointer to an mss_i2c_instance_t structure
+    identifying the MSS I2C hardware block, see
+    MSS_I2C_set_slave_reg_file().
+
+  @return
+    This function does not return a value.
+ */
+void MSS_I2C_publish_slave_reg_file
+(
+    mss_i2c_instance_t * this_i2c
+);
+
 /*-------------------------------------------------------------------------*//**
   I2C slave receive buffer configuration.
   ------------------------------------------------------------------------------
@@ -2109,6 +2467,44 @@ void MSS_I2C_register_transfer_completion_handler
     mss_i2c_transfer_completion_t completion_handler
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_I2C_clock_notify() function is the notifier through which the MSS I2C
+  driver follows the changes of the APB clock made with mss_clk_set_opp().
+  Before the change it waits for the master transaction in progress, if any,
+  to complete. After the change it selects the PCLK divider giving the fastest
+  serial clock not above the one used before the change, so that the bus
+  speed set with MSS_I2C_init() is not exceeded. The serial clock is left
+  alone when it is derived from the BCLK input, MSS_I2C_BCLK_DIV_8.
+  ------------------------------------------------------------------------------
+  @param event:
+    MSS_CLK_PRE_CHANGE or MSS_CLK_POST_CHANGE.
+
+  @param change:
+    The operating points and clock rates before and after the change.
+
+  @param arg:
+    The arg parameter is a pointer to the mss_i2c_instance_t structure of the
+    MSS I2C, given to the HAL in the mss_clk_notifier_t structure.
+
+  @return
+    This function does not return a value.
+
+  Example
+  @code
+    static mss_clk_notifier_t g_i2c1_clk = { MSS_I2C_clock_notify,
+            &g_mss_i2c1_lo, NULL };
+
+    MSS_I2C_init(&g_mss_i2c1_lo, 0x21u, MSS_I2C_PCLK_DIV_256);
+    mss_clk_register_notifier(&g_i2c1_clk);
+  @endcode
+ */
+void MSS_I2C_clock_notify
+(
+    uint8_t event,
+    const mss_clk_change_t * change,
+    void * arg
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,6 +26,7 @@ extern "C" {
 #define BYTE_MASK                       0xFFu
 #define BLK_SIZE                        512u
 #define BLOCK_COUNT_ENABLE_SHIFT        16u
+#define SDMA_BOUNDARY_SHIFT             12u
 #define BUFF_EMPTY                      0u
 #define RCA_VALUE                       0x0001u
 #define STUFF_BITS                      0x0u
@@ -42,6 +43,16 @@ extern "C" {
 #define MMC_HS400_MODE                  0x03B90300u
 #define MMC_HS_MODE_DEFAULT             0x03B90000u
 #define MMC_HPI_ENABLE                  0x03A10100u
+/* CMD0 arguments of the boot operation */
+#define MMC_PRE_IDLE_ARG                0xF0F0F0F0u
+#define MMC_BOOT_INITIATION_ARG         0xFFFFFFFAu
+/* CMD6 writes of PARTITION_CONFIG and BOOT_BUS_CONDITIONS */
+#define MMC_PARTITION_CONFIG            0x03B30000u
+#define MMC_BOOT_BUS_CONDITIONS         0x03B10000u
+#define MMC_BOOT_PARTITION_SHIFT        3u
+#define MMC_BOOT_MODE_HS_SDR            0x08u
+/* The device starts sending boot data within one second */
+#define MMC_BOOT_DATA_TIMEOUT           1000000u
 
 #define MMC_CQ_ENABLE                   0x030F0100u
 #define CQ_IDLE_TIME                    0x1000u
@@ -56,6 +67,8 @@ extern "C" {
 #define MMC_64BIT_UPPER_ADDR_SHIFT      32u
 #define MMC_SRS03_COMMAND_SHIFT         24u
 #define DELAY_COUNT                     0xFFFFu
+/* mtime ticks covering a DELAY_COUNT spin at the fastest CPU clock */
+#define DELAY_COUNT_TICKS               ((LIBERO_SETTING_MSS_RTC_TOGGLE_CLK / 1000000u) * 500u)
 #define DATA_TIMEOUT_VALUE              500000u
 #define HRS0_SOFTWARE_RESET             0x00000001u
 #define MMC_SOFTWARE_RESET_SHIFT        0x3u
@@ -66,6 +79,7 @@ extern "C" {
 #define SIZE_64KB                       0x00010000u
 #define SIZE_1GB                        0x40000000u
 
+#define EXT_CSD_BOOT_INFO_OFFSET        228u
 #define EXT_CSD_SECTOR_COUNT_OFFSET     212u
 #define EXT_CSD_CARD_TYPE_OFFSET        196u
 #define EXT_CSD_REVISION_OFFSET         192u
@@ -94,6 +108,9 @@ extern "C" {
 #define DEVICE_SUPPORT_SDR_25MHZ        0x01u
 #define DEVICE_SUPPORT_LEGACY           0x00u
 
+#define DEVICE_SUPPORT_ALT_BOOT         0x01u
+#define DEVICE_SUPPORT_HS_BOOT          0x04u
+
 #define DEVICE_STATE_MASK               0xF00u
 #define DEVICE_STATE_TRANS              0x900u
 
@@ -136,6 +153,13 @@ extern "C" {
 
 #define BYTE_3_MASK                     0xFF0000u
 #define CQ_TDLBA_ALIGN_MASK            ((1u << 10u) - 1u)
+/* Task error information register (CQRS21) fields */
+#define CQ_TERRI_RESP_VALID             0x00008000u
+#define CQ_TERRI_RESP_TASK_SHIFT        8u
+#define CQ_TERRI_DATA_VALID             0x80000000u
+#define CQ_TERRI_DATA_TASK_SHIFT        24u
+#define CQ_TERRI_TASK_MASK              0x1Fu
+#define CQ_SUBMIT_SLOTS_MASK            ((1u << MSS_MMC_CQ_MAX_TASKS) - 1u)
 
 #define CARD_INT_STATUS_MASK            0xFEu
 #define SDCARD_BUSWIDTH_MASK            0xFCu
@@ -156,6 +180,14 @@ extern "C" {
 #define SDIO_CSA_SUPPORT                0x40u
 #define SDIO_CSA_ENABLE                 0x80u
 #define SDIO_FBR_BASE_ADDR              0x100u
+#define SDIO_BLOCK_MODE                 0x08000000u
+#define SDIO_FUNCTION_SHIFT             28u
+#define SDIO_REG_ADDR_MASK              0x1FFFFu
+#define SDIO_BLOCK_COUNT_MAX            511u
+#define SDIO_FUNCTION_MAX               7u
+#define SDIO_INT_MASTER_ENABLE          0x01u
+/* R5 flags: COM_CRC_ERROR, ILLEGAL_COMMAND, ERROR, FUNCTION_NUMBER, OUT_OF_RANGE */
+#define SDIO_R5_ERROR_MASK              0xCB00u
 
 #define NULL_POINTER                    ((void *)0u)
 /*******************************************************************************
@@ -180,6 +212,12 @@ static uint32_t g_trans_dest_addr = MMC_CLEAR;
 #endif /* MSS_MMC_INTERNAL_APIS */
 
 static uint8_t g_cq_task_id = MMC_CLEAR;
+/* Task slots used by MSS_MMC_cq_submit() */
+static volatile uint32_t g_cq_slot_busy = MMC_CLEAR;
+static uint32_t g_cq_slot_pending = MMC_CLEAR;
+static volatile uint32_t g_cq_slot_error = MMC_CLEAR;
+static mss_mmc_cq_task_handler_t g_cq_slot_handler[MSS_MMC_CQ_MAX_TASKS];
+static void *g_cq_slot_user_data[MSS_MMC_CQ_MAX_TASKS];
 /******************************************************************************/
 struct mmc_trans
 {
@@ -187,6 +225,27 @@ struct mmc_trans
 };
 static struct mmc_trans g_mmc_trs_status;
 /******************************************************************************/
+struct sd_write
+{
+    /* Chunks submitted, not yet given to the SDMA */
+    const uint8_t *queue[MSS_MMC_SD_WRITE_QUEUE];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint32_t submitted;
+    volatile uint32_t done;
+    uint32_t chunks;
+    uint32_t dest;
+    uint32_t boundary;
+    volatile uint8_t active;
+    /* The SDMA is stopped at the end of a chunk, waiting for the next */
+    volatile uint8_t paused;
+};
+static struct sd_write g_sd_wr;
+static uint8_t g_mmc_card_type = MSS_MMC_CARD_TYPE_NONE;
+/* SDIO card interrupt, masked from when it is taken until acknowledged */
+static mss_mmc_sdio_int_handler_t g_sdio_card_int_handler = NULL_POINTER;
+static volatile uint8_t g_sdio_card_int_armed = MMC_CLEAR;
+/******************************************************************************/
 struct phydelayaddresses
 {
     uint8_t address;
@@ -244,6 +303,18 @@ static mss_mmc_status_t adma2_create_descriptor_table
     const uint8_t *data_src,
     uint32_t data_sz
 );
+static mss_mmc_status_t adma2_create_sg_descriptor_table
+(
+    const mss_mmc_sg_t *segments,
+    uint32_t seg_count
+);
+static mss_mmc_status_t adma2_sg_transfer
+(
+    uint8_t is_write,
+    uint32_t argument,
+    const mss_mmc_sg_t *segments,
+    uint32_t seg_count
+);
 
 static mss_mmc_status_t change_sdio_device_bus_mode(const mss_mmc_cfg_t * cfg);
 static void sdio_host_access_cccr
@@ -281,9 +352,26 @@ static mss_mmc_status_t read_tune_block
     uint8_t cmd
 );
 static mss_mmc_status_t execute_tunning_mmc(uint8_t data_width);
+static void tuning_cache_bind(const mss_mmc_cfg_t * cfg);
 static cif_response_t check_device_status(cif_response_t rsp_status);
+static void cq_submit_done(uint32_t completed);
+static void sd_write_start_chunk(void);
+static mss_mmc_status_t sdio_adma2_transfer
+(
+    uint8_t is_write,
+    uint8_t function,
+    uint32_t address,
+    uint8_t op_code,
+    uint8_t *buffer,
+    uint32_t size
+);
 
 static mss_mmc_handler_t g_transfer_complete_handler_t;
+/* Tuning record, see MSS_MMC_set_tuning_cache() */
+static mss_mmc_tuning_t *g_tuning_cache = NULL_POINTER;
+static mss_mmc_tuning_save_t g_tuning_save = NULL_POINTER;
+static uint8_t g_tuning_bound = MMC_CLEAR;
+static uint8_t g_tuning_updated = MMC_CLEAR;
 /*****************************************************************************/
 
 /*-------------------------------------------------------------------------*//**
@@ -315,7 +403,13 @@ MSS_MMC_init
     g_transfer_complete_handler_t = NULL_POINTER;
     g_mmc_init_complete = MMC_CLEAR;
     g_sdio_fun_num = MMC_CLEAR;
+    g_tuning_bound = MMC_CLEAR;
+    g_tuning_updated = MMC_CLEAR;
     g_mmc_trs_status.state = MSS_MMC_NOT_INITIALISED;
+    g_mmc_card_type = cfg->card_type;
+    g_sdio_card_int_handler = NULL_POINTER;
+    g_sdio_card_int_armed = MMC_CLEAR;
+    g_sd_wr.active = MMC_CLEAR;
     /* Set RCA default value */
     sdcard_RCA = RCA_VALUE;
     /* Reset host controller*/
@@ -710,6 +804,13 @@ MSS_MMC_init
         g_mmc_init_complete = MMC_CLEAR;
         g_mmc_trs_status.state = MSS_MMC_NOT_INITIALISED;
     }
+    /* Hand an updated tuning record to the application */
+    if ((MSS_MMC_INIT_SUCCESS == ret_status) && (g_tuning_updated == MMC_SET)
+            && (g_tuning_save != NULL_POINTER))
+    {
+        g_tuning_save(g_tuning_cache);
+    }
+    g_tuning_bound = MMC_CLEAR;
     /* Clear interrupts */
     MMC->SRS12 = ~(SRS12_CURRENT_LIMIT_ERROR
                             | SRS12_CARD_INTERRUPT
@@ -927,6 +1028,9 @@ MSS_MMC_sdma_read
                     tmp = (tmp & (~SRS10_DMA_SELECT_MASK));
                     MMC->SRS10 = (tmp | SRS10_DMA_SELECT_SDMA);
                     /* SDMA setup */
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+                    mss_l2_flush_range((uint64_t)(uintptr_t)dest, size);
+#endif
                     MMC->SRS22 = ((uint32_t)((uintptr_t)dest));
                     MMC->SRS23 = ((uint32_t)(((uint64_t)((uintptr_t)dest)) >> MMC_64BIT_UPPER_ADDR_SHIFT));
                     /* Block length and count SDMA buffer boundary */
@@ -1053,6 +1157,9 @@ MSS_MMC_adma2_read
                     mmc_delay(MASK_8BIT);
                     /* Calculate block count */
                     blockcount = ((size - MMC_SET) / blocklen) + MMC_SET;
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+                    mss_l2_flush_range((uint64_t)(uintptr_t)dest, size);
+#endif
                     /* Create ADMA2 descriptor table */
                     ret_status = adma2_create_descriptor_table(dest, size);
                     if (ret_status != MSS_MMC_INVALID_PARAMETER)
@@ -1411,6 +1518,9 @@ MSS_MMC_sdma_write
                     tmp = (tmp & (~SRS10_DMA_SELECT_MASK));
                     MMC->SRS10 = (tmp | SRS10_DMA_SELECT_SDMA);
                     /* SDMA setup */
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+                    mss_l2_flush_range((uint64_t)(uintptr_t)src, size);
+#endif
                     MMC->SRS22 = (uint32_t)(uintptr_t)src;
                     MMC->SRS23 = (uint32_t)(((uint64_t)(uintptr_t)src) >> MMC_64BIT_UPPER_ADDR_SHIFT);
                     /* Block length and count SDMA buffer boundary */
@@ -1533,6 +1643,9 @@ MSS_MMC_adma2_write
                     mmc_delay(MASK_8BIT);
                     /* Calculate block count */
                     blockcount = ((size - MMC_SET) / blocklen) + MMC_SET;
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+                    mss_l2_flush_range((uint64_t)(uintptr_t)src, size);
+#endif
                     /* ADMA2 table create */
                     ret_status = adma2_create_descriptor_table(src, size);
                     if (ret_status != MSS_MMC_INVALID_PARAMETER)
@@ -1709,6 +1822,36 @@ mss_mmc_status_t MSS_MMC_get_transfer_status(void)
 {
     return g_mmc_trs_status.state;
 }
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+uint8_t MSS_MMC_sc_read(uint8_t *buf, uint32_t sector, uint32_t count)
+{
+    mss_mmc_status_t ret_status;
+
+    ret_status = MSS_MMC_sdma_read(sector, buf, (count * BLK_SIZE));
+    while (MSS_MMC_TRANSFER_IN_PROGRESS == ret_status)
+    {
+        ret_status = MSS_MMC_get_transfer_status();
+    }
+
+    return (MSS_MMC_TRANSFER_SUCCESS == ret_status) ? MMC_CLEAR : MMC_SET;
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+uint8_t MSS_MMC_sc_write(const uint8_t *buf, uint32_t sector, uint32_t count)
+{
+    mss_mmc_status_t ret_status;
+
+    ret_status = MSS_MMC_sdma_write(buf, sector, (count * BLK_SIZE));
+    while (MSS_MMC_TRANSFER_IN_PROGRESS == ret_status)
+    {
+        ret_status = MSS_MMC_get_transfer_status();
+    }
+
+    return (MSS_MMC_TRANSFER_SUCCESS == ret_status) ? MMC_CLEAR : MMC_SET;
+}
 /*-------------------------------------------------------------------------*//**
  * See "mss_mmc.h" for details of how to use this function.
  */
@@ -1716,6 +1859,25 @@ void MSS_MMC_set_handler( mss_mmc_handler_t handler)
 {
     g_transfer_complete_handler_t = handler;
 }
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+void MSS_MMC_set_wait_hook(mss_mmc_wait_hook_t hook)
+{
+    cif_set_wait_hook(hook);
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+void MSS_MMC_set_tuning_cache
+(
+    mss_mmc_tuning_t *tuning,
+    mss_mmc_tuning_save_t save
+)
+{
+    g_tuning_cache = tuning;
+    g_tuning_save = save;
+}
 /*-------------------------------------------------------------------------*//**
  * See "mss_mmc.h" for details of how to use this function.
  */
@@ -1882,7 +2044,8 @@ MSS_MMC_cq_write
 
     if (g_mmc_cq_init_complete == MMC_SET)
     {
-        if (MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state)
+        if ((MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state) ||
+            (g_cq_slot_busy != MMC_CLEAR))
         {
             ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
         }
@@ -2021,7 +2184,8 @@ MSS_MMC_cq_read
 
     if (g_mmc_cq_init_complete == MMC_SET)
     {
-       if (MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state)
+       if ((MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state) ||
+           (g_cq_slot_busy != MMC_CLEAR))
        {
            ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
        }
@@ -2031,101 +2195,1259 @@ MSS_MMC_cq_read
             if (((size % blocklen) != MMC_CLEAR) || (size > (SIZE_1GB - (CQ_HOST_NUMBER_OF_TASKS * BLK_SIZE)))
                     || (size == MMC_CLEAR) || (dest == NULL_POINTER))
             {
-                ret_status = MSS_MMC_INVALID_PARAMETER;
+                ret_status = MSS_MMC_INVALID_PARAMETER;
+            }
+            else
+            {
+                /* Disable PCLI interrupt for MMC */
+                PLIC_DisableIRQ(MMC_main_PLIC);
+                /* Disable error/interrupt */
+                MMC->SRS14 = MMC_CLEAR;
+                /* Check MMC device is busy */
+                do
+                {
+                   response_status = cif_send_cq_direct_command(g_desc_addr,
+                                                       sdcard_RCA,
+                                                       MMC_CMD_13_SEND_STATUS,
+                                                       MSS_MMC_RESPONSE_R1,
+                                                       CQ_DCMD_TASK_ID);
+                } while (DEVICE_BUSY == response_status);
+                
+                if (TRANSFER_IF_SUCCESS == response_status)
+                {
+                    reg = MMC_CLEAR;
+                    /* Calculate block count */
+                    blockcount = ((size - MMC_SET) / blocklen) + MMC_SET;
+                    for(task_id = MMC_CLEAR; ((task_id < CQ_HOST_NUMBER_OF_TASKS) && (blockcount != MMC_CLEAR)); ++task_id)
+                    {
+                        desc_offset = CQ_HOST_NUMBER_OF_TASKS * task_id;
+                        dcmdTaskDesc = (uint32_t *)(g_desc_addr + desc_offset);
+    
+                        flags = (uint32_t)(CQ_DESC_VALID |  CQ_DESC_END | CQ_DESC_ACT_TASK | CQ_DESC_INT);
+                        flags |= CQ_DESC_SET_CONTEXT_ID(MMC_CLEAR) | CQ_DESC_DATA_DIR_READ;
+    
+                        if (blockcount > MASK_16BIT)
+                        {
+                            blk_cnt = MASK_16BIT;
+                            blockcount = blockcount - MASK_16BIT;
+                        }
+                        else
+                        {
+                            blk_cnt = blockcount;
+                            blockcount = MMC_CLEAR;
+                        }
+                        dcmdTaskDesc[MMC_CLEAR] = flags | (blk_cnt << SHIFT_16BIT);
+                        dcmdTaskDesc[BYTES_1] = argument;
+                        dcmdTaskDesc[BYTES_2] = MMC_CLEAR;
+                        dcmdTaskDesc[BYTES_3] = MMC_CLEAR;
+    
+                        if (trans_size > MASK_16BIT)
+                        {
+                            /* Data buffer size is 64KB */
+                            size = MMC_CLEAR;
+                        }
+                        else
+                        {
+                            size = trans_size;
+                        }
+                        /* Supports only 64KB */
+                        dcmdTaskDesc[BYTES_4] = (uint32_t)((CQ_DESC_VALID | CQ_DESC_ACT_TRAN |  CQ_DESC_END) | (size << SHIFT_16BIT));
+                        /* Data buffer address in host memory, lower part */
+                        dcmdTaskDesc[BYTES_5] = (uint32_t)(uintptr_t)dest;
+                        /* Data buffer address in host memory, higher part */
+                        dcmdTaskDesc[BYTES_6] = (uint32_t)(((uint64_t)(uintptr_t)dest) >> MMC_64BIT_UPPER_ADDR_SHIFT);
+                        dcmdTaskDesc[BYTES_7] = MMC_CLEAR;
+    
+                        if (trans_size > (SIZE_32MB - BLK_SIZE))
+                        {
+                            trans_size = trans_size - (SIZE_32MB - BLK_SIZE);
+                            src = src + (SIZE_32MB - - BLK_SIZE);
+                            argument = argument + blockcount;
+                        }
+                        reg |= (MMC_SET << task_id);
+                    }
+    
+                    g_cq_task_id = task_id;
+                    /* Enable interrupts */
+                    MMC->SRS14 = (SRS14_CMD_QUEUING_SIG_EN | SRS14_COMMAND_TIMEOUT_ERR_SIG_EN
+                                        | SRS14_DATA_TIMEOUT_ERR_SIG_EN);
+                    PLIC_EnableIRQ(MMC_main_PLIC);
+                    /* Set doorbell to start processing descriptors by controller */
+                    MMC->CQRS10 = reg;
+    
+                    g_mmc_trs_status.state = MSS_MMC_TRANSFER_IN_PROGRESS;
+                    ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+                }
+                else
+                {
+                    g_mmc_trs_status.state = MSS_MMC_DEVICE_ERROR;
+                    ret_status = MSS_MMC_DEVICE_ERROR;
+                }
+            }
+        }
+    }
+    else
+    {
+        ret_status = MSS_MMC_CQ_NOT_INITIALISED;
+    }
+    return ret_status;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_cq_submit
+(
+    uint8_t direction,
+    uint32_t sector,
+    uint8_t *buffer,
+    uint32_t size,
+    mss_mmc_cq_task_handler_t handler,
+    void *p_user_data,
+    uint8_t *task_id
+)
+{
+    uint32_t *dcmdTaskDesc;
+    uint32_t flags;
+    uint32_t free_slots;
+    uint8_t slot;
+    mss_mmc_status_t ret_status;
+
+    if (g_mmc_cq_init_complete != MMC_SET)
+    {
+        ret_status = MSS_MMC_CQ_NOT_INITIALISED;
+    }
+    else if ((buffer == NULL_POINTER) || (size == MMC_CLEAR)
+            || ((size % BLK_SIZE) != MMC_CLEAR)
+            || (size > MSS_MMC_CQ_MAX_TASK_SIZE)
+            || (direction > MSS_MMC_CQ_DIR_WRITE))
+    {
+        ret_status = MSS_MMC_INVALID_PARAMETER;
+    }
+    else if (MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state)
+    {
+        /* MSS_MMC_cq_write() or MSS_MMC_cq_read() in progress */
+        ret_status = MSS_MMC_TRANSFER_FAIL;
+    }
+    else
+    {
+        /* Slots are also freed from the MMC interrupt */
+        PLIC_DisableIRQ(MMC_main_PLIC);
+
+        free_slots = (~g_cq_slot_busy) & CQ_SUBMIT_SLOTS_MASK;
+        if (free_slots == MMC_CLEAR)
+        {
+            ret_status = MSS_MMC_TRANSFER_FAIL;
+        }
+        else
+        {
+            slot = MMC_CLEAR;
+            while ((free_slots & (MMC_SET << slot)) == MMC_CLEAR)
+            {
+                ++slot;
+            }
+
+            g_cq_slot_busy |= (MMC_SET << slot);
+            g_cq_slot_error &= ~(MMC_SET << slot);
+            g_cq_slot_handler[slot] = handler;
+            g_cq_slot_user_data[slot] = p_user_data;
+
+            dcmdTaskDesc = (uint32_t *)(g_desc_addr + (CQ_HOST_NUMBER_OF_TASKS * slot));
+
+            flags = (uint32_t)(CQ_DESC_VALID |  CQ_DESC_END | CQ_DESC_ACT_TASK | CQ_DESC_INT);
+            if (MSS_MMC_CQ_DIR_WRITE == direction)
+            {
+                flags |= CQ_DESC_SET_CONTEXT_ID(MMC_SET) | CQ_DESC_DATA_DIR_WRITE;
+            }
+            else
+            {
+                flags |= CQ_DESC_SET_CONTEXT_ID(MMC_CLEAR) | CQ_DESC_DATA_DIR_READ;
+            }
+
+            dcmdTaskDesc[MMC_CLEAR] = flags | CQ_DESC_SET_BLOCK_COUNT(size / BLK_SIZE);
+            dcmdTaskDesc[BYTES_1] = sector;
+            dcmdTaskDesc[BYTES_2] = MMC_CLEAR;
+            dcmdTaskDesc[BYTES_3] = MMC_CLEAR;
+            /* A data length of 0 means 64KB */
+            dcmdTaskDesc[BYTES_4] = (uint32_t)(CQ_DESC_VALID | CQ_DESC_ACT_TRAN | CQ_DESC_END) | CQ_DESC_SET_DATA_LEN(size);
+            /* Data buffer address in host memory, lower part */
+            dcmdTaskDesc[BYTES_5] = (uint32_t)(uintptr_t)buffer;
+            /* Data buffer address in host memory, higher part */
+            dcmdTaskDesc[BYTES_6] = (uint32_t)(((uint64_t)(uintptr_t)buffer) >> MMC_64BIT_UPPER_ADDR_SHIFT);
+            dcmdTaskDesc[BYTES_7] = MMC_CLEAR;
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+            mss_l2_flush_range((uint64_t)(uintptr_t)buffer, size);
+            mss_l2_flush_range((uint64_t)(uintptr_t)dcmdTaskDesc, CQ_HOST_NUMBER_OF_TASKS);
+#endif
+            g_cq_slot_pending |= (MMC_SET << slot);
+
+            if (task_id != NULL_POINTER)
+            {
+                *task_id = slot;
+            }
+            ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+        }
+
+        PLIC_EnableIRQ(MMC_main_PLIC);
+    }
+    return ret_status;
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+void MSS_MMC_cq_ring_doorbell(void)
+{
+    uint32_t pending;
+
+    PLIC_DisableIRQ(MMC_main_PLIC);
+
+    pending = g_cq_slot_pending;
+    g_cq_slot_pending = MMC_CLEAR;
+
+    if (pending != MMC_CLEAR)
+    {
+        /* Enable interrupts */
+        MMC->SRS14 = (SRS14_CMD_QUEUING_SIG_EN | SRS14_COMMAND_TIMEOUT_ERR_SIG_EN
+                            | SRS14_DATA_TIMEOUT_ERR_SIG_EN);
+        /* Descriptors must be in memory before the controller reads them */
+        mb();
+        /* Set doorbell to start processing descriptors by controller */
+        MMC->CQRS10 = pending;
+    }
+
+    PLIC_EnableIRQ(MMC_main_PLIC);
+}
+/*******************************************************************************
+ * Frees the MSS_MMC_cq_submit() task slots in completed and calls their
+ * handlers. Called from the MMC interrupt.
+ */
+static void cq_submit_done(uint32_t completed)
+{
+    mss_mmc_cq_task_handler_t handler;
+    mss_mmc_status_t status;
+    void *p_user_data;
+    uint32_t bit;
+    uint8_t slot;
+
+    for (slot = MMC_CLEAR; slot < MSS_MMC_CQ_MAX_TASKS; ++slot)
+    {
+        bit = MMC_SET << slot;
+        if ((completed & bit) != MMC_CLEAR)
+        {
+            status = ((g_cq_slot_error & bit) != MMC_CLEAR) ?
+                        MSS_MMC_TRANSFER_FAIL : MSS_MMC_TRANSFER_SUCCESS;
+            handler = g_cq_slot_handler[slot];
+            p_user_data = g_cq_slot_user_data[slot];
+
+            g_cq_slot_error &= ~bit;
+            /* Slot may be reused by the handler */
+            g_cq_slot_busy &= ~bit;
+
+            if (handler != NULL_POINTER)
+            {
+                handler(slot, status, p_user_data);
+            }
+        }
+    }
+
+    if ((g_cq_slot_busy == MMC_CLEAR) &&
+        (MSS_MMC_TRANSFER_IN_PROGRESS != g_mmc_trs_status.state))
+    {
+        /* Disable interrupts */
+        MMC->SRS14 = MMC_CLEAR;
+    }
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_adma2_write_sg
+(
+    const mss_mmc_sg_t *segments,
+    uint32_t seg_count,
+    uint32_t dest
+)
+{
+    return (adma2_sg_transfer(MMC_SET, dest, segments, seg_count));
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_adma2_read_sg
+(
+    uint32_t src,
+    const mss_mmc_sg_t *segments,
+    uint32_t seg_count
+)
+{
+    return (adma2_sg_transfer(MMC_CLEAR, src, segments, seg_count));
+}
+/*******************************************************************************
+ * Starts an ADMA2 read or write of a list of memory segments. This follows
+ * MSS_MMC_adma2_write() and MSS_MMC_adma2_read(), with the descriptor chain
+ * built from every segment.
+ */
+static mss_mmc_status_t adma2_sg_transfer
+(
+    uint8_t is_write,
+    uint32_t argument,
+    const mss_mmc_sg_t *segments,
+    uint32_t seg_count
+)
+{
+    uint32_t blockcount;
+    uint32_t size = MMC_CLEAR;
+    uint32_t seg;
+    uint32_t tmp, srs03_data, srs9;
+    uint32_t command;
+    cif_response_t response_status;
+    mss_mmc_status_t ret_status = MSS_MMC_NO_ERROR;
+
+    if (g_mmc_init_complete == MMC_SET)
+    {
+        if (MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state)
+        {
+            ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+        }
+        else
+        {
+            if ((segments == NULL_POINTER) || (seg_count == MMC_CLEAR))
+            {
+                ret_status = MSS_MMC_INVALID_PARAMETER;
+            }
+            for (seg = MMC_CLEAR; (seg < seg_count) && (ret_status == MSS_MMC_NO_ERROR); seg++)
+            {
+                if ((segments[seg].buffer == NULL_POINTER) || (segments[seg].size == MMC_CLEAR)
+                        || (segments[seg].size > (SIZE_32MB - BLK_SIZE)))
+                {
+                    ret_status = MSS_MMC_INVALID_PARAMETER;
+                }
+                else
+                {
+                    size += segments[seg].size;
+                }
+            }
+            /* Total size should be divided by 512, not greater than (32MB - 512) */
+            if ((ret_status != MSS_MMC_NO_ERROR) || ((size % BLK_SIZE) != MMC_CLEAR)
+                    || (size > (SIZE_32MB - BLK_SIZE)))
+            {
+                ret_status = MSS_MMC_INVALID_PARAMETER;
+            }
+            else
+            {
+                /* Disable PLIC interrupt for MMC */
+                PLIC_DisableIRQ(MMC_main_PLIC);
+                /* Disable error/interrupt */
+                MMC->SRS14 = MMC_CLEAR;
+                /* Check eMMC/SD device is busy */
+                do
+                {
+                    response_status = cif_send_cmd(sdcard_RCA << SHIFT_16BIT,
+                                                MMC_CMD_13_SEND_STATUS,
+                                                MSS_MMC_RESPONSE_R1);
+                } while (DEVICE_BUSY == response_status);
+
+                if (TRANSFER_IF_SUCCESS == response_status)
+                {
+                    /* Reset Data and cmd line */
+                    MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+                    mmc_delay(MASK_8BIT);
+                    /* Calculate block count */
+                    blockcount = size / BLK_SIZE;
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+                    for (seg = MMC_CLEAR; seg < seg_count; seg++)
+                    {
+                        mss_l2_flush_range((uint64_t)(uintptr_t)segments[seg].buffer,
+                                           segments[seg].size);
+                    }
+#endif
+                    /* ADMA2 table create */
+                    ret_status = adma2_create_sg_descriptor_table(segments, seg_count);
+                    if (ret_status != MSS_MMC_INVALID_PARAMETER)
+                    {
+                        /* ADMA setup */
+                        MMC->SRS22 = (uint32_t)(uintptr_t)adma_descriptor_table;
+                        MMC->SRS23 = (uint32_t)(((uint64_t)(uintptr_t)adma_descriptor_table) >> MMC_64BIT_UPPER_ADDR_SHIFT);
+                        tmp = MMC->SRS10;
+                        tmp = (tmp & (~SRS10_DMA_SELECT_MASK));
+                        MMC->SRS10 = (tmp | SRS10_DMA_SELECT_ADMA2);
+                        /* Block length and count */
+                        MMC->SRS01 = (BLK_SIZE | (blockcount << BLOCK_COUNT_ENABLE_SHIFT));
+                        /* enable interrupts */
+                        MMC->SRS14 = (SRS14_COMMAND_COMPLETE_SIG_EN | SRS14_TRANSFER_COMPLETE_SIG_EN
+                                            | SRS14_DATA_TIMEOUT_ERR_SIG_EN | SRS14_ADMA_ERROR_SIG_EN);
+                        PLIC_EnableIRQ(MMC_main_PLIC);
+                        /* Check cmd and data line busy */
+                        do
+                        {
+                            srs9 = MMC->SRS09;
+                        }while ((srs9 & (SRS9_CMD_INHIBIT_CMD | SRS9_CMD_INHIBIT_DAT)) != MMC_CLEAR);
+
+                        srs03_data = (uint32_t)(SRS3_DATA_PRESENT | SRS3_BLOCK_COUNT_ENABLE
+                                            | SRS3_RESPONSE_CHECK_TYPE_R1 | SRS3_RESP_LENGTH_48
+                                            | SRS3_CRC_CHECK_EN | SRS3_INDEX_CHECK_EN
+                                            | SRS3_DMA_ENABLE);
+                        srs03_data |= (is_write == MMC_SET) ? (uint32_t)SRS3_TRANS_DIRECT_WRITE
+                                                            : (uint32_t)SRS3_TRANS_DIRECT_READ;
+
+                        if (blockcount > MMC_SET)
+                        {
+                            /* Multi block transfer */
+                            srs03_data |= (uint32_t)SRS3_MULTI_BLOCK_SEL;
+                            g_mmc_is_multi_blk = MMC_SET;
+                            command = (is_write == MMC_SET) ? MMC_CMD_25_WRITE_MULTI_BLOCK
+                                                            : MMC_CMD_18_READ_MULTIPLE_BLOCK;
+                        }
+                        else
+                        {
+                            /* Single block transfer */
+                            g_mmc_is_multi_blk = MMC_CLEAR;
+                            command = (is_write == MMC_SET) ? MMC_CMD_24_WRITE_SINGLE_BLOCK
+                                                            : MMC_CMD_17_READ_SINGLE_BLOCK;
+                        }
+                        /* Command argument */
+                        MMC->SRS02 = argument;
+                        /* Execute command */
+                        MMC->SRS03 = (uint32_t)((command << MMC_SRS03_COMMAND_SHIFT) | srs03_data);
+
+                        g_mmc_trs_status.state = MSS_MMC_TRANSFER_IN_PROGRESS;
+                        ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+                    }
+                    else
+                    {
+                        PLIC_EnableIRQ(MMC_main_PLIC);
+                    }
+                }
+                else
+                {
+                    PLIC_EnableIRQ(MMC_main_PLIC);
+                    g_mmc_trs_status.state = MSS_MMC_DEVICE_ERROR;
+                    ret_status = MSS_MMC_DEVICE_ERROR;
+                }
+            }
+        }
+    }
+    else
+    {
+        ret_status = MSS_MMC_NOT_INITIALISED;
+    }
+
+    return (ret_status);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_sdio_adma2_write
+(
+    const uint8_t *src,
+    uint8_t function,
+    uint32_t dest,
+    uint8_t op_code,
+    uint32_t size
+)
+{
+    return (sdio_adma2_transfer(MMC_SET, function, dest, op_code, (uint8_t *)src, size));
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_sdio_adma2_read
+(
+    uint8_t function,
+    uint32_t src,
+    uint8_t op_code,
+    uint8_t *dest,
+    uint32_t size
+)
+{
+    return (sdio_adma2_transfer(MMC_CLEAR, function, src, op_code, dest, size));
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_sdio_rw_direct
+(
+    uint8_t is_write,
+    uint8_t function,
+    uint32_t reg_addr,
+    uint8_t *data
+)
+{
+    uint32_t argument;
+    uint32_t response;
+    cif_response_t response_status;
+    mss_mmc_status_t ret_status = MSS_MMC_TRANSFER_SUCCESS;
+
+    if ((g_mmc_init_complete != MMC_SET) || (MSS_MMC_CARD_TYPE_SDIO != g_mmc_card_type))
+    {
+        ret_status = MSS_MMC_NOT_INITIALISED;
+    }
+    /* cif_send_cmd() clears the status of a transfer in progress */
+    else if (MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state)
+    {
+        ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+    }
+    else if ((function > SDIO_FUNCTION_MAX) || (reg_addr > SDIO_REG_ADDR_MASK)
+            || (data == NULL_POINTER))
+    {
+        ret_status = MSS_MMC_INVALID_PARAMETER;
+    }
+    else
+    {
+        argument = ((uint32_t)function << SDIO_FUNCTION_SHIFT) | (reg_addr << SHIFT_9BIT);
+        if (is_write != MMC_CLEAR)
+        {
+            argument |= SDIO_WRITE | *data;
+        }
+        response_status = cif_send_cmd(argument, SDIO_CMD_52_IO_RW_DIRECT,
+                                        MSS_MMC_RESPONSE_R5);
+        response = MMC->SRS04;
+        if ((TRANSFER_IF_SUCCESS != response_status) ||
+            ((response & SDIO_R5_ERROR_MASK) != MMC_CLEAR))
+        {
+            ret_status = MSS_MMC_TRANSFER_FAIL;
+        }
+        else if (is_write == MMC_CLEAR)
+        {
+            *data = (uint8_t)(response & MASK_8BIT);
+        }
+        else
+        {
+            /* Written */
+        }
+    }
+    return ret_status;
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_sdio_set_card_int_handler
+(
+    mss_mmc_sdio_int_handler_t handler,
+    uint8_t function_mask
+)
+{
+    uint8_t int_enable;
+    mss_mmc_status_t ret_status;
+
+    /* Bit N for function N, bit 0 is the master enable */
+    int_enable = function_mask & CARD_INT_STATUS_MASK;
+    if (int_enable != MMC_CLEAR)
+    {
+        int_enable |= SDIO_INT_MASTER_ENABLE;
+    }
+
+    g_sdio_card_int_armed = MMC_CLEAR;
+    MMC->SRS14 &= ~SRS14_CARD_INTERRUPT_SIG_EN;
+    g_sdio_card_int_handler = handler;
+
+    ret_status = MSS_MMC_sdio_rw_direct(MMC_SET, MSS_SDIO_FUNCTION_NUMBER_0,
+                                        MSS_MMC_CCCR_INT_ENABLE, &int_enable);
+    if ((MSS_MMC_TRANSFER_SUCCESS == ret_status) && (int_enable != MMC_CLEAR)
+        && (handler != NULL_POINTER))
+    {
+        MMC->SRS13 |= SRS13_CARD_INTERRUPT_STAT_EN;
+        MSS_MMC_sdio_card_int_ack();
+        PLIC_EnableIRQ(MMC_main_PLIC);
+    }
+    return ret_status;
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+void MSS_MMC_sdio_card_int_ack(void)
+{
+    if (g_sdio_card_int_handler != NULL_POINTER)
+    {
+        g_sdio_card_int_armed = MMC_SET;
+        MMC->SRS14 |= SRS14_CARD_INTERRUPT_SIG_EN;
+    }
+}
+/******************************************************************************/
+static mss_mmc_status_t sdio_adma2_transfer
+(
+    uint8_t is_write,
+    uint8_t function,
+    uint32_t address,
+    uint8_t op_code,
+    uint8_t *buffer,
+    uint32_t size
+)
+{
+    uint32_t blockcount;
+    uint32_t argument;
+    uint32_t tmp, srs03_data, srs9;
+    mss_mmc_status_t ret_status = MSS_MMC_NO_ERROR;
+
+    if ((g_mmc_init_complete != MMC_SET) || (MSS_MMC_CARD_TYPE_SDIO != g_mmc_card_type))
+    {
+        ret_status = MSS_MMC_NOT_INITIALISED;
+    }
+    else if (MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state)
+    {
+        ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+    }
+    /* Size should be divided by 512, not greater than 511 blocks */
+    else if ((function > SDIO_FUNCTION_MAX) || (address > SDIO_REG_ADDR_MASK)
+            || ((size % BLK_SIZE) != MMC_CLEAR) || (size == MMC_CLEAR)
+            || (size > (SDIO_BLOCK_COUNT_MAX * BLK_SIZE)) || (buffer == NULL_POINTER))
+    {
+        ret_status = MSS_MMC_INVALID_PARAMETER;
+    }
+    else
+    {
+        /* Disable PLIC interrupt for MMC */
+        PLIC_DisableIRQ(MMC_main_PLIC);
+        /* Disable error/interrupt, but for the card interrupt */
+        MMC->SRS14 &= SRS14_CARD_INTERRUPT_SIG_EN;
+        /* Reset Data and cmd line */
+        MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+        mmc_delay(MASK_8BIT);
+        blockcount = size / BLK_SIZE;
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+        mss_l2_flush_range((uint64_t)(uintptr_t)buffer, size);
+#endif
+        /* Create ADMA2 descriptor table */
+        ret_status = adma2_create_descriptor_table(buffer, size);
+        if (ret_status != MSS_MMC_INVALID_PARAMETER)
+        {
+            /* ADMA setup */
+            MMC->SRS22 = (uint32_t)(uintptr_t)adma_descriptor_table;
+            MMC->SRS23 = (uint32_t)(((uint64_t)(uintptr_t)adma_descriptor_table) >> MMC_64BIT_UPPER_ADDR_SHIFT);
+            /* Select ADMA2 */
+            tmp = MMC->SRS10;
+            tmp = (tmp & (~SRS10_DMA_SELECT_MASK));
+            MMC->SRS10 = (tmp | SRS10_DMA_SELECT_ADMA2);
+            /* Block length and count */
+            MMC->SRS01 = (BLK_SIZE | (blockcount << BLOCK_COUNT_ENABLE_SHIFT));
+            /* The response is checked by the host, no CMD12 at the end */
+            g_mmc_is_multi_blk = MMC_CLEAR;
+            /* Enable interrupts */
+            MMC->SRS14 |= (SRS14_TRANSFER_COMPLETE_SIG_EN |
+                            SRS14_DATA_TIMEOUT_ERR_SIG_EN |
+                            SRS14_ADMA_ERROR_SIG_EN |
+                            SRS14_RESPONSE_ERROR_SIG_EN);
+            PLIC_EnableIRQ(MMC_main_PLIC);
+            /* Check cmd and data line busy */
+            do
+            {
+                srs9 = MMC->SRS09;
+            }while ((srs9 & (SRS9_CMD_INHIBIT_CMD | SRS9_CMD_INHIBIT_DAT)) != MMC_CLEAR);
+
+            srs03_data = (uint32_t)(SRS3_DATA_PRESENT | SRS3_MULTI_BLOCK_SEL
+                                | SRS3_BLOCK_COUNT_ENABLE
+                                | SRS3_RESP_ERR_CHECK_EN | SRS3_RESP_INTER_DISABLE
+                                | SRS3_RESPONSE_CHECK_TYPE_R5 | SRS3_RESP_LENGTH_48
+                                | SRS3_CRC_CHECK_EN | SRS3_INDEX_CHECK_EN
+                                | SRS3_DMA_ENABLE);
+            argument = ((uint32_t)function << SDIO_FUNCTION_SHIFT) | SDIO_BLOCK_MODE
+                        | (address << SHIFT_9BIT) | blockcount;
+            if (op_code != MSS_MMC_SDIO_ADDR_FIXED)
+            {
+                argument |= SDIO_OPCODE_INC;
+            }
+            if (is_write == MMC_SET)
+            {
+                srs03_data |= (uint32_t)SRS3_TRANS_DIRECT_WRITE;
+                argument |= SDIO_WRITE;
+            }
+            else
+            {
+                srs03_data |= (uint32_t)SRS3_TRANS_DIRECT_READ;
+            }
+            g_mmc_trs_status.state = MSS_MMC_TRANSFER_IN_PROGRESS;
+            /* Command argument */
+            MMC->SRS02 = argument;
+            /* Execute command */
+            MMC->SRS03 = (uint32_t)((SDIO_CMD_53_IO_RW_EXTENDED << MMC_SRS03_COMMAND_SHIFT) | srs03_data);
+            ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+        }
+        else
+        {
+            PLIC_EnableIRQ(MMC_main_PLIC);
+        }
+    }
+    return ret_status;
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_sd_write_begin
+(
+    uint32_t dest,
+    uint32_t size
+)
+{
+    uint32_t boundary;
+    uint32_t tmp;
+    cif_response_t response_status;
+    mss_mmc_status_t ret_status = MSS_MMC_NO_ERROR;
+
+    /* SDMA buffer boundary of one chunk, 4KB to 512KB */
+    boundary = MMC_CLEAR;
+    while (((SIZE_4KB << boundary) < MSS_MMC_SD_WRITE_CHUNK) && (boundary < BYTES_7))
+    {
+        boundary++;
+    }
+
+    if (g_mmc_init_complete != MMC_SET)
+    {
+        ret_status = MSS_MMC_NOT_INITIALISED;
+    }
+    else if ((MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state)
+            || (g_sd_wr.active == MMC_SET))
+    {
+        ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+    }
+    /* Size should be divided by the chunk size, not greater than 32MB */
+    else if ((MSS_MMC_CARD_TYPE_SD != g_mmc_card_type)
+            || ((SIZE_4KB << boundary) != MSS_MMC_SD_WRITE_CHUNK)
+            || ((size % MSS_MMC_SD_WRITE_CHUNK) != MMC_CLEAR) || (size == MMC_CLEAR)
+            || (size > (SIZE_32MB - MSS_MMC_SD_WRITE_CHUNK)))
+    {
+        ret_status = MSS_MMC_INVALID_PARAMETER;
+    }
+    else
+    {
+        /* Disable PLIC interrupt for MMC */
+        PLIC_DisableIRQ(MMC_main_PLIC);
+        /* Disable error/interrupt */
+        MMC->SRS14 = MMC_CLEAR;
+        /* Check SD device is busy, the only wait for the previous write */
+        do
+        {
+            response_status = cif_send_cmd(sdcard_RCA << SHIFT_16BIT,
+                                        MMC_CMD_13_SEND_STATUS,
+                                        MSS_MMC_RESPONSE_R1);
+        } while (DEVICE_BUSY == response_status);
+
+        if (TRANSFER_IF_SUCCESS == response_status)
+        {
+            /* Pre-erase the blocks about to be written */
+            response_status = cif_send_cmd(sdcard_RCA << SHIFT_16BIT,
+                                        SD_CMD_55,
+                                        MSS_MMC_RESPONSE_R1);
+            if (TRANSFER_IF_SUCCESS == response_status)
+            {
+                response_status = cif_send_cmd(size / BLK_SIZE,
+                                        SD_ACMD_23_SET_WR_BLK_ERASE_COUNT,
+                                        MSS_MMC_RESPONSE_R1);
+            }
+        }
+
+        if (TRANSFER_IF_SUCCESS == response_status)
+        {
+            /* Reset Data and cmd line */
+            MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+            mmc_delay(MASK_8BIT);
+            /* Enable SDMA */
+            tmp = MMC->SRS10;
+            tmp = (tmp & (~SRS10_DMA_SELECT_MASK));
+            MMC->SRS10 = (tmp | SRS10_DMA_SELECT_SDMA);
+
+            g_sd_wr.head = MMC_CLEAR;
+            g_sd_wr.tail = MMC_CLEAR;
+            g_sd_wr.submitted = MMC_CLEAR;
+            g_sd_wr.done = MMC_CLEAR;
+            g_sd_wr.chunks = size / MSS_MMC_SD_WRITE_CHUNK;
+            g_sd_wr.dest = dest;
+            g_sd_wr.boundary = boundary << SDMA_BOUNDARY_SHIFT;
+            g_sd_wr.paused = MMC_CLEAR;
+            g_sd_wr.active = MMC_SET;
+            g_mmc_trs_status.state = MSS_MMC_TRANSFER_IN_PROGRESS;
+        }
+        else
+        {
+            g_mmc_trs_status.state = MSS_MMC_DEVICE_ERROR;
+            ret_status = MSS_MMC_DEVICE_ERROR;
+        }
+        PLIC_EnableIRQ(MMC_main_PLIC);
+    }
+    return ret_status;
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t MSS_MMC_sd_write_submit(const uint8_t *buf)
+{
+    uint32_t srs03_data, srs9;
+    mss_mmc_status_t ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+
+    if ((g_sd_wr.active != MMC_SET) ||
+        (MSS_MMC_TRANSFER_IN_PROGRESS != g_mmc_trs_status.state))
+    {
+        ret_status = MSS_MMC_TRANSFER_FAIL;
+    }
+    else if ((buf == NULL_POINTER) || (g_sd_wr.submitted == g_sd_wr.chunks) ||
+        (((uintptr_t)buf & (MSS_MMC_SD_WRITE_CHUNK - MMC_SET)) != MMC_CLEAR))
+    {
+        ret_status = MSS_MMC_INVALID_PARAMETER;
+    }
+    else if ((g_sd_wr.head - g_sd_wr.tail) == MSS_MMC_SD_WRITE_QUEUE)
+    {
+        ret_status = MSS_MMC_SD_WRITE_QUEUE_FULL;
+    }
+    else
+    {
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+        mss_l2_flush_range((uint64_t)(uintptr_t)buf, MSS_MMC_SD_WRITE_CHUNK);
+#endif
+        if (g_sd_wr.submitted == MMC_CLEAR)
+        {
+            /* SDMA setup, stopping at the end of each chunk */
+            MMC->SRS22 = (uint32_t)(uintptr_t)buf;
+            MMC->SRS23 = (uint32_t)(((uint64_t)(uintptr_t)buf) >> MMC_64BIT_UPPER_ADDR_SHIFT);
+            /* Block length and count SDMA buffer boundary */
+            MMC->SRS01 = (BLK_SIZE | (((g_sd_wr.chunks * MSS_MMC_SD_WRITE_CHUNK) / BLK_SIZE)
+                            << BLOCK_COUNT_ENABLE_SHIFT) | g_sd_wr.boundary);
+            /* Enable interrupts */
+            MMC->SRS14 = (SRS14_COMMAND_COMPLETE_SIG_EN |
+                            SRS14_TRANSFER_COMPLETE_SIG_EN |
+                            SRS14_DMA_INTERRUPT_SIG_EN |
+                            SRS14_DATA_TIMEOUT_ERR_SIG_EN);
+            /* check data line busy */
+            do
+            {
+                srs9 = MMC->SRS09;
+            }while ((srs9 & (SRS9_CMD_INHIBIT_CMD | SRS9_CMD_INHIBIT_DAT)) != MMC_CLEAR);
+            /* DPS, Data transfer direction - write */
+            srs03_data = (uint32_t)(SRS3_DATA_PRESENT | SRS3_TRANS_DIRECT_WRITE
+                                    | SRS3_MULTI_BLOCK_SEL | SRS3_BLOCK_COUNT_ENABLE
+                                    | SRS3_RESPONSE_CHECK_TYPE_R1 | SRS3_RESP_LENGTH_48
+                                    | SRS3_CRC_CHECK_EN | SRS3_INDEX_CHECK_EN
+                                    | SRS3_DMA_ENABLE);
+            /* Multi block transfer */
+            g_mmc_is_multi_blk = MMC_SET;
+            g_sd_wr.submitted = MMC_SET;
+
+            MMC->SRS02 = g_sd_wr.dest;
+            /* Execute command */
+            MMC->SRS03 = (uint32_t)((MMC_CMD_25_WRITE_MULTI_BLOCK << MMC_SRS03_COMMAND_SHIFT) | srs03_data);
+        }
+        else
+        {
+            PLIC_DisableIRQ(MMC_main_PLIC);
+            g_sd_wr.queue[g_sd_wr.head % MSS_MMC_SD_WRITE_QUEUE] = buf;
+            g_sd_wr.head++;
+            g_sd_wr.submitted++;
+            if (g_sd_wr.paused == MMC_SET)
+            {
+                /* Restart the SDMA stopped waiting for this chunk */
+                sd_write_start_chunk();
+            }
+            PLIC_EnableIRQ(MMC_main_PLIC);
+        }
+    }
+    return ret_status;
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t MSS_MMC_sd_write_end(void)
+{
+    cif_response_t response_status;
+    mss_mmc_status_t ret_status;
+    uint32_t srs12;
+
+    if ((g_sd_wr.active == MMC_SET) && (g_sd_wr.submitted == MMC_CLEAR))
+    {
+        /* No data sent, the pre-erase count lapses with the next command */
+        g_sd_wr.active = MMC_CLEAR;
+        g_mmc_trs_status.state = MSS_MMC_TRANSFER_SUCCESS;
+    }
+    else if ((g_sd_wr.active == MMC_SET) && (g_sd_wr.submitted != g_sd_wr.chunks))
+    {
+        /* Wait for the SDMA to take every chunk submitted */
+        while ((g_sd_wr.paused == MMC_CLEAR) &&
+                (MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state))
+        {
+            (void)cif_wait();
+        }
+
+        PLIC_DisableIRQ(MMC_main_PLIC);
+        if (MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state)
+        {
+            /* Disable error/interrupt */
+            MMC->SRS14 = MMC_CLEAR;
+            /* Let the data taken reach the card, then stop the transfer */
+            MMC->SRS10 |= SRS10_STOP_AT_BLOCK_GAP;
+            do
+            {
+                srs12 = MMC->SRS12;
+            }while ((srs12 & (SRS12_TRANSFER_COMPLETE | SRS12_ERROR_INTERRUPT)) == MMC_CLEAR);
+            MMC->SRS12 = srs12;
+
+            response_status = cif_send_cmd(sdcard_RCA << SHIFT_16BIT,
+                                        MMC_CMD_12_STOP_TRANSMISSION,
+                                        MSS_MMC_RESPONSE_R1B);
+            /* Reset Data and cmd line */
+            MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+            mmc_delay(MASK_8BIT);
+            MMC->SRS10 &= ~SRS10_STOP_AT_BLOCK_GAP;
+
+            if (((srs12 & SRS12_ERROR_INTERRUPT) == MMC_CLEAR) &&
+                (TRANSFER_IF_FAIL != response_status))
+            {
+                g_mmc_trs_status.state = MSS_MMC_TRANSFER_SUCCESS;
+            }
+            else
+            {
+                g_mmc_trs_status.state = MSS_MMC_TRANSFER_FAIL;
+            }
+        }
+        g_sd_wr.active = MMC_CLEAR;
+        PLIC_EnableIRQ(MMC_main_PLIC);
+    }
+    else
+    {
+        /* Every chunk submitted, the transfer completes by itself */
+    }
+
+    ret_status = g_mmc_trs_status.state;
+
+    return ret_status;
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+uint32_t MSS_MMC_sd_write_get_done(void)
+{
+    return (g_sd_wr.done);
+}
+/******************************************************************************/
+static void sd_write_start_chunk(void)
+{
+    const uint8_t *buf;
+
+    buf = g_sd_wr.queue[g_sd_wr.tail % MSS_MMC_SD_WRITE_QUEUE];
+    g_sd_wr.tail++;
+    g_sd_wr.paused = MMC_CLEAR;
+    /* Writing the address restarts the SDMA */
+    MMC->SRS22 = (uint32_t)(uintptr_t)buf;
+    MMC->SRS23 = (uint32_t)(((uint64_t)(uintptr_t)buf) >> MMC_64BIT_UPPER_ADDR_SHIFT);
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_boot_read
+(
+    const mss_mmc_cfg_t * cfg,
+    uint8_t *dest,
+    uint32_t size
+)
+{
+    mss_mmc_status_t ret_status = MSS_MMC_NO_ERROR;
+    uint32_t reg, cap, srs10, hrs6, srs12;
+    uint32_t blockcount;
+    uint32_t max_clk_rate;
+
+    if (MSS_MMC_MODE_SDR == cfg->bus_speed_mode)
+    {
+        max_clk_rate = MSS_MMC_CLOCK_50MHZ;
+    }
+    else
+    {
+        max_clk_rate = MSS_MMC_CLOCK_26MHZ;
+    }
+
+    if (MSS_MMC_TRANSFER_IN_PROGRESS == g_mmc_trs_status.state)
+    {
+        ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+    }
+    /* Size should be divided by 512, not greater than (32MB - 512) */
+    else if ((MSS_MMC_CARD_TYPE_MMC != cfg->card_type) ||
+            ((MSS_MMC_MODE_SDR != cfg->bus_speed_mode) &&
+            (MSS_MMC_MODE_LEGACY != cfg->bus_speed_mode)) ||
+            (cfg->data_bus_width > MSS_MMC_DATA_WIDTH_8BIT) ||
+            (cfg->clk_rate > max_clk_rate) || (cfg->clk_rate == MMC_CLEAR) ||
+            ((size % BLK_SIZE) != MMC_CLEAR) || (size > (SIZE_32MB - BLK_SIZE))
+            || (size == MMC_CLEAR) || (dest == NULL_POINTER))
+    {
+        ret_status = MSS_MMC_INVALID_PARAMETER;
+    }
+    else
+    {
+        /* Reset MMC */
+        SYSREG->SOFT_RESET_CR &= ~(MMC_SET << MMC_SOFTWARE_RESET_SHIFT);
+        /* Disable MMC interrupt */
+        PLIC_DisableIRQ(MMC_main_PLIC);
+
+        /* MSS_MMC_init() is needed once the boot operation has ended */
+        g_mmc_init_complete = MMC_CLEAR;
+        g_mmc_trs_status.state = MSS_MMC_NOT_INITIALISED;
+        /* Reset host controller*/
+        MMC->HRS00 |= HRS0_SOFTWARE_RESET;
+        mmc_delay(DELAY_COUNT);
+
+        do
+        {
+           reg = MMC->HRS00;
+        }while ((reg & HRS0_SOFTWARE_RESET) != MMC_CLEAR);
+
+        /* Set de-bounce time */
+        MMC->HRS01 = DEBOUNCING_TIME;
+        /* eMMC legacy or high speed SDR mode, as the boot bus conditions */
+        hrs6 = MMC->HRS06;
+        hrs6 &= ~MSS_MMC_MODE_MASK;
+        hrs6 |= cfg->bus_speed_mode;
+        MMC->HRS06 = hrs6;
+        /* Clear error/interrupt status */
+        MMC->SRS12 = MMC_STATUS_CLEAR;
+
+        reg = MMC->SRS15;
+        cap = MMC->SRS16;
+        /* Check DMA 64 bit support */
+        if ((cap & SRS16_64BIT_SUPPORT) != MMC_CLEAR)
+        {
+            reg |= SRS15_64_BIT_ADDRESSING;
+            reg |= SRS15_HOST_4_ENABLE;
+            MMC->SRS15 = reg;
+        }
+        /* Enable error/interrupt status */
+        MMC->SRS13 = SRS13_STATUS_EN;
+        /* Disable error/interrupt */
+        MMC->SRS14 = MMC_CLEAR;
+        /* Set the 1s boot data timeout */
+        ret_status = set_data_timeout(MMC_BOOT_DATA_TIMEOUT);
+        if (MSS_MMC_NO_ERROR == ret_status)
+        {
+            /* Turn-off Host Controller Power */
+            ret_status = set_sdhost_power(MMC_CLEAR);
+        }
+        if (MSS_MMC_NO_ERROR == ret_status)
+        {
+            if (MSS_MMC_1_8V_BUS_VOLTAGE == cfg->bus_voltage)
+            {
+                ret_status = set_sdhost_power(SRS10_SET_1_8V_BUS_VOLTAGE);
+            }
+            else
+            {
+                ret_status = set_sdhost_power(SRS10_SET_3_3V_BUS_VOLTAGE);
+            }
+        }
+        if (MSS_MMC_NO_ERROR == ret_status)
+        {
+            /* Boot bus width and timing */
+            srs10 = MMC->SRS10;
+            srs10 &= ~(SRS10_DATA_WIDTH_4BIT | SRS10_EXTENDED_DATA_TRANSFER_WIDTH
+                        | SRS10_HIGH_SPEED_ENABLE);
+            if (MSS_MMC_DATA_WIDTH_8BIT == cfg->data_bus_width)
+            {
+                srs10 |= SRS10_EXTENDED_DATA_TRANSFER_WIDTH;
+            }
+            else if (MSS_MMC_DATA_WIDTH_4BIT == cfg->data_bus_width)
+            {
+                srs10 |= SRS10_DATA_WIDTH_4BIT;
+            }
+            else
+            {
+                /* 1-bit bus mode */
+            }
+            if (MSS_MMC_MODE_SDR == cfg->bus_speed_mode)
+            {
+                srs10 |= SRS10_HIGH_SPEED_ENABLE;
+            }
+            MMC->SRS10 = srs10;
+
+            if (set_host_sdclk(cfg->clk_rate) != MMC_CLEAR)
+            {
+                ret_status = MSS_MMC_BASE_CLK_IS_ZERO_ERR;
+            }
+        }
+        if (MSS_MMC_NO_ERROR == ret_status)
+        {
+            /* At least 74 clock cycles before the first command */
+            mmc_delay(DELAY_COUNT);
+            /* From pre-boot or idle to pre-idle */
+            (void)cif_send_cmd(MMC_PRE_IDLE_ARG, MMC_CMD_0_GO_IDLE_STATE,
+                                                    MSS_MMC_RESPONSE_NO_RESP);
+            mmc_delay(DELAY_COUNT);
+
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+            mss_l2_flush_range((uint64_t)(uintptr_t)dest, size);
+#endif
+            /* Create ADMA2 descriptor table */
+            ret_status = adma2_create_descriptor_table(dest, size);
+        }
+        if (MSS_MMC_NO_ERROR == ret_status)
+        {
+            /* ADMA setup */
+            MMC->SRS22 = (uint32_t)(uintptr_t)adma_descriptor_table;
+            MMC->SRS23 = (uint32_t)(((uint64_t)(uintptr_t)adma_descriptor_table) >> MMC_64BIT_UPPER_ADDR_SHIFT);
+            /* Select ADMA2 */
+            reg = MMC->SRS10;
+            reg = (reg & (~SRS10_DMA_SELECT_MASK));
+            MMC->SRS10 = (reg | SRS10_DMA_SELECT_ADMA2);
+            /* Block length and count */
+            blockcount = size / BLK_SIZE;
+            MMC->SRS01 = (BLK_SIZE | (blockcount << BLOCK_COUNT_ENABLE_SHIFT));
+            /* The transfer ends at the block count, without CMD12 */
+            g_mmc_is_multi_blk = MMC_CLEAR;
+            PLIC_EnableIRQ(MMC_main_PLIC);
+            /* Check cmd and data line busy */
+            do
+            {
+                reg = MMC->SRS09;
+            }while ((reg & (SRS9_CMD_INHIBIT_CMD | SRS9_CMD_INHIBIT_DAT)) != MMC_CLEAR);
+
+            g_mmc_trs_status.state = MSS_MMC_TRANSFER_IN_PROGRESS;
+            /* Boot initiation, the device streams the boot partition */
+            MMC->SRS02 = MMC_BOOT_INITIATION_ARG;
+            MMC->SRS03 = (uint32_t)((MMC_CMD_0_GO_IDLE_STATE << MMC_SRS03_COMMAND_SHIFT)
+                                | SRS3_DATA_PRESENT | SRS3_TRANS_DIRECT_READ
+                                | SRS3_MULTI_BLOCK_SEL | SRS3_BLOCK_COUNT_ENABLE
+                                | SRS3_NO_RESPONSE | SRS3_DMA_ENABLE);
+            /*
+             * There is no response to check, so command complete is taken
+             * here rather than by the interrupt handler.
+             */
+            do
+            {
+                srs12 = MMC->SRS12;
+            }while ((srs12 & (SRS12_COMMAND_COMPLETE | SRS12_ERROR_INTERRUPT)) == MMC_CLEAR);
+
+            if ((srs12 & SRS12_ERROR_INTERRUPT) != MMC_CLEAR)
+            {
+                MMC->SRS12 = srs12;
+                g_mmc_trs_status.state = MSS_MMC_TRANSFER_FAIL;
+                ret_status = MSS_MMC_TRANSFER_FAIL;
+            }
+            else
+            {
+                MMC->SRS12 = SRS12_COMMAND_COMPLETE;
+                /* Enable interrupts */
+                MMC->SRS14 = (SRS14_TRANSFER_COMPLETE_SIG_EN |
+                                SRS14_DATA_TIMEOUT_ERR_SIG_EN |
+                                SRS14_ADMA_ERROR_SIG_EN);
+                ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+            }
+        }
+        else
+        {
+            ret_status = MSS_MMC_INIT_FAILURE;
+        }
+    }
+    return ret_status;
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t MSS_MMC_boot_end(void)
+{
+    cif_response_t response_status;
+    mss_mmc_status_t ret_status = MSS_MMC_NO_ERROR;
+
+    /* Disable PLIC interrupt for MMC */
+    PLIC_DisableIRQ(MMC_main_PLIC);
+    /* Disable error/interrupt */
+    MMC->SRS14 = MMC_CLEAR;
+    /* Abandon any data left, then reset the device to idle */
+    MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+    mmc_delay(MASK_8BIT);
+    MMC->SRS12 = MMC_STATUS_CLEAR;
+
+    response_status = cif_send_cmd(RESET_ARG, MMC_CMD_0_GO_IDLE_STATE,
+                                                MSS_MMC_RESPONSE_NO_RESP);
+    mmc_delay(DELAY_COUNT);
+    if (TRANSFER_IF_SUCCESS != response_status)
+    {
+        ret_status = MSS_MMC_RESET_ERR;
+    }
+    g_mmc_trs_status.state = MSS_MMC_NOT_INITIALISED;
+
+    return ret_status;
+}
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_boot_config
+(
+    uint8_t partition,
+    uint8_t data_bus_width,
+    uint8_t bus_speed_mode
+)
+{
+    cif_response_t response_status;
+    mss_mmc_status_t ret_status = MSS_MMC_NO_ERROR;
+    uint32_t csd_reg[BLK_SIZE/WORD_SIZE];
+    uint8_t *pcsd_reg = NULL_POINTER;
+    uint32_t boot_bus;
+
+    if (g_mmc_init_complete != MMC_SET)
+    {
+        ret_status = MSS_MMC_NOT_INITIALISED;
+    }
+    else if ((partition > MSS_MMC_BOOT_PARTITION_2) ||
+            (data_bus_width > MSS_MMC_DATA_WIDTH_8BIT) ||
+            ((MSS_MMC_MODE_SDR != bus_speed_mode) &&
+            (MSS_MMC_MODE_LEGACY != bus_speed_mode)))
+    {
+        ret_status = MSS_MMC_INVALID_PARAMETER;
+    }
+    else
+    {
+        /* Read EXT_CSD */
+        ret_status = MSS_MMC_single_block_read(READ_SEND_EXT_CSD, csd_reg);
+        if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
+        {
+            pcsd_reg = ((uint8_t *)csd_reg);
+            if ((pcsd_reg[EXT_CSD_BOOT_INFO_OFFSET] & DEVICE_SUPPORT_ALT_BOOT) == MMC_CLEAR)
+            {
+                ret_status = MSS_MMC_DEVICE_ERROR;
+            }
+            else if ((MSS_MMC_MODE_SDR == bus_speed_mode) &&
+                ((pcsd_reg[EXT_CSD_BOOT_INFO_OFFSET] & DEVICE_SUPPORT_HS_BOOT) == MMC_CLEAR))
+            {
+                ret_status = MSS_MMC_DEVICE_NOT_SUPPORT_SDR;
             }
             else
             {
-                /* Disable PCLI interrupt for MMC */
-                PLIC_DisableIRQ(MMC_main_PLIC);
-                /* Disable error/interrupt */
-                MMC->SRS14 = MMC_CLEAR;
-                /* Check MMC device is busy */
-                do
+                boot_bus = data_bus_width;
+                if (MSS_MMC_MODE_SDR == bus_speed_mode)
                 {
-                   response_status = cif_send_cq_direct_command(g_desc_addr,
-                                                       sdcard_RCA,
-                                                       MMC_CMD_13_SEND_STATUS,
-                                                       MSS_MMC_RESPONSE_R1,
-                                                       CQ_DCMD_TASK_ID);
-                } while (DEVICE_BUSY == response_status);
-                
+                    boot_bus |= MMC_BOOT_MODE_HS_SDR;
+                }
+                response_status = cif_send_cmd(MMC_BOOT_BUS_CONDITIONS | (boot_bus << SHIFT_8BIT),
+                                                MMC_CMD_6_SWITCH,
+                                                MSS_MMC_RESPONSE_R1B);
+                if (TRANSFER_IF_FAIL != response_status)
+                {
+                    response_status = check_device_status(response_status);
+                }
                 if (TRANSFER_IF_SUCCESS == response_status)
                 {
-                    reg = MMC_CLEAR;
-                    /* Calculate block count */
-                    blockcount = ((size - MMC_SET) / blocklen) + MMC_SET;
-                    for(task_id = MMC_CLEAR; ((task_id < CQ_HOST_NUMBER_OF_TASKS) && (blockcount != MMC_CLEAR)); ++task_id)
+                    /* Boot partition enabled without boot acknowledge, user area accessed */
+                    response_status = cif_send_cmd(MMC_PARTITION_CONFIG |
+                                    ((uint32_t)partition << (MMC_BOOT_PARTITION_SHIFT + SHIFT_8BIT)),
+                                                    MMC_CMD_6_SWITCH,
+                                                    MSS_MMC_RESPONSE_R1B);
+                    if (TRANSFER_IF_FAIL != response_status)
                     {
-                        desc_offset = CQ_HOST_NUMBER_OF_TASKS * task_id;
-                        dcmdTaskDesc = (uint32_t *)(g_desc_addr + desc_offset);
-    
-                        flags = (uint32_t)(CQ_DESC_VALID |  CQ_DESC_END | CQ_DESC_ACT_TASK | CQ_DESC_INT);
-                        flags |= CQ_DESC_SET_CONTEXT_ID(MMC_CLEAR) | CQ_DESC_DATA_DIR_READ;
-    
-                        if (blockcount > MASK_16BIT)
-                        {
-                            blk_cnt = MASK_16BIT;
-                            blockcount = blockcount - MASK_16BIT;
-                        }
-                        else
-                        {
-                            blk_cnt = blockcount;
-                            blockcount = MMC_CLEAR;
-                        }
-                        dcmdTaskDesc[MMC_CLEAR] = flags | (blk_cnt << SHIFT_16BIT);
-                        dcmdTaskDesc[BYTES_1] = argument;
-                        dcmdTaskDesc[BYTES_2] = MMC_CLEAR;
-                        dcmdTaskDesc[BYTES_3] = MMC_CLEAR;
-    
-                        if (trans_size > MASK_16BIT)
-                        {
-                            /* Data buffer size is 64KB */
-                            size = MMC_CLEAR;
-                        }
-                        else
-                        {
-                            size = trans_size;
-                        }
-                        /* Supports only 64KB */
-                        dcmdTaskDesc[BYTES_4] = (uint32_t)((CQ_DESC_VALID | CQ_DESC_ACT_TRAN |  CQ_DESC_END) | (size << SHIFT_16BIT));
-                        /* Data buffer address in host memory, lower part */
-                        dcmdTaskDesc[BYTES_5] = (uint32_t)(uintptr_t)dest;
-                        /* Data buffer address in host memory, higher part */
-                        dcmdTaskDesc[BYTES_6] = (uint32_t)(((uint64_t)(uintptr_t)dest) >> MMC_64BIT_UPPER_ADDR_SHIFT);
-                        dcmdTaskDesc[BYTES_7] = MMC_CLEAR;
-    
-                        if (trans_size > (SIZE_32MB - BLK_SIZE))
-                        {
-                            trans_size = trans_size - (SIZE_32MB - BLK_SIZE);
-                            src = src + (SIZE_32MB - - BLK_SIZE);
-                            argument = argument + blockcount;
-                        }
-                        reg |= (MMC_SET << task_id);
+                        response_status = check_device_status(response_status);
                     }
-    
-                    g_cq_task_id = task_id;
-                    /* Enable interrupts */
-                    MMC->SRS14 = (SRS14_CMD_QUEUING_SIG_EN | SRS14_COMMAND_TIMEOUT_ERR_SIG_EN
-                                        | SRS14_DATA_TIMEOUT_ERR_SIG_EN);
-                    PLIC_EnableIRQ(MMC_main_PLIC);
-                    /* Set doorbell to start processing descriptors by controller */
-                    MMC->CQRS10 = reg;
-    
-                    g_mmc_trs_status.state = MSS_MMC_TRANSFER_IN_PROGRESS;
-                    ret_status = MSS_MMC_TRANSFER_IN_PROGRESS;
+                }
+                if (TRANSFER_IF_SUCCESS == response_status)
+                {
+                    ret_status = MSS_MMC_NO_ERROR;
                 }
                 else
                 {
-                    g_mmc_trs_status.state = MSS_MMC_DEVICE_ERROR;
                     ret_status = MSS_MMC_DEVICE_ERROR;
                 }
             }
         }
     }
-    else
-    {
-        ret_status = MSS_MMC_CQ_NOT_INITIALISED;
-    }
     return ret_status;
 }
 
@@ -2136,6 +3458,7 @@ uint8_t  mmc_main_plic_IRQHandler(void)
 {
     uint32_t trans_status_isr;
     uint32_t response_reg, inttoclear;
+    uint32_t task_err, err_mask;
     uintptr_t address;
     uintptr_t highaddr;
     uint64_t address64;
@@ -2143,11 +3466,26 @@ uint8_t  mmc_main_plic_IRQHandler(void)
 
     trans_status_isr = MMC->SRS12;
 
+    /* SDIO card interrupt, cleared by the card once the function is served */
+    if (((trans_status_isr & SRS12_CARD_INTERRUPT) != MMC_CLEAR) &&
+        (g_sdio_card_int_armed == MMC_SET))
+    {
+        g_sdio_card_int_armed = MMC_CLEAR;
+        MMC->SRS14 &= ~SRS14_CARD_INTERRUPT_SIG_EN;
+        g_sdio_card_int_handler();
+    }
+    trans_status_isr &= ~SRS12_CARD_INTERRUPT;
+
+    if (trans_status_isr == MMC_CLEAR)
+    {
+        /* Card interrupt only */
+    }
     /* Error interrupt */
-    if ((trans_status_isr & SRS12_ERROR_INTERRUPT) != MMC_CLEAR)
+    else if ((trans_status_isr & SRS12_ERROR_INTERRUPT) != MMC_CLEAR)
     {
         MMC->SRS12 = trans_status_isr;
         MMC->SRS14 = MMC_CLEAR;
+        g_sd_wr.active = MMC_CLEAR;
         g_mmc_trs_status.state = MSS_MMC_TRANSFER_FAIL;
         if (g_transfer_complete_handler_t != NULL_POINTER)
         {
@@ -2184,6 +3522,13 @@ uint8_t  mmc_main_plic_IRQHandler(void)
     {
         MMC->SRS12 = trans_status_isr;
 
+        if (g_sd_wr.active == MMC_SET)
+        {
+            /* Every chunk of MSS_MMC_sd_write_begin() taken */
+            g_sd_wr.done = g_sd_wr.chunks;
+            g_sd_wr.active = MMC_CLEAR;
+        }
+
         if (g_mmc_is_multi_blk == MMC_CLEAR)
         {
             /* Disable interrupts */
@@ -2204,6 +3549,21 @@ uint8_t  mmc_main_plic_IRQHandler(void)
         }
     }
     /* DMA interrupt */
+    else if (((trans_status_isr & SRS12_DMA_INTERRUPT) != MMC_CLEAR) &&
+                (g_sd_wr.active == MMC_SET))
+    {
+        MMC->SRS12 = SRS12_DMA_INTERRUPT;
+        /* A chunk has been taken, go on with the next or wait for it */
+        g_sd_wr.done++;
+        if (g_sd_wr.tail != g_sd_wr.head)
+        {
+            sd_write_start_chunk();
+        }
+        else
+        {
+            g_sd_wr.paused = MMC_SET;
+        }
+    }
     else if ((trans_status_isr & SRS12_DMA_INTERRUPT) != MMC_CLEAR)
     {
         address = MMC->SRS22;
@@ -2226,9 +3586,28 @@ uint8_t  mmc_main_plic_IRQHandler(void)
 
         if ((inttoclear & CQRS04_RESP_ERR_INT) != MMC_CLEAR)
         {
-            /* Disable interrupts */
-            MMC->SRS14 = MMC_CLEAR;
-           g_mmc_trs_status.state = MSS_MMC_TRANSFER_FAIL;
+            task_err = MMC->CQRS21;
+            err_mask = MMC_CLEAR;
+            if ((task_err & CQ_TERRI_RESP_VALID) != MMC_CLEAR)
+            {
+                err_mask |= MMC_SET << ((task_err >> CQ_TERRI_RESP_TASK_SHIFT) & CQ_TERRI_TASK_MASK);
+            }
+            if ((task_err & CQ_TERRI_DATA_VALID) != MMC_CLEAR)
+            {
+                err_mask |= MMC_SET << ((task_err >> CQ_TERRI_DATA_TASK_SHIFT) & CQ_TERRI_TASK_MASK);
+            }
+
+            if ((err_mask & g_cq_slot_busy) != MMC_CLEAR)
+            {
+                /* Reported to the task handler when the task completes */
+                g_cq_slot_error |= (err_mask & g_cq_slot_busy);
+            }
+            else
+            {
+                /* Disable interrupts */
+                MMC->SRS14 = MMC_CLEAR;
+               g_mmc_trs_status.state = MSS_MMC_TRANSFER_FAIL;
+            }
         }
 
         if ((inttoclear & CQRS04_TASK_COMPLETE_INT) != MMC_CLEAR)
@@ -2236,15 +3615,23 @@ uint8_t  mmc_main_plic_IRQHandler(void)
             inttoclear = MMC->CQRS11;
             /* Clear all caught notifications */
             MMC->CQRS11 = inttoclear;
-            --g_cq_task_id;
-            if (g_cq_task_id == MMC_CLEAR)
+            err_mask = g_cq_slot_busy;
+            if ((inttoclear & err_mask) != MMC_CLEAR)
             {
-                /* Disable interrupts */
-                MMC->SRS14 = MMC_CLEAR;
-                g_mmc_trs_status.state = MSS_MMC_TRANSFER_SUCCESS;
-                if (g_transfer_complete_handler_t != NULL_POINTER)
+                cq_submit_done(inttoclear & err_mask);
+            }
+            if ((inttoclear & ~err_mask) != MMC_CLEAR)
+            {
+                --g_cq_task_id;
+                if (g_cq_task_id == MMC_CLEAR)
                 {
-                    g_transfer_complete_handler_t(trans_status_isr);
+                    /* Disable interrupts */
+                    MMC->SRS14 = MMC_CLEAR;
+                    g_mmc_trs_status.state = MSS_MMC_TRANSFER_SUCCESS;
+                    if (g_transfer_complete_handler_t != NULL_POINTER)
+                    {
+                        g_transfer_complete_handler_t(trans_status_isr);
+                    }
                 }
             }
         }
@@ -2255,6 +3642,12 @@ uint8_t  mmc_main_plic_IRQHandler(void)
         /* Disable interrupts */
         MMC->SRS14 = MMC_CLEAR;
     }
+
+    if (g_sdio_card_int_armed == MMC_SET)
+    {
+        /* Kept across the transfer interrupts disabled above */
+        MMC->SRS14 |= SRS14_CARD_INTERRUPT_SIG_EN;
+    }
     return MMC_CLEAR;
 }
 
@@ -2376,6 +3769,8 @@ MSS_MMC_pause_sdma_write_hpi
                         g_trans_src_addr = (uint8_t *)(src + (prog_sector_num * BLK_SIZE));
         
                         g_device_hpi_set = MMC_SET;
+                        /* Other transfers may be started while paused */
+                        g_mmc_trs_status.state = MSS_MMC_INIT_SUCCESS;
                     }
                     else
                     {
@@ -2479,6 +3874,9 @@ MSS_MMC_packed_write
                     MMC->SRS10 = (tmp | SRS10_DMA_SELECT_SDMA);
 
                     /* SDMA setup */
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+                    mss_l2_flush_range((uint64_t)(uintptr_t)src, size);
+#endif
                     MMC->SRS22 = (uint32_t)(uintptr_t)src;
                     MMC->SRS23 = (uint32_t)(((uint64_t)(uintptr_t)src) >> MMC_64BIT_UPPER_ADDR_SHIFT);
 
@@ -2640,6 +4038,9 @@ MSS_MMC_packed_read
                         MMC->SRS10 = (tmp | SRS10_DMA_SELECT_SDMA);
 
                         /* SDMA setup */
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+                        mss_l2_flush_range((uint64_t)(uintptr_t)dest, size);
+#endif
                         MMC->SRS22 = (uint32_t)(uintptr_t)dest;
                         MMC->SRS23 = (uint32_t)(((uint64_t)(uintptr_t)dest) >> MMC_64BIT_UPPER_ADDR_SHIFT);
                         /* Block length and count SDMA buffer boundary */
@@ -2905,6 +4306,7 @@ static mss_mmc_status_t phy_training_mmc(uint8_t delay_type, uint32_t clk_rate)
     uint8_t rx_buff[BLK_SIZE];
     uint32_t read_srs11;
     uint32_t cmd_response;
+    uint8_t use_saved = MMC_CLEAR;
 
     mss_mmc_status_t ret_status = MSS_MMC_NO_ERROR;
     cif_response_t response_status = TRANSFER_IF_FAIL;
@@ -2918,58 +4320,92 @@ static mss_mmc_status_t phy_training_mmc(uint8_t delay_type, uint32_t clk_rate)
         max_delay = (MSS_MMC_CLOCK_200MHZ / clk_rate) * BYTES_2;
     }
 
-    pos = length = curr_length = MMC_CLEAR;
-    /* Reset Data and cmd line */
-    MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
-    for (delay = MMC_CLEAR; delay < max_delay; delay++)
+    /* Try the saved delay first, a failed read falls back to the search */
+    if ((g_tuning_bound == MMC_SET) && (delay_type < MSS_MMC_TUNING_PHY_DELAYS)
+            && ((g_tuning_cache->phy_valid & (MMC_SET << delay_type)) != MMC_CLEAR)
+            && (g_tuning_cache->phy_delay[delay_type] < max_delay))
     {
-        phy_write_set(delay_type, delay);
-
+        MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+        phy_write_set(delay_type, g_tuning_cache->phy_delay[delay_type]);
         ret_status = read_tune_block((uint32_t *)rx_buff, BLK_SIZE, MMC_CMD_17_READ_SINGLE_BLOCK);
+        /* Reset Data and cmd line */
+        MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
         if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
         {
-            curr_length++;
-            if (curr_length > length)
-            {
-                pos = delay - length;
-                length++;
-                /* Reset Data and cmd line */
-                 MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
-            }
+            use_saved = MMC_SET;
         }
         else
         {
+            g_tuning_cache->phy_valid &= ~(MMC_SET << delay_type);
             do
             {
-                if (TRANSFER_IF_FAIL == response_status)
+                read_srs11 = MMC->SRS11;
+            }while ((read_srs11 & MMC_RESET_DATA_CMD_LINE) != MMC_CLEAR);
+        }
+    }
+
+    if (use_saved == MMC_CLEAR)
+    {
+        pos = length = curr_length = MMC_CLEAR;
+        /* Reset Data and cmd line */
+        MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+        for (delay = MMC_CLEAR; delay < max_delay; delay++)
+        {
+            phy_write_set(delay_type, delay);
+
+            ret_status = read_tune_block((uint32_t *)rx_buff, BLK_SIZE, MMC_CMD_17_READ_SINGLE_BLOCK);
+            if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
+            {
+                curr_length++;
+                if (curr_length > length)
                 {
+                    pos = delay - length;
+                    length++;
                     /* Reset Data and cmd line */
-                    MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
-            
-                    do
-                    {
-                        read_srs11 = MMC->SRS11;
-                    }while ((read_srs11 & MMC_RESET_DATA_CMD_LINE) != MMC_CLEAR);
+                     MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
                 }
+            }
+            else
+            {
+                do
+                {
+                    if (TRANSFER_IF_FAIL == response_status)
+                    {
+                        /* Reset Data and cmd line */
+                        MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+            
+                        do
+                        {
+                            read_srs11 = MMC->SRS11;
+                        }while ((read_srs11 & MMC_RESET_DATA_CMD_LINE) != MMC_CLEAR);
+                    }
 
-                response_status = cif_send_cmd(sdcard_RCA << RCA_SHIFT_BIT,
-                                            MMC_CMD_13_SEND_STATUS,
-                                            MSS_MMC_RESPONSE_R1);
-                cmd_response = MMC->SRS04;
-            }while ((TRANSFER_IF_SUCCESS != response_status) ||
-                    ((cmd_response & DEVICE_STATE_MASK) != DEVICE_STATE_TRANS));
+                    response_status = cif_send_cmd(sdcard_RCA << RCA_SHIFT_BIT,
+                                                MMC_CMD_13_SEND_STATUS,
+                                                MSS_MMC_RESPONSE_R1);
+                    cmd_response = MMC->SRS04;
+                }while ((TRANSFER_IF_SUCCESS != response_status) ||
+                        ((cmd_response & DEVICE_STATE_MASK) != DEVICE_STATE_TRANS));
 
-            curr_length = MMC_CLEAR;
-            response_status = TRANSFER_IF_FAIL;
+                curr_length = MMC_CLEAR;
+                response_status = TRANSFER_IF_FAIL;
+            }
         }
-    }
 
-    new_delay = pos + (length / BYTES_2);
-    phy_write_set(delay_type, new_delay);
+        new_delay = pos + (length / BYTES_2);
+        phy_write_set(delay_type, new_delay);
 
-    ret_status = read_tune_block((uint32_t *)rx_buff, BLK_SIZE, MMC_CMD_17_READ_SINGLE_BLOCK);
-    /* Reset Data and cmd line */
-    MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+        ret_status = read_tune_block((uint32_t *)rx_buff, BLK_SIZE, MMC_CMD_17_READ_SINGLE_BLOCK);
+        if ((MSS_MMC_TRANSFER_SUCCESS == ret_status) && (g_tuning_bound == MMC_SET)
+                && (delay_type < MSS_MMC_TUNING_PHY_DELAYS))
+        {
+            g_tuning_cache->phy_delay[delay_type] = new_delay;
+            g_tuning_cache->phy_valid |= (MMC_SET << delay_type);
+            g_tuning_updated = MMC_SET;
+        }
+        /* Reset Data and cmd line */
+        MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+    }
     return ret_status;
 }
 /******************************************************************************/
@@ -3040,18 +4476,35 @@ static mss_mmc_status_t adma2_create_descriptor_table
         uint32_t data_sz
 )
 {
-    uint32_t datasize = data_sz;
+    mss_mmc_sg_t segment;
+
+    segment.buffer = (uint8_t *)data_src;
+    segment.size = data_sz;
+
+    return (adma2_create_sg_descriptor_table(&segment, MMC_SET));
+}
+/******************************************************************************/
+static mss_mmc_status_t adma2_create_sg_descriptor_table
+(
+        const mss_mmc_sg_t *segments,
+        uint32_t seg_count
+)
+{
+    uint32_t seg;
+    uint32_t size;
+    uint32_t current_subsize;
     uint32_t i = MMC_CLEAR;
     uint32_t j = MMC_CLEAR;
-    uintptr_t buf_address = (uintptr_t)data_src;
+    uintptr_t buf_address;
     uint32_t offset = MMC_CLEAR;
     mss_mmc_status_t status = MSS_MMC_NO_ERROR;
 
-    if (datasize >= SIZE_64KB)
+    for (seg = MMC_CLEAR; (seg < seg_count) && (status == MSS_MMC_NO_ERROR); seg++)
     {
-        uint32_t current_subsize = SIZE_64KB;
-        uint32_t size = datasize;
+        buf_address = (uintptr_t)segments[seg].buffer;
+        size = segments[seg].size;
 
+        /* Each descriptor moves up to 64KB */
         while (size > MMC_CLEAR)
         {
             if (i >= SDIO_CFG_SDIO_BUFFERS_COUNT)
@@ -3062,10 +4515,8 @@ static mss_mmc_status_t adma2_create_descriptor_table
                 break;
             }
 
-            if (size < current_subsize)
-            {
-                current_subsize = size;
-            }
+            current_subsize = (size < SIZE_64KB) ? size : SIZE_64KB;
+
             adma_descriptor_table[j++] = (ADMA2_DESCRIPTOR_TYPE_TRAN
                                                 | ADMA2_DESCRIPTOR_VAL | ADMA2_DESCRIPTOR_INT
                                                 | ((current_subsize & MASK_16BIT) << SHIFT_16BIT));
@@ -3079,19 +4530,23 @@ static mss_mmc_status_t adma2_create_descriptor_table
             i++;
         }
     }
+
+    if ((status == MSS_MMC_NO_ERROR) && (i > MMC_CLEAR))
+    {
+        /* Last descriptor finishes transmission */
+        offset  = (i * WORD_SIZE) - WORD_SIZE;
+        adma_descriptor_table[offset] |= ADMA2_DESCRIPTOR_END;
+
+#if defined(MSS_MMC_CACHE_MAINTENANCE)
+        /* The ADMA engine reads the table from memory, not from the cache */
+        mss_l2_flush_range((uint64_t)(uintptr_t)adma_descriptor_table,
+                           (uint64_t)i * WORD_SIZE * sizeof(uint32_t));
+#endif
+    }
     else
     {
-        adma_descriptor_table[j++] = (ADMA2_DESCRIPTOR_TYPE_TRAN
-                                    | ADMA2_DESCRIPTOR_VAL | ADMA2_DESCRIPTOR_INT
-                                    | ((datasize & MASK_16BIT) << SHIFT_16BIT));
-        adma_descriptor_table[j++] = ((uint32_t)buf_address & MASK_32BIT);
-        adma_descriptor_table[j++] = (uint32_t)((uint64_t)buf_address >> MMC_64BIT_UPPER_ADDR_SHIFT);
-        adma_descriptor_table[j] = MMC_CLEAR;
-        i = MMC_SET;
+        status = MSS_MMC_INVALID_PARAMETER;
     }
-    /* Last descriptor finishes transmission */
-    offset  = (i * WORD_SIZE) - WORD_SIZE;
-    adma_descriptor_table[offset] |= ADMA2_DESCRIPTOR_END;
 
     return (status);
 }
@@ -3160,6 +4615,7 @@ static mss_mmc_status_t mmccard_oper_config(const mss_mmc_cfg_t * cfg)
                                                     MSS_MMC_RESPONSE_R2);
         if (TRANSFER_IF_SUCCESS == response_status)
         {
+            tuning_cache_bind(cfg);
             do
             {
                 /* Assign a RCA to the device */
@@ -3465,6 +4921,7 @@ static mss_mmc_status_t sdcard_oper_config(const mss_mmc_cfg_t * cfg)
                                                     MSS_MMC_RESPONSE_R2);
                     if (TRANSFER_IF_SUCCESS == response_status)
                     {
+                        tuning_cache_bind(cfg);
 
                         response_status = cif_send_cmd(MMC_CLEAR,
                                                     MMC_CMD_3_SET_RELATIVE_ADDR,
@@ -5208,7 +6665,25 @@ static mss_mmc_status_t  set_sdhost_power(uint32_t voltage)
 /******************************************************************************/
 static void mmc_delay(uint32_t value)
 {
-    while (value--) asm volatile("");
+    uint64_t start;
+
+    /* Long delays let the wait hook run, or else are spent in wfi */
+    if ((value >= DELAY_COUNT) && (cif_wait() == MMC_SET))
+    {
+        start = readmtime();
+        while ((readmtime() - start) < DELAY_COUNT_TICKS)
+        {
+            (void)cif_wait();
+        }
+    }
+    else if (value >= DELAY_COUNT)
+    {
+        mss_idle_sleep_until(readmtime() + DELAY_COUNT_TICKS);
+    }
+    else
+    {
+        while (value--) asm volatile("");
+    }
 }
 /******************************************************************************/
 static mss_mmc_status_t cmd6_single_block_read
@@ -5287,48 +6762,139 @@ static mss_mmc_status_t execute_tunning_mmc(uint8_t data_width)
     uint32_t ReadPattern[128u];
     uint8_t i, j, PatternOk[40u];
     uint8_t Pos;
+    uint8_t use_saved = MMC_CLEAR;
     uint8_t BufferSize =  (data_width == MSS_MMC_DATA_WIDTH_4BIT)? 64u:128u;
     uint32_t const *WritePattern = calc_write_pattern(data_width);
 
-    for (j = 0u; j < 40u; j++)
+    /* Try the saved tuning value first, a failed read falls back to the sweep */
+    if ((g_tuning_bound == MMC_SET) && (g_tuning_cache->tune_valid != MMC_CLEAR)
+            && (g_tuning_cache->tune_value < 40u))
     {
-        host_mmc_tune(j);
+        host_mmc_tune(g_tuning_cache->tune_value);
         mmc_delay(0xFFu);
-        for (i = 0u; i < (BufferSize / 4u); i++)
-        {
-            ReadPattern[i] = 0u;
-        }
         ret_status = read_tune_block(ReadPattern, BufferSize, MMC_CMD_21_SEND_TUNE_BLK);
         if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
         {
-            /* Compare data with pattern */
-            PatternOk[j] = 1u;
             for (i = 0u; i < (BufferSize / 4u); i++)
             {
                 if (WritePattern[i] != ReadPattern[i])
                 {
-                    PatternOk[j] = 0u;
-                    /* Reset Data and cmd line */
-                    MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
-                    /* Read pattern is not correct - exit loop */
+                    ret_status = MSS_MMC_TRANSFER_FAIL;
                     break;
                 }
             }
         }
+        if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
+        {
+            use_saved = MMC_SET;
+        }
         else
         {
             /* Reset Data and cmd line */
             MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
-            PatternOk[j] = 0u;
+            g_tuning_cache->tune_valid = MMC_CLEAR;
+        }
+    }
+
+    if (use_saved == MMC_CLEAR)
+    {
+        for (j = 0u; j < 40u; j++)
+        {
+            host_mmc_tune(j);
+            mmc_delay(0xFFu);
+            for (i = 0u; i < (BufferSize / 4u); i++)
+            {
+                ReadPattern[i] = 0u;
+            }
+            ret_status = read_tune_block(ReadPattern, BufferSize, MMC_CMD_21_SEND_TUNE_BLK);
+            if (MSS_MMC_TRANSFER_SUCCESS == ret_status)
+            {
+                /* Compare data with pattern */
+                PatternOk[j] = 1u;
+                for (i = 0u; i < (BufferSize / 4u); i++)
+                {
+                    if (WritePattern[i] != ReadPattern[i])
+                    {
+                        PatternOk[j] = 0u;
+                        /* Reset Data and cmd line */
+                        MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+                        /* Read pattern is not correct - exit loop */
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                /* Reset Data and cmd line */
+                MMC->SRS11 |= MMC_RESET_DATA_CMD_LINE;
+                PatternOk[j] = 0u;
+            }
+        }
+        Pos = calc_longest_valid_delay_chain_val(PatternOk);
+        /* Delay value set to Pos */
+        host_mmc_tune(Pos);
+        ret_status = read_tune_block(ReadPattern, BufferSize, MMC_CMD_21_SEND_TUNE_BLK);
+        if ((MSS_MMC_TRANSFER_SUCCESS == ret_status) && (g_tuning_bound == MMC_SET))
+        {
+            g_tuning_cache->tune_value = Pos;
+            g_tuning_cache->tune_valid = MMC_SET;
+            g_tuning_updated = MMC_SET;
         }
     }
-    Pos = calc_longest_valid_delay_chain_val(PatternOk);
-    /* Delay value set to Pos */
-    host_mmc_tune(Pos);
-    ret_status = read_tune_block(ReadPattern, BufferSize, MMC_CMD_21_SEND_TUNE_BLK);
     return ret_status;
 }
 /******************************************************************************/
+/* Called after CMD2 with the CID response in SRS04..SRS07. Keeps the tuning
+ * record when it was saved for this device and configuration, clears it
+ * otherwise. */
+static void tuning_cache_bind(const mss_mmc_cfg_t * cfg)
+{
+    uint32_t cid[4];
+    uint8_t idx;
+    uint8_t match;
+
+    if (g_tuning_cache != NULL_POINTER)
+    {
+        cid[0] = MMC->SRS04;
+        cid[1] = MMC->SRS05;
+        cid[2] = MMC->SRS06;
+        cid[3] = MMC->SRS07;
+
+        match = ((g_tuning_cache->marker == MSS_MMC_TUNING_MARKER)
+                    && (g_tuning_cache->clk_rate == cfg->clk_rate)
+                    && (g_tuning_cache->data_bus_width == cfg->data_bus_width)
+                    && (g_tuning_cache->bus_speed_mode == cfg->bus_speed_mode))
+                    ? MMC_SET : MMC_CLEAR;
+        for (idx = 0u; idx < 4u; idx++)
+        {
+            if (g_tuning_cache->cid[idx] != cid[idx])
+            {
+                match = MMC_CLEAR;
+            }
+        }
+
+        if (match == MMC_CLEAR)
+        {
+            g_tuning_cache->marker = MSS_MMC_TUNING_MARKER;
+            g_tuning_cache->clk_rate = cfg->clk_rate;
+            g_tuning_cache->data_bus_width = cfg->data_bus_width;
+            g_tuning_cache->bus_speed_mode = cfg->bus_speed_mode;
+            g_tuning_cache->tune_valid = MMC_CLEAR;
+            g_tuning_cache->tune_value = MMC_CLEAR;
+            g_tuning_cache->phy_valid = MMC_CLEAR;
+            for (idx = 0u; idx < 4u; idx++)
+            {
+                g_tuning_cache->cid[idx] = cid[idx];
+            }
+            for (idx = 0u; idx < MSS_MMC_TUNING_PHY_DELAYS; idx++)
+            {
+                g_tuning_cache->phy_delay[idx] = MMC_CLEAR;
+            }
+        }
+        g_tuning_bound = MMC_SET;
+    }
+}
+/******************************************************************************/
 static mss_mmc_status_t read_tune_block
 (
     uint32_t *read_data,
@@ -5512,10 +7078,12 @@ static cif_response_t check_device_status(cif_response_t rsp_status)
 {
     uint32_t srs9;
     
-    do
+    srs9 = MMC->SRS09;
+    while ((srs9 & SRS9_DAT0_SIGNAL_LEVEL) == MMC_CLEAR)
     {
+        (void)cif_wait();
         srs9 = MMC->SRS09;
-    }while ((srs9 & SRS9_DAT0_SIGNAL_LEVEL) == MMC_CLEAR);
+    }
 
     /*
     * Writing to the EXT CSD register takes significant time,
@@ -46,10 +46,13 @@
     - Single block read and write without DMA.
     - Multiple or single block read and write with DMA (SDMA, ADMA2).
     - eMMC command queue block read and write.
+    - eMMC boot partition read using the alternative boot operation.
     - eMMC standards LEGACY, SDR, DDR, HS200, HS400 and HS400-ES
     - SD card standards Default Speed(DS), High Speed(HS), UHS-I(SDR12, SDR25,
       SDR50, SDR104, DDR50).
     - Single block read and write operation for SDIO.
+    - Multiple block read and write for SDIO with ADMA2, and the SDIO card
+      interrupt.
 
   ==============================================================================
   Theory of Operation
@@ -72,6 +75,7 @@
     - Block Transfer Status
     - Interrupt Handling
     - Command Queue
+    - Boot Partition Read
 
   --------------------------------
   Initialization
@@ -87,6 +91,21 @@
   The MSS_MMC_init() function takes a pointer to the configuration data
   structure of type mss_mmc_cfg_t.
 
+  Tuning Cache
+
+  MSS_MMC_init() trains the PHY input delay for the selected bus mode and, for
+  HS200 and HS400, sweeps the eMMC tuning value with CMD21. Both searches
+  issue many read commands and add to the boot time. The application can hand
+  the driver a record of type mss_mmc_tuning_t, loaded from non-volatile
+  storage such as the eNVM, by calling MSS_MMC_set_tuning_cache() before
+  MSS_MMC_init(). When the record was saved for the same device, identified by
+  its CID, and for the same clock rate, bus width and bus speed mode, the
+  driver applies the saved values and checks them with a single read. A full
+  search is only made for a value which is missing or which fails the check,
+  for example with a CRC error. Whenever a full search was made, the driver
+  calls the save handler at the end of a successful MSS_MMC_init() so that
+  the application can store the updated record.
+
   --------------------------------
   Block Transfer Control 
   --------------------------------
@@ -124,6 +143,64 @@
   To read a single block of data stored within the SDIO device, a call is made
   to the MSS_MMC_sdio_single_block_read() function.
 
+  Scatter-Gather Transfer
+
+  The MSS_MMC_adma2_write_sg() and MSS_MMC_adma2_read_sg() functions take a
+  list of memory segments, of type mss_mmc_sg_t, instead of one buffer. One
+  ADMA2 descriptor chain is built for the whole list, so a single multi-block
+  transfer reads into or writes from buffers which are not contiguous in
+  memory, without a bounce copy. Only the total size of the segments must be a
+  multiple of 512 bytes.
+
+  SD Card Write Stream
+
+  The following functions write a large run of blocks to an SD card as one
+  multi-block write, given in chunks as they become ready:
+    - MSS_MMC_sd_write_begin()
+    - MSS_MMC_sd_write_submit()
+    - MSS_MMC_sd_write_end()
+    - MSS_MMC_sd_write_get_done()
+
+  MSS_MMC_sd_write_begin() waits for the card to finish any previous write,
+  then sends ACMD23 with the number of blocks to be written so the card can
+  erase them in advance. Each MSS_MMC_sd_write_submit() gives one buffer of
+  MSS_MMC_SD_WRITE_CHUNK bytes, aligned on that size. The first starts CMD25.
+  SDMA stops at the end of each chunk, the eMMC SD interrupt carries on with
+  the next chunk submitted, so the card stays in the one multi-block write
+  however long the application takes to submit the next chunk. The card is
+  only waited for once, by the next command after the write, and not after
+  each buffer.
+  MSS_MMC_sd_write_get_done() returns the number of chunks taken by the SDMA,
+  whose buffers may be reused. The write completes, with CMD12 sent from the
+  interrupt, once every chunk has been submitted and sent, or is ended early
+  with MSS_MMC_sd_write_end(). Blocks erased but not written are left erased.
+
+  SDIO Block Transfer
+
+  The MSS_MMC_sdio_adma2_write() and MSS_MMC_sdio_adma2_read() functions
+  transfer up to 511 blocks of 512 bytes to or from a register or FIFO of an
+  SDIO function with a single CMD53 in block mode, using ADMA2. They are
+  non-blocking, completion being reported as for MSS_MMC_adma2_read(), so a
+  network driver can queue its next frame while the last one is moving. The
+  MSS_MMC_sdio_rw_direct() function reads or writes one register with CMD52.
+
+  The MSS_MMC_sdio_set_card_int_handler() function enables the card interrupt
+  of the selected functions in the SDIO device and registers the handler
+  called from the eMMC SD interrupt when the device asserts it, whether or not
+  a transfer is in progress. The card holds its interrupt asserted until the
+  function interrupt is served, so it is masked in the host controller when
+  the handler is called, and taken again once the application has served the
+  function, typically from a task, and called MSS_MMC_sdio_card_int_ack().
+
+  Cache Maintenance
+
+  By default the DMA transfer functions do no cache maintenance, so DMA
+  buffers are expected to be in non-cached memory. If MSS_MMC_CACHE_MAINTENANCE
+  is defined, the SDMA and ADMA2 transfer functions flush the buffer, and the
+  ADMA2 descriptor table, from the L2 cache before the transfer is started.
+  This allows buffers to be placed in cached DDR. The buffer must not be
+  accessed by the CPU until the transfer has completed.
+
   --------------------------------
   Block Transfer Status
   --------------------------------
@@ -159,6 +236,77 @@
   To read a single block or multiple blocks of data stored within the eMMC
   device using a command queue, a call is made to the MSS_MMC_cq_read()
   function. This function supports up to 32 tasks.
+
+  The MSS_MMC_cq_write() and MSS_MMC_cq_read() functions queue the tasks for
+  one transfer and wait for all of them before the next transfer can start.
+  For many small independent transfers, such as random reads, the following
+  functions keep up to MSS_MMC_CQ_MAX_TASKS tasks queued in the device at the
+  same time:
+    - MSS_MMC_cq_submit()
+    - MSS_MMC_cq_ring_doorbell()
+
+  MSS_MMC_cq_submit() takes a free task slot, fills in its task descriptor and
+  returns the slot number. The task is not started until
+  MSS_MMC_cq_ring_doorbell() is called, so a batch of tasks can be started
+  with one doorbell write. The device may complete the tasks in any order.
+  Each task's handler is called from the eMMC SD interrupt when the task
+  completes, and the slot is free again once the handler is called.
+  MSS_MMC_cq_write() and MSS_MMC_cq_read() are refused while submitted tasks
+  are outstanding, and MSS_MMC_cq_submit() is refused while one of them is in
+  progress.
+
+  --------------------------------
+  Boot Partition Read
+  --------------------------------
+  The following functions read an eMMC boot partition without initializing the
+  device:
+    - MSS_MMC_boot_read()
+    - MSS_MMC_boot_end()
+    - MSS_MMC_boot_config()
+
+  MSS_MMC_init() identifies the device, selects it and switches its bus width
+  and speed mode before any data can be read, which takes tens of
+  milliseconds. The eMMC alternative boot operation instead has the device
+  stream its boot partition as soon as it is powered: MSS_MMC_boot_read()
+  sets up the host controller at the boot bus width, timing and clock of the
+  configuration passed to it, sends CMD0 with the boot initiation argument and
+  has ADMA2 write the blocks received straight to the destination buffer,
+  typically in DDR. A bootloader can load the next stage image this way, and
+  check or start it, while the rest of its own start-up goes on.
+
+  MSS_MMC_boot_read() returns MSS_MMC_TRANSFER_IN_PROGRESS once the transfer
+  is started. Completion is reported by MSS_MMC_get_transfer_status() and the
+  handler registered with MSS_MMC_set_handler() as for MSS_MMC_adma2_read().
+  MSS_MMC_boot_end() then leaves the boot operation. The device must be
+  initialized with MSS_MMC_init() before any other function of the driver is
+  used.
+
+  The boot partition read, the boot bus width and the boot timing are set in
+  the EXT_CSD register of the device, once, with MSS_MMC_boot_config() after
+  MSS_MMC_init(). Boot acknowledge is left disabled as the host controller
+  does not take it. The widest bus and high speed SDR timing the board and
+  device support give the fastest read, the bus width and speed mode passed to
+  MSS_MMC_boot_read() must then be the same as those set.
+
+  --------------------------------
+  Block Device
+  --------------------------------
+  The block device layer in mss_mmc_bdev.h queues read and write requests,
+  merges requests which continue each other and starts them back to back from
+  the eMMC SD interrupt. See mss_mmc_bdev.h for details.
+
+  --------------------------------
+  Waiting
+  --------------------------------
+  Each command sent to the device, and each wait for the device to leave the
+  busy state, polls the host controller status registers, which takes
+  hundreds of microseconds per command. An application running under an RTOS
+  can register a wait hook with MSS_MMC_set_wait_hook(). The driver calls the
+  hook on each pass of these polling loops, and during its longer fixed
+  delays, so the hook can yield or block the calling task for a short time
+  and let other tasks use the hart. The hook is only called while machine
+  interrupts are enabled, so it is never called from the eMMC SD interrupt or
+  from a transfer completion handler.
   
  *//*=========================================================================*/
 #ifndef __MSS_MMC_H
@@ -277,6 +425,30 @@ extern "C"
 #define MSS_SDIO_FUNCTION_NUMBER_6      6u
 #define MSS_SDIO_FUNCTION_NUMBER_7      7u
 
+/* Register address of MSS_MMC_sdio_adma2_write() and MSS_MMC_sdio_adma2_read() */
+#define MSS_MMC_SDIO_ADDR_FIXED         0u
+#define MSS_MMC_SDIO_ADDR_INCR          1u
+
+/* Boot partition enabled for the boot operation, see MSS_MMC_boot_config() */
+#define MSS_MMC_BOOT_DISABLE            0u
+#define MSS_MMC_BOOT_PARTITION_1        1u
+#define MSS_MMC_BOOT_PARTITION_2        2u
+
+/*-------------------------------------------------------------------------*//**
+  Size in bytes of each chunk given to MSS_MMC_sd_write_submit(), a power of
+  two from 4KB to 512KB.
+ */
+#ifndef MSS_MMC_SD_WRITE_CHUNK
+#define MSS_MMC_SD_WRITE_CHUNK          0x10000u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Number of chunks MSS_MMC_sd_write_submit() can queue ahead of the SDMA.
+ */
+#ifndef MSS_MMC_SD_WRITE_QUEUE
+#define MSS_MMC_SD_WRITE_QUEUE          8u
+#endif
+
 /*-------------------------------------------------------------------------*//**
 The mss_mmc_status_t type is used to indicate the return status of the eMMC/SD
 data transfer. A variable of this type is returned by the MSS_MMC_init(),
@@ -331,7 +503,8 @@ typedef enum
     MSS_MMC_DEVICE_IS_NOT_IN_HPI_MODE,
     MSS_MMC_DEVICE_HPI_NOT_DISABLED,
     MSS_MMC_DATA_SIZE_IS_NOT_MULTI_BLOCK,
-    MSS_MMC_DEVICE_ERROR
+    MSS_MMC_DEVICE_ERROR,
+    MSS_MMC_SD_WRITE_QUEUE_FULL
 } mss_mmc_status_t;
 
 /*-------------------------------------------------------------------------*//**
@@ -367,6 +540,105 @@ typedef struct
 */
 typedef void (*mss_mmc_handler_t)(uint32_t status);
 
+/*-------------------------------------------------------------------------*//**
+  This type definition specifies the prototype of the wait hook registered
+  with MSS_MMC_set_wait_hook().
+*/
+typedef void (*mss_mmc_wait_hook_t)(void);
+
+/*-------------------------------------------------------------------------*//**
+  This type definition specifies the prototype of the function called from the
+  eMMC SD interrupt when the SDIO device asserts its card interrupt, registered
+  by MSS_MMC_sdio_set_card_int_handler().
+ */
+typedef void (*mss_mmc_sdio_int_handler_t)(void);
+
+/*-------------------------------------------------------------------------*//**
+  Number of PHY input delay types held in a tuning record. This covers the
+  MSS_MMC_PHY_DELAY_INPUT_ delay types of mss_mmc_types.h.
+ */
+#define MSS_MMC_TUNING_PHY_DELAYS       9u
+
+/*-------------------------------------------------------------------------*//**
+  Value of the marker field of a tuning record filled in by the driver.
+ */
+#define MSS_MMC_TUNING_MARKER           0x4D4D5455u
+
+/*-------------------------------------------------------------------------*//**
+  The mss_mmc_tuning_t type holds the results of the PHY training and bus
+  tuning made by MSS_MMC_init(), together with the device and configuration
+  they were found for. The application does not need to interpret the record,
+  it only stores it and hands it back with MSS_MMC_set_tuning_cache().
+ */
+typedef struct
+{
+    /* MSS_MMC_TUNING_MARKER when the record holds results */
+    uint32_t marker;
+    /* CID register of the device */
+    uint32_t cid[4];
+    /* Clock rate, bus width and bus speed mode of mss_mmc_cfg_t */
+    uint32_t clk_rate;
+    uint8_t data_bus_width;
+    uint8_t bus_speed_mode;
+    /* Non-zero when tune_value holds the HS200/HS400 tuning result */
+    uint8_t tune_valid;
+    uint8_t tune_value;
+    /* Bit n set when phy_delay[n] holds the result for PHY delay type n */
+    uint32_t phy_valid;
+    uint8_t phy_delay[MSS_MMC_TUNING_PHY_DELAYS];
+} mss_mmc_tuning_t;
+
+/*-------------------------------------------------------------------------*//**
+  This type definition specifies the prototype of the function called by the
+  driver at the end of MSS_MMC_init() when the tuning record has been updated
+  and should be saved by the application.
+ */
+typedef void (*mss_mmc_tuning_save_t)(const mss_mmc_tuning_t *tuning);
+
+/*-------------------------------------------------------------------------*//**
+  The mss_mmc_sg_t type describes one memory segment of a scatter-gather
+  transfer made with MSS_MMC_adma2_write_sg() or MSS_MMC_adma2_read_sg(). The
+  buffer address and size must be multiples of 4 bytes.
+ */
+typedef struct
+{
+    /* Start of the segment in host memory */
+    uint8_t *buffer;
+    /* Size of the segment in bytes */
+    uint32_t size;
+} mss_mmc_sg_t;
+
+/*-------------------------------------------------------------------------*//**
+  Task directions for MSS_MMC_cq_submit().
+ */
+#define MSS_MMC_CQ_DIR_READ             0u
+#define MSS_MMC_CQ_DIR_WRITE            1u
+
+/*-------------------------------------------------------------------------*//**
+  Number of task slots available to MSS_MMC_cq_submit(). The last of the 32
+  command queue slots is kept for direct commands.
+ */
+#define MSS_MMC_CQ_MAX_TASKS            31u
+
+/*-------------------------------------------------------------------------*//**
+  Largest transfer, in bytes, for one task submitted with MSS_MMC_cq_submit().
+ */
+#define MSS_MMC_CQ_MAX_TASK_SIZE        65536u
+
+/*-------------------------------------------------------------------------*//**
+  This type definition specifies the prototype of the task completion handler
+  passed to MSS_MMC_cq_submit(). It is called from interrupt context with the
+  slot number returned by MSS_MMC_cq_submit(), MSS_MMC_TRANSFER_SUCCESS or
+  MSS_MMC_TRANSFER_FAIL, and the p_user_data value given to
+  MSS_MMC_cq_submit(). The handler may submit new tasks.
+*/
+typedef void (*mss_mmc_cq_task_handler_t)
+(
+    uint8_t task_id,
+    mss_mmc_status_t status,
+    void *p_user_data
+);
+
 /*-----------------------------Public APIs------------------------------------*/
 
 /*-------------------------------------------------------------------------*//**
@@ -864,6 +1136,95 @@ MSS_MMC_adma2_read
     uint8_t *dest,
     uint32_t size
 );
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_adma2_write_sg() function is used to write blocks of data
+  gathered from a list of memory segments to the eMMC/SD device using ADMA2.
+  The segments are written one after another, starting at sector dest.
+
+  Note: A call to MSS_MMC_adma2_write_sg() while a transfer is in progress will
+  not initiate a new transfer.
+
+  Note: This function is a non-blocking function and returns immediately after
+  initiating the write transfer. The segment list is only read by this
+  function, but the segment buffers must not change until the transfer has
+  completed.
+
+  @param segments
+  This parameter is a pointer to the list of segments.
+
+  @param seg_count
+  Specifies the number of segments in the list.
+
+  @param dest
+  Specifies the sector address in the eMMC/SD device where the data is
+  to be stored.
+
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation. MSS_MMC_INVALID_PARAMETER is returned if
+  the total size is not a multiple of 512, is greater than (32MB - 512), or
+  needs more descriptors than the driver's descriptor table holds.
+ */
+mss_mmc_status_t
+MSS_MMC_adma2_write_sg
+(
+    const mss_mmc_sg_t *segments,
+    uint32_t seg_count,
+    uint32_t dest
+);
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_adma2_read_sg() function is used to read blocks of data from the
+  eMMC/SD device, starting at sector src, and scatter them over a list of
+  memory segments using ADMA2.
+
+  Note: A call to MSS_MMC_adma2_read_sg() while a transfer is in progress will
+  not initiate a new transfer.
+
+  Note: This function is a non-blocking function and returns immediately after
+  initiating the read transfer.
+
+  @param src
+  Specifies the sector address in the eMMC/SD device from where the data is
+  to be read.
+
+  @param segments
+  This parameter is a pointer to the list of segments.
+
+  @param seg_count
+  Specifies the number of segments in the list.
+
+  @return
+  This function returns a value of type mss_mmc_status_t which specifies the
+  transfer status of the operation. MSS_MMC_INVALID_PARAMETER is returned if
+  the total size is not a multiple of 512, is greater than (32MB - 512), or
+  needs more descriptors than the driver's descriptor table holds.
+
+  Example:
+  The following example reads 64 sectors into four separate frame buffers.
+  @code
+    mss_mmc_sg_t segments[4];
+    uint32_t idx;
+
+    for (idx = 0u; idx < 4u; idx++)
+    {
+        segments[idx].buffer = g_frame[idx];
+        segments[idx].size = 8192u;
+    }
+
+    ret_status = MSS_MMC_adma2_read_sg(SECT_1, segments, 4u);
+    do
+    {
+        ret_status = MSS_MMC_get_transfer_status();
+    }while (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS)
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_adma2_read_sg
+(
+    uint32_t src,
+    const mss_mmc_sg_t *segments,
+    uint32_t seg_count
+);
 /*-------------------------------------------------------------------------*//**
   The MSS_MMC_sdio_single_block_write() function is used to transfer a single
   block of data from the host controller to the SDIO device function 1
@@ -1001,6 +1362,178 @@ MSS_MMC_sdio_single_block_read
     uint16_t data_size
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sdio_adma2_write() function starts the write of one or more
+  512-byte blocks to an SDIO function, with CMD53 in block mode and ADMA2. The
+  block size of the function must be 512 bytes, as MSS_MMC_init() sets for
+  function 1.
+
+  Note: This function is a non-blocking function and returns immediately after
+  initiating the write transfer. Use the MSS_MMC_get_transfer_status() function
+  or a completion handler registered by the MSS_MMC_set_handler() function to
+  check the status of the transfer.
+
+  @param src
+  This parameter is a pointer to the data to be written.
+
+  @param function
+  Specifies the SDIO function number, MSS_SDIO_FUNCTION_NUMBER_0 to
+  MSS_SDIO_FUNCTION_NUMBER_7.
+
+  @param dest
+  Specifies the 17-bit register address in the function.
+
+  @param op_code
+  Specifies MSS_MMC_SDIO_ADDR_FIXED to write each byte to the same address,
+  such as a FIFO, or MSS_MMC_SDIO_ADDR_INCR to write successive addresses.
+
+  @param size
+  Specifies the size in bytes of the transfer, a multiple of 512 but not
+  greater than 511 blocks.
+
+  @return
+  This function returns MSS_MMC_TRANSFER_IN_PROGRESS when the transfer has
+  been started, MSS_MMC_NOT_INITIALISED when the device is not an initialized
+  SDIO device, MSS_MMC_TRANSFER_IN_PROGRESS when a transfer is in progress and
+  MSS_MMC_INVALID_PARAMETER when a parameter is out of range.
+
+  Example:
+  @code
+    #define WLAN_FIFO 0x00000u
+
+    ret_status = MSS_MMC_sdio_adma2_write(frame, MSS_SDIO_FUNCTION_NUMBER_1,
+                                          WLAN_FIFO, MSS_MMC_SDIO_ADDR_FIXED,
+                                          4u * 512u);
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_sdio_adma2_write
+(
+    const uint8_t *src,
+    uint8_t function,
+    uint32_t dest,
+    uint8_t op_code,
+    uint32_t size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sdio_adma2_read() function starts the read of one or more
+  512-byte blocks from an SDIO function, with CMD53 in block mode and ADMA2.
+  The block size of the function must be 512 bytes.
+
+  Note: This function is a non-blocking function and returns immediately after
+  initiating the read transfer.
+
+  @param function
+  Specifies the SDIO function number, MSS_SDIO_FUNCTION_NUMBER_0 to
+  MSS_SDIO_FUNCTION_NUMBER_7.
+
+  @param src
+  Specifies the 17-bit register address in the function.
+
+  @param op_code
+  Specifies MSS_MMC_SDIO_ADDR_FIXED or MSS_MMC_SDIO_ADDR_INCR.
+
+  @param dest
+  This parameter is a pointer to a buffer where the data read will be stored.
+
+  @param size
+  Specifies the size in bytes of the transfer, a multiple of 512 but not
+  greater than 511 blocks.
+
+  @return
+  This function returns the same values as MSS_MMC_sdio_adma2_write().
+ */
+mss_mmc_status_t
+MSS_MMC_sdio_adma2_read
+(
+    uint8_t function,
+    uint32_t src,
+    uint8_t op_code,
+    uint8_t *dest,
+    uint32_t size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sdio_rw_direct() function reads or writes one register of an SDIO
+  function with CMD52. It cannot be used while a transfer is in progress.
+
+  @param is_write
+  Specifies 1 to write the register, 0 to read it.
+
+  @param function
+  Specifies the SDIO function number, MSS_SDIO_FUNCTION_NUMBER_0 for the CCCR
+  and FBR registers.
+
+  @param reg_addr
+  Specifies the 17-bit register address in the function.
+
+  @param data
+  This parameter is a pointer to the byte written, or to the byte where the
+  value read is stored.
+
+  @return
+  This function returns MSS_MMC_TRANSFER_SUCCESS, MSS_MMC_NOT_INITIALISED,
+  MSS_MMC_TRANSFER_IN_PROGRESS, MSS_MMC_INVALID_PARAMETER, or
+  MSS_MMC_TRANSFER_FAIL when the device reported an error.
+ */
+mss_mmc_status_t
+MSS_MMC_sdio_rw_direct
+(
+    uint8_t is_write,
+    uint8_t function,
+    uint32_t reg_addr,
+    uint8_t *data
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sdio_set_card_int_handler() function enables the card interrupt
+  of SDIO functions in the device and registers the handler called when the
+  device asserts it. The handler is called from the eMMC SD interrupt, after
+  which the card interrupt stays masked until MSS_MMC_sdio_card_int_ack() is
+  called.
+
+  @param handler
+  The function called when the card interrupt is asserted, or NULL.
+
+  @param function_mask
+  Specifies the functions whose interrupt is enabled, bit N for function N, 1
+  to 7. A mask of 0 disables the card interrupt.
+
+  @return
+  This function returns the status of the write of the CCCR interrupt enable
+  register, as MSS_MMC_sdio_rw_direct().
+
+  Example:
+  @code
+    void wlan_int(void)
+    {
+        // wake the network task, which reads the interrupt status of the
+        // function then calls MSS_MMC_sdio_card_int_ack()
+    }
+
+    ret_status = MSS_MMC_sdio_set_card_int_handler(wlan_int, 1u << 1u);
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_sdio_set_card_int_handler
+(
+    mss_mmc_sdio_int_handler_t handler,
+    uint8_t function_mask
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sdio_card_int_ack() function unmasks the card interrupt once the
+  function interrupt reported to the handler has been served.
+
+  @param
+    This function has no parameters.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_MMC_sdio_card_int_ack(void);
+
 /*-------------------------------------------------------------------------*//**
   The MSS_MMC_get_transfer_status() function returns the status of the MMC
   transfer initiated by a call to MSS_MMC_sdma_write(), MSS_MMC_sdma_read(), 
@@ -1034,6 +1567,39 @@ MSS_MMC_sdio_single_block_read
  */
 mss_mmc_status_t MSS_MMC_get_transfer_status(void);
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sc_read() and MSS_MMC_sc_write() functions read and write count
+  sectors with SDMA and wait for the transfer to finish. They have the form of
+  the device functions of the MPFS HAL sector cache, see mss_sector_cache.h,
+  so the cache can be used in front of the eMMC/SD device. They can also be
+  called directly by the application.
+
+  The MMC interrupt must be enabled, as for MSS_MMC_sdma_read().
+
+  @param buf
+    The data buffer.
+
+  @param sector
+    The first sector.
+
+  @param count
+    The number of sectors.
+
+  @return
+    These functions return 0 when the transfer succeeded and 1 otherwise.
+
+  Example:
+  @code
+    cfg.read = MSS_MMC_sc_read;
+    cfg.write = MSS_MMC_sc_write;
+    (void)mss_sector_cache_init(&g_sc, &cfg);
+
+    status = mss_sector_cache_read(&g_sc, fat_buffer, fat_sector, 1u);
+  @endcode
+ */
+uint8_t MSS_MMC_sc_read(uint8_t *buf, uint32_t sector, uint32_t count);
+uint8_t MSS_MMC_sc_write(const uint8_t *buf, uint32_t sector, uint32_t count);
+
 /*-------------------------------------------------------------------------*//**
   The MSS_MMC_set_handler() function registers a handler function that will be
   called by the driver when a read o write transfer completes. The application
@@ -1114,6 +1680,75 @@ mss_mmc_status_t MSS_MMC_get_transfer_status(void);
  */
 void MSS_MMC_set_handler(mss_mmc_handler_t handler);
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_set_wait_hook() function registers a function which the driver
+  calls while it waits for the host controller or the device, see the Waiting
+  section above. The hook must return once it has yielded or slept; the
+  driver checks the status registers again each time it returns. The hook
+  must not call the driver functions.
+
+  @param hook
+  The wait hook, or NULL to spin without calling a hook.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    static void mmc_wait(void)
+    {
+        taskYIELD();
+    }
+
+    MSS_MMC_set_wait_hook(mmc_wait);
+    ret_status = MSS_MMC_init(&g_mmc0);
+  @endcode
+ */
+void MSS_MMC_set_wait_hook(mss_mmc_wait_hook_t hook);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_set_tuning_cache() function gives the driver a tuning record to
+  use and update in the following calls to MSS_MMC_init(). It must be called
+  before MSS_MMC_init(). The record is kept by the driver, so it must remain
+  valid for as long as it is registered.
+
+  A record which has never been saved, or which was saved for another device
+  or configuration, is cleared by MSS_MMC_init() and filled in with the results
+  of a full search. A zero filled record can be used the first time.
+
+  @param tuning
+  The tuning parameter is a pointer to the tuning record. Passing NULL_POINTER
+  stops the use of a tuning record, and MSS_MMC_init() always makes a full
+  search.
+
+  @param save
+  The save parameter is a pointer to the function called when the record has
+  been updated. It may be NULL_POINTER.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  The following example keeps the tuning record in the eNVM user area.
+  @code
+    static mss_mmc_tuning_t g_tuning;
+
+    void save_tuning(const mss_mmc_tuning_t *tuning)
+    {
+        envm_write(TUNING_ADDR, tuning, sizeof(mss_mmc_tuning_t));
+    }
+
+    memcpy(&g_tuning, (const void *)TUNING_ADDR, sizeof(g_tuning));
+    MSS_MMC_set_tuning_cache(&g_tuning, save_tuning);
+    ret_status = MSS_MMC_init(&g_mmc);
+  @endcode
+ */
+void MSS_MMC_set_tuning_cache
+(
+    mss_mmc_tuning_t *tuning,
+    mss_mmc_tuning_save_t save
+);
+
 /*-------------------------------------------------------------------------*//**
   The MSS_MMC_cq_init() function enables command queue in the eMMC device and
   in the host controller. The command queue allows the application to queue
@@ -1298,6 +1933,303 @@ MSS_MMC_cq_read
     uint32_t size
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_cq_submit() function takes a free command queue task slot and
+  fills in its task descriptor for a read or write of up to
+  MSS_MMC_CQ_MAX_TASK_SIZE bytes. The task is started by the next call to
+  MSS_MMC_cq_ring_doorbell().
+
+  Note: This function is a non-blocking function. It can be called from a task
+  completion handler.
+
+  @param direction
+  Specifies the direction of the transfer, MSS_MMC_CQ_DIR_READ or
+  MSS_MMC_CQ_DIR_WRITE.
+
+  @param sector
+  Specifies the first sector of the transfer in the eMMC device.
+
+  @param buffer
+  This parameter is a pointer to the data buffer in host memory. It must
+  remain valid until the task handler is called.
+
+  @param size
+  Specifies the size in bytes of the transfer. The value of size must be a
+  multiple of 512 and not greater than MSS_MMC_CQ_MAX_TASK_SIZE.
+
+  @param handler
+  Specifies the task completion handler. It may be NULL.
+
+  @param p_user_data
+  This value is passed to the handler.
+
+  @param task_id
+  This parameter is a pointer to where the slot number of the task is stored.
+  It may be NULL.
+
+  @return
+  This function returns MSS_MMC_TRANSFER_IN_PROGRESS when the task has been
+  set up. It returns MSS_MMC_TRANSFER_FAIL when no task slot is free or when
+  MSS_MMC_cq_write() or MSS_MMC_cq_read() is in progress,
+  MSS_MMC_CQ_NOT_INITIALISED when MSS_MMC_cq_init() has not succeeded, and
+  MSS_MMC_INVALID_PARAMETER when a parameter is out of range.
+
+  Example:
+  @code
+    void read_done(uint8_t task_id, mss_mmc_status_t status, void *p_user_data)
+    {
+        // p_user_data identifies the read
+    }
+
+    for (idx = 0u; idx < 8u; idx++)
+    {
+        (void)MSS_MMC_cq_submit(MSS_MMC_CQ_DIR_READ, sectors[idx],
+                                &buffer[idx * 4096u], 4096u, read_done,
+                                (void *)idx, NULL);
+    }
+    MSS_MMC_cq_ring_doorbell();
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_cq_submit
+(
+    uint8_t direction,
+    uint32_t sector,
+    uint8_t *buffer,
+    uint32_t size,
+    mss_mmc_cq_task_handler_t handler,
+    void *p_user_data,
+    uint8_t *task_id
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_cq_ring_doorbell() function starts all the tasks set up by
+  MSS_MMC_cq_submit() since the last call, with one doorbell register write.
+
+  @param
+    This function has no parameters.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_MMC_cq_ring_doorbell(void);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sd_write_begin() function starts a multi-block write to an SD
+  card, given in chunks by MSS_MMC_sd_write_submit(). It waits for the card
+  to be ready and sets the number of blocks to pre-erase with ACMD23.
+
+  @param dest
+  Specifies the sector address in the SD card where the data is to be written.
+
+  @param size
+  Specifies the size in bytes of the write, a multiple of
+  MSS_MMC_SD_WRITE_CHUNK but not greater than (32MB - MSS_MMC_SD_WRITE_CHUNK).
+
+  @return
+  This function returns MSS_MMC_NO_ERROR when the write has been started,
+  MSS_MMC_NOT_INITIALISED, MSS_MMC_TRANSFER_IN_PROGRESS when a transfer is in
+  progress, MSS_MMC_INVALID_PARAMETER when the device is not an SD card or the
+  size is out of range, and MSS_MMC_DEVICE_ERROR when the card did not take the
+  pre-erase command.
+
+  Example:
+  @code
+    #define RECORD_SIZE 0x01000000u
+
+    ret_status = MSS_MMC_sd_write_begin(sector, RECORD_SIZE);
+    for (chunk = 0u; chunk < (RECORD_SIZE / MSS_MMC_SD_WRITE_CHUNK); chunk++)
+    {
+        buffer = wait_for_samples();
+        while (MSS_MMC_SD_WRITE_QUEUE_FULL == MSS_MMC_sd_write_submit(buffer))
+        {
+            ;
+        }
+    }
+    do
+    {
+        ret_status = MSS_MMC_get_transfer_status();
+    }while (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS);
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_sd_write_begin
+(
+    uint32_t dest,
+    uint32_t size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sd_write_submit() function gives the next chunk of the write
+  started by MSS_MMC_sd_write_begin(). The buffer must stay unchanged until
+  MSS_MMC_sd_write_get_done() shows it has been taken.
+
+  Note: This function is a non-blocking function.
+
+  @param buf
+  This parameter is a pointer to MSS_MMC_SD_WRITE_CHUNK bytes of data, aligned
+  on MSS_MMC_SD_WRITE_CHUNK bytes.
+
+  @return
+  This function returns MSS_MMC_TRANSFER_IN_PROGRESS when the chunk has been
+  queued, MSS_MMC_SD_WRITE_QUEUE_FULL when MSS_MMC_SD_WRITE_QUEUE chunks are
+  waiting for the SDMA, MSS_MMC_INVALID_PARAMETER when the buffer is not
+  aligned or every chunk of the write has been given, and
+  MSS_MMC_TRANSFER_FAIL when no write is in progress or the write failed.
+ */
+mss_mmc_status_t MSS_MMC_sd_write_submit(const uint8_t *buf);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sd_write_end() function ends the write started by
+  MSS_MMC_sd_write_begin() before all its chunks have been submitted. It waits
+  for the chunks submitted to be written, then stops the multi-block write
+  with CMD12. It has no effect once every chunk has been submitted.
+
+  @param
+    This function has no parameters.
+
+  @return
+  This function returns the transfer status, as
+  MSS_MMC_get_transfer_status().
+ */
+mss_mmc_status_t MSS_MMC_sd_write_end(void);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_sd_write_get_done() function returns the number of chunks of the
+  write started by MSS_MMC_sd_write_begin() taken by the SDMA, in the order
+  they were submitted.
+
+  @param
+    This function has no parameters.
+
+  @return
+  This function returns the number of chunks taken.
+ */
+uint32_t MSS_MMC_sd_write_get_done(void);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_boot_read() function reads the start of the enabled boot
+  partition of an eMMC device using the alternative boot operation, without
+  initializing the device. It resets and sets up the host controller from the
+  configuration passed and transfers the data received using ADMA2.
+
+  Note: This function is a non-blocking function and returns immediately after
+  initiating the read transfer. Use the MSS_MMC_get_transfer_status() function
+  or a completion handler registered by the MSS_MMC_set_handler() function to
+  wait for its completion, then call MSS_MMC_boot_end().
+
+  Note: The device must be powered up, or reset to the pre-idle state, before
+  this function is called. MSS_MMC_init() must be called to use the device
+  after the boot operation.
+
+  @param cfg
+  This parameter is a pointer to a data structure of type mss_mmc_cfg_t. The
+  card_type must be MSS_MMC_CARD_TYPE_MMC. The data_bus_width is the boot bus
+  width and the bus_speed_mode is MSS_MMC_MODE_LEGACY, for a clk_rate up to
+  26MHz, or MSS_MMC_MODE_SDR for high speed timing, for a clk_rate up to 50MHz,
+  as set in the device by MSS_MMC_boot_config().
+
+  @param dest
+  This parameter is a pointer to a buffer where the data read from the boot
+  partition will be stored.
+
+  @param size
+  Specifies the size in bytes of the data read from the start of the boot
+  partition. The value of size must be a multiple of 512 but not greater than
+  (32MB -512).
+
+  @return
+  This function returns MSS_MMC_TRANSFER_IN_PROGRESS when the transfer has
+  been started, MSS_MMC_INVALID_PARAMETER or MSS_MMC_TRANSFER_IN_PROGRESS when
+  a parameter is out of range or a transfer is in progress, and
+  MSS_MMC_INIT_FAILURE or MSS_MMC_TRANSFER_FAIL when the host controller could
+  not be set up or the boot initiation command failed.
+
+  Example:
+  The following example shows how to load a 1MB image from the boot partition
+  at 8 bits high speed, then initialize the device.
+  @code
+    #define IMAGE_SIZE 0x100000u
+
+    mss_mmc_cfg_t g_boot;
+    mss_mmc_status_t ret_status;
+    uint8_t *image = (uint8_t *)0x80000000u;
+
+    g_boot.clk_rate = MSS_MMC_CLOCK_50MHZ;
+    g_boot.card_type = MSS_MMC_CARD_TYPE_MMC;
+    g_boot.data_bus_width = MSS_MMC_DATA_WIDTH_8BIT;
+    g_boot.bus_speed_mode = MSS_MMC_MODE_SDR;
+    g_boot.bus_voltage = MSS_MMC_1_8V_BUS_VOLTAGE;
+
+    ret_status = MSS_MMC_boot_read(&g_boot, image, IMAGE_SIZE);
+    if (MSS_MMC_TRANSFER_IN_PROGRESS == ret_status)
+    {
+        do
+        {
+            ret_status = MSS_MMC_get_transfer_status();
+        }while (ret_status == MSS_MMC_TRANSFER_IN_PROGRESS);
+    }
+    (void)MSS_MMC_boot_end();
+
+    ret_status = MSS_MMC_init(&g_mmc0);
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_boot_read
+(
+    const mss_mmc_cfg_t * cfg,
+    uint8_t *dest,
+    uint32_t size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_boot_end() function ends the boot operation started by
+  MSS_MMC_boot_read(), stopping the transfer if it is still in progress, and
+  resets the device to the idle state with CMD0.
+
+  @param
+    This function has no parameters.
+
+  @return
+  This function returns MSS_MMC_NO_ERROR, or MSS_MMC_RESET_ERR if the reset
+  command could not be sent.
+ */
+mss_mmc_status_t MSS_MMC_boot_end(void);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_boot_config() function sets the boot partition read by the boot
+  operation and the boot bus conditions in the EXT_CSD register of the eMMC
+  device. The settings are kept by the device, so this is done once, when the
+  device is provisioned. MSS_MMC_init() must have been called.
+
+  @param partition
+  Specifies the boot partition, MSS_MMC_BOOT_PARTITION_1 or
+  MSS_MMC_BOOT_PARTITION_2, or MSS_MMC_BOOT_DISABLE to disable the boot
+  operation.
+
+  @param data_bus_width
+  Specifies the boot bus width, MSS_MMC_DATA_WIDTH_1BIT,
+  MSS_MMC_DATA_WIDTH_4BIT or MSS_MMC_DATA_WIDTH_8BIT.
+
+  @param bus_speed_mode
+  Specifies the boot timing, MSS_MMC_MODE_LEGACY or MSS_MMC_MODE_SDR for high
+  speed.
+
+  @return
+  This function returns MSS_MMC_NO_ERROR when the settings have been written,
+  MSS_MMC_NOT_INITIALISED or MSS_MMC_INVALID_PARAMETER,
+  MSS_MMC_DEVICE_NOT_SUPPORT_SDR when the device does not support the high
+  speed boot timing, and MSS_MMC_DEVICE_ERROR when it does not support the
+  alternative boot operation or the EXT_CSD register could not be written.
+ */
+mss_mmc_status_t
+MSS_MMC_boot_config
+(
+    uint8_t partition,
+    uint8_t data_bus_width,
+    uint8_t bus_speed_mode
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,429 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC MSS eMMC SD asynchronous block device implementation.
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+#include "mss_mmc.h"
+#ifdef MSS_MMC_INTERNAL_APIS
+#include "mss_mmc_internal_api.h"
+#endif
+#include "mss_mmc_bdev.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * Macros
+ */
+#define BDEV_BLK_SIZE                   512u
+#define BDEV_CLEAR                      0u
+#define BDEV_SET                        1u
+#define BDEV_NULL                       ((mss_mmc_bdev_req_t *)0)
+
+/*******************************************************************************
+ * Global variable file scope
+ */
+/* Requests waiting to be started, oldest first */
+static mss_mmc_bdev_req_t *g_bdev_head = BDEV_NULL;
+static mss_mmc_bdev_req_t *g_bdev_tail = BDEV_NULL;
+/* Urgent reads waiting to be started, oldest first */
+static mss_mmc_bdev_req_t *g_bdev_urgent_head = BDEV_NULL;
+static mss_mmc_bdev_req_t *g_bdev_urgent_tail = BDEV_NULL;
+/* Requests making up the transfer in progress */
+static mss_mmc_bdev_req_t * volatile g_bdev_active = BDEV_NULL;
+/* Size of the transfer in progress, and set once it has been resumed */
+static uint32_t g_bdev_active_size = BDEV_CLEAR;
+static uint8_t g_bdev_active_resumed = BDEV_CLEAR;
+/* Write paused with HPI while urgent reads are served */
+static mss_mmc_bdev_req_t *g_bdev_paused = BDEV_NULL;
+static uint8_t g_bdev_use_cq = BDEV_CLEAR;
+
+/*******************************************************************************
+ * Private functions
+ */
+static void bdev_start(void);
+static mss_mmc_bdev_req_t *bdev_take
+(
+    mss_mmc_bdev_req_t **head,
+    mss_mmc_bdev_req_t **tail,
+    uint32_t *size
+);
+static void bdev_preempt(void);
+static void bdev_resume(void);
+static void bdev_complete(mss_mmc_bdev_req_t *chain, mss_mmc_status_t status);
+static void bdev_transfer_handler(uint32_t status);
+static mss_mmc_status_t bdev_transfer
+(
+    uint8_t direction,
+    uint32_t sector,
+    uint8_t *buffer,
+    uint32_t size
+);
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc_bdev.h" for details of how to use this function.
+ */
+void MSS_MMC_bdev_init(uint8_t use_cq)
+{
+    PLIC_DisableIRQ(MMC_main_PLIC);
+
+    g_bdev_head = BDEV_NULL;
+    g_bdev_tail = BDEV_NULL;
+    g_bdev_urgent_head = BDEV_NULL;
+    g_bdev_urgent_tail = BDEV_NULL;
+    g_bdev_active = BDEV_NULL;
+    g_bdev_active_size = BDEV_CLEAR;
+    g_bdev_active_resumed = BDEV_CLEAR;
+    g_bdev_paused = BDEV_NULL;
+    g_bdev_use_cq = (use_cq != BDEV_CLEAR) ? BDEV_SET : BDEV_CLEAR;
+
+    MSS_MMC_set_handler(bdev_transfer_handler);
+
+    PLIC_EnableIRQ(MMC_main_PLIC);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc_bdev.h" for details of how to use this function.
+ */
+mss_mmc_status_t MSS_MMC_bdev_submit(mss_mmc_bdev_req_t *req)
+{
+    if ((req == BDEV_NULL) || (req->buffer == (uint8_t *)0) ||
+        (req->size == BDEV_CLEAR) || ((req->size % BDEV_BLK_SIZE) != BDEV_CLEAR) ||
+        (req->size > MSS_MMC_BDEV_MAX_MERGE) ||
+        (req->direction > MSS_MMC_BDEV_WRITE))
+    {
+        return MSS_MMC_INVALID_PARAMETER;
+    }
+
+    req->status = MSS_MMC_TRANSFER_IN_PROGRESS;
+    req->next = BDEV_NULL;
+
+    /* The queue is also changed from the MMC interrupt */
+    PLIC_DisableIRQ(MMC_main_PLIC);
+
+    if (g_bdev_tail == BDEV_NULL)
+    {
+        g_bdev_head = req;
+    }
+    else
+    {
+        g_bdev_tail->next = req;
+    }
+    g_bdev_tail = req;
+
+    if (g_bdev_active == BDEV_NULL)
+    {
+        bdev_start();
+    }
+
+    PLIC_EnableIRQ(MMC_main_PLIC);
+
+    return MSS_MMC_TRANSFER_IN_PROGRESS;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc_bdev.h" for details of how to use this function.
+ */
+mss_mmc_status_t MSS_MMC_bdev_submit_urgent(mss_mmc_bdev_req_t *req)
+{
+    if ((req == BDEV_NULL) || (req->buffer == (uint8_t *)0) ||
+        (req->size == BDEV_CLEAR) || ((req->size % BDEV_BLK_SIZE) != BDEV_CLEAR) ||
+        (req->size > MSS_MMC_BDEV_MAX_MERGE) ||
+        (req->direction != MSS_MMC_BDEV_READ))
+    {
+        return MSS_MMC_INVALID_PARAMETER;
+    }
+
+    req->status = MSS_MMC_TRANSFER_IN_PROGRESS;
+    req->next = BDEV_NULL;
+
+    PLIC_DisableIRQ(MMC_main_PLIC);
+
+    if (g_bdev_urgent_tail == BDEV_NULL)
+    {
+        g_bdev_urgent_head = req;
+    }
+    else
+    {
+        g_bdev_urgent_tail->next = req;
+    }
+    g_bdev_urgent_tail = req;
+
+    if (g_bdev_active != BDEV_NULL)
+    {
+        bdev_preempt();
+    }
+
+    if (g_bdev_active == BDEV_NULL)
+    {
+        bdev_start();
+    }
+
+    PLIC_EnableIRQ(MMC_main_PLIC);
+
+    return MSS_MMC_TRANSFER_IN_PROGRESS;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc_bdev.h" for details of how to use this function.
+ */
+uint8_t MSS_MMC_bdev_idle(void)
+{
+    return ((g_bdev_active == BDEV_NULL) && (g_bdev_head == BDEV_NULL) &&
+            (g_bdev_urgent_head == BDEV_NULL) && (g_bdev_paused == BDEV_NULL)) ?
+            BDEV_SET : BDEV_CLEAR;
+}
+
+/*******************************************************************************
+ * Starts the next transfer: urgent reads first, then the paused write, then
+ * the normal queue. Called with the MMC interrupt disabled or from the MMC
+ * interrupt.
+ */
+static void bdev_start(void)
+{
+    mss_mmc_bdev_req_t *first;
+    mss_mmc_status_t status;
+    uint32_t size = BDEV_CLEAR;
+
+    while ((g_bdev_active == BDEV_NULL) &&
+           ((g_bdev_urgent_head != BDEV_NULL) || (g_bdev_paused != BDEV_NULL) ||
+            (g_bdev_head != BDEV_NULL)))
+    {
+        if (g_bdev_urgent_head != BDEV_NULL)
+        {
+            first = bdev_take(&g_bdev_urgent_head, &g_bdev_urgent_tail, &size);
+        }
+        else if (g_bdev_paused != BDEV_NULL)
+        {
+            bdev_resume();
+            first = BDEV_NULL;
+        }
+        else
+        {
+            first = bdev_take(&g_bdev_head, &g_bdev_tail, &size);
+        }
+
+        if (first != BDEV_NULL)
+        {
+            g_bdev_active = first;
+            g_bdev_active_size = size;
+            g_bdev_active_resumed = BDEV_CLEAR;
+
+            status = bdev_transfer(first->direction, first->sector,
+                                   first->buffer, size);
+            if (MSS_MMC_TRANSFER_IN_PROGRESS != status)
+            {
+                /* Not started, fail these requests and try the next ones */
+                g_bdev_active = BDEV_NULL;
+                bdev_complete(first, status);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * Takes the request at the head of a queue and the requests behind it which
+ * continue it on the device and in memory. Returns the first request of the
+ * chain and its total size.
+ */
+static mss_mmc_bdev_req_t *bdev_take
+(
+    mss_mmc_bdev_req_t **head,
+    mss_mmc_bdev_req_t **tail,
+    uint32_t *size
+)
+{
+    mss_mmc_bdev_req_t *first = *head;
+    mss_mmc_bdev_req_t *last = first;
+    mss_mmc_bdev_req_t *next = last->next;
+
+    *size = first->size;
+
+    while ((next != BDEV_NULL) &&
+           (next->direction == last->direction) &&
+           (next->sector == (last->sector + (last->size / BDEV_BLK_SIZE))) &&
+           (next->buffer == (last->buffer + last->size)) &&
+           ((*size + next->size) <= MSS_MMC_BDEV_MAX_MERGE))
+    {
+        *size += next->size;
+        last = next;
+        next = last->next;
+    }
+
+    *head = next;
+    if (next == BDEV_NULL)
+    {
+        *tail = BDEV_NULL;
+    }
+    last->next = BDEV_NULL;
+
+    return first;
+}
+
+/*******************************************************************************
+ * Pauses the write in progress with HPI so the urgent reads can be started.
+ * Only writes of at least MSS_MMC_BDEV_HPI_MIN_SIZE bytes, which have not
+ * already been paused once, are paused. Called with the MMC interrupt
+ * disabled.
+ */
+static void bdev_preempt(void)
+{
+#ifdef MSS_MMC_INTERNAL_APIS
+    mss_mmc_bdev_req_t *chain = g_bdev_active;
+    mss_mmc_status_t status;
+
+    if ((g_bdev_use_cq == BDEV_CLEAR) && (g_bdev_paused == BDEV_NULL) &&
+        (chain->direction == MSS_MMC_BDEV_WRITE) &&
+        (g_bdev_active_resumed == BDEV_CLEAR) &&
+        (g_bdev_active_size >= MSS_MMC_BDEV_HPI_MIN_SIZE))
+    {
+        status = MSS_MMC_pause_sdma_write_hpi(chain->buffer, chain->sector,
+                                              g_bdev_active_size);
+        if (MSS_MMC_TRANSFER_SUCCESS == status)
+        {
+            g_bdev_paused = chain;
+            g_bdev_active = BDEV_NULL;
+        }
+        else if (MSS_MMC_TRANSFER_FAIL == status)
+        {
+            /* The write has been stopped but can not be resumed */
+            g_bdev_active = BDEV_NULL;
+            bdev_complete(chain, status);
+        }
+        else
+        {
+            /* HPI not supported or the write has finished, let it complete */
+        }
+    }
+#endif
+}
+
+/*******************************************************************************
+ * Restarts the remaining blocks of the paused write.
+ */
+static void bdev_resume(void)
+{
+#ifdef MSS_MMC_INTERNAL_APIS
+    mss_mmc_bdev_req_t *chain = g_bdev_paused;
+    mss_mmc_status_t status;
+
+    g_bdev_paused = BDEV_NULL;
+
+    status = MSS_MMC_resume_sdma_write_hpi();
+    if (MSS_MMC_TRANSFER_IN_PROGRESS == status)
+    {
+        g_bdev_active = chain;
+        g_bdev_active_resumed = BDEV_SET;
+    }
+    else
+    {
+        /* Nothing was left to write, or the write could not be restarted */
+        bdev_complete(chain, status);
+    }
+#else
+    g_bdev_paused = BDEV_NULL;
+#endif
+}
+
+/*******************************************************************************
+ * Starts one transfer with the transfer function suited to its size.
+ */
+static mss_mmc_status_t bdev_transfer
+(
+    uint8_t direction,
+    uint32_t sector,
+    uint8_t *buffer,
+    uint32_t size
+)
+{
+    mss_mmc_status_t status;
+
+    if (g_bdev_use_cq == BDEV_SET)
+    {
+        if (MSS_MMC_BDEV_WRITE == direction)
+        {
+            status = MSS_MMC_cq_write(buffer, sector, size);
+        }
+        else
+        {
+            status = MSS_MMC_cq_read(sector, buffer, size);
+        }
+    }
+    else if (size <= MSS_MMC_BDEV_SDMA_LIMIT)
+    {
+        if (MSS_MMC_BDEV_WRITE == direction)
+        {
+            status = MSS_MMC_sdma_write(buffer, sector, size);
+        }
+        else
+        {
+            status = MSS_MMC_sdma_read(sector, buffer, size);
+        }
+    }
+    else
+    {
+        if (MSS_MMC_BDEV_WRITE == direction)
+        {
+            status = MSS_MMC_adma2_write(buffer, sector, size);
+        }
+        else
+        {
+            status = MSS_MMC_adma2_read(sector, buffer, size);
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+ * Sets the status of each request in the chain and calls its handler. The
+ * handlers may submit new requests.
+ */
+static void bdev_complete(mss_mmc_bdev_req_t *chain, mss_mmc_status_t status)
+{
+    mss_mmc_bdev_req_t *req = chain;
+    mss_mmc_bdev_req_t *next;
+
+    while (req != BDEV_NULL)
+    {
+        /* The handler may reuse the request */
+        next = req->next;
+        req->next = BDEV_NULL;
+        req->status = status;
+
+        if (req->handler != (mss_mmc_bdev_handler_t)0)
+        {
+            req->handler(req);
+        }
+        req = next;
+    }
+}
+
+/*******************************************************************************
+ * Transfer completion handler registered with MSS_MMC_set_handler(). Called
+ * from mmc_main_plic_IRQHandler().
+ */
+static void bdev_transfer_handler(uint32_t status)
+{
+    mss_mmc_bdev_req_t *chain = g_bdev_active;
+
+    (void)status;
+
+    g_bdev_active = BDEV_NULL;
+
+    if (chain != BDEV_NULL)
+    {
+        bdev_complete(chain, MSS_MMC_get_transfer_status());
+    }
+
+    bdev_start();
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,230 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC MSS eMMC SD asynchronous block device public API.
+ *
+ */
+/*=========================================================================*//**
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The block device layer sits on top of the MSS eMMC SD driver and lets the
+  application queue any number of read and write requests without waiting for
+  the previous transfer to finish. Requests are started one after another from
+  the eMMC SD interrupt, so the device is kept busy for as long as there are
+  requests in the queue.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  MSS_MMC_bdev_init() is called once after MSS_MMC_init(), and after
+  MSS_MMC_cq_init() when the command queue is used. It registers the block
+  device completion handler with MSS_MMC_set_handler(), so the application
+  must not register its own handler while the block device is in use, and
+  must not call the MSS_MMC transfer functions directly.
+
+  The application fills in a request of type mss_mmc_bdev_req_t and passes it
+  to MSS_MMC_bdev_submit(). The request belongs to the block device until its
+  handler is called, from interrupt context, with the outcome of the transfer
+  in the request's status field.
+
+  Request Merging
+  When a transfer is started, the block device looks at the requests waiting
+  behind the first one. A request is merged into the same transfer when it is
+  in the same direction, starts at the sector following the previous request
+  and its buffer follows on from the previous request's buffer in memory.
+  Merging stops at MSS_MMC_BDEV_MAX_MERGE bytes.
+
+  Transfer Selection
+  With the command queue enabled every transfer uses MSS_MMC_cq_read() or
+  MSS_MMC_cq_write(). Otherwise transfers of up to MSS_MMC_BDEV_SDMA_LIMIT
+  bytes use SDMA, which has the lowest set-up cost, and larger ones use ADMA2.
+
+  Urgent Reads
+  Reads passed to MSS_MMC_bdev_submit_urgent() are kept in a queue of their
+  own which is served before the normal queue. When MSS_MMC_INTERNAL_APIS is
+  defined, the command queue is not used and a write of at least
+  MSS_MMC_BDEV_HPI_MIN_SIZE bytes is in progress, the write is paused with the
+  eMMC high priority interrupt (HPI) using MSS_MMC_pause_sdma_write_hpi(). The
+  urgent reads are then started, and once they are complete the remaining
+  blocks of the write are restarted with MSS_MMC_resume_sdma_write_hpi() ahead
+  of the normal queue. The read latency is then bounded by the HPI time of
+  the device rather than by the length of the write. A write is paused at
+  most once; urgent reads arriving after it has been resumed wait for it to
+  finish. Without HPI support urgent reads only move ahead of the normal
+  queue.
+
+ *//*=========================================================================*/
+#ifndef __MSS_MMC_BDEV_H
+#define __MSS_MMC_BDEV_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "mss_mmc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Largest transfer, in bytes, built by merging requests. It must be a multiple
+  of 512 and no larger than (32MB - 512).
+ */
+#ifndef MSS_MMC_BDEV_MAX_MERGE
+#define MSS_MMC_BDEV_MAX_MERGE          (1024u * 1024u)
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Transfers up to this size, in bytes, use SDMA rather than ADMA2 when the
+  command queue is not used.
+ */
+#ifndef MSS_MMC_BDEV_SDMA_LIMIT
+#define MSS_MMC_BDEV_SDMA_LIMIT         4096u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Writes of at least this size, in bytes, are paused with HPI to start urgent
+  reads. Shorter writes are left to finish.
+ */
+#ifndef MSS_MMC_BDEV_HPI_MIN_SIZE
+#define MSS_MMC_BDEV_HPI_MIN_SIZE       (64u * 1024u)
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Request directions.
+ */
+#define MSS_MMC_BDEV_READ               0u
+#define MSS_MMC_BDEV_WRITE              1u
+
+struct mss_mmc_bdev_req;
+
+/*-------------------------------------------------------------------------*//**
+  Request completion handler. It is called from interrupt context and may
+  submit further requests.
+ */
+typedef void (*mss_mmc_bdev_handler_t)(struct mss_mmc_bdev_req *req);
+
+/*-------------------------------------------------------------------------*//**
+  Block device request. The application fills in the fields down to
+  p_user_data; the remaining fields are used by the block device.
+ */
+typedef struct mss_mmc_bdev_req
+{
+    /* MSS_MMC_BDEV_READ or MSS_MMC_BDEV_WRITE */
+    uint8_t direction;
+    /* First sector */
+    uint32_t sector;
+    /* Data buffer */
+    uint8_t *buffer;
+    /* Size in bytes, a multiple of 512 */
+    uint32_t size;
+    /* Completion handler, may be NULL */
+    mss_mmc_bdev_handler_t handler;
+    /* Application data, not used by the block device */
+    void *p_user_data;
+    /* MSS_MMC_TRANSFER_SUCCESS or the error, set before the handler is called */
+    volatile mss_mmc_status_t status;
+    /* Queue link */
+    struct mss_mmc_bdev_req *next;
+} mss_mmc_bdev_req_t;
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_bdev_init() function empties the request queue and registers the
+  block device completion handler.
+
+  @param use_cq
+  Non-zero to use the command queue transfer functions. MSS_MMC_cq_init() must
+  have been called successfully.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_MMC_bdev_init(uint8_t use_cq);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_bdev_submit() function adds a request to the queue, and starts
+  it straight away if the device is idle.
+
+  @param req
+  The request. It must not be changed until its handler has been called.
+
+  @return
+  This function returns MSS_MMC_TRANSFER_IN_PROGRESS when the request has been
+  queued, or MSS_MMC_INVALID_PARAMETER when it is not valid.
+
+  Example:
+  @code
+    static mss_mmc_bdev_req_t g_req[2];
+
+    void req_done(mss_mmc_bdev_req_t *req)
+    {
+        if (MSS_MMC_TRANSFER_SUCCESS != req->status)
+        {
+            // handle error
+        }
+    }
+
+    MSS_MMC_bdev_init(0u);
+
+    g_req[0].direction = MSS_MMC_BDEV_WRITE;
+    g_req[0].sector = 100u;
+    g_req[0].buffer = g_log_buffer;
+    g_req[0].size = 4096u;
+    g_req[0].handler = req_done;
+    (void)MSS_MMC_bdev_submit(&g_req[0]);
+
+    g_req[1].direction = MSS_MMC_BDEV_WRITE;
+    g_req[1].sector = 108u;
+    g_req[1].buffer = g_log_buffer + 4096u;
+    g_req[1].size = 4096u;
+    g_req[1].handler = req_done;
+    (void)MSS_MMC_bdev_submit(&g_req[1]);
+  @endcode
+ */
+mss_mmc_status_t MSS_MMC_bdev_submit(mss_mmc_bdev_req_t *req);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_bdev_submit_urgent() function adds a read request to the urgent
+  queue. It is started before any request in the normal queue and, when
+  possible, a long write in progress is paused with HPI to start it straight
+  away. See the Urgent Reads section above.
+
+  @param req
+  The request. Its direction must be MSS_MMC_BDEV_READ. It must not be changed
+  until its handler has been called.
+
+  @return
+  This function returns MSS_MMC_TRANSFER_IN_PROGRESS when the request has been
+  queued, or MSS_MMC_INVALID_PARAMETER when it is not valid.
+
+  Example:
+  @code
+    // Bulk logging continues in the background
+    (void)MSS_MMC_bdev_submit(&g_log_req);
+
+    g_cfg_req.direction = MSS_MMC_BDEV_READ;
+    g_cfg_req.sector = CFG_SECTOR;
+    g_cfg_req.buffer = g_cfg_buffer;
+    g_cfg_req.size = 512u;
+    g_cfg_req.handler = cfg_done;
+    (void)MSS_MMC_bdev_submit_urgent(&g_cfg_req);
+  @endcode
+ */
+mss_mmc_status_t MSS_MMC_bdev_submit_urgent(mss_mmc_bdev_req_t *req);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_bdev_idle() function returns non-zero when no request is queued
+  or in progress.
+
+  @return
+  This function returns 1 when the block device is idle, 0 otherwise.
+ */
+uint8_t MSS_MMC_bdev_idle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __MSS_MMC_BDEV_H */
@@ -11,6 +11,7 @@
  * mss_mmc_if.h header file.
  *
  */
+#include "mpfs_hal/mss_hal.h"
 #include "mss_mmc_if.h"
 #include "mss_mmc_regs.h"
 #include "mss_mmc_types.h"
@@ -30,6 +31,9 @@ extern "C" {
 static cif_response_t response_1_parser(void);
 static uint32_t process_request_checkresptype(uint8_t responsetype);
 static cif_response_t cq_execute_task(uint8_t task_id);
+
+/* Called while waiting, see cif_set_wait_hook() */
+static void (*g_cif_wait_hook)(void) = NULL;
 /***************************************************************************//**
  * cif_send_cmd()
  * See ".h" for details of how to use this function.
@@ -111,10 +115,13 @@ void send_mmc_cmd
     uint32_t srs9, trans_status_isr;
     
     /* check if command line is not busy */
-    do
+    srs9 = MMC->SRS09;
+    while ((srs9 & SRS9_CMD_INHIBIT_CMD) != NO_CMD_INHIBIT)
     {
+        /* Also called from the MMC interrupt, cif_wait() checks for that */
+        (void)cif_wait();
         srs9 = MMC->SRS09;
-    }while ((srs9 & SRS9_CMD_INHIBIT_CMD) != NO_CMD_INHIBIT);
+    }
 
     command_information = process_request_checkresptype(resp_type);
 
@@ -125,10 +132,12 @@ void send_mmc_cmd
     {
         /* only need to wait around if expecting no response */
         case CHECK_IF_CMD_SENT_POLL:
-            do
+            trans_status_isr = MMC->SRS12;
+            while (((SRS12_COMMAND_COMPLETE | SRS12_ERROR_INTERRUPT) & trans_status_isr) == MMC_CLEAR)
             {
+                (void)cif_wait();
                 trans_status_isr = MMC->SRS12;
-            }while (((SRS12_COMMAND_COMPLETE | SRS12_ERROR_INTERRUPT) & trans_status_isr) == MMC_CLEAR);
+            }
             break;
         case CHECK_IF_CMD_SENT_INT:
             break;
@@ -309,10 +318,12 @@ static cif_response_t cq_execute_task(uint8_t task_id)
 
     while (value--);
     
-    do
+    trans_status_isr = MMC->SRS12;
+    while (((SRS12_ERROR_INTERRUPT | SRS12_CMD_QUEUING_INT) & trans_status_isr) == MMC_CLEAR)
     {
+        (void)cif_wait();
         trans_status_isr = MMC->SRS12;
-    }while (((SRS12_ERROR_INTERRUPT | SRS12_CMD_QUEUING_INT) & trans_status_isr) == MMC_CLEAR);
+    }
 
     if ((trans_status_isr & (SRS12_ERROR_INTERRUPT | SRS12_CMD_QUEUING_INT)) != MMC_CLEAR)
     {
@@ -359,6 +370,33 @@ static cif_response_t cq_execute_task(uint8_t task_id)
     }
     return ret_status;
 }
+
+/***************************************************************************//**
+ * cif_set_wait_hook()
+ * See ".h" for details of how to use this function.
+ */
+void cif_set_wait_hook(void (*hook)(void))
+{
+    g_cif_wait_hook = hook;
+}
+
+/***************************************************************************//**
+ * cif_wait()
+ * See ".h" for details of how to use this function.
+ */
+uint8_t cif_wait(void)
+{
+    uint8_t called = MMC_CLEAR;
+
+    if ((g_cif_wait_hook != NULL) &&
+        ((read_csr(mstatus) & MSTATUS_MIE) != MMC_CLEAR))
+    {
+        g_cif_wait_hook();
+        called = MMC_SET;
+    }
+
+    return called;
+}
 /******************************************************************************/
 #ifdef __cplusplus
 }
@@ -151,6 +151,21 @@ cif_response_t cif_send_cq_direct_command
         uint8_t resp_type,
         uint8_t task_id
 );
+
+/***************************************************************************//**
+  The cif_set_wait_hook() function sets the function called by cif_wait(), or
+  removes it when hook is NULL.
+ */
+void cif_set_wait_hook(void (*hook)(void));
+
+/***************************************************************************//**
+  The cif_wait() function is called on each pass of the loops which wait for
+  the eMMC/SD host or device. It calls the wait hook when one is set and
+  machine interrupts are enabled, so the hook is never called from an
+  interrupt handler or a critical section. It returns 1 when the hook was
+  called.
+ */
+uint8_t cif_wait(void);
 /******************************************************************************/
 
 
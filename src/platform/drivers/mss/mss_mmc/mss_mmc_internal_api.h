@@ -25,6 +25,10 @@
   To resume previously interrupted multiple block transfer of eMMC device, 
   a call is made to the MSS_MMC_resume_sdma_write_hpi() function.
 
+  Other transfers, for example urgent reads, may be started and completed
+  between the two calls. MSS_MMC_bdev_submit_urgent() in mss_mmc_bdev.h uses
+  this to preempt long writes.
+
   --------------------------------
   Packed Commands
   --------------------------------
@@ -44,6 +48,9 @@
   packed command header block and the base address of buffer containing the
   data blocks to be stored into the eMMC device.
 
+  The packed write coalescer in mss_mmc_pwc.h builds the packed command header
+  itself and groups small writes into packed writes automatically.
+
   --------------------------------
   Command Queue
   --------------------------------
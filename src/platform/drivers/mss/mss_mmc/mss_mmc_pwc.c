@@ -0,0 +1,344 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC MSS eMMC packed write coalescing implementation.
+ *
+ */
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "mss_mmc.h"
+#ifdef MSS_MMC_INTERNAL_APIS
+#include "mss_mmc_internal_api.h"
+#endif
+#include "mss_mmc_pwc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MSS_MMC_INTERNAL_APIS
+
+/***************************************************************************//**
+ * Macros
+ */
+#define PWC_BLK_SIZE                    512u
+#define PWC_CLEAR                       0u
+#define PWC_SET                         1u
+#define PWC_BATCHES                     2u
+/* Packed command header, JESD84-B51 6.6.29.1 */
+#define PWC_HDR_VERSION                 0x01u
+#define PWC_HDR_WRITE                   0x02u
+#define PWC_HDR_ENTRY_SIZE              8u
+
+/*******************************************************************************
+ * Types
+ */
+typedef struct
+{
+    /* Header block followed by the data of every entry */
+    uint8_t *buffer;
+    /* Data bytes after the header */
+    uint32_t used;
+    uint32_t entries;
+    uint32_t first_sector;
+    /* Sector following the last entry, and its block count */
+    uint32_t next_sector;
+    uint32_t last_blocks;
+    /* mtime of the first write */
+    uint64_t start_time;
+} pwc_batch_t;
+
+/*******************************************************************************
+ * Global variable file scope
+ */
+static pwc_batch_t g_pwc_batch[PWC_BATCHES];
+/* Data bytes one batch can hold */
+static uint32_t g_pwc_capacity = PWC_CLEAR;
+static uint64_t g_pwc_window = PWC_CLEAR;
+/* Batch being filled */
+static uint8_t g_pwc_fill = PWC_CLEAR;
+/* Set while the other batch is being written */
+static uint8_t g_pwc_busy = PWC_CLEAR;
+static mss_mmc_status_t g_pwc_error = MSS_MMC_TRANSFER_SUCCESS;
+
+/*******************************************************************************
+ * Private functions
+ */
+static void pwc_reset_batch(pwc_batch_t *batch);
+static void pwc_put_word(uint8_t *dest, uint32_t value);
+static uint8_t pwc_check_done(uint8_t wait);
+static mss_mmc_status_t pwc_send(void);
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc_pwc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_pwc_init
+(
+    uint8_t *buffer,
+    uint32_t size,
+    uint64_t window
+)
+{
+    uint32_t half = size / PWC_BATCHES;
+    uint8_t idx;
+
+    if ((buffer == (uint8_t *)0) || ((half % PWC_BLK_SIZE) != PWC_CLEAR) ||
+        (half < (PWC_BLK_SIZE * 2u)))
+    {
+        return MSS_MMC_INVALID_PARAMETER;
+    }
+
+    for (idx = 0u; idx < PWC_BATCHES; idx++)
+    {
+        g_pwc_batch[idx].buffer = buffer + (half * idx);
+        pwc_reset_batch(&g_pwc_batch[idx]);
+    }
+
+    g_pwc_capacity = half - PWC_BLK_SIZE;
+    g_pwc_window = window;
+    g_pwc_fill = PWC_CLEAR;
+    g_pwc_busy = PWC_CLEAR;
+    g_pwc_error = MSS_MMC_TRANSFER_SUCCESS;
+
+    return MSS_MMC_NO_ERROR;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc_pwc.h" for details of how to use this function.
+ */
+mss_mmc_status_t
+MSS_MMC_pwc_write
+(
+    const uint8_t *src,
+    uint32_t dest,
+    uint32_t size
+)
+{
+    pwc_batch_t *batch;
+    uint8_t *entry;
+    uint8_t new_entry;
+    mss_mmc_status_t status = MSS_MMC_NO_ERROR;
+
+    if ((g_pwc_capacity == PWC_CLEAR) || (src == (const uint8_t *)0) ||
+        (size == PWC_CLEAR) || ((size % PWC_BLK_SIZE) != PWC_CLEAR) ||
+        (size > g_pwc_capacity))
+    {
+        return MSS_MMC_INVALID_PARAMETER;
+    }
+
+    (void)pwc_check_done(PWC_CLEAR);
+
+    batch = &g_pwc_batch[g_pwc_fill];
+    new_entry = ((batch->entries == PWC_CLEAR) || (dest != batch->next_sector)) ?
+                PWC_SET : PWC_CLEAR;
+
+    /* No room in this batch, send it and fill the other one */
+    if ((batch->entries != PWC_CLEAR) &&
+        (((batch->used + size) > g_pwc_capacity) ||
+         ((new_entry == PWC_SET) && (batch->entries >= MSS_MMC_PWC_MAX_ENTRIES))))
+    {
+        status = pwc_send();
+        batch = &g_pwc_batch[g_pwc_fill];
+        new_entry = PWC_SET;
+    }
+
+    if (MSS_MMC_NO_ERROR == status)
+    {
+        if (batch->entries == PWC_CLEAR)
+        {
+            (void)memset(batch->buffer, 0, PWC_BLK_SIZE);
+            batch->first_sector = dest;
+            batch->start_time = readmtime();
+        }
+
+        if (new_entry == PWC_SET)
+        {
+            batch->entries++;
+            batch->last_blocks = size / PWC_BLK_SIZE;
+            entry = &batch->buffer[batch->entries * PWC_HDR_ENTRY_SIZE];
+            /* CMD23 argument, block count */
+            pwc_put_word(entry, batch->last_blocks);
+            /* CMD25 argument, start sector */
+            pwc_put_word(&entry[4], dest);
+        }
+        else
+        {
+            /* Continues the last entry, extend its block count */
+            batch->last_blocks += size / PWC_BLK_SIZE;
+            entry = &batch->buffer[batch->entries * PWC_HDR_ENTRY_SIZE];
+            pwc_put_word(entry, batch->last_blocks);
+        }
+
+        (void)memcpy(&batch->buffer[PWC_BLK_SIZE + batch->used], src, size);
+        batch->used += size;
+        batch->next_sector = dest + (size / PWC_BLK_SIZE);
+    }
+
+    return status;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc_pwc.h" for details of how to use this function.
+ */
+void MSS_MMC_pwc_poll(void)
+{
+    pwc_batch_t *batch;
+
+    if ((g_pwc_capacity != PWC_CLEAR) && (pwc_check_done(PWC_CLEAR) == PWC_SET))
+    {
+        batch = &g_pwc_batch[g_pwc_fill];
+        if ((batch->entries != PWC_CLEAR) &&
+            ((readmtime() - batch->start_time) >= g_pwc_window))
+        {
+            (void)pwc_send();
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc_pwc.h" for details of how to use this function.
+ */
+mss_mmc_status_t MSS_MMC_pwc_flush(void)
+{
+    if (g_pwc_capacity == PWC_CLEAR)
+    {
+        return MSS_MMC_NOT_INITIALISED;
+    }
+
+    return pwc_send();
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See "mss_mmc_pwc.h" for details of how to use this function.
+ */
+mss_mmc_status_t MSS_MMC_pwc_sync(void)
+{
+    mss_mmc_status_t status;
+
+    if (g_pwc_capacity == PWC_CLEAR)
+    {
+        return MSS_MMC_NOT_INITIALISED;
+    }
+
+    (void)pwc_send();
+    (void)pwc_check_done(PWC_SET);
+
+    status = g_pwc_error;
+    g_pwc_error = MSS_MMC_TRANSFER_SUCCESS;
+
+    return status;
+}
+
+/*******************************************************************************
+ * Empties a batch.
+ */
+static void pwc_reset_batch(pwc_batch_t *batch)
+{
+    batch->used = PWC_CLEAR;
+    batch->entries = PWC_CLEAR;
+    batch->first_sector = PWC_CLEAR;
+    batch->next_sector = PWC_CLEAR;
+    batch->last_blocks = PWC_CLEAR;
+    batch->start_time = PWC_CLEAR;
+}
+
+/*******************************************************************************
+ * Stores a header word, least significant byte first.
+ */
+static void pwc_put_word(uint8_t *dest, uint32_t value)
+{
+    dest[0] = (uint8_t)value;
+    dest[1] = (uint8_t)(value >> 8u);
+    dest[2] = (uint8_t)(value >> 16u);
+    dest[3] = (uint8_t)(value >> 24u);
+}
+
+/*******************************************************************************
+ * Retires the batch being written once the eMMC driver has finished with it,
+ * waiting for it when wait is set. Returns 1 when no batch is being written.
+ */
+static uint8_t pwc_check_done(uint8_t wait)
+{
+    mss_mmc_status_t status;
+    uint8_t other = g_pwc_fill ^ PWC_SET;
+
+    if (g_pwc_busy == PWC_SET)
+    {
+        do
+        {
+            status = MSS_MMC_get_transfer_status();
+        } while ((wait == PWC_SET) && (MSS_MMC_TRANSFER_IN_PROGRESS == status));
+
+        if (MSS_MMC_TRANSFER_IN_PROGRESS != status)
+        {
+            if ((MSS_MMC_TRANSFER_SUCCESS != status) &&
+                (MSS_MMC_TRANSFER_SUCCESS == g_pwc_error))
+            {
+                g_pwc_error = status;
+            }
+            pwc_reset_batch(&g_pwc_batch[other]);
+            g_pwc_busy = PWC_CLEAR;
+        }
+    }
+
+    return (g_pwc_busy == PWC_CLEAR) ? PWC_SET : PWC_CLEAR;
+}
+
+/*******************************************************************************
+ * Sends the batch being filled and moves filling to the other batch, after
+ * waiting for it to be written.
+ */
+static mss_mmc_status_t pwc_send(void)
+{
+    pwc_batch_t *batch = &g_pwc_batch[g_pwc_fill];
+    mss_mmc_status_t status;
+
+    if (batch->entries == PWC_CLEAR)
+    {
+        return MSS_MMC_NO_ERROR;
+    }
+
+    (void)pwc_check_done(PWC_SET);
+
+    if (batch->entries == PWC_SET)
+    {
+        /* Nothing to pack, write the data on its own */
+        status = MSS_MMC_sdma_write(&batch->buffer[PWC_BLK_SIZE],
+                                    batch->first_sector, batch->used);
+    }
+    else
+    {
+        batch->buffer[0] = PWC_HDR_VERSION;
+        batch->buffer[1] = PWC_HDR_WRITE;
+        batch->buffer[2] = (uint8_t)batch->entries;
+        status = MSS_MMC_packed_write(batch->buffer, batch->first_sector,
+                                      batch->used + PWC_BLK_SIZE);
+    }
+
+    if (MSS_MMC_TRANSFER_IN_PROGRESS == status)
+    {
+        g_pwc_busy = PWC_SET;
+        g_pwc_fill ^= PWC_SET;
+        status = MSS_MMC_NO_ERROR;
+    }
+    else
+    {
+        /* Not started, the writes in the batch are lost */
+        if (MSS_MMC_TRANSFER_SUCCESS == g_pwc_error)
+        {
+            g_pwc_error = status;
+        }
+        pwc_reset_batch(batch);
+    }
+
+    return status;
+}
+
+#endif /* MSS_MMC_INTERNAL_APIS */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC MSS eMMC packed write coalescing public API.
+ *
+ */
+/*=========================================================================*//**
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The packed write coalescer sits on top of MSS_MMC_packed_write() and gathers
+  small writes to unrelated sectors into eMMC packed write commands. The eMMC
+  device receives one CMD23/CMD25 pair and one data transfer for the whole
+  group, instead of one command pair and one programming delay per write,
+  which raises the throughput of small random writes such as log records.
+
+  The coalescer uses MSS_MMC_packed_write(), so it is only available when
+  MSS_MMC_INTERNAL_APIS is defined.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  MSS_MMC_pwc_init() is called once after MSS_MMC_init(). It is given a
+  staging buffer, which it splits into two halves. Writes passed to
+  MSS_MMC_pwc_write() are copied into the half being filled, after the first
+  512 bytes which are kept for the packed command header. A write which
+  continues the previous one on the device is added to the previous entry.
+
+  The half being filled is sent to the device, and filling moves to the other
+  half, when:
+    - it has no room for the next write, or holds MSS_MMC_PWC_MAX_ENTRIES
+      entries,
+    - MSS_MMC_pwc_poll() is called and the first write in it is more than
+      the time window old,
+    - MSS_MMC_pwc_flush() or MSS_MMC_pwc_sync() is called.
+
+  A group holding a single entry is written with MSS_MMC_sdma_write(), without
+  a header. MSS_MMC_pwc_write() only waits when both halves are in use, that is
+  when the previous group is still being written.
+
+  The application must not start other transfers while the coalescer holds
+  data, and must call MSS_MMC_pwc_sync() before reading back sectors it has
+  just written, or before power is removed.
+
+ *//*=========================================================================*/
+#ifndef __MSS_MMC_PWC_H
+#define __MSS_MMC_PWC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "mss_mmc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MSS_MMC_INTERNAL_APIS
+
+/*-------------------------------------------------------------------------*//**
+  Largest number of writes in one packed command. It must not be greater than
+  the MAX_PACKED_WRITES field of the device's extended CSD register, or 63.
+ */
+#ifndef MSS_MMC_PWC_MAX_ENTRIES
+#define MSS_MMC_PWC_MAX_ENTRIES         8u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_pwc_init() function sets up the coalescer.
+
+  @param buffer
+  The staging buffer. It must be 4 byte aligned.
+
+  @param size
+  The size of the staging buffer in bytes. It must be a multiple of 1024 and
+  hold at least two 512 byte headers and two blocks.
+
+  @param window
+  The longest time, in mtime ticks, that a write is held before
+  MSS_MMC_pwc_poll() sends it.
+
+  @return
+  This function returns MSS_MMC_NO_ERROR, or MSS_MMC_INVALID_PARAMETER if the
+  buffer is not valid.
+ */
+mss_mmc_status_t
+MSS_MMC_pwc_init
+(
+    uint8_t *buffer,
+    uint32_t size,
+    uint64_t window
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_pwc_write() function copies a write into the staging buffer. The
+  src buffer may be reused as soon as the function returns.
+
+  @param src
+  The data to be written.
+
+  @param dest
+  The first sector to be written.
+
+  @param size
+  The size in bytes. It must be a multiple of 512 and no greater than half the
+  staging buffer less the 512 byte header.
+
+  @return
+  This function returns MSS_MMC_NO_ERROR when the write has been accepted,
+  MSS_MMC_INVALID_PARAMETER if it is not valid, or the error returned by the
+  eMMC driver when a group could not be started.
+
+  Example:
+  @code
+    static uint8_t g_pwc_buffer[2u * 16384u];
+
+    MSS_MMC_pwc_init(g_pwc_buffer, sizeof(g_pwc_buffer), 10000u);
+
+    for (;;)
+    {
+        if (record_ready())
+        {
+            (void)MSS_MMC_pwc_write(record, record_sector(), 512u);
+        }
+        MSS_MMC_pwc_poll();
+    }
+  @endcode
+ */
+mss_mmc_status_t
+MSS_MMC_pwc_write
+(
+    const uint8_t *src,
+    uint32_t dest,
+    uint32_t size
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_pwc_poll() function sends the group being filled when its first
+  write is older than the time window and the device is idle. It should be
+  called regularly, for example from the main loop.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_MMC_pwc_poll(void);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_pwc_flush() function sends the group being filled straight away,
+  waiting for the previous group if it is still being written.
+
+  @return
+  This function returns MSS_MMC_NO_ERROR, or the error returned by the eMMC
+  driver when the group could not be started.
+ */
+mss_mmc_status_t MSS_MMC_pwc_flush(void);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_MMC_pwc_sync() function sends the group being filled and waits until
+  all the accepted writes have been written.
+
+  @return
+  This function returns MSS_MMC_TRANSFER_SUCCESS, or the first error seen
+  since the previous call to MSS_MMC_pwc_sync().
+ */
+mss_mmc_status_t MSS_MMC_pwc_sync(void);
+
+#endif /* MSS_MMC_INTERNAL_APIS */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __MSS_MMC_PWC_H */
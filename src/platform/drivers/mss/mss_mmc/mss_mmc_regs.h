@@ -282,6 +282,8 @@ typedef struct {
 #define SRS10_EXTENDED_DATA_TRANSFER_WIDTH     0x00000020u
 /* High speed enable. */
 #define SRS10_HIGH_SPEED_ENABLE             0x00000004u
+/* Stop at block gap request. */
+#define SRS10_STOP_AT_BLOCK_GAP             0x00010000u
 /* Turning on the LED.*/
 #define SRS10_TURN_ON_LED                   0x00000001u
 /*-----------------------------------------------------------------------------
@@ -101,6 +101,14 @@ static void global_init(mss_uart_instance_t * this_uart, uint32_t baud_rate,
                                                          uint8_t line_config);
 static void uart_isr(mss_uart_instance_t * this_uart);
 static void default_tx_handler(mss_uart_instance_t * this_uart);
+static void ring_tx_handler(mss_uart_instance_t * this_uart);
+static void ring_rx_handler(mss_uart_instance_t * this_uart);
+static void block_tx_handler(mss_uart_instance_t * this_uart);
+static void block_rx_handler(mss_uart_instance_t * this_uart);
+static void block_rto_handler(mss_uart_instance_t * this_uart);
+static void block_rx_done(mss_uart_instance_t * this_uart);
+static void frame_rx_handler(mss_uart_instance_t * this_uart);
+static void frame_rto_handler(mss_uart_instance_t * this_uart);
 static void enable_irq(const mss_uart_instance_t * this_uart);
 static void disable_irq(const mss_uart_instance_t * this_uart);
 static void config_baud_divisors
@@ -385,6 +393,7 @@ MSS_UART_tx_complete
     this_uart->status |= status;
 
     if ((TX_COMPLETE == this_uart->tx_buff_size) &&
+       (this_uart->tx_ring_head == this_uart->tx_ring_tail) &&
        ((status & MSS_UART_TEMT) != 0u))
     {
         ret_value = (int8_t)1;
@@ -427,6 +436,399 @@ MSS_UART_get_rx
     return rx_size;
 }
 
+/***************************************************************************//**
+ * See mss_uart.h for details of how to use this function.
+ */
+void
+MSS_UART_set_tx_ring
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t * buffer,
+    uint32_t size
+)
+{
+    ASSERT(buffer != ((uint8_t*)0));
+    ASSERT(size > 1u);
+
+    if ((buffer != ((uint8_t*)0)) && (size > 1u))
+    {
+        /* disables TX interrupt while the ring is set up */
+        this_uart->hw_reg->IER &= ~ETBEI_MASK;
+
+        this_uart->tx_ring = buffer;
+        this_uart->tx_ring_size = size;
+        this_uart->tx_ring_head = 0u;
+        this_uart->tx_ring_tail = 0u;
+
+        this_uart->tx_buff_size = TX_COMPLETE;
+        this_uart->tx_handler = ring_tx_handler;
+
+        enable_irq(this_uart);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_uart.h for details of how to use this function.
+ */
+uint32_t
+MSS_UART_ring_tx
+(
+    mss_uart_instance_t * this_uart,
+    const uint8_t * pbuff,
+    uint32_t tx_size
+)
+{
+    uint32_t head;
+    uint32_t next;
+    uint32_t copied = 0u;
+
+    ASSERT(pbuff != ((uint8_t*)0));
+    ASSERT(this_uart->tx_ring != ((uint8_t*)0));
+
+    if ((pbuff != ((uint8_t*)0)) && (this_uart->tx_ring != ((uint8_t*)0)))
+    {
+        head = this_uart->tx_ring_head;
+
+        while (copied < tx_size)
+        {
+            next = head + 1u;
+            if (next == this_uart->tx_ring_size)
+            {
+                next = 0u;
+            }
+
+            /* Ring full */
+            if (next == this_uart->tx_ring_tail)
+            {
+                break;
+            }
+
+            this_uart->tx_ring[head] = pbuff[copied];
+            ++copied;
+            head = next;
+        }
+
+        if (copied > 0u)
+        {
+            /* Publish the data before the THRE handler can see the new head */
+            mb();
+            this_uart->tx_ring_head = head;
+
+            /* enables TX interrupt, the handler disables it when the ring is
+             * empty */
+            this_uart->hw_reg->IER |= ETBEI_MASK;
+        }
+    }
+
+    return copied;
+}
+
+/***************************************************************************//**
+ * See mss_uart.h for details of how to use this function.
+ */
+void
+MSS_UART_set_rx_ring
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t * buffer,
+    uint32_t size,
+    mss_uart_rx_trig_level_t trigger_level
+)
+{
+    ASSERT(buffer != ((uint8_t*)0));
+    ASSERT(size > 1u);
+    ASSERT(trigger_level < MSS_UART_FIFO_INVALID_TRIG_LEVEL);
+
+    if ((buffer != ((uint8_t*)0)) && (size > 1u) &&
+       (trigger_level < MSS_UART_FIFO_INVALID_TRIG_LEVEL))
+    {
+        this_uart->rx_ring = buffer;
+        this_uart->rx_ring_size = size;
+        this_uart->rx_ring_head = 0u;
+        this_uart->rx_ring_tail = 0u;
+        this_uart->rx_ring_overflow = 0u;
+
+        this_uart->rx_handler = ring_rx_handler;
+
+        /* Set the receive interrupt trigger level. */
+        this_uart->hw_reg->FCR = (this_uart->hw_reg->FCR &
+                                 (uint8_t)(~((uint8_t)FCR_TRIG_LEVEL_MASK))) |
+                                 (uint8_t)trigger_level;
+
+        /* Enable receive interrupt. */
+        this_uart->hw_reg->IER |= ERBFI_MASK;
+
+        enable_irq(this_uart);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_uart.h for details of how to use this function.
+ */
+size_t
+MSS_UART_ring_rx
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t * rx_buff,
+    size_t buff_size
+)
+{
+    size_t rx_size = 0u;
+    uint32_t tail;
+    uint32_t head;
+
+    ASSERT(rx_buff != ((uint8_t*)0));
+    ASSERT(this_uart->rx_ring != ((uint8_t*)0));
+
+    if ((rx_buff != ((uint8_t*)0)) && (this_uart->rx_ring != ((uint8_t*)0)))
+    {
+        tail = this_uart->rx_ring_tail;
+        head = this_uart->rx_ring_head;
+
+        /* Read the head before the data it covers */
+        mb();
+
+        while ((tail != head) && (rx_size < buff_size))
+        {
+            rx_buff[rx_size] = this_uart->rx_ring[tail];
+            ++rx_size;
+            ++tail;
+            if (tail == this_uart->rx_ring_size)
+            {
+                tail = 0u;
+            }
+        }
+
+        this_uart->rx_ring_tail = tail;
+    }
+
+    return rx_size;
+}
+
+/***************************************************************************//**
+ * See mss_uart.h for details of how to use this function.
+ */
+void
+MSS_UART_set_dma_engine
+(
+    mss_uart_instance_t * this_uart,
+    const mss_uart_dma_engine_t * engine
+)
+{
+    this_uart->dma_engine = engine;
+}
+
+/***************************************************************************//**
+ * See mss_uart.h for details of how to use this function.
+ */
+uint8_t
+MSS_UART_dma_tx
+(
+    mss_uart_instance_t * this_uart,
+    const uint8_t * pbuff,
+    uint32_t tx_size,
+    mss_uart_block_handler_t handler
+)
+{
+    const mss_uart_dma_engine_t * engine = this_uart->dma_engine;
+
+    ASSERT(pbuff != ((uint8_t*)0));
+    ASSERT(tx_size > 0u);
+
+    if ((pbuff == ((uint8_t*)0)) || (0u == tx_size) ||
+       (TX_COMPLETE != this_uart->tx_buff_size))
+    {
+        return 0u;
+    }
+
+    this_uart->dma_tx_handler = handler;
+    this_uart->dma_tx_size = tx_size;
+
+    if (engine != ((const mss_uart_dma_engine_t *)0))
+    {
+        /* tx_buff_size marks the transmit as busy for MSS_UART_tx_complete() */
+        this_uart->tx_buff_size = tx_size;
+
+        if (0u == engine->start(engine->p_context, (uint64_t)pbuff,
+                                (uint64_t)&this_uart->hw_reg->THR, tx_size, 1u))
+        {
+            this_uart->tx_buff_size = TX_COMPLETE;
+            return 0u;
+        }
+    }
+    else
+    {
+        this_uart->tx_buffer = pbuff;
+        this_uart->tx_buff_size = tx_size;
+        this_uart->tx_idx = 0u;
+
+        this_uart->tx_handler = block_tx_handler;
+
+        /* enables TX interrupt */
+        this_uart->hw_reg->IER |= ETBEI_MASK;
+        enable_irq(this_uart);
+    }
+
+    return 1u;
+}
+
+/***************************************************************************//**
+ * See mss_uart.h for details of how to use this function.
+ */
+uint8_t
+MSS_UART_dma_rx
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t * rx_buff,
+    uint32_t buff_size,
+    uint8_t timeout,
+    mss_uart_block_handler_t handler
+)
+{
+    const mss_uart_dma_engine_t * engine = this_uart->dma_engine;
+
+    ASSERT(rx_buff != ((uint8_t*)0));
+    ASSERT(buff_size > 0u);
+    ASSERT(handler != ((mss_uart_block_handler_t)0));
+
+    if ((rx_buff == ((uint8_t*)0)) || (0u == buff_size) ||
+       (handler == ((mss_uart_block_handler_t)0)) ||
+       (this_uart->dma_rx_buffer != ((uint8_t*)0)))
+    {
+        return 0u;
+    }
+
+    this_uart->dma_rx_handler = handler;
+    this_uart->dma_rx_size = buff_size;
+    this_uart->dma_rx_idx = 0u;
+    this_uart->dma_rx_buffer = rx_buff;
+
+    if (0u != timeout)
+    {
+        this_uart->rto_handler = block_rto_handler;
+        MSS_UART_enable_rx_timeout(this_uart, timeout);
+
+        /* Enable receiver timeout interrupt. */
+        this_uart->hw_reg->IEM |= ERTOI_MASK;
+    }
+    else
+    {
+        this_uart->hw_reg->IEM &= ~ERTOI_MASK;
+    }
+
+    if (engine != ((const mss_uart_dma_engine_t *)0))
+    {
+        if (0u == engine->start(engine->p_context,
+                                (uint64_t)&this_uart->hw_reg->RBR,
+                                (uint64_t)rx_buff, buff_size, 0u))
+        {
+            this_uart->hw_reg->IEM &= ~ERTOI_MASK;
+            this_uart->dma_rx_buffer = (uint8_t*)0;
+            return 0u;
+        }
+    }
+    else
+    {
+        this_uart->rx_handler = block_rx_handler;
+
+        /* Interrupt once per 14 bytes, the character time-out picks up the
+         * remainder */
+        this_uart->hw_reg->FCR = (this_uart->hw_reg->FCR &
+                                 (uint8_t)(~((uint8_t)FCR_TRIG_LEVEL_MASK))) |
+                                 (uint8_t)MSS_UART_FIFO_FOURTEEN_BYTES;
+
+        /* Enable receive interrupt. */
+        this_uart->hw_reg->IER |= ERBFI_MASK;
+    }
+
+    enable_irq(this_uart);
+
+    return 1u;
+}
+
+/***************************************************************************//**
+ * See mss_uart.h for details of how to use this function.
+ */
+void
+MSS_UART_dma_complete
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t to_uart,
+    uint32_t count
+)
+{
+    mss_uart_block_handler_t handler;
+
+    if (0u != to_uart)
+    {
+        this_uart->tx_buff_size = TX_COMPLETE;
+
+        handler = this_uart->dma_tx_handler;
+        if (handler != ((mss_uart_block_handler_t)0))
+        {
+            handler(this_uart, count);
+        }
+    }
+    else if (this_uart->dma_rx_buffer != ((uint8_t*)0))
+    {
+        this_uart->dma_rx_idx = count;
+        block_rx_done(this_uart);
+    }
+    else
+    {
+        /* No receive block in progress, e.g. already completed by the
+         * receiver time-out */
+    }
+}
+
+/***************************************************************************//**
+ * See mss_uart.h for details of how to use this function.
+ */
+void
+MSS_UART_set_frame_mode
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t * buffer,
+    uint32_t buff_size,
+    uint8_t timeout,
+    mss_uart_rx_trig_level_t trigger_level,
+    mss_uart_frame_handler_t handler
+)
+{
+    ASSERT(buffer != ((uint8_t*)0));
+    ASSERT(buff_size > 0u);
+    ASSERT(timeout > 0u);
+    ASSERT(trigger_level < MSS_UART_FIFO_INVALID_TRIG_LEVEL);
+    ASSERT(handler != ((mss_uart_frame_handler_t)0));
+
+    if ((buffer != ((uint8_t*)0)) && (buff_size > 0u) && (timeout > 0u) &&
+       (trigger_level < MSS_UART_FIFO_INVALID_TRIG_LEVEL) &&
+       (handler != ((mss_uart_frame_handler_t)0)))
+    {
+        this_uart->frame_buffer = buffer;
+        this_uart->frame_size = buff_size;
+        this_uart->frame_len = 0u;
+        this_uart->frame_overflow = 0u;
+        this_uart->frame_handler = handler;
+
+        this_uart->rx_handler = frame_rx_handler;
+        this_uart->rto_handler = frame_rto_handler;
+
+        /* Set the receive interrupt trigger level. */
+        this_uart->hw_reg->FCR = (this_uart->hw_reg->FCR &
+                                 (uint8_t)(~((uint8_t)FCR_TRIG_LEVEL_MASK))) |
+                                 (uint8_t)trigger_level;
+
+        MSS_UART_enable_rx_timeout(this_uart, timeout);
+
+        /* Enable receive and receiver timeout interrupts. */
+        this_uart->hw_reg->IER |= ERBFI_MASK;
+        this_uart->hw_reg->IEM |= ERTOI_MASK;
+
+        enable_irq(this_uart);
+    }
+}
+
 /***************************************************************************//**
  * See mss_uart.h for details of how to use this function.
  */
@@ -1330,6 +1732,38 @@ MSS_UART_enable_local_irq
     __enable_local_irq((int8_t)MMUART0_E51_INT);
 }
 
+/***************************************************************************//**
+ * See mss_uart.h for details of how to use this function.
+ */
+void
+MSS_UART_clock_notify
+(
+    uint8_t event,
+    const mss_clk_change_t * change,
+    void * arg
+)
+{
+    mss_uart_instance_t * this_uart = (mss_uart_instance_t *)arg;
+
+    (void)change;
+
+    if (MSS_CLK_PRE_CHANGE == event)
+    {
+        while (0u == (MSS_UART_get_tx_status(this_uart) & MSS_UART_TEMT))
+        {
+            ;
+        }
+    }
+    else if (0u != this_uart->baudrate)
+    {
+        config_baud_divisors(this_uart, this_uart->baudrate);
+    }
+    else
+    {
+        ;
+    }
+}
+
 /*******************************************************************************
  * Local Functions
  ******************************************************************************/
@@ -1489,6 +1923,32 @@ static void global_init
 
     this_uart->local_irq_enabled = 0u;
 
+    this_uart->tx_ring          = (uint8_t*)0;
+    this_uart->tx_ring_size     = 0u;
+    this_uart->tx_ring_head     = 0u;
+    this_uart->tx_ring_tail     = 0u;
+    this_uart->rx_ring          = (uint8_t*)0;
+    this_uart->rx_ring_size     = 0u;
+    this_uart->rx_ring_head     = 0u;
+    this_uart->rx_ring_tail     = 0u;
+    this_uart->rx_ring_overflow = 0u;
+
+    this_uart->dma_engine       = (const mss_uart_dma_engine_t *)0;
+    this_uart->dma_tx_handler   = (mss_uart_block_handler_t)0;
+    this_uart->dma_rx_handler   = (mss_uart_block_handler_t)0;
+    this_uart->dma_tx_size      = 0u;
+    this_uart->dma_rx_buffer    = (uint8_t*)0;
+    this_uart->dma_rx_size      = 0u;
+    this_uart->dma_rx_idx       = 0u;
+
+    this_uart->frame_handler    = (mss_uart_frame_handler_t)0;
+    this_uart->frame_buffer     = (uint8_t*)0;
+    this_uart->frame_size       = 0u;
+    this_uart->frame_len        = 0u;
+    this_uart->frame_overflow   = 0u;
+    this_uart->frame_first_time = 0u;
+    this_uart->frame_last_time  = 0u;
+
     /* Initialize the sticky status */
     this_uart->status = 0u;
 }
@@ -1511,7 +1971,7 @@ config_baud_divisors
 
     this_uart->baudrate = baudrate;
 
-    pclk_freq = LIBERO_SETTING_MSS_APB_AHB_CLK;
+    pclk_freq = mss_clk_apb_hz();
 
     /*
      * Compute baud value based on requested baud rate and PCLK frequency.
@@ -1759,6 +2219,297 @@ default_tx_handler
     }
 }
 
+/***************************************************************************//**
+ * THRE handler used with MSS_UART_set_tx_ring(). The FIFO is empty when the
+ * interrupt fires, so it is filled completely from the ring in one pass.
+ */
+static void
+ring_tx_handler
+(
+    mss_uart_instance_t * this_uart
+)
+{
+    uint8_t status;
+    uint32_t cnt = 0u;
+    uint32_t tail = this_uart->tx_ring_tail;
+    uint32_t head = this_uart->tx_ring_head;
+
+    /* Read the Line Status Register and update the sticky record. */
+    status = this_uart->hw_reg->LSR;
+    this_uart->status |= status;
+
+    if (status & MSS_UART_THRE)
+    {
+        /* Read the head before the data it covers */
+        mb();
+
+        while ((tail != head) && (cnt < TX_FIFO_SIZE))
+        {
+            this_uart->hw_reg->THR = this_uart->tx_ring[tail];
+            ++cnt;
+            ++tail;
+            if (tail == this_uart->tx_ring_size)
+            {
+                tail = 0u;
+            }
+        }
+
+        this_uart->tx_ring_tail = tail;
+    }
+
+    if (tail == this_uart->tx_ring_head)
+    {
+        /* disables TX interrupt, MSS_UART_ring_tx() enables it again */
+        this_uart->hw_reg->IER &= ~ETBEI_MASK;
+
+        /* Catch data added after the head was checked */
+        if (tail != this_uart->tx_ring_head)
+        {
+            this_uart->hw_reg->IER |= ETBEI_MASK;
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Receive handler used with MSS_UART_set_rx_ring(). Empties the receive FIFO
+ * into the ring.
+ */
+static void
+ring_rx_handler
+(
+    mss_uart_instance_t * this_uart
+)
+{
+    uint8_t status;
+    uint8_t data_byte;
+    uint32_t head = this_uart->rx_ring_head;
+    uint32_t next;
+
+    status = this_uart->hw_reg->LSR;
+    this_uart->status |= status;
+
+    while ((status & MSS_UART_DATA_READY) != 0u)
+    {
+        data_byte = this_uart->hw_reg->RBR;
+
+        next = head + 1u;
+        if (next == this_uart->rx_ring_size)
+        {
+            next = 0u;
+        }
+
+        if (next == this_uart->rx_ring_tail)
+        {
+            ++this_uart->rx_ring_overflow;
+        }
+        else
+        {
+            this_uart->rx_ring[head] = data_byte;
+            head = next;
+        }
+
+        status = this_uart->hw_reg->LSR;
+        this_uart->status |= status;
+    }
+
+    /* Publish the data before MSS_UART_ring_rx() can see the new head */
+    mb();
+    this_uart->rx_ring_head = head;
+}
+
+/***************************************************************************//**
+ * THRE handler used by MSS_UART_dma_tx() when no DMA engine is selected.
+ */
+static void
+block_tx_handler
+(
+    mss_uart_instance_t * this_uart
+)
+{
+    mss_uart_block_handler_t handler;
+
+    default_tx_handler(this_uart);
+
+    if (TX_COMPLETE == this_uart->tx_buff_size)
+    {
+        handler = this_uart->dma_tx_handler;
+        if (handler != ((mss_uart_block_handler_t)0))
+        {
+            handler(this_uart, this_uart->dma_tx_size);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Receive handler used by MSS_UART_dma_rx() when no DMA engine is selected.
+ * Empties the receive FIFO into the block and completes it when full. Bytes
+ * beyond the end of the block are left in the FIFO for the next block.
+ */
+static void
+block_rx_handler
+(
+    mss_uart_instance_t * this_uart
+)
+{
+    uint8_t status;
+    uint32_t idx = this_uart->dma_rx_idx;
+
+    if (this_uart->dma_rx_buffer == ((uint8_t*)0))
+    {
+        /* No block in progress, stop further receive interrupts */
+        this_uart->hw_reg->IER &= ~ERBFI_MASK;
+        return;
+    }
+
+    status = this_uart->hw_reg->LSR;
+    this_uart->status |= status;
+
+    while (((status & MSS_UART_DATA_READY) != 0u) &&
+           (idx < this_uart->dma_rx_size))
+    {
+        this_uart->dma_rx_buffer[idx] = this_uart->hw_reg->RBR;
+        ++idx;
+
+        status = this_uart->hw_reg->LSR;
+        this_uart->status |= status;
+    }
+
+    this_uart->dma_rx_idx = idx;
+
+    if (idx == this_uart->dma_rx_size)
+    {
+        block_rx_done(this_uart);
+    }
+}
+
+/***************************************************************************//**
+ * Receiver time-out handler used by MSS_UART_dma_rx(). Completes a partially
+ * filled block once the line has gone idle.
+ */
+static void
+block_rto_handler
+(
+    mss_uart_instance_t * this_uart
+)
+{
+    const mss_uart_dma_engine_t * engine = this_uart->dma_engine;
+
+    if (this_uart->dma_rx_buffer == ((uint8_t*)0))
+    {
+        return;
+    }
+
+    if (engine != ((const mss_uart_dma_engine_t *)0))
+    {
+        this_uart->dma_rx_idx = engine->stop(engine->p_context, 0u);
+    }
+
+    /* Collect anything still in the FIFO; the engine, if any, is stopped. */
+    block_rx_handler(this_uart);
+
+    if ((this_uart->dma_rx_buffer != ((uint8_t*)0)) &&
+        (this_uart->dma_rx_idx > 0u))
+    {
+        block_rx_done(this_uart);
+    }
+}
+
+/***************************************************************************//**
+ * Ends the receive block in progress and calls its completion handler, which
+ * may start the next block.
+ */
+static void
+block_rx_done
+(
+    mss_uart_instance_t * this_uart
+)
+{
+    uint32_t count = this_uart->dma_rx_idx;
+
+    this_uart->hw_reg->IER &= ~ERBFI_MASK;
+    this_uart->hw_reg->IEM &= ~ERTOI_MASK;
+    this_uart->dma_rx_buffer = (uint8_t*)0;
+
+    this_uart->dma_rx_handler(this_uart, count);
+}
+
+/***************************************************************************//**
+ * Receive handler used by MSS_UART_set_frame_mode(). Empties the receive FIFO
+ * into the frame buffer and timestamps the block.
+ */
+static void
+frame_rx_handler
+(
+    mss_uart_instance_t * this_uart
+)
+{
+    uint8_t status;
+    uint8_t data_byte;
+    uint32_t len = this_uart->frame_len;
+    uint64_t now;
+
+    status = this_uart->hw_reg->LSR;
+    this_uart->status |= status;
+
+    if ((status & MSS_UART_DATA_READY) == 0u)
+    {
+        return;
+    }
+
+    now = readmtime();
+    if (0u == len)
+    {
+        this_uart->frame_first_time = now;
+    }
+    this_uart->frame_last_time = now;
+
+    while ((status & MSS_UART_DATA_READY) != 0u)
+    {
+        data_byte = this_uart->hw_reg->RBR;
+
+        if (len < this_uart->frame_size)
+        {
+            this_uart->frame_buffer[len] = data_byte;
+            ++len;
+        }
+        else
+        {
+            this_uart->frame_overflow = 1u;
+        }
+
+        status = this_uart->hw_reg->LSR;
+        this_uart->status |= status;
+    }
+
+    this_uart->frame_len = len;
+}
+
+/***************************************************************************//**
+ * Receiver time-out handler used by MSS_UART_set_frame_mode(). The line has
+ * gone idle, so the current frame is complete.
+ */
+static void
+frame_rto_handler
+(
+    mss_uart_instance_t * this_uart
+)
+{
+    /* Collect anything below the trigger level still in the FIFO. */
+    frame_rx_handler(this_uart);
+
+    if ((this_uart->frame_len > 0u) || (0u != this_uart->frame_overflow))
+    {
+        this_uart->frame_handler(this_uart, this_uart->frame_buffer,
+                                 this_uart->frame_len,
+                                 this_uart->frame_overflow,
+                                 this_uart->frame_first_time,
+                                 this_uart->frame_last_time);
+
+        this_uart->frame_len = 0u;
+        this_uart->frame_overflow = 0u;
+    }
+}
+
 static void
 enable_irq
 (
@@ -289,6 +289,57 @@
   called by the driver whenever receive data is available. You must provide this
   receive handler function which must include a call to the MSS_UART_get_rx()
   function to actually read the received data.
+
+  Driver Managed Ring Buffers
+  As an alternative to MSS_UART_irq_tx() and a user receive handler, the
+  application can give the driver a transmit ring buffer with
+  MSS_UART_set_tx_ring() and a receive ring buffer with MSS_UART_set_rx_ring().
+  MSS_UART_ring_tx() copies as much data as fits into the transmit ring and
+  returns straight away, so it can be called at any time, including while a
+  previous transmit is still in progress. The driver's THRE handler refills the
+  whole transmit FIFO from the ring each time it empties. The driver's receive
+  handler empties the receive FIFO into the receive ring, from where the data
+  is read with MSS_UART_ring_rx(). Each ring has a single producer and a single
+  consumer, so MSS_UART_ring_tx() and MSS_UART_ring_rx() must not be called from
+  more than one context at a time for the same UART.
+  Note: MSS_UART_irq_tx(), MSS_UART_set_tx_handler() and
+        MSS_UART_set_rx_handler() replace the ring handlers.
+
+  Bulk Block Transfers
+  MSS_UART_dma_tx() and MSS_UART_dma_rx() move a whole block of data and call a
+  completion handler, of type mss_uart_block_handler_t, when it is done. They
+  are intended for high baud rate transfers such as YMODEM image loads.
+  The MSS PDMA cannot service the UART FIFOs: it has no peripheral request
+  lines and always increments both addresses. By default the driver therefore
+  moves the data from its interrupt handlers, a full transmit FIFO per THRE
+  interrupt and a full receive FIFO per receive interrupt, with the receive
+  trigger level set to 14 bytes.
+  A fabric DMA controller which can be paced by the UART's TXRDY and RXRDY
+  signals can be given to the driver with MSS_UART_set_dma_engine(). The driver
+  then programs the block transfers through the mss_uart_dma_engine_t
+  functions, and the DMA controller's driver reports each completed block by
+  calling MSS_UART_dma_complete(). The TXRDY and RXRDY signal mode is set with
+  MSS_UART_set_ready_mode().
+  When MSS_UART_dma_rx() is called with a non-zero timeout, the receiver
+  time-out is enabled and a partially filled block is completed once the line
+  has been idle for the time-out period. This allows the last, short, block of
+  a transfer to be delivered without waiting for the buffer to fill.
+  Note: MSS_UART_dma_tx() uses the same transmit state as MSS_UART_irq_tx(),
+        and MSS_UART_dma_rx() replaces the receive and receiver time-out
+        handlers.
+
+  Idle Line Framing
+  For protocols such as Modbus RTU, where a frame ends when the line goes
+  idle, MSS_UART_set_frame_mode() makes the driver collect received data into
+  a frame buffer and call a frame handler once the receiver time-out expires.
+  The receive interrupt handler empties the whole receive FIFO each time it
+  runs, and reads mtime once per FIFO block rather than once per byte. The
+  frame handler is given the mtime value of the first and of the last block of
+  the frame; the time between the last block of one frame and the first block
+  of the next gives the inter-frame gap. A lower receive trigger level gives
+  more accurate timestamps at the cost of more interrupts.
+  Note: MSS_UART_set_frame_mode() replaces the receive and receiver time-out
+        handlers.
   
   -----------
   UART Status
@@ -316,6 +367,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include "mpfs_hal/common/mss_clk_scale.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -686,6 +738,56 @@ typedef struct  mss_uart_instance mss_uart_instance_t;
  */
 typedef void (*mss_uart_irq_handler_t)( mss_uart_instance_t * this_uart );
 
+/***************************************************************************//**
+  Block transfer completion handler prototype.
+  This typedef specifies the function prototype for the completion handlers
+  passed to MSS_UART_dma_tx() and MSS_UART_dma_rx(). The count parameter is the
+  number of bytes transferred. It is less than the block size for a receive
+  block completed by the receiver time-out.
+ */
+typedef void (*mss_uart_block_handler_t)( mss_uart_instance_t * this_uart,
+                                           uint32_t count );
+
+/***************************************************************************//**
+  Fabric DMA engine used for block transfers.
+  This structure is filled in by the driver of a fabric DMA controller and
+  passed to MSS_UART_set_dma_engine().
+
+  The start function starts a transfer of length bytes from src to dest. When
+  to_uart is non-zero, dest is the address of the UART THR register and only
+  src increments; otherwise src is the address of the RBR register and only
+  dest increments. It returns non-zero if the transfer was started.
+
+  The stop function stops a receive (to_uart zero) or transmit transfer and
+  returns the number of bytes moved so far.
+
+  The p_context value is passed to both functions.
+ */
+/***************************************************************************//**
+  Frame handler prototype.
+  This typedef specifies the function prototype for the frame handler passed
+  to MSS_UART_set_frame_mode(). The frame parameter points to the driver's
+  frame buffer, which is reused for the next frame once the handler returns.
+  The length parameter is the number of bytes stored, and overflow is non-zero
+  if bytes were lost because the frame did not fit in the buffer. The
+  first_time and last_time parameters are the mtime values read when the first
+  and the last block of the frame were taken from the receive FIFO.
+ */
+typedef void (*mss_uart_frame_handler_t)( mss_uart_instance_t * this_uart,
+                                           const uint8_t * frame,
+                                           uint32_t length,
+                                           uint8_t overflow,
+                                           uint64_t first_time,
+                                           uint64_t last_time );
+
+typedef struct mss_uart_dma_engine
+{
+    uint8_t (*start)(void * p_context, uint64_t src, uint64_t dest,
+                     uint32_t length, uint8_t to_uart);
+    uint32_t (*stop)(void * p_context, uint8_t to_uart);
+    void * p_context;
+} mss_uart_dma_engine_t;
+
 /*----------------------------------------------------------------------------*/
 /*----------------------------------- UART -----------------------------------*/
 /*----------------------------------------------------------------------------*/
@@ -804,6 +906,35 @@ struct mss_uart_instance{
     uint8_t                local_irq_enabled;  /*!< check if local interrupt were enabled on this instance*/
     void* user_data;                          /*!< Pointer to user provided pointer for user specific use. */
 
+    /* driver managed ring buffers (used with MSS_UART_set_tx_ring() and MSS_UART_set_rx_ring()): */
+    uint8_t *           tx_ring;            /*!< Transmit ring storage. */
+    uint32_t            tx_ring_size;       /*!< Transmit ring size in bytes. */
+    volatile uint32_t   tx_ring_head;       /*!< Index of next byte written by MSS_UART_ring_tx(). */
+    volatile uint32_t   tx_ring_tail;       /*!< Index of next byte sent by the THRE handler. */
+    uint8_t *           rx_ring;            /*!< Receive ring storage. */
+    uint32_t            rx_ring_size;       /*!< Receive ring size in bytes. */
+    volatile uint32_t   rx_ring_head;       /*!< Index of next byte written by the receive handler. */
+    volatile uint32_t   rx_ring_tail;       /*!< Index of next byte read by MSS_UART_ring_rx(). */
+    volatile uint32_t   rx_ring_overflow;   /*!< Bytes dropped because the receive ring was full. */
+
+    /* block transfers (used with MSS_UART_dma_tx() and MSS_UART_dma_rx()): */
+    const mss_uart_dma_engine_t * dma_engine;   /*!< Fabric DMA engine, or NULL for driver interrupt handling. */
+    mss_uart_block_handler_t dma_tx_handler;    /*!< Transmit block completion handler. */
+    mss_uart_block_handler_t dma_rx_handler;    /*!< Receive block completion handler. */
+    uint32_t            dma_tx_size;        /*!< Size of the transmit block in progress. */
+    uint8_t *           dma_rx_buffer;      /*!< Receive block buffer, NULL when no receive block is in progress. */
+    uint32_t            dma_rx_size;        /*!< Receive block size. */
+    volatile uint32_t   dma_rx_idx;         /*!< Number of bytes received into the block. */
+
+    /* idle line framing (used with MSS_UART_set_frame_mode()): */
+    mss_uart_frame_handler_t frame_handler;     /*!< Frame handler. */
+    uint8_t *           frame_buffer;       /*!< Frame buffer. */
+    uint32_t            frame_size;         /*!< Frame buffer size. */
+    uint32_t            frame_len;          /*!< Bytes in the current frame. */
+    uint8_t             frame_overflow;     /*!< Bytes were lost from the current frame. */
+    uint64_t            frame_first_time;   /*!< mtime of the first block of the current frame. */
+    uint64_t            frame_last_time;    /*!< mtime of the last block of the current frame. */
+
 };
 
 /***************************************************************************//**
@@ -1558,6 +1689,366 @@ MSS_UART_get_rx
    size_t buff_size
 );
 
+/***************************************************************************//**
+  The MSS_UART_set_tx_ring() function gives the driver a buffer to use as a
+  transmit ring for MSS_UART_ring_tx() and installs the driver's ring THRE
+  handler. One byte of the ring is always left unused, so a ring of size bytes
+  holds up to (size - 1) bytes waiting to be sent.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART hardware block that will perform
+    the requested function. There are ten such data structures,
+    g_mss_uart0_lo to g_mss_uart4_lo, associated with MSS UART0 to MSS UART4
+    when they are connected on the AXI switch slave 5 (main APB bus) and
+    g_mss_uart0_hi to g_mss_uart4_hi, associated with MSS UART0 to MSS UART4
+    when they are connected on the AXI switch slave 6 (AMP APB bus).
+    This parameter must point to one of these ten global data structure defined
+    within the UART driver.
+
+  @param buffer
+    The buffer parameter is a pointer to the storage for the ring. It must
+    remain valid while the ring is in use.
+
+  @param size
+    The size parameter specifies the size of the buffer in bytes. It must be at
+    least 2.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_UART_set_tx_ring
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t * buffer,
+    uint32_t size
+);
+
+/***************************************************************************//**
+  The MSS_UART_ring_tx() function copies data into the transmit ring set up by
+  MSS_UART_set_tx_ring() and makes sure the THRE interrupt is enabled. It never
+  waits for space; if the ring does not have room for all of the data, only the
+  part that fits is copied.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART hardware block that will perform
+    the requested function.
+
+  @param pbuff
+    The pbuff parameter is a pointer to the data to transmit.
+
+  @param tx_size
+    The tx_size parameter specifies the number of bytes to transmit.
+
+  @return
+    This function returns the number of bytes copied into the ring.
+
+  Example:
+  @code
+      static uint8_t g_tx_ring[1024];
+
+      MSS_UART_init(&g_mss_uart1_lo,
+              MSS_UART_115200_BAUD,
+              MSS_UART_DATA_8_BITS | MSS_UART_NO_PARITY | MSS_UART_ONE_STOP_BIT);
+
+      MSS_UART_set_tx_ring(&g_mss_uart1_lo, g_tx_ring, sizeof(g_tx_ring));
+
+      MSS_UART_ring_tx(&g_mss_uart1_lo, msg, sizeof(msg));
+  @endcode
+ */
+uint32_t
+MSS_UART_ring_tx
+(
+    mss_uart_instance_t * this_uart,
+    const uint8_t * pbuff,
+    uint32_t tx_size
+);
+
+/***************************************************************************//**
+  The MSS_UART_set_rx_ring() function gives the driver a buffer to use as a
+  receive ring, installs the driver's receive handler and enables the receive
+  interrupt. Received data is read from the ring with MSS_UART_ring_rx(). Data
+  received while the ring is full is dropped and counted in the instance's
+  rx_ring_overflow field.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART hardware block that will perform
+    the requested function.
+
+  @param buffer
+    The buffer parameter is a pointer to the storage for the ring. It must
+    remain valid while the ring is in use.
+
+  @param size
+    The size parameter specifies the size of the buffer in bytes. It must be at
+    least 2.
+
+  @param trigger_level
+    The trigger_level parameter is the receive FIFO trigger level, as for
+    MSS_UART_set_rx_handler(). Data below the trigger level is picked up by the
+    character time-out interrupt.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_UART_set_rx_ring
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t * buffer,
+    uint32_t size,
+    mss_uart_rx_trig_level_t trigger_level
+);
+
+/***************************************************************************//**
+  The MSS_UART_ring_rx() function copies received data out of the receive ring
+  set up by MSS_UART_set_rx_ring(). It does not wait for data.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART hardware block that will perform
+    the requested function.
+
+  @param rx_buff
+    The rx_buff parameter is a pointer to a buffer where the received data is
+    copied.
+
+  @param buff_size
+    The buff_size parameter specifies the size of the receive buffer in bytes.
+
+  @return
+    This function returns the number of bytes copied into rx_buff.
+ */
+size_t
+MSS_UART_ring_rx
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t * rx_buff,
+    size_t buff_size
+);
+
+/***************************************************************************//**
+  The MSS_UART_set_dma_engine() function selects the fabric DMA engine used by
+  MSS_UART_dma_tx() and MSS_UART_dma_rx(). Passing NULL selects the driver's
+  interrupt handlers, which is the default after MSS_UART_init(). It must not
+  be called while a block transfer is in progress.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART hardware block that will perform
+    the requested function. There are ten such data structures,
+    g_mss_uart0_lo to g_mss_uart4_lo, associated with MSS UART0 to MSS UART4
+    when they are connected on the AXI switch slave 5 (main APB bus) and
+    g_mss_uart0_hi to g_mss_uart4_hi, associated with MSS UART0 to MSS UART4
+    when they are connected on the AXI switch slave 6 (AMP APB bus).
+    This parameter must point to one of these ten global data structure defined
+    within the UART driver.
+
+  @param engine
+    The engine parameter is a pointer to the DMA engine description. It must
+    remain valid while it is selected.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_UART_set_dma_engine
+(
+    mss_uart_instance_t * this_uart,
+    const mss_uart_dma_engine_t * engine
+);
+
+/***************************************************************************//**
+  The MSS_UART_dma_tx() function starts a transmit of a block of data and
+  returns straight away. The handler is called from interrupt context when the
+  whole block has been written to the transmit FIFO; MSS_UART_tx_complete() can
+  be used to find out when the last byte has left the shift register.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART hardware block that will perform
+    the requested function.
+
+  @param pbuff
+    The pbuff parameter is a pointer to the block to transmit. It must remain
+    valid until the handler is called.
+
+  @param tx_size
+    The tx_size parameter specifies the size of the block in bytes.
+
+  @param handler
+    The handler parameter is the completion handler. It may be NULL.
+
+  @return
+    This function returns 1 if the transmit was started, or 0 if a transmit is
+    already in progress, the parameters are not valid or the DMA engine did
+    not accept the transfer.
+ */
+uint8_t
+MSS_UART_dma_tx
+(
+    mss_uart_instance_t * this_uart,
+    const uint8_t * pbuff,
+    uint32_t tx_size,
+    mss_uart_block_handler_t handler
+);
+
+/***************************************************************************//**
+  The MSS_UART_dma_rx() function starts a receive of a block of data and
+  returns straight away. The handler is called from interrupt context when the
+  block is full or, when timeout is non-zero, when the line has been idle for
+  the receiver time-out period after at least one byte was received. The
+  handler may call MSS_UART_dma_rx() to start the next block.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART hardware block that will perform
+    the requested function.
+
+  @param rx_buff
+    The rx_buff parameter is a pointer to the block buffer. It must remain
+    valid until the handler is called.
+
+  @param buff_size
+    The buff_size parameter specifies the size of the block in bytes.
+
+  @param timeout
+    The timeout parameter is the receiver time-out multiple passed to
+    MSS_UART_enable_rx_timeout(), or 0 to complete full blocks only.
+
+  @param handler
+    The handler parameter is the completion handler.
+
+  @return
+    This function returns 1 if the receive was started, or 0 if a receive is
+    already in progress, the parameters are not valid or the DMA engine did
+    not accept the transfer.
+
+  Example:
+  @code
+      static uint8_t g_block[1029];
+
+      void block_received(mss_uart_instance_t * this_uart, uint32_t count)
+      {
+          process_block(g_block, count);
+          (void)MSS_UART_dma_rx(this_uart, g_block, sizeof(g_block), 24u,
+                                block_received);
+      }
+
+      (void)MSS_UART_dma_rx(&g_mss_uart1_lo, g_block, sizeof(g_block), 24u,
+                            block_received);
+  @endcode
+ */
+uint8_t
+MSS_UART_dma_rx
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t * rx_buff,
+    uint32_t buff_size,
+    uint8_t timeout,
+    mss_uart_block_handler_t handler
+);
+
+/***************************************************************************//**
+  The MSS_UART_dma_complete() function is called by the fabric DMA controller's
+  driver when a transfer started through mss_uart_dma_engine_t completes. It
+  calls the block completion handler.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART hardware block that will perform
+    the requested function.
+
+  @param to_uart
+    The to_uart parameter is the to_uart value the transfer was started with.
+
+  @param count
+    The count parameter is the number of bytes transferred.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_UART_dma_complete
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t to_uart,
+    uint32_t count
+);
+
+/***************************************************************************//**
+  The MSS_UART_set_frame_mode() function enables idle line framing. Received
+  data is collected in the frame buffer until the line has been idle for the
+  receiver time-out period, and the frame is then passed to the handler from
+  interrupt context.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART hardware block that will perform
+    the requested function. There are ten such data structures,
+    g_mss_uart0_lo to g_mss_uart4_lo, associated with MSS UART0 to MSS UART4
+    when they are connected on the AXI switch slave 5 (main APB bus) and
+    g_mss_uart0_hi to g_mss_uart4_hi, associated with MSS UART0 to MSS UART4
+    when they are connected on the AXI switch slave 6 (AMP APB bus).
+    This parameter must point to one of these ten global data structure defined
+    within the UART driver.
+
+  @param buffer
+    The buffer parameter is a pointer to the frame buffer. It must remain valid
+    while frame mode is enabled.
+
+  @param buff_size
+    The buff_size parameter specifies the size of the frame buffer in bytes.
+
+  @param timeout
+    The timeout parameter is the receiver time-out multiple passed to
+    MSS_UART_enable_rx_timeout(). The time-out is 4 x timeout x bit time, so
+    for the Modbus RTU 3.5 character gap with 11 bit characters a value of 10
+    is suitable.
+
+  @param trigger_level
+    The trigger_level parameter is the receive FIFO trigger level, as for
+    MSS_UART_set_rx_handler().
+
+  @param handler
+    The handler parameter is the frame handler.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+      static uint8_t g_frame[256];
+
+      void frame_received(mss_uart_instance_t * this_uart,
+                          const uint8_t * frame, uint32_t length,
+                          uint8_t overflow, uint64_t first_time,
+                          uint64_t last_time)
+      {
+          if (0u == overflow)
+          {
+              modbus_parse(frame, length, first_time);
+          }
+      }
+
+      MSS_UART_set_frame_mode(&g_mss_uart1_lo, g_frame, sizeof(g_frame), 10u,
+                              MSS_UART_FIFO_EIGHT_BYTES, frame_received);
+  @endcode
+ */
+void
+MSS_UART_set_frame_mode
+(
+    mss_uart_instance_t * this_uart,
+    uint8_t * buffer,
+    uint32_t buff_size,
+    uint8_t timeout,
+    mss_uart_rx_trig_level_t trigger_level,
+    mss_uart_frame_handler_t handler
+);
+
 /***************************************************************************//**
   The MSS_UART_set_rx_handler() function is used to register a receive handler
   function that is called by the driver when a UART receive data available (RDA)
@@ -3328,6 +3819,47 @@ MSS_UART_enable_local_irq
     mss_uart_instance_t * this_uart
 );
 
+/***************************************************************************//**
+  The MSS_UART_clock_notify() function is the notifier through which the MSS
+  UART driver follows the changes of the APB clock made with
+  mss_clk_set_opp(). Before the change it waits for the transmitter to be
+  empty, so the character being sent is not corrupted. After the change it
+  recalculates the baud rate divisors for the baud rate passed to
+  MSS_UART_init(). Characters received during the change may be lost.
+
+  @param event
+    MSS_CLK_PRE_CHANGE or MSS_CLK_POST_CHANGE.
+
+  @param change
+    The operating points and clock rates before and after the change.
+
+  @param arg
+    The arg parameter is a pointer to the mss_uart_instance_t structure of
+    the MSS UART, given to the HAL in the mss_clk_notifier_t structure.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    static mss_clk_notifier_t g_uart0_clk = { MSS_UART_clock_notify,
+            &g_mss_uart0_lo, NULL };
+
+    MSS_UART_init(&g_mss_uart0_lo,
+             MSS_UART_115200_BAUD,
+             MSS_UART_DATA_8_BITS | MSS_UART_NO_PARITY | MSS_UART_ONE_STOP_BIT);
+
+    mss_clk_register_notifier(&g_uart0_clk);
+  @endcode
+ */
+void
+MSS_UART_clock_notify
+(
+    uint8_t event,
+    const mss_clk_change_t * change,
+    void * arg
+);
+
 #ifdef __cplusplus
 }
 #endif
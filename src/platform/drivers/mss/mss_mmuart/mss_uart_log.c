@@ -0,0 +1,403 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem MMUART multi-hart log channel
+ * implementation.
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "mss_uart.h"
+#include "mss_uart_log.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MPFS_HAL_SHARED_MEM_ENABLED
+
+#define LOG_LINE_SIZE                       128u
+
+static mss_uart_log_area_t * get_log_area(void);
+static uint32_t format_record(char * line, const mss_uart_log_record_t * rec,
+                              uint32_t hart);
+static uint32_t tx_ring_space(const mss_uart_instance_t * this_uart);
+static uint32_t drain_lines(mss_uart_instance_t * this_uart,
+                            const mss_uart_log_sink_t * sink,
+                            uint32_t max_records);
+static uint32_t out_space(const mss_uart_instance_t * this_uart,
+                          const mss_uart_log_sink_t * sink);
+static void out_write(mss_uart_instance_t * this_uart,
+                      const mss_uart_log_sink_t * sink,
+                      const char * line, uint32_t len);
+
+/***************************************************************************//**
+ * See mss_uart_log.h for details of how to use this function.
+ */
+uint8_t
+MSS_UART_log_init
+(
+    void
+)
+{
+    mss_uart_log_area_t * area = get_log_area();
+
+    if (area == (mss_uart_log_area_t *)0)
+    {
+        return 0u;
+    }
+
+    area->marker = 0u;
+    mb();
+
+    (void)memset((void *)area, 0, sizeof(mss_uart_log_area_t));
+
+    /* Rings must be clear before the other harts see the marker */
+    mb();
+    area->marker = MSS_UART_LOG_MARKER;
+
+    return 1u;
+}
+
+/***************************************************************************//**
+ * See mss_uart_log.h for details of how to use this function.
+ */
+uint8_t
+MSS_UART_log
+(
+    const char * fmt,
+    uint64_t arg0,
+    uint64_t arg1,
+    uint64_t arg2
+)
+{
+    mss_uart_log_area_t * area = get_log_area();
+    uint64_t hart_id = read_csr(mhartid);
+    mss_uart_log_ring_t * ring;
+    mss_uart_log_record_t * rec;
+    uint32_t head;
+
+    if ((area == (mss_uart_log_area_t *)0) ||
+        (MSS_UART_LOG_MARKER != area->marker) ||
+        (hart_id >= MSS_UART_LOG_HARTS))
+    {
+        return 0u;
+    }
+
+    ring = &area->ring[hart_id];
+    head = ring->head;
+
+    if ((head - ring->tail) >= MSS_UART_LOG_RING_SIZE)
+    {
+        ring->dropped = ring->dropped + 1u;
+        return 0u;
+    }
+
+    rec = &ring->record[head & (MSS_UART_LOG_RING_SIZE - 1u)];
+    rec->timestamp = readmtime();
+    rec->fmt = fmt;
+    rec->arg[0] = arg0;
+    rec->arg[1] = arg1;
+    rec->arg[2] = arg2;
+
+    /* Record must be visible to the drainer before the new head */
+    mb();
+    ring->head = head + 1u;
+
+    return 1u;
+}
+
+/***************************************************************************//**
+ * See mss_uart_log.h for details of how to use this function.
+ */
+uint32_t
+MSS_UART_log_drain
+(
+    mss_uart_instance_t * this_uart
+)
+{
+    mss_uart_log_area_t * area = get_log_area();
+    mss_uart_log_ring_t * ring;
+    mss_uart_log_record_t rec;
+    char line[LOG_LINE_SIZE];
+    uint32_t sent = 0u;
+    uint32_t hart;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t dropped;
+
+    if ((area == (mss_uart_log_area_t *)0) ||
+        (MSS_UART_LOG_MARKER != area->marker))
+    {
+        return 0u;
+    }
+
+    for (hart = 0u; hart < MSS_UART_LOG_HARTS; hart++)
+    {
+        ring = &area->ring[hart];
+        tail = ring->tail;
+        head = ring->head;
+
+        /* Read the head before the records it covers */
+        mb();
+
+        while (tail != head)
+        {
+            rec = ring->record[tail & (MSS_UART_LOG_RING_SIZE - 1u)];
+
+            /* Record copied, the producer may reuse the slot */
+            mb();
+            ++tail;
+            ring->tail = tail;
+
+            (void)format_record(line, &rec, hart);
+
+            MSS_UART_polled_tx_string(this_uart, (const uint8_t *)line);
+            ++sent;
+        }
+
+        dropped = ring->dropped;
+        if (dropped != ring->dropped_seen)
+        {
+            (void)snprintf(line, sizeof(line), "h%u: %u log records dropped\r\n",
+                           (unsigned int)hart,
+                           (unsigned int)(dropped - ring->dropped_seen));
+            MSS_UART_polled_tx_string(this_uart, (const uint8_t *)line);
+            ring->dropped_seen = dropped;
+        }
+    }
+
+    return sent;
+}
+
+/***************************************************************************//**
+ * See mss_uart_log.h for details of how to use this function.
+ */
+uint32_t
+MSS_UART_log_drain_ring
+(
+    mss_uart_instance_t * this_uart,
+    uint32_t max_records
+)
+{
+    if (this_uart->tx_ring == ((uint8_t *)0))
+    {
+        return 0u;
+    }
+
+    return drain_lines(this_uart, (const mss_uart_log_sink_t *)0, max_records);
+}
+
+/***************************************************************************//**
+ * See mss_uart_log.h for details of how to use this function.
+ */
+uint32_t
+MSS_UART_log_drain_sink
+(
+    const mss_uart_log_sink_t * sink,
+    uint32_t max_records
+)
+{
+    return drain_lines((mss_uart_instance_t *)0, sink, max_records);
+}
+
+/***************************************************************************//**
+ * Formats the records waiting in the harts' rings and writes the lines to the
+ * transmit ring of this_uart, or to sink when this_uart is NULL. Stops at the
+ * first line there is no room for, leaving its record in the log ring.
+ */
+static uint32_t
+drain_lines
+(
+    mss_uart_instance_t * this_uart,
+    const mss_uart_log_sink_t * sink,
+    uint32_t max_records
+)
+{
+    mss_uart_log_area_t * area = get_log_area();
+    mss_uart_log_ring_t * ring;
+    mss_uart_log_record_t rec;
+    char line[LOG_LINE_SIZE];
+    uint32_t sent = 0u;
+    uint32_t hart;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t dropped;
+    uint32_t len;
+    uint8_t full = 0u;
+
+    if ((area == (mss_uart_log_area_t *)0) ||
+        (MSS_UART_LOG_MARKER != area->marker))
+    {
+        return 0u;
+    }
+
+    for (hart = 0u; (hart < MSS_UART_LOG_HARTS) && (0u == full); hart++)
+    {
+        ring = &area->ring[hart];
+        tail = ring->tail;
+        head = ring->head;
+
+        /* Read the head before the records it covers */
+        mb();
+
+        while ((tail != head) && (0u == full))
+        {
+            if ((0u != max_records) && (sent == max_records))
+            {
+                full = 1u;
+            }
+            else
+            {
+                rec = ring->record[tail & (MSS_UART_LOG_RING_SIZE - 1u)];
+                len = format_record(line, &rec, hart);
+
+                /* The record stays in the log ring until its whole line fits */
+                if (len > out_space(this_uart, sink))
+                {
+                    full = 1u;
+                }
+                else
+                {
+                    /* Record copied, the producer may reuse the slot */
+                    mb();
+                    ++tail;
+                    ring->tail = tail;
+
+                    out_write(this_uart, sink, line, len);
+                    ++sent;
+                }
+            }
+        }
+
+        dropped = ring->dropped;
+        if ((0u == full) && (dropped != ring->dropped_seen))
+        {
+            (void)snprintf(line, sizeof(line), "h%u: %u log records dropped\r\n",
+                           (unsigned int)hart,
+                           (unsigned int)(dropped - ring->dropped_seen));
+            len = (uint32_t)strlen(line);
+            if (len <= out_space(this_uart, sink))
+            {
+                out_write(this_uart, sink, line, len);
+                ring->dropped_seen = dropped;
+            }
+        }
+    }
+
+    return sent;
+}
+
+/***************************************************************************//**
+ * Returns the room for a line in the transmit ring of this_uart, or in sink
+ * when this_uart is NULL.
+ */
+static uint32_t
+out_space
+(
+    const mss_uart_instance_t * this_uart,
+    const mss_uart_log_sink_t * sink
+)
+{
+    if (this_uart != (const mss_uart_instance_t *)0)
+    {
+        return tx_ring_space(this_uart);
+    }
+
+    return sink->space();
+}
+
+/***************************************************************************//**
+ * Writes a line which out_space() said fits.
+ */
+static void
+out_write
+(
+    mss_uart_instance_t * this_uart,
+    const mss_uart_log_sink_t * sink,
+    const char * line,
+    uint32_t len
+)
+{
+    if (this_uart != (mss_uart_instance_t *)0)
+    {
+        (void)MSS_UART_ring_tx(this_uart, (const uint8_t *)line, len);
+    }
+    else
+    {
+        (void)sink->write((const uint8_t *)line, len);
+    }
+}
+
+/***************************************************************************//**
+ * Formats a record into line, LOG_LINE_SIZE bytes, prefixed with its mtime
+ * value and hart number, and returns the length of the line. A line too long
+ * for the buffer is cut.
+ */
+static uint32_t
+format_record
+(
+    char * line,
+    const mss_uart_log_record_t * rec,
+    uint32_t hart
+)
+{
+    int len;
+
+    len = snprintf(line, LOG_LINE_SIZE, "[%lu] h%u: ",
+                   (unsigned long)rec->timestamp, (unsigned int)hart);
+    if ((len > 0) && ((uint32_t)len < LOG_LINE_SIZE))
+    {
+        (void)snprintf(&line[len], LOG_LINE_SIZE - (uint32_t)len,
+                       rec->fmt, rec->arg[0], rec->arg[1], rec->arg[2]);
+    }
+
+    return (uint32_t)strlen(line);
+}
+
+/***************************************************************************//**
+ * Returns the number of bytes MSS_UART_ring_tx() can add to the transmit ring
+ * of this_uart. One byte of the ring is always left free.
+ */
+static uint32_t
+tx_ring_space
+(
+    const mss_uart_instance_t * this_uart
+)
+{
+    uint32_t head = this_uart->tx_ring_head;
+    uint32_t tail = this_uart->tx_ring_tail;
+
+    return ((tail + this_uart->tx_ring_size) - head - 1u) %
+           this_uart->tx_ring_size;
+}
+
+/***************************************************************************//**
+ * Returns the log area in the shared memory of the calling hart, or NULL when
+ * there is no shared memory. The HLS pointer is held in the tp register.
+ */
+static mss_uart_log_area_t *
+get_log_area
+(
+    void
+)
+{
+    HLS_DATA * hls = (HLS_DATA *)(uintptr_t)get_tp_reg();
+
+    if ((hls == (HLS_DATA *)0) || (hls->shared_mem == (uint64_t *)0))
+    {
+        return (mss_uart_log_area_t *)0;
+    }
+
+    return (mss_uart_log_area_t *)((uintptr_t)hls->shared_mem +
+                                   MSS_UART_LOG_SHARED_MEM_OFFSET);
+}
+
+#endif /* MPFS_HAL_SHARED_MEM_ENABLED */
+
+#ifdef __cplusplus
+}
+#endif
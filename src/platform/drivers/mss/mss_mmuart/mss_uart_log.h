@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem MMUART multi-hart log channel public
+ * API.
+ *
+ */
+/*=========================================================================*//**
+  @section intro_sec Introduction
+  The MSS UART log channel lets every hart log messages without waiting for a
+  UART and without a lock. Each hart writes fixed size binary records into its
+  own ring in the memory shared by all harts (hls->shared_mem). A single hart,
+  the drainer, formats the records and writes them to an MSS UART.
+
+  A log call stores the mtime value, a format string pointer and up to
+  MSS_UART_LOG_ARGS integer arguments. It does not format the message and does
+  not touch the UART, so it costs a few tens of cycles.
+
+  The log channel is only available when MPFS_HAL_SHARED_MEM_ENABLED is defined
+  in mss_sw_config.h.
+
+  @section theory_op Theory of Operation
+  The log area is placed MSS_UART_LOG_SHARED_MEM_OFFSET bytes into the shared
+  memory, so that it can sit after the application's own shared data. It holds
+  one ring per hart. A ring has one producer, the hart that owns it, and one
+  consumer, the drainer, so the head and tail indexes need no lock: the
+  producer only writes the head and the consumer only writes the tail.
+
+  The drainer hart calls MSS_UART_log_init() once, before any hart logs, and
+  then calls MSS_UART_log_drain() regularly, for example from its main loop.
+  The other harts call MSS_UART_log() at any time after that, including from
+  interrupt handlers. A hart logging from both thread and interrupt context
+  must mask interrupts around MSS_UART_log() in thread context, because the
+  ring only supports one producer.
+
+  MSS_UART_log_drain() sends with polled transmit, so it waits for the UART.
+  MSS_UART_log_drain_ring() instead queues the formatted lines on the
+  interrupt driven transmit ring of the UART, see MSS_UART_set_tx_ring(), and
+  returns once that ring is full, so the drainer never stalls.
+  MSS_UART_log_drain_sink() does the same with another destination, such as
+  the USB CDC class driver.
+
+  When a ring is full the record is dropped and the ring's drop count is
+  incremented. The drainer reports the number of dropped records.
+
+  The format string is only read by the drainer, so it must be a string
+  constant in memory which the drainer can read at the same address. This is
+  the case when all harts run the same image.
+
+  Only integer and pointer arguments are supported, each one is passed as a
+  uint64_t and the format string should use the matching conversions, for
+  example %lu, %lx or %ld.
+ *//*=========================================================================*/
+#ifndef MSS_UART_LOG_H_
+#define MSS_UART_LOG_H_
+
+#include <stdint.h>
+#include "mss_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MPFS_HAL_SHARED_MEM_ENABLED
+
+/***************************************************************************//**
+  Offset of the log area from the start of the shared memory, in bytes.
+ */
+#ifndef MSS_UART_LOG_SHARED_MEM_OFFSET
+#define MSS_UART_LOG_SHARED_MEM_OFFSET      0x1000u
+#endif
+
+/***************************************************************************//**
+  Number of records in each hart's ring. Must be a power of 2.
+ */
+#ifndef MSS_UART_LOG_RING_SIZE
+#define MSS_UART_LOG_RING_SIZE              64u
+#endif
+
+/***************************************************************************//**
+  Number of harts with a ring.
+ */
+#define MSS_UART_LOG_HARTS                  5u
+
+/***************************************************************************//**
+  Number of arguments stored with each record.
+ */
+#define MSS_UART_LOG_ARGS                   3u
+
+/***************************************************************************//**
+  Marker written by MSS_UART_log_init() once the log area is ready.
+ */
+#define MSS_UART_LOG_MARKER                 0x4C4F4721u
+
+/***************************************************************************//**
+  One log record.
+ */
+typedef struct mss_uart_log_record
+{
+    uint64_t timestamp;                     /*!< mtime when the record was logged */
+    const char * fmt;                       /*!< printf style format string */
+    uint64_t arg[MSS_UART_LOG_ARGS];        /*!< format arguments */
+} mss_uart_log_record_t;
+
+/***************************************************************************//**
+  Ring of records written by one hart. The head and tail are kept on separate
+  cache lines so the producer and the drainer do not share a line.
+ */
+typedef struct mss_uart_log_ring
+{
+    volatile uint32_t head;                 /*!< next record written, producer only */
+    volatile uint32_t dropped;              /*!< records dropped, producer only */
+    uint8_t pad0[56];
+    volatile uint32_t tail;                 /*!< next record read, drainer only */
+    uint32_t dropped_seen;                  /*!< drops already reported, drainer only */
+    uint8_t pad1[56];
+    mss_uart_log_record_t record[MSS_UART_LOG_RING_SIZE];
+} mss_uart_log_ring_t;
+
+/***************************************************************************//**
+  Log area in shared memory.
+ */
+typedef struct mss_uart_log_area
+{
+    volatile uint32_t marker;               /*!< MSS_UART_LOG_MARKER once initialized */
+    uint8_t pad[60];
+    mss_uart_log_ring_t ring[MSS_UART_LOG_HARTS];
+} mss_uart_log_area_t;
+
+/***************************************************************************//**
+  A destination of the formatted lines other than an MSS UART, for
+  MSS_UART_log_drain_sink(), for example MSS_USBD_CDC_tx_space() and
+  MSS_USBD_CDC_write() of the USB CDC class driver.
+
+  space returns the number of bytes write can take straight away. write takes
+  a whole line, which space said fits, and must not wait.
+ */
+typedef struct mss_uart_log_sink
+{
+    uint32_t (*space)(void);
+    uint32_t (*write)(const uint8_t * buf, uint32_t len);
+} mss_uart_log_sink_t;
+
+/***************************************************************************//**
+  The MSS_UART_log_init() function clears the log area in shared memory. It
+  must be called once, by the drainer hart, before any hart calls
+  MSS_UART_log().
+
+  @return
+    This function returns 1 if the log area was set up, or 0 if there is no
+    shared memory.
+ */
+uint8_t
+MSS_UART_log_init
+(
+    void
+);
+
+/***************************************************************************//**
+  The MSS_UART_log() function adds a record to the calling hart's ring. It
+  returns straight away; the message is formatted and sent by the drainer.
+
+  @param fmt
+    The fmt parameter is a printf style format string. It must be a string
+    constant.
+
+  @param arg0
+    The arg0 parameter is the first format argument.
+
+  @param arg1
+    The arg1 parameter is the second format argument.
+
+  @param arg2
+    The arg2 parameter is the third format argument.
+
+  @return
+    This function returns 1 if the record was added, or 0 if the ring was full
+    or the log area has not been initialized.
+
+  Example:
+  @code
+      (void)MSS_UART_log("rx block %lu, %lu bytes\r\n", block, count, 0u);
+  @endcode
+ */
+uint8_t
+MSS_UART_log
+(
+    const char * fmt,
+    uint64_t arg0,
+    uint64_t arg1,
+    uint64_t arg2
+);
+
+/***************************************************************************//**
+  The MSS_UART_log_drain() function formats and sends all records waiting in
+  the harts' rings, oldest first within each ring. Each line is prefixed with
+  the record's mtime value and hart number. It uses polled transmit on
+  this_uart, so it should be called by a single hart only, and only that hart
+  should use this_uart.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART the records are sent to.
+
+  @return
+    This function returns the number of records sent.
+ */
+uint32_t
+MSS_UART_log_drain
+(
+    mss_uart_instance_t * this_uart
+);
+
+/***************************************************************************//**
+  The MSS_UART_log_drain_ring() function formats the records waiting in the
+  harts' rings, as MSS_UART_log_drain() does, and queues the lines on the
+  transmit ring of this_uart set with MSS_UART_set_tx_ring(), so the drainer
+  never waits for the UART. It stops at the first line the transmit ring has
+  no room for, leaving that record for the next call, so it can be called from
+  an idle task or a low priority timer on any hart without stalling it. It
+  should be called by a single hart only, and only that hart should write to
+  the transmit ring of this_uart.
+
+  @param this_uart
+    The this_uart parameter is a pointer to an mss_uart_instance_t
+    structure identifying the MSS UART the records are sent to.
+
+  @param max_records
+    The max_records parameter is the most records formatted in one call, or 0
+    for no limit.
+
+  @return
+    This function returns the number of records queued, or 0 if this_uart has
+    no transmit ring.
+
+  Example:
+  @code
+      static uint8_t g_log_tx_ring[2048];
+
+      MSS_UART_set_tx_ring(&g_mss_uart0_lo, g_log_tx_ring,
+                           sizeof(g_log_tx_ring));
+      ...
+      // idle loop
+      (void)MSS_UART_log_drain_ring(&g_mss_uart0_lo, 8u);
+  @endcode
+ */
+uint32_t
+MSS_UART_log_drain_ring
+(
+    mss_uart_instance_t * this_uart,
+    uint32_t max_records
+);
+
+/***************************************************************************//**
+  The MSS_UART_log_drain_sink() function formats the records waiting in the
+  harts' rings, as MSS_UART_log_drain_ring() does, and writes the lines to
+  sink instead of an MSS UART. It stops at the first line the sink has no
+  room for, leaving that record for the next call.
+
+  @param sink
+    The sink parameter is a pointer to the space and write functions of the
+    destination.
+
+  @param max_records
+    The max_records parameter is the most records formatted in one call, or 0
+    for no limit.
+
+  @return
+    This function returns the number of records written.
+
+  Example:
+  @code
+      static const mss_uart_log_sink_t g_cdc_log_sink =
+      {
+          MSS_USBD_CDC_tx_space,
+          MSS_USBD_CDC_write
+      };
+      ...
+      // idle loop
+      (void)MSS_UART_log_drain_sink(&g_cdc_log_sink, 8u);
+  @endcode
+ */
+uint32_t
+MSS_UART_log_drain_sink
+(
+    const mss_uart_log_sink_t * sink,
+    uint32_t max_records
+);
+
+#endif /* MPFS_HAL_SHARED_MEM_ENABLED */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_UART_LOG_H_ */
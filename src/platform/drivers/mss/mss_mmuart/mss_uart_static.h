@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem MMUART polled transmit and receive
+ * functions for a UART known at compile time.
+ *
+ */
+/*=========================================================================*//**
+  @section intro_sec Introduction
+  The functions of mss_uart.h take a pointer to a mss_uart_instance_t and load
+  the register address of the UART from it on each call. An application using
+  one UART in a hot path can instead give the register block of the UART, a
+  constant from the list below, to the inline functions of this header. Each
+  call then compiles to the register accesses of that UART, with no call and no
+  instance lookup.
+
+  The UART is set up with MSS_UART_init() as usual and these functions can be
+  mixed with those of mss_uart.h. They do not update the sticky line status
+  read by MSS_UART_get_rx_status(), the line status bits seen are returned
+  instead.
+
+  Example:
+  @code
+    #include "drivers/mss/mss_mmuart/mss_uart_static.h"
+
+    MSS_UART_init(&g_mss_uart0_lo, MSS_UART_115200_BAUD,
+                  MSS_UART_DATA_8_BITS | MSS_UART_NO_PARITY |
+                  MSS_UART_ONE_STOP_BIT);
+
+    (void)MSS_UART_static_polled_tx(MSS_UART0_LO_REGS, msg, sizeof(msg));
+  @endcode
+ *//*=========================================================================*/
+#ifndef MSS_UART_STATIC_H_
+#define MSS_UART_STATIC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "mss_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+  Register blocks of the UARTs.
+ */
+#define MSS_UART0_LO_REGS           ((MSS_UART_TypeDef *)0x20000000UL)
+#define MSS_UART1_LO_REGS           ((MSS_UART_TypeDef *)0x20100000UL)
+#define MSS_UART2_LO_REGS           ((MSS_UART_TypeDef *)0x20102000UL)
+#define MSS_UART3_LO_REGS           ((MSS_UART_TypeDef *)0x20104000UL)
+#define MSS_UART4_LO_REGS           ((MSS_UART_TypeDef *)0x20106000UL)
+
+#define MSS_UART0_HI_REGS           ((MSS_UART_TypeDef *)0x28000000UL)
+#define MSS_UART1_HI_REGS           ((MSS_UART_TypeDef *)0x28100000UL)
+#define MSS_UART2_HI_REGS           ((MSS_UART_TypeDef *)0x28102000UL)
+#define MSS_UART3_HI_REGS           ((MSS_UART_TypeDef *)0x28104000UL)
+#define MSS_UART4_HI_REGS           ((MSS_UART_TypeDef *)0x28106000UL)
+
+#define MSS_UART_STATIC_TX_FIFO_SIZE    16u
+#define MSS_UART_STATIC_DATA_READY      ((uint8_t) 0x01)
+
+/***************************************************************************//**
+  MSS_UART_static_putc() waits for the transmit FIFO to be empty and writes
+  one byte to it.
+
+  @return
+    The line status bits seen.
+ */
+static inline __attribute__((always_inline)) uint8_t
+MSS_UART_static_putc
+(
+    MSS_UART_TypeDef * const hw_reg,
+    uint8_t data
+)
+{
+    uint8_t status = 0u;
+    uint8_t lsr;
+
+    do
+    {
+        lsr = hw_reg->LSR;
+        status |= lsr;
+    } while (0u == (lsr & MSS_UART_THRE));
+
+    hw_reg->THR = data;
+
+    return status;
+}
+
+/***************************************************************************//**
+  MSS_UART_static_polled_tx() writes tx_size bytes, filling the transmit FIFO
+  each time it is empty, as MSS_UART_polled_tx() does.
+
+  @return
+    The line status bits seen.
+ */
+static inline __attribute__((always_inline)) uint8_t
+MSS_UART_static_polled_tx
+(
+    MSS_UART_TypeDef * const hw_reg,
+    const uint8_t * pbuff,
+    uint32_t tx_size
+)
+{
+    uint32_t char_idx = 0u;
+    uint32_t fill_size;
+    uint8_t status = 0u;
+    uint8_t lsr;
+
+    while (char_idx < tx_size)
+    {
+        lsr = hw_reg->LSR;
+        status |= lsr;
+
+        if (0u != (lsr & MSS_UART_THRE))
+        {
+            fill_size = tx_size - char_idx;
+
+            if (fill_size > MSS_UART_STATIC_TX_FIFO_SIZE)
+            {
+                fill_size = MSS_UART_STATIC_TX_FIFO_SIZE;
+            }
+
+            while (0u != fill_size)
+            {
+                hw_reg->THR = pbuff[char_idx];
+                char_idx++;
+                fill_size--;
+            }
+        }
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+  MSS_UART_static_getc() reads one byte into data if one has been received.
+
+  @return
+    1 if a byte was read, else 0.
+ */
+static inline __attribute__((always_inline)) uint8_t
+MSS_UART_static_getc
+(
+    MSS_UART_TypeDef * const hw_reg,
+    uint8_t * data
+)
+{
+    uint8_t got = 0u;
+
+    if (0u != (hw_reg->LSR & MSS_UART_STATIC_DATA_READY))
+    {
+        *data = hw_reg->RBR;
+        got = 1u;
+    }
+
+    return got;
+}
+
+/***************************************************************************//**
+  MSS_UART_static_get_rx() reads the bytes received, up to buff_size, as
+  MSS_UART_get_rx() does.
+
+  @return
+    The number of bytes read.
+ */
+static inline __attribute__((always_inline)) size_t
+MSS_UART_static_get_rx
+(
+    MSS_UART_TypeDef * const hw_reg,
+    uint8_t * rx_buff,
+    size_t buff_size
+)
+{
+    size_t rx_size = 0u;
+
+    while ((rx_size < buff_size) &&
+           (0u != (hw_reg->LSR & MSS_UART_STATIC_DATA_READY)))
+    {
+        rx_buff[rx_size] = hw_reg->RBR;
+        rx_size++;
+    }
+
+    return rx_size;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_UART_STATIC_H_ */
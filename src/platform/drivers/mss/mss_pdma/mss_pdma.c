@@ -6,6 +6,7 @@
  * PoalrFire SoC Microprocessor Subsystem PDMA bare metal driver implementation.
  */
 
+#include <string.h>
 #include "mpfs_hal/mss_hal.h"
 #include "mss_pdma.h"
 
@@ -24,6 +25,28 @@ uint8_t g_channel_nextcfg_wsize[MSS_PDMA_lAST_CHANNEL] =
                                                 { 0x0Fu, 0x0Fu, 0x0Fu, 0x0Fu };
 uint8_t g_channel_nextcfg_rsize[MSS_PDMA_lAST_CHANNEL] = 
                                                 { 0x0Fu, 0x0Fu, 0x0Fu, 0x0Fu };
+
+/* Transaction sizes of the chains and streams. */
+static const mss_pdma_txn_config_t g_pdma_txn_auto = {MSS_PDMA_TXN_AUTO, 0u, 0u};
+
+/* Per channel queue of transfer chains, the head is the active chain. */
+static mss_pdma_chain_t *g_pdma_chain_head[MSS_PDMA_lAST_CHANNEL];
+static mss_pdma_chain_t *g_pdma_chain_tail[MSS_PDMA_lAST_CHANNEL];
+
+/* Set while a channel's interrupt handler is advancing its chains. */
+static volatile uint8_t g_pdma_chain_in_isr[MSS_PDMA_lAST_CHANNEL];
+
+/* Channel the next copy goes on when all channels are busy. */
+static uint8_t g_pdma_copy_next_channel;
+
+/* Stream running on each channel. */
+static mss_pdma_stream_t *g_pdma_stream[MSS_PDMA_lAST_CHANNEL];
+
+static uint8_t pdma_txn_size(uint64_t addr, uint64_t num_bytes, uint8_t *fabric);
+static mss_pdma_error_id_t pdma_chain_start(mss_pdma_channel_id_t channel_id);
+static void pdma_chain_advance(mss_pdma_channel_id_t channel_id, uint8_t error);
+static void pdma_copy_handler(mss_pdma_chain_t *chain, mss_pdma_chain_status_t status);
+static void pdma_stream_advance(mss_pdma_channel_id_t channel_id, uint8_t error);
 /*-------------------------------------------------------------------------*//**
  * MSS_PDMA_init()
  * See pse_pdma.h for description of this function.
@@ -34,7 +57,15 @@ MSS_PDMA_init
     void
 )
 {
-    ;
+    uint8_t channel;
+
+    for (channel = 0u; channel < (uint8_t)MSS_PDMA_lAST_CHANNEL; channel++)
+    {
+        g_pdma_chain_head[channel] = 0;
+        g_pdma_chain_tail[channel] = 0;
+        g_pdma_chain_in_isr[channel] = 0u;
+        g_pdma_stream[channel] = 0;
+    }
 }
 
 /*-------------------------------------------------------------------------*//**
@@ -48,6 +79,27 @@ MSS_PDMA_setup_transfer
     mss_pdma_channel_config_t *channel_config
 )
 {
+    return MSS_PDMA_setup_transfer_txn(channel_id, channel_config, 0);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_PDMA_setup_transfer_txn()
+ * See pse_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_setup_transfer_txn
+(
+    mss_pdma_channel_id_t channel_id,
+    mss_pdma_channel_config_t *channel_config,
+    const mss_pdma_txn_config_t *txn_config
+)
+{
+    uint8_t txn_mode = MSS_PDMA_TXN_CHANNEL;
+    uint8_t force_order;
+    uint8_t fabric = 0u;
+    uint8_t wsize;
+    uint8_t rsize;
+
     if (channel_id > MSS_PDMA_CHANNEL_3)
     {
         return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
@@ -113,7 +165,48 @@ MSS_PDMA_setup_transfer
         pdmareg->next_config &= ~((uint32_t)MASK_REPEAT_TRANSCTION);
     }
 
-    if (channel_config->force_order)
+    /* PDMA transaction sizes, channel defaults are the maximum. */
+    force_order = channel_config->force_order;
+    wsize = g_channel_nextcfg_wsize[channel_id];
+    rsize = g_channel_nextcfg_rsize[channel_id];
+
+    if (txn_config != 0)
+    {
+        txn_mode = txn_config->txn_mode;
+    }
+
+    if (txn_mode == MSS_PDMA_TXN_AUTO)
+    {
+        wsize = pdma_txn_size(channel_config->dest_addr,
+                              channel_config->num_bytes, &fabric);
+        rsize = pdma_txn_size(channel_config->src_addr,
+                              channel_config->num_bytes, &fabric);
+        if (fabric != 0u)
+        {
+            force_order = 1u;
+        }
+    }
+    else if (txn_mode == MSS_PDMA_TXN_EXPLICIT)
+    {
+        if (txn_config->write_size > 0x0Fu)
+        {
+            return MSS_PDMA_ERROR_INVALID_NEXTCFG_WSIZE;
+        }
+
+        if (txn_config->read_size > 0x0Fu)
+        {
+            return MSS_PDMA_ERROR_INVALID_NEXTCFG_RSIZE;
+        }
+
+        wsize = txn_config->write_size;
+        rsize = txn_config->read_size;
+    }
+    else
+    {
+        ;
+    }
+
+    if (force_order)
     {
         pdmareg->next_config |= ((uint32_t)MASK_FORCE_ORDERING);
     }
@@ -122,15 +215,64 @@ MSS_PDMA_setup_transfer
         pdmareg->next_config &= ~((uint32_t)MASK_FORCE_ORDERING);
     }
 
-    /* PDMA transaction size.. set to maximum. */
-    pdmareg->next_config |=
-            (g_channel_nextcfg_wsize[channel_id] << SHIFT_CH_CONFIG_WSIZE);
-    pdmareg->next_config |=
-            (g_channel_nextcfg_rsize[channel_id] << SHIFT_CH_CONFIG_RSIZE);
+    pdmareg->next_config &= ~((uint32_t)(MASK_MAXIUM_WSIZE | MASK_MAXIUM_RSIZE));
+    pdmareg->next_config |= ((uint32_t)wsize << SHIFT_CH_CONFIG_WSIZE);
+    pdmareg->next_config |= ((uint32_t)rsize << SHIFT_CH_CONFIG_RSIZE);
+
+#if defined(MSS_PDMA_CACHE_MAINTENANCE)
+    mss_l2_flush_range(channel_config->src_addr, channel_config->num_bytes);
+    mss_l2_flush_range(channel_config->dest_addr, channel_config->num_bytes);
+#endif
 
     return MSS_PDMA_OK;
 }
 
+/***************************************************************************//**
+ * Pick the largest transaction size, as a base 2 logarithm, for one end of a
+ * transfer. This is limited by the alignment of the address and length and by
+ * the type of memory the address is in. fabric is set if the address is
+ * behind one of the fabric interfaces.
+ */
+static uint8_t
+pdma_txn_size
+(
+    uint64_t addr,
+    uint64_t num_bytes,
+    uint8_t *fabric
+)
+{
+    uint64_t align = addr | num_bytes;
+    uint8_t limit;
+    uint8_t size = 0u;
+
+    if (((addr >= 0x60000000u) && (addr < 0x80000000u)) ||     /* FIC0 */
+        ((addr >= 0xE0000000u) && (addr <= 0xFFFFFFFFu)) ||    /* FIC1 */
+        ((addr >= 0x40000000u) && (addr < 0x60000000u)) ||     /* FIC3 */
+        ((addr >= 0x2000000000u) && (addr < 0x4000000000u)))   /* FIC0/1 */
+    {
+        limit = MSS_PDMA_MAX_SIZE_FIC;
+        *fabric = 1u;
+    }
+    else if (((addr >= 0xC0000000u) && (addr < 0xE0000000u)) ||
+             ((addr >= 0x1400000000u) && (addr < 0x2000000000u)))
+    {
+        /* Non-cached and write combined DDR */
+        limit = MSS_PDMA_MAX_SIZE_NONCACHED;
+    }
+    else
+    {
+        /* Cached DDR, LIM and L2 scratchpad */
+        limit = MSS_PDMA_MAX_SIZE_CACHED;
+    }
+
+    while ((size < limit) && (0u == (align & ((uint64_t)1u << size))))
+    {
+        size++;
+    }
+
+    return size;
+}
+
 /***************************************************************************//**
  * See pse_pdma.h for description of this function.
  */
@@ -142,8 +284,6 @@ MSS_PDMA_set_transction_size
     uint8_t read_size
 )
 {
-    uint8_t value;
-
     if (channel_id > MSS_PDMA_CHANNEL_3)
     {
         return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
@@ -379,6 +519,633 @@ MSS_PDMA_clear_transfer_error_status
     return intStatus;
 }
 
+/***************************************************************************//**
+ * See pse_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_submit_chain
+(
+    mss_pdma_channel_id_t channel_id,
+    mss_pdma_chain_t *chain
+)
+{
+    mss_pdma_error_id_t status = MSS_PDMA_OK;
+    PLIC_IRQn_Type done_irq;
+    PLIC_IRQn_Type err_irq;
+    uint8_t in_isr;
+
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
+    }
+
+    if ((chain == 0) || (chain->segments == 0) || (chain->segment_count == 0u))
+    {
+        return MSS_PDMA_ERROR_INVALID_SRC_ADDR;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    /* Interrupt numbers go in done/error pairs per channel. */
+    done_irq = (PLIC_IRQn_Type)((uint32_t)DMA_CH0_DONE_IRQn +
+                                ((uint32_t)channel_id * 2u));
+    err_irq  = (PLIC_IRQn_Type)((uint32_t)DMA_CH0_ERR_IRQn +
+                                ((uint32_t)channel_id * 2u));
+
+    /* Don't touch the PLIC from the channel's own interrupt handler. */
+    in_isr = g_pdma_chain_in_isr[channel_id];
+    if (0u == in_isr)
+    {
+        PLIC_DisableIRQ(done_irq);
+        PLIC_DisableIRQ(err_irq);
+    }
+
+    chain->next_segment = 0u;
+    chain->next = 0;
+
+    if (g_pdma_chain_head[channel_id] != 0)
+    {
+        chain->status = MSS_PDMA_CHAIN_QUEUED;
+        g_pdma_chain_tail[channel_id]->next = chain;
+        g_pdma_chain_tail[channel_id] = chain;
+    }
+    else if (pdmareg->control_reg & MASK_PDMA_CONTROL_RUN)
+    {
+        /* Busy with a transfer which isn't one of ours. */
+        status = MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS;
+    }
+    else
+    {
+        chain->status = MSS_PDMA_CHAIN_ACTIVE;
+        g_pdma_chain_head[channel_id] = chain;
+        g_pdma_chain_tail[channel_id] = chain;
+
+        status = pdma_chain_start(channel_id);
+        if (status != MSS_PDMA_OK)
+        {
+            chain->status = MSS_PDMA_CHAIN_IDLE;
+            g_pdma_chain_head[channel_id] = 0;
+            g_pdma_chain_tail[channel_id] = 0;
+        }
+    }
+
+    if (0u == in_isr)
+    {
+        PLIC_EnableIRQ(done_irq);
+        PLIC_EnableIRQ(err_irq);
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+ * See pse_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_memcpy_async
+(
+    mss_pdma_copy_token_t *token,
+    void *dest,
+    const void *src,
+    uint64_t num_bytes
+)
+{
+    mss_pdma_channel_id_t channels[MSS_PDMA_lAST_CHANNEL];
+    mss_pdma_error_id_t status = MSS_PDMA_OK;
+    uint64_t part;
+    uint64_t offset = 0u;
+    uint8_t count = 0u;
+    uint8_t channel;
+    uint8_t index;
+
+    if (token == 0)
+    {
+        return MSS_PDMA_ERROR_INVALID_PARAM;
+    }
+
+    if (src == 0)
+    {
+        return MSS_PDMA_ERROR_INVALID_SRC_ADDR;
+    }
+
+    if (dest == 0)
+    {
+        return MSS_PDMA_ERROR_INVALID_DEST_ADDR;
+    }
+
+    token->used_mask  = 0u;
+    token->done_mask  = 0u;
+    token->error_mask = 0u;
+
+    if (num_bytes < MSS_PDMA_COPY_THRESHOLD)
+    {
+        (void)mpfs_memcpy_cpu(dest, src, (size_t)num_bytes);
+        return MSS_PDMA_OK;
+    }
+
+    /* Use every channel which is idle, as long as each gets a decent share */
+    for (channel = 0u; channel < (uint8_t)MSS_PDMA_lAST_CHANNEL; channel++)
+    {
+        volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel);
+
+        if ((g_pdma_chain_head[channel] == 0) &&
+            (0u == (pdmareg->control_reg & MASK_PDMA_CONTROL_RUN)) &&
+            (num_bytes >= ((uint64_t)MSS_PDMA_COPY_THRESHOLD * (count + 1u))))
+        {
+            channels[count] = (mss_pdma_channel_id_t)channel;
+            count++;
+        }
+    }
+
+    if (0u == count)
+    {
+        channels[0] = (mss_pdma_channel_id_t)g_pdma_copy_next_channel;
+        g_pdma_copy_next_channel = (uint8_t)((g_pdma_copy_next_channel + 1u) %
+                                             (uint8_t)MSS_PDMA_lAST_CHANNEL);
+        count = 1u;
+    }
+
+    /* Keep the split points on 64 byte boundaries */
+    part = (num_bytes / count) & ~((uint64_t)63u);
+
+    for (index = 0u; index < count; index++)
+    {
+        mss_pdma_chain_t *chain = &token->chain[index];
+        mss_pdma_segment_t *segment = &token->segment[index];
+
+        segment->src_addr  = (uint64_t)src + offset;
+        segment->dest_addr = (uint64_t)dest + offset;
+        if (index == (count - 1u))
+        {
+            segment->num_bytes = num_bytes - offset;
+        }
+        else
+        {
+            segment->num_bytes = part;
+        }
+
+        offset += part;
+
+        chain->segments      = segment;
+        chain->segment_count = 1u;
+        chain->force_order   = 0u;
+        chain->handler       = pdma_copy_handler;
+        chain->p_user_data   = token;
+
+        token->used_mask |= (1u << index);
+        status = MSS_PDMA_submit_chain(channels[index], chain);
+        if (status != MSS_PDMA_OK)
+        {
+            /* Finish what we couldn't hand to the PDMA on the CPU */
+            (void)mpfs_memcpy_cpu((void *)segment->dest_addr,
+                                  (const void *)segment->src_addr,
+                                  (size_t)(num_bytes - (segment->src_addr - (uint64_t)src)));
+            (void)atomic_or(&token->done_mask, (1u << index));
+            break;
+        }
+    }
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * See pse_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_memset_async
+(
+    mss_pdma_copy_token_t *token,
+    void *dest,
+    uint8_t value,
+    uint64_t num_bytes
+)
+{
+    mss_pdma_chain_t *chain;
+    uint64_t filled;
+    uint64_t size;
+    uint32_t count = 0u;
+    uint8_t channel;
+    mss_pdma_error_id_t status;
+
+    if (token == 0)
+    {
+        return MSS_PDMA_ERROR_INVALID_PARAM;
+    }
+
+    if (dest == 0)
+    {
+        return MSS_PDMA_ERROR_INVALID_DEST_ADDR;
+    }
+
+    token->used_mask  = 0u;
+    token->done_mask  = 0u;
+    token->error_mask = 0u;
+
+    if (num_bytes < MSS_PDMA_COPY_THRESHOLD)
+    {
+        (void)mpfs_memset_cpu(dest, (int)value, (size_t)num_bytes);
+        return MSS_PDMA_OK;
+    }
+
+    /* Seed the fill on the CPU then let the PDMA double it */
+    (void)mpfs_memset_cpu(dest, (int)value, MSS_PDMA_COPY_THRESHOLD);
+    filled = MSS_PDMA_COPY_THRESHOLD;
+
+    while ((filled < num_bytes) && (count < MSS_PDMA_COPY_SEGMENTS))
+    {
+        size = filled;
+        if ((count == (MSS_PDMA_COPY_SEGMENTS - 1u)) || (size > (num_bytes - filled)))
+        {
+            size = num_bytes - filled;
+        }
+
+        /* Segments on a channel run one after the other so this is safe */
+        token->segment[count].src_addr  = (uint64_t)dest;
+        token->segment[count].dest_addr = (uint64_t)dest + filled;
+        token->segment[count].num_bytes = size;
+        filled += size;
+        count++;
+    }
+
+    channel = 0u;
+    while ((channel < (uint8_t)MSS_PDMA_lAST_CHANNEL) &&
+           (g_pdma_chain_head[channel] != 0))
+    {
+        channel++;
+    }
+
+    if (channel == (uint8_t)MSS_PDMA_lAST_CHANNEL)
+    {
+        channel = g_pdma_copy_next_channel;
+        g_pdma_copy_next_channel = (uint8_t)((g_pdma_copy_next_channel + 1u) %
+                                             (uint8_t)MSS_PDMA_lAST_CHANNEL);
+    }
+
+    chain = &token->chain[0];
+    chain->segments      = token->segment;
+    chain->segment_count = count;
+    chain->force_order   = 1u;
+    chain->handler       = pdma_copy_handler;
+    chain->p_user_data   = token;
+
+    token->used_mask = 1u;
+    status = MSS_PDMA_submit_chain((mss_pdma_channel_id_t)channel, chain);
+    if (status != MSS_PDMA_OK)
+    {
+        (void)mpfs_memset_cpu((uint8_t *)dest + MSS_PDMA_COPY_THRESHOLD, (int)value,
+                              (size_t)(num_bytes - MSS_PDMA_COPY_THRESHOLD));
+        token->done_mask = 1u;
+    }
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * See pse_pdma.h for description of this function.
+ */
+uint8_t
+MSS_PDMA_copy_done
+(
+    const mss_pdma_copy_token_t *token
+)
+{
+    if (token->done_mask == token->used_mask)
+    {
+        return 1u;
+    }
+    else
+    {
+        return 0u;
+    }
+}
+
+/***************************************************************************//**
+ * See pse_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_copy_wait
+(
+    const mss_pdma_copy_token_t *token
+)
+{
+    if (token == 0)
+    {
+        return MSS_PDMA_ERROR_INVALID_PARAM;
+    }
+
+    while (0u == MSS_PDMA_copy_done(token))
+    {
+        ;
+    }
+
+    if (token->error_mask != 0u)
+    {
+        return MSS_PDMA_ERROR_TRANSFER_FAILED;
+    }
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * See pse_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_start_stream
+(
+    mss_pdma_channel_id_t channel_id,
+    mss_pdma_stream_t *stream
+)
+{
+    mss_pdma_channel_config_t config;
+    mss_pdma_error_id_t status;
+
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
+    }
+
+    if ((stream == 0) || (stream->buffers == 0) || (stream->buffer_count < 2u))
+    {
+        return MSS_PDMA_ERROR_INVALID_DEST_ADDR;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    if ((g_pdma_stream[channel_id] != 0) ||
+        (g_pdma_chain_head[channel_id] != 0) ||
+        (pdmareg->control_reg & MASK_PDMA_CONTROL_RUN))
+    {
+        return MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS;
+    }
+
+    config.src_addr        = stream->src_addr;
+    config.dest_addr       = stream->buffers[0];
+    config.num_bytes       = stream->buffer_size;
+    config.enable_done_int = 1u;
+    config.enable_err_int  = 1u;
+    config.repeat          = 1u;
+    config.force_order     = 0u;
+
+    status = MSS_PDMA_setup_transfer_txn(channel_id, &config, &g_pdma_txn_auto);
+    if (status != MSS_PDMA_OK)
+    {
+        return status;
+    }
+
+    stream->active_buffer = 0u;
+    stream->stopping = 0u;
+    stream->running = 1u;
+    g_pdma_stream[channel_id] = stream;
+
+    (void)MSS_PDMA_start_transfer(channel_id);
+
+    /*
+     * The first transfer has been copied into the exec registers, so the
+     * next registers can now be pointed at the second buffer.
+     */
+#if defined(MSS_PDMA_CACHE_MAINTENANCE)
+    mss_l2_flush_range(stream->buffers[1], stream->buffer_size);
+#endif
+    pdmareg->next_destination = stream->buffers[1];
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * See pse_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_stop_stream
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    if ((channel_id > MSS_PDMA_CHANNEL_3) || (g_pdma_stream[channel_id] == 0))
+    {
+        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    /* The channel stops when the active transfer completes. */
+    g_pdma_stream[channel_id]->stopping = 1u;
+    pdmareg->next_config &= ~((uint32_t)MASK_REPEAT_TRANSCTION);
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * Called from a channel's done and error interrupt handlers while a stream is
+ * running on it. On completion the hardware has already restarted on the next
+ * buffer, so the next registers are moved on to the one after that before the
+ * application is told about the buffer just filled.
+ */
+static void
+pdma_stream_advance
+(
+    mss_pdma_channel_id_t channel_id,
+    uint8_t error
+)
+{
+    mss_pdma_stream_t *stream = g_pdma_stream[channel_id];
+    mss_pdma_stream_event_t event = MSS_PDMA_STREAM_BUFFER_DONE;
+    uint32_t done_buffer = stream->active_buffer;
+    uint32_t next_buffer;
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    if ((error != 0u) || (stream->stopping != 0u))
+    {
+        event = (error != 0u) ? MSS_PDMA_STREAM_ERROR : MSS_PDMA_STREAM_STOPPED;
+
+        /* Release the channel. */
+        pdmareg->control_reg &= ~((uint32_t)(MASK_PDMA_TRANSFER_DONE |
+                                             MASK_PDMA_TRANSFER_ERROR |
+                                             MASK_PDMA_CONTROL_RUN |
+                                             MASK_CLAIM_PDMA_CHANNEL));
+        stream->running = 0u;
+        g_pdma_stream[channel_id] = 0;
+    }
+    else
+    {
+        next_buffer = done_buffer + 1u;
+        if (next_buffer == stream->buffer_count)
+        {
+            next_buffer = 0u;
+        }
+        stream->active_buffer = next_buffer;
+
+        next_buffer++;
+        if (next_buffer == stream->buffer_count)
+        {
+            next_buffer = 0u;
+        }
+
+#if defined(MSS_PDMA_CACHE_MAINTENANCE)
+        mss_l2_flush_range(stream->buffers[next_buffer], stream->buffer_size);
+#endif
+        pdmareg->next_destination = stream->buffers[next_buffer];
+        pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_TRANSFER_DONE);
+    }
+
+#if defined(MSS_PDMA_CACHE_MAINTENANCE)
+    mss_l2_invalidate_range(stream->buffers[done_buffer], stream->buffer_size);
+#endif
+
+    if (stream->handler != 0)
+    {
+        stream->handler(stream, done_buffer, event);
+    }
+}
+
+/***************************************************************************//**
+ * Chain handler for the copy service. The chains of one token can finish on
+ * different harts so the masks are updated atomically.
+ */
+static void
+pdma_copy_handler
+(
+    mss_pdma_chain_t *chain,
+    mss_pdma_chain_status_t status
+)
+{
+    mss_pdma_copy_token_t *token = (mss_pdma_copy_token_t *)chain->p_user_data;
+    uint32_t bit = 1u << (uint32_t)(chain - &token->chain[0]);
+
+    if (status == MSS_PDMA_CHAIN_ERROR)
+    {
+        (void)atomic_or(&token->error_mask, bit);
+    }
+
+    mb();
+    (void)atomic_or(&token->done_mask, bit);
+}
+
+/***************************************************************************//**
+ * Start the next segment of the chain at the head of a channel's queue. The
+ * channel must be idle.
+ */
+static mss_pdma_error_id_t
+pdma_chain_start
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    mss_pdma_chain_t *chain = g_pdma_chain_head[channel_id];
+    const mss_pdma_segment_t *segment;
+    mss_pdma_channel_config_t config;
+    mss_pdma_error_id_t status;
+
+    segment = &chain->segments[chain->next_segment];
+
+    config.src_addr        = segment->src_addr;
+    config.dest_addr       = segment->dest_addr;
+    config.num_bytes       = segment->num_bytes;
+    config.enable_done_int = 1u;
+    config.enable_err_int  = 1u;
+    config.repeat          = 0u;
+    config.force_order     = chain->force_order;
+
+    status = MSS_PDMA_setup_transfer_txn(channel_id, &config, &g_pdma_txn_auto);
+    if (status == MSS_PDMA_OK)
+    {
+        chain->next_segment++;
+        (void)MSS_PDMA_start_transfer(channel_id);
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+ * Called from a channel's done or error interrupt while it has chains queued.
+ * Starts the next segment, or finishes the active chain and starts the next
+ * one in the queue before telling the application.
+ */
+static void
+pdma_chain_advance
+(
+    mss_pdma_channel_id_t channel_id,
+    uint8_t error
+)
+{
+    mss_pdma_chain_t *chain = g_pdma_chain_head[channel_id];
+    mss_pdma_chain_status_t chain_status;
+    uint8_t finished = 0u;
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    g_pdma_chain_in_isr[channel_id] = 1u;
+
+    /* Acknowledge the transfer and release the channel for the next one. */
+    pdmareg->control_reg &= ~((uint32_t)(MASK_PDMA_TRANSFER_DONE |
+                                         MASK_PDMA_TRANSFER_ERROR |
+                                         MASK_PDMA_CONTROL_RUN));
+
+    if ((error != 0u) || (chain->next_segment == chain->segment_count))
+    {
+        finished = 1u;
+    }
+    else if (pdma_chain_start(channel_id) != MSS_PDMA_OK)
+    {
+        error = 1u;
+        finished = 1u;
+    }
+    else
+    {
+        ;
+    }
+
+    while (finished != 0u)
+    {
+        chain_status = (error != 0u) ? MSS_PDMA_CHAIN_ERROR : MSS_PDMA_CHAIN_DONE;
+        g_pdma_chain_head[channel_id] = chain->next;
+        if (g_pdma_chain_head[channel_id] == 0)
+        {
+            g_pdma_chain_tail[channel_id] = 0;
+        }
+
+        finished = 0u;
+        error = 0u;
+        if (g_pdma_chain_head[channel_id] != 0)
+        {
+            /* Keep the channel busy before calling back into the application */
+            g_pdma_chain_head[channel_id]->status = MSS_PDMA_CHAIN_ACTIVE;
+            if (pdma_chain_start(channel_id) != MSS_PDMA_OK)
+            {
+                error = 1u;
+                finished = 1u;
+            }
+        }
+
+#if defined(MSS_PDMA_CACHE_MAINTENANCE)
+        {
+            uint32_t segment;
+
+            for (segment = 0u; segment < chain->next_segment; segment++)
+            {
+                mss_l2_invalidate_range(chain->segments[segment].dest_addr,
+                                        chain->segments[segment].num_bytes);
+            }
+        }
+#endif
+
+        chain->status = chain_status;
+        if (chain->handler != 0)
+        {
+            chain->handler(chain, chain_status);
+        }
+
+        chain = g_pdma_chain_head[channel_id];
+    }
+
+    g_pdma_chain_in_isr[channel_id] = 0u;
+}
+
 /***************************************************************************//**
  * Each DMA channel has two interrupts, one for transfer complete
  * and the other for the transfer error.
@@ -393,6 +1160,18 @@ dma_ch0_DONE_IRQHandler
     volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
                                                 (MSS_PDMA_CHANNEL_0);
 
+    if (g_pdma_stream[MSS_PDMA_CHANNEL_0] != 0)
+    {
+        pdma_stream_advance(MSS_PDMA_CHANNEL_0, 0u);
+        return 0u;
+    }
+
+    if (g_pdma_chain_head[MSS_PDMA_CHANNEL_0] != 0)
+    {
+        pdma_chain_advance(MSS_PDMA_CHANNEL_0, 0u);
+        return 0u;
+    }
+
     pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
 
     return 0u;
@@ -408,6 +1187,18 @@ dma_ch0_ERR_IRQHandler
     volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
                                                 (MSS_PDMA_CHANNEL_0);
 
+    if (g_pdma_stream[MSS_PDMA_CHANNEL_0] != 0)
+    {
+        pdma_stream_advance(MSS_PDMA_CHANNEL_0, 1u);
+        return 0u;
+    }
+
+    if (g_pdma_chain_head[MSS_PDMA_CHANNEL_0] != 0)
+    {
+        pdma_chain_advance(MSS_PDMA_CHANNEL_0, 1u);
+        return 0u;
+    }
+
     pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
 
     return 0u;
@@ -423,6 +1214,18 @@ dma_ch1_DONE_IRQHandler
     volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
                                                 (MSS_PDMA_CHANNEL_1);
 
+    if (g_pdma_stream[MSS_PDMA_CHANNEL_1] != 0)
+    {
+        pdma_stream_advance(MSS_PDMA_CHANNEL_1, 0u);
+        return 0u;
+    }
+
+    if (g_pdma_chain_head[MSS_PDMA_CHANNEL_1] != 0)
+    {
+        pdma_chain_advance(MSS_PDMA_CHANNEL_1, 0u);
+        return 0u;
+    }
+
     pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
 
     return 0u;
@@ -438,6 +1241,18 @@ dma_ch1_ERR_IRQHandler
     volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
                                                 (MSS_PDMA_CHANNEL_1);
 
+    if (g_pdma_stream[MSS_PDMA_CHANNEL_1] != 0)
+    {
+        pdma_stream_advance(MSS_PDMA_CHANNEL_1, 1u);
+        return 0u;
+    }
+
+    if (g_pdma_chain_head[MSS_PDMA_CHANNEL_1] != 0)
+    {
+        pdma_chain_advance(MSS_PDMA_CHANNEL_1, 1u);
+        return 0u;
+    }
+
     pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
 
     return 0u;
@@ -454,6 +1269,18 @@ dma_ch2_DONE_IRQHandler
     volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
                                                 (MSS_PDMA_CHANNEL_2);
 
+    if (g_pdma_stream[MSS_PDMA_CHANNEL_2] != 0)
+    {
+        pdma_stream_advance(MSS_PDMA_CHANNEL_2, 0u);
+        return 0u;
+    }
+
+    if (g_pdma_chain_head[MSS_PDMA_CHANNEL_2] != 0)
+    {
+        pdma_chain_advance(MSS_PDMA_CHANNEL_2, 0u);
+        return 0u;
+    }
+
     pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
 
     return 0u;
@@ -469,6 +1296,18 @@ dma_ch2_ERR_IRQHandler
     volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
                                                 (MSS_PDMA_CHANNEL_2);
 
+    if (g_pdma_stream[MSS_PDMA_CHANNEL_2] != 0)
+    {
+        pdma_stream_advance(MSS_PDMA_CHANNEL_2, 1u);
+        return 0u;
+    }
+
+    if (g_pdma_chain_head[MSS_PDMA_CHANNEL_2] != 0)
+    {
+        pdma_chain_advance(MSS_PDMA_CHANNEL_2, 1u);
+        return 0u;
+    }
+
     pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
 
     return 0u;
@@ -484,6 +1323,18 @@ dma_ch3_DONE_IRQHandler
     volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
                                                 (MSS_PDMA_CHANNEL_3);
 
+    if (g_pdma_stream[MSS_PDMA_CHANNEL_3] != 0)
+    {
+        pdma_stream_advance(MSS_PDMA_CHANNEL_3, 0u);
+        return 0u;
+    }
+
+    if (g_pdma_chain_head[MSS_PDMA_CHANNEL_3] != 0)
+    {
+        pdma_chain_advance(MSS_PDMA_CHANNEL_3, 0u);
+        return 0u;
+    }
+
     pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
 
     return 0u;
@@ -499,6 +1350,18 @@ dma_ch3_ERR_IRQHandler
     volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
                                                 (MSS_PDMA_CHANNEL_3);
 
+    if (g_pdma_stream[MSS_PDMA_CHANNEL_3] != 0)
+    {
+        pdma_stream_advance(MSS_PDMA_CHANNEL_3, 1u);
+        return 0u;
+    }
+
+    if (g_pdma_chain_head[MSS_PDMA_CHANNEL_3] != 0)
+    {
+        pdma_chain_advance(MSS_PDMA_CHANNEL_3, 1u);
+        return 0u;
+    }
+
     pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
 
     return 0u;
@@ -124,6 +124,56 @@
   The MSS_PDMA_clear_transfer_error_status() function can be used to clear the
   DMA transfer error status.
 
+  --------------------------------
+  Transfer Chains
+  --------------------------------
+  A single PDMA transfer can only be set up on a channel while no other
+  transfer is running on it. To keep a channel busy without software having to
+  wait for each transfer to complete, a list of segments can be submitted as a
+  chain by calling MSS_PDMA_submit_chain(). Chains are queued per channel and
+  the channel's done interrupt handler moves on to the next segment, and then
+  to the next chain, by itself. The application is told once, through the
+  chain's handler, when the whole chain has completed or a segment has failed.
+  The channel's done and error interrupts must be enabled in the PLIC for
+  chains to progress.
+
+  --------------------------------
+  Asynchronous Copy Service
+  --------------------------------
+  MSS_PDMA_memcpy_async() and MSS_PDMA_memset_async() offload large copies and
+  fills to the PDMA using transfer chains. A copy is split across the channels
+  which are free at the time of the call so that they run in parallel. The
+  caller supplies an mss_pdma_copy_token_t which can be polled with
+  MSS_PDMA_copy_done() or waited on with MSS_PDMA_copy_wait(). Requests smaller
+  than MSS_PDMA_COPY_THRESHOLD bytes are done by the CPU before returning, as
+  setting up the PDMA would take longer than the copy.
+
+  --------------------------------
+  Streaming
+  --------------------------------
+  MSS_PDMA_start_stream() runs continuous transfers from one source, typically
+  a buffer in fabric IP reached through a FIC, into a ring of two or more
+  destination buffers. The channel is set up to repeat its transfer and the
+  done interrupt handler points the next transfer at the following buffer
+  while the current one is being filled, so there is no gap between buffers.
+  The stream's handler is called as each buffer is filled, and the
+  application must finish with that buffer before the ring comes back round
+  to it. MSS_PDMA_stop_stream() lets the buffer being filled complete and then
+  stops the channel. The channel's done and error interrupts must be enabled
+  in the PLIC.
+
+  --------------------------------
+  Cache Maintenance
+  --------------------------------
+  By default the driver does no cache maintenance, so buffers are expected to
+  be in non-cached memory. If MSS_PDMA_CACHE_MAINTENANCE is defined, the
+  source and destination ranges are flushed from the L2 cache by
+  MSS_PDMA_setup_transfer(), and the destination of each segment of a chain is
+  invalidated before the chain's handler is called. This allows buffers to be
+  placed in cached DDR. Buffers should then be cache line aligned and a whole
+  number of cache lines long, and must not be accessed by the CPU while the
+  transfer is running.
+
 *//*==========================================================================*/
 #ifndef MSS_PDMA_H
 #define MSS_PDMA_H
@@ -137,7 +187,8 @@ extern "C" {
 /*---------------------------Public Data Structure----------------------------*/
 /*----------------------------------PDMA--------------------------------------*/
 
-/*----------------------------------------------------------------------------/*
+/*----------------------------------------------------------------------------*/
+/*
   The mss_pdma_channel_id_t enumeration is used to identify peripheral DMA 
   channels. It is used as function parameter to specify the PDMA channel used.
  */
@@ -175,6 +226,178 @@ typedef struct _pdmachannelconfig
                                               in-flight at a time */
 } mss_pdma_channel_config_t;
 
+/*-------------------------------------------------------------------------*//**
+  Values for the txn_mode member of mss_pdma_txn_config_t.
+
+  - MSS_PDMA_TXN_CHANNEL uses the sizes set for the channel with
+    MSS_PDMA_set_transction_size().
+  - MSS_PDMA_TXN_AUTO picks the largest sizes allowed by the alignment of the
+    addresses and the length and by the memory the source and destination are
+    in. Ordering is also forced if either end is in the fabric.
+  - MSS_PDMA_TXN_EXPLICIT uses the write_size and read_size members.
+ */
+#define MSS_PDMA_TXN_CHANNEL                           0u
+#define MSS_PDMA_TXN_AUTO                              1u
+#define MSS_PDMA_TXN_EXPLICIT                          2u
+
+/*-------------------------------------------------------------------------*//**
+  The mss_pdma_txn_config_t structure selects the transaction sizes of a
+  transfer set up with MSS_PDMA_setup_transfer_txn().
+ */
+typedef struct _pdmatxnconfig
+{
+    uint8_t txn_mode;                      /* How the transaction sizes are
+                                              chosen, MSS_PDMA_TXN_xxx */
+    uint8_t write_size;                    /* Base 2 log of write transaction
+                                              size for MSS_PDMA_TXN_EXPLICIT */
+    uint8_t read_size;                     /* Base 2 log of read transaction
+                                              size for MSS_PDMA_TXN_EXPLICIT */
+} mss_pdma_txn_config_t;
+
+/*-------------------------------------------------------------------------*//**
+  Largest transaction sizes, as base 2 logarithms, used by MSS_PDMA_TXN_AUTO
+  for each type of target. Cached memory is limited to a cache line and the
+  fabric interfaces to one 64 bit beat so that simple AXI slaves are not
+  given bursts they cannot handle. These can be overridden at build time.
+ */
+#ifndef MSS_PDMA_MAX_SIZE_CACHED
+#define MSS_PDMA_MAX_SIZE_CACHED                       6u
+#endif
+#ifndef MSS_PDMA_MAX_SIZE_NONCACHED
+#define MSS_PDMA_MAX_SIZE_NONCACHED                    6u
+#endif
+#ifndef MSS_PDMA_MAX_SIZE_FIC
+#define MSS_PDMA_MAX_SIZE_FIC                          3u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  The mss_pdma_segment_t structure describes one contiguous copy in a transfer
+  chain submitted with MSS_PDMA_submit_chain().
+ */
+typedef struct _pdmasegment
+{
+    uint64_t src_addr;                     /* source address */
+    uint64_t dest_addr;                    /* destination address */
+    uint64_t num_bytes;                    /* Number of bytes to be transferred */
+} mss_pdma_segment_t;
+
+/*-------------------------------------------------------------------------*//**
+  The mss_pdma_chain_status_t enumeration reports the progress of a transfer
+  chain.
+ */
+typedef enum __pdma_chain_status
+{
+    MSS_PDMA_CHAIN_IDLE = 0,               //!< Not submitted
+    MSS_PDMA_CHAIN_QUEUED,                 //!< Waiting for the channel
+    MSS_PDMA_CHAIN_ACTIVE,                 //!< Segments being transferred
+    MSS_PDMA_CHAIN_DONE,                   //!< All segments transferred
+    MSS_PDMA_CHAIN_ERROR,                  //!< A segment failed, rest skipped
+} mss_pdma_chain_status_t;
+
+struct _pdmachain;
+
+/*-------------------------------------------------------------------------*//**
+  The mss_pdma_chain_handler_t type is the prototype of the function called
+  from the PDMA interrupt handlers when a transfer chain finishes. The status
+  is MSS_PDMA_CHAIN_DONE or MSS_PDMA_CHAIN_ERROR.
+ */
+typedef void (*mss_pdma_chain_handler_t)(struct _pdmachain *chain,
+                                         mss_pdma_chain_status_t status);
+
+/*-------------------------------------------------------------------------*//**
+  The mss_pdma_chain_t structure describes a list of segments to be
+  transferred back to back on one PDMA channel. The application owns the
+  structure and the segment array and must keep both valid until the chain
+  has finished. The fields after p_user_data are used by the driver.
+ */
+typedef struct _pdmachain
+{
+    const mss_pdma_segment_t *segments;    /* array of segments to transfer */
+    uint32_t segment_count;                /* number of entries in segments */
+    uint8_t force_order;                   /* force ordering for each segment */
+    mss_pdma_chain_handler_t handler;      /* called when the chain finishes,
+                                              can be 0 */
+    void *p_user_data;                     /* for use by the application */
+
+    volatile uint32_t next_segment;        /* next segment to start */
+    volatile mss_pdma_chain_status_t status; /* progress of the chain */
+    struct _pdmachain *next;               /* next chain queued on the channel */
+} mss_pdma_chain_t;
+
+/*-------------------------------------------------------------------------*//**
+  Copies and fills smaller than this many bytes are done by the CPU.
+ */
+#ifndef MSS_PDMA_COPY_THRESHOLD
+#define MSS_PDMA_COPY_THRESHOLD                        1024u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Maximum number of segments used by MSS_PDMA_memset_async(). The fill
+  doubles in size with each segment so this limits the fill to
+  MSS_PDMA_COPY_THRESHOLD * 2^MSS_PDMA_COPY_SEGMENTS bytes.
+ */
+#define MSS_PDMA_COPY_SEGMENTS                         32u
+
+/*-------------------------------------------------------------------------*//**
+  The mss_pdma_copy_token_t structure tracks an asynchronous copy or fill. It
+  is owned by the application and must remain valid until the operation has
+  completed. Its contents are private to the driver.
+ */
+typedef struct _pdmacopytoken
+{
+    mss_pdma_chain_t chain[MSS_PDMA_lAST_CHANNEL];     /* one chain per channel */
+    mss_pdma_segment_t segment[MSS_PDMA_COPY_SEGMENTS]; /* segment storage */
+    volatile uint32_t used_mask;                      /* chains submitted */
+    volatile uint32_t done_mask;                      /* chains finished */
+    volatile uint32_t error_mask;                     /* chains failed */
+} mss_pdma_copy_token_t;
+
+/*-------------------------------------------------------------------------*//**
+  The mss_pdma_stream_event_t enumeration is passed to a stream's handler.
+  - MSS_PDMA_STREAM_BUFFER_DONE - a buffer has been filled, the stream keeps
+                                  running
+  - MSS_PDMA_STREAM_STOPPED     - the last buffer has been filled after a call
+                                  to MSS_PDMA_stop_stream()
+  - MSS_PDMA_STREAM_ERROR       - a transfer failed and the stream has stopped
+ */
+typedef enum
+{
+    MSS_PDMA_STREAM_BUFFER_DONE = 0,
+    MSS_PDMA_STREAM_STOPPED,
+    MSS_PDMA_STREAM_ERROR
+} mss_pdma_stream_event_t;
+
+struct _pdmastream;
+
+/*-------------------------------------------------------------------------*//**
+  Stream handler, called from the channel's interrupt handler with the index
+  of the buffer the event refers to.
+ */
+typedef void (*mss_pdma_stream_handler_t)(struct _pdmastream *stream,
+                                          uint32_t buffer_index,
+                                          mss_pdma_stream_event_t event);
+
+/*-------------------------------------------------------------------------*//**
+  The mss_pdma_stream_t structure describes a continuous transfer from one
+  source into a ring of destination buffers. The application owns the
+  structure and the buffer array and must keep both valid until the stream
+  has stopped. The fields after p_user_data are used by the driver.
+ */
+typedef struct _pdmastream
+{
+    uint64_t src_addr;                     /* source read for every buffer */
+    const uint64_t *buffers;               /* destination buffer addresses */
+    uint32_t buffer_count;                 /* number of buffers, at least 2 */
+    uint64_t buffer_size;                  /* bytes transferred per buffer */
+    mss_pdma_stream_handler_t handler;     /* called as each buffer fills,
+                                              can be 0 */
+    void *p_user_data;                     /* for use by the application */
+
+    volatile uint32_t active_buffer;       /* buffer being filled */
+    volatile uint8_t stopping;             /* stop after the active buffer */
+    volatile uint8_t running;              /* set while the stream runs */
+} mss_pdma_stream_t;
+
 /*------------------------Private data structures-----------------------------*/
 /*----------------------------------- PDMA -----------------------------------*/
 
@@ -191,6 +414,8 @@ typedef enum __pdma_error_id_t
     MSS_PDMA_ERROR_INVALID_CHANNEL_ID,     //!< ERROR_INVALID_CHANNEL_ID
     MSS_PDMA_ERROR_INVALID_NEXTCFG_WSIZE,  //!< ERROR_INVALID_NEXTCFG_WSIZE
     MSS_PDMA_ERROR_INVALID_NEXTCFG_RSIZE,  //!< ERROR_INVALID_NEXTCFG_RSIZE
+    MSS_PDMA_ERROR_INVALID_PARAM,          //!< ERROR_INVALID_PARAM
+    MSS_PDMA_ERROR_TRANSFER_FAILED,        //!< ERROR_TRANSFER_FAILED
     MSS_PDMA_ERROR_LAST_ID,                //!< ERROR_LAST_ID
 } mss_pdma_error_id_t;
 
@@ -278,6 +503,8 @@ MSS_PDMA_init
            - Enable the ErrorInterrupt
            - Set the active transfer type, single or repeat.
            - Force Order.
+           The transaction sizes are those set for the channel with
+           MSS_PDMA_set_transction_size().
        
    @return pdma_error_id_t
            The function returns error signals of type mss_pdma_error_id_t.
@@ -296,6 +523,49 @@ MSS_PDMA_setup_transfer
     mss_pdma_channel_config_t *channel_config
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_setup_transfer_txn() function configures a DMA channel as
+  MSS_PDMA_setup_transfer() does, with the transaction sizes of the transfer
+  chosen as txn_config says.
+
+  @param channel_id
+           The channel_id parameter specifies the Platform DMA channel selected
+           for DMA transaction.
+
+  @param channel_config
+           The channel_config parameter structure contains the data needed for
+           a DMA transfer, as for MSS_PDMA_setup_transfer().
+
+  @param txn_config
+           The txn_config parameter selects the transaction sizes. NULL uses
+           the sizes set for the channel, the same as MSS_PDMA_TXN_CHANNEL.
+
+   @return pdma_error_id_t
+           The function returns error signals of type mss_pdma_error_id_t,
+           MSS_PDMA_ERROR_INVALID_NEXTCFG_WSIZE or
+           MSS_PDMA_ERROR_INVALID_NEXTCFG_RSIZE if an explicit size is larger
+           than 15.
+
+  Example:
+  The following call will configure channel 0 with the largest transaction
+  sizes the alignment of the transfer allows
+  @code
+                static const mss_pdma_txn_config_t txn = {MSS_PDMA_TXN_AUTO,
+                                                          0u, 0u};
+
+                g_pdma_error_code = MSS_PDMA_setup_transfer_txn(PDMA_CHANNEL_0,
+                                                          &pdma_config_ch0,
+                                                          &txn);
+  @endcode
+ */
+mss_pdma_error_id_t
+MSS_PDMA_setup_transfer_txn
+(
+    mss_pdma_channel_id_t channel_id,
+    mss_pdma_channel_config_t *channel_config,
+    const mss_pdma_txn_config_t *txn_config
+);
+
 /*-------------------------------------------------------------------------*//**
   The MSS_PDMA_start_transfer() function is used to initiate an individual
   transfer on selected   DMA channel . The source and destination address of
@@ -312,11 +582,11 @@ MSS_PDMA_setup_transfer
   Example:
   The following call will configure channel 0
   @code
-                /*Setup the PDMA channel for transfer
+                // Setup the PDMA channel for transfer
                 g_pdma_error_code = MSS_PDMA_setup_transfer(PDMA_CHANNEL_0,
                                                           &pdma_config_ch0);
 
-                /*Initiate the transfer for channel 0.
+                // Initiate the transfer for channel 0.
                 MSS_PDMA_start_transfer(PDMA_CHANNEL_0);
   @endcode
  */
@@ -577,4 +847,227 @@ MSS_PDMA_clear_transfer_error_status
     mss_pdma_channel_id_t channel_id
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_submit_chain() function is used to queue a chain of transfers
+  on a PDMA channel. If the channel is idle the first segment is started
+  straight away, otherwise the chain is started by the done interrupt handler
+  once the chains ahead of it have finished. Every segment enables the done
+  and error interrupts, so the channel's interrupts must be enabled in the
+  PLIC.
+
+  This function can be called from a chain handler to queue more work.
+
+  @param channel_id
+           The channel_id parameter specifies the Platform DMA channel to
+           queue the chain on.
+
+  @param chain
+           The chain parameter points to the chain to transfer. The segments,
+           segment_count, force_order, handler and p_user_data fields must be
+           set up by the application. The chain must not already be queued.
+
+  @return
+           The function returns error signals of type mss_pdma_error_id_t.
+           MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS is returned if the channel
+           is running a transfer set up with MSS_PDMA_setup_transfer().
+
+  Example:
+  The following call will copy two buffers on channel 0 with one completion.
+  @code
+                static mss_pdma_segment_t segs[2] =
+                {
+                    { SRC_A, DEST_A, 4096u },
+                    { SRC_B, DEST_B, 4096u },
+                };
+                static mss_pdma_chain_t chain;
+
+                chain.segments      = segs;
+                chain.segment_count = 2u;
+                chain.force_order   = 0u;
+                chain.handler       = copy_done;
+                chain.p_user_data   = 0;
+
+                PLIC_EnableIRQ(DMA_CH0_DONE_IRQn);
+                PLIC_EnableIRQ(DMA_CH0_ERR_IRQn);
+                MSS_PDMA_submit_chain(MSS_PDMA_CHANNEL_0, &chain);
+  @endcode
+ */
+mss_pdma_error_id_t
+MSS_PDMA_submit_chain
+(
+    mss_pdma_channel_id_t channel_id,
+    mss_pdma_chain_t *chain
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_memcpy_async() function starts copying a block of memory using
+  the PDMA. The copy is divided between the PDMA channels which have nothing
+  queued on them, or queued on one channel if they are all busy. Copies of
+  less than MSS_PDMA_COPY_THRESHOLD bytes are done by the CPU and the token is
+  complete when the function returns.
+
+  The source and destination must not overlap. The PDMA channels' done and
+  error interrupts must be enabled in the PLIC.
+
+  @param token
+           The token parameter points to the application owned token used to
+           track the copy.
+
+  @param dest
+           The dest parameter is the destination address.
+
+  @param src
+           The src parameter is the source address.
+
+  @param num_bytes
+           The num_bytes parameter is the number of bytes to copy.
+
+  @return
+           The function returns error signals of type mss_pdma_error_id_t,
+           MSS_PDMA_ERROR_INVALID_PARAM if token is NULL.
+
+  Example:
+  @code
+                mss_pdma_copy_token_t token;
+
+                MSS_PDMA_memcpy_async(&token, ddr_buf, lim_buf, 65536u);
+                do_other_work();
+                MSS_PDMA_copy_wait(&token);
+  @endcode
+ */
+mss_pdma_error_id_t
+MSS_PDMA_memcpy_async
+(
+    mss_pdma_copy_token_t *token,
+    void *dest,
+    const void *src,
+    uint64_t num_bytes
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_memset_async() function starts filling a block of memory with a
+  byte value. The CPU fills the first MSS_PDMA_COPY_THRESHOLD bytes and a
+  single PDMA channel then doubles the filled area with each segment. Fills of
+  less than MSS_PDMA_COPY_THRESHOLD bytes are done entirely by the CPU.
+
+  @param token
+           The token parameter points to the application owned token used to
+           track the fill.
+
+  @param dest
+           The dest parameter is the address of the block to fill.
+
+  @param value
+           The value parameter is the byte value to fill the block with.
+
+  @param num_bytes
+           The num_bytes parameter is the number of bytes to fill.
+
+  @return
+           The function returns error signals of type mss_pdma_error_id_t,
+           MSS_PDMA_ERROR_INVALID_PARAM if token is NULL.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_memset_async
+(
+    mss_pdma_copy_token_t *token,
+    void *dest,
+    uint8_t value,
+    uint64_t num_bytes
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_copy_done() function checks whether an asynchronous copy or
+  fill has finished.
+
+  @param token
+           The token parameter points to the token passed to
+           MSS_PDMA_memcpy_async() or MSS_PDMA_memset_async().
+
+  @return
+           This function returns 1 if the operation has finished and 0 if it
+           is still in progress.
+ */
+uint8_t
+MSS_PDMA_copy_done
+(
+    const mss_pdma_copy_token_t *token
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_copy_wait() function waits for an asynchronous copy or fill to
+  finish. It must not be called from a PDMA interrupt handler.
+
+  @param token
+           The token parameter points to the token passed to
+           MSS_PDMA_memcpy_async() or MSS_PDMA_memset_async().
+
+  @return
+           The function returns MSS_PDMA_OK if all of the transfers succeeded,
+           MSS_PDMA_ERROR_TRANSFER_FAILED if any of them failed, or
+           MSS_PDMA_ERROR_INVALID_PARAM if token is NULL.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_copy_wait
+(
+    const mss_pdma_copy_token_t *token
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_start_stream() function starts a stream on a PDMA channel. The
+  first transfer fills buffer 0 and the following ones fill the buffers in
+  order, going back to buffer 0 after the last one. The channel must be idle
+  and stays in use by the stream until it has stopped.
+
+  @param channel_id
+           The channel_id parameter specifies the PDMA channel to use.
+
+  @param stream
+           The stream parameter points to the application owned stream
+           description.
+
+  @return
+           The function returns MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS if the
+           channel is busy, MSS_PDMA_ERROR_INVALID_DEST_ADDR if fewer than two
+           buffers are given, or another error from MSS_PDMA_setup_transfer().
+
+  Example:
+  @code
+      static uint64_t buffers[2] = { 0xC0000000u, 0xC0010000u };
+      static mss_pdma_stream_t stream;
+
+      stream.src_addr     = 0x60000000u;
+      stream.buffers      = buffers;
+      stream.buffer_count = 2u;
+      stream.buffer_size  = 0x10000u;
+      stream.handler      = capture_handler;
+
+      MSS_PDMA_start_stream(MSS_PDMA_CHANNEL_0, &stream);
+  @endcode
+ */
+mss_pdma_error_id_t
+MSS_PDMA_start_stream
+(
+    mss_pdma_channel_id_t channel_id,
+    mss_pdma_stream_t *stream
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_stop_stream() function asks the stream running on a channel to
+  stop. The buffer being filled is completed and reported to the handler with
+  MSS_PDMA_STREAM_STOPPED, then the channel is released.
+
+  @param channel_id
+           The channel_id parameter specifies the PDMA channel.
+
+  @return
+           The function returns MSS_PDMA_ERROR_INVALID_CHANNEL_ID if there is
+           no stream running on the channel.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_stop_stream
+(
+    mss_pdma_channel_id_t channel_id
+);
+
 #endif  /* MSS_PDMA_H */
@@ -66,14 +66,15 @@ void MSS_QSPI_get_config
 )
 {
    volatile uint32_t reg =0;
+   uint32_t qmode;
 
    reg = QSPI->CONTROL;
 
    config->spi_mode = ((reg & CTRL_CLKIDL_MASK) >> CTRL_CLKIDL);
-   reg = reg & (uint32_t )((uint32_t )CTRL_QMODE12_MASK | (uint32_t )CTRL_QMODE0_MASK);
-   reg = reg >> CTRL_QMODE0;
+   qmode = reg & (uint32_t )((uint32_t )CTRL_QMODE12_MASK | (uint32_t )CTRL_QMODE0_MASK);
+   qmode = qmode >> CTRL_QMODE0;
 
-   config->io_format = (mss_qspi_io_format)reg;
+   config->io_format = (mss_qspi_io_format)qmode;
 
    config->clk_div = (mss_qspi_clk_div)((reg & CTRL_CLKRATE_MASK)
                                                                >> CTRL_CLKRATE);
@@ -278,6 +279,83 @@ void MSS_QSPI_set_status_handler
     }
 }
 
+/***************************************************************************//**
+ * See mss_qspi.h for details of how to use this function.
+ */
+void MSS_QSPI_xip_prefetch
+(
+    void* dest,
+    uint32_t offset,
+    uint32_t size
+)
+{
+    uint32_t idx;
+    uint32_t* dst32 = (uint32_t*)dest;
+    const volatile uint32_t* src32 =
+                   (const volatile uint32_t*)(uintptr_t)(MSS_QSPI_XIP_BASE + offset);
+
+    for (idx = 0u; idx < (size / 4u); ++idx)
+    {
+        dst32[idx] = src32[idx];
+    }
+}
+
+/***************************************************************************//**
+ * See mss_qspi.h for details of how to use this function.
+ */
+void MSS_QSPI_xip_window_init
+(
+    mss_qspi_xip_window_t* window,
+    uint8_t* buffer,
+    uint32_t size
+)
+{
+    window->buffer = buffer;
+    window->size = size;
+    window->start = 0u;
+    window->length = 0u;
+}
+
+/***************************************************************************//**
+ * See mss_qspi.h for details of how to use this function.
+ */
+const void* MSS_QSPI_xip_window_read
+(
+    mss_qspi_xip_window_t* window,
+    uint32_t offset,
+    uint32_t size
+)
+{
+    const void* data = (const void*)0;
+    uint32_t start;
+
+    /* The window is refilled from the word holding offset */
+    start = offset & ~3u;
+
+    if ((size <= (window->size - (offset - start))) &&
+        (offset < MSS_QSPI_XIP_SIZE) &&
+        (size <= (MSS_QSPI_XIP_SIZE - offset)))
+    {
+        if ((offset < window->start) ||
+            ((offset - window->start) > window->length) ||
+            (size > (window->length - (offset - window->start))))
+        {
+            window->length = window->size;
+            if (window->length > (MSS_QSPI_XIP_SIZE - start))
+            {
+                window->length = MSS_QSPI_XIP_SIZE - start;
+            }
+
+            MSS_QSPI_xip_prefetch(window->buffer, start, window->length);
+            window->start = start;
+        }
+
+        data = (const void*)&window->buffer[offset - window->start];
+    }
+
+    return(data);
+}
+
 static void qspi_isr(void)
 {
     uint32_t idx;
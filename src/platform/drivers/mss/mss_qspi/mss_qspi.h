@@ -171,6 +171,30 @@
   the QSPI pins which might be needed to communicate with non-standard target
   devices.
 
+  -------------
+  XIP Operation
+  -------------
+  When the xip field of the configuration is set, reads from the QSPI address
+  space, MSS_QSPI_XIP_BASE onwards, are turned into reads of the target memory
+  device, so code can be run and constants read directly from the flash. The
+  target memory device must first be put in its XIP (continuous read) mode
+  using its own command sequence, for example a quad I/O fast read with the
+  XIP confirmation bit. The MSS QSPI then sends the address and data phases
+  only, in the configured io_format, so quad I/O gives the fastest XIP reads.
+  While XIP is enabled, the MSS QSPI registers can not be read back, so
+  MSS_QSPI_get_config() must be called before XIP is enabled and the returned
+  configuration kept to leave XIP mode.
+
+  The mpfs-envm-qspi-xip.ld linker template in platform_config_reference places
+  functions and constants declared with MSS_QSPI_XIP_TEXT and
+  MSS_QSPI_XIP_RODATA in the XIP window.
+
+  The XIP window is not cached. Data which is read many times can be copied
+  into a reserved L2 scratchpad way with MSS_QSPI_xip_prefetch(), or read
+  through an mss_qspi_xip_window_t with MSS_QSPI_xip_window_read(), which
+  fetches a whole window ahead each time a sequential reader runs past the
+  data it holds.
+
  *//*=========================================================================*/
 
 #ifndef MSS_QSPI_H_
@@ -396,6 +420,27 @@ typedef struct
 /*PolarFire SoC MSS QSPI hardware instance*/
 #define QSPI                    ((QSPI_TypeDef *) QSPI_BASE)
 
+/*Start and size of the XIP window with 3 address bytes*/
+#define MSS_QSPI_XIP_BASE       0x21000000u
+#define MSS_QSPI_XIP_SIZE       0x01000000u
+
+/*Sections placed in the XIP window by the mpfs-envm-qspi-xip.ld template*/
+#define MSS_QSPI_XIP_TEXT       __attribute__((section(".qspi_xip_text")))
+#define MSS_QSPI_XIP_RODATA     __attribute__((section(".qspi_xip_rodata")))
+
+/***************************************************************************//**
+  Window of XIP data held in memory by MSS_QSPI_xip_window_read(). The fields
+  are set by MSS_QSPI_xip_window_init() and must not be changed by the
+  application.
+*/
+typedef struct mss_qspi_xip_window
+{
+    uint8_t*    buffer;     /*window memory, for example in the L2 scratchpad*/
+    uint32_t    size;       /*window size in bytes*/
+    uint32_t    start;      /*flash offset held at buffer[0]*/
+    uint32_t    length;     /*bytes held, 0 when empty*/
+}mss_qspi_xip_window_t;
+
 
 
 /*----------------------------------------------------------------------------*/
@@ -671,6 +716,111 @@ void MSS_QSPI_set_status_handler
    mss_qspi_status_handler_t handler
 );
 
+/***************************************************************************//**
+  The MSS_QSPI_xip_prefetch() function copies data from the XIP window into
+  memory, for example into the .qspi_xip_prefetch area which the
+  mpfs-envm-qspi-xip.ld template places in a reserved L2 scratchpad way. The
+  copy uses 32 bit reads so each read of the target memory device returns
+  four bytes. XIP must be enabled.
+
+  @param dest
+    The dest parameter is the buffer the data is copied to. It must be 4 byte
+    aligned.
+
+  @param offset
+    The offset parameter is the address of the data in the target memory
+    device. It must be a multiple of 4.
+
+  @param size
+    The size parameter is the number of bytes to copy. It must be a multiple
+    of 4.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    extern uint8_t __qspi_xip_prefetch_start;
+
+    MSS_QSPI_xip_prefetch(&__qspi_xip_prefetch_start,
+                          (uint32_t)g_table - MSS_QSPI_XIP_BASE,
+                          sizeof(g_table));
+  @endcode
+ */
+void MSS_QSPI_xip_prefetch
+(
+    void* dest,
+    uint32_t offset,
+    uint32_t size
+);
+
+/***************************************************************************//**
+  The MSS_QSPI_xip_window_init() function sets up a window used to read XIP
+  data with MSS_QSPI_xip_window_read(). The window starts empty.
+
+  @param window
+    The window parameter is the window to be set up.
+
+  @param buffer
+    The buffer parameter is the memory holding the window. It must be 4 byte
+    aligned.
+
+  @param size
+    The size parameter is the size of the buffer in bytes. It must be a
+    multiple of 4.
+
+  @return
+    This function does not return a value.
+ */
+void MSS_QSPI_xip_window_init
+(
+    mss_qspi_xip_window_t* window,
+    uint8_t* buffer,
+    uint32_t size
+);
+
+/***************************************************************************//**
+  The MSS_QSPI_xip_window_read() function returns a pointer to size bytes of
+  XIP data held in the window. When the window does not hold all of them, it
+  is refilled with MSS_QSPI_xip_prefetch() starting at offset, so a reader
+  walking forward through a large table reads the flash once per window
+  rather than once per access. XIP must be enabled.
+
+  @param window
+    The window parameter is a window set up by MSS_QSPI_xip_window_init().
+
+  @param offset
+    The offset parameter is the address of the data in the target memory
+    device.
+
+  @param size
+    The size parameter is the number of bytes needed.
+
+  @return
+    This function returns a pointer to the data in the window, valid until the
+    next call for this window, or a NULL pointer if size is greater than the
+    window can hold or the data is outside the XIP window.
+
+  Example:
+  @code
+    static mss_qspi_xip_window_t g_window;
+    const uint32_t* entry;
+
+    MSS_QSPI_xip_window_init(&g_window, &__qspi_xip_prefetch_start, 4096u);
+    for (idx = 0u; idx < count; idx++)
+    {
+        entry = MSS_QSPI_xip_window_read(&g_window, base + (idx * 4u), 4u);
+        sum += *entry;
+    }
+  @endcode
+ */
+const void* MSS_QSPI_xip_window_read
+(
+    mss_qspi_xip_window_t* window,
+    uint32_t offset,
+    uint32_t size
+);
+
 /***************************************************************************//**
   The MSS_QSPI_read_direct_access_reg() reads the current value of the direct
   access register(DAR) of the MSS QSPI. DAR allows direct access to the QSPI 
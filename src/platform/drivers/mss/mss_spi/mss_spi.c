@@ -52,6 +52,10 @@ extern "C" {
 #define CTRL_CLKMODE_MASK       0x10000000u
 #define SPS_MASK                0x04000000u
 
+/* CONTROL register bits held in a slave's configuration. */
+#define SLAVE_CFG_CTRL_MASK     (MASTER_MODE_MASK | SPS_MASK | BIGFIFO_MASK | \
+                                 CTRL_CLKMODE_MASK | PROTOCOL_MODE_MASK)
+
 /* CONTROL2 register */
 #define C2_ENABLE_CMD_IRQ_MASK     0x00000010u
 #define C2_ENABLE_SSEND_IRQ_MASK   0x00000020u
@@ -121,6 +125,15 @@ static void recover_from_rx_overflow(mss_spi_instance_t * this_spi);
 static void fill_slave_tx_fifo(mss_spi_instance_t * this_spi);
 static void read_slave_rx_fifo(mss_spi_instance_t * this_spi);
 static void mss_spi_isr(mss_spi_instance_t * this_spi);
+static uint8_t xfer_start(mss_spi_instance_t * this_spi);
+static void xfer_next(mss_spi_instance_t * this_spi);
+static void xfer_fill_tx_fifo(mss_spi_instance_t * this_spi);
+static void xfer_rx_handler(mss_spi_instance_t * this_spi);
+static const mss_spi_xfer_t * xfer_skip_empty(const mss_spi_xfer_t * xfer);
+static void xfer_chain_end(mss_spi_instance_t * this_spi);
+static void txn_run(mss_spi_instance_t * this_spi);
+static void apply_slave_cfg(mss_spi_instance_t * this_spi, mss_spi_slave_t slave);
+static uint8_t scale_clk_gen(uint8_t clk_gen, const mss_clk_change_t * change);
 
 /***************************************************************************//**
  * MSS_SPI_init()
@@ -571,6 +584,190 @@ void MSS_SPI_transfer_block
     }
 }
 
+/***************************************************************************//**
+ * MSS_SPI_set_dma_engine()
+ * See "mss_spi.h" for details of how to use this function.
+ */
+void MSS_SPI_set_dma_engine
+(
+    mss_spi_instance_t * this_spi,
+    const mss_spi_dma_engine_t * engine
+)
+{
+    ASSERT((this_spi == &g_mss_spi0_lo) || (this_spi == &g_mss_spi0_hi) 
+            || (this_spi == &g_mss_spi1_lo) || (this_spi == &g_mss_spi1_hi));
+
+    this_spi->dma_engine = engine;
+}
+
+/***************************************************************************//**
+ * MSS_SPI_dma_transfer_block()
+ * See "mss_spi.h" for details of how to use this function.
+ */
+uint8_t MSS_SPI_dma_transfer_block
+(
+    mss_spi_instance_t * this_spi,
+    const uint8_t cmd_buffer[],
+    uint32_t cmd_byte_size,
+    uint8_t rd_buffer[],
+    uint32_t rd_byte_size,
+    mss_spi_xfer_handler_t handler
+)
+{
+    uint8_t started = 0u;
+
+    ASSERT((this_spi == &g_mss_spi0_lo) || (this_spi == &g_mss_spi0_hi) 
+            || (this_spi == &g_mss_spi1_lo) || (this_spi == &g_mss_spi1_hi));
+
+    if ((const mss_spi_xfer_t *)0 == this_spi->xfer)
+    {
+        this_spi->xfer_single.cmd_buffer = cmd_buffer;
+        this_spi->xfer_single.cmd_byte_size = cmd_byte_size;
+        this_spi->xfer_single.rd_buffer = rd_buffer;
+        this_spi->xfer_single.rd_byte_size = rd_byte_size;
+        this_spi->xfer_single.next = (const mss_spi_xfer_t *)0;
+
+        started = MSS_SPI_dma_transfer_chain(this_spi,
+                                             MSS_SPI_MAX_NB_OF_SLAVES,
+                                             &this_spi->xfer_single,
+                                             handler);
+    }
+
+    return started;
+}
+
+/***************************************************************************//**
+ * MSS_SPI_dma_transfer_chain()
+ * See "mss_spi.h" for details of how to use this function.
+ */
+uint8_t MSS_SPI_dma_transfer_chain
+(
+    mss_spi_instance_t * this_spi,
+    mss_spi_slave_t slave,
+    const mss_spi_xfer_t * chain,
+    mss_spi_xfer_handler_t handler
+)
+{
+    const mss_spi_xfer_t * first;
+    uint8_t started = 0u;
+
+    ASSERT((this_spi == &g_mss_spi0_lo) || (this_spi == &g_mss_spi0_hi) 
+            || (this_spi == &g_mss_spi1_lo) || (this_spi == &g_mss_spi1_hi));
+
+    /* This function is only intended to be used with an SPI master. */
+    ASSERT((this_spi->hw_reg->CONTROL & CTRL_MASTER_MASK)
+                == CTRL_MASTER_MASK);
+
+    first = xfer_skip_empty(chain);
+
+    if (((const mss_spi_xfer_t *)0 == this_spi->xfer) &&
+        ((const mss_spi_xfer_t *)0 != first))
+    {
+        if (slave < MSS_SPI_MAX_NB_OF_SLAVES)
+        {
+            MSS_SPI_set_slave_select(this_spi, slave);
+        }
+
+        /* Shut down interrupts from the MSS SPI while we do this */
+        PLIC_DisableIRQ(this_spi->irqn);
+
+        this_spi->xfer_handler = handler;
+        this_spi->xfer_chain = chain;
+        this_spi->xfer_slave = (uint8_t)slave;
+        this_spi->xfer_txn = (mss_spi_transaction_t *)0;
+        this_spi->xfer = first;
+
+        started = xfer_start(this_spi);
+        if (0u == started)
+        {
+            this_spi->xfer = (const mss_spi_xfer_t *)0;
+            if (slave < MSS_SPI_MAX_NB_OF_SLAVES)
+            {
+                this_spi->hw_reg->SLAVE_SELECT &= ~((uint32_t)1 << (uint32_t)slave);
+            }
+        }
+
+        /* Re enable interrupts */
+        PLIC_EnableIRQ(this_spi->irqn);
+    }
+
+    return started;
+}
+
+/***************************************************************************//**
+ * MSS_SPI_dma_complete()
+ * See "mss_spi.h" for details of how to use this function.
+ */
+void MSS_SPI_dma_complete
+(
+    mss_spi_instance_t * this_spi
+)
+{
+    const mss_spi_xfer_t * xfer = this_spi->xfer;
+
+    if ((const mss_spi_xfer_t *)0 != xfer)
+    {
+        if ((0u == this_spi->xfer_rd_phase) && (0u != xfer->rd_byte_size))
+        {
+            /* Command phase done, start the read phase */
+            this_spi->xfer_rd_phase = 1u;
+            if (0u == this_spi->dma_engine->start(this_spi->dma_engine->p_context,
+                                                  this_spi->hw_reg,
+                                                  (const uint8_t *)0,
+                                                  xfer->rd_buffer,
+                                                  xfer->rd_byte_size))
+            {
+                this_spi->xfer = (const mss_spi_xfer_t *)0;
+                xfer_next(this_spi);
+            }
+        }
+        else
+        {
+            xfer_next(this_spi);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * MSS_SPI_queue_transaction()
+ * See "mss_spi.h" for details of how to use this function.
+ */
+void MSS_SPI_queue_transaction
+(
+    mss_spi_instance_t * this_spi,
+    mss_spi_transaction_t * txn
+)
+{
+    ASSERT((this_spi == &g_mss_spi0_lo) || (this_spi == &g_mss_spi0_hi) 
+            || (this_spi == &g_mss_spi1_lo) || (this_spi == &g_mss_spi1_hi));
+
+    /* This function is only intended to be used with an SPI master. */
+    ASSERT((this_spi->hw_reg->CONTROL & CTRL_MASTER_MASK)
+                == CTRL_MASTER_MASK);
+
+    ASSERT(txn->slave < MSS_SPI_MAX_NB_OF_SLAVES);
+    ASSERT(this_spi->slaves_cfg[txn->slave].ctrl_reg != NOT_CONFIGURED);
+
+    /* Shut down interrupts from the MSS SPI while we do this */
+    PLIC_DisableIRQ(this_spi->irqn);
+
+    txn->next = (mss_spi_transaction_t *)0;
+    if ((mss_spi_transaction_t *)0 == this_spi->txn_head)
+    {
+        this_spi->txn_head = txn;
+    }
+    else
+    {
+        this_spi->txn_tail->next = txn;
+    }
+    this_spi->txn_tail = txn;
+
+    txn_run(this_spi);
+
+    /* Re enable interrupts */
+    PLIC_EnableIRQ(this_spi->irqn);
+}
+
 /***************************************************************************//**
  * MSS_SPI_set_frame_rx_handler()
  * See "mss_spi.h" for details of how to use this function.
@@ -762,6 +959,9 @@ void MSS_SPI_set_slave_block_buffers
     this_spi->slave_tx_size = tx_buff_size;
     this_spi->slave_tx_idx = 0u;
 
+    /* Drop any pair armed for the previous buffers. */
+    this_spi->slave_next_armed = 0u;
+
     /* Flush the Tx and Rx FIFOs.
      * Please note this does not have any effect on A2F200. */
     this_spi->hw_reg->COMMAND |= ((uint32_t)TX_FIFO_RESET_MASK
@@ -853,6 +1053,46 @@ void MSS_SPI_set_slave_block_buffers
     PLIC_EnableIRQ(this_spi->irqn);
 }
 
+/***************************************************************************//**
+ * MSS_SPI_arm_slave_block_buffers()
+ * See "mss_spi.h" for details of how to use this function.
+ */
+uint8_t MSS_SPI_arm_slave_block_buffers
+(
+    mss_spi_instance_t * this_spi,
+    const uint8_t * tx_buffer,
+    uint32_t tx_buff_size,
+    uint8_t * rx_buffer,
+    uint32_t rx_buff_size
+)
+{
+    uint8_t armed = 0u;
+
+    ASSERT((this_spi == &g_mss_spi0_lo) || (this_spi == &g_mss_spi0_hi) 
+            || (this_spi == &g_mss_spi1_lo) || (this_spi == &g_mss_spi1_hi));
+
+    /* This function is only intended to be used with an SPI slave. */
+    ASSERT((this_spi->hw_reg->CONTROL & CTRL_MASTER_MASK) != CTRL_MASTER_MASK);
+
+    /* Shut down interrupts from the MSS SPI while we do this */
+    PLIC_DisableIRQ(this_spi->irqn);
+
+    if (0u == this_spi->slave_next_armed)
+    {
+        this_spi->slave_next_tx_buffer = tx_buffer;
+        this_spi->slave_next_tx_size = tx_buff_size;
+        this_spi->slave_next_rx_buffer = rx_buffer;
+        this_spi->slave_next_rx_size = rx_buff_size;
+        this_spi->slave_next_armed = 1u;
+        armed = 1u;
+    }
+
+    /* Re enable interrupts */
+    PLIC_EnableIRQ(this_spi->irqn);
+
+    return armed;
+}
+
 /***************************************************************************//**
  * MSS_SPI_set_cmd_handler()
  * See "mss_spi.h" for details of how to use this function.
@@ -983,6 +1223,84 @@ uint32_t MSS_SPI_tx_done
     return tx_done;
 }
 
+/***************************************************************************//**
+ * MSS_SPI_clock_notify()
+ * See "mss_spi.h" for details of how to use this function.
+ */
+void MSS_SPI_clock_notify
+(
+    uint8_t event,
+    const mss_clk_change_t * change,
+    void * arg
+)
+{
+    mss_spi_instance_t * this_spi = (mss_spi_instance_t *)arg;
+    uint32_t ctrl;
+    uint32_t slave;
+
+    if (MSS_CLK_PRE_CHANGE == event)
+    {
+        while ((const mss_spi_xfer_t *)0 != this_spi->xfer)
+        {
+            ;
+        }
+    }
+    else
+    {
+        PLIC_DisableIRQ(this_spi->irqn);
+
+        for (slave = 0u; slave < (uint32_t)MSS_SPI_MAX_NB_OF_SLAVES; slave++)
+        {
+            if (NOT_CONFIGURED != this_spi->slaves_cfg[slave].ctrl_reg)
+            {
+                this_spi->slaves_cfg[slave].clk_gen =
+                    scale_clk_gen(this_spi->slaves_cfg[slave].clk_gen, change);
+            }
+        }
+
+        ctrl = this_spi->hw_reg->CONTROL;
+        this_spi->hw_reg->CONTROL = ctrl & ~(uint32_t)CTRL_ENABLE_MASK;
+        this_spi->hw_reg->CLK_GEN =
+            (uint32_t)scale_clk_gen((uint8_t)this_spi->hw_reg->CLK_GEN, change);
+        this_spi->hw_reg->CONTROL = ctrl;
+
+        PLIC_EnableIRQ(this_spi->irqn);
+    }
+}
+
+/***************************************************************************//**
+ * Returns the CLK_GEN value giving the fastest SPI clock at the new APB clock
+ * not above the one given by clk_gen at the old APB clock.
+ * SPI clock = PCLK / (2 x (CLK_GEN + 1))
+ */
+static uint8_t scale_clk_gen
+(
+    uint8_t clk_gen,
+    const mss_clk_change_t * change
+)
+{
+    uint64_t clk_div = 2u * ((uint64_t)clk_gen + 1u);
+
+    clk_div = ((clk_div * change->to.apb_hz) + change->from.apb_hz - 1u) /
+              change->from.apb_hz;
+    clk_div = (clk_div + 1u) & ~(uint64_t)1u;
+
+    if (clk_div < 2u)
+    {
+        clk_div = 2u;
+    }
+    else if (clk_div > 512u)
+    {
+        clk_div = 512u;
+    }
+    else
+    {
+        ;
+    }
+
+    return ((uint8_t)((clk_div / 2u) - 1u));
+}
+
 /***************************************************************************//**
  * Fill the transmit FIFO(used for slave block transfers).
  */
@@ -1080,6 +1398,307 @@ static void read_slave_rx_fifo
     }
 }
 
+/***************************************************************************//**
+ * Returns the first transfer of the chain which has something to transfer.
+ */
+static const mss_spi_xfer_t * xfer_skip_empty
+(
+    const mss_spi_xfer_t * xfer
+)
+{
+    while (((const mss_spi_xfer_t *)0 != xfer) &&
+           (0u == (xfer->cmd_byte_size + xfer->rd_byte_size)))
+    {
+        xfer = xfer->next;
+    }
+
+    return xfer;
+}
+
+/***************************************************************************//**
+ * Sets up the MSS SPI for the transfer in this_spi->xfer and starts it, either
+ * through the DMA engine or by filling the transmit FIFO. Returns 0 if the DMA
+ * engine did not accept the transfer.
+ */
+static uint8_t xfer_start
+(
+    mss_spi_instance_t * this_spi
+)
+{
+    const mss_spi_xfer_t * xfer = this_spi->xfer;
+    uint32_t rx_overflow;
+    uint8_t started = 1u;
+
+    this_spi->xfer_size = xfer->cmd_byte_size + xfer->rd_byte_size;
+    this_spi->xfer_tx_idx = 0u;
+    this_spi->xfer_rx_idx = 0u;
+    this_spi->xfer_rd_phase = 0u;
+
+    /* Flush the Tx and Rx FIFOs. */
+    this_spi->hw_reg->COMMAND |= ((uint32_t)TX_FIFO_RESET_MASK |
+                                  (uint32_t)RX_FIFO_RESET_MASK);
+
+    /* Recover from receive overflow. */
+    rx_overflow = this_spi->hw_reg->STATUS & RX_OVERFLOW_MASK;
+    if (rx_overflow > 0U)
+    {
+         recover_from_rx_overflow(this_spi);
+    }
+
+    /* Set frame size to 8 bits and the frame count to the transfer size. */
+    this_spi->hw_reg->CONTROL &= ~(uint32_t)CTRL_ENABLE_MASK;
+    this_spi->hw_reg->FRAMESUP = this_spi->xfer_size & BYTESUPPER_MASK;
+    this_spi->hw_reg->CONTROL = (this_spi->hw_reg->CONTROL & ~TXRXDFCOUNT_MASK) |
+                                ((this_spi->xfer_size << TXRXDFCOUNT_SHIFT)
+                                 & TXRXDFCOUNT_MASK);
+
+    this_spi->hw_reg->FRAMESIZE = MSS_SPI_BLOCK_TRANSFER_FRAME_SIZE;
+    this_spi->hw_reg->CONTROL |= CTRL_ENABLE_MASK;
+
+    /* Flush the receive FIFO. */
+    while (0u == (this_spi->hw_reg->STATUS & RX_FIFO_EMPTY_MASK))
+    {
+        (void)this_spi->hw_reg->RX_DATA;
+    }
+
+    if ((const mss_spi_dma_engine_t *)0 != this_spi->dma_engine)
+    {
+        if (0u != xfer->cmd_byte_size)
+        {
+            started = this_spi->dma_engine->start(this_spi->dma_engine->p_context,
+                                                  this_spi->hw_reg,
+                                                  xfer->cmd_buffer,
+                                                  (uint8_t *)0,
+                                                  xfer->cmd_byte_size);
+        }
+        else
+        {
+            this_spi->xfer_rd_phase = 1u;
+            started = this_spi->dma_engine->start(this_spi->dma_engine->p_context,
+                                                  this_spi->hw_reg,
+                                                  (const uint8_t *)0,
+                                                  xfer->rd_buffer,
+                                                  xfer->rd_byte_size);
+        }
+    }
+    else
+    {
+        this_spi->hw_reg->INT_CLEAR = RXDONE_IRQ_MASK;
+        this_spi->hw_reg->CONTROL |= CTRL_RX_IRQ_EN_MASK;
+        xfer_fill_tx_fifo(this_spi);
+    }
+
+    return started;
+}
+
+/***************************************************************************//**
+ * Moves on to the next transfer of the chain, or completes the chain.
+ */
+static void xfer_next
+(
+    mss_spi_instance_t * this_spi
+)
+{
+    const mss_spi_xfer_t * next = (const mss_spi_xfer_t *)0;
+
+    if ((const mss_spi_xfer_t *)0 != this_spi->xfer)
+    {
+        next = xfer_skip_empty(this_spi->xfer->next);
+    }
+
+    this_spi->xfer = next;
+    if ((const mss_spi_xfer_t *)0 != next)
+    {
+        if (0u == xfer_start(this_spi))
+        {
+            this_spi->xfer = (const mss_spi_xfer_t *)0;
+        }
+    }
+
+    if ((const mss_spi_xfer_t *)0 == this_spi->xfer)
+    {
+        xfer_chain_end(this_spi);
+        txn_run(this_spi);
+    }
+}
+
+/***************************************************************************//**
+ * Completes the chain: releases the slave select, removes the chain's
+ * transaction from the queue and calls the completion handler.
+ */
+static void xfer_chain_end
+(
+    mss_spi_instance_t * this_spi
+)
+{
+    mss_spi_transaction_t * txn = this_spi->xfer_txn;
+
+    this_spi->hw_reg->CONTROL &= ~(uint32_t)CTRL_RX_IRQ_EN_MASK;
+
+    if (this_spi->xfer_slave < (uint8_t)MSS_SPI_MAX_NB_OF_SLAVES)
+    {
+        this_spi->hw_reg->SLAVE_SELECT &=
+                        ~((uint32_t)1 << (uint32_t)this_spi->xfer_slave);
+    }
+
+    if ((mss_spi_transaction_t *)0 != txn)
+    {
+        this_spi->txn_head = txn->next;
+        if ((mss_spi_transaction_t *)0 == this_spi->txn_head)
+        {
+            this_spi->txn_tail = (mss_spi_transaction_t *)0;
+        }
+        this_spi->xfer_txn = (mss_spi_transaction_t *)0;
+    }
+
+    if ((mss_spi_xfer_handler_t)0 != this_spi->xfer_handler)
+    {
+        this_spi->xfer_handler(this_spi, this_spi->xfer_chain);
+    }
+}
+
+/***************************************************************************//**
+ * Starts the transaction at the head of the queue if the SPI is idle.
+ * Transactions which cannot be started are completed straight away.
+ */
+static void txn_run
+(
+    mss_spi_instance_t * this_spi
+)
+{
+    mss_spi_transaction_t * txn;
+
+    while (((const mss_spi_xfer_t *)0 == this_spi->xfer) &&
+           ((mss_spi_transaction_t *)0 != this_spi->txn_head))
+    {
+        txn = this_spi->txn_head;
+
+        apply_slave_cfg(this_spi, txn->slave);
+        this_spi->hw_reg->SLAVE_SELECT |= ((uint32_t)1 << (uint32_t)txn->slave);
+
+        this_spi->xfer_handler = txn->handler;
+        this_spi->xfer_chain = txn->chain;
+        this_spi->xfer_slave = (uint8_t)txn->slave;
+        this_spi->xfer_txn = txn;
+        this_spi->xfer = xfer_skip_empty(txn->chain);
+
+        if ((const mss_spi_xfer_t *)0 != this_spi->xfer)
+        {
+            if (0u == xfer_start(this_spi))
+            {
+                this_spi->xfer = (const mss_spi_xfer_t *)0;
+            }
+        }
+
+        if ((const mss_spi_xfer_t *)0 == this_spi->xfer)
+        {
+            xfer_chain_end(this_spi);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Programs the SPI for a slave from its cached configuration, only writing
+ * the registers which differ from it.
+ */
+static void apply_slave_cfg
+(
+    mss_spi_instance_t * this_spi,
+    mss_spi_slave_t slave
+)
+{
+    const mss_spi_slave_cfg_t * cfg = &this_spi->slaves_cfg[slave];
+    uint32_t ctrl = this_spi->hw_reg->CONTROL;
+    uint32_t ctrl_diff = (ctrl ^ cfg->ctrl_reg) & SLAVE_CFG_CTRL_MASK;
+    uint32_t clk_diff = this_spi->hw_reg->CLK_GEN ^ (uint32_t)cfg->clk_gen;
+    uint32_t size_diff = this_spi->hw_reg->FRAMESIZE ^
+                         (uint32_t)cfg->txrxdf_size_reg;
+
+    if ((0u != ctrl_diff) || (0u != clk_diff) || (0u != size_diff))
+    {
+        this_spi->hw_reg->CONTROL = ctrl & ~(uint32_t)CTRL_ENABLE_MASK;
+        if (0u != ctrl_diff)
+        {
+            ctrl = (ctrl & ~SLAVE_CFG_CTRL_MASK) |
+                   (cfg->ctrl_reg & SLAVE_CFG_CTRL_MASK);
+            this_spi->hw_reg->CONTROL = ctrl & ~(uint32_t)CTRL_ENABLE_MASK;
+        }
+        if (0u != clk_diff)
+        {
+            this_spi->hw_reg->CLK_GEN = (uint32_t)cfg->clk_gen;
+        }
+        if (0u != size_diff)
+        {
+            this_spi->hw_reg->FRAMESIZE = (uint32_t)cfg->txrxdf_size_reg;
+        }
+        this_spi->hw_reg->CONTROL = ctrl | CTRL_ENABLE_MASK;
+    }
+}
+
+/***************************************************************************//**
+ * Writes frames to the transmit FIFO, keeping no more frames in flight than
+ * the receive FIFO can hold.
+ */
+static void xfer_fill_tx_fifo
+(
+    mss_spi_instance_t * this_spi
+)
+{
+    const mss_spi_xfer_t * xfer = this_spi->xfer;
+
+    while ((this_spi->xfer_tx_idx < this_spi->xfer_size) &&
+           ((this_spi->xfer_tx_idx - this_spi->xfer_rx_idx) < BIG_FIFO_SIZE) &&
+           (0u == (this_spi->hw_reg->STATUS & TX_FIFO_FULL_MASK)))
+    {
+        if (this_spi->xfer_tx_idx < xfer->cmd_byte_size)
+        {
+            this_spi->hw_reg->TX_DATA = xfer->cmd_buffer[this_spi->xfer_tx_idx];
+        }
+        else
+        {
+            this_spi->hw_reg->TX_DATA = 0x00u;
+        }
+        ++this_spi->xfer_tx_idx;
+    }
+}
+
+/***************************************************************************//**
+ * Receive interrupt handling for master DMA block transfers serviced by the
+ * driver. Empties the receive FIFO and refills the transmit FIFO.
+ */
+static void xfer_rx_handler
+(
+    mss_spi_instance_t * this_spi
+)
+{
+    const mss_spi_xfer_t * xfer = this_spi->xfer;
+    uint32_t rx_raw;
+    uint32_t rd_idx;
+
+    while (0u == (this_spi->hw_reg->STATUS & RX_FIFO_EMPTY_MASK))
+    {
+        rx_raw = this_spi->hw_reg->RX_DATA;
+        if (this_spi->xfer_rx_idx >= xfer->cmd_byte_size)
+        {
+            rd_idx = this_spi->xfer_rx_idx - xfer->cmd_byte_size;
+            if (rd_idx < xfer->rd_byte_size)
+            {
+                xfer->rd_buffer[rd_idx] = (uint8_t)rx_raw;
+            }
+        }
+        ++this_spi->xfer_rx_idx;
+    }
+
+    if (this_spi->xfer_rx_idx >= this_spi->xfer_size)
+    {
+        xfer_next(this_spi);
+    }
+    else
+    {
+        xfer_fill_tx_fifo(this_spi);
+    }
+}
+
 /***************************************************************************//**
  * SPI interrupt service routine.
  */
@@ -1094,7 +1713,15 @@ static void mss_spi_isr
     ASSERT((this_spi == &g_mss_spi0_lo) || (this_spi == &g_mss_spi0_hi) 
             || (this_spi == &g_mss_spi1_lo) || (this_spi == &g_mss_spi1_hi));                                                                     
   
-    if (0u != (*this_mis & RXDONE_IRQ_MASK))
+    if ((0u != (*this_mis & RXDONE_IRQ_MASK)) &&
+        ((const mss_spi_xfer_t *)0 != this_spi->xfer))
+    {
+        /* Master DMA block transfer. Clear the interrupt before emptying the
+         * FIFO so that a frame received meanwhile raises it again. */
+        this_spi->hw_reg->INT_CLEAR = RXDONE_IRQ_MASK;
+        xfer_rx_handler(this_spi);
+    }
+    else if (0u != (*this_mis & RXDONE_IRQ_MASK))
     {
         if (MSS_SPI_SLAVE_XFER_FRAME == this_spi->slave_xfer_mode)
         {
@@ -1124,6 +1751,9 @@ static void mss_spi_isr
                 }
                 ++this_spi->slave_rx_idx;            
             }
+
+            /* Top up the TX FIFO in the same pass. */
+            fill_slave_tx_fifo(this_spi);
         }
         else
         {
@@ -1222,9 +1852,22 @@ static void mss_spi_isr
     if (0u != (*this_mis & SSEND_IRQ_MASK))
     {
         uint32_t rx_size;
+        uint8_t * rx_buffer;
 
         read_slave_rx_fifo(this_spi);
         rx_size = this_spi->slave_rx_idx;
+        rx_buffer = this_spi->slave_rx_buffer;
+
+        /* Switch to the armed buffer pair, if any, before the TX FIFO is
+         * reloaded for the next transaction. */
+        if (0u != this_spi->slave_next_armed)
+        {
+            this_spi->slave_tx_buffer = this_spi->slave_next_tx_buffer;
+            this_spi->slave_tx_size = this_spi->slave_next_tx_size;
+            this_spi->slave_rx_buffer = this_spi->slave_next_rx_buffer;
+            this_spi->slave_rx_size = this_spi->slave_next_rx_size;
+            this_spi->slave_next_armed = 0u;
+        }
 
         /* Re-enable command interrupt if required and clear all the response
          * buffer state in readiness for next response. This must be done
@@ -1254,7 +1897,7 @@ static void mss_spi_isr
         /* Call the receive handler if one exists. */
         if ((mss_spi_block_rx_handler_t)0 != this_spi->block_rx_handler)
         {
-            (*this_spi->block_rx_handler)(this_spi->slave_rx_buffer, rx_size);
+            (*this_spi->block_rx_handler)(rx_buffer, rx_size);
         }
         this_spi->hw_reg->INT_CLEAR = SSEND_IRQ_MASK;
     }
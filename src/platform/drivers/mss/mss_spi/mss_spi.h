@@ -172,6 +172,46 @@ The MSS SPI driver functions are grouped in following categories:
   Note: Unlike in previous versions of this driver, the SPS bit is set in the
         CONTROL register in Motorola modes so that the Slave Select line remains
         asserted throughout block transfers.
+
+  SPI master DMA block transfer control
+  The following functions are used for long master block transfers which must
+  not occupy a processor while they run:
+    - MSS_SPI_dma_transfer_block()
+    - MSS_SPI_dma_transfer_chain()
+    - MSS_SPI_set_dma_engine()
+    - MSS_SPI_dma_complete()
+  MSS_SPI_dma_transfer_block() takes the same buffers as
+  MSS_SPI_transfer_block() but returns straight away and calls a completion
+  handler, of type mss_spi_xfer_handler_t, from interrupt context once the
+  transfer is complete. MSS_SPI_dma_transfer_chain() runs a linked list of
+  mss_spi_xfer_t transfers one after the other, asserting the slave select at
+  the start of the first and releasing it after the last, so a command and
+  several data blocks, or a stream of display lines, are sent as one SPI
+  transaction.
+  The MSS PDMA cannot service the SPI FIFOs: it has no peripheral request
+  lines and always increments both addresses. By default the driver therefore
+  moves the data from its receive interrupt handler, keeping up to a full FIFO
+  of frames in flight, so the SPI clock runs without gaps between bytes while
+  the processor is only interrupted to empty and refill the FIFOs.
+  A fabric DMA controller which can be paced by the SPI can be given to the
+  driver with MSS_SPI_set_dma_engine(). The driver then programs each command
+  and read phase through the mss_spi_dma_engine_t functions, and the DMA
+  controller's driver reports the end of each phase by calling
+  MSS_SPI_dma_complete().
+  Note: The MSS_SPI_transfer_block() and MSS_SPI_transfer_frame() functions
+        must not be called while a DMA block transfer is in progress.
+
+  SPI master transaction queue
+  MSS_SPI_queue_transaction() adds an mss_spi_transaction_t, a chain of block
+  transfers for one slave, to a queue which the driver runs one transaction
+  after the other from its interrupt handler, with no processor involvement
+  between them. Each slave's mode, clock divider and frame size are registered
+  once with MSS_SPI_configure_master_mode(), which keeps them in the driver's
+  per slave configuration. Before each queued transaction the driver compares
+  that configuration with the SPI registers and only rewrites, with the SPI
+  briefly disabled, the registers which differ. Back-to-back transactions to
+  the same slave, or to slaves sharing a configuration, therefore only change
+  the slave select.
  
   SPI slave frame transfer control
   The following functions are used as part of SPI slave frame transfers:
@@ -195,6 +235,7 @@ The MSS SPI driver functions are grouped in following categories:
   SPI slave block transfer control
   The following functions are used as part of SPI slave block transfers:
     - MSS_SPI_set_slave_block_buffers()
+    - MSS_SPI_arm_slave_block_buffers()
     - MSS_SPI_set_cmd_handler()
     - MSS_SPI_set_cmd_response()
   The MSS_SPI_set_slave_block_buffers() function is used to configure a MSS SPI
@@ -219,6 +260,18 @@ The MSS SPI driver functions are grouped in following categories:
   typically include one or more bytes allowing for the turn around time required
   for the command handler function to execute and call
   MSS_SPI_set_cmd_response().
+  The MSS_SPI_arm_slave_block_buffers() function provides double buffering.
+  It arms the transmit and receive buffer pair used for the next transaction.
+  When the slave select is released, the driver switches to the armed pair and
+  preloads the transmit FIFO from its transmit buffer within the same
+  interrupt, so that a master starting the next transaction straight away does
+  not see an underrun. It then passes the receive buffer of the completed
+  transaction to the block receive handler. The application processes the
+  received data in place and arms the pair it has finished with again, so the
+  two pairs are used in turn without copying. If no pair is armed when the
+  slave select is released, the current buffers are reused as before.
+  While a block transfer is in progress, each receive interrupt empties the
+  receive FIFO and then tops up the transmit FIFO in the same pass.
   
  *//*=========================================================================*/
 #ifndef MSS_SPI_H_
@@ -226,6 +279,7 @@ The MSS SPI driver functions are grouped in following categories:
 
 #include <stddef.h>
 #include <stdint.h>
+#include "mpfs_hal/common/mss_clk_scale.h"
 
 /*Register map of the MPFS MSS SPI*/
 typedef struct
@@ -406,6 +460,67 @@ typedef enum __mss_spi_sxfer_mode_t
     MSS_SPI_SLAVE_XFER_FRAME = 2  /* Single frame transfers */
 } mss_spi_sxfer_mode_t;
 
+/***************************************************************************//**
+  The mss_spi_xfer_t structure describes one master block transfer of a chain
+  passed to MSS_SPI_dma_transfer_chain(). As with MSS_SPI_transfer_block(),
+  cmd_byte_size bytes are sent from cmd_buffer and then rd_byte_size bytes are
+  received into rd_buffer. Either size may be 0. The next field points to the
+  next transfer of the chain, or is NULL for the last one.
+ */
+typedef struct __mss_spi_xfer_t
+{
+    const uint8_t * cmd_buffer;
+    uint32_t cmd_byte_size;
+    uint8_t * rd_buffer;
+    uint32_t rd_byte_size;
+    const struct __mss_spi_xfer_t * next;
+} mss_spi_xfer_t;
+
+/***************************************************************************//**
+  This defines the function prototype of the completion handlers passed to
+  MSS_SPI_dma_transfer_block() and MSS_SPI_dma_transfer_chain(). The chain
+  parameter is the first transfer of the completed chain. The handler is
+  called from interrupt context and may start the next transfer.
+ */
+struct __mss_spi_instance_t;
+typedef void (*mss_spi_xfer_handler_t)(struct __mss_spi_instance_t * this_spi,
+                                       const mss_spi_xfer_t * chain);
+
+/***************************************************************************//**
+  The mss_spi_transaction_t structure describes one transaction queued with
+  MSS_SPI_queue_transaction(): the chain of transfers is run with the slave
+  select of slave asserted, and handler is called with the chain when it is
+  complete. The next field is used by the driver to link the queue.
+ */
+typedef struct __mss_spi_transaction_t
+{
+    mss_spi_slave_t slave;
+    const mss_spi_xfer_t * chain;
+    mss_spi_xfer_handler_t handler;
+    struct __mss_spi_transaction_t * next;
+} mss_spi_transaction_t;
+
+/***************************************************************************//**
+  Fabric DMA engine used for master DMA block transfers.
+  This structure is filled in by the driver of a fabric DMA controller and
+  passed to MSS_SPI_set_dma_engine().
+
+  The start function starts a transfer of length frames through the SPI
+  registers at hw_reg. The frames are written to TX_DATA from tx_buffer, or
+  are 0 when tx_buffer is NULL, and the frames read from RX_DATA are stored in
+  rx_buffer, or discarded when rx_buffer is NULL. It returns non-zero if the
+  transfer was started.
+
+  The p_context value is passed to the start function.
+ */
+typedef struct __mss_spi_dma_engine_t
+{
+    uint8_t (*start)(void * p_context, SPI_TypeDef * hw_reg,
+                     const uint8_t * tx_buffer, uint8_t * rx_buffer,
+                     uint32_t length);
+    void * p_context;
+} mss_spi_dma_engine_t;
+
 /***************************************************************************//**
   There is one instance of this structure for each of the microprocessor
   subsystem's SPIs. Instances of this structure are used to identify a specific
@@ -436,6 +551,13 @@ typedef struct __mss_spi_instance_t
     uint8_t * slave_rx_buffer;          /*!< Pointer to buffer where data received by a slave will be stored. */
     uint32_t slave_rx_size;             /*!< Slave receive buffer siSze. */
     uint32_t slave_rx_idx;              /*!< Current index into slave receive buffer. */
+
+    /* Slave block buffers armed for the next transaction: */
+    const uint8_t * slave_next_tx_buffer;   /*!< Transmit buffer of the armed pair. */
+    uint32_t slave_next_tx_size;            /*!< Size of the armed transmit buffer. */
+    uint8_t * slave_next_rx_buffer;         /*!< Receive buffer of the armed pair. */
+    uint32_t slave_next_rx_size;            /*!< Size of the armed receive buffer. */
+    uint8_t slave_next_armed;               /*!< Set while a buffer pair is armed. */
     
     /* Configuration for each target slave. */
     mss_spi_slave_cfg_t slaves_cfg[MSS_SPI_MAX_NB_OF_SLAVES];
@@ -454,6 +576,23 @@ typedef struct __mss_spi_instance_t
     /* MSS SPI reset handler*/
     mss_spi_oveflow_handler_t buffer_overflow_handler;
 
+    /* Master DMA block transfers: */
+    const mss_spi_dma_engine_t * dma_engine;    /*!< Fabric DMA engine, or NULL for driver interrupt handling. */
+    mss_spi_xfer_handler_t xfer_handler;        /*!< Chain completion handler. */
+    const mss_spi_xfer_t * xfer_chain;          /*!< First transfer of the chain in progress. */
+    const mss_spi_xfer_t * volatile xfer;       /*!< Transfer in progress, NULL when idle. */
+    mss_spi_xfer_t xfer_single;                 /*!< Chain used by MSS_SPI_dma_transfer_block(). */
+    uint32_t xfer_size;                         /*!< Number of frames in the transfer in progress. */
+    uint32_t xfer_tx_idx;                       /*!< Number of frames written to the TX FIFO. */
+    uint32_t xfer_rx_idx;                       /*!< Number of frames read from the RX FIFO. */
+    uint8_t xfer_slave;                         /*!< Slave selected for the chain, MSS_SPI_MAX_NB_OF_SLAVES if none. */
+    uint8_t xfer_rd_phase;                      /*!< Set while the DMA engine runs the read phase. */
+
+    /* Master transaction queue: */
+    mss_spi_transaction_t * txn_head;           /*!< Transaction in progress, then the queued ones. */
+    mss_spi_transaction_t * txn_tail;           /*!< Last queued transaction. */
+    mss_spi_transaction_t * xfer_txn;           /*!< Transaction the chain in progress belongs to, or NULL. */
+
 } mss_spi_instance_t;
 
 
@@ -930,6 +1069,219 @@ void MSS_SPI_transfer_block
     uint32_t rd_byte_size
 );
 
+/***************************************************************************//**
+  The MSS_SPI_set_dma_engine() function selects the fabric DMA engine used by
+  MSS_SPI_dma_transfer_block() and MSS_SPI_dma_transfer_chain(). Passing NULL
+  selects the driver's interrupt handling, which is the default after
+  MSS_SPI_init(). It must not be called while a DMA block transfer is in
+  progress.
+
+  @param this_spi
+    The this_spi parameter is a pointer to an mss_spi_instance_t structure
+    identifying the MSS SPI hardware block to operate on.
+
+  @param engine
+    The engine parameter is a pointer to the DMA engine description. It must
+    remain valid while it is selected.
+ */
+void MSS_SPI_set_dma_engine
+(
+    mss_spi_instance_t * this_spi,
+    const mss_spi_dma_engine_t * engine
+);
+
+/***************************************************************************//**
+  The MSS_SPI_dma_transfer_block() function starts a master block transfer and
+  returns straight away. The transfer is the same as the one performed by
+  MSS_SPI_transfer_block(), and the slave select must likewise be set by the
+  application. The handler is called from interrupt context when the last
+  byte has been received.
+
+  @param this_spi
+    The this_spi parameter is a pointer to an mss_spi_instance_t structure
+    identifying the MSS SPI hardware block to operate on.
+
+  @param cmd_buffer
+    The cmd_buffer parameter is a pointer to the buffer containing the data
+    sent by the master. It must remain valid until the handler is called.
+
+  @param cmd_byte_size
+    The cmd_byte_size parameter specifies the number of bytes contained in
+    cmd_buffer that will be sent.
+
+  @param rd_buffer
+    The rd_buffer parameter is a pointer to the buffer where the data received
+    from the slave after the command has been sent will be stored.
+
+  @param rd_byte_size
+    The rd_byte_size parameter specifies the number of bytes to be received
+    from the slave.
+
+  @param handler
+    The handler parameter is the completion handler. It may be NULL.
+
+  @return
+    This function returns 1 if the transfer was started, or 0 if a DMA block
+    transfer is already in progress, there is nothing to transfer or the DMA
+    engine did not accept the transfer.
+ */
+uint8_t MSS_SPI_dma_transfer_block
+(
+    mss_spi_instance_t * this_spi,
+    const uint8_t cmd_buffer[],
+    uint32_t cmd_byte_size,
+    uint8_t rd_buffer[],
+    uint32_t rd_byte_size,
+    mss_spi_xfer_handler_t handler
+);
+
+/***************************************************************************//**
+  The MSS_SPI_dma_transfer_chain() function starts a chain of master block
+  transfers and returns straight away. When slave is a valid slave, it is
+  selected with MSS_SPI_set_slave_select() before the first transfer and its
+  slave select is released after the last one, so it stays asserted for the
+  whole chain. The handler is called from interrupt context at the end of the
+  chain.
+
+  @param this_spi
+    The this_spi parameter is a pointer to an mss_spi_instance_t structure
+    identifying the MSS SPI hardware block to operate on.
+
+  @param slave
+    The slave parameter is the slave selected for the chain, or
+    MSS_SPI_MAX_NB_OF_SLAVES to leave the slave select to the application.
+
+  @param chain
+    The chain parameter is the first transfer of the chain. The transfers and
+    their buffers must remain valid until the handler is called.
+
+  @param handler
+    The handler parameter is the completion handler. It may be NULL.
+
+  @return
+    This function returns 1 if the chain was started, or 0 if a DMA block
+    transfer is already in progress, the chain holds nothing to transfer or
+    the DMA engine did not accept the transfer.
+
+  Example:
+  @code
+      static const uint8_t g_cmd[4] = { 0x2C, 0x00, 0x00, 0x00 };
+      static uint8_t g_line[2][480u * 2u];
+      static mss_spi_xfer_t g_xfer[3];
+
+      void frame_done(mss_spi_instance_t * this_spi,
+                      const mss_spi_xfer_t * chain)
+      {
+          g_frame_done = 1u;
+      }
+
+      g_xfer[0].cmd_buffer = g_cmd;
+      g_xfer[0].cmd_byte_size = sizeof(g_cmd);
+      g_xfer[0].rd_byte_size = 0u;
+      g_xfer[0].next = &g_xfer[1];
+      g_xfer[1].cmd_buffer = g_line[0];
+      g_xfer[1].cmd_byte_size = sizeof(g_line[0]);
+      g_xfer[1].rd_byte_size = 0u;
+      g_xfer[1].next = &g_xfer[2];
+      g_xfer[2].cmd_buffer = g_line[1];
+      g_xfer[2].cmd_byte_size = sizeof(g_line[1]);
+      g_xfer[2].rd_byte_size = 0u;
+      g_xfer[2].next = 0;
+
+      (void)MSS_SPI_dma_transfer_chain(&g_mss_spi0_lo, MSS_SPI_SLAVE_0,
+                                       g_xfer, frame_done);
+  @endcode
+ */
+uint8_t MSS_SPI_dma_transfer_chain
+(
+    mss_spi_instance_t * this_spi,
+    mss_spi_slave_t slave,
+    const mss_spi_xfer_t * chain,
+    mss_spi_xfer_handler_t handler
+);
+
+/***************************************************************************//**
+  The MSS_SPI_dma_complete() function is called by the fabric DMA controller's
+  driver, usually from its interrupt handler, when a transfer started through
+  the mss_spi_dma_engine_t start function completes. It starts the next phase
+  or transfer of the chain, or completes the chain.
+
+  @param this_spi
+    The this_spi parameter is a pointer to an mss_spi_instance_t structure
+    identifying the MSS SPI hardware block to operate on.
+ */
+void MSS_SPI_dma_complete
+(
+    mss_spi_instance_t * this_spi
+);
+
+/***************************************************************************//**
+  The MSS_SPI_queue_transaction() function adds a transaction to the end of
+  the master transaction queue and returns straight away. The transaction is
+  started at once if the SPI is idle, otherwise from the driver's interrupt
+  handler as soon as the transactions queued before it are complete.
+
+  The slave must have been configured with MSS_SPI_configure_master_mode().
+  Only the SPI registers whose value differs from the slave's configuration
+  are rewritten before the transaction starts. The slave select of the slave
+  is asserted for the whole chain and released at its end, and the handler is
+  then called from interrupt context. A transaction the DMA engine does not
+  accept, or which holds nothing to transfer, is completed without any
+  transfer.
+
+  @param this_spi
+    The this_spi parameter is a pointer to an mss_spi_instance_t structure
+    identifying the MSS SPI hardware block to operate on.
+
+  @param txn
+    The txn parameter is a pointer to the transaction. The transaction, its
+    transfers and their buffers must remain valid until its handler is
+    called. The transaction may be queued again from its handler.
+
+  Example:
+  @code
+      static const uint8_t g_rd_status[2] = { 0x05, 0x00 };
+      static uint8_t g_status;
+      static mss_spi_xfer_t g_flash_xfer;
+      static mss_spi_xfer_t g_adc_xfer;
+      static mss_spi_transaction_t g_flash_txn;
+      static mss_spi_transaction_t g_adc_txn;
+      static uint8_t g_adc_sample[2];
+
+      MSS_SPI_configure_master_mode(&g_mss_spi0_lo, MSS_SPI_SLAVE_0,
+                                    MSS_SPI_MODE0, 4u,
+                                    MSS_SPI_BLOCK_TRANSFER_FRAME_SIZE, 0);
+      MSS_SPI_configure_master_mode(&g_mss_spi0_lo, MSS_SPI_SLAVE_1,
+                                    MSS_SPI_MODE3, 32u,
+                                    MSS_SPI_BLOCK_TRANSFER_FRAME_SIZE, 0);
+
+      g_flash_xfer.cmd_buffer = g_rd_status;
+      g_flash_xfer.cmd_byte_size = 1u;
+      g_flash_xfer.rd_buffer = &g_status;
+      g_flash_xfer.rd_byte_size = 1u;
+      g_flash_xfer.next = 0;
+      g_flash_txn.slave = MSS_SPI_SLAVE_0;
+      g_flash_txn.chain = &g_flash_xfer;
+      g_flash_txn.handler = status_read;
+
+      g_adc_xfer.cmd_byte_size = 0u;
+      g_adc_xfer.rd_buffer = g_adc_sample;
+      g_adc_xfer.rd_byte_size = sizeof(g_adc_sample);
+      g_adc_xfer.next = 0;
+      g_adc_txn.slave = MSS_SPI_SLAVE_1;
+      g_adc_txn.chain = &g_adc_xfer;
+      g_adc_txn.handler = sample_read;
+
+      MSS_SPI_queue_transaction(&g_mss_spi0_lo, &g_flash_txn);
+      MSS_SPI_queue_transaction(&g_mss_spi0_lo, &g_adc_txn);
+  @endcode
+ */
+void MSS_SPI_queue_transaction
+(
+    mss_spi_instance_t * this_spi,
+    mss_spi_transaction_t * txn
+);
+
 /*==============================================================================
  * Slave functions
  *============================================================================*/
@@ -1138,6 +1490,69 @@ void MSS_SPI_set_slave_block_buffers
     mss_spi_block_rx_handler_t spi_block_rx_handler
 );
 
+/***************************************************************************//**
+  The MSS_SPI_arm_slave_block_buffers() function arms the transmit and receive
+  buffers used by an MSS SPI slave for the next block transaction, after
+  MSS_SPI_set_slave_block_buffers() has set up block transfers. When the slave
+  select is released at the end of the current transaction, the armed pair
+  becomes the current pair and the transmit FIFO is preloaded from it before
+  the block receive handler is called with the receive buffer of the completed
+  transaction. Only one pair can be armed at a time.
+
+  @param this_spi
+    The this_spi parameter is a pointer to an mss_spi_instance_t structure
+    identifying the MSS SPI hardware block to operate on.
+
+  @param tx_buffer
+    The tx_buffer parameter is a pointer to the data returned to the master in
+    the next transaction. It may be NULL if tx_buff_size is 0.
+
+  @param tx_buff_size
+    The tx_buff_size parameter specifies the number of bytes of tx_buffer.
+
+  @param rx_buffer
+    The rx_buffer parameter is a pointer to the buffer the data received in the
+    next transaction will be stored in.
+
+  @param rx_buff_size
+    The rx_buff_size parameter specifies the size of rx_buffer.
+
+  @return
+    This function returns 1 if the pair was armed, or 0 if a pair is already
+    armed.
+
+  Example:
+  @code
+      static uint8_t g_rx[2][256];
+      static uint8_t g_tx[2][256];
+
+      void block_rx_handler(uint8_t * rx_buff, uint32_t rx_size)
+      {
+          uint32_t idx = (rx_buff == g_rx[0]) ? 0u : 1u;
+
+          process_packet(rx_buff, rx_size, g_tx[idx]);
+          (void)MSS_SPI_arm_slave_block_buffers(&g_mss_spi1_lo,
+                                                g_tx[idx], sizeof(g_tx[idx]),
+                                                rx_buff, sizeof(g_rx[idx]));
+      }
+
+      MSS_SPI_set_slave_block_buffers(&g_mss_spi1_lo, g_tx[0],
+                                      sizeof(g_tx[0]), g_rx[0],
+                                      sizeof(g_rx[0]), block_rx_handler);
+      (void)MSS_SPI_arm_slave_block_buffers(&g_mss_spi1_lo, g_tx[1],
+                                            sizeof(g_tx[1]), g_rx[1],
+                                            sizeof(g_rx[1]));
+  @endcode
+ */
+uint8_t MSS_SPI_arm_slave_block_buffers
+(
+    mss_spi_instance_t * this_spi,
+    const uint8_t * tx_buffer,
+    uint32_t tx_buff_size,
+    uint8_t * rx_buffer,
+    uint32_t rx_buff_size
+);
+
 /***************************************************************************//**
   The MSS_SPI_set_cmd_handler() function specifies a command handler function
   that will be called when the number of bytes received reaches the command size
@@ -1317,6 +1732,40 @@ void MSS_SPI_set_cmd_response
     uint32_t resp_buff_size
 );
 
+/***************************************************************************//**
+  The MSS_SPI_clock_notify() function is the notifier through which the MSS SPI
+  driver follows the changes of the APB clock made with mss_clk_set_opp().
+  Before the change it waits for the transfer chain in progress, if any, to
+  complete. After the change it recalculates the clock divider of each slave
+  configured with MSS_SPI_configure_master_mode(), and of the slave currently
+  selected, for the fastest SPI clock not above the one used before the
+  change. Divider ratios out of the range of the MSS SPI are clamped to it.
+
+  @param event
+    MSS_CLK_PRE_CHANGE or MSS_CLK_POST_CHANGE.
+
+  @param change
+    The operating points and clock rates before and after the change.
+
+  @param arg
+    The arg parameter is a pointer to the mss_spi_instance_t structure of the
+    MSS SPI, given to the HAL in the mss_clk_notifier_t structure.
+
+  Example:
+  @code
+    static mss_clk_notifier_t g_spi0_clk = { MSS_SPI_clock_notify,
+            &g_mss_spi0_lo, NULL };
+
+    mss_clk_register_notifier(&g_spi0_clk);
+  @endcode
+ */
+void MSS_SPI_clock_notify
+(
+    uint8_t event,
+    const mss_clk_change_t * change,
+    void * arg
+);
+
 #ifdef __cplusplus
 }
 #endif
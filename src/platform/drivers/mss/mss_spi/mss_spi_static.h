@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem SPI polled frame transfers for an SPI
+ * known at compile time.
+ *
+ */
+/*=========================================================================*//**
+  @section intro_sec Introduction
+  MSS_SPI_transfer_frame() takes a pointer to a mss_spi_instance_t, loads the
+  register address from it and sets the SPI up for a single frame on each call.
+  An application transferring frames on one SPI in a hot path can instead give
+  the register block of the SPI, MSS_SPI0_LO_BASE, MSS_SPI1_LO_BASE,
+  MSS_SPI0_HI_BASE or MSS_SPI1_HI_BASE, to the inline functions of this
+  header. Each call then compiles to the register accesses of that SPI.
+
+  The SPI is set up as a master as usual, with the slave selected, and one
+  MSS_SPI_transfer_frame() made first: it leaves the SPI set for single frame
+  transfers, which the functions below rely on and do not set again.
+
+  Example:
+  @code
+    #include "drivers/mss/mss_spi/mss_spi_static.h"
+
+    MSS_SPI_set_slave_select(&g_mss_spi0_lo, MSS_SPI_SLAVE_0);
+    (void)MSS_SPI_transfer_frame(&g_mss_spi0_lo, 0u);
+
+    for (inc = 0u; inc < count; inc++)
+    {
+        rx[inc] = MSS_SPI_static_transfer_frame(MSS_SPI0_LO_BASE, tx[inc]);
+    }
+  @endcode
+ *//*=========================================================================*/
+#ifndef MSS_SPI_STATIC_H_
+#define MSS_SPI_STATIC_H_
+
+#include <stdint.h>
+#include "mss_spi.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MSS_SPI_STATIC_TX_DONE          0x00000001u
+#define MSS_SPI_STATIC_RX_DATA_READY    0x00000002u
+
+/***************************************************************************//**
+  MSS_SPI_static_transfer_frame() sends one frame and returns the frame
+  received, as MSS_SPI_transfer_frame() does.
+ */
+static inline __attribute__((always_inline)) uint32_t
+MSS_SPI_static_transfer_frame
+(
+    SPI_TypeDef * const hw_reg,
+    uint32_t tx_bits
+)
+{
+    hw_reg->TX_DATA = tx_bits;
+
+    while (0u == (hw_reg->STATUS & MSS_SPI_STATIC_TX_DONE))
+    {
+    }
+
+    while (0u == (hw_reg->STATUS & MSS_SPI_STATIC_RX_DATA_READY))
+    {
+    }
+
+    return hw_reg->RX_DATA;
+}
+
+/***************************************************************************//**
+  MSS_SPI_static_transfer_frames() transfers count frames, one at a time, from
+  tx_frames to rx_frames. rx_frames may be 0 to drop the frames received.
+ */
+static inline __attribute__((always_inline)) void
+MSS_SPI_static_transfer_frames
+(
+    SPI_TypeDef * const hw_reg,
+    const uint32_t * tx_frames,
+    uint32_t * rx_frames,
+    uint32_t count
+)
+{
+    uint32_t inc;
+    uint32_t rx_bits;
+
+    for (inc = 0u; inc < count; inc++)
+    {
+        rx_bits = MSS_SPI_static_transfer_frame(hw_reg, tx_frames[inc]);
+
+        if ((uint32_t *)0 != rx_frames)
+        {
+            rx_frames[inc] = rx_bits;
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_SPI_STATIC_H_ */
@@ -0,0 +1,322 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem(MSS) system services entropy pool
+ * implementation.
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "mss_sys_services.h"
+#include "mss_sys_entropy.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Constant definitions
+ */
+#define CHACHA20_KEY_WORDS                      8u
+#define CHACHA20_BLOCK_WORDS                    16u
+#define CHACHA20_BLOCK_SIZE                     64u
+
+#define ROTL32(v, n)    (((v) << (n)) | ((v) >> (32u - (n))))
+
+#define CHACHA20_QR(a, b, c, d)                     \
+    do {                                            \
+        (a) += (b); (d) ^= (a); (d) = ROTL32((d), 16u); \
+        (c) += (d); (b) ^= (c); (b) = ROTL32((b), 12u); \
+        (a) += (b); (d) ^= (a); (d) = ROTL32((d), 8u);  \
+        (c) += (d); (b) ^= (c); (b) = ROTL32((b), 7u);  \
+    } while (0)
+
+/*******************************************************************************
+ * Local variables
+ */
+static uint32_t g_drbg_key[CHACHA20_KEY_WORDS];
+static uint32_t g_drbg_bytes_since_seed = 0u;
+static volatile uint8_t g_drbg_seeded = 0u;
+static volatile uint8_t g_drbg_seed_pending = 0u;
+static volatile long g_drbg_lock = 0;
+
+static uint32_t g_nonce[MSS_SYS_NONCE_SERVICE_RESP_LEN / 4u];
+static mss_sys_service_req_t g_nonce_req;
+
+/*******************************************************************************
+ * Local function declarations
+ */
+static void chacha20_block
+(
+    const uint32_t key[CHACHA20_KEY_WORDS],
+    uint32_t counter,
+    uint32_t out[CHACHA20_BLOCK_WORDS]
+);
+
+static void drbg_rekey(uint32_t counter);
+static void nonce_complete(mss_sys_service_req_t* req);
+
+/*-----------------------------------------------------------------------------
+                             Public Functions
+ -----------------------------------------------------------------------------*/
+
+/***************************************************************************//**
+ * MSS_SYS_ENTROPY_init()
+ * See "mss_sys_entropy.h" for details of how to use this function.
+ */
+uint16_t
+MSS_SYS_ENTROPY_init
+(
+    uint16_t mb_offset
+)
+{
+    uint64_t saved;
+    uint32_t idx;
+    uint16_t status;
+
+    saved = disable_interrupts();
+    spinlock(&g_drbg_lock);
+
+    for (idx = 0u; idx < CHACHA20_KEY_WORDS; idx++)
+    {
+        g_drbg_key[idx] = 0u;
+    }
+
+    g_drbg_bytes_since_seed = 0u;
+    g_drbg_seeded = 0u;
+    g_drbg_seed_pending = 1u;
+
+    spinunlock(&g_drbg_lock);
+    restore_interrupts(saved);
+
+    g_nonce_req.cmd_opcode = (uint8_t)MSS_SYS_NONCE_SERVICE_REQUEST_CMD;
+    g_nonce_req.cmd_data = (uint8_t*)0;
+    g_nonce_req.cmd_data_size = 0u;
+    g_nonce_req.p_response = (uint8_t*)g_nonce;
+    g_nonce_req.response_size = (uint16_t)MSS_SYS_NONCE_SERVICE_RESP_LEN;
+    g_nonce_req.mb_offset = mb_offset;
+    g_nonce_req.response_offset = 0u;
+    g_nonce_req.complete = nonce_complete;
+    g_nonce_req.user_data = 0;
+
+    status = MSS_SYS_service_submit(&g_nonce_req);
+
+    if (MSS_SYS_SUCCESS != status)
+    {
+        /* Retried by the next call to MSS_SYS_ENTROPY_get() */
+        g_drbg_seed_pending = 0u;
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+ * MSS_SYS_ENTROPY_get()
+ * See "mss_sys_entropy.h" for details of how to use this function.
+ */
+uint16_t
+MSS_SYS_ENTROPY_get
+(
+    uint8_t* p_buffer,
+    uint32_t length
+)
+{
+    uint32_t block[CHACHA20_BLOCK_WORDS];
+    uint32_t counter = 1u;
+    uint32_t offset = 0u;
+    uint32_t chunk;
+    uint32_t idx;
+    uint64_t saved;
+    uint8_t request_seed = 0u;
+    uint16_t status = MSS_SYS_PARAM_ERR;
+
+    if ((uint8_t*)0 != p_buffer)
+    {
+        saved = disable_interrupts();
+        spinlock(&g_drbg_lock);
+
+        if (0u == g_drbg_seeded)
+        {
+            status = MSS_SYS_PENDING;
+        }
+        else
+        {
+            while (offset < length)
+            {
+                chacha20_block(g_drbg_key, counter, block);
+                counter++;
+
+                chunk = length - offset;
+                if (chunk > CHACHA20_BLOCK_SIZE)
+                {
+                    chunk = CHACHA20_BLOCK_SIZE;
+                }
+
+                for (idx = 0u; idx < chunk; idx++)
+                {
+                    p_buffer[offset + idx] =
+                        (uint8_t)(block[idx / 4u] >> ((idx % 4u) * 8u));
+                }
+
+                offset += chunk;
+            }
+
+            /* Fast key erasure: the bytes returned cannot be recomputed */
+            drbg_rekey(counter);
+
+            if ((MSS_SYS_ENTROPY_RESEED_INTERVAL - g_drbg_bytes_since_seed) >
+                length)
+            {
+                g_drbg_bytes_since_seed += length;
+            }
+            else
+            {
+                g_drbg_bytes_since_seed = MSS_SYS_ENTROPY_RESEED_INTERVAL;
+            }
+
+            status = MSS_SYS_SUCCESS;
+        }
+
+        if ((0u == g_drbg_seed_pending) &&
+            ((0u == g_drbg_seeded) ||
+             (g_drbg_bytes_since_seed >= MSS_SYS_ENTROPY_RESEED_INTERVAL)))
+        {
+            g_drbg_seed_pending = 1u;
+            request_seed = 1u;
+        }
+
+        spinunlock(&g_drbg_lock);
+        restore_interrupts(saved);
+
+        for (idx = 0u; idx < CHACHA20_BLOCK_WORDS; idx++)
+        {
+            block[idx] = 0u;
+        }
+
+        if (1u == request_seed)
+        {
+            if (MSS_SYS_SUCCESS != MSS_SYS_service_submit(&g_nonce_req))
+            {
+                g_drbg_seed_pending = 0u;
+            }
+        }
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+ Internal functions.
+*/
+
+/*
+ * This function computes the ChaCha20 block (RFC 8439) for the key and block
+ * counter provided, with an all-zero nonce.
+ */
+static void chacha20_block
+(
+    const uint32_t key[CHACHA20_KEY_WORDS],
+    uint32_t counter,
+    uint32_t out[CHACHA20_BLOCK_WORDS]
+)
+{
+    uint32_t in[CHACHA20_BLOCK_WORDS];
+    uint32_t idx;
+
+    in[0] = 0x61707865u;
+    in[1] = 0x3320646Eu;
+    in[2] = 0x79622D32u;
+    in[3] = 0x6B206574u;
+
+    for (idx = 0u; idx < CHACHA20_KEY_WORDS; idx++)
+    {
+        in[4u + idx] = key[idx];
+    }
+
+    in[12] = counter;
+    in[13] = 0u;
+    in[14] = 0u;
+    in[15] = 0u;
+
+    for (idx = 0u; idx < CHACHA20_BLOCK_WORDS; idx++)
+    {
+        out[idx] = in[idx];
+    }
+
+    for (idx = 0u; idx < 10u; idx++)
+    {
+        CHACHA20_QR(out[0], out[4], out[8],  out[12]);
+        CHACHA20_QR(out[1], out[5], out[9],  out[13]);
+        CHACHA20_QR(out[2], out[6], out[10], out[14]);
+        CHACHA20_QR(out[3], out[7], out[11], out[15]);
+        CHACHA20_QR(out[0], out[5], out[10], out[15]);
+        CHACHA20_QR(out[1], out[6], out[11], out[12]);
+        CHACHA20_QR(out[2], out[7], out[8],  out[13]);
+        CHACHA20_QR(out[3], out[4], out[9],  out[14]);
+    }
+
+    for (idx = 0u; idx < CHACHA20_BLOCK_WORDS; idx++)
+    {
+        out[idx] += in[idx];
+        in[idx] = 0u;
+    }
+}
+
+/*
+ * This function replaces the DRBG key with the first half of the block
+ * generated for the counter provided. It must be called with g_drbg_lock held.
+ */
+static void drbg_rekey(uint32_t counter)
+{
+    uint32_t block[CHACHA20_BLOCK_WORDS];
+    uint32_t idx;
+
+    chacha20_block(g_drbg_key, counter, block);
+
+    for (idx = 0u; idx < CHACHA20_KEY_WORDS; idx++)
+    {
+        g_drbg_key[idx] = block[idx];
+    }
+
+    for (idx = 0u; idx < CHACHA20_BLOCK_WORDS; idx++)
+    {
+        block[idx] = 0u;
+    }
+}
+
+/*
+ * Completion callback of the nonce request, called from the message interrupt
+ * handler. The nonce is mixed into the DRBG key and then cleared.
+ */
+static void nonce_complete(mss_sys_service_req_t* req)
+{
+    uint32_t idx;
+
+    spinlock(&g_drbg_lock);
+
+    if (MSS_SYS_SUCCESS == req->status)
+    {
+        for (idx = 0u; idx < CHACHA20_KEY_WORDS; idx++)
+        {
+            g_drbg_key[idx] ^= g_nonce[idx];
+        }
+
+        drbg_rekey(0u);
+        g_drbg_bytes_since_seed = 0u;
+        g_drbg_seeded = 1u;
+    }
+
+    for (idx = 0u; idx < (MSS_SYS_NONCE_SERVICE_RESP_LEN / 4u); idx++)
+    {
+        g_nonce[idx] = 0u;
+    }
+
+    g_drbg_seed_pending = 0u;
+
+    spinunlock(&g_drbg_lock);
+}
+
+#ifdef __cplusplus
+}
+#endif
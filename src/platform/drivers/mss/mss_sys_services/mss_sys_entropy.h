@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * PolarFire SoC Microprocessor Subsystem(MSS) system services entropy pool.
+ */
+
+/*=========================================================================*//**
+  @mainpage PolarFire SoC MSS System services entropy pool
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The entropy pool provides random bytes to the application without a system
+  controller round trip for each request. It is seeded with the output of the
+  nonce service of the system controller and expands the seed with a ChaCha20
+  based deterministic random bit generator (DRBG) running from RAM.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  MSS_SYS_ENTROPY_init() queues a nonce service request using
+  MSS_SYS_service_submit(). When the nonce is received, the message interrupt
+  handler mixes it into the 256-bit key of the DRBG by XORing it into the key
+  and replacing the key with the first half of a ChaCha20 block generated from
+  the result. The nonce buffer is then cleared.
+
+  MSS_SYS_ENTROPY_get() fills the caller's buffer with ChaCha20 blocks
+  generated from the key and then replaces the key with a further block, so
+  that the output already returned cannot be recomputed from the state. The
+  time taken depends only on the number of bytes requested. The function never
+  waits for the system controller: once MSS_SYS_ENTROPY_RESEED_INTERVAL bytes
+  have been returned since the last seed, it queues a new nonce request and
+  keeps serving bytes until the nonce arrives.
+
+  The message interrupt of the system controller must be enabled, as required
+  by MSS_SYS_service_submit(). All the functions can be called from any hart.
+ */
+
+#ifndef MSS_SYS_ENTROPY_H_
+#define MSS_SYS_ENTROPY_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Number of bytes returned by MSS_SYS_ENTROPY_get() after which the DRBG is
+  reseeded with a new nonce from the system controller.
+ */
+#ifndef MSS_SYS_ENTROPY_RESEED_INTERVAL
+#define MSS_SYS_ENTROPY_RESEED_INTERVAL                         16384u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_ENTROPY_init() function resets the entropy pool and queues the
+  nonce service request which seeds it.
+
+  @param mb_offset
+         Mailbox offset used for the nonce service requests, as for
+         MSS_SYS_nonce_service().
+
+  @return
+         This function returns the value returned by MSS_SYS_service_submit()
+         for the seed request.
+
+  Example:
+  @code
+       status = MSS_SYS_ENTROPY_init(0u);
+  @endcode
+ */
+uint16_t
+MSS_SYS_ENTROPY_init
+(
+    uint16_t mb_offset
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_ENTROPY_get() function copies random bytes from the entropy pool
+  to the buffer provided.
+
+  @param p_buffer
+         Buffer receiving the random bytes.
+
+  @param length
+         Number of random bytes requested.
+
+  @return
+         This function returns MSS_SYS_SUCCESS when the buffer was filled,
+         MSS_SYS_PENDING when the pool has not been seeded yet and no bytes were
+         written, or MSS_SYS_PARAM_ERR when p_buffer is null.
+
+  Example:
+  @code
+       uint8_t client_random[32];
+
+       while (MSS_SYS_PENDING == MSS_SYS_ENTROPY_get(client_random,
+                                                     sizeof(client_random)))
+       {
+           ;
+       }
+  @endcode
+ */
+uint16_t
+MSS_SYS_ENTROPY_get
+(
+    uint8_t* p_buffer,
+    uint32_t length
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_SYS_ENTROPY_H_ */
@@ -0,0 +1,228 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem(MSS) system services device identity
+ * bundle implementation.
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "mss_sys_services.h"
+#include "mss_sys_identity.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Constant definitions
+ */
+#define IDENTITY_SERVICE_COUNT                  5u
+
+/*******************************************************************************
+ * Local variables
+ */
+extern uint8_t g_service_mode;
+
+static mss_sys_service_req_t g_identity_req[IDENTITY_SERVICE_COUNT];
+static volatile uint8_t g_identity_done_count = 0u;
+
+/*******************************************************************************
+ * Local function declarations
+ */
+static void identity_release
+(
+    mss_sys_identity_t* p_bundle,
+    uint16_t status
+);
+
+static void identity_req_complete(mss_sys_service_req_t* req);
+
+/*-----------------------------------------------------------------------------
+                             Public Functions
+ -----------------------------------------------------------------------------*/
+
+/***************************************************************************//**
+ * MSS_SYS_IDENTITY_read()
+ * See "mss_sys_identity.h" for details of how to use this function.
+ */
+uint16_t
+MSS_SYS_IDENTITY_read
+(
+    mss_sys_identity_t* p_bundle,
+    uint16_t mb_offset
+)
+{
+    uint32_t marker;
+    uint8_t idx;
+    uint16_t status = MSS_SYS_PARAM_ERR;
+
+    if ((mss_sys_identity_t*)0 != p_bundle)
+    {
+        marker = atomic_swap(&p_bundle->marker, MSS_SYS_IDENTITY_BUSY_MARKER);
+
+        if (MSS_SYS_IDENTITY_READY_MARKER == marker)
+        {
+            /* Another hart may see the busy marker in the meantime and
+             * retry */
+            p_bundle->marker = MSS_SYS_IDENTITY_READY_MARKER;
+            status = MSS_SYS_SUCCESS;
+        }
+        else if (MSS_SYS_IDENTITY_BUSY_MARKER == marker)
+        {
+            status = MSS_SYS_PENDING;
+        }
+        else if (MSS_SYS_SERVICE_INTERRUPT_MODE == g_service_mode)
+        {
+            p_bundle->status = MSS_SYS_SUCCESS;
+            g_identity_done_count = 0u;
+
+            g_identity_req[0].cmd_opcode =
+                    (uint8_t)MSS_SYS_SERIAL_NUMBER_REQUEST_CMD;
+            g_identity_req[0].p_response = p_bundle->serial_number;
+            g_identity_req[0].response_size =
+                    (uint16_t)MSS_SYS_SERIAL_NUMBER_RESP_LEN;
+
+            g_identity_req[1].cmd_opcode =
+                    (uint8_t)MSS_SYS_USERCODE_REQUEST_CMD;
+            g_identity_req[1].p_response = p_bundle->user_code;
+            g_identity_req[1].response_size =
+                    (uint16_t)MSS_SYS_USERCODE_RESP_LEN;
+
+            g_identity_req[2].cmd_opcode =
+                    (uint8_t)MSS_SYS_DESIGN_INFO_REQUEST_CMD;
+            g_identity_req[2].p_response = p_bundle->design_info;
+            g_identity_req[2].response_size =
+                    (uint16_t)MSS_SYS_DESIGN_INFO_RESP_LEN;
+
+            g_identity_req[3].cmd_opcode =
+                    (uint8_t)MSS_SYS_DEVICE_CERTIFICATE_REQUEST_CMD;
+            g_identity_req[3].p_response = p_bundle->device_certificate;
+            g_identity_req[3].response_size =
+                    (uint16_t)MSS_SYS_DEVICE_CERTIFICATE_RESP_LEN;
+
+            g_identity_req[4].cmd_opcode =
+                    (uint8_t)MSS_SYS_QUERY_SECURITY_REQUEST_CMD;
+            g_identity_req[4].p_response = p_bundle->security_locks;
+            g_identity_req[4].response_size =
+                    (uint16_t)(MSS_SYS_QUERY_SECURITY_RESP_LEN + 3u);
+
+            status = MSS_SYS_SUCCESS;
+
+            for (idx = 0u; idx < IDENTITY_SERVICE_COUNT; idx++)
+            {
+                g_identity_req[idx].cmd_data = (uint8_t*)0;
+                g_identity_req[idx].cmd_data_size = 0u;
+                g_identity_req[idx].mb_offset = mb_offset;
+                g_identity_req[idx].response_offset = 0u;
+                g_identity_req[idx].complete = identity_req_complete;
+                g_identity_req[idx].user_data = (void*)p_bundle;
+
+                if (MSS_SYS_SUCCESS == status)
+                {
+                    /* Only the first request can be refused as busy, the
+                     * others are queued behind it */
+                    status = MSS_SYS_service_submit(&g_identity_req[idx]);
+                }
+            }
+
+            if (MSS_SYS_SUCCESS == status)
+            {
+                status = MSS_SYS_PENDING;
+            }
+            else
+            {
+                identity_release(p_bundle, status);
+            }
+        }
+        else
+        {
+            status = MSS_SYS_get_serial_number(p_bundle->serial_number,
+                                               mb_offset);
+
+            if (MSS_SYS_SUCCESS == status)
+            {
+                status = MSS_SYS_get_user_code(p_bundle->user_code,
+                                               mb_offset);
+            }
+
+            if (MSS_SYS_SUCCESS == status)
+            {
+                status = MSS_SYS_get_design_info(p_bundle->design_info,
+                                                 mb_offset);
+            }
+
+            if (MSS_SYS_SUCCESS == status)
+            {
+                status = MSS_SYS_get_device_certificate(
+                        p_bundle->device_certificate, mb_offset);
+            }
+
+            if (MSS_SYS_SUCCESS == status)
+            {
+                status = MSS_SYS_query_security(p_bundle->security_locks,
+                                                mb_offset);
+            }
+
+            identity_release(p_bundle, status);
+        }
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+ Internal functions.
+*/
+
+/*
+ * This function records the status of the bundle and marks it as complete, or
+ * as not read when one of the services failed.
+ */
+static void identity_release
+(
+    mss_sys_identity_t* p_bundle,
+    uint16_t status
+)
+{
+    p_bundle->status = status;
+
+    /* Make the responses visible to the other harts before the marker */
+    mb();
+
+    if (MSS_SYS_SUCCESS == status)
+    {
+        p_bundle->marker = MSS_SYS_IDENTITY_READY_MARKER;
+    }
+    else
+    {
+        p_bundle->marker = 0u;
+    }
+}
+
+/*
+ * Completion callback of the identity service requests, called from the
+ * message interrupt handler in the order the requests were submitted.
+ */
+static void identity_req_complete(mss_sys_service_req_t* req)
+{
+    mss_sys_identity_t* p_bundle = (mss_sys_identity_t*)req->user_data;
+
+    if ((MSS_SYS_SUCCESS == p_bundle->status) &&
+        (MSS_SYS_SUCCESS != req->status))
+    {
+        p_bundle->status = req->status;
+    }
+
+    g_identity_done_count++;
+
+    if (IDENTITY_SERVICE_COUNT == g_identity_done_count)
+    {
+        identity_release(p_bundle, p_bundle->status);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * PolarFire SoC Microprocessor Subsystem(MSS) system services device identity
+ * bundle.
+ */
+
+
+/*=========================================================================*//**
+  @mainpage PolarFire SoC MSS System services device identity bundle
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The device identity bundle holds the results of the serial number, user code,
+  design information, device certificate and query security services. The
+  services are requested once at boot and the results are kept in memory
+  shared by all the harts, so that each hart can read the device identity
+  without a system controller request of its own.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  The bundle is a mss_sys_identity_t structure placed in memory accessible by
+  all the harts, typically the shared memory pointed to by the shared_mem
+  member of the Hart Local Storage when MPFS_HAL_SHARED_MEM_ENABLED is defined.
+  All the harts must use the same structure.
+
+  Each hart calls MSS_SYS_IDENTITY_read() at boot. The first call claims the
+  bundle by atomically writing the marker member of the structure, so the
+  services are requested only once whichever hart runs first. The other calls
+  return MSS_SYS_PENDING until the bundle is complete and MSS_SYS_SUCCESS
+  afterwards, without requesting any services.
+
+  In interrupt mode the five services are queued together using
+  MSS_SYS_service_submit(), so that the message interrupt handler starts each
+  service as soon as the previous one is complete. MSS_SYS_IDENTITY_read()
+  returns MSS_SYS_PENDING without waiting. In polling mode the services are
+  requested one after the other and MSS_SYS_IDENTITY_read() returns when the
+  bundle is complete.
+
+  When one of the services fails, the bundle is released so that the next call
+  to MSS_SYS_IDENTITY_read() requests the services again. The status of the
+  failed service is kept in the status member of the structure.
+ */
+
+#ifndef MSS_SYS_IDENTITY_H_
+#define MSS_SYS_IDENTITY_H_
+
+#include <stdint.h>
+#include "mss_sys_services.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Values of the marker member of mss_sys_identity_t. Any other value means the
+  bundle has not been read.
+ */
+#define MSS_SYS_IDENTITY_READY_MARKER                           0xB1B2B3B4UL
+#define MSS_SYS_IDENTITY_BUSY_MARKER                            0xB1B2B3B5UL
+
+/*-------------------------------------------------------------------------*//**
+  Device identity bundle
+  The mss_sys_identity_t type holds the results of the identity services.
+
+  marker
+    MSS_SYS_IDENTITY_READY_MARKER when the bundle is complete.
+
+  status
+    MSS_SYS_SUCCESS when all the services succeeded, otherwise the status of
+    the first service that failed.
+
+  serial_number, user_code, design_info, device_certificate
+    Responses of MSS_SYS_get_serial_number(), MSS_SYS_get_user_code(),
+    MSS_SYS_get_design_info() and MSS_SYS_get_device_certificate().
+
+  security_locks
+    Response of MSS_SYS_query_security(). Only the first
+    MSS_SYS_QUERY_SECURITY_RESP_LEN bytes are valid, the response being read
+    as whole mailbox words.
+ */
+typedef struct
+{
+    volatile uint32_t marker;
+    volatile uint16_t status;
+    uint8_t serial_number[MSS_SYS_SERIAL_NUMBER_RESP_LEN];
+    uint8_t user_code[MSS_SYS_USERCODE_RESP_LEN];
+    uint8_t design_info[MSS_SYS_DESIGN_INFO_RESP_LEN];
+    uint8_t security_locks[MSS_SYS_QUERY_SECURITY_RESP_LEN + 3u];
+    uint8_t device_certificate[MSS_SYS_DEVICE_CERTIFICATE_RESP_LEN];
+} mss_sys_identity_t;
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_IDENTITY_read() function requests the identity services when the
+  bundle has not been read yet, and returns the state of the bundle.
+
+  @param p_bundle
+         Bundle shared by all the harts.
+
+  @param mb_offset
+         Mailbox offset used for the service requests, as for the individual
+         service functions.
+
+  @return
+         This function returns MSS_SYS_SUCCESS when the bundle is complete,
+         MSS_SYS_PENDING while the services are in progress, MSS_SYS_PARAM_ERR
+         when p_bundle is null, or the status of the service that failed.
+
+  Example:
+  @code
+       mss_sys_identity_t* p_id = (mss_sys_identity_t*)hls->shared_mem;
+
+       while (MSS_SYS_PENDING == MSS_SYS_IDENTITY_read(p_id, 0u))
+       {
+           ;
+       }
+  @endcode
+ */
+uint16_t
+MSS_SYS_IDENTITY_read
+(
+    mss_sys_identity_t* p_bundle,
+    uint16_t mb_offset
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_SYS_IDENTITY_H_ */
@@ -10,6 +10,7 @@
 #include "mpfs_hal/mss_hal.h"
 #include "mss_sys_services_regs.h"
 #include "mss_sys_services.h"
+#include "mss_sys_snvm_cache.h"
 
 
 #ifdef __cplusplus
@@ -47,6 +48,27 @@ uint16_t g_int_service_response_offset;
 
 volatile uint8_t g_message_interrupt_counter = 0u;
 
+/* Queue of requests submitted with MSS_SYS_service_submit(). The lock is
+ * shared by all harts; it is always taken with the local interrupts disabled.
+ */
+static mss_sys_service_req_t* g_ss_req_head = 0;
+static mss_sys_service_req_t* g_ss_req_tail = 0;
+static mss_sys_service_req_t* volatile g_ss_req_active = 0;
+static volatile long g_ss_req_lock = 0;
+
+/* Set while a service requested in interrupt mode by one of the service
+ * functions has not yet been read with MSS_SYS_read_response()
+ */
+static volatile uint8_t g_ss_int_service_pending = 0u;
+
+/* Serialises the digital signature batches between the submitting hart and
+ * the message interrupt handler */
+static volatile long g_ss_batch_lock = 0;
+
+/* Serialises the SPI copy streams between the application and the message
+ * interrupt handler */
+static volatile long g_ss_stream_lock = 0;
+
 /*******************************************************************************
  * Callback handler function declaration
  */
@@ -88,6 +110,40 @@ static uint16_t request_system_service
     uint16_t response_offset
 );
 
+static void load_and_request_service
+(
+    uint8_t cmd_opcode,
+    uint8_t* cmd_data,
+    uint16_t cmd_data_size,
+    uint16_t mb_offset,
+    uint8_t notify
+);
+
+static void read_mailbox_response
+(
+    uint8_t* p_response,
+    uint16_t response_size,
+    uint16_t response_offset
+);
+
+static void start_next_service_req(void);
+
+static uint16_t sign_batch_submit
+(
+    mss_sys_sign_batch_t* batch,
+    uint8_t slot
+);
+
+static void sign_batch_req_complete(mss_sys_service_req_t* req);
+
+static uint16_t spi_stream_submit
+(
+    mss_sys_spi_stream_t* stream,
+    uint8_t buf
+);
+
+static void spi_stream_req_complete(mss_sys_service_req_t* req);
+
 /*-----------------------------------------------------------------------------
                              Public Functions
  -----------------------------------------------------------------------------*/
@@ -554,6 +610,57 @@ MSS_SYS_digital_signature_service
     return status;
 }
 
+/***************************************************************************//**
+ * MSS_SYS_digital_signature_batch()
+ * See "mss_sysservices.h" for details of how to use this function.
+ */
+uint16_t
+MSS_SYS_digital_signature_batch
+(
+    mss_sys_sign_batch_t* batch
+)
+{
+    uint16_t status = MSS_SYS_PARAM_ERR;
+    uint64_t saved;
+    uint8_t slot;
+
+    if ((0 != batch) && (0 != batch->p_hashes) &&
+        (0 != batch->p_responses) && (0u != batch->count) &&
+        ((MSS_SYS_DIGITAL_SIGNATURE_RAW_FORMAT_REQUEST_CMD == batch->format) ||
+         (MSS_SYS_DIGITAL_SIGNATURE_DER_FORMAT_REQUEST_CMD == batch->format)))
+    {
+        batch->done = 0u;
+        batch->status = MSS_SYS_PENDING;
+        batch->next = 0u;
+        batch->in_flight = 0u;
+
+        saved = disable_interrupts();
+        spinlock(&g_ss_batch_lock);
+
+        /* Fill both mailbox slots; the second request is queued behind the
+         * first one by the dispatcher */
+        for (slot = 0u; (slot < 2u) && (batch->next < batch->count); slot++)
+        {
+            status = sign_batch_submit(batch, slot);
+
+            if (MSS_SYS_SUCCESS != status)
+            {
+                break;
+            }
+        }
+
+        if (0u != batch->in_flight)
+        {
+            status = MSS_SYS_SUCCESS;
+        }
+
+        spinunlock(&g_ss_batch_lock);
+        restore_interrupts(saved);
+    }
+
+    return status;
+}
+
 /***************************************************************************//**
  * SYS_secure_nvm_write()
  * See "mss_sysservices.h" for details of how to use this function.
@@ -577,6 +684,9 @@ MSS_SYS_secure_nvm_write
     ASSERT(!(NULL_BUFFER == p_user_key));
     ASSERT(!(snvm_module >= 221u));
 
+    /* The cached copy of the page, if any, is no longer valid */
+    MSS_SYS_SNVM_CACHE_invalidate(snvm_module);
+
     *p_frame = snvm_module; /* SNVMADDR - SNVM module */
     p_frame += 4; /* Next 3 bytes RESERVED - For alignment */
 
@@ -1112,6 +1222,109 @@ MSS_SYS_spi_copy
      return status;
 }
 
+/***************************************************************************//**
+ * MSS_SYS_spi_copy_stream()
+ * See "mss_sysservices.h" for details of how to use this function.
+ */
+uint16_t
+MSS_SYS_spi_copy_stream
+(
+    mss_sys_spi_stream_t* stream
+)
+{
+    uint16_t status = MSS_SYS_PARAM_ERR;
+    uint64_t saved;
+    uint8_t buf;
+
+    if ((0 != stream) && (0 != stream->p_buffer[0]) &&
+        (0 != stream->p_buffer[1]) && (0u != stream->chunk_size) &&
+        (0u != stream->n_bytes) && (0 != stream->chunk) &&
+        (stream->options >= 1u) && (stream->options <= 3u))
+    {
+        stream->done = 0u;
+        stream->status = MSS_SYS_PENDING;
+        stream->next = 0u;
+        stream->in_flight = 0u;
+        stream->owned[0] = 0u;
+        stream->owned[1] = 0u;
+
+        saved = disable_interrupts();
+        spinlock(&g_ss_stream_lock);
+
+        /* Start copying into both buffers; the second request is queued
+         * behind the first one by the dispatcher */
+        for (buf = 0u; (buf < 2u) && (stream->next < stream->n_bytes); buf++)
+        {
+            status = spi_stream_submit(stream, buf);
+
+            if (MSS_SYS_SUCCESS != status)
+            {
+                break;
+            }
+        }
+
+        if (0u != stream->in_flight)
+        {
+            status = MSS_SYS_SUCCESS;
+        }
+
+        spinunlock(&g_ss_stream_lock);
+        restore_interrupts(saved);
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+ * MSS_SYS_spi_copy_stream_release()
+ * See "mss_sysservices.h" for details of how to use this function.
+ */
+uint16_t
+MSS_SYS_spi_copy_stream_release
+(
+    mss_sys_spi_stream_t* stream,
+    uint8_t buf
+)
+{
+    uint16_t status = MSS_SYS_PARAM_ERR;
+    uint64_t saved;
+    uint8_t stream_done = 0u;
+
+    if ((0 != stream) && (buf < 2u))
+    {
+        saved = disable_interrupts();
+        spinlock(&g_ss_stream_lock);
+
+        if (0u != stream->owned[buf])
+        {
+            stream->owned[buf] = 0u;
+            status = MSS_SYS_SUCCESS;
+
+            if ((MSS_SYS_PENDING == stream->status) &&
+                (stream->next < stream->n_bytes))
+            {
+                if (MSS_SYS_SUCCESS != spi_stream_submit(stream, buf))
+                {
+                    stream->status = MSS_SYS_BUSY;
+
+                    /* No completion is left to end the stream */
+                    stream_done = (0u == stream->in_flight) ? 1u : 0u;
+                }
+            }
+        }
+
+        spinunlock(&g_ss_stream_lock);
+        restore_interrupts(saved);
+
+        if ((1u == stream_done) && (0 != stream->complete))
+        {
+            stream->complete(stream);
+        }
+    }
+
+    return status;
+}
+
 /***************************************************************************//**
  * MSS_SYS_debug_read_probe()
  * See "mss_sysservices.h" for details of how to use this function.
@@ -1870,6 +2083,19 @@ MSS_SYS_debug_terminate
     return status;
 }
 
+/***************************************************************************//**
+ * MSS_SYS_SNVM_CACHE_invalidate()
+ * Default implementation used when the sNVM read cache is not linked in.
+ */
+__attribute__((weak)) void
+MSS_SYS_SNVM_CACHE_invalidate
+(
+    uint8_t snvm_module
+)
+{
+    (void)snvm_module;
+}
+
 /***************************************************************************//**
  * MSS_SYS_read_response()
  * See "mss_sysservices.h" for details of how to use this function.
@@ -1879,29 +2105,80 @@ uint16_t MSS_SYS_read_response
     void
 )
 {
-    uint16_t response_limit = 0u;
-    uint32_t idx;
     uint16_t status = MSS_SYS_PARAM_ERR;
 
     if (g_message_interrupt_counter > 0u)
     {
         g_message_interrupt_counter = 0u;
 
-        if (g_int_service_response_size > 0u)
+        read_mailbox_response(gp_int_service_response,
+                              g_int_service_response_size,
+                              g_int_service_response_offset);
+
+        /* Read the status returned by System Controller*/
+        status = ((MSS_SCBCTRL->SERVICES_SR & SCBCTRL_SERVICESSR_STATUS_MASK) >>
+                SCBCTRL_SERVICESSR_STATUS);
+
+        g_ss_int_service_pending = 0u;
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+ * MSS_SYS_service_submit()
+ * See "mss_sysservices.h" for details of how to use this function.
+ */
+uint16_t
+MSS_SYS_service_submit
+(
+    mss_sys_service_req_t* req
+)
+{
+    uint16_t status = MSS_SYS_PARAM_ERR;
+    uint64_t saved;
+
+    if ((NULL_BUFFER != (uint8_t*)req) &&
+        ((0u == req->cmd_data_size) || (NULL_BUFFER != req->cmd_data)) &&
+        ((0u == req->response_size) || (NULL_BUFFER != req->p_response)))
+    {
+        saved = disable_interrupts();
+        spinlock(&g_ss_req_lock);
+
+        if ((0 == g_ss_req_active) &&
+            ((0u != g_ss_int_service_pending) ||
+             (MSS_SCBCTRL->SERVICES_CR & SCBCTRL_SERVICESCR_REQ_MASK) ||
+             (MSS_SCBCTRL->SERVICES_SR & SCBCTRL_SERVICESSR_BUSY_MASK)))
+        {
+            /* System controller is busy with a service requested by one of
+             * the service functions */
+            status = MSS_SYS_BUSY;
+        }
+        else
         {
-            response_limit = g_int_service_response_size +
-                             g_int_service_response_offset;
+            req->status = MSS_SYS_PENDING;
+            req->next = 0;
 
-            for (idx = g_int_service_response_offset; idx < response_limit; idx++)
+            if (0 == g_ss_req_tail)
+            {
+                g_ss_req_head = req;
+            }
+            else
             {
-                gp_int_service_response[idx - g_int_service_response_offset] =
-                        *((uint8_t *)MSS_SCBMAILBOX + idx);
+                g_ss_req_tail->next = req;
             }
+            g_ss_req_tail = req;
+
+            if (0 == g_ss_req_active)
+            {
+                start_next_service_req();
+            }
+
+            status = MSS_SYS_SUCCESS;
         }
 
-        /* Read the status returned by System Controller*/
-        status = ((MSS_SCBCTRL->SERVICES_SR & SCBCTRL_SERVICESSR_STATUS_MASK) >>
-                SCBCTRL_SERVICESSR_STATUS);
+        spinunlock(&g_ss_req_lock);
+        restore_interrupts(saved);
     }
 
     return status;
@@ -1928,6 +2205,58 @@ static uint16_t request_system_service
     uint16_t response_offset
 
 )
+{
+    uint16_t status = MSS_SYS_SUCCESS;
+    uint64_t saved;
+
+    /* Code for MSS_SYS_PARAM_ERR is not implemented with this version of 
+       driver. */
+
+    saved = disable_interrupts();
+    spinlock(&g_ss_req_lock);
+
+    if ((MSS_SCBCTRL->SERVICES_SR & SCBCTRL_SERVICESSR_BUSY_MASK) ||
+        (MSS_SCBCTRL->SERVICES_CR & SCBCTRL_SERVICESCR_REQ_MASK) ||
+        (0 != g_ss_req_active))
+    {
+        /* System controller is busy with executing service */
+        status = MSS_SYS_BUSY;
+    }
+    else
+    {
+        if (g_service_mode == MSS_SYS_SERVICE_INTERRUPT_MODE)
+        {
+            gp_int_service_response = (uint8_t*)p_response;
+            g_int_service_response_offset = response_offset;
+            g_int_service_response_size = response_size;
+            g_ss_int_service_pending = 1u;
+        }
+
+        load_and_request_service(cmd_opcode, cmd_data, cmd_data_size,
+                                 mb_offset,
+                                 (g_service_mode ==
+                                  MSS_SYS_SERVICE_INTERRUPT_MODE));
+    }
+
+    spinunlock(&g_ss_req_lock);
+    restore_interrupts(saved);
+
+    return status;
+}
+
+/*
+ * This function writes the Mailbox input data, if any, to the mailbox and then
+ * requests the service from the system controller. The message interrupt is
+ * requested on completion when notify is non-zero.
+ */
+static void load_and_request_service
+(
+    uint8_t cmd_opcode,
+    uint8_t* cmd_data,
+    uint16_t cmd_data_size,
+    uint16_t mb_offset,
+    uint8_t notify
+)
 {
     uint32_t idx;
     uint16_t ss_command = 0u;
@@ -1938,24 +2267,8 @@ static uint16_t request_system_service
     uint32_t * mailbox_reg;
     uint32_t mailbox_val = 0u;
 
-    if (MSS_SCBCTRL->SERVICES_SR & SCBCTRL_SERVICESSR_BUSY_MASK)
-    {
-        /* System controller is busy with executing service */
-        return MSS_SYS_BUSY;
-    }
-
-    /* Code for MSS_SYS_PARAM_ERR is not implemented with this version of 
-       driver. */
-
     *MSS_SCBMESSAGE_INT = 0x0u; /* clear message_int reg */
 
-    if (g_service_mode == MSS_SYS_SERVICE_INTERRUPT_MODE)
-    {
-        gp_int_service_response = (uint8_t*)p_response;
-        g_int_service_response_offset = response_offset;
-        g_int_service_response_size = response_size;
-    }
-
     if (cmd_data_size > 0u)
     {
         word_buf = (uint32_t*)cmd_data;
@@ -1990,7 +2303,7 @@ static uint16_t request_system_service
     ss_command = ((mb_offset << 7u) |  (cmd_opcode & 0x7Fu));
 
     /* Interrupt based implementation of services */
-    if (MSS_SYS_SERVICE_INTERRUPT_MODE == g_service_mode)
+    if (0u != notify)
     {
         MSS_SCBCTRL->SERVICES_CR = (((ss_command << SCBCTRL_SERVICESCR_COMMAND)
                 & SCBCTRL_SERVICESCR_COMMAND_MASK) |
@@ -2004,9 +2317,303 @@ static uint16_t request_system_service
                 SCBCTRL_SERVICESCR_REQ_MASK);
 
     }
+}
+
+/*
+ * This function copies the response of the last service from the mailbox.
+ */
+static void read_mailbox_response
+(
+    uint8_t* p_response,
+    uint16_t response_size,
+    uint16_t response_offset
+)
+{
+    uint32_t idx;
+    uint16_t response_limit = 0u;
+
+    if (response_size > 0u)
+    {
+        response_limit = response_size + response_offset;
+
+        for (idx = response_offset; idx < response_limit; idx++)
+        {
+            p_response[idx - response_offset] =
+                    *((uint8_t *)MSS_SCBMAILBOX + idx);
+        }
+    }
+}
+
+/*
+ * This function copies the next hash of a signature batch into a mailbox slot
+ * and queues the request for that slot. It must be called with
+ * g_ss_batch_lock held.
+ */
+static uint16_t sign_batch_submit
+(
+    mss_sys_sign_batch_t* batch,
+    uint8_t slot
+)
+{
+    mss_sys_service_req_t* req = &batch->req[slot];
+    uint32_t slot_offset = (uint32_t)batch->mb_offset +
+                           ((uint32_t)slot * MSS_SYS_SIGN_BATCH_SLOT_WORDS);
+    uint32_t resp_size;
+    uint32_t idx;
+    uint16_t status;
+    const uint8_t* p_hash;
+
+    if (MSS_SYS_DIGITAL_SIGNATURE_RAW_FORMAT_REQUEST_CMD == batch->format)
+    {
+        resp_size = MSS_SYS_DIGITAL_SIGNATURE_RAW_FORMAT_RESP_SIZE;
+    }
+    else
+    {
+        resp_size = MSS_SYS_DIGITAL_SIGNATURE_DER_FORMAT_RESP_SIZE;
+    }
+
+    /* The other slot may be in use by the system controller; only this slot
+     * is written */
+    p_hash = batch->p_hashes +
+             (batch->next * MSS_SYS_DIGITAL_SIGNATURE_HASH_DATA_LEN);
+
+    for (idx = 0u; idx < (MSS_SYS_DIGITAL_SIGNATURE_HASH_DATA_LEN / 4u); idx++)
+    {
+        *(MSS_SCBMAILBOX + slot_offset + idx) =
+                ((uint32_t)p_hash[(idx * 4u)]) |
+                ((uint32_t)p_hash[(idx * 4u) + 1u] << 8u) |
+                ((uint32_t)p_hash[(idx * 4u) + 2u] << 16u) |
+                ((uint32_t)p_hash[(idx * 4u) + 3u] << 24u);
+    }
+
+    /* The hash is already in the mailbox, so no command data is given */
+    req->cmd_opcode = batch->format;
+    req->cmd_data = NULL_BUFFER;
+    req->cmd_data_size = 0u;
+    req->p_response = batch->p_responses + (batch->next * resp_size);
+    req->response_size = (uint16_t)resp_size;
+    req->mb_offset = (uint16_t)slot_offset;
+    req->response_offset = (uint16_t)((slot_offset * 4u) +
+                                      MSS_SYS_DIGITAL_SIG_RET_OFFSET);
+    req->complete = sign_batch_req_complete;
+    req->user_data = batch;
+
+    batch->in_flight++;
+
+    status = MSS_SYS_service_submit(req);
+
+    if (MSS_SYS_SUCCESS == status)
+    {
+        batch->next++;
+    }
+    else
+    {
+        batch->in_flight--;
+    }
+
+    return status;
+}
+
+/*
+ * Completion callback of the requests of a signature batch, called from the
+ * message interrupt handler. The dispatcher has already started the request
+ * of the other slot, so the next hash is copied into this slot while the
+ * system controller executes it.
+ */
+static void sign_batch_req_complete(mss_sys_service_req_t* req)
+{
+    mss_sys_sign_batch_t* batch = (mss_sys_sign_batch_t*)req->user_data;
+    uint8_t slot = (uint8_t)(req - &batch->req[0]);
+    uint8_t batch_done = 0u;
+
+    spinlock(&g_ss_batch_lock);
+
+    batch->in_flight--;
+
+    if (MSS_SYS_SUCCESS == req->status)
+    {
+        batch->done++;
+    }
+    else if (MSS_SYS_PENDING == batch->status)
+    {
+        batch->status = req->status;
+    }
+    else
+    {
+        /* An earlier signature already failed */
+    }
+
+    if ((MSS_SYS_PENDING == batch->status) && (batch->next < batch->count))
+    {
+        if (MSS_SYS_SUCCESS != sign_batch_submit(batch, slot))
+        {
+            batch->status = MSS_SYS_BUSY;
+        }
+    }
+
+    if (0u == batch->in_flight)
+    {
+        if (MSS_SYS_PENDING == batch->status)
+        {
+            batch->status = MSS_SYS_SUCCESS;
+        }
+        batch_done = 1u;
+    }
 
-    /* Service requested successfully */
-    return MSS_SYS_SUCCESS;
+    spinunlock(&g_ss_batch_lock);
+
+    if ((1u == batch_done) && (0 != batch->complete))
+    {
+        batch->complete(batch);
+    }
+}
+
+/*
+ * This function queues the SPI copy of the next chunk of a stream into one of
+ * its buffers. The mailbox data is kept per buffer as the dispatcher only
+ * writes it to the mailbox when the request is started. It must be called
+ * with g_ss_stream_lock held.
+ */
+static uint16_t spi_stream_submit
+(
+    mss_sys_spi_stream_t* stream,
+    uint8_t buf
+)
+{
+    mss_sys_service_req_t* req = &stream->req[buf];
+    uint8_t* mb_format = (uint8_t*)&stream->mb_data[buf][0];
+    uint32_t size = stream->n_bytes - stream->next;
+    uint16_t status;
+
+    if (size > stream->chunk_size)
+    {
+        size = stream->chunk_size;
+    }
+
+    *(uint64_t *)mb_format         = (uint64_t)stream->p_buffer[buf];
+    *(uint32_t *)(mb_format + 8u)  = stream->spi_addr + stream->next;
+    *(uint32_t *)(mb_format + 12u) = size;
+    mb_format[16] = stream->options;
+
+    req->cmd_opcode = (uint8_t)MSS_SYS_SPI_COPY_CMD;
+    req->cmd_data = mb_format;
+    req->cmd_data_size = (uint16_t)MSS_SYS_SPI_COPY_MAILBOX_DATA_LEN;
+    req->p_response = NULL_BUFFER;
+    req->response_size = MSS_SYS_NO_RESPONSE_LEN;
+    req->mb_offset = stream->mb_offset;
+    req->response_offset = MSS_SYS_COMMON_RET_OFFSET;
+    req->complete = spi_stream_req_complete;
+    req->user_data = stream;
+
+    stream->in_flight++;
+
+    status = MSS_SYS_service_submit(req);
+
+    if (MSS_SYS_SUCCESS == status)
+    {
+        stream->next += size;
+    }
+    else
+    {
+        stream->in_flight--;
+    }
+
+    return status;
+}
+
+/*
+ * Completion callback of the requests of a SPI copy stream, called from the
+ * message interrupt handler. The dispatcher has already started the copy into
+ * the other buffer, so the application processes this chunk while the system
+ * controller copies the next one. Chunks complete in order as the dispatcher
+ * executes the requests in the order they were queued.
+ */
+static void spi_stream_req_complete(mss_sys_service_req_t* req)
+{
+    mss_sys_spi_stream_t* stream = (mss_sys_spi_stream_t*)req->user_data;
+    uint8_t buf = (uint8_t)(req - &stream->req[0]);
+    uint32_t offset = stream->done;
+    uint32_t size = *(uint32_t *)((uint8_t*)&stream->mb_data[buf][0] + 12u);
+    uint8_t deliver = 0u;
+    uint8_t stream_done = 0u;
+
+    spinlock(&g_ss_stream_lock);
+
+    stream->in_flight--;
+
+    if (MSS_SYS_SUCCESS != req->status)
+    {
+        if (MSS_SYS_PENDING == stream->status)
+        {
+            stream->status = req->status;
+        }
+    }
+    else if (MSS_SYS_PENDING == stream->status)
+    {
+        stream->owned[buf] = 1u;
+        deliver = 1u;
+    }
+    else
+    {
+        /* An earlier chunk already failed */
+    }
+
+    spinunlock(&g_ss_stream_lock);
+
+    /* Called without the lock so that the buffer can be released from the
+     * call-back function */
+    if (1u == deliver)
+    {
+        stream->chunk(stream, buf, offset, size);
+    }
+
+    spinlock(&g_ss_stream_lock);
+
+    if (1u == deliver)
+    {
+        stream->done += size;
+
+        if ((MSS_SYS_PENDING == stream->status) &&
+            (stream->done == stream->n_bytes))
+        {
+            stream->status = MSS_SYS_SUCCESS;
+        }
+    }
+
+    if ((0u == stream->in_flight) && (MSS_SYS_PENDING != stream->status))
+    {
+        stream_done = 1u;
+    }
+
+    spinunlock(&g_ss_stream_lock);
+
+    if ((1u == stream_done) && (0 != stream->complete))
+    {
+        stream->complete(stream);
+    }
+}
+
+/*
+ * This function requests the service of the first queued request. It must be
+ * called with g_ss_req_lock held and no request active.
+ */
+static void start_next_service_req(void)
+{
+    mss_sys_service_req_t* req = g_ss_req_head;
+
+    if (0 != req)
+    {
+        g_ss_req_head = req->next;
+        if (0 == g_ss_req_head)
+        {
+            g_ss_req_tail = 0;
+        }
+        req->next = 0;
+        g_ss_req_active = req;
+
+        load_and_request_service(req->cmd_opcode, req->cmd_data,
+                                 req->cmd_data_size, req->mb_offset, 1u);
+    }
 }
 
 /* This function executes the SS command in interrupt mode. If Mailbox input data
@@ -2052,10 +2659,7 @@ static uint16_t execute_ss_polling_mode
     uint16_t response_offset
 )
 {
-    uint32_t idx;
     uint16_t status = 0u;
-    uint16_t response_limit = 0u;
-    uint8_t* response_buf;
 
     status = request_system_service(cmd_opcode, cmd_data, cmd_data_size,
                                    p_response,response_size, mb_offset,
@@ -2081,17 +2685,7 @@ static uint16_t execute_ss_polling_mode
             ;
         }
 
-        if (response_size > 0u)
-        {
-            response_limit = response_size + response_offset;
-            response_buf = (uint8_t*)p_response;
-
-            for (idx = response_offset; idx < response_limit; idx++)
-            {
-                response_buf[idx - response_offset] =
-                        *((uint8_t *)MSS_SCBMAILBOX + idx);
-            }
-        }
+        read_mailbox_response(p_response, response_size, response_offset);
 
         /* Read the status returned by System Controller */
         status = ((MSS_SCBCTRL->SERVICES_SR & SCBCTRL_SERVICESSR_STATUS_MASK) >>
@@ -2116,14 +2710,43 @@ g5c_message_plic_IRQHandler
     void
 )
 {
-    g_message_interrupt_counter++;
+    mss_sys_service_req_t* req;
 
     volatile uint32_t reg = *MSS_SCBMESSAGE; /* read message reg. */
     reg = *MSS_SCBMESSAGE_INT;
     *MSS_SCBMESSAGE_INT = 0x0u; /* clear message_int reg */
     reg = *MSS_SCBMESSAGE_INT;
 
-    mss_sys_interrupt_handler();
+    spinlock(&g_ss_req_lock);
+    req = g_ss_req_active;
+
+    if (0 != req)
+    {
+        /* Completion of a queued request: read its response and feed the
+         * next request to the system controller before calling back */
+        read_mailbox_response(req->p_response, req->response_size,
+                              req->response_offset);
+        req->status = (uint16_t)((MSS_SCBCTRL->SERVICES_SR &
+                                  SCBCTRL_SERVICESSR_STATUS_MASK) >>
+                                 SCBCTRL_SERVICESSR_STATUS);
+        g_ss_req_active = 0;
+        start_next_service_req();
+    }
+
+    spinunlock(&g_ss_req_lock);
+
+    if (0 != req)
+    {
+        if (0 != req->complete)
+        {
+            req->complete(req);
+        }
+    }
+    else
+    {
+        g_message_interrupt_counter++;
+        mss_sys_interrupt_handler();
+    }
 
     return 0;
 }
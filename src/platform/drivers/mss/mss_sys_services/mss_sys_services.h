@@ -165,6 +165,30 @@
   service the function will exit with the MSS_SYS_BUSY return value. The error
   codes are different for each service. See individual function descriptions to
   know the meaning of the error code for each service.
+
+  -----------------------------------------------------------------------------
+  Queued service requests
+  -----------------------------------------------------------------------------
+  The MSS_SYS_service_submit() function queues a service request described by
+  a structure of type mss_sys_service_req_t, instead of returning MSS_SYS_BUSY
+  while the system controller executes another request. Each request carries
+  its own response buffer and completion callback, so several requests can be
+  outstanding at the same time and can be submitted from any hart. The driver
+  requests the next queued service from the message interrupt handler as soon
+  as the previous one is complete, after its response was read from the
+  mailbox. The message interrupt must therefore be enabled in the PLIC to use
+  queued requests, whichever mode was selected with
+  MSS_SYS_select_service_mode().
+  While queued requests are outstanding the other service functions return
+  MSS_SYS_BUSY. MSS_SYS_service_submit() returns MSS_SYS_BUSY when the queue is
+  empty and a service requested by one of the other service functions has not
+  completed, or in interrupt mode, has not been read with
+  MSS_SYS_read_response().
+
+  MSS_SYS_digital_signature_batch() and MSS_SYS_spi_copy_stream() are built on
+  queued requests. MSS_SYS_spi_copy_stream() copies a large block of SPI flash
+  in chunks into two buffers used in turn, so that the application processes
+  one chunk while the system controller copies the next one.
  */
 
 #ifndef MSS_SYS_SERVICES_H_
@@ -197,10 +221,14 @@ extern "C" {
     System service cannot be executed as one or more parameters are not as
     expected by this driver.
 
+  MSS_SYS_PENDING
+    Status of a queued service request which has not completed yet.
+
 */
 #define MSS_SYS_SUCCESS                                       0u
 #define MSS_SYS_BUSY                                          0xEFu
 #define MSS_SYS_PARAM_ERR                                     0xFFu
+#define MSS_SYS_PENDING                                       0xEEu
 
 /*-------------------------------------------------------------------------*//**
   System service execution mode macros
@@ -971,6 +999,200 @@ extern "C" {
  */
 typedef void (*mss_sys_service_handler_t)(void);
 
+/*-------------------------------------------------------------------------*//**
+  Queued service request
+  The mss_sys_service_req_t type describes a service request submitted with
+  MSS_SYS_service_submit(). The structure, the command data and the response
+  buffer are owned by the caller and must not be modified until the request is
+  complete.
+
+  cmd_opcode
+    Service command opcode, for example MSS_SYS_NONCE_SERVICE_REQUEST_CMD.
+
+  cmd_data, cmd_data_size
+    Mailbox input data of the service and its size in bytes. cmd_data must be
+    word aligned. cmd_data_size is 0 for services without input data.
+
+  p_response, response_size
+    Buffer receiving the service response and its size in bytes.
+    response_size is 0 for services without response data.
+
+  mb_offset
+    Mailbox offset of the service, as passed to the individual service
+    functions.
+
+  response_offset
+    Offset in the mailbox at which the system controller writes the response,
+    0 for most of the services.
+
+  status
+    MSS_SYS_PENDING until the service is complete, then the status code
+    returned by the system controller.
+
+  complete
+    Function called from the message interrupt handler when the service is
+    complete, or 0.
+
+  user_data
+    Not used by the driver.
+
+  next
+    Used by the driver to queue the request.
+ */
+typedef struct mss_sys_service_req
+{
+    uint8_t cmd_opcode;
+    uint8_t* cmd_data;
+    uint16_t cmd_data_size;
+    uint8_t* p_response;
+    uint16_t response_size;
+    uint16_t mb_offset;
+    uint16_t response_offset;
+    volatile uint16_t status;
+    void (*complete)(struct mss_sys_service_req* req);
+    void* user_data;
+    struct mss_sys_service_req* next;
+} mss_sys_service_req_t;
+
+/*-------------------------------------------------------------------------*//**
+  Number of mailbox words used by each of the two mailbox slots of a digital
+  signature batch. A slot holds the hash followed by the signature.
+ */
+#define MSS_SYS_SIGN_BATCH_SLOT_WORDS                           40u
+
+/*-------------------------------------------------------------------------*//**
+  Digital signature batch
+  The mss_sys_sign_batch_t type describes a batch of SHA384 hashes to be signed
+  using MSS_SYS_digital_signature_batch(). The structure and the buffers are
+  owned by the caller and must not be modified until the batch is complete.
+
+  p_hashes
+    count hashes of MSS_SYS_DIGITAL_SIGNATURE_HASH_DATA_LEN bytes each, stored
+    one after the other.
+
+  p_responses
+    Buffer receiving count signatures, one after the other. Each signature is
+    MSS_SYS_DIGITAL_SIGNATURE_RAW_FORMAT_RESP_SIZE or
+    MSS_SYS_DIGITAL_SIGNATURE_DER_FORMAT_RESP_SIZE bytes, depending on format.
+
+  count
+    Number of hashes to be signed.
+
+  format
+    MSS_SYS_DIGITAL_SIGNATURE_RAW_FORMAT_REQUEST_CMD or
+    MSS_SYS_DIGITAL_SIGNATURE_DER_FORMAT_REQUEST_CMD.
+
+  mb_offset
+    Word offset of the first mailbox slot. The batch uses
+    2 * MSS_SYS_SIGN_BATCH_SLOT_WORDS words of the mailbox from this offset.
+
+  done
+    Number of signatures generated so far.
+
+  status
+    MSS_SYS_PENDING until the batch is complete, then MSS_SYS_SUCCESS or the
+    status code of the first signature which failed. No further hashes are
+    submitted after a failure.
+
+  complete
+    Function called from the message interrupt handler when the batch is
+    complete, or 0.
+
+  user_data
+    Not used by the driver.
+
+  The remaining elements are used internally by the driver.
+ */
+typedef struct mss_sys_sign_batch
+{
+    const uint8_t* p_hashes;
+    uint8_t* p_responses;
+    uint32_t count;
+    uint8_t format;
+    uint16_t mb_offset;
+    volatile uint32_t done;
+    volatile uint16_t status;
+    void (*complete)(struct mss_sys_sign_batch* batch);
+    void* user_data;
+
+    mss_sys_service_req_t req[2];
+    uint32_t next;
+    uint32_t in_flight;
+} mss_sys_sign_batch_t;
+
+/*-------------------------------------------------------------------------*//**
+  SPI copy stream
+  The mss_sys_spi_stream_t type describes a copy from the system controller SPI
+  flash to MSS memory made in chunks by MSS_SYS_spi_copy_stream(). The
+  structure and the buffers are owned by the caller and must not be modified
+  until the stream is complete.
+
+  p_buffer
+    Two buffers of chunk_size bytes each, used in turn to receive the chunks.
+
+  chunk_size
+    Number of bytes copied by each SPI copy service. The last chunk is shorter
+    when n_bytes is not a multiple of chunk_size.
+
+  spi_addr
+    Address in SPI flash of the first byte to be copied.
+
+  n_bytes
+    Total number of bytes to be copied.
+
+  options
+    SPI clock frequency, as for MSS_SYS_spi_copy().
+
+  mb_offset
+    Mailbox offset of the SPI copy services, as for MSS_SYS_spi_copy().
+
+  done
+    Number of bytes copied and handed to the chunk call-back function so far.
+
+  status
+    MSS_SYS_PENDING until the stream is complete, then MSS_SYS_SUCCESS or the
+    status code of the first SPI copy which failed. No further chunks are
+    copied after a failure.
+
+  chunk
+    Function called from the message interrupt handler when a chunk has been
+    copied. buf is the index in p_buffer of the buffer holding the chunk,
+    offset is the position of the chunk from the start of the stream and size
+    is its length in bytes. The buffer belongs to the application until it is
+    handed back with MSS_SYS_spi_copy_stream_release(), which can be called
+    from the call-back function itself or later from the application.
+
+  complete
+    Function called from the message interrupt handler when the stream is
+    complete, after the chunk call-back function of the last chunk, or 0.
+
+  user_data
+    Not used by the driver.
+
+  The remaining elements are used internally by the driver.
+ */
+typedef struct mss_sys_spi_stream
+{
+    uint8_t* p_buffer[2];
+    uint32_t chunk_size;
+    uint32_t spi_addr;
+    uint32_t n_bytes;
+    uint8_t options;
+    uint16_t mb_offset;
+    volatile uint32_t done;
+    volatile uint16_t status;
+    void (*chunk)(struct mss_sys_spi_stream* stream, uint8_t buf,
+                  uint32_t offset, uint32_t size);
+    void (*complete)(struct mss_sys_spi_stream* stream);
+    void* user_data;
+
+    mss_sys_service_req_t req[2];
+    uint32_t mb_data[2][5];
+    uint32_t next;
+    uint32_t in_flight;
+    uint8_t owned[2];
+} mss_sys_spi_stream_t;
+
 /*-------------------------------------------------------------------------*//**
   The function MSS_SYS_read_response() is used to read the response after
   execution of system service in interrupt mode only. For polling mode call to
@@ -994,6 +1216,45 @@ MSS_SYS_read_response
     void
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_service_submit() function queues a service request. The service
+  is requested immediately when the system controller is idle, otherwise from
+  the message interrupt handler when the previously queued requests are
+  complete. This function can be called from any hart and from interrupt
+  handlers.
+
+  @param req
+         Pointer to the request to be queued. See mss_sys_service_req_t.
+
+  @return
+         This function returns MSS_SYS_SUCCESS when the request was queued,
+         MSS_SYS_BUSY when a service requested by one of the other service
+         functions is in progress, or MSS_SYS_PARAM_ERR when a parameter is
+         invalid.
+
+  Example:
+  @code
+       static uint8_t nonce[MSS_SYS_NONCE_SERVICE_RESP_LEN];
+       static mss_sys_service_req_t nonce_req;
+
+       nonce_req.cmd_opcode = MSS_SYS_NONCE_SERVICE_REQUEST_CMD;
+       nonce_req.cmd_data = 0;
+       nonce_req.cmd_data_size = 0u;
+       nonce_req.p_response = nonce;
+       nonce_req.response_size = MSS_SYS_NONCE_SERVICE_RESP_LEN;
+       nonce_req.mb_offset = 0u;
+       nonce_req.response_offset = 0u;
+       nonce_req.complete = nonce_done;
+
+       status = MSS_SYS_service_submit(&nonce_req);
+  @endcode
+ */
+uint16_t
+MSS_SYS_service_submit
+(
+    mss_sys_service_req_t* req
+);
+
 /*-------------------------------------------------------------------------*//**
   The MSS_SYS_service_mode() function is for user to configure system service
   execution in polling mode or interrupt mode. This function also registers the
@@ -1774,6 +2035,44 @@ MSS_SYS_digital_signature_service
     uint16_t mb_offset
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_digital_signature_batch() function signs a batch of SHA384
+  hashes using queued service requests. Two mailbox slots are used in turn:
+  while the system controller signs the hash in one slot, the message interrupt
+  handler copies the next hash into the other slot, so that the system
+  controller executes the signatures back-to-back. This function does not
+  block; the complete call-back function of the batch is called when all the
+  hashes are signed. The message interrupt must be enabled, as for
+  MSS_SYS_service_submit().
+
+  @param batch
+                    The batch parameter is a pointer to the batch description.
+                    See mss_sys_sign_batch_t.
+  @return
+                    This function returns MSS_SYS_SUCCESS when the batch was
+                    started, MSS_SYS_BUSY when the system controller is busy
+                    with a service requested by one of the other service
+                    functions, or MSS_SYS_PARAM_ERR when a parameter is
+                    invalid.
+
+  Example:
+  @code
+       batch.p_hashes = hashes;
+       batch.p_responses = signatures;
+       batch.count = 16u;
+       batch.format = MSS_SYS_DIGITAL_SIGNATURE_RAW_FORMAT_REQUEST_CMD;
+       batch.mb_offset = 0u;
+       batch.complete = batch_signed;
+
+       status = MSS_SYS_digital_signature_batch(&batch);
+  @endcode
+*/
+uint16_t
+MSS_SYS_digital_signature_batch
+(
+    mss_sys_sign_batch_t* batch
+);
+
 /*-------------------------------------------------------------------------*//**
   The MSS_SYS_secure_nvm_write() function is used to provide write access/write the
   data in the sNVM region. Data can be stored in the following format:
@@ -2215,6 +2514,84 @@ MSS_SYS_spi_copy
     uint16_t mb_offset
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_spi_copy_stream() function copies a block of the system
+  controller SPI flash to MSS memory in chunks, using queued service requests
+  and the two buffers of the stream in turn. The copies of the first two
+  chunks are queued straight away. When a chunk has been copied the chunk
+  call-back function of the stream is called from the message interrupt
+  handler, while the system controller copies the following chunk into the
+  other buffer. The copy of the chunk after that is queued when the
+  application hands the buffer back with MSS_SYS_spi_copy_stream_release().
+  This function does not block. The message interrupt must be enabled, as for
+  MSS_SYS_service_submit().
+
+  @param stream
+                    The stream parameter is a pointer to the stream
+                    description. See mss_sys_spi_stream_t.
+  @return
+                    This function returns MSS_SYS_SUCCESS when the stream was
+                    started, MSS_SYS_BUSY when the system controller is busy
+                    with a service requested by one of the other service
+                    functions, or MSS_SYS_PARAM_ERR when a parameter is
+                    invalid.
+
+  Example:
+  @code
+       static uint8_t chunk_buf[2][4096] __attribute__((aligned(8)));
+       static mss_sys_spi_stream_t stream;
+
+       static void chunk_copied(mss_sys_spi_stream_t* s, uint8_t buf,
+                                uint32_t offset, uint32_t size)
+       {
+           image_crc = crc32_update(image_crc, s->p_buffer[buf], size);
+           (void)MSS_SYS_spi_copy_stream_release(s, buf);
+       }
+
+       stream.p_buffer[0] = chunk_buf[0];
+       stream.p_buffer[1] = chunk_buf[1];
+       stream.chunk_size = sizeof(chunk_buf[0]);
+       stream.spi_addr = 0x400000u;
+       stream.n_bytes = image_size;
+       stream.options = 1u;
+       stream.mb_offset = 0u;
+       stream.chunk = chunk_copied;
+       stream.complete = 0;
+
+       status = MSS_SYS_spi_copy_stream(&stream);
+  @endcode
+*/
+uint16_t
+MSS_SYS_spi_copy_stream
+(
+    mss_sys_spi_stream_t* stream
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_spi_copy_stream_release() function hands a buffer of a stream
+  back to the driver once the application has finished with the chunk it
+  holds. The copy of the next chunk into that buffer is queued, if any is left
+  to be copied. This function can be called from the chunk call-back function
+  and from any hart.
+
+  @param stream
+                    The stream parameter is a pointer to the stream passed to
+                    MSS_SYS_spi_copy_stream().
+  @param buf
+                    The buf parameter is the index of the buffer, as passed to
+                    the chunk call-back function.
+  @return
+                    This function returns MSS_SYS_SUCCESS when the buffer was
+                    handed back, or MSS_SYS_PARAM_ERR when the buffer is not
+                    held by the application.
+*/
+uint16_t
+MSS_SYS_spi_copy_stream_release
+(
+    mss_sys_spi_stream_t* stream,
+    uint8_t buf
+);
+
 /*-------------------------------------------------------------------------*//**
   The MSS_SYS_debug_read_probe() function will read the content of a
   probe module (59 x 18b words).
@@ -0,0 +1,358 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem(MSS) system services sNVM read cache
+ * implementation.
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "mss_sys_services.h"
+#include "mss_sys_snvm_cache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Constant definitions
+ */
+#define SNVM_CACHE_MAX_DATA_LEN                 252u
+#define SNVM_CACHE_AUTH_DATA_LEN                236u
+#define SNVM_CACHE_ADMIN_LEN                    4u
+#define SNVM_CACHE_USK_LEN                      12u
+
+#ifdef MSS_SYS_SNVM_CACHE_SECTION
+#define SNVM_CACHE_PLACEMENT    __attribute__((section(MSS_SYS_SNVM_CACHE_SECTION)))
+#else
+#define SNVM_CACHE_PLACEMENT
+#endif
+
+/*******************************************************************************
+ * Type definitions
+ */
+typedef struct snvm_cache_entry
+{
+    uint8_t data[SNVM_CACHE_MAX_DATA_LEN];
+    uint8_t admin[SNVM_CACHE_ADMIN_LEN];
+    uint8_t user_key[SNVM_CACHE_USK_LEN];
+    uint32_t last_use;
+    uint16_t data_len;
+    uint8_t snvm_module;
+    uint8_t valid;
+} snvm_cache_entry_t;
+
+/*******************************************************************************
+ * Global variables declarations
+ */
+extern uint8_t g_service_mode;
+
+static snvm_cache_entry_t g_snvm_cache[MSS_SYS_SNVM_CACHE_ENTRIES]
+                                                        SNVM_CACHE_PLACEMENT;
+static uint32_t g_snvm_cache_use = 0u;
+
+/* Incremented by each invalidation, so that a page read before the
+ * invalidation is not cached after it */
+static volatile uint32_t g_snvm_cache_generation = 0u;
+static volatile long g_snvm_cache_lock = 0;
+
+/*******************************************************************************
+ * Local function declarations.
+ */
+static snvm_cache_entry_t* snvm_cache_lookup
+(
+    uint8_t snvm_module,
+    const uint8_t* p_user_key,
+    uint16_t data_len
+);
+
+static void snvm_cache_insert
+(
+    uint8_t snvm_module,
+    const uint8_t* p_user_key,
+    const uint8_t* p_admin,
+    const uint8_t* p_data,
+    uint16_t data_len
+);
+
+static void snvm_cache_clear_entry(snvm_cache_entry_t* entry);
+
+/*-----------------------------------------------------------------------------
+                             Public Functions
+ -----------------------------------------------------------------------------*/
+
+/***************************************************************************//**
+ * MSS_SYS_SNVM_CACHE_read()
+ * See "mss_sys_snvm_cache.h" for details of how to use this function.
+ */
+uint16_t
+MSS_SYS_SNVM_CACHE_read
+(
+    uint8_t snvm_module,
+    uint8_t* p_user_key,
+    uint8_t* p_admin,
+    uint8_t* p_data,
+    uint16_t data_len,
+    uint16_t mb_offset
+)
+{
+    snvm_cache_entry_t* entry = 0;
+    uint16_t status = MSS_SYS_PARAM_ERR;
+    uint32_t generation = 0u;
+    uint32_t idx;
+    uint64_t saved;
+    uint8_t cacheable;
+
+    cacheable = ((MSS_SYS_SERVICE_POLLING_MODE == g_service_mode) &&
+                 ((uint8_t*)0 != p_admin) && ((uint8_t*)0 != p_data) &&
+                 ((SNVM_CACHE_MAX_DATA_LEN == data_len) ||
+                  ((SNVM_CACHE_AUTH_DATA_LEN == data_len) &&
+                   ((uint8_t*)0 != p_user_key))));
+
+    if (0u != cacheable)
+    {
+        saved = disable_interrupts();
+        spinlock(&g_snvm_cache_lock);
+
+        entry = snvm_cache_lookup(snvm_module, p_user_key, data_len);
+
+        if (0 != entry)
+        {
+            for (idx = 0u; idx < SNVM_CACHE_ADMIN_LEN; idx++)
+            {
+                p_admin[idx] = entry->admin[idx];
+            }
+
+            for (idx = 0u; idx < data_len; idx++)
+            {
+                p_data[idx] = entry->data[idx];
+            }
+
+            entry->last_use = ++g_snvm_cache_use;
+            status = MSS_SYS_SUCCESS;
+        }
+
+        generation = g_snvm_cache_generation;
+
+        spinunlock(&g_snvm_cache_lock);
+        restore_interrupts(saved);
+    }
+
+    if (0 == entry)
+    {
+        status = MSS_SYS_secure_nvm_read(snvm_module, p_user_key, p_admin,
+                                         p_data, data_len, mb_offset);
+
+        if ((0u != cacheable) && (MSS_SYS_SUCCESS == status))
+        {
+            saved = disable_interrupts();
+            spinlock(&g_snvm_cache_lock);
+
+            if (generation == g_snvm_cache_generation)
+            {
+                snvm_cache_insert(snvm_module, p_user_key, p_admin, p_data,
+                                  data_len);
+            }
+
+            spinunlock(&g_snvm_cache_lock);
+            restore_interrupts(saved);
+        }
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+ * MSS_SYS_SNVM_CACHE_invalidate()
+ * See "mss_sys_snvm_cache.h" for details of how to use this function.
+ */
+void
+MSS_SYS_SNVM_CACHE_invalidate
+(
+    uint8_t snvm_module
+)
+{
+    uint32_t entry_idx;
+    uint64_t saved;
+
+    saved = disable_interrupts();
+    spinlock(&g_snvm_cache_lock);
+
+    for (entry_idx = 0u; entry_idx < MSS_SYS_SNVM_CACHE_ENTRIES; entry_idx++)
+    {
+        if ((0u != g_snvm_cache[entry_idx].valid) &&
+            (snvm_module == g_snvm_cache[entry_idx].snvm_module))
+        {
+            snvm_cache_clear_entry(&g_snvm_cache[entry_idx]);
+        }
+    }
+
+    g_snvm_cache_generation++;
+
+    spinunlock(&g_snvm_cache_lock);
+    restore_interrupts(saved);
+}
+
+/***************************************************************************//**
+ * MSS_SYS_SNVM_CACHE_invalidate_all()
+ * See "mss_sys_snvm_cache.h" for details of how to use this function.
+ */
+void
+MSS_SYS_SNVM_CACHE_invalidate_all
+(
+    void
+)
+{
+    uint32_t entry_idx;
+    uint64_t saved;
+
+    saved = disable_interrupts();
+    spinlock(&g_snvm_cache_lock);
+
+    for (entry_idx = 0u; entry_idx < MSS_SYS_SNVM_CACHE_ENTRIES; entry_idx++)
+    {
+        snvm_cache_clear_entry(&g_snvm_cache[entry_idx]);
+    }
+
+    g_snvm_cache_generation++;
+
+    spinunlock(&g_snvm_cache_lock);
+    restore_interrupts(saved);
+}
+
+/***************************************************************************//**
+ Internal functions.
+*/
+
+/*
+ * This function returns the entry caching the page, or 0. For authenticated
+ * pages the user secret key must match the key used to read the page; the
+ * comparison takes the same time whatever the key. It must be called with
+ * g_snvm_cache_lock held.
+ */
+static snvm_cache_entry_t* snvm_cache_lookup
+(
+    uint8_t snvm_module,
+    const uint8_t* p_user_key,
+    uint16_t data_len
+)
+{
+    snvm_cache_entry_t* entry = 0;
+    uint32_t entry_idx;
+    uint32_t idx;
+    uint8_t diff;
+
+    for (entry_idx = 0u; entry_idx < MSS_SYS_SNVM_CACHE_ENTRIES; entry_idx++)
+    {
+        if ((0u != g_snvm_cache[entry_idx].valid) &&
+            (snvm_module == g_snvm_cache[entry_idx].snvm_module) &&
+            (data_len == g_snvm_cache[entry_idx].data_len))
+        {
+            diff = 0u;
+
+            if (SNVM_CACHE_AUTH_DATA_LEN == data_len)
+            {
+                for (idx = 0u; idx < SNVM_CACHE_USK_LEN; idx++)
+                {
+                    diff |= (uint8_t)(g_snvm_cache[entry_idx].user_key[idx] ^
+                                      p_user_key[idx]);
+                }
+            }
+
+            if (0u == diff)
+            {
+                entry = &g_snvm_cache[entry_idx];
+            }
+        }
+    }
+
+    return entry;
+}
+
+/*
+ * This function stores a page in a free entry, or in the least recently used
+ * entry when the cache is full. It must be called with g_snvm_cache_lock held.
+ */
+static void snvm_cache_insert
+(
+    uint8_t snvm_module,
+    const uint8_t* p_user_key,
+    const uint8_t* p_admin,
+    const uint8_t* p_data,
+    uint16_t data_len
+)
+{
+    snvm_cache_entry_t* entry = &g_snvm_cache[0];
+    uint32_t entry_idx;
+    uint32_t idx;
+
+    for (entry_idx = 0u; entry_idx < MSS_SYS_SNVM_CACHE_ENTRIES; entry_idx++)
+    {
+        if ((0u != g_snvm_cache[entry_idx].valid) &&
+            (snvm_module == g_snvm_cache[entry_idx].snvm_module))
+        {
+            /* Replace the page read with another length or key */
+            entry = &g_snvm_cache[entry_idx];
+            break;
+        }
+
+        if ((0u == g_snvm_cache[entry_idx].valid) ||
+            ((0u != entry->valid) &&
+             (g_snvm_cache[entry_idx].last_use < entry->last_use)))
+        {
+            entry = &g_snvm_cache[entry_idx];
+        }
+    }
+
+    for (idx = 0u; idx < SNVM_CACHE_ADMIN_LEN; idx++)
+    {
+        entry->admin[idx] = p_admin[idx];
+    }
+
+    for (idx = 0u; idx < data_len; idx++)
+    {
+        entry->data[idx] = p_data[idx];
+    }
+
+    for (idx = 0u; idx < SNVM_CACHE_USK_LEN; idx++)
+    {
+        if (SNVM_CACHE_AUTH_DATA_LEN == data_len)
+        {
+            entry->user_key[idx] = p_user_key[idx];
+        }
+        else
+        {
+            entry->user_key[idx] = 0u;
+        }
+    }
+
+    entry->snvm_module = snvm_module;
+    entry->data_len = data_len;
+    entry->last_use = ++g_snvm_cache_use;
+    entry->valid = 1u;
+}
+
+/*
+ * This function erases an entry, so that no page data or key is left in RAM.
+ */
+static void snvm_cache_clear_entry(snvm_cache_entry_t* entry)
+{
+    uint32_t idx;
+
+    for (idx = 0u; idx < SNVM_CACHE_MAX_DATA_LEN; idx++)
+    {
+        entry->data[idx] = 0u;
+    }
+
+    for (idx = 0u; idx < SNVM_CACHE_USK_LEN; idx++)
+    {
+        entry->user_key[idx] = 0u;
+    }
+
+    entry->valid = 0u;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * PolarFire SoC Microprocessor Subsystem(MSS) system services sNVM read cache.
+ */
+
+/*=========================================================================*//**
+  @mainpage PolarFire SoC MSS System services sNVM read cache
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The sNVM read cache keeps copies of recently read sNVM pages in RAM, so that
+  reading the same page again does not need a secure NVM read service from the
+  system controller.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  MSS_SYS_SNVM_CACHE_read() takes the same parameters as
+  MSS_SYS_secure_nvm_read(). When the page is cached with the same data length
+  and, for authenticated pages, was read with the same user secret key, the
+  cached page admin data and page data are copied to the caller's buffers.
+  Otherwise the page is read with MSS_SYS_secure_nvm_read() and cached when the
+  read was successful. The least recently used entry is replaced when the cache
+  is full.
+
+  The pages are only cached when the driver is in polling mode. In interrupt
+  mode the data is not available when MSS_SYS_secure_nvm_read() returns, so
+  the reads are passed to MSS_SYS_secure_nvm_read() unchanged.
+
+  Writes are not cached: MSS_SYS_secure_nvm_write() writes the page to sNVM and
+  invalidates the cached copy of the page by calling
+  MSS_SYS_SNVM_CACHE_invalidate(). MSS_SYS_SNVM_CACHE_invalidate_all() can be
+  used when sNVM is written by other means, for example by the fabric.
+
+  The cache holds page data and user secret keys in clear. It is placed in the
+  linker section named by MSS_SYS_SNVM_CACHE_SECTION, when this constant is
+  defined, so that the application can restrict access to it, for example with
+  a PMP region.
+ */
+
+#ifndef MSS_SYS_SNVM_CACHE_H_
+#define MSS_SYS_SNVM_CACHE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Number of sNVM pages held by the cache.
+ */
+#ifndef MSS_SYS_SNVM_CACHE_ENTRIES
+#define MSS_SYS_SNVM_CACHE_ENTRIES                              8u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_SNVM_CACHE_read() function reads an sNVM page through the cache.
+  The parameters and return values are those of MSS_SYS_secure_nvm_read().
+
+  Example:
+  @code
+       status = MSS_SYS_SNVM_CACHE_read(snvm_module, user_key, admin, data,
+                                        236u, 0u);
+  @endcode
+ */
+uint16_t
+MSS_SYS_SNVM_CACHE_read
+(
+    uint8_t snvm_module,
+    uint8_t* p_user_key,
+    uint8_t* p_admin,
+    uint8_t* p_data,
+    uint16_t data_len,
+    uint16_t mb_offset
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_SNVM_CACHE_invalidate() function removes a page from the cache.
+  It is called by MSS_SYS_secure_nvm_write().
+
+  @param snvm_module
+                    The sNVM module to be removed from the cache.
+  @return
+                    This function does not return any value.
+ */
+void
+MSS_SYS_SNVM_CACHE_invalidate
+(
+    uint8_t snvm_module
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_SNVM_CACHE_invalidate_all() function empties the cache.
+
+  @param
+                    This function does not have any parameters.
+  @return
+                    This function does not return any value.
+ */
+void
+MSS_SYS_SNVM_CACHE_invalidate_all
+(
+    void
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_SYS_SNVM_CACHE_H_ */
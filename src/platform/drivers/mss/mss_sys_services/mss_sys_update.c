@@ -0,0 +1,536 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem(MSS) system services pipelined
+ * firmware update implementation.
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "mss_sys_services.h"
+#include "mss_sys_update.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (MSS_SYS_UPDATE_CHUNKS < 2u)
+#error "MSS_SYS_UPDATE_CHUNKS must be at least 2"
+#endif
+
+#if (0u != (MSS_SYS_UPDATE_CHUNK_SIZE & (MSS_SYS_UPDATE_CHUNK_SIZE - 1u)))
+#error "MSS_SYS_UPDATE_CHUNK_SIZE must be a power of two"
+#endif
+
+#if ((0u == MSS_SYS_UPDATE_HASH_STEP) || (0u != (MSS_SYS_UPDATE_HASH_STEP % 64u)))
+#error "MSS_SYS_UPDATE_HASH_STEP must be a multiple of 64"
+#endif
+
+/*******************************************************************************
+ */
+#define UPDATE_RING_SIZE        (MSS_SYS_UPDATE_CHUNKS * MSS_SYS_UPDATE_CHUNK_SIZE)
+#define SHA256_BLOCK_LEN        64u
+
+/*******************************************************************************
+ * Type definitions
+ */
+typedef struct sha256_ctx
+{
+    uint32_t state[8];
+    uint64_t total;
+    uint8_t block[SHA256_BLOCK_LEN];
+    uint32_t used;
+} sha256_ctx_t;
+
+/*******************************************************************************
+ * Global variables declarations
+ */
+extern uint8_t g_service_mode;
+
+static const uint32_t g_sha256_k[64] =
+{
+    0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u, 0x3956c25bu, 0x59f111f1u,
+    0x923f82a4u, 0xab1c5ed5u, 0xd807aa98u, 0x12835b01u, 0x243185beu, 0x550c7dc3u,
+    0x72be5d74u, 0x80deb1feu, 0x9bdc06a7u, 0xc19bf174u, 0xe49b69c1u, 0xefbe4786u,
+    0x0fc19dc6u, 0x240ca1ccu, 0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau,
+    0x983e5152u, 0xa831c66du, 0xb00327c8u, 0xbf597fc7u, 0xc6e00bf3u, 0xd5a79147u,
+    0x06ca6351u, 0x14292967u, 0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu, 0x53380d13u,
+    0x650a7354u, 0x766a0abbu, 0x81c2c92eu, 0x92722c85u, 0xa2bfe8a1u, 0xa81a664bu,
+    0xc24b8b70u, 0xc76c51a3u, 0xd192e819u, 0xd6990624u, 0xf40e3585u, 0x106aa070u,
+    0x19a4c116u, 0x1e376c08u, 0x2748774cu, 0x34b0bcb5u, 0x391c0cb3u, 0x4ed8aa4au,
+    0x5b9cca4fu, 0x682e6ff3u, 0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u,
+    0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u
+};
+
+static uint8_t g_update_ring[UPDATE_RING_SIZE] __attribute__ ((aligned (8)));
+
+static const mss_sys_update_flash_t* g_update_flash;
+static uint32_t g_update_flash_addr;
+static uint32_t g_update_len;
+static uint8_t g_update_check;
+static uint8_t g_update_expected[MSS_SYS_UPDATE_DIGEST_LEN];
+static uint8_t g_update_digest[MSS_SYS_UPDATE_DIGEST_LEN];
+static uint8_t g_update_status = MSS_SYS_UPDATE_IDLE;
+static sha256_ctx_t g_update_sha;
+
+/* Byte counts from the start of the image. g_update_filled is only written
+ * by MSS_SYS_UPDATE_write() and g_update_released only by
+ * MSS_SYS_UPDATE_poll(), the other counts are private to the poll. */
+static volatile uint32_t g_update_filled;
+static volatile uint32_t g_update_released;
+static uint32_t g_update_writing;
+static uint32_t g_update_written;
+static uint32_t g_update_hashed;
+
+/*******************************************************************************
+ * Local function declarations.
+ */
+static void update_flash_step(void);
+static void update_hash_step(void);
+static void sha256_init(sha256_ctx_t* ctx);
+static void sha256_update(sha256_ctx_t* ctx, const uint8_t* p_data, uint32_t len);
+static void sha256_final(sha256_ctx_t* ctx, uint8_t* p_digest);
+static void sha256_block(uint32_t* state, const uint8_t* p_block);
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_SYS_UPDATE_begin()
+ * See "mss_sys_update.h" for details of how to use this function.
+ */
+uint8_t
+MSS_SYS_UPDATE_begin
+(
+    const mss_sys_update_flash_t* p_flash,
+    uint32_t flash_addr,
+    uint32_t image_len,
+    const uint8_t* p_digest
+)
+{
+    uint32_t idx;
+
+    if (((const mss_sys_update_flash_t*)0 == p_flash) || (0u == image_len) ||
+        (MSS_SYS_UPDATE_BUSY == g_update_status) ||
+        (0u == p_flash->sector_size) ||
+        (0u != (p_flash->sector_size % MSS_SYS_UPDATE_CHUNK_SIZE)) ||
+        (0u != (flash_addr % p_flash->sector_size)))
+    {
+        return MSS_SYS_UPDATE_PARAM_ERR;
+    }
+
+    g_update_flash = p_flash;
+    g_update_flash_addr = flash_addr;
+    g_update_len = image_len;
+    g_update_check = ((const uint8_t*)0 != p_digest) ? 1u : 0u;
+
+    for (idx = 0u; idx < MSS_SYS_UPDATE_DIGEST_LEN; idx++)
+    {
+        g_update_expected[idx] = (0u != g_update_check) ? p_digest[idx] : 0u;
+        g_update_digest[idx] = 0u;
+    }
+
+    g_update_filled = 0u;
+    g_update_released = 0u;
+    g_update_writing = 0u;
+    g_update_written = 0u;
+    g_update_hashed = 0u;
+    sha256_init(&g_update_sha);
+
+    mb();
+    g_update_status = MSS_SYS_UPDATE_BUSY;
+
+    return MSS_SYS_UPDATE_BUSY;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_SYS_UPDATE_write()
+ * See "mss_sys_update.h" for details of how to use this function.
+ */
+uint32_t
+MSS_SYS_UPDATE_write
+(
+    const uint8_t* p_data,
+    uint32_t len
+)
+{
+    uint32_t filled = g_update_filled;
+    uint32_t space;
+    uint32_t taken;
+    uint32_t pos;
+    uint32_t idx;
+
+    if (MSS_SYS_UPDATE_BUSY != g_update_status)
+    {
+        return 0u;
+    }
+
+    space = UPDATE_RING_SIZE - (filled - g_update_released);
+    taken = g_update_len - filled;
+
+    if (taken > space)
+    {
+        taken = space;
+    }
+
+    if (taken > len)
+    {
+        taken = len;
+    }
+
+    /* The reads of g_update_released are done before the ring is written */
+    mb();
+
+    pos = filled % UPDATE_RING_SIZE;
+    for (idx = 0u; idx < taken; idx++)
+    {
+        g_update_ring[pos] = p_data[idx];
+        pos++;
+        if (UPDATE_RING_SIZE == pos)
+        {
+            pos = 0u;
+        }
+    }
+
+    /* The data is in the ring before the poll can see it */
+    mb();
+    g_update_filled = filled + taken;
+
+    return taken;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_SYS_UPDATE_poll()
+ * See "mss_sys_update.h" for details of how to use this function.
+ */
+uint8_t
+MSS_SYS_UPDATE_poll
+(
+    void
+)
+{
+    uint32_t idx;
+    uint8_t diff = 0u;
+
+    if (MSS_SYS_UPDATE_BUSY == g_update_status)
+    {
+        update_flash_step();
+    }
+
+    if (MSS_SYS_UPDATE_BUSY == g_update_status)
+    {
+        update_hash_step();
+
+        mb();
+        g_update_released = (g_update_written < g_update_hashed) ?
+                            g_update_written : g_update_hashed;
+
+        if ((g_update_len == g_update_written) &&
+            (g_update_len == g_update_hashed))
+        {
+            sha256_final(&g_update_sha, g_update_digest);
+
+            for (idx = 0u; idx < MSS_SYS_UPDATE_DIGEST_LEN; idx++)
+            {
+                diff |= (uint8_t)(g_update_digest[idx] ^ g_update_expected[idx]);
+            }
+
+            if ((0u != g_update_check) && (0u != diff))
+            {
+                g_update_status = MSS_SYS_UPDATE_DIGEST_MISMATCH;
+            }
+            else
+            {
+                g_update_status = MSS_SYS_UPDATE_DONE;
+            }
+        }
+    }
+
+    return g_update_status;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_SYS_UPDATE_install()
+ * See "mss_sys_update.h" for details of how to use this function.
+ */
+uint16_t
+MSS_SYS_UPDATE_install
+(
+    uint32_t spi_idx,
+    uint8_t program
+)
+{
+    uint16_t status;
+
+    if (MSS_SYS_UPDATE_DONE != g_update_status)
+    {
+        return MSS_SYS_PARAM_ERR;
+    }
+
+    status = MSS_SYS_authenticate_iap_image(spi_idx);
+
+    if ((MSS_SYS_SUCCESS == status) && (0u != program) &&
+        (MSS_SYS_SERVICE_POLLING_MODE == g_service_mode))
+    {
+        status = MSS_SYS_execute_iap(MSS_SYS_IAP_PROGRAM_BY_SPIIDX_CMD,
+                                     spi_idx);
+    }
+
+    return status;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_SYS_UPDATE_get_digest()
+ * See "mss_sys_update.h" for details of how to use this function.
+ */
+void
+MSS_SYS_UPDATE_get_digest
+(
+    uint8_t* p_digest
+)
+{
+    uint32_t idx;
+
+    for (idx = 0u; idx < MSS_SYS_UPDATE_DIGEST_LEN; idx++)
+    {
+        p_digest[idx] = g_update_digest[idx];
+    }
+}
+
+/*
+ * This function moves the flash write on and, once the flash is idle, starts
+ * writing the next chunk when it is full, or the last one when the image is
+ * complete. Chunks are written whole from the ring, as they never wrap.
+ */
+static void update_flash_step(void)
+{
+    uint32_t filled = g_update_filled;
+    uint32_t len;
+    uint32_t addr;
+    uint8_t erase;
+    uint8_t result;
+
+    if (g_update_writing != g_update_written)
+    {
+        result = g_update_flash->poll();
+        if (MSS_SYS_UPDATE_FLASH_DONE == result)
+        {
+            g_update_written = g_update_writing;
+        }
+        else if (MSS_SYS_UPDATE_FLASH_ERROR == result)
+        {
+            g_update_status = MSS_SYS_UPDATE_FLASH_FAILED;
+        }
+        else
+        {
+            /* Still busy */
+        }
+    }
+
+    if ((MSS_SYS_UPDATE_BUSY == g_update_status) &&
+        (g_update_writing == g_update_written) &&
+        (g_update_writing != g_update_len))
+    {
+        len = filled - g_update_writing;
+        if (len > MSS_SYS_UPDATE_CHUNK_SIZE)
+        {
+            len = MSS_SYS_UPDATE_CHUNK_SIZE;
+        }
+
+        if ((MSS_SYS_UPDATE_CHUNK_SIZE == len) || (g_update_len == filled))
+        {
+            addr = g_update_flash_addr + g_update_writing;
+            erase = (0u == (g_update_writing % g_update_flash->sector_size)) ?
+                    1u : 0u;
+
+            result = g_update_flash->write(
+                        &g_update_ring[g_update_writing % UPDATE_RING_SIZE],
+                        addr, len, erase);
+
+            if (MSS_SYS_UPDATE_FLASH_BUSY == result)
+            {
+                g_update_writing += len;
+            }
+            else
+            {
+                g_update_status = MSS_SYS_UPDATE_FLASH_FAILED;
+            }
+        }
+    }
+}
+
+/*
+ * This function adds up to MSS_SYS_UPDATE_HASH_STEP bytes received to the
+ * digest, stopping at the end of the ring.
+ */
+static void update_hash_step(void)
+{
+    uint32_t len = g_update_filled - g_update_hashed;
+    uint32_t pos = g_update_hashed % UPDATE_RING_SIZE;
+
+    if (len > MSS_SYS_UPDATE_HASH_STEP)
+    {
+        len = MSS_SYS_UPDATE_HASH_STEP;
+    }
+
+    if (len > (UPDATE_RING_SIZE - pos))
+    {
+        len = UPDATE_RING_SIZE - pos;
+    }
+
+    if (0u != len)
+    {
+        sha256_update(&g_update_sha, &g_update_ring[pos], len);
+        g_update_hashed += len;
+    }
+}
+
+/*
+ * SHA-256, FIPS 180-4.
+ */
+static void sha256_init(sha256_ctx_t* ctx)
+{
+    ctx->state[0] = 0x6a09e667u;
+    ctx->state[1] = 0xbb67ae85u;
+    ctx->state[2] = 0x3c6ef372u;
+    ctx->state[3] = 0xa54ff53au;
+    ctx->state[4] = 0x510e527fu;
+    ctx->state[5] = 0x9b05688cu;
+    ctx->state[6] = 0x1f83d9abu;
+    ctx->state[7] = 0x5be0cd19u;
+    ctx->total = 0u;
+    ctx->used = 0u;
+}
+
+static void sha256_update(sha256_ctx_t* ctx, const uint8_t* p_data, uint32_t len)
+{
+    uint32_t idx = 0u;
+
+    ctx->total += len;
+
+    while ((0u != ctx->used) && (idx < len))
+    {
+        ctx->block[ctx->used] = p_data[idx];
+        ctx->used++;
+        idx++;
+        if (SHA256_BLOCK_LEN == ctx->used)
+        {
+            sha256_block(ctx->state, ctx->block);
+            ctx->used = 0u;
+        }
+    }
+
+    while ((len - idx) >= SHA256_BLOCK_LEN)
+    {
+        sha256_block(ctx->state, &p_data[idx]);
+        idx += SHA256_BLOCK_LEN;
+    }
+
+    while (idx < len)
+    {
+        ctx->block[ctx->used] = p_data[idx];
+        ctx->used++;
+        idx++;
+    }
+}
+
+static void sha256_final(sha256_ctx_t* ctx, uint8_t* p_digest)
+{
+    uint64_t bits = ctx->total * 8u;
+    uint32_t idx;
+
+    ctx->block[ctx->used] = 0x80u;
+    ctx->used++;
+
+    if (ctx->used > (SHA256_BLOCK_LEN - 8u))
+    {
+        while (ctx->used < SHA256_BLOCK_LEN)
+        {
+            ctx->block[ctx->used] = 0u;
+            ctx->used++;
+        }
+        sha256_block(ctx->state, ctx->block);
+        ctx->used = 0u;
+    }
+
+    while (ctx->used < (SHA256_BLOCK_LEN - 8u))
+    {
+        ctx->block[ctx->used] = 0u;
+        ctx->used++;
+    }
+
+    for (idx = 0u; idx < 8u; idx++)
+    {
+        ctx->block[SHA256_BLOCK_LEN - 1u - idx] = (uint8_t)(bits >> (8u * idx));
+    }
+    sha256_block(ctx->state, ctx->block);
+
+    for (idx = 0u; idx < 32u; idx++)
+    {
+        p_digest[idx] = (uint8_t)(ctx->state[idx / 4u] >> (24u - (8u * (idx % 4u))));
+    }
+}
+
+#define SHA256_ROR(x, n)        (((x) >> (n)) | ((x) << (32u - (n))))
+
+static void sha256_block(uint32_t* state, const uint8_t* p_block)
+{
+    uint32_t w[64];
+    uint32_t a = state[0];
+    uint32_t b = state[1];
+    uint32_t c = state[2];
+    uint32_t d = state[3];
+    uint32_t e = state[4];
+    uint32_t f = state[5];
+    uint32_t g = state[6];
+    uint32_t h = state[7];
+    uint32_t s0;
+    uint32_t s1;
+    uint32_t t1;
+    uint32_t t2;
+    uint32_t idx;
+
+    for (idx = 0u; idx < 16u; idx++)
+    {
+        w[idx] = ((uint32_t)p_block[4u * idx] << 24u) |
+                 ((uint32_t)p_block[(4u * idx) + 1u] << 16u) |
+                 ((uint32_t)p_block[(4u * idx) + 2u] << 8u) |
+                 (uint32_t)p_block[(4u * idx) + 3u];
+    }
+
+    for (idx = 16u; idx < 64u; idx++)
+    {
+        s0 = SHA256_ROR(w[idx - 15u], 7u) ^ SHA256_ROR(w[idx - 15u], 18u) ^
+             (w[idx - 15u] >> 3u);
+        s1 = SHA256_ROR(w[idx - 2u], 17u) ^ SHA256_ROR(w[idx - 2u], 19u) ^
+             (w[idx - 2u] >> 10u);
+        w[idx] = w[idx - 16u] + s0 + w[idx - 7u] + s1;
+    }
+
+    for (idx = 0u; idx < 64u; idx++)
+    {
+        s1 = SHA256_ROR(e, 6u) ^ SHA256_ROR(e, 11u) ^ SHA256_ROR(e, 25u);
+        t1 = h + s1 + ((e & f) ^ (~e & g)) + g_sha256_k[idx] + w[idx];
+        s0 = SHA256_ROR(a, 2u) ^ SHA256_ROR(a, 13u) ^ SHA256_ROR(a, 22u);
+        t2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+#ifdef __cplusplus
+}
+#endif
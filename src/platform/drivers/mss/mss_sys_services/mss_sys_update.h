@@ -0,0 +1,264 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem(MSS) system services pipelined
+ * firmware update.
+ */
+
+/*=========================================================================*//**
+  @mainpage PolarFire SoC MSS System services pipelined firmware update
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The update pipeline writes a new IAP image or bitstream to the SPI flash as
+  it is received, instead of receiving the whole image, then writing it, then
+  having the system controller authenticate it. Receiving, programming the
+  flash and computing the SHA-256 digest of the image overlap, so the image is
+  in the flash and checked about as soon as the slowest of them is done.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  The received data goes into a ring of MSS_SYS_UPDATE_CHUNKS chunks of
+  MSS_SYS_UPDATE_CHUNK_SIZE bytes. MSS_SYS_UPDATE_write() copies received data
+  into the ring, stopping where it is full, and is called by whatever is
+  receiving the image: a YMODEM or network receive loop, interrupt handler or
+  another hart.
+
+  MSS_SYS_UPDATE_poll(), called regularly by a single context, runs the other
+  two stages:
+    - Flash: as soon as the flash is idle and a chunk is full, the chunk write
+      is started with the write function of the flash driver. Its poll
+      function is called to move it on. The 64KB sectors are erased by the
+      write of their first chunk, so an erase costs no more than a program.
+      With the asynchronous engine of the micron_mt25q driver, chunks keep
+      arriving while the flash is programming.
+    - Digest: up to MSS_SYS_UPDATE_HASH_STEP bytes of the data received are
+      added to the SHA-256 digest of the image. The digest runs while the flash
+      is busy, and is not held up by it.
+  A chunk is given back to the ring once it has been written and hashed.
+
+  When the whole image has been written and hashed, the digest is compared
+  with the one given to MSS_SYS_UPDATE_begin(), catching an image damaged or
+  cut short in transfer before the system controller is involved.
+  MSS_SYS_UPDATE_install() then has the system controller authenticate the
+  image in the flash with MSS_SYS_authenticate_iap_image() and, if asked,
+  program it with MSS_SYS_execute_iap(). The authentication reads the image
+  back from the flash, so it also checks what was programmed.
+
+  MSS_SYS_UPDATE_install() waits for the services and needs the driver in
+  polling mode. In interrupt mode it returns after requesting the
+  authentication, as MSS_SYS_authenticate_iap_image() does, and the program
+  request is left to the application.
+
+  Example, with the micron_mt25q driver of the QSPI example:
+  @code
+      static const mss_sys_update_flash_t g_flash =
+      {
+          Flash_async_write, Flash_async_poll, FLASH_SECTOR_SIZE
+      };
+
+      MSS_SYS_UPDATE_begin(&g_flash, 0x00400000u, image_len, image_sha256);
+
+      while (MSS_SYS_UPDATE_BUSY == (status = MSS_SYS_UPDATE_poll()))
+      {
+          if (0u != packet_ready)
+          {
+              used += MSS_SYS_UPDATE_write(&packet[used], packet_len - used);
+              ...
+          }
+      }
+
+      if (MSS_SYS_UPDATE_DONE == status)
+      {
+          status = MSS_SYS_UPDATE_install(2u, 1u);
+      }
+  @endcode
+ */
+
+#ifndef MSS_SYS_UPDATE_H_
+#define MSS_SYS_UPDATE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Size of each chunk written to the flash, a power of two which divides the
+  sector size of the flash.
+ */
+#ifndef MSS_SYS_UPDATE_CHUNK_SIZE
+#define MSS_SYS_UPDATE_CHUNK_SIZE                               4096u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Number of chunks in the receive ring, at least 2 so that one can be filled
+  while another is written.
+ */
+#ifndef MSS_SYS_UPDATE_CHUNKS
+#define MSS_SYS_UPDATE_CHUNKS                                   4u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Most bytes added to the digest by each call to MSS_SYS_UPDATE_poll(), a
+  multiple of 64. It bounds the time each call takes.
+ */
+#ifndef MSS_SYS_UPDATE_HASH_STEP
+#define MSS_SYS_UPDATE_HASH_STEP                                1024u
+#endif
+
+#define MSS_SYS_UPDATE_DIGEST_LEN                               32u
+
+/*-------------------------------------------------------------------------*//**
+  Values returned by the flash driver functions, those of the micron_mt25q
+  asynchronous engine.
+ */
+#define MSS_SYS_UPDATE_FLASH_DONE                               0u
+#define MSS_SYS_UPDATE_FLASH_BUSY                               1u
+#define MSS_SYS_UPDATE_FLASH_ERROR                              2u
+
+/*-------------------------------------------------------------------------*//**
+  Values returned by MSS_SYS_UPDATE_begin() and MSS_SYS_UPDATE_poll().
+ */
+#define MSS_SYS_UPDATE_DONE                                     0u
+#define MSS_SYS_UPDATE_BUSY                                     1u
+#define MSS_SYS_UPDATE_FLASH_FAILED                             2u
+#define MSS_SYS_UPDATE_DIGEST_MISMATCH                          3u
+#define MSS_SYS_UPDATE_PARAM_ERR                                4u
+#define MSS_SYS_UPDATE_IDLE                                     5u
+
+/*-------------------------------------------------------------------------*//**
+  The mss_sys_update_flash_t structure gives the pipeline the flash driver.
+
+  write starts writing len bytes from buf to the flash at addr, erasing the
+  sectors covering them first when erase is not 0, and returns without
+  waiting. It returns MSS_SYS_UPDATE_FLASH_BUSY when the write was started.
+  buf remains valid until the write is done.
+
+  poll moves the write on and returns MSS_SYS_UPDATE_FLASH_BUSY until it is
+  done, then MSS_SYS_UPDATE_FLASH_DONE or MSS_SYS_UPDATE_FLASH_ERROR.
+
+  sector_size is the size of the flash sectors erased by write.
+ */
+typedef struct mss_sys_update_flash
+{
+    uint8_t (*write)(const uint8_t* buf, uint32_t addr, uint32_t len,
+                     uint8_t erase);
+    uint8_t (*poll)(void);
+    uint32_t sector_size;
+} mss_sys_update_flash_t;
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_UPDATE_begin() function starts an update.
+
+  @param p_flash
+                    The flash driver to write the image with.
+  @param flash_addr
+                    The address in the flash to write the image to, at the
+                    start of a sector.
+  @param image_len
+                    The length of the image in bytes.
+  @param p_digest
+                    The MSS_SYS_UPDATE_DIGEST_LEN byte SHA-256 digest the image
+                    must have, or NULL to not check it.
+  @return
+                    This function returns MSS_SYS_UPDATE_BUSY if the update
+                    was started, or MSS_SYS_UPDATE_PARAM_ERR.
+ */
+uint8_t
+MSS_SYS_UPDATE_begin
+(
+    const mss_sys_update_flash_t* p_flash,
+    uint32_t flash_addr,
+    uint32_t image_len,
+    const uint8_t* p_digest
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_UPDATE_write() function adds received image data to the update.
+  It may be called from another hart or an interrupt handler than
+  MSS_SYS_UPDATE_poll(), by a single context at a time.
+
+  @param p_data
+                    The data received, the next len bytes of the image.
+  @param len
+                    The number of bytes.
+  @return
+                    This function returns the number of bytes taken, fewer
+                    than len when the ring is full or the image is complete.
+                    The rest is given again once MSS_SYS_UPDATE_poll() has
+                    freed some of the ring.
+ */
+uint32_t
+MSS_SYS_UPDATE_write
+(
+    const uint8_t* p_data,
+    uint32_t len
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_UPDATE_poll() function moves the update on, see above.
+
+  @param
+                    This function does not have any parameters.
+  @return
+                    This function returns MSS_SYS_UPDATE_BUSY until the image
+                    has been written and checked, then MSS_SYS_UPDATE_DONE,
+                    MSS_SYS_UPDATE_FLASH_FAILED or
+                    MSS_SYS_UPDATE_DIGEST_MISMATCH. It returns
+                    MSS_SYS_UPDATE_IDLE when no update was started.
+ */
+uint8_t
+MSS_SYS_UPDATE_poll
+(
+    void
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_UPDATE_install() function has the system controller
+  authenticate the image written, and program it if asked. It can only be
+  called once MSS_SYS_UPDATE_poll() has returned MSS_SYS_UPDATE_DONE.
+
+  @param spi_idx
+                    The index of the image in the SPI directory.
+  @param program
+                    Not 0 to program the image with
+                    MSS_SYS_IAP_PROGRAM_BY_SPIIDX_CMD once it has been
+                    authenticated.
+  @return
+                    This function returns the status of the last service
+                    requested, or MSS_SYS_PARAM_ERR if the update is not done.
+ */
+uint16_t
+MSS_SYS_UPDATE_install
+(
+    uint32_t spi_idx,
+    uint8_t program
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_SYS_UPDATE_get_digest() function copies the SHA-256 digest of the
+  image, once MSS_SYS_UPDATE_poll() has returned MSS_SYS_UPDATE_DONE or
+  MSS_SYS_UPDATE_DIGEST_MISMATCH.
+
+  @param p_digest
+                    Receives the MSS_SYS_UPDATE_DIGEST_LEN byte digest.
+  @return
+                    This function does not return any value.
+ */
+void
+MSS_SYS_UPDATE_get_digest
+(
+    uint8_t* p_digest
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_SYS_UPDATE_H_ */
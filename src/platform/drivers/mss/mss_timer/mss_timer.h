@@ -109,6 +109,9 @@
   application code. The Timer 2 interrupt is not used when the MSS Timer is
   configured as a 64-bit timer.
   
+  To time more one-shot events than there are timers, the deadline scheduler
+  in mss_timer_sched.h multiplexes them onto the 64-bit timer.
+  
  *//*=========================================================================*/
 #ifndef MSS_TIMER_H_
 #define MSS_TIMER_H_
@@ -0,0 +1,385 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC Microprocessor Subsystem (MSS) Timer 64-bit deadline event
+ * scheduler implementation.
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "mss_timer.h"
+#include "mss_timer_sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Constant definitions
+ */
+#define TSCHED_COUNT_MAX                0xFFFFFFFFFFFFFFFFull
+#define TSCHED_NOT_ARMED                0xFFFFFFFFFFFFFFFFull
+
+/*******************************************************************************
+ * Local variables
+ */
+static TIMER_TypeDef * g_tsched_timer;
+static mss_tim64_sched_event_t * g_tsched_heap[MSS_TIM64_SCHED_MAX_EVENTS];
+static uint32_t g_tsched_waiting = 0u;
+
+/* Time base: the counter was loaded with g_tsched_loaded at g_tsched_base */
+static uint64_t g_tsched_base = 0u;
+static uint64_t g_tsched_loaded = TSCHED_COUNT_MAX;
+
+/* Deadline the timer is set for */
+static uint64_t g_tsched_armed = TSCHED_NOT_ARMED;
+static uint8_t g_tsched_in_isr = 0u;
+
+static mss_tim64_sched_stats_t g_tsched_stats;
+
+/*******************************************************************************
+ * Local function declarations
+ */
+static uint64_t tsched_now(void);
+static void tsched_arm(uint64_t deadline);
+static void tsched_swap(uint32_t a, uint32_t b);
+static void tsched_sift_up(uint32_t index);
+static void tsched_sift_down(uint32_t index);
+static void tsched_remove(uint32_t index);
+static void tsched_record(uint64_t late);
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_timer_sched.h for details of how to use this function.
+ */
+void MSS_TIM64_SCHED_init(TIMER_TypeDef * timer)
+{
+    uint32_t inc;
+
+    g_tsched_timer = timer;
+
+    for (inc = 0u; inc < g_tsched_waiting; inc++)
+    {
+        g_tsched_heap[inc]->queued = 0u;
+    }
+
+    g_tsched_waiting = 0u;
+    g_tsched_base = 0u;
+    g_tsched_loaded = TSCHED_COUNT_MAX;
+    g_tsched_armed = TSCHED_NOT_ARMED;
+    MSS_TIM64_SCHED_clear_stats();
+
+    /* Periodic from the largest count, so the counter never stops */
+    MSS_TIM64_init(timer, MSS_TIMER_PERIODIC_MODE);
+    MSS_TIM64_load_immediate(timer, 0xFFFFFFFFu, 0xFFFFFFFFu);
+    MSS_TIM64_load_background(timer, 0xFFFFFFFFu, 0xFFFFFFFFu);
+    MSS_TIM64_start(timer);
+    MSS_TIM64_enable_irq(timer);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_timer_sched.h for details of how to use this function.
+ */
+uint64_t MSS_TIM64_SCHED_now(void)
+{
+    uint64_t psr = disable_interrupts();
+    uint64_t now = tsched_now();
+
+    restore_interrupts(psr);
+
+    return now;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_timer_sched.h for details of how to use this function.
+ */
+uint8_t MSS_TIM64_SCHED_add
+(
+    mss_tim64_sched_event_t * event,
+    uint64_t deadline,
+    mss_tim64_sched_handler_t handler,
+    void * arg
+)
+{
+    uint8_t ret_val = ERROR;
+    uint64_t psr = disable_interrupts();
+
+    if ((0u == event->queued) &&
+        (g_tsched_waiting < MSS_TIM64_SCHED_MAX_EVENTS))
+    {
+        event->deadline = deadline;
+        event->handler = handler;
+        event->arg = arg;
+        event->queued = 1u;
+        event->index = g_tsched_waiting;
+
+        g_tsched_heap[g_tsched_waiting] = event;
+        g_tsched_waiting++;
+        tsched_sift_up(event->index);
+
+        if (g_tsched_waiting > g_tsched_stats.max_waiting)
+        {
+            g_tsched_stats.max_waiting = g_tsched_waiting;
+        }
+
+        /* The interrupt handler sets the timer once the handlers have run */
+        if ((0u == g_tsched_in_isr) && (0u == event->index) &&
+            (deadline < g_tsched_armed))
+        {
+            tsched_arm(deadline);
+        }
+
+        ret_val = SUCCESS;
+    }
+    else if (0u == event->queued)
+    {
+        g_tsched_stats.overflows++;
+    }
+    else
+    {
+        /* Already waiting */
+    }
+
+    restore_interrupts(psr);
+
+    return ret_val;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_timer_sched.h for details of how to use this function.
+ *
+ * The timer is left set for the deadline of the event removed, the interrupt
+ * then finding nothing due and setting it for the next deadline.
+ */
+uint8_t MSS_TIM64_SCHED_cancel(mss_tim64_sched_event_t * event)
+{
+    uint8_t ret_val = ERROR;
+    uint64_t psr = disable_interrupts();
+
+    if (0u != event->queued)
+    {
+        tsched_remove(event->index);
+        ret_val = SUCCESS;
+    }
+
+    restore_interrupts(psr);
+
+    return ret_val;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_timer_sched.h for details of how to use this function.
+ */
+void MSS_TIM64_SCHED_isr(void)
+{
+    mss_tim64_sched_event_t * event;
+    uint64_t now;
+
+    MSS_TIM64_clear_irq(g_tsched_timer);
+
+    g_tsched_in_isr = 1u;
+    g_tsched_armed = TSCHED_NOT_ARMED;
+    now = tsched_now();
+
+    while ((0u != g_tsched_waiting) &&
+           (g_tsched_heap[0]->deadline <= (now + MSS_TIM64_SCHED_LEAD_TICKS)))
+    {
+        event = g_tsched_heap[0];
+
+        /* Set early by MSS_TIM64_SCHED_LEAD_TICKS, wait out the rest */
+        while (now < event->deadline)
+        {
+            now = tsched_now();
+        }
+
+        tsched_remove(0u);
+        tsched_record(now - event->deadline);
+        event->handler(event, event->arg);
+
+        now = tsched_now();
+    }
+
+    g_tsched_in_isr = 0u;
+
+    if (0u != g_tsched_waiting)
+    {
+        tsched_arm(g_tsched_heap[0]->deadline);
+    }
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_timer_sched.h for details of how to use this function.
+ */
+void MSS_TIM64_SCHED_get_stats(mss_tim64_sched_stats_t * stats)
+{
+    uint64_t psr = disable_interrupts();
+
+    *stats = g_tsched_stats;
+    restore_interrupts(psr);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_timer_sched.h for details of how to use this function.
+ */
+void MSS_TIM64_SCHED_clear_stats(void)
+{
+    uint64_t psr = disable_interrupts();
+
+    g_tsched_stats.fired = 0u;
+    g_tsched_stats.late_min = TSCHED_COUNT_MAX;
+    g_tsched_stats.late_max = 0u;
+    g_tsched_stats.late_total = 0u;
+    g_tsched_stats.max_waiting = g_tsched_waiting;
+    g_tsched_stats.overflows = 0u;
+    restore_interrupts(psr);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * Ticks since MSS_TIM64_SCHED_init(), called with interrupts masked. Once the
+ * counter has passed zero it has been reloaded with the largest count, so a
+ * value above the one loaded means the deadline has passed.
+ */
+static uint64_t tsched_now(void)
+{
+    uint32_t value_u;
+    uint32_t value_l;
+    uint64_t value;
+    uint64_t now;
+
+    MSS_TIM64_get_current_value(g_tsched_timer, &value_u, &value_l);
+    value = ((uint64_t)value_u << 32u) | (uint64_t)value_l;
+
+    if (value <= g_tsched_loaded)
+    {
+        now = g_tsched_base + (g_tsched_loaded - value);
+    }
+    else
+    {
+        now = g_tsched_base + g_tsched_loaded + 1u + (TSCHED_COUNT_MAX - value);
+    }
+
+    return now;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * Loads the counter to reach zero at the deadline, less the lead. The
+ * background value is set back to the largest count, as writing the load
+ * value sets it too.
+ */
+static void tsched_arm(uint64_t deadline)
+{
+    uint64_t now = tsched_now();
+    uint64_t target = deadline;
+    uint64_t delta = 1u;
+
+    if (target > MSS_TIM64_SCHED_LEAD_TICKS)
+    {
+        target -= MSS_TIM64_SCHED_LEAD_TICKS;
+    }
+
+    if (target > now)
+    {
+        delta = target - now;
+    }
+
+    MSS_TIM64_load_immediate(g_tsched_timer, (uint32_t)(delta >> 32u),
+            (uint32_t)delta);
+    MSS_TIM64_load_background(g_tsched_timer, 0xFFFFFFFFu, 0xFFFFFFFFu);
+
+    g_tsched_base = now + MSS_TIM64_SCHED_RELOAD_TICKS;
+    g_tsched_loaded = delta;
+    g_tsched_armed = deadline;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * Heap maintenance, the nearest deadline at index 0.
+ */
+static void tsched_swap(uint32_t a, uint32_t b)
+{
+    mss_tim64_sched_event_t * event = g_tsched_heap[a];
+
+    g_tsched_heap[a] = g_tsched_heap[b];
+    g_tsched_heap[b] = event;
+    g_tsched_heap[a]->index = a;
+    g_tsched_heap[b]->index = b;
+}
+
+static void tsched_sift_up(uint32_t index)
+{
+    uint32_t parent;
+
+    while ((index > 0u) && (g_tsched_heap[(index - 1u) / 2u]->deadline >
+                            g_tsched_heap[index]->deadline))
+    {
+        parent = (index - 1u) / 2u;
+        tsched_swap(index, parent);
+        index = parent;
+    }
+}
+
+static void tsched_sift_down(uint32_t index)
+{
+    uint32_t child;
+    uint32_t smallest = index;
+
+    do
+    {
+        index = smallest;
+        child = (2u * index) + 1u;
+
+        if ((child < g_tsched_waiting) &&
+            (g_tsched_heap[child]->deadline <
+             g_tsched_heap[smallest]->deadline))
+        {
+            smallest = child;
+        }
+
+        child++;
+
+        if ((child < g_tsched_waiting) &&
+            (g_tsched_heap[child]->deadline <
+             g_tsched_heap[smallest]->deadline))
+        {
+            smallest = child;
+        }
+
+        if (smallest != index)
+        {
+            tsched_swap(index, smallest);
+        }
+    } while (smallest != index);
+}
+
+static void tsched_remove(uint32_t index)
+{
+    g_tsched_heap[index]->queued = 0u;
+    g_tsched_waiting--;
+
+    if (index != g_tsched_waiting)
+    {
+        g_tsched_heap[index] = g_tsched_heap[g_tsched_waiting];
+        g_tsched_heap[index]->index = index;
+        tsched_sift_down(index);
+        tsched_sift_up(index);
+    }
+}
+
+static void tsched_record(uint64_t late)
+{
+    g_tsched_stats.fired++;
+    g_tsched_stats.late_total += late;
+
+    if (late < g_tsched_stats.late_min)
+    {
+        g_tsched_stats.late_min = late;
+    }
+
+    if (late > g_tsched_stats.late_max)
+    {
+        g_tsched_stats.late_max = late;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
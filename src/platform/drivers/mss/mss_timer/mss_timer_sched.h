@@ -0,0 +1,237 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * PolarFire SoC Microprocessor Subsystem (MSS) Timer 64-bit deadline event
+ * scheduler.
+ */
+
+
+/*=========================================================================*//**
+  @mainpage PolarFire SoC MSS Timer deadline scheduler
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The deadline scheduler multiplexes any number of one-shot events onto the
+  MSS Timer used as a single 64-bit timer. Each event calls a handler, from
+  the timer interrupt, at a deadline given in timer ticks. The timer counts at
+  the APB clock rate, so deadlines have a resolution of a few nanoseconds.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  MSS_TIM64_SCHED_init() sets up the 64-bit timer in periodic mode, reloading
+  itself with the largest count, so it never stops and is used as the time
+  base as well. MSS_TIM64_SCHED_now() returns the ticks since the call to
+  MSS_TIM64_SCHED_init().
+
+  The events waiting are held in a binary heap on their deadlines. The timer is
+  loaded with MSS_TIM64_load_immediate() for the nearest deadline when an event
+  is added ahead of all the others and when the timer interrupt has called the
+  handlers due. The background load value stays at the largest count, so the
+  time base carries on from the deadline.
+
+  The handler of an event may add the event again, e.g. with its last deadline
+  plus a period, for a periodic event which does not drift.
+
+  The time from a deadline to the call of the handler is recorded for each
+  event, giving the lowest, highest and mean lateness and so the jitter. The
+  interrupt latency can be taken out of the jitter by defining
+  MSS_TIM64_SCHED_LEAD_TICKS: the timer is then set that many ticks before the
+  deadline and the interrupt handler waits for the deadline itself.
+
+  The timer interrupt handler of the application, timer1_plic_IRQHandler(),
+  must call MSS_TIM64_SCHED_isr(). The functions below mask interrupts on the
+  calling hart only, so they must be called on the hart the Timer 1 interrupt
+  is enabled on.
+
+  Example:
+  @code
+    static mss_tim64_sched_event_t g_pwm_event;
+
+    static void pwm_update(mss_tim64_sched_event_t * event, void * arg)
+    {
+        update_duty_cycle();
+        (void)MSS_TIM64_SCHED_add(event, event->deadline +
+                MSS_TIM64_SCHED_US_TO_TICKS(50u), pwm_update, arg);
+    }
+
+    uint8_t timer1_plic_IRQHandler(void)
+    {
+        MSS_TIM64_SCHED_isr();
+        return EXT_IRQ_KEEP_ENABLED;
+    }
+
+    MSS_TIM64_SCHED_init(TIMER_LO);
+    (void)MSS_TIM64_SCHED_add(&g_pwm_event, MSS_TIM64_SCHED_now() +
+            MSS_TIM64_SCHED_US_TO_TICKS(50u), pwm_update, 0);
+  @endcode
+ */
+
+#ifndef MSS_TIMER_SCHED_H_
+#define MSS_TIMER_SCHED_H_
+
+#include <stdint.h>
+#include "mss_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Largest number of events waiting at the same time.
+ */
+#ifndef MSS_TIM64_SCHED_MAX_EVENTS
+#define MSS_TIM64_SCHED_MAX_EVENTS          32u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Timer clock rate, the MSS APB clock.
+ */
+#ifndef MSS_TIM64_SCHED_CLK_HZ
+#define MSS_TIM64_SCHED_CLK_HZ              LIBERO_SETTING_MSS_APB_AHB_CLK
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Ticks from reading the timer to the new load value taking effect, added to
+  the time base each time the timer is loaded.
+ */
+#ifndef MSS_TIM64_SCHED_RELOAD_TICKS
+#define MSS_TIM64_SCHED_RELOAD_TICKS        0u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Ticks before a deadline the timer interrupt is set for, the interrupt handler
+  waiting out the rest. 0 calls the handlers from the interrupt as it comes.
+ */
+#ifndef MSS_TIM64_SCHED_LEAD_TICKS
+#define MSS_TIM64_SCHED_LEAD_TICKS          0u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Conversions from microseconds and nanoseconds to timer ticks.
+ */
+#define MSS_TIM64_SCHED_US_TO_TICKS(us) \
+    (((uint64_t)(us) * (uint64_t)MSS_TIM64_SCHED_CLK_HZ) / 1000000u)
+#define MSS_TIM64_SCHED_NS_TO_TICKS(ns) \
+    (((uint64_t)(ns) * (uint64_t)MSS_TIM64_SCHED_CLK_HZ) / 1000000000u)
+
+struct mss_tim64_sched_event;
+
+/*-------------------------------------------------------------------------*//**
+  Handler called, from the timer interrupt, at the deadline of an event.
+ */
+typedef void (*mss_tim64_sched_handler_t)
+(
+    struct mss_tim64_sched_event * event,
+    void * arg
+);
+
+/*-------------------------------------------------------------------------*//**
+  An event, provided by the application. Its members are set by
+  MSS_TIM64_SCHED_add() and must not be changed while the event is waiting.
+ */
+typedef struct mss_tim64_sched_event
+{
+    uint64_t deadline;
+    mss_tim64_sched_handler_t handler;
+    void * arg;
+    uint32_t index;                 /* Place in the heap while waiting */
+    uint8_t queued;
+} mss_tim64_sched_event_t;
+
+/*-------------------------------------------------------------------------*//**
+  Lateness of the calls to the handlers, in timer ticks after the deadline.
+ */
+typedef struct
+{
+    uint64_t fired;                 /* Handlers called */
+    uint64_t late_min;
+    uint64_t late_max;
+    uint64_t late_total;            /* Divide by fired for the mean */
+    uint32_t max_waiting;           /* Most events waiting at once */
+    uint32_t overflows;             /* MSS_TIM64_SCHED_add() calls refused */
+} mss_tim64_sched_stats_t;
+
+/*-------------------------------------------------------------------------*//**
+  MSS_TIM64_SCHED_init() initializes the MSS Timer as a 64-bit timer, starts
+  the time base and enables the Timer 1 interrupt. Any events waiting are
+  dropped and the statistics are cleared.
+
+  @param timer
+    The timer parameter specifies the Timer block to use, TIMER_LO or
+    TIMER_HI.
+ */
+void MSS_TIM64_SCHED_init(TIMER_TypeDef * timer);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_TIM64_SCHED_now() returns the ticks since MSS_TIM64_SCHED_init().
+ */
+uint64_t MSS_TIM64_SCHED_now(void);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_TIM64_SCHED_add() adds an event calling handler at the deadline, in ticks
+  as returned by MSS_TIM64_SCHED_now(). A deadline which has passed calls the
+  handler straight away from the timer interrupt.
+
+  @return
+    SUCCESS, or ERROR if the event is already waiting or
+    MSS_TIM64_SCHED_MAX_EVENTS events are waiting.
+ */
+uint8_t MSS_TIM64_SCHED_add
+(
+    mss_tim64_sched_event_t * event,
+    uint64_t deadline,
+    mss_tim64_sched_handler_t handler,
+    void * arg
+);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_TIM64_SCHED_cancel() removes an event which is waiting.
+
+  @return
+    SUCCESS, or ERROR if the event was not waiting.
+ */
+uint8_t MSS_TIM64_SCHED_cancel(mss_tim64_sched_event_t * event);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_TIM64_SCHED_isr() calls the handlers of the events due and sets the timer
+  for the next deadline. It must be called from timer1_plic_IRQHandler().
+ */
+void MSS_TIM64_SCHED_isr(void);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_TIM64_SCHED_get_stats() copies the lateness statistics to stats.
+ */
+void MSS_TIM64_SCHED_get_stats(mss_tim64_sched_stats_t * stats);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_TIM64_SCHED_clear_stats() clears the lateness statistics.
+ */
+void MSS_TIM64_SCHED_clear_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_TIMER_SCHED_H_ */
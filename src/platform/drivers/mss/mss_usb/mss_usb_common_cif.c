@@ -487,6 +487,9 @@ MSS_USB_CIF_rx_ep_read_prepare
         /* Make sure that address is Modulo-4.Bits D0-D1 are read only.*/
         ASSERT(!(((uint32_t)buf_addr) & 0x00000002U));
 
+#ifdef MSS_USB_CACHE_MAINTENANCE
+        mss_l2_flush_range((uint64_t)(uintptr_t)buf_addr, xfr_length);
+#endif
         MSS_USB_CIF_dma_write_addr(dma_channel, (uint32_t)buf_addr);
 
         /*
@@ -540,6 +543,10 @@ MSS_USB_CIF_ep_write_pkt
             /* Make sure that address is Modulo-4.Bits D0-D1 are read only.*/
             ASSERT(!(((uint32_t)buf_addr) & 0x00000002u));
 
+#ifdef MSS_USB_CACHE_MAINTENANCE
+            mss_l2_flush_range((uint64_t)(uintptr_t)buf_addr,
+                        (MSS_USB_XFR_BULK == xfr_type) ? xfr_length : txn_length);
+#endif
             MSS_USB_CIF_dma_write_addr(dma_channel,(uint32_t)(buf_addr));
 
             if (MSS_USB_XFR_BULK == xfr_type)
@@ -61,4 +61,24 @@
     #define MSS_USB_OTG_SRP_ENABLED
 #endif
 
+/*-------------------------------------------------------------------------*//**
+  Define MSS_USB_CACHE_MAINTENANCE to have the driver flush DMA buffers from
+  the L2 cache before each DMA transfer is started, so that they can be placed
+  in cached DDR. The CPU must not access a buffer while its transfer is in
+  progress.
+*/
+
+/*-------------------------------------------------------------------------*//**
+  Define MSS_USBH_MSC_DMA to have the USBH-MSC driver configure its bulk pipes
+  to use the MSS USB DMA channels 1 (OUT) and 2 (IN) instead of copying the
+  data to and from the FIFOs in the interrupt handler. The data buffers must be
+  word aligned and reachable by the MSS USB DMA, and these DMA channels must
+  not be used by the application.
+*/
+
+/*-------------------------------------------------------------------------*//**
+  Define MSS_USBH_HID_REPORT_QUEUE_SIZE to set the number of reports that the
+  USBH-HID driver queues until the application takes them. The default is 8.
+*/
+
 #endif  /* __MSS_USB_CONFIG_H_ */
@@ -0,0 +1,856 @@
+/*******************************************************************************
+ * Copyright 2019-2020 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC MSS USB Driver Stack
+ *      USB Logical Layer (USB-LL)
+ *          USBD-CDC class driver.
+ *
+ * USBD-CDC class driver implementation:
+ * This source file implements a CDC ACM virtual serial port with a transmit
+ * ring sent by the MSS USB DMA and a ring of receive buffers.
+ *
+ */
+
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "mss_usb_device.h"
+#include "mss_usb_device_cdc.h"
+#include "mss_usb_std_def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MSS_USB_DEVICE_ENABLED
+
+#define CDC_COMM_INTERFACE_NUM                          0x00u
+#define CDC_DATA_INTERFACE_NUM                          0x01u
+#define CDC_CONF_DESCR_DESCTYPE_IDX                     1u
+
+/* Offsets of wMaxPacketSize of the bulk endpoint descriptors */
+#define CDC_CONF_DESCR_TX_MAXPKT_IDX                    65u
+#define CDC_CONF_DESCR_RX_MAXPKT_IDX                    72u
+
+#define CDC_LINE_CODING_LENGTH                          7u
+
+/***************************************************************************//**
+ Local functions used by USBD-CDC class driver.
+ */
+static void usbd_cdc_tx_start(void);
+static void usbd_cdc_rx_start(void);
+
+/***************************************************************************//**
+ Implementations of Call-back functions used by USBD.
+ */
+static uint8_t* usbd_cdc_get_descriptor_cb(uint8_t recepient,
+                                           uint8_t type,
+                                           uint32_t* length,
+                                           mss_usb_device_speed_t musb_speed);
+
+static uint8_t usbd_cdc_init_cb(uint8_t cfgidx,
+                                mss_usb_device_speed_t musb_speed);
+static uint8_t usbd_cdc_release_cb(uint8_t cfgidx);
+static uint8_t usbd_cdc_process_request_cb(mss_usbd_setup_pkt_t* setup_pkt,
+                                           uint8_t** buf_pp,
+                                           uint32_t* length);
+static uint8_t usbd_cdc_tx_complete_cb(mss_usb_ep_num_t num, uint8_t status);
+static uint8_t usbd_cdc_rx_cb(mss_usb_ep_num_t num,
+                              uint8_t status,
+                              uint32_t rx_count);
+static uint8_t usbd_cdc_cep_rx_done_cb(uint8_t status);
+
+/*******************************************************************************
+ Global variables used by USBD-CDC class driver.
+ */
+mss_usbd_class_cb_t usbd_cdc_class_cb = {usbd_cdc_init_cb,
+                                         usbd_cdc_release_cb,
+                                         usbd_cdc_get_descriptor_cb,
+                                         usbd_cdc_process_request_cb,
+                                         usbd_cdc_tx_complete_cb,
+                                         usbd_cdc_rx_cb,
+                                         0,
+                                         usbd_cdc_cep_rx_done_cb };
+
+/* Application call-back functions */
+static const mss_usbd_cdc_cb_t* g_usbd_cdc_app_cb = 0;
+
+/* USB current Speed of operation selected by user*/
+static mss_usb_device_speed_t g_usbd_cdc_user_speed;
+
+static volatile mss_usbd_cdc_state_t g_usbd_cdc_state = USBD_CDC_NOT_CONFIGURED;
+
+static mss_usbd_cdc_line_coding_t g_line_coding __attribute__ ((aligned (4))) =
+                                                        {115200u, 0u, 0u, 8u};
+static mss_usbd_cdc_line_coding_t g_line_coding_rx __attribute__ ((aligned (4)));
+static volatile uint16_t g_control_line = 0u;
+
+/*
+ Transmit ring. head and tail are free running byte counts, the transfer in
+ progress covers tx_xfr_advance bytes from tail: its data and the unused bytes
+ up to the next word.
+ */
+static uint8_t* g_tx_ring = 0;
+static uint32_t g_tx_ring_size = 0u;
+static volatile uint32_t g_tx_head = 0u;
+static volatile uint32_t g_tx_tail = 0u;
+static volatile uint32_t g_tx_xfr_advance = 0u;
+static volatile uint8_t g_tx_busy = 0u;
+
+/*
+ Receive buffers, filled in order by the endpoint and emptied in order by
+ MSS_USBD_CDC_read().
+ */
+static uint8_t g_rx_buf[CDC_RX_BUFFER_COUNT][CDC_RX_BUFFER_SIZE] __attribute__ ((aligned (4)));
+static uint32_t g_rx_len[CDC_RX_BUFFER_COUNT];
+static volatile uint32_t g_rx_fill_idx = 0u;
+static volatile uint32_t g_rx_read_idx = 0u;
+static volatile uint32_t g_rx_read_offset = 0u;
+static volatile uint32_t g_rx_filled = 0u;
+static volatile uint8_t g_rx_busy = 0u;
+
+uint8_t cdc_fs_conf_descr[CDC_CONFIG_DESCR_LENGTH] =
+{
+    /*----------------------- Configuration Descriptor -----------------------*/
+    USB_STD_CONFIG_DESCR_LEN,                       /* bLength */
+    USB_CONFIGURATION_DESCRIPTOR_TYPE,              /* bDescriptorType */
+    CDC_CONFIG_DESCR_LENGTH,                        /* wTotalLength LSB */
+    0x00u,                                          /* wTotalLength MSB */
+    0x02u,                                          /* bNumInterfaces */
+    0x01u,                                          /* bConfigurationValue */
+    0x00u,                                          /* iConfiguration */
+    0xC0u,                                          /* bmAttributes */
+    0x32u,                                          /* bMaxPower */
+    /*------------------- Interface Association Descriptor -------------------*/
+    USB_STD_IA_DESCR_LEN,                           /* bLength */
+    USB_INTERFACE_ASSOCIATION_DESCRIPTOR_TYPE,      /* bDescriptorType */
+    CDC_COMM_INTERFACE_NUM,                         /* bFirstInterface */
+    0x02u,                                          /* bInterfaceCount */
+    USB_CLASS_CODE_CDC,                             /* bFunctionClass */
+    USB_CLASS_CDC_SUBCLASS_ACM,                     /* bFunctionSubClass */
+    0x00u,                                          /* bFunctionProtocol */
+    0x00u,                                          /* iFunction */
+    /*-------------------- Communication Interface Descriptor -----------------*/
+    USB_STD_INTERFACE_DESCR_LEN,                    /* bLength */
+    USB_INTERFACE_DESCRIPTOR_TYPE,                  /* bDescriptorType */
+    CDC_COMM_INTERFACE_NUM,                         /* bInterfaceNumber */
+    0x00u,                                          /* bAlternateSetting */
+    0x01u,                                          /* bNumEndpoints */
+    USB_CLASS_CODE_CDC,                             /* bInterfaceClass */
+    USB_CLASS_CDC_SUBCLASS_ACM,                     /* bInterfaceSubClass */
+    0x00u,                                          /* bInterfaceProtocol */
+    0x00u,                                          /* iInterface */
+    /*---------------------- Header Functional Descriptor --------------------*/
+    0x05u,                                          /* bFunctionLength */
+    USB_CDC_CS_INTERFACE_DESCRIPTOR_TYPE,           /* bDescriptorType */
+    0x00u,                                          /* bDescriptorSubtype */
+    0x10u,                                          /* bcdCDC LSB */
+    0x01u,                                          /* bcdCDC MSB */
+    /*----------------- Call Management Functional Descriptor ----------------*/
+    0x05u,                                          /* bFunctionLength */
+    USB_CDC_CS_INTERFACE_DESCRIPTOR_TYPE,           /* bDescriptorType */
+    0x01u,                                          /* bDescriptorSubtype */
+    0x00u,                                          /* bmCapabilities */
+    CDC_DATA_INTERFACE_NUM,                         /* bDataInterface */
+    /*------------------------ ACM Functional Descriptor ---------------------*/
+    0x04u,                                          /* bFunctionLength */
+    USB_CDC_CS_INTERFACE_DESCRIPTOR_TYPE,           /* bDescriptorType */
+    0x02u,                                          /* bDescriptorSubtype */
+    0x02u,                                          /* bmCapabilities */
+    /*----------------------- Union Functional Descriptor --------------------*/
+    0x05u,                                          /* bFunctionLength */
+    USB_CDC_CS_INTERFACE_DESCRIPTOR_TYPE,           /* bDescriptorType */
+    0x06u,                                          /* bDescriptorSubtype */
+    CDC_COMM_INTERFACE_NUM,                         /* bControlInterface */
+    CDC_DATA_INTERFACE_NUM,                         /* bSubordinateInterface0 */
+    /*-------------------- Notification Endpoint Descriptor ------------------*/
+    USB_STD_ENDPOINT_DESCR_LEN,                     /* bLength */
+    USB_ENDPOINT_DESCRIPTOR_TYPE,                   /* bDescriptorType */
+    (0x80u | CDC_INTR_TX_EP),                       /* bEndpointAddress */
+    USB_EP_DESCR_ATTR_INTR,                         /* bmAttributes */
+    CDC_INTR_TX_EP_MAX_PKT_SIZE,                    /* wMaxPacketSize LSB */
+    0x00u,                                          /* wMaxPacketSize MSB */
+    0xFFu,                                          /* bInterval */
+    /*------------------------ Data Interface Descriptor ---------------------*/
+    USB_STD_INTERFACE_DESCR_LEN,                    /* bLength */
+    USB_INTERFACE_DESCRIPTOR_TYPE,                  /* bDescriptorType */
+    CDC_DATA_INTERFACE_NUM,                         /* bInterfaceNumber */
+    0x00u,                                          /* bAlternateSetting */
+    0x02u,                                          /* bNumEndpoints */
+    USB_CLASS_CODE_CDC_DATA,                        /* bInterfaceClass */
+    0x00u,                                          /* bInterfaceSubClass */
+    0x00u,                                          /* bInterfaceProtocol */
+    0x00u,                                          /* iInterface */
+    /*------------------------- IN Endpoint Descriptor -----------------------*/
+    USB_STD_ENDPOINT_DESCR_LEN,                     /* bLength */
+    USB_ENDPOINT_DESCRIPTOR_TYPE,                   /* bDescriptorType */
+    (0x80u | CDC_BULK_TX_EP),                       /* bEndpointAddress */
+    USB_EP_DESCR_ATTR_BULK,                         /* bmAttributes */
+    0x40u,                                          /* wMaxPacketSize LSB */
+    0x00u,                                          /* wMaxPacketSize MSB */
+    0x00u,                                          /* bInterval */
+    /*------------------------- OUT Endpoint Descriptor ----------------------*/
+    USB_STD_ENDPOINT_DESCR_LEN,                     /* bLength */
+    USB_ENDPOINT_DESCRIPTOR_TYPE,                   /* bDescriptorType */
+    CDC_BULK_RX_EP,                                 /* bEndpointAddress */
+    USB_EP_DESCR_ATTR_BULK,                         /* bmAttributes */
+    0x40u,                                          /* wMaxPacketSize LSB */
+    0x00u,                                          /* wMaxPacketSize MSB */
+    0x00u                                           /* bInterval */
+};
+
+uint8_t cdc_hs_conf_descr[CDC_CONFIG_DESCR_LENGTH] =
+{
+    /*----------------------- Configuration Descriptor -----------------------*/
+    USB_STD_CONFIG_DESCR_LEN,                       /* bLength */
+    USB_CONFIGURATION_DESCRIPTOR_TYPE,              /* bDescriptorType */
+    CDC_CONFIG_DESCR_LENGTH,                        /* wTotalLength LSB */
+    0x00u,                                          /* wTotalLength MSB */
+    0x02u,                                          /* bNumInterfaces */
+    0x01u,                                          /* bConfigurationValue */
+    0x00u,                                          /* iConfiguration */
+    0xC0u,                                          /* bmAttributes */
+    0x32u,                                          /* bMaxPower */
+    /*------------------- Interface Association Descriptor -------------------*/
+    USB_STD_IA_DESCR_LEN,                           /* bLength */
+    USB_INTERFACE_ASSOCIATION_DESCRIPTOR_TYPE,      /* bDescriptorType */
+    CDC_COMM_INTERFACE_NUM,                         /* bFirstInterface */
+    0x02u,                                          /* bInterfaceCount */
+    USB_CLASS_CODE_CDC,                             /* bFunctionClass */
+    USB_CLASS_CDC_SUBCLASS_ACM,                     /* bFunctionSubClass */
+    0x00u,                                          /* bFunctionProtocol */
+    0x00u,                                          /* iFunction */
+    /*-------------------- Communication Interface Descriptor -----------------*/
+    USB_STD_INTERFACE_DESCR_LEN,                    /* bLength */
+    USB_INTERFACE_DESCRIPTOR_TYPE,                  /* bDescriptorType */
+    CDC_COMM_INTERFACE_NUM,                         /* bInterfaceNumber */
+    0x00u,                                          /* bAlternateSetting */
+    0x01u,                                          /* bNumEndpoints */
+    USB_CLASS_CODE_CDC,                             /* bInterfaceClass */
+    USB_CLASS_CDC_SUBCLASS_ACM,                     /* bInterfaceSubClass */
+    0x00u,                                          /* bInterfaceProtocol */
+    0x00u,                                          /* iInterface */
+    /*---------------------- Header Functional Descriptor --------------------*/
+    0x05u,                                          /* bFunctionLength */
+    USB_CDC_CS_INTERFACE_DESCRIPTOR_TYPE,           /* bDescriptorType */
+    0x00u,                                          /* bDescriptorSubtype */
+    0x10u,                                          /* bcdCDC LSB */
+    0x01u,                                          /* bcdCDC MSB */
+    /*----------------- Call Management Functional Descriptor ----------------*/
+    0x05u,                                          /* bFunctionLength */
+    USB_CDC_CS_INTERFACE_DESCRIPTOR_TYPE,           /* bDescriptorType */
+    0x01u,                                          /* bDescriptorSubtype */
+    0x00u,                                          /* bmCapabilities */
+    CDC_DATA_INTERFACE_NUM,                         /* bDataInterface */
+    /*------------------------ ACM Functional Descriptor ---------------------*/
+    0x04u,                                          /* bFunctionLength */
+    USB_CDC_CS_INTERFACE_DESCRIPTOR_TYPE,           /* bDescriptorType */
+    0x02u,                                          /* bDescriptorSubtype */
+    0x02u,                                          /* bmCapabilities */
+    /*----------------------- Union Functional Descriptor --------------------*/
+    0x05u,                                          /* bFunctionLength */
+    USB_CDC_CS_INTERFACE_DESCRIPTOR_TYPE,           /* bDescriptorType */
+    0x06u,                                          /* bDescriptorSubtype */
+    CDC_COMM_INTERFACE_NUM,                         /* bControlInterface */
+    CDC_DATA_INTERFACE_NUM,                         /* bSubordinateInterface0 */
+    /*-------------------- Notification Endpoint Descriptor ------------------*/
+    USB_STD_ENDPOINT_DESCR_LEN,                     /* bLength */
+    USB_ENDPOINT_DESCRIPTOR_TYPE,                   /* bDescriptorType */
+    (0x80u | CDC_INTR_TX_EP),                       /* bEndpointAddress */
+    USB_EP_DESCR_ATTR_INTR,                         /* bmAttributes */
+    CDC_INTR_TX_EP_MAX_PKT_SIZE,                    /* wMaxPacketSize LSB */
+    0x00u,                                          /* wMaxPacketSize MSB */
+    0x10u,                                          /* bInterval */
+    /*------------------------ Data Interface Descriptor ---------------------*/
+    USB_STD_INTERFACE_DESCR_LEN,                    /* bLength */
+    USB_INTERFACE_DESCRIPTOR_TYPE,                  /* bDescriptorType */
+    CDC_DATA_INTERFACE_NUM,                         /* bInterfaceNumber */
+    0x00u,                                          /* bAlternateSetting */
+    0x02u,                                          /* bNumEndpoints */
+    USB_CLASS_CODE_CDC_DATA,                        /* bInterfaceClass */
+    0x00u,                                          /* bInterfaceSubClass */
+    0x00u,                                          /* bInterfaceProtocol */
+    0x00u,                                          /* iInterface */
+    /*------------------------- IN Endpoint Descriptor -----------------------*/
+    USB_STD_ENDPOINT_DESCR_LEN,                     /* bLength */
+    USB_ENDPOINT_DESCRIPTOR_TYPE,                   /* bDescriptorType */
+    (0x80u | CDC_BULK_TX_EP),                       /* bEndpointAddress */
+    USB_EP_DESCR_ATTR_BULK,                         /* bmAttributes */
+    0x00u,                                          /* wMaxPacketSize LSB */
+    0x02u,                                          /* wMaxPacketSize MSB */
+    0x00u,                                          /* bInterval */
+    /*------------------------- OUT Endpoint Descriptor ----------------------*/
+    USB_STD_ENDPOINT_DESCR_LEN,                     /* bLength */
+    USB_ENDPOINT_DESCRIPTOR_TYPE,                   /* bDescriptorType */
+    CDC_BULK_RX_EP,                                 /* bEndpointAddress */
+    USB_EP_DESCR_ATTR_BULK,                         /* bmAttributes */
+    0x00u,                                          /* wMaxPacketSize LSB */
+    0x02u,                                          /* wMaxPacketSize MSB */
+    0x00u                                           /* bInterval */
+};
+
+/***************************************************************************//**
+ * See mss_usb_device_cdc.h for details of how to use this function.
+ */
+void
+MSS_USBD_CDC_init
+(
+    const mss_usbd_cdc_cb_t* app_cb,
+    uint8_t* tx_ring,
+    uint32_t tx_ring_size,
+    mss_usb_device_speed_t speed
+)
+{
+    ASSERT(0u == ((uintptr_t)tx_ring & 0x3u));
+    ASSERT((tx_ring_size >= 64u) && (0u == (tx_ring_size & (tx_ring_size - 1u))));
+
+    g_usbd_cdc_app_cb = app_cb;
+    g_usbd_cdc_user_speed = speed;
+    g_tx_ring = tx_ring;
+    g_tx_ring_size = tx_ring_size;
+
+    MSS_USBD_set_class_cb_handler(&usbd_cdc_class_cb);
+}
+
+/***************************************************************************//**
+ * See mss_usb_device_cdc.h for details of how to use this function.
+ */
+mss_usbd_cdc_state_t
+MSS_USBD_CDC_get_state
+(
+    void
+)
+{
+    return g_usbd_cdc_state;
+}
+
+/***************************************************************************//**
+ * See mss_usb_device_cdc.h for details of how to use this function.
+ */
+void
+MSS_USBD_CDC_get_line_coding
+(
+    mss_usbd_cdc_line_coding_t* coding
+)
+{
+    uint64_t saved;
+
+    saved = disable_interrupts();
+    *coding = g_line_coding;
+    restore_interrupts(saved);
+}
+
+/***************************************************************************//**
+ * See mss_usb_device_cdc.h for details of how to use this function.
+ */
+uint16_t
+MSS_USBD_CDC_get_control_line
+(
+    void
+)
+{
+    return g_control_line;
+}
+
+/***************************************************************************//**
+ * See mss_usb_device_cdc.h for details of how to use this function.
+ */
+uint32_t
+MSS_USBD_CDC_write
+(
+    const uint8_t* buf,
+    uint32_t length
+)
+{
+    uint64_t saved;
+    uint32_t result = 0u;
+    uint32_t offset;
+    uint32_t first;
+
+    saved = disable_interrupts();
+
+    if((USBD_CDC_CONFIGURED == g_usbd_cdc_state) && (0u != length) &&
+       (length <= (g_tx_ring_size - (g_tx_head - g_tx_tail))))
+    {
+        offset = g_tx_head & (g_tx_ring_size - 1u);
+        first = g_tx_ring_size - offset;
+        if(first > length)
+        {
+            first = length;
+        }
+
+        memcpy(&g_tx_ring[offset], buf, first);
+        memcpy(g_tx_ring, &buf[first], length - first);
+        g_tx_head += length;
+
+        usbd_cdc_tx_start();
+        result = length;
+    }
+
+    restore_interrupts(saved);
+
+    return result;
+}
+
+/***************************************************************************//**
+ * See mss_usb_device_cdc.h for details of how to use this function.
+ */
+uint32_t
+MSS_USBD_CDC_tx_space
+(
+    void
+)
+{
+    uint32_t space = 0u;
+
+    if(USBD_CDC_CONFIGURED == g_usbd_cdc_state)
+    {
+        space = g_tx_ring_size - (g_tx_head - g_tx_tail);
+    }
+
+    return space;
+}
+
+/***************************************************************************//**
+ * See mss_usb_device_cdc.h for details of how to use this function.
+ */
+uint32_t
+MSS_USBD_CDC_read
+(
+    uint8_t* buf,
+    uint32_t length
+)
+{
+    uint64_t saved;
+    uint32_t copied = 0u;
+    uint32_t count;
+    uint32_t idx;
+
+    saved = disable_interrupts();
+
+    while((copied < length) && (0u != g_rx_filled))
+    {
+        idx = g_rx_read_idx;
+        count = g_rx_len[idx] - g_rx_read_offset;
+        if(count > (length - copied))
+        {
+            count = length - copied;
+        }
+
+        memcpy(&buf[copied], &g_rx_buf[idx][g_rx_read_offset], count);
+        copied += count;
+        g_rx_read_offset += count;
+
+        /* Buffer emptied, back to the endpoint */
+        if(g_rx_read_offset == g_rx_len[idx])
+        {
+            g_rx_read_offset = 0u;
+            g_rx_read_idx = (idx + 1u) % CDC_RX_BUFFER_COUNT;
+            g_rx_filled--;
+            usbd_cdc_rx_start();
+        }
+    }
+
+    restore_interrupts(saved);
+
+    return copied;
+}
+
+/***************************************************************************//**
+ usbd_cdc_tx_start() function starts sending the data of the transmit ring
+ when no transfer is in progress: all of it, or up to the end of the ring when
+ it wraps. A transfer ending at an unaligned head moves the head up to the
+ next word so that the next transfer starts word aligned. Called with the
+ interrupts disabled or from the USB interrupt.
+ */
+static void
+usbd_cdc_tx_start
+(
+    void
+)
+{
+    uint32_t offset;
+    uint32_t length;
+
+    if((0u == g_tx_busy) && (g_tx_head != g_tx_tail) &&
+       (USBD_CDC_CONFIGURED == g_usbd_cdc_state))
+    {
+        offset = g_tx_tail & (g_tx_ring_size - 1u);
+        length = g_tx_head - g_tx_tail;
+        if(length > (g_tx_ring_size - offset))
+        {
+            length = g_tx_ring_size - offset;
+        }
+        else
+        {
+            g_tx_head = (g_tx_head + 3u) & ~3u;
+        }
+
+        g_tx_xfr_advance = (length + 3u) & ~3u;
+        g_tx_busy = 1u;
+
+        MSS_USBD_tx_ep_write(CDC_BULK_TX_EP, &g_tx_ring[offset], length);
+    }
+}
+
+/***************************************************************************//**
+ usbd_cdc_rx_start() function gives the next free receive buffer to the
+ endpoint when it has none. Called with the interrupts disabled or from the USB
+ interrupt.
+ */
+static void
+usbd_cdc_rx_start
+(
+    void
+)
+{
+    if((0u == g_rx_busy) && (g_rx_filled < CDC_RX_BUFFER_COUNT) &&
+       (USBD_CDC_CONFIGURED == g_usbd_cdc_state))
+    {
+        g_rx_busy = 1u;
+        MSS_USBD_rx_ep_read_prepare(CDC_BULK_RX_EP,
+                                    g_rx_buf[g_rx_fill_idx],
+                                    CDC_RX_BUFFER_SIZE);
+    }
+}
+
+/***************************************************************************//**
+ returns the configuration descriptor requested by Host.
+ */
+static uint8_t*
+usbd_cdc_get_descriptor_cb
+(
+    uint8_t recepient,
+    uint8_t type,
+    uint32_t* length,
+    mss_usb_device_speed_t musb_speed
+)
+{
+    uint8_t* conf_desc = 0;
+    uint8_t* os_conf_desc = 0;
+
+    /*User Selected FS:
+        Operate only in FS
+      User Selected HS:
+        Device connected to 2.0 Host(musb_speed = HS):Operate in HS
+        Device connected to 1.x Host(musb_speed = FS):Operate in FS
+    */
+    if(MSS_USB_DEVICE_FS == g_usbd_cdc_user_speed)
+    {
+        conf_desc = cdc_fs_conf_descr;
+        os_conf_desc = 0;
+    }
+    else if(MSS_USB_DEVICE_HS == musb_speed)
+    {
+        conf_desc = cdc_hs_conf_descr;
+        os_conf_desc = cdc_fs_conf_descr;
+    }
+    else
+    {
+        conf_desc = cdc_fs_conf_descr;
+        os_conf_desc = cdc_hs_conf_descr;
+    }
+
+    if(USB_STD_REQ_RECIPIENT_DEVICE == recepient)
+    {
+        if(USB_CONFIGURATION_DESCRIPTOR_TYPE == type)
+        {
+            conf_desc[CDC_CONF_DESCR_DESCTYPE_IDX] =
+                                            USB_CONFIGURATION_DESCRIPTOR_TYPE;
+            *length = CDC_CONFIG_DESCR_LENGTH;
+            return(conf_desc);
+        }
+        else if((USB_OTHER_SPEED_CONFIG_DESCRIPTOR_TYPE == type) &&
+                (0 != os_conf_desc))
+        {
+            os_conf_desc[CDC_CONF_DESCR_DESCTYPE_IDX] =
+                                        USB_OTHER_SPEED_CONFIG_DESCRIPTOR_TYPE;
+            *length = CDC_CONFIG_DESCR_LENGTH;
+            return(os_conf_desc);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return USB_FAIL;
+}
+
+/***************************************************************************//**
+ usbd_cdc_init_cb() call-back is called by USB Device mode driver on receiving
+ SET_CONFIGURATION command. Both bulk endpoints are configured to use the MSS
+ USB DMA. The notification endpoint is configured but not used: the host polls
+ it and gets NAKs.
+ */
+static uint8_t
+usbd_cdc_init_cb
+(
+    uint8_t cfgidx,
+    mss_usb_device_speed_t musb_speed
+)
+{
+    uint8_t* conf_desc = cdc_fs_conf_descr;
+    uint16_t bulk_txep_maxpktsz;
+    uint16_t bulk_rxep_maxpktsz;
+
+    if(MSS_USB_DEVICE_HS == musb_speed)
+    {
+        conf_desc = cdc_hs_conf_descr;
+    }
+
+    bulk_txep_maxpktsz =
+            (uint16_t)((conf_desc[CDC_CONF_DESCR_TX_MAXPKT_IDX + 1u] << 8u) |
+                       conf_desc[CDC_CONF_DESCR_TX_MAXPKT_IDX]);
+    bulk_rxep_maxpktsz =
+            (uint16_t)((conf_desc[CDC_CONF_DESCR_RX_MAXPKT_IDX + 1u] << 8u) |
+                       conf_desc[CDC_CONF_DESCR_RX_MAXPKT_IDX]);
+
+    g_tx_head = 0u;
+    g_tx_tail = 0u;
+    g_tx_busy = 0u;
+    g_rx_fill_idx = 0u;
+    g_rx_read_idx = 0u;
+    g_rx_read_offset = 0u;
+    g_rx_filled = 0u;
+    g_rx_busy = 0u;
+    g_control_line = 0u;
+
+    MSS_USBD_rx_ep_configure(CDC_BULK_RX_EP,
+                             CDC_BULK_RX_EP_FIFO_ADDR,
+                             CDC_BULK_EP_FIFO_SIZE,
+                             bulk_rxep_maxpktsz,
+                             1u,
+                             DMA_ENABLE,
+                             CDC_BULK_RX_EP_DMA_CHANNEL,
+                             MSS_USB_XFR_BULK,
+                             NO_ZLP_TO_XFR);
+
+    MSS_USBD_tx_ep_configure(CDC_BULK_TX_EP,
+                             CDC_BULK_TX_EP_FIFO_ADDR,
+                             CDC_BULK_EP_FIFO_SIZE,
+                             bulk_txep_maxpktsz,
+                             1u,
+                             DMA_ENABLE,
+                             CDC_BULK_TX_EP_DMA_CHANNEL,
+                             MSS_USB_XFR_BULK,
+                             ADD_ZLP_TO_XFR);
+
+    MSS_USBD_tx_ep_configure(CDC_INTR_TX_EP,
+                             CDC_INTR_TX_EP_FIFO_ADDR,
+                             CDC_INTR_TX_EP_FIFO_SIZE,
+                             CDC_INTR_TX_EP_MAX_PKT_SIZE,
+                             1u,
+                             DMA_DISABLE,
+                             MSS_USB_DMA_CHANNEL_NA,
+                             MSS_USB_XFR_INTERRUPT,
+                             NO_ZLP_TO_XFR);
+
+    g_usbd_cdc_state = USBD_CDC_CONFIGURED;
+
+    usbd_cdc_rx_start();
+
+    if((0 != g_usbd_cdc_app_cb) && (0 != g_usbd_cdc_app_cb->cdc_configured))
+    {
+        g_usbd_cdc_app_cb->cdc_configured();
+    }
+
+    return USB_SUCCESS;
+}
+
+/***************************************************************************//**
+ usbd_cdc_release_cb() call-back is called by USB Device mode driver on
+ receiving a command to clear the configuration or on disconnect.
+ */
+static uint8_t
+usbd_cdc_release_cb
+(
+    uint8_t cfgidx
+)
+{
+    g_usbd_cdc_state = USBD_CDC_NOT_CONFIGURED;
+
+    MSS_USB_CIF_tx_ep_disable_irq(CDC_BULK_TX_EP);
+    MSS_USB_CIF_tx_ep_clr_csrreg(CDC_BULK_TX_EP);
+    MSS_USB_CIF_dma_clr_ctrlreg(CDC_BULK_TX_EP_DMA_CHANNEL);
+
+    MSS_USB_CIF_rx_ep_disable_irq(CDC_BULK_RX_EP);
+    MSS_USB_CIF_rx_ep_clr_csrreg(CDC_BULK_RX_EP);
+    MSS_USB_CIF_dma_clr_ctrlreg(CDC_BULK_RX_EP_DMA_CHANNEL);
+
+    MSS_USB_CIF_tx_ep_disable_irq(CDC_INTR_TX_EP);
+    MSS_USB_CIF_tx_ep_clr_csrreg(CDC_INTR_TX_EP);
+
+    g_tx_tail = g_tx_head;
+    g_tx_busy = 0u;
+    g_rx_filled = 0u;
+    g_rx_busy = 0u;
+    g_control_line = 0u;
+
+    if((0 != g_usbd_cdc_app_cb) && (0 != g_usbd_cdc_app_cb->cdc_released))
+    {
+        g_usbd_cdc_app_cb->cdc_released();
+    }
+
+    return USB_SUCCESS;
+}
+
+/***************************************************************************//**
+ usbd_cdc_process_request_cb() call-back function processes the CDC ACM
+ requests received on the control endpoint.
+ */
+static uint8_t
+usbd_cdc_process_request_cb
+(
+    mss_usbd_setup_pkt_t* setup_pkt,
+    uint8_t** buf_pp,
+    uint32_t* length
+)
+{
+    uint8_t result = USB_FAIL;
+
+    if((USB_CLASS_REQUEST == (setup_pkt->request_type & USB_STD_REQ_TYPE_MASK)) &&
+       (CDC_COMM_INTERFACE_NUM == setup_pkt->index))
+    {
+        switch(setup_pkt->request)
+        {
+            case USB_CDC_SET_LINE_CODING:
+                *buf_pp = (uint8_t*)&g_line_coding_rx;
+                *length = CDC_LINE_CODING_LENGTH;
+                result = USB_SUCCESS;
+            break;
+
+            case USB_CDC_GET_LINE_CODING:
+                *buf_pp = (uint8_t*)&g_line_coding;
+                *length = CDC_LINE_CODING_LENGTH;
+                result = USB_SUCCESS;
+            break;
+
+            case USB_CDC_SET_CONTROL_LINE_STATE:
+                g_control_line = setup_pkt->value;
+                if((0 != g_usbd_cdc_app_cb) &&
+                   (0 != g_usbd_cdc_app_cb->cdc_control_line))
+                {
+                    g_usbd_cdc_app_cb->cdc_control_line(setup_pkt->value);
+                }
+                result = USB_SUCCESS;
+            break;
+
+            case USB_CDC_SEND_BREAK:
+                result = USB_SUCCESS;
+            break;
+
+            default:
+                /*Stall the request*/
+            break;
+        }
+    }
+
+    return result;
+}
+
+/***************************************************************************//**
+ usbd_cdc_cep_rx_done_cb() call-back function is called by USB Device mode
+ driver when the data stage of a request has been received, here the line
+ coding of SET_LINE_CODING.
+ */
+static uint8_t
+usbd_cdc_cep_rx_done_cb
+(
+    uint8_t status
+)
+{
+    if(0u == status)
+    {
+        g_line_coding = g_line_coding_rx;
+
+        if((0 != g_usbd_cdc_app_cb) && (0 != g_usbd_cdc_app_cb->cdc_line_coding))
+        {
+            g_usbd_cdc_app_cb->cdc_line_coding(&g_line_coding);
+        }
+    }
+
+    return USB_SUCCESS;
+}
+
+/***************************************************************************//**
+ usbd_cdc_tx_complete_cb() call-back function is called by USB Device mode
+ driver on completion of the IN transfer. The data is dropped on an error, so
+ that a host which stalls the endpoint does not hold up the ring.
+ */
+static uint8_t
+usbd_cdc_tx_complete_cb
+(
+    mss_usb_ep_num_t num,
+    uint8_t status
+)
+{
+    if((CDC_BULK_TX_EP == num) && (1u == g_tx_busy))
+    {
+        if(status & (TX_EP_UNDER_RUN_ERROR | TX_EP_STALL_ERROR))
+        {
+            MSS_USBD_tx_ep_flush_fifo(CDC_BULK_TX_EP);
+        }
+
+        g_tx_tail += g_tx_xfr_advance;
+        g_tx_busy = 0u;
+
+        usbd_cdc_tx_start();
+
+        if((0 != g_usbd_cdc_app_cb) && (0 != g_usbd_cdc_app_cb->cdc_tx_space))
+        {
+            g_usbd_cdc_app_cb->cdc_tx_space();
+        }
+    }
+
+    return USB_SUCCESS;
+}
+
+/***************************************************************************//**
+ usbd_cdc_rx_cb() call-back function is called by USB Device mode driver when
+ the active receive buffer is full or a short packet was received. The next
+ free buffer is given to the endpoint before the application is told.
+ */
+static uint8_t
+usbd_cdc_rx_cb
+(
+    mss_usb_ep_num_t num,
+    uint8_t status,
+    uint32_t rx_count
+)
+{
+    uint8_t received = 0u;
+
+    if((CDC_BULK_RX_EP == num) && (1u == g_rx_busy))
+    {
+        g_rx_busy = 0u;
+
+        if((0u == (status & (RX_EP_OVER_RUN_ERROR | RX_EP_STALL_ERROR |
+                             RX_EP_DATA_ERROR | RX_EP_PID_ERROR |
+                             RX_EP_ISO_INCOMP_ERROR))) &&
+           (0u != rx_count))
+        {
+            g_rx_len[g_rx_fill_idx] = rx_count;
+            g_rx_fill_idx = (g_rx_fill_idx + 1u) % CDC_RX_BUFFER_COUNT;
+            g_rx_filled++;
+            received = 1u;
+        }
+
+        usbd_cdc_rx_start();
+
+        if((1u == received) && (0 != g_usbd_cdc_app_cb) &&
+           (0 != g_usbd_cdc_app_cb->cdc_rx))
+        {
+            g_usbd_cdc_app_cb->cdc_rx();
+        }
+    }
+
+    return USB_SUCCESS;
+}
+
+#endif  //MSS_USB_DEVICE_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
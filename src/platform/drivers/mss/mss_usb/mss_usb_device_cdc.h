@@ -0,0 +1,428 @@
+/*******************************************************************************
+ * Copyright 2019-2020 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * PolarFire SoC MSS USB Driver Stack
+ *      USB Logical Layer (USB-LL)
+ *          USBD-CDC class driver.
+ *
+ *  USBD-CDC class driver public API.
+ *
+ */
+
+/*=========================================================================*//**
+  @mainpage PolarFire SoC MSS USB driver (USBD-CDC)
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The CDC class device driver implements a USB virtual serial port of the
+  Abstract Control Model (ACM) sub-class, which the host operating systems
+  support without a vendor driver: it appears as /dev/ttyACMx on Linux and as a
+  COM port on Windows. It is meant for a console and for streaming data at USB
+  High Speed rates, well beyond those of an MSS UART.
+
+  This driver uses the USBD-Class driver template to implement the device.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  The following steps are involved in the operation of the USBD-CDC driver:
+    - Configuration
+    - Initialization
+    - Enumeration
+    - Class Specific requests
+    - Data transfer
+
+  --------------------------------
+  Configuration
+  --------------------------------
+  To use this driver, the MSS USB driver must first be configured in the USB
+  device mode using the MSS_USB_PERIPHERAL_MODE. No other configuration is
+  necessary.
+
+  --------------------------------
+  Initialization
+  --------------------------------
+  The CDC class driver must be initialized using the MSS_USBD_CDC_init()
+  function, which also gives it the transmit ring. Once initialized, this
+  driver gets configured by the USBD driver during the enumeration process. The
+  usbd_cdc_init_cb() call-back function is called by the USBD driver when the
+  host configures this device, and then calls the cdc_configured call-back
+  function of the application.
+
+  Note: For successful enumeration, the device specific descriptors must also be
+  provided by the application using the MSS_USBD_set_desc_cb_handler()
+  function to the USBD Driver. The configuration descriptor holds an interface
+  association descriptor, so the device descriptor should use bDeviceClass
+  0xEF, bDeviceSubClass 0x02 and bDeviceProtocol 0x01.
+
+  --------------------------------
+  Class Specific requests
+  --------------------------------
+  The driver handles the SET_LINE_CODING, GET_LINE_CODING and
+  SET_CONTROL_LINE_STATE requests. The line coding has no effect on the
+  transfers, it is kept for the host and passed on to the cdc_line_coding
+  call-back function of the application, for example to set up a UART bridge.
+  The DTR and RTS signals set by the host are passed on to the
+  cdc_control_line call-back function; most terminal programs set DTR while
+  the port is open. Other requests are stalled.
+
+  --------------------------------
+  Data transfer
+  --------------------------------
+  Data to be sent to the host is copied into the transmit ring by
+  MSS_USBD_CDC_write(), which never waits. The MSS USB DMA sends the data
+  straight from the ring: while a transfer is in progress further writes are
+  gathered in the ring, and the interrupt handler sends all of them in the next
+  transfer, so the number of transfers drops as the data rate rises. The MSS
+  USB DMA only reads from word aligned addresses, so when a transfer ends part
+  way through a word, up to three bytes of the ring are left unused after it.
+
+  Data from the host is received by the MSS USB DMA into
+  CDC_RX_BUFFER_COUNT buffers of CDC_RX_BUFFER_SIZE bytes. A buffer holds one
+  USB transfer, up to its size. MSS_USBD_CDC_read() copies the received data
+  out of the buffers, and each buffer emptied is given back to the endpoint.
+  When all buffers are full the host is held off with NAKs, so no data is lost.
+
+  MSS_USBD_CDC_write() and MSS_USBD_CDC_read() disable the interrupts for the
+  time of the copy. They must be called from the hart which handles the MSS USB
+  interrupts. MSS_USBD_CDC_tx_space() and MSS_USBD_CDC_write() have the form of
+  the space and write functions of mss_uart_log_sink_t, so the MSS UART log
+  channel can be drained to this driver, see MSS_UART_log_drain_sink().
+
+ *//*=========================================================================*/
+
+#ifndef __MSS_USB_DEVICE_CDC_H_
+#define __MSS_USB_DEVICE_CDC_H_
+
+#include <stdint.h>
+#include "mss_usb_device.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MSS_USB_DEVICE_ENABLED
+/*******************************************************************************
+ USBD-CDC configuration definitions: These values will be used by the CDC class
+ driver to configure the MSS USB core endpoints.
+
+ Note:
+ The bulk FIFOs are twice the High Speed maximum packet size so the MSS USB
+ core double buffers the packets. They must not overlap the FIFOs of the
+ control endpoint or of other endpoints used by the application.
+ */
+#define CDC_BULK_TX_EP                                  MSS_USB_TX_EP_1
+#define CDC_BULK_RX_EP                                  MSS_USB_RX_EP_1
+#define CDC_INTR_TX_EP                                  MSS_USB_TX_EP_2
+
+#define CDC_BULK_RX_EP_FIFO_ADDR                        0x100u
+#define CDC_BULK_TX_EP_FIFO_ADDR                        0x500u
+#define CDC_BULK_EP_FIFO_SIZE                           1024u
+#define CDC_INTR_TX_EP_FIFO_ADDR                        0x900u
+#define CDC_INTR_TX_EP_FIFO_SIZE                        64u
+#define CDC_INTR_TX_EP_MAX_PKT_SIZE                     16u
+
+#define CDC_BULK_TX_EP_DMA_CHANNEL                      MSS_USB_DMA_CHANNEL2
+#define CDC_BULK_RX_EP_DMA_CHANNEL                      MSS_USB_DMA_CHANNEL1
+
+/* Receive buffers, the size is a multiple of the High Speed packet size */
+#ifndef CDC_RX_BUFFER_COUNT
+#define CDC_RX_BUFFER_COUNT                             4u
+#endif
+
+#ifndef CDC_RX_BUFFER_SIZE
+#define CDC_RX_BUFFER_SIZE                              512u
+#endif
+
+/* Full configuration descriptor length */
+#define CDC_CONFIG_DESCR_LENGTH                     (USB_STD_CONFIG_DESCR_LEN + \
+                                                     USB_STD_IA_DESCR_LEN + \
+                                                     USB_STD_INTERFACE_DESCR_LEN + \
+                                                     5u + 5u + 4u + 5u + \
+                                                     USB_STD_ENDPOINT_DESCR_LEN + \
+                                                     USB_STD_INTERFACE_DESCR_LEN + \
+                                                     USB_STD_ENDPOINT_DESCR_LEN + \
+                                                     USB_STD_ENDPOINT_DESCR_LEN )
+
+/* Bits of the control line state set by the host */
+#define USBD_CDC_CONTROL_LINE_DTR                       0x01u
+#define USBD_CDC_CONTROL_LINE_RTS                       0x02u
+
+/***************************************************************************//**
+ Exported Types from USBD-CDC class driver
+ */
+/***************************************************************************//**
+  mss_usbd_cdc_state_t
+  The mss_usbd_cdc_state_t provides a type to identify the current state of the
+  CDC class driver.
+    USBD_CDC_NOT_CONFIGURED - The driver is not configured and it cannot
+                              perform data transfers.
+    USBD_CDC_CONFIGURED     - The driver is configured by the host and it can
+                              perform data transfers.
+*/
+typedef enum mss_usbd_cdc_state {
+    USBD_CDC_NOT_CONFIGURED,
+    USBD_CDC_CONFIGURED
+} mss_usbd_cdc_state_t;
+
+/***************************************************************************//**
+  mss_usbd_cdc_line_coding_t
+  The mss_usbd_cdc_line_coding_t type is the line coding set by the host, in
+  the layout of the CDC specification.
+
+  rate
+  The data rate in bits per second.
+
+  stop_bits
+  0: 1 stop bit, 1: 1.5 stop bits, 2: 2 stop bits.
+
+  parity
+  0: none, 1: odd, 2: even, 3: mark, 4: space.
+
+  data_bits
+  5, 6, 7, 8 or 16.
+*/
+typedef struct __attribute__ ((packed)) mss_usbd_cdc_line_coding {
+    uint32_t rate;
+    uint8_t stop_bits;
+    uint8_t parity;
+    uint8_t data_bits;
+} mss_usbd_cdc_line_coding_t;
+
+/***************************************************************************//**
+  mss_usbd_cdc_cb_t
+  The mss_usbd_cdc_cb_t type provides the prototype of the optional call-back
+  functions implemented by the application. They are all called from the
+  interrupt handler.
+
+  cdc_configured
+  Called when the host has configured the device.
+
+  cdc_released
+  Called when the device is un-configured or disconnected. The data in the
+  transmit ring and the receive buffers is discarded.
+
+  cdc_line_coding
+  Called when the host has set the line coding.
+
+  cdc_control_line
+  Called when the host has set the control line state, with
+  USBD_CDC_CONTROL_LINE_DTR and USBD_CDC_CONTROL_LINE_RTS.
+
+  cdc_rx
+  Called when data from the host has been received. MSS_USBD_CDC_read() can be
+  called from this function.
+
+  cdc_tx_space
+  Called when a transfer to the host has completed and made room in the
+  transmit ring.
+*/
+typedef struct mss_usbd_cdc_cb {
+    void (*cdc_configured)(void);
+    void (*cdc_released)(void);
+    void (*cdc_line_coding)(const mss_usbd_cdc_line_coding_t* coding);
+    void (*cdc_control_line)(uint16_t state);
+    void (*cdc_rx)(void);
+    void (*cdc_tx_space)(void);
+} mss_usbd_cdc_cb_t;
+
+/***************************************************************************//**
+ Exported functions from USBD-CDC class driver
+ */
+
+/***************************************************************************//**
+  @brief MSS_USBD_CDC_init()
+  The MSS_USBD_CDC_init() function must be used by the application to
+  initialize the CDC class driver.
+
+  @param app_cb
+  The app_cb parameter is a pointer to the application call-back functions. It
+  can be NULL.
+
+  @param tx_ring
+  The tx_ring parameter is the transmit ring. It must be word aligned and
+  reachable by the MSS USB DMA.
+
+  @param tx_ring_size
+  The tx_ring_size parameter is the size of the transmit ring in bytes, a power
+  of 2 of at least 64 bytes. A few times the High Speed packet size is enough
+  for a console, stream data needs 16 KB or more.
+
+  @param speed
+  The speed parameter indicates the USB speed at which this class driver must
+  operate.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+        static uint8_t g_cdc_tx_ring[16384] __attribute__ ((aligned (4)));
+
+        MSS_USBD_CDC_init(&g_cdc_cb, g_cdc_tx_ring, sizeof(g_cdc_tx_ring),
+                          MSS_USB_DEVICE_HS);
+        MSS_USBD_set_desc_cb_handler(&cdc_descr_cb);
+        MSS_USBD_init(MSS_USB_DEVICE_HS);
+  @endcode
+*/
+void
+MSS_USBD_CDC_init
+(
+    const mss_usbd_cdc_cb_t* app_cb,
+    uint8_t* tx_ring,
+    uint32_t tx_ring_size,
+    mss_usb_device_speed_t speed
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_CDC_get_state()
+  The MSS_USBD_CDC_get_state() function returns the current state of the CDC
+  class driver.
+
+  @param
+    This function does not take a parameter.
+
+  @return
+    This function returns a value of type mss_usbd_cdc_state_t.
+*/
+mss_usbd_cdc_state_t
+MSS_USBD_CDC_get_state
+(
+    void
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_CDC_get_line_coding()
+  The MSS_USBD_CDC_get_line_coding() function returns the line coding last set
+  by the host, 115200 baud 8N1 until it has set one.
+
+  @param coding
+  The coding parameter is a pointer to the structure to fill in.
+
+  @return
+    This function does not return a value.
+*/
+void
+MSS_USBD_CDC_get_line_coding
+(
+    mss_usbd_cdc_line_coding_t* coding
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_CDC_get_control_line()
+  The MSS_USBD_CDC_get_control_line() function returns the control line state
+  last set by the host, with USBD_CDC_CONTROL_LINE_DTR and
+  USBD_CDC_CONTROL_LINE_RTS.
+
+  @param
+    This function does not take a parameter.
+
+  @return
+    This function returns the control line state.
+*/
+uint16_t
+MSS_USBD_CDC_get_control_line
+(
+    void
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_CDC_write()
+  The MSS_USBD_CDC_write() function copies data into the transmit ring and
+  starts sending it when no transfer is in progress. It copies all the data or,
+  if that does not fit in the ring, none of it, so a line or a message is never
+  split. It does not wait.
+
+  @param buf
+  The buf parameter is a pointer to the data.
+
+  @param length
+  The length parameter is the number of bytes to send.
+
+  @return
+    This function returns length, or 0 when the data does not fit in the
+    transmit ring or the device is not configured.
+
+  Example:
+  @code
+        len = snprintf(line, sizeof(line), "%u,%u\r\n", sample_a, sample_b);
+        if(0u == MSS_USBD_CDC_write((const uint8_t*)line, len))
+        {
+            ++g_samples_dropped;
+        }
+  @endcode
+*/
+uint32_t
+MSS_USBD_CDC_write
+(
+    const uint8_t* buf,
+    uint32_t length
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_CDC_tx_space()
+  The MSS_USBD_CDC_tx_space() function returns the number of bytes
+  MSS_USBD_CDC_write() can take straight away.
+
+  @param
+    This function does not take a parameter.
+
+  @return
+    This function returns the free space of the transmit ring in bytes, or 0
+    when the device is not configured.
+*/
+uint32_t
+MSS_USBD_CDC_tx_space
+(
+    void
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_CDC_read()
+  The MSS_USBD_CDC_read() function copies received data into buf.
+
+  @param buf
+  The buf parameter is a pointer to the buffer for the data.
+
+  @param length
+  The length parameter is the size of buf in bytes.
+
+  @return
+    This function returns the number of bytes copied, 0 when no data has been
+    received.
+*/
+uint32_t
+MSS_USBD_CDC_read
+(
+    uint8_t* buf,
+    uint32_t length
+);
+
+#endif  //MSS_USB_DEVICE_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __MSS_USB_DEVICE_CDC_H_ */
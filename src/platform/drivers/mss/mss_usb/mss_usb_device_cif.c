@@ -234,6 +234,10 @@ MSS_USBD_CIF_rx_ep_read_prepare
         /*Make sure that address is Modulo-4.Bits D0-D1 are read only.*/
         ASSERT(!(((uint32_t)device_ep->buf_addr) & 0x00000002));
 
+#ifdef MSS_USB_CACHE_MAINTENANCE
+        mss_l2_flush_range((uint64_t)(uintptr_t)device_ep->buf_addr,
+                           device_ep->xfr_length);
+#endif
         MSS_USB_CIF_dma_write_addr(device_ep->dma_channel,
                                    (uint32_t)device_ep->buf_addr);
 
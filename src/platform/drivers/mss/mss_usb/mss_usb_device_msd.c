@@ -100,6 +100,12 @@ static uint8_t usbd_msc_process_read_10(void);
 static uint8_t usbd_msc_process_write_10(void);
 static uint8_t usbd_msc_process_inquiry(void);
 static uint8_t usbd_msc_process_read_capacity_10(void);
+static uint8_t usbd_msc_async_buffers_set(void);
+static void usbd_msc_async_reset(void);
+static void usbd_msc_async_prepare(uint8_t dir, uint32_t addr, uint32_t len);
+static void usbd_msc_async_run(void);
+static void usbd_msc_async_tx_done(void);
+static void usbd_msc_async_rx_done(uint32_t rx_count);
 
 /***************************************************************************//**
  Implementations of Call-back functions used by USBD.
@@ -193,6 +199,31 @@ typedef enum scsi_req_type {
     SCSI_OUT
 } scsi_req_type_t;
 scsi_req_type_t g_req_type = SCSI_ZDR;
+
+/*
+ State of an asynchronous READ_10/WRITE_10 data phase, see
+ MSS_USBD_MSC_set_async_buffers(). fill_len[] is non-zero while a buffer holds
+ data read from the media and not yet sent to the host, or data received from
+ the host and not yet written to the media. A buffer with fill_len 0 is free.
+ */
+typedef struct usbd_msc_async {
+    uint8_t* buf[2];
+    uint32_t buf_len;
+    uint32_t fill_len[2];
+    uint32_t media_addr;        /* address of the next media operation */
+    uint32_t media_left;        /* READ_10: bytes not yet read from media */
+    uint32_t rx_left;           /* WRITE_10: bytes not yet received */
+    uint32_t media_len;         /* length of the media read in progress */
+    uint8_t media_idx;          /* buffer of the next media operation */
+    uint8_t usb_idx;            /* buffer of the next USB transfer */
+    uint8_t dir;                /* SCSI_IN or SCSI_OUT */
+    uint8_t media_busy;
+    uint8_t usb_busy;
+    uint8_t error;
+    volatile uint8_t active;
+} usbd_msc_async_t;
+
+static usbd_msc_async_t g_async;
 /*
  The g_bot_state is used to store the current state of the driver during
  Bulk-only Transport (BOT) transaction.
@@ -323,6 +354,90 @@ MSS_USBD_MSC_get_state
     return g_usbd_msc_state;
 }
 
+void
+MSS_USBD_MSC_set_async_buffers
+(
+    uint8_t* buf0,
+    uint8_t* buf1,
+    uint32_t len
+)
+{
+    uint64_t saved;
+
+    saved = disable_interrupts();
+    usbd_msc_async_reset();
+    g_async.buf[0] = buf0;
+    g_async.buf[1] = buf1;
+    g_async.buf_len = len;
+    restore_interrupts(saved);
+}
+
+void
+MSS_USBD_MSC_media_read_done
+(
+    uint8_t status
+)
+{
+    uint64_t saved;
+
+    saved = disable_interrupts();
+    if((1u == g_async.active) && (SCSI_IN == g_async.dir) &&
+       (1u == g_async.media_busy))
+    {
+        g_async.media_busy = 0u;
+        if(0u != status)
+        {
+            g_async.fill_len[g_async.media_idx] = g_async.media_len;
+            g_async.media_addr += g_async.media_len;
+            g_async.media_left -= g_async.media_len;
+            g_async.media_idx ^= 1u;
+        }
+        else
+        {
+            g_async.error = 1u;
+            usbd_msc_prepare_sense_data(g_bot_cbw.lun,
+                                        SC_MEDIUM_ERROR,
+                                        ASC_UNRECOVERED_READ_ERROR);
+        }
+        usbd_msc_async_run();
+    }
+    restore_interrupts(saved);
+}
+
+void
+MSS_USBD_MSC_media_write_done
+(
+    uint8_t status
+)
+{
+    uint64_t saved;
+
+    saved = disable_interrupts();
+    if((1u == g_async.active) && (SCSI_OUT == g_async.dir) &&
+       (1u == g_async.media_busy))
+    {
+        g_async.media_busy = 0u;
+        if(0u != status)
+        {
+            g_async.media_addr += g_async.fill_len[g_async.media_idx];
+            g_async.fill_len[g_async.media_idx] = 0u;
+            g_async.media_idx ^= 1u;
+        }
+        else
+        {
+            /* Data still received from the host is discarded */
+            g_async.error = 1u;
+            g_async.fill_len[0] = 0u;
+            g_async.fill_len[1] = 0u;
+            usbd_msc_prepare_sense_data(g_bot_cbw.lun,
+                                        SC_MEDIUM_ERROR,
+                                        ASC_WRITE_FAULT);
+        }
+        usbd_msc_async_run();
+    }
+    restore_interrupts(saved);
+}
+
 /***************************************************************************//**
  returns the configuration descriptor requested by Host.
  */
@@ -439,6 +554,7 @@ usbd_msc_init_cb
     g_xfr_buf_ptr = 0;
     g_xfr_buf_len = 0u;
     g_xfr_lba_addr = 0u;
+    usbd_msc_async_reset();
 
       /*
       User Selected FS: Operate only in FS
@@ -515,6 +631,7 @@ usbd_msc_release_cb
 )
 {
     g_usbd_msc_state = USBD_MSC_NOT_CONFIGURED;
+    usbd_msc_async_reset();
     MSS_USB_CIF_tx_ep_disable_irq(MSC_CLASS_BULK_TX_EP);
     MSS_USB_CIF_tx_ep_clr_csrreg(MSC_CLASS_BULK_TX_EP);
     MSS_USB_CIF_dma_clr_ctrlreg(MSS_USB_DMA_CHANNEL2);
@@ -577,6 +694,7 @@ usbd_msc_process_request_cb
                     g_xfr_buf_ptr = (uint8_t*)0;
                     g_xfr_buf_len = 0u;
                     g_xfr_lba_addr = 0u;
+                    usbd_msc_async_reset();
                     MSS_USBD_rx_ep_read_prepare(MSC_CLASS_BULK_RX_EP,
                                                 (uint8_t*)&g_bot_cbw,
                                                 USBD_MSC_BOT_CBW_LENGTH);
@@ -694,7 +812,12 @@ usbd_msc_bot_fsm
                 {
                     case CB_PASS:
                         g_current_command_csw.status = SCSI_COMMAND_PASS;
-                        if(g_req_type == SCSI_OUT)
+                        if(1u == g_async.active)
+                        {
+                            /* Double buffered READ_10/WRITE_10 */
+                            usbd_msc_async_run();
+                        }
+                        else if(g_req_type == SCSI_OUT)
                         {
                             //CASE:12 (Success)
                             usbd_msc_receive_data(g_xfr_buf_ptr, g_xfr_buf_len);
@@ -894,7 +1017,11 @@ usbd_msc_bot_fsm
         case BOT_DATA_TX:
             if(BOT_EVENT_TX == g_bottx_events) /* Data TX from Device*/
             {
-                if(SCSI_COMMAND_LESSDATAPASS == g_current_command_csw.status)
+                if(1u == g_async.active)
+                {
+                    usbd_msc_async_tx_done();
+                }
+                else if(SCSI_COMMAND_LESSDATAPASS == g_current_command_csw.status)
                 {
                     g_xfr_buf_ptr = (uint8_t*)0;
                     g_xfr_buf_len = 0u;
@@ -986,7 +1113,11 @@ usbd_msc_bot_fsm
         case BOT_DATA_RX:
             if(BOT_EVENT_RX == g_botrx_events)
             {
-                if(SCSI_COMMAND_LESSDATAPASS == g_current_command_csw.status)
+                if(1u == g_async.active)
+                {
+                    usbd_msc_async_rx_done(rx_count);
+                }
+                else if(SCSI_COMMAND_LESSDATAPASS == g_current_command_csw.status)
                 {
                     g_xfr_buf_ptr = (uint8_t*)0;
                     g_xfr_buf_len = 0u;
@@ -1523,12 +1654,21 @@ usbd_msc_process_read_10
         cb_res = CB_LENGTH_MISMATCH;
     }
 
-    if(0 == g_usbd_msc_media_ops->media_read)
+    if((0 == g_usbd_msc_media_ops->media_read) &&
+       ((0 == g_usbd_msc_media_ops->media_read_start) ||
+        (0u == usbd_msc_async_buffers_set())))
     {
         cb_res = CB_INTERNAL_ERROR;
     }
 
-    if(CB_PASS == cb_res)
+    if((CB_PASS == cb_res) &&
+       (0 != g_usbd_msc_media_ops->media_read_start) &&
+       (1u == usbd_msc_async_buffers_set()))
+    {
+        /* The data phase is started by usbd_msc_async_run() */
+        usbd_msc_async_prepare(SCSI_IN, lba_addr, dev_data_len);
+    }
+    else if(CB_PASS == cb_res)
     {
         if(0 != g_usbd_msc_media_ops->media_read)
         {
@@ -1623,12 +1763,21 @@ usbd_msc_process_write_10
         cb_res = CB_LENGTH_MISMATCH;
     }
 
-    if(0 == g_usbd_msc_media_ops->media_acquire_write_buf)
+    if((0 == g_usbd_msc_media_ops->media_acquire_write_buf) &&
+       ((0 == g_usbd_msc_media_ops->media_write_start) ||
+        (0u == usbd_msc_async_buffers_set())))
     {
         cb_res = CB_INTERNAL_ERROR;
     }
 
-    if(CB_PASS == cb_res)
+    if((CB_PASS == cb_res) &&
+       (0 != g_usbd_msc_media_ops->media_write_start) &&
+       (1u == usbd_msc_async_buffers_set()))
+    {
+        /* The data phase is started by usbd_msc_async_run() */
+        usbd_msc_async_prepare(SCSI_OUT, lba_addr, dev_data_len);
+    }
+    else if(CB_PASS == cb_res)
     {
         write_buf = g_usbd_msc_media_ops->media_acquire_write_buf(g_bot_cbw.lun,
                                                                   lba_addr,
@@ -1673,6 +1822,315 @@ usbd_msc_process_write_10
     return (cb_res);
 }
 
+/***************************************************************************//**
+ usbd_msc_async_buffers_set() function returns 1 when the application has
+ provided the double buffers used by the asynchronous media functions.
+ */
+static uint8_t
+usbd_msc_async_buffers_set
+(
+    void
+)
+{
+    uint8_t set = 0u;
+
+    if((0 != g_async.buf[0]) && (0 != g_async.buf[1]) &&
+       (0u != g_async.buf_len))
+    {
+        set = 1u;
+    }
+
+    return (set);
+}
+
+/***************************************************************************//**
+ usbd_msc_async_reset() function abandons the asynchronous data phase in
+ progress, if any. A media operation still in progress is ignored when it
+ completes.
+ */
+static void
+usbd_msc_async_reset
+(
+    void
+)
+{
+    g_async.fill_len[0] = 0u;
+    g_async.fill_len[1] = 0u;
+    g_async.media_addr = 0u;
+    g_async.media_left = 0u;
+    g_async.rx_left = 0u;
+    g_async.media_len = 0u;
+    g_async.media_idx = 0u;
+    g_async.usb_idx = 0u;
+    g_async.media_busy = 0u;
+    g_async.usb_busy = 0u;
+    g_async.error = 0u;
+    g_async.active = 0u;
+}
+
+/***************************************************************************//**
+ usbd_msc_async_prepare() function sets up the asynchronous data phase of a
+ READ_10 (dir = SCSI_IN) or WRITE_10 (dir = SCSI_OUT) command of len bytes
+ starting at media address addr.
+ */
+static void
+usbd_msc_async_prepare
+(
+    uint8_t dir,
+    uint32_t addr,
+    uint32_t len
+)
+{
+    usbd_msc_async_reset();
+    g_async.dir = dir;
+    g_async.media_addr = addr;
+    if(SCSI_IN == dir)
+    {
+        g_async.media_left = len;
+    }
+    else
+    {
+        g_async.rx_left = len;
+    }
+    g_async.active = 1u;
+
+    g_xfr_buf_ptr = (uint8_t*)0;
+    g_xfr_buf_len = 0u;
+    g_xfr_lba_addr = addr;
+}
+
+/***************************************************************************//**
+ usbd_msc_async_run() function starts every media operation and USB transfer
+ of the asynchronous data phase that can be started, and sends the status once
+ the data phase is over. It is called from the USB interrupt and from the media
+ completion functions with the interrupts disabled. A media operation can
+ complete from within its start function, in which case this function is
+ entered again; every step therefore checks the state again.
+ */
+static void
+usbd_msc_async_run
+(
+    void
+)
+{
+    uint8_t idx;
+    uint32_t len;
+
+    if(SCSI_IN == g_async.dir)
+    {
+        /* Read the next part of the media into a free buffer */
+        idx = g_async.media_idx;
+        if((1u == g_async.active) && (0u == g_async.media_busy) &&
+           (0u == g_async.error) && (0u != g_async.media_left) &&
+           (0u == g_async.fill_len[idx]))
+        {
+            len = g_async.media_left;
+            if(len > g_async.buf_len)
+            {
+                len = g_async.buf_len;
+            }
+            g_async.media_len = len;
+            g_async.media_busy = 1u;
+            if(0u == g_usbd_msc_media_ops->media_read_start(g_bot_cbw.lun,
+                                                            g_async.buf[idx],
+                                                            g_async.media_addr,
+                                                            len))
+            {
+                g_async.media_busy = 0u;
+                g_async.error = 1u;
+                usbd_msc_prepare_sense_data(g_bot_cbw.lun,
+                                            SC_MEDIUM_ERROR,
+                                            ASC_UNRECOVERED_READ_ERROR);
+            }
+        }
+
+        /* Send a buffer which has been read */
+        idx = g_async.usb_idx;
+        if((1u == g_async.active) && (0u == g_async.usb_busy) &&
+           (0u == g_async.error) && (0u != g_async.fill_len[idx]))
+        {
+            g_async.usb_busy = 1u;
+            g_xfr_buf_ptr = g_async.buf[idx];
+            g_xfr_buf_len = g_async.fill_len[idx];
+            usbd_msc_send_data(g_xfr_buf_ptr, g_xfr_buf_len);
+        }
+
+        if((1u == g_async.active) && (0u == g_async.usb_busy) &&
+           (0u == g_async.media_busy))
+        {
+            if(1u == g_async.error)
+            {
+                usbd_msc_async_reset();
+                g_xfr_buf_ptr = (uint8_t*)0;
+                g_xfr_buf_len = 0u;
+                g_xfr_lba_addr = 0u;
+                g_current_command_csw.status = SCSI_COMMAND_FAIL;
+                usbd_msc_stallin_sendstatus();
+            }
+            else if(0u == g_current_command_csw.data_residue)
+            {
+                usbd_msc_async_reset();
+                g_xfr_buf_ptr = (uint8_t*)0;
+                g_xfr_buf_len = 0u;
+                g_xfr_lba_addr = 0u;
+                g_current_command_csw.status = SCSI_COMMAND_PASS;
+                usbd_msc_send_csw();
+            }
+            else
+            {
+                /* Waiting for a buffer */
+            }
+        }
+    }
+    else
+    {
+        /* Write a buffer which has been received */
+        idx = g_async.media_idx;
+        if((1u == g_async.active) && (0u == g_async.media_busy) &&
+           (0u == g_async.error) && (0u != g_async.fill_len[idx]))
+        {
+            g_async.media_busy = 1u;
+            if(0u == g_usbd_msc_media_ops->media_write_start(g_bot_cbw.lun,
+                                                             g_async.buf[idx],
+                                                             g_async.media_addr,
+                                                             g_async.fill_len[idx]))
+            {
+                g_async.media_busy = 0u;
+                g_async.error = 1u;
+                g_async.fill_len[0] = 0u;
+                g_async.fill_len[1] = 0u;
+                usbd_msc_prepare_sense_data(g_bot_cbw.lun,
+                                            SC_MEDIUM_ERROR,
+                                            ASC_WRITE_FAULT);
+            }
+        }
+
+        /*
+         Receive the next part of the data into a free buffer. After an error
+         the data is still received, and discarded, so the host reaches the
+         status phase.
+         */
+        idx = g_async.usb_idx;
+        if((1u == g_async.active) && (0u == g_async.usb_busy) &&
+           (0u != g_async.rx_left) && (0u == g_async.fill_len[idx]))
+        {
+            len = g_async.rx_left;
+            if(len > g_async.buf_len)
+            {
+                len = g_async.buf_len;
+            }
+            g_async.usb_busy = 1u;
+            g_xfr_buf_ptr = g_async.buf[idx];
+            g_xfr_buf_len = len;
+            usbd_msc_receive_data(g_xfr_buf_ptr, g_xfr_buf_len);
+        }
+
+        if((1u == g_async.active) && (0u == g_async.usb_busy) &&
+           (0u == g_async.media_busy) && (0u == g_async.rx_left) &&
+           (0u == g_async.fill_len[0]) && (0u == g_async.fill_len[1]))
+        {
+            if(1u == g_async.error)
+            {
+                g_current_command_csw.status = SCSI_COMMAND_FAIL;
+            }
+            else
+            {
+                g_current_command_csw.status = SCSI_COMMAND_PASS;
+            }
+            usbd_msc_async_reset();
+            g_xfr_buf_ptr = (uint8_t*)0;
+            g_xfr_buf_len = 0u;
+            g_xfr_lba_addr = 0u;
+            usbd_msc_send_csw();
+        }
+    }
+}
+
+/***************************************************************************//**
+ usbd_msc_async_tx_done() function is called when a buffer of an asynchronous
+ READ_10 has been sent to the host.
+ */
+static void
+usbd_msc_async_tx_done
+(
+    void
+)
+{
+    uint8_t idx = g_async.usb_idx;
+
+    g_async.usb_busy = 0u;
+    if(g_current_command_csw.data_residue >= g_async.fill_len[idx])
+    {
+        g_current_command_csw.data_residue -= g_async.fill_len[idx];
+    }
+    else
+    {
+        ASSERT(0);/*corrupt/invalid data_residue value*/
+    }
+    g_async.fill_len[idx] = 0u;
+    g_async.usb_idx ^= 1u;
+
+    usbd_msc_async_run();
+}
+
+/***************************************************************************//**
+ usbd_msc_async_rx_done() function is called when a buffer of an asynchronous
+ WRITE_10 has been received from the host. A short transfer ends the data
+ phase and the command fails.
+ */
+static void
+usbd_msc_async_rx_done
+(
+    uint32_t rx_count
+)
+{
+    uint8_t idx = g_async.usb_idx;
+
+    g_async.usb_busy = 0u;
+    if(rx_count > g_xfr_buf_len)
+    {
+        rx_count = g_xfr_buf_len;
+    }
+
+    if(g_current_command_csw.data_residue >= rx_count)
+    {
+        g_current_command_csw.data_residue -= rx_count;
+    }
+    else
+    {
+        ASSERT(0);/*corrupt/invalid data_residue value*/
+    }
+
+    if(rx_count == g_xfr_buf_len)
+    {
+        g_async.rx_left -= rx_count;
+        if(0u == g_async.error)
+        {
+            g_async.fill_len[idx] = rx_count;
+        }
+    }
+    else
+    {
+        /* Buffers waiting for the media are discarded */
+        if((0u == g_async.media_busy) || (0u != g_async.media_idx))
+        {
+            g_async.fill_len[0] = 0u;
+        }
+        if((0u == g_async.media_busy) || (1u != g_async.media_idx))
+        {
+            g_async.fill_len[1] = 0u;
+        }
+        g_async.rx_left = 0u;
+        g_async.error = 1u;
+        usbd_msc_prepare_sense_data(g_bot_cbw.lun,
+                                    SC_ABORTED_COMMAND,
+                                    ASC_PARAMETER_LIST_LENGTH_ERROR);
+    }
+    g_async.usb_idx ^= 1u;
+
+    usbd_msc_async_run();
+}
+
 static uint8_t usbd_msc_process_inquiry(void)
 {
     uint32_t dev_data_len = 0u;
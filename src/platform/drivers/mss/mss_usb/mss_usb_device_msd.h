@@ -117,6 +117,21 @@
   media_acquire_write_buf, media_write_ready and media_read (as part of structure
   of type mss_usbd_msc_media_t) must be implemented by the application.
 
+  --------------------------------
+  Asynchronous media access
+  --------------------------------
+  With media_read, media_acquire_write_buf and media_write_ready the media
+  operation is done inside the call-back, from the USB interrupt, and the USB
+  bus is idle until it returns. For slow media such as SPI flash or eMMC the
+  application can instead implement media_read_start and media_write_start,
+  and provide two buffers using MSS_USBD_MSC_set_async_buffers(). A READ_10 or
+  WRITE_10 command is then split into parts of the buffer length. The driver
+  starts the media operation on one buffer while the USB transfer of the
+  previous or next part uses the other buffer, and the application reports the
+  end of each media operation by calling MSS_USBD_MSC_media_read_done() or
+  MSS_USBD_MSC_media_write_done(), for example from the DMA interrupt of the
+  media. The status is sent to the host once all parts are complete.
+
 *//*==========================================================================*/
 
 #ifndef __MSS_USB_DEVICE_MSD_H_
@@ -245,6 +260,22 @@ typedef enum mss_usbd_msc_state {
   is passed as a parameter. In case when the disconnect event is detected by the
   USBD driver a value of cfgidx = 0xFF is passed. The application can use this
   call-back function and its parameter to take appropriate action as required.
+
+  media_read_start
+  The optional function pointed by the media_read_start function pointer is
+  called instead of media_read, when the asynchronous buffers are set, to start
+  reading len bytes from the media address blk_addr into buf. The function must
+  return 1 when the read was started and 0 otherwise. The application calls
+  MSS_USBD_MSC_media_read_done() when the read is complete; it may do so from
+  within this function.
+
+  media_write_start
+  The optional function pointed by the media_write_start function pointer is
+  called instead of media_acquire_write_buf and media_write_ready, when the
+  asynchronous buffers are set, to start writing len bytes from buf at the media
+  address blk_addr. The function must return 1 when the write was started and 0
+  otherwise. The application calls MSS_USBD_MSC_media_write_done() when the
+  write is complete; it may do so from within this function.
  */
 
 typedef struct mss_usbd_msc_media {
@@ -272,6 +303,16 @@ typedef struct mss_usbd_msc_media {
     uint8_t*(*media_inquiry)(uint8_t lun, uint32_t *len);
     uint8_t (*media_release)(uint8_t cfgidx);
 
+    uint8_t (*media_read_start)(uint8_t lun,
+                                uint8_t *buf,
+                                uint32_t blk_addr,
+                                uint32_t len);
+
+    uint8_t (*media_write_start)(uint8_t lun,
+                                 const uint8_t *buf,
+                                 uint32_t blk_addr,
+                                 uint32_t len);
+
 } mss_usbd_msc_media_t;
 
 /***************************************************************************//**
@@ -441,6 +482,94 @@ MSS_USBD_MSC_get_state
     void
 );
 
+/***************************************************************************//**
+  @brief MSS_USBD_MSC_set_async_buffers()
+  The MSS_USBD_MSC_set_async_buffers() function provides the two buffers used
+  for READ_10 and WRITE_10 commands when the media_read_start and
+  media_write_start call-back functions are implemented. Passing null pointers
+  returns the driver to the synchronous media call-back functions. It must not
+  be called while the host accesses the media.
+
+  @param buf0
+  @param buf1
+  The buf0 and buf1 parameters are the buffers. They must be word aligned and,
+  when the MSS USB DMA is used, reachable by it.
+
+  @param len
+  The len parameter is the length of each buffer. It must be a multiple of the
+  block size of the LUNs. 16KB or more is recommended for eMMC.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+        static uint8_t g_msd_buf[2][32768] __attribute__ ((aligned (4)));
+
+        static uint8_t emmc_read_start(uint8_t lun, uint8_t *buf,
+                                       uint32_t blk_addr, uint32_t len)
+        {
+            return (MSS_MMC_TRANSFER_IN_PROGRESS ==
+                    MSS_MMC_sdma_read(blk_addr / 512u, buf, len)) ? 1u : 0u;
+        }
+
+        // The eMMC transfer complete handler calls
+        // MSS_USBD_MSC_media_read_done(1u) or
+        // MSS_USBD_MSC_media_write_done(1u).
+
+        MSS_USBD_MSC_set_async_buffers(g_msd_buf[0], g_msd_buf[1], 32768u);
+        MSS_USBD_MSC_init(&usb_emmc_media, MSS_USB_DEVICE_HS);
+  @endcode
+*/
+void
+MSS_USBD_MSC_set_async_buffers
+(
+    uint8_t* buf0,
+    uint8_t* buf1,
+    uint32_t len
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_MSC_media_read_done()
+  The MSS_USBD_MSC_media_read_done() function must be called by the application
+  when a read started by the media_read_start call-back function is complete.
+  The driver sends the data to the host and starts the next read. It can be
+  called from an interrupt handler.
+
+  @param status
+  The status parameter is 1 when the data was read and 0 when the read failed.
+  A failed read fails the READ_10 command with a MEDIUM ERROR sense key.
+
+  @return
+    This function does not return a value.
+*/
+void
+MSS_USBD_MSC_media_read_done
+(
+    uint8_t status
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_MSC_media_write_done()
+  The MSS_USBD_MSC_media_write_done() function must be called by the
+  application when a write started by the media_write_start call-back function
+  is complete. The buffer is reused for the data from the host. It can be
+  called from an interrupt handler.
+
+  @param status
+  The status parameter is 1 when the data was written and 0 when the write
+  failed. A failed write fails the WRITE_10 command with a MEDIUM ERROR sense
+  key.
+
+  @return
+    This function does not return a value.
+*/
+void
+MSS_USBD_MSC_media_write_done
+(
+    uint8_t status
+);
+
 #endif  //MSS_USB_DEVICE_ENABLED
 
 #ifdef __cplusplus
@@ -0,0 +1,656 @@
+/*******************************************************************************
+ * Copyright 2019-2020 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC MSS USB Driver Stack
+ *      USB Logical Layer (USB-LL)
+ *          USBD-VENDOR class driver.
+ *
+ * USBD-VENDOR class driver implementation:
+ * This source file implements a vendor specific class with one bulk IN and
+ * one bulk OUT endpoint, each with a queue of application owned requests.
+ *
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "mss_usb_device.h"
+#include "mss_usb_device_vendor.h"
+#include "mss_usb_std_def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MSS_USB_DEVICE_ENABLED
+
+#define VENDOR_CLASS_INTERFACE_NUM                      0x00u
+#define VENDOR_CONF_DESCR_DESCTYPE_IDX                  1u
+
+/* Offsets of wMaxPacketSize of the endpoint descriptors */
+#define VENDOR_CONF_DESCR_TX_MAXPKT_IDX                 22u
+#define VENDOR_CONF_DESCR_RX_MAXPKT_IDX                 29u
+
+/* OUT buffers must hold whole High Speed packets */
+#define VENDOR_RX_BUF_ALIGN                             512u
+
+/***************************************************************************//**
+ Queue of requests on an endpoint.
+ */
+typedef struct usbd_vendor_queue {
+    mss_usbd_vendor_req_t* head;
+    mss_usbd_vendor_req_t* tail;
+    mss_usbd_vendor_req_t* volatile active;
+} usbd_vendor_queue_t;
+
+/***************************************************************************//**
+ Local functions used by USBD-VENDOR class driver.
+ */
+static uint8_t usbd_vendor_submit(usbd_vendor_queue_t* queue,
+                                  mss_usbd_vendor_req_t* req,
+                                  uint8_t is_in);
+static void usbd_vendor_start(usbd_vendor_queue_t* queue, uint8_t is_in);
+static void usbd_vendor_complete(usbd_vendor_queue_t* queue,
+                                 uint8_t is_in,
+                                 uint8_t status,
+                                 uint32_t actual);
+static void usbd_vendor_flush(usbd_vendor_queue_t* queue);
+
+/***************************************************************************//**
+ Implementations of Call-back functions used by USBD.
+ */
+static uint8_t* usbd_vendor_get_descriptor_cb(uint8_t recepient,
+                                              uint8_t type,
+                                              uint32_t* length,
+                                              mss_usb_device_speed_t musb_speed);
+
+static uint8_t usbd_vendor_init_cb(uint8_t cfgidx,
+                                   mss_usb_device_speed_t musb_speed);
+static uint8_t usbd_vendor_release_cb(uint8_t cfgidx);
+static uint8_t usbd_vendor_process_request_cb(mss_usbd_setup_pkt_t* setup_pkt,
+                                              uint8_t** buf_pp,
+                                              uint32_t* length);
+static uint8_t usbd_vendor_tx_complete_cb(mss_usb_ep_num_t num, uint8_t status);
+static uint8_t usbd_vendor_rx_cb(mss_usb_ep_num_t num,
+                                 uint8_t status,
+                                 uint32_t rx_count);
+
+/*******************************************************************************
+ Global variables used by USBD-VENDOR class driver.
+ */
+mss_usbd_class_cb_t usbd_vendor_class_cb = {usbd_vendor_init_cb,
+                                            usbd_vendor_release_cb,
+                                            usbd_vendor_get_descriptor_cb,
+                                            usbd_vendor_process_request_cb,
+                                            usbd_vendor_tx_complete_cb,
+                                            usbd_vendor_rx_cb,
+                                            0,
+                                            0 };
+
+/* Application call-back functions */
+static const mss_usbd_vendor_cb_t* g_usbd_vendor_app_cb = 0;
+
+/* USB current Speed of operation selected by user*/
+static mss_usb_device_speed_t g_usbd_vendor_user_speed;
+
+static volatile mss_usbd_vendor_state_t g_usbd_vendor_state =
+                                                    USBD_VENDOR_NOT_CONFIGURED;
+
+static usbd_vendor_queue_t g_in_queue = {0, 0, 0};
+static usbd_vendor_queue_t g_out_queue = {0, 0, 0};
+
+uint8_t vendor_fs_conf_descr[VENDOR_CONFIG_DESCR_LENGTH] =
+{
+    /*----------------------- Configuration Descriptor -----------------------*/
+    USB_STD_CONFIG_DESCR_LEN,                       /* bLength */
+    USB_CONFIGURATION_DESCRIPTOR_TYPE,              /* bDescriptorType */
+    VENDOR_CONFIG_DESCR_LENGTH,                     /* wTotalLength LSB */
+    0x00u,                                          /* wTotalLength MSB */
+    0x01u,                                          /* bNumInterfaces */
+    0x01u,                                          /* bConfigurationValue */
+    0x00u,                                          /* iConfiguration */
+    0xC0u,                                          /* bmAttributes */
+    0x32u,                                          /* bMaxPower */
+    /*------------------------- Interface Descriptor -------------------------*/
+    USB_STD_INTERFACE_DESCR_LEN,                    /* bLength */
+    USB_INTERFACE_DESCRIPTOR_TYPE,                  /* bDescriptorType */
+    VENDOR_CLASS_INTERFACE_NUM,                     /* bInterfaceNumber */
+    0x00u,                                          /* bAlternateSetting */
+    0x02u,                                          /* bNumEndpoints */
+    0xFFu,                                          /* bInterfaceClass */
+    0x00u,                                          /* bInterfaceSubClass */
+    0x00u,                                          /* bInterfaceProtocol */
+    0x00u,                                          /* iInterface */
+    /*------------------------- IN Endpoint Descriptor -----------------------*/
+    USB_STD_ENDPOINT_DESCR_LEN,                     /* bLength */
+    USB_ENDPOINT_DESCRIPTOR_TYPE,                   /* bDescriptorType */
+    (0x80u | VENDOR_BULK_TX_EP),                    /* bEndpointAddress */
+    0x02u,                                          /* bmAttributes */
+    0x40u,                                          /* wMaxPacketSize LSB */
+    0x00u,                                          /* wMaxPacketSize MSB */
+    0x00u,                                          /* bInterval */
+    /*------------------------- OUT Endpoint Descriptor ----------------------*/
+    USB_STD_ENDPOINT_DESCR_LEN,                     /* bLength */
+    USB_ENDPOINT_DESCRIPTOR_TYPE,                   /* bDescriptorType */
+    VENDOR_BULK_RX_EP,                              /* bEndpointAddress */
+    0x02u,                                          /* bmAttributes */
+    0x40u,                                          /* wMaxPacketSize LSB */
+    0x00u,                                          /* wMaxPacketSize MSB */
+    0x00u                                           /* bInterval */
+};
+
+uint8_t vendor_hs_conf_descr[VENDOR_CONFIG_DESCR_LENGTH] =
+{
+    /*----------------------- Configuration Descriptor -----------------------*/
+    USB_STD_CONFIG_DESCR_LEN,                       /* bLength */
+    USB_CONFIGURATION_DESCRIPTOR_TYPE,              /* bDescriptorType */
+    VENDOR_CONFIG_DESCR_LENGTH,                     /* wTotalLength LSB */
+    0x00u,                                          /* wTotalLength MSB */
+    0x01u,                                          /* bNumInterfaces */
+    0x01u,                                          /* bConfigurationValue */
+    0x00u,                                          /* iConfiguration */
+    0xC0u,                                          /* bmAttributes */
+    0x32u,                                          /* bMaxPower */
+    /*------------------------- Interface Descriptor -------------------------*/
+    USB_STD_INTERFACE_DESCR_LEN,                    /* bLength */
+    USB_INTERFACE_DESCRIPTOR_TYPE,                  /* bDescriptorType */
+    VENDOR_CLASS_INTERFACE_NUM,                     /* bInterfaceNumber */
+    0x00u,                                          /* bAlternateSetting */
+    0x02u,                                          /* bNumEndpoints */
+    0xFFu,                                          /* bInterfaceClass */
+    0x00u,                                          /* bInterfaceSubClass */
+    0x00u,                                          /* bInterfaceProtocol */
+    0x00u,                                          /* iInterface */
+    /*------------------------- IN Endpoint Descriptor -----------------------*/
+    USB_STD_ENDPOINT_DESCR_LEN,                     /* bLength */
+    USB_ENDPOINT_DESCRIPTOR_TYPE,                   /* bDescriptorType */
+    (0x80u | VENDOR_BULK_TX_EP),                    /* bEndpointAddress */
+    0x02u,                                          /* bmAttributes */
+    0x00u,                                          /* wMaxPacketSize LSB */
+    0x02u,                                          /* wMaxPacketSize MSB */
+    0x00u,                                          /* bInterval */
+    /*------------------------- OUT Endpoint Descriptor ----------------------*/
+    USB_STD_ENDPOINT_DESCR_LEN,                     /* bLength */
+    USB_ENDPOINT_DESCRIPTOR_TYPE,                   /* bDescriptorType */
+    VENDOR_BULK_RX_EP,                              /* bEndpointAddress */
+    0x02u,                                          /* bmAttributes */
+    0x00u,                                          /* wMaxPacketSize LSB */
+    0x02u,                                          /* wMaxPacketSize MSB */
+    0x00u                                           /* bInterval */
+};
+
+/***************************************************************************//**
+ * See mss_usb_device_vendor.h for details of how to use this function.
+ */
+void
+MSS_USBD_VENDOR_init
+(
+    const mss_usbd_vendor_cb_t* app_cb,
+    mss_usb_device_speed_t speed
+)
+{
+    g_usbd_vendor_app_cb = app_cb;
+    g_usbd_vendor_user_speed = speed;
+
+    MSS_USBD_set_class_cb_handler(&usbd_vendor_class_cb);
+}
+
+/***************************************************************************//**
+ * See mss_usb_device_vendor.h for details of how to use this function.
+ */
+mss_usbd_vendor_state_t
+MSS_USBD_VENDOR_get_state
+(
+    void
+)
+{
+    return g_usbd_vendor_state;
+}
+
+/***************************************************************************//**
+ * See mss_usb_device_vendor.h for details of how to use this function.
+ */
+uint8_t
+MSS_USBD_VENDOR_submit_in
+(
+    mss_usbd_vendor_req_t* req
+)
+{
+    uint8_t result = USB_FAIL;
+
+    if((0 != req) && (0u != req->length))
+    {
+        result = usbd_vendor_submit(&g_in_queue, req, 1u);
+    }
+
+    return result;
+}
+
+/***************************************************************************//**
+ * See mss_usb_device_vendor.h for details of how to use this function.
+ */
+uint8_t
+MSS_USBD_VENDOR_submit_out
+(
+    mss_usbd_vendor_req_t* req
+)
+{
+    uint8_t result = USB_FAIL;
+
+    if((0 != req) && (0u != req->length) &&
+       (0u == (req->length % VENDOR_RX_BUF_ALIGN)))
+    {
+        result = usbd_vendor_submit(&g_out_queue, req, 0u);
+    }
+
+    return result;
+}
+
+/***************************************************************************//**
+ usbd_vendor_submit() function adds a request to the queue of an endpoint and
+ starts it when the endpoint is idle.
+ */
+static uint8_t
+usbd_vendor_submit
+(
+    usbd_vendor_queue_t* queue,
+    mss_usbd_vendor_req_t* req,
+    uint8_t is_in
+)
+{
+    uint64_t saved;
+    uint8_t result = USB_FAIL;
+
+    if((0 != req->buf) && (0u == ((uintptr_t)req->buf & 0x3u)) &&
+       (USBD_VENDOR_CONFIGURED == g_usbd_vendor_state))
+    {
+        req->actual = 0u;
+        req->status = USBD_VENDOR_REQ_PENDING;
+        req->next = 0;
+
+        saved = disable_interrupts();
+
+        if(0 == queue->tail)
+        {
+            queue->head = req;
+        }
+        else
+        {
+            queue->tail->next = req;
+        }
+        queue->tail = req;
+
+        if(0 == queue->active)
+        {
+            usbd_vendor_start(queue, is_in);
+        }
+
+        restore_interrupts(saved);
+        result = USB_SUCCESS;
+    }
+
+    return result;
+}
+
+/***************************************************************************//**
+ usbd_vendor_start() function starts the transfer of the first queued request
+ of an idle endpoint. Called with the interrupts disabled or from the USB
+ interrupt.
+ */
+static void
+usbd_vendor_start
+(
+    usbd_vendor_queue_t* queue,
+    uint8_t is_in
+)
+{
+    mss_usbd_vendor_req_t* req = queue->head;
+
+    if(0 != req)
+    {
+        queue->head = req->next;
+        if(0 == queue->head)
+        {
+            queue->tail = 0;
+        }
+        req->next = 0;
+        queue->active = req;
+
+        if(1u == is_in)
+        {
+            MSS_USBD_tx_ep_write(VENDOR_BULK_TX_EP, req->buf, req->length);
+        }
+        else
+        {
+            MSS_USBD_rx_ep_read_prepare(VENDOR_BULK_RX_EP,
+                                        req->buf,
+                                        req->length);
+        }
+    }
+}
+
+/***************************************************************************//**
+ usbd_vendor_complete() function completes the active request of an endpoint.
+ The next request is started before the complete call-back function is called
+ so the endpoint does not wait for the application.
+ */
+static void
+usbd_vendor_complete
+(
+    usbd_vendor_queue_t* queue,
+    uint8_t is_in,
+    uint8_t status,
+    uint32_t actual
+)
+{
+    mss_usbd_vendor_req_t* req = queue->active;
+
+    if(0 != req)
+    {
+        req->actual = actual;
+        req->status = status;
+        queue->active = 0;
+
+        usbd_vendor_start(queue, is_in);
+
+        if(0 != req->complete)
+        {
+            req->complete(req);
+        }
+    }
+}
+
+/***************************************************************************//**
+ usbd_vendor_flush() function fails the active and all queued requests of an
+ endpoint.
+ */
+static void
+usbd_vendor_flush
+(
+    usbd_vendor_queue_t* queue
+)
+{
+    mss_usbd_vendor_req_t* req;
+    mss_usbd_vendor_req_t* next;
+    uint64_t saved;
+
+    saved = disable_interrupts();
+    req = queue->active;
+    if(0 != req)
+    {
+        req->next = queue->head;
+    }
+    else
+    {
+        req = queue->head;
+    }
+    queue->head = 0;
+    queue->tail = 0;
+    queue->active = 0;
+    restore_interrupts(saved);
+
+    while(0 != req)
+    {
+        next = req->next;
+        req->next = 0;
+        req->status = USBD_VENDOR_REQ_FAILED;
+        if(0 != req->complete)
+        {
+            req->complete(req);
+        }
+        req = next;
+    }
+}
+
+/***************************************************************************//**
+ returns the configuration descriptor requested by Host.
+ */
+static uint8_t*
+usbd_vendor_get_descriptor_cb
+(
+    uint8_t recepient,
+    uint8_t type,
+    uint32_t* length,
+    mss_usb_device_speed_t musb_speed
+)
+{
+    uint8_t* conf_desc = 0;
+    uint8_t* os_conf_desc = 0;
+
+    /*User Selected FS:
+        Operate only in FS
+      User Selected HS:
+        Device connected to 2.0 Host(musb_speed = HS):Operate in HS
+        Device connected to 1.x Host(musb_speed = FS):Operate in FS
+    */
+    if(MSS_USB_DEVICE_FS == g_usbd_vendor_user_speed)
+    {
+        conf_desc = vendor_fs_conf_descr;
+        os_conf_desc = 0;
+    }
+    else if(MSS_USB_DEVICE_HS == musb_speed)
+    {
+        conf_desc = vendor_hs_conf_descr;
+        os_conf_desc = vendor_fs_conf_descr;
+    }
+    else
+    {
+        conf_desc = vendor_fs_conf_descr;
+        os_conf_desc = vendor_hs_conf_descr;
+    }
+
+    if(USB_STD_REQ_RECIPIENT_DEVICE == recepient)
+    {
+        if(USB_CONFIGURATION_DESCRIPTOR_TYPE == type)
+        {
+            conf_desc[VENDOR_CONF_DESCR_DESCTYPE_IDX] =
+                                            USB_CONFIGURATION_DESCRIPTOR_TYPE;
+            *length = VENDOR_CONFIG_DESCR_LENGTH;
+            return(conf_desc);
+        }
+        else if((USB_OTHER_SPEED_CONFIG_DESCRIPTOR_TYPE == type) &&
+                (0 != os_conf_desc))
+        {
+            os_conf_desc[VENDOR_CONF_DESCR_DESCTYPE_IDX] =
+                                        USB_OTHER_SPEED_CONFIG_DESCRIPTOR_TYPE;
+            *length = VENDOR_CONFIG_DESCR_LENGTH;
+            return(os_conf_desc);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return USB_FAIL;
+}
+
+/***************************************************************************//**
+ usbd_vendor_init_cb() call-back is called by USB Device mode driver on
+ receiving SET_CONFIGURATION command. Both bulk endpoints are configured to
+ use the MSS USB DMA.
+ */
+static uint8_t
+usbd_vendor_init_cb
+(
+    uint8_t cfgidx,
+    mss_usb_device_speed_t musb_speed
+)
+{
+    uint8_t* conf_desc = vendor_fs_conf_descr;
+    uint16_t bulk_txep_maxpktsz;
+    uint16_t bulk_rxep_maxpktsz;
+
+    if(MSS_USB_DEVICE_HS == musb_speed)
+    {
+        conf_desc = vendor_hs_conf_descr;
+    }
+
+    bulk_txep_maxpktsz =
+            (uint16_t)((conf_desc[VENDOR_CONF_DESCR_TX_MAXPKT_IDX + 1u] << 8u) |
+                       conf_desc[VENDOR_CONF_DESCR_TX_MAXPKT_IDX]);
+    bulk_rxep_maxpktsz =
+            (uint16_t)((conf_desc[VENDOR_CONF_DESCR_RX_MAXPKT_IDX + 1u] << 8u) |
+                       conf_desc[VENDOR_CONF_DESCR_RX_MAXPKT_IDX]);
+
+    g_in_queue.head = 0;
+    g_in_queue.tail = 0;
+    g_in_queue.active = 0;
+    g_out_queue.head = 0;
+    g_out_queue.tail = 0;
+    g_out_queue.active = 0;
+
+    MSS_USBD_rx_ep_configure(VENDOR_BULK_RX_EP,
+                             VENDOR_BULK_RX_EP_FIFO_ADDR,
+                             VENDOR_BULK_EP_FIFO_SIZE,
+                             bulk_rxep_maxpktsz,
+                             1u,
+                             DMA_ENABLE,
+                             VENDOR_BULK_RX_EP_DMA_CHANNEL,
+                             MSS_USB_XFR_BULK,
+                             NO_ZLP_TO_XFR);
+
+    MSS_USBD_tx_ep_configure(VENDOR_BULK_TX_EP,
+                             VENDOR_BULK_TX_EP_FIFO_ADDR,
+                             VENDOR_BULK_EP_FIFO_SIZE,
+                             bulk_txep_maxpktsz,
+                             1u,
+                             DMA_ENABLE,
+                             VENDOR_BULK_TX_EP_DMA_CHANNEL,
+                             MSS_USB_XFR_BULK,
+                             VENDOR_BULK_TX_EP_ZLP);
+
+    g_usbd_vendor_state = USBD_VENDOR_CONFIGURED;
+
+    if((0 != g_usbd_vendor_app_cb) &&
+       (0 != g_usbd_vendor_app_cb->vendor_configured))
+    {
+        g_usbd_vendor_app_cb->vendor_configured();
+    }
+
+    return USB_SUCCESS;
+}
+
+/***************************************************************************//**
+ usbd_vendor_release_cb() call-back is called by USB Device mode driver on
+ receiving a command to clear the configuration or on disconnect.
+ */
+static uint8_t
+usbd_vendor_release_cb
+(
+    uint8_t cfgidx
+)
+{
+    g_usbd_vendor_state = USBD_VENDOR_NOT_CONFIGURED;
+
+    MSS_USB_CIF_tx_ep_disable_irq(VENDOR_BULK_TX_EP);
+    MSS_USB_CIF_tx_ep_clr_csrreg(VENDOR_BULK_TX_EP);
+    MSS_USB_CIF_dma_clr_ctrlreg(VENDOR_BULK_TX_EP_DMA_CHANNEL);
+
+    MSS_USB_CIF_rx_ep_disable_irq(VENDOR_BULK_RX_EP);
+    MSS_USB_CIF_rx_ep_clr_csrreg(VENDOR_BULK_RX_EP);
+    MSS_USB_CIF_dma_clr_ctrlreg(VENDOR_BULK_RX_EP_DMA_CHANNEL);
+
+    usbd_vendor_flush(&g_in_queue);
+    usbd_vendor_flush(&g_out_queue);
+
+    if((0 != g_usbd_vendor_app_cb) &&
+       (0 != g_usbd_vendor_app_cb->vendor_released))
+    {
+        g_usbd_vendor_app_cb->vendor_released();
+    }
+
+    return USB_SUCCESS;
+}
+
+/***************************************************************************//**
+ usbd_vendor_process_request_cb() call-back function passes the requests
+ received on the control endpoint to the application.
+ */
+static uint8_t
+usbd_vendor_process_request_cb
+(
+    mss_usbd_setup_pkt_t* setup_pkt,
+    uint8_t** buf_pp,
+    uint32_t* length
+)
+{
+    uint8_t result = USB_FAIL;
+
+    if((0 != g_usbd_vendor_app_cb) &&
+       (0 != g_usbd_vendor_app_cb->vendor_request))
+    {
+        result = g_usbd_vendor_app_cb->vendor_request(setup_pkt,
+                                                      buf_pp,
+                                                      length);
+    }
+
+    return result;
+}
+
+/***************************************************************************//**
+ usbd_vendor_tx_complete_cb() call-back function is called by USB Device mode
+ driver on completion of the IN transfer of the active request.
+ */
+static uint8_t
+usbd_vendor_tx_complete_cb
+(
+    mss_usb_ep_num_t num,
+    uint8_t status
+)
+{
+    mss_usbd_vendor_req_t* req = g_in_queue.active;
+
+    if((VENDOR_BULK_TX_EP == num) && (0 != req))
+    {
+        if(status & (TX_EP_UNDER_RUN_ERROR | TX_EP_STALL_ERROR))
+        {
+            MSS_USBD_tx_ep_flush_fifo(VENDOR_BULK_TX_EP);
+            usbd_vendor_complete(&g_in_queue, 1u, USBD_VENDOR_REQ_FAILED, 0u);
+        }
+        else
+        {
+            usbd_vendor_complete(&g_in_queue, 1u, USBD_VENDOR_REQ_DONE,
+                                 req->length);
+        }
+    }
+
+    return USB_SUCCESS;
+}
+
+/***************************************************************************//**
+ usbd_vendor_rx_cb() call-back function is called by USB Device mode driver
+ when the buffer of the active OUT request is full or a short packet was
+ received.
+ */
+static uint8_t
+usbd_vendor_rx_cb
+(
+    mss_usb_ep_num_t num,
+    uint8_t status,
+    uint32_t rx_count
+)
+{
+    if(VENDOR_BULK_RX_EP == num)
+    {
+        if(status & (RX_EP_OVER_RUN_ERROR | RX_EP_STALL_ERROR |
+                     RX_EP_DATA_ERROR | RX_EP_PID_ERROR | RX_EP_ISO_INCOMP_ERROR))
+        {
+            usbd_vendor_complete(&g_out_queue, 0u, USBD_VENDOR_REQ_FAILED,
+                                 rx_count);
+        }
+        else
+        {
+            usbd_vendor_complete(&g_out_queue, 0u, USBD_VENDOR_REQ_DONE,
+                                 rx_count);
+        }
+    }
+
+    return USB_SUCCESS;
+}
+
+#endif  //MSS_USB_DEVICE_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,360 @@
+/*******************************************************************************
+ * Copyright 2019-2020 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * PolarFire SoC MSS USB Driver Stack
+ *      USB Logical Layer (USB-LL)
+ *          USBD-VENDOR class driver.
+ *
+ *  USBD-VENDOR class driver public API.
+ *
+ */
+
+/*=========================================================================*//**
+  @mainpage PolarFire SoC MSS USB driver (USBD-VENDOR)
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The vendor bulk class device driver implements a vendor specific USB device
+  (bInterfaceClass 0xFF) with one BULK IN and one BULK OUT endpoint. It is meant
+  for streaming data between the PolarFire SoC device and a host application
+  using, for example, libusb or WinUSB, where the overhead of a standard class
+  such as MSC is not wanted.
+
+  This driver uses the USBD-Class driver template to implement the device.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  The following steps are involved in the operation of the USBD-VENDOR driver:
+    - Configuration
+    - Initialization
+    - Enumeration
+    - Class Specific requests
+    - Data transfer
+
+  --------------------------------
+  Configuration
+  --------------------------------
+  To use this driver, the MSS USB driver must first be configured in the USB
+  device mode using the MSS_USB_PERIPHERAL_MODE. No other configuration is
+  necessary.
+
+  --------------------------------
+  Initialization
+  --------------------------------
+  The vendor class driver must be initialized using the MSS_USBD_VENDOR_init()
+  function. Once initialized, this driver gets configured by the USBD driver
+  during the enumeration process. The usbd_vendor_init_cb() call-back function
+  is called by the USBD driver when the host configures this device, and then
+  calls the vendor_configured call-back function of the application.
+
+  Note: For successful enumeration, the device specific descriptors must also be
+  provided by the application using the MSS_USBD_set_desc_cb_handler()
+  function to the USBD Driver.
+
+  --------------------------------
+  Class Specific requests
+  --------------------------------
+  Vendor requests received on the control endpoint are passed on to the
+  vendor_request call-back function of the application, when it is provided.
+  Otherwise they are stalled.
+
+  --------------------------------
+  Data transfer
+  --------------------------------
+  Transfers are described by requests of type mss_usbd_vendor_req_t, owned by
+  the application together with their buffers. The data is moved directly
+  between the buffer and the endpoint FIFO by the MSS USB DMA, without being
+  copied by this driver. Each endpoint has a queue of requests:
+  MSS_USBD_VENDOR_submit_in() queues data to be sent to the host and
+  MSS_USBD_VENDOR_submit_out() queues a buffer for the data from the host. When
+  a request is complete the next request of the queue is started by the
+  interrupt handler before the complete call-back function of the finished
+  request is called, so the endpoint stays busy as long as the application
+  keeps requests queued. Two or more requests per endpoint are recommended.
+
+  Each IN request is one USB transfer. When its length is a multiple of the
+  maximum packet size, a zero length packet is added to mark its end, as set by
+  VENDOR_BULK_TX_EP_ZLP. An OUT request completes when its buffer is full or
+  when the host ends the transfer with a short packet; the actual element of
+  the request gives the number of bytes received. A zero length packet from the
+  host completes an OUT request with actual set to 0.
+
+ *//*=========================================================================*/
+
+#ifndef __MSS_USB_DEVICE_VENDOR_H_
+#define __MSS_USB_DEVICE_VENDOR_H_
+
+#include <stdint.h>
+#include "mss_usb_device.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MSS_USB_DEVICE_ENABLED
+/*******************************************************************************
+ USBD-VENDOR configuration definitions: These values will be used by the
+ vendor class driver to configure the MSS USB core endpoints.
+
+ Note:
+ The FIFOs are twice the High Speed maximum packet size so the MSS USB core
+ double buffers the packets. They must not overlap the FIFOs of the control
+ endpoint or of other endpoints used by the application.
+ */
+#define VENDOR_BULK_TX_EP                               MSS_USB_TX_EP_1
+#define VENDOR_BULK_RX_EP                               MSS_USB_RX_EP_1
+
+#define VENDOR_BULK_RX_EP_FIFO_ADDR                     0x100u
+#define VENDOR_BULK_TX_EP_FIFO_ADDR                     0x500u
+#define VENDOR_BULK_EP_FIFO_SIZE                        1024u
+
+#define VENDOR_BULK_TX_EP_DMA_CHANNEL                   MSS_USB_DMA_CHANNEL2
+#define VENDOR_BULK_RX_EP_DMA_CHANNEL                   MSS_USB_DMA_CHANNEL1
+
+#define VENDOR_BULK_TX_EP_ZLP                           ADD_ZLP_TO_XFR
+
+/* Full configuration descriptor length */
+#define VENDOR_CONFIG_DESCR_LENGTH                  (USB_STD_CONFIG_DESCR_LEN + \
+                                                     USB_STD_INTERFACE_DESCR_LEN + \
+                                                     USB_STD_ENDPOINT_DESCR_LEN + \
+                                                     USB_STD_ENDPOINT_DESCR_LEN )
+
+/* Values of the status element of mss_usbd_vendor_req_t */
+#define USBD_VENDOR_REQ_PENDING                         0u
+#define USBD_VENDOR_REQ_DONE                            1u
+#define USBD_VENDOR_REQ_FAILED                          2u
+
+/***************************************************************************//**
+ Exported Types from USBD-VENDOR class driver
+ */
+/***************************************************************************//**
+  mss_usbd_vendor_state_t
+  The mss_usbd_vendor_state_t provides a type to identify the current state of
+  the vendor class driver.
+    USBD_VENDOR_NOT_CONFIGURED - The driver is not configured and it cannot
+                                 perform data transfers.
+    USBD_VENDOR_CONFIGURED     - The driver is configured by the host and it
+                                 can perform data transfers.
+*/
+typedef enum mss_usbd_vendor_state {
+    USBD_VENDOR_NOT_CONFIGURED,
+    USBD_VENDOR_CONFIGURED
+} mss_usbd_vendor_state_t;
+
+/***************************************************************************//**
+  mss_usbd_vendor_req_t
+  The mss_usbd_vendor_req_t type describes a transfer queued on one of the bulk
+  endpoints. The application must not change the request or access its buffer
+  until the request is complete.
+
+  buf
+  The data buffer. It must be word aligned and reachable by the MSS USB DMA.
+
+  length
+  IN requests: the number of bytes to send, not 0.
+  OUT requests: the size of the buffer, a non-zero multiple of 512 bytes.
+
+  actual
+  The number of bytes transferred, set when the request is complete.
+
+  status
+  USBD_VENDOR_REQ_PENDING while the request is queued, USBD_VENDOR_REQ_DONE or
+  USBD_VENDOR_REQ_FAILED when it is complete. Queued requests fail when the
+  device is un-configured or disconnected.
+
+  complete
+  The optional function called from the interrupt handler when the request is
+  complete. The request can be submitted again from this function.
+
+  user_data
+  Not used by the driver.
+
+  next
+  Used by the driver to link the queued requests.
+*/
+typedef struct mss_usbd_vendor_req {
+    uint8_t* buf;
+    uint32_t length;
+    uint32_t actual;
+    volatile uint8_t status;
+    void (*complete)(struct mss_usbd_vendor_req* req);
+    void* user_data;
+    struct mss_usbd_vendor_req* next;
+} mss_usbd_vendor_req_t;
+
+/***************************************************************************//**
+  mss_usbd_vendor_cb_t
+  The mss_usbd_vendor_cb_t type provides the prototype of the optional
+  call-back functions implemented by the application.
+
+  vendor_configured
+  Called when the host has configured the device. OUT requests are typically
+  submitted from this function.
+
+  vendor_released
+  Called when the device is un-configured or disconnected, after the queued
+  requests have been failed.
+
+  vendor_request
+  Called with the vendor and class requests received on the control endpoint.
+  It has the form of the usbd_class_request call-back of the USBD driver: it
+  sets *buf_pp and *length for the data stage and returns USB_SUCCESS, or
+  returns USB_FAIL to stall the request.
+*/
+typedef struct mss_usbd_vendor_cb {
+    void (*vendor_configured)(void);
+    void (*vendor_released)(void);
+    uint8_t (*vendor_request)(mss_usbd_setup_pkt_t* setup_pkt,
+                              uint8_t** buf_pp,
+                              uint32_t* length);
+} mss_usbd_vendor_cb_t;
+
+/***************************************************************************//**
+ Exported functions from USBD-VENDOR class driver
+ */
+
+/***************************************************************************//**
+  @brief MSS_USBD_VENDOR_init()
+  The MSS_USBD_VENDOR_init() function must be used by the application to
+  initialize the vendor class driver.
+
+  @param app_cb
+  The app_cb parameter is a pointer to the application call-back functions. It
+  can be NULL.
+
+  @param speed
+  The speed parameter indicates the USB speed at which this class driver must
+  operate.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+        static const mss_usbd_vendor_cb_t g_vendor_cb =
+        {
+            stream_start,
+            stream_stop,
+            0
+        };
+
+        MSS_USBD_VENDOR_init(&g_vendor_cb, MSS_USB_DEVICE_HS);
+        MSS_USBD_set_desc_cb_handler(&stream_descr_cb);
+        MSS_USBD_init(MSS_USB_DEVICE_HS);
+  @endcode
+*/
+void
+MSS_USBD_VENDOR_init
+(
+    const mss_usbd_vendor_cb_t* app_cb,
+    mss_usb_device_speed_t speed
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_VENDOR_get_state()
+  The MSS_USBD_VENDOR_get_state() function returns the current state of the
+  vendor class driver.
+
+  @param
+    This function does not take a parameter.
+
+  @return
+    This function returns a value of type mss_usbd_vendor_state_t.
+*/
+mss_usbd_vendor_state_t
+MSS_USBD_VENDOR_get_state
+(
+    void
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_VENDOR_submit_in()
+  The MSS_USBD_VENDOR_submit_in() function queues a request to send data to the
+  host on the bulk IN endpoint. The transfer starts straight away when no other
+  IN request is in progress. It can be called from an interrupt handler,
+  including from the complete call-back function of a request.
+
+  @param req
+  The req parameter is a pointer to the request. The buf, length and complete
+  elements must be set by the application.
+
+  @return
+    This function returns USB_SUCCESS when the request was queued. It returns
+    USB_FAIL when the device is not configured or the request is not valid.
+
+  Example:
+  @code
+        static uint8_t g_samples[2][16384] __attribute__ ((aligned (4)));
+        static mss_usbd_vendor_req_t g_in_req[2];
+
+        static void samples_sent(mss_usbd_vendor_req_t* req)
+        {
+            fill_samples(req->buf, req->length);
+            (void)MSS_USBD_VENDOR_submit_in(req);
+        }
+
+        for(i = 0u; i < 2u; i++)
+        {
+            g_in_req[i].buf = g_samples[i];
+            g_in_req[i].length = sizeof(g_samples[i]);
+            g_in_req[i].complete = samples_sent;
+            fill_samples(g_in_req[i].buf, g_in_req[i].length);
+            (void)MSS_USBD_VENDOR_submit_in(&g_in_req[i]);
+        }
+  @endcode
+*/
+uint8_t
+MSS_USBD_VENDOR_submit_in
+(
+    mss_usbd_vendor_req_t* req
+);
+
+/***************************************************************************//**
+  @brief MSS_USBD_VENDOR_submit_out()
+  The MSS_USBD_VENDOR_submit_out() function queues a buffer for data from the
+  host on the bulk OUT endpoint. It can be called from an interrupt handler,
+  including from the complete call-back function of a request.
+
+  @param req
+  The req parameter is a pointer to the request. The buf, length and complete
+  elements must be set by the application.
+
+  @return
+    This function returns USB_SUCCESS when the request was queued. It returns
+    USB_FAIL when the device is not configured or the request is not valid.
+*/
+uint8_t
+MSS_USBD_VENDOR_submit_out
+(
+    mss_usbd_vendor_req_t* req
+);
+
+#endif  //MSS_USB_DEVICE_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __MSS_USB_DEVICE_VENDOR_H_ */
@@ -600,6 +600,27 @@ MSS_USBH_get_tdev_state
     return (g_tdev[tid].state);
 }
 
+/******************************************************************************
+ * See mss_usb_host.h for details of how to use this function.
+ */
+mss_usb_device_speed_t
+MSS_USBH_get_tdev_speed
+(
+    uint8_t target_addr
+)
+{
+    tdev_id_t tid = (tdev_id_t)0;
+
+    if (target_addr)
+    {
+        tid = (tdev_id_t)(target_addr & 0x03u);
+    }
+
+    ASSERT(g_tdev[tid].addr == target_addr);
+
+    return (g_tdev[tid].speed);
+}
+
 /******************************************************************************
  * See mss_usb_host.h for details of how to use this function.
  */
@@ -1901,7 +1922,9 @@ mss_usbh_ep_rx_cb
                     MSS_USB_CIF_rx_ep_clr_rxpktrdy((mss_usb_ep_num_t)ep_num);
                 }
 
-                if (rxep_ptr->xfr_count == rxep_ptr->xfr_length)
+                /* A short packet ends the transfer */
+                if ((rxep_ptr->xfr_count == rxep_ptr->xfr_length) ||
+                    (received_count < rxep_ptr->max_pkt_size))
                 {
                     transfer_complete = 1u;
                 }
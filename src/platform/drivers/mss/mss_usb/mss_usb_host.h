@@ -259,6 +259,9 @@
   | MSS_USBH_get_tdev_state()    | Used to find out the current state of the   |
   |                              | attached device                             |
   |                              |                                             |
+  | MSS_USBH_get_tdev_speed()    | Used to find out the USB speed of the       |
+  |                              | attached device                             |
+  |                              |                                             |
   | MSS_USBH_suspend()           | Suspends the MSS USB core. No frames are    |
   |                              | transferred                                 |
   |                              |                                             |
@@ -1411,6 +1414,33 @@ MSS_USBH_get_tdev_state
     uint8_t target_addr
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_USBH_get_tdev_speed() function can be used to find out the USB speed
+  at which the attached device is operating. The USBH-Class drivers use it to
+  interpret the bInterval field of the endpoint descriptors.
+
+  @param target_addr
+    The target_addr parameter is the address of the attached device with which
+    the MSS USB needs to communicate.
+
+  @return
+    This function returns a value of type mss_usb_device_speed_t indicating the
+    speed of the attached device.
+
+  Example:
+  @code
+      if (MSS_USB_DEVICE_HS == MSS_USBH_get_tdev_speed(g_hid_tdev_addr))
+      {
+          interval = (1u << (b_interval - 1u));
+      }
+  @endcode
+ */
+mss_usb_device_speed_t
+MSS_USBH_get_tdev_speed
+(
+    uint8_t target_addr
+);
+
 /*-------------------------------------------------------------------------*//**
   The MSS_USBH_suspend() function can be used to suspend the MSS USB. The MSS
   USB will complete the current transaction then stop the transaction scheduler
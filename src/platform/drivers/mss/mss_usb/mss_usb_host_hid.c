@@ -44,6 +44,7 @@ extern "C" {
 #define USBH_HID_DESC                                       0x21
 #define USBH_HID_REPORT_DESC                                0x22
 #define USBH_HID_SET_IDLE                                   0x0A
+#define USBH_HID_EP_DESCR_INTERVAL_IDX                      33u
 
 #define HID_MIN_POLL                           10
 #define HC_PID_DATA0                           0
@@ -89,7 +90,6 @@ uint8_t g_hid_report[50] = {0};
 volatile uint8_t toggle_in = 0;
 HID_State HID_Machine_state= HID_IDLE;
 volatile uint8_t next = 0;
-volatile uint8_t USBH_HID_RX_buffer[10] = {0x00};
 
 /***************************************************************************//**
   Types internally used by USBH-HID driver.
@@ -98,6 +98,7 @@ typedef struct {
  uint8_t num;
  uint16_t maxpktsz;
  uint16_t desclen;
+ uint8_t interval;
 } tdev_ep_t;
 
 /***************************************************************************//**
@@ -116,6 +117,15 @@ static volatile mss_usbh_hid_state_t g_hid_state = USBH_HID_IDLE;
 static mss_usbh_hid_err_code_t g_hidh_error_code = USBH_HID_NO_ERROR;
 static mss_usbh_hid_user_cb_t* g_hidh_user_cb;
 
+/* Reports received from the device and not yet passed to the application */
+static mss_usbh_hid_report_t g_hid_report_queue[MSS_USBH_HID_REPORT_QUEUE_SIZE];
+static volatile uint32_t g_hid_rq_wr = 0u;
+static volatile uint32_t g_hid_rq_rd = 0u;
+static volatile uint32_t g_hid_rq_count = 0u;
+
+/* Set while an IN transfer into the queue is pending on the interrupt pipe */
+static volatile uint8_t g_hid_in_busy = 0u;
+
 static uint8_t usbh_hid_allocate_cb(uint8_t tdev_addr);
 static uint8_t usbh_hid_release_cb(uint8_t tdev_addr);
 static uint8_t usbh_hid_cep_done_cb(uint8_t tdev_addr, 
@@ -127,6 +137,9 @@ static uint8_t usbh_hid_rx_cb(uint8_t tdev_addr, uint8_t status, uint32_t count)
 static mss_usbh_hid_err_code_t MSS_USBH_HID_validate_class_desc(uint8_t* p_cd);
 static mss_usbh_hid_err_code_t MSS_USBH_HID_extract_tdev_ep_desc(void);
 static void USBH_HID_Handle(void);
+static void usbh_hid_start_in(void);
+static void usbh_hid_reset_queue(void);
+static uint32_t usbh_hid_poll_interval(void);
 
 /***************************************************************************//**
   Definition of Class call-back functions used by USBH driver.
@@ -162,6 +175,7 @@ MSS_USBH_HID_init
     g_hid_tdev_addr = 0u;
     g_hidh_user_cb = user_sb;
     HID_Machine_state= HID_IDLE;
+    usbh_hid_reset_queue();
 }
 
 /******************************************************************************
@@ -447,6 +461,42 @@ MSS_USBH_HID_get_state
     return (g_hid_state);
 }
 
+/*******************************************************************************
+ * See mss_usb_host_hid.h for details of how to use this function.
+ */
+uint8_t
+MSS_USBH_HID_get_report
+(
+    mss_usbh_hid_report_t* report
+)
+{
+    uint64_t saved;
+    uint8_t result = 0u;
+
+    if (0 != report)
+    {
+        saved = disable_interrupts();
+
+        if (0u != g_hid_rq_count)
+        {
+            *report = g_hid_report_queue[g_hid_rq_rd];
+            g_hid_rq_rd = (g_hid_rq_rd + 1u) % MSS_USBH_HID_REPORT_QUEUE_SIZE;
+            g_hid_rq_count--;
+            result = 1u;
+
+            /* Resume polling if it was stopped because the queue was full */
+            if (HID_READ_DATA == HID_Machine_state)
+            {
+                usbh_hid_start_in();
+            }
+        }
+
+        restore_interrupts(saved);
+    }
+
+    return (result);
+}
+
 /*******************************************************************************
  * Internal Functions
  ******************************************************************************/
@@ -481,6 +531,8 @@ usbh_hid_release_cb
     g_tdev_in_ep.maxpktsz = 0u;
     g_tdev_in_ep.num = 0u;
     g_hid_tdev_addr = 0u;
+    HID_Machine_state = HID_IDLE;
+    usbh_hid_reset_queue();
 
     MSS_USB_CIF_dma_clr_ctrlreg(MSS_USB_DMA_CHANNEL2);
 
@@ -540,8 +592,20 @@ usbh_hid_rx_cb
     uint32_t count
 )
 {
+    g_hid_in_busy = 0u;
+
     if (0 == status)
     {
+        if (0u != count)
+        {
+            g_hid_report_queue[g_hid_rq_wr].length = (uint16_t)count;
+            g_hid_report_queue[g_hid_rq_wr].timestamp = MSS_USBH_get_milis();
+            g_hid_rq_wr = (g_hid_rq_wr + 1u) % MSS_USBH_HID_REPORT_QUEUE_SIZE;
+            g_hid_rq_count++;
+        }
+
+        /* The core waits for the polling interval before the next IN token */
+        usbh_hid_start_in();
         g_usbh_hid_rx_event = 1u;
     }
     else
@@ -549,7 +613,7 @@ usbh_hid_rx_cb
         if (MSS_USB_EP_NAK_TOUT & status)
         {
             /* Device responding with NAKs. Retry*/
-            g_hid_state = USBH_HID_DEVICE_RETRY;
+            usbh_hid_start_in();
         }
         else
         {
@@ -596,7 +660,15 @@ MSS_USBH_HID_extract_tdev_ep_desc
 
         g_tdev_in_ep.desclen = (uint16_t)((g_hid_conf_desc[26u] << 8u) |
                                            (g_hid_conf_desc[25u]));
-                
+
+        g_tdev_in_ep.interval =
+                            g_hid_conf_desc[USBH_HID_EP_DESCR_INTERVAL_IDX];
+
+        /* Reports are received directly into the report queue entries */
+        if (g_tdev_in_ep.maxpktsz > USBH_HID_REPORT_MAX_SIZE)
+        {
+            return (USBH_HID_EP_NOT_VALID);
+        }
     }
     else
     {
@@ -611,13 +683,12 @@ MSS_USBH_HID_extract_tdev_ep_desc
  */
 static void USBH_HID_Handle(void)
 {
-    static uint32_t wait_mili = 0;
+    mss_usbh_hid_report_t report;
+    uint64_t saved;
 
     switch (HID_Machine_state)
     {  
         case HID_IDLE:
-            HID_Machine_state = HID_GET_DATA;
-
             MSS_USBH_configure_in_pipe(g_hid_tdev_addr,
             USBH_HID_INTR_RX_PIPE,
             g_tdev_in_ep.num,
@@ -629,40 +700,23 @@ static void USBH_HID_Handle(void)
             MSS_USB_DMA_CHANNEL2,
             MSS_USB_XFR_INTERRUPT,
             ADD_ZLP_TO_XFR,
-            32768);
+            usbh_hid_poll_interval());
 
+            usbh_hid_reset_queue();
             HID_Machine_state = HID_READ_DATA;
-        break;
-
-        case HID_READ_DATA:
-            MSS_USBH_read_in_pipe(g_hid_tdev_addr,
-            USBH_HID_INTR_RX_PIPE,
-            g_tdev_in_ep.num,
-            g_tdev_in_ep.maxpktsz,
-            (uint8_t*)&USBH_HID_RX_buffer,
-            g_tdev_in_ep.maxpktsz);
-
-            HID_Machine_state = HID_POLL;
-
-            wait_mili = MSS_USBH_get_milis();
 
+            saved = disable_interrupts();
+            usbh_hid_start_in();
+            restore_interrupts(saved);
         break;
 
-        case HID_POLL:
-            if ((MSS_USBH_get_milis() - wait_mili) > HID_MIN_POLL)
-            {
-                HID_Machine_state = HID_WAIT_READ_DATA;
-            }
-        break;
-
-        case HID_WAIT_READ_DATA:
-            if (g_usbh_hid_rx_event)
+        case HID_READ_DATA:
+            /* Pass the reports received since the last call in one batch */
+            if (0 != g_hidh_user_cb->hidh_decode)
             {
-                g_usbh_hid_rx_event = 0;
-                HID_Machine_state = HID_READ_DATA;
-                if (0 != g_hidh_user_cb->hidh_decode)
+                while (0u != MSS_USBH_HID_get_report(&report))
                 {
-                    g_hidh_user_cb->hidh_decode((uint8_t*)&USBH_HID_RX_buffer);
+                    g_hidh_user_cb->hidh_decode(report.data);
                 }
             }
         break;
@@ -673,6 +727,64 @@ static void USBH_HID_Handle(void)
 
 }
 
+/*
+  This function starts the IN transfer into the next free entry of the report
+  queue. It is called with the interrupts disabled or from the USB interrupt.
+ */
+static void usbh_hid_start_in(void)
+{
+    if ((0u == g_hid_in_busy) &&
+        (g_hid_rq_count < MSS_USBH_HID_REPORT_QUEUE_SIZE))
+    {
+        g_hid_in_busy = 1u;
+        MSS_USBH_read_in_pipe(g_hid_tdev_addr,
+                              USBH_HID_INTR_RX_PIPE,
+                              g_tdev_in_ep.num,
+                              g_tdev_in_ep.maxpktsz,
+                              g_hid_report_queue[g_hid_rq_wr].data,
+                              g_tdev_in_ep.maxpktsz);
+    }
+}
+
+/*
+  This function empties the report queue.
+ */
+static void usbh_hid_reset_queue(void)
+{
+    g_hid_rq_wr = 0u;
+    g_hid_rq_rd = 0u;
+    g_hid_rq_count = 0u;
+    g_hid_in_busy = 0u;
+}
+
+/*
+  This function converts the bInterval value of the interrupt IN endpoint
+  descriptor to the polling interval used by the MSS USB core, in frames for
+  full and low speed devices and in micro frames for high speed devices.
+ */
+static uint32_t usbh_hid_poll_interval(void)
+{
+    uint32_t interval = g_tdev_in_ep.interval;
+
+    if (0u == interval)
+    {
+        interval = 1u;
+    }
+
+    if (MSS_USB_DEVICE_HS == MSS_USBH_get_tdev_speed(g_hid_tdev_addr))
+    {
+        /* bInterval is the exponent of the period, 1 to 16 */
+        if (interval > 16u)
+        {
+            interval = 16u;
+        }
+
+        interval = (1u << (interval - 1u));
+    }
+
+    return (interval);
+}
+
 #endif /* MSS_USB_HOST_ENABLED */
 
 #ifdef __cplusplus
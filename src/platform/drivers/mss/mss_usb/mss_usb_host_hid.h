@@ -114,10 +114,19 @@
 
   This driver only needs to perform the USB IN transfers on the Interrupt
   endpoint. The period at which this transfer is repeated is defined by the
-  device endpoint descriptor during the enumeration process. The application
-  must call the USBH_HID_Handle() function periodically to read the report from
-  the HID device. The application must register the call back function which
-  will be called by the USBH driver when the report is received.
+  bInterval field of the device endpoint descriptor. This driver programs that
+  interval into the interrupt IN pipe, so the MSS USB core issues the IN tokens
+  on the polling interval of the device by itself. Each received report is
+  stored in a queue of MSS_USBH_HID_REPORT_QUEUE_SIZE entries by the USB
+  interrupt handler, which then immediately requests the next report. When the
+  queue is full, polling stops until the application takes a report.
+
+  The reports can be taken from the queue with MSS_USBH_HID_get_report(). When
+  the hidh_decode call-back function is provided, MSS_USBH_HID_task() instead
+  passes all the queued reports to it, in the order in which they were
+  received. MSS_USBH_HID_task() therefore does not need to run at the polling
+  interval of the device; it can be called from a timer at the rate at which
+  the application wants to process the reports.
   
  *//*=========================================================================*/
 
@@ -132,6 +141,19 @@ extern "C" {
 #endif
 
 #ifdef MSS_USB_HOST_ENABLED
+
+/*-------------------------------------------------------------------------*//**
+  Number of reports that the USBH-HID driver can hold until they are taken by
+  the application. It can be overridden in mss_usb_config.h.
+ */
+#ifndef MSS_USBH_HID_REPORT_QUEUE_SIZE
+#define MSS_USBH_HID_REPORT_QUEUE_SIZE                      8u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Maximum size of a report, which is the size of the interrupt IN pipe FIFO.
+ */
+#define USBH_HID_REPORT_MAX_SIZE                            64u
   
 /*-------------------------------------------------------------------------*//**
   Types exported from USBH-HID driver
@@ -251,6 +273,28 @@ typedef struct mss_usbh_hid_user_cb
   
 } mss_usbh_hid_user_cb_t;
 
+/*-------------------------------------------------------------------------*//**
+  The mss_usbh_hid_report_t type holds one report received from the attached
+  HID class device.
+
+  data
+  The data element contains the report as received from the device.
+
+  length
+  The length element gives the number of bytes of the report.
+
+  timestamp
+  The timestamp element gives the value of MSS_USBH_get_milis() when the
+  report was received.
+ */
+typedef struct mss_usbh_hid_report
+{
+  uint8_t data[USBH_HID_REPORT_MAX_SIZE];
+  uint16_t length;
+  uint32_t timestamp;
+
+} mss_usbh_hid_report_t;
+
 
 /*----------------------------------------------------------------------------*/
 /*----------------------MSS USBH-HID Public APIs------------------------------*/
@@ -368,6 +412,34 @@ MSS_USBH_HID_get_state
     void
 );
 
+/***************************************************************************//**
+  The MSS_USBH_HID_get_report() function takes the oldest report from the
+  report queue of the USBH-HID driver. It can be called from any context.
+
+  @param report
+    The report parameter is a pointer to the structure into which the report
+    is copied.
+
+  @return
+    This function returns 1 when a report was copied and 0 when the queue was
+    empty.
+
+  Example:
+  @code
+      mss_usbh_hid_report_t report;
+
+      while (MSS_USBH_HID_get_report(&report))
+      {
+          process_report(report.data, report.length);
+      }
+  @endcode
+ */
+uint8_t
+MSS_USBH_HID_get_report
+(
+    mss_usbh_hid_report_t* report
+);
+
 #endif  /* MSS_USB_HOST_ENABLED */
 
 #ifdef __cplusplus
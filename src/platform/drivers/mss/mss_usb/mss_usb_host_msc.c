@@ -51,6 +51,15 @@ extern "C" {
 #define USBH_MSC_BULK_TX_PIPE_FIFOSZ                        0x200u
 #define USBH_MSC_BULK_RX_PIPE_FIFOSZ                        0x200u
 
+#ifdef MSS_USBH_MSC_DMA
+#define USBH_MSC_BULK_DMA                                   DMA_ENABLE
+#else
+#define USBH_MSC_BULK_DMA                                   DMA_DISABLE
+#endif
+
+#define USBH_MSC_CSW_LEN                                    13u
+#define USBH_MSC_REQ_MAX_COUNT                              0xFFFFu
+
 /***************************************************************************//**
   Types internally used by USBH-MSC driver.
  */
@@ -126,6 +135,11 @@ static mss_usbh_msc_err_code_t g_msch_error_code = USBH_MSC_NO_ERROR;
 
 static mss_usbh_msc_user_cb_t* g_msch_user_cb;
 
+/* Requests queued by MSS_USBH_MSC_submit() and the one on the bus */
+static mss_usbh_msc_req_t* g_req_head = 0;
+static mss_usbh_msc_req_t* g_req_tail = 0;
+static mss_usbh_msc_req_t* volatile g_req_active = 0;
+
 static uint8_t usbh_msc_allocate_cb(uint8_t tdev_addr);
 static uint8_t usbh_msc_release_cb(uint8_t tdev_addr);
 static uint8_t usbh_msc_cep_done_cb(uint8_t tdev_addr, uint8_t status, uint32_t count);
@@ -142,6 +156,10 @@ static void usbh_msc_construct_class_req(uint8_t* buf,
                                          uint8_t req,
                                          uint8_t bInterfaceNumber);
 
+static void usbh_msc_start_next_req(void);
+static void usbh_msc_complete_req(uint32_t count);
+static void usbh_msc_flush_reqs(void);
+
 /***************************************************************************//**
   Definition of Class call-back functions used by USBH driver.
  */
@@ -188,6 +206,10 @@ MSS_USBH_MSC_init
     g_scsi_command.dbuf_len = 0u;
     g_scsi_command.st = 0u;
     memset(g_bot_readcap, 0u, sizeof(g_bot_readcap));
+
+    g_req_head = 0;
+    g_req_tail = 0;
+    g_req_active = 0;
 }
 
 /******************************************************************************
@@ -405,7 +427,7 @@ MSS_USBH_MSC_task
                                         USBH_MSC_BULK_TX_PIPE_FIFOSZ,
                                         g_tdev_out_ep.maxpktsz,
                                         1,
-                                        DMA_DISABLE,
+                                        USBH_MSC_BULK_DMA,
                                         MSS_USB_DMA_CHANNEL1,
                                         MSS_USB_XFR_BULK,
                                         NO_ZLP_TO_XFR,
@@ -418,7 +440,7 @@ MSS_USBH_MSC_task
                                        USBH_MSC_BULK_RX_PIPE_FIFOSZ,
                                        g_tdev_in_ep.maxpktsz,
                                        1,
-                                       DMA_DISABLE,
+                                       USBH_MSC_BULK_DMA,
                                        MSS_USB_DMA_CHANNEL2,
                                        MSS_USB_XFR_BULK,
                                        NO_ZLP_TO_XFR,
@@ -1030,10 +1052,226 @@ MSS_USBH_MSC_write
     }
 }
 
+/*******************************************************************************
+ * See mss_usb_host_msc.h for details of how to use this function.
+ */
+uint8_t
+MSS_USBH_MSC_sc_read
+(
+    uint8_t* buf,
+    uint32_t sector,
+    uint32_t count
+)
+{
+    uint8_t status = 1u;
+
+    if ((USBH_MSC_DEVICE_READY == MSS_USBH_MSC_get_state()) &&
+        (0 == MSS_USBH_MSC_read(buf, sector, count)))
+    {
+        while (0u != MSS_USBH_MSC_is_scsi_req_complete())
+        {
+            ;
+        }
+        status = 0u;
+    }
+
+    return (status);
+}
+
+/*******************************************************************************
+ * See mss_usb_host_msc.h for details of how to use this function.
+ */
+uint8_t
+MSS_USBH_MSC_sc_write
+(
+    const uint8_t* buf,
+    uint32_t sector,
+    uint32_t count
+)
+{
+    uint8_t status = 1u;
+
+    if ((USBH_MSC_DEVICE_READY == MSS_USBH_MSC_get_state()) &&
+        (0 == MSS_USBH_MSC_write((uint8_t*)buf, sector, count)))
+    {
+        while (0u != MSS_USBH_MSC_is_scsi_req_complete())
+        {
+            ;
+        }
+        status = 0u;
+    }
+
+    return (status);
+}
+
+/*******************************************************************************
+ * See mss_usb_host_msc.h for details of how to use this function.
+ */
+int8_t
+MSS_USBH_MSC_submit
+(
+    mss_usbh_msc_req_t* req
+)
+{
+    uint64_t saved;
+    int8_t ret = -1;
+
+    if ((0 != req) && (0 != req->buf) && (0u != req->count) &&
+        (req->count <= USBH_MSC_REQ_MAX_COUNT) &&
+        ((USBH_MSC_REQ_READ == req->dir) || (USBH_MSC_REQ_WRITE == req->dir)) &&
+        ((USBH_MSC_DEVICE_READY == g_msc_state) ||
+         (USBH_MSC_BOT_RETRY == g_msc_state)))
+    {
+        req->status = USBH_MSC_REQ_PENDING;
+        req->next = 0;
+
+        saved = disable_interrupts();
+
+        if (0 == g_req_tail)
+        {
+            g_req_head = req;
+        }
+        else
+        {
+            g_req_tail->next = req;
+        }
+        g_req_tail = req;
+
+        if ((0 == g_req_active) && (0u == g_scsi_command.st))
+        {
+            usbh_msc_start_next_req();
+        }
+
+        restore_interrupts(saved);
+        ret = 0;
+    }
+
+    return (ret);
+}
+
 /*******************************************************************************
  * Internal Functions
  ******************************************************************************/
 
+/*
+ * Sends the CBW of the first queued request. Called with the interrupts
+ * disabled or from the interrupt handler, when no command is in progress.
+ */
+static void
+usbh_msc_start_next_req
+(
+    void
+)
+{
+    mss_usbh_msc_req_t* req = g_req_head;
+
+    if (0 != req)
+    {
+        g_req_head = req->next;
+        if (0 == g_req_head)
+        {
+            g_req_tail = 0;
+        }
+        req->next = 0;
+        g_req_active = req;
+
+        g_scsi_command.st = 1u;
+        MSS_USBH_MSC_construct_cbw_cb10byte((USBH_MSC_REQ_READ == req->dir) ?
+                                            USB_MSC_SCSI_READ_10 :
+                                            USB_MSC_SCSI_WRITE_10,
+                                            0u,
+                                            req->sector,
+                                            req->count,
+                                            512u,
+                                            &g_bot_cbw);
+
+        MSS_USBH_MSC_scsi_req((uint8_t*)&g_bot_cbw,
+                              req->buf,
+                              (req->count * 512u),
+                              (uint8_t*)&g_bot_csw);
+    }
+}
+
+/*
+ * Completes the active request once its CSW is received. The next request is
+ * put on the bus before the completion call-back is called so that the bus
+ * does not wait for the application.
+ */
+static void
+usbh_msc_complete_req
+(
+    uint32_t count
+)
+{
+    mss_usbh_msc_req_t* req = g_req_active;
+    uint32_t signature;
+
+    signature = ((uint32_t)g_bot_csw[3] << 24u) |
+                ((uint32_t)g_bot_csw[2] << 16u) |
+                ((uint32_t)g_bot_csw[1] << 8u) |
+                (uint32_t)g_bot_csw[0];
+
+    if ((USBH_MSC_CSW_LEN == count) &&
+        (USB_MSC_BOT_CSW_SIGNATURE == signature) &&
+        (0u == g_bot_csw[12]))
+    {
+        req->status = USBH_MSC_REQ_DONE;
+    }
+    else
+    {
+        req->status = USBH_MSC_REQ_FAILED;
+    }
+
+    g_req_active = 0;
+    usbh_msc_start_next_req();
+
+    if (0 != req->complete)
+    {
+        req->complete(req);
+    }
+}
+
+/*
+ * Fails the active and all queued requests when the device is released.
+ */
+static void
+usbh_msc_flush_reqs
+(
+    void
+)
+{
+    mss_usbh_msc_req_t* req;
+    mss_usbh_msc_req_t* next;
+    uint64_t saved;
+
+    saved = disable_interrupts();
+    req = g_req_active;
+    if (0 != req)
+    {
+        req->next = g_req_head;
+    }
+    else
+    {
+        req = g_req_head;
+    }
+    g_req_head = 0;
+    g_req_tail = 0;
+    g_req_active = 0;
+    restore_interrupts(saved);
+
+    while (0 != req)
+    {
+        next = req->next;
+        req->next = 0;
+        req->status = USBH_MSC_REQ_FAILED;
+        if (0 != req->complete)
+        {
+            req->complete(req);
+        }
+        req = next;
+    }
+}
+
 /*
  * This Call-back function is executed when the USBH-MSC driver is allocated
  * to the attached device by USBH driver.
@@ -1086,6 +1324,8 @@ usbh_msc_release_cb
     MSS_USB_CIF_rx_ep_clr_csrreg(USBH_MSC_BULK_TX_PIPE);
     MSS_USB_CIF_dma_clr_ctrlreg(MSS_USB_DMA_CHANNEL1);
 
+    usbh_msc_flush_reqs();
+
     if (0 != g_msch_user_cb->msch_driver_released)
     {
         g_msch_user_cb->msch_driver_released();
@@ -1252,6 +1492,11 @@ usbh_msc_rx_cb
                 g_usbh_msc_rx_event = 0u;
                 g_scsi_command.st = 0u;
                 g_msc_bot_state = MSC_BOT_IDLE;
+
+                if (0 != g_req_active)
+                {
+                    usbh_msc_complete_req(count);
+                }
             break;
 
             default:
@@ -148,7 +148,25 @@
   full use of this feature by passing on the multi-sector transfers from the
   application to the USBH driver. To free up the application from transferring
   data to/from MSS USB FIFO, this driver can configure USBH driver to use the
-  MSS USB internal DMA.
+  MSS USB internal DMA. Define MSS_USBH_MSC_DMA in the project settings to have
+  the bulk pipes use the MSS USB DMA channels 1 (OUT) and 2 (IN), see
+  mss_usb_config.h.
+
+  --------------------------------
+  Streaming transfers
+  --------------------------------
+  The BoT protocol allows only one command at a time on the bus, so with
+  MSS_USBH_MSC_read() and MSS_USBH_MSC_write() the application has to wait for
+  the CSW of a command before it can start the next one, and the bus is idle
+  while the application handles the data. The MSS_USBH_MSC_submit() function
+  queues a request described by a mss_usbh_msc_req_t structure instead. When
+  the CSW of a request is received, the driver sends the CBW of the next queued
+  request from the interrupt handler before calling the completion call-back of
+  the request just finished. With two or more buffers queued, the application
+  works on one buffer while the next is transferred, and the CBW, data and CSW
+  phases of consecutive commands follow each other without a gap. Large
+  requests, for example 64 KB or more, combined with MSS_USBH_MSC_DMA, keep the
+  number of commands and interrupts per megabyte low.
 
   The MSS_USBH_MSC_construct_cbw_cb10byte() and MSS_USBH_MSC_construct_cbw_cb6byte()
   functions are provided so that the user can easily prepare the CBW format
@@ -399,6 +417,56 @@ typedef struct {
  uint32_t dCSWStatus;
 } msd_csw_t;
 
+/*-------------------------------------------------------------------------*//**
+  The mss_usbh_msc_req_t type describes a READ_10 or WRITE_10 request queued
+  using the MSS_USBH_MSC_submit() function. The application owns the structure
+  and the data buffer, and must not change either of them until the request is
+  complete.
+
+  buf
+    The data buffer, count * 512 bytes.
+
+  sector, count
+    The first sector and the number of sectors to be transferred.
+
+  dir
+    USBH_MSC_REQ_READ or USBH_MSC_REQ_WRITE.
+
+  status
+    Set to USBH_MSC_REQ_PENDING by MSS_USBH_MSC_submit() and to
+    USBH_MSC_REQ_DONE or USBH_MSC_REQ_FAILED when the request is complete. A
+    request fails when the device reports a failure in the CSW, or when the
+    device is detached while the request is queued.
+
+  complete
+    The optional function called from the interrupt handler when the request is
+    complete. The request can be submitted again from this function.
+
+  user_data
+    Not used by the driver.
+
+  next
+    Used by the driver to link the queued requests.
+ */
+#define USBH_MSC_REQ_READ                               0u
+#define USBH_MSC_REQ_WRITE                              1u
+
+#define USBH_MSC_REQ_PENDING                            0u
+#define USBH_MSC_REQ_DONE                               1u
+#define USBH_MSC_REQ_FAILED                             2u
+
+typedef struct mss_usbh_msc_req
+{
+    uint8_t* buf;
+    uint32_t sector;
+    uint32_t count;
+    uint8_t dir;
+    volatile uint8_t status;
+    void (*complete)(struct mss_usbh_msc_req* req);
+    void* user_data;
+    struct mss_usbh_msc_req* next;
+} mss_usbh_msc_req_t;
+
 /*-------------------------------------------------------------------------*//**
   EXPORTED APIs from USBH-MSC driver
   ============================
@@ -648,6 +716,100 @@ MSS_USBH_MSC_write
     uint32_t count
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_USBH_MSC_sc_read() and MSS_USBH_MSC_sc_write() functions read and
+  write sectors using MSS_USBH_MSC_read() and MSS_USBH_MSC_write(), and wait
+  until MSS_USBH_MSC_is_scsi_req_complete() indicates that the transfer is
+  complete. They have the form of the device functions of the MPFS HAL sector
+  cache, see mss_sector_cache.h, so the cache can be used in front of the
+  attached mass storage device. The sector size of the device must be 512
+  bytes.
+
+  @param buf
+    The buf parameter is a pointer to the data buffer.
+
+  @param sector
+    The sector parameter indicates the first sector to be transferred.
+
+  @param count
+    The count parameter indicates the number of sectors to be transferred.
+
+  @return
+    These functions return 0 when the transfer was completed and 1 when the
+    device is not ready or a previous command is still in progress.
+
+  Example:
+  @code
+      cfg.read = MSS_USBH_MSC_sc_read;
+      cfg.write = MSS_USBH_MSC_sc_write;
+      (void)mss_sector_cache_init(&g_sc, &cfg);
+  @endcode
+*/
+uint8_t
+MSS_USBH_MSC_sc_read
+(
+    uint8_t* buf,
+    uint32_t sector,
+    uint32_t count
+);
+
+uint8_t
+MSS_USBH_MSC_sc_write
+(
+    const uint8_t* buf,
+    uint32_t sector,
+    uint32_t count
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_USBH_MSC_submit() function queues a READ_10 or WRITE_10 request. The
+  request is started straight away when no other command is in progress,
+  otherwise it is started from the interrupt handler when the requests queued
+  before it are complete. Requests are completed in the order in which they
+  were submitted. MSS_USBH_MSC_read(), MSS_USBH_MSC_write() and
+  MSS_USBH_MSC_scsi_req() must not be used while requests are queued, and
+  MSS_USBH_MSC_is_scsi_req_complete() returns 1 until the queue is empty.
+
+  @param req
+    The req parameter is a pointer to the request. The buf, sector, count, dir
+    and complete elements must be set by the application.
+
+  @return
+    This function returns 0 when the request was queued, or -1 when the device
+    is not in the USBH_MSC_DEVICE_READY state or the request is not valid.
+
+  Example:
+  @code
+      static uint8_t g_buf[2][65536] __attribute__ ((aligned (4)));
+      static mss_usbh_msc_req_t g_req[2];
+      static uint32_t g_next_sector;
+
+      static void read_done(mss_usbh_msc_req_t* req)
+      {
+          process(req->buf, req->count * 512u);
+          req->sector = g_next_sector;
+          g_next_sector += req->count;
+          (void)MSS_USBH_MSC_submit(req);
+      }
+
+      for (i = 0u; i < 2u; i++)
+      {
+          g_req[i].buf = g_buf[i];
+          g_req[i].sector = g_next_sector;
+          g_req[i].count = 128u;
+          g_req[i].dir = USBH_MSC_REQ_READ;
+          g_req[i].complete = read_done;
+          g_next_sector += 128u;
+          (void)MSS_USBH_MSC_submit(&g_req[i]);
+      }
+  @endcode
+*/
+int8_t
+MSS_USBH_MSC_submit
+(
+    mss_usbh_msc_req_t* req
+);
+
 /*-------------------------------------------------------------------------*//**
   The MSS_USBH_MSC_get_sector_count() function can be used to find out the
   number of sectors (logical blocks) available on the attached MSC class device.
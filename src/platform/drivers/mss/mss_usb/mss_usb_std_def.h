@@ -186,6 +186,11 @@ extern "C" {
 #define USB_CDC_SET_CONTROL_LINE_STATE                  0x22u
 #define USB_CDC_SEND_BREAK                              0x23u
 
+#define USB_CLASS_CODE_CDC                              0x02u  /* bInterfaceClass */
+#define USB_CLASS_CDC_SUBCLASS_ACM                      0x02u  /* bInterfaceSubClass */
+#define USB_CLASS_CODE_CDC_DATA                         0x0Au  /* bInterfaceClass */
+#define USB_CDC_CS_INTERFACE_DESCRIPTOR_TYPE            0x24u
+
 /*-------------------------------------------------------------------------*//**
   HID class related definitions
  */
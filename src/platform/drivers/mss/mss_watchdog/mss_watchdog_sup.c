@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC (MPFS) Microprocessor Subsystem Watchdog supervisor
+ * implementation.
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "mss_watchdog.h"
+#include "mss_watchdog_sup.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Constant definitions
+ */
+#define WD_SUP_FREE                     0u
+#define WD_SUP_RESERVED                 1u
+#define WD_SUP_ACTIVE                   2u
+
+#define WD_SUP_NUM_WDOGS                10u
+#define WD_SUP_NO_LAST                  0xFFFFFFFFu
+
+/*******************************************************************************
+ * Local variables
+ */
+mss_wd_sup_heartbeat_t g_mss_wd_sup_heartbeats[MSS_WD_SUP_MAX_HEARTBEATS];
+
+static uint32_t g_wd_sup_mask = 0u;
+static mss_wd_sup_stats_t g_wd_sup_stats;
+
+/*******************************************************************************
+ * Local function declarations
+ */
+static uint8_t wd_sup_service(uint32_t last_wd);
+static void wd_sup_refresh(uint32_t wd_num);
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_watchdog_sup.h for details of how to use this function.
+ */
+void MSS_WD_SUP_init(uint32_t wd_mask)
+{
+    uint32_t inc;
+
+    for (inc = 0u; inc < MSS_WD_SUP_MAX_HEARTBEATS; inc++)
+    {
+        __atomic_store_n(&g_mss_wd_sup_heartbeats[inc].state, WD_SUP_FREE,
+                __ATOMIC_RELEASE);
+    }
+
+    g_wd_sup_mask = wd_mask;
+    g_wd_sup_stats.checks = 0u;
+    g_wd_sup_stats.refreshes = 0u;
+    g_wd_sup_stats.stale = 0u;
+    g_wd_sup_stats.forbidden = 0u;
+    g_wd_sup_stats.last_stale = WD_SUP_NO_LAST;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_watchdog_sup.h for details of how to use this function.
+ */
+uint8_t MSS_WD_SUP_register(uint32_t max_missed, uint32_t * id)
+{
+    uint8_t ret_val = ERROR;
+    mss_wd_sup_heartbeat_t * heartbeat;
+    uint32_t expected;
+    uint32_t inc;
+
+    for (inc = 0u; (inc < MSS_WD_SUP_MAX_HEARTBEATS) && (ERROR == ret_val);
+            inc++)
+    {
+        heartbeat = &g_mss_wd_sup_heartbeats[inc];
+        expected = WD_SUP_FREE;
+
+        /* Claim the slot before setting it up, other harts may register too */
+        if (0 != __atomic_compare_exchange_n(&heartbeat->state, &expected,
+                WD_SUP_RESERVED, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            heartbeat->max_missed = max_missed;
+            heartbeat->missed = 0u;
+            heartbeat->last_count = heartbeat->count - 1u;
+            __atomic_store_n(&heartbeat->state, WD_SUP_ACTIVE,
+                    __ATOMIC_RELEASE);
+
+            *id = inc;
+            ret_val = SUCCESS;
+        }
+    }
+
+    return ret_val;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_watchdog_sup.h for details of how to use this function.
+ */
+void MSS_WD_SUP_unregister(uint32_t id)
+{
+    ASSERT(id < MSS_WD_SUP_MAX_HEARTBEATS);
+
+    __atomic_store_n(&g_mss_wd_sup_heartbeats[id].state, WD_SUP_FREE,
+            __ATOMIC_RELEASE);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_watchdog_sup.h for details of how to use this function.
+ */
+uint8_t MSS_WD_SUP_check(void)
+{
+    return wd_sup_service(WD_SUP_NUM_WDOGS);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_watchdog_sup.h for details of how to use this function.
+ */
+void MSS_WD_SUP_mvrp_isr(mss_watchdog_num_t wd_num)
+{
+    MSS_WD_clear_mvrp_irq(wd_num);
+    (void)wd_sup_service((uint32_t)wd_num);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_watchdog_sup.h for details of how to use this function.
+ */
+__attribute__((weak)) void MSS_WD_SUP_stale_handler(uint32_t id)
+{
+    (void)id;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * See mss_watchdog_sup.h for details of how to use this function.
+ */
+void MSS_WD_SUP_get_stats(mss_wd_sup_stats_t * stats)
+{
+    *stats = g_wd_sup_stats;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * Checks the heartbeats and, if none is stale, refreshes the watchdogs of the
+ * mask, last_wd last if it is one of them.
+ */
+static uint8_t wd_sup_service(uint32_t last_wd)
+{
+    uint8_t ret_val = SUCCESS;
+    mss_wd_sup_heartbeat_t * heartbeat;
+    uint32_t count;
+    uint32_t inc;
+
+    g_wd_sup_stats.checks++;
+
+    for (inc = 0u; inc < MSS_WD_SUP_MAX_HEARTBEATS; inc++)
+    {
+        heartbeat = &g_mss_wd_sup_heartbeats[inc];
+
+        if (WD_SUP_ACTIVE == __atomic_load_n(&heartbeat->state,
+                __ATOMIC_ACQUIRE))
+        {
+            count = heartbeat->count;
+
+            if (count != heartbeat->last_count)
+            {
+                heartbeat->last_count = count;
+                heartbeat->missed = 0u;
+            }
+            else if (heartbeat->missed < heartbeat->max_missed)
+            {
+                heartbeat->missed++;
+            }
+            else
+            {
+                g_wd_sup_stats.last_stale = inc;
+                MSS_WD_SUP_stale_handler(inc);
+                ret_val = ERROR;
+            }
+        }
+    }
+
+    if (SUCCESS == ret_val)
+    {
+        for (inc = 0u; inc < WD_SUP_NUM_WDOGS; inc++)
+        {
+            if (inc != last_wd)
+            {
+                wd_sup_refresh(inc);
+            }
+        }
+
+        if (last_wd < WD_SUP_NUM_WDOGS)
+        {
+            wd_sup_refresh(last_wd);
+        }
+
+        g_wd_sup_stats.refreshes++;
+    }
+    else
+    {
+        g_wd_sup_stats.stale++;
+    }
+
+    return ret_val;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * Refreshes a watchdog of the mask, unless it is in its forbidden window.
+ */
+static void wd_sup_refresh(uint32_t wd_num)
+{
+    if (0u != (g_wd_sup_mask & (1u << wd_num)))
+    {
+        if (0u == MSS_WD_forbidden_status((mss_watchdog_num_t)wd_num))
+        {
+            MSS_WD_reload((mss_watchdog_num_t)wd_num);
+        }
+        else
+        {
+            g_wd_sup_stats.forbidden++;
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
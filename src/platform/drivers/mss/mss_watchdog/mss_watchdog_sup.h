@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * PolarFire SoC (MPFS) Microprocessor Subsystem Watchdog supervisor, refreshing
+ * the watchdogs of all the harts from heartbeats.
+ */
+/*=========================================================================*//**
+  @mainpage PolarFire SoC MSS Watchdog supervisor
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  Rather than each hart refreshing its own watchdog from its main loop, the
+  harts and tasks to be watched each register a heartbeat and beat it with
+  MSS_WD_SUP_beat(), which only increments a counter in memory. One hart, the
+  supervisor, checks the heartbeats from time to time with MSS_WD_SUP_check()
+  and refreshes all the watchdogs given to MSS_WD_SUP_init() only if every
+  heartbeat registered has beaten recently enough. A hart or task which stops
+  beating so lets the watchdogs of all the harts run out.
+
+  ==============================================================================
+  Theory of Operation
+  ==============================================================================
+  Each heartbeat has its own cache line, so beating it touches no other data
+  and makes no access to the watchdog registers. At each check the supervisor
+  compares the count of each heartbeat with the count at the last check. A
+  heartbeat is stale once it has not changed for more checks in a row than
+  given when it was registered, e.g. 0 for a heartbeat which must beat
+  between every check. MSS_WD_SUP_stale_handler(), weakly defined, is called
+  for each stale heartbeat found, giving the application the time up to the
+  watchdog timeout to log the fault.
+
+  The checks can be made from the MVRP interrupt of one of the watchdogs,
+  raised when its count falls to the MVRP value and a refresh becomes
+  permitted, by calling MSS_WD_SUP_mvrp_isr() from the handler. The
+  watchdogs should then be configured alike. The watchdog which raised the
+  interrupt is refreshed last, so the others, refreshed just before it, are
+  past their own MVRP value when it next interrupts. A watchdog still in its
+  forbidden window is left for the next check.
+
+  The supervisor functions must be called from one hart only. Heartbeats may
+  be registered and unregistered from any hart.
+
+  Example, watchdogs 0 to 4 refreshed from the MVRP interrupt of watchdog 0
+  on the E51, which must be enabled in the PLIC:
+  @code
+    static uint32_t g_hb_id;
+
+    uint8_t wdog0_mvrp_plic_IRQHandler(void)
+    {
+        MSS_WD_SUP_mvrp_isr(MSS_WDOG0_LO);
+        return EXT_IRQ_KEEP_ENABLED;
+    }
+
+    void e51(void)
+    {
+        MSS_WD_SUP_init(0x1Fu);
+        MSS_WD_enable_mvrp_irq(MSS_WDOG0_LO);
+        PLIC_EnableIRQ(WDOG0_MRVP_PLIC);
+        ...
+    }
+
+    void u54_1(void)
+    {
+        (void)MSS_WD_SUP_register(2u, &g_hb_id);
+
+        for(;;)
+        {
+            do_work();
+            MSS_WD_SUP_beat(g_hb_id);
+        }
+    }
+  @endcode
+ */
+
+#ifndef MSS_WATCHDOG_SUP_H_
+#define MSS_WATCHDOG_SUP_H_
+
+#include <stdint.h>
+#include "mss_watchdog.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Largest number of heartbeats registered at the same time.
+ */
+#ifndef MSS_WD_SUP_MAX_HEARTBEATS
+#define MSS_WD_SUP_MAX_HEARTBEATS           16u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  A heartbeat. Only count is written by the hart or task beating it, the rest
+  by registration and the supervisor.
+ */
+typedef struct
+{
+    volatile uint32_t count;
+    volatile uint32_t state;
+    uint32_t max_missed;
+    uint32_t last_count;
+    uint32_t missed;
+} __attribute__((aligned(64))) mss_wd_sup_heartbeat_t;
+
+/*-------------------------------------------------------------------------*//**
+  Supervisor statistics.
+ */
+typedef struct
+{
+    uint64_t checks;                /* MSS_WD_SUP_check() calls */
+    uint64_t refreshes;             /* Checks refreshing the watchdogs */
+    uint64_t stale;                 /* Checks finding a stale heartbeat */
+    uint64_t forbidden;             /* Refreshes left for the next check */
+    uint32_t last_stale;            /* Last stale heartbeat found */
+} mss_wd_sup_stats_t;
+
+extern mss_wd_sup_heartbeat_t g_mss_wd_sup_heartbeats[MSS_WD_SUP_MAX_HEARTBEATS];
+
+/*-------------------------------------------------------------------------*//**
+  MSS_WD_SUP_init() sets the watchdogs refreshed by the supervisor, bit n of
+  wd_mask standing for watchdog n of mss_watchdog_num_t, e.g. 0x1F for
+  MSS_WDOG0_LO to MSS_WDOG4_LO. The heartbeats are unregistered and the
+  statistics cleared.
+ */
+void MSS_WD_SUP_init(uint32_t wd_mask);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_WD_SUP_register() registers a heartbeat, which may miss max_missed
+  checks in a row before it is stale, and returns its id in id. The heartbeat
+  counts as beaten at the next check.
+
+  @return
+    SUCCESS, or ERROR if MSS_WD_SUP_MAX_HEARTBEATS heartbeats are registered.
+ */
+uint8_t MSS_WD_SUP_register(uint32_t max_missed, uint32_t * id);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_WD_SUP_unregister() unregisters a heartbeat, e.g. before its task is
+  deleted.
+ */
+void MSS_WD_SUP_unregister(uint32_t id);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_WD_SUP_beat() beats a heartbeat. It is only ever called by the one hart
+  or task owning the heartbeat.
+ */
+static inline void MSS_WD_SUP_beat(uint32_t id)
+{
+    g_mss_wd_sup_heartbeats[id].count++;
+}
+
+/*-------------------------------------------------------------------------*//**
+  MSS_WD_SUP_check() checks the heartbeats and refreshes the watchdogs if none
+  is stale.
+
+  @return
+    SUCCESS, or ERROR if a heartbeat was stale and the watchdogs were not
+    refreshed.
+ */
+uint8_t MSS_WD_SUP_check(void);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_WD_SUP_mvrp_isr() clears the MVRP interrupt of wd_num and checks the
+  heartbeats, refreshing wd_num after the other watchdogs. It is called from
+  the MVRP interrupt handler of wd_num.
+ */
+void MSS_WD_SUP_mvrp_isr(mss_watchdog_num_t wd_num);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_WD_SUP_stale_handler() is called by MSS_WD_SUP_check() for each stale
+  heartbeat. The default does nothing.
+ */
+void MSS_WD_SUP_stale_handler(uint32_t id);
+
+/*-------------------------------------------------------------------------*//**
+  MSS_WD_SUP_get_stats() copies the supervisor statistics to stats.
+ */
+void MSS_WD_SUP_get_stats(mss_wd_sup_stats_t * stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_WATCHDOG_SUP_H_ */
@@ -8,6 +8,9 @@
  */
 
 #include "pf_pcie.h"
+#ifdef PF_PCIE_CACHE_MAINTENANCE
+#include "mpfs_hal/mss_hal.h"
+#endif
  
 #ifdef __cplusplus
 extern "C" {
@@ -128,11 +131,17 @@ extern "C" {
 /* EP DMA interrupt and error status */
 #define DMA_INT_STATUS              0x00000003u
 #define DMA_ERR_STATUS              0x00000300u
+/* Per engine bits: DMA0 0 and 8, DMA1 1 and 9 */
+#define DMA_INT_BIT(ch)             (0x00000001u << (ch))
+#define DMA_ERR_BIT(ch)             (0x00000100u << (ch))
+#define DMA_NUM_CHANNELS            PF_PCIE_EP_DMA_CHANNELS
 
 /* Enable PCIe Host MSI, INTx DMAx interrupts */
 #define PCIE_HOST_INT_ENABLE        0x1F000FFFu
 /* Enable PCIe local  DMAx, DMA error interrupts */
 #define PCIE_LOCAL_INT_ENABLE       0x1F0000FFu
+/* MSI summary bit of the root port local interrupt status */
+#define PCIE_LOCAL_MSI_INT          0x10000000u
 /****************************************************************************/
 /* Clear PCIe interrupt events */
 #define PCIE_EVENT_INT_DATA         0x00070007u
@@ -150,25 +159,33 @@ extern "C" {
 #define MASK_32BIT                  0xFFFFFFFFu
 #define SHIFT_32BIT                 32u
 
-struct pcie_dma_instance_t
-{
-  volatile pf_pcie_ep_dma_status_t state;
-  pf_pcie_write_callback_t tx_complete_handler;
-  pf_pcie_read_callback_t rx_complete_handler;
-};
-
-/* EP dma struct variable */
-static struct pcie_dma_instance_t g_pcie_dma;
-
-/* RP and EP bridge and controller structure variable */
-static PCIE_BRIDGE * g_rp_pcie_bridge = PCIE_CLEAR;
-static PCIE_BRIDGE * g_ep_bridge_reg = PCIE_CLEAR;
-static PCIE_CTRL * g_ep_ctrl_reg = PCIE_CLEAR;
-static PCIE_CTRL * g_rp_pcie_ctrl = PCIE_CLEAR;
-
-/* Enumeration and BAR structure variable */
-pf_pcie_ebuff_t g_pcie_enumeration;
-pf_pcie_bar_info_t g_pcie_bar_allocate;
+/*
+ Instance used by the functions without a pf_pcie_instance_t parameter. Being
+ zero initialized, it starts with no root port or endpoint bridge set.
+*/
+static pf_pcie_instance_t g_pcie_default;
+
+static void dma_start(pf_pcie_instance_t * this_pcie, uint8_t ch,
+                      uint64_t src_address, uint64_t dest_address,
+                      uint32_t length, uint64_t rp_cpu_address);
+static const pf_pcie_dma_share_t *
+dma_share_find(const pf_pcie_instance_t * this_pcie, uint64_t cpu_address,
+               uint64_t length);
+static void dma_channel_next(pf_pcie_instance_t * this_pcie, uint8_t ch);
+static void dma_channel_complete(pf_pcie_instance_t * this_pcie, uint8_t ch,
+                                 pf_pcie_ep_dma_status_t status);
+static uint32_t dma_irq_mask(const pf_pcie_instance_t * this_pcie);
+static void dma_irq_restore(const pf_pcie_instance_t * this_pcie,
+                            uint32_t mask);
+static void cfg_window_map(const pf_pcie_instance_t * this_pcie,
+                           uint64_t ecam_addr);
+static void cfg_endpoint_setup(uint64_t src_ecam_addr);
+static void cfg_bridge_setup(uint64_t src_ecam_addr, uint8_t bus_num,
+                             uint32_t prim_sec_num);
+static void cfg_cache_save_entry(pf_pcie_enum_cache_entry_t * entry,
+                                 uint64_t ecam_addr, uint8_t bar_count);
+static uint8_t cfg_cache_restore_entry(const pf_pcie_enum_cache_entry_t * entry,
+                                       uint64_t ecam_addr, uint8_t bar_count);
 
 /**************************************************************************//**
  * See pf_pciess.h for details of how to use this function.
@@ -177,8 +194,9 @@ pf_pcie_bar_info_t g_pcie_bar_allocate;
  *
  */
 pf_pcie_ebuff_t *
-PF_PCIE_enumeration
+PF_PCIE_inst_enumeration
 (
+    pf_pcie_instance_t * this_pcie,
     uint64_t apb_addr,
     uint8_t pcie_ctrl_num,
     uint64_t ecam_addr
@@ -186,9 +204,7 @@ PF_PCIE_enumeration
 {
     PCIE_BRIDGE * p_pcie_bridge;
     PCIE_END_CONF * p_pcie_config_space;
-    PCIE_ROOT_CONF * p_pcie_root_config;
     PCIE_CTRL * p_pcie_ctrl;
-    uint32_t * p_pcie_ep_config_space = PCIE_CLEAR;
     uint32_t pcie_header_type;
     uint32_t pcie_multi_fun;
     uint8_t pcie_bus_num;
@@ -196,17 +212,13 @@ PF_PCIE_enumeration
     uint8_t pcie_fun_num;
     uint16_t pcie_vendor_id;
     uint64_t src_ecam_addr;
-    uint32_t addr_inc;
-    uint32_t p_reg;
-    uint32_t ecam_addr_low;
-    uint32_t ecam_addr_high;
     /* Default attached bridges and devices are 0 */
     uint8_t bridges_attached = PCIE_CLEAR;
     uint8_t devices_attached = PCIE_CLEAR;
     uint32_t prim_sec_num = PRIM_SEC_SUB_BUS_DEFAULT; 
     /* Default bridge and device enumeration number is 0 */
-    g_pcie_enumeration.no_of_bridges_attached = PCIE_CLEAR;
-    g_pcie_enumeration.no_of_devices_attached = PCIE_CLEAR;
+    this_pcie->enumeration.no_of_bridges_attached = PCIE_CLEAR;
+    this_pcie->enumeration.no_of_devices_attached = PCIE_CLEAR;
     /* Check PCIe Controller is 0 or 1 */
     if (PF_PCIE_CTRL_0 == pcie_ctrl_num)
     {
@@ -229,27 +241,9 @@ PF_PCIE_enumeration
     if ((NULL_POINTER != p_pcie_bridge) &&
        (ROOT_PORT_ENABLE == ((p_pcie_bridge->GEN_SETTINGS) & ROOT_PORT_ENABLE)))
     {
-        g_rp_pcie_bridge = p_pcie_bridge;
-        g_rp_pcie_ctrl = p_pcie_ctrl;
-        /* Clear interrupts on PCIe RootPort */
-        p_pcie_ctrl->ECC_CONTROL = PCIE_ECC_DISABLE;
-        p_pcie_ctrl->PCIE_EVENT_INT = PCIE_EVENT_INT_DATA;
-        p_pcie_ctrl->SEC_ERROR_INT = PCIE_SEC_ERROR_INT_CLEAR;
-        p_pcie_ctrl->DED_ERROR_INT = PCIE_DED_ERROR_INT_CLEAR;
-        p_pcie_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
-        p_pcie_bridge->IMASK_LOCAL = PCIE_CLEAR;
-        p_pcie_bridge->ISTATUS_HOST = PCIE_ISTATUS_CLEAR;
-        p_pcie_bridge->IMASK_HOST = PCIE_CLEAR;
-
-        ecam_addr_low = (uint32_t)(ecam_addr & MASK_32BIT);
-        ecam_addr_high = (uint32_t)((ecam_addr >> SHIFT_32BIT) & MASK_32BIT);
-        /* Select PCIe Config space */
-        p_pcie_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_CONFIG_INTERFACE;
-        /* Address Translation table setup */
-        p_pcie_bridge->ATR0_AXI4_SLV0_SRCADDR_PARAM = ecam_addr_low | SIZE_256MB_TRANSLATE_TABLE_EN;
-        p_pcie_bridge->ATR0_AXI4_SLV0_SRC_ADDR = ecam_addr_high;
-        p_pcie_bridge->ATR0_AXI4_SLV0_TRSL_ADDR_LSB = ecam_addr_low;
-        p_pcie_bridge->ATR0_AXI4_SLV0_TRSL_ADDR_UDW = ecam_addr_high;
+        this_pcie->rp_bridge = p_pcie_bridge;
+        this_pcie->rp_ctrl = p_pcie_ctrl;
+        cfg_window_map(this_pcie, ecam_addr);
         /* Enumeration starts here */
         for (pcie_bus_num = PCIE_CLEAR; pcie_bus_num < PCIE_CFG_MAX_NUM_OF_BUS; pcie_bus_num++)
         {
@@ -282,77 +276,27 @@ PF_PCIE_enumeration
                         /* Check header type is type0 for PCIe EndPoint */
                         if (PCIE_CFG_HEADER_O_TYPE == pcie_header_type)
                         {
-                            g_pcie_enumeration.devices[devices_attached].bus_num = pcie_bus_num;
-                            g_pcie_enumeration.devices[devices_attached].dev_num = pcie_dev_num;
-                            g_pcie_enumeration.devices[devices_attached].fun_num = pcie_fun_num;  
-                            g_pcie_enumeration.devices[devices_attached].vendor_id = pcie_vendor_id;
+                            this_pcie->enumeration.devices[devices_attached].bus_num = pcie_bus_num;
+                            this_pcie->enumeration.devices[devices_attached].dev_num = pcie_dev_num;
+                            this_pcie->enumeration.devices[devices_attached].fun_num = pcie_fun_num;  
+                            this_pcie->enumeration.devices[devices_attached].vendor_id = pcie_vendor_id;
                             ++devices_attached;
-                            g_pcie_enumeration.no_of_devices_attached = devices_attached;
-                            /* Enable config space  memory access bus master and cache size */
-                            p_pcie_config_space->CFG_PRMSCR |= (EP_CFG_PRMSCR_DATA);
-                            p_pcie_config_space->BIST_HEADER = PCIE_CFG_CATCHE_SIZE;
-
-                            p_pcie_ep_config_space = (uint32_t *)((uintptr_t)src_ecam_addr);
-                            /* PCIe configuration header starts after standard size - 0x40/4 = 0x10 */
-                            p_pcie_ep_config_space = p_pcie_ep_config_space + 0x10u;
-
-                            for (addr_inc = PCIE_CLEAR; addr_inc < 48u; ++addr_inc)
-                            {
-                                /* Read Capability ID 10h for PCI Express Capability structure */
-                                p_reg = *(p_pcie_ep_config_space + addr_inc);
-                                if (PCIE_CAPB_ID_STRUCT == (p_reg & PCIE_CAPB_ID_MASK))
-                                {
-                                    break;
-                                }
-                            }
-                            if (addr_inc < 48u)
-                            {
-                                /* Device control and status offset */
-                                addr_inc = addr_inc + 2u;
-                                /* End Point control and status configure */
-                                *(p_pcie_ep_config_space + addr_inc) = EP_DEVICE_CTRL_STATUS_DATA;
-                            }
+                            this_pcie->enumeration.no_of_devices_attached = devices_attached;
+                            cfg_endpoint_setup(src_ecam_addr);
                         }
                         else
                         {
                             /* Header type is Type1
                              * This is a bridge or Root Port
                              */
-                            /* Check bus num is '0' for Root Port*/
-                            if (PCIE_CLEAR == pcie_bus_num)
-                            {
-                                p_pcie_root_config = (PCIE_ROOT_CONF *)((uintptr_t)src_ecam_addr);
-                                prim_sec_num |= (uint32_t)(((((uint32_t)pcie_bus_num) + PCIE_SET) << 8u) | pcie_bus_num);
-                                /* Sub bus num 0xFF, sec bus num 1, and prime bus num 0 */
-                                p_pcie_root_config->PRIM_SEC_BUS_NUM = prim_sec_num;
-                                /* Control & Status Register: enable bus master,
-                                 * Parity Error Response and  SERR#
-                                 */
-                                p_pcie_root_config->CFG_PRMSCR = RP_CFG_PRMSCR_DATA;
-                                /* Non-prefetchable Limit, Non-prefetchable Base */
-                                p_pcie_root_config->MEM_LIMIT_BASE = RP_MEM_LIMIT_BASE_DATA;
-                                /* Prefetchable Limit, Prefetchable Base */
-                                p_pcie_root_config->PREF_MEM_LIMIT_BASE = RP_PREF_MEM_LIMIT_BASE_DATA;
-                                /* Prefetchable Base upper */
-                                p_pcie_root_config->PREF_BASE_UPPER = RP_PREF_BASE_UPPER_DATA;
-                                /* Prefetchable upper limit*/
-                                p_pcie_root_config->PREF_LIMIT_UPPER = RP_PREF_LIMIT_UPPER_DATA;
-                                p_pcie_root_config->DEVICE_CTRL_STAT = RP_DEVICE_CTRL_STATUS_DATA;
-                            }
-                            else
-                            {
-                                /* The PCIe bridge primary and secondary bus setup */
-                                prim_sec_num |= (uint32_t)(((((uint32_t)pcie_bus_num) + PCIE_SET) << 8u) | pcie_bus_num);
-                                p_pcie_root_config = (PCIE_ROOT_CONF *)((uintptr_t)src_ecam_addr);
-                                p_pcie_root_config->PRIM_SEC_BUS_NUM = prim_sec_num;
-                                p_pcie_root_config->CFG_PRMSCR = RP_CFG_PRMSCR_DATA;
-                            }
-                            g_pcie_enumeration.bridges[bridges_attached].bus_num = pcie_bus_num;
-                            g_pcie_enumeration.bridges[bridges_attached].dev_num = pcie_dev_num;
-                            g_pcie_enumeration.bridges[bridges_attached].fun_num = pcie_fun_num;
-                            g_pcie_enumeration.bridges[bridges_attached].vendor_id = pcie_vendor_id;
+                            prim_sec_num |= (uint32_t)(((((uint32_t)pcie_bus_num) + PCIE_SET) << 8u) | pcie_bus_num);
+                            cfg_bridge_setup(src_ecam_addr, pcie_bus_num, prim_sec_num);
+                            this_pcie->enumeration.bridges[bridges_attached].bus_num = pcie_bus_num;
+                            this_pcie->enumeration.bridges[bridges_attached].dev_num = pcie_dev_num;
+                            this_pcie->enumeration.bridges[bridges_attached].fun_num = pcie_fun_num;
+                            this_pcie->enumeration.bridges[bridges_attached].vendor_id = pcie_vendor_id;
                             ++bridges_attached;
-                            g_pcie_enumeration.no_of_bridges_attached = bridges_attached;
+                            this_pcie->enumeration.no_of_bridges_attached = bridges_attached;
                         }
                         if ((PCIE_CLEAR == pcie_fun_num) && (PCIE_CLEAR == pcie_multi_fun))
                         {
@@ -367,10 +311,13 @@ PF_PCIE_enumeration
                 }
             }
         }
-        /* Selects PCIe Tx/RxInterface */
-        p_pcie_bridge->ATR0_AXI4_SLV0_TRSL_PARAM  = PCIE_TX_RX_INTERFACE;
+        if (PCIE_CLEAR == this_pcie->cfg_session)
+        {
+            /* Selects PCIe Tx/RxInterface */
+            p_pcie_bridge->ATR0_AXI4_SLV0_TRSL_PARAM  = PCIE_TX_RX_INTERFACE;
+        }
     }
-    return &g_pcie_enumeration;
+    return &this_pcie->enumeration;
 }
 
 /**************************************************************************//**
@@ -378,8 +325,9 @@ PF_PCIE_enumeration
  *
  */
 pf_pcie_bar_info_t *
-PF_PCIE_allocate_memory
+PF_PCIE_inst_allocate_memory
 (
+    pf_pcie_instance_t * this_pcie,
     uint64_t ecam_addr,
     uint64_t allocate_addr
 )
@@ -394,23 +342,26 @@ PF_PCIE_allocate_memory
     axi_trns_base_addr_low = (uint32_t)(allocate_addr  & MASK_32BIT);
     axi_trns_base_addr_high = (uint32_t)((allocate_addr >> SHIFT_32BIT) & MASK_32BIT);
     /* Default BAR and BAR size is 0 */
-    g_pcie_bar_allocate.bar0_address = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar0_size = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar1_address = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar1_size = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar2_address = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar2_size = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar3_address = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar3_size = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar4_address = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar4_size = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar5_address = PCIE_CLEAR;
-    g_pcie_bar_allocate.bar5_size = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar0_address = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar0_size = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar1_address = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar1_size = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar2_address = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar2_size = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar3_address = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar3_size = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar4_address = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar4_size = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar5_address = PCIE_CLEAR;
+    this_pcie->bar_allocate.bar5_size = PCIE_CLEAR;
     /* Check PCIe bridge is enabled */
-    if (NULL_POINTER != g_rp_pcie_bridge)
+    if (NULL_POINTER != this_pcie->rp_bridge)
     {
-        /* Select PCIe Config space */
-        g_rp_pcie_bridge->ATR0_AXI4_SLV0_TRSL_PARAM  = PCIE_CONFIG_INTERFACE;
+        if (PCIE_CLEAR == this_pcie->cfg_session)
+        {
+            /* Select PCIe Config space */
+            this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_PARAM  = PCIE_CONFIG_INTERFACE;
+        }
 
         p_pcie_config_space = (PCIE_END_CONF *)((uintptr_t)ecam_addr);
         pcie_header_type = PCIE_CLEAR;
@@ -432,10 +383,10 @@ PF_PCIE_allocate_memory
             if (ADDR_SPACE_64BIT == (lsb4bits_bar & ADDR_SPACE_64BIT))
             {
                  p_pcie_config_space->BAR1 = axi_trns_base_addr_high;
-                 g_pcie_bar_allocate.bar1_address = axi_trns_base_addr_high;
+                 this_pcie->bar_allocate.bar1_address = axi_trns_base_addr_high;
             }
-            g_pcie_bar_allocate.bar0_address = axi_trns_base_addr_low;
-            g_pcie_bar_allocate.bar0_size = read_bar;
+            this_pcie->bar_allocate.bar0_address = axi_trns_base_addr_low;
+            this_pcie->bar_allocate.bar0_size = read_bar;
             axi_trns_base_addr = axi_trns_base_addr + read_bar;
         }
          /* Check BAR0 is not 64-bit address space */
@@ -456,8 +407,8 @@ PF_PCIE_allocate_memory
              {
                  /* Write Translation address in EP BAR1 */
                  p_pcie_config_space->BAR1 = axi_trns_base_addr_low | lsb4bits_bar;
-                 g_pcie_bar_allocate.bar1_address = axi_trns_base_addr_low;
-                 g_pcie_bar_allocate.bar1_size = read_bar;
+                 this_pcie->bar_allocate.bar1_address = axi_trns_base_addr_low;
+                 this_pcie->bar_allocate.bar1_size = read_bar;
                  axi_trns_base_addr = axi_trns_base_addr + read_bar;
              }
         }
@@ -481,10 +432,10 @@ PF_PCIE_allocate_memory
                if (ADDR_SPACE_64BIT == (lsb4bits_bar & ADDR_SPACE_64BIT))
                 {
                     p_pcie_config_space->BAR3 = axi_trns_base_addr_high;
-                    g_pcie_bar_allocate.bar3_address = axi_trns_base_addr_high;
+                    this_pcie->bar_allocate.bar3_address = axi_trns_base_addr_high;
                 }
-                g_pcie_bar_allocate.bar2_address = axi_trns_base_addr_low;
-                g_pcie_bar_allocate.bar2_size = read_bar;
+                this_pcie->bar_allocate.bar2_address = axi_trns_base_addr_low;
+                this_pcie->bar_allocate.bar2_size = read_bar;
                 axi_trns_base_addr = axi_trns_base_addr + read_bar;
             }
     
@@ -506,8 +457,8 @@ PF_PCIE_allocate_memory
                 {
                     /* Write Translation address in EP BAR3 */
                     p_pcie_config_space->BAR3 = axi_trns_base_addr_low | lsb4bits_bar;
-                    g_pcie_bar_allocate.bar3_address = axi_trns_base_addr_low;
-                    g_pcie_bar_allocate.bar3_size = read_bar;
+                    this_pcie->bar_allocate.bar3_address = axi_trns_base_addr_low;
+                    this_pcie->bar_allocate.bar3_size = read_bar;
                     axi_trns_base_addr = axi_trns_base_addr + read_bar;
                 }
             }
@@ -529,10 +480,10 @@ PF_PCIE_allocate_memory
                if (ADDR_SPACE_64BIT == (lsb4bits_bar & ADDR_SPACE_64BIT))
                 {
                     p_pcie_config_space->BAR5 = axi_trns_base_addr_high;
-                    g_pcie_bar_allocate.bar5_address = axi_trns_base_addr_high;
+                    this_pcie->bar_allocate.bar5_address = axi_trns_base_addr_high;
                 }
-                g_pcie_bar_allocate.bar4_address = axi_trns_base_addr_low;
-                g_pcie_bar_allocate.bar4_size = read_bar;
+                this_pcie->bar_allocate.bar4_address = axi_trns_base_addr_low;
+                this_pcie->bar_allocate.bar4_size = read_bar;
                 axi_trns_base_addr = axi_trns_base_addr + read_bar;
             }
     
@@ -554,16 +505,188 @@ PF_PCIE_allocate_memory
                 {
                     /* Write Translation address in EP BAR5 */
                     p_pcie_config_space->BAR5 = axi_trns_base_addr_low | lsb4bits_bar;
-                    g_pcie_bar_allocate.bar5_address = axi_trns_base_addr_low;
-                    g_pcie_bar_allocate.bar5_size = read_bar;
+                    this_pcie->bar_allocate.bar5_address = axi_trns_base_addr_low;
+                    this_pcie->bar_allocate.bar5_size = read_bar;
                     axi_trns_base_addr = axi_trns_base_addr + read_bar;
                 }
             }
         }
-        /* Selects PCIe Tx/RxInterface */
-        g_rp_pcie_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_TX_RX_INTERFACE;
+        if (PCIE_CLEAR == this_pcie->cfg_session)
+        {
+            /* Selects PCIe Tx/RxInterface */
+            this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_TX_RX_INTERFACE;
+        }
+    }
+    return &this_pcie->bar_allocate;
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+uint8_t
+PF_PCIE_inst_enumeration_cache_save
+(
+    pf_pcie_instance_t * this_pcie,
+    uint64_t ecam_addr,
+    pf_pcie_enum_cache_t * cache
+)
+{
+    uint8_t returnval = PF_PCIE_ENUM_CACHE_FAILURE;
+    const pf_pcie_info_t * info;
+    uint64_t src_ecam_addr;
+    uint8_t idx;
+
+    cache->valid = PCIE_CLEAR;
+    if (NULL_POINTER != this_pcie->rp_bridge)
+    {
+        if (PCIE_CLEAR == this_pcie->cfg_session)
+        {
+            /* Select PCIe Config space */
+            this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_CONFIG_INTERFACE;
+        }
+        for (idx = PCIE_CLEAR; idx < this_pcie->enumeration.no_of_bridges_attached; idx++)
+        {
+            info = &this_pcie->enumeration.bridges[idx];
+            src_ecam_addr = ecam_address_calc(ecam_addr, (uint8_t)info->bus_num,
+                                              info->dev_num, info->fun_num);
+            cfg_cache_save_entry(&cache->bridges[idx], src_ecam_addr,
+                                 PF_PCIE_ENUM_CACHE_TYPE1_BARS);
+        }
+        for (idx = PCIE_CLEAR; idx < this_pcie->enumeration.no_of_devices_attached; idx++)
+        {
+            info = &this_pcie->enumeration.devices[idx];
+            src_ecam_addr = ecam_address_calc(ecam_addr, (uint8_t)info->bus_num,
+                                              info->dev_num, info->fun_num);
+            cfg_cache_save_entry(&cache->devices[idx], src_ecam_addr,
+                                 PF_PCIE_ENUM_CACHE_BARS);
+        }
+        if (PCIE_CLEAR == this_pcie->cfg_session)
+        {
+            /* Selects PCIe Tx/RxInterface */
+            this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_TX_RX_INTERFACE;
+        }
+        cache->ecam_addr = ecam_addr;
+        cache->enumeration = this_pcie->enumeration;
+        cache->bar_allocate = this_pcie->bar_allocate;
+        cache->valid = PF_PCIE_ENUM_CACHE_VALID;
+        returnval = PF_PCIE_ENUM_CACHE_SUCCESS;
+    }
+    return returnval;
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ * This function is valid only when IP is configured as a root complex.
+ *
+ */
+pf_pcie_ebuff_t *
+PF_PCIE_inst_enumeration_cache_restore
+(
+    pf_pcie_instance_t * this_pcie,
+    uint64_t apb_addr,
+    uint8_t pcie_ctrl_num,
+    uint64_t ecam_addr,
+    const pf_pcie_enum_cache_t * cache
+)
+{
+    pf_pcie_ebuff_t * p_ebuff = NULL_POINTER;
+    PCIE_BRIDGE * p_pcie_bridge = NULL_POINTER;
+    PCIE_CTRL * p_pcie_ctrl = NULL_POINTER;
+    const pf_pcie_info_t * info;
+    uint64_t src_ecam_addr;
+    uint32_t prim_sec_num = PRIM_SEC_SUB_BUS_DEFAULT;
+    uint8_t match = PCIE_SET;
+    uint8_t pcie_bus_num;
+    uint8_t idx;
+
+    if ((PF_PCIE_ENUM_CACHE_VALID == cache->valid) && (ecam_addr == cache->ecam_addr))
+    {
+        if (PF_PCIE_CTRL_0 == pcie_ctrl_num)
+        {
+            p_pcie_bridge = ((PCIE_BRIDGE *)((uintptr_t)(apb_addr + PCIE0_BRIDGE_PHY_ADDR_OFFSET)));
+            p_pcie_ctrl = ((PCIE_CTRL *)((uintptr_t)(apb_addr + PCIE0_CRTL_PHY_ADDR_OFFSET)));
+        }
+        else if (PF_PCIE_CTRL_1 == pcie_ctrl_num)
+        {
+            p_pcie_bridge = ((PCIE_BRIDGE *)((uintptr_t)(apb_addr + PCIE1_BRIDGE_PHY_ADDR_OFFSET)));
+            p_pcie_ctrl = ((PCIE_CTRL *)((uintptr_t)(apb_addr + PCIE1_CRTL_PHY_ADDR_OFFSET)));
+        }
+        else
+        {
+            /* Not supports PCIe Bridge Controller */
+            p_pcie_bridge = NULL_POINTER;
+        }
+    }
+    if ((NULL_POINTER != p_pcie_bridge) &&
+       (ROOT_PORT_ENABLE == ((p_pcie_bridge->GEN_SETTINGS) & ROOT_PORT_ENABLE)))
+    {
+        this_pcie->rp_bridge = p_pcie_bridge;
+        this_pcie->rp_ctrl = p_pcie_ctrl;
+        cfg_window_map(this_pcie, ecam_addr);
+        /*
+         * Visit the cached functions in bus order so that each bridge has its
+         * bus numbers before the functions behind it are read.
+         */
+        for (pcie_bus_num = PCIE_CLEAR;
+             (pcie_bus_num < PCIE_CFG_MAX_NUM_OF_BUS) && (PCIE_SET == match);
+             pcie_bus_num++)
+        {
+            for (idx = PCIE_CLEAR;
+                 (idx < cache->enumeration.no_of_bridges_attached) && (PCIE_SET == match);
+                 idx++)
+            {
+                info = &cache->enumeration.bridges[idx];
+                if (pcie_bus_num == info->bus_num)
+                {
+                    src_ecam_addr = ecam_address_calc(ecam_addr, pcie_bus_num,
+                                                      info->dev_num, info->fun_num);
+                    match = cfg_cache_restore_entry(&cache->bridges[idx], src_ecam_addr,
+                                                    PF_PCIE_ENUM_CACHE_TYPE1_BARS);
+                    if (PCIE_SET == match)
+                    {
+                        prim_sec_num |= (uint32_t)(((((uint32_t)pcie_bus_num) + PCIE_SET) << 8u) | pcie_bus_num);
+                        cfg_bridge_setup(src_ecam_addr, pcie_bus_num, prim_sec_num);
+                    }
+                }
+            }
+            for (idx = PCIE_CLEAR;
+                 (idx < cache->enumeration.no_of_devices_attached) && (PCIE_SET == match);
+                 idx++)
+            {
+                info = &cache->enumeration.devices[idx];
+                if (pcie_bus_num == info->bus_num)
+                {
+                    src_ecam_addr = ecam_address_calc(ecam_addr, pcie_bus_num,
+                                                      info->dev_num, info->fun_num);
+                    match = cfg_cache_restore_entry(&cache->devices[idx], src_ecam_addr,
+                                                    PF_PCIE_ENUM_CACHE_BARS);
+                    if (PCIE_SET == match)
+                    {
+                        cfg_endpoint_setup(src_ecam_addr);
+                    }
+                }
+            }
+        }
+        if (PCIE_SET == match)
+        {
+            this_pcie->enumeration = cache->enumeration;
+            this_pcie->bar_allocate = cache->bar_allocate;
+            p_ebuff = &this_pcie->enumeration;
+        }
+        else
+        {
+            this_pcie->enumeration.no_of_bridges_attached = PCIE_CLEAR;
+            this_pcie->enumeration.no_of_devices_attached = PCIE_CLEAR;
+        }
+        if (PCIE_CLEAR == this_pcie->cfg_session)
+        {
+            /* Selects PCIe Tx/RxInterface */
+            p_pcie_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_TX_RX_INTERFACE;
+        }
     }
-    return &g_pcie_bar_allocate;
+    return p_ebuff;
 }
 
 /**************************************************************************//**
@@ -571,8 +694,9 @@ PF_PCIE_allocate_memory
  *
  */
 void
-PF_PCIE_enable_config_space_msi
+PF_PCIE_inst_enable_config_space_msi
 (
+    pf_pcie_instance_t * this_pcie,
     uint64_t ecam_addr,
     uint64_t msi_addr,
     uint16_t msi_data
@@ -584,13 +708,13 @@ PF_PCIE_enable_config_space_msi
     uint32_t msi_addr_low;
     uint32_t msi_addr_high;
         
-    if (NULL_POINTER != g_rp_pcie_bridge)
+    if (NULL_POINTER != this_pcie->rp_bridge)
     {
         msi_addr_low = (uint32_t)(msi_addr & MASK_32BIT);
         msi_addr_high = (uint32_t)((msi_addr >> SHIFT_32BIT) & MASK_32BIT);
 
         /* Select PCIe Config space */
-        g_rp_pcie_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_CONFIG_INTERFACE;
+        this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_CONFIG_INTERFACE;
 
         p_pcie_config_space = (uint32_t *)((uintptr_t)(ecam_addr & PCIE_CONFIG_CAPB_ID_MASK));
 
@@ -635,7 +759,7 @@ PF_PCIE_enable_config_space_msi
             *(p_pcie_config_space + addr_inc) = msi_data;
         }
         /* Selects PCIe Tx/RxInterface */
-        g_rp_pcie_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_TX_RX_INTERFACE;
+        this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_TX_RX_INTERFACE;
     }
 
 }
@@ -720,8 +844,9 @@ PF_PCIE_type1_header_read
  * 
  */
 uint8_t
-PF_PCIE_config_space_atr_table_init
+PF_PCIE_inst_config_space_atr_table_init
 (
+    pf_pcie_instance_t * this_pcie,
     uint64_t apb_addr,
     uint8_t pcie_ctrl_num,
     uint64_t ecam_addr
@@ -731,54 +856,56 @@ PF_PCIE_config_space_atr_table_init
     uint32_t ecam_addr_low;
     uint32_t ecam_addr_high;
 
-    if (NULL_POINTER == g_rp_pcie_bridge)
+    this_pcie->cfg_session = PCIE_CLEAR;
+    if (NULL_POINTER == this_pcie->rp_bridge)
     {
         if (PF_PCIE_CTRL_0 == pcie_ctrl_num)
         {
-            g_rp_pcie_bridge = ((PCIE_BRIDGE *)((uintptr_t)(apb_addr + PCIE0_BRIDGE_PHY_ADDR_OFFSET)));
-            g_rp_pcie_ctrl = ((PCIE_CTRL *)((uintptr_t)(apb_addr + PCIE0_CRTL_PHY_ADDR_OFFSET)));
+            this_pcie->rp_bridge = ((PCIE_BRIDGE *)((uintptr_t)(apb_addr + PCIE0_BRIDGE_PHY_ADDR_OFFSET)));
+            this_pcie->rp_ctrl = ((PCIE_CTRL *)((uintptr_t)(apb_addr + PCIE0_CRTL_PHY_ADDR_OFFSET)));
         }
         else if (PF_PCIE_CTRL_1 == pcie_ctrl_num)
         {
-            g_rp_pcie_bridge = ((PCIE_BRIDGE *)((uintptr_t)(apb_addr + PCIE1_BRIDGE_PHY_ADDR_OFFSET)));
-            g_rp_pcie_ctrl = ((PCIE_CTRL *)((uintptr_t)(apb_addr + PCIE1_CRTL_PHY_ADDR_OFFSET)));
+            this_pcie->rp_bridge = ((PCIE_BRIDGE *)((uintptr_t)(apb_addr + PCIE1_BRIDGE_PHY_ADDR_OFFSET)));
+            this_pcie->rp_ctrl = ((PCIE_CTRL *)((uintptr_t)(apb_addr + PCIE1_CRTL_PHY_ADDR_OFFSET)));
         }
         else
         {
-            g_rp_pcie_bridge = NULL_POINTER;
+            this_pcie->rp_bridge = NULL_POINTER;
             returnval = PF_PCIE_ATR_TABLE_INIT_FAILURE;
         }
 
-        if (NULL_POINTER != g_rp_pcie_bridge)
+        if (NULL_POINTER != this_pcie->rp_bridge)
         {
             /* Clear interrupts on PCIe RootPort */
-            g_rp_pcie_ctrl->ECC_CONTROL = PCIE_ECC_DISABLE;
-            g_rp_pcie_ctrl->PCIE_EVENT_INT = PCIE_EVENT_INT_DATA;
-            g_rp_pcie_ctrl->SEC_ERROR_INT = PCIE_SEC_ERROR_INT_CLEAR;
-            g_rp_pcie_ctrl->DED_ERROR_INT = PCIE_DED_ERROR_INT_CLEAR;
+            this_pcie->rp_ctrl->ECC_CONTROL = PCIE_ECC_DISABLE;
+            this_pcie->rp_ctrl->PCIE_EVENT_INT = PCIE_EVENT_INT_DATA;
+            this_pcie->rp_ctrl->SEC_ERROR_INT = PCIE_SEC_ERROR_INT_CLEAR;
+            this_pcie->rp_ctrl->DED_ERROR_INT = PCIE_DED_ERROR_INT_CLEAR;
         
-            g_rp_pcie_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
-            g_rp_pcie_bridge->IMASK_LOCAL = PCIE_CLEAR;
-            g_rp_pcie_bridge->ISTATUS_HOST = PCIE_ISTATUS_CLEAR;
-            g_rp_pcie_bridge->IMASK_HOST = PCIE_CLEAR;
+            this_pcie->rp_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
+            this_pcie->rp_bridge->IMASK_LOCAL = PCIE_CLEAR;
+            this_pcie->rp_bridge->ISTATUS_HOST = PCIE_ISTATUS_CLEAR;
+            this_pcie->rp_bridge->IMASK_HOST = PCIE_CLEAR;
         }
     }
 
-    if (NULL_POINTER != g_rp_pcie_bridge)
+    if (NULL_POINTER != this_pcie->rp_bridge)
     {
         /* Check Root Port */
-        if (ROOT_PORT_ENABLE == (g_rp_pcie_bridge->GEN_SETTINGS & ROOT_PORT_ENABLE))
+        if (ROOT_PORT_ENABLE == (this_pcie->rp_bridge->GEN_SETTINGS & ROOT_PORT_ENABLE))
         {
             ecam_addr_low = (uint32_t)(ecam_addr & MASK_32BIT);
             ecam_addr_high = (uint32_t)((ecam_addr >> SHIFT_32BIT) & MASK_32BIT);
             /* Selects PCIe Config space */
-            g_rp_pcie_bridge->ATR0_AXI4_SLV0_TRSL_PARAM  = PCIE_CONFIG_INTERFACE;
+            this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_PARAM  = PCIE_CONFIG_INTERFACE;
         
-            g_rp_pcie_bridge->ATR0_AXI4_SLV0_SRCADDR_PARAM = ecam_addr_low |
+            this_pcie->rp_bridge->ATR0_AXI4_SLV0_SRCADDR_PARAM = ecam_addr_low |
                                                        SIZE_256MB_TRANSLATE_TABLE_EN;
-            g_rp_pcie_bridge->ATR0_AXI4_SLV0_SRC_ADDR = ecam_addr_high;
-            g_rp_pcie_bridge->ATR0_AXI4_SLV0_TRSL_ADDR_LSB = ecam_addr_low;
-            g_rp_pcie_bridge->ATR0_AXI4_SLV0_TRSL_ADDR_UDW = ecam_addr_high;
+            this_pcie->rp_bridge->ATR0_AXI4_SLV0_SRC_ADDR = ecam_addr_high;
+            this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_ADDR_LSB = ecam_addr_low;
+            this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_ADDR_UDW = ecam_addr_high;
+            this_pcie->cfg_session = PCIE_SET;
         }
         else
         {
@@ -792,13 +919,14 @@ PF_PCIE_config_space_atr_table_init
  * See pf_pciess.h for details of how to use this function.
  * 
  */
-void PF_PCIE_config_space_atr_table_terminate(void)
+void PF_PCIE_inst_config_space_atr_table_terminate(pf_pcie_instance_t * this_pcie)
 {
-    if (NULL_POINTER != g_rp_pcie_bridge)
+    if (NULL_POINTER != this_pcie->rp_bridge)
     {
         /* Selects PCIe Tx/Rx Interface, disable PCIe Config space */
-        g_rp_pcie_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_TX_RX_INTERFACE;
+        this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_TX_RX_INTERFACE;
      }
+    this_pcie->cfg_session = PCIE_CLEAR;
 }
 
 /**************************************************************************//**
@@ -833,6 +961,54 @@ PF_PCIE_config_space_write
     *(cfg_reg) = value;
 }
 
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_mmio_write_burst
+(
+    uint64_t bar_addr,
+    const void * src,
+    uint32_t length
+)
+{
+    const uint8_t * p_src = (const uint8_t *)src;
+    uint64_t dest = bar_addr;
+    uint32_t remaining = length;
+    uint64_t dword;
+    uint32_t byte;
+
+    /* Bytes up to the first 64-bit boundary */
+    while ((remaining > PCIE_CLEAR) && (PCIE_CLEAR != (dest & 0x7u)))
+    {
+        *(volatile uint8_t *)((uintptr_t)dest) = *p_src;
+        ++p_src;
+        ++dest;
+        --remaining;
+    }
+    while (remaining >= 8u)
+    {
+        /* Assemble the little endian 64-bit word, src may not be aligned */
+        dword = PCIE_CLEAR;
+        for (byte = 8u; byte > PCIE_CLEAR; --byte)
+        {
+            dword = (dword << 8u) | p_src[byte - 1u];
+        }
+        *(volatile uint64_t *)((uintptr_t)dest) = dword;
+        p_src += 8u;
+        dest += 8u;
+        remaining -= 8u;
+    }
+    while (remaining > PCIE_CLEAR)
+    {
+        *(volatile uint8_t *)((uintptr_t)dest) = *p_src;
+        ++p_src;
+        ++dest;
+        --remaining;
+    }
+}
+
 /**************************************************************************//**
  * See pf_pciess.h for details of how to use this function.
  * 
@@ -1021,32 +1197,42 @@ PF_PCIE_slave_atr_table_init
  * See pf_pciess.h for details of how to use this function.
  *
  */
-void PF_PCIE_dma_init(uint64_t  allocated_addr)
+void PF_PCIE_inst_dma_init(pf_pcie_instance_t * this_pcie, uint64_t allocated_addr)
 {
-    g_ep_bridge_reg = (PCIE_BRIDGE *)((uintptr_t)allocated_addr);
-    g_ep_ctrl_reg = (PCIE_CTRL *)((uintptr_t)(allocated_addr + 0x2000u));
+    uint8_t ch;
+
+    this_pcie->ep_bridge = (PCIE_BRIDGE *)((uintptr_t)allocated_addr);
+    this_pcie->ep_ctrl = (PCIE_CTRL *)((uintptr_t)(allocated_addr + 0x2000u));
 
     /* Disable EP ECC interrupts and clear status bits */
-    g_ep_ctrl_reg->ECC_CONTROL = PCIE_ECC_DISABLE;
-    g_ep_ctrl_reg->PCIE_EVENT_INT = PCIE_EVENT_INT_DATA;
-    g_ep_ctrl_reg->SEC_ERROR_INT = PCIE_SEC_ERROR_INT_CLEAR;
-    g_ep_ctrl_reg->DED_ERROR_INT = PCIE_DED_ERROR_INT_CLEAR;
+    this_pcie->ep_ctrl->ECC_CONTROL = PCIE_ECC_DISABLE;
+    this_pcie->ep_ctrl->PCIE_EVENT_INT = PCIE_EVENT_INT_DATA;
+    this_pcie->ep_ctrl->SEC_ERROR_INT = PCIE_SEC_ERROR_INT_CLEAR;
+    this_pcie->ep_ctrl->DED_ERROR_INT = PCIE_DED_ERROR_INT_CLEAR;
 
     /* Disable and clear  Local and Host interrupts on EP */
-    g_ep_bridge_reg->IMASK_LOCAL = PCIE_CLEAR;
-    g_ep_bridge_reg->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
-    g_ep_bridge_reg->IMASK_HOST = PCIE_CLEAR;
-    g_ep_bridge_reg->ISTATUS_HOST = PCIE_ISTATUS_CLEAR;
+    this_pcie->ep_bridge->IMASK_LOCAL = PCIE_CLEAR;
+    this_pcie->ep_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
+    this_pcie->ep_bridge->IMASK_HOST = PCIE_CLEAR;
+    this_pcie->ep_bridge->ISTATUS_HOST = PCIE_ISTATUS_CLEAR;
 
     /* Enable PCIe Host MSI, INTx DMAx interrupts on EP */
-    g_ep_bridge_reg->IMASK_HOST= PCIE_HOST_INT_ENABLE;
-    g_ep_bridge_reg->ISTATUS_HOST = PCIE_ISTATUS_CLEAR;
+    this_pcie->ep_bridge->IMASK_HOST= PCIE_HOST_INT_ENABLE;
+    this_pcie->ep_bridge->ISTATUS_HOST = PCIE_ISTATUS_CLEAR;
 
     /* initialize default interrupt handlers */
-    g_pcie_dma.tx_complete_handler = NULL_POINTER;
-    g_pcie_dma.rx_complete_handler = NULL_POINTER;
+    this_pcie->dma.tx_complete_handler = NULL_POINTER;
+    this_pcie->dma.rx_complete_handler = NULL_POINTER;
+
+    for (ch = 0u; ch < DMA_NUM_CHANNELS; ch++)
+    {
+        this_pcie->dma.channel[ch].state = PF_PCIE_EP_DMA_COMPLETED;
+        this_pcie->dma.channel[ch].inflight = NULL_POINTER;
+        this_pcie->dma.channel[ch].head = NULL_POINTER;
+        this_pcie->dma.channel[ch].tail = NULL_POINTER;
+    }
 
-    g_pcie_dma.state = PF_PCIE_EP_DMA_COMPLETED;
+    this_pcie->dma.state = PF_PCIE_EP_DMA_COMPLETED;
 }
 
 /**************************************************************************//**
@@ -1054,12 +1240,13 @@ void PF_PCIE_dma_init(uint64_t  allocated_addr)
  * 
  */
 void
-PF_PCIE_set_dma_write_callback
+PF_PCIE_inst_set_dma_write_callback
 (
+    pf_pcie_instance_t * this_pcie,
     pf_pcie_write_callback_t write_callback
 )
 {
-    g_pcie_dma.tx_complete_handler = write_callback;
+    this_pcie->dma.tx_complete_handler = write_callback;
 }
 
 /**************************************************************************//**
@@ -1067,26 +1254,66 @@ PF_PCIE_set_dma_write_callback
  *
  */
 void
-PF_PCIE_set_dma_read_callback
+PF_PCIE_inst_set_dma_read_callback
 (
+    pf_pcie_instance_t * this_pcie,
     pf_pcie_read_callback_t rx_callback
 )
 {
-    g_pcie_dma.rx_complete_handler = rx_callback;
+    this_pcie->dma.rx_complete_handler = rx_callback;
 }
 
 /**************************************************************************//**
  * See pf_pciess.h for details of how to use this function.
  *
  */
-void PF_PCIE_dma_abort(void)
+void PF_PCIE_inst_dma_abort(pf_pcie_instance_t * this_pcie)
 {
-    if(NULL_POINTER != g_ep_bridge_reg)
+    pf_pcie_dma_job_t * jobs[DMA_NUM_CHANNELS];
+    pf_pcie_dma_job_t * job;
+    uint32_t mask;
+    uint8_t ch;
+
+    mask = dma_irq_mask(this_pcie);
+    if(NULL_POINTER != this_pcie->ep_bridge)
+    {
+        this_pcie->ep_bridge->DMA0_CONTROL = PCIE_CLEAR;
+        this_pcie->ep_bridge->DMA1_CONTROL = PCIE_CLEAR;
+    }
+
+    /* Detach the jobs of both engines, in flight one first */
+    for (ch = 0u; ch < DMA_NUM_CHANNELS; ch++)
+    {
+        jobs[ch] = this_pcie->dma.channel[ch].inflight;
+        if (NULL_POINTER != jobs[ch])
+        {
+            jobs[ch]->next = this_pcie->dma.channel[ch].head;
+        }
+        else
+        {
+            jobs[ch] = this_pcie->dma.channel[ch].head;
+        }
+        this_pcie->dma.channel[ch].inflight = NULL_POINTER;
+        this_pcie->dma.channel[ch].head = NULL_POINTER;
+        this_pcie->dma.channel[ch].tail = NULL_POINTER;
+        this_pcie->dma.channel[ch].state = PF_PCIE_EP_DMA_COMPLETED;
+    }
+    this_pcie->dma.state = PF_PCIE_EP_DMA_COMPLETED;
+    dma_irq_restore(this_pcie, mask);
+
+    for (ch = 0u; ch < DMA_NUM_CHANNELS; ch++)
     {
-        g_ep_bridge_reg->DMA0_CONTROL = PCIE_CLEAR;
-        g_ep_bridge_reg->DMA1_CONTROL = PCIE_CLEAR;
+        while (NULL_POINTER != jobs[ch])
+        {
+            job = jobs[ch];
+            jobs[ch] = job->next;
+            job->next = NULL_POINTER;
+            if (NULL_POINTER != job->callback)
+            {
+                job->callback(job, PF_PCIE_EP_DMA_ERROR);
+            }
+        }
     }
-    g_pcie_dma.state = PF_PCIE_EP_DMA_COMPLETED;
 }
 
 /**************************************************************************//**
@@ -1094,41 +1321,32 @@ void PF_PCIE_dma_abort(void)
  *
  */
 void
-PF_PCIE_dma_read
+PF_PCIE_inst_dma_read
 (
+    pf_pcie_instance_t * this_pcie,
     uint64_t src_address,
     uint64_t dest_address,
     uint32_t rx_lenth
 )
 {
+    pf_pcie_dma_channel_t * chan = &this_pcie->dma.channel[PF_PCIE_EP_DMA_READ];
+    uint32_t mask;
+
     /* Check EP bridge access enabled with DMA */
-    if (NULL_POINTER != g_ep_bridge_reg)
+    if (NULL_POINTER != this_pcie->ep_bridge)
     {
-        if ((PF_PCIE_EP_DMA_IN_PROGRESS != g_pcie_dma.state) && (rx_lenth > 0u))
+        mask = dma_irq_mask(this_pcie);
+        if ((PF_PCIE_EP_DMA_IN_PROGRESS != chan->state) && (rx_lenth > 0u))
         {
-            g_ep_bridge_reg->DMA1_CONTROL = PCIE_CLEAR;
             /* DMA from EP to RP - source EP AXI-Master, destination PCIe - DMA1 */
-            /* AXI4-Master Interface for Source*/
-            g_ep_bridge_reg->DMA1_SRC_PARAM = EP_DMA_INTERFACE_AXI;
-            /* PCIe Interface for Destination */
-            g_ep_bridge_reg->DMA1_DESTPARAM = EP_DMA_INTERFACE_PCIE;
-            /* Set source address */
-            g_ep_bridge_reg->DMA1_SRCADDR_LDW = (uint32_t)(src_address & MASK_32BIT);
-            g_ep_bridge_reg->DMA1_SRCADDR_UDW = (uint32_t)((src_address >> SHIFT_32BIT) & MASK_32BIT);
-            /* Set destination address*/
-            g_ep_bridge_reg->DMA1_DESTADDR_LDW = (uint32_t)(dest_address & MASK_32BIT);
-            g_ep_bridge_reg->DMA1_DESTADDR_UDW = (uint32_t)((dest_address >> SHIFT_32BIT) & MASK_32BIT);
-            /* Set dma size */
-            g_ep_bridge_reg->DMA1_LENGTH = rx_lenth;
-            /*Start dma transaction */
-            g_ep_bridge_reg->DMA1_CONTROL = EP_DMA_START_DATA;
-
-            g_pcie_dma.state = PF_PCIE_EP_DMA_IN_PROGRESS;
+            dma_start(this_pcie, (uint8_t)PF_PCIE_EP_DMA_READ, src_address, dest_address,
+                      rx_lenth, dest_address);
         }
+        dma_irq_restore(this_pcie, mask);
     }
     else
     {
-        g_pcie_dma.state = PF_PCIE_EP_DMA_NOT_INITIALIZED;
+        this_pcie->dma.state = PF_PCIE_EP_DMA_NOT_INITIALIZED;
     }
 }
 
@@ -1137,42 +1355,91 @@ PF_PCIE_dma_read
  * 
  */
 void
-PF_PCIE_dma_write
+PF_PCIE_inst_dma_write
 (
+    pf_pcie_instance_t * this_pcie,
     uint64_t src_address,
     uint64_t dest_address,
     uint32_t tx_lenth
 )
 {
+    pf_pcie_dma_channel_t * chan = &this_pcie->dma.channel[PF_PCIE_EP_DMA_WRITE];
+    uint32_t mask;
+
     /* Check EP bridge access enabled with DMA */
-    if (NULL_POINTER != g_ep_bridge_reg)
+    if (NULL_POINTER != this_pcie->ep_bridge)
     {
-        if ((PF_PCIE_EP_DMA_IN_PROGRESS != g_pcie_dma.state)  && (tx_lenth > 0u))
+        mask = dma_irq_mask(this_pcie);
+        if ((PF_PCIE_EP_DMA_IN_PROGRESS != chan->state)  && (tx_lenth > 0u))
         {
-            g_ep_bridge_reg->DMA0_CONTROL = PCIE_CLEAR;
             /* DMA from RP to EP - source RP-PCIe, destination AXI-Master - DMA0 */
-            /* PCIe Interface for Source */
-            g_ep_bridge_reg->DMA0_SRC_PARAM = EP_DMA_INTERFACE_PCIE;
-            /*AXI4-Master Interface for Destination*/
-            g_ep_bridge_reg->DMA0_DESTPARAM = EP_DMA_INTERFACE_AXI;
-            /* Set source address */
-            g_ep_bridge_reg->DMA0_SRCADDR_LDW = (uint32_t)(src_address & MASK_32BIT);
-            g_ep_bridge_reg->DMA0_SRCADDR_UDW = (uint32_t)((src_address >> SHIFT_32BIT) & MASK_32BIT);
-            /* Set destination address*/        
-            g_ep_bridge_reg->DMA0_DESTADDR_LDW = (uint32_t)(dest_address & MASK_32BIT);
-            g_ep_bridge_reg->DMA0_DESTADDR_UDW = (uint32_t)((dest_address >> SHIFT_32BIT) & MASK_32BIT);
-            /* Set dma size */
-            g_ep_bridge_reg->DMA0_LENGTH = tx_lenth;
-            /*Start dma transaction */
-            g_ep_bridge_reg->DMA0_CONTROL = EP_DMA_START_DATA;
-
-            g_pcie_dma.state = PF_PCIE_EP_DMA_IN_PROGRESS;
+            dma_start(this_pcie, (uint8_t)PF_PCIE_EP_DMA_WRITE, src_address, dest_address,
+                      tx_lenth, src_address);
         }
+        dma_irq_restore(this_pcie, mask);
+    }
+    else
+    {
+        this_pcie->dma.state = PF_PCIE_EP_DMA_NOT_INITIALIZED;
+    }
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+uint8_t
+PF_PCIE_inst_dma_submit
+(
+    pf_pcie_instance_t * this_pcie,
+    pf_pcie_ep_dma_dir_t dir,
+    pf_pcie_dma_job_t * job
+)
+{
+    pf_pcie_dma_channel_t * chan;
+    uint32_t mask;
+    uint8_t returnval = PF_PCIE_DMA_SUBMIT_SUCCESS;
+
+    if ((NULL_POINTER == job) || (0u == job->length) ||
+        ((uint32_t)dir >= DMA_NUM_CHANNELS))
+    {
+        returnval = PF_PCIE_DMA_SUBMIT_INVALID;
+    }
+    else if (NULL_POINTER == this_pcie->ep_bridge)
+    {
+        returnval = PF_PCIE_DMA_SUBMIT_NOT_INITIALIZED;
+    }
+    else if ((0u != (job->flags & PF_PCIE_DMA_JOB_SHARED)) &&
+             (NULL_POINTER == dma_share_find(this_pcie,
+                  (PF_PCIE_EP_DMA_READ == dir) ? job->dest_address : job->src_address,
+                  job->length)))
+    {
+        returnval = PF_PCIE_DMA_SUBMIT_NOT_SHARED;
     }
     else
     {
-        g_pcie_dma.state = PF_PCIE_EP_DMA_NOT_INITIALIZED;
+        chan = &this_pcie->dma.channel[dir];
+        job->next = NULL_POINTER;
+
+        mask = dma_irq_mask(this_pcie);
+        if (NULL_POINTER != chan->tail)
+        {
+            chan->tail->next = job;
+        }
+        else
+        {
+            chan->head = job;
+        }
+        chan->tail = job;
+
+        if (PF_PCIE_EP_DMA_IN_PROGRESS != chan->state)
+        {
+            dma_channel_next(this_pcie, (uint8_t)dir);
+        }
+        dma_irq_restore(this_pcie, mask);
     }
+
+    return returnval;
 }
 
 /**************************************************************************//**
@@ -1180,26 +1447,137 @@ PF_PCIE_dma_write
  *
  */
 pf_pcie_ep_dma_status_t
-PF_PCIE_dma_get_transfer_status
+PF_PCIE_inst_dma_get_channel_status
 (
-    void
+    pf_pcie_instance_t * this_pcie,
+    pf_pcie_ep_dma_dir_t dir
+)
+{
+    pf_pcie_ep_dma_status_t status = PF_PCIE_EP_DMA_NOT_INITIALIZED;
+
+    if ((NULL_POINTER != this_pcie->ep_bridge) &&
+        ((uint32_t)dir < DMA_NUM_CHANNELS))
+    {
+        status = this_pcie->dma.channel[dir].state;
+    }
+
+    return status;
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+uint8_t
+PF_PCIE_inst_dma_share_buffer
+(
+    pf_pcie_instance_t * this_pcie,
+    uint64_t cpu_address,
+    uint64_t size,
+    uint64_t pcie_address
+)
+{
+    pf_pcie_dma_share_t * share;
+    uint8_t returnval = PF_PCIE_DMA_SHARE_FAILURE;
+    uint8_t free_idx = PF_PCIE_DMA_SHARE_REGIONS;
+    uint8_t idx;
+
+    if (0u != size)
+    {
+        for (idx = 0u; idx < PF_PCIE_DMA_SHARE_REGIONS; idx++)
+        {
+            share = &this_pcie->dma.share[idx];
+            if (0u == share->size)
+            {
+                if (PF_PCIE_DMA_SHARE_REGIONS == free_idx)
+                {
+                    free_idx = idx;
+                }
+            }
+            else if ((cpu_address < (share->cpu_address + share->size)) &&
+                     (share->cpu_address < (cpu_address + size)))
+            {
+                /* Overlaps, refused */
+                free_idx = PF_PCIE_DMA_SHARE_REGIONS;
+                break;
+            }
+            else
+            {
+                /* Not overlapping */
+            }
+        }
+
+        if (free_idx < PF_PCIE_DMA_SHARE_REGIONS)
+        {
+            share = &this_pcie->dma.share[free_idx];
+            share->cpu_address = cpu_address;
+            share->pcie_address = pcie_address;
+            share->size = size;
+            returnval = PF_PCIE_DMA_SHARE_SUCCESS;
+        }
+    }
+
+    return returnval;
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_inst_dma_unshare_buffer
+(
+    pf_pcie_instance_t * this_pcie,
+    uint64_t cpu_address
+)
+{
+    uint8_t idx;
+
+    for (idx = 0u; idx < PF_PCIE_DMA_SHARE_REGIONS; idx++)
+    {
+        if ((0u != this_pcie->dma.share[idx].size) &&
+            (cpu_address == this_pcie->dma.share[idx].cpu_address))
+        {
+            this_pcie->dma.share[idx].size = 0u;
+        }
+    }
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+pf_pcie_ep_dma_status_t
+PF_PCIE_inst_dma_get_transfer_status
+(
+    pf_pcie_instance_t * this_pcie
 )
 {
-    return g_pcie_dma.state;
+    pf_pcie_ep_dma_status_t status = this_pcie->dma.state;
+
+    if ((PF_PCIE_EP_DMA_IN_PROGRESS ==
+         this_pcie->dma.channel[PF_PCIE_EP_DMA_WRITE].state) ||
+        (PF_PCIE_EP_DMA_IN_PROGRESS ==
+         this_pcie->dma.channel[PF_PCIE_EP_DMA_READ].state))
+    {
+        status = PF_PCIE_EP_DMA_IN_PROGRESS;
+    }
+
+    return status;
 }
 
 /**************************************************************************//**
  * See pf_pciess.h for details of how to use this function.
  *
  */
-void PF_PCIE_enable_interrupts(void)
+void PF_PCIE_inst_enable_interrupts(pf_pcie_instance_t * this_pcie)
 {
     /* Check RP bridge access enabled */
-    if (NULL_POINTER != g_rp_pcie_bridge)
+    if (NULL_POINTER != this_pcie->rp_bridge)
     {
-        g_rp_pcie_bridge->IMASK_LOCAL = PCIE_LOCAL_INT_ENABLE;
-        g_rp_pcie_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
-        g_rp_pcie_bridge->ISTATUS_MSI = PCIE_ISTATUS_CLEAR;
+        this_pcie->rp_bridge->IMASK_LOCAL = PCIE_LOCAL_INT_ENABLE;
+        this_pcie->rp_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
+        this_pcie->rp_bridge->ISTATUS_MSI = PCIE_ISTATUS_CLEAR;
     }
 }
 
@@ -1207,13 +1585,13 @@ void PF_PCIE_enable_interrupts(void)
  * See pf_pciess.h for details of how to use this function.
  *
  */
-void PF_PCIE_disable_interrupts(void)
+void PF_PCIE_inst_disable_interrupts(pf_pcie_instance_t * this_pcie)
 {
     /* Check RP bridge access enabled */
-    if (NULL_POINTER != g_rp_pcie_bridge)
+    if (NULL_POINTER != this_pcie->rp_bridge)
     {
-        g_rp_pcie_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
-        g_rp_pcie_bridge->IMASK_LOCAL= PCIE_CLEAR;
+        this_pcie->rp_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
+        this_pcie->rp_bridge->IMASK_LOCAL= PCIE_CLEAR;
     }
 }
 
@@ -1221,49 +1599,851 @@ void PF_PCIE_disable_interrupts(void)
  * See pf_pciess.h for details of how to use this function.
  * 
  */
-void PF_PCIE_isr(void)
+void PF_PCIE_inst_isr(pf_pcie_instance_t * this_pcie)
 {
     uint32_t phy_reg;
+    uint32_t msi_pending;
+    uint8_t vector;
+    uint8_t ch;
     /* Check RP bridge access enabled */
-    if (NULL_POINTER != g_rp_pcie_bridge)
+    if (NULL_POINTER != this_pcie->rp_bridge)
     {
-        phy_reg = g_rp_pcie_bridge->ISTATUS_LOCAL;
-        phy_reg = g_rp_pcie_bridge->ISTATUS_MSI;
+        phy_reg = this_pcie->rp_bridge->ISTATUS_LOCAL;
+
+        /*
+         * Take the MSI vectors received so far. The summary bit is cleared
+         * first and only the vectors read are cleared, so a vector arriving
+         * while the handlers run raises the interrupt again.
+         */
+        this_pcie->rp_bridge->ISTATUS_LOCAL = PCIE_LOCAL_MSI_INT;
+        msi_pending = this_pcie->rp_bridge->ISTATUS_MSI;
+        this_pcie->rp_bridge->ISTATUS_MSI = msi_pending;
 
         /* Check EP bridge access enabled with DMA */
-        if (NULL_POINTER != g_ep_bridge_reg)
+        if (NULL_POINTER != this_pcie->ep_bridge)
         {
-            phy_reg = g_ep_bridge_reg->ISTATUS_HOST;
+            phy_reg = this_pcie->ep_bridge->ISTATUS_HOST;
 
-            /* Check EP DMA0/1 interrupt occurred */
-            if (PCIE_CLEAR != (phy_reg & DMA_INT_STATUS))
+            /* Check EP DMA0/1 interrupt or error occurred, per engine */
+            if (PCIE_CLEAR != (phy_reg & (DMA_INT_STATUS | DMA_ERR_STATUS)))
             {
-                g_ep_bridge_reg->ISTATUS_HOST = DMA_INT_STATUS;
-                g_pcie_dma.state = PF_PCIE_EP_DMA_COMPLETED;
-
-                if (NULL_POINTER != g_pcie_dma.tx_complete_handler)
+                for (ch = 0u; ch < DMA_NUM_CHANNELS; ch++)
                 {
-                    g_pcie_dma.tx_complete_handler(PF_PCIE_EP_DMA_COMPLETED);
-                }
-            }
-            else if (PCIE_CLEAR != (phy_reg & DMA_ERR_STATUS))
-            {
-                g_ep_bridge_reg->ISTATUS_HOST = DMA_ERR_STATUS;
-                g_pcie_dma.state = PF_PCIE_EP_DMA_ERROR;
-
-                if (NULL_POINTER != g_pcie_dma.rx_complete_handler)
-                {
-                    g_pcie_dma.rx_complete_handler(PF_PCIE_EP_DMA_ERROR);
+                    if (PCIE_CLEAR != (phy_reg & DMA_ERR_BIT(ch)))
+                    {
+                        this_pcie->ep_bridge->ISTATUS_HOST = DMA_ERR_BIT(ch) |
+                                                        DMA_INT_BIT(ch);
+                        dma_channel_complete(this_pcie, ch, PF_PCIE_EP_DMA_ERROR);
+                    }
+                    else if (PCIE_CLEAR != (phy_reg & DMA_INT_BIT(ch)))
+                    {
+                        this_pcie->ep_bridge->ISTATUS_HOST = DMA_INT_BIT(ch);
+                        dma_channel_complete(this_pcie, ch, PF_PCIE_EP_DMA_COMPLETED);
+                    }
+                    else
+                    {
+                        ; /* engine still busy or idle */
+                    }
                 }
             }
             else
             {
-                g_ep_bridge_reg->ISTATUS_HOST = PCIE_ISTATUS_CLEAR;
+                this_pcie->ep_bridge->ISTATUS_HOST = PCIE_ISTATUS_CLEAR;
             }
         }
-        g_rp_pcie_bridge->ISTATUS_MSI = PCIE_ISTATUS_CLEAR;
-        g_rp_pcie_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
+
+        /* Dispatch each received vector to its handler, lowest first */
+        vector = 0u;
+        while (PCIE_CLEAR != msi_pending)
+        {
+            if ((PCIE_CLEAR != (msi_pending & PCIE_SET)) &&
+                (NULL_POINTER != this_pcie->msi_handler[vector]))
+            {
+                this_pcie->msi_handler[vector](vector,
+                                               this_pcie->msi_user_data[vector]);
+            }
+            msi_pending >>= 1u;
+            vector++;
+        }
+
+        this_pcie->rp_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR & ~PCIE_LOCAL_MSI_INT;
+    }
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+uint8_t
+PF_PCIE_inst_set_msi_handler
+(
+    pf_pcie_instance_t * this_pcie,
+    uint8_t vector,
+    pf_pcie_msi_handler_t handler,
+    void * user_data
+)
+{
+    uint32_t mask;
+    uint8_t returnval = PF_PCIE_MSI_HANDLER_INVALID;
+
+    if (vector < PF_PCIE_MSI_VECTORS)
+    {
+        mask = dma_irq_mask(this_pcie);
+        this_pcie->msi_handler[vector] = handler;
+        this_pcie->msi_user_data[vector] = user_data;
+        dma_irq_restore(this_pcie, mask);
+        returnval = PF_PCIE_MSI_HANDLER_SUCCESS;
+    }
+
+    return returnval;
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void PF_PCIE_inst_init(pf_pcie_instance_t * this_pcie)
+{
+    uint8_t ch;
+    uint8_t vector;
+
+    this_pcie->rp_bridge = NULL_POINTER;
+    this_pcie->rp_ctrl = NULL_POINTER;
+    this_pcie->ep_bridge = NULL_POINTER;
+    this_pcie->ep_ctrl = NULL_POINTER;
+    this_pcie->cfg_session = PCIE_CLEAR;
+
+    this_pcie->dma.state = PF_PCIE_EP_DMA_NOT_INITIALIZED;
+    this_pcie->dma.tx_complete_handler = NULL_POINTER;
+    this_pcie->dma.rx_complete_handler = NULL_POINTER;
+    for (ch = 0u; ch < DMA_NUM_CHANNELS; ch++)
+    {
+        this_pcie->dma.channel[ch].state = PF_PCIE_EP_DMA_NOT_INITIALIZED;
+        this_pcie->dma.channel[ch].inflight = NULL_POINTER;
+        this_pcie->dma.channel[ch].head = NULL_POINTER;
+        this_pcie->dma.channel[ch].tail = NULL_POINTER;
+    }
+    for (ch = 0u; ch < PF_PCIE_DMA_SHARE_REGIONS; ch++)
+    {
+        this_pcie->dma.share[ch].size = 0u;
+    }
+
+    this_pcie->enumeration.no_of_bridges_attached = PCIE_CLEAR;
+    this_pcie->enumeration.no_of_devices_attached = PCIE_CLEAR;
+
+    for (vector = 0u; vector < PF_PCIE_MSI_VECTORS; vector++)
+    {
+        this_pcie->msi_handler[vector] = NULL_POINTER;
+        this_pcie->msi_user_data[vector] = NULL_POINTER;
+    }
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+pf_pcie_ebuff_t *
+PF_PCIE_enumeration
+(
+    uint64_t apb_addr,
+    uint8_t pcie_ctrl_num,
+    uint64_t ecam_addr
+)
+{
+    return PF_PCIE_inst_enumeration(&g_pcie_default, apb_addr, pcie_ctrl_num, ecam_addr);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+pf_pcie_bar_info_t *
+PF_PCIE_allocate_memory
+(
+    uint64_t ecam_addr,
+    uint64_t allocate_addr
+)
+{
+    return PF_PCIE_inst_allocate_memory(&g_pcie_default, ecam_addr, allocate_addr);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+uint8_t
+PF_PCIE_enumeration_cache_save
+(
+    uint64_t ecam_addr,
+    pf_pcie_enum_cache_t * cache
+)
+{
+    return PF_PCIE_inst_enumeration_cache_save(&g_pcie_default, ecam_addr, cache);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+pf_pcie_ebuff_t *
+PF_PCIE_enumeration_cache_restore
+(
+    uint64_t apb_addr,
+    uint8_t pcie_ctrl_num,
+    uint64_t ecam_addr,
+    const pf_pcie_enum_cache_t * cache
+)
+{
+    return PF_PCIE_inst_enumeration_cache_restore(&g_pcie_default, apb_addr, pcie_ctrl_num,
+                                                  ecam_addr, cache);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_enable_config_space_msi
+(
+    uint64_t ecam_addr,
+    uint64_t msi_addr,
+    uint16_t msi_data
+)
+{
+    PF_PCIE_inst_enable_config_space_msi(&g_pcie_default, ecam_addr, msi_addr, msi_data);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+uint8_t
+PF_PCIE_config_space_atr_table_init
+(
+    uint64_t apb_addr,
+    uint8_t pcie_ctrl_num,
+    uint64_t ecam_addr
+)
+{
+    return PF_PCIE_inst_config_space_atr_table_init(&g_pcie_default, apb_addr, pcie_ctrl_num, ecam_addr);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_config_space_atr_table_terminate
+(
+    void
+)
+{
+    PF_PCIE_inst_config_space_atr_table_terminate(&g_pcie_default);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_dma_init
+(
+    uint64_t allocated_addr
+)
+{
+    PF_PCIE_inst_dma_init(&g_pcie_default, allocated_addr);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_set_dma_write_callback
+(
+    pf_pcie_write_callback_t write_callback
+)
+{
+    PF_PCIE_inst_set_dma_write_callback(&g_pcie_default, write_callback);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_set_dma_read_callback
+(
+    pf_pcie_read_callback_t rx_callback
+)
+{
+    PF_PCIE_inst_set_dma_read_callback(&g_pcie_default, rx_callback);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_dma_abort
+(
+    void
+)
+{
+    PF_PCIE_inst_dma_abort(&g_pcie_default);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_dma_read
+(
+    uint64_t src_address,
+    uint64_t dest_address,
+    uint32_t rx_lenth
+)
+{
+    PF_PCIE_inst_dma_read(&g_pcie_default, src_address, dest_address, rx_lenth);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_dma_write
+(
+    uint64_t src_address,
+    uint64_t dest_address,
+    uint32_t tx_lenth
+)
+{
+    PF_PCIE_inst_dma_write(&g_pcie_default, src_address, dest_address, tx_lenth);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+uint8_t
+PF_PCIE_dma_submit
+(
+    pf_pcie_ep_dma_dir_t dir,
+    pf_pcie_dma_job_t * job
+)
+{
+    return PF_PCIE_inst_dma_submit(&g_pcie_default, dir, job);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+pf_pcie_ep_dma_status_t
+PF_PCIE_dma_get_channel_status
+(
+    pf_pcie_ep_dma_dir_t dir
+)
+{
+    return PF_PCIE_inst_dma_get_channel_status(&g_pcie_default, dir);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+uint8_t
+PF_PCIE_dma_share_buffer
+(
+    uint64_t cpu_address,
+    uint64_t size,
+    uint64_t pcie_address
+)
+{
+    return PF_PCIE_inst_dma_share_buffer(&g_pcie_default, cpu_address, size,
+                                         pcie_address);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_dma_unshare_buffer
+(
+    uint64_t cpu_address
+)
+{
+    PF_PCIE_inst_dma_unshare_buffer(&g_pcie_default, cpu_address);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+pf_pcie_ep_dma_status_t
+PF_PCIE_dma_get_transfer_status
+(
+    void
+)
+{
+    return PF_PCIE_inst_dma_get_transfer_status(&g_pcie_default);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_enable_interrupts
+(
+    void
+)
+{
+    PF_PCIE_inst_enable_interrupts(&g_pcie_default);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_disable_interrupts
+(
+    void
+)
+{
+    PF_PCIE_inst_disable_interrupts(&g_pcie_default);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+void
+PF_PCIE_isr
+(
+    void
+)
+{
+    PF_PCIE_inst_isr(&g_pcie_default);
+}
+
+/**************************************************************************//**
+ * See pf_pciess.h for details of how to use this function.
+ *
+ */
+uint8_t
+PF_PCIE_set_msi_handler
+(
+    uint8_t vector,
+    pf_pcie_msi_handler_t handler,
+    void * user_data
+)
+{
+    return PF_PCIE_inst_set_msi_handler(&g_pcie_default, vector, handler,
+                                        user_data);
+}
+
+/****************************************************************************
+ Programs and starts one endpoint DMA engine. Called with the engine idle and
+ the DMA interrupt masked. rp_cpu_address is the CPU address of the root port
+ side of the transfer, for the cache maintenance.
+*/
+static void
+dma_start
+(
+    pf_pcie_instance_t * this_pcie,
+    uint8_t ch,
+    uint64_t src_address,
+    uint64_t dest_address,
+    uint32_t length,
+    uint64_t rp_cpu_address
+)
+{
+#ifndef PF_PCIE_CACHE_MAINTENANCE
+    (void)rp_cpu_address;
+#endif
+    if ((uint8_t)PF_PCIE_EP_DMA_READ == ch)
+    {
+#ifdef PF_PCIE_CACHE_MAINTENANCE
+        /* Destination is the root port memory */
+        mss_l2_flush_range(rp_cpu_address, length);
+#endif
+        this_pcie->ep_bridge->DMA1_CONTROL = PCIE_CLEAR;
+        /* AXI4-Master Interface for Source*/
+        this_pcie->ep_bridge->DMA1_SRC_PARAM = EP_DMA_INTERFACE_AXI;
+        /* PCIe Interface for Destination */
+        this_pcie->ep_bridge->DMA1_DESTPARAM = EP_DMA_INTERFACE_PCIE;
+        /* Set source address */
+        this_pcie->ep_bridge->DMA1_SRCADDR_LDW = (uint32_t)(src_address & MASK_32BIT);
+        this_pcie->ep_bridge->DMA1_SRCADDR_UDW = (uint32_t)((src_address >> SHIFT_32BIT) & MASK_32BIT);
+        /* Set destination address*/
+        this_pcie->ep_bridge->DMA1_DESTADDR_LDW = (uint32_t)(dest_address & MASK_32BIT);
+        this_pcie->ep_bridge->DMA1_DESTADDR_UDW = (uint32_t)((dest_address >> SHIFT_32BIT) & MASK_32BIT);
+        /* Set dma size */
+        this_pcie->ep_bridge->DMA1_LENGTH = length;
+        /*Start dma transaction */
+        this_pcie->ep_bridge->DMA1_CONTROL = EP_DMA_START_DATA;
+    }
+    else
+    {
+#ifdef PF_PCIE_CACHE_MAINTENANCE
+        /* Source is the root port memory */
+        mss_l2_flush_range(rp_cpu_address, length);
+#endif
+        this_pcie->ep_bridge->DMA0_CONTROL = PCIE_CLEAR;
+        /* PCIe Interface for Source */
+        this_pcie->ep_bridge->DMA0_SRC_PARAM = EP_DMA_INTERFACE_PCIE;
+        /*AXI4-Master Interface for Destination*/
+        this_pcie->ep_bridge->DMA0_DESTPARAM = EP_DMA_INTERFACE_AXI;
+        /* Set source address */
+        this_pcie->ep_bridge->DMA0_SRCADDR_LDW = (uint32_t)(src_address & MASK_32BIT);
+        this_pcie->ep_bridge->DMA0_SRCADDR_UDW = (uint32_t)((src_address >> SHIFT_32BIT) & MASK_32BIT);
+        /* Set destination address*/
+        this_pcie->ep_bridge->DMA0_DESTADDR_LDW = (uint32_t)(dest_address & MASK_32BIT);
+        this_pcie->ep_bridge->DMA0_DESTADDR_UDW = (uint32_t)((dest_address >> SHIFT_32BIT) & MASK_32BIT);
+        /* Set dma size */
+        this_pcie->ep_bridge->DMA0_LENGTH = length;
+        /*Start dma transaction */
+        this_pcie->ep_bridge->DMA0_CONTROL = EP_DMA_START_DATA;
+    }
+
+    this_pcie->dma.channel[ch].state = PF_PCIE_EP_DMA_IN_PROGRESS;
+    this_pcie->dma.state = PF_PCIE_EP_DMA_IN_PROGRESS;
+}
+
+/****************************************************************************
+ Starts the first queued job of an idle engine, if there is one.
+*/
+static void
+dma_channel_next
+(
+    pf_pcie_instance_t * this_pcie,
+    uint8_t ch
+)
+{
+    pf_pcie_dma_channel_t * chan = &this_pcie->dma.channel[ch];
+    pf_pcie_dma_job_t * job = chan->head;
+    const pf_pcie_dma_share_t * share;
+    uint64_t src_address;
+    uint64_t dest_address;
+    uint64_t rp_cpu_address;
+
+    if (NULL_POINTER != job)
+    {
+        chan->head = job->next;
+        if (NULL_POINTER == chan->head)
+        {
+            chan->tail = NULL_POINTER;
+        }
+        job->next = NULL_POINTER;
+        chan->inflight = job;
+
+        src_address = job->src_address;
+        dest_address = job->dest_address;
+        rp_cpu_address = ((uint8_t)PF_PCIE_EP_DMA_READ == ch) ? dest_address : src_address;
+
+        if (0u != (job->flags & PF_PCIE_DMA_JOB_SHARED))
+        {
+            /* Checked by PF_PCIE_inst_dma_submit() */
+            share = dma_share_find(this_pcie, rp_cpu_address, job->length);
+            if ((uint8_t)PF_PCIE_EP_DMA_READ == ch)
+            {
+                dest_address = share->pcie_address + (rp_cpu_address - share->cpu_address);
+            }
+            else
+            {
+                src_address = share->pcie_address + (rp_cpu_address - share->cpu_address);
+            }
+        }
+
+        dma_start(this_pcie, ch, src_address, dest_address, job->length,
+                  rp_cpu_address);
+    }
+}
+
+/****************************************************************************
+ Returns the shared buffer holding length bytes from cpu_address, or
+ NULL_POINTER if there is none.
+*/
+static const pf_pcie_dma_share_t *
+dma_share_find
+(
+    const pf_pcie_instance_t * this_pcie,
+    uint64_t cpu_address,
+    uint64_t length
+)
+{
+    const pf_pcie_dma_share_t * share;
+    const pf_pcie_dma_share_t * found = NULL_POINTER;
+    uint8_t idx;
+
+    for (idx = 0u; idx < PF_PCIE_DMA_SHARE_REGIONS; idx++)
+    {
+        share = &this_pcie->dma.share[idx];
+        if ((0u != share->size) && (cpu_address >= share->cpu_address) &&
+            (length <= share->size) &&
+            ((cpu_address - share->cpu_address) <= (share->size - length)))
+        {
+            found = share;
+        }
+    }
+
+    return found;
+}
+
+/****************************************************************************
+ Completion of the transfer on one engine, from PF_PCIE_isr(). The next queued
+ job is started before the completed job's callback, or the direction's
+ registered callback for a PF_PCIE_dma_read()/PF_PCIE_dma_write() transfer,
+ is called.
+*/
+static void
+dma_channel_complete
+(
+    pf_pcie_instance_t * this_pcie,
+    uint8_t ch,
+    pf_pcie_ep_dma_status_t status
+)
+{
+    pf_pcie_dma_channel_t * chan = &this_pcie->dma.channel[ch];
+    pf_pcie_dma_job_t * job = chan->inflight;
+
+    chan->inflight = NULL_POINTER;
+    chan->state = status;
+    this_pcie->dma.state = status;
+
+    dma_channel_next(this_pcie, ch);
+
+    if (NULL_POINTER != job)
+    {
+        if (NULL_POINTER != job->callback)
+        {
+            job->callback(job, status);
+        }
+    }
+    else if ((uint8_t)PF_PCIE_EP_DMA_WRITE == ch)
+    {
+        if (NULL_POINTER != this_pcie->dma.tx_complete_handler)
+        {
+            this_pcie->dma.tx_complete_handler(status);
+        }
+    }
+    else
+    {
+        if (NULL_POINTER != this_pcie->dma.rx_complete_handler)
+        {
+            this_pcie->dma.rx_complete_handler(status);
+        }
+    }
+}
+
+/****************************************************************************
+ Masks the root port local interrupts, through which PF_PCIE_isr() is called,
+ while the DMA queues are updated. Returns the previous mask.
+*/
+static uint32_t
+dma_irq_mask
+(
+    const pf_pcie_instance_t * this_pcie
+)
+{
+    uint32_t mask = PCIE_CLEAR;
+
+    if (NULL_POINTER != this_pcie->rp_bridge)
+    {
+        mask = this_pcie->rp_bridge->IMASK_LOCAL;
+        this_pcie->rp_bridge->IMASK_LOCAL = PCIE_CLEAR;
+    }
+
+    return mask;
+}
+
+static void
+dma_irq_restore
+(
+    const pf_pcie_instance_t * this_pcie,
+    uint32_t mask
+)
+{
+    if (NULL_POINTER != this_pcie->rp_bridge)
+    {
+        this_pcie->rp_bridge->IMASK_LOCAL = mask;
+    }
+}
+
+/****************************************************************************
+ Clears the root port interrupts and maps the ECAM window at ecam_addr onto
+ the configuration space, for enumeration or a cache restore.
+*/
+static void
+cfg_window_map
+(
+    const pf_pcie_instance_t * this_pcie,
+    uint64_t ecam_addr
+)
+{
+    uint32_t ecam_addr_low;
+    uint32_t ecam_addr_high;
+
+    /* Clear interrupts on PCIe RootPort */
+    this_pcie->rp_ctrl->ECC_CONTROL = PCIE_ECC_DISABLE;
+    this_pcie->rp_ctrl->PCIE_EVENT_INT = PCIE_EVENT_INT_DATA;
+    this_pcie->rp_ctrl->SEC_ERROR_INT = PCIE_SEC_ERROR_INT_CLEAR;
+    this_pcie->rp_ctrl->DED_ERROR_INT = PCIE_DED_ERROR_INT_CLEAR;
+    this_pcie->rp_bridge->ISTATUS_LOCAL = PCIE_ISTATUS_CLEAR;
+    this_pcie->rp_bridge->IMASK_LOCAL = PCIE_CLEAR;
+    this_pcie->rp_bridge->ISTATUS_HOST = PCIE_ISTATUS_CLEAR;
+    this_pcie->rp_bridge->IMASK_HOST = PCIE_CLEAR;
+
+    ecam_addr_low = (uint32_t)(ecam_addr & MASK_32BIT);
+    ecam_addr_high = (uint32_t)((ecam_addr >> SHIFT_32BIT) & MASK_32BIT);
+    /* Select PCIe Config space */
+    this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_PARAM = PCIE_CONFIG_INTERFACE;
+    /* Address Translation table setup */
+    this_pcie->rp_bridge->ATR0_AXI4_SLV0_SRCADDR_PARAM = ecam_addr_low | SIZE_256MB_TRANSLATE_TABLE_EN;
+    this_pcie->rp_bridge->ATR0_AXI4_SLV0_SRC_ADDR = ecam_addr_high;
+    this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_ADDR_LSB = ecam_addr_low;
+    this_pcie->rp_bridge->ATR0_AXI4_SLV0_TRSL_ADDR_UDW = ecam_addr_high;
+}
+
+/****************************************************************************
+ Enables memory access, bus mastering and the device control settings of an
+ endpoint function found by enumeration.
+*/
+static void
+cfg_endpoint_setup
+(
+    uint64_t src_ecam_addr
+)
+{
+    PCIE_END_CONF * p_pcie_config_space = (PCIE_END_CONF *)((uintptr_t)src_ecam_addr);
+    uint32_t * p_pcie_ep_config_space;
+    uint32_t addr_inc;
+    uint32_t p_reg;
+
+    /* Enable config space  memory access bus master and cache size */
+    p_pcie_config_space->CFG_PRMSCR |= (EP_CFG_PRMSCR_DATA);
+    p_pcie_config_space->BIST_HEADER = PCIE_CFG_CATCHE_SIZE;
+
+    p_pcie_ep_config_space = (uint32_t *)((uintptr_t)src_ecam_addr);
+    /* PCIe configuration header starts after standard size - 0x40/4 = 0x10 */
+    p_pcie_ep_config_space = p_pcie_ep_config_space + 0x10u;
+
+    for (addr_inc = PCIE_CLEAR; addr_inc < 48u; ++addr_inc)
+    {
+        /* Read Capability ID 10h for PCI Express Capability structure */
+        p_reg = *(p_pcie_ep_config_space + addr_inc);
+        if (PCIE_CAPB_ID_STRUCT == (p_reg & PCIE_CAPB_ID_MASK))
+        {
+            break;
+        }
+    }
+    if (addr_inc < 48u)
+    {
+        /* Device control and status offset */
+        addr_inc = addr_inc + 2u;
+        /* End Point control and status configure */
+        *(p_pcie_ep_config_space + addr_inc) = EP_DEVICE_CTRL_STATUS_DATA;
+    }
+}
+
+/****************************************************************************
+ Sets the bus numbers and windows of the root port, on bus 0, or of a bridge
+ found by enumeration.
+*/
+static void
+cfg_bridge_setup
+(
+    uint64_t src_ecam_addr,
+    uint8_t bus_num,
+    uint32_t prim_sec_num
+)
+{
+    PCIE_ROOT_CONF * p_pcie_root_config = (PCIE_ROOT_CONF *)((uintptr_t)src_ecam_addr);
+
+    /* Check bus num is '0' for Root Port*/
+    if (PCIE_CLEAR == bus_num)
+    {
+        /* Sub bus num 0xFF, sec bus num 1, and prime bus num 0 */
+        p_pcie_root_config->PRIM_SEC_BUS_NUM = prim_sec_num;
+        /* Control & Status Register: enable bus master,
+         * Parity Error Response and  SERR#
+         */
+        p_pcie_root_config->CFG_PRMSCR = RP_CFG_PRMSCR_DATA;
+        /* Non-prefetchable Limit, Non-prefetchable Base */
+        p_pcie_root_config->MEM_LIMIT_BASE = RP_MEM_LIMIT_BASE_DATA;
+        /* Prefetchable Limit, Prefetchable Base */
+        p_pcie_root_config->PREF_MEM_LIMIT_BASE = RP_PREF_MEM_LIMIT_BASE_DATA;
+        /* Prefetchable Base upper */
+        p_pcie_root_config->PREF_BASE_UPPER = RP_PREF_BASE_UPPER_DATA;
+        /* Prefetchable upper limit*/
+        p_pcie_root_config->PREF_LIMIT_UPPER = RP_PREF_LIMIT_UPPER_DATA;
+        p_pcie_root_config->DEVICE_CTRL_STAT = RP_DEVICE_CTRL_STATUS_DATA;
+    }
+    else
+    {
+        /* The PCIe bridge primary and secondary bus setup */
+        p_pcie_root_config->PRIM_SEC_BUS_NUM = prim_sec_num;
+        p_pcie_root_config->CFG_PRMSCR = RP_CFG_PRMSCR_DATA;
+    }
+}
+
+/****************************************************************************
+ Records the vendor/device ID and the first bar_count BARs of a function.
+*/
+static void
+cfg_cache_save_entry
+(
+    pf_pcie_enum_cache_entry_t * entry,
+    uint64_t ecam_addr,
+    uint8_t bar_count
+)
+{
+    uint8_t bar;
+
+    PF_PCIE_config_space_read(ecam_addr, DEVICE_VID_DEVID, &entry->vid_devid);
+    for (bar = PCIE_CLEAR; bar < PF_PCIE_ENUM_CACHE_BARS; bar++)
+    {
+        entry->bar[bar] = PCIE_CLEAR;
+        if (bar < bar_count)
+        {
+            PF_PCIE_config_space_read(ecam_addr, (uint16_t)(DEVICE_BAR0 + (4u * bar)),
+                                      &entry->bar[bar]);
+        }
+    }
+}
+
+/****************************************************************************
+ Writes back the BARs recorded for a function if it still has the recorded
+ vendor/device ID. Returns PCIE_SET on a match and PCIE_CLEAR otherwise.
+*/
+static uint8_t
+cfg_cache_restore_entry
+(
+    const pf_pcie_enum_cache_entry_t * entry,
+    uint64_t ecam_addr,
+    uint8_t bar_count
+)
+{
+    uint8_t match = PCIE_CLEAR;
+    uint32_t vid_devid;
+    uint8_t bar;
+
+    PF_PCIE_config_space_read(ecam_addr, DEVICE_VID_DEVID, &vid_devid);
+    if (entry->vid_devid == vid_devid)
+    {
+        for (bar = PCIE_CLEAR; bar < bar_count; bar++)
+        {
+            PF_PCIE_config_space_write(ecam_addr, (uint16_t)(DEVICE_BAR0 + (4u * bar)),
+                                       entry->bar[bar]);
+        }
+        match = PCIE_SET;
     }
+    return match;
 }
 
 /****************************************************************************
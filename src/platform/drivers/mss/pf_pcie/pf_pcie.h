@@ -77,12 +77,50 @@
     function after it calls the PF_PCIE_enumeration() function. This function
     uses the ECAM base address and allocated memory address from the host
     processor memory map as its parameters.
+
+    Enumeration cache
+    Enumerating a system with switches reads every possible function of each
+    bus, and sizing each BAR takes several configuration accesses. Once the
+    system has been enumerated and its memory allocated, the application can
+    record the result with PF_PCIE_enumeration_cache_save() in a
+    pf_pcie_enum_cache_t kept, for example, in eNVM or external flash. On the
+    next boot PF_PCIE_enumeration_cache_restore() only reads the vendor and
+    device ID of each recorded function, in bus order, and writes the recorded
+    bus numbers, control settings and BAR values back without scanning or
+    sizing. If any function does not match the cache, it returns NULL and the
+    application enumerates and allocates memory as usual, then saves the cache
+    again. A function added since the cache was saved, in a slot where none
+    was before, is not seen by the restore, so the cache must be invalidated
+    when the hardware is changed.
+
+    Configuration space sessions
+    PF_PCIE_enumeration(), PF_PCIE_allocate_memory() and the cache functions
+    each switch the AXI4 slave ATR window to the configuration space and back
+    to the Tx/Rx interface. Between PF_PCIE_config_space_atr_table_init() and
+    PF_PCIE_config_space_atr_table_terminate() the window is left on the
+    configuration space, so a scan made of many of these calls and of
+    PF_PCIE_config_space_read() and PF_PCIE_config_space_write() accesses does
+    not reprogram it each time. Memory accesses to the endpoint BARs through
+    the window must not be made during a session.
     
     MSI Enabling 
     The PF_PCIE_enable_config_space_msi() enables MSI in the PCIe configuration
     space of the MSI capability register set. The application must call this
     function after it calls the PF_PCIE_enumeration() function. The function must
     be called separately to enable MSI in the PCIe root port and PCIe endpoint.
+
+    MSI vector dispatch
+    The root port records each MSI it receives in one of 32 vector status bits,
+    selected by the low five bits of the message data. An endpoint enabled for
+    multiple messages uses the consecutive vectors from msi_data upwards, for
+    example one per submission or completion queue, and the entries of an
+    MSI-X table can be given the root port MSI address and their own vector
+    number as data. PF_PCIE_set_msi_handler() registers a handler per vector
+    and PF_PCIE_isr() calls the handler of each vector received, so each
+    endpoint queue is serviced by its own function without a shared handler
+    scanning all sources. All vectors are delivered through the single PCIe
+    interrupt of the controller, so they are handled on the hart which takes
+    that interrupt.
     
     Configuration Space Read and Write 
     The following functions are used for configuration space read and write:
@@ -103,6 +141,28 @@
     read the entire PCIe type 1 configuration space header information using the
     PF_PCIE_type1_header_read() function.
     
+    MMIO bursts and ordering
+    The root port AXI4 slave window, through which the endpoint BARs are
+    accessed, is in non-cacheable address space, so each processor store to
+    it becomes one AXI write; stores to it are not combined. The DDR write
+    combining buffer aliases only apply to DDR. PF_PCIE_mmio_write_burst()
+    copies a block, such as a batch of descriptors, to a BAR with the widest
+    aligned stores, 64 bits, so it is written in as few transactions as the
+    processor can issue. Data the endpoint fetches itself by bus mastering,
+    for example a descriptor ring, is best placed in root port DDR, where it
+    can be written through the non-cached write combining alias of the DDR
+    and read by the endpoint in bursts. Write combined data is only certain
+    to have reached DDR once the processor has read back one of the locations
+    written through the same alias.
+    The ordering between these writes and the MMIO write that tells the
+    endpoint to use them, usually a doorbell, is kept with:
+        • PF_PCIE_wmb(), between the data writes, to memory or to a BAR, and
+          the doorbell write
+        • PF_PCIE_rmb(), between the read of an endpoint status showing that
+          data is ready and the reads of that data
+        • PF_PCIE_mb(), which orders all earlier accesses before all later
+          ones
+
     Address Translation table
     The following functions are used for address translation table setup:
         • PF_PCIE_master_atr_table_init()
@@ -120,6 +180,7 @@
         • PF_PCIE_enable_interrupts()
         • PF_PCIE_disable_interrupts()
         • PF_PCIE_isr()
+        • PF_PCIE_set_msi_handler()
     The PF_PCIE_enable_interrupts() function is used to enable the local MSI,
     INTx, and DMA transfer interrupts on the PCIe Root Port.
     The PF_PCIE_disable_interrupts() function is used to disable the local MSI,
@@ -139,6 +200,10 @@
         • PF_PCIE_set_dma_write_callback()
         • PF_PCIE_set_dma_read_callback()
         • PF_PCIE_dma_get_transfer_status()
+        • PF_PCIE_dma_submit()
+        • PF_PCIE_dma_get_channel_status()
+        • PF_PCIE_dma_share_buffer()
+        • PF_PCIE_dma_unshare_buffer()
         
     Initialization
     The PF_PCIE_dma_init() function in the PCIe root port application initializes
@@ -161,6 +226,44 @@
 
     The PF_PCIE_dma_abort() function aborts a dma transfer that is in progress.
 
+    DMA job queues
+    The endpoint has two DMA engines, DMA0 for writes and DMA1 for reads, and
+    they run independently. PF_PCIE_dma_submit() adds a job, described by a
+    pf_pcie_dma_job_t structure, to the queue of one engine and returns
+    straight away. A job is started as soon as its engine is idle, and
+    PF_PCIE_isr() starts the next job of the queue when a transfer completes,
+    before calling the completed job's own callback. Both engines can so be
+    kept busy and reads and writes run concurrently. PF_PCIE_dma_read() and
+    PF_PCIE_dma_write() still start a single transfer on their engine when it
+    is idle, and their completion is reported to the callbacks registered with
+    PF_PCIE_set_dma_read_callback() and PF_PCIE_set_dma_write_callback().
+
+    Shared buffers
+    The endpoint DMA can move data straight between the endpoint and the
+    buffers of another driver, for example the receive buffer pool of the MAC
+    driver or the ADMA2 buffers of the MMC driver, rather than through a
+    buffer of its own which the other driver then copies. Each such buffer, or
+    a block of memory holding several, is registered once with
+    PF_PCIE_dma_share_buffer(), giving its CPU address and the address the
+    inbound address translation maps to it. A job with the
+    PF_PCIE_DMA_JOB_SHARED flag then gives the root port side of the transfer
+    as a CPU address inside a shared buffer, the one the other driver uses,
+    and the driver translates it when the job is started. The completion
+    handler of the job can hand the buffer straight to the other driver, and
+    the completion handler of the other driver can submit the next job, so
+    each piece of data crosses the DDR once. pf_pcie_p2p.h provides such
+    chained transfers between the endpoint and the MAC and MMC drivers.
+
+    Cache maintenance
+    If PF_PCIE_CACHE_MAINTENANCE is defined, the root port memory buffer is
+    flushed from the L2 cache by PF_PCIE_dma_read() and PF_PCIE_dma_write()
+    before the transfer is started, so that it can be placed in cached DDR. The
+    root port address passed to these functions is then expected to be the CPU
+    address of the buffer, that is the inbound address translation must map
+    it one to one. The CPU must not access the buffer until the transfer has
+    completed. For a job on a shared buffer the flush is made on its CPU
+    address, so the translation of a shared buffer need not be one to one.
+
     Data transfer status
     The status of the PCIe DMA transfer initiated by the last call to PF_PCIE_dma_read()
     or PF_PCIE_dma_write() can be retrieved using the PF_PCIE_dma_get_transfer_status()
@@ -185,6 +288,18 @@
     And also, the user must call the PF_PCIE_isr() function from the system
     level interrupt handler for handling DMA interrupts.
 
+    Multiple controllers
+    The functions above keep their state in a single instance inside the
+    driver, so they drive one root port and one endpoint DMA at a time. To use
+    both PCIe controllers together, the application declares one
+    pf_pcie_instance_t per controller, initializes each with
+    PF_PCIE_inst_init() and uses the PF_PCIE_inst_xxx() functions, which take
+    the instance as their first parameter and otherwise behave as the function
+    of the same name without "inst_". Each instance has its own DMA engines
+    and queues, and PF_PCIE_inst_isr() is called with its instance from the
+    interrupt handler of that controller. The address translation table and
+    configuration space access functions keep no state and are shared.
+
 *//*=========================================================================*/
 #ifndef PF_PCIESS_H_
 #define PF_PCIESS_H_
@@ -216,6 +331,146 @@ extern "C" {
   a ATR table of AXI4 master/slave
 */
 #define PF_PCIE_ATR_TABLE_INIT_FAILURE  1u
+/*****************************************************************************
+  PF_PCIE_dma_submit() return values
+*/
+#define PF_PCIE_DMA_SUBMIT_SUCCESS          0u
+#define PF_PCIE_DMA_SUBMIT_NOT_INITIALIZED  1u
+#define PF_PCIE_DMA_SUBMIT_INVALID          2u
+#define PF_PCIE_DMA_SUBMIT_NOT_SHARED       3u
+
+/* pf_pcie_dma_job_t flags */
+#define PF_PCIE_DMA_JOB_SHARED              0x01u
+
+/*****************************************************************************
+  PF_PCIE_dma_share_buffer() return values
+*/
+#define PF_PCIE_DMA_SHARE_SUCCESS           0u
+#define PF_PCIE_DMA_SHARE_FAILURE           1u
+
+/* Buffers which can be shared, per instance */
+#ifndef PF_PCIE_DMA_SHARE_REGIONS
+#define PF_PCIE_DMA_SHARE_REGIONS           4u
+#endif
+
+/* Number of endpoint DMA engines, DMA0 and DMA1 */
+#define PF_PCIE_EP_DMA_CHANNELS             2u
+
+/* Number of MSI vectors decoded by the root port */
+#define PF_PCIE_MSI_VECTORS                 32u
+
+/*****************************************************************************
+  PF_PCIE_enumeration_cache_save() return values
+*/
+#define PF_PCIE_ENUM_CACHE_SUCCESS          0u
+#define PF_PCIE_ENUM_CACHE_FAILURE          1u
+
+/* Marks a pf_pcie_enum_cache_t holding a saved enumeration */
+#define PF_PCIE_ENUM_CACHE_VALID            0x50434945u
+
+/* BARs recorded per endpoint function and per bridge */
+#define PF_PCIE_ENUM_CACHE_BARS             6u
+#define PF_PCIE_ENUM_CACHE_TYPE1_BARS       2u
+
+/*****************************************************************************
+  PF_PCIE_set_msi_handler() return values
+*/
+#define PF_PCIE_MSI_HANDLER_SUCCESS         0u
+#define PF_PCIE_MSI_HANDLER_INVALID         1u
+
+/*****************************************************************************
+  The pf_pcie_msi_handler_t type defines the prototype of the functions
+  registered with PF_PCIE_set_msi_handler(). They are called from
+  PF_PCIE_isr() with the number of the MSI vector received and the user_data
+  given at registration.
+*/
+typedef void (*pf_pcie_msi_handler_t)(uint8_t vector, void * user_data);
+
+/*****************************************************************************
+  The pf_pcie_enum_cache_entry_t structure records one function of an
+  enumerated system: its vendor/device ID register, checked on restore, and
+  the values of its BARs.
+*/
+typedef struct
+{
+    uint32_t vid_devid;
+    uint32_t bar[PF_PCIE_ENUM_CACHE_BARS];
+} pf_pcie_enum_cache_entry_t;
+
+/*****************************************************************************
+  The pf_pcie_enum_cache_t structure holds an enumeration and BAR layout
+  saved by PF_PCIE_enumeration_cache_save(). bridges[] and devices[] are in
+  the order of enumeration.bridges[] and enumeration.devices[]. The
+  application stores the whole structure and gives it back to
+  PF_PCIE_enumeration_cache_restore(). Setting valid to 0 invalidates it.
+*/
+typedef struct
+{
+    uint32_t valid;
+    uint64_t ecam_addr;
+    pf_pcie_ebuff_t enumeration;
+    pf_pcie_bar_info_t bar_allocate;
+    pf_pcie_enum_cache_entry_t bridges[8u];
+    pf_pcie_enum_cache_entry_t devices[8u];
+} pf_pcie_enum_cache_t;
+
+/*****************************************************************************
+  The pf_pcie_dma_share_t structure records a buffer registered with
+  PF_PCIE_dma_share_buffer(): its CPU address and size, and the address of
+  its first byte for the endpoint DMA. A size of 0 marks a free entry.
+*/
+typedef struct
+{
+    uint64_t cpu_address;
+    uint64_t pcie_address;
+    uint64_t size;
+} pf_pcie_dma_share_t;
+
+/*****************************************************************************
+  The pf_pcie_dma_channel_t structure holds the state of one endpoint DMA
+  engine: its status, the DMA job it is running, if any, and its queue.
+*/
+typedef struct
+{
+    volatile pf_pcie_ep_dma_status_t state;
+    pf_pcie_dma_job_t * inflight;
+    pf_pcie_dma_job_t * head;
+    pf_pcie_dma_job_t * tail;
+} pf_pcie_dma_channel_t;
+
+/*****************************************************************************
+  The pf_pcie_instance_t structure holds the driver state for one PCIe
+  controller: its root port bridge, the endpoint bridge reached through the
+  endpoint BAR and used for DMA, the DMA engines and the enumeration and BAR
+  allocation results. The application provides one instance per controller
+  and initializes it with PF_PCIE_inst_init() before passing it to the
+  PF_PCIE_inst_xxx() functions. The functions without an instance parameter
+  all use a single instance internal to the driver.
+*/
+typedef struct pf_pcie_instance
+{
+    PCIE_BRIDGE * rp_bridge;
+    PCIE_CTRL * rp_ctrl;
+    PCIE_BRIDGE * ep_bridge;
+    PCIE_CTRL * ep_ctrl;
+    /* Set while a configuration space session holds the ATR window */
+    uint8_t cfg_session;
+
+    struct
+    {
+        volatile pf_pcie_ep_dma_status_t state;
+        pf_pcie_write_callback_t tx_complete_handler;
+        pf_pcie_read_callback_t rx_complete_handler;
+        pf_pcie_dma_channel_t channel[PF_PCIE_EP_DMA_CHANNELS];
+        pf_pcie_dma_share_t share[PF_PCIE_DMA_SHARE_REGIONS];
+    } dma;
+
+    pf_pcie_ebuff_t enumeration;
+    pf_pcie_bar_info_t bar_allocate;
+
+    pf_pcie_msi_handler_t msi_handler[PF_PCIE_MSI_VECTORS];
+    void * msi_user_data[PF_PCIE_MSI_VECTORS];
+} pf_pcie_instance_t;
 
 /******************************************************************************
   The PF_PCIE_enumeration() function enumerates all the components in a PCIe
@@ -328,6 +583,91 @@ PF_PCIE_allocate_memory
     uint64_t allocate_addr
 );
 
+/*****************************************************************************
+  The PF_PCIE_enumeration_cache_save() function records the result of
+  PF_PCIE_enumeration() and the BAR values written by PF_PCIE_allocate_memory()
+  in cache, so that PF_PCIE_enumeration_cache_restore() can set the same
+  system up on a later boot. It must be called after all the endpoints have
+  been allocated memory. bar_allocate of the cache is the result of the last
+  PF_PCIE_allocate_memory() call.
+
+  @param ecam_addr
+    Specifies the ECAM address given to PF_PCIE_enumeration().
+
+  @param cache
+    Points to the cache to fill in. The application stores it once this
+    function returns.
+
+  @return
+    PF_PCIE_ENUM_CACHE_SUCCESS, or PF_PCIE_ENUM_CACHE_FAILURE if the root port
+    has not been enumerated. valid is cleared on failure.
+*/
+uint8_t
+PF_PCIE_enumeration_cache_save
+(
+    uint64_t ecam_addr,
+    pf_pcie_enum_cache_t * cache
+);
+
+/*****************************************************************************
+  The PF_PCIE_enumeration_cache_restore() function sets up the PCIe system
+  recorded in cache instead of enumerating it and allocating memory. Each
+  recorded bridge and endpoint is checked against its saved vendor/device ID
+  and its bus numbers, control settings and BARs are written as
+  PF_PCIE_enumeration() and PF_PCIE_allocate_memory() wrote them, without
+  scanning the buses or sizing the BARs.
+
+  @param apb_addr
+    Specifies the base address in the processor's memory map for the registers
+    of the PCI Express hardware instance being initialized.
+
+  @param pcie_ctrl_num
+    Specifies the PCIe controller number 0 or 1.
+
+  @param ecam_addr
+    Specifies the ECAM address of PCIe system. It must be the address the
+    cache was saved with.
+
+  @param cache
+    Points to the cache saved by PF_PCIE_enumeration_cache_save().
+
+  @return
+    A pointer to the restored enumeration, as returned by
+    PF_PCIE_enumeration(). The BAR allocation is returned by
+    PF_PCIE_allocate_memory() calls made afterwards only if memory is
+    allocated again. NULL is returned if the cache is not valid, was saved for
+    another ECAM address, or does not match the system. The application must
+    then call PF_PCIE_enumeration() and PF_PCIE_allocate_memory().
+
+  @code
+        static pf_pcie_enum_cache_t g_pcie_cache;
+
+        pf_pcie_ebuff_t * p_ebuff;
+
+        nvm_read(PCIE_CACHE_NVM_ADDR, &g_pcie_cache, sizeof(g_pcie_cache));
+        p_ebuff = PF_PCIE_enumeration_cache_restore(PCIESS_AXI_APB, PF_PCIE_CTRL_1,
+                                                    ECAM_ADDR, &g_pcie_cache);
+        if (NULL == p_ebuff)
+        {
+            p_ebuff = PF_PCIE_enumeration(PCIESS_AXI_APB, PF_PCIE_CTRL_1, ECAM_ADDR);
+            (void)PF_PCIE_allocate_memory(ep_ecam_addr, EP_BAR_ADDR);
+            if (PF_PCIE_ENUM_CACHE_SUCCESS ==
+                PF_PCIE_enumeration_cache_save(ECAM_ADDR, &g_pcie_cache))
+            {
+                nvm_write(PCIE_CACHE_NVM_ADDR, &g_pcie_cache, sizeof(g_pcie_cache));
+            }
+        }
+  @endcode
+*/
+pf_pcie_ebuff_t *
+PF_PCIE_enumeration_cache_restore
+(
+    uint64_t apb_addr,
+    uint8_t pcie_ctrl_num,
+    uint64_t ecam_addr,
+    const pf_pcie_enum_cache_t * cache
+);
+
 /****************************************************************************
   The PF_PCIE_enable_config_space_msi() function enables the PCIe root port or
   endpoint MSI in the PCIe configuration space. It also sets up the message
@@ -443,7 +783,10 @@ PF_PCIE_type1_header_read
   The PF_PCIE_config_space_atr_table_init() function initializes the PCIe AXI4
   slave address translation table using the ecam_addr parameter, and enables
   the PCIe configuration interface to read or write data to the configuration
-  space registers.
+  space registers. On success it starts a configuration space session: the
+  window stays on the configuration space across PF_PCIE_enumeration(),
+  PF_PCIE_allocate_memory() and the enumeration cache functions until
+  PF_PCIE_config_space_atr_table_terminate() is called.
     
   @param apb_addr
     Specifies the base address in the processor's memory map for the registers
@@ -474,7 +817,8 @@ PF_PCIE_config_space_atr_table_init
 /****************************************************************************
   The PF_PCIE_config_space_atr_table_terminate() function disables the PCIe
   configuration interface in the address translation table and enables the PCIe
-  Tx/Rx interface for PCIe transactions.
+  Tx/Rx interface for PCIe transactions. It ends the configuration space
+  session started by PF_PCIE_config_space_atr_table_init().
     
   @param
     The PF_PCIE_config_space_atr_table_terminate() function does not have parameters.
@@ -568,6 +912,80 @@ PF_PCIE_config_space_write
     uint32_t value
 );
 
+/*****************************************************************************
+  The PF_PCIE_mmio_write_burst() function copies length bytes from src to an
+  endpoint BAR at bar_addr. The bytes up to the first 64-bit aligned address
+  of the BAR and after the last one are written one at a time and the rest
+  with 64-bit stores, whatever the alignment of src. The writes are posted:
+  use PF_PCIE_wmb() before a write which depends on them having been made.
+
+  @param bar_addr
+    Specifies the address in the processor's memory map of the BAR location
+    written first.
+
+  @param src
+    Points to the data to write.
+
+  @param length
+    Specifies the number of bytes to write.
+
+  @return
+    This function does not return a value.
+
+  @code
+        PF_PCIE_mmio_write_burst(ep_bar2_addr + RING_OFFSET, descs,
+                                 n_descs * sizeof(ep_desc_t));
+        PF_PCIE_wmb();
+        *(volatile uint32_t *)(ep_bar2_addr + DOORBELL_OFFSET) = tail;
+  @endcode
+*/
+void
+PF_PCIE_mmio_write_burst
+(
+    uint64_t bar_addr,
+    const void * src,
+    uint32_t length
+);
+
+/*****************************************************************************
+  The PF_PCIE_wmb() function makes all the memory and MMIO writes before it
+  happen before the memory and MMIO writes after it.
+*/
+static inline void PF_PCIE_wmb(void)
+{
+#if defined(__riscv)
+    __asm__ volatile ("fence ow, ow" ::: "memory");
+#else
+    __sync_synchronize();
+#endif
+}
+
+/*****************************************************************************
+  The PF_PCIE_rmb() function makes all the memory and MMIO reads before it
+  happen before the memory and MMIO reads after it.
+*/
+static inline void PF_PCIE_rmb(void)
+{
+#if defined(__riscv)
+    __asm__ volatile ("fence ir, ir" ::: "memory");
+#else
+    __sync_synchronize();
+#endif
+}
+
+/*****************************************************************************
+  The PF_PCIE_mb() function makes all the memory and MMIO accesses before it
+  happen before the memory and MMIO accesses after it.
+*/
+static inline void PF_PCIE_mb(void)
+{
+#if defined(__riscv)
+    __asm__ volatile ("fence iorw, iorw" ::: "memory");
+#else
+    __sync_synchronize();
+#endif
+}
+
 /****************************************************************************
   The PF_PCIE_master_atr_table_init() function sets up the address translation
   table for the PCIe AXI4 master.
@@ -931,6 +1349,150 @@ PF_PCIE_dma_get_transfer_status
     void
 );
 
+/*******************************************************************************
+  The PF_PCIE_dma_submit() function queues a DMA job on the endpoint DMA engine
+  selected by dir. The job is started straight away if the engine is idle,
+  otherwise when the jobs queued before it have completed. Its callback is
+  called from PF_PCIE_isr() when its transfer has completed. If the job is 
+  submitted while interrupts are not used, the queue only advances when
+  PF_PCIE_isr() is called.
+
+  The PF_PCIE_dma_abort() function stops both engines and completes the
+  queued jobs with the PF_PCIE_EP_DMA_ERROR status.
+
+  @param dir
+    Specifies the DMA engine, PF_PCIE_EP_DMA_WRITE or PF_PCIE_EP_DMA_READ.
+
+  @param job
+    Points to the job. The structure must remain valid until its callback has
+    been called.
+
+  @return
+    The PF_PCIE_dma_submit() function returns one of the following values:
+        - PF_PCIE_DMA_SUBMIT_SUCCESS
+        - PF_PCIE_DMA_SUBMIT_NOT_INITIALIZED   PF_PCIE_dma_init() not called
+        - PF_PCIE_DMA_SUBMIT_INVALID           no job, zero length or bad dir
+        - PF_PCIE_DMA_SUBMIT_NOT_SHARED        PF_PCIE_DMA_JOB_SHARED set and
+                                               the root port side not inside
+                                               one shared buffer
+
+  @code
+        static pf_pcie_dma_job_t g_wr_job[2];
+        static pf_pcie_dma_job_t g_rd_job[2];
+
+        void job_done(pf_pcie_dma_job_t * job, pf_pcie_ep_dma_status_t status)
+        {
+            if (PF_PCIE_EP_DMA_COMPLETED == status)
+            {
+                refill_and_resubmit(job);
+            }
+        }
+
+        void start_streams(void)
+        {
+            uint8_t idx;
+
+            PF_PCIE_dma_init(0x70008000);
+            PF_PCIE_enable_interrupts();
+            for (idx = 0u; idx < 2u; idx++)
+            {
+                g_wr_job[idx].src_address = RP_TX_BUF(idx);
+                g_wr_job[idx].dest_address = EP_RX_BUF(idx);
+                g_wr_job[idx].length = BUF_SIZE;
+                g_wr_job[idx].callback = job_done;
+                (void)PF_PCIE_dma_submit(PF_PCIE_EP_DMA_WRITE, &g_wr_job[idx]);
+
+                g_rd_job[idx].src_address = EP_TX_BUF(idx);
+                g_rd_job[idx].dest_address = RP_RX_BUF(idx);
+                g_rd_job[idx].length = BUF_SIZE;
+                g_rd_job[idx].callback = job_done;
+                (void)PF_PCIE_dma_submit(PF_PCIE_EP_DMA_READ, &g_rd_job[idx]);
+            }
+        }
+  @endcode
+*/
+uint8_t
+PF_PCIE_dma_submit
+(
+    pf_pcie_ep_dma_dir_t dir,
+    pf_pcie_dma_job_t * job
+);
+
+/*******************************************************************************
+  The PF_PCIE_dma_get_channel_status() function returns the status of one
+  endpoint DMA engine: PF_PCIE_EP_DMA_IN_PROGRESS while it runs a transfer,
+  otherwise the outcome of its last transfer.
+
+  @param dir
+    Specifies the DMA engine, PF_PCIE_EP_DMA_WRITE or PF_PCIE_EP_DMA_READ.
+
+  @return
+    The status of the engine as a value of type pf_pcie_ep_dma_status_t.
+*/
+pf_pcie_ep_dma_status_t
+PF_PCIE_dma_get_channel_status
+(
+    pf_pcie_ep_dma_dir_t dir
+);
+
+/*******************************************************************************
+  The PF_PCIE_dma_share_buffer() function registers a buffer, or a block of
+  memory holding several buffers, which endpoint DMA jobs with the
+  PF_PCIE_DMA_JOB_SHARED flag can read from or write to by its CPU address.
+  The buffer is typically owned by another driver, such as the receive buffer
+  pool given to MSS_MAC_rx_pool_init() or a buffer passed to
+  MSS_MMC_adma2_write(). The inbound address translation of the root port must
+  map pcie_address to the buffer.
+
+  @param cpu_address
+    Specifies the CPU address of the buffer.
+
+  @param size
+    Specifies the size of the buffer in bytes.
+
+  @param pcie_address
+    Specifies the address of the buffer for the endpoint DMA, that is the root
+    port memory address as given to PF_PCIE_dma_read() and PF_PCIE_dma_write().
+
+  @return
+    PF_PCIE_DMA_SHARE_SUCCESS, or PF_PCIE_DMA_SHARE_FAILURE if size is 0, the
+    buffer overlaps one already shared or PF_PCIE_DMA_SHARE_REGIONS buffers
+    are shared.
+
+  @code
+        static uint8_t g_rx_pool[RX_BUFS][MSS_MAC_MAX_RX_BUF_SIZE];
+
+        void share_mac_pool(void)
+        {
+            (void)PF_PCIE_dma_share_buffer((uint64_t)(uintptr_t)g_rx_pool,
+                                           sizeof(g_rx_pool),
+                                           RP_INBOUND_BASE +
+                                           ((uintptr_t)g_rx_pool - DDR_BASE));
+        }
+  @endcode
+*/
+uint8_t
+PF_PCIE_dma_share_buffer
+(
+    uint64_t cpu_address,
+    uint64_t size,
+    uint64_t pcie_address
+);
+
+/*******************************************************************************
+  The PF_PCIE_dma_unshare_buffer() function removes a buffer registered with
+  PF_PCIE_dma_share_buffer(). No job on the buffer must be queued or in
+  progress.
+
+  @param cpu_address
+    Specifies the CPU address the buffer was registered with.
+*/
+void
+PF_PCIE_dma_unshare_buffer
+(
+    uint64_t cpu_address
+);
+
 /****************************************************************************
   The PF_pcie_enable_interrupts() function enables local interrupts(MSI, INTx,
   DMAx) on the PCIe RootPort.
@@ -978,6 +1540,178 @@ void PF_PCIE_disable_interrupts(void);
 */
 void PF_PCIE_isr(void);
 
+/*****************************************************************************
+  The PF_PCIE_set_msi_handler() function registers the function that
+  PF_PCIE_isr() calls when the MSI vector is received, or removes it when
+  handler is NULL. Vectors without a handler are acknowledged and ignored.
+
+  @param vector
+    Specifies the MSI vector, from 0 to PF_PCIE_MSI_VECTORS - 1.
+
+  @param handler
+    Points to the handler function.
+
+  @param user_data
+    Passed to the handler, for example the queue served by the vector.
+
+  @return
+    PF_PCIE_MSI_HANDLER_SUCCESS, or PF_PCIE_MSI_HANDLER_INVALID if the vector
+    is out of range.
+
+  @code
+        static void nvme_cq_isr(uint8_t vector, void * user_data)
+        {
+            nvme_queue_service((nvme_queue_t *)user_data);
+        }
+
+        void setup_queues(void)
+        {
+            uint8_t q;
+
+            PF_PCIE_enable_config_space_msi(ep_ecam_addr, MSI_ADDR, MSI_BASE_DATA);
+            for (q = 0u; q < NVME_QUEUES; q++)
+            {
+                (void)PF_PCIE_set_msi_handler((uint8_t)(MSI_BASE_DATA + q),
+                                              nvme_cq_isr, &g_nvme_queue[q]);
+            }
+            PF_PCIE_enable_interrupts();
+        }
+  @endcode
+*/
+uint8_t
+PF_PCIE_set_msi_handler
+(
+    uint8_t vector,
+    pf_pcie_msi_handler_t handler,
+    void * user_data
+);
+
+/*****************************************************************************
+  The PF_PCIE_inst_init() function clears a pf_pcie_instance_t before its
+  first use, leaving it with no root port or endpoint bridge set.
+
+  @param this_pcie
+    Points to the instance.
+*/
+void PF_PCIE_inst_init(pf_pcie_instance_t * this_pcie);
+
+/*****************************************************************************
+  Instance versions of the functions above. Each one behaves as the function
+  of the same name without "inst_", on the controller state held by
+  this_pcie.
+
+  @code
+        static pf_pcie_instance_t g_pcie_a;
+        static pf_pcie_instance_t g_pcie_b;
+
+        uint8_t External_pcie0_IRQHandler(void)
+        {
+            PF_PCIE_inst_isr(&g_pcie_a);
+            return(EXT_IRQ_KEEP_ENABLED);
+        }
+
+        uint8_t External_pcie1_IRQHandler(void)
+        {
+            PF_PCIE_inst_isr(&g_pcie_b);
+            return(EXT_IRQ_KEEP_ENABLED);
+        }
+
+        void dual_link_init(void)
+        {
+            PF_PCIE_inst_init(&g_pcie_a);
+            PF_PCIE_inst_init(&g_pcie_b);
+            (void)PF_PCIE_inst_enumeration(&g_pcie_a, PCIESS_A_APB, PF_PCIE_CTRL_0, ECAM_A);
+            (void)PF_PCIE_inst_enumeration(&g_pcie_b, PCIESS_B_APB, PF_PCIE_CTRL_1, ECAM_B);
+            PF_PCIE_inst_dma_init(&g_pcie_a, EP_A_BAR_ADDR);
+            PF_PCIE_inst_dma_init(&g_pcie_b, EP_B_BAR_ADDR);
+            PF_PCIE_inst_enable_interrupts(&g_pcie_a);
+            PF_PCIE_inst_enable_interrupts(&g_pcie_b);
+        }
+  @endcode
+*/
+pf_pcie_ebuff_t * PF_PCIE_inst_enumeration(pf_pcie_instance_t * this_pcie,
+                                           uint64_t apb_addr,
+                                           uint8_t pcie_ctrl_num,
+                                           uint64_t ecam_addr);
+
+pf_pcie_bar_info_t * PF_PCIE_inst_allocate_memory(pf_pcie_instance_t * this_pcie,
+                                                  uint64_t ecam_addr,
+                                                  uint64_t allocate_addr);
+
+uint8_t PF_PCIE_inst_enumeration_cache_save(pf_pcie_instance_t * this_pcie,
+                                            uint64_t ecam_addr,
+                                            pf_pcie_enum_cache_t * cache);
+
+pf_pcie_ebuff_t *
+PF_PCIE_inst_enumeration_cache_restore(pf_pcie_instance_t * this_pcie,
+                                       uint64_t apb_addr,
+                                       uint8_t pcie_ctrl_num,
+                                       uint64_t ecam_addr,
+                                       const pf_pcie_enum_cache_t * cache);
+
+void PF_PCIE_inst_enable_config_space_msi(pf_pcie_instance_t * this_pcie,
+                                          uint64_t ecam_addr,
+                                          uint64_t msi_addr,
+                                          uint16_t msi_data);
+
+uint8_t PF_PCIE_inst_config_space_atr_table_init(pf_pcie_instance_t * this_pcie,
+                                                 uint64_t apb_addr,
+                                                 uint8_t pcie_ctrl_num,
+                                                 uint64_t ecam_addr);
+
+void PF_PCIE_inst_config_space_atr_table_terminate(pf_pcie_instance_t * this_pcie);
+
+void PF_PCIE_inst_dma_init(pf_pcie_instance_t * this_pcie,
+                           uint64_t allocated_addr);
+
+void PF_PCIE_inst_set_dma_write_callback(pf_pcie_instance_t * this_pcie,
+                                         pf_pcie_write_callback_t write_callback);
+
+void PF_PCIE_inst_set_dma_read_callback(pf_pcie_instance_t * this_pcie,
+                                        pf_pcie_read_callback_t rx_callback);
+
+void PF_PCIE_inst_dma_read(pf_pcie_instance_t * this_pcie,
+                           uint64_t src_address,
+                           uint64_t dest_address,
+                           uint32_t rx_lenth);
+
+void PF_PCIE_inst_dma_write(pf_pcie_instance_t * this_pcie,
+                            uint64_t src_address,
+                            uint64_t dest_address,
+                            uint32_t tx_lenth);
+
+void PF_PCIE_inst_dma_abort(pf_pcie_instance_t * this_pcie);
+
+pf_pcie_ep_dma_status_t
+PF_PCIE_inst_dma_get_transfer_status(pf_pcie_instance_t * this_pcie);
+
+uint8_t PF_PCIE_inst_dma_submit(pf_pcie_instance_t * this_pcie,
+                                pf_pcie_ep_dma_dir_t dir,
+                                pf_pcie_dma_job_t * job);
+
+pf_pcie_ep_dma_status_t
+PF_PCIE_inst_dma_get_channel_status(pf_pcie_instance_t * this_pcie,
+                                    pf_pcie_ep_dma_dir_t dir);
+
+uint8_t PF_PCIE_inst_dma_share_buffer(pf_pcie_instance_t * this_pcie,
+                                      uint64_t cpu_address,
+                                      uint64_t size,
+                                      uint64_t pcie_address);
+
+void PF_PCIE_inst_dma_unshare_buffer(pf_pcie_instance_t * this_pcie,
+                                     uint64_t cpu_address);
+
+void PF_PCIE_inst_enable_interrupts(pf_pcie_instance_t * this_pcie);
+
+void PF_PCIE_inst_disable_interrupts(pf_pcie_instance_t * this_pcie);
+
+void PF_PCIE_inst_isr(pf_pcie_instance_t * this_pcie);
+
+uint8_t PF_PCIE_inst_set_msi_handler(pf_pcie_instance_t * this_pcie,
+                                     uint8_t vector,
+                                     pf_pcie_msi_handler_t handler,
+                                     void * user_data);
+
 /*****************************************************************************/
 
 uint64_t
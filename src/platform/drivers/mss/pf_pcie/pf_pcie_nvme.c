@@ -0,0 +1,946 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC NVMe host driver for a controller behind the PCIe root port.
+ *
+ */
+
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "pf_pcie_nvme.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (PF_PCIE_NVME_QUEUE_DEPTH < 2u) || (PF_PCIE_NVME_QUEUE_DEPTH > 64u)
+#error "PF_PCIE_NVME_QUEUE_DEPTH must be from 2 to 64"
+#endif
+
+#if (PF_PCIE_NVME_MAX_TRANSFER < (2u * PF_PCIE_NVME_PAGE_SIZE)) || \
+    (PF_PCIE_NVME_MAX_TRANSFER > (2u * 1024u * 1024u)) || \
+    (0u != (PF_PCIE_NVME_MAX_TRANSFER & (PF_PCIE_NVME_MAX_TRANSFER - 1u)))
+#error "PF_PCIE_NVME_MAX_TRANSFER must be a power of two from 8KB to 2MB"
+#endif
+
+/**************************************************************************/
+/* Preprocessor Macros                                                    */
+/**************************************************************************/
+/* Controller registers, offsets from BAR0 */
+#define NVME_REG_CAP_LO             0x00u
+#define NVME_REG_CAP_HI             0x04u
+#define NVME_REG_CC                 0x14u
+#define NVME_REG_CSTS               0x1Cu
+#define NVME_REG_AQA                0x24u
+#define NVME_REG_ASQ_LO             0x28u
+#define NVME_REG_ASQ_HI             0x2Cu
+#define NVME_REG_ACQ_LO             0x30u
+#define NVME_REG_ACQ_HI             0x34u
+#define NVME_REG_DOORBELL           0x1000u
+
+/* CAP fields */
+#define NVME_CAP_MQES_MASK          0xFFFFu         /* low word */
+#define NVME_CAP_TO_SHIFT           24u             /* low word */
+#define NVME_CAP_TO_MASK            0xFFu
+#define NVME_CAP_DSTRD_MASK         0xFu            /* high word */
+#define NVME_CAP_CSS_NVM            (1u << 5u)      /* high word */
+#define NVME_CAP_MPSMIN_SHIFT       16u             /* high word */
+#define NVME_CAP_MPSMIN_MASK        0xFu
+
+/* CC fields: NVM command set, 4KB pages, round robin arbitration, 64 byte
+   submission and 16 byte completion entries */
+#define NVME_CC_EN                  1u
+#define NVME_CC_SHN_NORMAL          (1u << 14u)
+#define NVME_CC_IOSQES              (6u << 16u)
+#define NVME_CC_IOCQES              (4u << 20u)
+
+/* CSTS fields */
+#define NVME_CSTS_RDY               1u
+#define NVME_CSTS_CFS               2u
+#define NVME_CSTS_SHST_MASK         (3u << 2u)
+#define NVME_CSTS_SHST_COMPLETE     (2u << 2u)
+
+/* Admin command opcodes */
+#define NVME_ADMIN_CREATE_SQ        0x01u
+#define NVME_ADMIN_CREATE_CQ        0x05u
+#define NVME_ADMIN_IDENTIFY         0x06u
+#define NVME_ADMIN_SET_FEATURES     0x09u
+
+#define NVME_FEAT_NUM_QUEUES        0x07u
+#define NVME_IDENTIFY_NAMESPACE     0u
+#define NVME_IDENTIFY_CONTROLLER    1u
+
+/* NVM command opcodes */
+#define NVME_CMD_WRITE              0x01u
+#define NVME_CMD_READ               0x02u
+
+/* Queue creation: physically contiguous, completion interrupts enabled */
+#define NVME_QUEUE_PC               1u
+#define NVME_CQ_IEN                 2u
+
+/* Completion entry dword 3 */
+#define NVME_CQE_PHASE              (1u << 16u)
+#define NVME_CQE_STATUS_SHIFT       17u
+#define NVME_CQE_STATUS_MASK        0x7FFFu
+
+/* Identify data offsets */
+#define NVME_ID_CTRL_SERIAL         4u
+#define NVME_ID_CTRL_MODEL          24u
+#define NVME_ID_CTRL_MDTS           77u
+#define NVME_ID_NS_NSZE             0u
+#define NVME_ID_NS_FLBAS            26u
+#define NVME_ID_NS_LBAF             128u
+
+#define NVME_SECTOR_SHIFT           9u
+#define NVME_PAGE_MASK              ((uint64_t)PF_PCIE_NVME_PAGE_SIZE - 1u)
+
+/* Polling of the admin queue and of the controller status */
+#define NVME_ADMIN_TIMEOUT_US       1000000u
+#define NVME_POLL_US                10u
+
+/* Slots of each I/O queue, one entry of the submission queue is kept free */
+#define NVME_IO_SLOTS               (PF_PCIE_NVME_QUEUE_DEPTH - 1u)
+#define NVME_ALL_SLOTS              ((NVME_IO_SLOTS >= 64u) ? ~0ULL : \
+                                     ((1ULL << NVME_IO_SLOTS) - 1u))
+
+#define NVME_SQ_MEM                 ((((PF_PCIE_NVME_QUEUE_DEPTH * 64u) + \
+                                       PF_PCIE_NVME_PAGE_SIZE) - 1u) & \
+                                     ~(PF_PCIE_NVME_PAGE_SIZE - 1u))
+#define NVME_CQ_MEM                 ((((PF_PCIE_NVME_QUEUE_DEPTH * 16u) + \
+                                       PF_PCIE_NVME_PAGE_SIZE) - 1u) & \
+                                     ~(PF_PCIE_NVME_PAGE_SIZE - 1u))
+
+/**************************************************************************/
+/* Types                                                                  */
+/**************************************************************************/
+typedef struct
+{
+    uint32_t cdw0;
+    uint32_t nsid;
+    uint32_t cdw2;
+    uint32_t cdw3;
+    uint64_t mptr;
+    uint64_t prp1;
+    uint64_t prp2;
+    uint32_t cdw10;
+    uint32_t cdw11;
+    uint32_t cdw12;
+    uint32_t cdw13;
+    uint32_t cdw14;
+    uint32_t cdw15;
+} nvme_sqe_t;
+
+typedef struct
+{
+    uint32_t result;
+    uint32_t reserved;
+    uint32_t sq_head;
+    uint32_t status;
+} nvme_cqe_t;
+
+typedef struct
+{
+    volatile nvme_sqe_t * sq;
+    volatile nvme_cqe_t * cq;
+    volatile uint32_t * sq_doorbell;
+    volatile uint32_t * cq_doorbell;
+    uint64_t * prp_list;
+    uint16_t qid;
+    uint16_t sq_tail;
+    uint16_t cq_head;
+    uint16_t depth;
+    uint32_t phase;
+    /* Requests in the command slots, a set bit of free_slots is a free slot */
+    mss_mmc_bdev_req_t * slot[NVME_IO_SLOTS];
+    uint64_t free_slots;
+    /* Requests waiting for a slot */
+    mss_mmc_bdev_req_t * head;
+    mss_mmc_bdev_req_t * tail;
+    mss_spinlock_t lock;
+} nvme_queue_t;
+
+typedef struct
+{
+    uint8_t ready;
+    uint64_t bar0;
+    uint64_t dma_offset;
+    uint32_t nsid;
+    uint32_t doorbell_stride;
+    uint32_t timeout_ms;
+    uint32_t lba_shift;
+    uint32_t cid;
+    pf_pcie_instance_t * pcie;
+    nvme_queue_t admin;
+    uint8_t * identify;
+    nvme_queue_t io[PF_PCIE_NVME_IO_QUEUES];
+    pf_pcie_nvme_info_t info;
+} nvme_ctrl_t;
+
+/**************************************************************************/
+/* Private variables                                                      */
+/**************************************************************************/
+static nvme_ctrl_t g_nvme;
+
+/**************************************************************************/
+/* Private functions declarations                                         */
+/**************************************************************************/
+static uint32_t nvme_read32(uint32_t offset);
+static void nvme_write32(uint32_t offset, uint32_t value);
+static uint8_t nvme_wait_status(uint32_t mask, uint32_t value);
+static void nvme_queue_setup(nvme_queue_t * q, uint16_t qid, uint16_t depth,
+                             uint8_t * sq_mem, uint8_t * cq_mem);
+static uint8_t nvme_admin_cmd(nvme_sqe_t * cmd, uint32_t * result);
+static uint8_t nvme_identify(void);
+static uint8_t nvme_create_io_queues(uint32_t nb_queues, uint8_t msi_vector);
+static uint8_t nvme_start(nvme_queue_t * q, mss_mmc_bdev_req_t * req);
+static uint32_t nvme_service(nvme_queue_t * q);
+static void nvme_msi_handler(uint8_t vector, void * user_data);
+static uint64_t nvme_bus_addr(const void * p);
+static void nvme_copy_string(char * dest, const uint8_t * src, uint32_t length);
+
+/**************************************************************************//**
+ * See pf_pcie_nvme.h for details of how to use this function.
+ */
+uint8_t PF_PCIE_nvme_init(const pf_pcie_nvme_cfg_t * cfg)
+{
+    uint8_t status = PF_PCIE_NVME_INVALID;
+    uint32_t cap_lo;
+    uint32_t cap_hi;
+    uint32_t mqes;
+    uint64_t asq;
+    uint64_t acq;
+    uint32_t result = 0u;
+    uint32_t granted;
+    nvme_sqe_t cmd;
+
+    g_nvme.ready = 0u;
+
+    if ((NULL != cfg) && (NULL != cfg->dma_mem) &&
+        (0u == ((uintptr_t)cfg->dma_mem & NVME_PAGE_MASK)) &&
+        (0u != cfg->bar0_addr) && (0u != cfg->nsid) &&
+        ((PF_PCIE_NVME_POLLED == cfg->msi_vector) ||
+         ((uint32_t)cfg->msi_vector + PF_PCIE_NVME_IO_QUEUES <
+          PF_PCIE_MSI_VECTORS)))
+    {
+        (void)memset(&g_nvme, 0, sizeof(g_nvme));
+        (void)memset(cfg->dma_mem, 0, PF_PCIE_NVME_DMA_MEM_SIZE);
+
+        g_nvme.bar0 = cfg->bar0_addr;
+        g_nvme.dma_offset = cfg->dma_offset;
+        g_nvme.nsid = cfg->nsid;
+        g_nvme.pcie = cfg->pcie;
+
+        cap_lo = nvme_read32(NVME_REG_CAP_LO);
+        cap_hi = nvme_read32(NVME_REG_CAP_HI);
+        mqes = (cap_lo & NVME_CAP_MQES_MASK) + 1u;
+
+        g_nvme.doorbell_stride = 4u << (cap_hi & NVME_CAP_DSTRD_MASK);
+        g_nvme.timeout_ms = (((cap_lo >> NVME_CAP_TO_SHIFT) & NVME_CAP_TO_MASK)
+                             + 1u) * 500u;
+
+        if ((0u == (cap_hi & NVME_CAP_CSS_NVM)) ||
+            (0u != ((cap_hi >> NVME_CAP_MPSMIN_SHIFT) & NVME_CAP_MPSMIN_MASK)) ||
+            (mqes < PF_PCIE_NVME_QUEUE_DEPTH))
+        {
+            status = PF_PCIE_NVME_UNSUPPORTED;
+        }
+        else
+        {
+            /* Reset the controller */
+            nvme_write32(NVME_REG_CC, 0u);
+            status = nvme_wait_status(NVME_CSTS_RDY, 0u);
+        }
+
+        if (PF_PCIE_NVME_SUCCESS == status)
+        {
+            nvme_queue_setup(&g_nvme.admin, 0u, PF_PCIE_NVME_ADMIN_DEPTH,
+                             cfg->dma_mem,
+                             cfg->dma_mem + (PF_PCIE_NVME_PAGE_SIZE / 2u));
+            g_nvme.identify = cfg->dma_mem + PF_PCIE_NVME_PAGE_SIZE;
+
+            asq = nvme_bus_addr((const void *)g_nvme.admin.sq);
+            acq = nvme_bus_addr((const void *)g_nvme.admin.cq);
+
+            nvme_write32(NVME_REG_AQA, ((PF_PCIE_NVME_ADMIN_DEPTH - 1u) << 16u) |
+                                       (PF_PCIE_NVME_ADMIN_DEPTH - 1u));
+            nvme_write32(NVME_REG_ASQ_LO, (uint32_t)asq);
+            nvme_write32(NVME_REG_ASQ_HI, (uint32_t)(asq >> 32u));
+            nvme_write32(NVME_REG_ACQ_LO, (uint32_t)acq);
+            nvme_write32(NVME_REG_ACQ_HI, (uint32_t)(acq >> 32u));
+            PF_PCIE_wmb();
+            nvme_write32(NVME_REG_CC, NVME_CC_EN | NVME_CC_IOSQES |
+                                      NVME_CC_IOCQES);
+
+            status = nvme_wait_status(NVME_CSTS_RDY, NVME_CSTS_RDY);
+        }
+
+        if (PF_PCIE_NVME_SUCCESS == status)
+        {
+            status = nvme_identify();
+        }
+
+        if (PF_PCIE_NVME_SUCCESS == status)
+        {
+            (void)memset(&cmd, 0, sizeof(cmd));
+            cmd.cdw0 = NVME_ADMIN_SET_FEATURES;
+            cmd.cdw10 = NVME_FEAT_NUM_QUEUES;
+            cmd.cdw11 = ((PF_PCIE_NVME_IO_QUEUES - 1u) << 16u) |
+                        (PF_PCIE_NVME_IO_QUEUES - 1u);
+
+            status = nvme_admin_cmd(&cmd, &result);
+        }
+
+        if (PF_PCIE_NVME_SUCCESS == status)
+        {
+            /* Each field of the result is the number granted, less one */
+            granted = (result & 0xFFFFu) + 1u;
+
+            if (((result >> 16u) + 1u) < granted)
+            {
+                granted = (result >> 16u) + 1u;
+            }
+
+            if (granted > PF_PCIE_NVME_IO_QUEUES)
+            {
+                granted = PF_PCIE_NVME_IO_QUEUES;
+            }
+
+            status = nvme_create_io_queues(granted, cfg->msi_vector);
+        }
+
+        if (PF_PCIE_NVME_SUCCESS == status)
+        {
+            g_nvme.ready = 1u;
+        }
+    }
+
+    return (status);
+}
+
+/**************************************************************************//**
+ * See pf_pcie_nvme.h for details of how to use this function.
+ */
+void PF_PCIE_nvme_get_info(pf_pcie_nvme_info_t * info)
+{
+    if (NULL != info)
+    {
+        *info = g_nvme.info;
+    }
+}
+
+/**************************************************************************//**
+ * See pf_pcie_nvme.h for details of how to use this function.
+ */
+mss_mmc_status_t PF_PCIE_nvme_submit(mss_mmc_bdev_req_t * req)
+{
+    uint32_t hart_id = (uint32_t)read_csr(mhartid);
+    uint32_t queue = 0u;
+
+    if ((0u != hart_id) && (0u != g_nvme.info.io_queues))
+    {
+        queue = (hart_id - 1u) % g_nvme.info.io_queues;
+    }
+
+    return (PF_PCIE_nvme_submit_queue(queue, req));
+}
+
+/**************************************************************************//**
+ * See pf_pcie_nvme.h for details of how to use this function.
+ */
+mss_mmc_status_t PF_PCIE_nvme_submit_queue(uint32_t queue,
+                                           mss_mmc_bdev_req_t * req)
+{
+    mss_mmc_status_t status = MSS_MMC_INVALID_PARAMETER;
+    nvme_queue_t * q;
+    uint32_t block_mask = (1u << g_nvme.lba_shift) - 1u;
+    uint64_t saved;
+
+    if (0u == g_nvme.ready)
+    {
+        status = MSS_MMC_NOT_INITIALISED;
+    }
+    else if ((NULL != req) && (queue < g_nvme.info.io_queues) &&
+             (NULL != req->buffer) && (0u == ((uintptr_t)req->buffer & 3u)) &&
+             (0u != req->size) && (0u == (req->size & block_mask)) &&
+             (req->size <= g_nvme.info.max_transfer) &&
+             (0u == ((req->sector << NVME_SECTOR_SHIFT) & block_mask)) &&
+             ((MSS_MMC_BDEV_READ == req->direction) ||
+              (MSS_MMC_BDEV_WRITE == req->direction)))
+    {
+        q = &g_nvme.io[queue];
+
+#ifdef PF_PCIE_CACHE_MAINTENANCE
+        /* Written back before a read as well, so that no dirty line of the
+           buffer is evicted over the data the drive writes */
+        mss_l2_flush_range((uint64_t)(uintptr_t)req->buffer, req->size);
+#endif
+        req->status = MSS_MMC_TRANSFER_IN_PROGRESS;
+        req->next = NULL;
+
+        saved = mss_spin_lock_irqsave(&q->lock);
+
+        if ((NULL != q->head) || (0u == nvme_start(q, req)))
+        {
+            if (NULL == q->tail)
+            {
+                q->head = req;
+            }
+            else
+            {
+                q->tail->next = req;
+            }
+            q->tail = req;
+        }
+
+        mss_spin_unlock_irqrestore(&q->lock, saved);
+
+        status = MSS_MMC_TRANSFER_IN_PROGRESS;
+    }
+    else
+    {
+        /* Invalid request */
+    }
+
+    return (status);
+}
+
+/**************************************************************************//**
+ * See pf_pcie_nvme.h for details of how to use this function.
+ */
+uint32_t PF_PCIE_nvme_poll(uint32_t queue)
+{
+    uint32_t completed = 0u;
+
+    if ((0u != g_nvme.ready) && (queue < g_nvme.info.io_queues))
+    {
+        completed = nvme_service(&g_nvme.io[queue]);
+    }
+
+    return (completed);
+}
+
+/**************************************************************************//**
+ * See pf_pcie_nvme.h for details of how to use this function.
+ */
+uint8_t PF_PCIE_nvme_idle(void)
+{
+    uint8_t idle = 1u;
+    uint32_t queue;
+
+    for (queue = 0u; queue < g_nvme.info.io_queues; queue++)
+    {
+        if ((NVME_ALL_SLOTS != g_nvme.io[queue].free_slots) ||
+            (NULL != g_nvme.io[queue].head))
+        {
+            idle = 0u;
+        }
+    }
+
+    return (idle);
+}
+
+/**************************************************************************//**
+ * See pf_pcie_nvme.h for details of how to use this function.
+ */
+uint8_t PF_PCIE_nvme_shutdown(void)
+{
+    uint8_t status = PF_PCIE_NVME_INVALID;
+
+    if ((0u != g_nvme.ready) && (0u != PF_PCIE_nvme_idle()))
+    {
+        g_nvme.ready = 0u;
+
+        nvme_write32(NVME_REG_CC, nvme_read32(NVME_REG_CC) | NVME_CC_SHN_NORMAL);
+        status = nvme_wait_status(NVME_CSTS_SHST_MASK, NVME_CSTS_SHST_COMPLETE);
+    }
+
+    return (status);
+}
+
+/**************************************************************************/
+/* Private functions                                                      */
+/**************************************************************************/
+static uint32_t nvme_read32(uint32_t offset)
+{
+    return (*(volatile uint32_t *)(uintptr_t)(g_nvme.bar0 + offset));
+}
+
+static void nvme_write32(uint32_t offset, uint32_t value)
+{
+    *(volatile uint32_t *)(uintptr_t)(g_nvme.bar0 + offset) = value;
+}
+
+static uint64_t nvme_bus_addr(const void * p)
+{
+    return ((uint64_t)(uintptr_t)p + g_nvme.dma_offset);
+}
+
+/*
+ * Waits for the bits of CSTS selected by mask to read value, for up to the
+ * ready timeout given by CAP.TO. A controller fatal status ends the wait.
+ */
+static uint8_t nvme_wait_status(uint32_t mask, uint32_t value)
+{
+    uint8_t status = PF_PCIE_NVME_TIMEOUT;
+    uint32_t waited_us = 0u;
+    uint32_t csts;
+    uint8_t done = 0u;
+
+    while ((0u == done) && (waited_us < (g_nvme.timeout_ms * 1000u)))
+    {
+        csts = nvme_read32(NVME_REG_CSTS);
+
+        if ((csts & mask) == value)
+        {
+            status = PF_PCIE_NVME_SUCCESS;
+            done = 1u;
+        }
+        else if ((0u != (csts & NVME_CSTS_CFS)) && (0u != value))
+        {
+            done = 1u;
+        }
+        else
+        {
+            mss_idle_sleep_us(NVME_POLL_US);
+            waited_us += NVME_POLL_US;
+        }
+    }
+
+    return (status);
+}
+
+/*
+ * Sets the state of a queue pair up, its memory being already cleared so
+ * that the first phase expected in the completion queue is 1.
+ */
+static void nvme_queue_setup(nvme_queue_t * q, uint16_t qid, uint16_t depth,
+                             uint8_t * sq_mem, uint8_t * cq_mem)
+{
+    q->sq = (volatile nvme_sqe_t *)sq_mem;
+    q->cq = (volatile nvme_cqe_t *)cq_mem;
+    q->sq_doorbell = (volatile uint32_t *)(uintptr_t)(g_nvme.bar0 +
+                     NVME_REG_DOORBELL +
+                     ((2u * (uint32_t)qid) * g_nvme.doorbell_stride));
+    q->cq_doorbell = (volatile uint32_t *)(uintptr_t)(g_nvme.bar0 +
+                     NVME_REG_DOORBELL +
+                     (((2u * (uint32_t)qid) + 1u) * g_nvme.doorbell_stride));
+    q->qid = qid;
+    q->depth = depth;
+    q->sq_tail = 0u;
+    q->cq_head = 0u;
+    q->phase = NVME_CQE_PHASE;
+    q->free_slots = NVME_ALL_SLOTS;
+    q->head = NULL;
+    q->tail = NULL;
+}
+
+/*
+ * Runs an admin command and polls for its completion. Only used while the
+ * driver is being set up, one command at a time.
+ */
+static uint8_t nvme_admin_cmd(nvme_sqe_t * cmd, uint32_t * result)
+{
+    nvme_queue_t * q = &g_nvme.admin;
+    volatile nvme_cqe_t * cqe;
+    uint8_t status = PF_PCIE_NVME_TIMEOUT;
+    uint32_t waited_us = 0u;
+    uint32_t dw3;
+    uint8_t done = 0u;
+
+    g_nvme.cid++;
+    cmd->cdw0 |= (g_nvme.cid & 0xFFFFu) << 16u;
+    q->sq[q->sq_tail] = *cmd;
+    q->sq_tail = (uint16_t)((q->sq_tail + 1u) % q->depth);
+    PF_PCIE_wmb();
+    *q->sq_doorbell = q->sq_tail;
+
+    while ((0u == done) && (waited_us < NVME_ADMIN_TIMEOUT_US))
+    {
+        cqe = &q->cq[q->cq_head];
+        dw3 = cqe->status;
+
+        if ((dw3 & NVME_CQE_PHASE) == q->phase)
+        {
+            PF_PCIE_rmb();
+            *result = cqe->result;
+            status = (0u == ((dw3 >> NVME_CQE_STATUS_SHIFT) &
+                             NVME_CQE_STATUS_MASK)) ?
+                     PF_PCIE_NVME_SUCCESS : PF_PCIE_NVME_CMD_ERROR;
+
+            q->cq_head++;
+            if (q->cq_head == q->depth)
+            {
+                q->cq_head = 0u;
+                q->phase ^= NVME_CQE_PHASE;
+            }
+            *q->cq_doorbell = q->cq_head;
+            done = 1u;
+        }
+        else
+        {
+            mss_idle_sleep_us(NVME_POLL_US);
+            waited_us += NVME_POLL_US;
+        }
+    }
+
+    return (status);
+}
+
+/*
+ * Reads the identify data of the controller and of the namespace.
+ */
+static uint8_t nvme_identify(void)
+{
+    nvme_sqe_t cmd;
+    uint32_t result;
+    uint8_t status;
+    uint8_t mdts;
+    uint8_t format;
+    uint64_t blocks = 0u;
+    uint32_t index;
+
+    (void)memset(&cmd, 0, sizeof(cmd));
+    cmd.cdw0 = NVME_ADMIN_IDENTIFY;
+    cmd.prp1 = nvme_bus_addr(g_nvme.identify);
+    cmd.cdw10 = NVME_IDENTIFY_CONTROLLER;
+
+    status = nvme_admin_cmd(&cmd, &result);
+
+    if (PF_PCIE_NVME_SUCCESS == status)
+    {
+        nvme_copy_string(g_nvme.info.serial,
+                         &g_nvme.identify[NVME_ID_CTRL_SERIAL], 20u);
+        nvme_copy_string(g_nvme.info.model,
+                         &g_nvme.identify[NVME_ID_CTRL_MODEL], 40u);
+
+        /* MDTS is a power of two of the minimum page size, 0 for no limit */
+        mdts = g_nvme.identify[NVME_ID_CTRL_MDTS];
+        g_nvme.info.max_transfer = PF_PCIE_NVME_MAX_TRANSFER;
+
+        if ((0u != mdts) && (mdts < 20u) &&
+            ((PF_PCIE_NVME_PAGE_SIZE << mdts) < PF_PCIE_NVME_MAX_TRANSFER))
+        {
+            g_nvme.info.max_transfer = PF_PCIE_NVME_PAGE_SIZE << mdts;
+        }
+
+        (void)memset(&cmd, 0, sizeof(cmd));
+        cmd.cdw0 = NVME_ADMIN_IDENTIFY;
+        cmd.nsid = g_nvme.nsid;
+        cmd.prp1 = nvme_bus_addr(g_nvme.identify);
+        cmd.cdw10 = NVME_IDENTIFY_NAMESPACE;
+
+        status = nvme_admin_cmd(&cmd, &result);
+    }
+
+    if (PF_PCIE_NVME_SUCCESS == status)
+    {
+        for (index = 0u; index < 8u; index++)
+        {
+            blocks |= (uint64_t)g_nvme.identify[NVME_ID_NS_NSZE + index] <<
+                      (8u * index);
+        }
+
+        format = g_nvme.identify[NVME_ID_NS_FLBAS] & 0xFu;
+        g_nvme.lba_shift = g_nvme.identify[NVME_ID_NS_LBAF +
+                                           (4u * (uint32_t)format) + 2u];
+
+        /* Blocks from 512 bytes to the page size */
+        if ((0u == blocks) || (g_nvme.lba_shift < NVME_SECTOR_SHIFT) ||
+            ((1u << g_nvme.lba_shift) > PF_PCIE_NVME_PAGE_SIZE))
+        {
+            status = PF_PCIE_NVME_UNSUPPORTED;
+        }
+        else
+        {
+            g_nvme.info.blocks = blocks;
+            g_nvme.info.block_size = 1u << g_nvme.lba_shift;
+        }
+    }
+
+    return (status);
+}
+
+/*
+ * Creates the I/O completion queues and then their submission queues, and
+ * registers the MSI handler of each completion queue.
+ */
+static uint8_t nvme_create_io_queues(uint32_t nb_queues, uint8_t msi_vector)
+{
+    uint8_t status = PF_PCIE_NVME_SUCCESS;
+    nvme_queue_t * q;
+    nvme_sqe_t cmd;
+    uint32_t result;
+    uint32_t queue;
+    uint32_t cq_flags = NVME_QUEUE_PC;
+    uint8_t * mem;
+
+    if (PF_PCIE_NVME_POLLED != msi_vector)
+    {
+        cq_flags |= NVME_CQ_IEN;
+    }
+
+    for (queue = 0u; (queue < nb_queues) && (PF_PCIE_NVME_SUCCESS == status);
+         queue++)
+    {
+        q = &g_nvme.io[queue];
+        mem = g_nvme.identify + PF_PCIE_NVME_PAGE_SIZE +
+              (queue * PF_PCIE_NVME_IO_QUEUE_MEM);
+
+        nvme_queue_setup(q, (uint16_t)(queue + 1u), PF_PCIE_NVME_QUEUE_DEPTH,
+                         mem, mem + NVME_SQ_MEM);
+        q->prp_list = (uint64_t *)(mem + NVME_SQ_MEM + NVME_CQ_MEM);
+
+        (void)memset(&cmd, 0, sizeof(cmd));
+        cmd.cdw0 = NVME_ADMIN_CREATE_CQ;
+        cmd.prp1 = nvme_bus_addr((const void *)q->cq);
+        cmd.cdw10 = ((PF_PCIE_NVME_QUEUE_DEPTH - 1u) << 16u) | q->qid;
+        cmd.cdw11 = ((uint32_t)q->qid << 16u) | cq_flags;
+
+        status = nvme_admin_cmd(&cmd, &result);
+
+        if (PF_PCIE_NVME_SUCCESS == status)
+        {
+            (void)memset(&cmd, 0, sizeof(cmd));
+            cmd.cdw0 = NVME_ADMIN_CREATE_SQ;
+            cmd.prp1 = nvme_bus_addr((const void *)q->sq);
+            cmd.cdw10 = ((PF_PCIE_NVME_QUEUE_DEPTH - 1u) << 16u) | q->qid;
+            cmd.cdw11 = ((uint32_t)q->qid << 16u) | NVME_QUEUE_PC;
+
+            status = nvme_admin_cmd(&cmd, &result);
+        }
+
+        if ((PF_PCIE_NVME_SUCCESS == status) &&
+            (PF_PCIE_NVME_POLLED != msi_vector))
+        {
+            /* Interrupt vector qid of the drive is root port vector
+               msi_vector + qid */
+            if (NULL == g_nvme.pcie)
+            {
+                (void)PF_PCIE_set_msi_handler((uint8_t)(msi_vector + q->qid),
+                                              nvme_msi_handler, q);
+            }
+            else
+            {
+                (void)PF_PCIE_inst_set_msi_handler(g_nvme.pcie,
+                                                   (uint8_t)(msi_vector + q->qid),
+                                                   nvme_msi_handler, q);
+            }
+        }
+
+        if (PF_PCIE_NVME_SUCCESS == status)
+        {
+            g_nvme.info.io_queues = queue + 1u;
+        }
+    }
+
+    return (status);
+}
+
+/*
+ * Starts a request in a free command slot of an I/O queue. Returns 0 if no
+ * slot is free. Called with the lock of the queue held.
+ */
+static uint8_t nvme_start(nvme_queue_t * q, mss_mmc_bdev_req_t * req)
+{
+    uint8_t started = 0u;
+    uint32_t cid;
+    uint64_t bus;
+    uint64_t slba;
+    uint64_t page;
+    uint64_t end;
+    uint64_t * list;
+    uint32_t first;
+    uint32_t entry;
+    volatile nvme_sqe_t * sqe;
+
+    if (0u != q->free_slots)
+    {
+        cid = (uint32_t)__builtin_ctzll(q->free_slots);
+        q->free_slots &= ~(1ULL << cid);
+        q->slot[cid] = req;
+
+        bus = nvme_bus_addr(req->buffer);
+        slba = ((uint64_t)req->sector << NVME_SECTOR_SHIFT) >> g_nvme.lba_shift;
+        sqe = &q->sq[q->sq_tail];
+
+        sqe->cdw0 = ((MSS_MMC_BDEV_WRITE == req->direction) ?
+                     NVME_CMD_WRITE : NVME_CMD_READ) | (cid << 16u);
+        sqe->nsid = g_nvme.nsid;
+        sqe->cdw2 = 0u;
+        sqe->cdw3 = 0u;
+        sqe->mptr = 0u;
+        sqe->prp1 = bus;
+        sqe->cdw10 = (uint32_t)slba;
+        sqe->cdw11 = (uint32_t)(slba >> 32u);
+        sqe->cdw12 = (req->size >> g_nvme.lba_shift) - 1u;
+        sqe->cdw13 = 0u;
+        sqe->cdw14 = 0u;
+        sqe->cdw15 = 0u;
+
+        /* PRP entry 1 is the buffer, up to the end of its first page. PRP
+           entry 2 is the second page, or a list of all the pages after the
+           first */
+        first = PF_PCIE_NVME_PAGE_SIZE - (uint32_t)(bus & NVME_PAGE_MASK);
+
+        if (req->size <= first)
+        {
+            sqe->prp2 = 0u;
+        }
+        else if (req->size <= (first + PF_PCIE_NVME_PAGE_SIZE))
+        {
+            sqe->prp2 = bus + first;
+        }
+        else
+        {
+            list = &q->prp_list[cid * (PF_PCIE_NVME_PRP_LIST_SIZE / 8u)];
+            end = bus + req->size;
+            entry = 0u;
+
+            for (page = bus + first; page < end;
+                 page += PF_PCIE_NVME_PAGE_SIZE)
+            {
+                list[entry] = page;
+                entry++;
+            }
+
+            sqe->prp2 = nvme_bus_addr(list);
+        }
+
+        q->sq_tail = (uint16_t)((q->sq_tail + 1u) % q->depth);
+        PF_PCIE_wmb();
+        *q->sq_doorbell = q->sq_tail;
+
+        started = 1u;
+    }
+
+    return (started);
+}
+
+/*
+ * Processes the completions of an I/O queue, starts the waiting requests in
+ * the slots freed and then calls the handlers of the completed requests,
+ * without the lock so that they can submit further requests.
+ */
+static uint32_t nvme_service(nvme_queue_t * q)
+{
+    mss_mmc_bdev_req_t * done_head = NULL;
+    mss_mmc_bdev_req_t * done_tail = NULL;
+    mss_mmc_bdev_req_t * req;
+    volatile nvme_cqe_t * cqe;
+    uint32_t completed = 0u;
+    uint32_t dw3;
+    uint32_t cid;
+    uint64_t saved;
+
+    saved = mss_spin_lock_irqsave(&q->lock);
+
+    cqe = &q->cq[q->cq_head];
+    dw3 = cqe->status;
+
+    while ((dw3 & NVME_CQE_PHASE) == q->phase)
+    {
+        PF_PCIE_rmb();
+        cid = dw3 & 0xFFFFu;
+
+        if ((cid < NVME_IO_SLOTS) && (0u == (q->free_slots & (1ULL << cid))))
+        {
+            req = q->slot[cid];
+            q->slot[cid] = NULL;
+            q->free_slots |= (1ULL << cid);
+
+            req->status = (0u == ((dw3 >> NVME_CQE_STATUS_SHIFT) &
+                                  NVME_CQE_STATUS_MASK)) ?
+                          MSS_MMC_TRANSFER_SUCCESS : MSS_MMC_TRANSFER_FAIL;
+            req->next = NULL;
+
+            if (NULL == done_tail)
+            {
+                done_head = req;
+            }
+            else
+            {
+                done_tail->next = req;
+            }
+            done_tail = req;
+            completed++;
+        }
+
+        q->cq_head++;
+        if (q->cq_head == q->depth)
+        {
+            q->cq_head = 0u;
+            q->phase ^= NVME_CQE_PHASE;
+        }
+
+        cqe = &q->cq[q->cq_head];
+        dw3 = cqe->status;
+    }
+
+    if (0u != completed)
+    {
+        *q->cq_doorbell = q->cq_head;
+
+        while ((NULL != q->head) && (0u != nvme_start(q, q->head)))
+        {
+            q->head = q->head->next;
+            if (NULL == q->head)
+            {
+                q->tail = NULL;
+            }
+        }
+    }
+
+    mss_spin_unlock_irqrestore(&q->lock, saved);
+
+    while (NULL != done_head)
+    {
+        req = done_head;
+        done_head = req->next;
+
+#ifdef PF_PCIE_CACHE_MAINTENANCE
+        if (MSS_MMC_BDEV_READ == req->direction)
+        {
+            mss_l2_invalidate_range((uint64_t)(uintptr_t)req->buffer,
+                                    req->size);
+        }
+#endif
+        if (NULL != req->handler)
+        {
+            req->handler(req);
+        }
+    }
+
+    return (completed);
+}
+
+static void nvme_msi_handler(uint8_t vector, void * user_data)
+{
+    (void)vector;
+
+    (void)nvme_service((nvme_queue_t *)user_data);
+}
+
+/*
+ * Copies an identify string, padded with spaces, and terminates it.
+ */
+static void nvme_copy_string(char * dest, const uint8_t * src, uint32_t length)
+{
+    uint32_t index;
+
+    for (index = 0u; index < length; index++)
+    {
+        dest[index] = (char)src[index];
+    }
+
+    while ((0u != index) && (' ' == dest[index - 1u]))
+    {
+        index--;
+    }
+    dest[index] = '\0';
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,314 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC NVMe host driver for a controller behind the PCIe root port.
+ *
+ */
+/*=========================================================================*//**
+  @section intro_sec Introduction
+  The NVMe host driver reads and writes an NVMe solid state drive attached to
+  the PolarFire PCIe root port. It uses the BAR addresses assigned by
+  PF_PCIE_enumeration() and PF_PCIE_allocate_memory(), and the MSI vectors
+  dispatched by PF_PCIE_isr(). Requests are of the same mss_mmc_bdev_req_t
+  type as those of the eMMC SD block device, see mss_mmc_bdev.h, and complete
+  the same way, so an application can log to either device with the same
+  code.
+
+  @section theory_op Theory of Operation
+  Set up
+  The application enumerates the root port and allocates the BARs, enables
+  MSI in the NVMe function with PF_PCIE_enable_config_space_msi() and maps
+  the root port memory used by the drive for bus mastering with
+  PF_PCIE_master_atr_table_init(). It then calls PF_PCIE_nvme_init() with a
+  pf_pcie_nvme_cfg_t giving:
+    - bar0_addr, the processor address of BAR0 of the drive,
+    - dma_mem, PF_PCIE_NVME_DMA_MEM_SIZE bytes of 4KB aligned, non-cached
+      memory reached by the drive, for the queues and the PRP lists,
+    - dma_offset, added to the processor address of any byte of dma_mem or
+      of a data buffer to give its PCIe address, following the master ATR,
+    - the namespace used and the first MSI vector of the drive.
+  PF_PCIE_nvme_init() resets the controller, identifies it and the namespace,
+  and creates one I/O submission and completion queue pair per U54, up to
+  PF_PCIE_NVME_IO_QUEUES and the number of queues the drive grants.
+
+  Per hart queues
+  PF_PCIE_nvme_submit() queues a request on the queue pair of the calling
+  hart: U54_1 uses I/O queue 0, U54_2 queue 1 and so on, and the E51 queue 0.
+  No two harts then compete for a submission queue, and the lock of each
+  queue is only shared with the completion handler.
+  PF_PCIE_nvme_submit_queue() names the queue explicitly.
+
+  Completions
+  The admin queue uses MSI vector msi_vector and I/O queue q uses vector
+  msi_vector + 1 + q, so the drive must have been granted at least
+  1 + PF_PCIE_NVME_IO_QUEUES MSI messages, rounded up to a power of two, and
+  msi_vector must be aligned to that number, as for any multiple message
+  MSI. The completions of each queue are processed by its own MSI handler,
+  which is called by PF_PCIE_isr() on the hart taking the PCIe interrupt.
+  When msi_vector is PF_PCIE_NVME_POLLED, interrupts are not used and each
+  hart calls PF_PCIE_nvme_poll() on its own queue, so that its completions
+  are also handled on that hart.
+
+  Transfers
+  Each request is one NVMe read or write command. Its data is described with
+  a PRP list, built in the list of the command slot, so the buffer needs no
+  more than 32 bit alignment and can span any number of 4KB pages, up to
+  PF_PCIE_NVME_MAX_TRANSFER bytes or the maximum data transfer size of the
+  drive if smaller, see pf_pcie_nvme_info_t. Requests which do not find a free
+  command slot wait in the queue pair's software queue and are started as
+  earlier commands complete, so any number of requests can be submitted.
+  The sector of a request is in units of 512 bytes; with a namespace
+  formatted with 4KB blocks, the sector and the size of a request must be
+  multiples of 4KB.
+
+  Cache maintenance
+  Data buffers can be in cached DDR when PF_PCIE_CACHE_MAINTENANCE is
+  defined, as for the PCIe endpoint DMA. The buffer of a write is then
+  flushed from the L2 cache before the command is started and the buffer of
+  a read is invalidated before its handler is called. The queues must always
+  be in non-cached memory.
+
+  Shut down
+  PF_PCIE_nvme_shutdown() asks the drive for a normal shut down, after which
+  the data written is kept across a power loss. No request may be in
+  progress.
+
+  @code
+    #define NVME_MSI_VECTOR     8u
+
+    static uint8_t g_nvme_mem[PF_PCIE_NVME_DMA_MEM_SIZE]
+        __attribute__((aligned(4096), section(".ddr_nc")));
+
+    static void log_done(mss_mmc_bdev_req_t * req)
+    {
+        // req->status is MSS_MMC_TRANSFER_SUCCESS or MSS_MMC_TRANSFER_FAIL
+    }
+
+    void nvme_setup(void)
+    {
+        pf_pcie_nvme_cfg_t cfg;
+
+        PF_PCIE_enable_config_space_msi(nvme_ecam, MSI_ADDR, NVME_MSI_VECTOR);
+
+        cfg.bar0_addr = nvme_bar0;
+        cfg.dma_mem = g_nvme_mem;
+        cfg.dma_offset = 0u;
+        cfg.nsid = 1u;
+        cfg.msi_vector = NVME_MSI_VECTOR;
+        cfg.pcie = NULL;
+
+        if (PF_PCIE_NVME_SUCCESS == PF_PCIE_nvme_init(&cfg))
+        {
+            PF_PCIE_enable_interrupts();
+
+            g_log_req.direction = MSS_MMC_BDEV_WRITE;
+            g_log_req.sector = 0u;
+            g_log_req.buffer = g_log_buf;
+            g_log_req.size = sizeof(g_log_buf);
+            g_log_req.handler = log_done;
+            (void)PF_PCIE_nvme_submit(&g_log_req);
+        }
+    }
+  @endcode
+ *//*=========================================================================*/
+#ifndef PF_PCIE_NVME_H_
+#define PF_PCIE_NVME_H_
+
+#include <stdint.h>
+#include "pf_pcie.h"
+#include "drivers/mss/mss_mmc/mss_mmc_bdev.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+  Number of I/O queue pairs, one per U54.
+*/
+#ifndef PF_PCIE_NVME_IO_QUEUES
+#define PF_PCIE_NVME_IO_QUEUES          4u
+#endif
+
+/*****************************************************************************
+  Entries of each I/O submission and completion queue. One less command can
+  be in progress on each queue. From 2 to 64.
+*/
+#ifndef PF_PCIE_NVME_QUEUE_DEPTH
+#define PF_PCIE_NVME_QUEUE_DEPTH        32u
+#endif
+
+/*****************************************************************************
+  Largest request, in bytes. A power of two from 8KB to 2MB.
+*/
+#ifndef PF_PCIE_NVME_MAX_TRANSFER
+#define PF_PCIE_NVME_MAX_TRANSFER       (128u * 1024u)
+#endif
+
+#define PF_PCIE_NVME_PAGE_SIZE          4096u
+#define PF_PCIE_NVME_ADMIN_DEPTH        8u
+
+/* Bytes of PRP list per command slot */
+#define PF_PCIE_NVME_PRP_LIST_SIZE      ((PF_PCIE_NVME_MAX_TRANSFER / \
+                                          PF_PCIE_NVME_PAGE_SIZE) * 8u)
+
+/* Memory of one I/O queue pair: its submission queue, completion queue and
+   PRP lists, each starting on a page */
+#define PF_PCIE_NVME_IO_QUEUE_MEM       (((((PF_PCIE_NVME_QUEUE_DEPTH * 64u) + \
+                                            PF_PCIE_NVME_PAGE_SIZE) - 1u) & \
+                                          ~(PF_PCIE_NVME_PAGE_SIZE - 1u)) + \
+                                         ((((PF_PCIE_NVME_QUEUE_DEPTH * 16u) + \
+                                            PF_PCIE_NVME_PAGE_SIZE) - 1u) & \
+                                          ~(PF_PCIE_NVME_PAGE_SIZE - 1u)) + \
+                                         ((((PF_PCIE_NVME_QUEUE_DEPTH * \
+                                             PF_PCIE_NVME_PRP_LIST_SIZE) + \
+                                            PF_PCIE_NVME_PAGE_SIZE) - 1u) & \
+                                          ~(PF_PCIE_NVME_PAGE_SIZE - 1u)))
+
+/*****************************************************************************
+  Size of the memory given to PF_PCIE_nvme_init() in dma_mem: a page for
+  the admin queues, a page for the identify data and the I/O queue pairs.
+*/
+#define PF_PCIE_NVME_DMA_MEM_SIZE       ((2u * PF_PCIE_NVME_PAGE_SIZE) + \
+                                         (PF_PCIE_NVME_IO_QUEUES * \
+                                          PF_PCIE_NVME_IO_QUEUE_MEM))
+
+/*****************************************************************************
+  msi_vector value selecting polled completions.
+*/
+#define PF_PCIE_NVME_POLLED             0xFFu
+
+/*****************************************************************************
+  PF_PCIE_nvme_init() and PF_PCIE_nvme_shutdown() return values
+*/
+#define PF_PCIE_NVME_SUCCESS            0u
+#define PF_PCIE_NVME_INVALID            1u
+#define PF_PCIE_NVME_UNSUPPORTED        2u
+#define PF_PCIE_NVME_TIMEOUT            3u
+#define PF_PCIE_NVME_CMD_ERROR          4u
+
+/*****************************************************************************
+  The pf_pcie_nvme_cfg_t structure gives PF_PCIE_nvme_init() the resources of
+  the drive. See the Set up section above.
+
+  pcie
+    Instance of the root port the MSI handlers are registered with, or NULL
+    for the instance of the functions without "inst_".
+*/
+typedef struct
+{
+    uint64_t bar0_addr;
+    uint8_t * dma_mem;
+    uint64_t dma_offset;
+    uint32_t nsid;
+    uint8_t msi_vector;
+    pf_pcie_instance_t * pcie;
+} pf_pcie_nvme_cfg_t;
+
+/*****************************************************************************
+  The pf_pcie_nvme_info_t structure describes the drive once it is set up.
+
+  blocks, block_size
+    Size of the namespace, in blocks of block_size bytes.
+
+  max_transfer
+    Largest request in bytes.
+
+  io_queues
+    Number of I/O queue pairs created.
+
+  model, serial
+    Model and serial number reported by the drive, NUL terminated.
+*/
+typedef struct
+{
+    uint64_t blocks;
+    uint32_t block_size;
+    uint32_t max_transfer;
+    uint32_t io_queues;
+    char model[41];
+    char serial[21];
+} pf_pcie_nvme_info_t;
+
+/*****************************************************************************
+  The PF_PCIE_nvme_init() function resets the NVMe controller at
+  cfg->bar0_addr, identifies it and namespace cfg->nsid, and creates the I/O
+  queue pairs. The admin commands are polled, so the PCIe interrupts do not
+  need to be enabled yet. The MSI handlers of the queues are registered when
+  cfg->msi_vector is not PF_PCIE_NVME_POLLED.
+
+  @param cfg
+    Points to the configuration, which is not used after the call.
+
+  @return
+    PF_PCIE_NVME_SUCCESS, PF_PCIE_NVME_INVALID if the configuration is not
+    valid, PF_PCIE_NVME_UNSUPPORTED if the controller does not support the NVM
+    command set, 4KB pages or PF_PCIE_NVME_QUEUE_DEPTH entries per queue,
+    PF_PCIE_NVME_TIMEOUT if the controller did not become ready or did not
+    complete an admin command in time, or PF_PCIE_NVME_CMD_ERROR if an admin
+    command failed.
+*/
+uint8_t PF_PCIE_nvme_init(const pf_pcie_nvme_cfg_t * cfg);
+
+/*****************************************************************************
+  The PF_PCIE_nvme_get_info() function copies the description of the drive.
+
+  @param info
+    Points to the structure filled in.
+*/
+void PF_PCIE_nvme_get_info(pf_pcie_nvme_info_t * info);
+
+/*****************************************************************************
+  The PF_PCIE_nvme_submit() function queues a request on the I/O queue pair
+  of the calling hart and starts it straight away if a command slot is free.
+
+  @param req
+    The request. It must not be changed until its handler has been called.
+
+  @return
+    MSS_MMC_TRANSFER_IN_PROGRESS when the request has been queued,
+    MSS_MMC_NOT_INITIALISED if PF_PCIE_nvme_init() did not succeed, or
+    MSS_MMC_INVALID_PARAMETER when the request is not valid.
+*/
+mss_mmc_status_t PF_PCIE_nvme_submit(mss_mmc_bdev_req_t * req);
+
+/*****************************************************************************
+  The PF_PCIE_nvme_submit_queue() function queues a request on I/O queue
+  pair queue, from 0 to io_queues - 1, as PF_PCIE_nvme_submit().
+*/
+mss_mmc_status_t PF_PCIE_nvme_submit_queue(uint32_t queue,
+                                           mss_mmc_bdev_req_t * req);
+
+/*****************************************************************************
+  The PF_PCIE_nvme_poll() function processes the completions of I/O queue
+  pair queue and calls the handlers of the requests completed. It is used
+  when completions are polled, and may be called with interrupts as well.
+
+  @return
+    The number of requests completed.
+*/
+uint32_t PF_PCIE_nvme_poll(uint32_t queue);
+
+/*****************************************************************************
+  The PF_PCIE_nvme_idle() function returns 1 when no request is queued or in
+  progress on any queue pair, 0 otherwise.
+*/
+uint8_t PF_PCIE_nvme_idle(void);
+
+/*****************************************************************************
+  The PF_PCIE_nvme_shutdown() function shuts the controller down normally.
+  PF_PCIE_nvme_init() is needed to use the drive again.
+
+  @return
+    PF_PCIE_NVME_SUCCESS, PF_PCIE_NVME_INVALID if the driver is not set up or
+    a request is in progress, or PF_PCIE_NVME_TIMEOUT if the drive did not
+    report that the shut down was complete in time.
+*/
+uint8_t PF_PCIE_nvme_shutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PF_PCIE_NVME_H_ */
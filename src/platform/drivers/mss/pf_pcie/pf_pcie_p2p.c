@@ -0,0 +1,405 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC PCIe endpoint DMA transfers chained with the MAC and MMC
+ * drivers.
+ *
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "pf_pcie_p2p.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(PF_PCIE_P2P)
+
+/**************************************************************************/
+/* Preprocessor Macros                                                    */
+/**************************************************************************/
+#define P2P_MMC_BLOCK_SIZE          512u
+
+/**************************************************************************/
+/* Private variables                                                      */
+/**************************************************************************/
+/* MMC legs, the head is the one in progress */
+static pf_pcie_p2p_xfer_t * g_mmc_head = NULL;
+static pf_pcie_p2p_xfer_t * g_mmc_tail = NULL;
+static mss_spinlock_t g_mmc_lock;
+
+/**************************************************************************/
+/* Private Functions                                                      */
+/**************************************************************************/
+static void
+p2p_complete
+(
+    pf_pcie_p2p_xfer_t * xfer,
+    uint8_t status
+)
+{
+    if (NULL != xfer->handler)
+    {
+        xfer->handler(xfer, status);
+    }
+}
+
+static uint8_t
+p2p_dma_submit
+(
+    pf_pcie_p2p_xfer_t * xfer,
+    pf_pcie_ep_dma_dir_t dir
+)
+{
+    uint8_t ret;
+
+    if (NULL == xfer->pcie)
+    {
+        ret = PF_PCIE_dma_submit(dir, &xfer->job);
+    }
+    else
+    {
+        ret = PF_PCIE_inst_dma_submit(xfer->pcie, dir, &xfer->job);
+    }
+
+    return ret;
+}
+
+/* Starts the MMC leg of the transfer at the head of the queue */
+static mss_mmc_status_t
+p2p_mmc_start
+(
+    pf_pcie_p2p_xfer_t * xfer
+)
+{
+    mss_mmc_status_t ret;
+
+    if (PF_PCIE_P2P_MMC_TO_EP == xfer->path)
+    {
+        ret = MSS_MMC_adma2_read(xfer->lba, xfer->buffer, xfer->length);
+    }
+    else
+    {
+        ret = MSS_MMC_adma2_write(xfer->buffer, xfer->lba, xfer->length);
+    }
+
+    return ret;
+}
+
+/*
+ * Pops the head of the MMC queue, done, and starts the legs behind it until
+ * one starts. The legs which fail to start are returned in a list for their
+ * handlers to be called outside of the lock.
+ */
+static pf_pcie_p2p_xfer_t *
+p2p_mmc_next
+(
+    pf_pcie_p2p_xfer_t ** failed
+)
+{
+    pf_pcie_p2p_xfer_t * done;
+    pf_pcie_p2p_xfer_t * xfer;
+    pf_pcie_p2p_xfer_t * failed_tail = NULL;
+
+    done = g_mmc_head;
+    g_mmc_head = done->next;
+    done->next = NULL;
+
+    *failed = NULL;
+    while (NULL != g_mmc_head)
+    {
+        xfer = g_mmc_head;
+        if (MSS_MMC_TRANSFER_IN_PROGRESS == p2p_mmc_start(xfer))
+        {
+            break;
+        }
+
+        g_mmc_head = xfer->next;
+        xfer->next = NULL;
+        if (NULL == failed_tail)
+        {
+            *failed = xfer;
+        }
+        else
+        {
+            failed_tail->next = xfer;
+        }
+        failed_tail = xfer;
+    }
+
+    if (NULL == g_mmc_head)
+    {
+        g_mmc_tail = NULL;
+    }
+
+    return done;
+}
+
+static void
+p2p_fail_list
+(
+    pf_pcie_p2p_xfer_t * failed
+)
+{
+    pf_pcie_p2p_xfer_t * xfer;
+
+    while (NULL != failed)
+    {
+        xfer = failed;
+        failed = xfer->next;
+        xfer->next = NULL;
+        p2p_complete(xfer, PF_PCIE_P2P_PEER_ERROR);
+    }
+}
+
+/* Queues an MMC leg and starts it if the MMC is not busy with another one */
+static void
+p2p_mmc_queue
+(
+    pf_pcie_p2p_xfer_t * xfer
+)
+{
+    uint64_t saved;
+    uint8_t failed = 0u;
+
+    xfer->next = NULL;
+
+    saved = mss_spin_lock_irqsave(&g_mmc_lock);
+    if (NULL == g_mmc_head)
+    {
+        if (MSS_MMC_TRANSFER_IN_PROGRESS == p2p_mmc_start(xfer))
+        {
+            g_mmc_head = xfer;
+            g_mmc_tail = xfer;
+        }
+        else
+        {
+            failed = 1u;
+        }
+    }
+    else
+    {
+        g_mmc_tail->next = xfer;
+        g_mmc_tail = xfer;
+    }
+    mss_spin_unlock_irqrestore(&g_mmc_lock, saved);
+
+    if (0u != failed)
+    {
+        p2p_complete(xfer, PF_PCIE_P2P_PEER_ERROR);
+    }
+}
+
+/* Completion of the endpoint DMA leg */
+static void
+p2p_dma_done
+(
+    pf_pcie_dma_job_t * job,
+    pf_pcie_ep_dma_status_t status
+)
+{
+    pf_pcie_p2p_xfer_t * xfer = (pf_pcie_p2p_xfer_t *)job->user_data;
+    int32_t mac_ret;
+
+    if (PF_PCIE_EP_DMA_COMPLETED != status)
+    {
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+        if ((PF_PCIE_P2P_MAC_TO_EP == xfer->path) && (NULL != xfer->rx_buf))
+        {
+            MSS_MAC_rx_buf_release(xfer->rx_buf);
+        }
+#endif
+        p2p_complete(xfer, PF_PCIE_P2P_PCIE_ERROR);
+    }
+    else
+    {
+        switch (xfer->path)
+        {
+            case PF_PCIE_P2P_EP_TO_MAC:
+                mac_ret = MSS_MAC_send_pkt(xfer->mac, xfer->queue_no,
+                                           xfer->buffer, xfer->length,
+                                           (void *)xfer);
+                if (MSS_MAC_ERR_OK != mac_ret)
+                {
+                    p2p_complete(xfer, PF_PCIE_P2P_PEER_ERROR);
+                }
+                break;
+
+            case PF_PCIE_P2P_EP_TO_MMC:
+                p2p_mmc_queue(xfer);
+                break;
+
+            case PF_PCIE_P2P_MAC_TO_EP:
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+                if (NULL != xfer->rx_buf)
+                {
+                    MSS_MAC_rx_buf_release(xfer->rx_buf);
+                }
+#endif
+                p2p_complete(xfer, PF_PCIE_P2P_SUCCESS);
+                break;
+
+            default:
+                /* PF_PCIE_P2P_MMC_TO_EP, the endpoint write is its last leg */
+                p2p_complete(xfer, PF_PCIE_P2P_SUCCESS);
+                break;
+        }
+    }
+}
+
+/* Sets up the endpoint DMA job of the transfer */
+static pf_pcie_ep_dma_dir_t
+p2p_job_init
+(
+    pf_pcie_p2p_xfer_t * xfer
+)
+{
+    pf_pcie_ep_dma_dir_t dir;
+
+    if ((PF_PCIE_P2P_EP_TO_MAC == xfer->path) ||
+        (PF_PCIE_P2P_EP_TO_MMC == xfer->path))
+    {
+        dir = PF_PCIE_EP_DMA_READ;
+        xfer->job.src_address = xfer->ep_address;
+        xfer->job.dest_address = (uint64_t)(uintptr_t)xfer->buffer;
+    }
+    else
+    {
+        dir = PF_PCIE_EP_DMA_WRITE;
+        xfer->job.src_address = (uint64_t)(uintptr_t)xfer->buffer;
+        xfer->job.dest_address = xfer->ep_address;
+    }
+
+    xfer->job.length = xfer->length;
+    xfer->job.flags = PF_PCIE_DMA_JOB_SHARED;
+    xfer->job.callback = p2p_dma_done;
+    xfer->job.user_data = (void *)xfer;
+    xfer->job.next = NULL;
+
+    return dir;
+}
+
+/**************************************************************************/
+/* Public Functions                                                       */
+/**************************************************************************/
+/***************************************************************************//**
+ * See pf_pcie_p2p.h for details of how to use this function.
+ */
+uint8_t
+PF_PCIE_p2p_submit
+(
+    pf_pcie_p2p_xfer_t * xfer
+)
+{
+    pf_pcie_ep_dma_dir_t dir;
+    uint8_t ret = PF_PCIE_P2P_SUCCESS;
+
+    if ((NULL == xfer) || (NULL == xfer->buffer) || (0u == xfer->length) ||
+        (xfer->path > PF_PCIE_P2P_MMC_TO_EP))
+    {
+        ret = PF_PCIE_P2P_INVALID;
+    }
+    else if (((PF_PCIE_P2P_EP_TO_MMC == xfer->path) ||
+              (PF_PCIE_P2P_MMC_TO_EP == xfer->path)) &&
+             (0u != (xfer->length % P2P_MMC_BLOCK_SIZE)))
+    {
+        ret = PF_PCIE_P2P_INVALID;
+    }
+    else if ((PF_PCIE_P2P_EP_TO_MAC == xfer->path) && (NULL == xfer->mac))
+    {
+        ret = PF_PCIE_P2P_INVALID;
+    }
+    else
+    {
+        dir = p2p_job_init(xfer);
+        xfer->next = NULL;
+
+        if (PF_PCIE_P2P_MMC_TO_EP == xfer->path)
+        {
+            p2p_mmc_queue(xfer);
+        }
+        else if (PF_PCIE_DMA_SUBMIT_SUCCESS != p2p_dma_submit(xfer, dir))
+        {
+            ret = PF_PCIE_P2P_INVALID;
+        }
+        else
+        {
+            /* Queued */
+        }
+    }
+
+    return ret;
+}
+
+/***************************************************************************//**
+ * See pf_pcie_p2p.h for details of how to use this function.
+ */
+void
+PF_PCIE_p2p_mmc_handler
+(
+    uint32_t status
+)
+{
+    pf_pcie_p2p_xfer_t * done = NULL;
+    pf_pcie_p2p_xfer_t * failed = NULL;
+    mss_mmc_status_t mmc_status;
+    uint64_t saved;
+
+    (void)status;
+
+    mmc_status = MSS_MMC_get_transfer_status();
+
+    saved = mss_spin_lock_irqsave(&g_mmc_lock);
+    if ((NULL != g_mmc_head) && (MSS_MMC_TRANSFER_IN_PROGRESS != mmc_status))
+    {
+        done = p2p_mmc_next(&failed);
+    }
+    mss_spin_unlock_irqrestore(&g_mmc_lock, saved);
+
+    if (NULL != done)
+    {
+        if (MSS_MMC_TRANSFER_SUCCESS != mmc_status)
+        {
+            p2p_complete(done, PF_PCIE_P2P_PEER_ERROR);
+        }
+        else if (PF_PCIE_P2P_MMC_TO_EP == done->path)
+        {
+            if (PF_PCIE_DMA_SUBMIT_SUCCESS !=
+                p2p_dma_submit(done, PF_PCIE_EP_DMA_WRITE))
+            {
+                p2p_complete(done, PF_PCIE_P2P_PCIE_ERROR);
+            }
+        }
+        else
+        {
+            p2p_complete(done, PF_PCIE_P2P_SUCCESS);
+        }
+    }
+
+    p2p_fail_list(failed);
+}
+
+/***************************************************************************//**
+ * See pf_pcie_p2p.h for details of how to use this function.
+ */
+void
+PF_PCIE_p2p_mac_tx_complete
+(
+    void * p_user_data
+)
+{
+    pf_pcie_p2p_xfer_t * xfer = (pf_pcie_p2p_xfer_t *)p_user_data;
+
+    if (NULL != xfer)
+    {
+        p2p_complete(xfer, PF_PCIE_P2P_SUCCESS);
+    }
+}
+
+#endif /* PF_PCIE_P2P */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,245 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PolarFire SoC PCIe endpoint DMA transfers chained with the MAC and MMC
+ * drivers.
+ *
+ */
+/*=========================================================================*//**
+  @section intro_sec Introduction
+  A chained transfer moves a buffer between the PCIe endpoint and the Ethernet
+  MAC or the eMMC/SD card in two legs, an endpoint DMA job and a MAC or MMC
+  transfer, on the same buffer. The completion of the first leg submits the
+  second, from the interrupt handler of the first, so the data is written to
+  the DDR once and read from it once, without a copy between a PCIe buffer and
+  a buffer of the other driver. Four paths are supported:
+    - PF_PCIE_P2P_EP_TO_MAC, endpoint DMA read into the buffer, then
+      MSS_MAC_send_pkt() of it
+    - PF_PCIE_P2P_EP_TO_MMC, endpoint DMA read into the buffer, then
+      MSS_MMC_adma2_write() of it
+    - PF_PCIE_P2P_MAC_TO_EP, endpoint DMA write of a received packet, from the
+      receive buffer pool of the MAC when MSS_MAC_RX_BUFFER_POOL is defined,
+      the MAC leg having already taken place
+    - PF_PCIE_P2P_MMC_TO_EP, MSS_MMC_adma2_read() into the buffer, then
+      endpoint DMA write of it
+
+  The chained transfers are built when PF_PCIE_P2P is defined.
+
+  @section theory_op Theory of Operation
+  Set up
+  The buffers are registered with PF_PCIE_dma_share_buffer(), or
+  PF_PCIE_inst_dma_share_buffer(), so that the endpoint DMA jobs of the
+  transfers can give them by their CPU address. For the MMC paths
+  PF_PCIE_p2p_mmc_handler() is registered with MSS_MMC_set_handler(), or
+  called from the handler registered, and for PF_PCIE_P2P_EP_TO_MAC
+  PF_PCIE_p2p_mac_tx_complete() is called from the transmit callback of the
+  MAC with its p_user_data.
+
+  Transfers
+  The application fills a pf_pcie_p2p_xfer_t and passes it to
+  PF_PCIE_p2p_submit(). The endpoint DMA jobs are queued as by
+  PF_PCIE_dma_submit(). The MMC driver runs one transfer at a time, so the MMC
+  legs are queued by this module in the order they become ready and started
+  one after the other. The handler of the transfer is called once both legs
+  have completed, or the first leg which fails, and the transfer can then be
+  submitted again.
+
+  The MAC and MMC legs are started from PF_PCIE_isr() and the MMC interrupt
+  handler, which must be able to call MSS_MAC_send_pkt() and
+  MSS_MMC_adma2_write() or MSS_MMC_adma2_read(). The MMC driver waits for the
+  data lines of the card to be free before it starts a transfer, so an MMC leg
+  can delay the return from the interrupt handler by that long. The MMC legs
+  are the only MMC transfers while chained transfers are in progress.
+
+  Cache maintenance
+  The endpoint DMA flushes the shared buffers when PF_PCIE_CACHE_MAINTENANCE
+  is defined, and the MMC driver when MSS_MMC_CACHE_MAINTENANCE is. The MAC
+  reads and writes cached DDR through the L2.
+
+  @code
+        #define BLOCKS      8u
+
+        static uint8_t g_blk_buf[2][BLOCKS * 512u] __attribute__ ((aligned (64)));
+        static pf_pcie_p2p_xfer_t g_xfer[2];
+
+        static void xfer_done(pf_pcie_p2p_xfer_t * xfer, uint8_t status)
+        {
+            if (PF_PCIE_P2P_SUCCESS == status)
+            {
+                xfer->ep_address += sizeof(g_blk_buf[0]) * 2u;
+                xfer->lba += BLOCKS * 2u;
+                (void)PF_PCIE_p2p_submit(xfer);
+            }
+        }
+
+        void start_ep_to_card(void)
+        {
+            uint8_t idx;
+
+            (void)PF_PCIE_dma_share_buffer((uint64_t)(uintptr_t)g_blk_buf,
+                                           sizeof(g_blk_buf), RP_BLK_BUF_ADDR);
+            MSS_MMC_set_handler(PF_PCIE_p2p_mmc_handler);
+
+            for (idx = 0u; idx < 2u; idx++)
+            {
+                g_xfer[idx].path = PF_PCIE_P2P_EP_TO_MMC;
+                g_xfer[idx].pcie = NULL;
+                g_xfer[idx].ep_address = EP_SRAM_ADDR + (idx * sizeof(g_blk_buf[0]));
+                g_xfer[idx].buffer = g_blk_buf[idx];
+                g_xfer[idx].length = sizeof(g_blk_buf[0]);
+                g_xfer[idx].lba = idx * BLOCKS;
+                g_xfer[idx].handler = xfer_done;
+                (void)PF_PCIE_p2p_submit(&g_xfer[idx]);
+            }
+        }
+  @endcode
+ *//*=========================================================================*/
+#ifndef PF_PCIE_P2P_H_
+#define PF_PCIE_P2P_H_
+
+#include <stdint.h>
+#include "pf_pcie.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac.h"
+#include "drivers/mss/mss_mmc/mss_mmc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(PF_PCIE_P2P)
+
+/*****************************************************************************
+  Handler status values, PF_PCIE_P2P_INVALID is also returned by
+  PF_PCIE_p2p_submit()
+*/
+#define PF_PCIE_P2P_SUCCESS         0u
+#define PF_PCIE_P2P_PCIE_ERROR      1u
+#define PF_PCIE_P2P_PEER_ERROR      2u
+#define PF_PCIE_P2P_INVALID         3u
+
+/*****************************************************************************
+  Paths of a chained transfer, see the introduction
+*/
+typedef enum
+{
+    PF_PCIE_P2P_EP_TO_MAC = 0,
+    PF_PCIE_P2P_EP_TO_MMC,
+    PF_PCIE_P2P_MAC_TO_EP,
+    PF_PCIE_P2P_MMC_TO_EP
+} pf_pcie_p2p_path_t;
+
+struct pf_pcie_p2p_xfer;
+
+/*****************************************************************************
+  Completion handler of a chained transfer, called with the transfer and one
+  of the PF_PCIE_P2P_xxx status values from the interrupt handler of its last
+  leg.
+*/
+typedef void (*pf_pcie_p2p_handler_t)(struct pf_pcie_p2p_xfer * xfer,
+                                      uint8_t status);
+
+/*****************************************************************************
+  The pf_pcie_p2p_xfer_t structure describes a chained transfer. The fields
+  up to user_data are filled in by the application, the others are used by
+  the module. The structure belongs to the module from PF_PCIE_p2p_submit()
+  until its handler is called.
+
+  path
+    Path of the transfer.
+
+  pcie
+    PCIe instance, or NULL for the instance of the functions without an
+    instance parameter.
+
+  ep_address
+    Endpoint memory address, the source of PF_PCIE_P2P_EP_TO_xxx transfers
+    and the destination of the others.
+
+  buffer, length
+    Buffer, inside a buffer registered with PF_PCIE_dma_share_buffer(), and
+    number of bytes moved. For the MMC paths length is a multiple of 512.
+
+  mac, queue_no
+    MAC and transmit queue of PF_PCIE_P2P_EP_TO_MAC.
+
+  rx_buf
+    Receive buffer pool handle of the packet of PF_PCIE_P2P_MAC_TO_EP, or
+    NULL. The reference of the application to it is released with
+    MSS_MAC_rx_buf_release() once the endpoint DMA write has completed.
+
+  lba
+    Card sector of the MMC paths.
+
+  handler, user_data
+    Completion handler and data free for the application.
+*/
+typedef struct pf_pcie_p2p_xfer
+{
+    pf_pcie_p2p_path_t path;
+    pf_pcie_instance_t * pcie;
+    uint64_t ep_address;
+    uint8_t * buffer;
+    uint32_t length;
+    mss_mac_instance_t * mac;
+    uint32_t queue_no;
+#if defined(MSS_MAC_RX_BUFFER_POOL)
+    mss_mac_rx_buf_t * rx_buf;
+#endif
+    uint32_t lba;
+    pf_pcie_p2p_handler_t handler;
+    void * user_data;
+
+    pf_pcie_dma_job_t job;
+    struct pf_pcie_p2p_xfer * next;
+} pf_pcie_p2p_xfer_t;
+
+/*****************************************************************************
+  The PF_PCIE_p2p_submit() function starts a chained transfer with its first
+  leg, an endpoint DMA job or, for PF_PCIE_P2P_MMC_TO_EP, an MMC read queued
+  behind the MMC legs already queued.
+
+  @param xfer
+    Points to the transfer.
+
+  @return
+    PF_PCIE_P2P_SUCCESS, or PF_PCIE_P2P_INVALID if a field of the transfer is
+    not valid or, for the paths starting with the endpoint DMA, if
+    PF_PCIE_dma_submit() refuses its job, for example because the buffer is
+    not shared.
+*/
+uint8_t PF_PCIE_p2p_submit(pf_pcie_p2p_xfer_t * xfer);
+
+/*****************************************************************************
+  The PF_PCIE_p2p_mmc_handler() function completes the MMC leg in progress
+  and starts the next one queued. It is registered with
+  MSS_MMC_set_handler(), or called from the handler registered, and ignores
+  the completion of MMC transfers which are not MMC legs.
+
+  @param status
+    Interrupt status passed to the MMC handler.
+*/
+void PF_PCIE_p2p_mmc_handler(uint32_t status);
+
+/*****************************************************************************
+  The PF_PCIE_p2p_mac_tx_complete() function completes a
+  PF_PCIE_P2P_EP_TO_MAC transfer once the MAC has sent its buffer. It is
+  called from the transmit callback of the MAC with the p_user_data of the
+  callback, which is the transfer.
+
+  @param p_user_data
+    The p_user_data parameter of the transmit callback.
+*/
+void PF_PCIE_p2p_mac_tx_complete(void * p_user_data);
+
+#endif /* PF_PCIE_P2P */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PF_PCIE_P2P_H_ */
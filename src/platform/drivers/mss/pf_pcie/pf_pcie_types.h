@@ -147,6 +147,68 @@ typedef void (*pf_pcie_write_callback_t)(pf_pcie_ep_dma_status_t status);
  */
 typedef void (*pf_pcie_read_callback_t)(pf_pcie_ep_dma_status_t status);
 
+/*****************************************************************************
+  The pf_pcie_ep_dma_dir_t type selects the endpoint DMA engine used by
+  PF_PCIE_dma_submit().
+
+  - PF_PCIE_EP_DMA_WRITE  - DMA0, from the root port memory to the endpoint
+                            memory, as PF_PCIE_dma_write().
+  - PF_PCIE_EP_DMA_READ   - DMA1, from the endpoint memory to the root port
+                            memory, as PF_PCIE_dma_read().
+ */
+typedef enum
+{
+    PF_PCIE_EP_DMA_WRITE = 0,
+    PF_PCIE_EP_DMA_READ = 1
+} pf_pcie_ep_dma_dir_t;
+
+struct pf_pcie_dma_job;
+
+/***************************************************************************//**
+  The pf_pcie_dma_job_callback_t type defines the function prototype of the
+  completion handler of a DMA job queued with PF_PCIE_dma_submit(). It is
+  called from PF_PCIE_isr() with the job and the outcome of its transfer,
+  PF_PCIE_EP_DMA_COMPLETED or PF_PCIE_EP_DMA_ERROR. The job is no longer used
+  by the driver once its handler is called and can be submitted again.
+ */
+typedef void (*pf_pcie_dma_job_callback_t)(struct pf_pcie_dma_job * job,
+                                           pf_pcie_ep_dma_status_t status);
+
+/*****************************************************************************
+  The pf_pcie_dma_job_t structure describes one endpoint DMA transfer queued
+  with PF_PCIE_dma_submit(). The structure belongs to the driver from the
+  submit call until its callback is called.
+
+  src_address, dest_address, length
+    Source and destination addresses and size in bytes of the transfer, with
+    the same meaning as the parameters of PF_PCIE_dma_write() and
+    PF_PCIE_dma_read() for the direction the job is submitted to.
+
+  flags
+    PF_PCIE_DMA_JOB_SHARED if the root port address of the job, dest_address
+    of a read or src_address of a write, is the CPU address of a buffer
+    registered with PF_PCIE_dma_share_buffer(), 0 otherwise.
+
+  callback
+    Completion handler, or NULL.
+
+  user_data
+    Free for the application, not used by the driver.
+
+  next
+    Used by the driver to link the queued jobs.
+*/
+typedef struct pf_pcie_dma_job
+{
+    uint64_t src_address;
+    uint64_t dest_address;
+    uint32_t length;
+    uint32_t flags;
+    pf_pcie_dma_job_callback_t callback;
+    void * user_data;
+    struct pf_pcie_dma_job * next;
+} pf_pcie_dma_job_t;
+
 /*****************************************************************************
   The pf_pcie_info_t structure contains the PCIe system(device or bridge) vendor id,
   bus, device and function number.
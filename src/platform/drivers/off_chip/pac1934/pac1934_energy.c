@@ -0,0 +1,374 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PAC1934 power monitor energy measurement bare metal software driver
+ * implementation.
+ *
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss/mss_i2c/mss_i2c.h"
+#include "pac1934_energy.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ * PAC1934 registers and IDs
+ */
+#define PAC1934_REG_REFRESH             0x00u
+#define PAC1934_REG_CTRL                0x01u
+#define PAC1934_REG_ACC_COUNT           0x02u
+#define PAC1934_REG_CHANNEL_DIS         0x1Cu
+#define PAC1934_REG_NEG_PWR             0x1Du
+#define PAC1934_REG_REFRESH_V           0x1Fu
+#define PAC1934_REG_PRODUCT_ID          0xFDu
+
+#define PAC1934_PRODUCT_ID              0x5Bu
+#define PAC1934_MANUFACTURER_ID         0x5Du
+
+#define PAC1934_CTRL_SAMPLE_SHIFT       6u
+
+/* ACC_COUNT, 3 bytes, followed by VPOWER1_ACC to VPOWER4_ACC, 6 bytes each */
+#define PAC1934_ACC_COUNT_SIZE          3u
+#define PAC1934_VPOWER_ACC_SIZE         6u
+#define PAC1934_ACC_BLOCK_SIZE          (PAC1934_ACC_COUNT_SIZE + \
+                                  (PAC1934_NUM_CHANNELS * PAC1934_VPOWER_ACC_SIZE))
+
+/* Time from a refresh to the registers updated */
+#define PAC1934_REFRESH_WAIT_US         1000u
+
+/* Smallest sense resistor, which keeps the full scale power below 2^29 uW */
+#define PAC1934_MIN_RSENSE_UOHM         1000u
+
+/* 3.2 W x 100 mV, in micro-watts x micro-ohms */
+#define PAC1934_FSR_UW_UOHM             320000000000ULL
+
+#define PAC1934_ACC_FRACTION_BITS       28u
+#define PAC1934_HALF_FRACTION_BITS      14u
+
+static const uint32_t g_pac1934_sps[4] = { 1024u, 256u, 64u, 8u };
+
+static uint8_t pac1934_transfer(pac1934_energy_t * this_pac);
+static void pac1934_set_op(pac1934_energy_t * this_pac, uint8_t idx,
+        const uint8_t * tx, uint16_t tx_size, uint8_t * rx, uint16_t rx_size);
+static uint64_t pac1934_to_nj(uint64_t acc, uint32_t fsr_uw, uint32_t sps);
+
+/*------------------------------------------------------------------------------
+ * See pac1934_energy.h
+ */
+uint8_t PAC1934_energy_init
+(
+    pac1934_energy_t * this_pac,
+    const pac1934_energy_cfg_t * cfg
+)
+{
+    uint8_t result = PAC1934_SUCCESS;
+    uint8_t ch;
+
+    this_pac->cfg = cfg;
+    this_pac->running = 0u;
+
+    if (cfg->sample_rate > PAC1934_SPS_8)
+    {
+        result = PAC1934_ERR_CFG;
+    }
+    else
+    {
+        this_pac->sps = g_pac1934_sps[cfg->sample_rate];
+    }
+
+    for (ch = 0u; (PAC1934_SUCCESS == result) && (ch < PAC1934_NUM_CHANNELS);
+         ch++)
+    {
+        if (0u == cfg->rsense_uohm[ch])
+        {
+            this_pac->fsr_uw[ch] = 0u;
+        }
+        else if (cfg->rsense_uohm[ch] < PAC1934_MIN_RSENSE_UOHM)
+        {
+            result = PAC1934_ERR_CFG;
+        }
+        else
+        {
+            this_pac->fsr_uw[ch] = (uint32_t)(PAC1934_FSR_UW_UOHM /
+                    cfg->rsense_uohm[ch]);
+        }
+    }
+
+    if (PAC1934_SUCCESS == result)
+    {
+        /* Product ID followed by the manufacturer ID */
+        this_pac->tx[0] = PAC1934_REG_PRODUCT_ID;
+        pac1934_set_op(this_pac, 0u, &this_pac->tx[0], 1u, this_pac->rx, 2u);
+        result = pac1934_transfer(this_pac);
+    }
+
+    if ((PAC1934_SUCCESS == result) &&
+        ((PAC1934_PRODUCT_ID != this_pac->rx[0]) ||
+         (PAC1934_MANUFACTURER_ID != this_pac->rx[1])))
+    {
+        result = PAC1934_ERR_ID;
+    }
+
+    if (PAC1934_SUCCESS == result)
+    {
+        /* Sample rate, all channels enabled and unipolar, then a refresh for
+           the new settings to take effect. Each write ends with a STOP. */
+        this_pac->tx[0] = PAC1934_REG_CTRL;
+        this_pac->tx[1] = (uint8_t)(cfg->sample_rate << PAC1934_CTRL_SAMPLE_SHIFT);
+        this_pac->tx[2] = PAC1934_REG_CHANNEL_DIS;
+        this_pac->tx[3] = 0u;
+        this_pac->tx[4] = PAC1934_REG_NEG_PWR;
+        this_pac->tx[5] = 0u;
+        this_pac->tx[6] = PAC1934_REG_REFRESH;
+        pac1934_set_op(this_pac, 0u, &this_pac->tx[0], 2u, (uint8_t *)0, 0u);
+        pac1934_set_op(this_pac, 1u, &this_pac->tx[2], 2u, (uint8_t *)0, 0u);
+        pac1934_set_op(this_pac, 2u, &this_pac->tx[4], 2u, (uint8_t *)0, 0u);
+        pac1934_set_op(this_pac, 3u, &this_pac->tx[6], 1u, (uint8_t *)0, 0u);
+        this_pac->ops[0].next = &this_pac->ops[1];
+        this_pac->ops[1].next = &this_pac->ops[2];
+        this_pac->ops[2].next = &this_pac->ops[3];
+        result = pac1934_transfer(this_pac);
+    }
+
+    return (result);
+}
+
+/*------------------------------------------------------------------------------
+ * See pac1934_energy.h
+ */
+uint8_t PAC1934_energy_start
+(
+    pac1934_energy_t * this_pac
+)
+{
+    uint8_t result;
+
+    this_pac->tx[0] = PAC1934_REG_REFRESH;
+    pac1934_set_op(this_pac, 0u, &this_pac->tx[0], 1u, (uint8_t *)0, 0u);
+    result = pac1934_transfer(this_pac);
+
+    if (PAC1934_SUCCESS == result)
+    {
+        this_pac->mtime_start = readmtime();
+        this_pac->running = 1u;
+    }
+
+    return (result);
+}
+
+/*------------------------------------------------------------------------------
+ * See pac1934_energy.h
+ */
+uint8_t PAC1934_energy_stop
+(
+    pac1934_energy_t * this_pac,
+    pac1934_energy_result_t * result
+)
+{
+    uint8_t status = PAC1934_ERR_STATE;
+    uint64_t mtime_stop = 0u;
+    uint64_t acc;
+    const uint8_t * data;
+    uint8_t ch;
+    uint8_t idx;
+
+    if (0u != this_pac->running)
+    {
+        this_pac->running = 0u;
+
+        this_pac->tx[0] = PAC1934_REG_REFRESH_V;
+        pac1934_set_op(this_pac, 0u, &this_pac->tx[0], 1u, (uint8_t *)0, 0u);
+        status = pac1934_transfer(this_pac);
+        mtime_stop = readmtime();
+    }
+
+    if (PAC1934_SUCCESS == status)
+    {
+        mss_idle_sleep_us(PAC1934_REFRESH_WAIT_US);
+
+        this_pac->tx[0] = PAC1934_REG_ACC_COUNT;
+        pac1934_set_op(this_pac, 0u, &this_pac->tx[0], 1u, this_pac->rx,
+                PAC1934_ACC_BLOCK_SIZE);
+        status = pac1934_transfer(this_pac);
+    }
+
+    if (PAC1934_SUCCESS == status)
+    {
+        result->samples = ((uint32_t)this_pac->rx[0] << 16u) |
+                ((uint32_t)this_pac->rx[1] << 8u) | (uint32_t)this_pac->rx[2];
+        result->duration_us = ((uint64_t)result->samples * 1000000u) /
+                this_pac->sps;
+        result->mtime_ticks = mtime_stop - this_pac->mtime_start;
+        result->total_nj = 0u;
+
+        for (ch = 0u; ch < PAC1934_NUM_CHANNELS; ch++)
+        {
+            data = &this_pac->rx[PAC1934_ACC_COUNT_SIZE +
+                                 (ch * PAC1934_VPOWER_ACC_SIZE)];
+            acc = 0u;
+
+            for (idx = 0u; idx < PAC1934_VPOWER_ACC_SIZE; idx++)
+            {
+                acc = (acc << 8u) | data[idx];
+            }
+
+            result->energy_nj[ch] = pac1934_to_nj(acc, this_pac->fsr_uw[ch],
+                    this_pac->sps);
+            result->total_nj += result->energy_nj[ch];
+        }
+
+        /* nJ per us is mW */
+        if (0u == result->duration_us)
+        {
+            result->power_uw = 0u;
+        }
+        else
+        {
+            result->power_uw = (result->total_nj * 1000u) / result->duration_us;
+        }
+    }
+
+    return (status);
+}
+
+/*------------------------------------------------------------------------------
+ * See pac1934_energy.h
+ */
+uint64_t PAC1934_energy_per_op
+(
+    const pac1934_energy_result_t * result,
+    uint64_t ops
+)
+{
+    uint64_t energy = 0u;
+
+    if (0u != ops)
+    {
+        energy = (result->total_nj * 1000u) / ops;
+    }
+
+    return (energy);
+}
+
+/*------------------------------------------------------------------------------
+ * See pac1934_energy.h
+ */
+uint64_t PAC1934_energy_per_mb
+(
+    const pac1934_energy_result_t * result,
+    uint64_t bytes
+)
+{
+    uint64_t energy = 0u;
+
+    if (0u != bytes)
+    {
+        energy = (result->total_nj * 1000000u) / bytes;
+    }
+
+    return (energy);
+}
+
+/*------------------------------------------------------------------------------
+ * See pac1934_energy.h
+ */
+void PAC1934_energy_report_csv_header
+(
+    mss_uart_instance_t * uart
+)
+{
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)"name,samples,us,"\
+            "ch1_nj,ch2_nj,ch3_nj,ch4_nj,total_nj,uw,ops,pj_per_op\n\r");
+}
+
+/*------------------------------------------------------------------------------
+ * See pac1934_energy.h
+ */
+void PAC1934_energy_report_csv
+(
+    mss_uart_instance_t * uart,
+    const char * name,
+    const pac1934_energy_result_t * result,
+    uint64_t ops
+)
+{
+    uint8_t ch;
+
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)name);
+    mss_print_dec(uart, ",", result->samples);
+    mss_print_dec(uart, ",", result->duration_us);
+
+    for (ch = 0u; ch < PAC1934_NUM_CHANNELS; ch++)
+    {
+        mss_print_dec(uart, ",", result->energy_nj[ch]);
+    }
+
+    mss_print_dec(uart, ",", result->total_nj);
+    mss_print_dec(uart, ",", result->power_uw);
+    mss_print_dec(uart, ",", ops);
+    mss_print_dec(uart, ",", PAC1934_energy_per_op(result, ops));
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)"\n\r");
+}
+
+/*------------------------------------------------------------------------------
+ * Queues the sequence starting at ops[0] and waits for it to complete.
+ */
+static uint8_t pac1934_transfer(pac1934_energy_t * this_pac)
+{
+    uint8_t result = PAC1934_SUCCESS;
+    mss_i2c_status_t status;
+
+    MSS_I2C_queue_transfer(this_pac->cfg->i2c, &this_pac->ops[0],
+            (mss_i2c_transfer_completion_t)0);
+    status = MSS_I2C_wait_complete(this_pac->cfg->i2c, MSS_I2C_NO_TIMEOUT);
+
+    if (MSS_I2C_SUCCESS != status)
+    {
+        result = PAC1934_ERR_I2C;
+    }
+
+    return (result);
+}
+
+/*------------------------------------------------------------------------------
+ * Fills in one operation to the PAC1934, ending with a STOP and last in the
+ * sequence.
+ */
+static void pac1934_set_op(pac1934_energy_t * this_pac, uint8_t idx,
+        const uint8_t * tx, uint16_t tx_size, uint8_t * rx, uint16_t rx_size)
+{
+    this_pac->ops[idx].serial_addr = this_pac->cfg->addr;
+    this_pac->ops[idx].tx_buffer = tx;
+    this_pac->ops[idx].tx_size = tx_size;
+    this_pac->ops[idx].rx_buffer = rx;
+    this_pac->ops[idx].rx_size = rx_size;
+    this_pac->ops[idx].options = MSS_I2C_RELEASE_BUS;
+    this_pac->ops[idx].next = (const mss_i2c_op_t *)0;
+}
+
+/*------------------------------------------------------------------------------
+ * Converts an accumulator to nanojoules:
+ *   acc x fsr_uw x 1000 / 2^28 / sps
+ * The accumulator is split at bit 28 so that no product overflows.
+ */
+static uint64_t pac1934_to_nj(uint64_t acc, uint32_t fsr_uw, uint32_t sps)
+{
+    uint64_t whole = acc >> PAC1934_ACC_FRACTION_BITS;
+    uint64_t fraction = acc & ((1ULL << PAC1934_ACC_FRACTION_BITS) - 1u);
+    uint64_t energy;
+
+    energy = (whole * fsr_uw * 1000u) +
+            ((((fraction * fsr_uw) >> PAC1934_HALF_FRACTION_BITS) * 1000u) >>
+             PAC1934_HALF_FRACTION_BITS);
+
+    return (energy / sps);
+}
+
+#ifdef __cplusplus
+}
+#endif
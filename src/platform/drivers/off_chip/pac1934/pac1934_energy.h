@@ -0,0 +1,264 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PAC1934 power monitor energy measurement bare metal software driver public
+ * API.
+ *
+ */
+/*=========================================================================*//**
+  @mainpage PAC1934 Energy Measurement Bare Metal Driver.
+
+  ==============================================================================
+  Introduction
+  ==============================================================================
+  The PAC1934 on the Icicle kit samples the voltage and the current of four
+  supply rails and adds the power of each sample to one 48 bit accumulator per
+  channel. This driver uses the accumulators to measure the energy used between
+  a start and a stop marker placed around a benchmark, and reports it per
+  operation, so that configurations such as the L2 way masks, the CPU clock or
+  idling in wfi can be compared in joules per packet, per MB transferred or per
+  CoreMark iteration as well as in cycles.
+
+  All the PAC1934 accesses are sequences queued with MSS_I2C_queue_transfer(),
+  so each marker is a single I2C transaction started with one call:
+    - PAC1934_energy_start() sends REFRESH, which clears the accumulators and
+      the accumulation count. The accumulation of the window starts with the
+      STOP of the transaction.
+    - PAC1934_energy_stop() sends REFRESH_V, which latches the accumulators and
+      the count without clearing them, waits the 1 ms the PAC1934 takes to
+      update its registers, then reads the count and the four accumulators in
+      one block read.
+  The accumulators are only updated at the sample rate, so the energy of a
+  window is known to within one sample period at each end: windows should be
+  at least a few hundred sample periods long, by running the benchmark for
+  enough iterations. At full scale the 48 bit accumulators overflow after 2^20
+  samples, about 17 minutes at 1024 samples per second.
+
+  The markers wait for the I2C transactions to complete, so they must be
+  called with the MSS I2C interrupt enabled, outside mss_bench_run() or any
+  other code running with interrupts masked. The workload itself may run on
+  any hart.
+
+  ==============================================================================
+  Energy Calculation
+  ==============================================================================
+  In unipolar mode, the default, the full scale power of a channel is
+  3.2 W x (100 mV / Rsense), and each sample adds its power as a fraction of
+  the full scale times 2^28 to the accumulator. The energy of a channel is
+  then:
+      E = VPOWER_ACC x (0.32 V^2 / Rsense) / 2^28 / sample rate
+  The sense resistors are given in micro-ohms in the configuration and must be
+  1000 or more; a channel with a sense resistor of 0 is left out of the total.
+
+  ==============================================================================
+  Example
+  ==============================================================================
+  @code
+    static pac1934_energy_t g_pac;
+    static const pac1934_energy_cfg_t g_pac_cfg =
+    {
+        &g_mss_i2c1_lo, PAC1934_DEFAULT_ADDR, PAC1934_SPS_1024,
+        { 10000U, 10000U, 10000U, 10000U }
+    };
+
+    pac1934_energy_result_t result;
+
+    MSS_I2C_init(&g_mss_i2c1_lo, 0x21u, MSS_I2C_PCLK_DIV_256);
+    PLIC_SetPriority(I2C1_MAIN_PLIC, 2);
+    PLIC_EnableIRQ(I2C1_MAIN_PLIC);
+
+    if (PAC1934_SUCCESS == PAC1934_energy_init(&g_pac, &g_pac_cfg))
+    {
+        PAC1934_energy_report_csv_header(&g_mss_uart0_lo);
+
+        (void)PAC1934_energy_start(&g_pac);
+        for (idx = 0U; idx < iterations; idx++)
+        {
+            coremark_iteration();
+        }
+        (void)PAC1934_energy_stop(&g_pac, &result);
+
+        PAC1934_energy_report_csv(&g_mss_uart0_lo, "coremark", &result,
+                iterations);
+    }
+  @endcode
+ *//*=========================================================================*/
+#ifndef PAC1934_ENERGY_H_
+#define PAC1934_ENERGY_H_
+
+#include <stdint.h>
+#include "drivers/mss/mss_i2c/mss_i2c.h"
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Default I2C address of the PAC1934, with its ADDRSEL pin to ground, as on the
+  Icicle kit.
+ */
+#define PAC1934_DEFAULT_ADDR            0x10u
+
+/*-------------------------------------------------------------------------*//**
+  Number of channels of the PAC1934.
+ */
+#define PAC1934_NUM_CHANNELS            4u
+
+/*-------------------------------------------------------------------------*//**
+  Sample rates, for the sample_rate member of pac1934_energy_cfg_t.
+ */
+#define PAC1934_SPS_1024                0u
+#define PAC1934_SPS_256                 1u
+#define PAC1934_SPS_64                  2u
+#define PAC1934_SPS_8                   3u
+
+/*-------------------------------------------------------------------------*//**
+  Return values of the PAC1934 energy functions.
+ */
+#define PAC1934_SUCCESS                 0u
+#define PAC1934_ERR_I2C                 1u
+#define PAC1934_ERR_ID                  2u
+#define PAC1934_ERR_CFG                 3u
+#define PAC1934_ERR_STATE               4u
+
+/*-------------------------------------------------------------------------*//**
+  The pac1934_energy_cfg_t type gives the I2C instance and address of the
+  PAC1934, its sample rate and the sense resistor of each channel in
+  micro-ohms.
+ */
+typedef struct
+{
+    mss_i2c_instance_t * i2c;
+    uint8_t addr;
+    uint8_t sample_rate;
+    uint32_t rsense_uohm[PAC1934_NUM_CHANNELS];
+} pac1934_energy_cfg_t;
+
+/*-------------------------------------------------------------------------*//**
+  The pac1934_energy_t type holds the state of one PAC1934. The I2C buffers and
+  operations stay in it while a queued sequence is in progress.
+ */
+typedef struct
+{
+    const pac1934_energy_cfg_t * cfg;
+    uint32_t fsr_uw[PAC1934_NUM_CHANNELS];  /* Full scale power */
+    uint32_t sps;
+    uint64_t mtime_start;
+    uint8_t running;
+    uint8_t tx[8];
+    uint8_t rx[27];
+    mss_i2c_op_t ops[4];
+} pac1934_energy_t;
+
+/*-------------------------------------------------------------------------*//**
+  The pac1934_energy_result_t type gives the energy used between a start and a
+  stop marker.
+ */
+typedef struct
+{
+    uint64_t energy_nj[PAC1934_NUM_CHANNELS];
+    uint64_t total_nj;          /* Sum of the channels with a sense resistor */
+    uint32_t samples;           /* Accumulations in the window */
+    uint64_t duration_us;       /* Window, from the number of accumulations */
+    uint64_t mtime_ticks;       /* Window, from mtime between the markers */
+    uint64_t power_uw;          /* Mean power of the channels in the total */
+} pac1934_energy_result_t;
+
+/*-------------------------------------------------------------------------*//**
+  PAC1934_energy_init() checks the product and manufacturer IDs of the PAC1934,
+  enables its four channels in unipolar mode at the configured sample rate and
+  refreshes it so that the configuration takes effect. The MSS I2C instance
+  must be initialized and its interrupt enabled. The configuration must remain
+  valid while the instance is in use.
+
+  @return
+    PAC1934_SUCCESS, PAC1934_ERR_CFG for a sample rate or sense resistor out of
+    range, PAC1934_ERR_I2C if a transaction fails or PAC1934_ERR_ID if the
+    device is not a PAC1934.
+ */
+uint8_t PAC1934_energy_init
+(
+    pac1934_energy_t * this_pac,
+    const pac1934_energy_cfg_t * cfg
+);
+
+/*-------------------------------------------------------------------------*//**
+  PAC1934_energy_start() is the start marker of a measurement window. It clears
+  the accumulators of the PAC1934 and returns once they have been cleared.
+
+  @return
+    PAC1934_SUCCESS, or PAC1934_ERR_I2C if the transaction fails.
+ */
+uint8_t PAC1934_energy_start
+(
+    pac1934_energy_t * this_pac
+);
+
+/*-------------------------------------------------------------------------*//**
+  PAC1934_energy_stop() is the stop marker of a measurement window. It latches
+  the accumulators of the PAC1934, reads them and gives the energy used since
+  PAC1934_energy_start(). It takes a little over 1 ms.
+
+  @return
+    PAC1934_SUCCESS, PAC1934_ERR_STATE if no window was started or
+    PAC1934_ERR_I2C if a transaction fails.
+ */
+uint8_t PAC1934_energy_stop
+(
+    pac1934_energy_t * this_pac,
+    pac1934_energy_result_t * result
+);
+
+/*-------------------------------------------------------------------------*//**
+  PAC1934_energy_per_op() returns the energy of a window per operation in
+  picojoules, e.g. per packet or per benchmark iteration, or 0 for no
+  operations.
+ */
+uint64_t PAC1934_energy_per_op
+(
+    const pac1934_energy_result_t * result,
+    uint64_t ops
+);
+
+/*-------------------------------------------------------------------------*//**
+  PAC1934_energy_per_mb() returns the energy of a window per MB (10^6 bytes)
+  transferred in nanojoules, or 0 for no bytes.
+ */
+uint64_t PAC1934_energy_per_mb
+(
+    const pac1934_energy_result_t * result,
+    uint64_t bytes
+);
+
+/*-------------------------------------------------------------------------*//**
+  PAC1934_energy_report_csv_header() prints the names of the columns printed by
+  PAC1934_energy_report_csv().
+ */
+void PAC1934_energy_report_csv_header
+(
+    mss_uart_instance_t * uart
+);
+
+/*-------------------------------------------------------------------------*//**
+  PAC1934_energy_report_csv() prints a window to the UART as one line of comma
+  separated values: the name, the number of samples, the duration in
+  microseconds, the energy of each channel and the total in nanojoules, the
+  mean power in microwatts, the number of operations and the energy per
+  operation in picojoules.
+ */
+void PAC1934_energy_report_csv
+(
+    mss_uart_instance_t * uart,
+    const char * name,
+    const pac1934_energy_result_t * result,
+    uint64_t ops
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PAC1934_ENERGY_H_ */
@@ -12,6 +12,25 @@
  * The implementation of these function is platform and tool-chain specific.
  * The functions declared here are implemented using assembler as part of the 
  * processor/tool-chain specific HAL.
+ *
+ * Defining HW_REG_ACCESS_INLINE, on the compiler command line as this file is
+ * included before any HAL configuration, replaces the calls to the assembler
+ * functions with static inline functions of the same names. The compiler
+ * can then schedule the volatile accesses with the code around them and keep
+ * addresses in registers across loops. Each access stays a single load or
+ * store of the register width, in program order with the other volatile
+ * accesses.
+ *
+ * Defining HW_REG_ACCESS_FENCE as well orders the register accesses with the
+ * normal memory accesses: a "fence w,o" before each register write makes the
+ * memory writes before it, e.g. DMA descriptors, visible first, and a
+ * "fence i,r" after each register read completes it before the memory reads
+ * after it.
+ *
+ * Defining HW_REG_ACCESS_TRACE selects the inline functions and records each
+ * access they make, see hw_reg_trace.h. Drivers accessing registers through
+ * structure members can have those accesses recorded too by making them with
+ * HW_REG_RD() and HW_REG_WR(), which are plain accesses without tracing.
  * 
  */
 #ifndef HW_REG_ACCESS
@@ -23,6 +42,42 @@ extern "C" {
 
 
 #include "cpu_types.h"
+
+#ifdef HW_REG_ACCESS_TRACE
+#include "hw_reg_trace.h"
+
+#ifndef HW_REG_ACCESS_INLINE
+#define HW_REG_ACCESS_INLINE
+#endif
+
+#define HW_REG_TRACE_READ(ADDR, VALUE, SIZE) \
+    hw_reg_trace_record((addr_t)(ADDR), (uint32_t)(VALUE), (uint32_t)(SIZE))
+#define HW_REG_TRACE_WRITE(ADDR, VALUE, SIZE) \
+    hw_reg_trace_record((addr_t)(ADDR), (uint32_t)(VALUE), \
+                        (uint32_t)(SIZE) | HW_REG_TRACE_OP_WRITE)
+
+/*------------------------------------------------------------------------------
+ * Read and write of a register given as a structure member, e.g.
+ * HW_REG_WR(hw_reg->CTRL, value).
+ */
+#define HW_REG_RD(REG) \
+    __extension__ ({ __typeof__(REG) hw_reg_value_ = (REG); \
+        HW_REG_TRACE_READ(&(REG), hw_reg_value_, sizeof(REG)); \
+        hw_reg_value_; })
+#define HW_REG_WR(REG, VALUE) \
+    do { __typeof__(REG) hw_reg_value_ = (VALUE); \
+        (REG) = hw_reg_value_; \
+        HW_REG_TRACE_WRITE(&(REG), hw_reg_value_, sizeof(REG)); \
+    } while(0)
+#else
+#define HW_REG_TRACE_READ(ADDR, VALUE, SIZE)
+#define HW_REG_TRACE_WRITE(ADDR, VALUE, SIZE)
+
+#define HW_REG_RD(REG)                  (REG)
+#define HW_REG_WR(REG, VALUE)           ((REG) = (VALUE))
+#endif /* HW_REG_ACCESS_TRACE */
+
+#ifndef HW_REG_ACCESS_INLINE
 /***************************************************************************//**
  * HW_set_32bit_reg is used to write the content of a 32 bits wide peripheral
  * register.
@@ -235,7 +290,194 @@ uint8_t HW_get_8bit_reg_field
     uint_fast8_t mask
 );
 
+#else /* HW_REG_ACCESS_INLINE */
+
+#ifdef HW_REG_ACCESS_FENCE
+#define HW_REG_FENCE_BEFORE_WRITE()     __asm__ __volatile__("fence w,o" ::: "memory")
+#define HW_REG_FENCE_AFTER_READ()       __asm__ __volatile__("fence i,r" ::: "memory")
+#else
+#define HW_REG_FENCE_BEFORE_WRITE()
+#define HW_REG_FENCE_AFTER_READ()
+#endif
+
+/*------------------------------------------------------------------------------
+ * Inline forms of the functions above, with the same prototypes and results.
+ */
+static inline void
+HW_set_32bit_reg
+(
+    addr_t reg_addr,
+    uint32_t value
+)
+{
+    HW_REG_FENCE_BEFORE_WRITE();
+    *(volatile uint32_t *)reg_addr = value;
+    HW_REG_TRACE_WRITE(reg_addr, value, 4U);
+}
+
+static inline uint32_t
+HW_get_32bit_reg
+(
+    addr_t reg_addr
+)
+{
+    uint32_t value = *(volatile uint32_t *)reg_addr;
+
+    HW_REG_FENCE_AFTER_READ();
+    HW_REG_TRACE_READ(reg_addr, value, 4U);
+    return value;
+}
+
+static inline void
+HW_set_32bit_reg_field
+(
+    addr_t reg_addr,
+    int_fast8_t shift,
+    uint32_t mask,
+    uint32_t value
+)
+{
+    uint32_t reg = *(volatile uint32_t *)reg_addr;
+
+    HW_REG_TRACE_READ(reg_addr, reg, 4U);
+    reg = (reg & ~mask) | ((value << shift) & mask);
+    HW_REG_FENCE_BEFORE_WRITE();
+    *(volatile uint32_t *)reg_addr = reg;
+    HW_REG_TRACE_WRITE(reg_addr, reg, 4U);
+}
+
+static inline uint32_t
+HW_get_32bit_reg_field
+(
+    addr_t reg_addr,
+    int_fast8_t shift,
+    uint32_t mask
+)
+{
+    uint32_t value = *(volatile uint32_t *)reg_addr;
+
+    HW_REG_FENCE_AFTER_READ();
+    HW_REG_TRACE_READ(reg_addr, value, 4U);
+    return (value & mask) >> shift;
+}
+
+static inline void
+HW_set_16bit_reg
+(
+    addr_t reg_addr,
+    uint_fast16_t value
+)
+{
+    HW_REG_FENCE_BEFORE_WRITE();
+    *(volatile uint16_t *)reg_addr = (uint16_t)value;
+    HW_REG_TRACE_WRITE(reg_addr, value, 2U);
+}
+
+static inline uint16_t
+HW_get_16bit_reg
+(
+    addr_t reg_addr
+)
+{
+    uint16_t value = *(volatile uint16_t *)reg_addr;
+
+    HW_REG_FENCE_AFTER_READ();
+    HW_REG_TRACE_READ(reg_addr, value, 2U);
+    return value;
+}
+
+static inline void
+HW_set_16bit_reg_field
+(
+    addr_t reg_addr,
+    int_fast8_t shift,
+    uint_fast16_t mask,
+    uint_fast16_t value
+)
+{
+    uint16_t reg = *(volatile uint16_t *)reg_addr;
+
+    HW_REG_TRACE_READ(reg_addr, reg, 2U);
+    reg = (uint16_t)((reg & ~mask) | ((value << shift) & mask));
+    HW_REG_FENCE_BEFORE_WRITE();
+    *(volatile uint16_t *)reg_addr = reg;
+    HW_REG_TRACE_WRITE(reg_addr, reg, 2U);
+}
+
+static inline uint16_t
+HW_get_16bit_reg_field
+(
+    addr_t reg_addr,
+    int_fast8_t shift,
+    uint_fast16_t mask
+)
+{
+    uint16_t value = *(volatile uint16_t *)reg_addr;
+
+    HW_REG_FENCE_AFTER_READ();
+    HW_REG_TRACE_READ(reg_addr, value, 2U);
+    return (uint16_t)((value & mask) >> shift);
+}
+
+static inline void
+HW_set_8bit_reg
+(
+    addr_t reg_addr,
+    uint_fast8_t value
+)
+{
+    HW_REG_FENCE_BEFORE_WRITE();
+    *(volatile uint8_t *)reg_addr = (uint8_t)value;
+    HW_REG_TRACE_WRITE(reg_addr, value, 1U);
+}
+
+static inline uint8_t
+HW_get_8bit_reg
+(
+    addr_t reg_addr
+)
+{
+    uint8_t value = *(volatile uint8_t *)reg_addr;
+
+    HW_REG_FENCE_AFTER_READ();
+    HW_REG_TRACE_READ(reg_addr, value, 1U);
+    return value;
+}
+
+static inline void
+HW_set_8bit_reg_field
+(
+    addr_t reg_addr,
+    int_fast8_t shift,
+    uint_fast8_t mask,
+    uint_fast8_t value
+)
+{
+    uint8_t reg = *(volatile uint8_t *)reg_addr;
+
+    HW_REG_TRACE_READ(reg_addr, reg, 1U);
+    reg = (uint8_t)((reg & ~mask) | ((value << shift) & mask));
+    HW_REG_FENCE_BEFORE_WRITE();
+    *(volatile uint8_t *)reg_addr = reg;
+    HW_REG_TRACE_WRITE(reg_addr, reg, 1U);
+}
+
+static inline uint8_t
+HW_get_8bit_reg_field
+(
+    addr_t reg_addr,
+    int_fast8_t shift,
+    uint_fast8_t mask
+)
+{
+    uint8_t value = *(volatile uint8_t *)reg_addr;
+
+    HW_REG_FENCE_AFTER_READ();
+    HW_REG_TRACE_READ(reg_addr, value, 1U);
+    return (uint8_t)((value & mask) >> shift);
+}
 
+#endif /* HW_REG_ACCESS_INLINE */
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright 2019-2020 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+/***************************************************************************//**
+ *
+ * Register access tracing, see hw_reg_trace.h.
+ *
+ */
+#include "hal/hal.h"
+#include "mpfs_hal/common/mss_util.h"
+
+#ifdef HW_REG_ACCESS_TRACE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (0U != (HW_REG_TRACE_DEPTH & (HW_REG_TRACE_DEPTH - 1U)))
+#error "HW_REG_TRACE_DEPTH must be a power of two"
+#endif
+
+typedef struct
+{
+    hw_reg_trace_entry_t ring[HW_REG_TRACE_DEPTH];
+    uint32_t next;
+    uint32_t used;
+    uint64_t reads;
+    uint64_t writes;
+    uint64_t start_cycle;
+} hw_reg_trace_t;
+
+static hw_reg_trace_t g_hw_reg_trace[HW_REG_TRACE_NUM_HARTS];
+static volatile uint8_t g_hw_reg_trace_on = 1U;
+
+/*------------------------------------------------------------------------------
+ * See hw_reg_trace.h.
+ * Interrupts are masked so an access made by an interrupt handler is not lost
+ * half way through the recording of another.
+ */
+void hw_reg_trace_record(addr_t addr, uint32_t value, uint32_t op)
+{
+    hw_reg_trace_t * trace;
+    hw_reg_trace_entry_t * entry;
+    uint64_t hart_id;
+    uint64_t psr;
+
+    if(0U != g_hw_reg_trace_on)
+    {
+        psr = read_csr(mstatus);
+        __disable_irq();
+
+        hart_id = read_csr(mhartid);
+        trace = &g_hw_reg_trace[hart_id];
+        entry = &trace->ring[trace->next];
+
+        entry->cycle = read_csr(mcycle);
+        entry->addr = addr;
+        entry->value = value;
+        entry->op = op;
+
+        trace->next = (trace->next + 1U) & (HW_REG_TRACE_DEPTH - 1U);
+
+        if(trace->used < HW_REG_TRACE_DEPTH)
+        {
+            trace->used++;
+        }
+
+        if(0U != (op & HW_REG_TRACE_OP_WRITE))
+        {
+            trace->writes++;
+        }
+        else
+        {
+            trace->reads++;
+        }
+
+        write_csr(mstatus, psr);
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * See hw_reg_trace.h.
+ */
+void hw_reg_trace_enable(uint8_t enable)
+{
+    g_hw_reg_trace_on = (uint8_t)((0U != enable) ? 1U : 0U);
+}
+
+/*------------------------------------------------------------------------------
+ * See hw_reg_trace.h.
+ */
+void hw_reg_trace_start(void)
+{
+    uint64_t psr = read_csr(mstatus);
+    hw_reg_trace_t * trace;
+
+    __disable_irq();
+
+    trace = &g_hw_reg_trace[read_csr(mhartid)];
+    trace->next = 0U;
+    trace->used = 0U;
+    trace->reads = 0U;
+    trace->writes = 0U;
+    trace->start_cycle = read_csr(mcycle);
+
+    write_csr(mstatus, psr);
+}
+
+/*------------------------------------------------------------------------------
+ * See hw_reg_trace.h.
+ */
+void hw_reg_trace_stop(hw_reg_trace_summary_t * summary)
+{
+    uint64_t cycle = read_csr(mcycle);
+    uint64_t psr = read_csr(mstatus);
+    hw_reg_trace_t * trace;
+
+    __disable_irq();
+
+    trace = &g_hw_reg_trace[read_csr(mhartid)];
+    summary->reads = trace->reads;
+    summary->writes = trace->writes;
+    summary->cycles = cycle - trace->start_cycle;
+
+    write_csr(mstatus, psr);
+}
+
+/*------------------------------------------------------------------------------
+ * See hw_reg_trace.h.
+ */
+uint32_t hw_reg_trace_read
+(
+    uint32_t hart_id,
+    hw_reg_trace_entry_t * entries,
+    uint32_t max
+)
+{
+    hw_reg_trace_t * trace;
+    uint32_t count = 0U;
+    uint32_t idx;
+    uint64_t psr;
+
+    if(hart_id < HW_REG_TRACE_NUM_HARTS)
+    {
+        psr = read_csr(mstatus);
+        __disable_irq();
+
+        trace = &g_hw_reg_trace[hart_id];
+        count = (max < trace->used) ? max : trace->used;
+        idx = (trace->next - count) & (HW_REG_TRACE_DEPTH - 1U);
+
+        for(uint32_t inc = 0U; inc < count; inc++)
+        {
+            entries[inc] = trace->ring[idx];
+            idx = (idx + 1U) & (HW_REG_TRACE_DEPTH - 1U);
+        }
+
+        write_csr(mstatus, psr);
+    }
+
+    return (count);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HW_REG_ACCESS_TRACE */
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright 2019-2020 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+/***************************************************************************//**
+ *
+ * Register access tracing.
+ *
+ * Defining HW_REG_ACCESS_TRACE on the compiler command line selects the inline
+ * register access functions of hw_reg_access.h and records each access they
+ * make, and each access made through the HW_REG_RD() and HW_REG_WR() macros,
+ * in a ring buffer of the hart making it. An entry holds the register
+ * address, the value read or written, the access width and mcycle.
+ *
+ * The cost of a driver operation, in register accesses and cycles, is taken
+ * by calling hw_reg_trace_start() before it and hw_reg_trace_stop() after:
+ *
+ *      hw_reg_trace_summary_t cost;
+ *
+ *      hw_reg_trace_start();
+ *      (void)MSS_MAC_send_pkt(&g_mac0, 0u, buf, len, 0);
+ *      hw_reg_trace_stop(&cost);
+ *
+ * hw_reg_trace_read() then copies out the accesses themselves. The counts
+ * include entries overwritten in the ring. Interrupts taken between start and
+ * stop are counted as well.
+ *
+ * Without HW_REG_ACCESS_TRACE the functions below are not built and the
+ * macros of hw_reg_access.h make the plain accesses.
+ *
+ */
+#ifndef HW_REG_TRACE_H
+#define HW_REG_TRACE_H
+
+#include "cpu_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Entries in the ring buffer of each hart, a power of two. It may be set on the
+ * compiler command line.
+ */
+#ifndef HW_REG_TRACE_DEPTH
+#define HW_REG_TRACE_DEPTH              256U
+#endif
+
+#define HW_REG_TRACE_NUM_HARTS          5U
+
+/*
+ * Op field of an entry: the access width in bytes, HW_REG_TRACE_OP_WRITE for
+ * writes.
+ */
+#define HW_REG_TRACE_OP_SIZE_MASK       0x0000000FU
+#define HW_REG_TRACE_OP_WRITE           0x00000010U
+
+typedef struct
+{
+    uint64_t cycle;
+    addr_t addr;
+    uint32_t value;
+    uint32_t op;
+} hw_reg_trace_entry_t;
+
+typedef struct
+{
+    uint64_t reads;
+    uint64_t writes;
+    uint64_t cycles;
+} hw_reg_trace_summary_t;
+
+/***************************************************************************//**
+ * hw_reg_trace_record() adds an access to the ring buffer of the calling hart.
+ * It is called by the register access functions and macros.
+ */
+void hw_reg_trace_record(addr_t addr, uint32_t value, uint32_t op);
+
+/***************************************************************************//**
+ * hw_reg_trace_enable() turns recording on, enable non zero, or off on all
+ * harts. Recording is on from reset.
+ */
+void hw_reg_trace_enable(uint8_t enable);
+
+/***************************************************************************//**
+ * hw_reg_trace_start() empties the ring buffer of the calling hart, zeroes its
+ * counts and notes mcycle.
+ */
+void hw_reg_trace_start(void);
+
+/***************************************************************************//**
+ * hw_reg_trace_stop() returns the reads, writes and cycles of the calling hart
+ * since hw_reg_trace_start().
+ */
+void hw_reg_trace_stop(hw_reg_trace_summary_t * summary);
+
+/***************************************************************************//**
+ * hw_reg_trace_read() copies up to max of the latest entries of a hart to
+ * entries, oldest first.
+ *
+ * @return          The number of entries copied.
+ */
+uint32_t hw_reg_trace_read
+(
+    uint32_t hart_id,
+    hw_reg_trace_entry_t * entries,
+    uint32_t max
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HW_REG_TRACE_H */
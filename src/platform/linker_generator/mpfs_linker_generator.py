@@ -0,0 +1,250 @@
+#-------------------------------------------------------------------------------
+# This script takes a placement file which lists named output sections, e.g.
+# .fast_text, .fast_data or .dma_nocache, and the memory region each one goes
+# to, LIM, L2 scratchpad, DTIM, cached or non-cached DDR, and adds them to one
+# of the reference linker scripts, along with the copy and zero tables walked
+# by the startup code when MPFS_HAL_SECTION_TABLE is defined.
+#-------------------------------------------------------------------------------
+
+import json
+import os
+import os.path
+import re
+import sys
+
+
+# --------------------------------------------------------------------------------------------
+# mpfs_linker_generator.py version
+#
+# 0.1.0 first version, load and zero sections, on-chip and DDR tables
+# -------------------------------------------------------------------------------------------------------
+def get_script_ver():
+    '''
+    This changes anytime the mpfs_linker_generator.py script changes.
+    :return: script version
+    '''
+    return "0.1.0"
+
+
+# -----------------------------------------------------------------------------
+# Section kinds
+# load: initialised code or data, copied from the load region by the startup
+#       code
+# zero: uninitialised data, NOLOAD, zeroed by the startup code
+# -----------------------------------------------------------------------------
+section_kinds = ('load', 'zero')
+
+# -----------------------------------------------------------------------------
+# Regions whose name starts with this are only initialised once the DDR is
+# trained, through init_ddr_sections()
+# -----------------------------------------------------------------------------
+ddr_region_prefix = 'ddr'
+
+default_align = 0x10
+
+
+def read_placement_file(file_name):
+    '''
+    Reads the placement file, a json object with a "sections" list, each entry
+    holding "name", "region", "kind" and optionally "align". "load_region"
+    optionally overrides the region the load images are placed in, by default
+    the load region of .text in the template.
+    :param file_name: placement file
+    :return: placement
+    '''
+    with open(file_name, 'r') as f:
+        placement = json.load(f)
+    if 'sections' not in placement:
+        sys.exit('error: no "sections" in ' + file_name)
+    return placement
+
+
+def get_memory_regions(template):
+    '''
+    Returns the names of the regions of the MEMORY command of the template
+    :param template: linker script text
+    :return: list of region names
+    '''
+    memory = re.search(r'^MEMORY\s*\{(.*?)^\}', template, re.MULTILINE | re.DOTALL)
+    if memory is None:
+        sys.exit('error: no MEMORY command in the template')
+    return re.findall(r'^\s*(\w+)\s*\([rwxRWX!]+\)\s*:', memory.group(1), re.MULTILINE)
+
+
+def find_text_section(template):
+    '''
+    Finds the .text output section of the template, the new sections are added
+    after it
+    :param template: linker script text
+    :return: end offset, region and load region of .text
+    '''
+    text = re.search(r'^\s*\.text\s*:.*?^\s*\}\s*>\s*(\w+)(?:\s*AT\s*>\s*(\w+))?[^\n]*\n',
+                     template, re.MULTILINE | re.DOTALL)
+    if text is None:
+        sys.exit('error: no .text output section in the template')
+    load_region = text.group(2) if text.group(2) is not None else text.group(1)
+    return text.end(), text.group(1), load_region
+
+
+def symbol_name(section_name):
+    '''
+    .fast_text -> __fast_text
+    '''
+    return '__' + section_name.lstrip('.')
+
+
+def check_sections(sections, regions):
+    '''
+    Checks each section has a valid name, region and kind
+    :param sections: sections of the placement file
+    :param regions: regions of the template
+    '''
+    names = []
+    for s in sections:
+        name = s.get('name', '')
+        if re.match(r'^\.[A-Za-z_][A-Za-z0-9_]*$', name) is None:
+            sys.exit('error: invalid section name "' + name + '"')
+        if name in names:
+            sys.exit('error: section ' + name + ' given twice')
+        names.append(name)
+        if s.get('region') not in regions:
+            sys.exit('error: section ' + name + ': region ' + str(s.get('region')) +
+                     ' is not in the MEMORY command of the template')
+        if s.get('kind') not in section_kinds:
+            sys.exit('error: section ' + name + ': kind must be one of ' + ', '.join(section_kinds))
+
+
+def write_section(s, load_region):
+    '''
+    Returns the output section of one entry of the placement file
+    :param s: section
+    :param load_region: region holding the load images
+    :return: linker script text
+    '''
+    name = s['name']
+    sym = symbol_name(name)
+    align = s.get('align', default_align)
+    if isinstance(align, str):
+        align = int(align, 0)
+    lines = []
+    if s['kind'] == 'zero':
+        lines.append('    ' + name + ' (NOLOAD) : ALIGN(' + hex(align) + ')')
+        lines.append('    {')
+    else:
+        lines.append('    ' + name + ' : ALIGN(' + hex(align) + ')')
+        lines.append('    {')
+        lines.append('        ' + sym + '_load = LOADADDR(' + name + ');')
+    lines.append('        ' + sym + '_start = .;')
+    lines.append('        *(' + name + ' ' + name + '.*)')
+    lines.append('        . = ALIGN(0x8);')
+    lines.append('        ' + sym + '_end = .;')
+    if (s['kind'] == 'zero') or (s['region'] == load_region):
+        lines.append('    } > ' + s['region'])
+    else:
+        lines.append('    } > ' + s['region'] + ' AT > ' + load_region)
+    lines.append('')
+    return lines
+
+
+def write_table(prefix, sections, kind):
+    '''
+    Returns the entries of a copy table, load/start/end, or of a zero table,
+    start/end
+    '''
+    lines = ['        ' + prefix + '_start = .;']
+    for s in sections:
+        if s['kind'] == kind:
+            sym = symbol_name(s['name'])
+            if kind == 'load':
+                lines.append('        QUAD(' + sym + '_load)')
+            lines.append('        QUAD(' + sym + '_start)')
+            lines.append('        QUAD(' + sym + '_end)')
+    lines.append('        ' + prefix + '_end = .;')
+    return lines
+
+
+def generate_sections(placement, placement_name, load_region):
+    '''
+    Returns the section table and the output sections
+    :param placement: placement file content
+    :param placement_name: placement file name, for the comment
+    :param load_region: region holding the load images
+    :return: linker script text
+    '''
+    sections = placement['sections']
+    on_chip = [s for s in sections if not s['region'].startswith(ddr_region_prefix)]
+    ddr = [s for s in sections if s['region'].startswith(ddr_region_prefix)]
+    lines = ['',
+             '    /*',
+             '     * Sections placed by mpfs_linker_generator.py ' + get_script_ver() +
+             ' from ' + placement_name + '.',
+             '     * Put code or data in one of them with',
+             '     * __attribute__((section(".name"))). The tables below are walked by',
+             '     * init_memory() and init_ddr_sections() when MPFS_HAL_SECTION_TABLE',
+             '     * is defined in mss_sw_config.h.',
+             '     */',
+             '    .section_table : ALIGN(0x10)',
+             '    {']
+    lines += write_table('__section_copy_table', on_chip, 'load')
+    lines += write_table('__section_zero_table', on_chip, 'zero')
+    lines += write_table('__ddr_section_copy_table', ddr, 'load')
+    lines += write_table('__ddr_section_zero_table', ddr, 'zero')
+    lines.append('    } > ' + load_region)
+    lines.append('')
+    for s in sections:
+        lines += write_section(s, load_region)
+    return '\n'.join(lines)
+
+
+def show_help():
+    print ('no of args you entered = ' + str(len(sys.argv) - 1))
+    print ('mpfs_linker_generator.py version ' + get_script_ver())
+    print ('usage: python mpfs_linker_generator.py <placement.json> <template.ld> <output.ld>')
+    print ('  placement.json: sections and the region each one is placed in,')
+    print ('                  see mpfs_placement_example.json')
+    print ('  template.ld:    one of platform_config_reference/linker/*.ld')
+    print ('  output.ld:      generated linker script')
+
+
+def main_linker_generator():
+    '''
+    Three command line arguments
+    arg0: placement file
+    arg1: template linker script
+    arg2: linker script generated
+    '''
+    nb_arguments = len(sys.argv) - 1
+    if nb_arguments < 3:
+        show_help()
+        sys.exit()
+    placement_file = sys.argv[1]
+    template_file = sys.argv[2]
+    output_file = sys.argv[3]
+
+    placement = read_placement_file(placement_file)
+    with open(template_file, 'r', newline='') as f:
+        template = f.read()
+    crlf = '\r\n' in template
+    template = template.replace('\r\n', '\n')
+
+    regions = get_memory_regions(template)
+    text_end, text_region, load_region = find_text_section(template)
+    if 'load_region' in placement:
+        load_region = placement['load_region']
+        if load_region not in regions:
+            sys.exit('error: load region ' + load_region +
+                     ' is not in the MEMORY command of the template')
+    check_sections(placement['sections'], regions)
+
+    generated = generate_sections(placement, os.path.basename(placement_file), load_region)
+    output = template[:text_end] + generated + template[text_end:]
+    if crlf:
+        output = output.replace('\n', '\r\n')
+    with open(output_file, 'w', newline='') as f:
+        f.write(output)
+    print ('Linker script ' + output_file + ' generated from ' + template_file +
+           ', load region ' + load_region)
+
+
+if __name__ == "__main__":
+    main_linker_generator()
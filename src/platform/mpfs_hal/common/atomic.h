@@ -36,13 +36,18 @@
 extern "C" {
 #endif
 
+#if defined(MPFS_HAL_HOST_MODEL)
+#define mb() __sync_synchronize()
+#else
 #define mb() asm volatile ("fence" ::: "memory")
+#endif
 #define atomic_set(ptr, val) (*(volatile typeof(*(ptr)) *)(ptr) = val)
 #define atomic_read(ptr) (*(volatile typeof(*(ptr)) *)(ptr))
 
-#ifdef __riscv_atomic
+#if defined(__riscv_atomic) || defined(MPFS_HAL_HOST_MODEL)
 # define atomic_swap(ptr, swp) __sync_lock_test_and_set(ptr, swp)
 # define atomic_or(ptr, inc) __sync_fetch_and_or(ptr, inc)
+# define atomic_cas(ptr, cmp, swp) __sync_bool_compare_and_swap(ptr, cmp, swp)
 #else
 #define atomic_binop(ptr, inc, op) ({ \
   long flags = disable_irqsave(); \
@@ -52,6 +57,12 @@ extern "C" {
   res; })
 #define atomic_or(ptr, inc) atomic_binop(ptr, inc, res | (inc))
 #define atomic_swap(ptr, swp) atomic_binop(ptr, swp, (swp))
+#define atomic_cas(ptr, cmp, swp) ({ \
+  long flags = disable_irqsave(); \
+  int res = (atomic_read(ptr) == (cmp)); \
+  if (res) atomic_set(ptr, swp); \
+  enable_irqrestore(flags); \
+  res; })
 #endif
 
 #ifdef __cplusplus
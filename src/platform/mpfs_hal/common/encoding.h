@@ -276,6 +276,22 @@
 
 #endif
 
+#elif defined(MPFS_HAL_HOST_MODEL)
+
+/* Host native build against the register model, see mss_host.h */
+# define MSTATUS_SD             MSTATUS64_SD
+# define SSTATUS_SD             SSTATUS64_SD
+# define RISCV_PGLEVEL_BITS     9
+# define SPTBR_MODE             SPTBR64_MODE
+# define MCAUSE_INT             MCAUSE64_INT
+# define MCAUSE_CAUSE           MCAUSE64_CAUSE
+#define RISCV_PGSHIFT 12
+#define RISCV_PGSIZE (1 << RISCV_PGSHIFT)
+
+#ifndef __ASSEMBLER__
+#include "mpfs_hal/host/mss_host.h"
+#endif
+
 #endif
 
 #endif
@@ -20,6 +20,14 @@ extern "C" {
 #if defined ( __GNUC__ )
 #if defined(NDEBUG)
 #define ASSERT(CHECK)
+#elif defined(MPFS_HAL_HOST_MODEL)
+#define ASSERT(CHECK)\
+    do { \
+        if (!(CHECK)) \
+        { \
+            __builtin_trap(); \
+        }\
+    } while(0);
 #else
 #define ASSERT(CHECK)\
     do { \
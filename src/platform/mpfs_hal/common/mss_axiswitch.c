@@ -21,6 +21,20 @@
 extern "C" {
 #endif
 
+static const mss_axisw_qos_profile_t axisw_profiles[MSS_AXISW_NUM_PROFILES] =
+{
+    /* MSS_AXISW_PROFILE_DEFAULT */
+    { 0U, MSS_AXISW_TXNRATE_DISABLE, MSS_AXISW_TXNRATE_DISABLE, 1U, 0U },
+    /* MSS_AXISW_PROFILE_REALTIME */
+    { 15U, MSS_AXISW_TXNRATE_DISABLE, MSS_AXISW_TXNRATE_DISABLE, 1U, 0U },
+    /* MSS_AXISW_PROFILE_BULK_DMA */
+    { 0U, MSS_AXISW_TXNRATE_BY2, MSS_AXISW_TXNRATE_BY8, 16U, 1U },
+    /* MSS_AXISW_PROFILE_FABRIC */
+    { 4U, MSS_AXISW_TXNRATE_BY2, MSS_AXISW_TXNRATE_BY4, 32U, 1U },
+};
+
+static uint32_t axisw_regulator_set_rate(mss_axisw_regulator_t * regulator);
+
 /*Returns the value of AXI_HW_CFG_REG register*/
 uint32_t MSS_AXISW_get_hwcfg(void)
 {
@@ -259,6 +273,163 @@ uint32_t MSS_AXISW_read_slave_ready(mss_axisw_mport_t master_port_num,
     return ((AXISW->CMD & AXISW_CMD_ERR_MASK) >> AXISW_CMD_ERR);   /*return error bit value*/
 }
 
+/* Returns one of the predefined QoS profiles, or NULL for an invalid id
+
+ MSS_AXISW_PROFILE_DEFAULT:  no regulation, reset values
+ MSS_AXISW_PROFILE_REALTIME: no regulation, highest QoS, for the coreplex ports
+                             of latency sensitive harts
+ MSS_AXISW_PROFILE_BULK_DMA: 1/8 of the transactions, bursts of 16, for DMA
+                             masters such as the GEMs, MMC and USB
+ MSS_AXISW_PROFILE_FABRIC:   1/4 of the transactions, bursts of 32, for the FIC
+                             masters
+*/
+const mss_axisw_qos_profile_t * MSS_AXISW_get_profile(mss_axisw_profile_id_t id)
+{
+    const mss_axisw_qos_profile_t * profile = NULL;
+
+    if (id < MSS_AXISW_NUM_PROFILES)
+    {
+        profile = &axisw_profiles[id];
+    }
+
+    return (profile);
+}
+
+/* Applies a QoS profile to the read and the write channel of a master port
+
+ master_port_num: read or write channel of the master port, both are set up
+ profile: see MSS_AXISW_get_profile(), or a profile defined by the application
+
+ The QoS value is only written when it is not zero, as it can only be
+ programmed when the switch is configured for AXI3.
+
+ return value: MSS_AXISW_QOS_ERR, MSS_AXISW_RATE_ERR and
+ MSS_AXISW_BURSTINESS_ERR bits for the commands which failed, 0 on success
+*/
+uint32_t MSS_AXISW_apply_profile(mss_axisw_mport_t master_port_num,
+                                 const mss_axisw_qos_profile_t * profile)
+{
+    uint32_t error = 0U;
+    uint32_t chan;
+    mss_axisw_mport_t port;
+
+    for (chan = 0U; chan < 2U; chan++)
+    {
+        port = (mss_axisw_mport_t)(((uint32_t)master_port_num & ~0x01U) | chan);
+
+        if (profile->qos != 0U)
+        {
+            if (MSS_AXISW_write_qos_val(port, profile->qos) != 0U)
+            {
+                error |= MSS_AXISW_QOS_ERR;
+            }
+        }
+        if (MSS_AXISW_write_rate(port, profile->peak_rate, profile->xct_rate) != 0U)
+        {
+            error |= MSS_AXISW_RATE_ERR;
+        }
+        if (MSS_AXISW_write_burstiness(port, profile->burstiness,\
+                profile->regulator_en) != 0)
+        {
+            error |= MSS_AXISW_BURSTINESS_ERR;
+        }
+    }
+
+    return (error);
+}
+
+/* Sets the ports of a regulator to its maximum transaction rate
+
+ Call before the first MSS_AXISW_regulator_update(). The burstiness regulator
+ of the ports must have been enabled, e.g. by applying a profile with
+ regulator_en set, for the rates to take effect.
+
+ return value: As received form AXI_ERR_BIT in CMD register.
+*/
+uint32_t MSS_AXISW_regulator_init(mss_axisw_regulator_t * regulator)
+{
+    regulator->xct_rate = regulator->max_rate;
+    regulator->latency = 0U;
+    regulator->adjustments = 0U;
+
+    return (axisw_regulator_set_rate(regulator));
+}
+
+/* Measures the latency of the probe reads and adjusts the transaction rate
+ of the regulator ports
+
+ Call periodically, e.g. from the SysTick handler of a hart. The latency is
+ filtered over the last few calls. When it is above high_latency, the
+ transaction rate of the ports is halved, down to min_rate, so that masters
+ flooding the DDR leave bandwidth for the harts. When it is below low_latency,
+ the rate is doubled, up to max_rate.
+
+ return value: As received form AXI_ERR_BIT in CMD register.
+*/
+uint32_t MSS_AXISW_regulator_update(mss_axisw_regulator_t * regulator)
+{
+    uint64_t start;
+    uint32_t sample;
+    uint32_t sum = 0U;
+    uint32_t read;
+    uint32_t error = 0U;
+    uint32_t rate = (uint32_t)regulator->xct_rate;
+
+    start = readmcycle();
+    for (read = 0U; read < MSS_AXISW_PROBE_READS; read++)
+    {
+        /* each read is used before the next is issued */
+        sum += *regulator->probe;
+    }
+    sample = (uint32_t)((readmcycle() - start) / MSS_AXISW_PROBE_READS);
+
+    if (regulator->latency == 0U)
+    {
+        regulator->latency = sample;
+    }
+    else
+    {
+        regulator->latency = ((regulator->latency * 3U) + sample) / 4U;
+    }
+
+    if ((regulator->latency > regulator->high_latency) &&\
+            (rate > (uint32_t)regulator->min_rate))
+    {
+        regulator->xct_rate = (mss_axisw_rate_t)(rate >> 1U);
+        regulator->adjustments++;
+        error = axisw_regulator_set_rate(regulator);
+    }
+    else if ((regulator->latency < regulator->low_latency) &&\
+            (rate < (uint32_t)regulator->max_rate))
+    {
+        regulator->xct_rate = (mss_axisw_rate_t)(rate << 1U);
+        regulator->adjustments++;
+        error = axisw_regulator_set_rate(regulator);
+    }
+    else
+    {
+        /* latency within range, or rate at its limit */
+    }
+    (void)sum;
+
+    return (error);
+}
+
+/*Writes the transaction rate in use to all the regulator ports*/
+static uint32_t axisw_regulator_set_rate(mss_axisw_regulator_t * regulator)
+{
+    uint32_t error = 0U;
+    uint32_t port;
+
+    for (port = 0U; port < regulator->num_ports; port++)
+    {
+        error |= MSS_AXISW_write_rate(regulator->ports[port],\
+                regulator->peak_rate, regulator->xct_rate);
+    }
+
+    return (error);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -151,6 +151,79 @@ typedef struct
 
 #define AXISW                               ((AXISW_TypeDef*)0x20004000UL)
 
+/***************************************************************************//**
+  QoS profile applied to both channels of a master port by
+  MSS_AXISW_apply_profile().
+  qos: QoS value, only programmable when the switch is configured for AXI3
+  peak_rate, xct_rate: see mss_axisw_rate_t, MSS_AXISW_TXNRATE_DISABLE for no
+  regulation
+  burstiness: number of transactions which may be issued back to back when the
+  regulator is enabled, 1 to 256
+  regulator_en: 1 to enable the regulator
+ */
+typedef struct {
+    uint32_t            qos;
+    mss_axisw_rate_t    peak_rate;
+    mss_axisw_rate_t    xct_rate;
+    uint32_t            burstiness;
+    uint32_t            regulator_en;
+} mss_axisw_qos_profile_t;
+
+/***************************************************************************//**
+  Predefined QoS profiles, see MSS_AXISW_get_profile()
+ */
+typedef enum {
+    MSS_AXISW_PROFILE_DEFAULT   = 0x00,     /*!< not regulated, QoS 0      */
+    MSS_AXISW_PROFILE_REALTIME,             /*!< not regulated, QoS 15     */
+    MSS_AXISW_PROFILE_BULK_DMA,             /*!< 1/8 of the transactions,
+                                                 QoS 0                      */
+    MSS_AXISW_PROFILE_FABRIC,               /*!< 1/4 of the transactions,
+                                                 QoS 4                      */
+    MSS_AXISW_NUM_PROFILES
+} mss_axisw_profile_id_t;
+
+/*
+ * Error bits returned by MSS_AXISW_apply_profile()
+ */
+#define MSS_AXISW_QOS_ERR                   (0x01U)
+#define MSS_AXISW_RATE_ERR                  (0x02U)
+#define MSS_AXISW_BURSTINESS_ERR            (0x04U)
+
+/***************************************************************************//**
+  Runtime regulator, see MSS_AXISW_regulator_update().
+  The caller sets the fields up to peak_rate before calling
+  MSS_AXISW_regulator_init().
+  ports: channels throttled when the latency is high, e.g. the FIC read and
+  write channels
+  probe: memory read to measure the latency, normally non-cached DDR. It must
+  not be in a cached region, or the cache is measured.
+  high_latency, low_latency: mcycle ticks per probe read above which the
+  transaction rate of the ports is halved, and below which it is doubled
+  min_rate, max_rate: range of transaction rates used, not
+  MSS_AXISW_TXNRATE_DISABLE
+  peak_rate: peak rate written with each transaction rate
+ */
+typedef struct {
+    const mss_axisw_mport_t *   ports;
+    uint32_t                    num_ports;
+    const volatile uint32_t *   probe;
+    uint32_t                    high_latency;
+    uint32_t                    low_latency;
+    mss_axisw_rate_t            min_rate;
+    mss_axisw_rate_t            max_rate;
+    mss_axisw_rate_t            peak_rate;
+    mss_axisw_rate_t            xct_rate;       /* rate in use */
+    uint32_t                    latency;        /* filtered latency */
+    uint32_t                    adjustments;
+} mss_axisw_regulator_t;
+
+/*
+ * Number of probe reads made by each MSS_AXISW_regulator_update()
+ */
+#if !defined (MSS_AXISW_PROBE_READS)
+#define MSS_AXISW_PROBE_READS               8U
+#endif
+
 
 uint32_t MSS_AXISW_get_hwcfg(void);
 uint32_t MSS_AXISW_get_vid(void);
@@ -173,6 +246,11 @@ uint32_t MSS_AXISW_write_slave_ready(mss_axisw_mport_t master_port_num,
                                                    uint8_t slave_ready_en);
 uint32_t MSS_AXISW_read_slave_ready(mss_axisw_mport_t master_port_num,
                                                   uint8_t* slave_ready_en);
+const mss_axisw_qos_profile_t * MSS_AXISW_get_profile(mss_axisw_profile_id_t id);
+uint32_t MSS_AXISW_apply_profile(mss_axisw_mport_t master_port_num,
+                                 const mss_axisw_qos_profile_t * profile);
+uint32_t MSS_AXISW_regulator_init(mss_axisw_regulator_t * regulator);
+uint32_t MSS_AXISW_regulator_update(mss_axisw_regulator_t * regulator);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_bench.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Microbenchmark harness
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Back to back reads of mcycle made to measure the cost of reading it */
+#define BENCH_OVERHEAD_READS            16U
+
+/*******************************************************************************
+ * Local functions
+ */
+static uint64_t bench_overhead(void);
+static void bench_sort(uint64_t * samples, uint32_t count);
+static uint64_t bench_percentile(const uint64_t * samples, uint32_t count,
+        uint32_t percent);
+
+/***************************************************************************//**
+ * See mss_bench.h
+ */
+uint8_t mss_bench_run(const mss_bench_cfg_t * cfg, uint64_t * samples,
+        mss_bench_result_t * result)
+{
+    uint8_t ret_val = ERROR;
+    uint64_t psr;
+    uint64_t overhead;
+    uint64_t start;
+    uint64_t cycles;
+    uint64_t total = 0U;
+    uint64_t mtime_start;
+    uint32_t inc;
+
+    if((read_csr(mhartid) == cfg->hart_id) && (0U != cfg->iterations))
+    {
+        psr = disable_interrupts();
+        overhead = bench_overhead();
+
+        for(inc = 0U; inc < cfg->warmup; inc++)
+        {
+            if(0 != cfg->setup)
+            {
+                cfg->setup(cfg->arg);
+            }
+
+            cfg->fn(cfg->arg);
+        }
+
+        mtime_start = readmtime();
+
+        for(inc = 0U; inc < cfg->iterations; inc++)
+        {
+            if(0 != cfg->setup)
+            {
+                cfg->setup(cfg->arg);
+            }
+
+            if(0U != cfg->flush_length)
+            {
+                mss_l2_flush_range(cfg->flush_start, cfg->flush_length);
+            }
+
+            mb();
+            start = readmcycle();
+            cfg->fn(cfg->arg);
+            cycles = readmcycle() - start;
+
+            samples[inc] = (cycles > overhead) ? (cycles - overhead) : 0U;
+        }
+
+        result->mtime_ticks = readmtime() - mtime_start;
+        restore_interrupts(psr);
+
+        for(inc = 0U; inc < cfg->iterations; inc++)
+        {
+            total += samples[inc];
+        }
+
+        bench_sort(samples, cfg->iterations);
+
+        result->count = cfg->iterations;
+        result->min = samples[0];
+        result->max = samples[cfg->iterations - 1U];
+        result->mean = total / cfg->iterations;
+        result->p50 = bench_percentile(samples, cfg->iterations, 50U);
+        result->p90 = bench_percentile(samples, cfg->iterations, 90U);
+        result->p99 = bench_percentile(samples, cfg->iterations, 99U);
+        result->overhead = overhead;
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_bench.h
+ */
+uint8_t mss_bench_post(mss_bench_req_t * req, const mss_bench_cfg_t * cfg,
+        uint64_t * samples, mss_bench_result_t * result)
+{
+    uint8_t ret_val = ERROR;
+
+    if(MSS_BENCH_REQ_IDLE == __atomic_load_n(&req->state, __ATOMIC_ACQUIRE))
+    {
+        req->cfg = cfg;
+        req->samples = samples;
+        req->result = result;
+        req->status = ERROR;
+        /* Publish the request before marking it posted */
+        __atomic_store_n(&req->state, MSS_BENCH_REQ_POSTED, __ATOMIC_RELEASE);
+        raise_soft_interrupt((unsigned long)cfg->hart_id);
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_bench.h
+ */
+uint8_t mss_bench_service(mss_bench_req_t * req)
+{
+    uint8_t ret_val = ERROR;
+
+    if((MSS_BENCH_REQ_POSTED == __atomic_load_n(&req->state, __ATOMIC_ACQUIRE))
+            && (read_csr(mhartid) == req->cfg->hart_id))
+    {
+        req->status = mss_bench_run(req->cfg, req->samples, req->result);
+        /* Publish the results before marking the request done */
+        __atomic_store_n(&req->state, MSS_BENCH_REQ_DONE, __ATOMIC_RELEASE);
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_bench.h
+ */
+uint8_t mss_bench_done(mss_bench_req_t * req)
+{
+    uint8_t done = 0U;
+
+    if(MSS_BENCH_REQ_DONE == __atomic_load_n(&req->state, __ATOMIC_ACQUIRE))
+    {
+        __atomic_store_n(&req->state, MSS_BENCH_REQ_IDLE, __ATOMIC_RELAXED);
+        done = 1U;
+    }
+
+    return (done);
+}
+
+/***************************************************************************//**
+ * See mss_bench.h
+ */
+void mss_bench_report(mss_uart_instance_t * uart, const mss_bench_cfg_t * cfg,
+        const mss_bench_result_t * result)
+{
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)"\n\rBenchmark ");
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)cfg->name);
+    mss_print_dec(uart, " on hart ", cfg->hart_id);
+    mss_print_dec(uart, "\n\r samples   ", result->count);
+    mss_print_dec(uart, "\n\r min       ", result->min);
+    mss_print_dec(uart, "\n\r p50       ", result->p50);
+    mss_print_dec(uart, "\n\r p90       ", result->p90);
+    mss_print_dec(uart, "\n\r p99       ", result->p99);
+    mss_print_dec(uart, "\n\r max       ", result->max);
+    mss_print_dec(uart, "\n\r mean      ", result->mean);
+    mss_print_dec(uart, "\n\r overhead  ", result->overhead);
+    mss_print_dec(uart, "\n\r mtime     ", result->mtime_ticks);
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)"\n\r");
+}
+
+/***************************************************************************//**
+ * See mss_bench.h
+ */
+void mss_bench_report_csv_header(mss_uart_instance_t * uart)
+{
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)"name,hart,samples,min,"\
+            "p50,p90,p99,max,mean,overhead,mtime\n\r");
+}
+
+/***************************************************************************//**
+ * See mss_bench.h
+ */
+void mss_bench_report_csv(mss_uart_instance_t * uart,
+        const mss_bench_cfg_t * cfg, const mss_bench_result_t * result)
+{
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)cfg->name);
+    mss_print_dec(uart, ",", cfg->hart_id);
+    mss_print_dec(uart, ",", result->count);
+    mss_print_dec(uart, ",", result->min);
+    mss_print_dec(uart, ",", result->p50);
+    mss_print_dec(uart, ",", result->p90);
+    mss_print_dec(uart, ",", result->p99);
+    mss_print_dec(uart, ",", result->max);
+    mss_print_dec(uart, ",", result->mean);
+    mss_print_dec(uart, ",", result->overhead);
+    mss_print_dec(uart, ",", result->mtime_ticks);
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)"\n\r");
+}
+
+/***************************************************************************//**
+ * Returns the fewest cycles seen between two back to back reads of mcycle.
+ */
+static uint64_t bench_overhead(void)
+{
+    uint64_t least = ~0ULL;
+    uint64_t start;
+    uint64_t cycles;
+    uint32_t inc;
+
+    for(inc = 0U; inc < BENCH_OVERHEAD_READS; inc++)
+    {
+        start = readmcycle();
+        cycles = readmcycle() - start;
+
+        if(cycles < least)
+        {
+            least = cycles;
+        }
+    }
+
+    return (least);
+}
+
+/***************************************************************************//**
+ * Sorts the samples in place, in ascending order. A Shell sort, as the number
+ * of samples may be too large for an insertion sort and it needs no memory.
+ */
+static void bench_sort(uint64_t * samples, uint32_t count)
+{
+    uint32_t gap;
+    uint32_t inc;
+    uint32_t pos;
+    uint64_t sample;
+
+    for(gap = count / 2U; gap > 0U; gap /= 2U)
+    {
+        for(inc = gap; inc < count; inc++)
+        {
+            sample = samples[inc];
+
+            for(pos = inc; (pos >= gap) && (samples[pos - gap] > sample);
+                    pos -= gap)
+            {
+                samples[pos] = samples[pos - gap];
+            }
+
+            samples[pos] = sample;
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Returns the percentile of the sorted samples, by nearest rank.
+ */
+static uint64_t bench_percentile(const uint64_t * samples, uint32_t count,
+        uint32_t percent)
+{
+    uint64_t rank = (((uint64_t)count * percent) + 99U) / 100U;
+
+    if(0U == rank)
+    {
+        rank = 1U;
+    }
+
+    return (samples[rank - 1U]);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_bench.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Microbenchmark harness
+ *
+ * The harness times a function, called once per iteration, in mcycle cycles.
+ * It is shared by the benchmarks of the drivers so they measure and report in
+ * the same way.
+ *
+ * A run calls the function a number of times untimed to warm up the caches and
+ * branch predictors, then a number of times timed, storing the cycles taken by
+ * each call in a buffer provided by the caller. The cost of reading mcycle is
+ * measured first and taken off each sample. An optional setup function is
+ * called, untimed, before each call, e.g. to re-arm a DMA descriptor, and an
+ * optional address range is flushed from the L2 cache before each call, so
+ * each call starts with the data in memory rather than in the cache.
+ *
+ * The run is pinned to the hart given in the configuration, with interrupts
+ * masked for the whole run. mss_bench_run() returns ERROR if called on another
+ * hart. To run on another hart, mss_bench_post() hands the run to that hart
+ * and raises its software interrupt, and the hart runs it when it calls
+ * mss_bench_service(), e.g. from its main loop or Software_hN_IRQHandler().
+ * As interrupts are masked, the function benchmarked must poll the hardware
+ * rather than wait for an interrupt, e.g. with the polled driver functions.
+ *
+ * On return the samples are sorted and the result holds the minimum, maximum,
+ * mean and 50th, 90th and 99th percentiles, by nearest rank, together with the
+ * mtime ticks the whole run took. mss_bench_report() prints the result to a
+ * UART and mss_bench_report_csv() prints it as one line of comma separated
+ * values, after the column names from mss_bench_report_csv_header().
+ *
+ * Example, timing a 4KB copy from cold DDR on U54_1:
+ * @code
+ *   static void copy_4k(void * arg)
+ *   {
+ *       (void)memcpy(dst, src, 4096U);
+ *   }
+ *
+ *   static uint64_t samples[100];
+ *   mss_bench_cfg_t cfg = {
+ *       "memcpy_4k", copy_4k, 0, 0, 10U, 100U, (uint64_t)src, 4096U, 1U
+ *   };
+ *   mss_bench_result_t result;
+ *
+ *   if(SUCCESS == mss_bench_run(&cfg, samples, &result))
+ *   {
+ *       mss_bench_report_csv_header(&g_mss_uart0_lo);
+ *       mss_bench_report_csv(&g_mss_uart0_lo, &cfg, &result);
+ *   }
+ * @endcode
+ */
+#ifndef MSS_BENCH_H
+#define MSS_BENCH_H
+
+#include <stdint.h>
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The function benchmarked, and the optional setup function called untimed
+ * before it.
+ */
+typedef void (*mss_bench_fn_t)(void * arg);
+
+typedef struct
+{
+    const char * name;          /* Name used when reporting */
+    mss_bench_fn_t fn;          /* Function timed, called once per iteration */
+    mss_bench_fn_t setup;       /* Called untimed before each call, or 0 */
+    void * arg;                 /* Passed to fn and setup */
+    uint32_t warmup;            /* Untimed calls before the timed ones */
+    uint32_t iterations;        /* Timed calls, one sample each */
+    uint64_t flush_start;       /* Range flushed from the L2 before each */
+    uint64_t flush_length;      /* call, none if the length is 0 */
+    uint32_t hart_id;           /* Hart the run is pinned to */
+} mss_bench_cfg_t;
+
+typedef struct
+{
+    uint32_t count;             /* Number of samples */
+    uint64_t min;               /* Cycles per call */
+    uint64_t max;
+    uint64_t mean;
+    uint64_t p50;
+    uint64_t p90;
+    uint64_t p99;
+    uint64_t overhead;          /* Cycles taken off each sample */
+    uint64_t mtime_ticks;       /* mtime ticks taken by the whole run */
+} mss_bench_result_t;
+
+/*
+ * A run handed to another hart with mss_bench_post().
+ */
+#define MSS_BENCH_REQ_IDLE      0U
+#define MSS_BENCH_REQ_POSTED    1U
+#define MSS_BENCH_REQ_DONE      2U
+
+typedef struct
+{
+    const mss_bench_cfg_t * cfg;
+    uint64_t * samples;
+    mss_bench_result_t * result;
+    uint8_t status;
+    volatile uint32_t state;
+} mss_bench_req_t;
+
+/***************************************************************************//**
+ * mss_bench_run() runs a benchmark on the calling hart with interrupts masked.
+ * samples must hold cfg->iterations entries, and is returned sorted.
+ *
+ * @return
+ *   SUCCESS, or ERROR if called on a hart other than cfg->hart_id or
+ *   cfg->iterations is 0, in which case nothing is run.
+ */
+uint8_t mss_bench_run(const mss_bench_cfg_t * cfg, uint64_t * samples,
+        mss_bench_result_t * result);
+
+/***************************************************************************//**
+ * mss_bench_post() hands a run to the hart cfg->hart_id and raises its
+ * software interrupt. The request, configuration, samples and result must be
+ * in memory both harts can access. mss_bench_done() returns non zero once the
+ * run is complete, when req->status holds the value mss_bench_run() returned.
+ *
+ * @return
+ *   SUCCESS, or ERROR if the request is already posted.
+ */
+uint8_t mss_bench_post(mss_bench_req_t * req, const mss_bench_cfg_t * cfg,
+        uint64_t * samples, mss_bench_result_t * result);
+
+/***************************************************************************//**
+ * mss_bench_service() runs a request posted to the calling hart, if any. It
+ * does not clear the software interrupt, which the caller does if needed.
+ *
+ * @return
+ *   SUCCESS if a run was made, ERROR if there was none for this hart.
+ */
+uint8_t mss_bench_service(mss_bench_req_t * req);
+
+/***************************************************************************//**
+ * mss_bench_done() returns non zero once a posted run has completed, and makes
+ * the request available to post again.
+ */
+uint8_t mss_bench_done(mss_bench_req_t * req);
+
+/***************************************************************************//**
+ * mss_bench_report() prints the result of a run to the UART, one value per
+ * line, in decimal.
+ */
+void mss_bench_report(mss_uart_instance_t * uart, const mss_bench_cfg_t * cfg,
+        const mss_bench_result_t * result);
+
+/***************************************************************************//**
+ * mss_bench_report_csv_header() prints the names of the columns printed by
+ * mss_bench_report_csv().
+ */
+void mss_bench_report_csv_header(mss_uart_instance_t * uart);
+
+/***************************************************************************//**
+ * mss_bench_report_csv() prints the result of a run to the UART as one line
+ * of comma separated decimal values: name, hart, samples, min, p50, p90, p99,
+ * max, mean, overhead and mtime ticks.
+ */
+void mss_bench_report_csv(mss_uart_instance_t * uart,
+        const mss_bench_cfg_t * cfg, const mss_bench_result_t * result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_BENCH_H */
@@ -0,0 +1,442 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_checksum.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief CRC and checksum library shared by the drivers and applications
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CRC32_POLY              0xEDB88320UL
+#define CRC16_CCITT_POLY        0x1021U
+#define CRC_SLICES              8U
+#define CRC_TABLE_SIZE          256U
+
+#define ADLER32_MOD             65521UL
+/* Most bytes summed before b can overflow 32 bits */
+#define ADLER32_NMAX            5552U
+
+#define CHECKSUM_WORD_BYTES     8U
+#define CHECKSUM_WORD_MASK      (CHECKSUM_WORD_BYTES - 1U)
+
+typedef struct
+{
+    const void * data;
+    uint64_t length;
+    volatile uint64_t result;
+} checksum_bench_arg_t;
+
+/*******************************************************************************
+ * Local functions
+ */
+static void checksum_tables_init(void);
+static inline uint64_t inet_fold16(uint64_t sum);
+#if !defined(MPFS_HAL_HOST_MODEL)
+static void bench_crc32(void * arg);
+static void bench_crc16_ccitt(void * arg);
+static void bench_adler32(void * arg);
+static void bench_inet(void * arg);
+#endif
+
+/*******************************************************************************
+ * Local data
+ */
+static uint32_t g_crc32_table[CRC_SLICES][CRC_TABLE_SIZE];
+static uint16_t g_crc16_table[CRC_TABLE_SIZE];
+static uint32_t g_tables_ready = 0U;
+static const mss_checksum_offload_t * volatile g_offload = 0;
+
+/***************************************************************************//**
+ * See mss_checksum.h for details of how to use this function.
+ */
+uint32_t mss_crc32(uint32_t crc, const void * data, uint64_t length)
+{
+    const mss_checksum_offload_t * offload = g_offload;
+    const uint8_t * p = (const uint8_t *)data;
+    uint64_t word;
+    uint32_t lo;
+    uint32_t hi;
+
+    if((0 != offload) && (0 != offload->crc32) &&
+        (length >= offload->min_length))
+    {
+        crc = offload->crc32(crc, data, length);
+    }
+    else
+    {
+        if(0U == __atomic_load_n(&g_tables_ready, __ATOMIC_ACQUIRE))
+        {
+            checksum_tables_init();
+        }
+
+        crc = ~crc;
+
+        while((0U != length) && (0U != ((uintptr_t)p & CHECKSUM_WORD_MASK)))
+        {
+            crc = g_crc32_table[0][(crc ^ *p) & 0xFFU] ^ (crc >> 8U);
+            p++;
+            length--;
+        }
+
+        /*
+         * The low word of each double word, its first four bytes, is folded
+         * into the CRC, then the eight bytes are reduced together. Table N
+         * gives the effect of a byte followed by N zero bytes.
+         */
+        while(length >= CHECKSUM_WORD_BYTES)
+        {
+            word = *(const uint64_t *)(const void *)p;
+            lo = crc ^ (uint32_t)word;
+            hi = (uint32_t)(word >> 32U);
+
+            crc = g_crc32_table[7][lo & 0xFFU] ^
+                  g_crc32_table[6][(lo >> 8U) & 0xFFU] ^
+                  g_crc32_table[5][(lo >> 16U) & 0xFFU] ^
+                  g_crc32_table[4][lo >> 24U] ^
+                  g_crc32_table[3][hi & 0xFFU] ^
+                  g_crc32_table[2][(hi >> 8U) & 0xFFU] ^
+                  g_crc32_table[1][(hi >> 16U) & 0xFFU] ^
+                  g_crc32_table[0][hi >> 24U];
+
+            p += CHECKSUM_WORD_BYTES;
+            length -= CHECKSUM_WORD_BYTES;
+        }
+
+        while(0U != length)
+        {
+            crc = g_crc32_table[0][(crc ^ *p) & 0xFFU] ^ (crc >> 8U);
+            p++;
+            length--;
+        }
+
+        crc = ~crc;
+    }
+
+    return (crc);
+}
+
+/***************************************************************************//**
+ * See mss_checksum.h for details of how to use this function.
+ */
+uint16_t mss_crc16_ccitt(uint16_t crc, const void * data, uint64_t length)
+{
+    const mss_checksum_offload_t * offload = g_offload;
+    const uint8_t * p = (const uint8_t *)data;
+
+    if((0 != offload) && (0 != offload->crc16_ccitt) &&
+        (length >= offload->min_length))
+    {
+        crc = offload->crc16_ccitt(crc, data, length);
+    }
+    else
+    {
+        if(0U == __atomic_load_n(&g_tables_ready, __ATOMIC_ACQUIRE))
+        {
+            checksum_tables_init();
+        }
+
+        while(0U != length)
+        {
+            crc = (uint16_t)((uint16_t)(crc << 8U) ^
+                    g_crc16_table[((crc >> 8U) ^ *p) & 0xFFU]);
+            p++;
+            length--;
+        }
+    }
+
+    return (crc);
+}
+
+/***************************************************************************//**
+ * See mss_checksum.h for details of how to use this function.
+ */
+uint32_t mss_adler32(uint32_t adler, const void * data, uint64_t length)
+{
+    const uint8_t * p = (const uint8_t *)data;
+    uint32_t a = adler & 0xFFFFU;
+    uint32_t b = adler >> 16U;
+    uint32_t run;
+
+    while(0U != length)
+    {
+        run = (length < ADLER32_NMAX) ? (uint32_t)length : ADLER32_NMAX;
+        length -= run;
+
+        while(0U != run)
+        {
+            a += *p;
+            b += a;
+            p++;
+            run--;
+        }
+
+        a %= ADLER32_MOD;
+        b %= ADLER32_MOD;
+    }
+
+    return ((b << 16U) | a);
+}
+
+/***************************************************************************//**
+ * See mss_checksum.h for details of how to use this function.
+ *
+ * The 16 bit ones' complement sum does not depend on the byte order of the
+ * words summed, other than being byte swapped with them, so the data is summed
+ * as little endian words and the sum stored as it is. Data starting at an odd
+ * address is summed as if shifted by one byte, which swaps the bytes of its
+ * sum, and the sum is swapped back.
+ */
+uint64_t mss_inet_sum(uint64_t sum, const void * data, uint64_t length)
+{
+    const uint8_t * p = (const uint8_t *)data;
+    uint8_t odd = (uint8_t)((uintptr_t)p & 1U);
+    uint64_t acc = 0U;
+    uint64_t word;
+
+    if((0U != odd) && (0U != length))
+    {
+        acc = (uint64_t)*p << 8U;
+        p++;
+        length--;
+    }
+
+    while((length >= 2U) && (0U != ((uintptr_t)p & CHECKSUM_WORD_MASK)))
+    {
+        acc += *(const uint16_t *)(const void *)p;
+        p += 2U;
+        length -= 2U;
+    }
+
+    /* The carry out of the accumulator is added back in, end around */
+    while(length >= CHECKSUM_WORD_BYTES)
+    {
+        word = *(const uint64_t *)(const void *)p;
+        acc += word;
+        acc += (acc < word) ? 1U : 0U;
+        p += CHECKSUM_WORD_BYTES;
+        length -= CHECKSUM_WORD_BYTES;
+    }
+
+    /* At most 33 bits, so the rest cannot carry out */
+    acc = (acc & 0xFFFFFFFFULL) + (acc >> 32U);
+
+    if(length >= 4U)
+    {
+        acc += *(const uint32_t *)(const void *)p;
+        p += 4U;
+        length -= 4U;
+    }
+
+    if(length >= 2U)
+    {
+        acc += *(const uint16_t *)(const void *)p;
+        p += 2U;
+        length -= 2U;
+    }
+
+    if(0U != length)
+    {
+        acc += *p;
+    }
+
+    acc = inet_fold16(acc);
+
+    if(0U != odd)
+    {
+        acc = ((acc & 0xFFU) << 8U) | (acc >> 8U);
+    }
+
+    return (sum + acc);
+}
+
+/***************************************************************************//**
+ * See mss_checksum.h for details of how to use this function.
+ */
+uint16_t mss_inet_fold(uint64_t sum)
+{
+    return ((uint16_t)~inet_fold16(sum));
+}
+
+/***************************************************************************//**
+ * See mss_checksum.h for details of how to use this function.
+ */
+uint16_t mss_inet_checksum(const void * data, uint64_t length)
+{
+    return (mss_inet_fold(mss_inet_sum(0U, data, length)));
+}
+
+/***************************************************************************//**
+ * See mss_checksum.h for details of how to use this function.
+ */
+void mss_checksum_set_offload(const mss_checksum_offload_t * offload)
+{
+    g_offload = offload;
+}
+
+#if !defined(MPFS_HAL_HOST_MODEL)
+/***************************************************************************//**
+ * See mss_checksum.h for details of how to use this function.
+ */
+uint8_t mss_checksum_bench(mss_uart_instance_t * uart, const void * data,
+        uint64_t length)
+{
+    static uint64_t samples[MSS_CHECKSUM_BENCH_ITERATIONS];
+    static mss_bench_result_t results[4];
+    static const char * const names[4] =
+    {
+        "crc32", "crc16_ccitt", "adler32", "inet_checksum"
+    };
+    static const mss_bench_fn_t fns[4] =
+    {
+        bench_crc32, bench_crc16_ccitt, bench_adler32, bench_inet
+    };
+    checksum_bench_arg_t arg;
+    mss_bench_cfg_t cfg[4];
+    uint8_t status = SUCCESS;
+    uint32_t idx;
+
+    arg.data = data;
+    arg.length = length;
+    arg.result = 0U;
+
+    /* Builds the tables before the runs, out of the first sample */
+    (void)mss_crc32(0U, data, 0U);
+
+    for(idx = 0U; idx < 4U; idx++)
+    {
+        cfg[idx].name = names[idx];
+        cfg[idx].fn = fns[idx];
+        cfg[idx].setup = 0;
+        cfg[idx].arg = &arg;
+        cfg[idx].warmup = 2U;
+        cfg[idx].iterations = MSS_CHECKSUM_BENCH_ITERATIONS;
+        cfg[idx].flush_start = 0U;
+        cfg[idx].flush_length = 0U;
+        cfg[idx].hart_id = (uint32_t)read_csr(mhartid);
+
+        if(SUCCESS != mss_bench_run(&cfg[idx], samples, &results[idx]))
+        {
+            status = ERROR;
+        }
+    }
+
+    if(SUCCESS == status)
+    {
+        mss_bench_report_csv_header(uart);
+
+        for(idx = 0U; idx < 4U; idx++)
+        {
+            mss_bench_report_csv(uart, &cfg[idx], &results[idx]);
+        }
+
+        for(idx = 0U; idx < 4U; idx++)
+        {
+            MSS_UART_polled_tx_string(uart, (const uint8_t *)names[idx]);
+            mss_print_dec(uart, " bytes per 1000 cycles: ",
+                (length * 1000U) /
+                ((0U != results[idx].p50) ? results[idx].p50 : 1U));
+            MSS_UART_polled_tx_string(uart, (const uint8_t *)"\n\r");
+        }
+    }
+
+    return (status);
+}
+#endif
+
+/*------------------------------------------------------------------------------
+ * Builds the tables. Table N of the CRC-32 is the CRC of a byte followed by N
+ * zero bytes, the entry of table N - 1 pushed through one more zero byte.
+ */
+static void checksum_tables_init(void)
+{
+    uint32_t idx;
+    uint32_t bit;
+    uint32_t slice;
+    uint32_t crc;
+    uint32_t crc16;
+
+    for(idx = 0U; idx < CRC_TABLE_SIZE; idx++)
+    {
+        crc = idx;
+        crc16 = idx << 8U;
+
+        for(bit = 0U; bit < 8U; bit++)
+        {
+            crc = (0U != (crc & 1U)) ? ((crc >> 1U) ^ CRC32_POLY) : (crc >> 1U);
+            crc16 = (0U != (crc16 & 0x8000U)) ?
+                    ((crc16 << 1U) ^ CRC16_CCITT_POLY) : (crc16 << 1U);
+        }
+
+        g_crc32_table[0][idx] = crc;
+        g_crc16_table[idx] = (uint16_t)crc16;
+    }
+
+    for(idx = 0U; idx < CRC_TABLE_SIZE; idx++)
+    {
+        crc = g_crc32_table[0][idx];
+
+        for(slice = 1U; slice < CRC_SLICES; slice++)
+        {
+            crc = g_crc32_table[0][crc & 0xFFU] ^ (crc >> 8U);
+            g_crc32_table[slice][idx] = crc;
+        }
+    }
+
+    __atomic_store_n(&g_tables_ready, 1U, __ATOMIC_RELEASE);
+}
+
+static inline uint64_t inet_fold16(uint64_t sum)
+{
+    sum = (sum & 0xFFFFFFFFULL) + (sum >> 32U);
+    sum = (sum & 0xFFFFFFFFULL) + (sum >> 32U);
+    sum = (sum & 0xFFFFU) + (sum >> 16U);
+    sum = (sum & 0xFFFFU) + (sum >> 16U);
+
+    return (sum);
+}
+
+#if !defined(MPFS_HAL_HOST_MODEL)
+static void bench_crc32(void * arg)
+{
+    checksum_bench_arg_t * run = (checksum_bench_arg_t *)arg;
+
+    run->result = mss_crc32(0U, run->data, run->length);
+}
+
+static void bench_crc16_ccitt(void * arg)
+{
+    checksum_bench_arg_t * run = (checksum_bench_arg_t *)arg;
+
+    run->result = mss_crc16_ccitt(0U, run->data, run->length);
+}
+
+static void bench_adler32(void * arg)
+{
+    checksum_bench_arg_t * run = (checksum_bench_arg_t *)arg;
+
+    run->result = mss_adler32(MSS_ADLER32_INIT, run->data, run->length);
+}
+
+static void bench_inet(void * arg)
+{
+    checksum_bench_arg_t * run = (checksum_bench_arg_t *)arg;
+
+    run->result = mss_inet_checksum(run->data, run->length);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
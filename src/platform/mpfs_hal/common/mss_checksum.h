@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_checksum.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief CRC and checksum library shared by the drivers and applications
+ *
+ * mss_crc32() computes the CRC-32 of Ethernet, zlib and gzip, reflected
+ * polynomial 0xEDB88320, eight bytes at a time with the slicing-by-8 method:
+ * each aligned double word loaded is reduced with eight lookups, in eight
+ * tables of 256 entries, which do not depend on each other. mss_crc16_ccitt()
+ * computes the CRC-16 of polynomial 0x1021 a byte at a time with one table,
+ * the CRC of XMODEM and YMODEM when started from 0, of CCITT-FALSE when
+ * started from 0xFFFF. mss_adler32() computes the Adler-32 checksum of zlib.
+ *
+ * mss_inet_sum() adds data to the ones' complement sum of the Internet
+ * checksum, RFC 1071, an aligned double word at a time into a 64 bit
+ * accumulator, the carries out of it being added back in. mss_inet_fold()
+ * folds the sum to the 16 bit checksum. The checksum is in memory order, it is
+ * stored in a header as it is, without a byte swap.
+ *
+ * The CRCs are started from 0, mss_crc32() inverting before and after as zlib
+ * does, and each call taking the value returned by the previous one, so data
+ * in several buffers is checked piece by piece:
+ * @code
+ *   uint32_t crc = 0U;
+ *
+ *   crc = mss_crc32(crc, header, sizeof(header));
+ *   crc = mss_crc32(crc, payload, payload_length);
+ * @endcode
+ *
+ * The tables, 8.5KB, are built in .bss the first time a CRC is computed. Harts
+ * which start at the same time may all build them, writing the same values,
+ * each using them once it has finished.
+ *
+ * A CRC engine in the fabric, e.g. an accelerator driven through the
+ * fabric_ring driver, is used in place of the software by giving its functions
+ * to mss_checksum_set_offload(). They compute the same values as the software
+ * and are used for buffers of offload->min_length bytes or more, below which
+ * the software is faster than setting up the engine.
+ *
+ * mss_checksum_bench() times the functions with mss_bench_run() and prints the
+ * result of each, together with the bytes checked per cycle.
+ */
+#ifndef MSS_CHECKSUM_H
+#define MSS_CHECKSUM_H
+
+#include <stdint.h>
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Timed calls of each function made by mss_checksum_bench() */
+#ifndef MSS_CHECKSUM_BENCH_ITERATIONS
+#define MSS_CHECKSUM_BENCH_ITERATIONS   64U
+#endif
+
+#define MSS_CRC32_CHECK                 0xCBF43926UL    /* Of "123456789" */
+#define MSS_CRC16_CCITT_CHECK           0x31C3U         /* From 0 */
+#define MSS_ADLER32_INIT                1UL
+
+/*
+ * A CRC engine. Either function may be 0, the software is then used for that
+ * CRC. Each takes and returns the CRC as the function it stands in for does.
+ */
+typedef struct
+{
+    uint32_t (*crc32)(uint32_t crc, const void * data, uint64_t length);
+    uint16_t (*crc16_ccitt)(uint16_t crc, const void * data, uint64_t length);
+    uint64_t min_length;    /* Shorter buffers are checked in software */
+} mss_checksum_offload_t;
+
+/***************************************************************************//**
+ * Computes the CRC-32 of a buffer.
+ *
+ * @param crc       0, or the CRC of the data before this buffer
+ * @param data      Buffer
+ * @param length    Size of the buffer in bytes
+ * @return          The CRC of the data up to the end of this buffer
+ */
+uint32_t mss_crc32(uint32_t crc, const void * data, uint64_t length);
+
+/***************************************************************************//**
+ * Computes the CRC-16 of polynomial 0x1021 of a buffer, most significant bit
+ * first, with no inversion.
+ *
+ * @param crc       0 or 0xFFFF, or the CRC of the data before this buffer
+ * @param data      Buffer
+ * @param length    Size of the buffer in bytes
+ * @return          The CRC of the data up to the end of this buffer
+ */
+uint16_t mss_crc16_ccitt(uint16_t crc, const void * data, uint64_t length);
+
+/***************************************************************************//**
+ * Computes the Adler-32 checksum of a buffer.
+ *
+ * @param adler     MSS_ADLER32_INIT, or the checksum of the data before this
+ *                  buffer
+ * @param data      Buffer
+ * @param length    Size of the buffer in bytes
+ * @return          The checksum of the data up to the end of this buffer
+ */
+uint32_t mss_adler32(uint32_t adler, const void * data, uint64_t length);
+
+/***************************************************************************//**
+ * Adds a buffer to an Internet checksum sum. A buffer may start at any address
+ * but all the buffers of a sum except the last must be of an even length, as
+ * are the parts of a packet.
+ *
+ * @param sum       0, or the sum returned for the data before this buffer
+ * @param data      Buffer
+ * @param length    Size of the buffer in bytes
+ * @return          The sum of the data up to the end of this buffer
+ */
+uint64_t mss_inet_sum(uint64_t sum, const void * data, uint64_t length);
+
+/***************************************************************************//**
+ * Folds an Internet checksum sum to the checksum.
+ *
+ * @param sum       Sum returned by mss_inet_sum()
+ * @return          The ones' complement of the 16 bit sum, in memory order
+ */
+uint16_t mss_inet_fold(uint64_t sum);
+
+/***************************************************************************//**
+ * Computes the Internet checksum of a buffer, mss_inet_fold() of
+ * mss_inet_sum() from 0.
+ *
+ * @param data      Buffer
+ * @param length    Size of the buffer in bytes
+ * @return          The checksum, in memory order
+ */
+uint16_t mss_inet_checksum(const void * data, uint64_t length);
+
+/***************************************************************************//**
+ * Selects a CRC engine, or the software alone if offload is 0. The structure
+ * must stay valid while it is selected.
+ *
+ * @param offload   Functions of the engine, or 0
+ */
+void mss_checksum_set_offload(const mss_checksum_offload_t * offload);
+
+/***************************************************************************//**
+ * Times each function on a buffer on the calling hart and prints the results
+ * with mss_bench_report_csv(), after its header, then the bytes checked per
+ * thousand cycles of each at the median. The CRC times are those of the engine
+ * selected, if any, for buffers it takes.
+ *
+ * @param uart      UART printed to
+ * @param data      Buffer, in memory the calling hart can read
+ * @param length    Size of the buffer in bytes
+ * @return          SUCCESS, or ERROR if a run failed
+ */
+uint8_t mss_checksum_bench(mss_uart_instance_t * uart, const void * data,
+        uint64_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_CHECKSUM_H */
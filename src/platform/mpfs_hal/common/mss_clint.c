@@ -94,34 +94,63 @@ void handle_m_timer_interrupt(void)
 
     volatile uint64_t hart_id = read_csr(mhartid);
     volatile uint32_t error_loop;
+#ifdef MPFS_HAL_IRQ_PROFILING
+    uint64_t handler_cycles = readmcycle();
+#endif
+#ifdef MPFS_HAL_SMODE_APP
+    if (0U != mss_smode_forward_timer())
+    {
+        return;
+    }
+#endif
     clear_csr(mie, MIP_MTIP);
 
-    switch(hart_id)
+    /* Harts using the software timers have no system tick. While the
+       profiler samples the hart, its deadline is checked first. */
+    if (0U == pc_profile_timer())
     {
-        case 0U:
-            SysTick_Handler_h0_IRQHandler();
-            break;
-        case 1U:
-            SysTick_Handler_h1_IRQHandler();
-            break;
-        case 2U:
-            SysTick_Handler_h2_IRQHandler();
-            break;
-        case 3U:
-            SysTick_Handler_h3_IRQHandler();
-            break;
-        case 4U:
-            SysTick_Handler_h4_IRQHandler();
-            break;
-        default:
-            while (hart_id != 0U)
-             {
-                 error_loop++;
-             }
-            break;
+        /* Only a sample was due */
+    }
+    else if (0U == sw_timer_process())
+    {
+        switch(hart_id)
+        {
+            case 0U:
+                SysTick_Handler_h0_IRQHandler();
+                break;
+            case 1U:
+                SysTick_Handler_h1_IRQHandler();
+                break;
+            case 2U:
+                SysTick_Handler_h2_IRQHandler();
+                break;
+            case 3U:
+                SysTick_Handler_h3_IRQHandler();
+                break;
+            case 4U:
+                SysTick_Handler_h4_IRQHandler();
+                break;
+            default:
+                while (hart_id != 0U)
+                 {
+                     error_loop++;
+                 }
+                break;
+        }
+
+        CLINT->MTIMECMP[read_csr(mhartid)] = CLINT->MTIME + g_systick_increment[hart_id];
+    }
+    else
+    {
+        /* The software timers have programmed their next deadline */
     }
 
-    CLINT->MTIMECMP[read_csr(mhartid)] = CLINT->MTIME + g_systick_increment[hart_id];
+    pc_profile_program();
+
+#ifdef MPFS_HAL_IRQ_PROFILING
+    irq_profile_record(IRQ_PROFILE_TIMER_SOURCE, readmcycle() - handler_cycles,
+            0U);
+#endif
 
     set_csr(mie, MIP_MTIP);
 
@@ -136,6 +165,19 @@ void handle_m_soft_interrupt(void)
     volatile uint64_t hart_id = read_csr(mhartid);
     volatile uint32_t error_loop;
 
+#ifdef MPFS_HAL_SMODE_APP
+    if (0U != mss_smode_forward_soft())
+    {
+        return;
+    }
+#endif
+
+    /*
+     * Clear the software interrupt before the handler runs, so that one raised
+     * by another hart while the handler runs is taken again afterwards.
+     */
+    clear_soft_interrupt();
+
     switch(hart_id)
     {
         case 0U:
@@ -160,8 +202,5 @@ void handle_m_soft_interrupt(void)
             }
             break;
     }
-
-    /*Clear software interrupt*/
-    clear_soft_interrupt();
 }
 
@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_clk_scale.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Runtime scaling of the MSS clocks
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CLOCK_CONFIG_CR fields, 00=/1 01=/2 10=/4 11=/8 */
+#define CLK_CPU_SHIFT               0U
+#define CLK_AXI_SHIFT               2U
+#define CLK_AHB_SHIFT               4U
+#define CLK_FIELD_MASK              0x03U
+#define CLK_FIELD_MAX               3U
+
+#define CLK_LIBERO_FIELD(shift)     (((uint32_t)LIBERO_SETTING_MSS_CLOCK_CONFIG_CR \
+                                        >> (shift)) & CLK_FIELD_MASK)
+
+static volatile uint8_t g_clk_opp = MSS_CLK_OPP_FULL;
+static mss_clk_notifier_t * g_clk_notifiers = (mss_clk_notifier_t *)0;
+static mss_spinlock_t g_clk_lock;
+
+static uint32_t clk_field(uint8_t opp, uint32_t shift);
+static void clk_notify(uint8_t event, const mss_clk_change_t * change);
+
+/***************************************************************************//**
+ * See mss_clk_scale.h
+ */
+uint8_t mss_clk_num_opps(void)
+{
+    return ((uint8_t)((CLK_FIELD_MAX + 1U) - CLK_LIBERO_FIELD(CLK_CPU_SHIFT)));
+}
+
+/***************************************************************************//**
+ * See mss_clk_scale.h
+ */
+uint8_t mss_clk_get_opp(void)
+{
+    return (g_clk_opp);
+}
+
+/***************************************************************************//**
+ * See mss_clk_scale.h
+ */
+uint8_t mss_clk_set_opp(uint8_t opp)
+{
+    uint8_t result = ERROR;
+#ifdef MPFS_HAL_HW_CONFIG
+    mss_clk_change_t change;
+    uint32_t clock_config_cr;
+    uint32_t envm_cr;
+    uint32_t period;
+    uint32_t scale;
+    uint64_t mstatus;
+
+    if (opp < mss_clk_num_opps())
+    {
+        mss_spin_lock(&g_clk_lock);
+
+        change.from_opp = g_clk_opp;
+        change.to_opp = opp;
+        mss_clk_get_rates(change.from_opp, &change.from);
+        mss_clk_get_rates(change.to_opp, &change.to);
+
+        if (change.from_opp != change.to_opp)
+        {
+            clock_config_cr = ((uint32_t)LIBERO_SETTING_MSS_CLOCK_CONFIG_CR &
+                    ~(uint32_t)CLOCK_CONFIG_CR_DIVIDER_MASK) |
+                    (clk_field(opp, CLK_CPU_SHIFT) << CLK_CPU_SHIFT) |
+                    (clk_field(opp, CLK_AXI_SHIFT) << CLK_AXI_SHIFT) |
+                    (clk_field(opp, CLK_AHB_SHIFT) << CLK_AHB_SHIFT);
+
+            /* Fewest AHB cycles per eNVM clock which keep it at or below its
+               Libero rate, at least 1 */
+            scale = clk_field(opp, CLK_AHB_SHIFT) -
+                    CLK_LIBERO_FIELD(CLK_AHB_SHIFT);
+            period = ((uint32_t)LIBERO_SETTING_MSS_ENVM_CR &
+                    (uint32_t)ENVM_CR_CLOCK_PERIOD_MASK) + 1U;
+            period = (period + (1U << scale) - 1U) >> scale;
+
+            if (period < 2U)
+            {
+                period = 2U;
+            }
+
+            envm_cr = ((uint32_t)LIBERO_SETTING_MSS_ENVM_CR &
+                    ~(uint32_t)ENVM_CR_CLOCK_PERIOD_MASK) | (period - 1U);
+
+            clk_notify(MSS_CLK_PRE_CHANGE, &change);
+
+            mstatus = disable_interrupts();
+            mss_pll_set_mss_dividers(clock_config_cr, envm_cr);
+            g_clk_opp = opp;
+            restore_interrupts(mstatus);
+
+            clk_notify(MSS_CLK_POST_CHANGE, &change);
+        }
+
+        mss_spin_unlock(&g_clk_lock);
+        result = SUCCESS;
+    }
+#else
+    (void)opp;
+#endif
+
+    return (result);
+}
+
+/***************************************************************************//**
+ * See mss_clk_scale.h
+ */
+void mss_clk_get_rates(uint8_t opp, mss_clk_rates_t * rates)
+{
+    rates->cpu_hz = (uint64_t)LIBERO_SETTING_MSS_COREPLEX_CPU_CLK >>
+            (clk_field(opp, CLK_CPU_SHIFT) - CLK_LIBERO_FIELD(CLK_CPU_SHIFT));
+    rates->axi_hz = (uint64_t)LIBERO_SETTING_MSS_AXI_CLK >>
+            (clk_field(opp, CLK_AXI_SHIFT) - CLK_LIBERO_FIELD(CLK_AXI_SHIFT));
+    rates->apb_hz = (uint64_t)LIBERO_SETTING_MSS_APB_AHB_CLK >>
+            (clk_field(opp, CLK_AHB_SHIFT) - CLK_LIBERO_FIELD(CLK_AHB_SHIFT));
+}
+
+/***************************************************************************//**
+ * See mss_clk_scale.h
+ */
+uint64_t mss_clk_cpu_hz(void)
+{
+    mss_clk_rates_t rates;
+
+    mss_clk_get_rates(g_clk_opp, &rates);
+
+    return (rates.cpu_hz);
+}
+
+/***************************************************************************//**
+ * See mss_clk_scale.h
+ */
+uint64_t mss_clk_apb_hz(void)
+{
+    mss_clk_rates_t rates;
+
+    mss_clk_get_rates(g_clk_opp, &rates);
+
+    return (rates.apb_hz);
+}
+
+/***************************************************************************//**
+ * See mss_clk_scale.h
+ */
+void mss_clk_register_notifier(mss_clk_notifier_t * notifier)
+{
+    mss_clk_notifier_t ** link = &g_clk_notifiers;
+
+    mss_spin_lock(&g_clk_lock);
+
+    while ((mss_clk_notifier_t *)0 != *link)
+    {
+        link = &(*link)->next;
+    }
+
+    notifier->next = (mss_clk_notifier_t *)0;
+    *link = notifier;
+
+    mss_spin_unlock(&g_clk_lock);
+}
+
+/***************************************************************************//**
+ * See mss_clk_scale.h
+ */
+void mss_clk_unregister_notifier(mss_clk_notifier_t * notifier)
+{
+    mss_clk_notifier_t ** link = &g_clk_notifiers;
+
+    mss_spin_lock(&g_clk_lock);
+
+    while (((mss_clk_notifier_t *)0 != *link) && (notifier != *link))
+    {
+        link = &(*link)->next;
+    }
+
+    if ((mss_clk_notifier_t *)0 != *link)
+    {
+        *link = notifier->next;
+    }
+
+    mss_spin_unlock(&g_clk_lock);
+}
+
+/***************************************************************************//**
+ * Returns a CLOCK_CONFIG_CR divider field at an operating point: the Libero
+ * field plus the point, stopping at /8.
+ */
+static uint32_t clk_field(uint8_t opp, uint32_t shift)
+{
+    uint32_t field = CLK_LIBERO_FIELD(shift) + (uint32_t)opp;
+
+    if (field > CLK_FIELD_MAX)
+    {
+        field = CLK_FIELD_MAX;
+    }
+
+    return (field);
+}
+
+/***************************************************************************//**
+ * Calls the notifiers, in order of registration
+ */
+static void clk_notify(uint8_t event, const mss_clk_change_t * change)
+{
+    const mss_clk_notifier_t * notifier = g_clk_notifiers;
+
+    while ((const mss_clk_notifier_t *)0 != notifier)
+    {
+        notifier->notify(event, change, notifier->arg);
+        notifier = notifier->next;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_clk_scale.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Runtime scaling of the MSS clocks
+ *
+ * The MSS PLL is locked once at boot by mss_pll_config() from the Libero
+ * settings. The CPU, AXI and AHB/APB clocks are divided from its output by the
+ * dividers of CLOCK_CONFIG_CR, which can be changed from any value to any
+ * value in one go without a glitch. mss_clk_set_opp() moves the MSS between
+ * operating points built on these dividers, so that the harts can run at full
+ * speed under load and slower when idle:
+ *  - MSS_CLK_OPP_FULL is the Libero setting,
+ *  - each following point divides the CPU, AXI and AHB/APB clocks of the
+ *    previous one by two, the AXI and AHB/APB dividers stopping at /8,
+ *  - there are mss_clk_num_opps() points, up to the CPU divider of /8.
+ * Every point keeps the ratios the CPU, AXI and AHB clocks must respect, so
+ * all are valid for any Libero setting which is. The eNVM clock divider is
+ * scaled with the AHB clock so the eNVM clock is never above its Libero rate.
+ * The PLL is not relocked, so a change takes effect in a few cycles.
+ *
+ * The clocks of all the harts and of the peripherals on the AXI and APB buses
+ * change together. mtime and the RTC are clocked from the reference clock and
+ * keep their rate; mcycle counts at mss_clk_cpu_hz().
+ *
+ * Drivers whose timings depend on the APB clock register a notifier, called
+ * in order of registration on the hart changing the point, once before the
+ * change with MSS_CLK_PRE_CHANGE, to let a transfer in progress finish, and
+ * once after it with MSS_CLK_POST_CHANGE, to recalculate their dividers. The
+ * MSS UART, I2C and SPI drivers provide MSS_UART_clock_notify(),
+ * MSS_I2C_clock_notify() and MSS_SPI_clock_notify(), taking their instance as
+ * argument:
+ * @code
+ *   static mss_clk_notifier_t g_uart0_clk = { MSS_UART_clock_notify,
+ *           &g_mss_uart0_lo, NULL };
+ *
+ *   mss_clk_register_notifier(&g_uart0_clk);
+ *   ...
+ *   (void)mss_clk_set_opp(mss_clk_num_opps() - 1U);       // idle
+ *   ...
+ *   (void)mss_clk_set_opp(MSS_CLK_OPP_FULL);              // busy
+ * @endcode
+ *
+ * The USB block needs an AHB clock above 66 MHz. Only images which own the
+ * clocks, MPFS_HAL_HW_CONFIG defined, can change the point; the others see
+ * the Libero rates.
+ */
+#ifndef MSS_CLK_SCALE_H
+#define MSS_CLK_SCALE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MSS_CLK_OPP_FULL                0U
+
+/*
+ * Notifier events
+ */
+#define MSS_CLK_PRE_CHANGE              0U
+#define MSS_CLK_POST_CHANGE             1U
+
+typedef struct
+{
+    uint64_t cpu_hz;
+    uint64_t axi_hz;
+    uint64_t apb_hz;                /* AHB and APB */
+} mss_clk_rates_t;
+
+typedef struct
+{
+    uint8_t from_opp;
+    uint8_t to_opp;
+    mss_clk_rates_t from;
+    mss_clk_rates_t to;
+} mss_clk_change_t;
+
+typedef void (*mss_clk_notify_t)(uint8_t event,
+        const mss_clk_change_t * change, void * arg);
+
+typedef struct mss_clk_notifier
+{
+    mss_clk_notify_t notify;
+    void * arg;
+    struct mss_clk_notifier * next; /* Used by the HAL */
+} mss_clk_notifier_t;
+
+/***************************************************************************//**
+ * mss_clk_num_opps() returns the number of operating points of the Libero
+ * setting.
+ */
+uint8_t mss_clk_num_opps(void);
+
+/***************************************************************************//**
+ * mss_clk_get_opp() returns the current operating point.
+ */
+uint8_t mss_clk_get_opp(void);
+
+/***************************************************************************//**
+ * mss_clk_set_opp() moves the MSS to an operating point, calling the notifiers
+ * before and after the change. It must not be called from an interrupt
+ * handler, as the notifiers may wait for the peripherals. Changes from
+ * several harts are serialised.
+ *
+ * @return
+ *   SUCCESS, or ERROR if the point is out of range or the image does not own
+ *   the clocks.
+ */
+uint8_t mss_clk_set_opp(uint8_t opp);
+
+/***************************************************************************//**
+ * mss_clk_get_rates() gives the clock rates of an operating point in Hz.
+ */
+void mss_clk_get_rates(uint8_t opp, mss_clk_rates_t * rates);
+
+/***************************************************************************//**
+ * mss_clk_cpu_hz() and mss_clk_apb_hz() return the current CPU and AHB/APB
+ * clock rates in Hz.
+ */
+uint64_t mss_clk_cpu_hz(void);
+uint64_t mss_clk_apb_hz(void);
+
+/***************************************************************************//**
+ * mss_clk_register_notifier() adds a notifier to the end of the list, and
+ * mss_clk_unregister_notifier() takes it out. The notifier must remain valid
+ * while registered.
+ */
+void mss_clk_register_notifier(mss_clk_notifier_t * notifier);
+void mss_clk_unregister_notifier(mss_clk_notifier_t * notifier);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_CLK_SCALE_H */
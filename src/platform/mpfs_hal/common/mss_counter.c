@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_counter.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Per hart sharded statistics counters
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * See mss_counter.h
+ */
+uint64_t mss_counter_read(const mss_counter_t * counter)
+{
+    uint64_t total = 0U;
+    uint32_t hart;
+
+    for (hart = 0U; hart < MSS_COUNTER_NUM_HARTS; hart++)
+    {
+        total += counter->shard[hart].value;
+    }
+
+    return (total);
+}
+
+/***************************************************************************//**
+ * See mss_counter.h
+ */
+uint64_t mss_counter_read_hart(const mss_counter_t * counter, uint64_t hart_id)
+{
+    uint64_t value = 0U;
+
+    if (hart_id < MSS_COUNTER_NUM_HARTS)
+    {
+        value = counter->shard[hart_id].value;
+    }
+
+    return (value);
+}
+
+/***************************************************************************//**
+ * See mss_counter.h
+ */
+void mss_counter_clear(mss_counter_t * counter)
+{
+    uint32_t hart;
+
+    for (hart = 0U; hart < MSS_COUNTER_NUM_HARTS; hart++)
+    {
+        counter->shard[hart].value = 0U;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
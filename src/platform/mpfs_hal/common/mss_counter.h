@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_counter.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Per hart sharded statistics counters
+ *
+ * An mss_counter_t has one slot for each hart, each in a cache line of its
+ * own. A hart only ever writes its own slot, with a plain load and store, so
+ * counting from several harts neither bounces a cache line between them nor
+ * loses updates, and no atomic operations are needed. mss_counter_read() adds
+ * up the slots. It can run on any hart at any time and returns a total which
+ * may miss the increments in flight on the other harts.
+ *
+ * An increment on a hart can still be lost if an interrupt handler on the same
+ * hart increments the same counter between the load and the store, so a
+ * counter should be counted either from interrupt handlers or with the
+ * interrupt masked on each hart.
+ *
+ * Drivers declare their statistics as mss_stat_t and update them with the
+ * MSS_STAT_ macros. When MPFS_HAL_SHARDED_COUNTERS is defined in
+ * mss_sw_config.h they are sharded counters, otherwise they are the plain
+ * 64-bit variables the drivers used before, so the memory cost of
+ * sizeof(mss_counter_t) a statistic is only paid when it is wanted.
+ *
+ * Example:
+ * @code
+ *   static mss_counter_t g_rx_drops;
+ *
+ *   void rx_isr(void)
+ *   {
+ *       mss_counter_inc(&g_rx_drops);
+ *   }
+ *
+ *   total = mss_counter_read(&g_rx_drops);
+ * @endcode
+ */
+#ifndef MSS_COUNTER_H
+#define MSS_COUNTER_H
+
+#include <stdint.h>
+#include "encoding.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MSS_COUNTER_NUM_HARTS           5U
+#define MSS_COUNTER_LINE_BYTES          64U
+
+typedef struct
+{
+    volatile uint64_t value;
+    uint8_t line[MSS_COUNTER_LINE_BYTES - sizeof(uint64_t)];
+} mss_counter_shard_t;
+
+typedef struct
+{
+    mss_counter_shard_t shard[MSS_COUNTER_NUM_HARTS];
+} __attribute__((aligned(MSS_COUNTER_LINE_BYTES))) mss_counter_t;
+
+/***************************************************************************//**
+ * mss_counter_add() adds n to the calling hart's slot of a counter.
+ */
+static inline void mss_counter_add(mss_counter_t * counter, uint64_t n)
+{
+    mss_counter_shard_t * shard = &counter->shard[read_csr(mhartid)];
+
+    shard->value = shard->value + n;
+}
+
+/***************************************************************************//**
+ * mss_counter_inc() adds one to the calling hart's slot of a counter.
+ */
+static inline void mss_counter_inc(mss_counter_t * counter)
+{
+    mss_counter_add(counter, 1U);
+}
+
+/***************************************************************************//**
+ * mss_counter_read() returns the sum of the slots of a counter.
+ */
+uint64_t mss_counter_read(const mss_counter_t * counter);
+
+/***************************************************************************//**
+ * mss_counter_read_hart() returns one hart's slot of a counter, or 0 when
+ * hart_id is out of range.
+ */
+uint64_t mss_counter_read_hart(const mss_counter_t * counter, uint64_t hart_id);
+
+/***************************************************************************//**
+ * mss_counter_clear() sets all the slots of a counter to zero. Increments made
+ * on other harts while the counter is cleared may survive the clear.
+ */
+void mss_counter_clear(mss_counter_t * counter);
+
+/*
+ * Driver statistics, sharded or plain, see above
+ */
+#ifdef MPFS_HAL_SHARDED_COUNTERS
+typedef mss_counter_t mss_stat_t;
+#define MSS_STAT_ADD(stat, n)           mss_counter_add(&(stat), (uint64_t)(n))
+#define MSS_STAT_READ(stat)             mss_counter_read(&(stat))
+#define MSS_STAT_CLEAR(stat)            mss_counter_clear(&(stat))
+#else
+typedef volatile uint64_t mss_stat_t;
+#define MSS_STAT_ADD(stat, n)           ((stat) += (uint64_t)(n))
+#define MSS_STAT_READ(stat)             ((uint64_t)(stat))
+#define MSS_STAT_CLEAR(stat)            ((stat) = 0U)
+#endif
+
+#define MSS_STAT_INC(stat)              MSS_STAT_ADD(stat, 1U)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_COUNTER_H */
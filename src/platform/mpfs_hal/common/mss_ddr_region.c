@@ -0,0 +1,206 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_ddr_region.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief DDR address aliases and regions
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DDR_NUM_WINDOWS         6U
+#define DDR_SEG_OFFSET_SHIFT    24U
+
+typedef struct
+{
+    uint64_t base;
+    uint64_t size;
+    uint8_t seg;
+    uint8_t reg;
+    mss_ddr_usage_t usage;
+} ddr_window_t;
+
+/*
+ * The DDR windows, 32-bit window first for each usage, and the segmentation
+ * register which gives the DDR offset of each window in 16 Mbyte units.
+ */
+static const ddr_window_t g_ddr_windows[DDR_NUM_WINDOWS] =
+{
+    { 0x80000000ULL,   0x40000000ULL,  0U, 0U, MSS_DDR_USAGE_CPU },
+    { 0x1000000000ULL, 0x400000000ULL, 0U, 1U, MSS_DDR_USAGE_CPU },
+    { 0xC0000000ULL,   0x10000000ULL,  1U, 2U, MSS_DDR_USAGE_DMA },
+    { 0x1400000000ULL, 0x400000000ULL, 1U, 3U, MSS_DDR_USAGE_DMA },
+    { 0xD0000000ULL,   0x10000000ULL,  1U, 4U, MSS_DDR_USAGE_STREAM_WRITE },
+    { 0x1800000000ULL, 0x400000000ULL, 1U, 5U, MSS_DDR_USAGE_STREAM_WRITE }
+};
+
+typedef struct
+{
+    uint64_t next;
+    uint64_t end;
+} ddr_region_t;
+
+static ddr_region_t g_ddr_regions[MSS_DDR_NUM_USAGES];
+static volatile long g_ddr_region_lock = 0;
+
+/*
+ * DDR offset of the start of a window.
+ */
+static uint64_t window_ddr_base(const ddr_window_t * window)
+{
+    int64_t offset = (int64_t)SEG[window->seg].u[window->reg].CFG.offset;
+
+    return (window->base + (uint64_t)(offset * (1LL << DDR_SEG_OFFSET_SHIFT)));
+}
+
+/*
+ * Address in a window for the usage of length bytes at a DDR offset.
+ */
+static uint64_t usage_address(mss_ddr_usage_t usage, uint64_t ddr_offset,
+        uint64_t length)
+{
+    uint64_t addr = MSS_DDR_INVALID_ADDR;
+    uint64_t base;
+    uint32_t inc;
+
+    for(inc = 0U; (inc < DDR_NUM_WINDOWS) && (MSS_DDR_INVALID_ADDR == addr);
+            inc++)
+    {
+        if(g_ddr_windows[inc].usage == usage)
+        {
+            base = window_ddr_base(&g_ddr_windows[inc]);
+
+            if((ddr_offset >= base) &&
+               (length <= g_ddr_windows[inc].size) &&
+               ((ddr_offset - base) <= (g_ddr_windows[inc].size - length)))
+            {
+                addr = g_ddr_windows[inc].base + (ddr_offset - base);
+            }
+        }
+    }
+
+    return (addr);
+}
+
+/***************************************************************************//**
+ * See mss_ddr_region.h
+ */
+uint64_t mss_ddr_offset(uint64_t addr)
+{
+    uint64_t ddr_offset = MSS_DDR_INVALID_ADDR;
+    uint32_t inc;
+
+    for(inc = 0U; inc < DDR_NUM_WINDOWS; inc++)
+    {
+        if((addr >= g_ddr_windows[inc].base) &&
+           ((addr - g_ddr_windows[inc].base) < g_ddr_windows[inc].size))
+        {
+            ddr_offset = window_ddr_base(&g_ddr_windows[inc]) +
+                    (addr - g_ddr_windows[inc].base);
+        }
+    }
+
+    return (ddr_offset);
+}
+
+/***************************************************************************//**
+ * See mss_ddr_region.h
+ */
+uint64_t mss_ddr_alias(uint64_t addr, mss_ddr_usage_t usage)
+{
+    uint64_t ddr_offset = mss_ddr_offset(addr);
+    uint64_t alias = MSS_DDR_INVALID_ADDR;
+
+    if((MSS_DDR_INVALID_ADDR != ddr_offset) && (usage < MSS_DDR_NUM_USAGES))
+    {
+        alias = usage_address(usage, ddr_offset, 1U);
+    }
+
+    return (alias);
+}
+
+/***************************************************************************//**
+ * See mss_ddr_region.h
+ */
+uint8_t mss_ddr_region_init(mss_ddr_usage_t usage, uint64_t ddr_offset,
+        uint64_t length)
+{
+    uint64_t start = MSS_DDR_INVALID_ADDR;
+    uint64_t mstatus;
+    uint8_t ret_val = ERROR;
+
+    if((usage < MSS_DDR_NUM_USAGES) && (0U != length))
+    {
+        start = usage_address(usage, ddr_offset, length);
+    }
+
+    if(MSS_DDR_INVALID_ADDR != start)
+    {
+        mstatus = disable_interrupts();
+        spinlock(&g_ddr_region_lock);
+
+        g_ddr_regions[usage].next = start;
+        g_ddr_regions[usage].end = start + length;
+
+        spinunlock(&g_ddr_region_lock);
+        restore_interrupts(mstatus);
+
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_ddr_region.h
+ */
+void * mss_ddr_region_alloc(mss_ddr_usage_t usage, size_t size, size_t align)
+{
+    ddr_region_t * region;
+    uint64_t start;
+    uint64_t mstatus;
+    void * block = (void *)0;
+
+    if(align < 8U)
+    {
+        align = 8U;
+    }
+
+    if((usage < MSS_DDR_NUM_USAGES) && (0U == (align & (align - 1U))))
+    {
+        region = &g_ddr_regions[usage];
+
+        mstatus = disable_interrupts();
+        spinlock(&g_ddr_region_lock);
+
+        start = (region->next + (align - 1U)) & ~((uint64_t)align - 1U);
+
+        if((0U != region->end) && (start >= region->next) &&
+           (start <= region->end) && (size <= (region->end - start)))
+        {
+            block = (void *)start;
+            region->next = start + size;
+        }
+
+        mb();
+        spinunlock(&g_ddr_region_lock);
+        restore_interrupts(mstatus);
+    }
+
+    return (block);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_ddr_region.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief DDR address aliases and regions
+ *
+ * The DDR is seen by the harts through three pairs of address windows, 32-bit
+ * and 38-bit: cached, non-cached and non-cached through the write combining
+ * buffer (WCB). The segmentation registers set by setup_ddr_segments() give
+ * the DDR offset each window starts at, so the same DDR location can be
+ * reached through several windows. The choice of window for a buffer decides
+ * how fast it is to use:
+ *  - MSS_DDR_USAGE_CPU, the cached window, for buffers mostly accessed by the
+ *    harts.
+ *  - MSS_DDR_USAGE_DMA, the non-cached window, for buffers mostly accessed by
+ *    DMA masters, so that no cache maintenance is needed.
+ *  - MSS_DDR_USAGE_STREAM_WRITE, the WCB window, for buffers the harts write
+ *    sequentially and rarely read, such as frame buffers or transmit data.
+ *
+ * mss_ddr_alias() returns the address of a DDR location in the window for a
+ * usage, using the 32-bit window when the location is mapped by it.
+ * mss_ddr_offset() returns the DDR offset of an address in any window.
+ *
+ * mss_ddr_region_init() gives the allocator of a usage an area of DDR, and
+ * mss_ddr_region_alloc() then returns buffers from it in the window of that
+ * usage. The buffers are never freed. The areas given to the usages must not
+ * overlap, as accessing the same DDR through a cached and a non-cached window
+ * would read stale data and lose writes.
+ *
+ * Example:
+ * @code
+ *   (void)mss_ddr_region_init(MSS_DDR_USAGE_DMA, 0x40000000ULL, 0x100000ULL);
+ *   rx_ring = mss_ddr_region_alloc(MSS_DDR_USAGE_DMA, RX_RING_SIZE, 64U);
+ * @endcode
+ */
+#ifndef MSS_DDR_REGION_H
+#define MSS_DDR_REGION_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MSS_DDR_INVALID_ADDR    0xFFFFFFFFFFFFFFFFULL
+
+typedef enum
+{
+    MSS_DDR_USAGE_CPU = 0,
+    MSS_DDR_USAGE_DMA,
+    MSS_DDR_USAGE_STREAM_WRITE,
+    MSS_DDR_NUM_USAGES
+} mss_ddr_usage_t;
+
+/***************************************************************************//**
+ * mss_ddr_offset() returns the DDR offset of an address in one of the DDR
+ * windows, or MSS_DDR_INVALID_ADDR if the address is not in a DDR window.
+ */
+uint64_t mss_ddr_offset(uint64_t addr);
+
+/***************************************************************************//**
+ * mss_ddr_alias() returns the address of the DDR location held at addr, in
+ * any DDR window, in the window for the usage given, or MSS_DDR_INVALID_ADDR
+ * if no window for that usage maps it.
+ */
+uint64_t mss_ddr_alias(uint64_t addr, mss_ddr_usage_t usage);
+
+/***************************************************************************//**
+ * mss_ddr_region_init() gives length bytes of DDR, starting at the DDR offset
+ * given, to the allocator of a usage. It returns ERROR if the area is not
+ * mapped by a window for the usage.
+ */
+uint8_t mss_ddr_region_init(mss_ddr_usage_t usage, uint64_t ddr_offset,
+        uint64_t length);
+
+/***************************************************************************//**
+ * mss_ddr_region_alloc() returns size bytes, aligned to align bytes, a power
+ * of two, from the area of a usage and in its window, or a null pointer when
+ * the area is exhausted.
+ */
+void * mss_ddr_region_alloc(mss_ddr_usage_t usage, size_t size, size_t align);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_DDR_REGION_H */
@@ -0,0 +1,259 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_ddr_scrub.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Background DDR ECC scrubber
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCRUB_WORDS                 (MSS_DDR_SCRUB_CHUNK / sizeof(uint64_t))
+#define SCRUB_CHUNK_CREDIT          ((uint64_t)MSS_DDR_SCRUB_CHUNK * \
+                                     (uint64_t)MSS_DDR_SCRUB_MTIME_HZ)
+#define SCRUB_BURST_CREDIT          ((uint64_t)MSS_DDR_SCRUB_BURST * \
+                                     (uint64_t)MSS_DDR_SCRUB_MTIME_HZ)
+#define SECONDS_PER_HOUR            3600U
+
+/*
+ * Rate limit, in byte x mtime Hz units so no remainder is lost
+ */
+typedef struct
+{
+    mss_ddr_scrub_region_t * head;
+    mss_ddr_scrub_region_t * current;
+    uint64_t bytes_per_second;
+    uint64_t burst_ticks;
+    uint64_t credit;
+    uint64_t last_mtime;
+} ddr_scrub_t;
+
+static ddr_scrub_t g_scrub;
+
+static void scrub_chunk(mss_ddr_scrub_region_t * region);
+static void scrub_rewrite(uint64_t addr);
+
+/***************************************************************************//**
+ * See mss_ddr_scrub.h
+ */
+uint8_t mss_ddr_scrub_init(uint64_t bytes_per_second)
+{
+    uint8_t result = ERROR;
+
+    g_scrub.head = (mss_ddr_scrub_region_t *)0;
+    g_scrub.current = (mss_ddr_scrub_region_t *)0;
+    g_scrub.credit = 0U;
+    g_scrub.last_mtime = readmtime();
+
+    if (((LIBERO_SETTING_DDRPHY_MODE & DDRPHY_MODE_ECC_MASK) ==
+            DDRPHY_MODE_ECC_ON) && (0U != bytes_per_second))
+    {
+        g_scrub.bytes_per_second = bytes_per_second;
+        g_scrub.burst_ticks = (SCRUB_BURST_CREDIT / bytes_per_second) + 1U;
+        result = SUCCESS;
+    }
+    else
+    {
+        g_scrub.bytes_per_second = 0U;
+    }
+
+    return (result);
+}
+
+/***************************************************************************//**
+ * See mss_ddr_scrub.h
+ */
+uint8_t mss_ddr_scrub_add(mss_ddr_scrub_region_t * region, uint64_t addr,
+        uint64_t length)
+{
+    uint8_t result = ERROR;
+    uint64_t cached = mss_ddr_alias(addr, MSS_DDR_USAGE_CPU);
+    uint64_t non_cached = mss_ddr_alias(addr, MSS_DDR_USAGE_DMA);
+    mss_ddr_scrub_region_t * last;
+
+    if ((0U != length) &&
+        (0U == (addr % MSS_DDR_SCRUB_CHUNK)) &&
+        (0U == (length % MSS_DDR_SCRUB_CHUNK)) &&
+        (MSS_DDR_INVALID_ADDR != cached) &&
+        (MSS_DDR_INVALID_ADDR != non_cached) &&
+        ((cached + length - 1U) ==
+            mss_ddr_alias(addr + length - 1U, MSS_DDR_USAGE_CPU)) &&
+        ((non_cached + length - 1U) ==
+            mss_ddr_alias(addr + length - 1U, MSS_DDR_USAGE_DMA)))
+    {
+        region->next = (mss_ddr_scrub_region_t *)0;
+        region->cached = cached;
+        region->non_cached = non_cached;
+        region->length = length;
+        region->offset = 0U;
+        region->passes = 0U;
+        region->corrected = 0U;
+        region->uncorrected = 0U;
+        region->pass_corrected = 0U;
+        region->last_pass_corrected = 0U;
+        region->rewritten = 0U;
+        region->first_mtime = readmtime();
+
+        if ((mss_ddr_scrub_region_t *)0 == g_scrub.head)
+        {
+            g_scrub.head = region;
+            g_scrub.current = region;
+        }
+        else
+        {
+            last = g_scrub.head;
+            while ((mss_ddr_scrub_region_t *)0 != last->next)
+            {
+                last = last->next;
+            }
+            last->next = region;
+        }
+
+        result = SUCCESS;
+    }
+
+    return (result);
+}
+
+/***************************************************************************//**
+ * See mss_ddr_scrub.h
+ */
+uint64_t mss_ddr_scrub_run(void)
+{
+    uint64_t scrubbed = 0U;
+    uint64_t now = readmtime();
+    uint64_t elapsed = now - g_scrub.last_mtime;
+    mss_ddr_scrub_region_t * region;
+
+    g_scrub.last_mtime = now;
+
+    if (((mss_ddr_scrub_region_t *)0 != g_scrub.current) &&
+        (0U != g_scrub.bytes_per_second))
+    {
+        if (elapsed > g_scrub.burst_ticks)
+        {
+            elapsed = g_scrub.burst_ticks;
+        }
+
+        g_scrub.credit += elapsed * g_scrub.bytes_per_second;
+        if (g_scrub.credit > SCRUB_BURST_CREDIT)
+        {
+            g_scrub.credit = SCRUB_BURST_CREDIT;
+        }
+
+        while (g_scrub.credit >= SCRUB_CHUNK_CREDIT)
+        {
+            region = g_scrub.current;
+
+            scrub_chunk(region);
+            g_scrub.credit -= SCRUB_CHUNK_CREDIT;
+            scrubbed += MSS_DDR_SCRUB_CHUNK;
+
+            region->offset += MSS_DDR_SCRUB_CHUNK;
+            if (region->offset >= region->length)
+            {
+                region->offset = 0U;
+                region->passes++;
+                region->last_pass_corrected = region->pass_corrected;
+                region->pass_corrected = 0U;
+
+                g_scrub.current = region->next;
+                if ((mss_ddr_scrub_region_t *)0 == g_scrub.current)
+                {
+                    g_scrub.current = g_scrub.head;
+                }
+            }
+        }
+    }
+
+    return (scrubbed);
+}
+
+/***************************************************************************//**
+ * See mss_ddr_scrub.h
+ */
+uint64_t mss_ddr_scrub_errors_per_hour(const mss_ddr_scrub_region_t * region)
+{
+    uint64_t rate = 0U;
+    uint64_t elapsed = readmtime() - region->first_mtime;
+
+    if (0U != elapsed)
+    {
+        rate = (region->corrected * SECONDS_PER_HOUR *
+                (uint64_t)MSS_DDR_SCRUB_MTIME_HZ) / elapsed;
+    }
+
+    return (rate);
+}
+
+/***************************************************************************//**
+ * Reads the next chunk of a region through the non-cached window, and writes
+ * it back if the EDAC corrected errors in it.
+ */
+static void scrub_chunk(mss_ddr_scrub_region_t * region)
+{
+    const volatile uint64_t * p_word =
+            (const volatile uint64_t *)(region->non_cached + region->offset);
+    uint32_t count = SYSREG->EDAC_CNT_DDRC;
+    uint32_t corrected;
+    uint32_t word;
+
+    for (word = 0U; word < SCRUB_WORDS; word++)
+    {
+        (void)p_word[word];
+    }
+
+    mb();
+
+    corrected = (SYSREG->EDAC_CNT_DDRC - count) &
+            (uint32_t)EDAC_CNT_DDRC_COUNT_MASK;
+
+    if (0U != (SYSREG->EDAC_SR & (uint32_t)EDAC_SR_DDRC_2E_MASK))
+    {
+        SYSREG->EDAC_SR = (uint32_t)EDAC_SR_DDRC_2E_MASK;
+        region->uncorrected++;
+    }
+
+    if (0U != corrected)
+    {
+        region->corrected += corrected;
+        region->pass_corrected += corrected;
+        region->rewritten++;
+        scrub_rewrite(region->cached + region->offset);
+    }
+}
+
+/***************************************************************************//**
+ * Writes back a chunk through the cached window. Each line is read from the
+ * DDR, corrected, into the L2 by an atomic OR of zero, which leaves it dirty,
+ * and flushed.
+ */
+static void scrub_rewrite(uint64_t addr)
+{
+    uint64_t line;
+
+    mss_l2_flush_range(addr, MSS_DDR_SCRUB_CHUNK);
+
+    for (line = addr; line < (addr + MSS_DDR_SCRUB_CHUNK);
+            line += CACHE_BLOCK_BYTE_LENGTH)
+    {
+        __asm volatile ("amoor.d zero, zero, (%0)" : : "r"(line) : "memory");
+    }
+
+    mss_l2_flush_range(addr, MSS_DDR_SCRUB_CHUNK);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_ddr_scrub.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Background DDR ECC scrubber
+ *
+ * With ECC enabled in the DDR controller, a single bit error is corrected in
+ * the data returned to the master but stays in the DDR, so errors build up in
+ * areas which are rarely read until a second bit flips in the same word. The
+ * scrubber walks regions of DDR in the background and writes back the chunks
+ * in which the EDAC of the DDR controller counted corrected errors.
+ *
+ * Each chunk of MSS_DDR_SCRUB_CHUNK bytes is read through the non-cached DDR
+ * window, so every word is read from the DDR whatever the L2 holds. When the
+ * single bit error count of SYSREG->EDAC_CNT_DDRC moves during the read, each
+ * line of the chunk is rewritten through the cached window: the line is
+ * flushed, an atomic OR of zero pulls the corrected data into the L2 and marks
+ * the line dirty without changing it, and a second flush writes it back with
+ * fresh ECC. The atomic keeps the rewrite safe against the harts writing to
+ * the chunk at the same time. DMA masters writing to the DDR directly must not
+ * write to a region while it is being scrubbed.
+ *
+ * The errors counted while a chunk is read are charged to its region,
+ * including any corrected for other masters at the same time, which at worst
+ * causes a chunk to be rewritten needlessly. Uncorrectable errors, flagged in
+ * SYSREG->EDAC_SR, are counted the same way, and raise the ECC error
+ * interrupt if it is enabled.
+ *
+ * mss_ddr_scrub_run() scrubs as many chunks as the rate given to
+ * mss_ddr_scrub_init() allows since its last call, with up to
+ * MSS_DDR_SCRUB_BURST bytes of credit, so the scrubber never takes more than
+ * that share of the DDR bandwidth. It is called from one context only, e.g.
+ * the main loop of e51() or a software timer callback:
+ * @code
+ *   static mss_ddr_scrub_region_t g_scrub_all;
+ *
+ *   (void)mss_ddr_scrub_init(1024U * 1024U);        // 1 Mbyte/s
+ *   (void)mss_ddr_scrub_add(&g_scrub_all, 0x80000000ULL, 0x40000000ULL);
+ *   while (1)
+ *   {
+ *       (void)mss_ddr_scrub_run();
+ *       ...
+ *   }
+ * @endcode
+ */
+#ifndef MSS_DDR_SCRUB_H
+#define MSS_DDR_SCRUB_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Bytes read between two checks of the EDAC counters, a multiple of the cache
+ * line size
+ */
+#ifndef MSS_DDR_SCRUB_CHUNK
+#define MSS_DDR_SCRUB_CHUNK             4096U
+#endif
+
+/*
+ * Most bytes mss_ddr_scrub_run() scrubs in one call, when it has not been
+ * called for a while
+ */
+#ifndef MSS_DDR_SCRUB_BURST
+#define MSS_DDR_SCRUB_BURST             (4U * MSS_DDR_SCRUB_CHUNK)
+#endif
+
+/*
+ * Rate of mtime
+ */
+#ifndef MSS_DDR_SCRUB_MTIME_HZ
+#define MSS_DDR_SCRUB_MTIME_HZ          LIBERO_SETTING_MSS_RTC_TOGGLE_CLK
+#endif
+
+/*
+ * Region of DDR scrubbed, owned by the caller. The members are managed by the
+ * functions below.
+ */
+typedef struct mss_ddr_scrub_region
+{
+    struct mss_ddr_scrub_region * next;
+    uint64_t cached;            /* Start in the cached window */
+    uint64_t non_cached;        /* Start in the non-cached window */
+    uint64_t length;
+    uint64_t offset;            /* Next chunk */
+    uint64_t passes;            /* Complete passes over the region */
+    uint64_t corrected;         /* Single bit errors, all passes */
+    uint64_t uncorrected;       /* Chunks with double bit errors, all passes */
+    uint64_t pass_corrected;    /* Single bit errors, current pass */
+    uint64_t last_pass_corrected;
+    uint64_t rewritten;         /* Chunks written back */
+    uint64_t first_mtime;       /* mtime when added */
+} mss_ddr_scrub_region_t;
+
+/***************************************************************************//**
+ * mss_ddr_scrub_init() removes all regions and sets the most bytes per second
+ * the scrubber reads. It returns ERROR if ECC is not enabled in the Libero
+ * DDR settings.
+ */
+uint8_t mss_ddr_scrub_init(uint64_t bytes_per_second);
+
+/***************************************************************************//**
+ * mss_ddr_scrub_add() adds length bytes of DDR starting at addr, in any DDR
+ * window, to the regions scrubbed. addr and length are multiples of
+ * MSS_DDR_SCRUB_CHUNK. It returns ERROR if the region is not mapped by both a
+ * cached and a non-cached window, which is set by the segmentation registers.
+ */
+uint8_t mss_ddr_scrub_add(mss_ddr_scrub_region_t * region, uint64_t addr,
+        uint64_t length);
+
+/***************************************************************************//**
+ * mss_ddr_scrub_run() scrubs the chunks the rate limit allows, region after
+ * region, and returns the number of bytes scrubbed.
+ */
+uint64_t mss_ddr_scrub_run(void);
+
+/***************************************************************************//**
+ * mss_ddr_scrub_errors_per_hour() returns the corrected error rate of a
+ * region since it was added, in errors per hour.
+ */
+uint64_t mss_ddr_scrub_errors_per_hour(const mss_ddr_scrub_region_t * region);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_DDR_SCRUB_H */
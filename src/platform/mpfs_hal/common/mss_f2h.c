@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_f2h.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Fabric to hart interrupt fast path
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define F2H_NUM_HARTS               (MPFS_HAL_LAST_HART + 1U)
+
+/* The F2H interrupts are local interrupts 16 to 47, mip bits 32 to 63 */
+#define F2H_FIRST_LOCAL_INT         16U
+#define F2H_MIP_SHIFT               32U
+
+typedef struct
+{
+    mss_f2h_handler_t handler;
+    void * arg;
+} f2h_entry_t;
+
+static f2h_entry_t g_f2h_entries[F2H_NUM_HARTS][MSS_F2H_LINES_PER_HART];
+/* Attached F2H interrupts of each hart, bit n for mip bit 32 + n */
+static uint32_t g_f2h_attached[F2H_NUM_HARTS];
+static mss_f2h_stats_t g_f2h_stats[F2H_NUM_HARTS];
+
+/*******************************************************************************
+ * Local functions
+ */
+static uint32_t f2h_dispatch(uint64_t hart_id, uint32_t pending);
+static uint32_t f2h_pending(uint64_t hart_id);
+
+/***************************************************************************//**
+ * See mss_f2h.h
+ */
+uint8_t mss_f2h_attach(uint32_t f2h, mss_f2h_handler_t handler, void * arg)
+{
+    uint8_t ret_val = ERROR;
+    uint64_t hart_id = read_csr(mhartid);
+    uint32_t bit = f2h % MSS_F2H_LINES_PER_HART;
+    uint64_t psr;
+
+    if((f2h < MSS_F2H_NUM_LINES) &&
+            ((0U == hart_id) == (f2h >= MSS_F2H_FIRST_E51)))
+    {
+        psr = disable_interrupts();
+
+        PLIC_DisableIRQ((PLIC_IRQn_Type)((uint32_t)FABRIC_F2H_0_PLIC + f2h));
+        g_f2h_entries[hart_id][bit].handler = handler;
+        g_f2h_entries[hart_id][bit].arg = arg;
+        g_f2h_attached[hart_id] |= (1UL << bit);
+        __enable_local_irq((uint8_t)(F2H_FIRST_LOCAL_INT + bit));
+
+        restore_interrupts(psr);
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_f2h.h
+ */
+void mss_f2h_detach(uint32_t f2h)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint32_t bit = f2h % MSS_F2H_LINES_PER_HART;
+    uint64_t psr = disable_interrupts();
+
+    __disable_local_irq((uint8_t)(F2H_FIRST_LOCAL_INT + bit));
+    g_f2h_attached[hart_id] &= ~(1UL << bit);
+    g_f2h_entries[hart_id][bit].handler = (mss_f2h_handler_t)0;
+
+    restore_interrupts(psr);
+}
+
+/***************************************************************************//**
+ * See mss_f2h.h
+ */
+void mss_f2h_mask(uint8_t mask)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t bits = (uint64_t)g_f2h_attached[hart_id] << F2H_MIP_SHIFT;
+
+    if(0U != mask)
+    {
+        clear_csr(mie, bits);
+    }
+    else
+    {
+        set_csr(mie, bits);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_f2h.h
+ */
+uint32_t mss_f2h_poll(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint32_t events = f2h_dispatch(hart_id, f2h_pending(hart_id));
+
+    g_f2h_stats[hart_id].polls++;
+    g_f2h_stats[hart_id].events += events;
+
+    return (events);
+}
+
+/***************************************************************************//**
+ * See mss_f2h.h
+ */
+uint8_t mss_f2h_local_isr(uint64_t hart_id, uint8_t local_interrupt_no)
+{
+    uint8_t handled = 0U;
+    uint32_t events = 0U;
+    uint32_t passes = 0U;
+    uint32_t pending;
+
+    if((local_interrupt_no >= F2H_FIRST_LOCAL_INT) && (0U !=
+            (g_f2h_attached[hart_id] &
+            (1UL << (local_interrupt_no - F2H_FIRST_LOCAL_INT)))))
+    {
+        pending = f2h_pending(hart_id);
+
+        while((0U != pending) && (passes < MSS_F2H_MAX_PASSES))
+        {
+            events += f2h_dispatch(hart_id, pending);
+            passes++;
+            pending = f2h_pending(hart_id);
+        }
+
+        g_f2h_stats[hart_id].traps++;
+        g_f2h_stats[hart_id].events += events;
+
+        if(events > g_f2h_stats[hart_id].max_batch)
+        {
+            g_f2h_stats[hart_id].max_batch = events;
+        }
+
+        handled = 1U;
+    }
+
+    return (handled);
+}
+
+/***************************************************************************//**
+ * See mss_f2h.h
+ */
+void mss_f2h_get_stats(uint32_t hart_id, mss_f2h_stats_t * stats)
+{
+    ASSERT(hart_id < F2H_NUM_HARTS);
+
+    *stats = g_f2h_stats[hart_id];
+}
+
+/***************************************************************************//**
+ * Calls the handler of each F2H interrupt in pending, lowest first.
+ */
+static uint32_t f2h_dispatch(uint64_t hart_id, uint32_t pending)
+{
+    uint32_t events = 0U;
+    uint32_t base = (0U == hart_id) ? MSS_F2H_FIRST_E51 : 0U;
+    uint32_t bit;
+    f2h_entry_t * entry;
+
+    while(0U != pending)
+    {
+        bit = (uint32_t)__builtin_ctz(pending);
+        pending &= pending - 1U;
+        entry = &g_f2h_entries[hart_id][bit];
+
+        if((mss_f2h_handler_t)0 != entry->handler)
+        {
+            entry->handler(base + bit, entry->arg);
+            events++;
+        }
+    }
+
+    return (events);
+}
+
+/***************************************************************************//**
+ * The attached F2H interrupts pending on a hart, from one read of mip.
+ */
+static uint32_t f2h_pending(uint64_t hart_id)
+{
+    return ((uint32_t)(read_csr(mip) >> F2H_MIP_SHIFT) &
+            g_f2h_attached[hart_id]);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_f2h.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Fabric to hart interrupt fast path
+ *
+ * The 64 fabric to hart (F2H) interrupts go to the PLIC, and are also wired
+ * to the local interrupts of the harts: F2H 0 to 31 to local interrupts 16 to
+ * 47 of each U54, F2H 32 to 63 to local interrupts 16 to 47 of the E51. A
+ * local interrupt traps straight to the hart, with no PLIC claim and complete,
+ * and is pending in bit 32 + (F2H & 31) of mip of the hart.
+ *
+ * mss_f2h_attach() routes an F2H interrupt to the calling hart through its
+ * local interrupt, disabling the PLIC source on that hart, and sets the
+ * handler called for it. When MPFS_HAL_F2H_FAST_PATH is defined in
+ * mss_sw_config.h, the trap of any attached F2H interrupt reads mip once and
+ * calls the handlers of all the attached F2H interrupts pending, reading mip
+ * again until none are pending, up to MSS_F2H_MAX_PASSES times. A burst of
+ * fabric doorbells on several lines is so taken in one trap. Without
+ * MPFS_HAL_F2H_FAST_PATH the fabric_f2h_N_u54_local_IRQHandler_M() and
+ * fabric_f2h_N_e51_local_IRQHandler_M() handlers are called as before.
+ *
+ * mss_f2h_poll() calls the handlers of the attached F2H interrupts pending
+ * without a trap, e.g. from a loop with the local interrupts disabled using
+ * mss_f2h_mask(), for doorbells at a rate where taking a trap for each burst
+ * costs more than polling.
+ *
+ * The F2H interrupts are levels: a handler clears the source in the fabric
+ * before it returns, or the interrupt stays pending.
+ *
+ * Example, doorbells of an accelerator on F2H 4 handled by U54_1:
+ * @code
+ *   static void doorbell(uint32_t f2h, void * arg)
+ *   {
+ *       accel_ack((accel_t *)arg);
+ *   }
+ *
+ *   void u54_1(void)
+ *   {
+ *       (void)mss_f2h_attach(4U, doorbell, &g_accel);
+ *       __enable_irq();
+ *       ...
+ *   }
+ * @endcode
+ */
+#ifndef MSS_F2H_H
+#define MSS_F2H_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Most times the trap of an attached F2H interrupt reads mip for more
+ * pending interrupts
+ */
+#ifndef MSS_F2H_MAX_PASSES
+#define MSS_F2H_MAX_PASSES              8U
+#endif
+
+/*
+ * The F2H interrupts of the E51 and of each U54
+ */
+#define MSS_F2H_FIRST_E51               32U
+#define MSS_F2H_NUM_LINES               64U
+#define MSS_F2H_LINES_PER_HART          32U
+
+typedef void (*mss_f2h_handler_t)(uint32_t f2h, void * arg);
+
+typedef struct
+{
+    uint64_t traps;             /* Traps taken by the fast path */
+    uint64_t polls;             /* mss_f2h_poll() calls */
+    uint64_t events;            /* Handlers called */
+    uint32_t max_batch;         /* Most handlers called in one trap */
+} mss_f2h_stats_t;
+
+/***************************************************************************//**
+ * mss_f2h_attach() routes F2H interrupt f2h to the local interrupt of the
+ * calling hart, calling handler with arg for it, and disables its PLIC source
+ * on the calling hart. F2H 0 to 31 can be attached on the U54s, F2H 32 to 63
+ * on the E51 only. The local interrupt is enabled, interrupts must also be
+ * enabled on the hart for it to be taken.
+ *
+ * @return
+ *   SUCCESS, or ERROR if f2h is not wired to the calling hart.
+ */
+uint8_t mss_f2h_attach(uint32_t f2h, mss_f2h_handler_t handler, void * arg);
+
+/***************************************************************************//**
+ * mss_f2h_detach() disables the local interrupt of F2H interrupt f2h on the
+ * calling hart and removes its handler. The PLIC source is left disabled.
+ */
+void mss_f2h_detach(uint32_t f2h);
+
+/***************************************************************************//**
+ * mss_f2h_mask() disables, mask 1, or enables again, mask 0, the local
+ * interrupts of all the F2H interrupts attached on the calling hart, e.g.
+ * while it polls them with mss_f2h_poll().
+ */
+void mss_f2h_mask(uint8_t mask);
+
+/***************************************************************************//**
+ * mss_f2h_poll() calls the handlers of the F2H interrupts attached on the
+ * calling hart which are pending, once each.
+ *
+ * @return
+ *   The number of handlers called.
+ */
+uint32_t mss_f2h_poll(void);
+
+/***************************************************************************//**
+ * mss_f2h_local_isr() is called by the trap handler for local interrupts
+ * 16 to 47 when MPFS_HAL_F2H_FAST_PATH is defined. It calls the handlers of
+ * all the attached F2H interrupts pending.
+ *
+ * @return
+ *   1 if the F2H interrupt of the local interrupt is attached and the trap has
+ *   been handled, else 0 for the local interrupt handler to be called.
+ */
+uint8_t mss_f2h_local_isr(uint64_t hart_id, uint8_t local_interrupt_no);
+
+/***************************************************************************//**
+ * mss_f2h_get_stats() copies the statistics of a hart to stats.
+ */
+void mss_f2h_get_stats(uint32_t hart_id, mss_f2h_stats_t * stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_F2H_H */
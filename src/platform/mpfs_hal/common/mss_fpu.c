@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_fpu.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Floating point context for interrupt handlers
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__riscv_flen) && (__riscv_flen == 64)
+#define FPU_STORE       "fsd"
+#define FPU_LOAD        "fld"
+#elif defined(__riscv_flen)
+#define FPU_STORE       "fsw"
+#define FPU_LOAD        "flw"
+#endif
+
+/***************************************************************************//**
+ * See mss_fpu.h
+ */
+void mss_fpu_call(mss_fpu_fn_t fn, void * arg)
+{
+#ifdef __riscv_flen
+    uint64_t regs[32];
+    uint64_t fcsr = 0U;
+    uint64_t fs = read_csr(mstatus) & MSTATUS_FS;
+
+    if (MSTATUS_FS == fs)
+    {
+        __asm__ __volatile__(
+        FPU_STORE " f0, 0(%0)\n\t"
+        FPU_STORE " f1, 8(%0)\n\t"
+        FPU_STORE " f2, 16(%0)\n\t"
+        FPU_STORE " f3, 24(%0)\n\t"
+        FPU_STORE " f4, 32(%0)\n\t"
+        FPU_STORE " f5, 40(%0)\n\t"
+        FPU_STORE " f6, 48(%0)\n\t"
+        FPU_STORE " f7, 56(%0)\n\t"
+        FPU_STORE " f8, 64(%0)\n\t"
+        FPU_STORE " f9, 72(%0)\n\t"
+        FPU_STORE " f10, 80(%0)\n\t"
+        FPU_STORE " f11, 88(%0)\n\t"
+        FPU_STORE " f12, 96(%0)\n\t"
+        FPU_STORE " f13, 104(%0)\n\t"
+        FPU_STORE " f14, 112(%0)\n\t"
+        FPU_STORE " f15, 120(%0)\n\t"
+        FPU_STORE " f16, 128(%0)\n\t"
+        FPU_STORE " f17, 136(%0)\n\t"
+        FPU_STORE " f18, 144(%0)\n\t"
+        FPU_STORE " f19, 152(%0)\n\t"
+        FPU_STORE " f20, 160(%0)\n\t"
+        FPU_STORE " f21, 168(%0)\n\t"
+        FPU_STORE " f22, 176(%0)\n\t"
+        FPU_STORE " f23, 184(%0)\n\t"
+        FPU_STORE " f24, 192(%0)\n\t"
+        FPU_STORE " f25, 200(%0)\n\t"
+        FPU_STORE " f26, 208(%0)\n\t"
+        FPU_STORE " f27, 216(%0)\n\t"
+        FPU_STORE " f28, 224(%0)\n\t"
+        FPU_STORE " f29, 232(%0)\n\t"
+        FPU_STORE " f30, 240(%0)\n\t"
+        FPU_STORE " f31, 248(%0)\n\t"
+        : : "r"(regs) : "memory");
+        __asm__ __volatile__("frcsr %0" : "=r"(fcsr));
+    }
+
+    fn(arg);
+
+    if (MSTATUS_FS == fs)
+    {
+        __asm__ __volatile__(
+        FPU_LOAD " f0, 0(%0)\n\t"
+        FPU_LOAD " f1, 8(%0)\n\t"
+        FPU_LOAD " f2, 16(%0)\n\t"
+        FPU_LOAD " f3, 24(%0)\n\t"
+        FPU_LOAD " f4, 32(%0)\n\t"
+        FPU_LOAD " f5, 40(%0)\n\t"
+        FPU_LOAD " f6, 48(%0)\n\t"
+        FPU_LOAD " f7, 56(%0)\n\t"
+        FPU_LOAD " f8, 64(%0)\n\t"
+        FPU_LOAD " f9, 72(%0)\n\t"
+        FPU_LOAD " f10, 80(%0)\n\t"
+        FPU_LOAD " f11, 88(%0)\n\t"
+        FPU_LOAD " f12, 96(%0)\n\t"
+        FPU_LOAD " f13, 104(%0)\n\t"
+        FPU_LOAD " f14, 112(%0)\n\t"
+        FPU_LOAD " f15, 120(%0)\n\t"
+        FPU_LOAD " f16, 128(%0)\n\t"
+        FPU_LOAD " f17, 136(%0)\n\t"
+        FPU_LOAD " f18, 144(%0)\n\t"
+        FPU_LOAD " f19, 152(%0)\n\t"
+        FPU_LOAD " f20, 160(%0)\n\t"
+        FPU_LOAD " f21, 168(%0)\n\t"
+        FPU_LOAD " f22, 176(%0)\n\t"
+        FPU_LOAD " f23, 184(%0)\n\t"
+        FPU_LOAD " f24, 192(%0)\n\t"
+        FPU_LOAD " f25, 200(%0)\n\t"
+        FPU_LOAD " f26, 208(%0)\n\t"
+        FPU_LOAD " f27, 216(%0)\n\t"
+        FPU_LOAD " f28, 224(%0)\n\t"
+        FPU_LOAD " f29, 232(%0)\n\t"
+        FPU_LOAD " f30, 240(%0)\n\t"
+        FPU_LOAD " f31, 248(%0)\n\t"
+        : : "r"(regs) : "memory");
+        __asm__ __volatile__("fscsr %0" : : "r"(fcsr));
+    }
+
+    /* Back to the state of the code interrupted, e.g. initial */
+    clear_csr(mstatus, MSTATUS_FS);
+    set_csr(mstatus, fs);
+#else
+    fn(arg);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_fpu.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Floating point context for interrupt handlers
+ *
+ * The trap entry code saves the integer registers only, so an interrupt
+ * handler, or a function it calls, must not use floating point unless the
+ * floating point registers of the code it interrupted are preserved.
+ * mss_fpu_call() calls a function with them preserved, so the handlers which
+ * use floating point pay for it and the others do not.
+ *
+ * The registers are only saved when the FS field of mstatus is dirty, i.e.
+ * when the code interrupted has written them. FS is set to dirty at start up
+ * unless MPFS_HAL_FPU_LAZY is defined in mss_sw_config.h, in which case it is
+ * set to initial and only becomes dirty once the code of the hart uses
+ * floating point. On return the registers and FS are put back as they were.
+ *
+ * Example:
+ * @code
+ *   static void control_loop(void * arg)
+ *   {
+ *       g_output = g_gain * (float)read_adc();
+ *   }
+ *
+ *   uint8_t timer1_plic_IRQHandler(void)
+ *   {
+ *       MSS_TIM1_clear_irq();
+ *       mss_fpu_call(control_loop, 0);
+ *       return EXT_IRQ_KEEP_ENABLED;
+ *   }
+ * @endcode
+ */
+#ifndef MSS_FPU_H
+#define MSS_FPU_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*mss_fpu_fn_t)(void * arg);
+
+/***************************************************************************//**
+ * mss_fpu_call() calls fn(arg), saving the floating point registers and fcsr
+ * before and restoring them after if mstatus.FS is dirty. The caller must not
+ * use floating point itself, as the registers are only saved once it has been
+ * called. On the E51 or a build without floating point it just calls fn.
+ */
+void mss_fpu_call(mss_fpu_fn_t fn, void * arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_FPU_H */
@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_hart_heap.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Per-hart heap arenas
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HART_HEAP_NUM_ARENAS    5U
+#define HART_HEAP_ALIGN         16U
+#define HART_HEAP_MIN_BLOCK     (2U * sizeof(hart_heap_block_t))
+#define HART_HEAP_OWNER_MAGIC   0xA110C000UL
+
+/*
+ * Header of each block. Free blocks link to the next free block, allocated
+ * blocks record the arena they belong to.
+ */
+typedef struct hart_heap_block
+{
+    size_t size;
+    union
+    {
+        struct hart_heap_block * next;
+        uint64_t owner;
+    } u;
+} hart_heap_block_t;
+
+typedef struct
+{
+    hart_heap_block_t * free_list;
+    uint8_t initialised;
+    volatile long lock;
+} hart_heap_arena_t;
+
+extern char __heap_start_h0;
+extern char __heap_end_h0;
+extern char __heap_start_h1;
+extern char __heap_end_h1;
+extern char __heap_start_h2;
+extern char __heap_end_h2;
+extern char __heap_start_h3;
+extern char __heap_end_h3;
+extern char __heap_start_h4;
+extern char __heap_end_h4;
+
+static char * const g_arena_start[HART_HEAP_NUM_ARENAS] =
+{
+    &__heap_start_h0, &__heap_start_h1, &__heap_start_h2, &__heap_start_h3,
+    &__heap_start_h4
+};
+
+static char * const g_arena_end[HART_HEAP_NUM_ARENAS] =
+{
+    &__heap_end_h0, &__heap_end_h1, &__heap_end_h2, &__heap_end_h3,
+    &__heap_end_h4
+};
+
+static hart_heap_arena_t g_arena[HART_HEAP_NUM_ARENAS];
+
+/*
+ * Lock an arena, setting it up with a single free block on first use.
+ */
+static uint64_t arena_lock(uint32_t hart_id)
+{
+    hart_heap_arena_t * arena = &g_arena[hart_id];
+    uintptr_t start;
+    uintptr_t end;
+    uint64_t mstatus;
+
+    mstatus = disable_interrupts();
+    spinlock(&arena->lock);
+
+    if (0U == arena->initialised)
+    {
+        start = ((uintptr_t)g_arena_start[hart_id] + (HART_HEAP_ALIGN - 1U)) &
+                ~((uintptr_t)HART_HEAP_ALIGN - 1U);
+        end = (uintptr_t)g_arena_end[hart_id] &
+                ~((uintptr_t)HART_HEAP_ALIGN - 1U);
+        arena->free_list = (hart_heap_block_t *)0;
+
+        if ((end > start) && ((end - start) >= HART_HEAP_MIN_BLOCK))
+        {
+            arena->free_list = (hart_heap_block_t *)start;
+            arena->free_list->size = end - start;
+            arena->free_list->u.next = (hart_heap_block_t *)0;
+        }
+
+        arena->initialised = 1U;
+    }
+
+    return (mstatus);
+}
+
+static void arena_unlock(uint32_t hart_id, uint64_t mstatus)
+{
+    mb();
+    spinunlock(&g_arena[hart_id].lock);
+    restore_interrupts(mstatus);
+}
+
+/***************************************************************************//**
+ * See mss_hart_heap.h
+ */
+void * mss_hart_malloc(size_t size)
+{
+    uint32_t hart_id = (uint32_t)read_csr(mhartid);
+    hart_heap_block_t ** link;
+    hart_heap_block_t * block = (hart_heap_block_t *)0;
+    hart_heap_block_t * rest;
+    size_t needed;
+    uint64_t mstatus;
+
+    if ((hart_id < HART_HEAP_NUM_ARENAS) && (0U != size) &&
+        (size <= ((size_t)-1 - (2U * HART_HEAP_ALIGN))))
+    {
+        needed = ((size + (HART_HEAP_ALIGN - 1U)) &
+                  ~((size_t)HART_HEAP_ALIGN - 1U)) + sizeof(hart_heap_block_t);
+
+        mstatus = arena_lock(hart_id);
+
+        /* First fit */
+        link = &g_arena[hart_id].free_list;
+        while (((hart_heap_block_t *)0 != *link) && ((*link)->size < needed))
+        {
+            link = &(*link)->u.next;
+        }
+
+        if ((hart_heap_block_t *)0 != *link)
+        {
+            block = *link;
+
+            if ((block->size - needed) >= HART_HEAP_MIN_BLOCK)
+            {
+                rest = (hart_heap_block_t *)((uint8_t *)block + needed);
+                rest->size = block->size - needed;
+                rest->u.next = block->u.next;
+                block->size = needed;
+                *link = rest;
+            }
+            else
+            {
+                *link = block->u.next;
+            }
+
+            block->u.owner = HART_HEAP_OWNER_MAGIC | hart_id;
+        }
+
+        arena_unlock(hart_id, mstatus);
+    }
+
+    return (((hart_heap_block_t *)0 != block) ?
+            (void *)(block + 1) : (void *)0);
+}
+
+/***************************************************************************//**
+ * See mss_hart_heap.h
+ */
+void mss_hart_free(void * ptr)
+{
+    hart_heap_block_t * block;
+    hart_heap_block_t * prev = (hart_heap_block_t *)0;
+    hart_heap_block_t * next;
+    uint32_t hart_id;
+    uint64_t mstatus;
+
+    if ((void *)0 != ptr)
+    {
+        block = (hart_heap_block_t *)ptr - 1;
+        hart_id = (uint32_t)(block->u.owner & 0xFFFU);
+
+        ASSERT((block->u.owner & ~0xFFFULL) == HART_HEAP_OWNER_MAGIC);
+
+        if (((block->u.owner & ~0xFFFULL) == HART_HEAP_OWNER_MAGIC) &&
+            (hart_id < HART_HEAP_NUM_ARENAS))
+        {
+            mstatus = arena_lock(hart_id);
+
+            /* Keep the free list in address order */
+            next = g_arena[hart_id].free_list;
+            while (((hart_heap_block_t *)0 != next) && (next < block))
+            {
+                prev = next;
+                next = next->u.next;
+            }
+
+            block->u.next = next;
+
+            if (((hart_heap_block_t *)0 != next) &&
+                (((uint8_t *)block + block->size) == (uint8_t *)next))
+            {
+                block->size += next->size;
+                block->u.next = next->u.next;
+            }
+
+            if ((hart_heap_block_t *)0 == prev)
+            {
+                g_arena[hart_id].free_list = block;
+            }
+            else if (((uint8_t *)prev + prev->size) == (uint8_t *)block)
+            {
+                prev->size += block->size;
+                prev->u.next = block->u.next;
+            }
+            else
+            {
+                prev->u.next = block;
+            }
+
+            arena_unlock(hart_id, mstatus);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_hart_heap.h
+ */
+size_t mss_hart_heap_free_bytes(uint32_t hart_id)
+{
+    hart_heap_block_t * block;
+    size_t free_bytes = 0U;
+    uint64_t mstatus;
+
+    if (hart_id < HART_HEAP_NUM_ARENAS)
+    {
+        mstatus = arena_lock(hart_id);
+
+        for (block = g_arena[hart_id].free_list;
+             (hart_heap_block_t *)0 != block; block = block->u.next)
+        {
+            free_bytes += block->size;
+        }
+
+        arena_unlock(hart_id, mstatus);
+    }
+
+    return (free_bytes);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_hart_heap.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Per-hart heap arenas
+ *
+ * The newlib heap is shared by all the harts and serialised by the malloc lock
+ * in newlib_stubs.c, so harts allocating at the same time wait for each other.
+ * mss_hart_malloc() instead allocates from an arena owned by the calling hart,
+ * set in the linker script by HEAP_SIZE_E51_ARENA to HEAP_SIZE_U54_4_ARENA,
+ * between the __heap_start_hN and __heap_end_hN symbols.
+ *
+ * Each arena has its own lock, so harts only contend when one frees a block
+ * allocated by another, which mss_hart_free() supports. Interrupts are disabled
+ * while the lock is held, so the functions can be called from interrupt
+ * handlers. The free blocks of an arena are kept in address order and merged
+ * with their neighbours when freed. Allocations are 16 byte aligned and use 16
+ * bytes of the arena for their header.
+ */
+#ifndef MSS_HART_HEAP_H
+#define MSS_HART_HEAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * mss_hart_malloc() returns size bytes from the arena of the calling hart, or
+ * a null pointer when the arena has no free block large enough.
+ */
+void * mss_hart_malloc(size_t size);
+
+/***************************************************************************//**
+ * mss_hart_free() returns a block allocated by mss_hart_malloc() on any hart to
+ * the arena it was allocated from.
+ */
+void mss_hart_free(void * ptr);
+
+/***************************************************************************//**
+ * mss_hart_heap_free_bytes() returns the number of bytes free in the arena of
+ * a hart, including the block headers.
+ */
+size_t mss_hart_heap_free_bytes(uint32_t hart_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_HART_HEAP_H */
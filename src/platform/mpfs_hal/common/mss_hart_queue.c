@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_hart_queue.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Lock-free hart to hart message queues and doorbells
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+void mss_doorbell_init(mss_doorbell_t * doorbell)
+{
+    uint32_t inc;
+
+    for(inc = 0U; inc < MSS_HART_QUEUE_NUM_HARTS; inc++)
+    {
+        doorbell->pending[inc] = 0U;
+    }
+
+    mb();
+}
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+void mss_doorbell_ring(mss_doorbell_t * doorbell, uint32_t hart_id,
+        uint64_t channels)
+{
+    if((hart_id < MSS_HART_QUEUE_NUM_HARTS) && (0U != channels))
+    {
+        if(0U == atomic_or(&doorbell->pending[hart_id], channels))
+        {
+            raise_soft_interrupt(hart_id);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+uint64_t mss_doorbell_take(mss_doorbell_t * doorbell)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t channels = 0U;
+
+    if(hart_id < MSS_HART_QUEUE_NUM_HARTS)
+    {
+        channels = atomic_swap(&doorbell->pending[hart_id], 0U);
+    }
+
+    return (channels);
+}
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+uint8_t mss_spsc_init(mss_spsc_queue_t * queue, uint64_t * slots,
+        uint32_t capacity)
+{
+    uint8_t ret_val = ERROR;
+
+    if((0U != capacity) && (0U == (capacity & (capacity - 1U))) &&
+       (capacity <= 0x80000000U))
+    {
+        queue->head = 0U;
+        queue->tail = 0U;
+        queue->slots = slots;
+        queue->mask = capacity - 1U;
+        queue->doorbell = (mss_doorbell_t *)0;
+        mb();
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+void mss_spsc_set_doorbell(mss_spsc_queue_t * queue, mss_doorbell_t * doorbell,
+        uint32_t hart_id, uint64_t channels)
+{
+    queue->hart_id = hart_id;
+    queue->channels = channels;
+    mb();
+    queue->doorbell = doorbell;
+}
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+uint32_t mss_spsc_push(mss_spsc_queue_t * queue, const uint64_t * messages,
+        uint32_t count)
+{
+    uint32_t head = queue->head;
+    uint32_t space = (queue->mask + 1U) - (head - queue->tail);
+    uint32_t inc;
+
+    if(count > space)
+    {
+        count = space;
+    }
+
+    if(0U != count)
+    {
+        for(inc = 0U; inc < count; inc++)
+        {
+            queue->slots[(head + inc) & queue->mask] = messages[inc];
+        }
+
+        /* Publish the messages, then look at whether the consumer had caught up */
+        mb();
+        queue->head = head + count;
+        mb();
+
+        if(((mss_doorbell_t *)0 != queue->doorbell) && (queue->tail == head))
+        {
+            mss_doorbell_ring(queue->doorbell, queue->hart_id, queue->channels);
+        }
+    }
+
+    return (count);
+}
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+uint32_t mss_spsc_pop(mss_spsc_queue_t * queue, uint64_t * messages,
+        uint32_t count)
+{
+    uint32_t tail = queue->tail;
+    uint32_t used = queue->head - tail;
+    uint32_t inc;
+
+    if(count > used)
+    {
+        count = used;
+    }
+
+    if(0U != count)
+    {
+        mb();
+
+        for(inc = 0U; inc < count; inc++)
+        {
+            messages[inc] = queue->slots[(tail + inc) & queue->mask];
+        }
+
+        /*
+         * Release the slots. The fence orders this against the next read of
+         * the head, which the producer relies on to decide whether to ring.
+         */
+        mb();
+        queue->tail = tail + count;
+        mb();
+    }
+
+    return (count);
+}
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+uint8_t mss_mpsc_init(mss_mpsc_queue_t * queue, mss_mpsc_slot_t * slots,
+        uint64_t capacity)
+{
+    uint64_t inc;
+    uint8_t ret_val = ERROR;
+
+    if((0U != capacity) && (0U == (capacity & (capacity - 1U))))
+    {
+        for(inc = 0U; inc < capacity; inc++)
+        {
+            slots[inc].sequence = inc;
+        }
+
+        queue->head = 0U;
+        queue->tail = 0U;
+        queue->slots = slots;
+        queue->mask = capacity - 1U;
+        queue->doorbell = (mss_doorbell_t *)0;
+        mb();
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+void mss_mpsc_set_doorbell(mss_mpsc_queue_t * queue, mss_doorbell_t * doorbell,
+        uint32_t hart_id, uint64_t channels)
+{
+    queue->hart_id = hart_id;
+    queue->channels = channels;
+    mb();
+    queue->doorbell = doorbell;
+}
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+uint32_t mss_mpsc_push(mss_mpsc_queue_t * queue, const uint64_t * messages,
+        uint32_t count)
+{
+    mss_mpsc_slot_t * slot;
+    uint64_t head;
+    int64_t diff;
+    uint32_t pushed = 0U;
+
+    while(pushed < count)
+    {
+        head = queue->head;
+        slot = &queue->slots[head & queue->mask];
+        diff = (int64_t)(slot->sequence - head);
+
+        if(diff < 0)
+        {
+            /* The consumer has not released the slot yet: full */
+            break;
+        }
+
+        if((0 == diff) && (0 != atomic_cas(&queue->head, head, head + 1U)))
+        {
+            slot->message = messages[pushed];
+            mb();
+            slot->sequence = head + 1U;
+            pushed++;
+        }
+    }
+
+    if((0U != pushed) && ((mss_doorbell_t *)0 != queue->doorbell))
+    {
+        mss_doorbell_ring(queue->doorbell, queue->hart_id, queue->channels);
+    }
+
+    return (pushed);
+}
+
+/***************************************************************************//**
+ * See mss_hart_queue.h
+ */
+uint32_t mss_mpsc_pop(mss_mpsc_queue_t * queue, uint64_t * messages,
+        uint32_t count)
+{
+    mss_mpsc_slot_t * slot;
+    uint32_t popped = 0U;
+
+    while(popped < count)
+    {
+        slot = &queue->slots[queue->tail & queue->mask];
+
+        if(slot->sequence != (queue->tail + 1U))
+        {
+            /* Empty, or the next message is still being written */
+            break;
+        }
+
+        mb();
+        messages[popped] = slot->message;
+        mb();
+        slot->sequence = queue->tail + queue->mask + 1U;
+        queue->tail++;
+        popped++;
+    }
+
+    return (popped);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_hart_queue.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Lock-free hart to hart message queues and doorbells
+ *
+ * The queues pass 64-bit messages, typically buffer pointers, between harts
+ * without locks. They live in memory provided by the application, which, when
+ * the harts run separate images, is the area pointed to by hls->shared_mem
+ * with MPFS_HAL_SHARED_MEM_ENABLED defined.
+ *
+ * A single producer single consumer queue, mss_spsc_queue_t, keeps the index
+ * written by the producer and the index written by the consumer in separate
+ * cache lines, so each hart only reads the line the other writes.
+ * A multiple producer single consumer queue, mss_mpsc_queue_t, lets any number
+ * of harts push. Each slot holds a sequence number which tells the consumer
+ * when the message in it is complete, so a producer stalled between claiming
+ * and filling a slot only delays the messages after it.
+ *
+ * A doorbell, mss_doorbell_t, signals a hart with the software interrupt. Each
+ * hart has a 64-bit mask of pending channels. mss_doorbell_ring() sets channels
+ * and raises the software interrupt only if the hart had none pending, so any
+ * number of rings before the hart takes them cost a single interrupt.
+ * mss_doorbell_take(), called from the Software_hN_IRQHandler() of the hart,
+ * returns and clears the pending channels.
+ *
+ * A queue given a doorbell with mss_spsc_set_doorbell() or
+ * mss_mpsc_set_doorbell() rings its channel at the end of each push call which
+ * added messages, once per call however many were pushed. An SPSC queue only
+ * rings when the consumer had already emptied it, as a consumer which is not
+ * waiting will find the messages anyway.
+ *
+ * Example, U54_1 feeding U54_2:
+ * @code
+ *   // u54_1
+ *   (void)mss_spsc_init(&g_shared->q12, g_shared->q12_slots, 256U);
+ *   mss_spsc_set_doorbell(&g_shared->q12, &g_shared->doorbell, 2U, 0x1U);
+ *   (void)mss_spsc_push(&g_shared->q12, &msg, 1U);
+ *
+ *   // u54_2
+ *   void Software_h2_IRQHandler(void)
+ *   {
+ *       if (0U != (mss_doorbell_take(&g_shared->doorbell) & 0x1U))
+ *       {
+ *           while (0U != mss_spsc_pop(&g_shared->q12, &msg, 1U))
+ *           {
+ *               process(msg);
+ *           }
+ *       }
+ *   }
+ * @endcode
+ * The software interrupt must be enabled on the consumer hart with
+ * set_csr(mie, MIP_MSIP).
+ */
+#ifndef MSS_HART_QUEUE_H
+#define MSS_HART_QUEUE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MSS_HART_QUEUE_NUM_HARTS        5U
+#define MSS_HART_QUEUE_LINE_BYTES       64U
+
+typedef struct
+{
+    volatile uint64_t pending[MSS_HART_QUEUE_NUM_HARTS];
+} mss_doorbell_t;
+
+typedef struct
+{
+    volatile uint32_t head;
+    uint8_t head_line[MSS_HART_QUEUE_LINE_BYTES - sizeof(uint32_t)];
+    volatile uint32_t tail;
+    uint8_t tail_line[MSS_HART_QUEUE_LINE_BYTES - sizeof(uint32_t)];
+    uint64_t * slots;
+    uint32_t mask;
+    uint32_t hart_id;
+    uint64_t channels;
+    mss_doorbell_t * doorbell;
+} __attribute__((aligned(MSS_HART_QUEUE_LINE_BYTES))) mss_spsc_queue_t;
+
+typedef struct
+{
+    volatile uint64_t sequence;
+    uint64_t message;
+} mss_mpsc_slot_t;
+
+typedef struct
+{
+    volatile uint64_t head;
+    uint8_t head_line[MSS_HART_QUEUE_LINE_BYTES - sizeof(uint64_t)];
+    uint64_t tail;
+    mss_mpsc_slot_t * slots;
+    uint64_t mask;
+    uint32_t hart_id;
+    uint64_t channels;
+    mss_doorbell_t * doorbell;
+} __attribute__((aligned(MSS_HART_QUEUE_LINE_BYTES))) mss_mpsc_queue_t;
+
+/***************************************************************************//**
+ * mss_doorbell_init() clears the pending channels of all the harts.
+ */
+void mss_doorbell_init(mss_doorbell_t * doorbell);
+
+/***************************************************************************//**
+ * mss_doorbell_ring() sets channels pending for a hart, and raises its
+ * software interrupt if it had no channels pending.
+ */
+void mss_doorbell_ring(mss_doorbell_t * doorbell, uint32_t hart_id,
+        uint64_t channels);
+
+/***************************************************************************//**
+ * mss_doorbell_take() returns and clears the channels pending for the calling
+ * hart.
+ */
+uint64_t mss_doorbell_take(mss_doorbell_t * doorbell);
+
+/***************************************************************************//**
+ * mss_spsc_init() sets up an empty SPSC queue using capacity slots, a power of
+ * two. It returns ERROR for an invalid capacity. It must be called before the
+ * queue is used by either hart.
+ */
+uint8_t mss_spsc_init(mss_spsc_queue_t * queue, uint64_t * slots,
+        uint32_t capacity);
+
+/***************************************************************************//**
+ * mss_spsc_set_doorbell() makes the producer ring channels of the doorbell of
+ * the consumer hart when it pushes to an empty queue. A null doorbell stops
+ * the notifications.
+ */
+void mss_spsc_set_doorbell(mss_spsc_queue_t * queue, mss_doorbell_t * doorbell,
+        uint32_t hart_id, uint64_t channels);
+
+/***************************************************************************//**
+ * mss_spsc_push() adds up to count messages to the queue, as many as there is
+ * room for, and returns the number added. It must only be called by the
+ * producer.
+ */
+uint32_t mss_spsc_push(mss_spsc_queue_t * queue, const uint64_t * messages,
+        uint32_t count);
+
+/***************************************************************************//**
+ * mss_spsc_pop() removes up to count messages from the queue and returns the
+ * number removed. It must only be called by the consumer.
+ */
+uint32_t mss_spsc_pop(mss_spsc_queue_t * queue, uint64_t * messages,
+        uint32_t count);
+
+/***************************************************************************//**
+ * mss_mpsc_init() sets up an empty MPSC queue using capacity slots, a power of
+ * two. It returns ERROR for an invalid capacity.
+ */
+uint8_t mss_mpsc_init(mss_mpsc_queue_t * queue, mss_mpsc_slot_t * slots,
+        uint64_t capacity);
+
+/***************************************************************************//**
+ * mss_mpsc_set_doorbell() makes the producers ring channels of the doorbell of
+ * the consumer hart after each push. A null doorbell stops the notifications.
+ */
+void mss_mpsc_set_doorbell(mss_mpsc_queue_t * queue, mss_doorbell_t * doorbell,
+        uint32_t hart_id, uint64_t channels);
+
+/***************************************************************************//**
+ * mss_mpsc_push() adds up to count messages to the queue as for
+ * mss_spsc_push(). It can be called by any hart and from interrupt handlers.
+ */
+uint32_t mss_mpsc_push(mss_mpsc_queue_t * queue, const uint64_t * messages,
+        uint32_t count);
+
+/***************************************************************************//**
+ * mss_mpsc_pop() removes up to count messages from the queue and returns the
+ * number removed. It must only be called by the consumer.
+ */
+uint32_t mss_mpsc_pop(mss_mpsc_queue_t * queue, uint64_t * messages,
+        uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_HART_QUEUE_H */
@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_idle.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Low power idle and RTC disciplined clock
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+#ifdef MSS_IDLE_RTC
+#include "drivers/mss/mss_rtc/mss_rtc.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IDLE_NUM_HARTS              (MPFS_HAL_LAST_HART + 1U)
+
+static mss_idle_stats_t g_idle_stats[IDLE_NUM_HARTS];
+
+#ifdef MSS_IDLE_RTC
+static uint64_t g_clock_rtc_hz = 1U;
+static uint64_t g_clock_rtc_base = 0U;
+/* The clock is mtime plus the offset, modulo 2^64 */
+static uint64_t g_clock_offset = 0U;
+static uint64_t g_clock_last = 0U;
+#endif
+
+/*******************************************************************************
+ * Local functions
+ */
+static void idle_wfi(uint64_t hart_id);
+#ifdef MSS_IDLE_RTC
+static void clock_edge(uint64_t * rtc, uint64_t * mtime);
+#endif
+
+/***************************************************************************//**
+ * See mss_idle.h
+ */
+uint8_t mss_idle_wait(uint64_t deadline)
+{
+    uint8_t reason = MSS_IDLE_WAKE_DEADLINE;
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t psr = disable_interrupts();
+    uint64_t saved_mie = read_csr(mie);
+    uint64_t saved_cmp = CLINT->MTIMECMP[hart_id];
+
+    if(readmtime() < deadline)
+    {
+        if(MSS_IDLE_FOREVER != deadline)
+        {
+            /* Only bring the timer interrupt forward */
+            if((0U == (saved_mie & MIP_MTIP)) || (deadline < saved_cmp))
+            {
+                CLINT->MTIMECMP[hart_id] = deadline;
+            }
+
+            set_csr(mie, MIP_MTIP);
+        }
+
+        idle_wfi(hart_id);
+
+        CLINT->MTIMECMP[hart_id] = saved_cmp;
+        write_csr(mie, saved_mie);
+
+        if(readmtime() < deadline)
+        {
+            reason = MSS_IDLE_WAKE_IRQ;
+        }
+        else
+        {
+            g_idle_stats[hart_id].deadline_wakes++;
+        }
+    }
+
+    restore_interrupts(psr);
+
+    return (reason);
+}
+
+/***************************************************************************//**
+ * See mss_idle.h
+ * mss_idle_wait() already returns at once if the deadline has passed, the
+ * check here is for the last few ticks only.
+ */
+void mss_idle_sleep_until(uint64_t deadline)
+{
+    uint64_t now = readmtime();
+
+    if(deadline > MSS_IDLE_SPIN_TICKS)
+    {
+        while(now < (deadline - MSS_IDLE_SPIN_TICKS))
+        {
+            (void)mss_idle_wait(deadline - MSS_IDLE_SPIN_TICKS);
+            now = readmtime();
+        }
+    }
+
+    while(now < deadline)
+    {
+        now = readmtime();
+    }
+}
+
+/***************************************************************************//**
+ * See mss_idle.h
+ */
+void mss_idle_sleep_us(uint64_t usecs)
+{
+    uint64_t start = readmtime();
+
+    /* Microseconds to mtime ticks, split so as not to overflow */
+    mss_idle_sleep_until(start + ((usecs / 1000000U) * MSS_IDLE_MTIME_HZ) +
+            (((usecs % 1000000U) * MSS_IDLE_MTIME_HZ) / 1000000U));
+}
+
+/***************************************************************************//**
+ * See mss_idle.h
+ */
+void mss_idle_get_stats(uint32_t hart_id, mss_idle_stats_t * stats)
+{
+    ASSERT(hart_id < IDLE_NUM_HARTS);
+
+    *stats = g_idle_stats[hart_id];
+}
+
+/***************************************************************************//**
+ * See mss_idle.h
+ */
+void mss_idle_clear_stats(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+
+    g_idle_stats[hart_id].entries = 0U;
+    g_idle_stats[hart_id].idle_ticks = 0U;
+    g_idle_stats[hart_id].deadline_wakes = 0U;
+}
+
+#ifdef MSS_IDLE_RTC
+/***************************************************************************//**
+ * See mss_idle.h
+ */
+uint8_t mss_idle_wait_rtc(uint64_t rtc_count)
+{
+    uint8_t reason = MSS_IDLE_WAKE_DEADLINE;
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t psr = disable_interrupts();
+    uint64_t saved_mie = read_csr(mie);
+
+    if(MSS_RTC_get_binary_count() < rtc_count)
+    {
+        MSS_RTC_set_binary_count_alarm(rtc_count, MSS_RTC_SINGLE_SHOT_ALARM);
+        MSS_RTC_enable_irq();
+        set_csr(mie, MIP_MEIP);
+
+        idle_wfi(hart_id);
+
+        if(MSS_RTC_get_binary_count() < rtc_count)
+        {
+            reason = MSS_IDLE_WAKE_IRQ;
+        }
+        else
+        {
+            g_idle_stats[hart_id].deadline_wakes++;
+            MSS_RTC_clear_irq();
+        }
+
+        write_csr(mie, saved_mie);
+        /* Let the PLIC interrupt pending be claimed before disabling it */
+        restore_interrupts(psr);
+        psr = disable_interrupts();
+        MSS_RTC_disable_irq();
+    }
+
+    restore_interrupts(psr);
+
+    return (reason);
+}
+
+/***************************************************************************//**
+ * See mss_idle.h
+ */
+void mss_idle_clock_init(uint64_t rtc_hz)
+{
+    uint64_t rtc;
+    uint64_t mtime;
+
+    ASSERT(0U != rtc_hz);
+
+    clock_edge(&rtc, &mtime);
+
+    g_clock_rtc_hz = rtc_hz;
+    g_clock_rtc_base = rtc;
+    __atomic_store_n(&g_clock_last, 0U, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_clock_offset, 0U - mtime, __ATOMIC_RELAXED);
+}
+
+/***************************************************************************//**
+ * See mss_idle.h
+ */
+uint64_t mss_idle_clock_now(void)
+{
+    uint64_t now = readmtime() +
+            __atomic_load_n(&g_clock_offset, __ATOMIC_RELAXED);
+    uint64_t last = __atomic_load_n(&g_clock_last, __ATOMIC_RELAXED);
+
+    /* Move the last value on, unless another hart has moved it further */
+    while((now > last) && (0 == __atomic_compare_exchange_n(&g_clock_last,
+            &last, now, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+    {
+    }
+
+    if(now < last)
+    {
+        now = last;
+    }
+
+    return (now);
+}
+
+/***************************************************************************//**
+ * See mss_idle.h
+ */
+int64_t mss_idle_clock_sync(void)
+{
+    uint64_t rtc;
+    uint64_t mtime;
+    uint64_t elapsed;
+    uint64_t expected;
+    uint64_t offset = __atomic_load_n(&g_clock_offset, __ATOMIC_RELAXED);
+
+    clock_edge(&rtc, &mtime);
+
+    /* RTC ticks to mtime ticks, split so as not to overflow */
+    elapsed = rtc - g_clock_rtc_base;
+    expected = ((elapsed / g_clock_rtc_hz) * MSS_IDLE_MTIME_HZ) +
+            (((elapsed % g_clock_rtc_hz) * MSS_IDLE_MTIME_HZ) / g_clock_rtc_hz);
+
+    __atomic_store_n(&g_clock_offset, expected - mtime, __ATOMIC_RELAXED);
+
+    return ((int64_t)(expected - (mtime + offset)));
+}
+#endif /* MSS_IDLE_RTC */
+
+/***************************************************************************//**
+ * Waits in wfi with interrupts masked, counting the time spent.
+ */
+static void idle_wfi(uint64_t hart_id)
+{
+    uint64_t start = readmtime();
+
+#ifdef MPFS_HAL_LOAD_ACCOUNTING
+    mss_load_idle_enter();
+#endif
+#if defined(MPFS_HAL_HOST_MODEL)
+    mss_host_wfi();
+#else
+    __asm__ __volatile__("wfi");
+#endif
+#ifdef MPFS_HAL_LOAD_ACCOUNTING
+    mss_load_idle_exit();
+#endif
+
+    g_idle_stats[hart_id].entries++;
+    g_idle_stats[hart_id].idle_ticks += readmtime() - start;
+}
+
+#ifdef MSS_IDLE_RTC
+/***************************************************************************//**
+ * Waits for the RTC count to change and reads mtime straight after, so both
+ * are read at the same instant to within the time taken to read them.
+ */
+static void clock_edge(uint64_t * rtc, uint64_t * mtime)
+{
+    uint64_t psr;
+    uint64_t start = MSS_RTC_get_binary_count();
+
+    do
+    {
+        psr = disable_interrupts();
+        *rtc = MSS_RTC_get_binary_count();
+        *mtime = readmtime();
+        restore_interrupts(psr);
+    } while(*rtc == start);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
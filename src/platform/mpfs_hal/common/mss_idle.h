@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_idle.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Low power idle and RTC disciplined clock
+ *
+ * A hart with nothing to do waits in wfi, where it draws much less power than
+ * when polling, until an interrupt or a deadline wakes it up.
+ *
+ * mss_idle_wait() waits for any interrupt enabled on the hart, or until a
+ * deadline in mtime ticks. The deadline is set in the CLINT mtimecmp register
+ * of the hart only if it is earlier than the timer interrupt already set, and
+ * mtimecmp is put back on wake up, so the system tick and the software timers
+ * of mss_sw_timer.h carry on as before. Interrupts are masked around the wfi,
+ * so the interrupt which woke the hart up is taken once mss_idle_wait() has
+ * restored the state of the hart, before it returns.
+ *
+ * mss_idle_sleep_until() and mss_idle_sleep_us() are delays built on
+ * mss_idle_wait(): they go back to wfi after any other interrupt until the
+ * time is up, so a hart waiting on hardware for more than a few microseconds
+ * leaves the L2 and buses to the others. Waits shorter than
+ * MSS_IDLE_SPIN_TICKS are polled, as entering wfi would take longer. They may
+ * be called from an interrupt handler, where the hart stays in wfi with
+ * interrupts masked and only mtime wakes it.
+ *
+ * A hart with no more work for good is parked with park_hart(), which runs
+ * wfi from the virtual ROM in the SCB, as the default u54_1() to u54_4() do,
+ * so it no longer fetches from memory. A hart parked this way is only woken by
+ * a reset. A U54 not needed for now is parked with mss_park_hart() instead,
+ * see mss_park.h, and woken again by another hart.
+ *
+ * The time each hart spends in wfi is counted, see mss_idle_get_stats(), to
+ * give the idle residency of the hart.
+ *
+ * When MSS_IDLE_RTC is defined in mss_sw_config.h the MSS RTC, which must be
+ * running in binary mode, can also be used:
+ *  - mss_idle_wait_rtc() waits until an RTC binary count, using the RTC
+ *    alarm, for long waits on a hart whose mtimecmp is in use.
+ *  - mss_idle_clock_now() returns a monotonic clock in mtime ticks, kept in
+ *    step with the RTC by mss_idle_clock_sync(). mtime gives the resolution,
+ *    the RTC the long term rate, e.g. when the RTC counts a 32.768 kHz
+ *    crystal. A correction which would take the clock back holds it instead,
+ *    so it never goes back.
+ *
+ * Example, the main loop of a hart sleeping until its next deadline:
+ * @code
+ *   while(1)
+ *   {
+ *       deadline = do_work();
+ *       (void)mss_idle_wait(deadline);
+ *   }
+ * @endcode
+ */
+#ifndef MSS_IDLE_H
+#define MSS_IDLE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Rate of mtime, used to convert between RTC ticks and mtime ticks
+ */
+#ifndef MSS_IDLE_MTIME_HZ
+#define MSS_IDLE_MTIME_HZ               LIBERO_SETTING_MSS_RTC_TOGGLE_CLK
+#endif
+
+/*
+ * Waits of mss_idle_sleep_until() shorter than this, in mtime ticks, poll
+ * mtime rather than entering wfi
+ */
+#ifndef MSS_IDLE_SPIN_TICKS
+#define MSS_IDLE_SPIN_TICKS             (MSS_IDLE_MTIME_HZ / 200000U)
+#endif
+
+/*
+ * Deadline of mss_idle_wait() waiting for an interrupt only
+ */
+#define MSS_IDLE_FOREVER                0xFFFFFFFFFFFFFFFFULL
+
+/*
+ * The reasons mss_idle_wait() and mss_idle_wait_rtc() return for
+ */
+#define MSS_IDLE_WAKE_DEADLINE          0U
+#define MSS_IDLE_WAKE_IRQ               1U
+
+typedef struct
+{
+    uint64_t entries;           /* Times the hart waited in wfi */
+    uint64_t idle_ticks;        /* mtime ticks spent in wfi */
+    uint64_t deadline_wakes;    /* Waits ended by the deadline */
+} mss_idle_stats_t;
+
+/***************************************************************************//**
+ * mss_idle_wait() waits in wfi until an interrupt enabled on the calling hart
+ * or the deadline, in mtime ticks, or MSS_IDLE_FOREVER for no deadline. The
+ * interrupt, if any, is taken before the function returns if interrupts were
+ * enabled when it was called.
+ *
+ * @return
+ *   MSS_IDLE_WAKE_DEADLINE if the deadline has passed, else MSS_IDLE_WAKE_IRQ.
+ */
+uint8_t mss_idle_wait(uint64_t deadline);
+
+/***************************************************************************//**
+ * mss_idle_sleep_until() returns once mtime reaches the deadline, waiting in
+ * wfi for all but the last MSS_IDLE_SPIN_TICKS. Interrupts which come in the
+ * meantime are taken if interrupts were enabled when it was called.
+ */
+void mss_idle_sleep_until(uint64_t deadline);
+
+/***************************************************************************//**
+ * mss_idle_sleep_us() waits usecs microseconds with mss_idle_sleep_until().
+ */
+void mss_idle_sleep_us(uint64_t usecs);
+
+/***************************************************************************//**
+ * mss_idle_get_stats() copies the idle statistics of a hart to stats. The
+ * statistics of another hart may be read while it is updating them, so are
+ * only a sample.
+ */
+void mss_idle_get_stats(uint32_t hart_id, mss_idle_stats_t * stats);
+
+/***************************************************************************//**
+ * mss_idle_clear_stats() clears the idle statistics of the calling hart.
+ */
+void mss_idle_clear_stats(void);
+
+#ifdef MSS_IDLE_RTC
+/***************************************************************************//**
+ * mss_idle_wait_rtc() waits in wfi until an interrupt enabled on the calling
+ * hart or the RTC binary count reaches rtc_count. The RTC alarm, wakeup
+ * interrupt and the PLIC enable of the RTC wakeup interrupt on the calling
+ * hart are used, so must not be used by the application at the same time.
+ * The RTC wakeup interrupt is cleared before the function returns, and
+ * rtc_wakeup_plic_IRQHandler() called. An alarm left set by a wait ended by
+ * another interrupt may end the next wait early, so the caller checks the
+ * count, as with spurious wake ups.
+ *
+ * @return
+ *   MSS_IDLE_WAKE_DEADLINE if the count has been reached, else
+ *   MSS_IDLE_WAKE_IRQ.
+ */
+uint8_t mss_idle_wait_rtc(uint64_t rtc_count);
+
+/***************************************************************************//**
+ * mss_idle_clock_init() starts the clock returned by mss_idle_clock_now(),
+ * rtc_hz being the rate of the RTC binary count. It waits for the RTC count to
+ * change, so takes up to one RTC tick.
+ */
+void mss_idle_clock_init(uint64_t rtc_hz);
+
+/***************************************************************************//**
+ * mss_idle_clock_now() returns the mtime ticks since mss_idle_clock_init(),
+ * corrected to the RTC at the last mss_idle_clock_sync(). The value returned,
+ * on any hart, is never lower than a value returned before.
+ */
+uint64_t mss_idle_clock_now(void);
+
+/***************************************************************************//**
+ * mss_idle_clock_sync() corrects the clock to the RTC. Like
+ * mss_idle_clock_init() it takes up to one RTC tick, so should be called once
+ * in a while, e.g. every few seconds from a software timer, and from one hart
+ * only.
+ *
+ * @return
+ *   The correction made, in mtime ticks, positive if the clock was behind.
+ */
+int64_t mss_idle_clock_sync(void);
+#endif /* MSS_IDLE_RTC */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_IDLE_H */
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_io_offload.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief E51 I/O offload of slow peripheral accesses from the U54s
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * See mss_io_offload.h
+ */
+uint8_t mss_io_offload_init(mss_io_offload_t * offload)
+{
+    uint8_t ret_val = SUCCESS;
+    uint32_t inc;
+
+    mss_doorbell_init(&offload->doorbell);
+    offload->next = 0U;
+
+    for(inc = 0U; inc < MSS_IO_OFFLOAD_NUM_U54; inc++)
+    {
+        offload->served[inc] = 0U;
+        if(SUCCESS != mss_spsc_init(&offload->ring[inc], offload->slots[inc],
+                MSS_IO_OFFLOAD_RING_SLOTS))
+        {
+            ret_val = ERROR;
+        }
+        else
+        {
+            /* Channel of U54_n is bit n - 1 */
+            mss_spsc_set_doorbell(&offload->ring[inc], &offload->doorbell,
+                    0U, (uint64_t)1U << inc);
+        }
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_io_offload.h
+ */
+uint8_t mss_io_offload_post(mss_io_offload_t * offload,
+        mss_io_request_t * request, mss_io_handler_t handler, void * arg)
+{
+    uint8_t ret_val = ERROR;
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t message = (uint64_t)(uintptr_t)request;
+
+    if((hart_id >= 1U) && (hart_id <= MSS_IO_OFFLOAD_NUM_U54))
+    {
+        request->handler = handler;
+        request->arg = arg;
+        request->result = 0U;
+        request->state = MSS_IO_REQUEST_PENDING;
+
+        /* mss_spsc_push() orders the request before the slot is published */
+        if(1U == mss_spsc_push(&offload->ring[hart_id - 1U], &message, 1U))
+        {
+            ret_val = SUCCESS;
+        }
+        else
+        {
+            request->state = MSS_IO_REQUEST_IDLE;
+        }
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_io_offload.h
+ */
+uint8_t mss_io_offload_done(const mss_io_request_t * request)
+{
+    return ((MSS_IO_REQUEST_DONE == request->state) ? 1U : 0U);
+}
+
+/***************************************************************************//**
+ * See mss_io_offload.h
+ */
+uint64_t mss_io_offload_wait(mss_io_request_t * request)
+{
+    while(MSS_IO_REQUEST_PENDING == request->state)
+    {
+        ;
+    }
+
+    /* Read the result only once the state says it is written */
+    mb();
+
+    return (request->result);
+}
+
+/***************************************************************************//**
+ * See mss_io_offload.h
+ */
+uint32_t mss_io_offload_service(mss_io_offload_t * offload, uint32_t budget)
+{
+    uint32_t run = 0U;
+    uint32_t idle = 0U;
+    uint32_t ring = offload->next;
+    uint64_t message;
+    mss_io_request_t * request;
+
+    /*
+     * The doorbell is only a wake up, all the rings are looked at whichever
+     * channels are pending. Taking it before the rings are read means a post
+     * made while they are served rings again.
+     */
+    (void)mss_doorbell_take(&offload->doorbell);
+
+    /* One request per ring in turn, until all the rings are found empty */
+    while((idle < MSS_IO_OFFLOAD_NUM_U54) && ((0U == budget) || (run < budget)))
+    {
+        if(1U == mss_spsc_pop(&offload->ring[ring], &message, 1U))
+        {
+            request = (mss_io_request_t *)(uintptr_t)message;
+            request->result = request->handler(request->arg);
+            mb();
+            request->state = MSS_IO_REQUEST_DONE;
+            offload->served[ring]++;
+            run++;
+            idle = 0U;
+        }
+        else
+        {
+            idle++;
+        }
+
+        ring = (ring + 1U) % MSS_IO_OFFLOAD_NUM_U54;
+    }
+
+    offload->next = ring;
+
+    return (run);
+}
+
+#ifdef __cplusplus
+}
+#endif
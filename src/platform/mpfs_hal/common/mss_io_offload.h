@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_io_offload.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief E51 I/O offload of slow peripheral accesses from the U54s
+ *
+ * The E51 mostly idles in e51() once the U54s are running. The offload lets a
+ * U54 hand a slow operation, e.g. a UART print, an I2C sensor read, a system
+ * service or a watchdog refresh, to the E51, so it does not stall on the
+ * peripheral and its caches are not polluted by the driver.
+ *
+ * Each U54 has its own ring to the E51, an mss_spsc_queue_t, so posting takes
+ * no lock. A request, mss_io_request_t, is owned by the caller and holds a
+ * handler, run on the E51, and its argument. mss_io_offload_post() queues it
+ * and returns at once. The U54 later checks mss_io_offload_done() or waits in
+ * mss_io_offload_wait(), which returns the value returned by the handler. The
+ * request and what its argument points to must stay valid until it is done.
+ *
+ * A post to an empty ring rings the channel of the U54 in the doorbell of the
+ * E51, which raises its software interrupt, so the E51 can sleep in wfi
+ * between requests:
+ * @code
+ *   // shared between the harts, e.g. in hls->shared_mem
+ *   mss_io_offload_t g_offload;
+ *
+ *   void e51(void)
+ *   {
+ *       (void)mss_io_offload_init(&g_offload);
+ *       set_csr(mie, MIP_MSIP);
+ *       ...
+ *       while (1)
+ *       {
+ *           (void)mss_io_offload_service(&g_offload, 0U);
+ *           __asm("wfi");
+ *       }
+ *   }
+ *
+ *   // u54_1
+ *   static uint64_t print_handler(void * arg)
+ *   {
+ *       MSS_UART_polled_tx_string(&g_mss_uart0_lo, (const uint8_t *)arg);
+ *       return (0U);
+ *   }
+ *
+ *   static mss_io_request_t g_print;
+ *   (void)mss_io_offload_post(&g_offload, &g_print, print_handler, msg);
+ *   ...
+ *   (void)mss_io_offload_wait(&g_print);
+ * @endcode
+ * The E51 runs the requests of a ring in order, and serves the rings in turn.
+ * Handlers must not wait on the U54s, and must be linked in the image the E51
+ * runs.
+ */
+#ifndef MSS_IO_OFFLOAD_H
+#define MSS_IO_OFFLOAD_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Requests a U54 can have queued at once, a power of two
+ */
+#ifndef MSS_IO_OFFLOAD_RING_SLOTS
+#define MSS_IO_OFFLOAD_RING_SLOTS       16U
+#endif
+
+#define MSS_IO_OFFLOAD_NUM_U54          4U
+
+/*
+ * Request state
+ */
+#define MSS_IO_REQUEST_IDLE             0U
+#define MSS_IO_REQUEST_PENDING          1U
+#define MSS_IO_REQUEST_DONE             2U
+
+typedef uint64_t (*mss_io_handler_t)(void * arg);
+
+typedef struct
+{
+    mss_io_handler_t handler;
+    void * arg;
+    volatile uint64_t result;
+    volatile uint32_t state;
+} mss_io_request_t;
+
+typedef struct
+{
+    mss_spsc_queue_t ring[MSS_IO_OFFLOAD_NUM_U54];
+    uint64_t slots[MSS_IO_OFFLOAD_NUM_U54][MSS_IO_OFFLOAD_RING_SLOTS];
+    mss_doorbell_t doorbell;
+    uint64_t served[MSS_IO_OFFLOAD_NUM_U54];    /* Requests run per U54 */
+    uint32_t next;                              /* Ring served first */
+} mss_io_offload_t;
+
+/***************************************************************************//**
+ * mss_io_offload_init() empties the rings. It is called on the E51 before any
+ * U54 posts a request.
+ */
+uint8_t mss_io_offload_init(mss_io_offload_t * offload);
+
+/***************************************************************************//**
+ * mss_io_offload_post() queues a request to the E51 from the calling U54. It
+ * returns ERROR, leaving the request idle, if called from the E51 or if the
+ * ring of the U54 is full. It must not be called from an interrupt handler of
+ * a U54 which also posts from its main loop, as each ring has one producer.
+ */
+uint8_t mss_io_offload_post(mss_io_offload_t * offload,
+        mss_io_request_t * request, mss_io_handler_t handler, void * arg);
+
+/***************************************************************************//**
+ * mss_io_offload_done() returns non zero once the E51 has run the request.
+ */
+uint8_t mss_io_offload_done(const mss_io_request_t * request);
+
+/***************************************************************************//**
+ * mss_io_offload_wait() waits until the E51 has run the request, and returns
+ * the value returned by its handler.
+ */
+uint64_t mss_io_offload_wait(mss_io_request_t * request);
+
+/***************************************************************************//**
+ * mss_io_offload_service() runs the requests queued, on the E51, and returns
+ * the number run. A non zero budget limits the number run in one call, for
+ * when the E51 has other work to do.
+ */
+uint32_t mss_io_offload_service(mss_io_offload_t * offload, uint32_t budget);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_IO_OFFLOAD_H */
@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_irq_profile.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Interrupt handler profiling
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MPFS_HAL_IRQ_PROFILING
+
+#define IRQ_PROFILE_NUM_HARTS       (MPFS_HAL_LAST_HART + 1U)
+
+static irq_profile_entry_t \
+        g_irq_profile[IRQ_PROFILE_NUM_HARTS][IRQ_PROFILE_NUM_SOURCES];
+
+/***************************************************************************//**
+ * See mss_irq_profile.h
+ */
+void irq_profile_record
+(
+    uint32_t source,
+    uint64_t handler_cycles,
+    uint64_t latency_cycles
+)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    irq_profile_entry_t * entry;
+    uint32_t cycles = (uint32_t)handler_cycles;
+    uint32_t latency = (uint32_t)latency_cycles;
+
+    if ((hart_id < IRQ_PROFILE_NUM_HARTS) && (source < IRQ_PROFILE_NUM_SOURCES))
+    {
+        entry = &g_irq_profile[hart_id][source];
+
+        if (handler_cycles > 0xFFFFFFFFULL)
+        {
+            cycles = 0xFFFFFFFFU;
+        }
+
+        if (latency_cycles > 0xFFFFFFFFULL)
+        {
+            latency = 0xFFFFFFFFU;
+        }
+
+        if ((0U == entry->count) || (cycles < entry->min_cycles))
+        {
+            entry->min_cycles = cycles;
+        }
+
+        if (cycles > entry->max_cycles)
+        {
+            entry->max_cycles = cycles;
+        }
+
+        if (latency > entry->max_latency)
+        {
+            entry->max_latency = latency;
+        }
+
+        entry->total_cycles += handler_cycles;
+        entry->total_latency += latency_cycles;
+        entry->count++;
+    }
+}
+
+/***************************************************************************//**
+ * See mss_irq_profile.h
+ */
+const irq_profile_entry_t * irq_profile_get
+(
+    uint64_t hart_id,
+    uint32_t source
+)
+{
+    const irq_profile_entry_t * entry = (const irq_profile_entry_t *)0;
+
+    if ((hart_id < IRQ_PROFILE_NUM_HARTS) && (source < IRQ_PROFILE_NUM_SOURCES))
+    {
+        entry = &g_irq_profile[hart_id][source];
+    }
+
+    return (entry);
+}
+
+/***************************************************************************//**
+ * See mss_irq_profile.h
+ */
+void irq_profile_reset(void)
+{
+    uint32_t hart_id;
+    uint32_t source;
+    uint64_t mstatus;
+
+    for (hart_id = 0U; hart_id < IRQ_PROFILE_NUM_HARTS; hart_id++)
+    {
+        for (source = 0U; source < IRQ_PROFILE_NUM_SOURCES; source++)
+        {
+            mstatus = disable_interrupts();
+            g_irq_profile[hart_id][source].count = 0U;
+            g_irq_profile[hart_id][source].min_cycles = 0U;
+            g_irq_profile[hart_id][source].max_cycles = 0U;
+            g_irq_profile[hart_id][source].max_latency = 0U;
+            g_irq_profile[hart_id][source].total_cycles = 0U;
+            g_irq_profile[hart_id][source].total_latency = 0U;
+            restore_interrupts(mstatus);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_irq_profile.h
+ */
+void irq_profile_dump(mss_uart_instance_t * uart)
+{
+    uint32_t hart_id;
+    uint32_t source;
+    irq_profile_entry_t entry;
+
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)
+            "\n\r hart source   count    min      max      avg      "
+            "lat max  lat avg");
+
+    for (hart_id = 0U; hart_id < IRQ_PROFILE_NUM_HARTS; hart_id++)
+    {
+        for (source = 0U; source < IRQ_PROFILE_NUM_SOURCES; source++)
+        {
+            entry = g_irq_profile[hart_id][source];
+
+            if (0U != entry.count)
+            {
+                mss_print_hex(uart, "\n\r ", hart_id, 1U);
+
+                if (IRQ_PROFILE_TIMER_SOURCE == source)
+                {
+                    MSS_UART_polled_tx_string(uart,
+                            (const uint8_t *)"    timer   ");
+                }
+                else if (source < IRQ_PROFILE_EXT_SOURCE(0U))
+                {
+                    mss_print_hex(uart, "    local ",
+                            source - IRQ_PROFILE_LOCAL_SOURCE(0U), 2U);
+                }
+                else
+                {
+                    mss_print_hex(uart, "    ext  ",
+                            source - IRQ_PROFILE_EXT_SOURCE(0U), 3U);
+                }
+
+                mss_print_hex(uart, " ", entry.count, 8U);
+                mss_print_hex(uart, " ", entry.min_cycles, 8U);
+                mss_print_hex(uart, " ", entry.max_cycles, 8U);
+                mss_print_hex(uart, " ", entry.total_cycles / entry.count, 8U);
+                mss_print_hex(uart, " ", entry.max_latency, 8U);
+                mss_print_hex(uart, " ", entry.total_latency / entry.count, 8U);
+            }
+        }
+    }
+}
+
+#endif /* MPFS_HAL_IRQ_PROFILING */
+
+#ifdef __cplusplus
+}
+#endif
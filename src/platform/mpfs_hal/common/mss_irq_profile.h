@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_irq_profile.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Interrupt handler profiling
+ *
+ * When MPFS_HAL_IRQ_PROFILING is defined in mss_sw_config.h, the machine timer,
+ * local and external interrupt handlers of the HAL record for each hart and
+ * each interrupt source the number of interrupts taken, the minimum, maximum
+ * and total number of cycles spent in the handler and, for external
+ * interrupts, the number of cycles from the PLIC claim to the completion.
+ *
+ * Each hart only updates its own table, so no locking is required. The
+ * statistics read by another hart while an interrupt is being recorded may
+ * mix old and new values of the same entry.
+ * The table uses sizeof(irq_profile_entry_t) * IRQ_PROFILE_NUM_SOURCES bytes
+ * for each hart up to MPFS_HAL_LAST_HART.
+ */
+#ifndef MSS_IRQ_PROFILE_H
+#define MSS_IRQ_PROFILE_H
+
+#include <stdint.h>
+#include "mss_plic.h"
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Index of the interrupt sources in the profiling table
+ */
+#define IRQ_PROFILE_TIMER_SOURCE            0U
+#define IRQ_PROFILE_LOCAL_SOURCE(n)         (1U + (n))      /* n is 0 to 47 */
+#define IRQ_PROFILE_EXT_SOURCE(n)           (49U + (n))     /* PLIC source n */
+#define IRQ_PROFILE_NUM_SOURCES             (49U + PLIC_NUM_SOURCES)
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint32_t max_latency;
+    uint64_t total_cycles;
+    uint64_t total_latency;
+} irq_profile_entry_t;
+
+/***************************************************************************//**
+ * irq_profile_record() adds an interrupt to the statistics of the source for
+ * the current hart. latency_cycles is 0 for sources without a claim.
+ * It is called by the HAL interrupt handlers.
+ */
+void irq_profile_record
+(
+    uint32_t source,
+    uint64_t handler_cycles,
+    uint64_t latency_cycles
+);
+
+/***************************************************************************//**
+ * irq_profile_get() returns the statistics of a source for a hart, or a null
+ * pointer when the hart or the source is out of range.
+ */
+const irq_profile_entry_t * irq_profile_get
+(
+    uint64_t hart_id,
+    uint32_t source
+);
+
+/***************************************************************************//**
+ * irq_profile_reset() clears the statistics of all the harts.
+ */
+void irq_profile_reset(void);
+
+/***************************************************************************//**
+ * irq_profile_dump() prints the statistics of the sources which were taken at
+ * least once, one line per hart and source, in hexadecimal.
+ *
+ * Example:
+ * @code
+ *   irq_profile_dump(&g_mss_uart0_lo);
+ * @endcode
+ */
+void irq_profile_dump(mss_uart_instance_t * uart);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_IRQ_PROFILE_H */
@@ -30,10 +30,20 @@
 static const uint64_t g_init_marker = INIT_MARKER;
 #endif
 
+static const uint64_t g_way_mask_ports[] = LIBERO_TABLE_L2_WAY_MASK_PORTS;
+static const uint64_t g_way_mask_harts[] = LIBERO_TABLE_L2_WAY_MASK_HARTS;
+
 /*==============================================================================
  * Local functions.
  */
 static void check_config_l2_scratchpad(void);
+static uint64_t l2_allocatable_ways(void);
+
+/*==============================================================================
+ * Runtime way mask state.
+ */
+static volatile long g_l2_way_mask_lock = 0;
+static uint64_t g_l2_locked_ways = 0ULL;
 
 
 /*==============================================================================
@@ -106,20 +116,12 @@ __attribute__((weak)) void config_l2_cache(void)
     /*
      * Setup all masters, apart from one we are using to setup scratch
      */
-    CACHE_CTRL->WAY_MASK_DMA = LIBERO_SETTING_WAY_MASK_DMA;
-    CACHE_CTRL->WAY_MASK_AXI4_SLAVE_PORT_0 = LIBERO_SETTING_WAY_MASK_AXI4_PORT_0;
-    CACHE_CTRL->WAY_MASK_AXI4_SLAVE_PORT_1 = LIBERO_SETTING_WAY_MASK_AXI4_PORT_1;
-    CACHE_CTRL->WAY_MASK_AXI4_SLAVE_PORT_2 = LIBERO_SETTING_WAY_MASK_AXI4_PORT_2;
-    CACHE_CTRL->WAY_MASK_AXI4_SLAVE_PORT_3 = LIBERO_SETTING_WAY_MASK_AXI4_PORT_3;
-    CACHE_CTRL->WAY_MASK_E51_ICACHE = LIBERO_SETTING_WAY_MASK_E51_ICACHE;
-    CACHE_CTRL->WAY_MASK_U54_1_DCACHE = LIBERO_SETTING_WAY_MASK_U54_1_DCACHE;
-    CACHE_CTRL->WAY_MASK_U54_1_ICACHE = LIBERO_SETTING_WAY_MASK_U54_1_ICACHE;
-    CACHE_CTRL->WAY_MASK_U54_2_DCACHE = LIBERO_SETTING_WAY_MASK_U54_2_DCACHE;
-    CACHE_CTRL->WAY_MASK_U54_2_ICACHE = LIBERO_SETTING_WAY_MASK_U54_2_ICACHE;
-    CACHE_CTRL->WAY_MASK_U54_3_DCACHE = LIBERO_SETTING_WAY_MASK_U54_3_DCACHE;
-    CACHE_CTRL->WAY_MASK_U54_3_ICACHE = LIBERO_SETTING_WAY_MASK_U54_3_ICACHE;
-    CACHE_CTRL->WAY_MASK_U54_4_DCACHE = LIBERO_SETTING_WAY_MASK_U54_4_DCACHE;
-    CACHE_CTRL->WAY_MASK_U54_4_ICACHE = LIBERO_SETTING_WAY_MASK_U54_4_ICACHE;
+    config_64_copy((void *)(&(CACHE_CTRL->WAY_MASK_DMA)),
+                &(g_way_mask_ports),
+                sizeof(g_way_mask_ports));
+    config_64_copy((void *)(&(CACHE_CTRL->WAY_MASK_E51_ICACHE)),
+                &(g_way_mask_harts),
+                sizeof(g_way_mask_harts));
 
 #if (LIBERO_SETTING_NUM_SCRATCH_PAD_WAYS != 0)
     /*
@@ -192,6 +194,331 @@ static void check_config_l2_scratchpad(void)
     ASSERT(LIBERO_SETTING_NUM_SCRATCH_PAD_WAYS >= n_scratchpad_ways);
 }
 
+/*==============================================================================
+ * Flush the L2 lines holding an address range, see mss_l2_cache.h.
+ */
+void mss_l2_flush_range(uint64_t start, uint64_t length)
+{
+    uint64_t addr;
+    uint64_t end = start + length;
+
+    if((0U == length) ||
+       (((start >= DDR_CACHED_32BIT_TOP) || (end <= DDR_CACHED_32BIT_BOTTOM)) &&
+        ((start >= DDR_CACHED_38BIT_TOP) || (end <= DDR_CACHED_38BIT_BOTTOM))))
+    {
+        return;
+    }
+
+    /*
+     * Make sure all earlier stores have reached the cache before the lines
+     * are flushed.
+     */
+    mb();
+
+    addr = start & ~((uint64_t)CACHE_BLOCK_BYTE_LENGTH - 1U);
+    while(addr < end)
+    {
+        CACHE_CTRL->FLUSH64 = addr;
+        addr += CACHE_BLOCK_BYTE_LENGTH;
+    }
+
+    /*
+     * Order the flush register writes ahead of the register accesses which
+     * start the DMA.
+     */
+    mb();
+}
+
+/*==============================================================================
+ * Invalidate the L2 lines holding an address range, see mss_l2_cache.h.
+ */
+void mss_l2_invalidate_range(uint64_t start, uint64_t length)
+{
+    mss_l2_flush_range(start, length);
+}
+
+/*==============================================================================
+ * Write back and evict every line of the allocatable L2 ways, see
+ * mss_l2_cache.h.
+ *
+ * The L2 replaces lines at random, so the calling hart is given one way at a
+ * time and reads one way worth of cached DDR from DDR_CACHED_32BIT_BOTTOM,
+ * which allocates a line in every set of that way. The range is flushed first
+ * each time so none of it hits in a way already done.
+ */
+uint8_t mss_l2_flush_all(void)
+{
+    volatile uint64_t * masks = &CACHE_CTRL->WAY_MASK_DMA;
+    uint32_t master = (uint32_t)L2_MASTER_E51_DCACHE +
+            (2U * (uint32_t)read_csr(mhartid));
+    uint64_t saved_mask;
+    uint64_t ways;
+    uint64_t addr;
+    uint64_t mstatus;
+    uint32_t way;
+    uint8_t ret_val = ERROR;
+
+    mstatus = disable_interrupts();
+    spinlock(&g_l2_way_mask_lock);
+
+    if(0ULL == g_l2_locked_ways)
+    {
+        ways = l2_allocatable_ways();
+        saved_mask = masks[master];
+
+        for(way = 0U; way < 64U; ++way)
+        {
+            if(0ULL != (ways & (0x1ULL << way)))
+            {
+                mss_l2_flush_range(DDR_CACHED_32BIT_BOTTOM, WAY_BYTE_LENGTH);
+                masks[master] = (0x1ULL << way);
+                mb();
+
+                for(addr = DDR_CACHED_32BIT_BOTTOM;
+                    addr < (DDR_CACHED_32BIT_BOTTOM + WAY_BYTE_LENGTH);
+                    addr += CACHE_BLOCK_BYTE_LENGTH)
+                {
+                    (void)*(volatile uint64_t *)addr;
+                }
+
+                mb();
+            }
+        }
+
+        mss_l2_flush_range(DDR_CACHED_32BIT_BOTTOM, WAY_BYTE_LENGTH);
+        masks[master] = saved_mask;
+        mb();
+        ret_val = SUCCESS;
+    }
+
+    spinunlock(&g_l2_way_mask_lock);
+    restore_interrupts(mstatus);
+
+    return (ret_val);
+}
+
+/*==============================================================================
+ * Ways a master may be given: the enabled ways not used as scratchpad or
+ * holding locked lines.
+ */
+static uint64_t l2_allocatable_ways(void)
+{
+    uint64_t way_enable = CACHE_CTRL->WAY_ENABLE;
+    uint64_t enabled_ways = (0x2ULL << way_enable) - 1ULL;
+    uint64_t scratchpad_ways = 0ULL;
+    uint32_t inc;
+
+    for(inc = 0U; (inc < LIBERO_SETTING_NUM_SCRATCH_PAD_WAYS) && (inc <= way_enable);
+            ++inc)
+    {
+        scratchpad_ways |= (0x1ULL << (way_enable - inc));
+    }
+
+    return (enabled_ways & ~(scratchpad_ways | g_l2_locked_ways));
+}
+
+/*==============================================================================
+ * Update the way masks of the masters, all or none of them.
+ */
+static uint8_t l2_update_way_masks(mss_l2_master_t master, uint64_t way_mask,
+        uint8_t dedicate)
+{
+    volatile uint64_t * masks = &CACHE_CTRL->WAY_MASK_DMA;
+    uint64_t new_masks[L2_NUM_MASTERS];
+    uint64_t mstatus;
+    uint32_t inc;
+    uint8_t ret_val = SUCCESS;
+
+    mstatus = disable_interrupts();
+    spinlock(&g_l2_way_mask_lock);
+
+    if((master >= L2_NUM_MASTERS) || (0ULL == way_mask) ||
+       (0ULL != (way_mask & ~l2_allocatable_ways())))
+    {
+        ret_val = ERROR;
+    }
+    else
+    {
+
+        for(inc = 0U; inc < (uint32_t)L2_NUM_MASTERS; ++inc)
+        {
+            new_masks[inc] = masks[inc];
+
+            if(inc == (uint32_t)master)
+            {
+                new_masks[inc] = way_mask;
+            }
+            else if(0U != dedicate)
+            {
+                new_masks[inc] &= ~way_mask;
+
+                if(0ULL == new_masks[inc])
+                {
+                    ret_val = ERROR;
+                }
+            }
+            else
+            {
+                /* other masters are unchanged */
+            }
+        }
+
+        if(SUCCESS == ret_val)
+        {
+            mb();
+
+            for(inc = 0U; inc < (uint32_t)L2_NUM_MASTERS; ++inc)
+            {
+                masks[inc] = new_masks[inc];
+            }
+
+            mb();
+        }
+    }
+
+    spinunlock(&g_l2_way_mask_lock);
+    restore_interrupts(mstatus);
+
+    return (ret_val);
+}
+
+uint8_t mss_l2_set_way_mask(mss_l2_master_t master, uint64_t way_mask)
+{
+    return (l2_update_way_masks(master, way_mask, 0U));
+}
+
+uint8_t mss_l2_dedicate_ways(mss_l2_master_t master, uint64_t way_mask)
+{
+    return (l2_update_way_masks(master, way_mask, 1U));
+}
+
+uint64_t mss_l2_get_way_mask(mss_l2_master_t master)
+{
+    uint64_t way_mask = 0ULL;
+
+    if(master < L2_NUM_MASTERS)
+    {
+        way_mask = (&CACHE_CTRL->WAY_MASK_DMA)[master];
+    }
+
+    return (way_mask);
+}
+
+/*==============================================================================
+ * Lock an address range into L2 ways, see mss_l2_cache.h.
+ */
+uint8_t mss_l2_lock_range(uint64_t start, uint64_t length, uint64_t way_mask)
+{
+    volatile uint64_t * masks = &CACHE_CTRL->WAY_MASK_DMA;
+    uint32_t primer = (uint32_t)L2_MASTER_E51_DCACHE +
+            (2U * (uint32_t)read_csr(mhartid));
+    uint64_t allocatable;
+    uint64_t primer_mask;
+    uint64_t capacity = 0ULL;
+    uint64_t end = start + length;
+    uint64_t addr;
+    uint64_t mstatus;
+    uint32_t inc;
+    uint8_t ret_val = SUCCESS;
+
+    for(inc = 0U; inc <= MAX_WAY_ENABLE; ++inc)
+    {
+        if(0ULL != (way_mask & (0x1ULL << inc)))
+        {
+            capacity += WAY_BYTE_LENGTH;
+        }
+    }
+
+    mstatus = disable_interrupts();
+    spinlock(&g_l2_way_mask_lock);
+
+    allocatable = l2_allocatable_ways();
+
+    if((0ULL == way_mask) || (0ULL != (way_mask & ~allocatable)) ||
+       (way_mask == allocatable) || (0ULL == length) ||
+       (length > capacity) || (end < start) ||
+       (!((start >= DDR_CACHED_32BIT_BOTTOM) && (end <= DDR_CACHED_32BIT_TOP)) &&
+        !((start >= DDR_CACHED_38BIT_BOTTOM) && (end <= DDR_CACHED_38BIT_TOP))))
+    {
+        ret_val = ERROR;
+    }
+
+    for(inc = 0U; inc < (uint32_t)L2_NUM_MASTERS; ++inc)
+    {
+        if(0ULL == (masks[inc] & ~way_mask))
+        {
+            ret_val = ERROR;
+        }
+    }
+
+    if(SUCCESS == ret_val)
+    {
+        /*
+         * Take the ways from every master first, so that only the loads below
+         * allocate into them.
+         */
+        primer_mask = masks[primer] & ~way_mask;
+        mb();
+
+        for(inc = 0U; inc < (uint32_t)L2_NUM_MASTERS; ++inc)
+        {
+            masks[inc] &= ~way_mask;
+        }
+
+        /*
+         * Evict the range from L1 and from the other ways, as a line which is
+         * already held would be hit rather than allocated into the locked ways.
+         */
+        mss_l2_flush_range(start, length);
+
+        masks[primer] = way_mask;
+        mb();
+
+        /*
+         * The range fits in the ways as each way holds one line for every set,
+         * so a contiguous range no longer than the ways never evicts itself.
+         */
+        addr = start & ~((uint64_t)CACHE_BLOCK_BYTE_LENGTH - 1U);
+        while(addr < end)
+        {
+            (void)*(volatile uint64_t *)addr;
+            addr += CACHE_BLOCK_BYTE_LENGTH;
+        }
+
+        mb();
+        masks[primer] = primer_mask;
+        mb();
+
+        g_l2_locked_ways |= way_mask;
+    }
+
+    spinunlock(&g_l2_way_mask_lock);
+    restore_interrupts(mstatus);
+
+    return (ret_val);
+}
+
+/*==============================================================================
+ * Release locked L2 ways, see mss_l2_cache.h.
+ */
+void mss_l2_unlock_ways(uint64_t way_mask)
+{
+    uint64_t mstatus;
+
+    mstatus = disable_interrupts();
+    spinlock(&g_l2_way_mask_lock);
+
+    g_l2_locked_ways &= ~way_mask;
+
+    spinunlock(&g_l2_way_mask_lock);
+    restore_interrupts(mstatus);
+}
+
+uint64_t mss_l2_get_locked_ways(void)
+{
+    return (g_l2_locked_ways);
+}
+
 #if 0 // todo - remove, no longer used
 
 
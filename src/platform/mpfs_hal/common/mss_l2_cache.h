@@ -431,6 +431,33 @@ for scratchpad start at way 0, and work up. */
     /* NUM_OF_WAYS                       [0:8]   RW value= 0x0 */
 #endif
 
+/*
+ * Way masks in register order, as emitted in hw_reg_tables.h by the
+ * configuration generator from version 0.6.4, applied with config_64_copy().
+ * The E51 data cache mask, between the two tables, is set once the scratchpad
+ * has been set up.
+ */
+#if !defined (LIBERO_TABLE_L2_WAY_MASK_PORTS)
+#define LIBERO_TABLE_L2_WAY_MASK_PORTS  { \
+        LIBERO_SETTING_WAY_MASK_DMA, \
+        LIBERO_SETTING_WAY_MASK_AXI4_PORT_0, \
+        LIBERO_SETTING_WAY_MASK_AXI4_PORT_1, \
+        LIBERO_SETTING_WAY_MASK_AXI4_PORT_2, \
+        LIBERO_SETTING_WAY_MASK_AXI4_PORT_3 }
+#endif
+#if !defined (LIBERO_TABLE_L2_WAY_MASK_HARTS)
+#define LIBERO_TABLE_L2_WAY_MASK_HARTS  { \
+        LIBERO_SETTING_WAY_MASK_E51_ICACHE, \
+        LIBERO_SETTING_WAY_MASK_U54_1_DCACHE, \
+        LIBERO_SETTING_WAY_MASK_U54_1_ICACHE, \
+        LIBERO_SETTING_WAY_MASK_U54_2_DCACHE, \
+        LIBERO_SETTING_WAY_MASK_U54_2_ICACHE, \
+        LIBERO_SETTING_WAY_MASK_U54_3_DCACHE, \
+        LIBERO_SETTING_WAY_MASK_U54_3_ICACHE, \
+        LIBERO_SETTING_WAY_MASK_U54_4_DCACHE, \
+        LIBERO_SETTING_WAY_MASK_U54_4_ICACHE }
+#endif
+
 
 
 /*==============================================================================
@@ -446,6 +473,15 @@ for scratchpad start at way 0, and work up. */
 #define ZERO_DEVICE_BOTTOM  0x0A000000ULL
 #define ZERO_DEVICE_TOP     0x0C000000ULL
 
+/*
+ * Cached DDR ranges. Only addresses in these ranges can be held in the L2 so
+ * the range maintenance functions ignore anything else.
+ */
+#define DDR_CACHED_32BIT_BOTTOM  0x80000000ULL
+#define DDR_CACHED_32BIT_TOP     0xC0000000ULL
+#define DDR_CACHED_38BIT_BOTTOM  0x1000000000ULL
+#define DDR_CACHED_38BIT_TOP     0x1400000000ULL
+
 #define CACHE_CTRL_BASE     0x02010000ULL
 
 #define INIT_MARKER         0xC0FFEEBEC0010000ULL
@@ -525,6 +561,116 @@ typedef struct {
 void config_l2_cache(void);
 uint8_t check_num_scratch_ways(uint64_t *start, uint64_t *end);
 
+/*==============================================================================
+ * Cache maintenance by address range, for buffers shared with DMA masters.
+ *
+ * mss_l2_flush_range() writes back any dirty L2 lines holding the range and
+ * evicts them. The L2 probes the L1 data caches as part of the flush so lines
+ * dirty in L1 are written back as well. Call it before a DMA master reads a
+ * buffer the CPU has written, and before handing a buffer to a DMA master to
+ * write into so no dirty line is later evicted on top of the DMA data.
+ *
+ * mss_l2_invalidate_range() is for buffers a DMA master has written, to make
+ * sure the CPU does not read stale lines. The L2 controller only has a flush
+ * operation, so dirty lines in the range are written back before they are
+ * evicted. This is harmless as long as the CPU has not written to the buffer
+ * while the DMA master owned it.
+ *
+ * The range is rounded out to whole 64 byte cache lines, so buffers shared with
+ * DMA masters should be cache line aligned and a whole number of lines long.
+ * Ranges outside the cached DDR regions are ignored.
+ */
+void mss_l2_flush_range(uint64_t start, uint64_t length);
+void mss_l2_invalidate_range(uint64_t start, uint64_t length);
+
+/*------------------------------------------------------------------------------
+ * mss_l2_flush_all() writes back and evicts all the lines cached in the L2,
+ * and so in the L1 data caches, e.g. before the DDR is put in self-refresh. It
+ * takes time proportional to the size of the cache, not of the DDR, and
+ * returns ERROR, doing nothing, if any ways hold locked lines. The other
+ * masters must not access cached DDR while it runs.
+ */
+uint8_t mss_l2_flush_all(void);
+
+/*==============================================================================
+ * Runtime way partitioning.
+ *
+ * The way mask of a master selects the L2 ways it can allocate lines into, so
+ * that its misses only evict lines from those ways. The masters are listed in
+ * the order of their WAY_MASK registers.
+ *
+ * mss_l2_set_way_mask() sets the way mask of one master.
+ * mss_l2_dedicate_ways() sets the way mask of one master and removes its ways
+ * from the masks of all the other masters, so that for example a hart running
+ * a latency critical loop keeps its lines in the L2 whatever the DMA traffic.
+ * Both return ERROR, without changing any mask, when the mask is empty, uses
+ * ways which are not enabled or are used as scratchpad, or would leave another
+ * master without any way.
+ *
+ * The way masks only apply to allocation: lines held in a way removed from a
+ * master are still hit and written back normally, so no flush is needed when
+ * ways are taken from a master. The lines other masters hold in dedicated ways
+ * are replaced as the dedicated master allocates into them, or immediately by
+ * flushing their address ranges with mss_l2_flush_range().
+ */
+typedef enum
+{
+    L2_MASTER_DMA = 0,
+    L2_MASTER_AXI4_SLAVE_PORT_0,
+    L2_MASTER_AXI4_SLAVE_PORT_1,
+    L2_MASTER_AXI4_SLAVE_PORT_2,
+    L2_MASTER_AXI4_SLAVE_PORT_3,
+    L2_MASTER_E51_DCACHE,
+    L2_MASTER_E51_ICACHE,
+    L2_MASTER_U54_1_DCACHE,
+    L2_MASTER_U54_1_ICACHE,
+    L2_MASTER_U54_2_DCACHE,
+    L2_MASTER_U54_2_ICACHE,
+    L2_MASTER_U54_3_DCACHE,
+    L2_MASTER_U54_3_ICACHE,
+    L2_MASTER_U54_4_DCACHE,
+    L2_MASTER_U54_4_ICACHE,
+    L2_NUM_MASTERS
+} mss_l2_master_t;
+
+uint8_t mss_l2_set_way_mask(mss_l2_master_t master, uint64_t way_mask);
+uint8_t mss_l2_dedicate_ways(mss_l2_master_t master, uint64_t way_mask);
+uint64_t mss_l2_get_way_mask(mss_l2_master_t master);
+
+/*==============================================================================
+ * Cache locking.
+ *
+ * mss_l2_lock_range() keeps an address range, for example the text of an
+ * interrupt handler, a handler table or a descriptor ring, held in the L2 so
+ * that accesses to it never wait for the DDR. The ways given are removed from
+ * the way masks of all the masters and the range is loaded into them by the
+ * calling hart, the same way config_l2_cache() primes the scratchpad ways. As
+ * no master can then allocate into the ways, the lines of the range are never
+ * evicted. Hits, including instruction fetches, and writes to the range are
+ * served by the locked lines.
+ *
+ * The range must be in a cached DDR region and no longer than the ways given,
+ * 128 Kbytes per way, and the ways must not be locked already. Every master
+ * must keep at least one way. It returns ERROR, without changing anything,
+ * otherwise.
+ *
+ * mss_l2_flush_range() on a locked range evicts it, so the range must not be
+ * shared with DMA masters which need it flushed. mss_l2_unlock_ways() releases
+ * the ways, which can then be given back to the masters with
+ * mss_l2_set_way_mask(). mss_l2_get_locked_ways() returns the ways locked.
+ *
+ * Example:
+ * @code
+ *   extern char __gem_isr_start, __gem_isr_end;
+ *
+ *   (void)mss_l2_lock_range((uint64_t)&__gem_isr_start,
+ *           (uint64_t)(&__gem_isr_end - &__gem_isr_start), 0x0080U);
+ * @endcode
+ */
+uint8_t mss_l2_lock_range(uint64_t start, uint64_t length, uint64_t way_mask);
+void mss_l2_unlock_ways(uint64_t way_mask);
+uint64_t mss_l2_get_locked_ways(void);
+
 #ifdef __cplusplus
 }
 #endif
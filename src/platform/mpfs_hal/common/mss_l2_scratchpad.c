@@ -0,0 +1,225 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_l2_scratchpad.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief L2 scratchpad placement and allocation
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define L2_SCRATCHPAD_MIN_ALIGN     8U
+
+extern char __l2_scratchpad_heap_start;
+extern char __l2_scratchpad_heap_end;
+
+static uintptr_t g_l2_scratchpad_next = 0U;
+static volatile long g_l2_scratchpad_lock = 0;
+
+/*
+ * Returns the aligned start of an allocation of size bytes from next, so that
+ * it ends at or before end, or 0.
+ */
+static uintptr_t l2_carve(uintptr_t * next, uintptr_t end, size_t size,
+        size_t align)
+{
+    uintptr_t start;
+    uintptr_t block = 0U;
+
+    if(align < L2_SCRATCHPAD_MIN_ALIGN)
+    {
+        align = L2_SCRATCHPAD_MIN_ALIGN;
+    }
+
+    if(0U == (align & (align - 1U)))
+    {
+        start = (*next + (align - 1U)) & ~((uintptr_t)align - 1U);
+
+        if((start >= *next) && (start <= end) && (size <= (end - start)))
+        {
+            block = start;
+            *next = start + size;
+        }
+    }
+
+    return (block);
+}
+
+/***************************************************************************//**
+ * See mss_l2_scratchpad.h
+ */
+void * mss_l2_scratchpad_alloc(size_t size, size_t align)
+{
+    uint64_t mstatus;
+    uintptr_t block;
+
+    mstatus = disable_interrupts();
+    spinlock(&g_l2_scratchpad_lock);
+
+    if(0U == g_l2_scratchpad_next)
+    {
+        g_l2_scratchpad_next = (uintptr_t)&__l2_scratchpad_heap_start;
+    }
+
+    block = l2_carve(&g_l2_scratchpad_next,
+            (uintptr_t)&__l2_scratchpad_heap_end, size, align);
+
+    spinunlock(&g_l2_scratchpad_lock);
+    restore_interrupts(mstatus);
+
+    return ((void *)block);
+}
+
+/***************************************************************************//**
+ * See mss_l2_scratchpad.h
+ */
+size_t mss_l2_scratchpad_available(void)
+{
+    uintptr_t next = g_l2_scratchpad_next;
+
+    if(0U == next)
+    {
+        next = (uintptr_t)&__l2_scratchpad_heap_start;
+    }
+
+    return ((size_t)((uintptr_t)&__l2_scratchpad_heap_end - next));
+}
+
+/***************************************************************************//**
+ * See mss_l2_scratchpad.h
+ */
+uint8_t mss_l2_arena_init(mss_l2_arena_t * arena, size_t size)
+{
+    uintptr_t base = (uintptr_t)mss_l2_scratchpad_alloc(size, 0U);
+    uint8_t ret_val = ERROR;
+
+    if(0U != base)
+    {
+        arena->base = base;
+        arena->next = base;
+        arena->end = base + size;
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_l2_scratchpad.h
+ */
+void * mss_l2_arena_alloc(mss_l2_arena_t * arena, size_t size, size_t align)
+{
+    return ((void *)l2_carve(&arena->next, arena->end, size, align));
+}
+
+/***************************************************************************//**
+ * See mss_l2_scratchpad.h
+ */
+void mss_l2_arena_reset(mss_l2_arena_t * arena)
+{
+    arena->next = arena->base;
+}
+
+/***************************************************************************//**
+ * See mss_l2_scratchpad.h
+ */
+uint8_t mss_l2_pool_init(mss_l2_pool_t * pool, size_t block_size,
+        uint32_t count)
+{
+    uintptr_t base;
+    uintptr_t block;
+    uint32_t inc;
+    uint8_t ret_val = ERROR;
+
+    block_size = (block_size + (L2_SCRATCHPAD_MIN_ALIGN - 1U)) &
+            ~((size_t)L2_SCRATCHPAD_MIN_ALIGN - 1U);
+
+    if((0U != block_size) && (0U != count) &&
+       (block_size <= ((size_t)-1 / count)))
+    {
+        base = (uintptr_t)mss_l2_scratchpad_alloc(block_size * count,
+                CACHE_BLOCK_BYTE_LENGTH);
+
+        if(0U != base)
+        {
+            pool->free_list = (void *)0;
+
+            /* Chain the blocks so that the first one is allocated first */
+            for(inc = count; inc > 0U; inc--)
+            {
+                block = base + ((inc - 1U) * block_size);
+                *(void **)block = pool->free_list;
+                pool->free_list = (void *)block;
+            }
+
+            pool->block_size = block_size;
+            pool->count = count;
+            pool->free_count = count;
+            pool->lock = 0;
+            ret_val = SUCCESS;
+        }
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_l2_scratchpad.h
+ */
+void * mss_l2_pool_alloc(mss_l2_pool_t * pool)
+{
+    uint64_t mstatus;
+    void * block;
+
+    mstatus = disable_interrupts();
+    spinlock(&pool->lock);
+
+    block = pool->free_list;
+
+    if((void *)0 != block)
+    {
+        pool->free_list = *(void **)block;
+        pool->free_count--;
+    }
+
+    spinunlock(&pool->lock);
+    restore_interrupts(mstatus);
+
+    return (block);
+}
+
+/***************************************************************************//**
+ * See mss_l2_scratchpad.h
+ */
+void mss_l2_pool_free(mss_l2_pool_t * pool, void * block)
+{
+    uint64_t mstatus;
+
+    if((void *)0 != block)
+    {
+        mstatus = disable_interrupts();
+        spinlock(&pool->lock);
+
+        *(void **)block = pool->free_list;
+        pool->free_list = block;
+        pool->free_count++;
+
+        spinunlock(&pool->lock);
+        restore_interrupts(mstatus);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
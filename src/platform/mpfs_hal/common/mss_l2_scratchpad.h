@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_l2_scratchpad.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief L2 scratchpad placement and allocation
+ *
+ * The L2 scratchpad gives deterministic access latency, as its lines are
+ * never evicted. Data is placed in it either at link time or at run time.
+ *
+ * At link time, variables declared with L2_SCRATCHPAD are placed in the
+ * .l2_scratchpad section and initialised from their load address by
+ * init_memory(), and variables declared with L2_SCRATCHPAD_BSS are placed in
+ * the .l2_scratchpad_bss section and cleared by init_memory().
+ *
+ * At run time, memory is taken from the area reserved by
+ * L2_SCRATCHPAD_HEAP_SIZE in the linker script:
+ *  - mss_l2_scratchpad_alloc() allocates from the area for any hart. The
+ *    allocations are never freed, so that the layout is fixed once the
+ *    application is initialised.
+ *  - an arena is a block of the area owned by one hart, allocated from without
+ *    locking with mss_l2_arena_alloc() and released as a whole with
+ *    mss_l2_arena_reset().
+ *  - a pool is a block of the area split into blocks of the same size, which
+ *    any hart or interrupt handler can allocate and free in constant time.
+ *
+ * The scratchpad ways configured, LIBERO_SETTING_NUM_SCRATCH_PAD_WAYS, must
+ * cover all the scratchpad sections. This is checked by config_l2_cache().
+ */
+#ifndef MSS_L2_SCRATCHPAD_H
+#define MSS_L2_SCRATCHPAD_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define L2_SCRATCHPAD       __attribute__((section(".l2_scratchpad")))
+#define L2_SCRATCHPAD_BSS   __attribute__((section(".l2_scratchpad_bss")))
+
+typedef struct
+{
+    uintptr_t base;
+    uintptr_t next;
+    uintptr_t end;
+} mss_l2_arena_t;
+
+typedef struct
+{
+    void * free_list;
+    size_t block_size;
+    uint32_t count;
+    uint32_t free_count;
+    volatile long lock;
+} mss_l2_pool_t;
+
+/***************************************************************************//**
+ * mss_l2_scratchpad_alloc() returns size bytes of the scratchpad allocator
+ * area aligned to align bytes, a power of two, or a null pointer when the area
+ * is exhausted. An align of 0 gives 8 byte alignment.
+ *
+ * Example:
+ * @code
+ *   rx_ring = mss_l2_scratchpad_alloc(RX_RING_SIZE, 64U);
+ * @endcode
+ */
+void * mss_l2_scratchpad_alloc(size_t size, size_t align);
+
+/***************************************************************************//**
+ * mss_l2_scratchpad_available() returns the number of bytes of the scratchpad
+ * allocator area not allocated yet.
+ */
+size_t mss_l2_scratchpad_available(void);
+
+/***************************************************************************//**
+ * mss_l2_arena_init() allocates size bytes of the scratchpad allocator area to
+ * an arena. It returns SUCCESS, or ERROR when the area is exhausted.
+ */
+uint8_t mss_l2_arena_init(mss_l2_arena_t * arena, size_t size);
+
+/***************************************************************************//**
+ * mss_l2_arena_alloc() returns size bytes of the arena aligned as for
+ * mss_l2_scratchpad_alloc(), or a null pointer when the arena is exhausted.
+ * An arena must only be used by one hart and is not locked.
+ */
+void * mss_l2_arena_alloc(mss_l2_arena_t * arena, size_t size, size_t align);
+
+/***************************************************************************//**
+ * mss_l2_arena_reset() releases all the allocations made from the arena.
+ */
+void mss_l2_arena_reset(mss_l2_arena_t * arena);
+
+/***************************************************************************//**
+ * mss_l2_pool_init() allocates count blocks of block_size bytes from the
+ * scratchpad allocator area to a pool. The block size is rounded up to a
+ * multiple of 8 bytes and the first block is cache line aligned. It returns
+ * SUCCESS, or ERROR when the area is exhausted.
+ *
+ * Example:
+ * @code
+ *   static mss_l2_pool_t g_frame_pool;
+ *
+ *   (void)mss_l2_pool_init(&g_frame_pool, 1536U, 32U);
+ *   frame = mss_l2_pool_alloc(&g_frame_pool);
+ * @endcode
+ */
+uint8_t mss_l2_pool_init(mss_l2_pool_t * pool, size_t block_size,
+        uint32_t count);
+
+/***************************************************************************//**
+ * mss_l2_pool_alloc() returns a free block of the pool, or a null pointer when
+ * all the blocks are allocated.
+ */
+void * mss_l2_pool_alloc(mss_l2_pool_t * pool);
+
+/***************************************************************************//**
+ * mss_l2_pool_free() returns a block allocated from the pool.
+ */
+void mss_l2_pool_free(mss_l2_pool_t * pool, void * block);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_L2_SCRATCHPAD_H */
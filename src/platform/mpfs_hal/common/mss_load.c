@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_load.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Hart utilisation accounting
+ *
+ */
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MPFS_HAL_LOAD_ACCOUNTING
+
+#define LOAD_NUM_HARTS              (MPFS_HAL_LAST_HART + 1U)
+#define LOAD_CYCLES_PER_MTIME       (LIBERO_SETTING_MSS_COREPLEX_CPU_CLK / \
+                                        LIBERO_SETTING_MSS_RTC_TOGGLE_CLK)
+#define LOAD_FULL_SCALE             10000U
+
+/*
+ * State of a hart, written only by the hart itself and read by the others
+ * under the sequence count, which is odd while the hart updates it. One cache
+ * line per hart.
+ */
+typedef struct
+{
+    uint64_t seq;
+    uint64_t cycles[MSS_LOAD_NUM_STATES];
+    uint64_t last_cycle;
+    uint64_t last_mtime;
+    uint32_t state;
+    uint32_t trap_saved;    /* State the outermost trap returns to */
+    uint32_t idle_saved;    /* State mss_load_idle_exit() returns to */
+    uint32_t trap_depth;
+} __attribute__((aligned(64))) load_hart_t;
+
+static load_hart_t g_load[LOAD_NUM_HARTS];
+
+static void load_switch(load_hart_t * load, uint32_t state);
+
+/***************************************************************************//**
+ * See mss_load.h
+ */
+void mss_load_idle_enter(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t mstatus;
+
+    if (hart_id < LOAD_NUM_HARTS)
+    {
+        mstatus = disable_interrupts();
+        g_load[hart_id].idle_saved = g_load[hart_id].state;
+        load_switch(&g_load[hart_id], MSS_LOAD_IDLE);
+        restore_interrupts(mstatus);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_load.h
+ */
+void mss_load_idle_exit(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t mstatus;
+
+    if (hart_id < LOAD_NUM_HARTS)
+    {
+        mstatus = disable_interrupts();
+        load_switch(&g_load[hart_id], g_load[hart_id].idle_saved);
+        restore_interrupts(mstatus);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_load.h
+ */
+void mss_load_trap_enter(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    load_hart_t * load;
+
+    if (hart_id < LOAD_NUM_HARTS)
+    {
+        load = &g_load[hart_id];
+
+        if (0U == load->trap_depth)
+        {
+            load->trap_saved = load->state;
+            load_switch(load, MSS_LOAD_ISR);
+        }
+
+        load->trap_depth++;
+    }
+}
+
+/***************************************************************************//**
+ * See mss_load.h
+ */
+void mss_load_trap_exit(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    load_hart_t * load;
+
+    if (hart_id < LOAD_NUM_HARTS)
+    {
+        load = &g_load[hart_id];
+        load->trap_depth--;
+
+        if (0U == load->trap_depth)
+        {
+            load_switch(load, load->trap_saved);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_load.h
+ */
+void mss_load_get_sample(uint64_t hart_id, mss_load_sample_t * sample)
+{
+    load_hart_t * load;
+    uint64_t seq;
+    uint64_t last_cycle;
+    uint64_t last_mtime;
+    uint32_t state;
+    uint32_t idx;
+
+    (void)memset(sample, 0, sizeof(mss_load_sample_t));
+
+    if (hart_id < LOAD_NUM_HARTS)
+    {
+        load = &g_load[hart_id];
+
+        do
+        {
+            seq = __atomic_load_n(&load->seq, __ATOMIC_ACQUIRE);
+
+            for (idx = 0U; idx < MSS_LOAD_NUM_STATES; idx++)
+            {
+                sample->cycles[idx] = load->cycles[idx];
+            }
+
+            last_cycle = load->last_cycle;
+            last_mtime = load->last_mtime;
+            state = load->state;
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        } while ((0U != (seq & 1U)) ||
+                 (seq != __atomic_load_n(&load->seq, __ATOMIC_RELAXED)));
+
+        /* Add the cycles of the current state */
+        if (hart_id == read_csr(mhartid))
+        {
+            sample->cycles[state] += read_csr(mcycle) - last_cycle;
+        }
+        else
+        {
+            sample->cycles[state] += (readmtime() - last_mtime) *
+                    LOAD_CYCLES_PER_MTIME;
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_load.h
+ */
+void mss_load_utilisation
+(
+    const mss_load_sample_t * from,
+    const mss_load_sample_t * to,
+    mss_load_util_t * util
+)
+{
+    uint64_t delta[MSS_LOAD_NUM_STATES];
+    uint64_t total = 0U;
+    uint32_t shift = 0U;
+    uint32_t idx;
+
+    for (idx = 0U; idx < MSS_LOAD_NUM_STATES; idx++)
+    {
+        delta[idx] = to->cycles[idx] - from->cycles[idx];
+        total += delta[idx];
+    }
+
+    /* Scale down so that the products below do not overflow */
+    while ((total >> shift) > (1ULL << 48U))
+    {
+        shift++;
+    }
+
+    total >>= shift;
+
+    if (0U == total)
+    {
+        util->busy = 0U;
+        util->idle = 0U;
+        util->isr = 0U;
+    }
+    else
+    {
+        util->busy = (uint32_t)(((delta[MSS_LOAD_BUSY] >> shift) *
+                LOAD_FULL_SCALE) / total);
+        util->isr = (uint32_t)(((delta[MSS_LOAD_ISR] >> shift) *
+                LOAD_FULL_SCALE) / total);
+        util->idle = LOAD_FULL_SCALE - util->busy - util->isr;
+    }
+}
+
+/***************************************************************************//**
+ * Adds the cycles since the last transition to the current state of the hart
+ * and moves it to a new state. Called with interrupts disabled.
+ */
+static void load_switch(load_hart_t * load, uint32_t state)
+{
+    uint64_t now = read_csr(mcycle);
+    uint64_t mtime = readmtime();
+
+    __atomic_store_n(&load->seq, load->seq + 1U, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    load->cycles[load->state] += now - load->last_cycle;
+    load->last_cycle = now;
+    load->last_mtime = mtime;
+    load->state = state;
+
+    __atomic_store_n(&load->seq, load->seq + 1U, __ATOMIC_RELEASE);
+}
+
+#endif /* MPFS_HAL_LOAD_ACCOUNTING */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_load.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Hart utilisation accounting
+ *
+ * When MPFS_HAL_LOAD_ACCOUNTING is defined in mss_sw_config.h, the HAL counts
+ * for each hart the mcycle cycles spent in three states:
+ *  - idle, in wfi, entered from mss_idle_wait() and the delays built on it,
+ *    the task scheduler of mss_task_sched.h, park_hart(), mss_park_hart()
+ *    and the idle hook of an RTOS calling mss_load_idle_enter() and
+ *    mss_load_idle_exit() around its wfi,
+ *  - interrupt, from the entry to the return of trap_from_machine_mode() or
+ *    of the vectored interrupt stubs, nested interrupts included,
+ *  - busy, the rest.
+ *
+ * An interrupt taken from wfi is counted as interrupt time and the hart goes
+ * back to idle when it returns. Each transition costs two mcycle reads and a
+ * few stores to a cache line of the hart.
+ *
+ * Any hart can read the counts of any hart with mss_load_get_sample(). The
+ * cycles of the current state of another hart, which cannot read its mcycle,
+ * are estimated from mtime. mss_load_utilisation() gives the share of each
+ * state between two samples, e.g. to compare the load of U54_1 to U54_4 over
+ * the last second:
+ * @code
+ *   mss_load_sample_t prev[5], now;
+ *   mss_load_util_t util;
+ *
+ *   mss_load_get_sample(hart_id, &now);
+ *   mss_load_utilisation(&prev[hart_id], &now, &util);
+ *   prev[hart_id] = now;
+ *   // util.busy + util.isr is the load of the hart, in 1/100 of a percent
+ * @endcode
+ */
+#ifndef MSS_LOAD_H
+#define MSS_LOAD_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Accounting states
+ */
+#define MSS_LOAD_BUSY                   0U
+#define MSS_LOAD_IDLE                   1U
+#define MSS_LOAD_ISR                    2U
+#define MSS_LOAD_NUM_STATES             3U
+
+typedef struct
+{
+    uint64_t cycles[MSS_LOAD_NUM_STATES];   /* mcycle cycles in each state */
+} mss_load_sample_t;
+
+typedef struct
+{
+    /* Shares of the time in 1/100 of a percent, adding up to 10000 */
+    uint32_t busy;
+    uint32_t idle;
+    uint32_t isr;
+} mss_load_util_t;
+
+/***************************************************************************//**
+ * mss_load_idle_enter() and mss_load_idle_exit() are called by the calling
+ * hart just before and just after its wfi.
+ */
+void mss_load_idle_enter(void);
+void mss_load_idle_exit(void);
+
+/***************************************************************************//**
+ * mss_load_trap_enter() and mss_load_trap_exit() are called on entry to and on
+ * return from the trap handlers of the HAL.
+ */
+void mss_load_trap_enter(void);
+void mss_load_trap_exit(void);
+
+/***************************************************************************//**
+ * mss_load_get_sample() copies to sample the cycles a hart has spent in each
+ * state since reset, up to now.
+ */
+void mss_load_get_sample(uint64_t hart_id, mss_load_sample_t * sample);
+
+/***************************************************************************//**
+ * mss_load_utilisation() gives the share of each state between two samples of
+ * the same hart. The shares are 0 if no cycle went by.
+ */
+void mss_load_utilisation
+(
+    const mss_load_sample_t * from,
+    const mss_load_sample_t * to,
+    mss_load_util_t * util
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_LOAD_H */
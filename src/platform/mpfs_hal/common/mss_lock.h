@@ -0,0 +1,313 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_lock.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Spinlock, ticket lock, reader-writer lock and sequence lock
+ *
+ * The locks are built on the RISC-V atomic memory operations with acquire
+ * ordering when a lock is taken and release ordering when it is given back, so
+ * that the accesses made while holding a lock are seen by the next holder
+ * without full fences.
+ *
+ * - mss_spinlock_t is taken with amoswap and waits with plain loads, so that a
+ *   waiting hart does not keep stealing the cache line from the holder.
+ * - mss_ticket_lock_t hands the lock to the waiting harts in the order they
+ *   asked for it, using amoadd on the ticket counter.
+ * - mss_rwlock_t lets any number of readers, or one writer, hold the lock. A
+ *   waiting writer stops new readers from taking the lock.
+ * - mss_seqlock_t lets readers run without writing to shared memory at all.
+ *   A reader retries if a writer updated the data while it read it, so the
+ *   data read must not be used before mss_seqlock_read_retry() returns 0.
+ *
+ * The _irqsave variants also disable interrupts on the calling hart, for
+ * state shared with interrupt handlers, and return the mstatus value to give
+ * back to the matching _irqrestore function.
+ *
+ * When MPFS_HAL_LOCK_STATS is defined in mss_sw_config.h, each lock counts the
+ * times it was taken, the times it was found held, and the polling loops spent
+ * waiting for it.
+ *
+ * All lock types are zero when free, so static locks need no initialisation.
+ */
+#ifndef MSS_LOCK_H
+#define MSS_LOCK_H
+
+#include <stdint.h>
+#include "mss_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    uint64_t acquisitions;
+    uint64_t contentions;
+    uint64_t spins;
+} mss_lock_stats_t;
+
+typedef struct
+{
+    volatile uint32_t locked;
+#ifdef MPFS_HAL_LOCK_STATS
+    mss_lock_stats_t stats;
+#endif
+} mss_spinlock_t;
+
+typedef struct
+{
+    volatile uint32_t next;
+    volatile uint32_t owner;
+#ifdef MPFS_HAL_LOCK_STATS
+    mss_lock_stats_t stats;
+#endif
+} mss_ticket_lock_t;
+
+#define MSS_RWLOCK_WRITER           0x80000000U
+#define MSS_RWLOCK_WRITER_WAITING   0x40000000U
+#define MSS_RWLOCK_READERS          0x3FFFFFFFU
+
+typedef struct
+{
+    volatile uint32_t state;
+#ifdef MPFS_HAL_LOCK_STATS
+    mss_lock_stats_t stats;
+#endif
+} mss_rwlock_t;
+
+typedef struct
+{
+    volatile uint32_t sequence;
+    mss_spinlock_t writer;
+} mss_seqlock_t;
+
+#ifdef MPFS_HAL_LOCK_STATS
+static inline void mss_lock_count(mss_lock_stats_t * stats, uint64_t spins)
+{
+    (void)__atomic_fetch_add(&stats->acquisitions, 1U, __ATOMIC_RELAXED);
+
+    if (0U != spins)
+    {
+        (void)__atomic_fetch_add(&stats->contentions, 1U, __ATOMIC_RELAXED);
+        (void)__atomic_fetch_add(&stats->spins, spins, __ATOMIC_RELAXED);
+    }
+}
+#define MSS_LOCK_COUNT(lock, spins)     mss_lock_count(&(lock)->stats, (spins))
+#else
+#define MSS_LOCK_COUNT(lock, spins)     ((void)(spins))
+#endif
+
+/*==============================================================================
+ * Spinlock
+ */
+static inline uint8_t mss_spin_trylock(mss_spinlock_t * lock)
+{
+    uint8_t ret_val = ERROR;
+
+    if (0U == __atomic_exchange_n(&lock->locked, 1U, __ATOMIC_ACQUIRE))
+    {
+        MSS_LOCK_COUNT(lock, 0U);
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+static inline void mss_spin_lock(mss_spinlock_t * lock)
+{
+    uint64_t spins = 0U;
+
+    while (0U != __atomic_exchange_n(&lock->locked, 1U, __ATOMIC_ACQUIRE))
+    {
+        while (0U != __atomic_load_n(&lock->locked, __ATOMIC_RELAXED))
+        {
+            spins++;
+        }
+    }
+
+    MSS_LOCK_COUNT(lock, spins);
+}
+
+static inline void mss_spin_unlock(mss_spinlock_t * lock)
+{
+    __atomic_store_n(&lock->locked, 0U, __ATOMIC_RELEASE);
+}
+
+static inline uint64_t mss_spin_lock_irqsave(mss_spinlock_t * lock)
+{
+    uint64_t mstatus = disable_interrupts();
+
+    mss_spin_lock(lock);
+
+    return (mstatus);
+}
+
+static inline void mss_spin_unlock_irqrestore(mss_spinlock_t * lock,
+        uint64_t mstatus)
+{
+    mss_spin_unlock(lock);
+    restore_interrupts(mstatus);
+}
+
+/*==============================================================================
+ * Ticket lock
+ */
+static inline void mss_ticket_lock(mss_ticket_lock_t * lock)
+{
+    uint32_t ticket = __atomic_fetch_add(&lock->next, 1U, __ATOMIC_RELAXED);
+    uint64_t spins = 0U;
+
+    while (ticket != __atomic_load_n(&lock->owner, __ATOMIC_ACQUIRE))
+    {
+        spins++;
+    }
+
+    MSS_LOCK_COUNT(lock, spins);
+}
+
+static inline void mss_ticket_unlock(mss_ticket_lock_t * lock)
+{
+    /* Only the holder writes the owner, so no atomic increment is needed */
+    __atomic_store_n(&lock->owner, lock->owner + 1U, __ATOMIC_RELEASE);
+}
+
+static inline uint64_t mss_ticket_lock_irqsave(mss_ticket_lock_t * lock)
+{
+    uint64_t mstatus = disable_interrupts();
+
+    mss_ticket_lock(lock);
+
+    return (mstatus);
+}
+
+static inline void mss_ticket_unlock_irqrestore(mss_ticket_lock_t * lock,
+        uint64_t mstatus)
+{
+    mss_ticket_unlock(lock);
+    restore_interrupts(mstatus);
+}
+
+/*==============================================================================
+ * Reader-writer lock
+ */
+static inline void mss_read_lock(mss_rwlock_t * lock)
+{
+    uint32_t state;
+    uint64_t spins = 0U;
+
+    for (;;)
+    {
+        state = __atomic_load_n(&lock->state, __ATOMIC_RELAXED);
+
+        if ((0U == (state & (MSS_RWLOCK_WRITER | MSS_RWLOCK_WRITER_WAITING))) &&
+            __atomic_compare_exchange_n(&lock->state, &state, state + 1U, 0,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            break;
+        }
+
+        spins++;
+    }
+
+    MSS_LOCK_COUNT(lock, spins);
+}
+
+static inline void mss_read_unlock(mss_rwlock_t * lock)
+{
+    (void)__atomic_fetch_sub(&lock->state, 1U, __ATOMIC_RELEASE);
+}
+
+static inline void mss_write_lock(mss_rwlock_t * lock)
+{
+    uint32_t state;
+    uint64_t spins = 0U;
+
+    for (;;)
+    {
+        state = __atomic_load_n(&lock->state, __ATOMIC_RELAXED);
+
+        if (0U == (state & ~MSS_RWLOCK_WRITER_WAITING))
+        {
+            if (__atomic_compare_exchange_n(&lock->state, &state,
+                                            MSS_RWLOCK_WRITER, 0,
+                                            __ATOMIC_ACQUIRE,
+                                            __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (0U == (state & MSS_RWLOCK_WRITER_WAITING))
+        {
+            (void)__atomic_fetch_or(&lock->state, MSS_RWLOCK_WRITER_WAITING,
+                                    __ATOMIC_RELAXED);
+        }
+        else
+        {
+            /* wait for the readers or the writer to leave */
+        }
+
+        spins++;
+    }
+
+    MSS_LOCK_COUNT(lock, spins);
+}
+
+static inline void mss_write_unlock(mss_rwlock_t * lock)
+{
+    /* Keep the flag of another waiting writer */
+    (void)__atomic_fetch_and(&lock->state, ~MSS_RWLOCK_WRITER,
+                             __ATOMIC_RELEASE);
+}
+
+/*==============================================================================
+ * Sequence lock
+ */
+static inline void mss_seqlock_write_begin(mss_seqlock_t * lock)
+{
+    mss_spin_lock(&lock->writer);
+    __atomic_store_n(&lock->sequence, lock->sequence + 1U, __ATOMIC_RELAXED);
+    /* The odd sequence must be visible before any of the data changes */
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void mss_seqlock_write_end(mss_seqlock_t * lock)
+{
+    __atomic_store_n(&lock->sequence, lock->sequence + 1U, __ATOMIC_RELEASE);
+    mss_spin_unlock(&lock->writer);
+}
+
+static inline uint32_t mss_seqlock_read_begin(const mss_seqlock_t * lock)
+{
+    uint32_t sequence;
+
+    do
+    {
+        sequence = __atomic_load_n(&lock->sequence, __ATOMIC_ACQUIRE);
+    } while (0U != (sequence & 1U));
+
+    return (sequence);
+}
+
+static inline uint8_t mss_seqlock_read_retry(const mss_seqlock_t * lock,
+        uint32_t sequence)
+{
+    /* The data reads must complete before the sequence is read again */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    return ((sequence != __atomic_load_n(&lock->sequence, __ATOMIC_RELAXED)) ?
+            1U : 0U);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_LOCK_H */
@@ -0,0 +1,355 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_lz4.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief LZ4 decompression of load images
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LZ4_WORD_BYTES      8U
+#define LZ4_MIN_MATCH       4U
+/* Matches this far behind the output or more can be copied a word at a time */
+#define LZ4_WIDE_OFFSET     16U
+
+/*
+ * Keep the code with the start-up code, which runs from the load address, and
+ * keep the compiler from turning the copy loops into calls to memcpy().
+ */
+#define LZ4_BOOT_CODE       __attribute__((section(".text.init"), \
+                                optimize("no-tree-loop-distribute-patterns")))
+
+/*------------------------------------------------------------------------------
+ * Copies n bytes forward. The destination is aligned and each word stored is
+ * merged from two aligned source words when need be. The source may overlap
+ * the destination if it is at least LZ4_WIDE_OFFSET bytes behind it: every
+ * source word is then loaded after the bytes of it which are used have been
+ * stored.
+ */
+LZ4_BOOT_CODE static void lz4_copy(uint8_t * d, const uint8_t * s, uint64_t n)
+{
+    uint64_t * dw;
+    const uint64_t * sw;
+    uint64_t w0;
+    uint64_t w1;
+    uint32_t lo;
+    uint32_t hi;
+
+    if (n >= (2U * LZ4_WORD_BYTES))
+    {
+        /* Align the destination */
+        while (0U != ((uintptr_t)d & (LZ4_WORD_BYTES - 1U)))
+        {
+            *d++ = *s++;
+            n--;
+        }
+
+        dw = (uint64_t *)d;
+        lo = (uint32_t)((uintptr_t)s & (LZ4_WORD_BYTES - 1U)) * 8U;
+
+        if (0U == lo)
+        {
+            sw = (const uint64_t *)s;
+
+            while (n >= LZ4_WORD_BYTES)
+            {
+                *dw++ = *sw++;
+                n -= LZ4_WORD_BYTES;
+            }
+        }
+        else
+        {
+            hi = 64U - lo;
+            sw = (const uint64_t *)((uintptr_t)s & ~(uintptr_t)(LZ4_WORD_BYTES - 1U));
+            w0 = *sw++;
+
+            while (n >= LZ4_WORD_BYTES)
+            {
+                w1 = *sw++;
+                *dw++ = (w0 >> lo) | (w1 << hi);
+                w0 = w1;
+                n -= LZ4_WORD_BYTES;
+            }
+        }
+
+        s += ((uint8_t *)dw - d);
+        d = (uint8_t *)dw;
+    }
+
+    while (0U != n)
+    {
+        *d++ = *s++;
+        n--;
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Adds the extra length bytes following a token nibble of 15 to *len.
+ * Returns 0 if the input ran out first.
+ */
+LZ4_BOOT_CODE static uint8_t lz4_length
+(
+    const uint8_t ** p_ip,
+    const uint8_t * ip_end,
+    uint64_t * len
+)
+{
+    const uint8_t * ip = *p_ip;
+    uint8_t ok = 0U;
+    uint8_t more = 1U;
+
+    while ((1U == more) && (ip < ip_end))
+    {
+        *len += *ip;
+        more = (255U == *ip) ? 1U : 0U;
+        ip++;
+    }
+
+    if (0U == more)
+    {
+        ok = 1U;
+    }
+
+    *p_ip = ip;
+
+    return (ok);
+}
+
+/*------------------------------------------------------------------------------
+ * Reads a little endian 32 bit word from a byte address.
+ */
+LZ4_BOOT_CODE static uint32_t lz4_read32(const uint8_t * p)
+{
+    return ((uint32_t)p[0] | ((uint32_t)p[1] << 8U) |
+            ((uint32_t)p[2] << 16U) | ((uint32_t)p[3] << 24U));
+}
+
+/***************************************************************************//**
+ * See mss_lz4.h
+ */
+LZ4_BOOT_CODE uint64_t mss_lz4_decompress
+(
+    void * dst,
+    uint64_t dst_size,
+    const void * src,
+    uint64_t src_size
+)
+{
+    const uint8_t * ip = (const uint8_t *)src;
+    const uint8_t * const ip_end = ip + src_size;
+    uint8_t * const op_start = (uint8_t *)dst;
+    uint8_t * op = op_start;
+    uint8_t * const op_end = op + dst_size;
+    uint64_t result = MSS_LZ4_ERROR;
+    uint64_t len;
+    uint64_t offset;
+    uint32_t token;
+    uint8_t done = 0U;
+    uint8_t error = 0U;
+
+    while ((0U == done) && (0U == error))
+    {
+        if (ip >= ip_end)
+        {
+            error = 1U;
+        }
+        else
+        {
+            /* Literals */
+            token = *ip++;
+            len = token >> 4U;
+
+            if ((15U == len) && (0U == lz4_length(&ip, ip_end, &len)))
+            {
+                error = 1U;
+            }
+            else if ((len > (uint64_t)(ip_end - ip)) ||
+                     (len > (uint64_t)(op_end - op)))
+            {
+                error = 1U;
+            }
+            else
+            {
+                lz4_copy(op, ip, len);
+                op += len;
+                ip += len;
+
+                /* The last sequence has no match */
+                if (ip == ip_end)
+                {
+                    done = 1U;
+                }
+            }
+        }
+
+        if ((0U == done) && (0U == error))
+        {
+            /* Match */
+            if ((ip_end - ip) < 2)
+            {
+                error = 1U;
+            }
+            else
+            {
+                offset = (uint64_t)ip[0] | ((uint64_t)ip[1] << 8U);
+                ip += 2;
+                len = token & 15U;
+
+                if ((0U == offset) || (offset > (uint64_t)(op - op_start)))
+                {
+                    error = 1U;
+                }
+                else if ((15U == len) &&
+                         (0U == lz4_length(&ip, ip_end, &len)))
+                {
+                    error = 1U;
+                }
+                else if ((len + LZ4_MIN_MATCH) > (uint64_t)(op_end - op))
+                {
+                    error = 1U;
+                }
+                else
+                {
+                    len += LZ4_MIN_MATCH;
+
+                    if (offset >= LZ4_WIDE_OFFSET)
+                    {
+                        lz4_copy(op, op - offset, len);
+                        op += len;
+                    }
+                    else
+                    {
+                        while (0U != len)
+                        {
+                            *op = *(op - offset);
+                            op++;
+                            len--;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (0U == error)
+    {
+        result = (uint64_t)(op - op_start);
+    }
+
+    return (result);
+}
+
+/***************************************************************************//**
+ * See mss_lz4.h
+ */
+LZ4_BOOT_CODE uint8_t mss_lz4_is_frame(const void * src)
+{
+    return ((MSS_LZ4_LEGACY_MAGIC == lz4_read32((const uint8_t *)src)) ?
+            1U : 0U);
+}
+
+/***************************************************************************//**
+ * See mss_lz4.h
+ */
+LZ4_BOOT_CODE uint64_t mss_lz4_load_share
+(
+    void * dst,
+    uint64_t dst_size,
+    const void * src,
+    uint64_t share,
+    uint64_t nb_shares
+)
+{
+    const uint8_t * ip = (const uint8_t *)src;
+    uint8_t * op = (uint8_t *)dst;
+    uint64_t result = MSS_LZ4_ERROR;
+    uint64_t written = 0U;
+    uint64_t out = 0U;
+    uint64_t block = 0U;
+    uint64_t expect;
+    uint64_t block_size;
+    uint8_t error = 0U;
+
+    if ((0U == mss_lz4_is_frame(src)) || (share >= nb_shares))
+    {
+        error = 1U;
+    }
+
+    ip += 4U;
+
+    while ((0U == error) && (out < dst_size))
+    {
+        expect = dst_size - out;
+
+        if (expect > MSS_LZ4_LEGACY_BLOCK_SIZE)
+        {
+            expect = MSS_LZ4_LEGACY_BLOCK_SIZE;
+        }
+
+        /* Anything bigger than the worst case LZ4 expansion is not a block
+         * size, e.g. the frame ended early */
+        block_size = lz4_read32(ip);
+        ip += 4U;
+
+        if ((0U == block_size) ||
+            (block_size > (expect + (expect / 255U) + 16U)))
+        {
+            error = 1U;
+        }
+        else
+        {
+            if ((block % nb_shares) == share)
+            {
+                if (expect != mss_lz4_decompress(op + out, expect, ip,
+                                                 block_size))
+                {
+                    error = 1U;
+                }
+                else
+                {
+                    written += expect;
+                }
+            }
+
+            ip += block_size;
+            out += expect;
+            block++;
+        }
+    }
+
+    if (0U == error)
+    {
+        result = written;
+    }
+
+    return (result);
+}
+
+/***************************************************************************//**
+ * See mss_lz4.h
+ */
+LZ4_BOOT_CODE uint64_t mss_lz4_load
+(
+    void * dst,
+    uint64_t dst_size,
+    const void * src
+)
+{
+    return (mss_lz4_load_share(dst, dst_size, src, 0U, 1U));
+}
+
+#ifdef __cplusplus
+}
+#endif
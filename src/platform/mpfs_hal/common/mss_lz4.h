@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_lz4.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief LZ4 decompression of load images
+ *
+ * mss_lz4_decompress() decodes one LZ4 block. Literals and matches at least 16
+ * bytes behind the output are copied 8 bytes at a time with aligned stores,
+ * each word stored being merged from two aligned loads when the source and
+ * destination are not aligned the same way, so no access ever takes the
+ * misaligned load or store trap. Closer matches, which overlap the bytes they
+ * produce, are copied a byte at a time. The input is checked as it is decoded
+ * and no byte is written outside the output buffer, whatever the input.
+ *
+ * mss_lz4_load() decodes an image in the LZ4 legacy frame format, as written
+ * by "lz4 -l". The frame is a 4 byte magic number followed by blocks, each
+ * decoding to MSS_LZ4_LEGACY_BLOCK_SIZE bytes except the last one, which
+ * depend on no other block. mss_lz4_load_share() decodes only the blocks of
+ * one share of the harts, so that the harts can decode an image of more than
+ * one block, e.g. a DDR load region, at the same time.
+ *
+ * When MPFS_HAL_LZ4_LOAD is defined in mss_sw_config.h, init_memory() and
+ * init_memory_hart() decode each section whose load image holds a legacy
+ * frame instead of copying it. See mss_sw_config.h for how to compress the
+ * sections of an image after it is linked. An image copied from the system
+ * controller SPI flash with MSS_SYS_spi_copy() is decoded with mss_lz4_load()
+ * once it is in memory.
+ *
+ * The functions are placed in the .text.init section, which the linker
+ * scripts keep at the load address, and use no .data, .bss or .rodata, so
+ * they can be called from init_memory() before any section is copied.
+ */
+#ifndef MSS_LZ4_H
+#define MSS_LZ4_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Returned by mss_lz4_decompress() and mss_lz4_load() when the input is not
+ * valid or does not fit the output buffer */
+#define MSS_LZ4_ERROR               (~0ULL)
+
+#define MSS_LZ4_LEGACY_MAGIC        0x184C2102UL
+#define MSS_LZ4_LEGACY_BLOCK_SIZE   (8ULL * 1024ULL * 1024ULL)
+
+/***************************************************************************//**
+ * Decodes one LZ4 block.
+ *
+ * @param dst       Output buffer
+ * @param dst_size  Size of the output buffer in bytes
+ * @param src       LZ4 block
+ * @param src_size  Size of the block in bytes
+ * @return          Number of bytes written, or MSS_LZ4_ERROR
+ */
+uint64_t mss_lz4_decompress
+(
+    void * dst,
+    uint64_t dst_size,
+    const void * src,
+    uint64_t src_size
+);
+
+/***************************************************************************//**
+ * Checks for the magic number of an LZ4 legacy frame.
+ *
+ * @param src       Start of the load image
+ * @return          1 if src holds a legacy frame, 0 otherwise
+ */
+uint8_t mss_lz4_is_frame(const void * src);
+
+/***************************************************************************//**
+ * Decodes an LZ4 legacy frame which must decode to exactly dst_size bytes.
+ *
+ * @param dst       Output buffer
+ * @param dst_size  Size of the decoded image in bytes
+ * @param src       LZ4 legacy frame
+ * @return          dst_size, or MSS_LZ4_ERROR
+ */
+uint64_t mss_lz4_load
+(
+    void * dst,
+    uint64_t dst_size,
+    const void * src
+);
+
+/***************************************************************************//**
+ * Decodes the blocks of an LZ4 legacy frame belonging to one share. Block N of
+ * the frame belongs to share (N % nb_shares). Each of nb_shares harts calls
+ * this function with a different share to decode the whole frame.
+ *
+ * @param dst       Output buffer
+ * @param dst_size  Size of the decoded image in bytes
+ * @param src       LZ4 legacy frame
+ * @param share     Share to decode, 0 to nb_shares - 1
+ * @param nb_shares Number of shares
+ * @return          Number of bytes written by this share, or MSS_LZ4_ERROR
+ */
+uint64_t mss_lz4_load_share
+(
+    void * dst,
+    uint64_t dst_size,
+    const void * src,
+    uint64_t share,
+    uint64_t nb_shares
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_LZ4_H */
@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_mem.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Memory copy and fill
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+#ifdef MPFS_HAL_MEMCPY_PDMA_THRESHOLD
+#include "drivers/mss/mss_pdma/mss_pdma.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MPFS_HAL_MEMCPY_PDMA_THRESHOLD
+#if (MPFS_HAL_MEMCPY_PDMA_THRESHOLD < MSS_PDMA_COPY_THRESHOLD)
+#error MPFS_HAL_MEMCPY_PDMA_THRESHOLD must not be less than MSS_PDMA_COPY_THRESHOLD
+#endif
+#endif
+
+#define MEM_WORD_BYTES      8U
+#define MEM_LINE_BYTES      64U
+
+/*
+ * Keep the compiler from turning the loops below back into calls to memcpy()
+ * and memset().
+ */
+#define MEM_NO_LIBCALL      __attribute__((optimize("no-tree-loop-distribute-patterns")))
+
+/***************************************************************************//**
+ * See mss_mem.h
+ */
+MEM_NO_LIBCALL void * mpfs_memcpy_cpu(void * dest, const void * src, size_t n)
+{
+    uint8_t * d = (uint8_t *)dest;
+    const uint8_t * s = (const uint8_t *)src;
+    uint64_t * dw;
+    const uint64_t * sw;
+    uint64_t w0, w1, w2, w3, w4, w5, w6, w7, w8;
+    uint32_t lo;
+    uint32_t hi;
+
+    if (n >= (2U * MEM_WORD_BYTES))
+    {
+        /* Align the destination */
+        while (0U != ((uintptr_t)d & (MEM_WORD_BYTES - 1U)))
+        {
+            *d++ = *s++;
+            n--;
+        }
+
+        dw = (uint64_t *)d;
+
+        if (0U == ((uintptr_t)s & (MEM_WORD_BYTES - 1U)))
+        {
+            sw = (const uint64_t *)s;
+
+            while (n >= MEM_LINE_BYTES)
+            {
+                w0 = sw[0]; w1 = sw[1]; w2 = sw[2]; w3 = sw[3];
+                w4 = sw[4]; w5 = sw[5]; w6 = sw[6]; w7 = sw[7];
+                dw[0] = w0; dw[1] = w1; dw[2] = w2; dw[3] = w3;
+                dw[4] = w4; dw[5] = w5; dw[6] = w6; dw[7] = w7;
+                sw += 8U;
+                dw += 8U;
+                n -= MEM_LINE_BYTES;
+            }
+
+            while (n >= MEM_WORD_BYTES)
+            {
+                *dw++ = *sw++;
+                n -= MEM_WORD_BYTES;
+            }
+
+            s = (const uint8_t *)sw;
+        }
+        else
+        {
+            /*
+             * Merge each destination word from the two aligned source words
+             * holding it. The aligned words read never extend beyond the words
+             * holding the first and last bytes copied.
+             */
+            lo = 8U * (uint32_t)((uintptr_t)s & (MEM_WORD_BYTES - 1U));
+            hi = 64U - lo;
+            sw = (const uint64_t *)((uintptr_t)s & ~((uintptr_t)MEM_WORD_BYTES - 1U));
+            w0 = *sw++;
+
+            while (n >= MEM_LINE_BYTES)
+            {
+                w1 = sw[0]; w2 = sw[1]; w3 = sw[2]; w4 = sw[3];
+                w5 = sw[4]; w6 = sw[5]; w7 = sw[6]; w8 = sw[7];
+                dw[0] = (w0 >> lo) | (w1 << hi);
+                dw[1] = (w1 >> lo) | (w2 << hi);
+                dw[2] = (w2 >> lo) | (w3 << hi);
+                dw[3] = (w3 >> lo) | (w4 << hi);
+                dw[4] = (w4 >> lo) | (w5 << hi);
+                dw[5] = (w5 >> lo) | (w6 << hi);
+                dw[6] = (w6 >> lo) | (w7 << hi);
+                dw[7] = (w7 >> lo) | (w8 << hi);
+                w0 = w8;
+                sw += 8U;
+                dw += 8U;
+                n -= MEM_LINE_BYTES;
+                s += MEM_LINE_BYTES;
+            }
+
+            while (n >= MEM_WORD_BYTES)
+            {
+                w1 = *sw++;
+                *dw++ = (w0 >> lo) | (w1 << hi);
+                w0 = w1;
+                n -= MEM_WORD_BYTES;
+                s += MEM_WORD_BYTES;
+            }
+        }
+
+        d = (uint8_t *)dw;
+    }
+
+    while (0U != n)
+    {
+        *d++ = *s++;
+        n--;
+    }
+
+    return (dest);
+}
+
+/***************************************************************************//**
+ * See mss_mem.h
+ */
+MEM_NO_LIBCALL void * mpfs_memset_cpu(void * dest, int value, size_t n)
+{
+    uint8_t * d = (uint8_t *)dest;
+    uint64_t * dw;
+    uint64_t pattern = 0x0101010101010101ULL * (uint8_t)value;
+
+    if (n >= (2U * MEM_WORD_BYTES))
+    {
+        while (0U != ((uintptr_t)d & (MEM_WORD_BYTES - 1U)))
+        {
+            *d++ = (uint8_t)value;
+            n--;
+        }
+
+        dw = (uint64_t *)d;
+
+        while (n >= MEM_LINE_BYTES)
+        {
+            dw[0] = pattern; dw[1] = pattern; dw[2] = pattern; dw[3] = pattern;
+            dw[4] = pattern; dw[5] = pattern; dw[6] = pattern; dw[7] = pattern;
+            dw += 8U;
+            n -= MEM_LINE_BYTES;
+        }
+
+        while (n >= MEM_WORD_BYTES)
+        {
+            *dw++ = pattern;
+            n -= MEM_WORD_BYTES;
+        }
+
+        d = (uint8_t *)dw;
+    }
+
+    while (0U != n)
+    {
+        *d++ = (uint8_t)value;
+        n--;
+    }
+
+    return (dest);
+}
+
+/***************************************************************************//**
+ * See mss_mem.h
+ */
+void * mpfs_memcpy(void * dest, const void * src, size_t n)
+{
+#ifdef MPFS_HAL_MEMCPY_PDMA_THRESHOLD
+    mss_pdma_copy_token_t token;
+
+    if ((n >= MPFS_HAL_MEMCPY_PDMA_THRESHOLD) &&
+        (0U != (read_csr(mstatus) & MSTATUS_MIE)) &&
+        (MSS_PDMA_OK == MSS_PDMA_memcpy_async(&token, dest, src, (uint64_t)n)))
+    {
+        (void)MSS_PDMA_copy_wait(&token);
+    }
+    else
+#endif
+    {
+        (void)mpfs_memcpy_cpu(dest, src, n);
+    }
+
+    return (dest);
+}
+
+/***************************************************************************//**
+ * See mss_mem.h
+ */
+void * mpfs_memset(void * dest, int value, size_t n)
+{
+#ifdef MPFS_HAL_MEMCPY_PDMA_THRESHOLD
+    mss_pdma_copy_token_t token;
+
+    if ((n >= MPFS_HAL_MEMCPY_PDMA_THRESHOLD) &&
+        (0U != (read_csr(mstatus) & MSTATUS_MIE)) &&
+        (MSS_PDMA_OK == MSS_PDMA_memset_async(&token, dest, (uint8_t)value,
+                                              (uint64_t)n)))
+    {
+        (void)MSS_PDMA_copy_wait(&token);
+    }
+    else
+#endif
+    {
+        (void)mpfs_memset_cpu(dest, value, n);
+    }
+
+    return (dest);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_mem.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Memory copy and fill
+ *
+ * mpfs_memcpy_cpu() and mpfs_memset_cpu() copy and fill memory a 64 byte cache
+ * line at a time, with eight 8 byte loads followed by eight 8 byte stores, all
+ * aligned. When the source and destination are not aligned the same way, the
+ * destination is aligned and each word stored is merged from two aligned
+ * source words, so no access ever takes the misaligned load or store trap.
+ * They never use the PDMA and can be called from interrupt handlers.
+ *
+ * mpfs_memcpy() and mpfs_memset() are the same functions unless
+ * MPFS_HAL_MEMCPY_PDMA_THRESHOLD is defined in mss_sw_config.h, in which case
+ * requests of at least that many bytes are handed to MSS_PDMA_memcpy_async()
+ * or MSS_PDMA_memset_async() and waited for. The PDMA is then only used when
+ * interrupts are enabled on the calling hart, as the transfers complete in the
+ * PDMA interrupt handlers. The PDMA driver must have been initialised and its
+ * interrupts enabled in the PLIC.
+ *
+ * The source and destination of a copy must not overlap.
+ */
+#ifndef MSS_MEM_H
+#define MSS_MEM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void * mpfs_memcpy_cpu(void * dest, const void * src, size_t n);
+void * mpfs_memset_cpu(void * dest, int value, size_t n);
+
+void * mpfs_memcpy(void * dest, const void * src, size_t n);
+void * mpfs_memset(void * dest, int value, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_MEM_H */
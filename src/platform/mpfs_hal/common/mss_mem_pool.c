@@ -0,0 +1,238 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_mem_pool.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Fixed-block memory pools
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MEM_POOL_NO_BLOCK       0xFFFFFFFFU
+#define MEM_POOL_INDEX_MASK     0xFFFFFFFFULL
+#define MEM_POOL_GENERATION     0x100000000ULL
+
+/*
+ * The index of the next free block is held in the first word of each free
+ * block.
+ */
+static volatile uint32_t * pool_link(const mss_mem_pool_t * pool,
+        uint32_t index)
+{
+    return ((volatile uint32_t *)&pool->base[(uint64_t)index *
+                                             pool->block_size]);
+}
+
+static uint32_t pool_pop(mss_mem_pool_t * pool)
+{
+    uint64_t head;
+    uint64_t new_head;
+    uint32_t index;
+
+    do
+    {
+        head = pool->head;
+        index = (uint32_t)(head & MEM_POOL_INDEX_MASK);
+
+        if(MEM_POOL_NO_BLOCK == index)
+        {
+            break;
+        }
+
+        /*
+         * The link may be overwritten by the hart which takes the block first,
+         * in which case the generation of the head has changed and the swap
+         * fails.
+         */
+        new_head = ((head & ~MEM_POOL_INDEX_MASK) + MEM_POOL_GENERATION) |
+                *pool_link(pool, index);
+    } while(0 == atomic_cas(&pool->head, head, new_head));
+
+    return (index);
+}
+
+static void pool_push(mss_mem_pool_t * pool, uint32_t index)
+{
+    uint64_t head;
+    uint64_t new_head;
+
+    do
+    {
+        head = pool->head;
+        *pool_link(pool, index) = (uint32_t)(head & MEM_POOL_INDEX_MASK);
+        new_head = ((head & ~MEM_POOL_INDEX_MASK) + MEM_POOL_GENERATION) |
+                index;
+    } while(0 == atomic_cas(&pool->head, head, new_head));
+}
+
+/***************************************************************************//**
+ * See mss_mem_pool.h
+ */
+uint8_t mss_mem_pool_init(mss_mem_pool_t * pool, void * storage,
+        uint32_t block_size, uint32_t count)
+{
+    uint32_t inc;
+    uint8_t ret_val = ERROR;
+
+    block_size = MSS_MEM_POOL_BLOCK_SIZE(block_size);
+
+    if(((void *)0 != storage) && (0U != block_size) && (0U != count) &&
+       (MEM_POOL_NO_BLOCK != count) && (0U == ((uintptr_t)storage & 7U)))
+    {
+        pool->base = (uint8_t *)storage;
+        pool->block_size = block_size;
+        pool->count = count;
+
+        for(inc = 0U; inc < count; inc++)
+        {
+            *pool_link(pool, inc) = ((inc + 1U) < count) ?
+                    (inc + 1U) : MEM_POOL_NO_BLOCK;
+        }
+
+        for(inc = 0U; inc < MSS_MEM_POOL_NUM_HARTS; inc++)
+        {
+            pool->cache[inc].count = 0U;
+        }
+
+        pool->head = 0U;
+        mb();
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_mem_pool.h
+ */
+void * mss_mem_pool_alloc(mss_mem_pool_t * pool)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    mss_mem_pool_cache_t * cache;
+    uint64_t mstatus;
+    uint32_t index = MEM_POOL_NO_BLOCK;
+    void * block = (void *)0;
+
+    if(hart_id < MSS_MEM_POOL_NUM_HARTS)
+    {
+        cache = &pool->cache[hart_id];
+        mstatus = disable_interrupts();
+
+        if(0U == cache->count)
+        {
+            index = pool_pop(pool);
+
+            /* Refill half of the cache for the next allocations */
+            while((MEM_POOL_NO_BLOCK != index) &&
+                  (cache->count < (MSS_MEM_POOL_CACHE_SIZE / 2U)))
+            {
+                cache->block[cache->count] = pool_pop(pool);
+
+                if(MEM_POOL_NO_BLOCK == cache->block[cache->count])
+                {
+                    break;
+                }
+
+                cache->count++;
+            }
+        }
+        else
+        {
+            cache->count--;
+            index = cache->block[cache->count];
+        }
+
+        restore_interrupts(mstatus);
+    }
+    else
+    {
+        index = pool_pop(pool);
+    }
+
+    if(MEM_POOL_NO_BLOCK != index)
+    {
+        block = (void *)&pool->base[(uint64_t)index * pool->block_size];
+    }
+
+    return (block);
+}
+
+/***************************************************************************//**
+ * See mss_mem_pool.h
+ */
+void mss_mem_pool_free(mss_mem_pool_t * pool, void * block)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    mss_mem_pool_cache_t * cache;
+    uint64_t mstatus;
+    uint32_t index;
+
+    if((void *)0 != block)
+    {
+        index = (uint32_t)(((uint8_t *)block - pool->base) / pool->block_size);
+
+        if((hart_id < MSS_MEM_POOL_NUM_HARTS) && (0U != MSS_MEM_POOL_CACHE_SIZE))
+        {
+            cache = &pool->cache[hart_id];
+            mstatus = disable_interrupts();
+
+            if(cache->count >= MSS_MEM_POOL_CACHE_SIZE)
+            {
+                /* Drain half of the cache */
+                while(cache->count > (MSS_MEM_POOL_CACHE_SIZE / 2U))
+                {
+                    cache->count--;
+                    pool_push(pool, cache->block[cache->count]);
+                }
+            }
+
+            cache->block[cache->count] = index;
+            cache->count++;
+
+            restore_interrupts(mstatus);
+        }
+        else
+        {
+            pool_push(pool, index);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_mem_pool.h
+ */
+void mss_mem_pool_drain(mss_mem_pool_t * pool)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    mss_mem_pool_cache_t * cache;
+    uint64_t mstatus;
+
+    if(hart_id < MSS_MEM_POOL_NUM_HARTS)
+    {
+        cache = &pool->cache[hart_id];
+        mstatus = disable_interrupts();
+
+        while(0U != cache->count)
+        {
+            cache->count--;
+            pool_push(pool, cache->block[cache->count]);
+        }
+
+        restore_interrupts(mstatus);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_mem_pool.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Fixed-block memory pools
+ *
+ * A pool splits a buffer provided by the application into blocks of the same
+ * size, which drivers and interrupt handlers on any hart can allocate and free
+ * in constant time, without a heap.
+ *
+ * The free blocks are held on a list shared by all the harts, which is updated
+ * with compare and swap without locking. The head of the list holds a
+ * generation count next to the index of the first block, so that a block freed
+ * and allocated again between the read and the update of the head is detected.
+ *
+ * Each hart also keeps up to MSS_MEM_POOL_CACHE_SIZE free blocks of each pool
+ * in a cache of its own, so that most allocations and frees do not touch the
+ * shared list. The cache is refilled from, or drained to, the shared list half
+ * at a time. Interrupts are disabled on the calling hart while its cache is
+ * used, so the functions can be called from interrupt handlers. Blocks held in
+ * the cache of one hart are not available to the other harts, so an
+ * allocation can fail while other harts have free blocks cached.
+ *
+ * Example:
+ * @code
+ *   static uint64_t g_desc_storage[MSS_MEM_POOL_STORAGE_WORDS(48U, 64U)];
+ *   static mss_mem_pool_t g_desc_pool;
+ *
+ *   mss_mem_pool_init(&g_desc_pool, g_desc_storage, 48U, 64U);
+ *   desc = mss_mem_pool_alloc(&g_desc_pool);
+ *   ...
+ *   mss_mem_pool_free(&g_desc_pool, desc);
+ * @endcode
+ */
+#ifndef MSS_MEM_POOL_H
+#define MSS_MEM_POOL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Number of free blocks of each pool each hart may keep. 0 disables the
+ * caches, so that all the blocks are always available to all the harts.
+ */
+#ifndef MSS_MEM_POOL_CACHE_SIZE
+#define MSS_MEM_POOL_CACHE_SIZE         8U
+#endif
+
+#define MSS_MEM_POOL_NUM_HARTS          (MPFS_HAL_LAST_HART + 1U)
+
+/*
+ * Size of the blocks of a pool, rounded up to a multiple of 8 bytes, and words
+ * of storage needed for count blocks.
+ */
+#define MSS_MEM_POOL_BLOCK_SIZE(size)   ((((size) + 7U) / 8U) * 8U)
+#define MSS_MEM_POOL_STORAGE_WORDS(size, count) \
+                                ((MSS_MEM_POOL_BLOCK_SIZE(size) / 8U) * (count))
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t block[MSS_MEM_POOL_CACHE_SIZE + 1U];
+} mss_mem_pool_cache_t;
+
+typedef struct
+{
+    volatile uint64_t head;
+    uint8_t * base;
+    uint32_t block_size;
+    uint32_t count;
+    mss_mem_pool_cache_t cache[MSS_MEM_POOL_NUM_HARTS];
+} mss_mem_pool_t;
+
+/***************************************************************************//**
+ * mss_mem_pool_init() sets up a pool of count blocks of block_size bytes in
+ * the storage provided, which must be 8 byte aligned and hold
+ * MSS_MEM_POOL_STORAGE_WORDS(block_size, count) words. The pool must be set up
+ * before it is used by any hart. It returns ERROR when an argument is invalid.
+ */
+uint8_t mss_mem_pool_init(mss_mem_pool_t * pool, void * storage,
+        uint32_t block_size, uint32_t count);
+
+/***************************************************************************//**
+ * mss_mem_pool_alloc() returns a free block of the pool, or a null pointer when
+ * none is available to the calling hart.
+ */
+void * mss_mem_pool_alloc(mss_mem_pool_t * pool);
+
+/***************************************************************************//**
+ * mss_mem_pool_free() returns a block to the pool. Any hart may free a block,
+ * whichever hart allocated it.
+ */
+void mss_mem_pool_free(mss_mem_pool_t * pool, void * block);
+
+/***************************************************************************//**
+ * mss_mem_pool_drain() returns the blocks cached by the calling hart to the
+ * shared list, for example before the hart is stopped.
+ */
+void mss_mem_pool_drain(mss_mem_pool_t * pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_MEM_POOL_H */
@@ -22,7 +22,25 @@
 
 #ifndef SIFIVE_HIFIVE_UNLEASHED
 
+/* pmp field holds bits 39:2 of the address, mode is the top byte */
+#define MPU_PMP_MASK            ((1ULL << 38U) - 1U)
+#define MPU_ADDR_LIMIT          (1ULL << 40U)
+#define MPU_MODE_SHIFT          56U
+#define MPU_MODE_MASK           (0xFFULL << MPU_MODE_SHIFT)
+#define MPU_MODE_LOCK           (0x80ULL << MPU_MODE_SHIFT)
+#define MPU_REGION_MIN_SIZE     4096ULL
+
 static uint64_t pmp_get_napot_base_and_range(uint64_t reg, uint64_t *range);
+static uint8_t mpu_check_regions(mss_mpu_mport_t master_port,
+                                 const mss_mpu_region_t * regions,
+                                 uint8_t count);
+static void mpu_write_regions(mss_mpu_mport_t master_port,
+                              const mss_mpu_region_t * regions,
+                              uint8_t count);
+static uint64_t mpu_region_value(mss_mpu_mport_t master_port,
+                                 const mss_mpu_region_t * regions,
+                                 uint8_t count,
+                                 uint32_t pmp_region);
 
 uint8_t num_pmp_lut[10U] = {16U,16U,8U,4U,8U,8U,4U,4U,8U,2U};
 
@@ -300,6 +318,173 @@ uint8_t MSS_MPU_get_config(mss_mpu_mport_t master_port,
     }
 }
 
+/***************************************************************************//**
+ * See mss_mpu.h
+ */
+uint8_t MSS_MPU_configure_regions(mss_mpu_mport_t master_port,
+                                  const mss_mpu_region_t * regions,
+                                  uint8_t count)
+{
+    uint8_t ret_val = mpu_check_regions(master_port, regions, count);
+    uint64_t psr;
+
+    if(0U == ret_val)
+    {
+        psr = disable_interrupts();
+        mpu_write_regions(master_port, regions, count);
+        mb();
+        restore_interrupts(psr);
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_mpu.h
+ */
+uint8_t MSS_MPU_configure_masters(const mss_mpu_master_regions_t * masters,
+                                  uint32_t count)
+{
+    uint8_t ret_val = 0U;
+    uint64_t psr;
+    uint32_t inc;
+
+    for(inc = 0U; (inc < count) && (0U == ret_val); inc++)
+    {
+        ret_val = mpu_check_regions(masters[inc].master_port,
+                                    masters[inc].regions,
+                                    masters[inc].count);
+    }
+
+    if(0U == ret_val)
+    {
+        psr = disable_interrupts();
+
+        for(inc = 0U; inc < count; inc++)
+        {
+            mpu_write_regions(masters[inc].master_port,
+                              masters[inc].regions,
+                              masters[inc].count);
+        }
+
+        mb();
+        restore_interrupts(psr);
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * Checks a region list can be written to a master: it fits, each region is a
+ * valid NAPOT region, no two overlap and no locked PMP region would change.
+ */
+static uint8_t mpu_check_regions(mss_mpu_mport_t master_port,
+                                 const mss_mpu_region_t * regions,
+                                 uint8_t count)
+{
+    uint8_t ret_val = 0U;
+    const mss_mpu_region_t * region;
+    uint64_t current;
+    uint32_t inc;
+    uint32_t other;
+
+    if(((uint32_t)master_port >= sizeof(num_pmp_lut)) ||
+            (count > num_pmp_lut[master_port]))
+    {
+        ret_val = 1U;
+    }
+
+    for(inc = 0U; (inc < count) && (0U == ret_val); inc++)
+    {
+        region = &regions[inc];
+
+        if((region->size < MPU_REGION_MIN_SIZE) ||
+                (0U != (region->size & (region->size - 1U))) ||
+                (0U != (region->base & (region->size - 1U))) ||
+                (region->size > MPU_ADDR_LIMIT) ||
+                (region->base > (MPU_ADDR_LIMIT - region->size)) ||
+                (0U != (region->permission & ~0x7U)))
+        {
+            ret_val = 1U;
+        }
+
+        for(other = inc + 1U; (other < count) && (0U == ret_val); other++)
+        {
+            if((region->base < (regions[other].base + regions[other].size)) &&
+                    (regions[other].base < (region->base + region->size)))
+            {
+                ret_val = 1U;
+            }
+        }
+    }
+
+    if(0U == ret_val)
+    {
+        for(inc = 0U; inc < num_pmp_lut[master_port]; inc++)
+        {
+            current = MSS_MPU(master_port)->PMPCFG[inc].raw;
+
+            if((0U != (current & MPU_MODE_LOCK)) && (current !=
+                    mpu_region_value(master_port, regions, count, inc)))
+            {
+                ret_val = 1U;
+            }
+        }
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * Writes the PMP regions of a master which change, one store each.
+ */
+static void mpu_write_regions(mss_mpu_mport_t master_port,
+                              const mss_mpu_region_t * regions,
+                              uint8_t count)
+{
+    uint64_t value;
+    uint32_t inc;
+
+    for(inc = 0U; inc < num_pmp_lut[master_port]; inc++)
+    {
+        value = mpu_region_value(master_port, regions, count, inc);
+
+        if(value != MSS_MPU(master_port)->PMPCFG[inc].raw)
+        {
+            MSS_MPU(master_port)->PMPCFG[inc].raw = value;
+        }
+    }
+}
+
+/***************************************************************************//**
+ * The PMPCFG value of a PMP region for a region list. A PMP region past the
+ * end of the list keeps its address with its mode cleared, which turns it off
+ * without a write if it is already off.
+ */
+static uint64_t mpu_region_value(mss_mpu_mport_t master_port,
+                                 const mss_mpu_region_t * regions,
+                                 uint8_t count,
+                                 uint32_t pmp_region)
+{
+    uint64_t value;
+    uint64_t mode;
+
+    if(pmp_region < count)
+    {
+        mode = (uint64_t)regions[pmp_region].permission |
+                ((uint64_t)MSS_MPU_AM_NAPOT << 3U);
+        value = (((regions[pmp_region].base |
+                ((regions[pmp_region].size >> 1U) - 1U)) >> 2U) & MPU_PMP_MASK) |
+                (mode << MPU_MODE_SHIFT);
+    }
+    else
+    {
+        value = MSS_MPU(master_port)->PMPCFG[pmp_region].raw & ~MPU_MODE_MASK;
+    }
+
+    return (value);
+}
+
 static uint64_t pmp_get_napot_base_and_range(uint64_t reg, uint64_t *range)
 {
     /* construct a mask of all bits bar the top bit */
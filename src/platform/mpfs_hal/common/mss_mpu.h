@@ -118,6 +118,28 @@ typedef struct
 
 #define MSS_MPU(master)                ( (MPU_TypeDef*) (0x20005000UL + ((master) << 8U)))
 
+/***************************************************************************//**
+ * A region of a region list, see MSS_MPU_configure_regions(). size is a power
+ * of two of at least 4 KiB and base a multiple of size. permission is any of
+ * MPU_MODE_READ_ACCESS, MPU_MODE_WRITE_ACCESS and MPU_MODE_EXEC_ACCESS.
+ */
+typedef struct
+{
+    uint64_t base;
+    uint64_t size;
+    uint8_t permission;
+} mss_mpu_region_t;
+
+/***************************************************************************//**
+ * The region list of a master, see MSS_MPU_configure_masters().
+ */
+typedef struct
+{
+    mss_mpu_mport_t master_port;
+    const mss_mpu_region_t * regions;
+    uint8_t count;
+} mss_mpu_master_regions_t;
+
 
 uint8_t mpu_configure(void);
 
@@ -138,6 +160,52 @@ uint8_t MSS_MPU_get_config(mss_mpu_mport_t master_port,
                            mss_mpu_addrm_t* matching_mode,
                            uint8_t* lock_en);
 
+/***************************************************************************//**
+ * MSS_MPU_configure_regions() sets all the PMP regions of a master from a list
+ * of regions, region i of the list going in PMP region i and the regions of
+ * the master past the end of the list being turned off. The list is checked
+ * before anything is written: the regions must fit in the PMP regions of the
+ * master, be valid NAPOT regions, not overlap and the PMP regions of the
+ * master must not be locked. As the regions do not overlap, the order of the
+ * list makes no difference to which accesses are allowed.
+ *
+ * Each PMP region is written with a single 64 bit store, and only if it
+ * changes, so switching between lists which differ in a few regions, e.g. to
+ * move the DMA buffers of the MAC, takes only a few stores, with interrupts
+ * masked on the calling hart. The master can still make accesses between the
+ * stores, so its DMA should be stopped across the call if it must see the old
+ * or the new list only.
+ *
+ * Example, the buffers of GEM0 moved to another part of DDR:
+ * @code
+ *   static const mss_mpu_region_t g_gem0_regions[] =
+ *   {
+ *       { 0xC0000000ULL, 0x00100000ULL, MPU_MODE_READ_ACCESS |
+ *               MPU_MODE_WRITE_ACCESS },
+ *       { 0x08000000ULL, 0x00010000ULL, MPU_MODE_READ_ACCESS },
+ *   };
+ *
+ *   (void)MSS_MPU_configure_regions(MSS_MPU_GEM0, g_gem0_regions, 2U);
+ * @endcode
+ *
+ * @return
+ *   0 on success, or 1 if the list was refused, nothing having been written.
+ */
+uint8_t MSS_MPU_configure_regions(mss_mpu_mport_t master_port,
+                                  const mss_mpu_region_t * regions,
+                                  uint8_t count);
+
+/***************************************************************************//**
+ * MSS_MPU_configure_masters() sets the regions of several masters, e.g. GEM0,
+ * GEM1, USB, MMC, SCB and TRACE, as MSS_MPU_configure_regions() does for one.
+ * All the lists are checked before anything is written.
+ *
+ * @return
+ *   0 on success, or 1 if any list was refused, nothing having been written.
+ */
+uint8_t MSS_MPU_configure_masters(const mss_mpu_master_regions_t * masters,
+                                  uint32_t count);
+
 static inline uint8_t MSS_MPU_lock_region(mss_mpu_mport_t master_port,
                                         mss_mpu_pmp_region_t pmp_region)
 {
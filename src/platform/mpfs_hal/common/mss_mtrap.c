@@ -43,23 +43,291 @@ void bad_trap(uintptr_t* regs, uintptr_t dummy, uintptr_t mepc)
     }
 }
 
+#ifdef MPFS_HAL_EMULATE_MISALIGNED
+/*------------------------------------------------------------------------------
+ * Misaligned load and store emulation.
+ * The faulting instruction is decoded from mepc and the access made a byte at
+ * a time. regs[] holds x0 to x31 as saved by trap_vector, where x2 is the
+ * stack pointer less the context saved.
+ */
+#define MISALIGNED_NUM_HARTS        (MPFS_HAL_LAST_HART + 1U)
+
+#define OPCODE_LOAD                 0x03U
+#define OPCODE_STORE                0x23U
+
+static mss_misaligned_stats_t g_misaligned_stats[MISALIGNED_NUM_HARTS];
+
+typedef struct {
+    uintptr_t addr;
+    uint32_t reg;           /* rd of a load, rs2 of a store */
+    uint32_t size;          /* bytes, 0 if not emulated */
+    uint32_t is_signed;
+    uint32_t length;        /* of the instruction, 2 or 4 */
+} misaligned_access_t;
+
+static uintptr_t get_reg(const uintptr_t * regs, uint32_t reg)
+{
+    uintptr_t value = regs[reg];
+
+    if (0U == reg)
+    {
+        value = 0U;
+    }
+    else if (2U == reg)
+    {
+        value += INTEGER_CONTEXT_SIZE;
+    }
+    else
+    {
+        /* value as saved */
+    }
+
+    return (value);
+}
+
+static void set_reg(uintptr_t * regs, uint32_t reg, uintptr_t value)
+{
+    if (2U == reg)
+    {
+        regs[reg] = value - INTEGER_CONTEXT_SIZE;
+    }
+    else if (0U != reg)
+    {
+        regs[reg] = value;
+    }
+    else
+    {
+        /* x0 is not written */
+    }
+}
+
+/*
+ * Decodes the integer loads and stores, including the compressed forms, and
+ * leaves access->size 0 for anything else, e.g. floating point and atomics.
+ * The instruction is fetched as 16-bit parcels as it may be 2-byte aligned.
+ */
+static void decode_misaligned(const uintptr_t * regs, uintptr_t mepc,
+        misaligned_access_t * access)
+{
+    uint32_t insn = *(const volatile uint16_t *)mepc;
+    uint32_t funct3;
+    uintptr_t imm = 0U;
+    uint32_t base = 0U;
+
+    access->size = 0U;
+    access->is_signed = 0U;
+
+    if (3U == (insn & 3U))
+    {
+        insn |= (uint32_t)(*(const volatile uint16_t *)(mepc + 2U)) << 16U;
+        access->length = 4U;
+        funct3 = (insn >> 12U) & 7U;
+        base = (insn >> 15U) & 0x1FU;
+
+        if (OPCODE_LOAD == (insn & 0x7FU))
+        {
+            /* lb lh lw ld lbu lhu lwu */
+            if (funct3 != 7U)
+            {
+                access->size = 1U << (funct3 & 3U);
+                access->is_signed = (funct3 < 4U) ? 1U : 0U;
+            }
+            access->reg = (insn >> 7U) & 0x1FU;
+            imm = (uintptr_t)((int64_t)(int32_t)insn >> 20U);
+        }
+        else if (OPCODE_STORE == (insn & 0x7FU))
+        {
+            /* sb sh sw sd */
+            if (funct3 < 4U)
+            {
+                access->size = 1U << funct3;
+            }
+            access->reg = (insn >> 20U) & 0x1FU;
+            imm = (uintptr_t)((int64_t)(int32_t)(insn & 0xFE000000U) >> 20U) |
+                    ((insn >> 7U) & 0x1FU);
+        }
+        else
+        {
+            /* not emulated */
+        }
+    }
+    else
+    {
+        access->length = 2U;
+        funct3 = (insn >> 13U) & 7U;
+
+        if (0U == (insn & 3U))
+        {
+            /* c.lw c.ld c.sw c.sd, registers x8 to x15 */
+            base = 8U + ((insn >> 7U) & 7U);
+            access->reg = 8U + ((insn >> 2U) & 7U);
+
+            if ((2U == funct3) || (6U == funct3))
+            {
+                access->size = 4U;
+                access->is_signed = (2U == funct3) ? 1U : 0U;
+                imm = ((insn >> 7U) & 0x38U) | ((insn << 1U) & 0x40U) |
+                        ((insn >> 4U) & 0x4U);
+            }
+            else if ((3U == funct3) || (7U == funct3))
+            {
+                access->size = 8U;
+                imm = ((insn >> 7U) & 0x38U) | ((insn << 1U) & 0xC0U);
+            }
+            else
+            {
+                /* c.fld c.fsd not emulated */
+            }
+        }
+        else if (2U == (insn & 3U))
+        {
+            /* c.lwsp c.ldsp c.swsp c.sdsp */
+            base = 2U;
+
+            if (2U == funct3)
+            {
+                access->size = 4U;
+                access->is_signed = 1U;
+                access->reg = (insn >> 7U) & 0x1FU;
+                imm = ((insn >> 7U) & 0x20U) | ((insn >> 2U) & 0x1CU) |
+                        ((insn << 4U) & 0xC0U);
+            }
+            else if (3U == funct3)
+            {
+                access->size = 8U;
+                access->reg = (insn >> 7U) & 0x1FU;
+                imm = ((insn >> 7U) & 0x20U) | ((insn >> 2U) & 0x18U) |
+                        ((insn << 4U) & 0x1C0U);
+            }
+            else if (6U == funct3)
+            {
+                access->size = 4U;
+                access->reg = (insn >> 2U) & 0x1FU;
+                imm = ((insn >> 7U) & 0x3CU) | ((insn >> 1U) & 0xC0U);
+            }
+            else if (7U == funct3)
+            {
+                access->size = 8U;
+                access->reg = (insn >> 2U) & 0x1FU;
+                imm = ((insn >> 7U) & 0x38U) | ((insn >> 1U) & 0x1C0U);
+            }
+            else
+            {
+                /* not emulated */
+            }
+        }
+        else
+        {
+            /* not emulated */
+        }
+    }
+
+    access->addr = get_reg(regs, base) + imm;
+}
+
+static void record_misaligned(uintptr_t mepc, uintptr_t addr, uint8_t store)
+{
+    uint64_t hart_id = read_csr(mhartid);
+
+    if (0U != store)
+    {
+        g_misaligned_stats[hart_id].stores++;
+    }
+    else
+    {
+        g_misaligned_stats[hart_id].loads++;
+    }
+
+    g_misaligned_stats[hart_id].last_pc = mepc;
+    g_misaligned_stats[hart_id].last_addr = addr;
+}
+
+/*------------------------------------------------------------------------------
+ * See mss_mtrap.h
+ */
+void mss_get_misaligned_stats(uint64_t hart_id, mss_misaligned_stats_t * stats)
+{
+    ASSERT(hart_id < MISALIGNED_NUM_HARTS);
+
+    *stats = g_misaligned_stats[hart_id];
+}
+#endif /* MPFS_HAL_EMULATE_MISALIGNED */
+
 void misaligned_store_trap(uintptr_t * regs, uintptr_t mcause, uintptr_t mepc)
 {
+#ifdef MPFS_HAL_EMULATE_MISALIGNED
+    misaligned_access_t access;
+    uintptr_t value;
+    uint32_t inc;
+
+    (void)mcause;
+    decode_misaligned(regs, mepc, &access);
+
+    if (0U != access.size)
+    {
+        value = get_reg(regs, access.reg);
+
+        for (inc = 0U; inc < access.size; inc++)
+        {
+            *(volatile uint8_t *)(access.addr + inc) = (uint8_t)value;
+            value >>= 8U;
+        }
+
+        record_misaligned(mepc, access.addr, 1U);
+        write_csr(mepc, mepc + access.length);
+    }
+    else
+#else
     (void)regs;
     (void)mcause;
     (void)mepc;
-    while(1)
+#endif
     {
+        while(1)
+        {
+        }
     }
 }
 
 void misaligned_load_trap(uintptr_t * regs, uintptr_t mcause, uintptr_t mepc)
 {
+#ifdef MPFS_HAL_EMULATE_MISALIGNED
+    misaligned_access_t access;
+    uintptr_t value = 0U;
+    uint32_t inc;
+    uint32_t shift;
+
+    (void)mcause;
+    decode_misaligned(regs, mepc, &access);
+
+    if (0U != access.size)
+    {
+        for (inc = access.size; inc > 0U; inc--)
+        {
+            value = (value << 8U) |
+                    *(const volatile uint8_t *)(access.addr + inc - 1U);
+        }
+
+        if ((0U != access.is_signed) && (access.size < sizeof(uintptr_t)))
+        {
+            shift = (uint32_t)(sizeof(uintptr_t) - access.size) * 8U;
+            value = (uintptr_t)((int64_t)(value << shift) >> shift);
+        }
+
+        set_reg(regs, access.reg, value);
+        record_misaligned(mepc, access.addr, 0U);
+        write_csr(mepc, mepc + access.length);
+    }
+    else
+#else
     (void)regs;
     (void)mcause;
     (void)mepc;
-    while(1)
+#endif
     {
+        while(1)
+        {
+        }
     }
 }
 
@@ -679,46 +947,107 @@ uint8_t (*ext_irq_handler_table[PLIC_NUM_SOURCES])(void) =
 };
 #endif
 /*------------------------------------------------------------------------------
- *
+ * Services all the pending external interrupts before returning, so that a
+ * source becoming pending while another one is handled does not need a
+ * further trap.
+ * When MPFS_HAL_NESTED_EXT_INTERRUPTS is defined, the PLIC threshold is raised
+ * to the priority of the source being handled and interrupts are re-enabled
+ * while its handler runs, so that sources of a higher priority preempt it.
+ * The machine timer and software interrupts are masked in mie for that time,
+ * only PLIC sources can preempt an external interrupt handler.
  */
-void handle_m_ext_interrupt(void)
+MSS_HOT_TEXT void handle_m_ext_interrupt(void)
 {
-
+#ifdef MPFS_HAL_IRQ_PROFILING
+    uint64_t claim_cycles = readmcycle();
+    uint64_t handler_cycles;
+#endif
     volatile uint32_t int_num  = PLIC_ClaimIRQ();
+    uint8_t disable = EXT_IRQ_KEEP_ENABLED;
+#ifdef MPFS_HAL_NESTED_EXT_INTERRUPTS
+    uint32_t saved_threshold;
+    uintptr_t saved_mepc;
+    uintptr_t saved_mstatus;
+    uintptr_t saved_mie;
+#endif
 
-    if (INVALID_IRQn == int_num)
+    while (INVALID_IRQn != int_num)
     {
-       return;
-    }
+#ifdef MPFS_HAL_NESTED_EXT_INTERRUPTS
+        /* mepc and mstatus are overwritten by a nested trap */
+        saved_mepc = read_csr(mepc);
+        saved_mstatus = read_csr(mstatus);
+        saved_threshold = PLIC_GetPriority_Threshold();
+        PLIC_SetPriority_Threshold(PLIC_GetPriority((PLIC_IRQn_Type)int_num));
+        saved_mie = clear_csr(mie, MIP_MTIP | MIP_MSIP);
+        set_csr(mstatus, MSTATUS_MIE);
+#endif
+
+#ifdef MPFS_HAL_IRQ_PROFILING
+        handler_cycles = readmcycle();
+#endif
 
-    uint8_t disable = EXT_IRQ_KEEP_ENABLED;
 #ifndef SIFIVE_HIFIVE_UNLEASHED
-    disable = ext_irq_handler_table[int_num /* + OFFSET_TO_MSS_GLOBAL_INTS Think this was required in early bitfile */]();
+        disable = ext_irq_handler_table[int_num /* + OFFSET_TO_MSS_GLOBAL_INTS Think this was required in early bitfile */]();
 #else
-    disable = ext_irq_handler_table[int_num]();
+        disable = ext_irq_handler_table[int_num]();
 #endif
 
-    PLIC_CompleteIRQ(int_num);
+#ifdef MPFS_HAL_IRQ_PROFILING
+        handler_cycles = readmcycle() - handler_cycles;
+#endif
 
-    if(EXT_IRQ_DISABLE == disable)
-    {
-        PLIC_DisableIRQ((PLIC_IRQn_Type)int_num);
-    }
+#ifdef MPFS_HAL_NESTED_EXT_INTERRUPTS
+        clear_csr(mstatus, MSTATUS_MIE);
+        set_csr(mie, saved_mie & (MIP_MTIP | MIP_MSIP));
+        PLIC_SetPriority_Threshold(saved_threshold);
+        write_csr(mepc, saved_mepc);
+        write_csr(mstatus, saved_mstatus);
+#endif
 
+        PLIC_CompleteIRQ(int_num);
+        PLIC_complete_affinity(int_num);
+
+        if(EXT_IRQ_DISABLE == disable)
+        {
+            PLIC_DisableIRQ((PLIC_IRQn_Type)int_num);
+        }
+
+#ifdef MPFS_HAL_IRQ_PROFILING
+        irq_profile_record(IRQ_PROFILE_EXT_SOURCE(int_num), handler_cycles,
+                readmcycle() - claim_cycles);
+        claim_cycles = readmcycle();
+#endif
+
+        int_num = PLIC_ClaimIRQ();
+    }
 }
 
 
 /*------------------------------------------------------------------------------
  *
  */
-void handle_local_interrupt(uint8_t interrupt_no)
+MSS_HOT_TEXT void handle_local_interrupt(uint8_t interrupt_no)
 {
 #ifndef SIFIVE_HIFIVE_UNLEASHED    /* no local interrupts on unleashed */
     uint64_t mhart_id = read_csr(mhartid);
     uint8_t local_interrupt_no = (uint8_t)(interrupt_no - 16U);
     local_int_p_t *local_int_table = local_int_mux[mhart_id];
+#ifdef MPFS_HAL_IRQ_PROFILING
+    uint64_t handler_cycles = readmcycle();
+#endif
+
+#ifdef MPFS_HAL_F2H_FAST_PATH
+    if(0U == mss_f2h_local_isr(mhart_id, local_interrupt_no))
+#endif
+    {
+        (*local_int_table[local_interrupt_no])();
+    }
 
-    (*local_int_table[local_interrupt_no])();
+#ifdef MPFS_HAL_IRQ_PROFILING
+    irq_profile_record(IRQ_PROFILE_LOCAL_SOURCE(local_interrupt_no),
+            readmcycle() - handler_cycles, 0U);
+#endif
 
 #endif
 }
@@ -726,10 +1055,14 @@ void handle_local_interrupt(uint8_t interrupt_no)
 /*------------------------------------------------------------------------------
  *
  */
-void trap_from_machine_mode(uintptr_t * regs, uintptr_t dummy, uintptr_t mepc)
+MSS_HOT_TEXT void trap_from_machine_mode(uintptr_t * regs, uintptr_t dummy, uintptr_t mepc)
 {
     volatile uintptr_t mcause = read_csr(mcause);
 
+#ifdef MPFS_HAL_LOAD_ACCOUNTING
+    mss_load_trap_enter();
+#endif
+
     if (((mcause & MCAUSE_INT) == MCAUSE_INT) && ((mcause & MCAUSE_CAUSE)  > 15U)&& ((mcause & MCAUSE_CAUSE)  < 64U))
     {
         handle_local_interrupt((uint8_t)(mcause & MCAUSE_CAUSE));
@@ -746,6 +1079,22 @@ void trap_from_machine_mode(uintptr_t * regs, uintptr_t dummy, uintptr_t mepc)
     {
         handle_m_timer_interrupt();
     }
+#ifdef MPFS_HAL_SMODE_APP
+    else if (CAUSE_SUPERVISOR_ECALL == mcause)
+    {
+        mss_smode_ecall(regs, mepc);
+    }
+#endif
+#ifdef MPFS_HAL_EMULATE_MISALIGNED
+    else if (CAUSE_MISALIGNED_LOAD == mcause)
+    {
+        misaligned_load_trap(regs, mcause, mepc);
+    }
+    else if (CAUSE_MISALIGNED_STORE == mcause)
+    {
+        misaligned_store_trap(regs, mcause, mepc);
+    }
+#endif
     else
     {
         uint32_t i = 0U;
@@ -776,6 +1125,10 @@ void trap_from_machine_mode(uintptr_t * regs, uintptr_t dummy, uintptr_t mepc)
                 break;
         }
     }
+
+#ifdef MPFS_HAL_LOAD_ACCOUNTING
+    mss_load_trap_exit();
+#endif
 }
 
 #ifdef __cplusplus
@@ -59,6 +59,8 @@ extern "C" {
 
 #define HLS_SIZE          (64)
 #define INTEGER_CONTEXT_SIZE (32 * REGBYTES)
+/* ra, t0-t6 and a0-a7, saved by the vectored interrupt entry stubs */
+#define CALLER_SAVED_CONTEXT_SIZE (16 * REGBYTES)
 
 #ifndef __ASSEMBLER__
 typedef struct {
@@ -82,6 +84,22 @@ typedef struct {
 #define HLS() ((hls_t*)(MACHINE_STACK_TOP() - HLS_SIZE))
 #define OTHER_HLS(id) ((hls_t*)((void *)HLS() + RISCV_PGSIZE * ((id) - read_const_csr(mhartid))))
 
+#ifdef MPFS_HAL_EMULATE_MISALIGNED
+/*
+ * Misaligned accesses emulated on a hart, see MPFS_HAL_EMULATE_MISALIGNED in
+ * mss_sw_config.h. last_pc and last_addr give the most recent one, to find
+ * the code making them.
+ */
+typedef struct {
+  uint64_t loads;
+  uint64_t stores;
+  uintptr_t last_pc;
+  uintptr_t last_addr;
+} mss_misaligned_stats_t;
+
+void mss_get_misaligned_stats(uint64_t hart_id, mss_misaligned_stats_t * stats);
+#endif
+
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_park.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Runtime parking and re-wake of the U54s
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * See mss_park.h
+ */
+void mss_park_init(mss_park_t * park)
+{
+    uint32_t inc;
+
+    park->parked = 0U;
+    park->released = 0U;
+
+    for(inc = 0U; inc < MSS_PARK_NUM_HARTS; inc++)
+    {
+        park->stats[inc].parks = 0U;
+        park->stats[inc].wakes = 0U;
+        park->stats[inc].parked_ticks = 0U;
+    }
+
+    mb();
+}
+
+/***************************************************************************//**
+ * See mss_park.h
+ */
+uint8_t mss_park_hart(mss_park_t * park)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t hart_bit = 1ULL << hart_id;
+    HLS_DATA * hls = (HLS_DATA *)get_tp_reg();
+    uint64_t start;
+    uint8_t ret_val = ERROR;
+
+    if((0U != hart_id) &&
+        (0U == __atomic_load_n(&park->released, __ATOMIC_ACQUIRE)))
+    {
+        hls->park_mstatus = read_csr(mstatus);
+        clear_csr(mstatus, MSTATUS_MIE);
+        hls->park_mie = read_csr(mie);
+        write_csr(mie, MIP_MSIP);
+        hls->park_count++;
+        hls->park_state = HLS_PARK_PARKED;
+
+        start = readmtime();
+        park->stats[hart_id].parks++;
+        (void)__atomic_fetch_or(&park->parked, hart_bit, __ATOMIC_SEQ_CST);
+
+        /* Released meanwhile, mss_park_release() may have missed the bit */
+        if(0U != __atomic_load_n(&park->released, __ATOMIC_SEQ_CST))
+        {
+            (void)__atomic_fetch_and(&park->parked, ~hart_bit,
+                    __ATOMIC_SEQ_CST);
+        }
+
+#ifdef MPFS_HAL_LOAD_ACCOUNTING
+        mss_load_idle_enter();
+#endif
+        /*
+         * The software interrupt is cleared before the bit is looked at, so a
+         * wake which clears the bit after the look also leaves the interrupt
+         * pending for the wfi.
+         */
+        clear_soft_interrupt();
+
+        while(0U != (__atomic_load_n(&park->parked, __ATOMIC_ACQUIRE) &
+                hart_bit))
+        {
+            __asm__ __volatile__("wfi");
+            clear_soft_interrupt();
+        }
+#ifdef MPFS_HAL_LOAD_ACCOUNTING
+        mss_load_idle_exit();
+#endif
+
+        park->stats[hart_id].parked_ticks += readmtime() - start;
+
+        hls->park_state = HLS_PARK_RUNNING;
+        write_csr(mie, hls->park_mie);
+
+        if(0U != (hls->park_mstatus & MSTATUS_MIE))
+        {
+            set_csr(mstatus, MSTATUS_MIE);
+        }
+
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_park.h
+ */
+uint8_t mss_park_wake(mss_park_t * park, uint32_t hart_id)
+{
+    uint64_t hart_bit = 1ULL << hart_id;
+    uint8_t ret_val = ERROR;
+
+    if((hart_id < MSS_PARK_NUM_HARTS) &&
+        (0U != (__atomic_fetch_and(&park->parked, ~hart_bit, __ATOMIC_SEQ_CST) &
+        hart_bit)))
+    {
+        (void)__atomic_fetch_add(&park->stats[hart_id].wakes, 1U,
+                __ATOMIC_RELAXED);
+        raise_soft_interrupt(hart_id);
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_park.h
+ */
+uint32_t mss_park_wake_one(mss_park_t * park)
+{
+    uint64_t parked = __atomic_load_n(&park->parked, __ATOMIC_RELAXED);
+    uint32_t hart_id;
+    uint32_t woken = MSS_PARK_NO_HART;
+
+    /* Another hart may wake the same hart first, then try the next one */
+    while((MSS_PARK_NO_HART == woken) && (0U != parked))
+    {
+        hart_id = (uint32_t)__builtin_ctzll(parked);
+
+        if(SUCCESS == mss_park_wake(park, hart_id))
+        {
+            woken = hart_id;
+        }
+        else
+        {
+            parked = __atomic_load_n(&park->parked, __ATOMIC_RELAXED) &
+                    ~((2ULL << hart_id) - 1U);
+        }
+    }
+
+    return (woken);
+}
+
+/***************************************************************************//**
+ * See mss_park.h
+ */
+void mss_park_release(mss_park_t * park)
+{
+    uint32_t inc;
+
+    __atomic_store_n(&park->released, 1U, __ATOMIC_SEQ_CST);
+
+    for(inc = 0U; inc < MSS_PARK_NUM_HARTS; inc++)
+    {
+        (void)mss_park_wake(park, inc);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_park.h
+ */
+uint64_t mss_park_get_mask(const mss_park_t * park)
+{
+    return (__atomic_load_n(&park->parked, __ATOMIC_RELAXED));
+}
+
+/***************************************************************************//**
+ * See mss_park.h
+ */
+void mss_park_get_stats(const mss_park_t * park, uint32_t hart_id,
+        mss_park_stats_t * stats)
+{
+    if(hart_id < MSS_PARK_NUM_HARTS)
+    {
+        *stats = park->stats[hart_id];
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
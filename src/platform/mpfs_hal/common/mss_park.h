@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_park.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Runtime parking and re-wake of the U54s
+ *
+ * park_hart() parks a hart for good. mss_park_hart() parks the calling U54
+ * until another hart wakes it with mss_park_wake() or mss_park_wake_one(), so
+ * the U54s not needed at low load can be left in wfi and brought back within
+ * microseconds when there is work for them.
+ *
+ * A parked hart waits in wfi with only its software interrupt enabled in mie
+ * and interrupts disabled in mstatus, so its timer, local and PLIC interrupts
+ * do not wake it. They stay pending, and are taken once it has been woken and
+ * has put back its mie and mstatus, which are kept in its HLS while it is
+ * parked, together with its park state, see HLS_DATA. The wfi loop runs from
+ * the L1 instruction cache, so the hart makes no access to memory until it is
+ * woken.
+ *
+ * The harts parked are bits of a mask in an mss_park_t shared by the harts,
+ * e.g. in hls->shared_mem. A wake clears the bit of the hart then sends it the
+ * software interrupt. The software interrupt of a parked hart is taken by the
+ * park, so the other users of the software interrupt of the hart, e.g.
+ * mss_io_offload.h, must not post to a parked hart. A wake sent just as the
+ * hart is leaving may leave its software interrupt pending when it returns.
+ *
+ * The task scheduler of mss_task_sched.h parks its idle workers and wakes them
+ * when its deques grow, see mss_sched_set_parking(). With
+ * MPFS_HAL_LOAD_ACCOUNTING defined in mss_sw_config.h the time parked is
+ * counted as idle time by mss_load.h.
+ *
+ * Example, U54_2 to U54_4 parked while U54_1 copes alone:
+ * @code
+ *   // u54_2 to u54_4
+ *   while(1)
+ *   {
+ *       if(0U == work_pending())
+ *       {
+ *           (void)mss_park_hart(&g_shared->park);
+ *       }
+ *       do_work();
+ *   }
+ *
+ *   // u54_1, when its backlog grows
+ *   (void)mss_park_wake_one(&g_shared->park);
+ * @endcode
+ */
+#ifndef MSS_PARK_H
+#define MSS_PARK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MSS_PARK_NUM_HARTS              5U
+
+/*
+ * Returned by mss_park_wake_one() when no hart is parked
+ */
+#define MSS_PARK_NO_HART                0xFFFFFFFFUL
+
+/*
+ * Park state of a hart, in the park_state field of its HLS
+ */
+#define HLS_PARK_RUNNING                0U
+#define HLS_PARK_PARKED                 1U
+
+typedef struct
+{
+    uint64_t parks;             /* Times the hart parked */
+    uint64_t wakes;             /* Wakes sent to the hart */
+    uint64_t parked_ticks;      /* mtime ticks spent parked */
+} mss_park_stats_t;
+
+typedef struct
+{
+    volatile uint64_t parked;   /* Harts parked, bit N for hart N */
+    volatile uint32_t released; /* Set by mss_park_release() */
+    mss_park_stats_t stats[MSS_PARK_NUM_HARTS];
+} mss_park_t;
+
+/***************************************************************************//**
+ * mss_park_init() marks all the harts running and clears the statistics. It
+ * must be called before any hart parks.
+ */
+void mss_park_init(mss_park_t * park);
+
+/***************************************************************************//**
+ * mss_park_hart() parks the calling U54 until it is woken, then puts back its
+ * interrupt state and returns SUCCESS. It returns ERROR at once on the E51,
+ * which serves the other harts, and once mss_park_release() has been called.
+ */
+uint8_t mss_park_hart(mss_park_t * park);
+
+/***************************************************************************//**
+ * mss_park_wake() wakes a hart. It returns SUCCESS if the hart was parked,
+ * ERROR if it was running.
+ */
+uint8_t mss_park_wake(mss_park_t * park, uint32_t hart_id);
+
+/***************************************************************************//**
+ * mss_park_wake_one() wakes the lowest numbered hart parked, and returns its
+ * hart ID, or MSS_PARK_NO_HART if none is parked.
+ */
+uint32_t mss_park_wake_one(mss_park_t * park);
+
+/***************************************************************************//**
+ * mss_park_release() wakes all the harts parked, and makes mss_park_hart()
+ * return at once from then on, until mss_park_init() is called again. A hart
+ * parking at the same time is either woken or does not park.
+ */
+void mss_park_release(mss_park_t * park);
+
+/***************************************************************************//**
+ * mss_park_get_mask() returns the harts parked, bit N for hart N.
+ */
+uint64_t mss_park_get_mask(const mss_park_t * park);
+
+/***************************************************************************//**
+ * mss_park_get_stats() copies the park statistics of a hart to stats. The
+ * statistics of a running hart may be updated meanwhile, so are only a sample.
+ */
+void mss_park_get_stats(const mss_park_t * park, uint32_t hart_id,
+        mss_park_stats_t * stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_PARK_H */
@@ -0,0 +1,397 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_pc_profile.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Statistical profiling of the program counter
+ *
+ */
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PC_PROFILE_NUM_HARTS        (MPFS_HAL_LAST_HART + 1U)
+#define PC_PROFILE_NO_DEADLINE      (~0ULL)
+#define PC_PROFILE_MTIME_HZ         LIBERO_SETTING_MSS_RTC_TOGGLE_CLK
+
+typedef struct
+{
+    pc_profile_entry_t * table;
+    uint64_t samples;
+    uint64_t dropped;
+    uint32_t used;
+    /* Sampling, in mtime ticks */
+    uint64_t period;
+    uint64_t next_sample;
+    /* Deadline of the system tick or the software timers, and the last value
+       the profiler wrote to mtimecmp, which tells it when they wrote theirs */
+    uint64_t client_cmp;
+    uint64_t programmed;
+    uint8_t client_active;
+    volatile uint8_t running;
+} pc_profile_hart_t;
+
+static pc_profile_hart_t g_pc_profile[PC_PROFILE_NUM_HARTS];
+static uint32_t g_pc_profile_entries = 0U;
+
+static void pc_profile_record(pc_profile_hart_t * prof, uint64_t pc);
+
+/***************************************************************************//**
+ * See mss_pc_profile.h
+ */
+uint8_t pc_profile_init(uint32_t entries)
+{
+    uint8_t result = SUCCESS;
+    uint32_t hart_id;
+    pc_profile_entry_t * table;
+
+    if ((0U == entries) || (0U != (entries & (entries - 1U))) ||
+        (0U != g_pc_profile_entries))
+    {
+        result = ERROR;
+    }
+
+    for (hart_id = 0U; (SUCCESS == result) && (hart_id < PC_PROFILE_NUM_HARTS);
+         hart_id++)
+    {
+        table = (pc_profile_entry_t *)mss_l2_scratchpad_alloc(
+                entries * sizeof(pc_profile_entry_t), 64U);
+
+        if ((pc_profile_entry_t *)0 == table)
+        {
+            result = ERROR;
+        }
+        else
+        {
+            (void)memset(table, 0, entries * sizeof(pc_profile_entry_t));
+            g_pc_profile[hart_id].table = table;
+        }
+    }
+
+    if (SUCCESS == result)
+    {
+        g_pc_profile_entries = entries;
+    }
+
+    return (result);
+}
+
+/***************************************************************************//**
+ * See mss_pc_profile.h
+ */
+uint8_t pc_profile_start(uint64_t period_us)
+{
+    uint8_t result = ERROR;
+    uint64_t hart_id = read_csr(mhartid);
+    pc_profile_hart_t * prof;
+    uint64_t mstatus;
+
+    if ((hart_id < PC_PROFILE_NUM_HARTS) && (0U != g_pc_profile_entries) &&
+        (0U != period_us))
+    {
+        prof = &g_pc_profile[hart_id];
+        mstatus = disable_interrupts();
+
+        if (0U == prof->running)
+        {
+            prof->period = (period_us * PC_PROFILE_MTIME_HZ) / 1000000U;
+
+            if (0U == prof->period)
+            {
+                prof->period = 1U;
+            }
+
+            /* A timer interrupt enabled is the deadline of the system tick or
+               the software timers */
+            if (0U != (read_csr(mie) & MIP_MTIP))
+            {
+                prof->client_cmp = CLINT->MTIMECMP[hart_id];
+                prof->client_active = 1U;
+            }
+            else
+            {
+                prof->client_cmp = PC_PROFILE_NO_DEADLINE;
+                prof->client_active = 0U;
+            }
+
+            prof->next_sample = readmtime() + prof->period;
+            prof->programmed = CLINT->MTIMECMP[hart_id];
+            prof->running = 1U;
+
+            pc_profile_program();
+            set_csr(mie, MIP_MTIP);
+        }
+
+        restore_interrupts(mstatus);
+        result = SUCCESS;
+    }
+
+    return (result);
+}
+
+/***************************************************************************//**
+ * See mss_pc_profile.h
+ */
+void pc_profile_stop(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    pc_profile_hart_t * prof;
+    uint64_t mstatus;
+    uint64_t cmp;
+
+    if (hart_id < PC_PROFILE_NUM_HARTS)
+    {
+        prof = &g_pc_profile[hart_id];
+        mstatus = disable_interrupts();
+
+        if (0U != prof->running)
+        {
+            prof->running = 0U;
+            cmp = CLINT->MTIMECMP[hart_id];
+
+            if (cmp != prof->programmed)
+            {
+                prof->client_cmp = cmp;
+                prof->client_active = 1U;
+            }
+
+            if (0U != prof->client_active)
+            {
+                CLINT->MTIMECMP[hart_id] = prof->client_cmp;
+            }
+            else
+            {
+                clear_csr(mie, MIP_MTIP);
+                CLINT->MTIMECMP[hart_id] = PC_PROFILE_NO_DEADLINE;
+            }
+        }
+
+        restore_interrupts(mstatus);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_pc_profile.h
+ */
+void pc_profile_reset(uint64_t hart_id)
+{
+    pc_profile_hart_t * prof;
+    uint64_t mstatus;
+
+    if ((hart_id < PC_PROFILE_NUM_HARTS) && (0U != g_pc_profile_entries))
+    {
+        prof = &g_pc_profile[hart_id];
+        mstatus = disable_interrupts();
+
+        (void)memset(prof->table, 0,
+                g_pc_profile_entries * sizeof(pc_profile_entry_t));
+        prof->samples = 0U;
+        prof->dropped = 0U;
+        prof->used = 0U;
+
+        restore_interrupts(mstatus);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_pc_profile.h
+ */
+void pc_profile_get_stats(uint64_t hart_id, pc_profile_stats_t * stats)
+{
+    (void)memset(stats, 0, sizeof(pc_profile_stats_t));
+
+    if (hart_id < PC_PROFILE_NUM_HARTS)
+    {
+        stats->samples = g_pc_profile[hart_id].samples;
+        stats->dropped = g_pc_profile[hart_id].dropped;
+        stats->used = g_pc_profile[hart_id].used;
+        stats->entries = g_pc_profile_entries;
+    }
+}
+
+/***************************************************************************//**
+ * See mss_pc_profile.h
+ */
+const pc_profile_entry_t * pc_profile_get_table(uint64_t hart_id)
+{
+    const pc_profile_entry_t * table = (const pc_profile_entry_t *)0;
+
+    if (hart_id < PC_PROFILE_NUM_HARTS)
+    {
+        table = g_pc_profile[hart_id].table;
+    }
+
+    return (table);
+}
+
+/***************************************************************************//**
+ * See mss_pc_profile.h
+ */
+void pc_profile_dump(mss_uart_instance_t * uart, uint64_t hart_id)
+{
+    pc_profile_hart_t * prof;
+    uint32_t index;
+
+    if ((hart_id < PC_PROFILE_NUM_HARTS) && (0U != g_pc_profile_entries))
+    {
+        prof = &g_pc_profile[hart_id];
+
+        mss_print_hex(uart, "\n\r hart ", hart_id, 1U);
+        mss_print_hex(uart, " samples ", prof->samples, 16U);
+        mss_print_hex(uart, " dropped ", prof->dropped, 16U);
+
+        for (index = 0U; index < g_pc_profile_entries; index++)
+        {
+            if (0U != prof->table[index].count)
+            {
+                mss_print_hex(uart, "\n\rpc ", prof->table[index].pc, 16U);
+                mss_print_hex(uart, " ", prof->table[index].count, 16U);
+            }
+        }
+
+        MSS_UART_polled_tx_string(uart, (const uint8_t *)"\n\r");
+    }
+}
+
+/***************************************************************************//**
+ * See mss_pc_profile.h
+ */
+uint8_t pc_profile_timer(void)
+{
+    uint8_t due = 1U;
+    uint64_t hart_id = read_csr(mhartid);
+    pc_profile_hart_t * prof;
+    uint64_t cmp;
+    uint64_t now;
+
+    if ((hart_id < PC_PROFILE_NUM_HARTS) &&
+        (0U != g_pc_profile[hart_id].running))
+    {
+        prof = &g_pc_profile[hart_id];
+        cmp = CLINT->MTIMECMP[hart_id];
+
+        if (cmp != prof->programmed)
+        {
+            prof->client_cmp = cmp;
+            prof->client_active = 1U;
+        }
+
+        now = readmtime();
+
+        if (now >= prof->next_sample)
+        {
+            pc_profile_record(prof, read_csr(mepc));
+
+            /* Periods missed with the interrupts disabled are not made up */
+            prof->next_sample += prof->period;
+
+            if (prof->next_sample <= now)
+            {
+                prof->next_sample = now + prof->period;
+            }
+        }
+
+        if ((0U != prof->client_active) && (now >= prof->client_cmp))
+        {
+            /* The system tick or the software timers see their own deadline
+               in mtimecmp, and program the next one */
+            CLINT->MTIMECMP[hart_id] = prof->client_cmp;
+            prof->programmed = prof->client_cmp;
+        }
+        else
+        {
+            due = 0U;
+        }
+    }
+
+    return (due);
+}
+
+/***************************************************************************//**
+ * See mss_pc_profile.h
+ */
+void pc_profile_program(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    pc_profile_hart_t * prof;
+    uint64_t cmp;
+    uint64_t next;
+
+    if ((hart_id < PC_PROFILE_NUM_HARTS) &&
+        (0U != g_pc_profile[hart_id].running))
+    {
+        prof = &g_pc_profile[hart_id];
+        cmp = CLINT->MTIMECMP[hart_id];
+
+        if (cmp != prof->programmed)
+        {
+            prof->client_cmp = cmp;
+            prof->client_active = 1U;
+        }
+
+        next = prof->next_sample;
+
+        if ((0U != prof->client_active) && (prof->client_cmp < next))
+        {
+            next = prof->client_cmp;
+        }
+
+        prof->programmed = next;
+        CLINT->MTIMECMP[hart_id] = next;
+    }
+}
+
+/***************************************************************************//**
+ * Adds a sample to the table of a hart. The table is open addressed, probed
+ * linearly from a hash of the address.
+ */
+static void pc_profile_record(pc_profile_hart_t * prof, uint64_t pc)
+{
+    uint32_t mask = g_pc_profile_entries - 1U;
+    uint32_t index = (uint32_t)(((pc >> 1U) * 0x9E3779B97F4A7C15ULL) >> 32U) &
+            mask;
+    uint32_t probe;
+    uint8_t recorded = 0U;
+
+    prof->samples++;
+
+    for (probe = 0U; (0U == recorded) && (probe < PC_PROFILE_MAX_PROBES) &&
+         (probe <= mask); probe++)
+    {
+        if (0U == prof->table[index].count)
+        {
+            prof->table[index].pc = pc;
+            prof->table[index].count = 1U;
+            prof->used++;
+            recorded = 1U;
+        }
+        else if (pc == prof->table[index].pc)
+        {
+            prof->table[index].count++;
+            recorded = 1U;
+        }
+        else
+        {
+            index = (index + 1U) & mask;
+        }
+    }
+
+    if (0U == recorded)
+    {
+        prof->dropped++;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_pc_profile.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Statistical profiling of the program counter
+ *
+ * pc_profile_start() starts sampling the calling hart at a fixed period. At
+ * each sample, the machine timer interrupt handler adds the interrupted
+ * program counter, mepc, to a histogram of the hart. The histogram is a table
+ * of address and count pairs in the L2 scratchpad, allocated once by
+ * pc_profile_init(), which pc_profile_dump() prints so that the addresses can
+ * be resolved against the ELF file offline, e.g. with addr2line.
+ *
+ * The profiler is always built and costs one test in the machine timer
+ * handler when it is not running, so any image can be profiled from a
+ * command of the application or from the debugger, without being rebuilt.
+ *
+ * The samples are taken with the CLINT mtimecmp register of the hart, as the
+ * U54 and E51 performance counters do not raise an interrupt on overflow.
+ * While the profiler runs it shares mtimecmp with the system tick, the
+ * software timers and mss_idle_wait(): it keeps the deadline they program and
+ * sets mtimecmp to the earlier of that deadline and the next sample, passing
+ * the interrupt on to them when their deadline is reached. A deadline written
+ * outside the timer interrupt handler while the profiler runs, e.g. by
+ * SysTick_Config(), holds the samples back until it is reached.
+ *
+ * Code running with the machine interrupts disabled is never sampled; its
+ * time is given to the instruction which enables them again. A hart waiting
+ * in wfi is sampled at the wfi instruction.
+ *
+ * Samples whose address is not found in the table within
+ * PC_PROFILE_MAX_PROBES entries, when the table is nearly full, are counted
+ * as dropped.
+ *
+ * Example, sampling U54_1 at 10kHz:
+ * @code
+ *   (void)pc_profile_init(4096U);       // once, from any hart
+ *   (void)pc_profile_start(100U);       // on U54_1
+ *   run_workload();
+ *   pc_profile_stop();
+ *   pc_profile_dump(&g_mss_uart0_lo, 1U);
+ * @endcode
+ */
+#ifndef MSS_PC_PROFILE_H
+#define MSS_PC_PROFILE_H
+
+#include <stdint.h>
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PC_PROFILE_MAX_PROBES       16U
+
+typedef struct
+{
+    uint64_t pc;
+    uint64_t count;
+} pc_profile_entry_t;
+
+typedef struct
+{
+    uint64_t samples;
+    uint64_t dropped;
+    uint32_t used;
+    uint32_t entries;
+} pc_profile_stats_t;
+
+/***************************************************************************//**
+ * pc_profile_init() allocates a table of entries address and count pairs, a
+ * power of two, from the L2 scratchpad for each hart up to MPFS_HAL_LAST_HART.
+ * It must be called once before any hart starts profiling. It returns
+ * SUCCESS, or ERROR when entries is not a power of two or the scratchpad
+ * allocator area is exhausted.
+ */
+uint8_t pc_profile_init(uint32_t entries);
+
+/***************************************************************************//**
+ * pc_profile_start() starts sampling the calling hart every period_us
+ * microseconds. The table of the hart is not cleared, so that the samples of
+ * successive runs add up. It returns SUCCESS, or ERROR when pc_profile_init()
+ * was not called or the period is 0.
+ */
+uint8_t pc_profile_start(uint64_t period_us);
+
+/***************************************************************************//**
+ * pc_profile_stop() stops sampling the calling hart and gives mtimecmp back to
+ * the system tick and the software timers.
+ */
+void pc_profile_stop(void);
+
+/***************************************************************************//**
+ * pc_profile_reset() clears the table of a hart. The profiler of the hart
+ * must be stopped, unless pc_profile_reset() is called on the hart itself.
+ */
+void pc_profile_reset(uint64_t hart_id);
+
+/***************************************************************************//**
+ * pc_profile_get_stats() returns the number of samples taken and dropped and
+ * the number of the table entries in use for a hart.
+ */
+void pc_profile_get_stats(uint64_t hart_id, pc_profile_stats_t * stats);
+
+/***************************************************************************//**
+ * pc_profile_get_table() returns the table of a hart, which holds
+ * pc_profile_stats_t.entries entries in no particular order, entries with a
+ * count of 0 being unused. It returns a null pointer when the hart is out of
+ * range or pc_profile_init() was not called.
+ */
+const pc_profile_entry_t * pc_profile_get_table(uint64_t hart_id);
+
+/***************************************************************************//**
+ * pc_profile_dump() prints the number of samples of a hart followed by one
+ * line per address sampled, giving the address and its count in hexadecimal.
+ * Stop the profiler of the hart first for a consistent dump.
+ *
+ * The addresses are resolved with e.g.:
+ * @code
+ *   awk '$1 == "pc" { print $2 }' dump.txt | addr2line -f -e app.elf
+ * @endcode
+ */
+void pc_profile_dump(mss_uart_instance_t * uart, uint64_t hart_id);
+
+/***************************************************************************//**
+ * pc_profile_timer() takes a sample when one is due. It returns 1 when the
+ * deadline of the system tick or the software timers is reached, or the
+ * profiler is not running on the hart, and 0 otherwise.
+ * pc_profile_program() then sets mtimecmp for the next sample or deadline.
+ * They are called by handle_m_timer_interrupt().
+ */
+uint8_t pc_profile_timer(void);
+void pc_profile_program(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_PC_PROFILE_H */
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_perf.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Hart performance counters and L2 ECC event counters
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * See mss_perf.h
+ */
+uint8_t mss_perf_configure(uint8_t counter, uint64_t event)
+{
+    uint8_t ret_val = SUCCESS;
+
+    switch(counter)
+    {
+        case 0U:
+            write_csr(mhpmevent3, event);
+            write_csr(mhpmcounter3, 0U);
+            break;
+
+        case 1U:
+            write_csr(mhpmevent4, event);
+            write_csr(mhpmcounter4, 0U);
+            break;
+
+        default:
+            ret_val = ERROR;
+            break;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_perf.h
+ */
+uint64_t mss_perf_read(uint8_t counter)
+{
+    uint64_t value = 0U;
+
+    switch(counter)
+    {
+        case 0U:
+            value = read_csr(mhpmcounter3);
+            break;
+
+        case 1U:
+            value = read_csr(mhpmcounter4);
+            break;
+
+        default:
+            value = 0U;
+            break;
+    }
+
+    return (value);
+}
+
+/***************************************************************************//**
+ * See mss_perf.h
+ */
+void mss_perf_snapshot(mss_perf_snapshot_t * snapshot)
+{
+    snapshot->cycles = read_csr(mcycle);
+    snapshot->instret = read_csr(minstret);
+    snapshot->event[0] = read_csr(mhpmcounter3);
+    snapshot->event[1] = read_csr(mhpmcounter4);
+}
+
+/***************************************************************************//**
+ * See mss_perf.h
+ */
+void mss_perf_read_l2_ecc(mss_l2_ecc_stats_t * stats)
+{
+    stats->dir_fix_addr = CACHE_CTRL->ECC_DIR_FIX_ADDR;
+    stats->dir_fix_count = CACHE_CTRL->ECC_DIR_FIX_COUNT;
+    stats->data_fix_addr = CACHE_CTRL->ECC_DATA_FIX_ADDR;
+    stats->data_fix_count = CACHE_CTRL->ECC_DATA_FIX_COUNT;
+    stats->data_fail_addr = CACHE_CTRL->ECC_DATA_FAIL_ADDR;
+    stats->data_fail_count = CACHE_CTRL->ECC_DATA_FAIL_COUNT;
+}
+
+#ifdef __cplusplus
+}
+#endif
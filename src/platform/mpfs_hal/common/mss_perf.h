@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_perf.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Hart performance counters and L2 ECC event counters
+ *
+ * Each hart has two event counters, mhpmcounter3 and mhpmcounter4, in addition
+ * to the cycle and retired instruction counters. The event counted is selected
+ * with mss_perf_configure() as an event class and a mask of events within the
+ * class; the counter increments when any of the events in the mask occurs.
+ * The counters and their configuration belong to the hart which calls the
+ * functions, so each hart configures and reads its own counters.
+ *
+ * mss_perf_snapshot() reads all the counters of the hart at once, so that a
+ * hot loop can be profiled from the difference of two snapshots:
+ * @code
+ *   mss_perf_snapshot_t before, after;
+ *
+ *   (void)mss_perf_configure(0U, MSS_PERF_EVENT_DCACHE_MISS);
+ *   (void)mss_perf_configure(1U, MSS_PERF_EVENT_BRANCH_MISPREDICT);
+ *   mss_perf_snapshot(&before);
+ *   hot_loop();
+ *   mss_perf_snapshot(&after);
+ *   misses = after.event[0] - before.event[0];
+ * @endcode
+ *
+ * mss_perf_read_l2_ecc() reads the error correction counters of the L2 cache
+ * controller, which are shared by all the harts.
+ */
+#ifndef MSS_PERF_H
+#define MSS_PERF_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MSS_PERF_NUM_COUNTERS           2U
+
+#define MSS_PERF_EVENT(class, mask)     ((((uint64_t)(mask)) << 8U) | \
+                                            ((uint64_t)(class)))
+
+/*
+ * Instruction commit events
+ */
+#define MSS_PERF_EVENT_EXCEPTION        MSS_PERF_EVENT(0U, 0x0001U)
+#define MSS_PERF_EVENT_LOAD_RETIRED     MSS_PERF_EVENT(0U, 0x0002U)
+#define MSS_PERF_EVENT_STORE_RETIRED    MSS_PERF_EVENT(0U, 0x0004U)
+#define MSS_PERF_EVENT_ATOMIC_RETIRED   MSS_PERF_EVENT(0U, 0x0008U)
+#define MSS_PERF_EVENT_BRANCH_RETIRED   MSS_PERF_EVENT(0U, 0x0040U)
+#define MSS_PERF_EVENT_JUMP_RETIRED     MSS_PERF_EVENT(0U, 0x0180U)
+
+/*
+ * Microarchitectural events. MSS_PERF_EVENT_STALL counts the cycles in which
+ * the pipeline is held by an interlock or a busy cache.
+ */
+#define MSS_PERF_EVENT_LOAD_USE_INTERLOCK       MSS_PERF_EVENT(1U, 0x0001U)
+#define MSS_PERF_EVENT_LONG_LATENCY_INTERLOCK   MSS_PERF_EVENT(1U, 0x0002U)
+#define MSS_PERF_EVENT_ICACHE_BUSY              MSS_PERF_EVENT(1U, 0x0008U)
+#define MSS_PERF_EVENT_DCACHE_BUSY              MSS_PERF_EVENT(1U, 0x0010U)
+#define MSS_PERF_EVENT_BRANCH_MISPREDICT        MSS_PERF_EVENT(1U, 0x0020U)
+#define MSS_PERF_EVENT_TARGET_MISPREDICT        MSS_PERF_EVENT(1U, 0x0040U)
+#define MSS_PERF_EVENT_PIPELINE_FLUSH           MSS_PERF_EVENT(1U, 0x0180U)
+#define MSS_PERF_EVENT_STALL                    MSS_PERF_EVENT(1U, 0x061FU)
+
+/*
+ * Memory system events
+ */
+#define MSS_PERF_EVENT_ICACHE_MISS      MSS_PERF_EVENT(2U, 0x0001U)
+#define MSS_PERF_EVENT_DCACHE_MISS      MSS_PERF_EVENT(2U, 0x0002U)
+#define MSS_PERF_EVENT_DCACHE_WRITEBACK MSS_PERF_EVENT(2U, 0x0004U)
+#define MSS_PERF_EVENT_ITLB_MISS        MSS_PERF_EVENT(2U, 0x0008U)
+#define MSS_PERF_EVENT_DTLB_MISS        MSS_PERF_EVENT(2U, 0x0010U)
+
+typedef struct
+{
+    uint64_t cycles;
+    uint64_t instret;
+    uint64_t event[MSS_PERF_NUM_COUNTERS];
+} mss_perf_snapshot_t;
+
+typedef struct
+{
+    uint64_t dir_fix_addr;
+    uint32_t dir_fix_count;
+    uint64_t data_fix_addr;
+    uint32_t data_fix_count;
+    uint64_t data_fail_addr;
+    uint32_t data_fail_count;
+} mss_l2_ecc_stats_t;
+
+/***************************************************************************//**
+ * mss_perf_configure() selects the event counted by one of the event counters
+ * of the calling hart, 0 for mhpmcounter3 or 1 for mhpmcounter4, and clears
+ * the counter. An event of 0 stops the counter. It returns ERROR for an
+ * invalid counter.
+ */
+uint8_t mss_perf_configure(uint8_t counter, uint64_t event);
+
+/***************************************************************************//**
+ * mss_perf_read() returns the value of one of the event counters of the
+ * calling hart, or 0 for an invalid counter.
+ */
+uint64_t mss_perf_read(uint8_t counter);
+
+/***************************************************************************//**
+ * mss_perf_snapshot() reads the cycle, retired instruction and event counters
+ * of the calling hart.
+ */
+void mss_perf_snapshot(mss_perf_snapshot_t * snapshot);
+
+/***************************************************************************//**
+ * mss_perf_read_l2_ecc() reads the number of corrected directory and data
+ * errors, the number of uncorrected data errors, and the address of the last
+ * error of each kind, from the L2 cache controller.
+ */
+void mss_perf_read_l2_ecc(mss_l2_ecc_stats_t * stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_PERF_H */
@@ -24,6 +24,145 @@ extern "C" {
 
 const unsigned long plic_hart_lookup[5U] = {0U, 1U, 3U, 5U, 7U};
 
+#define PLIC_NUM_HARTS      5U
+#define PLIC_HART_MASK      ((1U << PLIC_NUM_HARTS) - 1U)
+
+/*
+ * Interrupts each hart must disable for itself on their next completion
+ */
+static volatile uint32_t \
+        g_plic_affinity_release[PLIC_NUM_HARTS][PLIC_SET_UP_REGISTERS];
+static volatile long g_plic_affinity_lock = 0;
+
+static volatile uint32_t * plic_mmode_enables(uint64_t hart_id);
+
+/***************************************************************************//**
+ * See mss_plic.h
+ */
+void PLIC_set_affinity(PLIC_IRQn_Type IRQn, uint32_t hart_mask)
+{
+    uint64_t my_hart_id = read_csr(mhartid);
+    uint64_t mstatus;
+    uint64_t hart_id;
+    volatile uint32_t * enables;
+    uint32_t word = (uint32_t)IRQn / 32U;
+    uint32_t bit = (uint32_t)1U << ((uint32_t)IRQn % 32U);
+
+    if((IRQn > INVALID_IRQn) && (IRQn < PLIC_NUM_SOURCES))
+    {
+        mstatus = disable_interrupts();
+        spinlock(&g_plic_affinity_lock);
+
+        for(hart_id = 0U; hart_id < PLIC_NUM_HARTS; hart_id++)
+        {
+            enables = plic_mmode_enables(hart_id);
+
+            if(0U != (hart_mask & ((uint32_t)1U << hart_id)))
+            {
+                g_plic_affinity_release[hart_id][word] &= ~bit;
+                enables[word] |= bit;
+            }
+            else if(0U != (enables[word] & bit))
+            {
+                if(hart_id == my_hart_id)
+                {
+                    enables[word] &= ~bit;
+                }
+                else
+                {
+                    g_plic_affinity_release[hart_id][word] |= bit;
+                }
+            }
+            else
+            {
+                /* not routed to this hart */
+            }
+        }
+
+        spinunlock(&g_plic_affinity_lock);
+        restore_interrupts(mstatus);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_plic.h
+ */
+uint32_t PLIC_get_affinity(PLIC_IRQn_Type IRQn)
+{
+    uint32_t hart_mask = 0U;
+    uint64_t hart_id;
+    uint32_t word = (uint32_t)IRQn / 32U;
+    uint32_t bit = (uint32_t)1U << ((uint32_t)IRQn % 32U);
+
+    if((IRQn > INVALID_IRQn) && (IRQn < PLIC_NUM_SOURCES))
+    {
+        for(hart_id = 0U; hart_id < PLIC_NUM_HARTS; hart_id++)
+        {
+            if((0U != (plic_mmode_enables(hart_id)[word] & bit)) &&
+               (0U == (g_plic_affinity_release[hart_id][word] & bit)))
+            {
+                hart_mask |= (uint32_t)1U << hart_id;
+            }
+        }
+    }
+
+    return (hart_mask & PLIC_HART_MASK);
+}
+
+/***************************************************************************//**
+ * See mss_plic.h
+ */
+void PLIC_complete_affinity(uint32_t IRQn)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint32_t word = IRQn / 32U;
+    uint32_t bit = (uint32_t)1U << (IRQn % 32U);
+
+    if((hart_id < PLIC_NUM_HARTS) && (IRQn < PLIC_NUM_SOURCES) &&
+       (0U != (g_plic_affinity_release[hart_id][word] & bit)))
+    {
+        spinlock(&g_plic_affinity_lock);
+
+        /* PLIC_set_affinity() may have added the hart back in the meantime */
+        if(0U != (g_plic_affinity_release[hart_id][word] & bit))
+        {
+            plic_mmode_enables(hart_id)[word] &= ~bit;
+            g_plic_affinity_release[hart_id][word] &= ~bit;
+        }
+
+        spinunlock(&g_plic_affinity_lock);
+    }
+}
+
+/***************************************************************************//**
+ * Returns the machine mode enables of a hart
+ */
+static volatile uint32_t * plic_mmode_enables(uint64_t hart_id)
+{
+    volatile uint32_t * enables;
+
+    switch(hart_id)
+    {
+        case 1U:
+            enables = PLIC->HART1_MMODE_ENA;
+            break;
+        case 2U:
+            enables = PLIC->HART2_MMODE_ENA;
+            break;
+        case 3U:
+            enables = PLIC->HART3_MMODE_ENA;
+            break;
+        case 4U:
+            enables = PLIC->HART4_MMODE_ENA;
+            break;
+        default:
+            enables = PLIC->HART0_MMODE_ENA;
+            break;
+    }
+
+    return (enables);
+}
+
 #ifdef __cplusplus
 }
 #endif
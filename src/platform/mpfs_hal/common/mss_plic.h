@@ -959,6 +959,66 @@ static inline void PLIC_SetPriority_Threshold(uint32_t threshold)
     PLIC->TARGET[plic_hart_lookup[hart_id]].PRIORITY_THRESHOLD  = threshold;
 }
 
+/***************************************************************************//**
+ * The function PLIC_GetPriority_Threshold() returns the threshold of the
+ * machine mode context of the current hart.
+ */
+static inline uint32_t PLIC_GetPriority_Threshold(void)
+{
+    uint64_t hart_id  = read_csr(mhartid);
+
+    return (PLIC->TARGET[plic_hart_lookup[hart_id]].PRIORITY_THRESHOLD);
+}
+
+/***************************************************************************//**
+ * The functions PLIC_raise_threshold() and PLIC_restore_threshold() bracket a
+ * priority ceiling critical section on the current hart. In place of masking
+ * every interrupt with disable_interrupts(), the machine mode PLIC threshold
+ * of the hart is raised to the ceiling of the resource protected, the highest
+ * priority of the PLIC sources whose handlers use it. Those sources, and all
+ * the sources of a lower priority, are held off while sources of a higher
+ * priority are still taken:
+ * @code
+ *   // Driver state shared with the handler of a source of priority 2
+ *   saved = PLIC_raise_threshold(2U);
+ *   update_driver_state();
+ *   PLIC_restore_threshold(saved);
+ * @endcode
+ *
+ * PLIC_raise_threshold() never lowers the threshold, so the sections nest, in
+ * interrupt handlers too, and returns the threshold to restore. The threshold
+ * register is read back once written, so the interrupts held off can no
+ * longer be signalled by the time it returns.
+ *
+ * Only the PLIC sources of the current hart are held off: the state must not
+ * be shared with local, software or timer interrupt handlers, nor with other
+ * harts, which need disable_interrupts() or a lock of mss_lock.h.
+ */
+static inline uint32_t PLIC_raise_threshold(uint32_t ceiling)
+{
+    uint64_t hart_id  = read_csr(mhartid);
+    volatile uint32_t * threshold =
+            &PLIC->TARGET[plic_hart_lookup[hart_id]].PRIORITY_THRESHOLD;
+    uint32_t saved = *threshold;
+
+    ASSERT(ceiling <= 7);
+
+    if (ceiling > saved)
+    {
+        *threshold = ceiling;
+        (void)*threshold;
+    }
+
+    return (saved);
+}
+
+static inline void PLIC_restore_threshold(uint32_t saved)
+{
+    uint64_t hart_id  = read_csr(mhartid);
+
+    PLIC->TARGET[plic_hart_lookup[hart_id]].PRIORITY_THRESHOLD  = saved;
+}
+
 /***************************************************************************//**
  *  PLIC_ClearPendingIRQ(void)
  *  This is only called by the startup hart and only once
@@ -1019,6 +1079,36 @@ static inline void PLIC_init_on_reset(void)
     PLIC_ClearPendingIRQ();
 }
 
+/***************************************************************************//**
+ * The function PLIC_set_affinity() routes the external interrupt IRQn to the
+ * machine mode context of the harts set in hart_mask, bit n being hart n. It
+ * can be called from any hart at any time, except from the handler of IRQn.
+ *
+ * The interrupt is enabled immediately on the harts added. It is disabled
+ * immediately on the calling hart if removed from it. Another hart removed
+ * may hold a claim on the interrupt, and the PLIC ignores the completion from
+ * a hart the interrupt is not enabled for, so it keeps the interrupt enabled
+ * until it next completes it in handle_m_ext_interrupt() and then releases
+ * it. The harts servicing IRQn can take it once more during that time.
+ *
+ * Interrupts managed with PLIC_set_affinity() should not also be enabled or
+ * disabled with PLIC_EnableIRQ() and PLIC_DisableIRQ().
+ */
+void PLIC_set_affinity(PLIC_IRQn_Type IRQn, uint32_t hart_mask);
+
+/***************************************************************************//**
+ * The function PLIC_get_affinity() returns the mask of the harts the external
+ * interrupt IRQn is routed to, not counting the harts releasing it.
+ */
+uint32_t PLIC_get_affinity(PLIC_IRQn_Type IRQn);
+
+/***************************************************************************//**
+ * The function PLIC_complete_affinity() is called by handle_m_ext_interrupt()
+ * after completing IRQn. It disables IRQn for the current hart when
+ * PLIC_set_affinity() removed the hart from its routing.
+ */
+void PLIC_complete_affinity(uint32_t IRQn);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,468 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_pmp_region.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Runtime PMP regions, switched per task
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PMP_REGION_NUM_HARTS        (MPFS_HAL_LAST_HART + 1U)
+
+/* pmpaddr holds bits 55:2 of an address */
+#define PMP_REGION_ADDR_LIMIT       (1ULL << 56U)
+#define PMP_REGION_PERM_MASK        (PMP_R | PMP_W | PMP_X)
+
+/*
+ * The block of entries of a hart, as last written
+ */
+typedef struct
+{
+    uint64_t addr[MSS_PMP_REGION_ENTRIES];
+    uint64_t cfg0;
+    uint64_t cfg2;
+} pmp_block_t;
+
+static pmp_block_t g_pmp_block[PMP_REGION_NUM_HARTS];
+static mss_pmp_region_stats_t g_pmp_region_stats[PMP_REGION_NUM_HARTS];
+
+/*******************************************************************************
+ * Local functions
+ */
+static uint8_t set_insert(mss_pmp_set_t * set, mss_pmp_range_t range);
+static uint8_t set_encode(mss_pmp_set_t * set);
+static uint8_t cfg_get(uint64_t cfg0, uint64_t cfg2, uint32_t entry);
+static void cfg_put(uint64_t * cfg0, uint64_t * cfg2, uint32_t entry,
+        uint8_t cfg);
+static uint64_t pmpaddr_read(uint32_t entry);
+static void pmpaddr_write(uint32_t entry, uint64_t value);
+
+/***************************************************************************//**
+ * See mss_pmp_region.h
+ */
+uint8_t mss_pmp_region_init(void)
+{
+    uint8_t ret_val = SUCCESS;
+    uint64_t hart_id = read_csr(mhartid);
+    pmp_block_t * block = &g_pmp_block[hart_id];
+    uint32_t entry;
+    uint32_t inc;
+
+    block->cfg0 = read_csr(pmpcfg0);
+    block->cfg2 = read_csr(pmpcfg2);
+
+    for(inc = 0U; inc < MSS_PMP_REGION_ENTRIES; inc++)
+    {
+        entry = MSS_PMP_REGION_FIRST + inc;
+        block->addr[inc] = pmpaddr_read(entry);
+
+        if(0U != (cfg_get(block->cfg0, block->cfg2, entry) & PMP_L))
+        {
+            ret_val = ERROR;
+        }
+    }
+
+    entry = MSS_PMP_REGION_FIRST + MSS_PMP_REGION_ENTRIES;
+
+    if((entry < 16U) &&
+            (PMP_TOR == (cfg_get(block->cfg0, block->cfg2, entry) & PMP_A)))
+    {
+        ret_val = ERROR;
+    }
+
+    if(SUCCESS == ret_val)
+    {
+        mss_pmp_set_load((const mss_pmp_set_t *)0);
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_pmp_region.h
+ */
+void mss_pmp_set_init(mss_pmp_set_t * set)
+{
+    set->ranges = 0U;
+    set->entries = 0U;
+}
+
+/***************************************************************************//**
+ * See mss_pmp_region.h
+ */
+uint8_t mss_pmp_set_add
+(
+    mss_pmp_set_t * set,
+    uint64_t base,
+    uint64_t size,
+    uint8_t perm
+)
+{
+    uint8_t ret_val = ERROR;
+    mss_pmp_set_t work;
+    mss_pmp_range_t range;
+
+    if((0U != (size & 3U)) || (0U != (base & 3U)))
+    {
+        /* Not aligned */
+    }
+    else if((0U == size) || (0U != (perm & (uint8_t)~PMP_REGION_PERM_MASK)) ||
+            (PMP_W == (perm & (PMP_R | PMP_W))))
+    {
+        /* Nothing to add, or not valid permissions, W without R is reserved */
+    }
+    else if((base >= PMP_REGION_ADDR_LIMIT) ||
+            (size > (PMP_REGION_ADDR_LIMIT - base)))
+    {
+        /* Beyond what pmpaddr can hold */
+    }
+    else
+    {
+        work = *set;
+        range.base = base;
+        range.end = base + size;
+        range.perm = perm;
+
+        if((SUCCESS == set_insert(&work, range)) &&
+                (SUCCESS == set_encode(&work)))
+        {
+            *set = work;
+            ret_val = SUCCESS;
+        }
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_pmp_region.h
+ *
+ * Entries past the end of the set are turned off and their pmpaddr left as it
+ * is, as nothing uses it.
+ */
+void mss_pmp_set_load(const mss_pmp_set_t * set)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    pmp_block_t * block = &g_pmp_block[hart_id];
+    uint64_t psr = disable_interrupts();
+    uint64_t cfg0 = block->cfg0;
+    uint64_t cfg2 = block->cfg2;
+    uint64_t writes = 0U;
+    uint32_t entries = 0U;
+    uint8_t cfg;
+    uint32_t inc;
+
+    if((const mss_pmp_set_t *)0 != set)
+    {
+        entries = set->entries;
+    }
+
+    for(inc = 0U; inc < MSS_PMP_REGION_ENTRIES; inc++)
+    {
+        cfg = 0U;
+
+        if(inc < entries)
+        {
+            cfg = set->cfg[inc];
+
+            if(set->addr[inc] != block->addr[inc])
+            {
+                pmpaddr_write(MSS_PMP_REGION_FIRST + inc, set->addr[inc]);
+                block->addr[inc] = set->addr[inc];
+                writes++;
+            }
+        }
+
+        cfg_put(&cfg0, &cfg2, MSS_PMP_REGION_FIRST + inc, cfg);
+    }
+
+    if(cfg0 != block->cfg0)
+    {
+        write_csr(pmpcfg0, cfg0);
+        block->cfg0 = cfg0;
+        writes++;
+    }
+
+    if(cfg2 != block->cfg2)
+    {
+        write_csr(pmpcfg2, cfg2);
+        block->cfg2 = cfg2;
+        writes++;
+    }
+
+    g_pmp_region_stats[hart_id].loads++;
+    g_pmp_region_stats[hart_id].csr_writes += writes;
+
+    restore_interrupts(psr);
+}
+
+/***************************************************************************//**
+ * See mss_pmp_region.h
+ */
+void mss_pmp_region_get_stats(uint32_t hart_id, mss_pmp_region_stats_t * stats)
+{
+    ASSERT(hart_id < PMP_REGION_NUM_HARTS);
+
+    *stats = g_pmp_region_stats[hart_id];
+}
+
+/***************************************************************************//**
+ * Inserts a range into the ranges of a set, in order of base, merging it with
+ * the ranges with the same permissions it overlaps or touches. Ranges with the
+ * same permissions in a set never overlap or touch, so one pass does.
+ */
+static uint8_t set_insert(mss_pmp_set_t * set, mss_pmp_range_t range)
+{
+    uint8_t ret_val = SUCCESS;
+    mss_pmp_range_t out[MSS_PMP_REGION_ENTRIES + 1U];
+    mss_pmp_range_t * old;
+    uint32_t count = 0U;
+    uint8_t placed = 0U;
+    uint32_t inc;
+
+    for(inc = 0U; (inc < set->ranges) && (SUCCESS == ret_val); inc++)
+    {
+        old = &set->range[inc];
+
+        if(old->end <= range.base)
+        {
+            if((old->end == range.base) && (old->perm == range.perm))
+            {
+                range.base = old->base;
+            }
+            else
+            {
+                out[count] = *old;
+                count++;
+            }
+        }
+        else if(old->base >= range.end)
+        {
+            if((old->base == range.end) && (old->perm == range.perm))
+            {
+                range.end = old->end;
+            }
+            else
+            {
+                if(0U == placed)
+                {
+                    out[count] = range;
+                    count++;
+                    placed = 1U;
+                }
+
+                out[count] = *old;
+                count++;
+            }
+        }
+        else if(old->perm == range.perm)
+        {
+            if(old->base < range.base)
+            {
+                range.base = old->base;
+            }
+
+            if(old->end > range.end)
+            {
+                range.end = old->end;
+            }
+        }
+        else
+        {
+            /* Overlaps a range with other permissions */
+            ret_val = ERROR;
+        }
+    }
+
+    if((SUCCESS == ret_val) && (0U == placed))
+    {
+        out[count] = range;
+        count++;
+    }
+
+    if((SUCCESS == ret_val) && (count > MSS_PMP_REGION_ENTRIES))
+    {
+        ret_val = ERROR;
+    }
+
+    if(SUCCESS == ret_val)
+    {
+        for(inc = 0U; inc < count; inc++)
+        {
+            set->range[inc] = out[inc];
+        }
+
+        set->ranges = (uint8_t)count;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * Works out the entries of the ranges of a set. A TOR entry takes its base
+ * from the entry before it, so a range starting where the TOR range before it
+ * ends needs no entry for its base. The first entry of the block takes its
+ * base from a Libero entry, or 0 for entry 0.
+ */
+static uint8_t set_encode(mss_pmp_set_t * set)
+{
+    uint8_t ret_val = SUCCESS;
+    uint64_t top = 0U;
+    uint8_t top_known = (0U == MSS_PMP_REGION_FIRST) ? 1U : 0U;
+    uint32_t count = 0U;
+    uint32_t needed;
+    uint64_t base;
+    uint64_t size;
+    uint32_t inc;
+
+    for(inc = 0U; (inc < set->ranges) && (SUCCESS == ret_val); inc++)
+    {
+        base = set->range[inc].base;
+        size = set->range[inc].end - base;
+
+        if((0U == (size & (size - 1U))) && (0U == (base & (size - 1U))))
+        {
+            needed = 1U;
+        }
+        else if((0U != top_known) && (top == base))
+        {
+            needed = 1U;
+        }
+        else
+        {
+            needed = 2U;
+        }
+
+        if((count + needed) > MSS_PMP_REGION_ENTRIES)
+        {
+            ret_val = ERROR;
+        }
+        else if((0U == (size & (size - 1U))) && (0U == (base & (size - 1U))))
+        {
+            if(4U == size)
+            {
+                set->addr[count] = base >> PMP_SHIFT;
+                set->cfg[count] = set->range[inc].perm | PMP_NA4;
+            }
+            else
+            {
+                set->addr[count] = (base >> PMP_SHIFT) | ((size >> 3U) - 1U);
+                set->cfg[count] = set->range[inc].perm | PMP_NAPOT;
+            }
+
+            count++;
+            top_known = 0U;
+        }
+        else
+        {
+            if(2U == needed)
+            {
+                /* Entry turned off, holding the base */
+                set->addr[count] = base >> PMP_SHIFT;
+                set->cfg[count] = 0U;
+                count++;
+            }
+
+            set->addr[count] = set->range[inc].end >> PMP_SHIFT;
+            set->cfg[count] = set->range[inc].perm | PMP_TOR;
+            count++;
+            top = set->range[inc].end;
+            top_known = 1U;
+        }
+    }
+
+    set->entries = (uint8_t)count;
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * The pmpcfg byte of an entry. On RV64 pmpcfg0 holds entries 0 to 7 and
+ * pmpcfg2 entries 8 to 15.
+ */
+static uint8_t cfg_get(uint64_t cfg0, uint64_t cfg2, uint32_t entry)
+{
+    uint64_t reg = (entry < 8U) ? cfg0 : cfg2;
+
+    return ((uint8_t)(reg >> ((entry & 7U) * 8U)));
+}
+
+static void cfg_put(uint64_t * cfg0, uint64_t * cfg2, uint32_t entry,
+        uint8_t cfg)
+{
+    uint64_t * reg = (entry < 8U) ? cfg0 : cfg2;
+    uint32_t shift = (entry & 7U) * 8U;
+
+    *reg = (*reg & ~(0xFFULL << shift)) | ((uint64_t)cfg << shift);
+}
+
+/***************************************************************************//**
+ * The CSR number is part of the instruction, hence the switches.
+ */
+static uint64_t pmpaddr_read(uint32_t entry)
+{
+    uint64_t value;
+
+    switch(entry)
+    {
+        case 0U:  value = read_csr(pmpaddr0);  break;
+        case 1U:  value = read_csr(pmpaddr1);  break;
+        case 2U:  value = read_csr(pmpaddr2);  break;
+        case 3U:  value = read_csr(pmpaddr3);  break;
+        case 4U:  value = read_csr(pmpaddr4);  break;
+        case 5U:  value = read_csr(pmpaddr5);  break;
+        case 6U:  value = read_csr(pmpaddr6);  break;
+        case 7U:  value = read_csr(pmpaddr7);  break;
+        case 8U:  value = read_csr(pmpaddr8);  break;
+        case 9U:  value = read_csr(pmpaddr9);  break;
+        case 10U: value = read_csr(pmpaddr10); break;
+        case 11U: value = read_csr(pmpaddr11); break;
+        case 12U: value = read_csr(pmpaddr12); break;
+        case 13U: value = read_csr(pmpaddr13); break;
+        case 14U: value = read_csr(pmpaddr14); break;
+        case 15U: value = read_csr(pmpaddr15); break;
+        default:  value = 0U;                  break;
+    }
+
+    return (value);
+}
+
+static void pmpaddr_write(uint32_t entry, uint64_t value)
+{
+    switch(entry)
+    {
+        case 0U:  write_csr(pmpaddr0, value);  break;
+        case 1U:  write_csr(pmpaddr1, value);  break;
+        case 2U:  write_csr(pmpaddr2, value);  break;
+        case 3U:  write_csr(pmpaddr3, value);  break;
+        case 4U:  write_csr(pmpaddr4, value);  break;
+        case 5U:  write_csr(pmpaddr5, value);  break;
+        case 6U:  write_csr(pmpaddr6, value);  break;
+        case 7U:  write_csr(pmpaddr7, value);  break;
+        case 8U:  write_csr(pmpaddr8, value);  break;
+        case 9U:  write_csr(pmpaddr9, value);  break;
+        case 10U: write_csr(pmpaddr10, value); break;
+        case 11U: write_csr(pmpaddr11, value); break;
+        case 12U: write_csr(pmpaddr12, value); break;
+        case 13U: write_csr(pmpaddr13, value); break;
+        case 14U: write_csr(pmpaddr14, value); break;
+        case 15U: write_csr(pmpaddr15, value); break;
+        default:  break;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
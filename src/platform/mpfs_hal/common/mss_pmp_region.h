@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_pmp_region.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Runtime PMP regions, switched per task
+ *
+ * pmp_configure() sets the PMP entries of each hart from Libero at start up.
+ * A block of MSS_PMP_REGION_ENTRIES entries, from entry MSS_PMP_REGION_FIRST,
+ * can then be given over to regions set up at run time, e.g. the stack and
+ * buffers of each task of an RTOS, the Libero entries being left as they are.
+ * The entries of the block must be unlocked, and the entry after the block
+ * must not be a TOR entry, as its base would be the last entry of the block.
+ * Entries below the block match first, so the block goes above the Libero
+ * entries which are to take precedence and below the entry, if any, which
+ * denies all the rest of memory.
+ *
+ * A region set, mss_pmp_set_t, holds the regions of a task. Regions are added
+ * with mss_pmp_set_add(), which merges regions with the same permissions which
+ * overlap or touch, and encodes each one in as few entries as it can:
+ *  - a naturally aligned power of two region takes one NA4 or NAPOT entry
+ *  - any other region takes one TOR entry, plus an entry for its base unless
+ *    it starts where the TOR region before it ends
+ * The CSR values are worked out when the region is added, so loading a set
+ * is just writes.
+ *
+ * mss_pmp_set_load() loads a set into the block of the calling hart. A copy of
+ * the block as written is kept for each hart, and only the pmpaddr registers
+ * which change are written, plus pmpcfg0 and pmpcfg2 if their bytes for the
+ * block change. Switching between tasks with the same layout of regions, e.g.
+ * a stack each and a shared buffer, costs one pmpaddr write for each region
+ * which differs and one or two pmpcfg writes, if any.
+ *
+ * PMP entries which are not locked check accesses from S and U mode only, so
+ * the regions protect memory from code run in those modes. The FreeRTOS port
+ * of the examples runs its tasks in M mode, where only locked entries apply.
+ *
+ * Example, loading the region set of a task from its FreeRTOS task tag on
+ * each context switch, in FreeRTOSConfig.h:
+ * @code
+ *   #define configUSE_APPLICATION_TASK_TAG  1
+ *   #define traceTASK_SWITCHED_IN()                                          \
+ *       mss_pmp_set_load((const mss_pmp_set_t *)pxCurrentTCB->pxTaskTag)
+ * @endcode
+ * and when the task is created:
+ * @code
+ *   static mss_pmp_set_t g_task_regions;
+ *
+ *   mss_pmp_set_init(&g_task_regions);
+ *   (void)mss_pmp_set_add(&g_task_regions, (uint64_t)stack, sizeof(stack),
+ *           PMP_R | PMP_W);
+ *   (void)mss_pmp_set_add(&g_task_regions, (uint64_t)&g_shared,
+ *           sizeof(g_shared), PMP_R);
+ *   vTaskSetApplicationTaskTag(task, (TaskHookFunction_t)&g_task_regions);
+ * @endcode
+ * mss_pmp_region_init() is called on each hart once pmp_configure() has run,
+ * before the scheduler starts.
+ */
+#ifndef MSS_PMP_REGION_H
+#define MSS_PMP_REGION_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The block of PMP entries used for the regions
+ */
+#ifndef MSS_PMP_REGION_FIRST
+#define MSS_PMP_REGION_FIRST            8U
+#endif
+
+#ifndef MSS_PMP_REGION_ENTRIES
+#define MSS_PMP_REGION_ENTRIES          6U
+#endif
+
+#if ((MSS_PMP_REGION_FIRST + MSS_PMP_REGION_ENTRIES) > 16U)
+#error "MSS_PMP_REGION_FIRST + MSS_PMP_REGION_ENTRIES must not be above 16"
+#endif
+
+/*
+ * A region, from base up to but not including end
+ */
+typedef struct
+{
+    uint64_t base;
+    uint64_t end;
+    uint8_t perm;               /* PMP_R, PMP_W and PMP_X */
+} mss_pmp_range_t;
+
+/*
+ * A region set, the regions and the entries encoding them
+ */
+typedef struct
+{
+    mss_pmp_range_t range[MSS_PMP_REGION_ENTRIES];  /* In order of base */
+    uint64_t addr[MSS_PMP_REGION_ENTRIES];          /* pmpaddr values */
+    uint8_t cfg[MSS_PMP_REGION_ENTRIES];            /* pmpcfg bytes */
+    uint8_t ranges;
+    uint8_t entries;
+} mss_pmp_set_t;
+
+typedef struct
+{
+    uint64_t loads;             /* mss_pmp_set_load() calls */
+    uint64_t csr_writes;        /* pmpaddr and pmpcfg writes made */
+} mss_pmp_region_stats_t;
+
+/***************************************************************************//**
+ * mss_pmp_region_init() takes over the block of entries on the calling hart,
+ * reading the values pmp_configure() left in it. The entries of the block are
+ * turned off, so memory is checked against the Libero entries only until a
+ * set is loaded.
+ *
+ * @return
+ *   SUCCESS, or ERROR if an entry of the block is locked or the entry after
+ *   the block is a TOR entry.
+ */
+uint8_t mss_pmp_region_init(void);
+
+/***************************************************************************//**
+ * mss_pmp_set_init() empties a region set. An empty set turns every entry of
+ * the block off when loaded.
+ */
+void mss_pmp_set_init(mss_pmp_set_t * set);
+
+/***************************************************************************//**
+ * mss_pmp_set_add() adds a region of size bytes from base to a set, with the
+ * permissions perm, any of PMP_R, PMP_W and PMP_X. base and size must be
+ * multiples of 4 bytes. A set loaded on a hart is not changed there until
+ * it is loaded again.
+ *
+ * @return
+ *   SUCCESS, or ERROR if the region is not 4 byte aligned, overlaps a region
+ *   of the set with other permissions, or the set would no longer fit in
+ *   MSS_PMP_REGION_ENTRIES entries. The set is left as it was on ERROR.
+ */
+uint8_t mss_pmp_set_add
+(
+    mss_pmp_set_t * set,
+    uint64_t base,
+    uint64_t size,
+    uint8_t perm
+);
+
+/***************************************************************************//**
+ * mss_pmp_set_load() loads a set into the block of entries of the calling
+ * hart, writing only the CSRs which change. A null set loads an empty set.
+ * It is meant to be called on a context switch, from M mode.
+ */
+void mss_pmp_set_load(const mss_pmp_set_t * set);
+
+/***************************************************************************//**
+ * mss_pmp_region_get_stats() copies the load statistics of a hart to stats.
+ */
+void mss_pmp_region_get_stats(uint32_t hart_id, mss_pmp_region_stats_t * stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_PMP_REGION_H */
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_print.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Printing of numbers on a UART for the reports of the HAL
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * See mss_print.h
+ */
+void mss_print_hex(mss_uart_instance_t * uart, const char * msg, uint64_t d,
+        uint8_t digits)
+{
+    const uint8_t hexchrs[] = { '0','1','2','3','4','5','6','7','8','9','A','B',\
+            'C','D','E','F' };
+    uint8_t idx;
+
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)msg);
+
+    for (idx = digits; idx > 0U; idx--)
+    {
+        MSS_UART_polled_tx(uart, &hexchrs[(d >> (4U * (idx - 1U))) & 0x0FU],
+                1U);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_print.h
+ */
+void mss_print_dec(mss_uart_instance_t * uart, const char * msg, uint64_t d)
+{
+    uint8_t digits[20];
+    uint8_t idx = 0U;
+
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)msg);
+
+    do
+    {
+        digits[idx] = (uint8_t)('0' + (d % 10U));
+        d /= 10U;
+        idx++;
+    } while(0U != d);
+
+    while(idx > 0U)
+    {
+        idx--;
+        MSS_UART_polled_tx(uart, &digits[idx], 1U);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
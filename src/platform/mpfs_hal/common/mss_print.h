@@ -0,0 +1,44 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_print.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Printing of numbers on a UART for the reports of the HAL
+ *
+ * The reports of the HAL profiling and statistics code print their values
+ * with these functions, using the polled transmit of the UART driver.
+ */
+#ifndef MSS_PRINT_H
+#define MSS_PRINT_H
+
+#include <stdint.h>
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * mss_print_hex() prints msg followed by the low digits of d in hexadecimal,
+ * digits giving their number.
+ */
+void mss_print_hex(mss_uart_instance_t * uart, const char * msg, uint64_t d,
+        uint8_t digits);
+
+/***************************************************************************//**
+ * mss_print_dec() prints msg followed by d in decimal.
+ */
+void mss_print_dec(mss_uart_instance_t * uart, const char * msg, uint64_t d);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_PRINT_H */
@@ -0,0 +1,520 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_rpmsg.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief virtio vrings and an RPMsg compatible transport between contexts
+ *
+ */
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VRING_MAX_NUM               32768U
+
+#define ALIGN_UP(x, a)              (((x) + ((uint64_t)(a) - 1U)) & \
+                                        ~((uint64_t)(a) - 1U))
+
+/* RPMsg header, at the start of each buffer */
+typedef struct
+{
+    uint32_t src;
+    uint32_t dst;
+    uint32_t reserved;
+    uint16_t len;
+    uint16_t flags;
+} rpmsg_hdr_t;
+
+/* RPMsg name service message */
+typedef struct
+{
+    char name[MSS_RPMSG_NS_NAME_BYTES];
+    uint32_t addr;
+    uint32_t flags;
+} rpmsg_ns_msg_t;
+
+static uint8_t vring_need_event(uint16_t event, uint16_t new_idx,
+        uint16_t old_idx);
+static uint8_t rpmsg_get_tx_buf(mss_rpmsg_t * rpmsg, uint16_t * head,
+        uint64_t * addr);
+static void rpmsg_put_tx_buf(mss_rpmsg_t * rpmsg, uint16_t head,
+        uint64_t addr, uint32_t len);
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+uint64_t mss_vring_size(uint32_t num)
+{
+    uint64_t size;
+
+    size = ((uint64_t)sizeof(mss_vring_desc_t) * num) +
+            ((uint64_t)sizeof(uint16_t) * (3U + num));
+    size = ALIGN_UP(size, MSS_VRING_ALIGN) +
+            ((uint64_t)sizeof(uint16_t) * 3U) +
+            ((uint64_t)sizeof(mss_vring_used_elem_t) * num);
+
+    return (size);
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+uint8_t mss_vring_init(mss_vring_t * vring, void * mem, uint32_t num,
+        uint8_t side, mss_vring_notify_t notify, void * notify_arg)
+{
+    uint8_t ret_val = ERROR;
+    uint8_t * base = (uint8_t *)mem;
+    uint64_t used_offset;
+    uint32_t inc;
+
+    if ((0U != num) && (0U == (num & (num - 1U))) && (num <= VRING_MAX_NUM) &&
+        (0U == ((uintptr_t)mem & (MSS_VRING_ALIGN - 1U))))
+    {
+        used_offset = ALIGN_UP(((uint64_t)sizeof(mss_vring_desc_t) * num) +
+                ((uint64_t)sizeof(uint16_t) * (3U + num)), MSS_VRING_ALIGN);
+
+        vring->num = num;
+        vring->side = side;
+        vring->desc = (volatile mss_vring_desc_t *)base;
+        vring->avail = (volatile mss_vring_avail_t *)(base +
+                ((uint64_t)sizeof(mss_vring_desc_t) * num));
+        vring->used = (volatile mss_vring_used_t *)(base + used_offset);
+        vring->used_event = &vring->avail->ring[num];
+        vring->avail_event = (volatile uint16_t *)&vring->used->ring[num];
+        vring->last_idx = 0U;
+        vring->kicked_idx = 0U;
+        vring->notify = notify;
+        vring->notify_arg = notify_arg;
+
+        if (MSS_VRING_DRIVER == side)
+        {
+            (void)memset(mem, 0, (size_t)mss_vring_size(num));
+
+            for (inc = 0U; inc < num; inc++)
+            {
+                vring->desc[inc].next = (uint16_t)(inc + 1U);
+            }
+
+            vring->free_head = 0U;
+            vring->num_free = (uint16_t)num;
+        }
+        else
+        {
+            vring->free_head = 0U;
+            vring->num_free = 0U;
+        }
+
+        mb();
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+uint8_t mss_vring_add_buf(mss_vring_t * vring, uint64_t addr, uint32_t len,
+        uint16_t flags)
+{
+    uint8_t ret_val = ERROR;
+    uint16_t head;
+    uint16_t idx;
+
+    if (0U != vring->num_free)
+    {
+        head = vring->free_head;
+        vring->free_head = vring->desc[head].next;
+        vring->num_free--;
+
+        vring->desc[head].addr = addr;
+        vring->desc[head].len = len;
+        vring->desc[head].flags = (uint16_t)(flags & MSS_VRING_DESC_F_WRITE);
+
+        idx = vring->avail->idx;
+        vring->avail->ring[idx & (vring->num - 1U)] = head;
+
+        /* Publish the descriptor before the index */
+        mb();
+        vring->avail->idx = (uint16_t)(idx + 1U);
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+uint8_t mss_vring_get_used(mss_vring_t * vring, uint64_t * addr,
+        uint32_t * len)
+{
+    uint8_t ret_val = ERROR;
+    uint32_t id;
+
+    if (vring->last_idx != vring->used->idx)
+    {
+        /* Read the entry after the index */
+        mb();
+        id = vring->used->ring[vring->last_idx & (vring->num - 1U)].id;
+
+        if (id < vring->num)
+        {
+            *addr = vring->desc[id].addr;
+            *len = vring->used->ring[vring->last_idx & (vring->num - 1U)].len;
+
+            vring->desc[id].next = vring->free_head;
+            vring->free_head = (uint16_t)id;
+            vring->num_free++;
+            ret_val = SUCCESS;
+        }
+
+        vring->last_idx++;
+
+        /* Ask to be notified of the next entry */
+        *vring->used_event = vring->last_idx;
+        mb();
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+uint8_t mss_vring_get_avail(mss_vring_t * vring, uint16_t * head,
+        uint64_t * addr, uint32_t * len)
+{
+    uint8_t ret_val = ERROR;
+    uint16_t id;
+
+    if (vring->last_idx != vring->avail->idx)
+    {
+        mb();
+        id = vring->avail->ring[vring->last_idx & (vring->num - 1U)];
+
+        if (id < vring->num)
+        {
+            *head = id;
+            *addr = vring->desc[id].addr;
+            *len = vring->desc[id].len;
+            ret_val = SUCCESS;
+        }
+
+        vring->last_idx++;
+
+        *vring->avail_event = vring->last_idx;
+        mb();
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+void mss_vring_add_used(mss_vring_t * vring, uint16_t head, uint32_t len)
+{
+    uint16_t idx = vring->used->idx;
+
+    vring->used->ring[idx & (vring->num - 1U)].id = head;
+    vring->used->ring[idx & (vring->num - 1U)].len = len;
+
+    mb();
+    vring->used->idx = (uint16_t)(idx + 1U);
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+void mss_vring_kick(mss_vring_t * vring)
+{
+    uint16_t new_idx;
+    uint16_t event;
+
+    /* The index must be seen before the event of the other side is read */
+    mb();
+
+    if (MSS_VRING_DRIVER == vring->side)
+    {
+        new_idx = vring->avail->idx;
+        event = *vring->avail_event;
+    }
+    else
+    {
+        new_idx = vring->used->idx;
+        event = *vring->used_event;
+    }
+
+    if ((0U != vring_need_event(event, new_idx, vring->kicked_idx)) &&
+        ((mss_vring_notify_t)0 != vring->notify))
+    {
+        vring->notify(vring->notify_arg);
+    }
+
+    vring->kicked_idx = new_idx;
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+void mss_vring_doorbell_notify(void * arg)
+{
+    const mss_vring_doorbell_t * bell = (const mss_vring_doorbell_t *)arg;
+
+    mss_doorbell_ring(bell->doorbell, bell->hart_id, bell->channels);
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+uint64_t mss_rpmsg_shared_size(uint32_t num, uint32_t buf_bytes)
+{
+    return ((2U * ALIGN_UP(mss_vring_size(num), MSS_VRING_ALIGN)) +
+            (2U * (uint64_t)num * buf_bytes));
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+uint8_t mss_rpmsg_init(mss_rpmsg_t * rpmsg, void * shared, uint32_t num,
+        uint32_t buf_bytes, uint8_t side, mss_vring_notify_t notify,
+        void * notify_arg)
+{
+    uint8_t ret_val = ERROR;
+    uint8_t * vring0 = (uint8_t *)shared;
+    uint8_t * vring1 = vring0 + ALIGN_UP(mss_vring_size(num), MSS_VRING_ALIGN);
+    uint32_t inc;
+
+    if ((buf_bytes > MSS_RPMSG_HDR_BYTES) && (0U == (buf_bytes & 7U)) &&
+        (buf_bytes <= (0xFFFFU + MSS_RPMSG_HDR_BYTES)))
+    {
+        rpmsg->bufs = vring1 + ALIGN_UP(mss_vring_size(num), MSS_VRING_ALIGN);
+        rpmsg->buf_bytes = buf_bytes;
+        rpmsg->tx_fresh = 0U;
+
+        if (MSS_RPMSG_HOST == side)
+        {
+            ret_val = mss_vring_init(&rpmsg->rx, vring0, num, MSS_VRING_DRIVER,
+                    notify, notify_arg);
+
+            if (SUCCESS == ret_val)
+            {
+                ret_val = mss_vring_init(&rpmsg->tx, vring1, num,
+                        MSS_VRING_DRIVER, notify, notify_arg);
+            }
+
+            /* The first half of the buffers take the messages of the remote */
+            for (inc = 0U; (SUCCESS == ret_val) && (inc < num); inc++)
+            {
+                ret_val = mss_vring_add_buf(&rpmsg->rx,
+                        (uint64_t)(uintptr_t)(rpmsg->bufs +
+                        ((uint64_t)inc * buf_bytes)), buf_bytes,
+                        MSS_VRING_DESC_F_WRITE);
+            }
+        }
+        else
+        {
+            ret_val = mss_vring_init(&rpmsg->tx, vring0, num, MSS_VRING_DEVICE,
+                    notify, notify_arg);
+
+            if (SUCCESS == ret_val)
+            {
+                ret_val = mss_vring_init(&rpmsg->rx, vring1, num,
+                        MSS_VRING_DEVICE, notify, notify_arg);
+            }
+        }
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+uint8_t mss_rpmsg_send(mss_rpmsg_t * rpmsg, uint32_t src, uint32_t dst,
+        const void * data, uint32_t len)
+{
+    uint8_t ret_val = ERROR;
+    rpmsg_hdr_t * hdr;
+    uint16_t head = 0U;
+    uint64_t addr = 0U;
+
+    if (len <= (rpmsg->buf_bytes - MSS_RPMSG_HDR_BYTES))
+    {
+        ret_val = rpmsg_get_tx_buf(rpmsg, &head, &addr);
+    }
+
+    if (SUCCESS == ret_val)
+    {
+        hdr = (rpmsg_hdr_t *)(uintptr_t)addr;
+        hdr->src = src;
+        hdr->dst = dst;
+        hdr->reserved = 0U;
+        hdr->len = (uint16_t)len;
+        hdr->flags = 0U;
+        (void)memcpy((uint8_t *)hdr + MSS_RPMSG_HDR_BYTES, data, len);
+
+        rpmsg_put_tx_buf(rpmsg, head, addr, MSS_RPMSG_HDR_BYTES + len);
+        mss_vring_kick(&rpmsg->tx);
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+uint8_t mss_rpmsg_recv(mss_rpmsg_t * rpmsg, uint32_t * src, uint32_t * dst,
+        void * data, uint32_t * len)
+{
+    uint8_t ret_val;
+    const rpmsg_hdr_t * hdr;
+    uint16_t head = 0U;
+    uint64_t addr = 0U;
+    uint32_t buf_len = 0U;
+    uint32_t copy;
+
+    if (MSS_RPMSG_HOST == rpmsg->rx.side)
+    {
+        ret_val = mss_vring_get_used(&rpmsg->rx, &addr, &buf_len);
+    }
+    else
+    {
+        ret_val = mss_vring_get_avail(&rpmsg->rx, &head, &addr, &buf_len);
+    }
+
+    if (SUCCESS == ret_val)
+    {
+        hdr = (const rpmsg_hdr_t *)(uintptr_t)addr;
+        copy = hdr->len;
+
+        if (copy > (rpmsg->buf_bytes - MSS_RPMSG_HDR_BYTES))
+        {
+            copy = rpmsg->buf_bytes - MSS_RPMSG_HDR_BYTES;
+        }
+
+        if (copy > *len)
+        {
+            copy = *len;
+        }
+
+        *src = hdr->src;
+        *dst = hdr->dst;
+        (void)memcpy(data, (const uint8_t *)hdr + MSS_RPMSG_HDR_BYTES, copy);
+        *len = copy;
+
+        /* Give the buffer back */
+        if (MSS_RPMSG_HOST == rpmsg->rx.side)
+        {
+            (void)mss_vring_add_buf(&rpmsg->rx, addr, rpmsg->buf_bytes,
+                    MSS_VRING_DESC_F_WRITE);
+        }
+        else
+        {
+            mss_vring_add_used(&rpmsg->rx, head, 0U);
+        }
+
+        mss_vring_kick(&rpmsg->rx);
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_rpmsg.h
+ */
+uint8_t mss_rpmsg_announce(mss_rpmsg_t * rpmsg, const char * name,
+        uint32_t addr, uint32_t flags)
+{
+    rpmsg_ns_msg_t msg;
+
+    (void)memset(&msg, 0, sizeof(msg));
+    (void)strncpy(msg.name, name, MSS_RPMSG_NS_NAME_BYTES - 1U);
+    msg.addr = addr;
+    msg.flags = flags;
+
+    return (mss_rpmsg_send(rpmsg, addr, MSS_RPMSG_NS_ADDR, &msg,
+            (uint32_t)sizeof(msg)));
+}
+
+/***************************************************************************//**
+ * virtio vring_need_event(): whether event, the index up to which the other
+ * side has consumed, lies in the entries added from old_idx to new_idx
+ */
+static uint8_t vring_need_event(uint16_t event, uint16_t new_idx,
+        uint16_t old_idx)
+{
+    return (((uint16_t)(new_idx - event - 1U) <
+            (uint16_t)(new_idx - old_idx)) ? 1U : 0U);
+}
+
+/***************************************************************************//**
+ * Gets a free buffer to send in. The host uses its transmit buffers once each
+ * before reusing those the remote has returned; the remote takes those the
+ * host has made available.
+ */
+static uint8_t rpmsg_get_tx_buf(mss_rpmsg_t * rpmsg, uint16_t * head,
+        uint64_t * addr)
+{
+    uint8_t ret_val;
+    uint32_t len = 0U;
+
+    if (MSS_RPMSG_HOST == rpmsg->tx.side)
+    {
+        if (rpmsg->tx_fresh < rpmsg->tx.num)
+        {
+            *addr = (uint64_t)(uintptr_t)(rpmsg->bufs + ((uint64_t)
+                    (rpmsg->tx.num + rpmsg->tx_fresh) * rpmsg->buf_bytes));
+            rpmsg->tx_fresh++;
+            ret_val = SUCCESS;
+        }
+        else
+        {
+            ret_val = mss_vring_get_used(&rpmsg->tx, addr, &len);
+        }
+    }
+    else
+    {
+        ret_val = mss_vring_get_avail(&rpmsg->tx, head, addr, &len);
+
+        if ((SUCCESS == ret_val) && (len < rpmsg->buf_bytes))
+        {
+            /* Not one of ours, give it back empty */
+            mss_vring_add_used(&rpmsg->tx, *head, 0U);
+            ret_val = ERROR;
+        }
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * Passes a filled buffer to the other side
+ */
+static void rpmsg_put_tx_buf(mss_rpmsg_t * rpmsg, uint16_t head,
+        uint64_t addr, uint32_t len)
+{
+    if (MSS_RPMSG_HOST == rpmsg->tx.side)
+    {
+        (void)mss_vring_add_buf(&rpmsg->tx, addr, len, 0U);
+    }
+    else
+    {
+        mss_vring_add_used(&rpmsg->tx, head, len);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,292 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_rpmsg.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief virtio vrings and an RPMsg compatible transport between contexts
+ *
+ * For AMP systems, where the harts run separate images, e.g. Linux or an RTOS
+ * on some and bare metal on others, in the memory pointed to by
+ * hls->shared_mem or any other area both contexts can access.
+ *
+ * mss_vring_t is a split virtio ring laid out as in the virtio specification:
+ * the descriptor table, then the available ring, then, at the next multiple of
+ * MSS_VRING_ALIGN, the used ring. The driver side owns the buffers, adds them
+ * to the available ring and takes them back from the used ring; the device
+ * side takes them from the available ring and returns them through the used
+ * ring. Notifications are suppressed with the used_event and avail_event
+ * fields of VIRTIO_RING_F_EVENT_IDX: each side publishes the index it has
+ * consumed up to, and mss_vring_kick() only notifies the other side when it
+ * has added entries past it, so a side which is still working through the
+ * ring takes no interrupts, and any number of entries added between kicks
+ * cost one at most. The notification itself is a callback, so it can be a
+ * CLINT software interrupt through mss_vring_doorbell_notify() and an
+ * mss_doorbell_t of mss_hart_queue.h, or a fabric mailbox or interrupt.
+ *
+ * mss_rpmsg_t is an RPMsg channel over two vrings and a pool of buffers, as
+ * used by the Linux virtio_rpmsg_bus and OpenAMP:
+ *  - the host, the virtio driver, posts half the buffers to vring 0 for the
+ *    remote to send in, and sends in the other half through vring 1,
+ *  - each buffer starts with the 16-byte RPMsg header, source and destination
+ *    addresses and length, followed by the payload,
+ *  - mss_rpmsg_announce() sends the name service announcement which makes
+ *    Linux create an rpmsg device for an endpoint.
+ *
+ * The host lays out the shared memory in mss_rpmsg_init(), so it must have
+ * done so before the remote calls mss_rpmsg_init(), e.g. by setting
+ * hls->shared_mem_status once it has. The harts of the MSS are coherent, so
+ * no cache maintenance is done. Each side of a channel must only be used by
+ * one context at a time.
+ *
+ * Example, U54_1 as host and U54_2 as remote, with g_shared in shared memory:
+ * @code
+ *   // u54_1
+ *   (void)mss_rpmsg_init(&g_rp, g_shared->rpmsg, 64U, 512U, MSS_RPMSG_HOST,
+ *           mss_vring_doorbell_notify, &g_to_h2);
+ *   (void)mss_rpmsg_send(&g_rp, 1024U, 1025U, data, length);
+ *
+ *   // u54_2, once u54_1 has initialised the channel
+ *   (void)mss_rpmsg_init(&g_rp, g_shared->rpmsg, 64U, 512U, MSS_RPMSG_REMOTE,
+ *           mss_vring_doorbell_notify, &g_to_h1);
+ *
+ *   void Software_h2_IRQHandler(void)
+ *   {
+ *       (void)mss_doorbell_take(&g_shared->doorbell);
+ *       length = sizeof(data);
+ *       while (SUCCESS == mss_rpmsg_recv(&g_rp, &src, &dst, data, &length))
+ *       {
+ *           process(data, length);
+ *           length = sizeof(data);
+ *       }
+ *   }
+ * @endcode
+ */
+#ifndef MSS_RPMSG_H
+#define MSS_RPMSG_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Alignment of the used ring, at least a cache line. Linux remoteproc expects
+ * the alignment given in the resource table of the firmware, usually 4096.
+ */
+#ifndef MSS_VRING_ALIGN
+#define MSS_VRING_ALIGN                 64U
+#endif
+
+/*
+ * Descriptor flags
+ */
+#define MSS_VRING_DESC_F_NEXT           1U
+#define MSS_VRING_DESC_F_WRITE          2U
+
+/*
+ * Sides of a vring or RPMsg channel
+ */
+#define MSS_VRING_DRIVER                0U
+#define MSS_VRING_DEVICE                1U
+#define MSS_RPMSG_HOST                  MSS_VRING_DRIVER
+#define MSS_RPMSG_REMOTE                MSS_VRING_DEVICE
+
+/*
+ * RPMsg
+ */
+#define MSS_RPMSG_HDR_BYTES             16U
+#define MSS_RPMSG_NS_ADDR               53U
+#define MSS_RPMSG_NS_NAME_BYTES         32U
+#define MSS_RPMSG_NS_CREATE             0U
+#define MSS_RPMSG_NS_DESTROY            1U
+
+typedef void (*mss_vring_notify_t)(void * arg);
+
+typedef struct
+{
+    uint64_t addr;
+    uint32_t len;
+    uint16_t flags;
+    uint16_t next;
+} mss_vring_desc_t;
+
+typedef struct
+{
+    uint16_t flags;
+    uint16_t idx;
+    uint16_t ring[];                /* then used_event */
+} mss_vring_avail_t;
+
+typedef struct
+{
+    uint32_t id;
+    uint32_t len;
+} mss_vring_used_elem_t;
+
+typedef struct
+{
+    uint16_t flags;
+    uint16_t idx;
+    mss_vring_used_elem_t ring[];   /* then avail_event */
+} mss_vring_used_t;
+
+typedef struct
+{
+    uint32_t num;
+    uint8_t side;
+    volatile mss_vring_desc_t * desc;
+    volatile mss_vring_avail_t * avail;
+    volatile mss_vring_used_t * used;
+    volatile uint16_t * used_event;     /* Written by the driver */
+    volatile uint16_t * avail_event;    /* Written by the device */
+    uint16_t last_idx;          /* Next used (driver) or available (device) */
+    uint16_t kicked_idx;        /* Index at the last notification */
+    uint16_t free_head;         /* Driver: free descriptors, chained */
+    uint16_t num_free;
+    mss_vring_notify_t notify;
+    void * notify_arg;
+} mss_vring_t;
+
+/*
+ * Arguments of mss_vring_doorbell_notify()
+ */
+typedef struct
+{
+    mss_doorbell_t * doorbell;
+    uint32_t hart_id;
+    uint64_t channels;
+} mss_vring_doorbell_t;
+
+typedef struct
+{
+    mss_vring_t rx;             /* Host: vring 0, remote: vring 1 */
+    mss_vring_t tx;             /* Host: vring 1, remote: vring 0 */
+    uint8_t * bufs;
+    uint32_t buf_bytes;
+    uint32_t tx_fresh;          /* Host: transmit buffers not used yet */
+} mss_rpmsg_t;
+
+/***************************************************************************//**
+ * mss_vring_size() returns the bytes of memory taken by a vring of num
+ * entries.
+ */
+uint64_t mss_vring_size(uint32_t num);
+
+/***************************************************************************//**
+ * mss_vring_init() sets up a vring of num entries, a power of two up to 32768,
+ * at mem, aligned to MSS_VRING_ALIGN, for one side. The driver side clears the
+ * rings and must initialise them before the device side does.
+ *
+ * @return
+ *   SUCCESS, or ERROR for an invalid number of entries or alignment.
+ */
+uint8_t mss_vring_init(mss_vring_t * vring, void * mem, uint32_t num,
+        uint8_t side, mss_vring_notify_t notify, void * notify_arg);
+
+/***************************************************************************//**
+ * mss_vring_add_buf() adds a buffer to the available ring, on the driver side,
+ * to be read by the device, or written if flags is MSS_VRING_DESC_F_WRITE.
+ *
+ * @return
+ *   SUCCESS, or ERROR if all the descriptors are in use.
+ */
+uint8_t mss_vring_add_buf(mss_vring_t * vring, uint64_t addr, uint32_t len,
+        uint16_t flags);
+
+/***************************************************************************//**
+ * mss_vring_get_used() takes back a buffer from the used ring, on the driver
+ * side, with the length written by the device.
+ *
+ * @return
+ *   SUCCESS, or ERROR if the used ring is empty.
+ */
+uint8_t mss_vring_get_used(mss_vring_t * vring, uint64_t * addr,
+        uint32_t * len);
+
+/***************************************************************************//**
+ * mss_vring_get_avail() takes a buffer from the available ring, on the device
+ * side. head is passed back to mss_vring_add_used().
+ *
+ * @return
+ *   SUCCESS, or ERROR if the available ring is empty.
+ */
+uint8_t mss_vring_get_avail(mss_vring_t * vring, uint16_t * head,
+        uint64_t * addr, uint32_t * len);
+
+/***************************************************************************//**
+ * mss_vring_add_used() returns a buffer to the driver through the used ring,
+ * on the device side, with the number of bytes written to it.
+ */
+void mss_vring_add_used(mss_vring_t * vring, uint16_t head, uint32_t len);
+
+/***************************************************************************//**
+ * mss_vring_kick() notifies the other side if it asked to be notified of the
+ * entries added since the last kick.
+ */
+void mss_vring_kick(mss_vring_t * vring);
+
+/***************************************************************************//**
+ * mss_vring_doorbell_notify() rings an mss_doorbell_t, given an
+ * mss_vring_doorbell_t, for the notify callback of mss_vring_init().
+ */
+void mss_vring_doorbell_notify(void * arg);
+
+/***************************************************************************//**
+ * mss_rpmsg_shared_size() returns the bytes of shared memory taken by an RPMsg
+ * channel: two vrings of num entries and 2 x num buffers of buf_bytes.
+ */
+uint64_t mss_rpmsg_shared_size(uint32_t num, uint32_t buf_bytes);
+
+/***************************************************************************//**
+ * mss_rpmsg_init() sets up one side of an RPMsg channel in shared memory. Both
+ * sides give the same number of entries and buffer size. buf_bytes is a
+ * multiple of 8, header included; Linux uses 512.
+ *
+ * @return
+ *   SUCCESS, or ERROR for invalid sizes.
+ */
+uint8_t mss_rpmsg_init(mss_rpmsg_t * rpmsg, void * shared, uint32_t num,
+        uint32_t buf_bytes, uint8_t side, mss_vring_notify_t notify,
+        void * notify_arg);
+
+/***************************************************************************//**
+ * mss_rpmsg_send() sends a message from endpoint src to endpoint dst, copying
+ * it into a free buffer, and notifies the other side if it is waiting.
+ *
+ * @return
+ *   SUCCESS, or ERROR if the message does not fit in a buffer or no buffer is
+ *   free, in which case it can be sent again later.
+ */
+uint8_t mss_rpmsg_send(mss_rpmsg_t * rpmsg, uint32_t src, uint32_t dst,
+        const void * data, uint32_t len);
+
+/***************************************************************************//**
+ * mss_rpmsg_recv() receives a message, copying up to *len bytes of it to data,
+ * and gives its buffer back. *len is set to the number of bytes copied.
+ *
+ * @return
+ *   SUCCESS, or ERROR if no message is waiting.
+ */
+uint8_t mss_rpmsg_recv(mss_rpmsg_t * rpmsg, uint32_t * src, uint32_t * dst,
+        void * data, uint32_t * len);
+
+/***************************************************************************//**
+ * mss_rpmsg_announce() sends the RPMsg name service message creating, or with
+ * MSS_RPMSG_NS_DESTROY destroying, an endpoint named name at addr.
+ */
+uint8_t mss_rpmsg_announce(mss_rpmsg_t * rpmsg, const char * name,
+        uint32_t addr, uint32_t flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_RPMSG_H */
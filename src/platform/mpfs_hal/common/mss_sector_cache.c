@@ -0,0 +1,365 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_sector_cache.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Sector cache shared by the block device drivers
+ *
+ */
+#include <stddef.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "mss_sector_cache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NO_LINE                         0xFFFFFFFFU
+
+static uint8_t *line_data(const mss_sector_cache_t *cache, uint32_t idx);
+static uint32_t find_line(const mss_sector_cache_t *cache, uint32_t sector);
+static uint8_t alloc_line(mss_sector_cache_t *cache, uint32_t sector,
+                          uint32_t *p_idx);
+static uint8_t fill_line(mss_sector_cache_t *cache, uint32_t sector,
+                         uint32_t *p_idx);
+static void touch_line(mss_sector_cache_t *cache, uint32_t idx);
+
+/*==============================================================================
+ * See mss_sector_cache.h for details of how to use this function.
+ */
+uint8_t mss_sector_cache_init(mss_sector_cache_t *cache,
+                              const mss_sector_cache_cfg_t *cfg)
+{
+    if((NULL == cache) || (NULL == cfg) || (NULL == cfg->read) ||
+       (NULL == cfg->write) || (NULL == cfg->region) || (NULL == cfg->lines) ||
+       (0U == cfg->line_count) || (0U == cfg->line_sectors))
+    {
+        return MSS_SECTOR_CACHE_ERROR;
+    }
+
+    cache->cfg = *cfg;
+    (void)memset(&cache->stats, 0, sizeof(cache->stats));
+    mss_sector_cache_invalidate(cache);
+
+    return MSS_SECTOR_CACHE_OK;
+}
+
+/*==============================================================================
+ * See mss_sector_cache.h for details of how to use this function.
+ */
+uint8_t mss_sector_cache_read(mss_sector_cache_t *cache, uint8_t *buf,
+                              uint32_t sector, uint32_t count)
+{
+    uint32_t line_sectors = cache->cfg.line_sectors;
+    uint32_t line_sector;
+    uint32_t offset;
+    uint32_t n;
+    uint32_t idx;
+    uint32_t ahead;
+    uint8_t sequential = (sector == cache->next_read) ? 1U : 0U;
+    uint8_t status = MSS_SECTOR_CACHE_OK;
+
+    while((0U != count) && (MSS_SECTOR_CACHE_OK == status))
+    {
+        offset = sector % line_sectors;
+        line_sector = sector - offset;
+        n = line_sectors - offset;
+        if(n > count)
+        {
+            n = count;
+        }
+
+        idx = find_line(cache, line_sector);
+        if(NO_LINE == idx)
+        {
+            status = fill_line(cache, line_sector, &idx);
+            cache->stats.misses++;
+        }
+        else
+        {
+            cache->stats.hits++;
+        }
+
+        if(MSS_SECTOR_CACHE_OK == status)
+        {
+            (void)mpfs_memcpy(buf,
+                         line_data(cache, idx) +
+                         (offset * MSS_SECTOR_CACHE_SECTOR_SIZE),
+                         n * MSS_SECTOR_CACHE_SECTOR_SIZE);
+            touch_line(cache, idx);
+            buf += n * MSS_SECTOR_CACHE_SECTOR_SIZE;
+            sector += n;
+            count -= n;
+        }
+    }
+
+    if(MSS_SECTOR_CACHE_OK == status)
+    {
+        cache->next_read = sector;
+
+        /*
+         * Sequential reader, fetch the lines following the one just read.
+         * A failed fetch, for example past the end of the device, only
+         * stops the read-ahead.
+         */
+        if(1U == sequential)
+        {
+            line_sector = (sector - 1U) - ((sector - 1U) % line_sectors);
+            ahead = 0U;
+            while(ahead < cache->cfg.readahead)
+            {
+                line_sector += line_sectors;
+                ahead++;
+                if(NO_LINE == find_line(cache, line_sector))
+                {
+                    if(MSS_SECTOR_CACHE_OK != fill_line(cache, line_sector,
+                                                        &idx))
+                    {
+                        ahead = cache->cfg.readahead;
+                    }
+                    else
+                    {
+                        touch_line(cache, idx);
+                        cache->stats.prefetches++;
+                    }
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
+/*==============================================================================
+ * See mss_sector_cache.h for details of how to use this function.
+ */
+uint8_t mss_sector_cache_write(mss_sector_cache_t *cache, const uint8_t *buf,
+                               uint32_t sector, uint32_t count)
+{
+    uint32_t line_sectors = cache->cfg.line_sectors;
+    uint32_t line_sector;
+    uint32_t offset;
+    uint32_t n;
+    uint32_t idx;
+    uint8_t status = MSS_SECTOR_CACHE_OK;
+
+    while((0U != count) && (MSS_SECTOR_CACHE_OK == status))
+    {
+        offset = sector % line_sectors;
+        line_sector = sector - offset;
+        n = line_sectors - offset;
+        if(n > count)
+        {
+            n = count;
+        }
+
+        idx = find_line(cache, line_sector);
+        if(NO_LINE == idx)
+        {
+            /* Only read the line first if part of it is kept */
+            if(n == line_sectors)
+            {
+                status = alloc_line(cache, line_sector, &idx);
+            }
+            else
+            {
+                status = fill_line(cache, line_sector, &idx);
+            }
+            cache->stats.misses++;
+        }
+        else
+        {
+            cache->stats.hits++;
+        }
+
+        if(MSS_SECTOR_CACHE_OK == status)
+        {
+            (void)mpfs_memcpy(line_data(cache, idx) +
+                         (offset * MSS_SECTOR_CACHE_SECTOR_SIZE),
+                         buf, n * MSS_SECTOR_CACHE_SECTOR_SIZE);
+            cache->cfg.lines[idx].dirty = 1U;
+            touch_line(cache, idx);
+            buf += n * MSS_SECTOR_CACHE_SECTOR_SIZE;
+            sector += n;
+            count -= n;
+        }
+    }
+
+    return status;
+}
+
+/*==============================================================================
+ * See mss_sector_cache.h for details of how to use this function.
+ */
+uint8_t mss_sector_cache_flush(mss_sector_cache_t *cache)
+{
+    mss_sector_cache_line_t *line;
+    uint32_t idx;
+    uint8_t status = MSS_SECTOR_CACHE_OK;
+
+    for(idx = 0U; idx < cache->cfg.line_count; idx++)
+    {
+        line = &cache->cfg.lines[idx];
+        if((1U == line->valid) && (1U == line->dirty))
+        {
+            if(0U == cache->cfg.write(line_data(cache, idx), line->sector,
+                                      cache->cfg.line_sectors))
+            {
+                line->dirty = 0U;
+                cache->stats.writebacks++;
+            }
+            else
+            {
+                status = MSS_SECTOR_CACHE_ERROR;
+            }
+        }
+    }
+
+    return status;
+}
+
+/*==============================================================================
+ * See mss_sector_cache.h for details of how to use this function.
+ */
+void mss_sector_cache_invalidate(mss_sector_cache_t *cache)
+{
+    uint32_t idx;
+
+    for(idx = 0U; idx < cache->cfg.line_count; idx++)
+    {
+        cache->cfg.lines[idx].sector = 0U;
+        cache->cfg.lines[idx].last_use = 0U;
+        cache->cfg.lines[idx].valid = 0U;
+        cache->cfg.lines[idx].dirty = 0U;
+    }
+
+    cache->use_count = 0U;
+    cache->next_read = NO_LINE;
+}
+
+/*==============================================================================
+ * Data of a line in the region.
+ */
+static uint8_t *line_data(const mss_sector_cache_t *cache, uint32_t idx)
+{
+    return cache->cfg.region +
+           (idx * cache->cfg.line_sectors * MSS_SECTOR_CACHE_SECTOR_SIZE);
+}
+
+/*==============================================================================
+ * Returns the line holding sector, or NO_LINE.
+ */
+static uint32_t find_line(const mss_sector_cache_t *cache, uint32_t sector)
+{
+    uint32_t idx;
+    uint32_t found = NO_LINE;
+
+    for(idx = 0U; (idx < cache->cfg.line_count) && (NO_LINE == found); idx++)
+    {
+        if((1U == cache->cfg.lines[idx].valid) &&
+           (sector == cache->cfg.lines[idx].sector))
+        {
+            found = idx;
+        }
+    }
+
+    return found;
+}
+
+/*==============================================================================
+ * Takes an empty line, or the least recently used one after writing it back
+ * if it is dirty, for sector. The line's data is not read.
+ */
+static uint8_t alloc_line(mss_sector_cache_t *cache, uint32_t sector,
+                          uint32_t *p_idx)
+{
+    mss_sector_cache_line_t *line;
+    uint32_t idx;
+    uint32_t victim = 0U;
+    uint8_t status = MSS_SECTOR_CACHE_OK;
+
+    for(idx = 0U; (idx < cache->cfg.line_count) &&
+                  (1U == cache->cfg.lines[victim].valid); idx++)
+    {
+        line = &cache->cfg.lines[idx];
+        if(0U == line->valid)
+        {
+            victim = idx;
+        }
+        else if((cache->use_count - line->last_use) >
+                (cache->use_count - cache->cfg.lines[victim].last_use))
+        {
+            victim = idx;
+        }
+        else
+        {
+            /* more recently used than the current victim */
+        }
+    }
+
+    line = &cache->cfg.lines[victim];
+    if((1U == line->valid) && (1U == line->dirty))
+    {
+        if(0U == cache->cfg.write(line_data(cache, victim), line->sector,
+                                  cache->cfg.line_sectors))
+        {
+            cache->stats.writebacks++;
+        }
+        else
+        {
+            status = MSS_SECTOR_CACHE_ERROR;
+        }
+    }
+
+    if(MSS_SECTOR_CACHE_OK == status)
+    {
+        line->sector = sector;
+        line->valid = 1U;
+        line->dirty = 0U;
+        *p_idx = victim;
+    }
+
+    return status;
+}
+
+/*==============================================================================
+ * Allocates a line for sector and reads it from the device.
+ */
+static uint8_t fill_line(mss_sector_cache_t *cache, uint32_t sector,
+                         uint32_t *p_idx)
+{
+    uint8_t status = alloc_line(cache, sector, p_idx);
+
+    if(MSS_SECTOR_CACHE_OK == status)
+    {
+        if(0U != cache->cfg.read(line_data(cache, *p_idx), sector,
+                                 cache->cfg.line_sectors))
+        {
+            cache->cfg.lines[*p_idx].valid = 0U;
+            status = MSS_SECTOR_CACHE_ERROR;
+        }
+    }
+
+    return status;
+}
+
+/*==============================================================================
+ * Marks a line as the most recently used.
+ */
+static void touch_line(mss_sector_cache_t *cache, uint32_t idx)
+{
+    cache->use_count++;
+    cache->cfg.lines[idx].last_use = cache->use_count;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_sector_cache.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Sector cache shared by the block device drivers
+ *
+ */
+#ifndef MSS_SECTOR_CACHE_H
+#define MSS_SECTOR_CACHE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==============================================================================
+ * Sector cache for block devices.
+ *
+ * The sector cache keeps recently used sectors of a block device in a memory
+ * region given by the application, for example in DDR or in the L2 cache
+ * scratchpad, so file systems do not fetch the same FAT and directory sectors
+ * from the device again and again. It is used with the eMMC/SD driver through
+ * MSS_MMC_sc_read() and MSS_MMC_sc_write(), and with the USB host mass storage
+ * class driver through MSS_USBH_MSC_sc_read() and MSS_USBH_MSC_sc_write(), or
+ * with any other driver which provides blocking read and write functions.
+ *
+ * The region is divided into lines of line_sectors sectors, each holding an
+ * aligned group of sectors of the device. Lines are replaced least recently
+ * used first.
+ *
+ * Read-ahead: when a read starts at the sector following the previous read,
+ * the next readahead lines after it are fetched as well, so a sequential
+ * reader finds its next sectors already in the cache.
+ *
+ * Write-back: writes only update the cache and mark the line dirty. Dirty
+ * lines are written to the device when they are replaced or when
+ * mss_sector_cache_flush() is called, which must be done before the device is
+ * removed or power is lost. A write which covers a whole line does not read
+ * the line from the device first.
+ *
+ * The device functions are called with buffers inside the region, so the
+ * region must be reachable by the driver's DMA. A cache must only be used
+ * from one context at a time, and the device must not be written other than
+ * through the cache while the cache is in use.
+ */
+
+#define MSS_SECTOR_CACHE_SECTOR_SIZE    512U
+
+#define MSS_SECTOR_CACHE_OK             0U
+#define MSS_SECTOR_CACHE_ERROR          1U
+
+/*
+ * Blocking device access functions. They return 0 on success and non-zero
+ * when the transfer failed.
+ */
+typedef uint8_t (*mss_sector_cache_read_t)(uint8_t *buf, uint32_t sector,
+                                           uint32_t count);
+typedef uint8_t (*mss_sector_cache_write_t)(const uint8_t *buf,
+                                            uint32_t sector, uint32_t count);
+
+/*
+ * Line tag. The application provides one per line.
+ */
+typedef struct
+{
+    uint32_t sector;        /* first sector held by the line */
+    uint32_t last_use;      /* value of use_count when last used */
+    uint8_t valid;
+    uint8_t dirty;
+} mss_sector_cache_line_t;
+
+typedef struct
+{
+    mss_sector_cache_read_t read;
+    mss_sector_cache_write_t write;
+    /* line_count * line_sectors * 512 bytes */
+    uint8_t *region;
+    mss_sector_cache_line_t *lines;
+    uint32_t line_count;
+    uint32_t line_sectors;
+    /* Number of lines fetched ahead of a sequential read, 0 to disable */
+    uint32_t readahead;
+} mss_sector_cache_cfg_t;
+
+typedef struct
+{
+    uint32_t hits;          /* lines found in the cache */
+    uint32_t misses;        /* lines read because of a miss */
+    uint32_t prefetches;    /* lines read ahead */
+    uint32_t writebacks;    /* dirty lines written to the device */
+} mss_sector_cache_stats_t;
+
+typedef struct
+{
+    mss_sector_cache_cfg_t cfg;
+    uint32_t use_count;
+    /* Sector following the previous read */
+    uint32_t next_read;
+    mss_sector_cache_stats_t stats;
+} mss_sector_cache_t;
+
+/*==============================================================================
+ * Sets up a cache and marks all its lines empty. Returns MSS_SECTOR_CACHE_OK,
+ * or MSS_SECTOR_CACHE_ERROR if the configuration is not valid.
+ *
+ * Example, a cache of 32 lines of 4KB in DDR for an eMMC device:
+ *
+ *    static uint8_t g_sc_region[32U * 4096U] __attribute__((aligned(64)));
+ *    static mss_sector_cache_line_t g_sc_lines[32];
+ *    static mss_sector_cache_t g_sc;
+ *
+ *    mss_sector_cache_cfg_t cfg;
+ *
+ *    cfg.read = MSS_MMC_sc_read;
+ *    cfg.write = MSS_MMC_sc_write;
+ *    cfg.region = g_sc_region;
+ *    cfg.lines = g_sc_lines;
+ *    cfg.line_count = 32U;
+ *    cfg.line_sectors = 8U;
+ *    cfg.readahead = 2U;
+ *    (void)mss_sector_cache_init(&g_sc, &cfg);
+ */
+uint8_t mss_sector_cache_init(mss_sector_cache_t *cache,
+                              const mss_sector_cache_cfg_t *cfg);
+
+/*==============================================================================
+ * Reads count sectors starting at sector into buf, from the cache where
+ * possible.
+ */
+uint8_t mss_sector_cache_read(mss_sector_cache_t *cache, uint8_t *buf,
+                              uint32_t sector, uint32_t count);
+
+/*==============================================================================
+ * Writes count sectors starting at sector from buf into the cache. The data
+ * reaches the device when the lines are replaced or flushed.
+ */
+uint8_t mss_sector_cache_write(mss_sector_cache_t *cache, const uint8_t *buf,
+                               uint32_t sector, uint32_t count);
+
+/*==============================================================================
+ * Writes all dirty lines to the device. Lines which could not be written stay
+ * dirty and MSS_SECTOR_CACHE_ERROR is returned.
+ */
+uint8_t mss_sector_cache_flush(mss_sector_cache_t *cache);
+
+/*==============================================================================
+ * Marks all lines empty without writing them back, for example after the
+ * device has been replaced. Call mss_sector_cache_flush() first to keep the
+ * writes held in the cache.
+ */
+void mss_sector_cache_invalidate(mss_sector_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_SECTOR_CACHE_H */
@@ -0,0 +1,418 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_smode.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Supervisor mode execution of the U54 application harts
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MPFS_HAL_SMODE_APP
+
+#define SMODE_NUM_HARTS             5U
+
+#define SMODE_MIDELEG               (MIP_SSIP | MIP_STIP | MIP_SEIP)
+#define SMODE_MEDELEG               ((1UL << CAUSE_MISALIGNED_FETCH) | \
+                                     (1UL << CAUSE_BREAKPOINT) | \
+                                     (1UL << CAUSE_USER_ECALL) | \
+                                     (1UL << CAUSE_FETCH_PAGE_FAULT) | \
+                                     (1UL << CAUSE_LOAD_PAGE_FAULT) | \
+                                     (1UL << CAUSE_STORE_PAGE_FAULT))
+
+/* mcounteren CY and IR */
+#define SMODE_MCOUNTEREN            0x5UL
+
+#define SMODE_PMP_CFG               (PMP_NAPOT | PMP_R | PMP_W | PMP_X)
+#define SMODE_PMP_SHIFT             ((MSS_SMODE_PMP_ENTRY - 8U) * 8U)
+
+#define ECALL_LENGTH                4U
+
+extern void strap_vector(void);
+extern uint8_t (*ext_irq_handler_table[PLIC_NUM_SOURCES])(void);
+
+static volatile uint8_t g_smode_active[SMODE_NUM_HARTS];
+static void (* volatile g_smode_entry[SMODE_NUM_HARTS])(void);
+
+static void smode_start(void);
+static void smode_pmp_open(void);
+static volatile uint32_t * smode_plic_enables(uint64_t hart_id);
+static void smode_ext_interrupt(void);
+static void smode_bad_trap(uintptr_t scause);
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+void mss_smode_enter(void (*entry)(void))
+{
+    uint64_t hart_id = read_csr(mhartid);
+
+    if ((0U == hart_id) || (hart_id >= SMODE_NUM_HARTS))
+    {
+        /* The E51 has no S mode */
+        entry();
+    }
+    else
+    {
+        g_smode_entry[hart_id] = entry;
+
+        smode_pmp_open();
+
+        write_csr(satp, 0U);
+        write_csr(mcounteren, SMODE_MCOUNTEREN);
+        write_csr(sscratch, hart_id);
+        write_csr(stvec, (uintptr_t)&strap_vector);
+        write_csr(mideleg, SMODE_MIDELEG);
+        write_csr(medeleg, SMODE_MEDELEG);
+
+        PLIC->TARGET[plic_hart_lookup[hart_id] + 1U].PRIORITY_THRESHOLD = 0U;
+
+        write_csr(sie, SMODE_MIDELEG);
+        clear_csr(mie, MIP_MTIP);
+        set_csr(mie, MIP_MSIP);
+
+        g_smode_active[hart_id] = 1U;
+
+        clear_csr(mstatus, MSTATUS_MPP);
+        set_csr(mstatus, (uintptr_t)PRV_S << 11U);
+        write_csr(mepc, (uintptr_t)&smode_start);
+
+        __asm volatile ("mret" ::: "memory");
+    }
+
+    while (1)
+    {
+        static volatile uint64_t counter = 0U;
+        /* Added some code as debugger hangs if in loop doing nothing */
+        counter = counter + 1U;
+    }
+}
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+uint8_t mss_smode_is_active(uint64_t hart_id)
+{
+    uint8_t active = 0U;
+
+    if (hart_id < SMODE_NUM_HARTS)
+    {
+        active = g_smode_active[hart_id];
+    }
+
+    return (active);
+}
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+uint64_t mss_smode_hart_id(void)
+{
+    return (read_csr(sscratch));
+}
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+void mss_smode_enable_irq(void)
+{
+    set_csr(sstatus, SSTATUS_SIE);
+}
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+void mss_smode_disable_irq(void)
+{
+    clear_csr(sstatus, SSTATUS_SIE);
+}
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+void mss_smode_set_timer(uint64_t deadline)
+{
+    register uintptr_t a0 __asm("a0") = (uintptr_t)deadline;
+    register uintptr_t a7 __asm("a7") = MSS_SMODE_ECALL_SET_TIMER;
+
+    __asm volatile ("ecall" : "+r"(a0) : "r"(a7) : "memory");
+
+    set_csr(sie, MIP_STIP);
+}
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+void mss_smode_send_ipi(uint32_t hart_mask)
+{
+    uint32_t hart_id;
+
+    for (hart_id = 1U; hart_id < SMODE_NUM_HARTS; hart_id++)
+    {
+        if (0U != (hart_mask & (1U << hart_id)))
+        {
+            CLINT->MSIP[hart_id] = 0x01U;
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+void mss_smode_plic_enable_irq(uint32_t irq)
+{
+    volatile uint32_t * enables = smode_plic_enables(mss_smode_hart_id());
+
+    if (((volatile uint32_t *)0 != enables) && (irq < PLIC_NUM_SOURCES))
+    {
+        enables[irq / 32U] |= (uint32_t)1U << (irq % 32U);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+void mss_smode_plic_disable_irq(uint32_t irq)
+{
+    volatile uint32_t * enables = smode_plic_enables(mss_smode_hart_id());
+
+    if (((volatile uint32_t *)0 != enables) && (irq < PLIC_NUM_SOURCES))
+    {
+        enables[irq / 32U] &= ~((uint32_t)1U << (irq % 32U));
+    }
+}
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+__attribute__((weak)) void mss_smode_soft_handler(void)
+{
+    return;
+}
+
+/***************************************************************************//**
+ * See mss_smode.h
+ */
+__attribute__((weak)) void mss_smode_timer_handler(void)
+{
+    return;
+}
+
+/***************************************************************************//**
+ * Handles an ecall from S mode, in M mode. The function number is in a7, the
+ * argument in a0 and the result goes back in a0, through the saved context.
+ */
+void mss_smode_ecall(uintptr_t * regs, uintptr_t mepc)
+{
+    uint64_t hart_id = read_csr(mhartid);
+
+    switch (regs[17])
+    {
+        case MSS_SMODE_ECALL_SET_TIMER:
+            CLINT->MTIMECMP[hart_id] = (uint64_t)regs[10];
+            clear_csr(mip, MIP_STIP);
+            set_csr(mie, MIP_MTIP);
+            regs[10] = SUCCESS;
+            break;
+
+        default:
+            regs[10] = ERROR;
+            break;
+    }
+
+    write_csr(mepc, mepc + ECALL_LENGTH);
+}
+
+/***************************************************************************//**
+ * Called by the M timer interrupt handler. If the hart runs in S mode, masks
+ * the M timer interrupt, raises the S one and returns 1.
+ */
+uint8_t mss_smode_forward_timer(void)
+{
+    uint8_t forwarded = mss_smode_is_active(read_csr(mhartid));
+
+    if (0U != forwarded)
+    {
+        clear_csr(mie, MIP_MTIP);
+        set_csr(mip, MIP_STIP);
+    }
+
+    return (forwarded);
+}
+
+/***************************************************************************//**
+ * Called by the M software interrupt handler. If the hart runs in S mode,
+ * clears MSIP, raises the S software interrupt and returns 1.
+ */
+uint8_t mss_smode_forward_soft(void)
+{
+    uint8_t forwarded = mss_smode_is_active(read_csr(mhartid));
+
+    if (0U != forwarded)
+    {
+        clear_soft_interrupt();
+        set_csr(mip, MIP_SSIP);
+    }
+
+    return (forwarded);
+}
+
+/***************************************************************************//**
+ * S mode trap handler, called from strap_vector in mss_entry.S.
+ */
+void trap_from_supervisor_mode(uintptr_t * regs, uintptr_t stval,
+        uintptr_t sepc)
+{
+    uintptr_t scause = read_csr(scause);
+
+    (void)regs;
+    (void)stval;
+    (void)sepc;
+
+    if ((scause & MCAUSE_INT) == MCAUSE_INT)
+    {
+        switch (scause & MCAUSE_CAUSE)
+        {
+            case IRQ_S_SOFT:
+                clear_csr(sip, SIP_SSIP);
+                mss_smode_soft_handler();
+                break;
+
+            case IRQ_S_TIMER:
+                clear_csr(sie, MIP_STIP);
+                mss_smode_timer_handler();
+                break;
+
+            case IRQ_S_EXT:
+                smode_ext_interrupt();
+                break;
+
+            default:
+                smode_bad_trap(scause);
+                break;
+        }
+    }
+    else
+    {
+        smode_bad_trap(scause);
+    }
+}
+
+/***************************************************************************//**
+ * First S mode code of the hart
+ */
+static void smode_start(void)
+{
+    g_smode_entry[mss_smode_hart_id()]();
+
+    while (1)
+    {
+        static volatile uint64_t counter = 0U;
+        /* Added some code as debugger hangs if in loop doing nothing */
+        counter = counter + 1U;
+    }
+}
+
+/***************************************************************************//**
+ * Sets PMP entry 15 to all of memory, read, write and execute, unless locked
+ */
+static void smode_pmp_open(void)
+{
+    uint64_t cfg2 = read_csr(pmpcfg2);
+
+    if (0U == ((cfg2 >> SMODE_PMP_SHIFT) & PMP_L))
+    {
+        write_csr(pmpaddr15, ~(uint64_t)0U);
+        cfg2 &= ~((uint64_t)0xFFU << SMODE_PMP_SHIFT);
+        cfg2 |= (uint64_t)SMODE_PMP_CFG << SMODE_PMP_SHIFT;
+        write_csr(pmpcfg2, cfg2);
+    }
+}
+
+/***************************************************************************//**
+ * Returns the S mode enables of a hart in the PLIC
+ */
+static volatile uint32_t * smode_plic_enables(uint64_t hart_id)
+{
+    volatile uint32_t * enables = (volatile uint32_t *)0;
+
+    switch (hart_id)
+    {
+        case 1U:
+            enables = PLIC->HART1_SMODE_ENA;
+            break;
+        case 2U:
+            enables = PLIC->HART2_SMODE_ENA;
+            break;
+        case 3U:
+            enables = PLIC->HART3_SMODE_ENA;
+            break;
+        case 4U:
+            enables = PLIC->HART4_SMODE_ENA;
+            break;
+        default:
+            break;
+    }
+
+    return (enables);
+}
+
+/***************************************************************************//**
+ * Services the pending external interrupts of the S mode context of the hart
+ */
+static void smode_ext_interrupt(void)
+{
+    volatile IRQ_Target_Type * target =
+            &PLIC->TARGET[plic_hart_lookup[mss_smode_hart_id()] + 1U];
+    uint32_t int_num = target->CLAIM_COMPLETE;
+    uint8_t disable;
+
+    while (INVALID_IRQn != int_num)
+    {
+        disable = ext_irq_handler_table[int_num]();
+
+        target->CLAIM_COMPLETE = int_num;
+
+        if (EXT_IRQ_DISABLE == disable)
+        {
+            mss_smode_plic_disable_irq(int_num);
+        }
+
+        int_num = target->CLAIM_COMPLETE;
+    }
+}
+
+/***************************************************************************//**
+ * Unexpected S mode trap, wait for the watchdog
+ */
+static void smode_bad_trap(uintptr_t scause)
+{
+    volatile uintptr_t cause = scause;
+    uint32_t i = 0U;
+
+    while (1)
+    {
+        i++;        /* added some code as SC debugger hangs if in loop doing nothing */
+        if (i == 0x1000U)
+        {
+            i = (uint32_t)cause;    /* so scause is not optimised out */
+        }
+    }
+}
+
+#endif /* MPFS_HAL_SMODE_APP */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_smode.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Supervisor mode execution of the U54 application harts
+ *
+ * With MPFS_HAL_SMODE_APP defined, main_other_hart() starts u54_1() to u54_4()
+ * in S mode rather than M mode, through mss_smode_enter(). Their interrupts
+ * are then taken in S mode by strap_vector and trap_from_supervisor_mode(),
+ * without going through the M mode trap handler, and the harts can later be
+ * given virtual memory through satp.
+ *
+ * Before switching, mss_smode_enter():
+ *  - gives S mode access to all of memory through PMP entry 15, unless the
+ *    Libero settings have locked it, so the PMP entries set up from Libero and
+ *    by mss_pmp_region.h still apply in front of it,
+ *  - delegates the S software, timer and external interrupts, and the
+ *    misaligned fetch, breakpoint, U mode ecall and page fault exceptions.
+ *    Illegal instructions and misaligned loads and stores stay in M mode,
+ *    for MPFS_HAL_FPU_LAZY and MPFS_HAL_EMULATE_MISALIGNED,
+ *  - opens the S mode context of the hart in the PLIC, threshold 0,
+ *  - lets S mode read cycle and instret.
+ *
+ * The U54 cannot delegate its M timer and software interrupts, as the CLINT
+ * only raises M level ones. The M mode handlers forward them instead:
+ *  - mss_smode_set_timer() asks M mode, through an ecall, to set mtimecmp.
+ *    When it is reached, M mode masks its timer interrupt and raises the S
+ *    timer interrupt. It stays pending until the next mss_smode_set_timer(),
+ *    so the S handler masks it in sie and mss_smode_set_timer() unmasks it.
+ *  - mss_smode_send_ipi() writes the CLINT MSIP registers; the M software
+ *    interrupt clears MSIP and raises the S software interrupt.
+ * Each costs a short M mode trap on top of the S one. External interrupts
+ * are enabled in the S context of the PLIC with mss_smode_plic_enable_irq()
+ * and go directly to S mode, using the handlers of ext_irq_handler_table.
+ *
+ * Code running in S mode cannot access the M mode CSRs. It must use the
+ * functions here rather than __enable_irq(), PLIC_EnableIRQ(),
+ * PLIC_ClaimIRQ(), readmcycle() and the other HAL functions which read
+ * mhartid or mstatus, and the software timers, the system tick and the PC
+ * profiler of mss_sw_timer.h, mss_clint.h and mss_pc_profile.h are not
+ * available on the hart. The hart ID is held in sscratch. Traps taken in M
+ * mode, e.g. the forwarded interrupts and the emulated misaligned accesses,
+ * run on the S mode stack, which is a full integer context deep at most.
+ */
+#ifndef MSS_SMODE_H
+#define MSS_SMODE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MPFS_HAL_SMODE_APP
+
+/*
+ * ecall function numbers, in a7
+ */
+#define MSS_SMODE_ECALL_SET_TIMER       0U
+
+/*
+ * PMP entry giving S mode access to all of memory
+ */
+#define MSS_SMODE_PMP_ENTRY             15U
+
+/***************************************************************************//**
+ * mss_smode_enter() switches the calling U54 to S mode and calls entry. It is
+ * called in M mode, with the stack of the application, and does not return.
+ * Should entry return, the hart waits in a loop.
+ */
+void mss_smode_enter(void (*entry)(void));
+
+/***************************************************************************//**
+ * mss_smode_is_active() returns 1 if the hart runs its application in S mode.
+ * Can be called in M mode only.
+ */
+uint8_t mss_smode_is_active(uint64_t hart_id);
+
+/***************************************************************************//**
+ * mss_smode_hart_id() returns the ID of the calling hart, in S mode.
+ */
+uint64_t mss_smode_hart_id(void);
+
+/***************************************************************************//**
+ * mss_smode_enable_irq() and mss_smode_disable_irq() enable and disable the S
+ * mode interrupts of the calling hart through sstatus.SIE. The software,
+ * timer and external interrupts are enabled in sie by mss_smode_enter().
+ */
+void mss_smode_enable_irq(void);
+void mss_smode_disable_irq(void);
+
+/***************************************************************************//**
+ * mss_smode_set_timer() raises the S timer interrupt of the calling hart when
+ * mtime reaches deadline, replacing any earlier deadline.
+ */
+void mss_smode_set_timer(uint64_t deadline);
+
+/***************************************************************************//**
+ * mss_smode_send_ipi() raises the S software interrupt of each hart whose bit
+ * is set in hart_mask, bit 0 for hart 0. The harts must run in S mode.
+ */
+void mss_smode_send_ipi(uint32_t hart_mask);
+
+/***************************************************************************//**
+ * mss_smode_plic_enable_irq() and mss_smode_plic_disable_irq() enable and
+ * disable an external interrupt in the S mode context of the calling hart.
+ * The source must not also be enabled in an M mode context.
+ */
+void mss_smode_plic_enable_irq(uint32_t irq);
+void mss_smode_plic_disable_irq(uint32_t irq);
+
+/***************************************************************************//**
+ * The S software and timer interrupt handlers, weak so the application can
+ * provide them. The timer interrupt is masked in sie when its handler is
+ * called.
+ */
+void mss_smode_soft_handler(void);
+void mss_smode_timer_handler(void);
+
+/***************************************************************************//**
+ * Called from the M mode trap handlers, see mss_smode.c.
+ */
+void mss_smode_ecall(uintptr_t * regs, uintptr_t mepc);
+uint8_t mss_smode_forward_timer(void);
+uint8_t mss_smode_forward_soft(void);
+
+#endif /* MPFS_HAL_SMODE_APP */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_SMODE_H */
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_stack.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Stack and HLS high water marks
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+#include "mpfs_hal/startup_gcc/system_startup_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MPFS_HAL_STACK_WATERMARK) && defined(MPFS_HAL_HW_CONFIG)
+
+#define STACK_NUM_HARTS             (MPFS_HAL_LAST_HART + 1U)
+/* Space kept below the stack pointer when painting the stack in use */
+#define STACK_PAINT_MARGIN          256U
+
+extern char __app_stack_bottom_h0;
+extern char __app_stack_bottom_h1;
+extern char __app_stack_bottom_h2;
+extern char __app_stack_bottom_h3;
+extern char __app_stack_bottom_h4;
+extern char __app_stack_top_h0;
+extern char __app_stack_top_h1;
+extern char __app_stack_top_h2;
+extern char __app_stack_top_h3;
+extern char __app_stack_top_h4;
+
+/*
+ * Bottom and top of the stacks of each hart, the HLS and the area kept at the
+ * top of the application stack by main_other_hart() excluded
+ */
+static uintptr_t const g_stack_bottom[2][5] =
+{
+    {
+        (uintptr_t)&__stack_bottom_h0$, (uintptr_t)&__stack_bottom_h1$,
+        (uintptr_t)&__stack_bottom_h2$, (uintptr_t)&__stack_bottom_h3$,
+        (uintptr_t)&__stack_bottom_h4$
+    },
+    {
+        (uintptr_t)&__app_stack_bottom_h0, (uintptr_t)&__app_stack_bottom_h1,
+        (uintptr_t)&__app_stack_bottom_h2, (uintptr_t)&__app_stack_bottom_h3,
+        (uintptr_t)&__app_stack_bottom_h4
+    }
+};
+
+static uintptr_t const g_stack_top[2][5] =
+{
+    {
+        (uintptr_t)&__stack_top_h0$, (uintptr_t)&__stack_top_h1$,
+        (uintptr_t)&__stack_top_h2$, (uintptr_t)&__stack_top_h3$,
+        (uintptr_t)&__stack_top_h4$
+    },
+    {
+        (uintptr_t)&__app_stack_top_h0, (uintptr_t)&__app_stack_top_h1,
+        (uintptr_t)&__app_stack_top_h2, (uintptr_t)&__app_stack_top_h3,
+        (uintptr_t)&__app_stack_top_h4
+    }
+};
+
+/***************************************************************************//**
+ * See mss_stack.h
+ */
+void mss_stack_paint_app(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uintptr_t sp;
+    uintptr_t end;
+    volatile uint64_t * word;
+
+    if (hart_id < STACK_NUM_HARTS)
+    {
+        __asm volatile ("mv %0, sp" : "=r"(sp));
+
+        word = (volatile uint64_t *)g_stack_bottom[MSS_STACK_APP][hart_id];
+        end = g_stack_top[MSS_STACK_APP][hart_id] - HLS_DEBUG_AREA_SIZE;
+
+        /* Both stacks may be in the same memory, keep clear of the frames in
+           use */
+        if ((sp > (uintptr_t)word) && (sp <= (end + HLS_DEBUG_AREA_SIZE)) &&
+            ((sp - STACK_PAINT_MARGIN) < end))
+        {
+            end = sp - STACK_PAINT_MARGIN;
+        }
+
+        while ((uintptr_t)word < end)
+        {
+            *word = MSS_STACK_PAINT_WORD;
+            word++;
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_stack.h
+ */
+uint8_t mss_stack_get_usage
+(
+    uint64_t hart_id,
+    uint8_t stack,
+    mss_stack_usage_t * usage
+)
+{
+    uint8_t result = ERROR;
+    const volatile uint64_t * word;
+
+    if ((hart_id < STACK_NUM_HARTS) && (stack <= MSS_STACK_APP))
+    {
+        usage->bottom = g_stack_bottom[stack][hart_id];
+        usage->top = g_stack_top[stack][hart_id] - HLS_DEBUG_AREA_SIZE;
+
+        /* The stacks grow down, so the paint left is at the bottom */
+        word = (const volatile uint64_t *)usage->bottom;
+
+        while (((uintptr_t)word < usage->top) &&
+               (MSS_STACK_PAINT_WORD == *word))
+        {
+            word++;
+        }
+
+        usage->used = usage->top - (uintptr_t)word;
+        result = SUCCESS;
+    }
+
+    return (result);
+}
+
+/***************************************************************************//**
+ * See mss_stack.h
+ */
+uint64_t mss_stack_hls_used(uint64_t hart_id)
+{
+    uint64_t used = 0U;
+    const volatile uint64_t * word;
+    uintptr_t hls;
+
+    if (hart_id < STACK_NUM_HARTS)
+    {
+        hls = g_stack_top[MSS_STACK_STARTUP][hart_id] - HLS_DEBUG_AREA_SIZE;
+
+        /* The HLS grows up from the bottom of its area */
+        for (word = (const volatile uint64_t *)hls;
+             (uintptr_t)word < g_stack_top[MSS_STACK_STARTUP][hart_id]; word++)
+        {
+            if (0U != *word)
+            {
+                used = ((uintptr_t)word + sizeof(uint64_t)) - hls;
+            }
+        }
+    }
+
+    return (used);
+}
+
+/***************************************************************************//**
+ * See mss_stack.h
+ */
+void mss_stack_report(mss_uart_instance_t * uart)
+{
+    uint64_t hart_id;
+    uint8_t stack;
+    mss_stack_usage_t usage;
+
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)
+            "\n\r hart stack    size     used");
+
+    for (hart_id = 0U; hart_id < STACK_NUM_HARTS; hart_id++)
+    {
+        for (stack = MSS_STACK_STARTUP; stack <= MSS_STACK_APP; stack++)
+        {
+            (void)mss_stack_get_usage(hart_id, stack, &usage);
+
+            mss_print_hex(uart, "\n\r ", hart_id, 1U);
+            MSS_UART_polled_tx_string(uart, (MSS_STACK_STARTUP == stack) ?
+                    (const uint8_t *)"    startup " :
+                    (const uint8_t *)"    app     ");
+            mss_print_hex(uart, "", usage.top - usage.bottom, 8U);
+            mss_print_hex(uart, " ", usage.used, 8U);
+        }
+
+        mss_print_hex(uart, "\n\r ", hart_id, 1U);
+        mss_print_hex(uart, "    hls     ", HLS_DEBUG_AREA_SIZE, 8U);
+        mss_print_hex(uart, " ", mss_stack_hls_used(hart_id), 8U);
+    }
+}
+
+#endif /* MPFS_HAL_STACK_WATERMARK && MPFS_HAL_HW_CONFIG */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_stack.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Stack and HLS high water marks
+ *
+ * When MPFS_HAL_STACK_WATERMARK is defined in mss_sw_config.h, the stacks of
+ * the harts are painted with MSS_STACK_PAINT_WORD before they are used, so
+ * that the deepest point each stack has reached can be found at any time by
+ * looking for the lowest word no longer holding the paint:
+ *  - the start-up stack of each hart, __stack_bottom_hN$ to __stack_top_hN$
+ *    less the HLS at its top, is painted by mss_entry.S in place of being
+ *    cleared,
+ *  - the application stack, __app_stack_bottom_hN to __app_stack_top_hN
+ *    less HLS_DEBUG_AREA_SIZE, is painted by main_other_hart() below its own
+ *    stack pointer before it moves the hart to it.
+ * The linker scripts may place both stacks of a hart in the same memory, in
+ * which case the two report the same use.
+ *
+ * The HAL has no separate trap stack: the interrupt and exception handlers
+ * run on the stack of the code they interrupt, so their frames, nested
+ * interrupts included, are part of the high water mark of that stack.
+ *
+ * The HLS of each hart, at the top of its start-up stack, is cleared at
+ * start-up. Its high water mark is the end of the last word which is no
+ * longer zero.
+ *
+ * A word of the stack written with the paint value is taken as unused, so the
+ * high water mark is, very rarely, lower than the real use. Leave a margin
+ * when sizing the stacks from it.
+ *
+ * Only for images run from reset, MPFS_HAL_HW_CONFIG defined.
+ *
+ * Example:
+ * @code
+ *   mss_stack_report(&g_mss_uart0_lo);
+ * @endcode
+ */
+#ifndef MSS_STACK_H
+#define MSS_STACK_H
+
+#include <stdint.h>
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Stacks of a hart
+ */
+#define MSS_STACK_STARTUP               0U
+#define MSS_STACK_APP                   1U
+
+typedef struct
+{
+    uintptr_t bottom;
+    uintptr_t top;              /* Initial stack pointer */
+    uint64_t used;              /* Bytes below top ever written */
+} mss_stack_usage_t;
+
+/***************************************************************************//**
+ * mss_stack_paint_app() paints the application stack of the calling hart up
+ * to just below its stack pointer. It is called by main_other_hart().
+ */
+void mss_stack_paint_app(void);
+
+/***************************************************************************//**
+ * mss_stack_get_usage() gives the size and the high water mark of a stack,
+ * MSS_STACK_STARTUP or MSS_STACK_APP, of a hart. It returns SUCCESS, or ERROR
+ * when the hart or the stack is out of range.
+ */
+uint8_t mss_stack_get_usage
+(
+    uint64_t hart_id,
+    uint8_t stack,
+    mss_stack_usage_t * usage
+);
+
+/***************************************************************************//**
+ * mss_stack_hls_used() returns the number of bytes of the HLS of a hart ever
+ * written, out of HLS_DEBUG_AREA_SIZE.
+ */
+uint64_t mss_stack_hls_used(uint64_t hart_id);
+
+/***************************************************************************//**
+ * mss_stack_report() prints the size and the high water mark in bytes of each
+ * stack and HLS of the harts up to MPFS_HAL_LAST_HART, in hexadecimal.
+ */
+void mss_stack_report(mss_uart_instance_t * uart);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_STACK_H */
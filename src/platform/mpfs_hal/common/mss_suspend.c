@@ -0,0 +1,451 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_suspend.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Suspend to DDR self-refresh and fast resume
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef DDR_SELF_REFRESH_RESUME
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SUSPEND_RECORD      ((mss_suspend_record_t *)MSS_SUSPEND_RECORD_ADDR)
+
+/*
+ * Size of the enables block of each PLIC context
+ */
+#define PLIC_ENABLES_STRIDE     (0x80U / 4U)
+
+/*
+ * In mss_utils.S
+ */
+uint64_t mss_suspend_save_context(mss_suspend_context_t * p_context)
+    __attribute__((returns_twice));
+void mss_suspend_restore_context(const mss_suspend_context_t * p_context)
+    __attribute__((noreturn));
+
+static void save_hart(mss_suspend_hart_t * p_hart, uint64_t hart_id);
+static void restore_hart(const mss_suspend_hart_t * p_hart, uint64_t hart_id);
+static uint8_t hart_resumed(const mss_suspend_hart_t * p_hart);
+static void suspend_system(mss_suspend_record_t * p_record,\
+        mss_suspend_hart_t * p_hart) __attribute__((noinline));
+static void ddr_self_refresh_power_down(void) MSS_SUSPEND_TEXT\
+        __attribute__((noinline));
+static uint32_t record_checksum(const mss_suspend_record_t * p_record);
+
+/*
+ * Set by mss_resume_check() in the boot image when the system is resuming
+ */
+static volatile uint8_t g_resuming = 0U;
+
+/***************************************************************************//**
+ * See mss_suspend.h
+ */
+uint8_t mss_suspend_hart(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    mss_suspend_hart_t * p_hart = &SUSPEND_RECORD->hart[hart_id];
+
+    save_hart(p_hart, hart_id);
+
+    if (0U == mss_suspend_save_context(&p_hart->context))
+    {
+        p_hart->saved = MSS_SUSPEND_HART_SAVED;
+        mb();
+        park_hart();
+    }
+
+    return (hart_resumed(p_hart));
+}
+
+/***************************************************************************//**
+ * See mss_suspend.h
+ */
+uint8_t mss_suspend(uint32_t hart_mask)
+{
+    mss_suspend_record_t * p_record = SUSPEND_RECORD;
+    uint64_t hart_id = read_csr(mhartid);
+    mss_suspend_hart_t * p_hart = &p_record->hart[hart_id];
+    uint64_t start = readmtime();
+    uint32_t waiting = hart_mask & ~(1UL << hart_id);
+    uint32_t hart;
+    uint32_t inc;
+    uint32_t reg;
+    uint8_t ret_val = MSS_SUSPEND_ERROR;
+
+    while ((0U != waiting) && ((readmtime() - start) < MSS_SUSPEND_TIMEOUT))
+    {
+        for (hart = 0U; hart < MSS_SUSPEND_NUM_HARTS; hart++)
+        {
+            if ((0U != (waiting & (1UL << hart))) &&
+                (MSS_SUSPEND_HART_SAVED ==
+                    *(volatile uint32_t *)&p_record->hart[hart].saved))
+            {
+                waiting &= ~(1UL << hart);
+            }
+        }
+    }
+
+    if ((0U == waiting) && (0ULL == mss_l2_get_locked_ways()))
+    {
+        p_record->hart_mask = hart_mask | (1UL << hart_id);
+
+        for (inc = 0U; inc < PLIC_NUM_SOURCES; inc++)
+        {
+            p_record->plic_priority[inc] = PLIC->SOURCE_PRIORITY[inc];
+        }
+
+        for (inc = 0U; inc < NUM_CLAIM_REGS; inc++)
+        {
+            volatile uint32_t * p_enables =
+                &PLIC->HART0_MMODE_ENA[0] + (inc * PLIC_ENABLES_STRIDE);
+
+            for (reg = 0U; reg < PLIC_SET_UP_REGISTERS; reg++)
+            {
+                p_record->plic_enable[inc][reg] = p_enables[reg];
+            }
+            p_record->plic_threshold[inc] = PLIC->TARGET[inc].PRIORITY_THRESHOLD;
+        }
+
+        for (inc = 0U; inc < (uint32_t)L2_NUM_MASTERS; inc++)
+        {
+            p_record->l2_way_mask[inc] =
+                    mss_l2_get_way_mask((mss_l2_master_t)inc);
+        }
+
+        save_hart(p_hart, hart_id);
+
+        if (0U == mss_suspend_save_context(&p_hart->context))
+        {
+            /* Only returns if the power was not removed */
+            suspend_system(p_record, p_hart);
+            ret_val = MSS_SUSPEND_ERROR;
+        }
+        else
+        {
+            ret_val = hart_resumed(p_hart);
+        }
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * See mss_suspend.h
+ */
+uint8_t mss_resume_pending(void)
+{
+    uint8_t pending = 0U;
+
+    if (MSS_RESUME_FLAG == mss_resume_flag_read())
+    {
+        pending = 1U;
+    }
+
+    return (pending);
+}
+
+/***************************************************************************//**
+ * See mss_suspend.h
+ */
+uint8_t mss_resume_check(void)
+{
+    mss_suspend_record_t * p_record = SUSPEND_RECORD;
+    uint32_t hart;
+    uint32_t inc;
+    uint32_t reg;
+
+    g_resuming = 0U;
+
+    if (1U == mss_resume_pending())
+    {
+        /* Whatever happens next, a reset from now on is a cold boot */
+        mss_resume_flag_write(0U);
+
+        if ((1U == ddr_self_refresh_resumed()) &&
+            (MSS_SUSPEND_RECORD_MAGIC == p_record->magic) &&
+            (MSS_SUSPEND_RECORD_VERSION == p_record->version) &&
+            (p_record->checksum == record_checksum(p_record)))
+        {
+            for (inc = 0U; inc < PLIC_NUM_SOURCES; inc++)
+            {
+                PLIC->SOURCE_PRIORITY[inc] = p_record->plic_priority[inc];
+            }
+
+            for (inc = 0U; inc < NUM_CLAIM_REGS; inc++)
+            {
+                volatile uint32_t * p_enables =
+                    &PLIC->HART0_MMODE_ENA[0] + (inc * PLIC_ENABLES_STRIDE);
+
+                for (reg = 0U; reg < PLIC_SET_UP_REGISTERS; reg++)
+                {
+                    p_enables[reg] = p_record->plic_enable[inc][reg];
+                }
+                PLIC->TARGET[inc].PRIORITY_THRESHOLD =
+                        p_record->plic_threshold[inc];
+            }
+
+            for (inc = 0U; inc < (uint32_t)L2_NUM_MASTERS; inc++)
+            {
+                (&CACHE_CTRL->WAY_MASK_DMA)[inc] = p_record->l2_way_mask[inc];
+            }
+
+            g_resuming = 1U;
+        }
+    }
+
+    /*
+     * The record is used once. On a cold boot a record left in the DDR must not
+     * be mistaken for a hart which has saved its state.
+     */
+    p_record->magic = 0U;
+    if (0U == g_resuming)
+    {
+        for (hart = 0U; hart < MSS_SUSPEND_NUM_HARTS; hart++)
+        {
+            p_record->hart[hart].saved = 0U;
+        }
+    }
+    mb();
+
+    return (g_resuming);
+}
+
+/***************************************************************************//**
+ * See mss_suspend.h
+ */
+void mss_resume_hart(uint8_t hart_id)
+{
+    mss_suspend_record_t * p_record = SUSPEND_RECORD;
+    mss_suspend_hart_t * p_hart;
+
+    if ((1U == g_resuming) && (hart_id < MSS_SUSPEND_NUM_HARTS) &&
+        (0U != (p_record->hart_mask & (1UL << hart_id))))
+    {
+        p_hart = &p_record->hart[hart_id];
+
+        if (MSS_SUSPEND_HART_SAVED == p_hart->saved)
+        {
+            p_hart->saved = 0U;
+            mb();
+            restore_hart(p_hart, hart_id);
+            mss_suspend_restore_context(&p_hart->context);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Default, there is nowhere to keep the flag so the system never resumes
+ */
+__attribute__((weak)) uint32_t mss_resume_flag_read(void)
+{
+    return (0U);
+}
+
+__attribute__((weak)) void mss_resume_flag_write(uint32_t flag)
+{
+    (void)flag;
+}
+
+/***************************************************************************//**
+ * Default, wait for the board to remove the power
+ */
+__attribute__((weak)) MSS_SUSPEND_TEXT void mss_suspend_power_down(void)
+{
+    clear_csr(mstatus, MSTATUS_MIE);
+
+    while (1)
+    {
+        __asm volatile ("wfi");
+    }
+}
+
+/***************************************************************************//**
+ * save_hart()
+ * Saves the CSRs of the calling hart, with interrupts left disabled
+ */
+static void save_hart(mss_suspend_hart_t * p_hart, uint64_t hart_id)
+{
+    uint64_t mstatus = read_csr(mstatus);
+    uint64_t now;
+    uint64_t mtimecmp;
+
+    clear_csr(mstatus, MSTATUS_MIE);
+
+    p_hart->saved = 0U;
+    p_hart->resume_mie = (uint32_t)(mstatus & MSTATUS_MIE);
+    p_hart->mstatus = mstatus & ~(uint64_t)MSTATUS_MIE;
+    p_hart->mie = read_csr(mie);
+    p_hart->mtvec = read_csr(mtvec);
+    p_hart->mscratch = read_csr(mscratch);
+    p_hart->medeleg = read_csr(medeleg);
+    p_hart->mideleg = read_csr(mideleg);
+    p_hart->mcounteren = read_csr(mcounteren);
+
+    now = readmtime();
+    mtimecmp = CLINT->MTIMECMP[hart_id];
+    p_hart->mtimecmp_left = (mtimecmp > now) ? (mtimecmp - now) : 0ULL;
+
+    p_hart->pmpcfg[0] = read_csr(pmpcfg0);
+    p_hart->pmpcfg[1] = read_csr(pmpcfg2);
+    p_hart->pmpaddr[0] = read_csr(pmpaddr0);
+    p_hart->pmpaddr[1] = read_csr(pmpaddr1);
+    p_hart->pmpaddr[2] = read_csr(pmpaddr2);
+    p_hart->pmpaddr[3] = read_csr(pmpaddr3);
+    p_hart->pmpaddr[4] = read_csr(pmpaddr4);
+    p_hart->pmpaddr[5] = read_csr(pmpaddr5);
+    p_hart->pmpaddr[6] = read_csr(pmpaddr6);
+    p_hart->pmpaddr[7] = read_csr(pmpaddr7);
+    p_hart->pmpaddr[8] = read_csr(pmpaddr8);
+    p_hart->pmpaddr[9] = read_csr(pmpaddr9);
+    p_hart->pmpaddr[10] = read_csr(pmpaddr10);
+    p_hart->pmpaddr[11] = read_csr(pmpaddr11);
+    p_hart->pmpaddr[12] = read_csr(pmpaddr12);
+    p_hart->pmpaddr[13] = read_csr(pmpaddr13);
+    p_hart->pmpaddr[14] = read_csr(pmpaddr14);
+    p_hart->pmpaddr[15] = read_csr(pmpaddr15);
+}
+
+/***************************************************************************//**
+ * restore_hart()
+ * Puts back the CSRs saved by save_hart(), interrupts stay disabled until the
+ * hart is back in its suspend call
+ */
+static void restore_hart(const mss_suspend_hart_t * p_hart, uint64_t hart_id)
+{
+    clear_csr(mstatus, MSTATUS_MIE);
+
+    /* The soft interrupt which woke the hart in the boot image */
+    CLINT->MSIP[hart_id] = 0U;
+    CLINT->MTIMECMP[hart_id] = readmtime() + p_hart->mtimecmp_left;
+
+    write_csr(pmpaddr0, p_hart->pmpaddr[0]);
+    write_csr(pmpaddr1, p_hart->pmpaddr[1]);
+    write_csr(pmpaddr2, p_hart->pmpaddr[2]);
+    write_csr(pmpaddr3, p_hart->pmpaddr[3]);
+    write_csr(pmpaddr4, p_hart->pmpaddr[4]);
+    write_csr(pmpaddr5, p_hart->pmpaddr[5]);
+    write_csr(pmpaddr6, p_hart->pmpaddr[6]);
+    write_csr(pmpaddr7, p_hart->pmpaddr[7]);
+    write_csr(pmpaddr8, p_hart->pmpaddr[8]);
+    write_csr(pmpaddr9, p_hart->pmpaddr[9]);
+    write_csr(pmpaddr10, p_hart->pmpaddr[10]);
+    write_csr(pmpaddr11, p_hart->pmpaddr[11]);
+    write_csr(pmpaddr12, p_hart->pmpaddr[12]);
+    write_csr(pmpaddr13, p_hart->pmpaddr[13]);
+    write_csr(pmpaddr14, p_hart->pmpaddr[14]);
+    write_csr(pmpaddr15, p_hart->pmpaddr[15]);
+    write_csr(pmpcfg0, p_hart->pmpcfg[0]);
+    write_csr(pmpcfg2, p_hart->pmpcfg[1]);
+
+    write_csr(mcounteren, p_hart->mcounteren);
+    write_csr(mideleg, p_hart->mideleg);
+    write_csr(medeleg, p_hart->medeleg);
+    write_csr(mscratch, p_hart->mscratch);
+    write_csr(mtvec, p_hart->mtvec);
+    write_csr(mie, p_hart->mie);
+    write_csr(mstatus, p_hart->mstatus);
+    __asm volatile("fence.i");
+}
+
+/***************************************************************************//**
+ * hart_resumed()
+ * Runs on the stack of the application once the hart has been resumed
+ */
+static uint8_t hart_resumed(const mss_suspend_hart_t * p_hart)
+{
+    if (0U != p_hart->resume_mie)
+    {
+        set_csr(mstatus, MSTATUS_MIE);
+    }
+
+    return (MSS_SUSPEND_RESUMED);
+}
+
+/***************************************************************************//**
+ * suspend_system()
+ * Seals the record, writes back the L2 and puts the DDR in self-refresh. Only
+ * returns if mss_suspend_power_down() does, with the DDR out of self-refresh.
+ * Nothing it writes to cached DDR after the L2 flush is kept, so it must not
+ * change anything its caller reads once resumed.
+ */
+static void suspend_system(mss_suspend_record_t * p_record,\
+        mss_suspend_hart_t * p_hart)
+{
+    p_hart->saved = MSS_SUSPEND_HART_SAVED;
+    p_record->magic = MSS_SUSPEND_RECORD_MAGIC;
+    p_record->version = MSS_SUSPEND_RECORD_VERSION;
+    p_record->checksum = record_checksum(p_record);
+    mb();
+
+    mss_resume_flag_write(MSS_RESUME_FLAG);
+
+    if (SUCCESS == mss_l2_flush_all())
+    {
+        ddr_self_refresh_power_down();
+    }
+
+    mss_resume_flag_write(0U);
+    p_record->magic = 0U;
+    mb();
+}
+
+/***************************************************************************//**
+ * ddr_self_refresh_power_down()
+ * Must not touch the DDR, see MSS_SUSPEND_TEXT
+ */
+static void ddr_self_refresh_power_down(void)
+{
+    DDRCFG->MC_BASE2.INIT_SELF_REFRESH.INIT_SELF_REFRESH = 0x1U;
+    while ((DDRCFG->MC_BASE2.INIT_SELF_REFRESH_STATUS.INIT_SELF_REFRESH_STATUS\
+            & 0x01U) == 0U)
+    {
+        /* wait for the DDR to be in self-refresh */
+    }
+
+    mss_suspend_power_down();
+
+    DDRCFG->MC_BASE2.INIT_SELF_REFRESH.INIT_SELF_REFRESH = 0x0U;
+    while ((DDRCFG->MC_BASE2.INIT_SELF_REFRESH_STATUS.INIT_SELF_REFRESH_STATUS\
+            & 0x01U) != 0U)
+    {
+        /* wait for the DDR to leave self-refresh */
+    }
+}
+
+/***************************************************************************//**
+ * record_checksum()
+ * Checksum of all the record words before the checksum
+ */
+static uint32_t record_checksum(const mss_suspend_record_t * p_record)
+{
+    const uint32_t * p_word = (const uint32_t *)p_record;
+    uint32_t words = (uint32_t)(offsetof(mss_suspend_record_t, checksum) / 4U);
+    uint32_t sum = 0x5A5A5A5AUL;
+    uint32_t i;
+
+    for (i = 0U; i < words; i++)
+    {
+        sum = ((sum << 5U) | (sum >> 27U)) ^ p_word[i];
+    }
+
+    return (sum);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDR_SELF_REFRESH_RESUME */
@@ -0,0 +1,249 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_suspend.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Suspend to DDR self-refresh and fast resume
+ *
+ * When DDR_SELF_REFRESH_RESUME is defined in mss_sw_config.h, a duty cycled
+ * system can be suspended with its state held in the DDR, put in
+ * self-refresh, and resumed where it left off after the MSS has been powered
+ * down or reset, instead of going through a cold boot and full DDR training.
+ *
+ * Suspend, run by the application from the DDR:
+ *  - Each hart taking part other than the one suspending the system calls
+ *    mss_suspend_hart(). It saves its registers, CSRs, PMP entries and the
+ *    time left to its mtimecmp in the resume record, at MSS_SUSPEND_RECORD_ADDR
+ *    in the DDR, and parks in the virtual ROM.
+ *  - The last hart calls mss_suspend() with the mask of these harts. Once they
+ *    have all saved their state it saves its own, the PLIC priorities,
+ *    enables and thresholds and the L2 way masks, sets the resume flag with
+ *    mss_resume_flag_write(), writes back the whole L2 with
+ *    mss_l2_flush_all(), puts the DDR in self-refresh and calls
+ *    mss_suspend_power_down().
+ *
+ * Resume, run by the boot image, which needs MPFS_HAL_HW_CONFIG:
+ *  - mss_nwc_init() reads the resume flag with mss_resume_flag_read(). With
+ *    the flag set and the training results of DDR_CALIB_CACHE, the DDR
+ *    controller is started without resetting the DDR or writing its mode
+ *    registers, the DDR is taken out of self-refresh, the PHY is trained
+ *    with the cached offsets and the cached write calibration is restored.
+ *    None of the memory tests are run, as they write to the DDR. If any step
+ *    fails the DDR is fully trained and the boot is a cold one.
+ *  - main_first_hart() calls mss_resume_check(), which clears the resume
+ *    flag, checks the record and restores the PLIC and L2 way masks, then
+ *    skips the initialisation of the DDR sections and wakes the other harts.
+ *  - main_other_hart() calls mss_resume_hart() on each hart. A hart with a
+ *    saved state restores its CSRs, PMP entries and registers and returns
+ *    from its mss_suspend_hart() or mss_suspend() call with
+ *    MSS_SUSPEND_RESUMED. The harts which did not take part start their
+ *    application as on a cold boot.
+ *
+ * Limitations:
+ *  - The DDR must stay powered, and its reset and clock enable held by the
+ *    board, while the MSS is down. The order in which the controller is
+ *    taken out of self-refresh relative to the PHY training must be checked
+ *    on the hardware for each memory type.
+ *  - The suspending harts must be in machine mode. Supervisor mode state,
+ *    e.g. satp, is not saved. mtime restarts at reset, the time left to each
+ *    mtimecmp is kept.
+ *  - Peripherals, including the PDMA and the MACs, are not saved. They must
+ *    be idle when suspending and are initialised again by the application on
+ *    resume. No master may access the DDR while the L2 is written back.
+ *  - No L2 ways may be locked, see mss_l2_lock_range().
+ *  - The code run once the DDR is in self-refresh, and any
+ *    mss_suspend_power_down() of the application, are placed with
+ *    MSS_SUSPEND_TEXT, which must not be in the DDR.
+ *
+ * Example:
+ * @code
+ *   void u54_2(void)
+ *   {
+ *       ...
+ *       if (suspend_requested)
+ *       {
+ *           (void)mss_suspend_hart();
+ *           restart_peripherals();
+ *       }
+ *   }
+ *
+ *   void u54_1(void)
+ *   {
+ *       ...
+ *       if (MSS_SUSPEND_RESUMED == mss_suspend(1U << 2U))
+ *       {
+ *           restart_peripherals();
+ *       }
+ *   }
+ *
+ *   uint32_t mss_resume_flag_read(void)
+ *   {
+ *       return (FABRIC_RETENTION_REG);
+ *   }
+ *
+ *   void mss_resume_flag_write(uint32_t flag)
+ *   {
+ *       FABRIC_RETENTION_REG = flag;
+ *   }
+ * @endcode
+ */
+#ifndef MSS_SUSPEND_H
+#define MSS_SUSPEND_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef DDR_SELF_REFRESH_RESUME
+
+#ifndef DDR_CALIB_CACHE
+#error DDR_SELF_REFRESH_RESUME needs DDR_CALIB_CACHE
+#endif
+
+/*
+ * Address of the resume record in the DDR, chosen by the application, e.g.
+ * the last page of the 32 bit non cached region. The suspending image and
+ * the boot image must both use it.
+ */
+#ifndef MSS_SUSPEND_RECORD_ADDR
+#error DDR_SELF_REFRESH_RESUME needs MSS_SUSPEND_RECORD_ADDR
+#endif
+
+/*
+ * Placement of the code run once the DDR is in self-refresh. The default suits
+ * images linked with one of the eNVM or LIM linker scripts, images running from
+ * DDR can use L2_SCRATCHPAD.
+ */
+#ifndef MSS_SUSPEND_TEXT
+#define MSS_SUSPEND_TEXT    __attribute__((section(".ram_codetext")))
+#endif
+
+/*
+ * Time mss_suspend() waits for the other harts to call mss_suspend_hart(), in
+ * mtime ticks
+ */
+#ifndef MSS_SUSPEND_TIMEOUT
+#define MSS_SUSPEND_TIMEOUT             1000000ULL
+#endif
+
+#define MSS_SUSPEND_RESUMED             0U
+#define MSS_SUSPEND_ERROR               1U
+
+/*
+ * Value of the resume flag while the system is suspended
+ */
+#define MSS_RESUME_FLAG                 0x52534D45UL
+
+#define MSS_SUSPEND_RECORD_MAGIC        0x53555350UL
+#define MSS_SUSPEND_RECORD_VERSION      1U
+#define MSS_SUSPEND_HART_SAVED          0x48415254UL
+#define MSS_SUSPEND_NUM_HARTS           5U
+
+/*
+ * Registers saved by mss_suspend_save_context() in mss_utils.S, the offsets are
+ * used there
+ */
+typedef struct
+{
+    uint64_t regs[16];          /* ra, sp, gp, tp, s0 to s11 */
+    uint64_t fp_saved;          /* fcsr and fregs were saved */
+    uint64_t fcsr;
+    uint64_t fregs[12];         /* fs0 to fs11 */
+} mss_suspend_context_t;
+
+typedef struct
+{
+    mss_suspend_context_t context;
+    uint64_t mstatus;
+    uint64_t mie;
+    uint64_t mtvec;
+    uint64_t mscratch;
+    uint64_t medeleg;
+    uint64_t mideleg;
+    uint64_t mcounteren;
+    uint64_t mtimecmp_left;     /* mtimecmp - mtime, 0 when already due */
+    uint64_t pmpcfg[2];         /* pmpcfg0 and pmpcfg2 */
+    uint64_t pmpaddr[16];
+    uint32_t saved;             /* MSS_SUSPEND_HART_SAVED */
+    uint32_t resume_mie;        /* mstatus.MIE before suspending */
+} mss_suspend_hart_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t hart_mask;
+    uint32_t plic_priority[PLIC_NUM_SOURCES];
+    uint32_t plic_enable[NUM_CLAIM_REGS][PLIC_SET_UP_REGISTERS];
+    uint32_t plic_threshold[NUM_CLAIM_REGS];
+    uint64_t l2_way_mask[L2_NUM_MASTERS];
+    mss_suspend_hart_t hart[MSS_SUSPEND_NUM_HARTS];
+    uint32_t checksum;
+} mss_suspend_record_t;
+
+/***************************************************************************//**
+ * mss_suspend_hart() saves the state of the calling hart and parks it, for
+ * all the harts but one, see above. It only returns once resumed, with
+ * MSS_SUSPEND_RESUMED, and interrupts enabled again if they were.
+ */
+uint8_t mss_suspend_hart(void);
+
+/***************************************************************************//**
+ * mss_suspend() suspends the system, see above. hart_mask is the mask of the
+ * other harts, which must each call mss_suspend_hart().
+ *
+ * It returns MSS_SUSPEND_RESUMED once resumed. It returns MSS_SUSPEND_ERROR,
+ * not having suspended, if the harts have not all saved their state within
+ * MSS_SUSPEND_TIMEOUT or L2 ways are locked, or after
+ * mss_suspend_power_down() returns, in which case the DDR has been taken out
+ * of self-refresh and the parked harts only restart with a reset.
+ */
+uint8_t mss_suspend(uint32_t hart_mask);
+
+/***************************************************************************//**
+ * Called by the boot image, see above. mss_resume_check() returns 1U if the
+ * system is resuming. mss_resume_hart() returns when the calling hart has no
+ * saved state.
+ */
+uint8_t mss_resume_check(void);
+void mss_resume_hart(uint8_t hart_id);
+
+/***************************************************************************//**
+ * mss_resume_pending() returns 1U when the resume flag is set, it is used by
+ * the DDR training state machine
+ */
+uint8_t mss_resume_pending(void);
+
+/***************************************************************************//**
+ * Weakly linked, implement them in the application.
+ *
+ * mss_resume_flag_read() and mss_resume_flag_write() keep the resume flag
+ * where it survives the MSS being powered down or reset, e.g. a fabric
+ * register or a register of the power management IC. The default keeps it
+ * nowhere, so the system never resumes.
+ *
+ * mss_suspend_power_down() is called with the DDR in self-refresh, to have the
+ * board remove the MSS supplies or assert its reset. It must be placed with
+ * MSS_SUSPEND_TEXT and not access the DDR. The default waits in wfi with
+ * interrupts disabled.
+ */
+uint32_t mss_resume_flag_read(void);
+void mss_resume_flag_write(uint32_t flag);
+void mss_suspend_power_down(void);
+
+#endif /* DDR_SELF_REFRESH_RESUME */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_SUSPEND_H */
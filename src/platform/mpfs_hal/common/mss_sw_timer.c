@@ -0,0 +1,426 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_sw_timer.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Tickless software timers
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SW_TIMER_NUM_HARTS      (MPFS_HAL_LAST_HART + 1U)
+#define SW_TIMER_SLOT_BITS      6U
+#define SW_TIMER_SLOT_MASK      (SW_TIMER_SLOTS - 1U)
+#define SW_TIMER_MAX_DELTA      ((1ULL << (SW_TIMER_SLOT_BITS * SW_TIMER_LEVELS)) - 1ULL)
+#define SW_TIMER_NO_DEADLINE    0xFFFFFFFFFFFFFFFFULL
+
+typedef struct
+{
+    uint64_t now;                   /* wheel ticks processed */
+    uint64_t last_cascade;
+    uint64_t occupied[SW_TIMER_LEVELS];
+    sw_timer_t * slots[SW_TIMER_LEVELS][SW_TIMER_SLOTS];
+    uint8_t enabled;
+} sw_timer_wheel_t;
+
+static sw_timer_wheel_t g_sw_timer_wheel[SW_TIMER_NUM_HARTS];
+
+static void wheel_insert(sw_timer_wheel_t * wheel, sw_timer_t * timer);
+static void wheel_unlink(sw_timer_wheel_t * wheel, sw_timer_t * timer);
+static sw_timer_t * wheel_detach_slot(sw_timer_wheel_t * wheel, uint32_t level,
+        uint32_t slot);
+static uint64_t wheel_next_deadline(const sw_timer_wheel_t * wheel);
+static void wheel_expire(sw_timer_wheel_t * wheel);
+static void wheel_program(const sw_timer_wheel_t * wheel, uint64_t hart_id);
+
+/***************************************************************************//**
+ * See mss_sw_timer.h
+ */
+void sw_timer_init(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    sw_timer_wheel_t * wheel;
+    uint32_t level;
+    uint32_t slot;
+
+    if (hart_id < SW_TIMER_NUM_HARTS)
+    {
+        wheel = &g_sw_timer_wheel[hart_id];
+
+        clear_csr(mie, MIP_MTIP);
+
+        for (level = 0U; level < SW_TIMER_LEVELS; level++)
+        {
+            wheel->occupied[level] = 0ULL;
+
+            for (slot = 0U; slot < SW_TIMER_SLOTS; slot++)
+            {
+                wheel->slots[level][slot] = (sw_timer_t *)0;
+            }
+        }
+
+        wheel->now = readmtime() >> SW_TIMER_RESOLUTION_SHIFT;
+        wheel->last_cascade = wheel->now;
+        wheel->enabled = 1U;
+
+        CLINT->MTIMECMP[hart_id] = SW_TIMER_NO_DEADLINE;
+
+        set_csr(mie, MIP_MTIP);   /* mie Register - Machine Timer Interrupt Enable */
+
+        __enable_irq();
+    }
+}
+
+/***************************************************************************//**
+ * See mss_sw_timer.h
+ */
+void sw_timer_start
+(
+    sw_timer_t * timer,
+    uint64_t delay,
+    uint64_t period,
+    sw_timer_callback_t callback,
+    void * user_data
+)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    sw_timer_wheel_t * wheel;
+    uint64_t mstatus;
+
+    if ((hart_id < SW_TIMER_NUM_HARTS) && ((sw_timer_t *)0 != timer))
+    {
+        wheel = &g_sw_timer_wheel[hart_id];
+
+        mstatus = disable_interrupts();
+
+        if (0U != timer->active)
+        {
+            wheel_unlink(wheel, timer);
+        }
+
+        timer->expires = (readmtime() + delay) >> SW_TIMER_RESOLUTION_SHIFT;
+        timer->period = period >> SW_TIMER_RESOLUTION_SHIFT;
+
+        if ((0ULL != period) && (0ULL == timer->period))
+        {
+            timer->period = 1ULL;
+        }
+
+        timer->callback = callback;
+        timer->user_data = user_data;
+        wheel_insert(wheel, timer);
+
+        if (0U != wheel->enabled)
+        {
+            wheel_program(wheel, hart_id);
+        }
+
+        restore_interrupts(mstatus);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_sw_timer.h
+ */
+void sw_timer_cancel(sw_timer_t * timer)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t mstatus;
+
+    if ((hart_id < SW_TIMER_NUM_HARTS) && ((sw_timer_t *)0 != timer))
+    {
+        mstatus = disable_interrupts();
+
+        if (0U != timer->active)
+        {
+            /* mtimecmp is left as it is, the next deadline being the same or
+             * later */
+            wheel_unlink(&g_sw_timer_wheel[hart_id], timer);
+        }
+
+        restore_interrupts(mstatus);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_sw_timer.h
+ */
+uint8_t sw_timer_process(void)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    sw_timer_wheel_t * wheel;
+    uint64_t target;
+    uint64_t deadline;
+    uint8_t processed = 0U;
+
+    if ((hart_id < SW_TIMER_NUM_HARTS) &&
+        (0U != g_sw_timer_wheel[hart_id].enabled))
+    {
+        wheel = &g_sw_timer_wheel[hart_id];
+        target = readmtime() >> SW_TIMER_RESOLUTION_SHIFT;
+        deadline = wheel_next_deadline(wheel);
+
+        /* Step from one deadline to the next rather than tick by tick */
+        while (deadline <= target)
+        {
+            wheel->now = deadline;
+            wheel_expire(wheel);
+            deadline = wheel_next_deadline(wheel);
+        }
+
+        if (target > wheel->now)
+        {
+            wheel->now = target;
+        }
+
+        wheel_program(wheel, hart_id);
+        processed = 1U;
+    }
+
+    return (processed);
+}
+
+/***************************************************************************//**
+ * Adds a timer to the slot of its deadline, at the lowest level covering it.
+ */
+static void wheel_insert(sw_timer_wheel_t * wheel, sw_timer_t * timer)
+{
+    uint64_t delta = 0ULL;
+    uint64_t target;
+    uint32_t level = 0U;
+    uint32_t slot;
+
+    if (timer->expires > wheel->now)
+    {
+        delta = timer->expires - wheel->now;
+    }
+
+    if (delta > SW_TIMER_MAX_DELTA)
+    {
+        /* Re-inserted when the end of the range of the wheel is reached */
+        delta = SW_TIMER_MAX_DELTA;
+    }
+
+    target = wheel->now + delta;
+
+    while ((level < (SW_TIMER_LEVELS - 1U)) &&
+           (delta >= (1ULL << (SW_TIMER_SLOT_BITS * (level + 1U)))))
+    {
+        level++;
+    }
+
+    slot = (uint32_t)(target >> (SW_TIMER_SLOT_BITS * level)) & SW_TIMER_SLOT_MASK;
+
+    timer->level = (uint8_t)level;
+    timer->slot = (uint8_t)slot;
+    timer->prev = (sw_timer_t *)0;
+    timer->next = wheel->slots[level][slot];
+
+    if ((sw_timer_t *)0 != timer->next)
+    {
+        timer->next->prev = timer;
+    }
+
+    wheel->slots[level][slot] = timer;
+    wheel->occupied[level] |= (1ULL << slot);
+    timer->active = 1U;
+}
+
+/***************************************************************************//**
+ * Removes an active timer from its slot.
+ */
+static void wheel_unlink(sw_timer_wheel_t * wheel, sw_timer_t * timer)
+{
+    if ((sw_timer_t *)0 != timer->prev)
+    {
+        timer->prev->next = timer->next;
+    }
+    else
+    {
+        wheel->slots[timer->level][timer->slot] = timer->next;
+    }
+
+    if ((sw_timer_t *)0 != timer->next)
+    {
+        timer->next->prev = timer->prev;
+    }
+
+    if ((sw_timer_t *)0 == wheel->slots[timer->level][timer->slot])
+    {
+        wheel->occupied[timer->level] &= ~(1ULL << timer->slot);
+    }
+
+    timer->next = (sw_timer_t *)0;
+    timer->prev = (sw_timer_t *)0;
+    timer->active = 0U;
+}
+
+/***************************************************************************//**
+ * Empties a slot and returns the list of its timers.
+ */
+static sw_timer_t * wheel_detach_slot(sw_timer_wheel_t * wheel, uint32_t level,
+        uint32_t slot)
+{
+    sw_timer_t * list = wheel->slots[level][slot];
+
+    wheel->slots[level][slot] = (sw_timer_t *)0;
+    wheel->occupied[level] &= ~(1ULL << slot);
+
+    return (list);
+}
+
+/***************************************************************************//**
+ * Returns the wheel tick of the next slot to process, or SW_TIMER_NO_DEADLINE.
+ * The level 0 slots are due at their own tick, the higher level slots at the
+ * start of the period they cover, when their timers are moved down a level.
+ */
+static uint64_t wheel_next_deadline(const sw_timer_wheel_t * wheel)
+{
+    uint64_t deadline = SW_TIMER_NO_DEADLINE;
+    uint64_t candidate;
+    uint64_t rotated;
+    uint32_t level;
+    uint32_t shift;
+    uint32_t start;
+    uint32_t distance;
+
+    for (level = 0U; level < SW_TIMER_LEVELS; level++)
+    {
+        if (0ULL != wheel->occupied[level])
+        {
+            shift = SW_TIMER_SLOT_BITS * level;
+            start = (uint32_t)(wheel->now >> shift) & SW_TIMER_SLOT_MASK;
+
+            if (0U != level)
+            {
+                /* the current slot of a higher level is due next rotation */
+                start = (start + 1U) & SW_TIMER_SLOT_MASK;
+            }
+
+            rotated = wheel->occupied[level];
+
+            if (0U != start)
+            {
+                rotated = (rotated >> start) | (rotated << (SW_TIMER_SLOTS - start));
+            }
+
+            distance = (uint32_t)__builtin_ctzll(rotated);
+
+            if (0U != level)
+            {
+                distance++;
+            }
+
+            candidate = ((wheel->now >> shift) + distance) << shift;
+
+            if (candidate < deadline)
+            {
+                deadline = candidate;
+            }
+        }
+    }
+
+    return (deadline);
+}
+
+/***************************************************************************//**
+ * Processes the slots due at the current wheel tick: the higher level slots
+ * are moved down, then the callbacks of the level 0 timers due are called.
+ */
+static void wheel_expire(sw_timer_wheel_t * wheel)
+{
+    sw_timer_t * list;
+    sw_timer_t * timer;
+    uint32_t level;
+    uint32_t shift;
+
+    if (wheel->now != wheel->last_cascade)
+    {
+        wheel->last_cascade = wheel->now;
+
+        for (level = SW_TIMER_LEVELS - 1U; level > 0U; level--)
+        {
+            shift = SW_TIMER_SLOT_BITS * level;
+
+            if (0ULL == (wheel->now & ((1ULL << shift) - 1ULL)))
+            {
+                list = wheel_detach_slot(wheel, level,
+                        (uint32_t)(wheel->now >> shift) & SW_TIMER_SLOT_MASK);
+
+                while ((sw_timer_t *)0 != list)
+                {
+                    timer = list;
+                    list = list->next;
+                    wheel_insert(wheel, timer);
+                }
+            }
+        }
+    }
+
+    list = wheel_detach_slot(wheel, 0U,
+            (uint32_t)wheel->now & SW_TIMER_SLOT_MASK);
+
+    while ((sw_timer_t *)0 != list)
+    {
+        timer = list;
+        list = list->next;
+
+        if (timer->expires > wheel->now)
+        {
+            /* deadline beyond the range of the wheel when started */
+            wheel_insert(wheel, timer);
+        }
+        else
+        {
+            timer->active = 0U;
+
+            if (0ULL != timer->period)
+            {
+                timer->expires += timer->period;
+
+                if (timer->expires <= wheel->now)
+                {
+                    timer->expires = wheel->now + timer->period;
+                }
+
+                /* re-armed first so that the callback can cancel it */
+                wheel_insert(wheel, timer);
+            }
+
+            if ((sw_timer_callback_t)0 != timer->callback)
+            {
+                timer->callback(timer, timer->user_data);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Programs mtimecmp of the hart for the next deadline of the wheel.
+ */
+static void wheel_program(const sw_timer_wheel_t * wheel, uint64_t hart_id)
+{
+    uint64_t deadline = wheel_next_deadline(wheel);
+
+    if (SW_TIMER_NO_DEADLINE != deadline)
+    {
+        deadline = deadline << SW_TIMER_RESOLUTION_SHIFT;
+    }
+
+    CLINT->MTIMECMP[hart_id] = deadline;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_sw_timer.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Tickless software timers
+ *
+ * The software timers replace the fixed period system tick of a hart with a
+ * hierarchical timer wheel. The CLINT mtimecmp register of the hart is only
+ * programmed for the next timer deadline, so a hart without timers due does
+ * not wake up from wfi.
+ *
+ * Each hart has its own wheel of SW_TIMER_LEVELS levels of 64 slots, the
+ * slots of level n covering 64^n wheel ticks of 2^SW_TIMER_RESOLUTION_SHIFT
+ * mtime ticks. Starting and cancelling a timer takes a constant time, and
+ * the next deadline is found from one bitmap per level without scanning the
+ * timers. Timers due further than the range of the wheel are moved back into
+ * the wheel when its range is reached.
+ *
+ * sw_timer_init() switches the calling hart from the system tick configured by
+ * SysTick_Config() to the software timers. The timer callbacks are called from
+ * the machine timer interrupt handler of the hart. The timers of a hart must
+ * only be started and cancelled from that hart.
+ */
+#ifndef MSS_SW_TIMER_H
+#define MSS_SW_TIMER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Resolution of the software timers, as a power of two number of mtime ticks
+ */
+#ifndef SW_TIMER_RESOLUTION_SHIFT
+#define SW_TIMER_RESOLUTION_SHIFT       4U
+#endif
+
+#define SW_TIMER_LEVELS                 4U
+#define SW_TIMER_SLOTS                  64U
+
+struct sw_timer;
+
+typedef void (*sw_timer_callback_t)(struct sw_timer * timer, void * user_data);
+
+/*
+ * Software timer, owned by the caller. The members are managed by the
+ * functions below.
+ */
+typedef struct sw_timer
+{
+    struct sw_timer * next;
+    struct sw_timer * prev;
+    uint64_t expires;
+    uint64_t period;
+    sw_timer_callback_t callback;
+    void * user_data;
+    uint8_t level;
+    uint8_t slot;
+    volatile uint8_t active;
+} sw_timer_t;
+
+/***************************************************************************//**
+ * sw_timer_init() resets the timer wheel of the calling hart and uses it
+ * instead of the system tick for the machine timer interrupt of the hart.
+ */
+void sw_timer_init(void);
+
+/***************************************************************************//**
+ * sw_timer_start() starts a timer on the calling hart, restarting it if it is
+ * already active. The callback is called delay mtime ticks from now and then
+ * every period mtime ticks, or once when period is 0.
+ *
+ * Example:
+ * @code
+ *   static sw_timer_t g_led_timer;
+ *
+ *   sw_timer_start(&g_led_timer, 500000ULL, 500000ULL, toggle_led, NULL);
+ * @endcode
+ */
+void sw_timer_start
+(
+    sw_timer_t * timer,
+    uint64_t delay,
+    uint64_t period,
+    sw_timer_callback_t callback,
+    void * user_data
+);
+
+/***************************************************************************//**
+ * sw_timer_cancel() stops a timer started on the calling hart. It does
+ * nothing if the timer is not active.
+ */
+void sw_timer_cancel(sw_timer_t * timer);
+
+/***************************************************************************//**
+ * sw_timer_process() calls the callbacks of the timers due on the calling hart
+ * and programs mtimecmp for the next deadline. It is called by
+ * handle_m_timer_interrupt() and returns 0 when sw_timer_init() was not called
+ * on the hart, in which case the system tick is used.
+ */
+uint8_t sw_timer_process(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_SW_TIMER_H */
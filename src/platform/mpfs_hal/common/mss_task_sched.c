@@ -0,0 +1,436 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_task_sched.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Work-stealing task scheduler for the harts
+ *
+ */
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCHED_DEQUE_MASK                ((int64_t)MSS_SCHED_DEQUE_SIZE - 1)
+
+/*******************************************************************************
+ * Local functions
+ */
+static uint8_t sched_push(mss_sched_deque_t * deque, const mss_task_t * task);
+static uint8_t sched_pop(mss_sched_deque_t * deque, mss_task_t * task);
+static uint8_t sched_steal(mss_sched_deque_t * deque, mss_task_t * task);
+static uint8_t sched_find(mss_sched_t * sched, uint64_t hart_id,
+        mss_task_t * task);
+static void sched_wake_one(mss_sched_t * sched, uint64_t hart_id);
+static void sched_run(mss_sched_t * sched, uint64_t hart_id, mss_task_t * task);
+
+/***************************************************************************//**
+ * See mss_task_sched.h
+ */
+void mss_sched_init(mss_sched_t * sched)
+{
+    uint32_t inc;
+
+    for(inc = 0U; inc < MSS_SCHED_NUM_HARTS; inc++)
+    {
+        sched->deque[inc].top = 0;
+        sched->deque[inc].bottom = 0;
+    }
+
+    sched->idle = 0U;
+    sched->stop = 0U;
+    sched->unpark_depth = 0U;
+    sched->park_ticks = 0U;
+    mss_park_init(&sched->park);
+    mb();
+}
+
+/***************************************************************************//**
+ * See mss_task_sched.h
+ */
+void mss_sched_set_parking(mss_sched_t * sched, uint64_t park_ticks,
+        uint32_t unpark_depth)
+{
+    __atomic_store_n(&sched->unpark_depth, unpark_depth, __ATOMIC_RELAXED);
+    __atomic_store_n(&sched->park_ticks, park_ticks, __ATOMIC_RELEASE);
+}
+
+/***************************************************************************//**
+ * See mss_task_sched.h
+ */
+void mss_sched_worker(mss_sched_t * sched)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t hart_bit = 1ULL << hart_id;
+    uint64_t idle_since = readmtime();
+    uint64_t park_ticks;
+    uint8_t park;
+    mss_task_t task;
+
+    set_csr(mie, MIP_MSIP);
+
+    while(0U == __atomic_load_n(&sched->stop, __ATOMIC_ACQUIRE))
+    {
+        if(SUCCESS == sched_find(sched, hart_id, &task))
+        {
+            sched_run(sched, hart_id, &task);
+            idle_since = readmtime();
+        }
+        else
+        {
+            /*
+             * Mark the hart idle before looking once more, so a task pushed
+             * after the first look either is found or wakes the hart.
+             */
+            (void)__atomic_fetch_or(&sched->idle, hart_bit, __ATOMIC_SEQ_CST);
+
+            if(SUCCESS == sched_find(sched, hart_id, &task))
+            {
+                (void)__atomic_fetch_and(&sched->idle, ~hart_bit,
+                        __ATOMIC_SEQ_CST);
+                sched_run(sched, hart_id, &task);
+                idle_since = readmtime();
+            }
+            else
+            {
+                park = 0U;
+                park_ticks = __atomic_load_n(&sched->park_ticks,
+                        __ATOMIC_ACQUIRE);
+
+                if(0U == __atomic_load_n(&sched->stop, __ATOMIC_ACQUIRE))
+                {
+                    if(0U == park_ticks)
+                    {
+#ifdef MPFS_HAL_LOAD_ACCOUNTING
+                        mss_load_idle_enter();
+#endif
+                        __asm__ __volatile__("wfi");
+#ifdef MPFS_HAL_LOAD_ACCOUNTING
+                        mss_load_idle_exit();
+#endif
+                    }
+                    else if(MSS_IDLE_WAKE_DEADLINE ==
+                            mss_idle_wait(idle_since + park_ticks))
+                    {
+                        park = 1U;
+                    }
+                    else
+                    {
+                        /* Woken for a task */
+                    }
+                }
+
+                (void)__atomic_fetch_and(&sched->idle, ~hart_bit,
+                        __ATOMIC_SEQ_CST);
+
+                /* Not taken with interrupts disabled, so clear it here */
+                if(0U == (read_csr(mstatus) & MSTATUS_MIE))
+                {
+                    clear_soft_interrupt();
+                }
+
+                /*
+                 * A task pushed between leaving the idle mask and parking is
+                 * left to the other harts, the one which pushed it included.
+                 * mss_sched_stop() releases the park, so the hart does not
+                 * stay parked.
+                 */
+                if(0U != park)
+                {
+                    (void)mss_park_hart(&sched->park);
+                    idle_since = readmtime();
+                }
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_task_sched.h
+ */
+void mss_sched_stop(mss_sched_t * sched)
+{
+    uint64_t idle;
+    uint32_t inc;
+
+    __atomic_store_n(&sched->stop, 1U, __ATOMIC_SEQ_CST);
+    idle = __atomic_exchange_n(&sched->idle, 0U, __ATOMIC_SEQ_CST);
+
+    for(inc = 0U; inc < MSS_SCHED_NUM_HARTS; inc++)
+    {
+        if(0U != (idle & (1ULL << inc)))
+        {
+            raise_soft_interrupt(inc);
+        }
+    }
+
+    mss_park_release(&sched->park);
+}
+
+/***************************************************************************//**
+ * See mss_task_sched.h
+ */
+void mss_sched_spawn(mss_sched_t * sched, mss_task_group_t * group,
+        mss_task_fn_t fn, void * arg, uint64_t begin, uint64_t end,
+        uint64_t grain)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    mss_task_t task;
+
+    if(begin < end)
+    {
+        task.fn = fn;
+        task.arg = arg;
+        task.begin = begin;
+        task.end = end;
+        task.grain = (0U == grain) ? 1U : grain;
+        task.group = group;
+
+        (void)__atomic_fetch_add(&group->pending, 1U, __ATOMIC_RELAXED);
+
+        if(SUCCESS == sched_push(&sched->deque[hart_id], &task))
+        {
+            sched_wake_one(sched, hart_id);
+        }
+        else
+        {
+            sched_run(sched, hart_id, &task);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_task_sched.h
+ */
+void mss_sched_wait(mss_sched_t * sched, mss_task_group_t * group)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    mss_task_t task;
+
+    while(0U != __atomic_load_n(&group->pending, __ATOMIC_ACQUIRE))
+    {
+        if(SUCCESS == sched_find(sched, hart_id, &task))
+        {
+            sched_run(sched, hart_id, &task);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_task_sched.h
+ */
+void mss_parallel_for(mss_sched_t * sched, uint64_t begin, uint64_t end,
+        uint64_t grain, mss_task_fn_t fn, void * arg)
+{
+    mss_task_group_t group;
+
+    group.pending = 0U;
+    mss_sched_spawn(sched, &group, fn, arg, begin, end, grain);
+    mss_sched_wait(sched, &group);
+}
+
+/***************************************************************************//**
+ * Pushes a task to the bottom of the deque of the calling hart. Returns ERROR
+ * if the deque is full.
+ */
+static uint8_t sched_push(mss_sched_deque_t * deque, const mss_task_t * task)
+{
+    int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+    int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    uint8_t ret_val = ERROR;
+
+    if((bottom - top) < (int64_t)MSS_SCHED_DEQUE_SIZE)
+    {
+        deque->tasks[bottom & SCHED_DEQUE_MASK] = *task;
+        /* Publish the task before the new bottom */
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+        ret_val = SUCCESS;
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * Pops the newest task from the bottom of the deque of the calling hart. The
+ * last task left is raced for with the thieves through the top.
+ */
+static uint8_t sched_pop(mss_sched_deque_t * deque, mss_task_t * task)
+{
+    int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) - 1;
+    int64_t top;
+    uint8_t ret_val = ERROR;
+
+    __atomic_store_n(&deque->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    top = __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+
+    if(top <= bottom)
+    {
+        *task = deque->tasks[bottom & SCHED_DEQUE_MASK];
+        ret_val = SUCCESS;
+
+        if(top == bottom)
+        {
+            if(!__atomic_compare_exchange_n(&deque->top, &top, top + 1, false,
+                    __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+            {
+                /* Stolen */
+                ret_val = ERROR;
+            }
+
+            __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+        }
+    }
+    else
+    {
+        __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * Steals the oldest task from the top of the deque of another hart. Returns
+ * ERROR if the deque is empty or another hart took the task first.
+ */
+static uint8_t sched_steal(mss_sched_deque_t * deque, mss_task_t * task)
+{
+    int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    int64_t bottom;
+    uint8_t ret_val = ERROR;
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+
+    if(top < bottom)
+    {
+        /*
+         * The owner does not reuse the slot until the top has moved past it,
+         * so the copy is complete if the compare and swap succeeds.
+         */
+        *task = deque->tasks[top & SCHED_DEQUE_MASK];
+
+        if(__atomic_compare_exchange_n(&deque->top, &top, top + 1, false,
+                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+        {
+            ret_val = SUCCESS;
+        }
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * Takes a task from the deque of the calling hart, or else steals one from
+ * the other harts, starting with the next hart up.
+ */
+static uint8_t sched_find(mss_sched_t * sched, uint64_t hart_id,
+        mss_task_t * task)
+{
+    uint64_t victim;
+    uint32_t inc;
+    uint8_t ret_val = sched_pop(&sched->deque[hart_id], task);
+
+    for(inc = 1U; (ERROR == ret_val) && (inc < MSS_SCHED_NUM_HARTS); inc++)
+    {
+        victim = (hart_id + inc) % MSS_SCHED_NUM_HARTS;
+        ret_val = sched_steal(&sched->deque[victim], task);
+    }
+
+    return (ret_val);
+}
+
+/***************************************************************************//**
+ * Sends the software interrupt to one idle hart, if any, after a push. If none
+ * is idle a parked hart is woken once the deque of the hart which pushed holds
+ * enough tasks.
+ */
+static void sched_wake_one(mss_sched_t * sched, uint64_t hart_id)
+{
+    mss_sched_deque_t * deque = &sched->deque[hart_id];
+    uint64_t idle;
+    uint64_t hart_bit;
+    int64_t depth;
+    uint32_t unpark_depth;
+    uint8_t woken = 0U;
+
+    /* Order the push before reading the idle mask, see mss_sched_worker() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    idle = __atomic_load_n(&sched->idle, __ATOMIC_RELAXED);
+
+    while(0U != idle)
+    {
+        hart_bit = idle & (~idle + 1U);
+        idle = __atomic_fetch_and(&sched->idle, ~hart_bit, __ATOMIC_SEQ_CST);
+
+        if(0U != (idle & hart_bit))
+        {
+            raise_soft_interrupt((unsigned long)__builtin_ctzll(hart_bit));
+            idle = 0U;
+            woken = 1U;
+        }
+    }
+
+    if((0U == woken) && (0U != mss_park_get_mask(&sched->park)))
+    {
+        depth = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) -
+                __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+        unpark_depth = __atomic_load_n(&sched->unpark_depth, __ATOMIC_RELAXED);
+
+        if((0U == __atomic_load_n(&sched->park_ticks, __ATOMIC_RELAXED)) ||
+            (depth >= (int64_t)((0U == unpark_depth) ? 1U : unpark_depth)))
+        {
+            (void)mss_park_wake_one(&sched->park);
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Runs a task, first splitting off the upper half of its range as new tasks
+ * until it is no larger than the grain.
+ */
+static void sched_run(mss_sched_t * sched, uint64_t hart_id, mss_task_t * task)
+{
+    mss_task_t upper;
+    uint64_t split;
+    uint8_t pushed = SUCCESS;
+
+    while((SUCCESS == pushed) && ((task->end - task->begin) > task->grain))
+    {
+        split = task->begin + ((task->end - task->begin) / 2U);
+        upper = *task;
+        upper.begin = split;
+
+        (void)__atomic_fetch_add(&task->group->pending, 1U, __ATOMIC_RELAXED);
+        pushed = sched_push(&sched->deque[hart_id], &upper);
+
+        if(SUCCESS == pushed)
+        {
+            task->end = split;
+            sched_wake_one(sched, hart_id);
+        }
+        else
+        {
+            /* Deque full: run the rest of the range here */
+            (void)__atomic_fetch_sub(&task->group->pending, 1U,
+                    __ATOMIC_RELAXED);
+        }
+    }
+
+    task->fn(task->arg, task->begin, task->end);
+
+    (void)__atomic_fetch_sub(&task->group->pending, 1U, __ATOMIC_RELEASE);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_task_sched.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Work-stealing task scheduler for the harts
+ *
+ * The scheduler runs tasks, each a function called on a range of indexes,
+ * across the harts which call it, without an RTOS. It lives in memory provided
+ * by the application and shared by the harts, e.g. the area pointed to by
+ * hls->shared_mem with MPFS_HAL_SHARED_MEM_ENABLED defined.
+ *
+ * Each hart has a deque of tasks. A hart pushes and pops tasks at the bottom
+ * of its own deque without locks, and idle harts steal from the top of the
+ * deques of the others with a compare and swap, as in the Chase-Lev deque.
+ * A task with a range larger than its grain is split in two before it runs:
+ * the upper half is pushed as a new task, so the oldest tasks, which others
+ * steal, are the largest, and a range is only split as far as needed to keep
+ * the harts busy.
+ *
+ * Harts waiting for work call mss_sched_worker(), e.g. from u54_1()..u54_4().
+ * When they find no task they mark themselves idle and wait in wfi. A hart
+ * pushing a task sends the software interrupt to one idle hart, which in turn
+ * wakes another when it splits the task it stole. The software interrupt is
+ * enabled by mss_sched_worker(). With interrupts enabled in mstatus, the
+ * interrupt is taken and Software_hN_IRQHandler() is called as normal.
+ *
+ * With parking set up by mss_sched_set_parking(), a worker which has found no
+ * task for a while parks itself with mss_park_hart(), and is then no longer
+ * woken by each task pushed. It is woken again when a hart pushes a task while
+ * no worker is idle and its deque holds the number of tasks given, so at low
+ * load the spare harts stay parked and under load they are all brought back,
+ * each woken hart waking the next as it splits the tasks it steals.
+ *
+ * A task group counts the tasks still to complete. mss_sched_wait() runs
+ * tasks, from any group, until the group it waits for completes, so the hart
+ * which starts the work also takes part in it. mss_parallel_for() starts a
+ * range on a group and waits for it.
+ *
+ * Example, four U54s sharing a loop started by U54_1:
+ * @code
+ *   static void scale(void * arg, uint64_t begin, uint64_t end)
+ *   {
+ *       for (; begin < end; begin++)
+ *       {
+ *           samples[begin] *= 2;
+ *       }
+ *   }
+ *
+ *   // u54_1, once g_shared has been set up with mss_sched_init()
+ *   mss_parallel_for(&g_shared->sched, 0U, NUM_SAMPLES, 1024U, scale, 0);
+ *
+ *   // u54_2, u54_3 and u54_4
+ *   mss_sched_worker(&g_shared->sched);
+ * @endcode
+ */
+#ifndef MSS_TASK_SCHED_H
+#define MSS_TASK_SCHED_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MSS_SCHED_NUM_HARTS             5U
+#define MSS_SCHED_LINE_BYTES            64U
+
+/*
+ * Number of tasks each deque holds, a power of two. When a deque is full the
+ * hart runs the rest of its range itself.
+ */
+#ifndef MSS_SCHED_DEQUE_SIZE
+#define MSS_SCHED_DEQUE_SIZE            64U
+#endif
+
+/*
+ * A task function, called for the indexes from begin up to, not including,
+ * end.
+ */
+typedef void (*mss_task_fn_t)(void * arg, uint64_t begin, uint64_t end);
+
+/*
+ * Count of the tasks of a group still to complete. A group is zero when
+ * complete, so static groups need no initialisation.
+ */
+typedef struct
+{
+    volatile uint64_t pending;
+} mss_task_group_t;
+
+typedef struct
+{
+    mss_task_fn_t fn;
+    void * arg;
+    uint64_t begin;
+    uint64_t end;
+    uint64_t grain;
+    mss_task_group_t * group;
+} mss_task_t;
+
+typedef struct
+{
+    volatile int64_t top;
+    uint8_t top_line[MSS_SCHED_LINE_BYTES - sizeof(int64_t)];
+    volatile int64_t bottom;
+    uint8_t bottom_line[MSS_SCHED_LINE_BYTES - sizeof(int64_t)];
+    mss_task_t tasks[MSS_SCHED_DEQUE_SIZE];
+} __attribute__((aligned(MSS_SCHED_LINE_BYTES))) mss_sched_deque_t;
+
+typedef struct
+{
+    mss_sched_deque_t deque[MSS_SCHED_NUM_HARTS];
+    volatile uint64_t idle;
+    volatile uint32_t stop;
+    uint32_t unpark_depth;      /* Tasks queued which wake a parked worker */
+    uint64_t park_ticks;        /* mtime ticks idle before parking, 0 never */
+    mss_park_t park;
+} mss_sched_t;
+
+/***************************************************************************//**
+ * mss_sched_init() empties the deques of all the harts. It must be called
+ * before any hart uses the scheduler.
+ */
+void mss_sched_init(mss_sched_t * sched);
+
+/***************************************************************************//**
+ * mss_sched_set_parking() makes the workers park once they have been idle for
+ * park_ticks mtime ticks, and wakes one when a hart pushes a task while no
+ * worker is idle and its deque holds unpark_depth tasks or more, 1 or more if
+ * unpark_depth is 0. A park_ticks of 0 stops the parking, which is the
+ * setting left by mss_sched_init(). Workers already parked are woken by the
+ * next pushes.
+ */
+void mss_sched_set_parking(mss_sched_t * sched, uint64_t park_ticks,
+        uint32_t unpark_depth);
+
+/***************************************************************************//**
+ * mss_sched_worker() runs tasks on the calling hart, waiting in wfi when
+ * there are none, until mss_sched_stop() is called.
+ */
+void mss_sched_worker(mss_sched_t * sched);
+
+/***************************************************************************//**
+ * mss_sched_stop() makes mss_sched_worker() return on all the harts, once
+ * they complete the task they are running. Parked workers are woken.
+ */
+void mss_sched_stop(mss_sched_t * sched);
+
+/***************************************************************************//**
+ * mss_sched_spawn() adds a task calling fn for the indexes from begin to end
+ * to the group, split into ranges of at least grain indexes, a grain of 0
+ * being taken as 1. The task is pushed to the deque of the calling hart, or
+ * run before returning if the deque is full.
+ */
+void mss_sched_spawn(mss_sched_t * sched, mss_task_group_t * group,
+        mss_task_fn_t fn, void * arg, uint64_t begin, uint64_t end,
+        uint64_t grain);
+
+/***************************************************************************//**
+ * mss_sched_wait() runs tasks on the calling hart until all the tasks of the
+ * group have completed.
+ */
+void mss_sched_wait(mss_sched_t * sched, mss_task_group_t * group);
+
+/***************************************************************************//**
+ * mss_parallel_for() calls fn for the indexes from begin to end, in ranges of
+ * at least grain indexes, on the calling hart and any idle harts, and returns
+ * when all the ranges are done. The task group is on the stack of the calling
+ * hart, which the other harts must be able to access.
+ */
+void mss_parallel_for(mss_sched_t * sched, uint64_t begin, uint64_t end,
+        uint64_t grain, mss_task_fn_t fn, void * arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_TASK_SCHED_H */
@@ -100,18 +100,23 @@ uint64_t readmcycle(void)
     return (read_csr(mcycle));
 }
 
+/**
+ * sleep_ms(uint64_t msecs)
+ * The wait is in mtime ticks, as it always has been, and is spent in wfi, see
+ * mss_idle_sleep_until()
+ * @param number of mtime ticks to sleep
+ */
 void sleep_ms(uint64_t msecs)
 {
     uint64_t starttime = readmtime();
-    volatile uint64_t endtime = 0U;
 
-    while(endtime < (starttime+msecs)) {
-        endtime = readmtime();
-    }
+    mss_idle_sleep_until(starttime + msecs);
 }
 
 /**
  * sleep_cycles(uint64_t ncycles)
+ * Waits of more than a few microseconds are spent in wfi, the remainder is
+ * polled on mcycle
  * @param number of cycles to sleep
  */
 void sleep_cycles(uint64_t ncycles)
@@ -119,6 +124,13 @@ void sleep_cycles(uint64_t ncycles)
     uint64_t starttime = readmcycle();
     volatile uint64_t endtime = 0U;
 
+    /* CPU cycles to mtime ticks, split so as not to overflow */
+    mss_idle_sleep_until(readmtime() +
+            ((ncycles / LIBERO_SETTING_MSS_COREPLEX_CPU_CLK) *
+            MSS_IDLE_MTIME_HZ) +
+            (((ncycles % LIBERO_SETTING_MSS_COREPLEX_CPU_CLK) *
+            MSS_IDLE_MTIME_HZ) / LIBERO_SETTING_MSS_COREPLEX_CPU_CLK));
+
     while(endtime < (starttime + ncycles)) {
         endtime = readmcycle();
     }
@@ -131,7 +143,11 @@ void sleep_cycles(uint64_t ncycles)
 __attribute__((aligned(16))) uint64_t get_program_counter(void)
 {
     uint64_t prog_counter;
+#if defined(MPFS_HAL_HOST_MODEL)
+    prog_counter = (uint64_t)(uintptr_t)__builtin_return_address(0);
+#else
     asm volatile ("auipc %0, 0" : "=r"(prog_counter));
+#endif
     return (prog_counter);
 }
 
@@ -142,7 +158,11 @@ __attribute__((aligned(16))) uint64_t get_program_counter(void)
 uint64_t get_stack_pointer(void)
 {
     uint64_t stack_pointer;
+#if defined(MPFS_HAL_HOST_MODEL)
+    stack_pointer = (uint64_t)(uintptr_t)__builtin_frame_address(0);
+#else
     asm volatile ("addi %0, sp, 0" : "=r"(stack_pointer));
+#endif
     return (stack_pointer);
 }
 
@@ -157,7 +177,12 @@ uint64_t get_stack_pointer(void)
 uint64_t get_tp_reg(void)
 {
     uint64_t tp_reg_val;
+#if defined(MPFS_HAL_HOST_MODEL)
+    /* No hart local storage on the host */
+    tp_reg_val = 0U;
+#else
     asm volatile ("addi %0, tp, 0" : "=r"(tp_reg_val));
+#endif
     return (tp_reg_val);
 }
 
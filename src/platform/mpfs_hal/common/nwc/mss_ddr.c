@@ -57,6 +57,28 @@
  */
 mss_ddr_calibration calib_data;
 
+/*
+ * Time spent in each training phase, see get_ddr_training_timing()
+ */
+static mss_ddr_timing ddr_timing;
+
+#ifdef DDR_CALIB_CACHE
+/*
+ * Training results of the previous boot, see ddr_calib_cache_load()
+ */
+static mss_ddr_calib_cache calib_cache;
+#endif
+
+#ifdef DDR_SELF_REFRESH_RESUME
+/*
+ * ddr_sr_resume is set while the DDR is being brought out of self-refresh,
+ * ddr_sr_resumed once it has been without its contents being touched, see
+ * ddr_self_refresh_resumed()
+ */
+static uint8_t ddr_sr_resume = 0U;
+static uint8_t ddr_sr_resumed = 0U;
+#endif
+
 /* rx lane FIFO used for tuning  */
 #if (TUNE_RPC_166_VALUE == 1)
 static uint32_t rpc_166_fifo_offset;
@@ -100,17 +122,36 @@ uint8_t sweep_results[MAX_NUMBER_DPC_VS_GEN_SWEEPS]\
  */
 static uint32_t ddr_setup(void);
 static void init_ddrc(void);
+static uint32_t addr_map_field(const uint32_t * p_regs, uint32_t field);
+static void addr_map_set_field(uint32_t * p_regs, uint32_t field,\
+        uint32_t value);
 static uint8_t write_calibration_using_mtc(uint8_t num_of_lanes_to_calibrate);
 /*static uint8_t mode_register_write(uint32_t MR_ADDR, uint32_t MR_DATA);*/
+static void MTC_start(uint8_t mask, uint64_t start_address, uint32_t size, MTC_PATTERN data_pattern, MTC_ADD_PATTERN add_pattern);
 static uint8_t MTC_test(uint8_t mask, uint64_t start_address, uint32_t size, MTC_PATTERN pattern, MTC_ADD_PATTERN add_pattern, uint32_t *error);
+static uint8_t mtc_test_next(mss_ddr_mtc_test * p_test);
+static void mtc_test_run(const mss_ddr_mtc_test * p_test);
 #ifdef VREFDQ_CALIB
 static uint8_t FPGA_VREFDQ_calibration_using_mtc(void);
 static uint8_t VREFDQ_calibration_using_mtc(void);
 #endif
 #ifdef DDR_SANITY_CHECKS_EN
 static uint8_t rw_sanity_chk(uint64_t * address, uint32_t count);
+#endif
+#if defined(DDR_SANITY_CHECKS_EN) || defined(DDR_CALIB_CACHE)
 static uint8_t mtc_sanity_check(uint64_t start_address);
 #endif
+#ifdef DDR_TRAINING_TIMING
+static DDR_TIMING_PHASE ddr_timing_phase(DDR_TRAINING_SM state);
+static void ddr_timing_record(DDR_TRAINING_SM state, uint64_t entry_time);
+#endif
+#ifdef DDR_CALIB_CACHE
+static uint32_t calib_cache_checksum(const mss_ddr_calib_cache * p_cache);
+static uint8_t calib_cache_read(void);
+static uint8_t calib_cache_restore(DDR_TYPE ddr_type, uint8_t lanes,\
+        uint8_t check);
+static void calib_cache_write(uint32_t tip_cfg_params, uint32_t dpc_bits);
+#endif
 #ifdef SET_VREF_LPDDR4_MODE_REGS
 static uint8_t mode_register_write(uint32_t MR_ADDR, uint32_t MR_DATA);
 #endif
@@ -237,9 +278,17 @@ static uint32_t ddr_setup(void)
     static  uint8_t refclk_sweep_index =0xFU;
 #endif
     static uint32_t bclk_answer = 0U;
+#ifdef DDR_CALIB_CACHE
+    static uint8_t calib_cache_checked = 0U;
+    static uint8_t use_calib_cache = 0U;
+#endif
     DDR_TYPE ddr_type;
     uint32_t ret_status = 0U;
     uint8_t number_of_lanes_to_calibrate;
+#ifdef DDR_TRAINING_TIMING
+    const DDR_TRAINING_SM entry_state = ddr_training_state;
+    const uint64_t entry_time = readmtime();
+#endif
 
     ddr_type = LIBERO_SETTING_DDRPHY_MODE & DDRPHY_MODE_MASK;
 
@@ -265,9 +314,39 @@ static uint32_t ddr_setup(void)
             error = 0U;
             memfill((uint8_t *)&calib_data,0U,sizeof(calib_data));
             retry_count = 0U;
+#ifdef DDR_CALIB_CACHE
+            if (calib_cache_checked == 0U)
+            {
+                calib_cache_checked = 1U;
+                use_calib_cache = calib_cache_read();
+            }
+            if (use_calib_cache == 1U)
+            {
+                /*
+                 * Train with the offsets and bank voltage found on a previous
+                 * boot, so that no sweep is needed
+                 */
+                tip_cfg_params = calib_cache.tip_cfg_params;
+                dpc_bits = calib_cache.dpc_bits;
+            }
+#endif
+#ifdef DDR_SELF_REFRESH_RESUME
+            /*
+             * The DDR can only be brought out of self-refresh with cached
+             * results, full training writes to it
+             */
+            if ((use_calib_cache == 1U) && (mss_resume_pending() == 1U))
+            {
+                ddr_sr_resume = 1U;
+            }
+            else
+            {
+                ddr_sr_resume = 0U;
+            }
+#endif
 #ifdef DEBUG_DDR_INIT
             (void)uprint32(g_debug_uart, "\n\r Start training. TIP_CFG_PARAMS:"\
-                    , LIBERO_SETTING_TIP_CFG_PARAMS);
+                    , tip_cfg_params);
 #endif
 #ifdef SWEEP_ENABLED
             addr_cmd_value = LIBERO_SETTING_TIP_CFG_PARAMS\
@@ -378,6 +457,32 @@ static uint32_t ddr_setup(void)
             ddr_training_state = DDR_CHECK_TRAINING_SWEEP;
             break;
         case DDR_TRAINING_FAIL:
+#ifdef DDR_CALIB_CACHE
+            if (use_calib_cache == 1U)
+            {
+                /*
+                 * The cached results no longer work, train from scratch
+                 */
+#ifdef DEBUG_DDR_INIT
+                (void)uprint32(g_debug_uart, "\n\r Cached training rejected: ",\
+                        ddr_training_state);
+#endif
+                use_calib_cache = 0U;
+#ifdef DDR_SELF_REFRESH_RESUME
+                /*
+                 * Full training overwrites part of the DDR, so its contents
+                 * are lost and the boot is a cold one
+                 */
+                ddr_sr_resume = 0U;
+#endif
+                DDRCFG->DFI.PHY_DFI_INIT_START.PHY_DFI_INIT_START   = 0x0U;
+                /* reset controller */
+                DDRCFG->MC_BASE2.CTRLR_INIT.CTRLR_INIT = 0x0U;
+                CFG_DDR_SGMII_PHY->training_start.training_start = 0x0U;
+                ddr_training_state = DDR_TRAINING_INIT;
+                break;
+            }
+#endif
 #ifdef DEBUG_DDR_INIT
             {
                 tip_register_status (g_debug_uart);
@@ -846,6 +951,19 @@ static uint32_t ddr_setup(void)
              */
             {
                 init_ddrc();
+#ifdef DDR_SELF_REFRESH_RESUME
+                if (ddr_sr_resume == 1U)
+                {
+                    /*
+                     * The DDR is in self-refresh: no reset or mode register
+                     * writes from the controller, which starts in
+                     * self-refresh too
+                     */
+                    DDRCFG->MC_BASE2.CFG_CTRLR_INIT_DISABLE.CFG_CTRLR_INIT_DISABLE\
+                        = 0x1U;
+                    DDRCFG->MC_BASE2.INIT_SELF_REFRESH.INIT_SELF_REFRESH = 0x1U;
+                }
+#endif
                 ddr_training_state = DDR_TRAINING_RESET;
             }
             break;
@@ -1180,6 +1298,28 @@ static uint32_t ddr_setup(void)
                 CFG_DDR_SGMII_PHY->lane_alignment_fifo_control.lane_alignment_fifo_control = 0x00U;
                 CFG_DDR_SGMII_PHY->lane_alignment_fifo_control.lane_alignment_fifo_control = 0x02U;
 #endif
+#ifdef DDR_SELF_REFRESH_RESUME
+                if (ddr_sr_resume == 1U)
+                {
+                    /*
+                     * DFI is up, take the DDR out of self-refresh before the
+                     * training state machine uses it
+                     */
+                    uint32_t sr_timeout = 0xFFFFU;
+
+                    DDRCFG->MC_BASE2.INIT_SELF_REFRESH.INIT_SELF_REFRESH = 0x0U;
+                    while (((DDRCFG->MC_BASE2.INIT_SELF_REFRESH_STATUS.\
+                            INIT_SELF_REFRESH_STATUS & 0x01U) != 0U) &&\
+                            (sr_timeout != 0U))
+                    {
+                        sr_timeout--;
+                    }
+                    if (sr_timeout == 0U)
+                    {
+                        ddr_error_count++;
+                    }
+                }
+#endif
 
 #ifdef DEBUG_DDR_INIT
                 (void)uprint32(g_debug_uart, \
@@ -1463,6 +1603,39 @@ static uint32_t ddr_setup(void)
              *
              */
             number_of_lanes_to_calibrate = get_num_lanes();
+#ifdef DDR_CALIB_CACHE
+            if (use_calib_cache == 1U)
+            {
+                /*
+                 * Restore the write calibration found on a previous boot and
+                 * check it, instead of searching for it again
+                 */
+#ifdef DDR_SELF_REFRESH_RESUME
+                if ((error == 0U) && (ddr_sr_resume == 1U))
+                {
+                    /*
+                     * No memory test, the DDR holds the suspended state. Go
+                     * straight to the end of training.
+                     */
+                    (void)calib_cache_restore(ddr_type,\
+                            number_of_lanes_to_calibrate, 0U);
+                    ddr_training_state = DDR_TRAINING_FINISH_CHECK;
+                    break;
+                }
+#endif
+                if ((error == 0U) && (calib_cache_restore(ddr_type,\
+                        number_of_lanes_to_calibrate, 1U) == 0U))
+                {
+                    ddr_training_state = DDR_SWEEP_CHECK;
+                }
+                else
+                {
+                    error = 0U;
+                    ddr_training_state = DDR_TRAINING_FAIL;
+                }
+                break;
+            }
+#endif
             /*
              *  Now start the write calibration as training has been successful
              */
@@ -1843,6 +2016,9 @@ static uint32_t ddr_setup(void)
 #ifdef DEBUG_DDR_INIT
             {
                 tip_register_status (g_debug_uart);
+#ifdef DDR_TRAINING_TIMING
+                training_timing_status(g_debug_uart);
+#endif
                 (void)uprint32(g_debug_uart, "\n\r\n\r DDR_TRAINING_PASS: ",\
                         ddr_training_state);
                 (void)uprint32(g_debug_uart, "\n ****************************************************", 0);
@@ -1859,7 +2035,27 @@ static uint32_t ddr_setup(void)
                  * Configure Segments- address mapping,  CFG0/CFG1
                  */
                 setup_ddr_segments(LIBERO_SEG_SETUP);
+#ifdef DDR_CALIB_CACHE
+                if (use_calib_cache == 0U)
+                {
+                    calib_cache_write(tip_cfg_params, dpc_bits);
+                }
+#endif
+#ifdef DDR_SELF_REFRESH_RESUME
+                if (ddr_sr_resume == 1U)
+                {
+                    ddr_sr_resumed = 1U;
+                }
+#endif
+            }
+#ifdef DDR_SELF_REFRESH_RESUME
+            if (ddr_sr_resume == 1U)
+            {
+                DDRCFG->MC_BASE2.CFG_CTRLR_INIT_DISABLE.CFG_CTRLR_INIT_DISABLE\
+                    = LIBERO_SETTING_CFG_CTRLR_INIT_DISABLE;
+                ddr_sr_resume = 0U;
             }
+#endif
             ret_status |= DDR_SETUP_DONE;
             ddr_training_state = DDR_TRAINING_FINISHED;
             break;
@@ -1869,6 +2065,9 @@ static uint32_t ddr_setup(void)
               break;
     } /* end of case statement */
 
+#ifdef DDR_TRAINING_TIMING
+    ddr_timing_record(entry_state, entry_time);
+#endif
     return (ret_status);
 }
 
@@ -2637,12 +2836,26 @@ static uint8_t read_back_sanity_check(uint64_t * address, uint32_t count)
  * @param start_address
  * @return non zero if error
  */
-#ifdef DDR_SANITY_CHECKS_EN
+#if defined(DDR_SANITY_CHECKS_EN) || defined(DDR_CALIB_CACHE)
 static uint8_t mtc_sanity_check(uint64_t start_address)
 {
     uint8_t result;
-    uint64_t size = 4U;
-    result = MTC_test((0xFU), start_address, size );
+    uint8_t mask;
+    uint32_t error = 0U;
+    uint32_t size = 4U;
+
+    if (get_num_lanes() <= 3U)
+    {
+        mask = 0x3U;
+    }
+    else
+    {
+        mask = 0xFU;
+    }
+    result = MTC_test(mask, start_address, size, MTC_COUNTING_PATTERN,\
+            MTC_ADD_SEQUENTIAL, &error);
+    result |= MTC_test(mask, start_address, size, MTC_PSEUDO_RANDOM,\
+            MTC_ADD_RANDOM, &error);
     return result;
 }
 #endif
@@ -3288,23 +3501,17 @@ static uint8_t VREFDQ_calibration_using_mtc(void)
 #endif
 
 /***************************************************************************//**
- * MTC_test
- * test memory using the NWL memory test core
- * There are numerous options
- * todo: Add user input as to option to use?
- * @param laneToTest
- * @param mask0
- * @param mask1   some lane less DQ as only used for parity
+ * MTC_start
+ * Configures the NWL memory test core and starts a single test, without
+ * waiting for it to complete
+ * @param mask lanes to check
  * @param start_address
  * @param size = x, where x is used as power of two 2**x e.g. 256K => x == 18
- * @return pass/fail
+ * @param data_pattern
+ * @param add_pattern
  */
-static uint8_t MTC_test(uint8_t mask, uint64_t start_address, uint32_t size, MTC_PATTERN data_pattern, MTC_ADD_PATTERN add_pattern, uint32_t *error)
+static void MTC_start(uint8_t mask, uint64_t start_address, uint32_t size, MTC_PATTERN data_pattern, MTC_ADD_PATTERN add_pattern)
 {
-    if((*error & MTC_TIMEOUT_ERROR) == MTC_TIMEOUT_ERROR)
-    {
-        return (uint8_t)*error;
-    }
     /* Write Calibration - first configure memory test */
     {
         /*
@@ -3474,6 +3681,31 @@ static uint8_t MTC_test(uint8_t mask, uint64_t start_address, uint32_t size, MTC
         */
         DDRCFG->MEM_TEST.MT_EN_SINGLE.MT_EN_SINGLE = 0x00U;
         DDRCFG->MEM_TEST.MT_EN_SINGLE.MT_EN_SINGLE = 0x01U;
+        }
+    }
+}
+
+/***************************************************************************//**
+ * MTC_test
+ * test memory using the NWL memory test core
+ * There are numerous options
+ * todo: Add user input as to option to use?
+ * @param laneToTest
+ * @param mask0
+ * @param mask1   some lane less DQ as only used for parity
+ * @param start_address
+ * @param size = x, where x is used as power of two 2**x e.g. 256K => x == 18
+ * @return pass/fail
+ */
+static uint8_t MTC_test(uint8_t mask, uint64_t start_address, uint32_t size, MTC_PATTERN data_pattern, MTC_ADD_PATTERN add_pattern, uint32_t *error)
+{
+    if((*error & MTC_TIMEOUT_ERROR) == MTC_TIMEOUT_ERROR)
+    {
+        return (uint8_t)*error;
+    }
+    MTC_start(mask, start_address, size, data_pattern, add_pattern);
+
+    {
         /*
         * MT_DONE_ACK
         * Set when test completes
@@ -3495,7 +3727,6 @@ static uint8_t MTC_test(uint8_t mask, uint64_t start_address, uint32_t size, MTC
             #endif
         }
         #endif
-        }
     }
     /*
     * MT_ERROR_STS
@@ -3517,8 +3748,12 @@ static uint8_t MTC_test(uint8_t mask, uint64_t start_address, uint32_t size, MTC
 
 static void init_ddrc(void)
 {
+    mss_ddr_addr_map addr_map;
+
+    (void)ddr_get_addr_map(DDR_ADDR_MAP_PROFILE_SELECT, &addr_map);
+
     DDRCFG->ADDR_MAP.CFG_MANUAL_ADDRESS_MAP.CFG_MANUAL_ADDRESS_MAP =\
-        LIBERO_SETTING_CFG_MANUAL_ADDRESS_MAP;
+        addr_map.manual;
     DDRCFG->ADDR_MAP.CFG_CHIPADDR_MAP.CFG_CHIPADDR_MAP =\
         LIBERO_SETTING_CFG_CHIPADDR_MAP;
     DDRCFG->ADDR_MAP.CFG_CIDADDR_MAP.CFG_CIDADDR_MAP =\
@@ -3528,23 +3763,23 @@ static void init_ddrc(void)
     DDRCFG->ADDR_MAP.CFG_MB_AUTOPCH_COL_BIT_POS_HIGH.CFG_MB_AUTOPCH_COL_BIT_POS_HIGH =\
         LIBERO_SETTING_CFG_MB_AUTOPCH_COL_BIT_POS_HIGH;
     DDRCFG->ADDR_MAP.CFG_BANKADDR_MAP_0.CFG_BANKADDR_MAP_0 =\
-        LIBERO_SETTING_CFG_BANKADDR_MAP_0;
+        addr_map.bank[0];
     DDRCFG->ADDR_MAP.CFG_BANKADDR_MAP_1.CFG_BANKADDR_MAP_1 =\
-        LIBERO_SETTING_CFG_BANKADDR_MAP_1;
+        addr_map.bank[1];
     DDRCFG->ADDR_MAP.CFG_ROWADDR_MAP_0.CFG_ROWADDR_MAP_0 =\
-        LIBERO_SETTING_CFG_ROWADDR_MAP_0;
+        addr_map.row[0];
     DDRCFG->ADDR_MAP.CFG_ROWADDR_MAP_1.CFG_ROWADDR_MAP_1 =\
-        LIBERO_SETTING_CFG_ROWADDR_MAP_1;
+        addr_map.row[1];
     DDRCFG->ADDR_MAP.CFG_ROWADDR_MAP_2.CFG_ROWADDR_MAP_2 =\
-        LIBERO_SETTING_CFG_ROWADDR_MAP_2;
+        addr_map.row[2];
     DDRCFG->ADDR_MAP.CFG_ROWADDR_MAP_3.CFG_ROWADDR_MAP_3 =\
-        LIBERO_SETTING_CFG_ROWADDR_MAP_3;
+        addr_map.row[3];
     DDRCFG->ADDR_MAP.CFG_COLADDR_MAP_0.CFG_COLADDR_MAP_0 =\
-        LIBERO_SETTING_CFG_COLADDR_MAP_0;
+        addr_map.col[0];
     DDRCFG->ADDR_MAP.CFG_COLADDR_MAP_1.CFG_COLADDR_MAP_1 =\
-        LIBERO_SETTING_CFG_COLADDR_MAP_1;
+        addr_map.col[1];
     DDRCFG->ADDR_MAP.CFG_COLADDR_MAP_2.CFG_COLADDR_MAP_2 =\
-        LIBERO_SETTING_CFG_COLADDR_MAP_2;
+        addr_map.col[2];
     DDRCFG->MC_BASE3.CFG_VRCG_ENABLE.CFG_VRCG_ENABLE =\
         LIBERO_SETTING_CFG_VRCG_ENABLE;
     DDRCFG->MC_BASE3.CFG_VRCG_DISABLE.CFG_VRCG_DISABLE =\
@@ -4688,5 +4923,661 @@ static uint8_t ddr_manual_addcmd_refclk_offset(DDR_TYPE ddr_type, uint8_t * refc
 #endif
 
 
+/**
+ * ddr_get_addr_map
+ * See mss_ddr.h
+ * @param profile
+ * @param p_map
+ * @return 0U if successful
+ */
+uint8_t ddr_get_addr_map(DDR_ADDR_MAP_PROFILE profile, mss_ddr_addr_map * p_map)
+{
+    uint8_t error = 0U;
+    uint32_t positions[DDR_ADDR_MAP_BANK_FIELDS + DDR_ADDR_MAP_ROW_FIELDS +\
+                       DDR_ADDR_MAP_COL_FIELDS];
+    uint32_t n_bank = 0U;
+    uint32_t n_row = 0U;
+    uint32_t n_col = 1U;
+    uint32_t n_line = 0U;
+    uint32_t field;
+    uint32_t next = 0U;
+    uint64_t used = 0U;
+    uint64_t bit;
+
+    p_map->manual = LIBERO_SETTING_CFG_MANUAL_ADDRESS_MAP;
+    p_map->bank[0] = LIBERO_SETTING_CFG_BANKADDR_MAP_0;
+    p_map->bank[1] = LIBERO_SETTING_CFG_BANKADDR_MAP_1;
+    p_map->row[0] = LIBERO_SETTING_CFG_ROWADDR_MAP_0;
+    p_map->row[1] = LIBERO_SETTING_CFG_ROWADDR_MAP_1;
+    p_map->row[2] = LIBERO_SETTING_CFG_ROWADDR_MAP_2;
+    p_map->row[3] = LIBERO_SETTING_CFG_ROWADDR_MAP_3;
+    p_map->col[0] = LIBERO_SETTING_CFG_COLADDR_MAP_0;
+    p_map->col[1] = LIBERO_SETTING_CFG_COLADDR_MAP_1;
+    p_map->col[2] = LIBERO_SETTING_CFG_COLADDR_MAP_2;
+
+    if ((profile != DDR_ADDR_MAP_LIBERO) &&\
+        (profile < DDR_NUM_ADDR_MAP_PROFILES))
+    {
+        /*
+         * Address bits used by the Libero mapping. Unused fields are 0,
+         * except for the first column bit which can be address bit 0.
+         */
+        while ((n_bank < DDR_ADDR_MAP_BANK_FIELDS) &&\
+                (addr_map_field(p_map->bank, n_bank) != 0U))
+        {
+            n_bank++;
+        }
+        while ((n_row < DDR_ADDR_MAP_ROW_FIELDS) &&\
+                (addr_map_field(p_map->row, n_row) != 0U))
+        {
+            n_row++;
+        }
+        while ((n_col < DDR_ADDR_MAP_COL_FIELDS) &&\
+                (addr_map_field(p_map->col, n_col) != 0U))
+        {
+            n_col++;
+        }
+
+        for (field = 0U; field < (n_bank + n_row + n_col); field++)
+        {
+            if (field < n_bank)
+            {
+                bit = 1ULL << addr_map_field(p_map->bank, field);
+            }
+            else if (field < (n_bank + n_row))
+            {
+                bit = 1ULL << addr_map_field(p_map->row, field - n_bank);
+            }
+            else
+            {
+                bit = 1ULL << addr_map_field(p_map->col,\
+                        field - n_bank - n_row);
+            }
+
+            if ((used & bit) != 0U)
+            {
+                error = 1U;
+            }
+            used |= bit;
+        }
+
+        if ((n_bank == 0U) || (n_row == 0U))
+        {
+            error = 1U;
+        }
+    }
+    else
+    {
+        error = 2U;
+    }
+
+    if (error == 0U)
+    {
+        /*
+         * Hand the address bits out again, lowest first, in profile order
+         */
+        for (field = 0U; field < 64U; field++)
+        {
+            if ((used & (1ULL << field)) != 0U)
+            {
+                positions[next] = field;
+                next++;
+            }
+        }
+        next = 0U;
+
+        n_line = n_col;
+        if ((profile == DDR_ADDR_MAP_LINE_INTERLEAVE) &&\
+            (DDR_ADDR_MAP_LINE_COL_BITS < n_col))
+        {
+            n_line = DDR_ADDR_MAP_LINE_COL_BITS;
+        }
+
+        for (field = 0U; field < n_line; field++)
+        {
+            addr_map_set_field(p_map->col, field, positions[next]);
+            next++;
+        }
+
+        if (profile != DDR_ADDR_MAP_BANK_ROW_COL)
+        {
+            for (field = 0U; field < n_bank; field++)
+            {
+                addr_map_set_field(p_map->bank, field, positions[next]);
+                next++;
+            }
+        }
+
+        for (field = n_line; field < n_col; field++)
+        {
+            addr_map_set_field(p_map->col, field, positions[next]);
+            next++;
+        }
+
+        for (field = 0U; field < n_row; field++)
+        {
+            addr_map_set_field(p_map->row, field, positions[next]);
+            next++;
+        }
+
+        if (profile == DDR_ADDR_MAP_BANK_ROW_COL)
+        {
+            for (field = 0U; field < n_bank; field++)
+            {
+                addr_map_set_field(p_map->bank, field, positions[next]);
+                next++;
+            }
+        }
+
+        p_map->manual = 1U;
+    }
+    else if (error == 2U)
+    {
+        /* Libero mapping asked for */
+        error = 0U;
+    }
+    else
+    {
+        /* Libero mapping kept */
+    }
+
+    return (error);
+}
+
+/**
+ * Reads 6 bit field number field of a set of address mapping registers
+ * @param p_regs
+ * @param field
+ * @return address bit
+ */
+static uint32_t addr_map_field(const uint32_t * p_regs, uint32_t field)
+{
+    uint32_t bit = field * DDR_ADDR_MAP_FIELD_BITS;
+    uint32_t value = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < DDR_ADDR_MAP_FIELD_BITS; i++)
+    {
+        value |= ((p_regs[(bit + i) / 32U] >> ((bit + i) % 32U)) & 1U) << i;
+    }
+
+    return (value);
+}
+
+/**
+ * Writes 6 bit field number field of a set of address mapping registers
+ * @param p_regs
+ * @param field
+ * @param value
+ */
+static void addr_map_set_field(uint32_t * p_regs, uint32_t field,\
+        uint32_t value)
+{
+    uint32_t bit = field * DDR_ADDR_MAP_FIELD_BITS;
+    uint32_t i;
+
+    for (i = 0U; i < DDR_ADDR_MAP_FIELD_BITS; i++)
+    {
+        p_regs[(bit + i) / 32U] &= ~(1UL << ((bit + i) % 32U));
+        p_regs[(bit + i) / 32U] |= ((value >> i) & 1U) << ((bit + i) % 32U);
+    }
+}
+
+/**
+ * get_ddr_training_timing
+ * @return time spent in each training phase
+ */
+const mss_ddr_timing * get_ddr_training_timing(void)
+{
+    return (&ddr_timing);
+}
+
+/**
+ * ddr_mtc_test_start
+ * See mss_ddr.h
+ * @param p_test
+ * @return status of the test
+ */
+DDR_MTC_TEST_STATUS ddr_mtc_test_start(mss_ddr_mtc_test * p_test)
+{
+    uint8_t lane;
+
+    if (p_test->lane_mask == 0U)
+    {
+        if (get_num_lanes() <= 3U)
+        {
+            p_test->lane_mask = 0x3U;
+        }
+        else
+        {
+            p_test->lane_mask = 0xFU;
+        }
+    }
+
+    for (lane = 0U; lane < MAX_LANES; lane++)
+    {
+        p_test->lane_errors[lane] = 0U;
+    }
+    p_test->runs = 0U;
+    p_test->polls = 0U;
+    p_test->block = 0U;
+    p_test->data_pattern = 0U;
+    p_test->add_pattern = 0U;
+    p_test->lane = 0U;
+
+    /* find the first combination asked for */
+    if ((((p_test->data_patterns >> p_test->data_pattern) & 1U) != 0U) &&\
+        (((p_test->add_patterns >> p_test->add_pattern) & 1U) != 0U) &&\
+        (((p_test->lane_mask >> p_test->lane) & 1U) != 0U) &&\
+        (p_test->blocks != 0U))
+    {
+        p_test->status = DDR_MTC_TEST_BUSY;
+    }
+    else if (mtc_test_next(p_test) != 0U)
+    {
+        p_test->status = DDR_MTC_TEST_BUSY;
+    }
+    else
+    {
+        p_test->status = DDR_MTC_TEST_DONE;
+    }
+
+    if (p_test->status == DDR_MTC_TEST_BUSY)
+    {
+        mtc_test_run(p_test);
+    }
+
+    return (p_test->status);
+}
+
+/**
+ * ddr_mtc_test_poll
+ * See mss_ddr.h
+ * @param p_test
+ * @return status of the test
+ */
+DDR_MTC_TEST_STATUS ddr_mtc_test_poll(mss_ddr_mtc_test * p_test)
+{
+    if (p_test->status == DDR_MTC_TEST_BUSY)
+    {
+        if ((DDRCFG->MEM_TEST.MT_DONE_ACK.MT_DONE_ACK & 0x01U) != 0U)
+        {
+            if ((DDRCFG->MEM_TEST.MT_ERROR_STS.MT_ERROR_STS & 0x01U) != 0U)
+            {
+                p_test->lane_errors[p_test->lane]++;
+            }
+            p_test->runs++;
+            p_test->polls = 0U;
+
+            if (mtc_test_next(p_test) != 0U)
+            {
+                mtc_test_run(p_test);
+            }
+            else
+            {
+                p_test->status = DDR_MTC_TEST_DONE;
+            }
+        }
+        else
+        {
+            p_test->polls++;
+            if (p_test->polls > DDR_MTC_TEST_POLL_TIMEOUT)
+            {
+                p_test->status = DDR_MTC_TEST_TIMEOUT;
+            }
+        }
+    }
+
+    return (p_test->status);
+}
+
+/**
+ * mtc_test_next
+ * Moves a test on to the next combination of lane, block, address pattern and
+ * data pattern asked for. Random address runs all cover the start of DDR, so
+ * they are made for the first block only.
+ * @param p_test
+ * @return 1U if there is a run left to do
+ */
+static uint8_t mtc_test_next(mss_ddr_mtc_test * p_test)
+{
+    uint8_t found = 0U;
+    uint8_t finished = 0U;
+
+    while ((found == 0U) && (finished == 0U))
+    {
+        p_test->lane++;
+        if (p_test->lane >= MAX_LANES)
+        {
+            p_test->lane = 0U;
+            p_test->block++;
+            if ((p_test->block >= p_test->blocks) ||\
+                (p_test->add_pattern == (uint8_t)MTC_ADD_RANDOM))
+            {
+                p_test->block = 0U;
+                p_test->add_pattern++;
+                if (p_test->add_pattern > (uint8_t)MTC_ADD_RANDOM)
+                {
+                    p_test->add_pattern = 0U;
+                    p_test->data_pattern++;
+                    if (p_test->data_pattern > (uint8_t)MTC_PSEUDO_RANDOM_8BIT)
+                    {
+                        finished = 1U;
+                    }
+                }
+            }
+        }
+
+        if ((finished == 0U) && (p_test->blocks != 0U) &&\
+            (((p_test->lane_mask >> p_test->lane) & 1U) != 0U) &&\
+            (((p_test->add_patterns >> p_test->add_pattern) & 1U) != 0U) &&\
+            (((p_test->data_patterns >> p_test->data_pattern) & 1U) != 0U))
+        {
+            found = 1U;
+        }
+    }
+
+    return (found);
+}
+
+/**
+ * mtc_test_run
+ * Starts the memory test core run for the current combination of a test
+ * @param p_test
+ */
+static void mtc_test_run(const mss_ddr_mtc_test * p_test)
+{
+    uint64_t start_address = p_test->start_address +\
+            ((uint64_t)p_test->block << p_test->size);
+
+    MTC_start((uint8_t)(1U << p_test->lane), start_address, p_test->size,\
+            (MTC_PATTERN)p_test->data_pattern,\
+            (MTC_ADD_PATTERN)p_test->add_pattern);
+}
+
+#ifdef DDR_TRAINING_TIMING
+/**
+ * ddr_timing_phase
+ * @param state
+ * @return training phase the state belongs to
+ */
+static DDR_TIMING_PHASE ddr_timing_phase(DDR_TRAINING_SM state)
+{
+    DDR_TIMING_PHASE phase;
+
+    switch (state)
+    {
+        case DDR_TRAINING_CONFIG_PLL:
+        case DDR_TRAINING_VERIFY_PLL_LOCK:
+            phase = DDR_PHASE_PLL_LOCK;
+            break;
+
+        case DDR_TRAINING_IP_SM_BCLKSCLK_SW:
+        case DDR_TRAINING_IP_SM_BCLKSCLK:
+            phase = DDR_PHASE_BCLK_SCLK;
+            break;
+
+        case DDR_MANUAL_ADDCMD_TRAINING_SW:
+        case DDR_TRAINING_IP_SM_ADDCMD:
+            phase = DDR_PHASE_ADDCMD;
+            break;
+
+        case DDR_TRAINING_IP_SM_WRLVL:
+            phase = DDR_PHASE_WRLVL;
+            break;
+
+        case DDR_TRAINING_IP_SM_RDGATE:
+            phase = DDR_PHASE_RDGATE;
+            break;
+
+        case DDR_TRAINING_IP_SM_DQ_DQS:
+        case DDR_TRAINING_IP_SM_VERIFY:
+        case DDR_TRAINING_SET_FINAL_MODE:
+            phase = DDR_PHASE_DQ_DQS;
+            break;
+
+        case DDR_TRAINING_WRITE_CALIBRATION:
+        case DDR_TRAINING_WRITE_CALIBRATION_RETRY:
+            phase = DDR_PHASE_WRITE_CALIBRATION;
+            break;
+
+        case DDR_TRAINING_VREFDQ_CALIB:
+        case DDR_TRAINING_FPGA_VREFDQ_CALIB:
+            phase = DDR_PHASE_VREF_CALIBRATION;
+            break;
+
+        case DDR_SANITY_CHECKS:
+        case DDR_FULL_MTC_CHECK:
+        case DDR_FULL_32BIT_NC_CHECK:
+        case DDR_FULL_32BIT_CACHE_CHECK:
+        case DDR_LOAD_PATTERN_TO_CACHE:
+        case DDR_VERIFY_PATTERN_IN_CACHE:
+        case DDR_FULL_32BIT_WRC_CHECK:
+        case DDR_FULL_64BIT_NC_CHECK:
+        case DDR_FULL_64BIT_CACHE_CHECK:
+        case DDR_FULL_64BIT_WRC_CHECK:
+            phase = DDR_PHASE_MEMORY_TESTS;
+            break;
+
+        case DDR_TRAINING_FAIL:
+        case DDR_CHECK_TRAINING_SWEEP:
+        case DDR_TRAINING_SWEEP:
+        case DDR_SWEEP_CHECK:
+        case DDR_SWEEP_AGAIN:
+        case DDR_TRAINING_FAIL_SM2_VERIFY:
+        case DDR_TRAINING_FAIL_SM_VERIFY:
+        case DDR_TRAINING_FAIL_SM_DQ_DQS:
+        case DDR_TRAINING_FAIL_SM_RDGATE:
+        case DDR_TRAINING_FAIL_SM_WRLVL:
+        case DDR_TRAINING_FAIL_SM_ADDCMD:
+        case DDR_TRAINING_FAIL_SM_BCLKSCLK:
+        case DDR_TRAINING_FAIL_BCLKSCLK_SW:
+        case DDR_TRAINING_FAIL_FULL_32BIT_NC_CHECK:
+        case DDR_TRAINING_FAIL_32BIT_CACHE_CHECK:
+        case DDR_TRAINING_FAIL_MIN_LATENCY:
+        case DDR_TRAINING_FAIL_START_CHECK:
+        case DDR_TRAINING_FAIL_PLL_LOCK:
+        case DDR_TRAINING_FAIL_DDR_SANITY_CHECKS:
+            phase = DDR_PHASE_SWEEP;
+            break;
+
+        default:
+            phase = DDR_PHASE_SETUP;
+            break;
+    }
+
+    return (phase);
+}
+
+/**
+ * ddr_timing_record
+ * Adds the time spent in one call of ddr_setup() to the phase of the state it
+ * ran.
+ * @param state state run by the call
+ * @param entry_time mtime when the call started
+ */
+static void ddr_timing_record(DDR_TRAINING_SM state, uint64_t entry_time)
+{
+    const uint64_t now = readmtime();
+    DDR_TIMING_PHASE phase;
+
+    if ((state == DDR_TRAINING_INIT) && (ddr_timing.trainings == 0U))
+    {
+        memfill((uint8_t *)&ddr_timing, 0U, sizeof(ddr_timing));
+        ddr_timing.start = entry_time;
+    }
+
+    if (state == DDR_TRAINING_CHECK_FOR_OFFMODE)
+    {
+        /* each training attempt starts here */
+        ddr_timing.trainings++;
+    }
+
+    if (state != DDR_TRAINING_FINISHED)
+    {
+        phase = ddr_timing_phase(state);
+        ddr_timing.phase_ticks[phase] += now - entry_time;
+        ddr_timing.phase_entries[phase]++;
+        ddr_timing.end = now;
+    }
+}
+#endif /* DDR_TRAINING_TIMING */
+
+#ifdef DDR_CALIB_CACHE
+/**
+ * Default, nothing is saved between boots
+ * @param p_cache
+ * @return 1U, no record read
+ */
+__attribute__((weak)) uint8_t ddr_calib_cache_load(mss_ddr_calib_cache * p_cache)
+{
+    (void)p_cache;
+    return (1U);
+}
+
+/**
+ * Default, nothing is saved between boots
+ * @param p_cache
+ */
+__attribute__((weak)) void ddr_calib_cache_save(const mss_ddr_calib_cache * p_cache)
+{
+    (void)p_cache;
+}
+
+/**
+ * calib_cache_checksum
+ * @param p_cache
+ * @return checksum of all the record words before the checksum
+ */
+static uint32_t calib_cache_checksum(const mss_ddr_calib_cache * p_cache)
+{
+    const uint32_t * p_word = (const uint32_t *)p_cache;
+    uint32_t words = (uint32_t)(offsetof(mss_ddr_calib_cache, checksum) / 4U);
+    uint32_t sum = 0x5A5A5A5AUL;
+    uint32_t i;
+
+    for (i = 0U; i < words; i++)
+    {
+        sum = ((sum << 5U) | (sum >> 27U)) ^ p_word[i];
+    }
+
+    return (sum);
+}
+
+/**
+ * calib_cache_read
+ * Reads the results saved on a previous boot into calib_cache and checks they
+ * were found with the current Libero settings.
+ * @return 1U if the cached results can be used
+ */
+static uint8_t calib_cache_read(void)
+{
+    uint8_t valid = 0U;
+
+    memfill((uint8_t *)&calib_cache, 0U, sizeof(calib_cache));
+
+    if (ddr_calib_cache_load(&calib_cache) == 0U)
+    {
+        if ((calib_cache.magic == DDR_CALIB_CACHE_MAGIC) &&\
+            (calib_cache.version == DDR_CALIB_CACHE_VERSION) &&\
+            (calib_cache.libero_ddrphy_mode == LIBERO_SETTING_DDRPHY_MODE) &&\
+            (calib_cache.libero_tip_cfg_params ==\
+                                            LIBERO_SETTING_TIP_CFG_PARAMS) &&\
+            (calib_cache.libero_dpc_bits == LIBERO_SETTING_DPC_BITS) &&\
+            (calib_cache.checksum == calib_cache_checksum(&calib_cache)))
+        {
+            valid = 1U;
+        }
+    }
+
+#ifdef DEBUG_DDR_INIT
+    (void)uprint32(g_debug_uart, "\n\r Cached training results: ", valid);
+#endif
+    return (valid);
+}
+
+/**
+ * calib_cache_restore
+ * Sets the write latency, DQ delays and write calibration of calib_cache and
+ * checks them with the memory test core.
+ * @param ddr_type
+ * @param lanes
+ * @param check 0U to skip the check, which writes to the DDR
+ * @return 0U if the DDR passed the check
+ */
+static uint8_t calib_cache_restore(DDR_TYPE ddr_type, uint8_t lanes,\
+        uint8_t check)
+{
+    uint8_t result = 0U;
+
+    calib_data = calib_cache.calib;
+
+    DDRCFG->DFI.CFG_DFI_T_PHY_WRLAT.CFG_DFI_T_PHY_WRLAT =\
+            calib_cache.write_latency;
+
+    if (ddr_type == LPDDR4)
+    {
+        uint8_t lane;
+        /* Changed default value to centre dq/dqs on window */
+        CFG_DDR_SGMII_PHY->rpc220.rpc220 = 0xCUL;
+        for(lane = 0U; lane < lanes; lane++)
+        {
+            load_dq(lane);
+        }
+#ifdef SW_CONFIG_LPDDR_WR_CALIB_FN
+        set_calib_values(lanes);
+#else
+        set_write_calib(lanes);
+#endif
+    }
+    else
+    {
+        set_write_calib(lanes);
+    }
+
+    if (check != 0U)
+    {
+        result = mtc_sanity_check(0x0000000000000000ULL);
+    }
+
+    return (result);
+}
+
+/**
+ * calib_cache_write
+ * Records the results of a full training and hands them to
+ * ddr_calib_cache_save().
+ * @param tip_cfg_params
+ * @param dpc_bits
+ */
+static void calib_cache_write(uint32_t tip_cfg_params, uint32_t dpc_bits)
+{
+    memfill((uint8_t *)&calib_cache, 0U, sizeof(calib_cache));
+    calib_cache.magic = DDR_CALIB_CACHE_MAGIC;
+    calib_cache.version = DDR_CALIB_CACHE_VERSION;
+    calib_cache.libero_ddrphy_mode = LIBERO_SETTING_DDRPHY_MODE;
+    calib_cache.libero_tip_cfg_params = LIBERO_SETTING_TIP_CFG_PARAMS;
+    calib_cache.libero_dpc_bits = LIBERO_SETTING_DPC_BITS;
+    calib_cache.tip_cfg_params = tip_cfg_params;
+    calib_cache.dpc_bits = dpc_bits;
+    calib_cache.write_latency =\
+            DDRCFG->DFI.CFG_DFI_T_PHY_WRLAT.CFG_DFI_T_PHY_WRLAT;
+    calib_cache.calib = calib_data;
+    calib_cache.checksum = calib_cache_checksum(&calib_cache);
+
+    ddr_calib_cache_save(&calib_cache);
+}
+#endif /* DDR_CALIB_CACHE */
+
+#ifdef DDR_SELF_REFRESH_RESUME
+/***************************************************************************//**
+ * See mss_ddr.h
+ */
+uint8_t ddr_self_refresh_resumed(void)
+{
+    return (ddr_sr_resumed);
+}
+#endif /* DDR_SELF_REFRESH_RESUME */
+
 #endif /* DDR_SUPPORT */
 
@@ -1022,6 +1022,145 @@ typedef struct mss_ddr_calibration_{
   mss_ddr_vref mem_vref;
 } mss_ddr_calibration;
 
+/***************************************************************************//**
+  Training results kept between boots when DDR_CALIB_CACHE is defined.
+  The Libero settings the results were found with are recorded so that the
+  results are not used once the DDR configuration changes.
+ */
+#define DDR_CALIB_CACHE_MAGIC           0x44434331UL
+#define DDR_CALIB_CACHE_VERSION         1U
+
+typedef struct mss_ddr_calib_cache_{
+    uint32_t    magic;
+    uint32_t    version;
+    uint32_t    libero_ddrphy_mode;
+    uint32_t    libero_tip_cfg_params;
+    uint32_t    libero_dpc_bits;
+    uint32_t    tip_cfg_params;     /* add/cmd and bclk/sclk offsets used */
+    uint32_t    dpc_bits;           /* DPC VRGEN (FPGA VREF) bits used */
+    uint32_t    write_latency;      /* CFG_DFI_T_PHY_WRLAT used */
+    mss_ddr_calibration calib;      /* write calibration and DQ delays */
+    uint32_t    checksum;
+} mss_ddr_calib_cache;
+
+/***************************************************************************//**
+  Phases of the DDR training timed when DDR_TRAINING_TIMING is defined
+ */
+typedef enum DDR_TIMING_PHASE_
+{
+    DDR_PHASE_SETUP,                /*!< PHY, IO, DDRC and training set-up */
+    DDR_PHASE_PLL_LOCK,             /*!< DDR PLL configuration and lock   */
+    DDR_PHASE_BCLK_SCLK,            /*!< BCLK/SCLK training               */
+    DDR_PHASE_ADDCMD,               /*!< address/command training         */
+    DDR_PHASE_WRLVL,                /*!< write levelling                  */
+    DDR_PHASE_RDGATE,               /*!< read gate training               */
+    DDR_PHASE_DQ_DQS,               /*!< DQ/DQS training and verify       */
+    DDR_PHASE_WRITE_CALIBRATION,    /*!< write calibration                */
+    DDR_PHASE_VREF_CALIBRATION,     /*!< VREF calibration                 */
+    DDR_PHASE_MEMORY_TESTS,         /*!< sanity checks and memory tests   */
+    DDR_PHASE_SWEEP,                /*!< failures, retries and sweeps     */
+    DDR_NUM_TIMING_PHASES
+} DDR_TIMING_PHASE;
+
+/***************************************************************************//**
+  Time spent in each phase of the DDR training, in mtime ticks. A phase run
+  more than once, on a retry or during a sweep, is accumulated.
+ */
+typedef struct mss_ddr_timing_{
+    uint64_t    start;                          /* mtime at training start */
+    uint64_t    end;                            /* mtime at training end   */
+    uint64_t    phase_ticks[DDR_NUM_TIMING_PHASES];
+    uint32_t    phase_entries[DDR_NUM_TIMING_PHASES];
+    uint32_t    trainings;                      /* training attempts       */
+} mss_ddr_timing;
+
+/***************************************************************************//**
+  Status of a memory test core (MTC) test started by ddr_mtc_test_start()
+ */
+typedef enum DDR_MTC_TEST_STATUS_
+{
+    DDR_MTC_TEST_IDLE,              /*!< not started                      */
+    DDR_MTC_TEST_BUSY,              /*!< ddr_mtc_test_poll() to be called */
+    DDR_MTC_TEST_DONE,              /*!< all the runs completed           */
+    DDR_MTC_TEST_TIMEOUT            /*!< a run did not complete            */
+} DDR_MTC_TEST_STATUS;
+
+/*
+ * Number of ddr_mtc_test_poll() calls after which a run which has not
+ * completed is reported as a timeout
+ */
+#if !defined (DDR_MTC_TEST_POLL_TIMEOUT)
+#define DDR_MTC_TEST_POLL_TIMEOUT   0xFFFFFFUL
+#endif
+
+/***************************************************************************//**
+  Memory test core test of the DDR, see ddr_mtc_test_start().
+  The caller sets the fields up to lane_mask, the other fields are written by
+  ddr_mtc_test_start() and ddr_mtc_test_poll().
+ */
+typedef struct mss_ddr_mtc_test_{
+    uint64_t    start_address;      /* as seen by DDRC, 0 is start of DDR  */
+    uint32_t    size;               /* 2**size bytes tested per run       */
+    uint32_t    blocks;             /* consecutive blocks of 2**size bytes */
+    uint32_t    data_patterns;      /* bit mask of (1 << MTC_PATTERN)      */
+    uint8_t     add_patterns;       /* bit mask of (1 << MTC_ADD_PATTERN)  */
+    uint8_t     lane_mask;          /* lanes tested, 0 for all data lanes  */
+    DDR_MTC_TEST_STATUS status;
+    uint32_t    runs;               /* runs completed                     */
+    uint32_t    lane_errors[MAX_LANES]; /* runs failed on each lane       */
+    uint32_t    polls;
+    uint32_t    block;
+    uint8_t     data_pattern;
+    uint8_t     add_pattern;
+    uint8_t     lane;
+} mss_ddr_mtc_test;
+
+/***************************************************************************//**
+  DDR controller address mapping profiles, see ddr_get_addr_map()
+ */
+typedef enum DDR_ADDR_MAP_PROFILE_
+{
+    DDR_ADDR_MAP_LIBERO,            /*!< mapping set by Libero             */
+    DDR_ADDR_MAP_ROW_BANK_COL,      /*!< page interleave across banks      */
+    DDR_ADDR_MAP_BANK_ROW_COL,      /*!< one contiguous region per bank    */
+    DDR_ADDR_MAP_LINE_INTERLEAVE,   /*!< cache line interleave across banks */
+    DDR_NUM_ADDR_MAP_PROFILES
+} DDR_ADDR_MAP_PROFILE;
+
+/*
+ * Profile used by the DDR set up
+ */
+#if !defined (DDR_ADDR_MAP_PROFILE_SELECT)
+#define DDR_ADDR_MAP_PROFILE_SELECT     DDR_ADDR_MAP_LIBERO
+#endif
+
+/*
+ * Number of column bits kept below the bank bits by
+ * DDR_ADDR_MAP_LINE_INTERLEAVE, 16 columns of 4 bytes for a 64 byte cache line
+ * on a 32 bit bus
+ */
+#if !defined (DDR_ADDR_MAP_LINE_COL_BITS)
+#define DDR_ADDR_MAP_LINE_COL_BITS      4U
+#endif
+
+/*
+ * Address bit fields of the mapping registers, 6 bits each
+ */
+#define DDR_ADDR_MAP_FIELD_BITS         6U
+#define DDR_ADDR_MAP_BANK_FIELDS        6U
+#define DDR_ADDR_MAP_ROW_FIELDS         18U
+#define DDR_ADDR_MAP_COL_FIELDS         16U
+
+/***************************************************************************//**
+  Values of the DDR controller address mapping registers
+ */
+typedef struct mss_ddr_addr_map_{
+    uint32_t    manual;             /* CFG_MANUAL_ADDRESS_MAP              */
+    uint32_t    bank[2];            /* CFG_BANKADDR_MAP_0, _1              */
+    uint32_t    row[4];             /* CFG_ROWADDR_MAP_0 to _3             */
+    uint32_t    col[3];             /* CFG_COLADDR_MAP_0 to _2             */
+} mss_ddr_addr_map;
+
 /***************************************************************************//**
   sweep index's
  */
@@ -1123,6 +1262,204 @@ setup_ddr_segments
     SEG_SETUP option
 );
 
+/***************************************************************************//**
+  The get_ddr_training_timing() function returns the time spent in each phase
+  of the last DDR training. The times are only recorded when
+  DDR_TRAINING_TIMING is defined.
+
+  @return
+    Pointer to the training times.
+
+  Example:
+  @code
+
+      const mss_ddr_timing * p_timing = get_ddr_training_timing();
+      uint64_t total = p_timing->end - p_timing->start;
+
+  @endcode
+
+ */
+const mss_ddr_timing *
+get_ddr_training_timing
+(
+    void
+);
+
+/***************************************************************************//**
+  The ddr_mtc_test_start() function starts a test of the DDR by the memory
+  test core of the DDR controller, and ddr_mtc_test_poll() moves it on. The
+  harts are free to do other work between calls to ddr_mtc_test_poll().
+
+  One run of the memory test core is made for each combination of the data
+  patterns, address patterns, lanes and blocks asked for, checking a single
+  lane, so that errors are reported per lane. Runs with MTC_ADD_RANDOM cover
+  2**size bytes from the start of DDR, whatever the block.
+
+  The DDR tested is overwritten and must not be used by the harts or other
+  masters during the test. Call these functions only once DDR training has
+  completed.
+
+  @param p_test
+    Test to run, set up by the caller.
+
+  @return
+    DDR_MTC_TEST_BUSY, or DDR_MTC_TEST_DONE if there is nothing to test.
+
+  Example:
+  @code
+
+      static mss_ddr_mtc_test test;
+
+      test.start_address = 0U;
+      test.size = ONE_MB_MTC;
+      test.blocks = 64U;
+      test.data_patterns = (1U << MTC_PSEUDO_RANDOM) | (1U << MTC_WALKING_ONE);
+      test.add_patterns = (1U << MTC_ADD_SEQUENTIAL);
+      test.lane_mask = 0U;
+
+      (void)ddr_mtc_test_start(&test);
+      while (ddr_mtc_test_poll(&test) == DDR_MTC_TEST_BUSY)
+      {
+          do_other_init();
+      }
+
+  @endcode
+
+ */
+DDR_MTC_TEST_STATUS
+ddr_mtc_test_start
+(
+    mss_ddr_mtc_test * p_test
+);
+
+/***************************************************************************//**
+  The ddr_mtc_test_poll() function checks whether the current run of a test
+  started by ddr_mtc_test_start() has completed, records its result and starts
+  the next run.
+
+  @param p_test
+    Test started by ddr_mtc_test_start().
+
+  @return
+    Status of the test.
+
+ */
+DDR_MTC_TEST_STATUS
+ddr_mtc_test_poll
+(
+    mss_ddr_mtc_test * p_test
+);
+
+/***************************************************************************//**
+  The ddr_calib_cache_load() function is called once per boot by the DDR
+  training state machine when DDR_CALIB_CACHE is defined, to read the training
+  results saved by ddr_calib_cache_save() on a previous boot, typically from
+  eNVM or sNVM. The weakly linked default has nothing saved and returns 1U.
+  The HAL checks the record before using it, and falls back to full training if
+  the DDR does not pass a memory test core check with the cached results.
+
+  @param p_cache
+    Record to fill.
+
+  @return
+    0U if a record was read, otherwise non-zero.
+
+  Example:
+  @code
+
+      uint8_t ddr_calib_cache_load(mss_ddr_calib_cache * p_cache)
+      {
+          memcpy(p_cache, (const void *)MY_ENVM_DDR_CALIB_ADDR,
+                  sizeof(*p_cache));
+          return (0U);
+      }
+
+  @endcode
+
+ */
+uint8_t
+ddr_calib_cache_load
+(
+    mss_ddr_calib_cache * p_cache
+);
+
+/***************************************************************************//**
+  The ddr_calib_cache_save() function is called by the DDR training state
+  machine when DDR_CALIB_CACHE is defined and full training has passed, with
+  the results to give back to ddr_calib_cache_load() on the next boot. It is
+  not called when the cached results were used. The weakly linked default does
+  nothing.
+
+  @param p_cache
+    Record to save.
+
+  @return
+    none
+
+ */
+void
+ddr_calib_cache_save
+(
+    const mss_ddr_calib_cache * p_cache
+);
+
+/***************************************************************************//**
+  The ddr_self_refresh_resumed() function returns 1U when DDR_SELF_REFRESH_RESUME
+  is defined and the DDR training state machine has brought the DDR out of the
+  self-refresh it was put in by mss_suspend(), restoring the cached training
+  results without any memory test, so the contents of the DDR are those it had
+  when suspended. It returns 0U after a cold boot, including when the cached
+  results were rejected and the DDR was fully trained. See mss_suspend.h.
+
+  @return
+    1U if the DDR contents were kept.
+
+ */
+uint8_t
+ddr_self_refresh_resumed
+(
+    void
+);
+
+/***************************************************************************//**
+  The ddr_get_addr_map() function returns the address mapping register values
+  of a profile. The profiles reorder the bank, row and column bits of the
+  Libero mapping, using the same address bits, so they suit any memory size
+  and geometry:
+
+  - DDR_ADDR_MAP_ROW_BANK_COL puts the bank bits just above the column bits.
+    Consecutive pages are in different banks, so a single sequential stream
+    hardly ever closes a page. This is the usual choice for one stream.
+  - DDR_ADDR_MAP_BANK_ROW_COL puts the bank bits at the top. Each bank holds
+    one contiguous part of the DDR, so harts given buffers in different parts
+    keep their pages open in their own banks. This suits streams which can be
+    placed, e.g. one per hart with mss_ddr_region_alloc().
+  - DDR_ADDR_MAP_LINE_INTERLEAVE puts the bank bits above the lowest
+    DDR_ADDR_MAP_LINE_COL_BITS column bits, so consecutive cache lines go to
+    different banks. Many streams at arbitrary addresses spread over all the
+    banks, at the cost of more page activations for each of them.
+
+  The profile used when the DDR is set up is DDR_ADDR_MAP_PROFILE_SELECT. The
+  mapping cannot be changed once the DDR holds data, so compare the profiles
+  by building once with each and running ddr_addr_map_bench().
+
+  @param profile
+    Profile, see DDR_ADDR_MAP_PROFILE.
+
+  @param p_map
+    Register values.
+
+  @return
+    0U if successful, otherwise non-zero, with the Libero values, if the Libero
+    mapping cannot be decoded.
+
+ */
+uint8_t
+ddr_get_addr_map
+(
+    DDR_ADDR_MAP_PROFILE profile,
+    mss_ddr_addr_map * p_map
+);
 
 #ifdef __cplusplus
 }
@@ -25,6 +25,9 @@
 #define DDR_BASE            0x80000000u
 #define DDR_SIZE            0x40000000u
 
+/* One access per line, so each access of a stream is a new burst */
+#define DDR_BENCH_LINE_BYTES        64U
+
 #define PDMA_CHANNEL0_BASE_ADDRESS  0x3000000ULL
 #define PDMA_CHANNEL1_BASE_ADDRESS  0x3001000ULL
 #define PDMA_CHANNEL2_BASE_ADDRESS  0x3002000ULL
@@ -737,6 +740,108 @@ void sweep_status (mss_uart_instance_t *g_mss_uart_debug_pt)
 #endif
 #endif
 
+/***************************************************************************//**
+ * Prints the time spent in each DDR training phase, in mtime ticks
+ *
+ * @param g_mss_uart_debug_pt
+ */
+#ifdef DEBUG_DDR_INIT
+void training_timing_status (mss_uart_instance_t *g_mss_uart_debug_pt)
+{
+    static const char * const phase_names[DDR_NUM_TIMING_PHASES] =
+    {
+        "\n\r setup:             ",
+        "\n\r pll lock:          ",
+        "\n\r bclk/sclk:         ",
+        "\n\r addcmd:            ",
+        "\n\r write levelling:   ",
+        "\n\r read gate:         ",
+        "\n\r dq/dqs:            ",
+        "\n\r write calibration: ",
+        "\n\r vref calibration:  ",
+        "\n\r memory tests:      ",
+        "\n\r retries/sweeps:    "
+    };
+    const mss_ddr_timing * p_timing = get_ddr_training_timing();
+    uint32_t phase;
+
+    MSS_UART_polled_tx_string(g_mss_uart_debug_pt,\
+                    "\n\r DDR training time (mtime ticks)");
+    for (phase = 0U; phase < (uint32_t)DDR_NUM_TIMING_PHASES; phase++)
+    {
+        uprint64(g_mss_uart_debug_pt, phase_names[phase],\
+                p_timing->phase_ticks[phase]);
+        uprint32(g_mss_uart_debug_pt, " x", p_timing->phase_entries[phase]);
+    }
+    uprint32(g_mss_uart_debug_pt, "\n\r trainings:         ",\
+            p_timing->trainings);
+    uprint64(g_mss_uart_debug_pt, "\n\r total:             ",\
+            p_timing->end - p_timing->start);
+}
+#endif
+
+/***************************************************************************//**
+ * Times interleaved streams through the DDR, see mss_ddr_debug.h
+ *
+ * @param g_mss_uart_debug_pt
+ * @param base
+ * @param size
+ * @param streams
+ */
+#ifdef DEBUG_DDR_INIT
+void ddr_addr_map_bench (mss_uart_instance_t *g_mss_uart_debug_pt,\
+        uint64_t base, uint64_t size, uint32_t streams)
+{
+    uint64_t stride;
+    uint64_t lines;
+    uint64_t line;
+    uint64_t start;
+    uint64_t read_ticks;
+    uint64_t write_ticks;
+    uint32_t stream;
+
+    if (streams == 0U)
+    {
+        streams = 1U;
+    }
+    stride = (size / streams) & ~(DDR_BENCH_LINE_BYTES - 1U);
+    lines = stride / DDR_BENCH_LINE_BYTES;
+
+    start = readmtime();
+    for (line = 0U; line < lines; line++)
+    {
+        for (stream = 0U; stream < streams; stream++)
+        {
+            *(volatile uint64_t *)(base + (stream * stride) +\
+                    (line * DDR_BENCH_LINE_BYTES)) = line;
+        }
+    }
+    mb();
+    write_ticks = readmtime() - start;
+
+    start = readmtime();
+    for (line = 0U; line < lines; line++)
+    {
+        for (stream = 0U; stream < streams; stream++)
+        {
+            (void)*(volatile uint64_t *)(base + (stream * stride) +\
+                    (line * DDR_BENCH_LINE_BYTES));
+        }
+    }
+    mb();
+    read_ticks = readmtime() - start;
+
+    uprint32(g_mss_uart_debug_pt, "\n\r address map profile: 0x",\
+            (uint32_t)DDR_ADDR_MAP_PROFILE_SELECT);
+    uprint32(g_mss_uart_debug_pt, " streams: 0x", streams);
+    uprint64(g_mss_uart_debug_pt, " lines: 0x", lines * streams);
+    uprint64(g_mss_uart_debug_pt, "\n\r write (mtime ticks): 0x",\
+            write_ticks);
+    uprint64(g_mss_uart_debug_pt, "\n\r read (mtime ticks):  0x",\
+            read_ticks);
+}
+#endif
+
 
 /**
  * Load a pattern to DDR
@@ -194,6 +194,51 @@ sweep_status
 mss_uart_instance_t *g_mss_uart_debug_pt
 );
 
+/***************************************************************************//**
+  The training_timing_status() function prints the time spent in each phase of
+  the DDR training, as returned by get_ddr_training_timing(), to the designated
+  debug port.
+
+  Example:
+  @code
+
+  training_timing_status(g_debug_uart);
+
+  @endcode
+ */
+void
+training_timing_status
+(
+mss_uart_instance_t *g_mss_uart_debug_pt
+);
+
+/***************************************************************************//**
+  The ddr_addr_map_bench() function compares the DDR address mapping profiles,
+  see ddr_get_addr_map(). It splits size bytes from base into streams buffers
+  and writes, then reads, one word of each 64 byte line of every buffer in
+  turn, as the same number of harts streaming through their own buffers would.
+  base should be in a non-cached DDR window, so every access goes to the DDR.
+  It prints the mtime ticks taken by the writes and the reads with the profile
+  built in, DDR_ADDR_MAP_PROFILE_SELECT. Build once with each profile and run
+  with the number of streams of the workload; the profile with the fewest
+  ticks has the fewest bank conflicts for it. The DDR tested is overwritten.
+
+  Example:
+  @code
+
+  ddr_addr_map_bench(g_debug_uart, 0xC0000000ULL, 0x4000000ULL, 4U);
+
+  @endcode
+ */
+void
+ddr_addr_map_bench
+(
+mss_uart_instance_t *g_mss_uart_debug_pt,
+uint64_t base,
+uint64_t size,
+uint32_t streams
+);
+
 /***************************************************************************//**
  *
  */
@@ -24,9 +24,12 @@
 
 
 /*
- * IOMUX values from Libero
+ * IOMUX values from Libero, from the table of hw_reg_tables.h if generated
  */
-IOMUX_CONFIG   iomux_config_values = {
+#if defined (LIBERO_TABLE_IOMUX)
+const IOMUX_CONFIG   iomux_config_values = LIBERO_TABLE_IOMUX;
+#else
+const IOMUX_CONFIG   iomux_config_values = {
     LIBERO_SETTING_IOMUX0_CR, /* Selects whether the peripheral is connected to
                                  the Fabric or IOMUX structure. */
     LIBERO_SETTING_IOMUX1_CR, /* BNK4 SDV PAD 0 to 7, each IO has 4 bits   */
@@ -37,11 +40,12 @@ IOMUX_CONFIG   iomux_config_values = {
     LIBERO_SETTING_IOMUX6_CR  /* Sets whether the MMC/SD Voltage select lines
                                  are inverted on entry to the IOMUX structure */
 };
+#endif
 
 /*
  * Bank 4 and 2 settings, the 38 MSSIO.
  */
-MSSIO_BANK4_CONFIG mssio_bank4_io_config = {
+const MSSIO_BANK4_CONFIG mssio_bank4_io_config = {
     /* LIBERO_SETTING_mssio_bank4_io_cfg_0_cr
         x_vddi Ratio Rx<0-2> == 001
         drv<3-6> == 1111
@@ -66,7 +70,7 @@ MSSIO_BANK4_CONFIG mssio_bank4_io_config = {
 /*
  * Bank 4 and 2 settings, the 38 MSSIO.
  */
-MSSIO_BANK2_CONFIG mssio_bank2_io_config = {
+const MSSIO_BANK2_CONFIG mssio_bank2_io_config = {
     /* LIBERO_SETTING_mssio_bank4_io_cfg_0_cr
         x_vddi Ratio Rx<0-2> == 001
         drv<3-6> == 1111
@@ -320,15 +320,19 @@ uint8_t mss_nwc_init(void)
      * Setup SGMII
      * The SGMII set-upset configures the external clock reference so this must
      * be called before configuring the MSS PLL
+     * If MPFS_HAL_NWC_WARM_START is defined, the SGMII and MSS PLL are not
+     * re-locked if already locked with the Libero settings after a warm reset.
      */
     SIM_FEEDBACK0(2);
     sgmii_setup();
+    BOOT_TRACE(BOOT_TRACE_NWC_SGMII);
 
     /*
      * Setup the MSS PLL
      */
     SIM_FEEDBACK0(3);
     mss_pll_config();
+    BOOT_TRACE(BOOT_TRACE_NWC_PLL);
 
     {
 #ifdef DDR_SUPPORT
@@ -349,6 +353,7 @@ uint8_t mss_nwc_init(void)
         {
             error |= (0x1U << 2U);
         }
+        BOOT_TRACE(BOOT_TRACE_NWC_DDR);
         //todo: remove, just for sim test ddr_recalib_io_test();
 #endif
     }
@@ -377,21 +382,17 @@ void delay(uint32_t n)
 
 /*-------------------------------------------------------------------------*//**
  * mtime_delay()
- * waits x microseconds
+ * waits x microseconds in wfi, see mss_idle_sleep_until()
  * Assumption 1 is we have ensured clock is 1MHz
- * Assumption 2 is we have not setup tick timer when using this function. It is
- * only used by the startup code
+ * mtime is no longer reset, so the delay can be used once the tick timer of
+ * the hart is running.
  * @param microseconds microseconds to delay
  */
 
 void mtime_delay(uint32_t microseconds)
 {
-    CLINT->MTIME = 0ULL;
-    volatile uint32_t count = 0ULL;
+    uint64_t start = readmtime();
 
-    while(CLINT->MTIME < microseconds)
-    {
-        count++;
-    }
+    mss_idle_sleep_until(start + (uint64_t)microseconds);
     return;
 }
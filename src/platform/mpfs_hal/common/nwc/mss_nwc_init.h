@@ -127,10 +127,9 @@ mss_nwc_init
 
 /***************************************************************************//**
   mtime_delay(x) delay function, passes microseconds
-  waits x microseconds
+  waits x microseconds, in wfi for all but the last few, see
+  mss_idle_sleep_until()
   Assumption 1 is we have ensured clock is 1MHz
-  Assumption 2 is we have not setup tick timer when using this function. It is
-  only used by the startup code.
 
   Example:
   @code
@@ -70,6 +70,7 @@ void sgmii_mux_config(uint8_t option);
 /*******************************************************************************
  Local functions                                 *
 *******************************************************************************/
+static void mss_pll_lock_new_config(void);
 
 
 /***************************************************************************//**
@@ -402,6 +403,98 @@ void mss_pll_config(void)
 {
     copy_switch_code(); /* copy switch code to RAM */
 
+#ifdef MPFS_HAL_NWC_WARM_START
+    /*
+     * On a warm reset the MSS PLL is still locked with the Libero settings, so
+     * only the MSS clock dividers, which are reset, need to be set up again.
+     */
+    if (mss_pll_config_check() != 0U)
+#endif
+    {
+        mss_pll_lock_new_config();
+    }
+
+    /*
+     * 6)   MSS Processor enables all 4 PLL outputs.
+     * 7)   MSS Processor writes mssclk_mux_sel_int<0>=1 to select the MSS PLL
+     *      clock.
+     */
+    mss_mux_post_mss_pll_config();
+}
+
+/***************************************************************************//**
+ * mss_pll_config_check()
+ * See mss_pll.h for details of how to use this function.
+ */
+uint8_t mss_pll_config_check(void)
+{
+    uint8_t result = 1U;
+
+    if (((MSS_SCB_MSS_PLL->PLL_CTRL & (PLL_CTRL_LOCK_BIT |\
+            PLL_CTRL_REG_POWERDOWN_B_MASK)) == (PLL_CTRL_LOCK_BIT |\
+            PLL_CTRL_REG_POWERDOWN_B_MASK)) &&\
+        (MSS_SCB_MSS_PLL->PLL_REF_FB == LIBERO_SETTING_MSS_PLL_REF_FB) &&\
+        (MSS_SCB_MSS_PLL->PLL_DIV_0_1 == LIBERO_SETTING_MSS_PLL_DIV_0_1) &&\
+        (MSS_SCB_MSS_PLL->PLL_DIV_2_3 == LIBERO_SETTING_MSS_PLL_DIV_2_3) &&\
+        (MSS_SCB_MSS_PLL->PLL_CTRL2 == LIBERO_SETTING_MSS_PLL_CTRL2) &&\
+        (MSS_SCB_MSS_PLL->PLL_FRACN == LIBERO_SETTING_MSS_PLL_FRACN) &&\
+        (MSS_SCB_CFM_MSS_MUX->PLL_CKMUX == LIBERO_SETTING_MSS_PLL_CKMUX) &&\
+        (MSS_SCB_CFM_MSS_MUX->MSSCLKMUX == LIBERO_SETTING_MSS_MSSCLKMUX))
+    {
+        result = 0U;
+    }
+
+    return(result);
+}
+
+/***************************************************************************//**
+ * mss_pll_set_mss_dividers()
+ * See mss_pll.h for details of how to use this function.
+ * Run from RAM, as the eNVM clock is changed. When the AHB clock goes up the
+ * eNVM divider is raised first and the new eNVM clock waited for, when it goes
+ * down the eNVM divider is lowered once the AHB clock is slower.
+ ******************************************************************************/
+__attribute__((section(".ram_codetext"))) \
+        void mss_pll_set_mss_dividers(uint32_t clock_config_cr, uint32_t envm_cr)
+{
+    volatile uint32_t wait_for_true = 0U;
+    uint8_t envm_first = ((envm_cr & ENVM_CR_CLOCK_PERIOD_MASK) >\
+            (SYSREG->ENVM_CR & ENVM_CR_CLOCK_PERIOD_MASK)) ? 1U : 0U;
+
+    if (0U != envm_first)
+    {
+        SYSREG->ENVM_CR = envm_cr;
+        mb();
+
+        while ((SYSREG->ENVM_CR & ENVM_CR_CLOCK_OKAY_MASK) !=\
+                ENVM_CR_CLOCK_OKAY_MASK)
+        {
+#ifdef RENODE_DEBUG
+            break;
+#endif
+            wait_for_true++;
+        }
+    }
+
+    /* The dividers may be changed from any value to any value in one go */
+    SYSREG->CLOCK_CONFIG_CR = clock_config_cr;
+    mb();
+
+    if (0U == envm_first)
+    {
+        SYSREG->ENVM_CR = envm_cr;
+        mb();
+    }
+}
+
+/***************************************************************************//**
+ * mss_pll_lock_new_config()
+ *
+ * Steps 4c and 5 of mss_pll_config(), writes the Libero settings to the MSS PLL
+ * and waits for lock.
+ ******************************************************************************/
+static void mss_pll_lock_new_config(void)
+{
     MSS_SCB_DDR_PLL->SOFT_RESET     = PLL_INIT_AND_OUT_OF_RESET;
     MSS_SCB_MSS_PLL->SOFT_RESET     = PLL_INIT_AND_OUT_OF_RESET;
 
@@ -483,13 +576,6 @@ void mss_pll_config(void)
             //todo: add failure mode
         }
     }
-
-    /*
-     * 6)   MSS Processor enables all 4 PLL outputs.
-     * 7)   MSS Processor writes mssclk_mux_sel_int<0>=1 to select the MSS PLL
-     *      clock.
-     */
-    mss_mux_post_mss_pll_config();
 }
 
 /**
@@ -297,6 +297,43 @@ uint8_t sgmii_pll_lock_scb(void);
  */
 void ddr_pll_config_scb_turn_off(void);
 
+/***************************************************************************//**
+  mss_pll_config_check() Checks if the MSS PLL is already locked with the
+  Libero settings and feeding the MSS, as it is after a warm reset.
+  When MPFS_HAL_NWC_WARM_START is defined, mss_pll_config() does not re-lock
+  the MSS PLL if this is the case.
+
+  @return
+    0U if locked with the Libero settings
+
+  Example:
+  @code
+      if (mss_pll_config_check() == 0U)
+      {
+           MSS PLL does not need to be configured
+      }
+  @endcode
+
+ */
+uint8_t mss_pll_config_check(void);
+
+/***************************************************************************//**
+  mss_pll_set_mss_dividers() changes the MSS clock dividers of CLOCK_CONFIG_CR
+  and the eNVM clock divider of ENVM_CR at runtime, in the order which keeps
+  the eNVM clock within its limit. It runs from RAM. The MSS PLL itself is
+  left as it is.
+
+  Example:
+  @code
+
+      mss_pll_set_mss_dividers(LIBERO_SETTING_MSS_CLOCK_CONFIG_CR,
+              LIBERO_SETTING_MSS_ENVM_CR);
+
+  @endcode
+
+ */
+void mss_pll_set_mss_dividers(uint32_t clock_config_cr, uint32_t envm_cr);
+
 /***************************************************************************//**
   set_RTC_divisor() Sets the RTC divisor based on values from Libero
   It is assumed the RTC clock is set to 1MHz
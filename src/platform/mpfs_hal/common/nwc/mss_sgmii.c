@@ -99,18 +99,31 @@ static uint32_t sgmii_channel_setup(void)
     {
         case SGMII_SETUP_INIT:
             status = SGMII_IN_SETUP;
-            CFG_DDR_SGMII_PHY->SOFT_RESET_SGMII.SOFT_RESET_SGMII = \
-                    (0x01 << 8U) | 1U; /* PERIPH   soft reset */
-            CFG_DDR_SGMII_PHY->SOFT_RESET_SGMII.SOFT_RESET_SGMII = 1U;
-            setup_sgmii_rpc_per_config();         /* load RPC SGMII_MODE register ext */
-
-            /* Enable the Bank controller */
+#ifdef MPFS_HAL_NWC_WARM_START
             /*
-             * Set soft reset on IP to load RPC to SCB regs (dynamic mode)
-             * Bring the sgmii bank controller out of reset =- ioscb_bank_ctrl_sgmii
+             * On a warm reset the IO calibration, SGMII PLL and DLL are
+             * retained. The MACs are in the MSS so are set up again.
              */
-            IOSCB_BANK_CNTL_SGMII->soft_reset = 1U;  /* DPC_BITS NV_MAP  reset */
-            sgmii_training_state = SGMII_IO_EN;
+            if (sgmii_config_check() == 0U)
+            {
+                sgmii_training_state = SGMII_TURN_ON_MACS;
+            }
+            else
+#endif
+            {
+                CFG_DDR_SGMII_PHY->SOFT_RESET_SGMII.SOFT_RESET_SGMII = \
+                        (0x01 << 8U) | 1U; /* PERIPH   soft reset */
+                CFG_DDR_SGMII_PHY->SOFT_RESET_SGMII.SOFT_RESET_SGMII = 1U;
+                setup_sgmii_rpc_per_config();         /* load RPC SGMII_MODE register ext */
+
+                /* Enable the Bank controller */
+                /*
+                 * Set soft reset on IP to load RPC to SCB regs (dynamic mode)
+                 * Bring the sgmii bank controller out of reset =- ioscb_bank_ctrl_sgmii
+                 */
+                IOSCB_BANK_CNTL_SGMII->soft_reset = 1U;  /* DPC_BITS NV_MAP  reset */
+                sgmii_training_state = SGMII_IO_EN;
+            }
             break;
 
         case SGMII_IO_EN:
@@ -416,6 +429,29 @@ static void setup_sgmii_rpc_per_config(void)
     CFG_DDR_SGMII_PHY->PLL_CNTL.PLL_CNTL        = LIBERO_SETTING_PLL_CNTL;
 }
 
+/***************************************************************************//**
+ * sgmii_config_check()
+ * See mss_sgmii.h for details of how to use this function.
+ */
+uint8_t sgmii_config_check(void)
+{
+    uint8_t result = 1U;
+
+    /* bit14 calibration complete, bit30 calibration lock */
+    if (((CFG_DDR_SGMII_PHY->PVT_STAT.PVT_STAT & ((1U << 14U) | (1U << 30U)))\
+            == ((1U << 14U) | (1U << 30U))) &&\
+        ((CFG_DDR_SGMII_PHY->PLL_CNTL.PLL_CNTL & (1U << 7U)) != 0U) &&\
+        ((CFG_DDR_SGMII_PHY->RECAL_CNTL.RECAL_CNTL & (1U << 23U)) != 0U) &&\
+        (CFG_DDR_SGMII_PHY->SGMII_MODE.SGMII_MODE ==\
+            (LIBERO_SETTING_SGMII_MODE & ~REG_CDR_MOVE_STEP)) &&\
+        (CFG_DDR_SGMII_PHY->CLK_CNTL.CLK_CNTL == LIBERO_SETTING_CLK_CNTL))
+    {
+        result = 0U;
+    }
+
+    return(result);
+}
+
 /**
  * SGMII Off mode
  */
@@ -245,6 +245,26 @@ void sgmii_off_mode(void);
  */
 uint32_t sgmii_setup(void);
 
+/***************************************************************************//**
+  sgmii_config_check() Checks if the SGMII IO calibration is locked and the
+  SGMII PLL and DLL are locked with the Libero settings, as they are after a
+  warm reset. When MPFS_HAL_NWC_WARM_START is defined, sgmii_setup() only
+  sets up the MACs and channels if this is the case.
+
+  @return
+    0U if calibrated and locked
+
+  Example:
+  @code
+      if (sgmii_config_check() == 0U)
+      {
+           SGMII PLL and DLL do not need to be configured
+      }
+  @endcode
+
+ */
+uint8_t sgmii_config_check(void);
+
 /***************************************************************************//**
   ddr_pvt_calibration() calibrates DDR I/O using the hardware function
 
@@ -0,0 +1,696 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_host.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Host native build, CSRs, register memory, PLIC and model thread
+ *
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE             0x100000
+#endif
+
+/*
+ * Register blocks mapped as memory. Anonymous memory is only committed when
+ * it is touched, so the windows can be generous.
+ */
+typedef struct
+{
+    uintptr_t base;
+    size_t size;
+} mss_host_window_t;
+
+static const mss_host_window_t g_host_windows[] =
+{
+    { 0x02000000UL, 0x0E000000UL },     /* CLINT, L2 controller, PDMA, PLIC */
+    { 0x20000000UL, 0x20000000UL },     /* Peripherals, SYSREG, MAC, MMC, SCB */
+};
+
+/* MAC register blocks and their high aliases, which share the same memory */
+#define HOST_MAC_BLOCK_BASE             0x20110000UL
+#define HOST_MAC_BLOCK_ALIAS            0x28110000UL
+#define HOST_MAC_BLOCK_SIZE             0x4000UL
+
+#define HOST_NS_PER_SEC                 1000000000ULL
+
+/* Signal which interrupts a hart thread, as the external interrupt line */
+#define HOST_IRQ_SIGNAL                 SIGUSR1
+
+/* Signal of the interval timer which runs the models on a single CPU host */
+#define HOST_TICK_SIGNAL                SIGALRM
+
+static const uint32_t g_host_plic_target[MSS_HOST_NUM_HARTS] =
+{
+    TARGET_OFFSET_HART0_M,
+    TARGET_OFFSET_HART1_M,
+    TARGET_OFFSET_HART2_M,
+    TARGET_OFFSET_HART3_M,
+    TARGET_OFFSET_HART4_M
+};
+
+static __thread mss_host_csr_t g_host_csr;
+static __thread volatile uint32_t g_host_in_trap;
+static __thread volatile uint32_t g_host_in_model;
+static __thread volatile sig_atomic_t g_host_irq_deferred;
+
+static pthread_t g_host_hart_thread[MSS_HOST_NUM_HARTS];
+static volatile uint32_t g_host_hart_valid[MSS_HOST_NUM_HARTS];
+
+static pthread_mutex_t g_host_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static pthread_t g_host_thread;
+static volatile uint32_t g_host_thread_run = 0U;
+static volatile uint32_t g_host_tick_run = 0U;
+static uint64_t g_host_start_ns = 0U;
+
+/* Symbols of the linker scripts. There is no L2 scratchpad heap on the host. */
+char __l2_scratchpad_heap_start;
+extern char __l2_scratchpad_heap_end __attribute__((alias("__l2_scratchpad_heap_start")));
+
+static uint8_t (*g_host_irq_handler[PLIC_NUM_SOURCES])(void);
+static uint8_t g_host_irq_in_service[PLIC_NUM_SOURCES];
+
+static int host_map_windows(void);
+static uint64_t host_clock_csr(size_t csr);
+static void host_step_devices(void);
+static uint32_t host_irq_claim(uint64_t hart_id);
+static uint32_t host_irq_any(uint64_t hart_id);
+static uint32_t host_irq_take(void);
+static void * host_model_thread(void * arg);
+static void host_irq_signal(int signal_number);
+static void host_tick_signal(int signal_number);
+static int host_tick_arm(uint32_t period_us);
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+int mss_host_model_init(void)
+{
+    int status = host_map_windows();
+
+    g_host_start_ns = mss_host_time_ns();
+    g_host_start_ns = (0U != g_host_start_ns) ? g_host_start_ns : 1U;
+
+    if(0 == status)
+    {
+        memset(g_host_irq_in_service, 0, sizeof(g_host_irq_in_service));
+        status = mss_host_mac_reset();
+        mss_host_pdma_reset();
+    }
+
+    return (status);
+}
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+int mss_host_model_start(void)
+{
+    int status = 0;
+
+    if((0U != g_host_thread_run) || (0U != g_host_tick_run))
+    {
+        /* Already running */
+    }
+    else if(sysconf(_SC_NPROCESSORS_ONLN) > 1L)
+    {
+        g_host_thread_run = 1U;
+        if(0 != pthread_create(&g_host_thread, NULL, host_model_thread, NULL))
+        {
+            g_host_thread_run = 0U;
+            status = -1;
+        }
+    }
+    else
+    {
+        /*
+         * A model thread would only run when a hart thread used up its time
+         * slice, so the models are run from a timer signal on the harts.
+         */
+        g_host_tick_run = 1U;
+        status = host_tick_arm(MSS_HOST_TICK_US);
+        if(0 != status)
+        {
+            g_host_tick_run = 0U;
+        }
+    }
+
+    return (status);
+}
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+void mss_host_model_stop(void)
+{
+    if(0U != g_host_thread_run)
+    {
+        g_host_thread_run = 0U;
+        (void)pthread_join(g_host_thread, NULL);
+    }
+
+    if(0U != g_host_tick_run)
+    {
+        (void)host_tick_arm(0U);
+        g_host_tick_run = 0U;
+    }
+}
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+void mss_host_model_step(void)
+{
+    host_step_devices();
+    (void)host_irq_take();
+}
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+void mss_host_set_hart(uint64_t hart_id)
+{
+    struct sigaction action;
+
+    g_host_csr.mhartid = (unsigned long)hart_id;
+
+    if(hart_id < MSS_HOST_NUM_HARTS)
+    {
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = host_irq_signal;
+        action.sa_flags = SA_RESTART;
+        (void)sigemptyset(&action.sa_mask);
+        (void)sigaction(HOST_IRQ_SIGNAL, &action, NULL);
+
+        g_host_hart_thread[hart_id] = pthread_self();
+        __atomic_store_n(&g_host_hart_valid[hart_id], 1U, __ATOMIC_RELEASE);
+    }
+}
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+void mss_host_irq_connect(uint32_t source, uint8_t (*handler)(void))
+{
+    if(source < PLIC_NUM_SOURCES)
+    {
+        g_host_irq_handler[source] = handler;
+    }
+}
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+void mss_host_wfi(void)
+{
+    if((0U == g_host_thread_run) && (0U == g_host_tick_run))
+    {
+        host_step_devices();
+    }
+
+    if(0U == host_irq_take())
+    {
+        (void)sched_yield();
+    }
+}
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+unsigned long mss_host_csr_read(size_t csr)
+{
+    unsigned long value;
+
+    if((offsetof(mss_host_csr_t, mcycle) == csr) ||
+       (offsetof(mss_host_csr_t, minstret) == csr) ||
+       (offsetof(mss_host_csr_t, cycle) == csr) ||
+       (offsetof(mss_host_csr_t, instret) == csr) ||
+       (offsetof(mss_host_csr_t, time) == csr))
+    {
+        /* The clock CSRs hold the offset written to them */
+        value = (unsigned long)host_clock_csr(csr) +
+                *(unsigned long *)((uint8_t *)&g_host_csr + csr);
+    }
+    else
+    {
+        value = *(unsigned long *)((uint8_t *)&g_host_csr + csr);
+    }
+
+    return (value);
+}
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+unsigned long mss_host_csr_access(size_t csr, unsigned long value, uint32_t op)
+{
+    unsigned long * p_csr = (unsigned long *)((uint8_t *)&g_host_csr + csr);
+    unsigned long old = mss_host_csr_read(csr);
+    unsigned long new_value = value;
+
+    if(MSS_HOST_CSR_SET == op)
+    {
+        new_value = old | value;
+    }
+    else if(MSS_HOST_CSR_CLEAR == op)
+    {
+        new_value = old & ~value;
+    }
+    else
+    {
+        /* write */
+    }
+
+    if(offsetof(mss_host_csr_t, mhartid) == csr)
+    {
+        /* read only */
+    }
+    else if((offsetof(mss_host_csr_t, mcycle) == csr) ||
+            (offsetof(mss_host_csr_t, minstret) == csr) ||
+            (offsetof(mss_host_csr_t, cycle) == csr) ||
+            (offsetof(mss_host_csr_t, instret) == csr) ||
+            (offsetof(mss_host_csr_t, time) == csr))
+    {
+        *p_csr = new_value - (unsigned long)host_clock_csr(csr);
+    }
+    else
+    {
+        *p_csr = new_value;
+    }
+
+    /* Enabling interrupts is where a pending interrupt is taken */
+    if(((offsetof(mss_host_csr_t, mstatus) == csr) ||
+        (offsetof(mss_host_csr_t, mie) == csr)) && (new_value != old))
+    {
+        (void)host_irq_take();
+    }
+
+    return (old);
+}
+
+/***************************************************************************//**
+ * Called by the device models with the model lock held. A source becomes
+ * pending when its level is high and it is not being serviced, as through
+ * the gateway of the PLIC, and the hart threads are then signalled so that
+ * the interrupt is taken at once, wherever the thread is.
+ */
+void mss_host_irq_set_level(uint32_t source, uint32_t level)
+{
+    volatile uint32_t * pending = (volatile uint32_t *)PLIC->PENDING_ARRAY;
+    uint32_t hart_id;
+    uint32_t bit;
+
+    if((source > 0U) && (source < PLIC_NUM_SOURCES))
+    {
+        bit = (uint32_t)1U << (source % 32U);
+
+        if((0U != level) && (0U == g_host_irq_in_service[source]) &&
+           (0U == (pending[source / 32U] & bit)))
+        {
+            pending[source / 32U] |= bit;
+
+            /* Raise the interrupt line of each hart */
+            for(hart_id = 0U; hart_id < MSS_HOST_NUM_HARTS; hart_id++)
+            {
+                if(0U != __atomic_load_n(&g_host_hart_valid[hart_id],
+                                         __ATOMIC_ACQUIRE))
+                {
+                    (void)pthread_kill(g_host_hart_thread[hart_id],
+                                       HOST_IRQ_SIGNAL);
+                }
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Stands in for the function of nwc/mss_pll.c, which waits on the eNVM clock.
+ * The new eNVM clock is ready at once.
+ */
+void mss_pll_set_mss_dividers(uint32_t clock_config_cr, uint32_t envm_cr)
+{
+    SYSREG->CLOCK_CONFIG_CR = clock_config_cr;
+    SYSREG->ENVM_CR = envm_cr | ENVM_CR_CLOCK_OKAY_MASK;
+}
+
+/***************************************************************************//**
+ * The model lock, held while a model runs. It is recursive, so that a hook
+ * called by a model can call into the models again.
+ */
+void mss_host_lock(void)
+{
+    g_host_in_model++;
+    (void)pthread_mutex_lock(&g_host_lock);
+}
+
+void mss_host_unlock(void)
+{
+    (void)pthread_mutex_unlock(&g_host_lock);
+    g_host_in_model--;
+
+    /* An interrupt which came in while the thread held the lock */
+    if((0U == g_host_in_model) && (0 != g_host_irq_deferred))
+    {
+        (void)host_irq_take();
+    }
+}
+
+/***************************************************************************//**
+ * Host monotonic clock
+ */
+uint64_t mss_host_time_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (((uint64_t)now.tv_sec * HOST_NS_PER_SEC) + (uint64_t)now.tv_nsec);
+}
+
+/***************************************************************************//**
+ * Maps the register windows, then puts the MAC blocks and their aliases on
+ * shared memory. A window which is already in use is reported rather than
+ * replaced.
+ */
+static int host_map_windows(void)
+{
+    int status = 0;
+    uint32_t window;
+    void * addr;
+    int fd;
+
+    for(window = 0U;
+        (0 == status) &&
+        (window < (sizeof(g_host_windows) / sizeof(g_host_windows[0])));
+        window++)
+    {
+        addr = mmap((void *)g_host_windows[window].base,
+                    g_host_windows[window].size,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE |
+                    MAP_FIXED_NOREPLACE,
+                    -1, 0);
+
+        if(addr != (void *)g_host_windows[window].base)
+        {
+            (void)fprintf(stderr, "mss_host: cannot map registers at 0x%lx\n",
+                          (unsigned long)g_host_windows[window].base);
+            status = -1;
+        }
+    }
+
+    if(0 == status)
+    {
+        fd = memfd_create("mss_host_mac", 0U);
+        if((fd < 0) || (0 != ftruncate(fd, (off_t)HOST_MAC_BLOCK_SIZE)) ||
+           (MAP_FAILED == mmap((void *)HOST_MAC_BLOCK_BASE, HOST_MAC_BLOCK_SIZE,
+                               PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+                               fd, 0)) ||
+           (MAP_FAILED == mmap((void *)HOST_MAC_BLOCK_ALIAS, HOST_MAC_BLOCK_SIZE,
+                               PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+                               fd, 0)))
+        {
+            (void)fprintf(stderr, "mss_host: cannot alias the MAC registers\n");
+            status = -1;
+        }
+
+        if(fd >= 0)
+        {
+            (void)close(fd);
+        }
+    }
+
+    return (status);
+}
+
+/***************************************************************************//**
+ * Value of a clock CSR from the host clock
+ */
+static uint64_t host_clock_csr(size_t csr)
+{
+    unsigned __int128 ns = mss_host_time_ns() - g_host_start_ns;
+    uint64_t hz = MSS_HOST_CPU_HZ;
+
+    if(offsetof(mss_host_csr_t, time) == csr)
+    {
+        hz = MSS_HOST_MTIME_HZ;
+    }
+
+    return ((uint64_t)((ns * hz) / HOST_NS_PER_SEC));
+}
+
+/***************************************************************************//**
+ * Runs each device model once
+ */
+static void host_step_devices(void)
+{
+    mss_host_lock();
+
+    CLINT->MTIME = host_clock_csr(offsetof(mss_host_csr_t, time));
+    mss_host_mac_step();
+    mss_host_pdma_step();
+
+    mss_host_unlock();
+}
+
+/***************************************************************************//**
+ * Claims the highest priority source pending and enabled on a hart above its
+ * threshold, the lowest numbered one of equal priorities, as the PLIC does.
+ * Called with the model lock held.
+ */
+static uint32_t host_irq_claim(uint64_t hart_id)
+{
+    uint32_t target = g_host_plic_target[hart_id];
+    volatile uint32_t * pending = (volatile uint32_t *)PLIC->PENDING_ARRAY;
+    volatile uint32_t * enables = (volatile uint32_t *)
+        ((uintptr_t)PLIC->HART0_MMODE_ENA + (target * 0x80U));
+    uint32_t threshold = PLIC->TARGET[target].PRIORITY_THRESHOLD;
+    uint32_t best = 0U;
+    uint32_t best_priority = 0U;
+    uint32_t source;
+    uint32_t priority;
+    uint32_t bit;
+
+    for(source = 1U; source < PLIC_NUM_SOURCES; source++)
+    {
+        bit = (uint32_t)1U << (source % 32U);
+        priority = PLIC->SOURCE_PRIORITY[source - 1U];
+
+        if((0U != (pending[source / 32U] & enables[source / 32U] & bit)) &&
+           (priority > threshold) && (priority > best_priority))
+        {
+            best = source;
+            best_priority = priority;
+        }
+    }
+
+    if(0U != best)
+    {
+        pending[best / 32U] &= ~((uint32_t)1U << (best % 32U));
+        g_host_irq_in_service[best] = 1U;
+        mss_host_mac_claim(best);
+        PLIC->TARGET[target].CLAIM_COMPLETE = best;
+    }
+
+    return (best);
+}
+
+/***************************************************************************//**
+ * Whether any source is pending and enabled on a hart, read without the model
+ * lock to keep the cost of enabling interrupts down
+ */
+static uint32_t host_irq_any(uint64_t hart_id)
+{
+    volatile uint32_t * pending = (volatile uint32_t *)PLIC->PENDING_ARRAY;
+    volatile uint32_t * enables = (volatile uint32_t *)
+        ((uintptr_t)PLIC->HART0_MMODE_ENA + (g_host_plic_target[hart_id] * 0x80U));
+    uint32_t any = 0U;
+    uint32_t word;
+
+    for(word = 0U; word < ((PLIC_NUM_SOURCES + 31U) / 32U); word++)
+    {
+        any |= pending[word] & enables[word];
+    }
+
+    return (any);
+}
+
+/***************************************************************************//**
+ * Takes the pending external interrupts of the calling hart, as a trap to
+ * handle_m_ext_interrupt() would, with interrupts masked while the handlers
+ * run. Returns the number of interrupts taken.
+ */
+static uint32_t host_irq_take(void)
+{
+    uint64_t hart_id = g_host_csr.mhartid;
+    unsigned long saved_mstatus;
+    uint32_t taken = 0U;
+    uint32_t source = 1U;
+    uint8_t disable;
+    uint32_t target;
+
+    if((0U == g_host_in_trap) && (0U == g_host_in_model) && (hart_id < MSS_HOST_NUM_HARTS) &&
+       (0U != (g_host_csr.mstatus & MSTATUS_MIE)) &&
+       (0U != (g_host_csr.mie & MIP_MEIP)) && (0U != host_irq_any(hart_id)))
+    {
+        g_host_irq_deferred = 0;
+        g_host_in_trap = 1U;
+        saved_mstatus = g_host_csr.mstatus;
+        g_host_csr.mstatus &= ~(unsigned long)MSTATUS_MIE;
+        target = g_host_plic_target[hart_id];
+
+        while(0U != source)
+        {
+            mss_host_lock();
+            source = host_irq_claim(hart_id);
+            mss_host_unlock();
+
+            if(0U != source)
+            {
+                disable = EXT_IRQ_KEEP_ENABLED;
+                if(NULL != g_host_irq_handler[source])
+                {
+                    disable = g_host_irq_handler[source]();
+                }
+
+                mss_host_lock();
+                g_host_irq_in_service[source] = 0U;
+                mss_host_mac_acknowledge(source);
+                if(EXT_IRQ_DISABLE == disable)
+                {
+                    ((volatile uint32_t *)((uintptr_t)PLIC->HART0_MMODE_ENA +
+                        (target * 0x80U)))[source / 32U] &=
+                        ~((uint32_t)1U << (source % 32U));
+                }
+                mss_host_pdma_update();
+                mss_host_unlock();
+
+                taken++;
+            }
+        }
+
+        g_host_csr.mstatus = saved_mstatus;
+        g_host_in_trap = 0U;
+
+        /* A signal which came in after the last claim */
+        if(0 != g_host_irq_deferred)
+        {
+            taken += host_irq_take();
+        }
+    }
+
+    return (taken);
+}
+
+/***************************************************************************//**
+ * The external interrupt line of a hart thread. The interrupt is put off
+ * while the thread is in the models or in a handler, or has interrupts
+ * disabled, and taken when it unlocks the models or enables interrupts.
+ */
+static void host_irq_signal(int signal_number)
+{
+    int saved_errno = errno;
+
+    (void)signal_number;
+
+    g_host_irq_deferred = 1;
+    if(0U == g_host_in_model)
+    {
+        (void)host_irq_take();
+    }
+
+    errno = saved_errno;
+}
+
+/***************************************************************************//**
+ * The interval timer, which steps the models on whichever thread it lands,
+ * unless that thread is in the models already.
+ */
+static void host_tick_signal(int signal_number)
+{
+    int saved_errno = errno;
+
+    (void)signal_number;
+
+    if(0U == g_host_in_model)
+    {
+        host_step_devices();
+        (void)host_irq_take();
+    }
+
+    errno = saved_errno;
+}
+
+/***************************************************************************//**
+ * Arms the interval timer with a period in microseconds, or disarms it when
+ * the period is zero
+ */
+static int host_tick_arm(uint32_t period_us)
+{
+    struct sigaction action;
+    struct itimerval timer;
+    int status = 0;
+
+    if(0U != period_us)
+    {
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = host_tick_signal;
+        action.sa_flags = SA_RESTART;
+        (void)sigemptyset(&action.sa_mask);
+        status = sigaction(HOST_TICK_SIGNAL, &action, NULL);
+    }
+
+    memset(&timer, 0, sizeof(timer));
+    timer.it_interval.tv_usec = (suseconds_t)period_us;
+    timer.it_value.tv_usec = (suseconds_t)period_us;
+
+    if(0 == status)
+    {
+        status = setitimer(ITIMER_REAL, &timer, NULL);
+    }
+
+    return ((0 == status) ? 0 : -1);
+}
+
+/***************************************************************************//**
+ * The hardware
+ */
+static void * host_model_thread(void * arg)
+{
+    (void)arg;
+
+    while(0U != g_host_thread_run)
+    {
+        host_step_devices();
+        (void)sched_yield();
+    }
+
+    return (NULL);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,261 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_host.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Host native build of the HAL and drivers against a register model
+ *
+ * When MPFS_HAL_HOST_MODEL is defined, the HAL and the drivers build with the
+ * native compiler of an x86/Linux host, so that the descriptor ring logic,
+ * the queueing layers and the allocators can be run under perf, valgrind or
+ * callgrind, for example to catch algorithmic regressions in CI before a
+ * hardware run. The driver sources are not changed for this:
+ *  - encoding.h takes the CSR access macros from this file. The CSRs of each
+ *    modelled hart live in a thread local structure, so each host thread is a
+ *    hart. mcycle, minstret and time count from the host monotonic clock, the
+ *    other CSRs read back what was written to them.
+ *  - mss_host_model_init() maps memory at the physical addresses of the
+ *    CLINT, PDMA, PLIC and peripheral register blocks, so the register
+ *    structures of the HAL and the drivers, at their fixed addresses, are
+ *    plain memory. The high aliases of the MAC register blocks are mapped to
+ *    the same memory as the low ones.
+ *  - mss_host_model_step() runs the behavioural models of the devices on that
+ *    memory: the CLINT mtime, the GEM transmit and receive DMA of the MACs
+ *    and the PDMA channels. It runs on its own thread, which stands for the
+ *    hardware, once mss_host_model_start() is called, or from the test code
+ *    for a single threaded, repeatable run.
+ *  - The models raise PLIC sources, and a raised source signals the threads
+ *    made harts by mss_host_set_hart(), so that the interrupt is taken at once
+ *    wherever the thread is, as on target, for example in a loop polling a
+ *    flag set by the handler. It is put off while interrupts are disabled
+ *    through mstatus or mie, and taken when they are enabled again. The
+ *    handler is the one given to mss_host_irq_connect() for the source.
+ *
+ * The model is a behavioural one, not a cycle accurate one:
+ *  - A write to a register is seen by a model at its next step, and the
+ *    interrupt status bits a handler was entered with are taken as cleared
+ *    when it returns, as the MAC and PDMA handlers clear what they read.
+ *  - Transmitted frames are looped back to receive queue 0 of the same MAC
+ *    when local loopback is set in NETWORK_CONTROL, and are handed to the
+ *    hook of mss_host_mac_set_tx_hook() otherwise. mss_host_mac_receive()
+ *    puts a frame on the wire side of a receive queue.
+ *  - The MAC driver writes the low 32 bits of the addresses of its static
+ *    descriptor rings to the queue pointers, so the test program must be
+ *    linked as a position dependent executable, with -no-pie, to keep them
+ *    below 4GB.
+ *  - The statistics counters, the PHY management interface, the time stamp
+ *    unit, screening, checksum offload and header-data split of the MAC, the
+ *    local interrupts and the MMC are not modelled, and their registers read
+ *    back what was written to them.
+ *
+ * See readme.md in this folder for how to build and run a host program.
+ */
+#ifndef MSS_HOST_H
+#define MSS_HOST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * CSRs of a modelled hart, named as in the CSR access macros
+ */
+typedef struct
+{
+    unsigned long mhartid;
+    unsigned long mstatus;
+    unsigned long mie;
+    unsigned long mip;
+    unsigned long mepc;
+    unsigned long mcause;
+    unsigned long mtvec;
+    unsigned long mscratch;
+    unsigned long mideleg;
+    unsigned long medeleg;
+    unsigned long mcounteren;
+    unsigned long mcycle;
+    unsigned long minstret;
+    unsigned long mhpmcounter3;
+    unsigned long mhpmcounter4;
+    unsigned long mhpmevent3;
+    unsigned long mhpmevent4;
+    unsigned long pmpcfg0;
+    unsigned long pmpcfg2;
+    unsigned long pmpaddr0;
+    unsigned long pmpaddr1;
+    unsigned long pmpaddr2;
+    unsigned long pmpaddr3;
+    unsigned long pmpaddr4;
+    unsigned long pmpaddr5;
+    unsigned long pmpaddr6;
+    unsigned long pmpaddr7;
+    unsigned long pmpaddr8;
+    unsigned long pmpaddr9;
+    unsigned long pmpaddr10;
+    unsigned long pmpaddr11;
+    unsigned long pmpaddr12;
+    unsigned long pmpaddr13;
+    unsigned long pmpaddr14;
+    unsigned long pmpaddr15;
+    unsigned long sstatus;
+    unsigned long sie;
+    unsigned long sip;
+    unsigned long sscratch;
+    unsigned long scause;
+    unsigned long sepc;
+    unsigned long stvec;
+    unsigned long satp;
+    unsigned long cycle;
+    unsigned long instret;
+    unsigned long time;
+} mss_host_csr_t;
+
+#define MSS_HOST_CSR_WRITE              0U
+#define MSS_HOST_CSR_SET                1U
+#define MSS_HOST_CSR_CLEAR              2U
+
+#define MSS_HOST_NUM_HARTS              5U
+
+/* Rate of mcycle and minstret, and of mtime and the time CSR */
+#ifndef MSS_HOST_CPU_HZ
+#define MSS_HOST_CPU_HZ                 600000000ULL
+#endif
+#ifndef MSS_HOST_MTIME_HZ
+#define MSS_HOST_MTIME_HZ               1000000ULL
+#endif
+
+/* Period of the timer which runs the models on a single CPU host */
+#ifndef MSS_HOST_TICK_US
+#define MSS_HOST_TICK_US                20U
+#endif
+
+unsigned long mss_host_csr_read(size_t csr);
+unsigned long mss_host_csr_access(size_t csr, unsigned long value, uint32_t op);
+
+/*
+ * The CSR access macros of encoding.h
+ */
+#define read_csr(reg) \
+    mss_host_csr_read(offsetof(mss_host_csr_t, reg))
+
+#define write_csr(reg, val) \
+    ((void)mss_host_csr_access(offsetof(mss_host_csr_t, reg), \
+                               (unsigned long)(val), MSS_HOST_CSR_WRITE))
+
+#define swap_csr(reg, val) \
+    mss_host_csr_access(offsetof(mss_host_csr_t, reg), \
+                        (unsigned long)(val), MSS_HOST_CSR_WRITE)
+
+#define set_csr(reg, bit) \
+    mss_host_csr_access(offsetof(mss_host_csr_t, reg), \
+                        (unsigned long)(bit), MSS_HOST_CSR_SET)
+
+#define clear_csr(reg, bit) \
+    mss_host_csr_access(offsetof(mss_host_csr_t, reg), \
+                        (unsigned long)(bit), MSS_HOST_CSR_CLEAR)
+
+#define read_reg(reg)   ((unsigned long)__builtin_frame_address(0))
+
+#define rdtime()        read_csr(time)
+#define rdcycle()       read_csr(cycle)
+#define rdinstret()     read_csr(instret)
+
+/***************************************************************************//**
+ * mss_host_model_init() maps the register blocks and puts the models in their
+ * reset state. It must be called once, before any HAL or driver function.
+ * Returns 0 on success, or -1 when the register blocks cannot be mapped at
+ * their addresses, or when the program is not linked below 4GB and the MAC
+ * is built with 32-bit DMA addresses.
+ */
+int mss_host_model_init(void);
+
+/***************************************************************************//**
+ * mss_host_model_start() starts the thread which runs the device models over
+ * and over, mss_host_model_stop() stops it. On a single CPU host, where such a
+ * thread would only run once a hart thread had used up its time slice, the
+ * models are run every MSS_HOST_TICK_US microseconds from a SIGALRM interval
+ * timer instead, which the test program must then leave to the model.
+ */
+int mss_host_model_start(void);
+void mss_host_model_stop(void);
+
+/***************************************************************************//**
+ * mss_host_model_step() runs each device model once, then takes the pending
+ * interrupts of the calling hart. It can be called from any thread, along
+ * with the model thread or instead of it.
+ */
+void mss_host_model_step(void);
+
+/***************************************************************************//**
+ * mss_host_set_hart() makes the calling thread hart hart_id, and has external
+ * interrupts delivered to it. It uses SIGUSR1, which the test program must
+ * leave to the model.
+ */
+void mss_host_set_hart(uint64_t hart_id);
+
+/***************************************************************************//**
+ * mss_host_irq_connect() sets the handler of a PLIC source, which is called
+ * as from handle_m_ext_interrupt() when the source is taken. When the handler
+ * returns EXT_IRQ_DISABLE the source is disabled on the hart, as on target.
+ */
+void mss_host_irq_connect(uint32_t source, uint8_t (*handler)(void));
+
+/***************************************************************************//**
+ * mss_host_wfi() takes the pending interrupts of the calling hart, or yields
+ * the host CPU when there are none. It stands for wfi in a wait loop.
+ */
+void mss_host_wfi(void);
+
+/***************************************************************************//**
+ * mss_host_mac_set_tx_hook() sets the function which is given the frames a
+ * MAC transmits while it is not in local loopback. mac is 0 or 1, queue is
+ * the transmit queue, 0 to 3 on the pMAC and 0 on the eMAC, which is
+ * selected by emac. Frames are dropped when there is no hook. The hook may
+ * pass the frame on to mss_host_mac_receive(), for example to connect the two
+ * MACs back to back.
+ */
+typedef void (*mss_host_mac_tx_hook_t)(uint32_t mac, uint32_t emac,
+                                       uint32_t queue, const uint8_t *frame,
+                                       uint32_t length);
+
+void mss_host_mac_set_tx_hook(mss_host_mac_tx_hook_t hook);
+
+/***************************************************************************//**
+ * mss_host_mac_receive() receives a frame on a receive queue of a MAC, as if
+ * it came in from the wire. Returns 0 when the frame is written to the
+ * receive ring, or -1 when it is dropped, because the receiver is disabled or
+ * the ring has no free buffer for it.
+ */
+int mss_host_mac_receive(uint32_t mac, uint32_t emac, uint32_t queue,
+                         const uint8_t *frame, uint32_t length);
+
+/*
+ * Between the host support and the device models
+ */
+void mss_host_lock(void);
+void mss_host_unlock(void);
+void mss_host_irq_set_level(uint32_t source, uint32_t level);
+uint64_t mss_host_time_ns(void);
+int mss_host_mac_reset(void);
+void mss_host_mac_step(void);
+void mss_host_mac_claim(uint32_t source);
+void mss_host_mac_acknowledge(uint32_t source);
+void mss_host_pdma_reset(void);
+void mss_host_pdma_step(void);
+void mss_host_pdma_update(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_HOST_H */
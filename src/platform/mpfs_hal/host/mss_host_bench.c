@@ -0,0 +1,397 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_host_bench.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Host native benchmark of the HAL and drivers
+ *
+ * Times the memory pool, asynchronous PDMA copies, the checksum library and
+ * MAC0 frames sent in local loopback, in host nanoseconds per operation. The MAC and PDMA runs
+ * exercise the descriptor and chain handling of the drivers together with
+ * their interrupt handlers, the times include the cost of the models.
+ *
+ * The program exits non zero when a check fails, so it can gate CI.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss_pdma/mss_pdma.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef HOST_BENCH_POOL_ITERATIONS
+#define HOST_BENCH_POOL_ITERATIONS      1000000U
+#endif
+#ifndef HOST_BENCH_PDMA_ITERATIONS
+#define HOST_BENCH_PDMA_ITERATIONS      2000U
+#endif
+#ifndef HOST_BENCH_CHECKSUM_ITERATIONS
+#define HOST_BENCH_CHECKSUM_ITERATIONS  2000U
+#endif
+#ifndef HOST_BENCH_MAC_FRAMES
+#define HOST_BENCH_MAC_FRAMES           20000U
+#endif
+
+#define HOST_BENCH_POOL_BLOCK           64U
+#define HOST_BENCH_POOL_BLOCKS          32U
+#define HOST_BENCH_PDMA_BYTES           65536U
+#define HOST_BENCH_FRAME_LENGTH         1514U
+
+/* A program hangs on a broken model rather than fails, so runs are bounded */
+#define HOST_BENCH_TIMEOUT_NS           10000000000ULL
+
+static uint64_t g_pool_storage[MSS_MEM_POOL_STORAGE_WORDS(HOST_BENCH_POOL_BLOCK,
+                                                          HOST_BENCH_POOL_BLOCKS)];
+static mss_mem_pool_t g_pool;
+
+static uint8_t g_pdma_src[HOST_BENCH_PDMA_BYTES] __attribute__((aligned(64)));
+static uint8_t g_pdma_dst[HOST_BENCH_PDMA_BYTES] __attribute__((aligned(64)));
+
+static uint8_t g_tx_frame[HOST_BENCH_FRAME_LENGTH] __attribute__((aligned(64)));
+static uint8_t g_rx_buffers[MSS_MAC_RX_RING_SIZE][MSS_MAC_MAX_RX_BUF_SIZE]
+    __attribute__((aligned(64)));
+static volatile uint32_t g_rx_count = 0U;
+static volatile uint32_t g_rx_errors = 0U;
+static volatile uint32_t g_tx_count = 0U;
+
+static uint32_t g_failures = 0U;
+
+static void bench_report(const char * name, uint64_t start_ns, uint32_t count);
+static void bench_check(uint32_t ok, const char * what);
+static void bench_pool(void);
+static void bench_pdma(void);
+static void bench_checksum(void);
+static void bench_mac(void);
+static void mac_rx_callback(void *this_mac, uint32_t queue_no,
+                            uint8_t *p_rx_packet, uint32_t pckt_length,
+                            mss_mac_rx_desc_t *cdesc, void *p_user_data);
+static void mac_tx_callback(void *this_mac, uint32_t queue_no,
+                            mss_mac_tx_desc_t *cdesc, void *p_user_data);
+
+int main(void)
+{
+    uint32_t source;
+
+    if(0 != mss_host_model_init())
+    {
+        return (EXIT_FAILURE);
+    }
+
+    mss_host_set_hart(1U);
+    PLIC_init();
+
+    mss_host_irq_connect(MAC0_INT_PLIC, mac0_int_plic_IRQHandler);
+    mss_host_irq_connect(MAC0_QUEUE1_PLIC, mac0_queue1_plic_IRQHandler);
+    mss_host_irq_connect(MAC0_QUEUE2_PLIC, mac0_queue2_plic_IRQHandler);
+    mss_host_irq_connect(MAC0_QUEUE3_PLIC, mac0_queue3_plic_IRQHandler);
+    mss_host_irq_connect(DMA_CH0_DONE_IRQn, dma_ch0_DONE_IRQHandler);
+    mss_host_irq_connect(DMA_CH0_ERR_IRQn, dma_ch0_ERR_IRQHandler);
+    mss_host_irq_connect(DMA_CH1_DONE_IRQn, dma_ch1_DONE_IRQHandler);
+    mss_host_irq_connect(DMA_CH1_ERR_IRQn, dma_ch1_ERR_IRQHandler);
+    mss_host_irq_connect(DMA_CH2_DONE_IRQn, dma_ch2_DONE_IRQHandler);
+    mss_host_irq_connect(DMA_CH2_ERR_IRQn, dma_ch2_ERR_IRQHandler);
+    mss_host_irq_connect(DMA_CH3_DONE_IRQn, dma_ch3_DONE_IRQHandler);
+    mss_host_irq_connect(DMA_CH3_ERR_IRQn, dma_ch3_ERR_IRQHandler);
+
+    /* The PDMA driver leaves the priorities of its sources to the program */
+    for(source = (uint32_t)DMA_CH0_DONE_IRQn;
+        source <= (uint32_t)DMA_CH3_ERR_IRQn; source++)
+    {
+        PLIC_SetPriority((PLIC_IRQn_Type)source, 1U);
+    }
+
+    if(0 != mss_host_model_start())
+    {
+        return (EXIT_FAILURE);
+    }
+
+    set_csr(mie, MIP_MEIP);
+    __enable_irq();
+
+    bench_pool();
+    bench_pdma();
+    bench_checksum();
+    bench_mac();
+
+    __disable_irq();
+    mss_host_model_stop();
+
+    (void)printf("%s\n", (0U == g_failures) ? "PASS" : "FAIL");
+
+    return ((0U == g_failures) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+static void bench_report(const char * name, uint64_t start_ns, uint32_t count)
+{
+    uint64_t elapsed_ns = mss_host_time_ns() - start_ns;
+
+    (void)printf("%-24s %10u ops %12.1f ns/op\n", name, count,
+                 (double)elapsed_ns / (double)((0U != count) ? count : 1U));
+}
+
+static void bench_check(uint32_t ok, const char * what)
+{
+    if(0U == ok)
+    {
+        (void)printf("check failed: %s\n", what);
+        g_failures++;
+    }
+}
+
+/*
+ * Allocates and frees runs of blocks
+ */
+static void bench_pool(void)
+{
+    void * blocks[HOST_BENCH_POOL_BLOCKS];
+    uint64_t start_ns;
+    uint32_t iteration;
+    uint32_t index;
+    uint32_t ok = 1U;
+
+    bench_check((SUCCESS == mss_mem_pool_init(&g_pool, g_pool_storage,
+                                              HOST_BENCH_POOL_BLOCK,
+                                              HOST_BENCH_POOL_BLOCKS)) ? 1U : 0U,
+                "mem_pool init");
+
+    start_ns = mss_host_time_ns();
+    for(iteration = 0U;
+        iteration < (HOST_BENCH_POOL_ITERATIONS / HOST_BENCH_POOL_BLOCKS);
+        iteration++)
+    {
+        for(index = 0U; index < HOST_BENCH_POOL_BLOCKS; index++)
+        {
+            blocks[index] = mss_mem_pool_alloc(&g_pool);
+            ok &= (NULL != blocks[index]) ? 1U : 0U;
+        }
+        for(index = 0U; index < HOST_BENCH_POOL_BLOCKS; index++)
+        {
+            mss_mem_pool_free(&g_pool, blocks[index]);
+        }
+    }
+    bench_report("mem_pool alloc+free", start_ns,
+                 (HOST_BENCH_POOL_ITERATIONS / HOST_BENCH_POOL_BLOCKS) *
+                 HOST_BENCH_POOL_BLOCKS);
+
+    bench_check(ok, "mem_pool alloc");
+}
+
+/*
+ * Copies a buffer with the PDMA, split over the idle channels
+ */
+static void bench_pdma(void)
+{
+    static mss_pdma_copy_token_t token;
+    uint64_t start_ns;
+    uint32_t iteration;
+    uint32_t ok = 1U;
+
+    MSS_PDMA_init();
+
+    start_ns = mss_host_time_ns();
+    for(iteration = 0U; iteration < HOST_BENCH_PDMA_ITERATIONS; iteration++)
+    {
+        memset(g_pdma_src, (int)(iteration & 0xFFU), sizeof(g_pdma_src));
+        ok &= (MSS_PDMA_OK == MSS_PDMA_memcpy_async(&token, g_pdma_dst,
+                                                    g_pdma_src,
+                                                    HOST_BENCH_PDMA_BYTES)) ? 1U : 0U;
+        ok &= (MSS_PDMA_OK == MSS_PDMA_copy_wait(&token)) ? 1U : 0U;
+        ok &= (0 == memcmp(g_pdma_dst, g_pdma_src, sizeof(g_pdma_dst))) ? 1U : 0U;
+    }
+    bench_report("pdma memcpy 64KB", start_ns, HOST_BENCH_PDMA_ITERATIONS);
+
+    bench_check(ok, "pdma copy");
+}
+
+/*
+ * Checks the checksums against known values, then computes each over 64KB
+ */
+static void bench_checksum(void)
+{
+    static const uint8_t inet_example[8] =
+    {
+        0x00U, 0x01U, 0xF2U, 0x03U, 0xF4U, 0xF5U, 0xF6U, 0xF7U
+    };
+    uint64_t start_ns;
+    uint32_t iteration;
+    uint32_t index;
+    uint32_t crc = 0U;
+
+    bench_check((MSS_CRC32_CHECK == mss_crc32(0U, "123456789", 9U)) ? 1U : 0U,
+                "crc32 check value");
+    bench_check((MSS_CRC16_CCITT_CHECK ==
+                 mss_crc16_ccitt(0U, "123456789", 9U)) ? 1U : 0U,
+                "crc16 check value");
+    bench_check((0x11E60398UL ==
+                 mss_adler32(MSS_ADLER32_INIT, "Wikipedia", 9U)) ? 1U : 0U,
+                "adler32 check value");
+    /* RFC 1071 example, the sum 0xDDF2 stored as 0x22 0x0D */
+    bench_check((0x0D22U == mss_inet_checksum(inet_example, 8U)) ? 1U : 0U,
+                "inet checksum example");
+
+    for(index = 0U; index < HOST_BENCH_PDMA_BYTES; index++)
+    {
+        g_pdma_src[index] = (uint8_t)((index * 2654435761U) >> 24U);
+    }
+
+    /* Unaligned starts and splits give the same results */
+    memcpy(&g_pdma_dst[1], g_pdma_src, 1001U);
+    bench_check((mss_inet_checksum(g_pdma_src, 1001U) ==
+                 mss_inet_checksum(&g_pdma_dst[1], 1001U)) ? 1U : 0U,
+                "inet checksum unaligned");
+    bench_check((mss_inet_fold(mss_inet_sum(mss_inet_sum(0U, g_pdma_src, 334U),
+                                            &g_pdma_src[334], 667U)) ==
+                 mss_inet_checksum(g_pdma_src, 1001U)) ? 1U : 0U,
+                "inet checksum split");
+    bench_check((mss_crc32(mss_crc32(0U, &g_pdma_dst[1], 333U),
+                           &g_pdma_dst[334], 668U) ==
+                 mss_crc32(0U, g_pdma_src, 1001U)) ? 1U : 0U,
+                "crc32 unaligned split");
+
+    start_ns = mss_host_time_ns();
+    for(iteration = 0U; iteration < HOST_BENCH_CHECKSUM_ITERATIONS; iteration++)
+    {
+        crc ^= mss_crc32(0U, g_pdma_src, HOST_BENCH_PDMA_BYTES);
+    }
+    bench_report("crc32 64KB", start_ns, HOST_BENCH_CHECKSUM_ITERATIONS);
+
+    start_ns = mss_host_time_ns();
+    for(iteration = 0U; iteration < HOST_BENCH_CHECKSUM_ITERATIONS; iteration++)
+    {
+        crc ^= mss_crc16_ccitt(0U, g_pdma_src, HOST_BENCH_PDMA_BYTES);
+    }
+    bench_report("crc16_ccitt 64KB", start_ns, HOST_BENCH_CHECKSUM_ITERATIONS);
+
+    start_ns = mss_host_time_ns();
+    for(iteration = 0U; iteration < HOST_BENCH_CHECKSUM_ITERATIONS; iteration++)
+    {
+        crc ^= mss_adler32(MSS_ADLER32_INIT, g_pdma_src, HOST_BENCH_PDMA_BYTES);
+    }
+    bench_report("adler32 64KB", start_ns, HOST_BENCH_CHECKSUM_ITERATIONS);
+
+    start_ns = mss_host_time_ns();
+    for(iteration = 0U; iteration < HOST_BENCH_CHECKSUM_ITERATIONS; iteration++)
+    {
+        crc ^= mss_inet_checksum(g_pdma_src, HOST_BENCH_PDMA_BYTES);
+    }
+    bench_report("inet_checksum 64KB", start_ns, HOST_BENCH_CHECKSUM_ITERATIONS);
+
+    /* Keeps the loops from being optimised away */
+    bench_check((0xFFFFFFFFUL != crc) ? 1U : 0U, "checksum loop");
+}
+
+/*
+ * Sends frames on MAC0 queue 0 in local loopback, one in flight at a time
+ */
+static void bench_mac(void)
+{
+    mss_mac_cfg_t cfg;
+    uint64_t start_ns;
+    uint64_t deadline_ns;
+    uint32_t frame;
+    uint32_t index;
+
+    MSS_MAC_cfg_struct_def_init(&cfg);
+    cfg.interface_type = NULL_PHY;
+    cfg.phy_type = MSS_MAC_DEV_PHY_NULL;
+    cfg.loopback = MSS_MAC_LOOPBACK_ENABLE;
+    cfg.mac_addr[0] = 0x00U;
+    cfg.mac_addr[1] = 0xFCU;
+    cfg.mac_addr[2] = 0x00U;
+    cfg.mac_addr[3] = 0x12U;
+    cfg.mac_addr[4] = 0x34U;
+    cfg.mac_addr[5] = 0x56U;
+
+    MSS_MAC_init(&g_mac0, &cfg);
+    MSS_MAC_set_tx_callback(&g_mac0, 0U, mac_tx_callback);
+    MSS_MAC_set_rx_callback(&g_mac0, 0U, mac_rx_callback);
+
+    for(index = 0U; index < MSS_MAC_RX_RING_SIZE; index++)
+    {
+        (void)MSS_MAC_receive_pkt(&g_mac0, 0U, g_rx_buffers[index], NULL,
+                                  (index == (MSS_MAC_RX_RING_SIZE - 1U)) ?
+                                  MSS_MAC_INT_ENABLE : MSS_MAC_INT_ARM);
+    }
+
+    memset(g_tx_frame, 0xFF, 6U);
+    memcpy(&g_tx_frame[6], cfg.mac_addr, 6U);
+    g_tx_frame[12] = 0x88U;
+    g_tx_frame[13] = 0xB5U;
+    for(index = 14U; index < HOST_BENCH_FRAME_LENGTH; index++)
+    {
+        g_tx_frame[index] = (uint8_t)index;
+    }
+
+    start_ns = mss_host_time_ns();
+    deadline_ns = start_ns + HOST_BENCH_TIMEOUT_NS;
+    for(frame = 0U;
+        (frame < HOST_BENCH_MAC_FRAMES) && (mss_host_time_ns() < deadline_ns);
+        frame++)
+    {
+        while((MSS_MAC_SUCCESS != MSS_MAC_send_pkt(&g_mac0, 0U, g_tx_frame,
+                                                   HOST_BENCH_FRAME_LENGTH,
+                                                   NULL)) &&
+              (mss_host_time_ns() < deadline_ns))
+        {
+            mss_host_wfi();
+        }
+
+        while((g_rx_count <= frame) && (mss_host_time_ns() < deadline_ns))
+        {
+            mss_host_wfi();
+        }
+    }
+    bench_report("mac0 loopback 1514B", start_ns, g_rx_count);
+
+    bench_check((HOST_BENCH_MAC_FRAMES == g_rx_count) ? 1U : 0U,
+                "mac0 frames received");
+    bench_check((0U == g_rx_errors) ? 1U : 0U, "mac0 frame contents");
+    bench_check((g_tx_count >= (HOST_BENCH_MAC_FRAMES - MSS_MAC_TX_RING_SIZE)) ?
+                1U : 0U, "mac0 transmit completions");
+}
+
+static void mac_rx_callback(void *this_mac, uint32_t queue_no,
+                            uint8_t *p_rx_packet, uint32_t pckt_length,
+                            mss_mac_rx_desc_t *cdesc, void *p_user_data)
+{
+    (void)cdesc;
+
+    if((HOST_BENCH_FRAME_LENGTH != pckt_length) ||
+       (0 != memcmp(p_rx_packet, g_tx_frame, HOST_BENCH_FRAME_LENGTH)))
+    {
+        g_rx_errors++;
+    }
+    g_rx_count++;
+
+    (void)MSS_MAC_receive_pkt((mss_mac_instance_t *)this_mac, queue_no,
+                              p_rx_packet, p_user_data, MSS_MAC_INT_ENABLE);
+}
+
+static void mac_tx_callback(void *this_mac, uint32_t queue_no,
+                            mss_mac_tx_desc_t *cdesc, void *p_user_data)
+{
+    (void)this_mac;
+    (void)queue_no;
+    (void)cdesc;
+    (void)p_user_data;
+
+    g_tx_count++;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,618 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_host_mac.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Host native build, behavioural model of the GEM DMA
+ *
+ * Models the transmit and receive descriptor rings of the pMAC queues and of
+ * the eMAC of both MACs, their interrupt status, enable and mask registers
+ * and the status bits of TRANSMIT_STATUS and RECEIVE_STATUS the driver uses.
+ * See mss_host.h for what is left out.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss_ethernet_mac/mss_ethernet_mac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HOST_MAC_PORTS                  4U
+#define HOST_MAC_QUEUES                 4U
+
+/* Largest frame and longest descriptor walk for one frame */
+#define HOST_MAC_MAX_FRAME              10240U
+#define HOST_MAC_MAX_BUFFERS            256U
+
+/* Frames a transmit queue sends in one step */
+#define HOST_MAC_TX_BURST               64U
+
+#define HOST_MAC_RX_BUF_UNIT            64U
+
+#if defined(MSS_MAC_TIME_STAMPED_MODE)
+#define HOST_MAC_RX_ADDR_MASK           (~(uint32_t)(GEM_RX_DMA_WRAP | GEM_RX_DMA_USED | GEM_RX_DMA_TS_PRESENT))
+#else
+#define HOST_MAC_RX_ADDR_MASK           (~(uint32_t)(GEM_RX_DMA_WRAP | GEM_RX_DMA_USED))
+#endif
+
+/*
+ * Registers of a queue. Queue 0 has its registers among those of the MAC,
+ * the others have theirs in arrays further up.
+ */
+typedef struct
+{
+    volatile uint32_t * int_status;
+    volatile uint32_t * int_enable;
+    volatile uint32_t * int_disable;
+    volatile uint32_t * int_mask;
+    volatile uint32_t * tx_q_ptr;
+    volatile uint32_t * rx_q_ptr;
+    volatile uint32_t * rx_buf_size;     /* DMA_CONFIG for queue 0 */
+} host_mac_queue_regs_t;
+
+typedef struct
+{
+    host_mac_queue_regs_t regs;
+    uint32_t status;                        /* Interrupt status */
+    uint32_t status_published;
+    uint32_t status_claimed;                /* Status a handler was entered with */
+    uint32_t mask;
+    uint32_t tx_ptr_published;
+    uint64_t tx_base;
+    uint64_t tx_current;
+    uint32_t tx_go;
+    uint32_t rx_ptr_published;
+    uint64_t rx_base;
+    uint64_t rx_current;
+    uint32_t irq;
+} host_mac_queue_t;
+
+typedef struct
+{
+    MAC_TypeDef * regs;                     /* eMAC registers are laid out alike */
+    uint32_t mac;
+    uint32_t emac;
+    uint32_t queue_count;
+    uint32_t tx_status;
+    uint32_t tx_status_published;
+    uint32_t rx_status;
+    uint32_t rx_status_published;
+    host_mac_queue_t queue[HOST_MAC_QUEUES];
+} host_mac_port_t;
+
+static host_mac_port_t g_host_mac[HOST_MAC_PORTS];
+static mss_host_mac_tx_hook_t g_host_mac_tx_hook = NULL;
+static uint8_t g_host_mac_frame[HOST_MAC_MAX_FRAME];
+static const uint8_t g_host_mac_bcast[6] = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+
+static const uint32_t g_host_mac_irq[HOST_MAC_PORTS][HOST_MAC_QUEUES] =
+{
+    { MAC0_INT_PLIC, MAC0_QUEUE1_PLIC, MAC0_QUEUE2_PLIC, MAC0_QUEUE3_PLIC },
+    { MAC0_EMAC_PLIC, 0U, 0U, 0U },
+    { MAC1_INT_PLIC, MAC1_QUEUE1_PLIC, MAC1_QUEUE2_PLIC, MAC1_QUEUE3_PLIC },
+    { MAC1_EMAC_PLIC, 0U, 0U, 0U }
+};
+
+static void host_mac_sync(host_mac_port_t * port);
+static uint32_t host_mac_w1c(volatile uint32_t * reg, uint32_t * published, uint32_t value);
+static void host_mac_sync_ptr(volatile uint32_t * reg, uint32_t * published,
+                              uint32_t upper, uint64_t * base, uint64_t * current);
+static void host_mac_publish_ptr(volatile uint32_t * reg, uint32_t * published, uint64_t current);
+static void host_mac_update_irq(host_mac_port_t * port);
+static void host_mac_tx(host_mac_port_t * port, uint32_t queue_no);
+static int host_mac_rx(host_mac_port_t * port, uint32_t queue_no, const uint8_t * frame,
+                       uint32_t length);
+
+/***************************************************************************//**
+ * Puts the MACs in their reset state, with all interrupts masked
+ */
+int mss_host_mac_reset(void)
+{
+    int status = 0;
+    host_mac_port_t * port;
+    host_mac_queue_t * queue;
+    uint32_t port_no;
+    uint32_t queue_no;
+
+    /*
+     * The driver writes the low 32 bits of its descriptor ring addresses to
+     * the queue pointers. Read back, as the compiler may take the address of a
+     * static object to be below 4GB.
+     */
+    volatile uintptr_t image_address = (uintptr_t)&g_host_mac;
+
+    if((uint64_t)image_address > 0xFFFFFFFFULL)
+    {
+        (void)fprintf(stderr, "mss_host: the program must be linked with -no-pie\n");
+        status = -1;
+    }
+
+    memset(g_host_mac, 0, sizeof(g_host_mac));
+
+    for(port_no = 0U; port_no < HOST_MAC_PORTS; port_no++)
+    {
+        port = &g_host_mac[port_no];
+        port->regs = (MAC_TypeDef *)(0x20110000UL + (port_no * 0x1000UL));
+        port->mac = port_no / 2U;
+        port->emac = port_no % 2U;
+        port->queue_count = (0U != port->emac) ? 1U : HOST_MAC_QUEUES;
+
+        /* MDIO is not modelled, so management operations are always done */
+        *(volatile uint32_t *)&port->regs->NETWORK_STATUS = GEM_MAN_DONE;
+
+        for(queue_no = 0U; queue_no < port->queue_count; queue_no++)
+        {
+            queue = &port->queue[queue_no];
+            if(0U == queue_no)
+            {
+                queue->regs.int_status  = &port->regs->INT_STATUS;
+                queue->regs.int_enable  = &port->regs->INT_ENABLE;
+                queue->regs.int_disable = &port->regs->INT_DISABLE;
+                queue->regs.int_mask    = &port->regs->INT_MASK;
+                queue->regs.tx_q_ptr    = &port->regs->TRANSMIT_Q_PTR;
+                queue->regs.rx_q_ptr    = &port->regs->RECEIVE_Q_PTR;
+                queue->regs.rx_buf_size = &port->regs->DMA_CONFIG;
+            }
+            else
+            {
+                queue->regs.int_status  = &(&port->regs->INT_Q1_STATUS)[queue_no - 1U];
+                queue->regs.int_enable  = &(&port->regs->INT_Q1_ENABLE)[queue_no - 1U];
+                queue->regs.int_disable = &(&port->regs->INT_Q1_DISABLE)[queue_no - 1U];
+                queue->regs.int_mask    = &(&port->regs->INT_Q1_MASK)[queue_no - 1U];
+                queue->regs.tx_q_ptr    = &(&port->regs->TRANSMIT_Q1_PTR)[queue_no - 1U];
+                queue->regs.rx_q_ptr    = &(&port->regs->RECEIVE_Q1_PTR)[queue_no - 1U];
+                queue->regs.rx_buf_size = &(&port->regs->DMA_RXBUF_SIZE_Q1)[queue_no - 1U];
+            }
+            queue->mask = 0xFFFFFFFFU;
+            *queue->regs.int_mask = queue->mask;
+            queue->irq = g_host_mac_irq[port_no][queue_no];
+        }
+    }
+
+    return (status);
+}
+
+/***************************************************************************//**
+ * Runs the MACs once, called with the model lock held
+ */
+void mss_host_mac_step(void)
+{
+    host_mac_port_t * port;
+    uint32_t port_no;
+    uint32_t queue_no;
+    uint32_t control;
+
+    for(port_no = 0U; port_no < HOST_MAC_PORTS; port_no++)
+    {
+        port = &g_host_mac[port_no];
+
+        /* The driver writes the queue pointers before it starts transmit */
+        control = port->regs->NETWORK_CONTROL;
+        host_mac_sync(port);
+
+        if(0U != (control & GEM_TRANSMIT_START))
+        {
+            (void)__atomic_fetch_and(&port->regs->NETWORK_CONTROL,
+                                     ~(uint32_t)GEM_TRANSMIT_START, __ATOMIC_SEQ_CST);
+            for(queue_no = 0U; queue_no < port->queue_count; queue_no++)
+            {
+                port->queue[queue_no].tx_go = 1U;
+            }
+        }
+
+        if((0U != (control & GEM_TRANSMIT_HALT)) || (0U == (control & GEM_ENABLE_TRANSMIT)))
+        {
+            (void)__atomic_fetch_and(&port->regs->NETWORK_CONTROL,
+                                     ~(uint32_t)GEM_TRANSMIT_HALT, __ATOMIC_SEQ_CST);
+            for(queue_no = 0U; queue_no < port->queue_count; queue_no++)
+            {
+                port->queue[queue_no].tx_go = 0U;
+            }
+        }
+
+        /* The highest queue has the highest priority */
+        for(queue_no = port->queue_count; queue_no != 0U; queue_no--)
+        {
+            host_mac_tx(port, queue_no - 1U);
+        }
+
+        host_mac_sync(port);
+        host_mac_update_irq(port);
+    }
+}
+
+/***************************************************************************//**
+ * Records the interrupt status of a queue as a handler is entered for it,
+ * called with the model lock held
+ */
+void mss_host_mac_claim(uint32_t source)
+{
+    host_mac_port_t * port;
+    uint32_t port_no;
+    uint32_t queue_no;
+
+    for(port_no = 0U; port_no < HOST_MAC_PORTS; port_no++)
+    {
+        port = &g_host_mac[port_no];
+        for(queue_no = 0U; queue_no < port->queue_count; queue_no++)
+        {
+            if(source == port->queue[queue_no].irq)
+            {
+                host_mac_sync(port);
+                port->queue[queue_no].status_claimed = port->queue[queue_no].status;
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Clears the interrupt status a handler was entered with once it returns,
+ * called with the model lock held
+ */
+void mss_host_mac_acknowledge(uint32_t source)
+{
+    host_mac_port_t * port;
+    host_mac_queue_t * queue;
+    uint32_t port_no;
+    uint32_t queue_no;
+
+    for(port_no = 0U; port_no < HOST_MAC_PORTS; port_no++)
+    {
+        port = &g_host_mac[port_no];
+        for(queue_no = 0U; queue_no < port->queue_count; queue_no++)
+        {
+            queue = &port->queue[queue_no];
+            if(source == queue->irq)
+            {
+                host_mac_sync(port);
+                queue->status &= ~queue->status_claimed;
+                queue->status_claimed = 0U;
+                host_mac_sync(port);
+                host_mac_update_irq(port);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+void mss_host_mac_set_tx_hook(mss_host_mac_tx_hook_t hook)
+{
+    g_host_mac_tx_hook = hook;
+}
+
+/***************************************************************************//**
+ * See mss_host.h
+ */
+int mss_host_mac_receive(uint32_t mac, uint32_t emac, uint32_t queue,
+                         const uint8_t *frame, uint32_t length)
+{
+    int status = -1;
+    host_mac_port_t * port = &g_host_mac[((mac & 1U) * 2U) + (emac & 1U)];
+
+    if(queue < port->queue_count)
+    {
+        mss_host_lock();
+        host_mac_sync(port);
+        status = host_mac_rx(port, queue, frame, length);
+        host_mac_sync(port);
+        host_mac_update_irq(port);
+        mss_host_unlock();
+    }
+
+    return (status);
+}
+
+/***************************************************************************//**
+ * Brings the model up to date with what the driver wrote to the registers
+ * since the last step and publishes the model state in the registers
+ */
+static void host_mac_sync(host_mac_port_t * port)
+{
+    host_mac_queue_t * queue;
+    uint32_t queue_no;
+    uint32_t bits;
+    uint32_t go = 0U;
+
+    for(queue_no = 0U; queue_no < port->queue_count; queue_no++)
+    {
+        queue = &port->queue[queue_no];
+
+        /*
+         * When both were written since the last step, the disable is taken to
+         * come first, as when the driver sets up a queue
+         */
+        bits = __atomic_exchange_n(queue->regs.int_disable, 0U, __ATOMIC_SEQ_CST);
+        queue->mask |= bits;
+        bits = __atomic_exchange_n(queue->regs.int_enable, 0U, __ATOMIC_SEQ_CST);
+        queue->mask &= ~bits;
+        *queue->regs.int_mask = queue->mask;
+
+        queue->status = host_mac_w1c(queue->regs.int_status, &queue->status_published,
+                                     queue->status);
+
+        host_mac_sync_ptr(queue->regs.tx_q_ptr, &queue->tx_ptr_published,
+                          port->regs->UPPER_TX_Q_BASE_ADDR, &queue->tx_base,
+                          &queue->tx_current);
+        host_mac_sync_ptr(queue->regs.rx_q_ptr, &queue->rx_ptr_published,
+                          port->regs->UPPER_RX_Q_BASE_ADDR, &queue->rx_base,
+                          &queue->rx_current);
+
+        go |= queue->tx_go;
+    }
+
+    port->tx_status &= ~(uint32_t)GEM_TRANSMIT_GO;
+    port->tx_status = host_mac_w1c(&port->regs->TRANSMIT_STATUS,
+                                   &port->tx_status_published,
+                                   port->tx_status | ((0U != go) ? GEM_TRANSMIT_GO : 0U));
+    port->rx_status = host_mac_w1c(&port->regs->RECEIVE_STATUS,
+                                   &port->rx_status_published, port->rx_status);
+}
+
+/***************************************************************************//**
+ * A write to a write one to clear register shows as a value other than the
+ * one last published. Returns the new value, which is published.
+ */
+static uint32_t host_mac_w1c(volatile uint32_t * reg, uint32_t * published, uint32_t value)
+{
+    uint32_t current = *reg;
+    uint32_t new_value = value;
+
+    if(current != *published)
+    {
+        new_value &= ~current;
+    }
+
+    if(__atomic_compare_exchange_n(reg, &current, new_value, 0,
+                                   __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+    {
+        *published = new_value;
+    }
+
+    return (new_value);
+}
+
+/***************************************************************************//**
+ * The queue pointer registers read back the descriptor the DMA is at, so a
+ * value other than that is a new queue base written by the driver. Bit 0
+ * disables the queue.
+ */
+static void host_mac_sync_ptr(volatile uint32_t * reg, uint32_t * published,
+                              uint32_t upper, uint64_t * base, uint64_t * current)
+{
+    uint32_t value = *reg;
+
+#if !defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+    upper = 0U;
+#endif
+    if(value != *published)
+    {
+        *base = ((uint64_t)upper << 32) | (uint64_t)(value & ~3U);
+        *current = *base;
+        *published = value;
+    }
+}
+
+static void host_mac_publish_ptr(volatile uint32_t * reg, uint32_t * published, uint64_t current)
+{
+    uint32_t expected = *published;
+    uint32_t new_value = (uint32_t)current | (expected & 3U);
+
+    if(__atomic_compare_exchange_n(reg, &expected, new_value, 0,
+                                   __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+    {
+        *published = new_value;
+    }
+}
+
+/***************************************************************************//**
+ * The interrupt of a queue is a level, high while an unmasked status bit is
+ * set
+ */
+static void host_mac_update_irq(host_mac_port_t * port)
+{
+    host_mac_queue_t * queue;
+    uint32_t queue_no;
+
+    for(queue_no = 0U; queue_no < port->queue_count; queue_no++)
+    {
+        queue = &port->queue[queue_no];
+        mss_host_irq_set_level(queue->irq, queue->status & ~queue->mask);
+    }
+}
+
+/***************************************************************************//**
+ * Sends the frames ready on a transmit queue. The used bit is written back to
+ * the first descriptor of each frame, and the queue stops at a descriptor
+ * with the used bit set.
+ */
+static void host_mac_tx(host_mac_port_t * port, uint32_t queue_no)
+{
+    host_mac_queue_t * queue = &port->queue[queue_no];
+    volatile mss_mac_tx_desc_t * desc;
+    volatile mss_mac_tx_desc_t * first;
+    uint64_t next;
+    uint64_t buffer;
+    uint32_t status;
+    uint32_t length;
+    uint32_t copy;
+    uint32_t buffers;
+    uint32_t frames = 0U;
+    uint32_t done;
+
+    if((0U != (queue->tx_ptr_published & 1U)) || (0U == queue->tx_current))
+    {
+        queue->tx_go = 0U;  /* Queue disabled */
+    }
+
+    while((0U != queue->tx_go) && (frames < HOST_MAC_TX_BURST))
+    {
+        first = (volatile mss_mac_tx_desc_t *)(uintptr_t)queue->tx_current;
+        if(0U != (first->status & GEM_TX_DMA_USED))
+        {
+            queue->tx_go = 0U;
+        }
+        else
+        {
+            length = 0U;
+            buffers = 0U;
+            done = 0U;
+            next = queue->tx_current;
+
+            while((0U == done) && (buffers < HOST_MAC_MAX_BUFFERS))
+            {
+                desc = (volatile mss_mac_tx_desc_t *)(uintptr_t)next;
+                status = desc->status;
+                buffer = (uint64_t)desc->addr_low;
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+                buffer |= (uint64_t)desc->addr_high << 32;
+#endif
+                copy = status & GEM_TX_DMA_BUFF_LEN;
+                if(copy > (HOST_MAC_MAX_FRAME - length))
+                {
+                    copy = HOST_MAC_MAX_FRAME - length;
+                }
+                memcpy(&g_host_mac_frame[length], (const void *)(uintptr_t)buffer, copy);
+                length += copy;
+                buffers++;
+
+                next = (0U != (status & GEM_TX_DMA_WRAP)) ? queue->tx_base :
+                       (next + sizeof(mss_mac_tx_desc_t));
+                done = (0U != (status & GEM_TX_DMA_LAST)) ? 1U : 0U;
+            }
+
+            (void)__atomic_fetch_or(&first->status, (uint32_t)GEM_TX_DMA_USED, __ATOMIC_SEQ_CST);
+            queue->tx_current = next;
+            host_mac_publish_ptr(queue->regs.tx_q_ptr, &queue->tx_ptr_published, next);
+            frames++;
+
+            port->tx_status |= GEM_STAT_TRANSMIT_COMPLETE;
+            queue->status |= GEM_TRANSMIT_COMPLETE;
+
+            if(0U != (port->regs->NETWORK_CONTROL & GEM_LOOPBACK_LOCAL))
+            {
+                (void)host_mac_rx(port, 0U, g_host_mac_frame, length);
+            }
+            else if(NULL != g_host_mac_tx_hook)
+            {
+                g_host_mac_tx_hook(port->mac, port->emac, queue_no, g_host_mac_frame, length);
+            }
+            else
+            {
+                /* Off into the void */
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ * Writes a frame into the buffers of a receive queue. The frame is dropped
+ * when the ring does not have enough free buffers for it.
+ */
+static int host_mac_rx(host_mac_port_t * port, uint32_t queue_no, const uint8_t * frame,
+                       uint32_t length)
+{
+    int status = -1;
+    host_mac_queue_t * queue = &port->queue[queue_no];
+    volatile mss_mac_rx_desc_t * desc;
+    uint64_t next;
+    uint64_t buffer;
+    uint32_t buf_size;
+    uint32_t needed;
+    uint32_t index;
+    uint32_t offset = 0U;
+    uint32_t copy;
+    uint32_t word;
+
+    if(0U == queue_no)
+    {
+        buf_size = ((*queue->regs.rx_buf_size >> GEM_RX_BUF_SIZE_SHIFT) & 0xFFU) *
+                   HOST_MAC_RX_BUF_UNIT;
+    }
+    else
+    {
+        buf_size = (*queue->regs.rx_buf_size & 0xFFU) * HOST_MAC_RX_BUF_UNIT;
+    }
+
+    if((0U != (port->regs->NETWORK_CONTROL & GEM_ENABLE_RECEIVE)) &&
+       (0U == (queue->rx_ptr_published & 1U)) && (0U != queue->rx_current) &&
+       (0U != buf_size) && (0U != length) && (length <= HOST_MAC_MAX_FRAME))
+    {
+        needed = (length + buf_size - 1U) / buf_size;
+
+        /* All the buffers of the frame must be free */
+        status = 0;
+        next = queue->rx_current;
+        for(index = 0U; (0 == status) && (index < needed); index++)
+        {
+            desc = (volatile mss_mac_rx_desc_t *)(uintptr_t)next;
+            word = desc->addr_low;
+            if(0U != (word & GEM_RX_DMA_USED))
+            {
+                status = -1;
+            }
+            next = (0U != (word & GEM_RX_DMA_WRAP)) ? queue->rx_base :
+                   (next + sizeof(mss_mac_rx_desc_t));
+        }
+
+        if(0 == status)
+        {
+            next = queue->rx_current;
+            for(index = 0U; index < needed; index++)
+            {
+                desc = (volatile mss_mac_rx_desc_t *)(uintptr_t)next;
+                word = desc->addr_low;
+                buffer = (uint64_t)(word & HOST_MAC_RX_ADDR_MASK);
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+                buffer |= (uint64_t)desc->addr_high << 32;
+#endif
+                copy = ((length - offset) > buf_size) ? buf_size : (length - offset);
+                memcpy((void *)(uintptr_t)buffer, &frame[offset], copy);
+                offset += copy;
+
+                desc->status = ((0U == index) ? GEM_RX_DMA_START_OF_FRAME : 0U) |
+                               (((index + 1U) == needed) ?
+                                (GEM_RX_DMA_END_OF_FRAME |
+                                 (length & (GEM_RX_DMA_BUFF_LEN | GEM_RX_DMA_JUMBO_BIT_13))) : 0U) |
+                               (((length >= 6U) &&
+                                 (0U == memcmp(frame, g_host_mac_bcast, 6U))) ?
+                                GEM_RX_DMA_BCAST : 0U);
+                __sync_synchronize();
+                desc->addr_low = word | GEM_RX_DMA_USED;
+
+                next = (0U != (word & GEM_RX_DMA_WRAP)) ? queue->rx_base :
+                       (next + sizeof(mss_mac_rx_desc_t));
+            }
+
+            queue->rx_current = next;
+            host_mac_publish_ptr(queue->regs.rx_q_ptr, &queue->rx_ptr_published, next);
+            port->rx_status |= GEM_FRAME_RECEIVED;
+            queue->status |= GEM_RECEIVE_COMPLETE;
+        }
+    }
+
+    if((0 != status) && (0U != (port->regs->NETWORK_CONTROL & GEM_ENABLE_RECEIVE)))
+    {
+        port->rx_status |= GEM_BUFFER_NOT_AVAILABLE;
+        queue->status |= GEM_RX_USED_BIT_READ;
+    }
+
+    return (status);
+}
+
+#ifdef __cplusplus
+}
+#endif
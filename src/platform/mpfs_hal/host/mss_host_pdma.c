@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_host_pdma.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Host native build, behavioural model of the PDMA
+ *
+ * A channel copies next_bytes from next_source to next_destination in one
+ * step once its run bit is set, then sets its done bit and raises its done
+ * interrupt if enabled. In repeat mode the transfer is copied again each step
+ * until the run bit is cleared. A transfer with a null address sets the error
+ * bit instead.
+ */
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss_pdma/mss_pdma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HOST_PDMA_CHANNELS              4U
+
+/* The exec registers are read only to the driver */
+#define HOST_PDMA_EXEC32(reg)           (*(volatile uint32_t *)&(reg))
+#define HOST_PDMA_EXEC64(reg)           (*(volatile uint64_t *)&(reg))
+
+static mss_pdma_t * host_pdma_channel(uint32_t channel);
+
+/***************************************************************************//**
+ * Puts the channels in their reset state
+ */
+void mss_host_pdma_reset(void)
+{
+    uint32_t channel;
+
+    for(channel = 0U; channel < HOST_PDMA_CHANNELS; channel++)
+    {
+        memset((void *)host_pdma_channel(channel), 0, sizeof(mss_pdma_t));
+    }
+}
+
+/***************************************************************************//**
+ * Runs the channels once, called with the model lock held
+ */
+void mss_host_pdma_step(void)
+{
+    mss_pdma_t * regs;
+    uint32_t channel;
+    uint32_t control;
+    uint64_t bytes;
+
+    for(channel = 0U; channel < HOST_PDMA_CHANNELS; channel++)
+    {
+        regs = host_pdma_channel(channel);
+        control = regs->control_reg;
+
+        if(0U != (control & MASK_PDMA_CONTROL_RUN))
+        {
+            bytes = regs->next_bytes;
+            HOST_PDMA_EXEC32(regs->exec_config) = regs->next_config;
+            HOST_PDMA_EXEC64(regs->exec_bytes) = bytes;
+            HOST_PDMA_EXEC64(regs->exec_destination) = regs->next_destination;
+            HOST_PDMA_EXEC64(regs->exec_source) = regs->next_source;
+
+            if((0U == regs->next_destination) || (0U == regs->next_source))
+            {
+                (void)__atomic_fetch_and(&regs->control_reg,
+                                         ~(uint32_t)MASK_PDMA_CONTROL_RUN, __ATOMIC_SEQ_CST);
+                (void)__atomic_fetch_or(&regs->control_reg,
+                                        (uint32_t)MASK_PDMA_TRANSFER_ERROR, __ATOMIC_SEQ_CST);
+            }
+            else
+            {
+                memmove((void *)(uintptr_t)regs->next_destination,
+                        (const void *)(uintptr_t)regs->next_source, (size_t)bytes);
+                HOST_PDMA_EXEC64(regs->exec_bytes) = 0U;
+
+                if(0U == (regs->next_config & MASK_REPEAT_TRANSCTION))
+                {
+                    (void)__atomic_fetch_and(&regs->control_reg,
+                                             ~(uint32_t)MASK_PDMA_CONTROL_RUN, __ATOMIC_SEQ_CST);
+                }
+                (void)__atomic_fetch_or(&regs->control_reg,
+                                        (uint32_t)MASK_PDMA_TRANSFER_DONE, __ATOMIC_SEQ_CST);
+            }
+        }
+    }
+
+    mss_host_pdma_update();
+}
+
+/***************************************************************************//**
+ * The done and error interrupts of a channel are levels, high while the bit
+ * is set and the interrupt enabled. Called with the model lock held.
+ */
+void mss_host_pdma_update(void)
+{
+    mss_pdma_t * regs;
+    uint32_t channel;
+    uint32_t control;
+
+    for(channel = 0U; channel < HOST_PDMA_CHANNELS; channel++)
+    {
+        regs = host_pdma_channel(channel);
+        control = regs->control_reg;
+
+        mss_host_irq_set_level((uint32_t)DMA_CH0_DONE_IRQn + (channel * 2U),
+                               ((0U != (control & MASK_PDMA_TRANSFER_DONE)) &&
+                                (0U != (control & MASK_PDMA_ENABLE_DONE_INT))) ? 1U : 0U);
+        mss_host_irq_set_level((uint32_t)DMA_CH0_ERR_IRQn + (channel * 2U),
+                               ((0U != (control & MASK_PDMA_TRANSFER_ERROR)) &&
+                                (0U != (control & MASK_PDMA_ENABLE_ERR_INT))) ? 1U : 0U);
+    }
+}
+
+static mss_pdma_t * host_pdma_channel(uint32_t channel)
+{
+    return ((mss_pdma_t *)(uintptr_t)(PDMA_REG_BASE + (channel * PDMA_CHL_REG_OFFSET)));
+}
+
+#ifdef __cplusplus
+}
+#endif
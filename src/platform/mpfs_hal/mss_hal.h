@@ -50,18 +50,49 @@ typedef long            ssize_t;
 #include "fpga_design_config/fpga_design_config.h"
 #include "common/nwc/mss_ddr.h"
 #include "common/mss_clint.h"
+#include "common/mss_sw_timer.h"
 #include "common/mss_h2f.h"
 #include "common/mss_hart_ints.h"
 #include "common/mss_mpu.h"
 #include "common/mss_pmp.h"
+#include "common/mss_pmp_region.h"
 #include "common/mss_plic.h"
 #include "common/mss_seg.h"
 #include "common/mss_sysreg.h"
 #include "common/mss_util.h"
+#include "common/mss_lock.h"
+#include "common/mss_counter.h"
 #include "common/mss_mtrap.h"
+#include "common/mss_print.h"
+#include "common/mss_irq_profile.h"
+#include "common/mss_pc_profile.h"
+#include "common/mss_clk_scale.h"
+#include "common/mss_smode.h"
 #include "common/mss_l2_cache.h"
+#include "common/mss_l2_scratchpad.h"
+#include "common/mss_perf.h"
+#include "common/mss_mem_pool.h"
+#include "common/mss_hart_heap.h"
+#include "common/mss_mem.h"
+#include "common/mss_ddr_region.h"
+#include "common/mss_ddr_scrub.h"
+#include "common/mss_hart_queue.h"
+#include "common/mss_rpmsg.h"
+#include "common/mss_io_offload.h"
+#include "common/mss_park.h"
+#include "common/mss_task_sched.h"
+#include "common/mss_sector_cache.h"
 #include "common/mss_axiswitch.h"
 #include "common/mss_peripherals.h"
+#include "common/mss_bench.h"
+#include "common/mss_idle.h"
+#include "common/mss_load.h"
+#include "common/mss_stack.h"
+#include "common/mss_lz4.h"
+#include "common/mss_checksum.h"
+#include "common/mss_fpu.h"
+#include "common/mss_f2h.h"
+#include "common/mss_suspend.h"
 #include "common/nwc/mss_cfm.h"
 #include "common/nwc/mss_ddr.h"
 #include "common/nwc/mss_sgmii.h"
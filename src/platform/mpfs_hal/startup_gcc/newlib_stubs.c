@@ -337,6 +337,59 @@ caddr_t _sbrk(int incr)
     return ((caddr_t) prev_heap_end);
 }
 
+/*==============================================================================
+ * Serialise the shared newlib heap between harts. newlib calls these around
+ * every malloc(), free() and realloc(), and also around its calls to _sbrk().
+ * The lock is recursive, as some newlib functions take it while they already
+ * hold it. Interrupts are disabled on the hart holding the lock, so that an
+ * interrupt handler using malloc() cannot re-enter the heap.
+ * For allocations which do not contend with other harts, see mss_hart_heap.h.
+ */
+static volatile long g_malloc_lock = 0;
+static uint64_t g_malloc_lock_owner = 0U;
+static uint32_t g_malloc_lock_depth = 0U;
+static uint64_t g_malloc_lock_mstatus = 0U;
+
+struct _reent;
+void __malloc_lock(struct _reent *reent);
+void __malloc_lock(struct _reent *reent)
+{
+    uint64_t hart_id = read_csr(mhartid);
+    uint64_t mstatus;
+
+    (void)reent;
+    mstatus = disable_interrupts();
+
+    if ((0U != g_malloc_lock_depth) && (hart_id == g_malloc_lock_owner))
+    {
+        g_malloc_lock_depth++;
+    }
+    else
+    {
+        spinlock(&g_malloc_lock);
+        g_malloc_lock_owner = hart_id;
+        g_malloc_lock_depth = 1U;
+        g_malloc_lock_mstatus = mstatus;
+    }
+}
+
+void __malloc_unlock(struct _reent *reent);
+void __malloc_unlock(struct _reent *reent)
+{
+    uint64_t mstatus = g_malloc_lock_mstatus;
+
+    (void)reent;
+
+    g_malloc_lock_depth--;
+
+    if (0U == g_malloc_lock_depth)
+    {
+        mb();
+        spinunlock(&g_malloc_lock);
+        restore_interrupts(mstatus);
+    }
+}
+
 /*==============================================================================
  * Status of a file (by name).
  */
@@ -33,8 +33,134 @@
 #ifdef  MPFS_HAL_HW_CONFIG
 #include "../common/nwc/mss_nwc_init.h"
 #include "system_startup_defs.h"
+#elif defined(MPFS_HAL_PARALLEL_INIT_MEMORY) || defined(MPFS_HAL_BOOT_TRACE)
+#include "system_startup_defs.h"
 #endif
 
+#if (defined(MPFS_HAL_HW_CONFIG) && defined(MPFS_HAL_PARALLEL_HART_WAKE)) || \
+    defined(MPFS_HAL_PARALLEL_INIT_MEMORY) || defined(MPFS_HAL_BOOT_TRACE)
+/*==============================================================================
+ * Returns the HLS of each hart, located below the top of its stack.
+ */
+static HLS_DATA* hart_hls(uint8_t hart_id)
+{
+    ptrdiff_t stack_top;
+
+    switch (hart_id)
+    {
+        case 1:
+            stack_top = (ptrdiff_t)((uint8_t*)&__stack_top_h1$);
+            break;
+        case 2:
+            stack_top = (ptrdiff_t)((uint8_t*)&__stack_top_h2$);
+            break;
+        case 3:
+            stack_top = (ptrdiff_t)((uint8_t*)&__stack_top_h3$);
+            break;
+        case 4:
+            stack_top = (ptrdiff_t)((uint8_t*)&__stack_top_h4$);
+            break;
+        default:
+            stack_top = (ptrdiff_t)((uint8_t*)&__stack_top_h0$);
+            break;
+    }
+
+    return ((HLS_DATA*)(stack_top - HLS_DEBUG_AREA_SIZE));
+}
+#endif
+
+#if defined(MPFS_HAL_HW_CONFIG) && defined(MPFS_HAL_PARALLEL_HART_WAKE)
+/*==============================================================================
+ * Wakes harts MPFS_HAL_FIRST_HART + 1 to MPFS_HAL_LAST_HART together.
+ * Each hart is sent its soft interrupt as soon as it reports being in wfi,
+ * without waiting for the previous harts to leave wfi, and the
+ * acknowledgements are collected in any order. As in the serial sequence, the
+ * soft interrupt is sent again to a hart still reporting wfi after a few
+ * polling rounds, as a debugger halt may have taken it out of wfi early.
+ */
+static void wake_other_harts(void)
+{
+    HLS_DATA* hls;
+    uint32_t wait_count[MPFS_HAL_LAST_HART + 1U] = { 0U };
+    uint8_t sent[MPFS_HAL_LAST_HART + 1U] = { 0U };
+    uint8_t pending = 0U;
+    uint8_t hart_id;
+
+    for (hart_id = MPFS_HAL_FIRST_HART + 1U; hart_id <= MPFS_HAL_LAST_HART;
+            hart_id++)
+    {
+        pending |= (uint8_t)(1U << hart_id);
+    }
+
+    while (0U != pending)
+    {
+        for (hart_id = MPFS_HAL_FIRST_HART + 1U; hart_id <= MPFS_HAL_LAST_HART;
+                hart_id++)
+        {
+            if (0U != (pending & (uint8_t)(1U << hart_id)))
+            {
+                hls = hart_hls(hart_id);
+
+                if (hls->in_wfi_indicator == HLS_OTHER_HART_PASSED_WFI)
+                {
+                    pending &= (uint8_t)~(1U << hart_id);
+                }
+                else if (hls->in_wfi_indicator == HLS_OTHER_HART_IN_WFI)
+                {
+                    if ((0U == sent[hart_id]) || (wait_count[hart_id] > 0x10U))
+                    {
+                        hls->my_hart_id = hart_id; /* record hartid locally */
+                        raise_soft_interrupt(hart_id);
+                        sent[hart_id] = 1U;
+                        wait_count[hart_id] = 0U;
+                    }
+                    else
+                    {
+                        wait_count[hart_id]++;
+                    }
+                }
+                else
+                {
+                    /* hart not yet waiting for the main hart */
+                }
+            }
+        }
+    }
+}
+#endif  /* MPFS_HAL_HW_CONFIG && MPFS_HAL_PARALLEL_HART_WAKE */
+
+#ifdef MPFS_HAL_BOOT_TRACE
+/*==============================================================================
+ * Records an entry in the boot trace held in the HLS of the calling hart,
+ * pointed to by tp. The PC recorded is the return address of the call.
+ * Use the BOOT_TRACE() macro, which compiles to nothing unless
+ * MPFS_HAL_BOOT_TRACE is defined.
+ */
+__attribute__((noinline)) void boot_trace_record(uint16_t tag)
+{
+    BOOT_TRACE_DATA * trace =\
+            (BOOT_TRACE_DATA *)(get_tp_reg() + HLS_BOOT_TRACE_OFFSET);
+    uint32_t count = trace->count;
+
+    if (count < trace->max_entries)
+    {
+        trace->entry[count].tag_pc = ((uint64_t)tag << BOOT_TRACE_TAG_SHIFT) |\
+            ((uint64_t)__builtin_return_address(0) & BOOT_TRACE_PC_MASK);
+        trace->entry[count].mcycle = readmcycle();
+    }
+    trace->count = count + 1U;
+}
+
+/*==============================================================================
+ * Returns the boot trace of a hart, so that it can be dumped once the boot is
+ * complete. mcycle of each hart counts from its reset.
+ */
+const BOOT_TRACE_DATA * boot_trace_get(uint8_t hart_id)
+{
+    return ((const BOOT_TRACE_DATA *)((uint8_t *)hart_hls(hart_id) +\
+            HLS_BOOT_TRACE_OFFSET));
+}
+#endif  /* MPFS_HAL_BOOT_TRACE */
 
 /*==============================================================================
  * This function is called by the lowest enabled hart (MPFS_HAL_FIRST_HART) in
@@ -55,6 +181,8 @@ __attribute__((weak)) int main_first_hart(HLS_DATA* hls)
         uint8_t hart_id;
         ptrdiff_t stack_top;
 
+        BOOT_TRACE(BOOT_TRACE_MAIN_FIRST_HART);
+
         /*
          * We only use code within the conditional compile
          * #ifdef MPFS_HAL_HW_CONFIG
@@ -65,9 +193,15 @@ __attribute__((weak)) int main_first_hart(HLS_DATA* hls)
          */
 #ifdef  MPFS_HAL_HW_CONFIG
         config_l2_cache();
+        BOOT_TRACE(BOOT_TRACE_L2_CACHE);
 #endif  /* MPFS_HAL_HW_CONFIG */
 
+#ifdef MPFS_HAL_PARALLEL_INIT_MEMORY
+        init_memory_parallel();
+#else
         init_memory();
+#endif
+        BOOT_TRACE(BOOT_TRACE_INIT_MEMORY);
 #ifndef MPFS_HAL_HW_CONFIG
         hls->my_hart_id = MPFS_HAL_FIRST_HART;
 #endif
@@ -77,6 +211,7 @@ __attribute__((weak)) int main_first_hart(HLS_DATA* hls)
         (void)init_mem_protection_unit();
         (void)init_pmp((uint8_t)MPFS_HAL_FIRST_HART);
         (void)mss_set_apb_bus_cr((uint32_t)LIBERO_SETTING_APBBUS_CR);
+        BOOT_TRACE(BOOT_TRACE_PROTECTION);
 #endif  /* MPFS_HAL_HW_CONFIG */
         /*
          * Initialise NWC
@@ -87,9 +222,28 @@ __attribute__((weak)) int main_first_hart(HLS_DATA* hls)
          */
 #ifdef  MPFS_HAL_HW_CONFIG
         (void)mss_nwc_init();
+        BOOT_TRACE(BOOT_TRACE_NWC_INIT);
 
         /* main hart init's the PLIC */
         PLIC_init_on_reset();
+        BOOT_TRACE(BOOT_TRACE_PLIC_INIT);
+
+#ifdef DDR_SELF_REFRESH_RESUME
+        /*
+         * Resuming from DDR self-refresh: the PLIC and L2 way masks are
+         * restored and the DDR holds the suspended state, which the DDR
+         * sections must not overwrite. See mss_suspend.h.
+         */
+        if (mss_resume_check() == 0U)
+#endif
+        {
+#ifdef MPFS_HAL_SECTION_TABLE
+            if ((LIBERO_SETTING_DDRPHY_MODE & DDRPHY_MODE_MASK) != DDR_OFF_MODE)
+            {
+                init_ddr_sections();
+            }
+#endif
+        }
         /*
          * Start the other harts. They are put in wfi in entry.S
          * When debugging, harts are released from reset separately,
@@ -99,6 +253,9 @@ __attribute__((weak)) int main_first_hart(HLS_DATA* hls)
         hls = (HLS_DATA*)(stack_top - HLS_DEBUG_AREA_SIZE);
         hls->in_wfi_indicator = HLS_MAIN_HART_STARTED;
         hls->my_hart_id = MPFS_HAL_FIRST_HART;
+#ifdef MPFS_HAL_PARALLEL_HART_WAKE
+        wake_other_harts();
+#else
         WFI_SM sm_check_thread = INIT_THREAD_PR;
         hart_id = MPFS_HAL_FIRST_HART + 1U;
         while( hart_id <= MPFS_HAL_LAST_HART)
@@ -168,6 +325,8 @@ __attribute__((weak)) int main_first_hart(HLS_DATA* hls)
                     break;
             }
         }
+#endif  /* MPFS_HAL_PARALLEL_HART_WAKE */
+        BOOT_TRACE(BOOT_TRACE_HARTS_WOKEN);
         stack_top = (ptrdiff_t)((uint8_t*)&__stack_top_h0$);
         hls = (HLS_DATA*)(stack_top - HLS_DEBUG_AREA_SIZE);
         hls->in_wfi_indicator = HLS_MAIN_HART_FIN_INIT;
@@ -293,6 +452,8 @@ __attribute__((weak)) int main_other_hart(HLS_DATA* hls)
     const uint64_t app_stack_top_h3 = (const uint64_t)&__app_stack_top_h3 - (HLS_DEBUG_AREA_SIZE);
     const uint64_t app_stack_top_h4 = (const uint64_t)&__app_stack_top_h4 - (HLS_DEBUG_AREA_SIZE);
 
+    BOOT_TRACE(BOOT_TRACE_MAIN_OTHER_HART);
+
 #ifdef  MPFS_HAL_HW_CONFIG
 #ifdef  MPFS_HAL_SHARED_MEM_ENABLED
     /*
@@ -321,6 +482,17 @@ __attribute__((weak)) int main_other_hart(HLS_DATA* hls)
 
     volatile uint64_t dummy;
 
+#ifdef DDR_SELF_REFRESH_RESUME
+    /* Does not return if the hart was suspended, see mss_suspend.h */
+    mss_resume_hart((uint8_t)hls->my_hart_id);
+#endif
+
+    BOOT_TRACE(BOOT_TRACE_APPLICATION);
+
+#ifdef MPFS_HAL_STACK_WATERMARK
+    mss_stack_paint_app();
+#endif
+
     switch(hls->my_hart_id)
     {
 
@@ -332,25 +504,41 @@ __attribute__((weak)) int main_other_hart(HLS_DATA* hls)
     case 1U:
         (void)init_pmp((uint8_t)1);
         __asm volatile ("add sp, x0, %1" : "=r"(dummy) : "r"(app_stack_top_h1));
+#ifdef MPFS_HAL_SMODE_APP
+        mss_smode_enter(&u54_1);
+#else
         u54_1();
+#endif
         break;
 
     case 2U:
         (void)init_pmp((uint8_t)2);
         __asm volatile ("add sp, x0, %1" : "=r"(dummy) : "r"(app_stack_top_h2));
+#ifdef MPFS_HAL_SMODE_APP
+        mss_smode_enter(&u54_2);
+#else
         u54_2();
+#endif
         break;
 
     case 3U:
         (void)init_pmp((uint8_t)3);
         __asm volatile ("add sp, x0, %1" : "=r"(dummy) : "r"(app_stack_top_h3));
+#ifdef MPFS_HAL_SMODE_APP
+        mss_smode_enter(&u54_3);
+#else
         u54_3();
+#endif
         break;
 
     case 4U:
         (void)init_pmp((uint8_t)4);
         __asm volatile ("add sp, x0, %1" : "=r"(dummy) : "r"(app_stack_top_h4));
+#ifdef MPFS_HAL_SMODE_APP
+        mss_smode_enter(&u54_4);
+#else
         u54_4();
+#endif
         break;
 
     default:
@@ -404,8 +592,12 @@ void load_virtual_rom(void)
  * This function relies on load_virtual_rom() having been called previously to
  * populate the virtual ROM with a suitable executable.
  */
-static void park_hart(void)
+void park_hart(void)
 {
+#ifdef MPFS_HAL_LOAD_ACCOUNTING
+    /* Idle for good */
+    mss_load_idle_enter();
+#endif
     clear_csr(mstatus, MSTATUS_MIE);
     __asm volatile("fence.i");
     __asm volatile("li ra,0x20003120");
@@ -478,22 +670,283 @@ __attribute__((weak)) void u54_4(void)
      park_hart();
 }
 
+#ifdef MPFS_HAL_LZ4_LOAD
+/*------------------------------------------------------------------------------
+ * Decodes a section whose load image is an LZ4 legacy frame, copies it
+ * otherwise. A section which is not decoded fully is left as it is, as there
+ * is nothing else to boot.
+ */
+static void load_section
+(
+    uint64_t * p_load,
+    uint64_t * p_start,
+    uint64_t * p_end
+)
+{
+    if ((p_load != p_start) && (0U != mss_lz4_is_frame(p_load)))
+    {
+        (void)mss_lz4_load(p_start,
+                (uint64_t)((uint8_t *)p_end - (uint8_t *)p_start), p_load);
+    }
+    else
+    {
+        copy_section(p_load, p_start, p_end);
+    }
+}
+#else
+#define load_section    copy_section
+#endif  /* MPFS_HAL_LZ4_LOAD */
+
+#ifdef MPFS_HAL_SECTION_TABLE
+/*------------------------------------------------------------------------------
+ * Loads each section of a copy table, entries load/start/end, and zeroes each
+ * section of a zero table, entries start/end. The tables are added to the
+ * linker script by linker_generator/mpfs_linker_generator.py.
+ */
+static void init_section_table
+(
+    uint64_t * p_copy,
+    uint64_t * p_copy_end,
+    uint64_t * p_zero,
+    uint64_t * p_zero_end
+)
+{
+    while (p_copy < p_copy_end)
+    {
+        load_section((uint64_t *)p_copy[0], (uint64_t *)p_copy[1],
+                (uint64_t *)p_copy[2]);
+        p_copy += 3U;
+    }
+
+    while (p_zero < p_zero_end)
+    {
+        zero_section((uint64_t *)p_zero[0], (uint64_t *)p_zero[1]);
+        p_zero += 2U;
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Initialises the generated sections placed in DDR. Called by init_memory()
+ * when the DDR is set up by a previous boot stage, and by main_first_hart()
+ * once the DDR is trained otherwise.
+ */
+__attribute__((weak)) void init_ddr_sections(void)
+{
+    init_section_table(&__ddr_section_copy_table_start,
+            &__ddr_section_copy_table_end, &__ddr_section_zero_table_start,
+            &__ddr_section_zero_table_end);
+
+    mb();
+    __asm volatile("fence.i");
+}
+#endif  /* MPFS_HAL_SECTION_TABLE */
+
  /*-----------------------------------------------------------------------------
   * _start() function called invoked
   * This function is called on power up and warm reset.
   */
  __attribute__((weak)) void init_memory( void)
  {
-    copy_section(&__text_load, &__text_start, &__text_end);
-    copy_section(&__sdata_load, &__sdata_start, &__sdata_end);
-    copy_section(&__data_load, &__data_start, &__data_end);
+    load_section(&__text_load, &__text_start, &__text_end);
+    load_section(&__sdata_load, &__sdata_start, &__sdata_end);
+    load_section(&__data_load, &__data_start, &__data_end);
+    load_section(&__l2_scratchpad_load, &__l2_scratchpad_start,
+            &__l2_scratchpad_end);
+#ifdef MPFS_HAL_HOT_TEXT
+    load_section(&__hot_text_load, &__hot_text_start, &__hot_text_end);
+    mb();
+    __asm volatile("fence.i");
+#endif
 
     zero_section(&__sbss_start, &__sbss_end);
     zero_section(&__bss_start, &__bss_end);
+    zero_section(&__l2_scratchpad_bss_start, &__l2_scratchpad_bss_end);
+
+#ifdef MPFS_HAL_SECTION_TABLE
+    init_section_table(&__section_copy_table_start, &__section_copy_table_end,
+            &__section_zero_table_start, &__section_zero_table_end);
+#ifndef MPFS_HAL_HW_CONFIG
+    init_ddr_sections();
+#endif
+#endif  /* MPFS_HAL_SECTION_TABLE */
 
     __disable_all_irqs();      /* disables local and global interrupt enable */
  }
 
+#ifdef MPFS_HAL_PARALLEL_INIT_MEMORY
+/*------------------------------------------------------------------------------
+ * Copies, or zeroes when p_load is NULL, the share of a section belonging to
+ * the hart with index share out of the harts MPFS_HAL_FIRST_HART to
+ * MPFS_HAL_LAST_HART. The shares are whole cache lines so that no two harts
+ * write to the same line.
+ */
+static void init_section_share
+(
+    uint64_t * p_load,
+    uint64_t * p_start,
+    uint64_t * p_end,
+    uint64_t share
+)
+{
+    const uint64_t nb_harts = (MPFS_HAL_LAST_HART - MPFS_HAL_FIRST_HART) + 1U;
+    uint64_t words = (uint64_t)(p_end - p_start);
+    uint64_t share_words = (((words + nb_harts) - 1U) / nb_harts);
+    uint64_t first;
+    uint64_t last;
+
+    share_words = (share_words + 7U) & ~7ULL;
+    first = share * share_words;
+    last = first + share_words;
+
+    if (first > words)
+    {
+        first = words;
+    }
+
+    if (last > words)
+    {
+        last = words;
+    }
+
+    if (NULL == p_load)
+    {
+        zero_section(p_start + first, p_start + last);
+    }
+    else
+    {
+        copy_section(p_load + first, p_start + first, p_start + last);
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Initialises the share of a section with a load image belonging to the hart
+ * with index share. A section whose load image is an LZ4 legacy frame is
+ * shared by frame block instead, block N being decoded by the hart with index
+ * (N + section) % the number of harts, so that the harts decoding the first
+ * block of each section are spread out.
+ */
+static void load_section_share
+(
+    uint64_t * p_load,
+    uint64_t * p_start,
+    uint64_t * p_end,
+    uint64_t share,
+    uint64_t section
+)
+{
+#ifdef MPFS_HAL_LZ4_LOAD
+    const uint64_t nb_harts = (MPFS_HAL_LAST_HART - MPFS_HAL_FIRST_HART) + 1U;
+
+    if ((p_load != p_start) && (0U != mss_lz4_is_frame(p_load)))
+    {
+        (void)mss_lz4_load_share(p_start,
+                (uint64_t)((uint8_t *)p_end - (uint8_t *)p_start), p_load,
+                ((share + nb_harts) - (section % nb_harts)) % nb_harts,
+                nb_harts);
+    }
+    else
+    {
+        init_section_share(p_load, p_start, p_end, share);
+    }
+#else
+    (void)section;
+    init_section_share(p_load, p_start, p_end, share);
+#endif  /* MPFS_HAL_LZ4_LOAD */
+}
+
+/*------------------------------------------------------------------------------
+ * Initialises the share of each section of init_memory() belonging to the
+ * hart. Called by every hart from MPFS_HAL_FIRST_HART to MPFS_HAL_LAST_HART
+ * when MPFS_HAL_PARALLEL_INIT_MEMORY is defined, the other harts calling it
+ * from entry.S before they go into wfi. It must not use any .data or .bss
+ * variable.
+ */
+__attribute__((weak)) void init_memory_hart(uint64_t hart_id)
+{
+    const uint64_t share = hart_id - MPFS_HAL_FIRST_HART;
+#ifdef MPFS_HAL_SECTION_TABLE
+    uint64_t * p_entry;
+    uint64_t section = 5U;
+#endif
+
+    load_section_share(&__text_load, &__text_start, &__text_end, share, 0U);
+    load_section_share(&__sdata_load, &__sdata_start, &__sdata_end, share, 1U);
+    load_section_share(&__data_load, &__data_start, &__data_end, share, 2U);
+    load_section_share(&__l2_scratchpad_load, &__l2_scratchpad_start,
+            &__l2_scratchpad_end, share, 3U);
+#ifdef MPFS_HAL_HOT_TEXT
+    load_section_share(&__hot_text_load, &__hot_text_start, &__hot_text_end,
+            share, 4U);
+#endif
+
+    init_section_share(NULL, &__sbss_start, &__sbss_end, share);
+    init_section_share(NULL, &__bss_start, &__bss_end, share);
+    init_section_share(NULL, &__l2_scratchpad_bss_start,
+            &__l2_scratchpad_bss_end, share);
+
+#ifdef MPFS_HAL_SECTION_TABLE
+    p_entry = &__section_copy_table_start;
+
+    while (p_entry < &__section_copy_table_end)
+    {
+        load_section_share((uint64_t *)p_entry[0], (uint64_t *)p_entry[1],
+                (uint64_t *)p_entry[2], share, section);
+        p_entry += 3U;
+        section++;
+    }
+
+    p_entry = &__section_zero_table_start;
+
+    while (p_entry < &__section_zero_table_end)
+    {
+        init_section_share(NULL, (uint64_t *)p_entry[0],
+                (uint64_t *)p_entry[1], share);
+        p_entry += 2U;
+    }
+#endif  /* MPFS_HAL_SECTION_TABLE */
+}
+
+/*------------------------------------------------------------------------------
+ * Parallel version of init_memory(), called by main_first_hart().
+ * The other harts, waiting in entry.S for the main hart to start, are asked
+ * to initialise their share of the sections through the HLS of hart 0, and
+ * this function returns once they have all flagged they are done. All the
+ * harts up to MPFS_HAL_LAST_HART must therefore be running.
+ */
+__attribute__((weak)) void init_memory_parallel(void)
+{
+    HLS_DATA* hls;
+    uint8_t hart_id;
+
+    hls = hart_hls(0U);
+    hls->in_wfi_indicator = HLS_MAIN_HART_INIT_MEMORY;
+    mb();
+
+    init_memory_hart(MPFS_HAL_FIRST_HART);
+
+    for (hart_id = MPFS_HAL_FIRST_HART + 1U; hart_id <= MPFS_HAL_LAST_HART;
+            hart_id++)
+    {
+        hls = hart_hls(hart_id);
+
+        while (hls->in_wfi_indicator != HLS_OTHER_HART_INIT_MEMORY_DONE)
+        {
+            ;
+        }
+    }
+
+#if defined(MPFS_HAL_SECTION_TABLE) && !defined(MPFS_HAL_HW_CONFIG)
+    init_ddr_sections();
+#endif
+
+    /* Code copied by the other harts */
+    mb();
+    __asm volatile("fence.i");
+
+    __disable_all_irqs();      /* disables local and global interrupt enable */
+}
+#endif  /* MPFS_HAL_PARALLEL_INIT_MEMORY */
+
  /*-----------------------------------------------------------------------------
    * _start() function called invoked
    * This function is called on power up and warm reset.
@@ -16,6 +16,10 @@
 #ifndef SYSTEM_STARTUP_H
 #define SYSTEM_STARTUP_H
 
+#ifdef MPFS_HAL_BOOT_TRACE
+#include "system_startup_defs.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -53,8 +57,45 @@ typedef struct HLS_DATA_
     volatile uint32_t shared_mem_marker;
     volatile uint32_t shared_mem_status;
     volatile uint64_t * shared_mem;
+    /* Runtime parking, see mss_park.h */
+    volatile uint32_t park_state;
+    uint32_t park_count;
+    uint64_t park_mie;          /* mie and mstatus put back on wake */
+    uint64_t park_mstatus;
 } HLS_DATA;
 
+#ifdef MPFS_HAL_BOOT_TRACE
+/*------------------------------------------------------------------------------
+ * Boot trace of a hart, held in its HLS. See system_startup_defs.h for the
+ * tags recorded by the HAL.
+ * count is the number of BOOT_TRACE() calls made, entries beyond max_entries
+ * are dropped.
+ */
+typedef struct BOOT_TRACE_ENTRY_
+{
+    uint64_t tag_pc;            /* tag in bits 63:48, PC in bits 47:0 */
+    uint64_t mcycle;
+} BOOT_TRACE_ENTRY;
+
+typedef struct BOOT_TRACE_DATA_
+{
+    volatile uint32_t count;
+    uint32_t max_entries;
+    uint64_t reserved;
+    BOOT_TRACE_ENTRY entry[MPFS_HAL_BOOT_TRACE_ENTRIES];
+} BOOT_TRACE_DATA;
+
+void boot_trace_record(uint16_t tag);
+const BOOT_TRACE_DATA * boot_trace_get(uint8_t hart_id);
+
+/*
+ * Records the tag, the PC and mcycle in the boot trace of the calling hart
+ */
+#define BOOT_TRACE(tag)         boot_trace_record((uint16_t)(tag))
+#else
+#define BOOT_TRACE(tag)
+#endif
+
 /*------------------------------------------------------------------------------
  * Symbols from the linker script used to locate the text, data and bss sections.
  */
@@ -89,8 +130,36 @@ extern unsigned long __text_load;
 extern unsigned long __text_start;
 extern unsigned long __text_end;
 
+extern unsigned long __l2_scratchpad_load;
+extern unsigned long __l2_scratchpad_start;
+extern unsigned long __l2_scratchpad_end;
+
+extern unsigned long __l2_scratchpad_bss_start;
+extern unsigned long __l2_scratchpad_bss_end;
+
 extern unsigned long __l2lim_end;
 
+#ifdef MPFS_HAL_HOT_TEXT
+extern unsigned long __hot_text_load;
+extern unsigned long __hot_text_start;
+extern unsigned long __hot_text_end;
+#endif  /* MPFS_HAL_HOT_TEXT */
+
+#ifdef MPFS_HAL_SECTION_TABLE
+/*
+ * Tables of the sections added by linker_generator/mpfs_linker_generator.py,
+ * copy entries load/start/end and zero entries start/end
+ */
+extern unsigned long __section_copy_table_start;
+extern unsigned long __section_copy_table_end;
+extern unsigned long __section_zero_table_start;
+extern unsigned long __section_zero_table_end;
+extern unsigned long __ddr_section_copy_table_start;
+extern unsigned long __ddr_section_copy_table_end;
+extern unsigned long __ddr_section_zero_table_start;
+extern unsigned long __ddr_section_zero_table_end;
+#endif  /* MPFS_HAL_SECTION_TABLE */
+
 extern unsigned long __e51itim_start;
 extern unsigned long __e51itim_end;
 
@@ -111,6 +180,20 @@ extern unsigned long __uninit_bottom$;
 extern unsigned long __uninit_top$;
 #endif
 
+/*
+ * Code and constants of the E51 housekeeping paths, e.g. the monitoring loop,
+ * the system services dispatcher or the watchdog supervisor, run from LIM or
+ * the L2 scratchpad rather than envm when MPFS_HAL_HOT_TEXT is defined. They
+ * are copied by init_memory(), so must not be used before it is called.
+ */
+#ifdef MPFS_HAL_HOT_TEXT
+#define MSS_HOT_TEXT        __attribute__((section(".hot_text")))
+#define MSS_HOT_RODATA      __attribute__((section(".hot_rodata")))
+#else
+#define MSS_HOT_TEXT
+#define MSS_HOT_RODATA
+#endif
+
 /*
  * Function Declarations
  */
@@ -122,6 +205,9 @@ void u54_2(void);
 void u54_3(void);
 void u54_4(void);
 void init_memory( void);
+void init_memory_hart(uint64_t hart_id);
+void init_memory_parallel(void);
+void init_ddr_sections(void);
 void init_ddr( void);
 uint8_t init_mem_protection_unit(void);
 uint8_t init_pmp(uint8_t hart_id);
@@ -146,6 +232,7 @@ void zero_section
     uint64_t * __sbss_end
 );
 void load_virtual_rom(void);
+void park_hart(void);
 
 void count_section
 (
@@ -14,7 +14,7 @@
  */
 
 #ifndef SYSTEM_STARTUP_DEFS_H
-#define SYSTEM_STARTUP_DESF_H
+#define SYSTEM_STARTUP_DEFS_H
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,6 +27,53 @@ extern "C" {
 #define HLS_MAIN_HART_FIN_INIT              0x55555555U
 #define HLS_OTHER_HART_IN_WFI               0x12345678U
 #define HLS_OTHER_HART_PASSED_WFI           0x87654321U
+#define HLS_MAIN_HART_INIT_MEMORY           0x4D454D49U
+
+/*------------------------------------------------------------------------------
+ * Word the stacks are painted with when MPFS_HAL_STACK_WATERMARK is defined,
+ * see mss_stack.h. No suffix, as it is also used in mss_entry.S.
+ */
+#define MSS_STACK_PAINT_WORD                0xA5A5A5A5A5A5A5A5
+#define HLS_OTHER_HART_INIT_MEMORY_DONE     0x4D454D44U
+
+/*------------------------------------------------------------------------------
+ * Boot trace, enabled by MPFS_HAL_BOOT_TRACE
+ * The trace of each hart is held in its HLS, after the HLS_DATA. It starts
+ * with the number of entries recorded and the number of entries it can hold.
+ * Each entry holds the tag in bits 63:48 and the PC in bits 47:0 of its first
+ * double word, and mcycle in its second.
+ */
+#if !defined (MPFS_HAL_BOOT_TRACE_ENTRIES)
+#define MPFS_HAL_BOOT_TRACE_ENTRIES     16
+#endif
+#define HLS_BOOT_TRACE_OFFSET           48
+#define HLS_BOOT_TRACE_HEADER_SIZE      16
+#define HLS_BOOT_TRACE_ENTRY_SIZE       16
+#define BOOT_TRACE_TAG_SHIFT            48
+#define BOOT_TRACE_PC_MASK              0x0000FFFFFFFFFFFFULL
+
+#if defined(MPFS_HAL_BOOT_TRACE) && (IMAGE_LOADED_BY_BOOTLOADER != 0)
+#error MPFS_HAL_BOOT_TRACE needs the HLS allocated from reset
+#endif
+
+/*
+ * Boot trace tags recorded by the HAL. Tags from BOOT_TRACE_USER may be used
+ * by the application.
+ */
+#define BOOT_TRACE_RESET                0x01    /* mss_entry.S, HLS cleared   */
+#define BOOT_TRACE_MAIN_FIRST_HART      0x02
+#define BOOT_TRACE_L2_CACHE             0x03    /* config_l2_cache() done     */
+#define BOOT_TRACE_INIT_MEMORY          0x04    /* init_memory() done         */
+#define BOOT_TRACE_PROTECTION           0x05    /* BEU, MPU and PMP set up    */
+#define BOOT_TRACE_NWC_SGMII            0x06    /* sgmii_setup() done         */
+#define BOOT_TRACE_NWC_PLL              0x07    /* mss_pll_config() done      */
+#define BOOT_TRACE_NWC_DDR              0x08    /* DDR training done          */
+#define BOOT_TRACE_NWC_INIT             0x09    /* mss_nwc_init() done        */
+#define BOOT_TRACE_PLIC_INIT            0x0A    /* PLIC_init_on_reset() done  */
+#define BOOT_TRACE_HARTS_WOKEN          0x0B    /* other harts out of wfi     */
+#define BOOT_TRACE_MAIN_OTHER_HART      0x0C
+#define BOOT_TRACE_APPLICATION          0x0D    /* e51()/u54_N() called       */
+#define BOOT_TRACE_USER                 0x100
 
 /*------------------------------------------------------------------------------
  * Define the size of the HLS used
@@ -36,11 +83,18 @@ extern "C" {
  *
  */
 #if !defined (HLS_DEBUG_AREA_SIZE)
+#if defined(MPFS_HAL_BOOT_TRACE)
+#define HLS_DEBUG_AREA_SIZE     (HLS_BOOT_TRACE_OFFSET + \
+                                 HLS_BOOT_TRACE_HEADER_SIZE + \
+                                 (MPFS_HAL_BOOT_TRACE_ENTRIES * \
+                                  HLS_BOOT_TRACE_ENTRY_SIZE))
+#else
 #define HLS_DEBUG_AREA_SIZE     64
 #endif
+#endif
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif /* SYSTEM_STARTUP_DESF_H */
+#endif /* SYSTEM_STARTUP_DEFS_H */
@@ -153,6 +153,150 @@
 #define MPFS_HAL_CLEAR_MEMORY  1
 #endif
 
+/*
+ * Nested external interrupts
+ * Uncomment to let external interrupts of a higher PLIC priority preempt the
+ * handler of the external interrupt being serviced. Each nesting level uses
+ * one more trap context on the stack of the hart, so the stack size must allow
+ * for the number of priority levels used.
+ */
+/* #define MPFS_HAL_NESTED_EXT_INTERRUPTS */
+
+/*
+ * Vectored interrupts
+ * Uncomment to use the vectored mode of mtvec. The machine software, timer,
+ * external and local interrupts then enter their handler through a stub which
+ * only saves the caller saved registers, instead of saving the full integer
+ * context and decoding mcause in trap_from_machine_mode().
+ */
+/* #define MPFS_HAL_VECTORED_INTERRUPTS */
+
+/*
+ * Interrupt profiling
+ * Uncomment to record the number of interrupts and the cycles spent in the
+ * handlers of the machine timer, local and external interrupts, for each hart
+ * and source. See mss_irq_profile.h.
+ */
+/* #define MPFS_HAL_IRQ_PROFILING */
+
+/*
+ * Sharded driver statistics
+ * Uncomment to keep the driver statistics declared as mss_stat_t, e.g. the
+ * Ethernet MAC queue counts, in one cache line per hart, so that harts taking
+ * the interrupts or sending on the same queue do not share a line. Each
+ * statistic then uses sizeof(mss_counter_t) bytes. See mss_counter.h.
+ */
+/* #define MPFS_HAL_SHARDED_COUNTERS */
+
+/*
+ * Load accounting
+ * Uncomment to count for each hart the mcycle cycles spent busy, in wfi and in
+ * the trap handlers, so that the utilisation of the harts can be read at run
+ * time. See mss_load.h.
+ */
+/* #define MPFS_HAL_LOAD_ACCOUNTING */
+
+/*
+ * Stack high water marks
+ * Uncomment to paint the start-up and application stacks of the harts at
+ * start-up, so that the deepest use of each stack and of each HLS can be
+ * reported at run time. Only for images run from reset. See mss_stack.h.
+ */
+/* #define MPFS_HAL_STACK_WATERMARK */
+
+/*
+ * Define MPFS_HAL_MEMCPY_PDMA_THRESHOLD to have mpfs_memcpy() and mpfs_memset()
+ * hand requests of at least that many bytes to the PDMA. It must not be less
+ * than MSS_PDMA_COPY_THRESHOLD. See mss_mem.h.
+ */
+/* #define MPFS_HAL_MEMCPY_PDMA_THRESHOLD 4096U */
+
+/*
+ * Define MPFS_HAL_LOCK_STATS to count the acquisitions, contentions and
+ * polling loops of each lock of mss_lock.h.
+ */
+/* #define MPFS_HAL_LOCK_STATS */
+
+/*
+ * Define MPFS_HAL_PARALLEL_HART_WAKE to have main_first_hart() send the soft
+ * interrupt to every U54 as soon as it is in wfi and collect the
+ * acknowledgements in any order, instead of waking the harts one at a time.
+ * The harts then run their own start-up code in parallel.
+ */
+/* #define MPFS_HAL_PARALLEL_HART_WAKE */
+
+/*
+ * Define MPFS_HAL_PARALLEL_INIT_MEMORY to split the copy of .text, .data and
+ * the L2 scratchpad image, and the zeroing of the .bss sections, across harts
+ * MPFS_HAL_FIRST_HART to MPFS_HAL_LAST_HART at boot, instead of having the
+ * main hart do it all before the other harts are woken. All these harts must
+ * be running, so do not use it when the harts are released from reset
+ * separately by a debugger.
+ */
+/* #define MPFS_HAL_PARALLEL_INIT_MEMORY */
+
+/*
+ * Define MPFS_HAL_LZ4_LOAD to have init_memory(), and init_memory_hart() when
+ * MPFS_HAL_PARALLEL_INIT_MEMORY is defined, decode the .text, .sdata, .data
+ * and L2 scratchpad sections whose load image is an LZ4 legacy frame, instead
+ * of copying them, e.g. for the mpfs-envm-lma-scratchpad-vma.ld flow. Less
+ * flash is then read at boot. Sections stored raw are still copied. With
+ * MPFS_HAL_PARALLEL_INIT_MEMORY, the frame blocks of 8MB are shared out
+ * between the harts. A section is compressed after the image is linked, e.g.
+ *   riscv64-unknown-elf-objcopy -O binary --only-section=.text app.elf text.bin
+ *   lz4 -l -9 text.bin text.lz4
+ *   riscv64-unknown-elf-objcopy --update-section .text=text.lz4 app.elf
+ * and the same for the other sections. To shrink the flash footprint as well,
+ * the load addresses of the sections following a compressed one must be moved
+ * down in the linker script. See mss_lz4.h.
+ */
+/* #define MPFS_HAL_LZ4_LOAD */
+
+/*
+ * Define MPFS_HAL_SECTION_TABLE when the linker script is generated by
+ * linker_generator/mpfs_linker_generator.py, which adds named sections, e.g.
+ * .fast_text in LIM, .fast_data in the L2 scratchpad or .dma_nocache in
+ * non-cached DDR, and tables listing them. init_memory() and
+ * init_memory_hart() then load or zero the on-chip sections along with the
+ * others. The DDR sections are initialised by init_ddr_sections(), from
+ * main_first_hart() once the DDR is trained when MPFS_HAL_HW_CONFIG is
+ * defined, from init_memory() otherwise.
+ */
+/* #define MPFS_HAL_SECTION_TABLE */
+
+/*
+ * Define MPFS_HAL_HOT_TEXT to run the code and constants tagged MSS_HOT_TEXT
+ * and MSS_HOT_RODATA, e.g. the machine mode trap path, from LIM rather than
+ * from eNVM, where each miss of the E51 instruction cache stalls on the eNVM.
+ * init_memory() copies the .hot_text section from its load address before
+ * the E51 enables interrupts. The linker script must provide .hot_text, as
+ * the reference mpfs-envm*.ld scripts do.
+ */
+/* #define MPFS_HAL_HOT_TEXT */
+
+/*
+ * Define MPFS_HAL_BOOT_TRACE to record a boot trace in the HLS of each hart,
+ * from reset to the call of e51()/u54_N(). Each entry of the trace holds a
+ * tag, the PC and mcycle, see system_startup_defs.h. The trace of each hart
+ * can be read after boot using boot_trace_get(), and further entries added
+ * using BOOT_TRACE(). HLS_DEBUG_AREA_SIZE is increased to hold
+ * MPFS_HAL_BOOT_TRACE_ENTRIES entries. Only for images run from reset.
+ */
+/* #define MPFS_HAL_BOOT_TRACE */
+/* #define MPFS_HAL_BOOT_TRACE_ENTRIES 16 */
+
+/*
+ * Define MPFS_HAL_NWC_WARM_START to shorten mss_nwc_init() after a warm reset,
+ * e.g. following a watchdog reset of the MSS. If the SGMII IO calibration,
+ * SGMII PLL and DLL are still locked with the Libero settings, the SGMII PHY
+ * is not calibrated again and only the MACs and channels are set up. If the
+ * MSS PLL is still locked with the Libero settings and feeding the MSS, it is
+ * not re-locked and only the MSS clock dividers are set. See
+ * sgmii_config_check() and mss_pll_config_check(). DDR training is still run,
+ * as the DDR controller is reset with the MSS.
+ */
+/* #define MPFS_HAL_NWC_WARM_START */
+
 /*
  * Comment out the lines to disable the corresponding hardware support not required
  * in your application.
@@ -182,6 +326,92 @@
 //#define DEBUG_DDR_CFG_DDR_SGMII_PHY
 //#define DEBUG_DDR_DDRCFG
 
+/*
+ * Keep the DDR training results between boots
+ * The results of a full training are passed to ddr_calib_cache_save(), and
+ * the next boot trains with the offsets and bank voltage returned by
+ * ddr_calib_cache_load() and restores the write calibration instead of
+ * sweeping for them, falling back to full training if a quick memory test
+ * fails. Both functions are weakly linked, implement them in your application
+ * to save the results to eNVM or sNVM.
+ */
+//#define DDR_CALIB_CACHE
+
+/*
+ * Suspend with the DDR in self-refresh and resume without a cold boot
+ * mss_suspend() saves the hart contexts, PMP, PLIC and L2 way masks in a
+ * record at MSS_SUSPEND_RECORD_ADDR in the DDR and puts the DDR in
+ * self-refresh. On the next boot, when mss_resume_flag_read() returns the
+ * flag written on suspend, the DDR is taken out of self-refresh with the
+ * results of DDR_CALIB_CACHE, which must also be defined, with no memory tests
+ * and the harts return to their saved context. See mss_suspend.h.
+ */
+//#define DDR_SELF_REFRESH_RESUME
+//#define MSS_SUSPEND_RECORD_ADDR     0xC7FFF000UL
+
+/*
+ * Record the time spent in each DDR training phase
+ * See get_ddr_training_timing(). The times are also printed at the end of
+ * training when DEBUG_DDR_INIT is defined.
+ */
+//#define DDR_TRAINING_TIMING
+
+/*
+ * DDR controller address mapping profile, a reordering of the bank, row and
+ * column bits of the Libero mapping. See ddr_get_addr_map() in mss_ddr.h for
+ * the workloads each one suits, and ddr_addr_map_bench() to compare them.
+ */
+//#define DDR_ADDR_MAP_PROFILE_SELECT DDR_ADDR_MAP_ROW_BANK_COL
+
+/*
+ * Use the MSS RTC for idle wake up and the disciplined clock
+ * Adds mss_idle_wait_rtc() and mss_idle_clock_now() to mss_idle.h. The RTC
+ * driver must be built and the RTC initialized in binary mode.
+ */
+//#define MSS_IDLE_RTC
+
+/*
+ * Emulate misaligned loads and stores
+ * By default a misaligned access traps and the hart waits in a loop. With this
+ * defined, integer loads and stores, including the compressed forms, are made
+ * a byte at a time by the trap handler and execution carries on. Each takes
+ * a trap, so is much slower than an aligned access; see
+ * mss_get_misaligned_stats() to find where they are made. Floating point and
+ * atomic accesses are not emulated.
+ */
+//#define MPFS_HAL_EMULATE_MISALIGNED
+
+/*
+ * Start the U54s with the floating point state initial rather than dirty
+ * mstatus.FS then only becomes dirty once a hart uses floating point, so
+ * mss_fpu_call() and the FreeRTOS context switch save the floating point
+ * registers only on harts, and in tasks, which use them.
+ */
+//#define MPFS_HAL_FPU_LAZY
+
+/*
+ * Block of PMP entries used for the runtime regions of mss_pmp_region.h
+ * Defaults to the 6 entries from entry 8. The entries must not be locked by
+ * the Libero PMP settings.
+ */
+//#define MSS_PMP_REGION_FIRST 8U
+//#define MSS_PMP_REGION_ENTRIES 6U
+
+/*
+ * Take fabric to hart interrupts attached with mss_f2h_attach() in batches
+ * The local interrupt trap calls the handlers of all the attached F2H
+ * interrupts pending on the hart, see mss_f2h.h.
+ */
+//#define MPFS_HAL_F2H_FAST_PATH
+
+/*
+ * Run the U54 applications, u54_1() to u54_4(), in S mode
+ * Their software, timer and external interrupts are taken in S mode, see
+ * mss_smode.h for what the application must use in place of the M mode HAL
+ * functions.
+ */
+//#define MPFS_HAL_SMODE_APP
+
 
 /*
  * The hardware configuration settings imported from Libero project get generated
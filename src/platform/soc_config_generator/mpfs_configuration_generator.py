@@ -15,6 +15,9 @@ from pathlib import Path
 # --------------------------------------------------------------------------------------------
 # mpfs_configuration_generator.py version
 #
+# 0.6.4 added hw_reg_tables.h, initialisers of register image tables in
+#       register order, so contiguous registers are set with a copy loop
+#
 # 0.6.3 target folder name change from "fpga_config" -> fpga_design config, filename 
 #	    hw_platform.h changed to fpga_design_config.h ,
 #		bug fix related to multiple xml file selection and added libero design information 
@@ -49,7 +52,7 @@ def get_script_ver():
     get_xml_ver()
     :return: script version
     '''
-    return "0.6.3"
+    return "0.6.4"
 
 
 
@@ -149,6 +152,29 @@ header_files = ('fpga_design_config,memory_map,hw_memory.h',
                 'fpga_design_config,clocks,hw_clk_sgmii_cfm.h',
                 'fpga_design_config,general,hw_gen_peripherals.h')
 
+# -----------------------------------------------------------------------------
+#  Register image tables, generated into reg_table_file
+#  Each table lists registers of one xml tag in register address order, so the
+#  embedded software can apply it with a copy loop. The values are the
+#  LIBERO_SETTING_ names, so overrides in mss_sw_config.h still apply. A table
+#  is only generated if all its registers are found in the xml.
+#  table name, xml tag, register name prefix, register names
+# -----------------------------------------------------------------------------
+reg_table_file = 'fpga_design_config,memory_map,hw_reg_tables.h'
+
+reg_tables = (('L2_WAY_MASK_PORTS', 'cache', 'none',
+               ('WAY_MASK_DMA', 'WAY_MASK_AXI4_PORT_0', 'WAY_MASK_AXI4_PORT_1',
+                'WAY_MASK_AXI4_PORT_2', 'WAY_MASK_AXI4_PORT_3')),
+              ('L2_WAY_MASK_HARTS', 'cache', 'none',
+               ('WAY_MASK_E51_ICACHE',
+                'WAY_MASK_U54_1_DCACHE', 'WAY_MASK_U54_1_ICACHE',
+                'WAY_MASK_U54_2_DCACHE', 'WAY_MASK_U54_2_ICACHE',
+                'WAY_MASK_U54_3_DCACHE', 'WAY_MASK_U54_3_ICACHE',
+                'WAY_MASK_U54_4_DCACHE', 'WAY_MASK_U54_4_ICACHE')),
+              ('IOMUX', 'io_mux', 'none',
+               ('IOMUX0_CR', 'IOMUX1_CR', 'IOMUX2_CR', 'IOMUX3_CR',
+                'IOMUX4_CR', 'IOMUX5_CR', 'IOMUX6_CR')),)
+
 MAX_LINE_WIDTH = 80
 
 
@@ -429,6 +455,53 @@ def generate_header( file, real_root, root, file_name, tags):
         end_define(headerFile, file_name)
 
 
+# -----------------------------------------------------------------------------
+# Register names of an xml tag
+# -----------------------------------------------------------------------------
+def get_register_names(root, tag):
+    names = []
+    for child in root:
+        for child1 in child:
+            if child1.tag == tag:
+                for child2 in child1.iter('registers'):
+                    for register in child2:
+                        names.append(register.get('name'))
+    return names
+
+
+# -----------------------------------------------------------------------------
+# generate the register image tables header file
+# -----------------------------------------------------------------------------
+def generate_reg_table_header(real_root, table_file, tables):
+    creator = "Microchip-FPGA Embedded Systems Solutions"
+    s = table_file.split(',')
+    file = os.path.join(*s)
+    file_name = s[-1]
+    with open(file, 'w+') as headerFile:
+        WriteCopyright(real_root, headerFile, file_name, creator)
+        start_define(headerFile, file_name)
+        start_cplus(headerFile, file_name)
+        for table in tables:
+            names = get_register_names(real_root, table[1])
+            if all(reg in names for reg in table[3]):
+                if table[2] != 'none':
+                    pre_append = table[2]
+                else:
+                    pre_append = ''
+                name = 'LIBERO_TABLE_' + table[0]
+                headerFile.write('#if !defined ' + '(' + name + ')\n')
+                headerFile.write('#define ' + name + ' { \\\n')
+                for index, reg in enumerate(table[3]):
+                    if index == len(table[3]) - 1:
+                        end = ' }\n'
+                    else:
+                        end = ', \\\n'
+                    headerFile.write('        LIBERO_SETTING_' + pre_append + reg + end)
+                headerFile.write('#endif\n')
+        end_cplus(headerFile, file_name)
+        end_define(headerFile, file_name)
+
+
 # -----------------------------------------------------------------------------
 # fpga_design_config.h header file generation. 
 # -----------------------------------------------------------------------------
@@ -490,6 +563,8 @@ def generate_reference_header_file(ref_header_file, root, header_files):
             include_file = c[0] + '/' + c[1]
             headerFile.write('#include \"' + include_file + '\"\n')
             index += 1
+        c = reg_table_file.split(',')
+        headerFile.write('#include \"' + c[1] + '/' + c[2] + '\"\n')
         # add the c++ define
         start_cplus(headerFile, file_name)
         # no content in this case
@@ -532,6 +607,8 @@ def generate_header_files(output_header_files, input_xml_file, input_xml_tags):
     '''
     generate a header which references all the generated headers
     '''
+    generate_reg_table_header(root, reg_table_file, reg_tables)
+
     file_name = 'fpga_design_config,fpga_design_config.h'
     generate_reference_header_file(file_name, root, output_header_files)
 